@@ -22,6 +22,12 @@
                        [-o output_event_file_prefix]
                        [--flux-ray-generation-surface-distance ]
                        [--flux-ray-generation-surface-radius   ]
+                       [--flux-spectral-index alpha]
+                       [--force-interactions]
+                       [--shard ishard/nshards]
+                       [--coordinate port --blocks n]
+                       [--coordinated-by host:port]
+                       [--threads n_of_threads]
                        [--seed random_number_seed]
                        [--cross-sections xml_file]
                        [--event-generator-list list_name]
@@ -146,6 +152,43 @@
               The argument --flux-ray-generation-surface-distance sets Rl, while              
               the argument --flux-ray-generation-surface-distance sets Rt.
               SI units are used.
+           --flux-spectral-index
+              Generate a weighted flux: the flux neutrino energies are thrown
+              from a E^-alpha power law (rather than from the flux spectrum) and
+              each event is weighted by the ratio of the flux to the power law.
+              Eg. `--flux-spectral-index 1' spreads the events evenly in log(E),
+              populating the high energy tail of the steeply falling spectrum.
+           --force-interactions
+              Every flux neutrino thrown towards the geometry interacts, and
+              each event is weighted by the interaction probability of its
+              neutrino (along its path through the geometry). No flux neutrino
+              is thrown away, which makes it much faster to generate events for
+              small detectors or cross sections. The event weights must be used.
+           --shard
+              Generates shard ishard (0 <= ishard < nshards) of a production
+              split in nshards batch jobs: the shard gets its share of the
+              events, a random number seed and an output file of its own
+              (`_s<ishard>' is inserted in the filename). The exposure of each
+              shard is saved with its events.
+           --coordinate, --blocks
+              Coordinated production: rather than generating events, serve
+              the workers (see --coordinated-by) of a production of the
+              requested events (-n) split into n blocks (the shards of
+              --shard i/n) at the given TCP port. The blocks are handed out
+              on demand, each with its share of the events left, and handed
+              out again if their worker fails or goes silent (eg. pre-empted
+              nodes). The exposure of each block and of the production is
+              written in [prefix].blocks.txt (see genie::JobCoordinator).
+           --coordinated-by
+              Coordinated production worker: once initialised, generate the
+              blocks handed out by the coordinator at host:port, each one as
+              shard i of the production (seed & `_s<i>' output file), until
+              it stops the production. Run all the workers with the same
+              options (but --coordinated-by) on a shared file system.
+           --threads
+              Number of event generation threads (sharing the geometry, each
+              with a flux driver and physics modules of its own).
+              [default: 1]
            -o
               Sets the prefix of the output event file.
               The output filename is built as:
@@ -233,9 +276,16 @@
 #include <vector>
 #include <sstream>
 #include <map>
+#include <atomic>
+#include <mutex>
+#include <thread>
 
+#include <RVersion.h>
+#include <TROOT.h>
 #include <TRotation.h>
+#include <TSystem.h>
 
+#include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/Conventions/Units.h"
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/EventGen/GFluxI.h"
@@ -254,6 +304,7 @@
 #include "Framework/Utils/CmdLnArgParser.h"
 #include "Framework/Utils/PrintUtils.h"
 #include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/JobCoordinator.h"
 #include "Framework/Utils/RunOpt.h"
 
 #ifdef __GENIE_FLUX_DRIVERS_ENABLED__
@@ -281,6 +332,42 @@ void            PrintSyntax        (void);
 GFluxI *        GetFlux            (void);
 GeomAnalyzerI * GetGeometry        (void);
 
+// Events generated by all threads, in order
+//
+class EventSink {
+public:
+  EventSink(long int nevents, NtpWriter & ntpw, GMCJMonitor & mcjmonitor) :
+    fNEvents(nevents), fNClaimed(0), fIEvent(0),
+    fNtpWriter(ntpw), fMCJMonitor(mcjmonitor) { }
+
+  //! claim the next event to generate (false if all have been claimed)
+  bool Claim (void) { return (fNClaimed++ < fNEvents); }
+  //! add a generated event
+  void Add   (EventRecord * event);
+
+private:
+  long int              fNEvents;    ///< events to generate
+  std::atomic<long int> fNClaimed;   ///< events claimed by the threads
+  int                   fIEvent;     ///< events added
+  std::mutex            fMutex;      ///< guards the output ntuple & monitor
+  NtpWriter &           fNtpWriter;
+  GMCJMonitor &         fMCJMonitor;
+};
+
+// An extra event generation thread
+//
+struct AtmoThread {
+  AtmoThread() : geom(0), nflux(0) { }
+  std::thread     thread;
+  GeomAnalyzerI * geom;  ///< shared geometry driver (0: one of its own)
+  string          state; ///< state file of the main job driver
+  long int        nflux; ///< flux neutrinos thrown by the thread
+};
+
+GMCJDriver *    MCJDriver          (GFluxI * flux_driver, GeomAnalyzerI * geom_driver, string state = "");
+void            GenerateEvents     (GMCJDriver & mcj_driver, GFluxI & flux_driver, EventSink & sink);
+void            AtmoThreadMain     (int ithread, long int seed, AtmoThread * thread, EventSink & sink);
+
 // User-specified options:
 //
 Long_t          gOptRunNu;                     // run number
@@ -303,6 +390,13 @@ long int        gOptRanSeed;                   // random number seed
 string          gOptInpXSecFile;               // cross-section splines
 double          gOptRL;                        // distance of flux ray generation surface (m)
 double          gOptRT;                        // radius of flux ray generation surface (m)
+bool            gOptWeightedFlux = false;      // generate a weighted flux?
+double          gOptSpectralIndex = 1.;        // spectral index of the weighted flux
+bool            gOptForceInteractions = false; // force the flux neutrinos to interact?
+int             gOptShard   = -1;              // shard of a sharded production (-1: none)
+int             gOptNShards =  1;              // shards of the production
+int             gOptCoordinatePort = 0;        // coordinator port (0: not the coordinator)
+string          gOptCoordinator = "";          // coordinator host:port (of a coordinated worker)
 
 // Defaults:
 //
@@ -319,6 +413,14 @@ int main(int argc, char** argv)
   // Parse command line arguments
   GetCommandLineArgs(argc,argv);
 
+  // the coordinator of a production only hands out its blocks
+  if(gOptCoordinatePort > 0) {
+    JobCoordinator coordinator(gOptNShards, gOptNev, 0, "flux neutrinos");
+    bool done = coordinator.Run(gOptCoordinatePort,
+                                gOptEvFilePrefix + ".blocks.txt");
+    return (done) ? 0 : 1;
+  }
+
   if ( ! RunOpt::Instance()->Tune() ) {
     LOG("gmkspl", pFATAL) << " No TuneId in RunOption";
     exit(-1);
@@ -328,9 +430,15 @@ int main(int argc, char** argv)
   // Iinitialization of random number generators, cross-section table, messenger, cache etc...
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
   utils::app_init::CacheFile(RunOpt::Instance()->CacheFile());
+  utils::app_init::MaxXSecTable(RunOpt::Instance()->MaxXSecTableFile());
   utils::app_init::RandGen(gOptRanSeed);
   utils::app_init::XSecTable(gOptInpXSecFile, true);
 
+  int nthreads = RunOpt::Instance()->NThreads();
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,6,0)
+  if(nthreads > 1) ROOT::EnableThreadSafety();
+#endif
+
   // get flux driver
   GFluxI * flux_driver = GetFlux();
 
@@ -338,55 +446,159 @@ int main(int argc, char** argv)
   GeomAnalyzerI * geom_driver = GetGeometry();
 
   // create the GENIE monte carlo job driver
-  GMCJDriver* mcj_driver = new GMCJDriver;
-  mcj_driver->SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
-  mcj_driver->UseFluxDriver(flux_driver);
-  mcj_driver->UseGeomAnalyzer(geom_driver);
-  mcj_driver->Configure();
-  mcj_driver->UseSplines();
-  mcj_driver->ForceSingleProbScale();
+  GMCJDriver* mcj_driver = MCJDriver(flux_driver, geom_driver);
+
+  // the events of this shard (of a sharded production), or of each block
+  // handed out by the coordinator of a coordinated one (the blocks forked
+  // before any generation thread is started)
+  long int nev = utils::app_init::WorkerShare(
+                        (long int) gOptNev, gOptShard, gOptNShards);
+  if(gOptCoordinator.size() > 0) {
+    double exposure = 0;
+    gOptShard = utils::app_init::CoordinatedBlock(
+                     gOptCoordinator, gOptNShards, nev, exposure);
+  }
 
   // initialize an ntuple writer
   NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
-  ntpw.CustomizeFilenamePrefix(gOptEvFilePrefix);
+  ntpw.CustomizeFilenamePrefix(
+     utils::app_init::ShardFilename(gOptEvFilePrefix, gOptShard));
   ntpw.Initialize();
 
   // Create a MC job monitor for a periodically updated status file
   GMCJMonitor mcjmonitor(gOptRunNu);
   mcjmonitor.SetRefreshRate(RunOpt::Instance()->MCJobStatusRefreshRate());
+  mcjmonitor.CustomizeFilename(
+     utils::app_init::ShardFilename(mcjmonitor.Filename(), gOptShard));
 
   // Set GHEP print level
   GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
 
+  // Start the extra generation threads, if requested: they configure their
+  // drivers from the path lengths & probability scales computed here,
+  // passed on in a driver state file
+  EventSink sink(nev, ntpw, mcjmonitor);
+  vector<AtmoThread *> threads;
+  string state_file = "";
+  if(nthreads > 1) {
+    state_file = utils::app_init::ShardFilename(gOptEvFilePrefix, gOptShard) +
+                 ".gmcjstate.root";
+    mcj_driver->SaveState(state_file, "");
+  }
+  long int seed = RandomGen::Instance()->GetSeed();
+  for(int ithread = 1; ithread < nthreads; ithread++) {
+    AtmoThread * thread = new AtmoThread;
+    thread->geom   = (gOptUsingRootGeom) ? geom_driver : 0; // shared if ROOT
+    thread->state  = state_file;
+    thread->thread = std::thread(AtmoThreadMain, ithread, seed, thread, std::ref(sink));
+    threads.push_back(thread);
+  }
+
   // event loop
-  for(int iev = 0; iev < gOptNev; iev++) {
+  GenerateEvents(*mcj_driver, *flux_driver, sink);
+
+  // wait for the extra threads, and sum the flux neutrinos thrown by all
+  long int nflux = mcj_driver->NFluxNeutrinos();
+  for(unsigned int i = 0; i < threads.size(); i++) {
+    threads[i]->thread.join();
+    nflux += threads[i]->nflux;
+    delete threads[i];
+  }
+  if(state_file.size() > 0) gSystem->Unlink(state_file.c_str());
+
+  // save the exposure (flux neutrinos thrown towards the geometry) with the
+  // events, for the normalization of the sample (or of its shards)
+  utils::app_init::SaveExposure(ntpw.EventTree(), gOptShard, gOptNShards,
+     seed, (double) nflux, "flux neutrinos", nflux, nev);
+
+  // save the event file
+  ntpw.Save();
+
+  // clean-up
+  delete mcj_driver;
+  delete geom_driver;
+  delete flux_driver;
+
+  return 0;
+}
+//________________________________________________________________________________________
+GMCJDriver * MCJDriver(GFluxI * flux_driver, GeomAnalyzerI * geom_driver, string state)
+{
+// create & configure the GENIE monte carlo job driver (from the saved state
+// of an identically configured one, if given)
+
+  GMCJDriver* mcj_driver = new GMCJDriver;
+  mcj_driver->SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+  mcj_driver->UseFluxDriver(flux_driver);
+  mcj_driver->UseGeomAnalyzer(geom_driver);
+  if(gOptExtMaxPlXml.size() > 0) mcj_driver->UseMaxPathLengths(gOptExtMaxPlXml);
+  if(state.size() > 0) mcj_driver->LoadState(state, "", false);
+  mcj_driver->Configure();
+  mcj_driver->UseSplines();
+  mcj_driver->ForceSingleProbScale();
+  if(gOptForceInteractions) mcj_driver->ForceInteraction();
+
+  return mcj_driver;
+}
+//________________________________________________________________________________________
+void GenerateEvents(GMCJDriver & mcj_driver, GFluxI & flux_driver, EventSink & sink)
+{
+  while(sink.Claim()) {
 
     // generate next event
-    EventRecord* event = mcj_driver->GenerateEvent();
+    EventRecord* event = mcj_driver.GenerateEvent();
 
     // set weight (if using a weighted flux)
-    //event->SetWeight(event->Weight()*flux_driver->Weight());
-
-    // print-out
-    LOG("gevgen_atmo", pNOTICE) << "Generated event: " << *event;
+    if(gOptWeightedFlux) event->SetWeight(event->Weight()*flux_driver.Weight());
 
     // save the event, refresh the mc job monitor
-    ntpw.AddEventRecord(iev, event);
-    mcjmonitor.Update(iev,event);
+    sink.Add(event);
 
     // clean-up
     delete event;
   }
+}
+//________________________________________________________________________________________
+void AtmoThreadMain(int ithread, long int seed, AtmoThread * thread, EventSink & sink)
+{
+// An extra event generation thread, with private instances of the physics
+// modules, a random number generator and flux & job drivers of its own and
+// with the ROOT geometry analyzer of the main thread (or a point geometry of
+// its own)
 
-  // save the event file
-  ntpw.Save();
+  long int tseed = utils::app_init::ThreadSeed(seed, ithread);
 
-  // clean-up
-  delete geom_driver;
-  delete flux_driver;
+  LOG("gevgen_atmo", pNOTICE)
+    << "Starting event generation thread " << ithread
+    << " (random number seed: " << tseed << ")";
+
+  AlgFactory::Instance()->UseThreadPool(true);
+  RandomGen::Instance()->SetThreadSeed(tseed);
+
+  GFluxI *        flux_driver = GetFlux();
+  GeomAnalyzerI * geom_driver = (thread->geom) ? thread->geom : GetGeometry();
+  GMCJDriver *    mcj_driver  = MCJDriver(flux_driver, geom_driver, thread->state);
+
+  GenerateEvents(*mcj_driver, *flux_driver, sink);
+
+  thread->nflux = mcj_driver->NFluxNeutrinos();
+
+  // delete the drivers before the thread's algorithms (on thread exit)
   delete mcj_driver;
+  if(!thread->geom) delete geom_driver;
+  delete flux_driver;
+}
+//________________________________________________________________________________________
+void EventSink::Add(EventRecord * event)
+{
+  std::lock_guard<std::mutex> lock(fMutex);
 
-  return 0;
+  // print-out
+  LOG("gevgen_atmo", pNOTICE) << "Generated event: " << *event;
+
+  fNtpWriter.AddEventRecord(fIEvent, event);
+  fMCJMonitor.Update(fIEvent, event);
+  fIEvent++;
 }
 //________________________________________________________________________________________
 GeomAnalyzerI* GetGeometry(void)
@@ -406,6 +618,9 @@ GeomAnalyzerI* GetGeometry(void)
     rgeom -> SetLengthUnits  (gOptGeomLUnits);
     rgeom -> SetDensityUnits (gOptGeomDUnits);
     rgeom -> SetTopVolName   (gOptRootGeomTopVol);
+    // shared by the event generation threads
+    int nthreads = RunOpt::Instance()->NThreads();
+    if(nthreads > 1) rgeom->SetMaxThreads(nthreads);
     // getting the bounding box dimensions along z so as to set the
     // appropriate upstream generation surface for the JPARC flux driver
     TGeoVolume * topvol = rgeom->GetGeometry()->GetTopVolume();
@@ -490,6 +705,11 @@ GFluxI* GetFlux(void)
   atmo_flux_driver->LoadFluxData();
   // configure flux generation surface:
   atmo_flux_driver->SetRadii(gOptRL, gOptRT);
+  // weighted flux (power-law energy spectrum)?
+  if(gOptWeightedFlux) {
+     atmo_flux_driver->GenerateWeighted(true);
+     atmo_flux_driver->SetSpectralIndex(gOptSpectralIndex);
+  }
   // set rotation for coordinate tranformation from the topocentric horizontal
   // system to a user-defined coordinate system:
   if(!gOptRot.IsIdentity()) {
@@ -886,6 +1106,63 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptRanSeed = -1;
   }
 
+  //
+  // *** weighted flux, forced interactions
+  //
+  if( parser.OptionExists("flux-spectral-index") ) {
+    LOG("gevgen_atmo", pINFO) << "Reading the spectral index of the weighted flux";
+    gOptWeightedFlux  = true;
+    gOptSpectralIndex = parser.ArgAsDouble("flux-spectral-index");
+  }
+  gOptForceInteractions = parser.OptionExists("force-interactions");
+
+  //
+  // *** shard of a sharded production: a part of the events & a seed of its own
+  //
+  if( parser.OptionExists("shard") ) {
+    LOG("gevgen_atmo", pINFO) << "Reading the production shard";
+    bool valid = utils::app_init::ShardOption(
+       parser.ArgAsString("shard"), gOptShard, gOptNShards);
+    if(!valid) {
+      LOG("gevgen_atmo", pFATAL)
+        << "The --shard option expects ishard/nshards "
+        << "with 0 <= ishard < nshards";
+      PrintSyntax();
+      gAbortingInErr = true;
+      exit(1);
+    }
+    gOptRanSeed = utils::app_init::ShardSeed(gOptRanSeed, gOptShard);
+  }
+
+  //
+  // *** coordinated production: the coordinator, or one of its workers
+  //
+  if( parser.OptionExists("coordinate") ) {
+    LOG("gevgen_atmo", pINFO) << "Reading the coordinator port";
+    gOptCoordinatePort = parser.ArgAsInt("coordinate");
+    gOptNShards = ( parser.OptionExists("blocks") ) ?
+                    parser.ArgAsInt("blocks") : 0;
+    if( gOptCoordinatePort <= 0 || gOptNShards <= 0 ) {
+      LOG("gevgen_atmo", pFATAL)
+        << "The --coordinate option expects a port number and the "
+        << "number of blocks of the production (--blocks n)";
+      PrintSyntax();
+      gAbortingInErr = true;
+      exit(1);
+    }
+  }
+  if( parser.OptionExists("coordinated-by") ) {
+    LOG("gevgen_atmo", pINFO) << "Reading the coordinator address";
+    gOptCoordinator = parser.ArgAsString("coordinated-by");
+  }
+  if( (gOptCoordinatePort > 0 || gOptCoordinator.size() > 0) && gOptShard >= 0 ) {
+    LOG("gevgen_atmo", pFATAL)
+      << "A coordinated production can not be combined with --shard";
+    PrintSyntax();
+    gAbortingInErr = true;
+    exit(1);
+  }
+
   //
   // *** input cross-section file
   //
@@ -941,9 +1218,18 @@ void GetCommandLineArgs(int argc, char ** argv)
   fluxinfo << "Flux ray generation surface - Distance = " 
            << gOptRL << " m, Radius = " << gOptRT << " m";
 
+  if(gOptWeightedFlux) {
+    fluxinfo << "\n\tWeighted flux - Spectral index = " << gOptSpectralIndex;
+  }
+
   ostringstream expinfo;
   if(gOptNev > 0)            { expinfo << gOptNev            << " events";   }
   if(gOptKtonYrExposure > 0) { expinfo << gOptKtonYrExposure << " kton*yrs"; }
+  if(gOptShard >= 0) {
+    expinfo << " - shard " << gOptShard << " of " << gOptNShards;
+  }
+  if(gOptForceInteractions)  { expinfo << " - forced interactions"; }
+  expinfo << " - " << RunOpt::Instance()->NThreads() << " thread(s)";
 
   ostringstream rotation;
   rotation << "\t| " <<  gOptRot.XX() << "  " << gOptRot.XY() << "  " << gOptRot.XZ() << " |\n";
@@ -1003,6 +1289,12 @@ void PrintSyntax(void)
    << "\n           [-o output_event_file_prefix]"
    << "\n           [--flux-ray-generation-surface-distance]"               
    << "\n           [--flux-ray-generation-surface-radius]"
+   << "\n           [--flux-spectral-index alpha]"
+   << "\n           [--force-interactions]"
+   << "\n           [--shard ishard/nshards]"
+   << "\n           [--coordinate port --blocks n]"
+   << "\n           [--coordinated-by host:port]"
+   << "\n           [--threads n_of_threads]"
    << "\n           [--seed random_number_seed]"
    << "\n            --cross-sections xml_file"
    << "\n           [--event-generator-list list_name]"
@@ -0,0 +1,131 @@
+//____________________________________________________________________________
+/*!
+
+\program gcfgsnap
+
+\brief   Saves the fully resolved GENIE configuration of a tune (all the
+         algorithm configuration sets, global parameter lists, common lists
+         and tune generator lists) into a binary snapshot.
+
+         Any GENIE application given the snapshot (--config-snapshot, or the
+         $GCONFSNAP environment variable) builds its configuration from it,
+         without parsing the XML configuration files. The snapshot is only
+         used with the same tune and XML path, and only if none of the XML
+         files it was made from changed since: otherwise the XML files are
+         parsed as usual.
+
+         Syntax :
+           gcfgsnap -o output_file
+                    [--tune genie_tune]
+                    [--message-thresholds xml_file]
+                    [--xml-path config_xml_dir]
+
+         Options :
+           -o
+              Name of the output configuration snapshot file.
+           --tune
+              Specifies a GENIE comprehensive neutrino interaction model tune.
+              [default: "Default"].
+           --message-thresholds
+              Allows users to customize the message stream thresholds.
+              The thresholds are specified using an XML file.
+              See $GENIE/config/Messenger.xml for the XML schema.
+           --xml-path
+              A directory to load XML files from - overrides $GXMLPATH, and $GENIE/config
+
+         Examples :
+
+           1) shell% gcfgsnap --tune G18_02a_00_000 -o G18_02a_00_000.gcfg
+              shell% gevgen ... --tune G18_02a_00_000 \
+                                --config-snapshot G18_02a_00_000.gcfg
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <string>
+
+#include "Framework/Algorithm/AlgConfigPool.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+
+using std::string;
+
+using namespace genie;
+
+void GetCommandLineArgs (int argc, char ** argv);
+void PrintSyntax        (void);
+
+//User-specified options:
+string gOutFile;          ///< output snapshot file
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  if ( ! RunOpt::Instance()->Tune() ) {
+    LOG("gcfgsnap", pFATAL) << " No TuneId in RunOption";
+    exit(-1);
+  }
+  RunOpt::Instance()->BuildTune();
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+
+  AlgConfigPool * pool = AlgConfigPool::Instance();
+  if ( ! pool->SaveSnapshot(gOutFile) ) {
+    LOG("gcfgsnap", pFATAL)
+      << "Could not save the configuration snapshot: " << gOutFile;
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  LOG("gcfgsnap", pNOTICE)
+     << " ****** Saved " << pool->ConfigKeyList().size()
+     << " configuration sets into : " << gOutFile;
+
+  return 0;
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gcfgsnap", pNOTICE) << "Parsing command line arguments";
+
+  // Common run options.
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  // Parse run options for this app
+
+  CmdLnArgParser parser(argc,argv);
+
+  if( parser.OptionExists('o') ) {
+    LOG("gcfgsnap", pINFO) << "Reading output file name";
+    gOutFile = parser.ArgAsString('o');
+  } else {
+    LOG("gcfgsnap", pFATAL) << "You must specify an output file name";
+    PrintSyntax();
+    exit(1);
+  }
+
+  LOG("gcfgsnap", pNOTICE) << *RunOpt::Instance();
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gcfgsnap", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gcfgsnap  -o output_file  [--tune genie_tune]\n"
+    << "             [--message-thresholds xml_file]\n"
+    << "             [--xml-path config_xml_dir]\n";
+}
+//____________________________________________________________________________
@@ -9,13 +9,24 @@
          sample is specified)
 
          Syntax :
-           gevcomp -f sample [-r reference_sample]
+           gevcomp -f sample [-r reference_sample] 
+                   [--summary [file]] [--threads n]
 
          Options:
            [] Denotes an optional argument
            -f Specifies the GENIE/ROOT file with the generated event sample
 	   -r Specifies another GENIE/ROOT event sample file for comparison 
            -n Specifies how many events to analyze [default: all]
+           --summary
+              Instead of the postscript plots, compare the two samples in a
+              single pass over the gst ntuples (reading only the branches
+              used), and write a machine-readable summary with the chi2 and
+              p-value of every (channel, variable) distribution.
+              The summary file name is optional [default: <sample>sample_test.txt].
+              Requires a reference sample (-r).
+           --threads
+              Number of threads reading each sample in --summary mode
+              (ROOT >= 6.06) [default: 1]
 
          Notes:
            The input ROOT files are the gst summary ntuples generated by 
@@ -37,8 +48,13 @@
 
 #include <cassert>
 #include <sstream>
+#include <fstream>
 #include <string>
+#include <vector>
+#include <thread>
 
+#include <RVersion.h>
+#include <TROOT.h>
 #include <TSystem.h>
 #include <TFile.h>
 #include <TDirectory.h>
@@ -63,7 +79,9 @@
 #include "Framework/Utils/Style.h"
 
 using std::ostringstream;
+using std::ofstream;
 using std::string;
+using std::vector;
 
 using namespace genie;
 
@@ -73,17 +91,44 @@ void   PrintSyntax          (void);
 bool   CheckRootFilename    (string filename);
 string OutputFileName       (string input_file_name);
 void   CreatePlots          (string filename, string filename_ref);
+void   CreateSummary        (string filename, string filename_ref);
+void   BookSummaryHists     (vector<TH1D*> & hists, const double * vmax, string tag);
+void   FillSummaryHists     (string filename, Long64_t first, Long64_t last,
+                             vector<TH1D*> & hists);
+bool   ReduceSummaryHists   (string filename, const double * vmax, string tag,
+                             vector<TH1D*> & hists);
 
 // command-line arguments
 string   gOptInpFile     = ""; // (-f) input GENIE event sample file
 string   gOptInpFileRef  = ""; // (-r) input GENIE event sample file (reference)
+bool     gOptSummary     = false; // (--summary) write the chi2 summary instead of plots
+string   gOptSummaryFile = ""; // (--summary) chi2 summary file
+int      gOptNThreads    = 1;  // (--threads) number of threads per sample
+
+// channels & variables compared in --summary mode
+const int    kNSumChannels = 11;
+const char * kSumChannel[kNSumChannels] = { 
+  "all", "qel_cc", "qel_nc", "mec_cc", "mec_nc", "res_cc", "res_nc", 
+  "dis_cc", "dis_nc", "coh_cc", "coh_nc" 
+};
+const int    kNSumVars = 11;
+const char * kSumVar[kNSumVars] = { 
+  "Ev", "El", "Q2s", "Ws", "xs", "ys", 
+  "nfp", "nfn", "nfpip", "nfpim", "nfpi0" 
+};
+const int    kNSumBins    = 50; // bins of the continuous variables
+const int    kNSumMulBins = 20; // bins of the multiplicities
 
 //_________________________________________________________________________________
 int main(int argc, char ** argv)
 {
   GetCommandLineArgs(argc,argv);
-  utils::style::SetDefaultStyle();
-  CreatePlots(gOptInpFile,gOptInpFileRef);
+  if(gOptSummary) {
+    CreateSummary(gOptInpFile,gOptInpFileRef);
+  } else {
+    utils::style::SetDefaultStyle();
+    CreatePlots(gOptInpFile,gOptInpFileRef);
+  }
   
   LOG("gevcomp", pINFO)  << "Done!";
   return 0;
@@ -1979,6 +2024,215 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   }
 }
 //_________________________________________________________________________________
+void CreateSummary(string inp_filename, string inp_filename_ref)
+{
+// Compares the (channel, variable) distributions of the two samples and
+// writes one line per distribution:
+//   channel variable n_test n_ref chi2 ndf p_value
+// (chi2 test for unweighted histograms with unknown normalisation, so
+// samples of different size can be compared)
+
+  if(!CheckRootFilename(inp_filename) || !CheckRootFilename(inp_filename_ref)) {
+    LOG("gevcomp", pFATAL) << "The summary mode needs a test and a reference sample";
+    exit(1);
+  }
+
+  // common binning: upper edges from the larger of the two samples
+  // (reading only the corresponding branches)
+  double vmax[kNSumVars];
+  for(int iv = 0; iv < kNSumVars; iv++) vmax[iv] = 1.;
+  string files[2] = { inp_filename, inp_filename_ref };
+  for(int is = 0; is < 2; is++) {
+    TFile fin(files[is].c_str(),"READ");
+    TTree * gst = dynamic_cast<TTree *> (fin.Get("gst"));
+    if(!gst) {
+      LOG("gevcomp", pFATAL) << "No gst tree in: " << files[is];
+      exit(1);
+    }
+    for(int iv = 0; iv < 4; iv++) {
+      vmax[iv] = TMath::Max(vmax[iv], 1.05 * gst->GetMaximum(kSumVar[iv]));
+    }
+  }
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,6,0)
+  if(gOptNThreads > 1) ROOT::EnableThreadSafety();
+#endif
+
+  vector<TH1D*> h0, h1;
+  bool ok = 
+     ReduceSummaryHists(inp_filename,     vmax, "test", h0) &&
+     ReduceSummaryHists(inp_filename_ref, vmax, "ref",  h1);
+  if(!ok) exit(1);
+
+  string summary_filename = gOptSummaryFile;
+  if(summary_filename.empty()) {
+    summary_filename = OutputFileName(inp_filename);
+    summary_filename.replace(summary_filename.size()-2, 2, "txt");
+  }
+  ofstream summary(summary_filename.c_str());
+  summary << "# test sample      : " << inp_filename     << "\n"
+          << "# reference sample : " << inp_filename_ref << "\n"
+          << "# channel variable n_test n_ref chi2 ndf p_value\n";
+
+  double chi2_sum = 0;
+  int    ndf_sum  = 0;
+  for(unsigned int ih = 0; ih < h0.size(); ih++) {
+    int ich = ih / kNSumVars;
+    int iv  = ih % kNSumVars;
+    double chi2  = 0;
+    int    ndf   = 0;
+    int    igood = 0;
+    double prob  = -1;
+    bool   empty = (h0[ih]->GetEntries() == 0 || h1[ih]->GetEntries() == 0);
+    if(!empty) {
+      prob = h0[ih]->Chi2TestX(h1[ih], chi2, ndf, igood, "UU");
+      chi2_sum += chi2;
+      ndf_sum  += ndf;
+    }
+    summary << kSumChannel[ich] << " " << kSumVar[iv] << " "
+            << h0[ih]->GetEntries() << " " << h1[ih]->GetEntries() << " "
+            << chi2 << " " << ndf << " " << prob << "\n";
+  }
+  summary << "# total chi2 / ndf : " << chi2_sum << " / " << ndf_sum << "\n";
+  summary.close();
+
+  LOG("gevcomp", pNOTICE) 
+     << "Total chi2 / ndf = " << chi2_sum << " / " << ndf_sum
+     << " - Summary written in " << summary_filename;
+
+  for(unsigned int ih = 0; ih < h0.size(); ih++) {
+     delete h0[ih];
+     delete h1[ih];
+  }
+}
+//_________________________________________________________________________________
+void BookSummaryHists(vector<TH1D*> & hists, const double * vmax, string tag)
+{
+// Books one histogram per (channel, variable), not owned by any directory
+// (they are filled on worker threads)
+
+  hists.resize(kNSumChannels * kNSumVars);
+  for(int ich = 0; ich < kNSumChannels; ich++) {
+    for(int iv = 0; iv < kNSumVars; iv++) {
+      string name = tag + "_" + kSumChannel[ich] + "_" + kSumVar[iv];
+      bool multiplicity = (iv >= 6);
+      TH1D * h = (multiplicity) ?
+         new TH1D(name.c_str(), "", kNSumMulBins, -0.5, kNSumMulBins-0.5) :
+         new TH1D(name.c_str(), "", kNSumBins,     0.,  vmax[iv]);
+      h->SetDirectory(0);
+      hists[ich*kNSumVars + iv] = h;
+    }
+  }
+}
+//_________________________________________________________________________________
+void FillSummaryHists(
+   string filename, Long64_t first, Long64_t last, vector<TH1D*> & hists)
+{
+// Fills the histograms from the gst entries [first, last), reading only
+// the branches used
+
+  TFile fin(filename.c_str(),"READ");
+  TTree * gst = dynamic_cast<TTree *> (fin.Get("gst"));
+  if(!gst) return;
+
+  Bool_t   qel, mec, res, dis, coh, cc, nc;
+  Double_t var[6];
+  Int_t    mul[5];
+
+  gst->SetBranchStatus("*", 0);
+  const char * flag_names[7] = { "qel", "mec", "res", "dis", "coh", "cc", "nc" };
+  Bool_t *     flags     [7] = { &qel,  &mec,  &res,  &dis,  &coh,  &cc,  &nc  };
+  for(int i = 0; i < 7; i++) {
+    gst->SetBranchStatus  (flag_names[i], 1);
+    gst->SetBranchAddress (flag_names[i], flags[i]);
+  }
+  for(int iv = 0; iv < kNSumVars; iv++) {
+    gst->SetBranchStatus  (kSumVar[iv], 1);
+    if(iv < 6) gst->SetBranchAddress (kSumVar[iv], &var[iv]);
+    else       gst->SetBranchAddress (kSumVar[iv], &mul[iv-6]);
+  }
+
+  for(Long64_t i = first; i < last; i++) {
+    gst->GetEntry(i);
+
+    // channel 0 (all) & the one exclusive channel of this event, if any
+    int ich = -1;
+    if      (qel) ich = 1;
+    else if (mec) ich = 3;
+    else if (res) ich = 5;
+    else if (dis) ich = 7;
+    else if (coh) ich = 9;
+    if(ich > 0) {
+      if      (nc) ich++;
+      else if (!cc) ich = -1;
+    }
+    for(int iv = 0; iv < kNSumVars; iv++) {
+      double v = (iv < 6) ? var[iv] : mul[iv-6];
+      hists[iv]->Fill(v);
+      if(ich > 0) hists[ich*kNSumVars + iv]->Fill(v);
+    }
+  }
+  fin.Close();
+}
+//_________________________________________________________________________________
+bool ReduceSummaryHists(
+   string filename, const double * vmax, string tag, vector<TH1D*> & hists)
+{
+// Fills the histograms of a sample, splitting its entries across threads
+// that fill histograms of their own, which are then added up
+
+  Long64_t nev = 0;
+  {
+    TFile fin(filename.c_str(),"READ");
+    TTree * gst = dynamic_cast<TTree *> (fin.Get("gst"));
+    if(!gst) {
+      LOG("gevcomp", pFATAL) << "No gst tree in: " << filename;
+      return false;
+    }
+    nev = gst->GetEntries();
+  }
+
+  Long64_t nthreads = TMath::Max(1LL, TMath::Min((Long64_t)gOptNThreads, nev));
+#if ROOT_VERSION_CODE < ROOT_VERSION(6,6,0)
+  if(nthreads > 1) {
+    LOG("gevcomp", pWARN) 
+      << "Reading in parallel needs ROOT >= 6.06 - Using a single thread";
+    nthreads = 1;
+  }
+#endif
+
+  LOG("gevcomp", pNOTICE) 
+     << "Reading " << nev << " events from " << filename 
+     << " on " << nthreads << " thread(s)";
+
+  BookSummaryHists(hists, vmax, tag);
+  if(nthreads == 1) {
+    FillSummaryHists(filename, 0, nev, hists);
+    return true;
+  }
+
+  vector< vector<TH1D*> > partial(nthreads);
+  vector<std::thread>     workers;
+  for(Long64_t it = 0; it < nthreads; it++) {
+    ostringstream part_tag;
+    part_tag << tag << "_part" << it;
+    BookSummaryHists(partial[it], vmax, part_tag.str());
+    Long64_t first = nev *  it    / nthreads;
+    Long64_t last  = nev * (it+1) / nthreads;
+    workers.push_back(std::thread(
+       FillSummaryHists, filename, first, last, std::ref(partial[it])));
+  }
+  for(unsigned int it = 0; it < workers.size(); it++) workers[it].join();
+
+  for(Long64_t it = 0; it < nthreads; it++) {
+    for(unsigned int ih = 0; ih < hists.size(); ih++) {
+      hists[ih]->Add(partial[it][ih]);
+      delete partial[it][ih];
+    }
+  }
+  return true;
+}
+//_________________________________________________________________________________
 string OutputFileName(string inpname)
 {
 // Builds the output filename based on the name of the input filename
@@ -2021,13 +2275,34 @@ void GetCommandLineArgs(int argc, char ** argv)
   } else {
     LOG("gevcomp", pNOTICE) << "Unspecified 'reference' event sample";
   }
+
+  // chi2 summary instead of plots?
+  if( parser.OptionExists("summary") ) {
+    LOG("gevcomp", pINFO) << "Writing a chi2 comparison summary";
+    gOptSummary     = true;
+    gOptSummaryFile = parser.ArgAsString("summary");
+    // the file name is optional: don't take the next option for it
+    if(!gOptSummaryFile.empty() && gOptSummaryFile[0] == '-') {
+      gOptSummaryFile = "";
+    }
+  }
+
+  // number of threads
+  if( parser.OptionExists("threads") ) {
+    LOG("gevcomp", pINFO) << "Reading number of threads";
+    gOptNThreads = parser.ArgAsInt("threads");
+  } else {
+    LOG("gevcomp", pINFO) << "Unspecified number of threads - Using default";
+    gOptNThreads = 1;
+  }
 }
 //_________________________________________________________________________________
 void PrintSyntax(void)
 {
   LOG("gevcomp", pNOTICE)
     << "\n\n" << "Syntax:" << "\n"
-    << " gevcomp -f sample.root [-n nev] [-r reference_sample.root]\n";
+    << " gevcomp -f sample.root [-n nev] [-r reference_sample.root]"
+    << " [--summary [file]] [--threads n]\n";
 }
 //_________________________________________________________________________________
 bool CheckRootFilename(string filename)
@@ -0,0 +1,311 @@
+//____________________________________________________________________________
+/*!
+
+\program gevfsi
+
+\brief   Re-runs the hadron transport (FSI) stage on the events of an existing
+         GENIE event file (GHEP format), for any number of alternative hadron
+         transport configurations.
+
+         Each event is restored to its state just before the hadron transport
+         (see utils::ghep::StripHadronTransport()) and the hadron transport,
+         nuclear binding energy and post-transport decay modules are run again
+         on it, once for each input configuration. Everything upstream (flux,
+         geometry, event selection and primary kinematics) is taken as is from
+         the input file, so FSI systematics do not require re-running whole
+         event generation jobs.
+
+         The events generated for each configuration are saved in a separate
+         output file: all output event trees have the same entries in the same
+         order as the input one (entry i of each output tree has the primary
+         interaction of entry i of the input tree).
+
+         Syntax :
+           gevfsi -i input_file -c fsi_configs
+                  [-o output_file_prefix]
+                  [-n number_of_events]
+                  [--seed random_number_seed]
+                  [--tune genie_tune]
+                  [--message-thresholds xml_file]
+                  [--event-record-print-level level]
+                  [--xml-path config_xml_dir]
+
+         Options :
+           -i
+              Input GENIE event file (GHEP format).
+           -c
+              A comma separated list of hadron transport configurations, each
+              specified as `algorithm_name/configuration_name', eg
+              `genie::HAIntranuke2018/Default,genie::HAIntranuke2018/MyAltConfig'.
+              Alternative configurations can be added as named parameter sets
+              in the algorithm XML file of a directory passed with --xml-path.
+           -o
+              Output file name prefix. The events generated with the i-th
+              configuration are saved in `prefix.i.ghep.root'.
+              Default: gntp.fsi
+           -n
+              Number of input events to process.
+              Default: all
+           --seed
+              Random number seed.
+           --tune
+              Specifies a GENIE comprehensive neutrino interaction model tune.
+              It should be the tune used to generate the input file.
+              [default: "Default"].
+           --message-thresholds
+              Allows users to customize the message stream thresholds.
+              The thresholds are specified using an XML file.
+              See $GENIE/config/Messenger.xml for the XML schema.
+           --event-record-print-level
+              Allows users to set the level of information shown when the event
+              record is printed in the screen. See GHepRecord::Print().
+           --xml-path
+              A directory to load XML files from - overrides $GXMLPATH, and $GENIE/config
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <string>
+#include <sstream>
+#include <vector>
+
+#include <TFile.h>
+#include <TTree.h>
+#include <TMath.h>
+
+#include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordVisitorI.h"
+#include "Framework/EventGen/EVGThreadException.h"
+#include "Framework/GHEP/GHepUtils.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpMCFormat.h"
+#include "Framework/Ntuple/NtpMCEventRecord.h"
+#include "Framework/Ntuple/NtpWriter.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+
+using std::string;
+using std::ostringstream;
+using std::vector;
+
+using namespace genie;
+
+// Prototypes:
+void GetCommandLineArgs (int argc, char ** argv);
+void PrintSyntax        (void);
+const EventRecordVisitorI * GetModule (string name, string config);
+
+// User-specified options:
+string   gOptInpFile     = "";          // input GHEP file
+string   gOptFSIConfigs  = "";          // comma separated algorithm/config list
+string   gOptOutPrefix   = "gntp.fsi";  // output file name prefix
+Long64_t gOptNEvents     = -1;          // number of events to process
+long int gOptRanSeed     = -1;          // random number seed
+
+// Max number of attempts to re-run the hadron transport of an event
+const int kMaxFSIAttempts = 100;
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  if ( ! RunOpt::Instance()->Tune() ) {
+    LOG("gevfsi", pFATAL) << " No TuneId in RunOption";
+    exit(-1);
+  }
+  RunOpt::Instance()->BuildTune();
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+  utils::app_init::RandGen(gOptRanSeed);
+  GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
+
+  // Hadron transport configurations and the modules following the hadron
+  // transport in the event generation chain
+  vector<const EventRecordVisitorI *> fsi_models;
+  vector<string> configs = utils::str::Split(gOptFSIConfigs, ",");
+  for(unsigned int ic = 0; ic < configs.size(); ic++) {
+    vector<string> id = utils::str::Split(utils::str::TrimSpaces(configs[ic]), "/");
+    if(id.size() != 2) {
+      LOG("gevfsi", pFATAL)
+        << "Invalid hadron transport configuration: " << configs[ic];
+      PrintSyntax();
+      exit(1);
+    }
+    fsi_models.push_back(GetModule(id[0], id[1]));
+  }
+  const EventRecordVisitorI * bind_energy =
+     GetModule("genie::NucBindEnergyAggregator", "Default");
+  const EventRecordVisitorI * decayer =
+     GetModule("genie::UnstableParticleDecayer", "AfterHadronTransport");
+
+  // Open the input event file
+  TFile fin(gOptInpFile.c_str(), "READ");
+  TTree * ghep_tree = dynamic_cast <TTree *> (fin.Get("gtree"));
+  if(!ghep_tree) {
+    LOG("gevfsi", pFATAL) << "No GHEP tree found in " << gOptInpFile;
+    gAbortingInErr = true;
+    exit(1);
+  }
+  NtpMCEventRecord * mcrec = 0;
+  ghep_tree->SetBranchAddress("gmcrec", &mcrec);
+
+  Long64_t nev = ghep_tree->GetEntries();
+  if(gOptNEvents >= 0) nev = TMath::Min(nev, gOptNEvents);
+
+  // One output event file per hadron transport configuration
+  vector<NtpWriter *> writers;
+  for(unsigned int ic = 0; ic < fsi_models.size(); ic++) {
+    ostringstream filename;
+    filename << gOptOutPrefix << "." << ic << ".ghep.root";
+    NtpWriter * ntpw = new NtpWriter(kNFGHEP, ic);
+    ntpw->CustomizeFilename(filename.str());
+    ntpw->Initialize();
+    writers.push_back(ntpw);
+    LOG("gevfsi", pNOTICE)
+      << "Events for " << configs[ic] << " will be saved in " << filename.str();
+  }
+
+  // Event loop
+  for(Long64_t iev = 0; iev < nev; iev++) {
+    ghep_tree->GetEntry(iev);
+
+    // the event just before the hadron transport
+    EventRecord pre_fsi(*(mcrec->event));
+    utils::ghep::StripHadronTransport(&pre_fsi);
+    mcrec->Clear();
+
+    LOG("gevfsi", pINFO) << "Pre-FSI event " << iev << ": " << pre_fsi;
+
+    for(unsigned int ic = 0; ic < fsi_models.size(); ic++) {
+      EventRecord * event = 0;
+      int iattempt = 0;
+      while(!event) {
+        event = new EventRecord(pre_fsi);
+        try {
+          fsi_models[ic]->ProcessEventRecord(event);
+          bind_energy   ->ProcessEventRecord(event);
+          decayer       ->ProcessEventRecord(event);
+        }
+        catch (exceptions::EVGThreadException exception) {
+          LOG("gevfsi", pNOTICE)
+             << "Hadron transport of event " << iev << " failed: " << exception;
+          delete event;
+          event = 0;
+          if(++iattempt >= kMaxFSIAttempts) {
+            LOG("gevfsi", pFATAL)
+              << "Couldn't re-run the hadron transport of event " << iev
+              << " after " << kMaxFSIAttempts << " attempts";
+            gAbortingInErr = true;
+            exit(1);
+          }
+        }
+      }
+      LOG("gevfsi", pINFO)
+        << "Event " << iev << " with " << configs[ic] << ": " << *event;
+      writers[ic]->AddEventRecord(iev, event);
+      delete event;
+    }
+
+    if(iev % 1000 == 0) {
+      LOG("gevfsi", pNOTICE) << "Processed " << iev << " / " << nev << " events";
+    }
+  }
+
+  for(unsigned int ic = 0; ic < writers.size(); ic++) {
+    writers[ic]->Save();
+    delete writers[ic];
+  }
+  fin.Close();
+
+  LOG("gevfsi", pNOTICE) << "Done!";
+  return 0;
+}
+//____________________________________________________________________________
+const EventRecordVisitorI * GetModule(string name, string config)
+{
+  const EventRecordVisitorI * module =
+     dynamic_cast<const EventRecordVisitorI *> (
+         AlgFactory::Instance()->GetAlgorithm(name, config));
+  if(!module) {
+    LOG("gevfsi", pFATAL)
+      << "Couldn't get event generation module: " << name << "/" << config;
+    gAbortingInErr = true;
+    exit(1);
+  }
+  return module;
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gevfsi", pNOTICE) << "Parsing command line arguments";
+
+  // Common run options. Set defaults and read.
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  // Parse run options for this app
+
+  CmdLnArgParser parser(argc,argv);
+
+  if( parser.OptionExists('i') ) {
+    gOptInpFile = parser.ArgAsString('i');
+  } else {
+    LOG("gevfsi", pFATAL) << "Unspecified input file - Exiting";
+    PrintSyntax();
+    exit(1);
+  }
+
+  if( parser.OptionExists('c') ) {
+    gOptFSIConfigs = parser.ArgAsString('c');
+  } else {
+    LOG("gevfsi", pFATAL)
+      << "Unspecified hadron transport configurations - Exiting";
+    PrintSyntax();
+    exit(1);
+  }
+
+  if( parser.OptionExists('o') ) {
+    gOptOutPrefix = parser.ArgAsString('o');
+  }
+  if( parser.OptionExists('n') ) {
+    gOptNEvents = parser.ArgAsLong('n');
+  }
+  if( parser.OptionExists("seed") ) {
+    gOptRanSeed = parser.ArgAsLong("seed");
+  }
+
+  LOG("gevfsi", pNOTICE)
+     << "\n Input event file : " << gOptInpFile
+     << "\n Hadron transport configurations : " << gOptFSIConfigs
+     << "\n Output file prefix : " << gOptOutPrefix
+     << "\n Number of events : " << gOptNEvents
+     << "\n Random number seed : " << gOptRanSeed;
+
+  LOG("gevfsi", pNOTICE) << *RunOpt::Instance();
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gevfsi", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gevfsi -i input_file -c alg/config[,alg/config...]"
+    << " [-o output_file_prefix] [-n nevents]"
+    << " [--seed seed_number]"
+    << " [--tune genie_tune]"
+    << " [--event-record-print-level level]"
+    << " [--xml-path config_xml_dir]"
+    << " [--message-thresholds xml_file]\n\n";
+}
+//____________________________________________________________________________
@@ -34,7 +34,13 @@
                   [--event-record-print-level level]
                   [--mc-job-status-refresh-rate  rate]
                   [--cache-file root_file]
+                  [--max-xsec-table file]
                   [--xml-path config_xml_dir]
+                  [--workers n]
+                  [--threads n]
+                  [--ordered-events]
+                  [--spline-storage mode]
+                  [--channel-bias rules]
 
          Options :
            [] Denotes an optional argument.
@@ -83,6 +89,9 @@
            --cross-sections
               Name (incl. full path) of an XML file with pre-computed
               cross-section values used for constructing splines.
+              A binary spline file (see gspl2bin) can be used instead.
+              Only the splines for the input neutrino and target(s) are
+              loaded.
            --event-generator-list
               List of event generators to load in event generation drivers.
               [default: "Default"].
@@ -105,8 +114,65 @@
            --cache-file
               Allows users to specify a cache file so that the cache can be
               re-used in subsequent MC jobs.
+           --max-xsec-table
+              A read-only table of the max differential cross sections used
+              by the kinematic generators, built with gmkmxs. It can be shared
+              by any number of concurrent jobs with the same tune and event
+              generator list, which then skip the max xsec scans.
            --xml-path
               A directory to load XML files from - overrides $GXMLPATH, and $GENIE/config
+           --workers
+              Number of worker processes to fork once the job is initialised
+              (configuration and splines loaded, prob scales computed). The
+              workers share the memory of the initialised job and generate
+              the requested events between them, each with its own seed
+              (derived from the job seed and the worker number, see
+              utils::app_init::WorkerSeed()) and its own output and status
+              files, with `_w<worker>' inserted in the file names
+              (eg gntp_w0.0.ghep.root, gntp_w1.0.ghep.root, ...).
+              The events are claimed on demand by the workers (and their
+              threads), so the workers don't all generate the same number
+              of events (see utils::app_init::ClaimEvent()).
+              [default: 1, no workers]
+           --threads
+              Number of event generation threads (of each worker process,
+              if --workers is used). Each thread uses its own event generation
+              drivers, configured on the thread with private instances of the
+              physics modules (see AlgFactory::UseThreadPool()), which share
+              the loaded cross section splines, and its own random number
+              generator (seeded from the job seed and the thread number, see
+              utils::app_init::ThreadSeed()). The events of all threads are
+              numbered and written, in the order they are generated, in a
+              single output file: the order of the events (not their physics)
+              depends on the thread scheduling. Thread 0 is the main thread,
+              generating as in single threaded jobs.
+              [default: 1]
+           --ordered-events
+              Generates every event from counter-based random number streams
+              keyed on the job seed and the event number (see RandomGen::
+              UseCounterBasedStreams()), whichever thread or worker claims it,
+              and writes the events in event number order: the output is then
+              the same for any number of threads and, merging the files of
+              the workers by event number, of workers. The events finished
+              before lower numbered ones are held back, on each thread, till
+              these are written.
+              [default: off]
+           --spline-storage
+              Storage of the loaded cross section splines: `default',
+              `compact' (the interpolating TSpline3 objects are dropped and
+              the splines evaluate from their coefficient arrays only, with
+              the same values, in ~2.5 times less memory) or `single' (as
+              compact, in single precision: 4-5 times less memory than the
+              default, cross sections changed by ~1E-7 relative).
+              See XSecSplineList::SetCompactStorage().
+              [default: default]
+           --channel-bias
+              Comma separated key=factor list of interaction channels whose
+              selection probability is multiplied by the given factors, eg.
+              `COH=50,1Kaon=200,charm=20' (see genie::ChannelBias for the
+              keys). The event weights compensate for the biasing, and the
+              stored cross sections are the unbiased ones.
+              [default: no biasing]
 
         ***  See the User Manual for more details and examples. ***
 
@@ -127,11 +193,17 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <set>
+#include <atomic>
+#include <mutex>
+#include <thread>
 
 #if defined(HAVE_FENV_H) && defined(HAVE_FEENABLEEXCEPT)
 #include <fenv.h> // for `feenableexcept`
 #endif
 
+#include <RVersion.h>
+#include <TROOT.h>
 #include <TFile.h>
 #include <TTree.h>
 #include <TSystem.h>
@@ -139,6 +211,7 @@
 #include <TH1.h>
 #include <TF1.h>
 
+#include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/Conventions/XmlParserStatus.h"
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/Conventions/Controls.h"
@@ -175,6 +248,7 @@
 using std::string;
 using std::vector;
 using std::map;
+using std::set;
 using std::ostringstream;
 
 using namespace genie;
@@ -184,16 +258,59 @@ void GetCommandLineArgs (int argc, char ** argv);
 void Initialize         (void);
 void PrintSyntax        (void);
 
+void GenerateEventsAtFixedInitState (void);
+
+// Multi-threaded generation (--threads): the requested events are claimed,
+// one at a time and on demand, by the generation threads of the job and of
+// all its workers (see utils::app_init::ClaimEvent()), so that costly events
+// hold back nobody but the thread generating them. The events are numbered
+// and added to the common output ntuple (and job monitor) as they are
+// generated or, with --ordered-events, in the order of their job-wide numbers
+class EventSink {
+public:
+  EventSink(long int nevents, bool ordered,
+            NtpWriter & ntpw, GMCJMonitor & mcjmonitor) :
+    fNEvents(nevents), fOrdered(ordered), fIEvent(0),
+    fNtpWriter(ntpw), fMCJMonitor(mcjmonitor) { }
+
+  //! claim the next event to generate (false if all have been claimed);
+  //! with ordered events, the random number streams of the calling thread
+  //! are set to the ones of the claimed event
+  bool Claim (long int & ievent);
+  //! add generated event ievent (as claimed)
+  void Add   (long int ievent, EventRecord * event);
+
+private:
+  void Write (long int ievent, const EventRecord * event);
+
+  long int                     fNEvents;    ///< events to generate (by the whole job)
+  bool                         fOrdered;    ///< write the events in event number order?
+  int                          fIEvent;     ///< events added
+  set<long int>                fClaimed;    ///< ordered: events claimed and not written yet
+  map<long int, EventRecord *> fHeld;       ///< ordered: events waiting for lower numbered ones
+  std::mutex                   fMutex;      ///< guards the claims, output ntuple & monitor
+  NtpWriter &                  fNtpWriter;
+  GMCJMonitor &                fMCJMonitor;
+};
+
+void InitializeThread                (int ithread, long int seed);
+void GenerateEventsAtFixedInitState  (GEVGDriver & evg_driver,
+                                      const TLorentzVector & nu_p4, EventSink & sink);
+void FixedInitStateThread            (int ithread, long int seed, EventSink & sink);
+void JoinThreads                     (vector<std::thread> & threads);
+
 #ifdef __CAN_GENERATE_EVENTS_USING_A_FLUX_OR_TGTMIX__
 void            GenerateEventsUsingFluxOrTgtMix();
+void            GenerateEventsUsingFluxOrTgtMix (GMCJDriver & mcj_driver, EventSink & sink);
+void            FluxOrTgtMixThread      (int ithread, long int seed, EventSink & sink);
+GMCJDriver *    MCJDriver               (GFluxI * flux_driver, GeomAnalyzerI * geom_driver);
 GeomAnalyzerI * GeomDriver              (void);
 GFluxI *        FluxDriver              (void);
 GFluxI *        MonoEnergeticFluxDriver (void);
 GFluxI *        TH1FluxDriver           (void);
+TH1D *          FluxSpectrum            (void);
 #endif
 
-void GenerateEventsAtFixedInitState (void);
-
 //Default options (override them using the command line arguments):
 int           kDefOptNevents   = 0;       // n-events to generate
 NtpMCFormat_t kDefOptNtpFormat = kNFGHEP; // ntuple format
@@ -214,6 +331,8 @@ string          gOptInpXSecFile;  // cross-section splines
 string          gOptOutFileName;  // Optional outfile name
 string          gOptStatFileName; // Status file name, set if gOptOutFileName was set.
 
+TH1D *          gFluxSpectrum = 0; // flux spectrum built from the -f input
+
 //____________________________________________________________________________
 int main(int argc, char ** argv)
 {
@@ -256,11 +375,30 @@ void Initialize()
   // messenger thresholds, cache file
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
   utils::app_init::CacheFile(RunOpt::Instance()->CacheFile());
+  utils::app_init::MaxXSecTable(RunOpt::Instance()->MaxXSecTableFile());
   utils::app_init::RandGen(gOptRanSeed);
+  if(RunOpt::Instance()->OrderedEvents()) {
+    RandomGen::Instance()->UseCounterBasedStreams();
+  }
+
+  // only load the splines needed for the input neutrino and target mix
+  set<int> probes;
+  set<int> targets;
+  probes.insert(gOptNuPdgCode);
+  map<int,double>::const_iterator tgt_iter = gOptTgtMix.begin();
+  for( ; tgt_iter != gOptTgtMix.end(); ++tgt_iter) {
+    targets.insert(tgt_iter->first);
+  }
+  XSecSplineList::Instance()->SetLoadFilter(probes, targets);
   utils::app_init::XSecTable(gOptInpXSecFile, false);
 
   // Set GHEP print level
   GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
+
+  // the extra generation threads (--threads) create ROOT objects
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,6,0)
+  if(RunOpt::Instance()->NThreads() > 1) ROOT::EnableThreadSafety();
+#endif
 }
 //____________________________________________________________________________
 void GenerateEventsAtFixedInitState(void)
@@ -279,6 +417,11 @@ void GenerateEventsAtFixedInitState(void)
   evg_driver.SetUnphysEventMask(*RunOpt::Instance()->UnphysEventMask());
   evg_driver.Configure(init_state);
 
+  // Fork the worker processes, if requested, sharing the configured driver:
+  // they claim events on demand, with their own seeds and output files
+  int nworkers = RunOpt::Instance()->NWorkers();
+  int iworker  = utils::app_init::ForkWorkers(nworkers);
+
   // Initialize an Ntuple Writer
   NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
 
@@ -286,6 +429,8 @@ void GenerateEventsAtFixedInitState(void)
   if (!gOptOutFileName.empty()){
     ntpw.CustomizeFilename(gOptOutFileName);
   }
+  ntpw.CustomizeFilename(
+     utils::app_init::WorkerFilename(ntpw.Filename(), iworker));
   ntpw.Initialize();
 
 
@@ -297,39 +442,162 @@ void GenerateEventsAtFixedInitState(void)
   if (!gOptStatFileName.empty()){
     mcjmonitor.CustomizeFilename(gOptStatFileName);
   }
+  mcjmonitor.CustomizeFilename(
+     utils::app_init::WorkerFilename(mcjmonitor.Filename(), iworker));
 
 
+  int nthreads = RunOpt::Instance()->NThreads();
+
   LOG("gevgen", pNOTICE)
-    << "\n ** Will generate " << gOptNevents << " events for \n"
+    << "\n ** Will generate " << gOptNevents << " events "
+    << ((iworker < 0) ? "" : "(with the other workers) ") << "for \n"
     << init_state << " at Ev = " << Ev << " GeV";
+  if(nthreads > 1) {
+    LOG("gevgen", pNOTICE) << " ** on " << nthreads << " threads";
+  }
 
-  // Generate events / print the GHEP record / add it to the ntuple
-  int ievent = 0;
-  while (ievent < gOptNevents) {
-     LOG("gevgen", pNOTICE)
-        << " *** Generating event............ " << ievent;
+  // Start the extra generation threads, if requested, each with its own
+  // driver, and generate events / add them to the ntuple on this thread too
+  EventSink sink(gOptNevents, RunOpt::Instance()->OrderedEvents(), ntpw, mcjmonitor);
+  vector<std::thread> threads;
+  long int seed = RandomGen::Instance()->GetSeed();
+  for(int ithread = 1; ithread < nthreads; ithread++) {
+     threads.push_back(
+        std::thread(FixedInitStateThread, ithread, seed, std::ref(sink)));
+  }
+  GenerateEventsAtFixedInitState(evg_driver, nu_p4, sink);
+  JoinThreads(threads);
 
+  // Save the generated MC events
+  ntpw.Save();
+}
+//____________________________________________________________________________
+void GenerateEventsAtFixedInitState(
+   GEVGDriver & evg_driver, const TLorentzVector & nu_p4, EventSink & sink)
+{
+  long int ievent = 0;
+  while (sink.Claim(ievent)) {
      // generate a single event
-     EventRecord * event = evg_driver.GenerateEvent(nu_p4);
-
-     if(!event) {
-        LOG("gevgen", pNOTICE)
-          << "Last attempt failed. Re-trying....";
-        continue;
+     EventRecord * event = 0;
+     while (!event) {
+        event = evg_driver.GenerateEvent(nu_p4);
+        if(!event) {
+           LOG("gevgen", pNOTICE)
+             << "Last attempt failed. Re-trying....";
+        }
      }
 
-     LOG("gevgen", pNOTICE)
-        << "Generated Event GHEP Record: " << *event;
-
      // add event at the output ntuple, refresh the mc job monitor & clean up
-     ntpw.AddEventRecord(ievent, event);
-     mcjmonitor.Update(ievent,event);
-     ievent++;
-     delete event;
+     sink.Add(ievent, event);
+     event->Release(); // recycle the record memory for the next event
   }
+}
+//____________________________________________________________________________
+void FixedInitStateThread(int ithread, long int seed, EventSink & sink)
+{
+// An extra event generation thread, with a driver of its own
 
-  // Save the generated MC events
-  ntpw.Save();
+  InitializeThread(ithread, seed);
+
+  InitialState init_state(gOptTgtMix.begin()->first, gOptNuPdgCode);
+  TLorentzVector nu_p4(0.,0.,gOptNuEnergy,gOptNuEnergy);
+
+  GEVGDriver * evg_driver = new GEVGDriver;
+  evg_driver->SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+  evg_driver->SetUnphysEventMask(*RunOpt::Instance()->UnphysEventMask());
+  evg_driver->Configure(init_state);
+
+  GenerateEventsAtFixedInitState(*evg_driver, nu_p4, sink);
+
+  // delete the driver before the thread's algorithms (on thread exit)
+  delete evg_driver;
+}
+//____________________________________________________________________________
+void InitializeThread(int ithread, long int seed)
+{
+// Gives the calling (extra) generation thread private instances of the
+// physics modules and a random number generator of its own
+
+  long int tseed = utils::app_init::ThreadSeed(seed, ithread);
+
+  LOG("gevgen", pNOTICE)
+    << "Starting event generation thread " << ithread
+    << " (random number seed: " << tseed << ")";
+
+  AlgFactory::Instance()->UseThreadPool(true);
+
+  // ordered events: the streams of an event don't depend on its thread
+  if(RunOpt::Instance()->OrderedEvents()) {
+    RandomGen::Instance()->SetThreadStreamId(0);
+  } else {
+    RandomGen::Instance()->SetThreadSeed(tseed);
+  }
+}
+//____________________________________________________________________________
+void JoinThreads(vector<std::thread> & threads)
+{
+  for(unsigned int i = 0; i < threads.size(); i++) threads[i].join();
+  threads.clear();
+}
+//____________________________________________________________________________
+bool EventSink::Claim(long int & ievent)
+{
+  if(!fOrdered) {
+    ievent = utils::app_init::ClaimEvent(fNEvents);
+    return (ievent >= 0);
+  }
+
+  // claim & book under the lock, so that no lower numbered claim of this
+  // process is still unbooked when an event is written
+  {
+    std::lock_guard<std::mutex> lock(fMutex);
+    ievent = utils::app_init::ClaimEvent(fNEvents);
+    if(ievent < 0) return false;
+    fClaimed.insert(ievent);
+  }
+  RandomGen::Instance()->SetEventNumber(ievent);
+  return true;
+}
+//____________________________________________________________________________
+void EventSink::Add(long int ievent, EventRecord * event)
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+
+  if(!fOrdered) {
+    this->Write(fIEvent, event);
+    return;
+  }
+
+  // lower numbered events still being generated: hold this one back
+  // (taking over its particles, the input record is recycled as usual)
+  if(ievent != *fClaimed.begin()) {
+    fHeld[ievent] = new EventRecord(std::move(*event));
+    return;
+  }
+
+  this->Write(ievent, event);
+  fClaimed.erase(fClaimed.begin());
+
+  // and the held events it was the last one to wait for
+  while(!fHeld.empty() && fHeld.begin()->first == *fClaimed.begin()) {
+    EventRecord * held = fHeld.begin()->second;
+    this->Write(fHeld.begin()->first, held);
+    delete held;
+    fHeld.erase(fHeld.begin());
+    fClaimed.erase(fClaimed.begin());
+  }
+}
+//____________________________________________________________________________
+void EventSink::Write(long int ievent, const EventRecord * event)
+{
+  LOG("gevgen", pNOTICE)
+     << " *** Generated event............ " << ievent;
+  LOG("gevgen", pNOTICE)
+     << "Generated Event GHEP Record: " << *event;
+
+  fNtpWriter.AddEventRecord((int) ievent, event);
+  fMCJMonitor.Update(fIEvent, event);
+  fIEvent++;
 }
 //____________________________________________________________________________
 
@@ -342,15 +610,13 @@ void GenerateEventsUsingFluxOrTgtMix(void)
   GeomAnalyzerI * geom_driver = GeomDriver();
 
   // Create the monte carlo job driver
-  GMCJDriver * mcj_driver = new GMCJDriver;
-  mcj_driver->SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
-  mcj_driver->SetUnphysEventMask(*RunOpt::Instance()->UnphysEventMask());
-  mcj_driver->UseFluxDriver(flux_driver);
-  mcj_driver->UseGeomAnalyzer(geom_driver);
-  mcj_driver->Configure();
-  mcj_driver->UseSplines();
-  if(!gOptWeighted)
-        mcj_driver->ForceSingleProbScale();
+  GMCJDriver * mcj_driver = MCJDriver(flux_driver, geom_driver);
+
+  // Fork the worker processes, if requested, sharing the configured driver
+  // (splines, probability scales): they claim events on demand, with their
+  // own seeds and output files
+  int nworkers = RunOpt::Instance()->NWorkers();
+  int iworker  = utils::app_init::ForkWorkers(nworkers);
 
   // Initialize an Ntuple Writer to save GHEP records into a TTree
   NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
@@ -359,6 +625,8 @@ void GenerateEventsUsingFluxOrTgtMix(void)
   if (!gOptOutFileName.empty()){
     ntpw.CustomizeFilename(gOptOutFileName);
   }
+  ntpw.CustomizeFilename(
+     utils::app_init::WorkerFilename(ntpw.Filename(), iworker));
   ntpw.Initialize();
 
   // Create an MC Job Monitor
@@ -369,32 +637,81 @@ void GenerateEventsUsingFluxOrTgtMix(void)
   if (!gOptStatFileName.empty()){
     mcjmonitor.CustomizeFilename(gOptStatFileName);
   }
+  mcjmonitor.CustomizeFilename(
+     utils::app_init::WorkerFilename(mcjmonitor.Filename(), iworker));
+
+
+  // Start the extra generation threads, if requested, each with its own
+  // flux, geometry and job drivers (the point geometry and generic fluxes
+  // are cheap to copy, and drivers of their own keep the threads' physics
+  // generation independent), and generate events on this thread too
+  int nthreads = RunOpt::Instance()->NThreads();
+  EventSink sink(gOptNevents, RunOpt::Instance()->OrderedEvents(), ntpw, mcjmonitor);
+  vector<std::thread> threads;
+  long int seed = RandomGen::Instance()->GetSeed();
+  for(int ithread = 1; ithread < nthreads; ithread++) {
+     threads.push_back(
+        std::thread(FluxOrTgtMixThread, ithread, seed, std::ref(sink)));
+  }
+  GenerateEventsUsingFluxOrTgtMix(*mcj_driver, sink);
+  JoinThreads(threads);
 
+  // Save the generated MC events
+  ntpw.Save();
 
-  // Generate events / print the GHEP record / add it to the ntuple
-  int ievent = 0;
-  while ( ievent < gOptNevents) {
-
-     LOG("gevgen", pNOTICE) << " *** Generating event............ " << ievent;
-
+  delete flux_driver;
+  delete geom_driver;
+  delete mcj_driver;;
+  delete gFluxSpectrum;
+  gFluxSpectrum = 0;
+}
+//____________________________________________________________________________
+void GenerateEventsUsingFluxOrTgtMix(GMCJDriver & mcj_driver, EventSink & sink)
+{
+  long int ievent = 0;
+  while (sink.Claim(ievent)) {
      // generate a single event for neutrinos coming from the specified flux
-     EventRecord * event = mcj_driver->GenerateEvent();
-
-     LOG("gevgen", pNOTICE) << "Generated Event GHEP Record: " << *event;
+     EventRecord * event = mcj_driver.GenerateEvent();
 
      // add event at the output ntuple, refresh the mc job monitor & clean-up
-     ntpw.AddEventRecord(ievent, event);
-     mcjmonitor.Update(ievent,event);
-     ievent++;
-     delete event;
+     sink.Add(ievent, event);
+     event->Release(); // recycle the record memory for the next event
   }
+}
+//____________________________________________________________________________
+void FluxOrTgtMixThread(int ithread, long int seed, EventSink & sink)
+{
+// An extra event generation thread, with drivers of its own
 
-  // Save the generated MC events
-  ntpw.Save();
+  InitializeThread(ithread, seed);
+
+  GFluxI *        flux_driver = FluxDriver();
+  GeomAnalyzerI * geom_driver = GeomDriver();
+  GMCJDriver *    mcj_driver  = MCJDriver(flux_driver, geom_driver);
+
+  GenerateEventsUsingFluxOrTgtMix(*mcj_driver, sink);
 
+  // delete the drivers before the thread's algorithms (on thread exit)
+  delete mcj_driver;
   delete flux_driver;
   delete geom_driver;
-  delete mcj_driver;;
+}
+//____________________________________________________________________________
+GMCJDriver * MCJDriver(GFluxI * flux_driver, GeomAnalyzerI * geom_driver)
+{
+// create & configure the monte carlo job driver
+
+  GMCJDriver * mcj_driver = new GMCJDriver;
+  mcj_driver->SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+  mcj_driver->SetUnphysEventMask(*RunOpt::Instance()->UnphysEventMask());
+  mcj_driver->UseFluxDriver(flux_driver);
+  mcj_driver->UseGeomAnalyzer(geom_driver);
+  mcj_driver->Configure();
+  mcj_driver->UseSplines();
+  if(!gOptWeighted)
+        mcj_driver->ForceSingleProbScale();
+
+  return mcj_driver;
 }
 //____________________________________________________________________________
 GeomAnalyzerI * GeomDriver(void)
@@ -431,7 +748,31 @@ GFluxI * TH1FluxDriver(void)
 {
 //
 //
+  // the spectrum is built once: the extra generation threads (--threads)
+  // use copies of the one built for the main thread
+  if(!gFluxSpectrum) gFluxSpectrum = FluxSpectrum();
+
+  TH1D * spectrum = new TH1D(*gFluxSpectrum);
+  spectrum->SetDirectory(0);
+
   flux::GCylindTH1Flux * flux = new flux::GCylindTH1Flux;
+
+  TVector3 bdir (0,0,1);
+  TVector3 bspot(0,0,0);
+
+  flux->SetNuDirection      (bdir);
+  flux->SetBeamSpot         (bspot);
+  flux->SetTransverseRadius (-1);
+  flux->AddEnergySpectrum   (gOptNuPdgCode, spectrum);
+
+  GFluxI * flux_driver = dynamic_cast<GFluxI *>(flux);
+  return flux_driver;
+}
+//____________________________________________________________________________
+TH1D * FluxSpectrum(void)
+{
+// build the flux spectrum from the -f input
+//
   TH1D * spectrum = 0;
 
   int flux_entries = 100000;
@@ -532,16 +873,7 @@ GFluxI * TH1FluxDriver(void)
   spectrum->Write();
   f.Close();
 
-  TVector3 bdir (0,0,1);
-  TVector3 bspot(0,0,0);
-
-  flux->SetNuDirection      (bdir);
-  flux->SetBeamSpot         (bspot);
-  flux->SetTransverseRadius (-1);
-  flux->AddEnergySpectrum   (gOptNuPdgCode, spectrum);
-
-  GFluxI * flux_driver = dynamic_cast<GFluxI *>(flux);
-  return flux_driver;
+  return spectrum;
 }
 //............................................................................
 #endif
@@ -789,7 +1121,13 @@ void PrintSyntax(void)
     << "\n              [--event-record-print-level level]"
     << "\n              [--mc-job-status-refresh-rate  rate]"
     << "\n              [--cache-file root_file]"
+    << "\n              [--max-xsec-table file]"
     << "\n              [--xml-path config_xml_dir]"
+    << "\n              [--workers n]"
+    << "\n              [--threads n]"
+    << "\n              [--ordered-events]"
+    << "\n              [--spline-storage mode]"
+    << "\n              [--channel-bias rules]"
     << "\n";
 }
 //____________________________________________________________________________
@@ -0,0 +1,455 @@
+//____________________________________________________________________________
+/*!
+
+\program gevbench_hadron
+
+\brief   Hadron transport (INTRANUKE) benchmark, based on gevgen_hadron.
+
+         Fires a fixed grid of hadron + nucleus interactions (probes x targets
+         x kinetic energies) through each of the requested INTRANUKE modes and
+         writes, for each mode and grid point, a machine-readable (XML)
+         summary of:
+          - the throughput (events/s) and the mean time per event,
+          - the mean number of memory allocations per event,
+          - the mean final state multiplicities and a checksum of the
+            generated final states.
+         The random number generator is re-seeded at every grid point, so the
+         checksums of the same mode, grid point, seed and number of events can
+         be compared across releases to spot any change in the generated
+         distributions, and the timings and allocations to spot regressions.
+         No events are saved.
+
+         Syntax :
+           gevbench_hadron [-n nev] [-p probes] [-t targets] [-k energies]
+                           [-m modes] [-o output_file]
+                           [--warm-up nev]
+                           [--seed random_number_seed]
+                           [--tune genie_tune]
+                           [--message-thresholds xml_file]
+                           [--xml-path config_xml_dir]
+
+         Options :
+           [] Denotes an optional argument
+           -n
+              Number of events generated at each grid point (default: 1000)
+           -p
+              Comma separated list of incoming hadron PDG codes
+              (default: 211,-211,2212,2112)
+           -t
+              Comma separated list of nuclear target PDG codes (10LZZZAAAI)
+              (default: 1000060120,1000260560,1000822080)
+           -k
+              Comma separated list of kinetic energies (in GeV)
+              (default: 0.1,0.3,1.0,3.0)
+           -m
+              Comma separated list of INTRANUKE modes, as in gevgen_hadron
+              <hA, hN, hA2018, hN2018, hA2019, hN2019> (default: hA,hA2018,hN2018)
+           -o
+              Output file name (default: gevbench_hadron.xml)
+           --warm-up
+              Number of events generated, and not measured, at each grid point
+              before the benchmark events, so that the mode tables and caches
+              are built (default: 10)
+           --seed
+              Random number seed (default: 1989)
+           --tune
+              Specifies a GENIE comprehensive neutrino interaction model tune.
+              [default: "Default"].
+           --message-thresholds
+              Allows users to customize the message stream thresholds.
+              The thresholds are specified using an XML file.
+              See $GENIE/config/Messenger.xml for the XML schema.
+           --xml-path
+              A directory to load XML files from - overrides $GXMLPATH, and $GENIE/config
+
+         Examples:
+
+         (1) Benchmark the hA and hA2018 modes for 165 MeV pi+ on C12 and Fe56:
+             % gevbench_hadron -p 211 -t 1000060120,1000260560 -k 0.165 -m hA,hA2018
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <TMath.h>
+#include <TLorentzVector.h>
+
+#include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordVisitorI.h"
+#include "Framework/EventGen/EVGThreadException.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/GHEP/GHepRecord.h"
+#include "Framework/GHEP/GHepStatus.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/ParticleData/PDGUtils.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+
+using std::string;
+using std::vector;
+using std::ofstream;
+using std::endl;
+
+using namespace genie;
+
+//____________________________________________________________________________
+// Memory allocation counter: the global operator new / delete are replaced
+// in this executable, so allocations made in the GENIE libraries are counted
+namespace {
+  unsigned long long gNAllocations = 0;
+}
+void * operator new (std::size_t size)
+{
+  gNAllocations++;
+  void * p = std::malloc(size ? size : 1);
+  if(!p) throw std::bad_alloc();
+  return p;
+}
+void * operator new[] (std::size_t size)
+{
+  gNAllocations++;
+  void * p = std::malloc(size ? size : 1);
+  if(!p) throw std::bad_alloc();
+  return p;
+}
+void operator delete   (void * p) noexcept { std::free(p); }
+void operator delete[] (void * p) noexcept { std::free(p); }
+
+//____________________________________________________________________________
+// Benchmark results at a grid point
+struct BenchPoint {
+  string mode;
+  int    probe;
+  int    target;
+  double ke;
+  int    nev;             // measured events
+  int    nfailed;         // events where the hadron transport threw
+  double time;            // wall time of the measured events (s)
+  unsigned long long nalloc; // allocations during the measured events
+  double nfs_p;           // summed final state multiplicities
+  double nfs_n;
+  double nfs_pi;
+  double nfs_other;
+  ULong64_t checksum;     // checksum of the final states
+};
+
+// Function prototypes
+void                        GetCommandLineArgs (int argc, char ** argv);
+const EventRecordVisitorI * GetIntranuke       (string mode);
+EventRecord *               InitializeEvent    (int probe, int target, double ke);
+void                        RunPoint           (const EventRecordVisitorI * intranuke, BenchPoint & point);
+void                        WriteResults       (const vector<BenchPoint> & points);
+void                        PrintSyntax        (void);
+
+// User-specified options:
+int      gOptNevents  = 1000;
+int      gOptNWarmUp  = 10;
+string   gOptProbes   = "211,-211,2212,2112";
+string   gOptTargets  = "1000060120,1000260560,1000822080";
+string   gOptEnergies = "0.1,0.3,1.0,3.0";
+string   gOptModes    = "hA,hA2018,hN2018";
+string   gOptOutFile  = "gevbench_hadron.xml";
+long int gOptRanSeed  = 1989;
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  if ( ! RunOpt::Instance()->Tune() ) {
+    LOG("gevbench_hadron", pFATAL) << " No TuneId in RunOption";
+    exit(-1);
+  }
+  RunOpt::Instance()->BuildTune();
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+  utils::app_init::RandGen(gOptRanSeed);
+
+  vector<string> modes    = utils::str::Split(gOptModes,    ",");
+  vector<string> probes   = utils::str::Split(gOptProbes,   ",");
+  vector<string> targets  = utils::str::Split(gOptTargets,  ",");
+  vector<string> energies = utils::str::Split(gOptEnergies, ",");
+
+  vector<BenchPoint> points;
+
+  for(unsigned int im = 0; im < modes.size(); im++) {
+    const EventRecordVisitorI * intranuke = GetIntranuke(modes[im]);
+    for(unsigned int ip = 0; ip < probes.size(); ip++) {
+      for(unsigned int it = 0; it < targets.size(); it++) {
+        for(unsigned int ie = 0; ie < energies.size(); ie++) {
+          BenchPoint point;
+          point.mode   = modes[im];
+          point.probe  = atoi(probes [ip].c_str());
+          point.target = atoi(targets[it].c_str());
+          point.ke     = atof(energies[ie].c_str());
+          RunPoint(intranuke, point);
+          points.push_back(point);
+
+          LOG("gevbench_hadron", pNOTICE)
+            << point.mode << ": probe = " << point.probe
+            << ", target = " << point.target << ", KE = " << point.ke
+            << " GeV : " << point.nev / TMath::Max(point.time, 1E-9)
+            << " events/s, " << (double) point.nalloc / TMath::Max(point.nev, 1)
+            << " allocations/event";
+        }
+      }
+    }
+  }
+
+  WriteResults(points);
+  return 0;
+}
+//____________________________________________________________________________
+void RunPoint(const EventRecordVisitorI * intranuke, BenchPoint & point)
+{
+  // same random numbers at each grid point, whatever the grid
+  RandomGen::Instance()->SetSeed(gOptRanSeed);
+
+  point.nev       = 0;
+  point.nfailed   = 0;
+  point.time      = 0.;
+  point.nalloc    = 0;
+  point.nfs_p     = 0.;
+  point.nfs_n     = 0.;
+  point.nfs_pi    = 0.;
+  point.nfs_other = 0.;
+  point.checksum  = 14695981039346656037ULL; // FNV-1a offset basis
+
+  for(int iev = -gOptNWarmUp; iev < gOptNevents; iev++) {
+    bool measured = (iev >= 0);
+
+    unsigned long long nalloc0 = gNAllocations;
+    std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+
+    EventRecord * evrec = InitializeEvent(point.probe, point.target, point.ke);
+    bool failed = false;
+    try {
+      intranuke->ProcessEventRecord(evrec);
+    }
+    catch (exceptions::EVGThreadException exception) {
+      failed = true;
+    }
+
+    std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+    unsigned long long nalloc1 = gNAllocations;
+
+    if(measured) {
+      point.nev++;
+      point.time   += std::chrono::duration<double>(t1 - t0).count();
+      point.nalloc += nalloc1 - nalloc0;
+      if(failed) point.nfailed++;
+    }
+
+    if(measured && !failed) {
+      // final state multiplicities and checksum of (pdg, KE in 10 keV units)
+      TObjArrayIter piter(evrec);
+      GHepParticle * p = 0;
+      while( (p = (GHepParticle *) piter.Next()) ) {
+        if(p->Status() != kIStStableFinalState) continue;
+        int pdgc = p->Pdg();
+        if      (pdgc == kPdgProton ) point.nfs_p++;
+        else if (pdgc == kPdgNeutron) point.nfs_n++;
+        else if (pdg::IsPion(pdgc)  ) point.nfs_pi++;
+        else                          point.nfs_other++;
+
+        long long values[2] = { pdgc, (long long) TMath::Nint(1E5 * p->KinE()) };
+        const unsigned char * bytes = (const unsigned char *) values;
+        for(unsigned int ib = 0; ib < sizeof(values); ib++) {
+          point.checksum ^= bytes[ib];
+          point.checksum *= 1099511628211ULL;  // FNV-1a prime
+        }
+      }
+    }
+    delete evrec;
+  }
+}
+//____________________________________________________________________________
+void WriteResults(const vector<BenchPoint> & points)
+{
+  ofstream out(gOptOutFile.c_str(), std::ios::out);
+  if(!out.is_open()) {
+    LOG("gevbench_hadron", pFATAL) << "Could not open file: " << gOptOutFile;
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  string tune = RunOpt::Instance()->Tune()->Name();
+
+  out << "<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?>" << endl;
+  out << "<!-- generated by gevbench_hadron: times in s, KE in GeV -->" << endl;
+  out << "<hadron_transport_benchmark tune=\"" << tune
+      << "\" seed=\"" << gOptRanSeed << "\" nev=\"" << gOptNevents
+      << "\" warm_up=\"" << gOptNWarmUp << "\">" << endl;
+  out << std::setprecision(6);
+  for(unsigned int i = 0; i < points.size(); i++) {
+    const BenchPoint & pt = points[i];
+    double nev = TMath::Max(pt.nev, 1);
+    double nok = TMath::Max(pt.nev - pt.nfailed, 1);
+    out << "  <point mode=\"" << pt.mode << "\" probe=\"" << pt.probe
+        << "\" target=\"" << pt.target << "\" ke=\"" << pt.ke << "\">" << endl;
+    out << "    <nev> "              << pt.nev                    << " </nev>" << endl;
+    out << "    <nfailed> "          << pt.nfailed                << " </nfailed>" << endl;
+    out << "    <time> "             << pt.time                   << " </time>" << endl;
+    out << "    <events_per_s> "     << pt.nev / TMath::Max(pt.time, 1E-9) << " </events_per_s>" << endl;
+    out << "    <time_per_event> "   << pt.time / nev             << " </time_per_event>" << endl;
+    out << "    <allocs_per_event> " << pt.nalloc / nev           << " </allocs_per_event>" << endl;
+    out << "    <mean_nfs_p> "       << pt.nfs_p / nok            << " </mean_nfs_p>" << endl;
+    out << "    <mean_nfs_n> "       << pt.nfs_n / nok            << " </mean_nfs_n>" << endl;
+    out << "    <mean_nfs_pi> "      << pt.nfs_pi / nok           << " </mean_nfs_pi>" << endl;
+    out << "    <mean_nfs_other> "   << pt.nfs_other / nok        << " </mean_nfs_other>" << endl;
+    out << "    <checksum> " << std::hex << pt.checksum << std::dec << " </checksum>" << endl;
+    out << "  </point>" << endl;
+  }
+  out << "</hadron_transport_benchmark>" << endl;
+  out.close();
+
+  LOG("gevbench_hadron", pNOTICE)
+    << "Saved " << points.size() << " benchmark points in: " << gOptOutFile;
+}
+//____________________________________________________________________________
+const EventRecordVisitorI * GetIntranuke(string mode)
+{
+// get the requested INTRANUKE module (same modes as gevgen_hadron)
+
+  string sname = "";
+  if      (mode == "hA"    ) sname = "genie::HAIntranuke";
+  else if (mode == "hN"    ) sname = "genie::HNIntranuke";
+  else if (mode == "hA2019") sname = "genie::HAIntranuke2019";
+  else if (mode == "hN2019") sname = "genie::HNIntranuke2019";
+  else if (mode == "hA2018") sname = "genie::HAIntranuke2018";
+  else if (mode == "hN2018") sname = "genie::HNIntranuke2018";
+  else {
+    LOG("gevbench_hadron", pFATAL) << "Invalid Intranuke mode: " << mode;
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  const EventRecordVisitorI * intranuke =
+     dynamic_cast<const EventRecordVisitorI *> (
+         AlgFactory::Instance()->GetAlgorithm(sname, "Default"));
+  if(!intranuke) {
+    LOG("gevbench_hadron", pFATAL)
+      << "Couldn't get hadron transport module: " << sname << "/Default";
+    gAbortingInErr = true;
+    exit(1);
+  }
+  return intranuke;
+}
+//____________________________________________________________________________
+EventRecord * InitializeEvent(int probe, int target, double ke)
+{
+// Initialize event record. Inserting the probe and target particles.
+
+  EventRecord * evrec = new EventRecord();
+  Interaction * interaction = new Interaction;
+  evrec->AttachSummary(interaction);
+
+  // dummy vertex position
+  TLorentzVector x4null(0.,0.,0.,0.);
+
+  // incident hadron & target nucleon masses
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+  double mh  = pdglib -> Find (probe ) -> Mass();
+  double M   = pdglib -> Find (target) -> Mass();
+
+  // form  incident hadron and target 4-momenta
+  double Eh  = mh + ke;
+  double pzh = TMath::Sqrt(TMath::Max(0.,Eh*Eh-mh*mh));
+  TLorentzVector p4h   (0.,0.,pzh,Eh);
+  TLorentzVector p4tgt (0.,0.,0., M);
+
+  // insert probe and target entries
+  GHepStatus_t ist = kIStInitialState;
+  evrec->AddParticle(probe,  ist, -1,-1,-1,-1, p4h,   x4null);
+  evrec->AddParticle(target, ist, -1,-1,-1,-1, p4tgt, x4null);
+
+  return evrec;
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gevbench_hadron", pNOTICE) << "Parsing command line arguments";
+
+  // Common run options. Set defaults and read.
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  // Parse run options for this app
+
+  CmdLnArgParser parser(argc,argv);
+
+  if( parser.OptionExists('n') ) {
+    gOptNevents = parser.ArgAsInt('n');
+  }
+  if( parser.OptionExists('p') ) {
+    gOptProbes = parser.ArgAsString('p');
+  }
+  if( parser.OptionExists('t') ) {
+    gOptTargets = parser.ArgAsString('t');
+  }
+  if( parser.OptionExists('k') ) {
+    gOptEnergies = parser.ArgAsString('k');
+  }
+  if( parser.OptionExists('m') ) {
+    gOptModes = parser.ArgAsString('m');
+  }
+  if( parser.OptionExists('o') ) {
+    gOptOutFile = parser.ArgAsString('o');
+  }
+  if( parser.OptionExists("warm-up") ) {
+    gOptNWarmUp = parser.ArgAsInt("warm-up");
+  }
+  if( parser.OptionExists("seed") ) {
+    gOptRanSeed = parser.ArgAsLong("seed");
+  }
+  if(gOptNevents <= 0 || gOptNWarmUp < 0) {
+    LOG("gevbench_hadron", pFATAL) << "Invalid number of events - Exiting";
+    PrintSyntax();
+    exit(1);
+  }
+
+  LOG("gevbench_hadron", pNOTICE)
+     << "\n Modes : " << gOptModes
+     << "\n Probes : " << gOptProbes
+     << "\n Targets : " << gOptTargets
+     << "\n Kinetic energies : " << gOptEnergies
+     << "\n Events per point : " << gOptNevents << " (+" << gOptNWarmUp << " warm-up)"
+     << "\n Random number seed : " << gOptRanSeed
+     << "\n Output file : " << gOptOutFile;
+
+  LOG("gevbench_hadron", pNOTICE) << *RunOpt::Instance();
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gevbench_hadron", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gevbench_hadron [-n nev] [-p probes] [-t targets] [-k energies]"
+    << " [-m modes] [-o output_file] [--warm-up nev]"
+    << " [--seed seed_number]"
+    << " [--tune genie_tune]"
+    << " [--xml-path config_xml_dir]"
+    << " [--message-thresholds xml_file]\n\n";
+}
+//____________________________________________________________________________
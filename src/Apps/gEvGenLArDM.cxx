@@ -402,6 +402,7 @@ int main(int argc, char ** argv)
   // messenger thresholds, cache file
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
   utils::app_init::CacheFile(RunOpt::Instance()->CacheFile());
+  utils::app_init::MaxXSecTable(RunOpt::Instance()->MaxXSecTableFile());
   utils::app_init::RandGen(gOptRanSeed);
   utils::app_init::XSecTable(gOptInpXSecFile, false);
 
@@ -1244,6 +1245,8 @@ void CreateFidSelection (string fidcut, GeomAnalyzerI* geom_driver)
     LOG("gevgen_lardm", pNOTICE) << "Reverse sense of fiducial volume cut";
   }
   rgeom->AdoptGeomVolSelector(fidsel);
+  // place the vertices in the (trimmed) swum path segments
+  rgeom->SetVtxFromSegments(true);
 
 }
 //____________________________________________________________________________
@@ -1342,6 +1345,8 @@ void CreateRockBoxSelection (string fidcut, GeomAnalyzerI* geom_driver)
   else              rocksel->MakeBox(xyzmin,xyzmax);
 
   rgeom->AdoptGeomVolSelector(rocksel);
+  // place the vertices in the (trimmed) swum path segments
+  rgeom->SetVtxFromSegments(true);
 
 }
 //____________________________________________________________________________
@@ -37,6 +37,7 @@
                    [-o output_file]
                    [--message-thresholds xmfile]
                    [--event-record-print-level level]
+                   [--prefetch depth]
 
          Options:
 
@@ -72,6 +73,9 @@
                     any (anti)neutrino CC with at least one hyperon 
                     (\Sigma^{+,0,-}, \Lambda^{0}, \Xi^{0,-}, \Omega^{-}) in final state
                 - <can add more / please send request to constantinos.andreopoulos \at cern.ch>
+              Files written with an event index tree (`gindex', see NtpMCEventIndex)
+              are selected from the small index alone and only the picked GHEP
+              entries are read. Files without one are read in full.
            -o 
               Specify output filename.
               (optional, default: gntp.<topology>.ghep.root)
@@ -82,6 +86,9 @@
           --event-record-print-level
               Allows users to set the level of information shown when the event
               record is printed in the screen. See GHepRecord::Print().
+          --prefetch
+              Read up to `depth' picked events ahead on a background thread.
+              (optional, default: 0, no prefetching)
 
          Examples:
 
@@ -107,19 +114,18 @@
 #include <sstream>
 
 #include <TSystem.h>
-#include <TFile.h>
 #include <TTree.h>
-#include <TChain.h>
-#include <TChainElement.h>
+#include <TObjString.h>
 
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/GHEP/GHepStatus.h"
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/GHEP/GHepUtils.h"
+#include "Framework/Interaction/InteractionType.h"
 #include "Framework/Ntuple/NtpMCFormat.h"
-#include "Framework/Ntuple/NtpMCTreeHeader.h"
-#include "Framework/Ntuple/NtpMCEventRecord.h"
+#include "Framework/Ntuple/NtpMCEventIndex.h"
+#include "Framework/Ntuple/NtpReader.h"
 #include "Framework/Ntuple/NtpWriter.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/ParticleData/PDGCodes.h"
@@ -138,7 +144,8 @@ using namespace genie;
 // func prototypes
 void   GetCommandLineArgs (int argc, char ** argv);
 void   RunCherryPicker    (void);
-bool   AcceptEvent        (const EventRecord & event);
+bool   AcceptIndexedEvent (const NtpMCEventIndex & index);
+bool   AcceptEvent        (int nupdg, bool iscc, bool isnc, unsigned int topo);
 void   PrintSyntax        (void);
 string DefaultOutputFile  (void);
 
@@ -162,6 +169,7 @@ typedef enum EGPickTopo {
 string      gOptInpFileNames;  ///< input file name
 string      gOptOutFileName;   ///< output file name
 GPickTopo_t gPickedTopology;   ///< output file format id
+int         gOptPrefetch;      ///< depth of the input prefetch queue
 
 //____________________________________________________________________________________
 int main(int argc, char ** argv)
@@ -193,74 +201,39 @@ void RunCherryPicker(void)
   Long64_t iev_glob = 0;
 
   // Load input trees. More than one trees can be loaded here if a wildcard was
-  // specified with -f (eg -f /data/myfiles/genie/*.ghep.root)
+  // specified with -f (eg -f /data/myfiles/genie/*.ghep.root).
+  // If the input files have an event index, events are selected from the
+  // index and only the picked events are read.
 
-  TChain gchain;
-  gchain.Add(gOptInpFileNames.c_str());
-
-  TObjArray * file_array = gchain.GetListOfFiles();
-  int nfiles = file_array->GetEntries();
+  NtpReader reader;
+  int nfiles = reader.AddFiles(gOptInpFileNames);
   LOG("gevpick", pFATAL) 
       << "Processing " << nfiles
       << (nfiles==1 ? " file " : " files ");
+  if(!reader.Initialize()) {
+    LOG("gevpick", pERROR) << "No GHEP events to cherry-pick";
+    return;
+  }
+  if(reader.HasIndex()) {
+    LOG("gevpick", pNOTICE) << "Selecting events using the event index";
+  }
+  if(gPickedTopology != kPtAll) reader.SetFilter(AcceptIndexedEvent);
+  reader.SetPrefetch(gOptPrefetch);
 
   //
-  // Loop over input event files
+  // Loop over the accepted events
   //
 
-  TIter next_file(file_array);
-  TChainElement *chEl=0;
-
-  while (( chEl=(TChainElement*)next_file() )) {
-
-     TFile fin(chEl->GetTitle(),"read");
-     TTree * ghep_tree = 
-        dynamic_cast <TTree *> ( fin.Get("gtree")  );
-
-     if(!ghep_tree) {
-        LOG("gevpick", pWARN) 
-           << "No GHEP tree found in " << chEl->GetTitle();
-        LOG("gevpick", pWARN) 
-           << "Skipping to next file...";
-        continue;
-     }
-
-     NtpMCEventRecord * mcrec = 0;
-     ghep_tree->SetBranchAddress("gmcrec", &mcrec);
-     if (!mcrec) {
-       LOG("gevpick", pERROR) << "Null MC record";
-       return;
-     }
-     Long64_t nmax = ghep_tree->GetEntries();
-     LOG("gevpick", pNOTICE) 
-        << "* Analyzing: " << nmax 
-        << " events from GHEP tree in file: " << chEl->GetTitle();
-
-     NtpMCTreeHeader * thdr = 
-        dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
-     LOG("gevpick", pNOTICE) 
-          << "Input tree header: " << *thdr;
-
-     //
-     // Loop over events in current file
-     //
-
-     for(Long64_t iev = 0; iev < nmax; iev++) {
-       ghep_tree->GetEntry(iev);
-       NtpMCRecHeader rec_header = mcrec->hdr;
-       EventRecord &  event      = *(mcrec->event);
-       LOG("gevpick", pDEBUG) << rec_header;
-       LOG("gevpick", pDEBUG) << event;
-       if(AcceptEvent(event)) {
-          brOrigFilename->SetString(chEl->GetTitle());
-          brOrigEvtNum = iev;
-          ntpw.AddEventRecord( iev_glob, &event );
-          iev_glob++;
-       }
-       mcrec->Clear();
-
-    } // event loop (current file)
-  }// file loop
+  Long64_t iev = -1;
+  while ( (iev = reader.Next()) >= 0 ) {
+     const EventRecord * event = reader.Event(iev);
+     if(!event) continue;
+     LOG("gevpick", pDEBUG) << *event;
+     brOrigFilename->SetString(reader.FileName(iev).c_str());
+     brOrigEvtNum = reader.LocalEntry(iev);
+     ntpw.AddEventRecord( iev_glob, event );
+     iev_glob++;
+  } // event loop
 
   // save the cherry-picked MC events
   ntpw.Save();
@@ -268,78 +241,29 @@ void RunCherryPicker(void)
   LOG("gevpick", pFATAL) << "Done!";
 }
 //____________________________________________________________________________________
-bool AcceptEvent(const EventRecord & event)
+bool AcceptIndexedEvent(const NtpMCEventIndex & index)
+{
+  return AcceptEvent(index.probe, 
+     index.intr == kIntWeakCC, index.intr == kIntWeakNC, index.topo);
+}
+//____________________________________________________________________________________
+bool AcceptEvent(int nupdg, bool iscc, bool isnc, unsigned int topo)
 {
   if ( gPickedTopology == kPtAll       ) return true;
   if ( gPickedTopology == kPtUndefined ) return false;
 
-  const Interaction * interaction = event.Summary();
-
-  int  nupdg     = event.Probe()->Pdg();
   bool isnumu    = (nupdg == kPdgNuMu);
   bool isnumubar = (nupdg == kPdgAntiNuMu);
-  bool iscc      = interaction->ProcInfo().IsWeakCC();
-  bool isnc      = interaction->ProcInfo().IsWeakNC();
-
-  int NfP        = 0; // number of protons         in final state
-  int NfPbar     = 0; // number of anti-protons    in final state
-  int NfN        = 0; // number of neutrons        in final state
-  int NfNbar     = 0; // number of anti-neutrons   in final state
-  int NfPip      = 0; // number of \pi^+'s         in final state
-  int NfPim      = 0; // number of \pi^-'s         in final state
-  int NfPi0      = 0; // number of \pi^0's         in final state
-  int NfKp       = 0; // number of \K^+'s          in final state
-  int NfKm       = 0; // number of \K^-'s          in final state
-  int NfK0       = 0; // number of \K^0's          in final state
-  int NfK0bar    = 0; // number of \bar{\K^0}'s    in final state
-  int NfSigmap   = 0; // number of \Sigma^+'s      in final state
-  int NfSigma0   = 0; // number of \Sigma^0's      in final state
-  int NfSigmam   = 0; // number of \Sigma^-'s      in final state
-  int NfLambda0  = 0; // number of \Lambda^0's     in final state
-  int NfXi0      = 0; // number of \Xi^0's         in final state
-  int NfXim      = 0; // number of \Xi^-'s         in final state
-  int NfOmegam   = 0; // number of \Omega^-'s      in final state
-  int NfOther    = 0; // number of other particles in final state
-
-  TObjArrayIter piter(&event);
-  GHepParticle * p = 0;
-  int ip=-1;
-  while( (p = (GHepParticle *) piter.Next())) {
-    ip++;
-    int pdgc = p->Pdg();
-    int ist  = p->Status();
-    // only final state particles
-    if(ist!=kIStStableFinalState) continue;
-    // don't count final state lepton as part of the hadronic system
-    if(event.Particle(ip)->FirstMother()==0) continue;
-    // skip pseudo-particles
-    if(pdg::IsPseudoParticle(pdgc)) continue;
-    // count ...
-    if      (pdgc == kPdgProton     ) NfP++;
-    else if (pdgc == kPdgAntiProton ) NfPbar++;
-    else if (pdgc == kPdgNeutron    ) NfN++;
-    else if (pdgc == kPdgAntiNeutron) NfNbar++;
-    else if (pdgc == kPdgPiP        ) NfPip++;
-    else if (pdgc == kPdgPiM        ) NfPim++;
-    else if (pdgc == kPdgPi0        ) NfPi0++;
-    else if (pdgc == kPdgKP         ) NfKp++;
-    else if (pdgc == kPdgKM         ) NfKm++;
-    else if (pdgc == kPdgK0         ) NfK0++;
-    else if (pdgc == kPdgAntiK0     ) NfK0bar++;
-    else if (pdgc == kPdgSigmaP     ) NfSigmap++;
-    else if (pdgc == kPdgSigma0     ) NfSigma0++;
-    else if (pdgc == kPdgSigmaM     ) NfSigmam++;
-    else if (pdgc == kPdgLambda     ) NfLambda0++;
-    else if (pdgc == kPdgXi0        ) NfXi0++;
-    else if (pdgc == kPdgXiM        ) NfXim++;
-    else if (pdgc == kPdgOmegaM     ) NfOmegam++;
-    else                              NfOther++;
-  }
+
+  int NfPip      = utils::ghep::FinalStateCount(topo, utils::ghep::kFSTopoPiP);
+  int NfPim      = utils::ghep::FinalStateCount(topo, utils::ghep::kFSTopoPiM);
+  int NfPi0      = utils::ghep::FinalStateCount(topo, utils::ghep::kFSTopoPi0);
+  int NfHyperon  = utils::ghep::FinalStateCount(topo, utils::ghep::kFSTopoHyperon);
 
   bool is1pipX  = (NfPip==1 && NfPi0==0 && NfPim==0);
   bool is1pi0X  = (NfPip==0 && NfPi0==1 && NfPim==0);
   bool is1pimX  = (NfPip==0 && NfPi0==0 && NfPim==1);
-  bool has_hype = (NfSigmap+NfSigma0+NfSigmam+NfLambda0+NfXi0+NfXim+NfOmegam > 0);
+  bool has_hype = (NfHyperon > 0);
 
   if ( gPickedTopology == kPtNumuCC1pip ) {
     if(isnumu && iscc && is1pipX) return true;
@@ -437,6 +361,13 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptOutFileName = DefaultOutputFile();
   }
 
+  // prefetch queue depth
+  if( parser.OptionExists("prefetch") ) {
+    gOptPrefetch = parser.ArgAsInt("prefetch");
+  } else {
+    gOptPrefetch = 0;
+  }
+
   // Summarize
   LOG("gevpick", pNOTICE) 
     << "\n\n gevpick job info: "
@@ -3,15 +3,25 @@
 
 \program gevscan
 
-\brief   A utility that reads-in a GHEP event tree and performs basic sanity 
+\brief   A utility that reads-in a GHEP event tree and performs basic sanity
          checks / test whether the generated events obey basic conservation laws
 
+         All the selected checks are run in a single pass over the events.
+         GHEP and flat (kNFFlat) event trees are read, from any number of
+         files (wildcards accepted, see NtpReader). With --threads n the
+         events are split in n consecutive ranges, scanned in parallel, and
+         the error statistics of the ranges are then merged (in event order).
+         The error log lists the failing events of each check, followed by
+         full event record printouts for a capped sample of them.
+
 \syntax  gevscan
-             -f ghep_event_file 
+             -f ghep_event_file
             [-o output_error_log_file]
             [-n nev1[,nev2]]
             [--add-event-printout-in-error-log]
             [--max-num-of-errors-shown n]
+            [--max-num-of-printouts n]
+            [--threads n]
             [--event-record-print-level level]
             [--check-energy-momentum-conservation]
             [--check-charge-conservation]
@@ -22,6 +32,11 @@
             [--check-decayer-consistency]
             [--all]
 
+         --max-num-of-errors-shown caps the failing events listed for each
+         check (all failures are counted). --max-num-of-printouts (default:
+         10) caps the failing events of each check whose full record is
+         printed out (in the error log with --add-event-printout-in-error-log).
+
 \author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
  University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -29,18 +44,22 @@
 
 \cpright Copyright (c) 2003-2020, The GENIE Collaboration
          For the full text of the license visit http://copyright.genie-mc.org
-         
+
 */
 //____________________________________________________________________________
 
 //#define __debug__
 
+#include <map>
 #include <string>
+#include <thread>
 #include <vector>
 #include <iomanip>
 #include <sstream>
 #include <fstream>
 
+#include <RVersion.h>
+#include <TROOT.h>
 #include <TSystem.h>
 #include <TFile.h>
 #include <TTree.h>
@@ -51,8 +70,7 @@
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/Ntuple/NtpMCFormat.h"
-#include "Framework/Ntuple/NtpMCTreeHeader.h"
-#include "Framework/Ntuple/NtpMCEventRecord.h"
+#include "Framework/Ntuple/NtpReader.h"
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
@@ -62,6 +80,7 @@
 #include "Framework/Utils/CmdLnArgParser.h"
 #include "Framework/Utils/RunOpt.h"
 
+using std::map;
 using std::ostringstream;
 using std::ofstream;
 using std::string;
@@ -75,39 +94,92 @@ using std::endl;
 using namespace genie;
 using namespace genie::constants;
 
+// the per-event checks
+typedef enum EScanCheck {
+  kChkEnergyMomentum = 0,
+  kChkCharge,
+  kChkPseudoParticles,
+  kChkOffMassShell,
+  kChkNumFinStateNucleons,
+  kNChecks
+} ScanCheck_t;
+
+// the error statistics of a range of events
+typedef struct SScanStats {
+  Long64_t              nerr     [kNChecks]; ///< failing events
+  vector<Long64_t>      failed   [kNChecks]; ///< failing events listed (up to the max shown)
+  vector<string>        printout [kNChecks]; ///< record printouts of the first failing events
+  map<int, vector<double> > vtx_r;     ///< (Z,A) code -> vertex radius distribution
+  map<int, Long64_t>        vtx_first; ///< (Z,A) code -> first event on that target
+  map<int, Long64_t>        first_fs;  ///< pdg code -> first event with it in the final state
+  map<int, Long64_t>        first_dec; ///< pdg code -> first event with it decayed
+} ScanStats_t;
+
 void GetCommandLineArgs (int argc, char ** argv);
 void PrintSyntax        (void);
 bool CheckRootFilename  (string filename);
 
+// scanning & merging
+void ScanEvents   (ScanStats_t & stats);
+void ScanRange    (NtpReader & reader, Long64_t first, Long64_t last, ScanStats_t & stats);
+void MergeStats   (ScanStats_t & stats, const ScanStats_t & part);
+void ReportCheck  (ScanCheck_t check, const ScanStats_t & stats);
+
 // checks
-void CheckEnergyMomentumConservation (void);
-void CheckChargeConservation (void);
-void CheckForPseudoParticlesInFinState (void);
-void CheckForOffMassShellParticlesInFinState (void);
-void CheckForNumFinStateNucleonsInconsistentWithTarget (void);
-void CheckVertexDistribution (void);
-void CheckDecayerConsistency (void);
+bool CheckEnergyMomentumConservation (const EventRecord & event);
+bool CheckChargeConservation (const EventRecord & event);
+bool CheckForPseudoParticlesInFinState (const EventRecord & event);
+bool CheckForOffMassShellParticlesInFinState (const EventRecord & event);
+bool CheckForNumFinStateNucleonsInconsistentWithTarget (const EventRecord & event);
+void FillVertexDistribution (const EventRecord & event, Long64_t iev, ScanStats_t & stats);
+void FillDecayerLists (const EventRecord & event, Long64_t iev, ScanStats_t & stats);
+void CheckVertexDistribution (const ScanStats_t & stats);
+void CheckDecayerConsistency (const ScanStats_t & stats);
 
 // options
 string   gOptInpFilename = "";
 string   gOptOutFilename = "";
 Long64_t gOptNEvtL = -1;
 Long64_t gOptNEvtH = -1;
-int      gOptMaxNumErrs = -1; 
+int      gOptMaxNumErrs = -1;
+int      gOptMaxNumPrintouts = 10;
+int      gOptNThreads = 1;
 bool     gOptAddEventPrintoutInErrLog = false;
-bool     gOptCheckEnergyMomentumConservation = false;
-bool     gOptCheckChargeConservation = false;
-bool     gOptCheckForPseudoParticlesInFinState = false;
-bool     gOptCheckForOffMassShellParticlesInFinState = false;
-bool     gOptCheckForNumFinStateNucleonsInconsistentWithTarget = false;
+bool     gOptCheck[kNChecks] = { false, false, false, false, false };
 bool     gOptCheckVertexDistribution = false;
 bool     gOptCheckDecayerConsistency = false;
 
+// description of each per-event check
+const char * kChkErrLogTitle[kNChecks] = {
+  "# Events failing the energy-momentum conservation test:",
+  "# Events failing the charge conservation test:",
+  "# Events with pseudo-particles in final state:",
+  "# Events with off-mass-shell particles in final state:",
+  "# Events with number of final state nucleons inconsistent with target:"
+};
+const char * kChkFailure[kNChecks] = {
+  "Energy-momentum non-conservation",
+  "Charge non-conservation",
+  "Pseudo-particle final state particle",
+  "Off-mass-shell final state particle",
+  "Number of final state nucleons inconsistent with target"
+};
+const char * kChkSummary[kNChecks] = {
+  " events failing the energy/momentum conservation test",
+  " events failing the charge conservation test",
+  " events with pseudo-particles in  final state",
+  " events with off-mass-shell particles in final state",
+  " events with a number of final state nucleons inconsistent with target"
+};
+
+// the intranuclear vertex radius distribution (fm)
+const int    kNVtxBins = 150;
+const double kVtxRMax  = 30.;
+
 Long64_t gFirstEventNum = -1;
 Long64_t gLastEventNum  = -1;
 
-TTree *            gEventTree = 0;
-NtpMCEventRecord * gMCRec = 0;
+NtpReader *        gReader = 0;
 ofstream           gErrLog;
 
 //____________________________________________________________________________
@@ -118,23 +190,23 @@ int main(int argc, char ** argv)
   // Set GHEP print level
   GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
 
-  TFile file(gOptInpFilename.c_str(),"READ");
-
-  NtpMCTreeHeader * thdr = dynamic_cast <NtpMCTreeHeader *> ( file.Get("header") );
-  LOG("gevscan", pINFO) << "Input tree header: " << *thdr;
-  NtpMCFormat_t format = thdr->format;
-  if(format != kNFGHEP) {
-      LOG("gevscan", pERROR) 
+  NtpReader reader;
+  if(reader.AddFiles(gOptInpFilename) == 0 || !reader.Initialize()) {
+    LOG("gevscan", pFATAL)
+      << "Couldn't read the event tree of: " << gOptInpFilename;
+    gAbortingInErr = true;
+    exit(1);
+  }
+  NtpMCFormat_t format = reader.Format();
+  if(format != kNFGHEP && format != kNFFlat) {
+      LOG("gevscan", pERROR)
         << "*** Unsupported event-tree format : "
         << NtpMCFormat::AsString(format);
-      file.Close();
       return 3;
   }
+  gReader = &reader;
 
-  gEventTree = dynamic_cast <TTree *> (file.Get("gtree"));
-  gEventTree->SetBranchAddress("gmcrec", &gMCRec);
-
-  Long64_t nev = gEventTree->GetEntries();
+  Long64_t nev = reader.NEvents();
   if(gOptNEvtL == -1 && gOptNEvtH == -1) {
     // read all events
     gFirstEventNum = 0;
@@ -152,7 +224,7 @@ int main(int argc, char ** argv)
     }
   }
 
-  
+
   if(gOptOutFilename.size() == 0) {
      ostringstream logfile;
      logfile << gOptInpFilename << ".errlog";
@@ -166,26 +238,17 @@ int main(int argc, char ** argv)
      gErrLog << "# " << endl;
   }
 
-  if (gOptCheckEnergyMomentumConservation) {
-	  CheckEnergyMomentumConservation();
-  }
-  if (gOptCheckChargeConservation) {
-          CheckChargeConservation();
-  }
-  if (gOptCheckForPseudoParticlesInFinState) {
-          CheckForPseudoParticlesInFinState();
-  }
-  if (gOptCheckForOffMassShellParticlesInFinState) {
-          CheckForOffMassShellParticlesInFinState();
-  }
-  if (gOptCheckForNumFinStateNucleonsInconsistentWithTarget) {
-          CheckForNumFinStateNucleonsInconsistentWithTarget();
+  ScanStats_t stats;
+  ScanEvents(stats);
+
+  for(int ichk = 0; ichk < kNChecks; ichk++) {
+    if(gOptCheck[ichk]) ReportCheck( (ScanCheck_t) ichk, stats);
   }
   if (gOptCheckVertexDistribution) {
-          CheckVertexDistribution();
+          CheckVertexDistribution(stats);
   }
   if (gOptCheckDecayerConsistency) {
-          CheckDecayerConsistency();
+          CheckDecayerConsistency(stats);
   }
 
 
@@ -196,28 +259,182 @@ int main(int argc, char ** argv)
   return 0;
 }
 //____________________________________________________________________________
-void CheckEnergyMomentumConservation (void)
+void ScanEvents(ScanStats_t & stats)
 {
-  LOG("gevscan", pNOTICE) << "Checking energy/momentum conservation...";
+// Runs all the selected checks in a single pass over the events, splitting
+// them in consecutive ranges scanned (each with a reader of its own) on
+// separate threads, and merges the error statistics of the ranges in order
 
-  if(gErrLog.is_open()) {
-    gErrLog << "# Events failing the energy-momentum conservation test:" << endl;
-    gErrLog << "# " << endl;
+  for(int ichk = 0; ichk < kNChecks; ichk++) stats.nerr[ichk] = 0;
+
+  Long64_t nev = gLastEventNum - gFirstEventNum + 1;
+  Long64_t nranges = TMath::Max(1LL, TMath::Min((Long64_t)gOptNThreads, nev));
+#if ROOT_VERSION_CODE < ROOT_VERSION(6,6,0)
+  if(nranges > 1) {
+    LOG("gevscan", pWARN)
+      << "Scanning in parallel needs ROOT >= 6.06 - Using a single thread";
+    nranges = 1;
   }
+#endif
 
-  int nerr = 0;
+  if(nranges == 1) {
+    ScanRange(*gReader, gFirstEventNum, gLastEventNum, stats);
+    return;
+  }
 
-  for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
-  {
-    if(gOptMaxNumErrs != -1 && nerr >= gOptMaxNumErrs) break;
+  LOG("gevscan", pNOTICE)
+     << "*** Scanning " << nev << " events on " << nranges << " threads";
 
-    gEventTree->GetEntry(i);
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,6,0)
+  ROOT::EnableThreadSafety();
+#endif
+
+  // the libraries used by the checks are set up before the threads start
+  PDGLibrary::Instance();
 
-    NtpMCRecHeader rec_header = gMCRec->hdr;
-    EventRecord &  event      = *(gMCRec->event);
+  vector<NtpReader *>  readers(nranges, (NtpReader *) 0);
+  vector<ScanStats_t>  parts  (nranges);
+  vector<std::thread>  workers;
+  for(Long64_t irange = 0; irange < nranges; irange++) {
+    readers[irange] = new NtpReader;
+    readers[irange]->AddFiles(gOptInpFilename);
+    readers[irange]->Initialize();
+    for(int ichk = 0; ichk < kNChecks; ichk++) parts[irange].nerr[ichk] = 0;
+  }
+  for(Long64_t irange = 0; irange < nranges; irange++) {
+    Long64_t first = gFirstEventNum + (nev *  irange   ) / nranges;
+    Long64_t last  = gFirstEventNum + (nev * (irange+1)) / nranges - 1;
+    workers.push_back(std::thread(ScanRange, std::ref(*readers[irange]),
+                                  first, last, std::ref(parts[irange])));
+  }
+  for(unsigned int iw = 0; iw < workers.size(); iw++) {
+    workers[iw].join();
+  }
+  for(Long64_t irange = 0; irange < nranges; irange++) {
+    MergeStats(stats, parts[irange]);
+    delete readers[irange];
+  }
+}
+//____________________________________________________________________________
+void ScanRange(
+  NtpReader & reader, Long64_t first, Long64_t last, ScanStats_t & stats)
+{
+  typedef bool (*Check_t) (const EventRecord &);
+  Check_t checks[kNChecks] = {
+    CheckEnergyMomentumConservation,
+    CheckChargeConservation,
+    CheckForPseudoParticlesInFinState,
+    CheckForOffMassShellParticlesInFinState,
+    CheckForNumFinStateNucleonsInconsistentWithTarget
+  };
+
+  for(Long64_t i = first; i <= last; i++)
+  {
+    const EventRecord * ev = reader.Event(i);
+    if(!ev) {
+      LOG("gevscan", pERROR) << "Couldn't read event: " << i;
+      continue;
+    }
+    const EventRecord & event = *ev;
 
     LOG("gevscan", pINFO) << "Checking event.... " << i;
 
+    for(int ichk = 0; ichk < kNChecks; ichk++) {
+      if(!gOptCheck[ichk] || checks[ichk](event)) continue;
+
+      // full record printouts for the first failures only
+      bool printout = (Long64_t) stats.printout[ichk].size() < gOptMaxNumPrintouts;
+      if(printout) {
+        LOG("gevscan", pERROR)
+          << " ** " << kChkFailure[ichk] << " in event: " << i
+          << "\n"
+          << event;
+        ostringstream record;
+        record << event;
+        stats.printout[ichk].push_back(record.str());
+      } else {
+        LOG("gevscan", pERROR)
+          << " ** " << kChkFailure[ichk] << " in event: " << i;
+      }
+      if(gOptMaxNumErrs == -1 || stats.nerr[ichk] < gOptMaxNumErrs) {
+        stats.failed[ichk].push_back(i);
+      }
+      stats.nerr[ichk]++;
+    }
+    if(gOptCheckVertexDistribution) FillVertexDistribution(event, i, stats);
+    if(gOptCheckDecayerConsistency) FillDecayerLists      (event, i, stats);
+  }//i
+}
+//____________________________________________________________________________
+void MergeStats(ScanStats_t & stats, const ScanStats_t & part)
+{
+// Adds the statistics of the next range of events
+
+  for(int ichk = 0; ichk < kNChecks; ichk++) {
+    for(unsigned int j = 0; j < part.failed[ichk].size(); j++) {
+      if(gOptMaxNumErrs != -1 &&
+         (Long64_t) stats.failed[ichk].size() >= gOptMaxNumErrs) break;
+      stats.failed[ichk].push_back(part.failed[ichk][j]);
+    }
+    for(unsigned int j = 0; j < part.printout[ichk].size(); j++) {
+      if((Long64_t) stats.printout[ichk].size() >= gOptMaxNumPrintouts) break;
+      stats.printout[ichk].push_back(part.printout[ichk][j]);
+    }
+    stats.nerr[ichk] += part.nerr[ichk];
+  }
+
+  map<int, vector<double> >::const_iterator vit = part.vtx_r.begin();
+  for( ; vit != part.vtx_r.end(); ++vit) {
+    vector<double> & r = stats.vtx_r[vit->first];
+    if(r.empty()) r.assign(kNVtxBins, 0.);
+    for(int ib = 0; ib < kNVtxBins; ib++) r[ib] += vit->second[ib];
+  }
+  const map<int, Long64_t> * firsts [3] =
+    { &part.vtx_first,  &part.first_fs,  &part.first_dec  };
+  map<int, Long64_t> *       merged [3] =
+    { &stats.vtx_first, &stats.first_fs, &stats.first_dec };
+  for(int k = 0; k < 3; k++) {
+    map<int, Long64_t>::const_iterator it = firsts[k]->begin();
+    for( ; it != firsts[k]->end(); ++it) {
+      // ranges are merged in event order: keep the first one seen
+      if(merged[k]->find(it->first) == merged[k]->end()) {
+        (*merged[k])[it->first] = it->second;
+      }
+    }
+  }
+}
+//____________________________________________________________________________
+void ReportCheck(ScanCheck_t check, const ScanStats_t & stats)
+{
+  if(gErrLog.is_open()) {
+    gErrLog << kChkErrLogTitle[check] << endl;
+    gErrLog << "# " << endl;
+    const vector<Long64_t> & failed = stats.failed[check];
+    for(unsigned int j = 0; j < failed.size(); j++) {
+      gErrLog << failed[j] << endl;
+    }
+    if(stats.nerr[check] == 0) {
+      gErrLog << "none" << endl;
+    }
+    else
+    if(stats.nerr[check] > (Long64_t) failed.size()) {
+      gErrLog << "# ... and " << stats.nerr[check] - failed.size()
+              << " more" << endl;
+    }
+    if(gOptAddEventPrintoutInErrLog) {
+      const vector<string> & printout = stats.printout[check];
+      for(unsigned int j = 0; j < printout.size(); j++) {
+        gErrLog << printout[j];
+      }
+    }
+  }
+
+  LOG("gevscan", pNOTICE)
+     << "Found " << stats.nerr[check] << kChkSummary[check];
+}
+//____________________________________________________________________________
+bool CheckEnergyMomentumConservation (const EventRecord & event)
+{
     double E_init  = 0, E_fin  = 0; // E
     double px_init = 0, px_fin = 0; // px
     double py_init = 0, py_fin = 0; // py
@@ -229,15 +446,15 @@ void CheckEnergyMomentumConservation (void)
 
       GHepStatus_t ist  = p->Status();
 
-      if(ist == kIStInitialState) 
+      if(ist == kIStInitialState)
       {
          E_init  += p->E();
          px_init += p->Px();
          py_init += p->Py();
          pz_init += p->Pz();
        }
-       if(ist == kIStStableFinalState || 
-          ist == kIStFinalStateNuclearRemnant) 
+       if(ist == kIStStableFinalState ||
+          ist == kIStFinalStateNuclearRemnant)
        {
          E_fin   += p->E();
          px_fin  += p->Px();
@@ -246,69 +463,23 @@ void CheckEnergyMomentumConservation (void)
        }
     }//p
 
-    double epsilon = 1E-3; 
+    double epsilon = 1E-3;
 
     bool E_conserved  = TMath::Abs(E_init  - E_fin)  < epsilon;
     bool px_conserved = TMath::Abs(px_init - px_fin) < epsilon;
     bool py_conserved = TMath::Abs(py_init - py_fin) < epsilon;
     bool pz_conserved = TMath::Abs(pz_init - pz_fin) < epsilon;
 
-    bool ok = E_conserved  && 
+    bool ok = E_conserved  &&
               px_conserved &&
               py_conserved &&
               pz_conserved;
 
-    if(!ok) {
-       LOG("gevscan", pERROR) 
-         << " ** Energy-momentum non-conservation in event: " << i 
-         << "\n"
-         << event;
-       if(gErrLog.is_open()) {
-           gErrLog << i;
-           if(gOptAddEventPrintoutInErrLog) {
-               gErrLog << event;
-           }
-       }
-       nerr++;
-    }
-    
-    gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
-
-  }//i
-
-  if(gErrLog.is_open()) {
-     if(nerr == 0) {
-         gErrLog << "none" << endl;    
-     }
-  }
-
-  LOG("gevscan", pNOTICE) 
-     << "Found " << nerr 
-     << " events failing the energy/momentum conservation test";
+    return ok;
 }
 //____________________________________________________________________________
-void CheckChargeConservation(void)
+bool CheckChargeConservation(const EventRecord & event)
 {
-  LOG("gevscan", pNOTICE) << "Checking charge conservation...";
-
-  if(gErrLog.is_open()) {
-     gErrLog << "# Events failing the charge conservation test:" << endl;
-     gErrLog << "# " << endl;
-  }
-
-  int nerr = 0;
-
-  for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
-  {
-    if(gOptMaxNumErrs != -1 && nerr >= gOptMaxNumErrs) break;
-
-    gEventTree->GetEntry(i);
-
-    NtpMCRecHeader rec_header = gMCRec->hdr;
-    EventRecord &  event      = *(gMCRec->event);
-
-    LOG("gevscan", pINFO) << "Checking event.... " << i;
-
     // Can't run the test for neutrinos scattered off nuclear targets
     // because of intranuclear rescattering effects and the presence, in the event
     // record, of a charged nuclear remnant pseudo-particle whose charge is not stored.
@@ -318,300 +489,166 @@ void CheckChargeConservation(void)
     if (nucltgt) {
       LOG("gevscan", pINFO)
            << "Event in nuclear target - Skipping test...";
+      return true;
     }
-    else {
-      double Q_init  = 0;
-      double Q_fin   = 0; 
 
-      GHepParticle * p = 0;
-      TIter event_iter(&event);
-      while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
+    double Q_init  = 0;
+    double Q_fin   = 0;
 
-        GHepStatus_t ist  = p->Status();
+    GHepParticle * p = 0;
+    TIter event_iter(&event);
+    while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
 
-        if(ist == kIStInitialState) 
-        {
-           Q_init  += p->Charge();
-         }
-         if(ist == kIStStableFinalState)
-         {
-           Q_fin  += p->Charge();
-         }
-      }//p
-
-      double epsilon = 1E-3; 
-      bool ok = TMath::Abs(Q_init - Q_fin)  < epsilon;
-      if(!ok) {
-         LOG("gevscan", pERROR) 
-           << " ** Charge non-conservation in event: " << i 
-           << "\n"
-           << event;
-         if(gErrLog.is_open()) {
-            gErrLog << i << endl;    
-            if(gOptAddEventPrintoutInErrLog) {
-                 gErrLog << event;
-            }
-         }
-         nerr++;
-      }
-      
-    }
-    gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
-  }//i
+      GHepStatus_t ist  = p->Status();
 
-  if(gErrLog.is_open()) {
-     if(nerr == 0) {
-        gErrLog << "none" << endl;    
-     }
-  }
+      if(ist == kIStInitialState)
+      {
+         Q_init  += p->Charge();
+       }
+       if(ist == kIStStableFinalState)
+       {
+         Q_fin  += p->Charge();
+       }
+    }//p
 
-  LOG("gevscan", pNOTICE) 
-     << "Found " << nerr 
-     << " events failing the charge conservation test";
+    double epsilon = 1E-3;
+    bool ok = TMath::Abs(Q_init - Q_fin)  < epsilon;
+    return ok;
 }
 //____________________________________________________________________________
-void CheckForPseudoParticlesInFinState(void)
+bool CheckForPseudoParticlesInFinState(const EventRecord & event)
 {
-  LOG("gevscan", pNOTICE) 
-      << "Checking for pseudo-particles appearing in final state...";
-
-  if(gErrLog.is_open()) {
-     gErrLog << "# Events with pseudo-particles in final state:" << endl;
-     gErrLog << "# " << endl;
-  }
-
-  int nerr = 0;
-
-  for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
-  {
-    if(gOptMaxNumErrs != -1 && nerr >= gOptMaxNumErrs) break;
-
-    gEventTree->GetEntry(i);
-
-    NtpMCRecHeader rec_header = gMCRec->hdr;
-    EventRecord &  event      = *(gMCRec->event);
-
-    LOG("gevscan", pINFO) << "Checking event.... " << i;
-
     GHepParticle * p = 0;
     TIter event_iter(&event);
-    bool ok = true;
     while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
 
       GHepStatus_t ist = p->Status();
       if(ist != kIStStableFinalState) continue;
-      int pdgc = p->Pdg();      
-      if(pdg::IsPseudoParticle(pdgc))
-      {
-        ok = false;
-        break;
-      }      
+      int pdgc = p->Pdg();
+      if(pdg::IsPseudoParticle(pdgc)) return false;
     }//p
 
-    if(!ok) {
-       LOG("gevscan", pERROR) 
-         << " ** Pseudo-particle final state particle in event: " << i 
-         << "\n"
-         << event;
-       if(gErrLog.is_open()) {
-          gErrLog << i << endl;    
-          if(gOptAddEventPrintoutInErrLog) {
-               gErrLog << event;
-          }
-       }
-       nerr++;
-    }
-
-    gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
-
-  }//i
-
-  if(gErrLog.is_open()) {
-     if(nerr == 0) {
-        gErrLog << "none" << endl;    
-     }
-  }
-
-  LOG("gevscan", pNOTICE) 
-     << "Found " << nerr 
-     << " events with pseudo-particles in  final state";
+    return true;
 }
 //____________________________________________________________________________
-void CheckForOffMassShellParticlesInFinState(void)
+bool CheckForOffMassShellParticlesInFinState(const EventRecord & event)
 {
-  LOG("gevscan", pNOTICE) 
-      << "Checking for off-mass-shell particles appearing in the final state...";
-
-  if(gErrLog.is_open()) {
-     gErrLog << "# Events with off-mass-shell particles in final state:" << endl;
-     gErrLog << "# " << endl;
-  }
-
-  int nerr = 0;
-
-  for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
-  {
-    if(gOptMaxNumErrs != -1 && nerr >= gOptMaxNumErrs) break;
-
-    gEventTree->GetEntry(i);
-
-    NtpMCRecHeader rec_header = gMCRec->hdr;
-    EventRecord &  event      = *(gMCRec->event);
-
-    LOG("gevscan", pINFO) << "Checking event.... " << i;
-
     GHepParticle * p = 0;
     TIter event_iter(&event);
-    bool ok = true;
     while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
 
       GHepStatus_t ist = p->Status();
       if(ist != kIStStableFinalState) continue;
-      if(p->IsOffMassShell())
-      {
-        ok = false;
-        break;
-      }      
+      if(p->IsOffMassShell()) return false;
     }//p
 
-    if(!ok) {
-       LOG("gevscan", pERROR) 
-         << " ** Off-mass-shell final state particle in event: " << i 
-         << "\n"
-         << event;
-       if(gErrLog.is_open()) {
-          gErrLog << i << endl;    
-          if(gOptAddEventPrintoutInErrLog) {
-               gErrLog << event;
-          }
-       }
-       nerr++;
-    }
-
-    gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
-
-  }//i
-
-  if(gErrLog.is_open()) {
-     if(nerr == 0) {
-        gErrLog << "none" << endl;    
-     }
-  }
-
-  LOG("gevscan", pNOTICE) 
-     << "Found " << nerr 
-     << " events with off-mass-shell particles in final state";
+    return true;
 }
 //____________________________________________________________________________
-void CheckForNumFinStateNucleonsInconsistentWithTarget(void)
+bool CheckForNumFinStateNucleonsInconsistentWithTarget(const EventRecord & event)
 {
-  LOG("gevscan", pNOTICE) 
-     << "Checking for number of final state nucleons inconsistent with target...";
-
-  if(gErrLog.is_open()) {
-    gErrLog << "# Events with number of final state nucleons inconsistent with target:" << endl;
-    gErrLog << "# " << endl;
-  }
+    // get target nucleus
+    GHepParticle * nucltgt = event.TargetNucleus();
+    if (!nucltgt) {
+      LOG("gevscan", pINFO)
+           << "Event not in nuclear target - Skipping test...";
+      return true;
+    }
 
-  int nerr = 0;
+    GHepParticle * p = 0;
 
-  for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
-  {
-    if(gOptMaxNumErrs != -1 && nerr >= gOptMaxNumErrs) break;
+    int Z = 0;
+    int N = 0;
 
-    gEventTree->GetEntry(i);
+    // get number of spectator nucleons
+    int fd = nucltgt->FirstDaughter();
+    int ld = nucltgt->LastDaughter();
+    for(int d = fd; d <= ld; d++) {
+      p = event.Particle(d);
+      if(!p) continue;
+      int pdgc = p->Pdg();
+      if(pdg::IsIon(pdgc)) {
+        Z = p->Z();
+        N = p->A() - p->Z();
+      }
+    }
+    // add nucleons from the primary interaction
+    TIter event_iter(&event);
+    while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
+      GHepStatus_t ist = p->Status();
+      if(ist != kIStHadronInTheNucleus) continue;
+      int pdgc = p->Pdg();
+      if(pdg::IsProton (pdgc)) { Z++; }
+      if(pdg::IsNeutron(pdgc)) { N++; }
+    }//p
 
-    NtpMCRecHeader rec_header = gMCRec->hdr;
-    EventRecord &  event      = *(gMCRec->event);
+    LOG("gevscan", pINFO)
+       << "Before intranuclear hadron transport: Z = " << Z << ", N = " << N;
 
-    LOG("gevscan", pINFO) << "Checking event.... " << i;
+    // count final state nucleons
+    int Zf = 0;
+    int Nf = 0;
+    event_iter.Reset();
+    while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
+      GHepStatus_t ist = p->Status();
+      if(ist != kIStStableFinalState) continue;
+      int pdgc = p->Pdg();
+      if(pdg::IsProton (pdgc)) { Zf++; }
+      if(pdg::IsNeutron(pdgc)) { Nf++; }
+    }
+    LOG("gevscan", pINFO)
+       << "In the final state: Z = " << Zf << ", N = " << Nf;
 
+    bool ok = (Zf <= Z && Nf <= N);
+    return ok;
+}
+//____________________________________________________________________________
+void FillVertexDistribution(
+   const EventRecord & event, Long64_t iev, ScanStats_t & stats)
+{
     // get target nucleus
     GHepParticle * nucltgt = event.TargetNucleus();
     if (!nucltgt) {
       LOG("gevscan", pINFO)
-           << "Event not in nuclear target - Skipping test...";
+           << "Event not in nuclear target - Skipping...";
+      return;
     }
-    else {
-      GHepParticle * p = 0;
-
-      int Z = 0;
-      int N = 0;
-
-      // get number of spectator nucleons 
-      int fd = nucltgt->FirstDaughter();
-      int ld = nucltgt->LastDaughter();
-      for(int d = fd; d <= ld; d++) {
-        p = event.Particle(d);
-        if(!p) continue;
-        int pdgc = p->Pdg();
-        if(pdg::IsIon(pdgc)) {
-          Z = p->Z();
-          N = p->A() - p->Z();
-        }
-      }
-      // add nucleons from the primary interaction
-      TIter event_iter(&event);
-      while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
-        GHepStatus_t ist = p->Status();
-        if(ist != kIStHadronInTheNucleus) continue;
-        int pdgc = p->Pdg();
-        if(pdg::IsProton (pdgc)) { Z++; }
-        if(pdg::IsNeutron(pdgc)) { N++; }
-      }//p
 
-      LOG("gevscan", pINFO)
-         << "Before intranuclear hadron transport: Z = " << Z << ", N = " << N;
-
-      // count final state nucleons
-      int Zf = 0;
-      int Nf = 0;
-      event_iter.Reset();
-      while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
-        GHepStatus_t ist = p->Status();
-        if(ist != kIStStableFinalState) continue;
-        int pdgc = p->Pdg();
-        if(pdg::IsProton (pdgc)) { Zf++; }
-        if(pdg::IsNeutron(pdgc)) { Nf++; }
+    // the test is run on the nuclear target seen first: the distribution
+    // of each target is kept, and the right one is picked once merged
+    int code = 1000 * nucltgt->Z() + nucltgt->A();
+    vector<double> & r_distr = stats.vtx_r[code];
+    if(r_distr.empty()) {
+      r_distr.assign(kNVtxBins, 0.);
+      stats.vtx_first[code] = iev;
+    }
+
+    GHepParticle * probe = event.Particle(0);
+    double r = probe->X4()->Vect().Mag();
+    int ib = (int) (r * kNVtxBins / kVtxRMax);
+    if(ib >= 0 && ib < kNVtxBins) r_distr[ib]++;
+}
+//____________________________________________________________________________
+void FillDecayerLists(
+   const EventRecord & event, Long64_t iev, ScanStats_t & stats)
+{
+    GHepParticle * p = 0;
+    TIter event_iter(&event);
+    while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
+      GHepStatus_t ist = p->Status();
+      int pdgc = p->Pdg();
+      if(ist == kIStStableFinalState && !stats.first_fs.count(pdgc)) {
+        stats.first_fs[pdgc] = iev;
       }
-      LOG("gevscan", pINFO)
-         << "In the final state: Z = " << Zf << ", N = " << Nf;
-
-      bool ok = (Zf <= Z && Nf <= N);
-      if(!ok) {
-         LOG("gevscan", pERROR) 
-           << " ** Number of final state nucleons inconsistent with target in event: " << i 
-           << "\n"
-           << event;
-         if(gErrLog.is_open()) {
-             gErrLog << i << endl;    
-             if(gOptAddEventPrintoutInErrLog) {
-                 gErrLog << event;
-             }
-         }
-         nerr++;
+      if(ist == kIStDecayedState && !stats.first_dec.count(pdgc)) {
+        stats.first_dec[pdgc] = iev;
       }
-    } //nucltgt
-
-    gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
-
-  }//i
-
-
-  if(gErrLog.is_open()) {
-     if(nerr == 0) {
-         gErrLog << "none" << endl;    
-     }
-  }
-
-  LOG("gevscan", pNOTICE) 
-     << "Found " << nerr 
-     << " events with a number of final state nucleons inconsistent with target";
+    }//p
 }
 //____________________________________________________________________________
-void CheckVertexDistribution(void)
+void CheckVertexDistribution(const ScanStats_t & stats)
 {
-  LOG("gevscan", pNOTICE) 
+  LOG("gevscan", pNOTICE)
      << "Checking intra-nuclear vertex distribution...";
 
   if(gErrLog.is_open()) {
@@ -619,50 +656,31 @@ void CheckVertexDistribution(void)
     gErrLog << "# " << endl;
   }
 
-  TH1D * r_distr_mc       = new TH1D("r_distr_mc","",      150,0,30); //fm
-  TH1D * r_distr_expected = new TH1D("r_distr_expected","",150,0,30); //fm
+  TH1D * r_distr_mc       = new TH1D("r_distr_mc","",      kNVtxBins,0,kVtxRMax); //fm
+  TH1D * r_distr_expected = new TH1D("r_distr_expected","",kNVtxBins,0,kVtxRMax); //fm
 
+  // this test is run on a MC sample for a given target: the one of the
+  // first event in a nuclear target
   int Z = -1;
   int A = -1;
-
-  // get vertex position distribution
-  for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
-  {
-    gEventTree->GetEntry(i);
-
-    NtpMCRecHeader rec_header = gMCRec->hdr;
-    EventRecord &  event      = *(gMCRec->event);
-
-    LOG("gevscan", pINFO) << "Checking event.... " << i;
-
-    // get target nucleus
-    GHepParticle * nucltgt = event.TargetNucleus();
-    if (!nucltgt) {
-      LOG("gevscan", pINFO)
-           << "Event not in nuclear target - Skipping...";
+  Long64_t first = -1;
+  map<int, Long64_t>::const_iterator it = stats.vtx_first.begin();
+  for( ; it != stats.vtx_first.end(); ++it) {
+    if(first == -1 || it->second < first) {
+      first = it->second;
+      Z = it->first / 1000;
+      A = it->first % 1000;
     }
-    else {
-      if(Z == -1 && A == -1) {
-         Z = nucltgt->Z();
-         A = nucltgt->A();
-      }
-
-      // this test is run on a MC sample for a given target
-      if(Z != nucltgt->Z() || A != nucltgt->A()) {
-        LOG("gevscan", pINFO)
-             << "Event not in nuclear target seen first - Skipping...";
-      }
-      else {
-        GHepParticle * probe = event.Particle(0);
-        double r = probe->X4()->Vect().Mag();
-
-        r_distr_mc->Fill(r);
-      }
-    } //nucltgt
-
-    gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
-
-  }//i
+  }
+  if(first != -1) {
+    const vector<double> & r = stats.vtx_r.find(1000*Z + A)->second;
+    double nentries = 0;
+    for(int ib = 0; ib < kNVtxBins; ib++) {
+      r_distr_mc->SetBinContent(ib+1, r[ib]);
+      nentries += r[ib];
+    }
+    r_distr_mc->SetEntries(nentries);
+  }
 
   if(A > 1) {
     // get expected vertex position distribution
@@ -673,7 +691,7 @@ void CheckVertexDistribution(void)
       r_distr_expected->SetBinContent(ir,nexp);
     }
 
-    // normalize 
+    // normalize
     double N = r_distr_mc->GetEntries();
     r_distr_expected -> Scale (N / r_distr_expected -> Integral());
 
@@ -683,9 +701,9 @@ void CheckVertexDistribution(void)
 
     if(gErrLog.is_open()) {
        if(pvalue < 0.99) {
-         gErrLog << "Problem! p-value = " << pvalue << endl;    
+         gErrLog << "Problem! p-value = " << pvalue << endl;
        } else {
-         gErrLog << "OK! p-value = " << pvalue << endl;    
+         gErrLog << "OK! p-value = " << pvalue << endl;
        }
     }
 
@@ -700,23 +718,23 @@ void CheckVertexDistribution(void)
   else {
 
     if(gErrLog.is_open()) {
-      gErrLog << "Can not run test with current sample" << endl;   
+      gErrLog << "Can not run test with current sample" << endl;
     }
 
   }
 
 }
 //____________________________________________________________________________
-void CheckDecayerConsistency(void)
+void CheckDecayerConsistency(const ScanStats_t & stats)
 {
-// Check that particles seen in the final state in some events do not appear to 
+// Check that particles seen in the final state in some events do not appear to
 // have decayed in other events.
 // This might happen if, for example, particle decay flags which are applied to
 // GENIE events do not get applied to intermediate particles appearing in the
 // PYTHIA hadronization. It might also happen if the decayed particle status is
 // used incorrectly in some modules (eg intranuke).
 //
-  LOG("gevscan", pNOTICE) 
+  LOG("gevscan", pNOTICE)
      << "Checking decayer consistency...";
 
   if(gErrLog.is_open()) {
@@ -728,35 +746,23 @@ void CheckDecayerConsistency(void)
   PDGCodeList final_state_particles(allowdup);
   PDGCodeList decayed_particles(allowdup);
 
-  for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
-  {
-    gEventTree->GetEntry(i);
-
-    NtpMCRecHeader rec_header = gMCRec->hdr;
-    EventRecord &  event      = *(gMCRec->event);
-
-    LOG("gevscan", pINFO) << "Checking event.... " << i;
-
-    GHepParticle * p = 0;
-    TIter event_iter(&event);
-    while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
-      GHepStatus_t ist = p->Status();
-      int pdgc = p->Pdg();
-      if(ist == kIStStableFinalState) { final_state_particles.push_back(pdgc); }
-      if(ist == kIStDecayedState    ) { decayed_particles.push_back(pdgc);     }
-    }//p
-    gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
-  }//i
+  map<int, Long64_t>::const_iterator it;
+  for(it = stats.first_fs.begin();  it != stats.first_fs.end();  ++it) {
+    final_state_particles.push_back(it->first);
+  }
+  for(it = stats.first_dec.begin(); it != stats.first_dec.end(); ++it) {
+    decayed_particles.push_back(it->first);
+  }
 
   // find particles which appear in both lists
   PDGCodeList particles_in_both_lists(allowdup);
 
   PDGCodeList::const_iterator iter;
-  for(iter = final_state_particles.begin(); 
-      iter != final_state_particles.end(); ++iter) 
+  for(iter = final_state_particles.begin();
+      iter != final_state_particles.end(); ++iter)
   {
      int pdgc = *iter;
-     if(decayed_particles.ExistsInPDGCodeList(pdgc)) 
+     if(decayed_particles.ExistsInPDGCodeList(pdgc))
      {
         particles_in_both_lists.push_back(pdgc);
      }
@@ -770,14 +776,14 @@ void CheckDecayerConsistency(void)
     ok = false;
     mesg << "Problem!\n" << particles_in_both_lists.size() << " particles seen both final state and to have decayed.";
   }
- 
-  LOG("gevscan", pNOTICE) 
+
+  LOG("gevscan", pNOTICE)
     << mesg.str();
-  LOG("gevscan", pNOTICE) 
+  LOG("gevscan", pNOTICE)
     << "Particles seen in final state: " << final_state_particles;
-  LOG("gevscan", pNOTICE) 
+  LOG("gevscan", pNOTICE)
     << "Particles seen to have decayed: " << decayed_particles;
-  LOG("gevscan", pNOTICE) 
+  LOG("gevscan", pNOTICE)
     << "Particles seen in both lists: " << particles_in_both_lists;
 
   if(gErrLog.is_open()) {
@@ -787,49 +793,35 @@ void CheckDecayerConsistency(void)
      gErrLog << "\nParticles seen in both lists:" << particles_in_both_lists << endl;
    }
 
-   // find example events
+   // example events: the first ones seen (while scanning) with each
+   // particle decayed and in the final state
    if(!ok) {
       if(gErrLog.is_open()) {
-         gErrLog << "\nExample events: " << endl;          
+         gErrLog << "\nExample events: " << endl;
       }
-      for(iter  = particles_in_both_lists.begin(); 
-          iter != particles_in_both_lists.end(); ++iter) 
+      int nprintouts = 0;
+      for(iter  = particles_in_both_lists.begin();
+          iter != particles_in_both_lists.end(); ++iter)
       {
          int pdgc_bothlists = *iter;
-         int iev_decay = -1;
-         int iev_fs    = -1;
-         bool have_example = false;
-         for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
-         {
-           have_example = (iev_decay != -1 && iev_fs != -1);
-           if(have_example) break;
-
-           gEventTree->GetEntry(i);
-           EventRecord &  event = *(gMCRec->event);
-           GHepParticle * p = 0;
-           TIter event_iter(&event);
-           while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
-              int pdgc = p->Pdg();
-              if(pdgc != pdgc_bothlists) continue;
-              GHepStatus_t ist = p->Status();
-              if(ist == kIStStableFinalState && iev_fs    == -1) { iev_fs    = i; }
-              if(ist == kIStDecayedState     && iev_decay == -1) { iev_decay = i; }
-           }//p
-           gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
-         }//i
+         Long64_t iev_decay = stats.first_dec.find(pdgc_bothlists)->second;
+         Long64_t iev_fs    = stats.first_fs .find(pdgc_bothlists)->second;
          if(gErrLog.is_open()) {
             gErrLog << ">> " << PDGLibrary::Instance()->Find(pdgc_bothlists)->GetName()
-                    << ": Decayed in event " << iev_decay 
+                    << ": Decayed in event " << iev_decay
                     << ". Seen in final state in event " << iev_fs << "." << endl;
-            if(gOptAddEventPrintoutInErrLog) {
-               gEventTree->GetEntry(iev_decay);
-               EventRecord & event_dec = *(gMCRec->event);
-               gErrLog << "Event " << iev_decay << ":";
-               gErrLog << event_dec;
-               gEventTree->GetEntry(iev_fs);
-               EventRecord & event_fs = *(gMCRec->event);
-               gErrLog << "Event: " << iev_fs << ":";
-               gErrLog << event_fs;
+            if(gOptAddEventPrintoutInErrLog && nprintouts < gOptMaxNumPrintouts) {
+               const EventRecord * event_dec = gReader->Event(iev_decay);
+               if(event_dec) {
+                 gErrLog << "Event " << iev_decay << ":";
+                 gErrLog << *event_dec;
+               }
+               const EventRecord * event_fs = gReader->Event(iev_fs);
+               if(event_fs) {
+                 gErrLog << "Event: " << iev_fs << ":";
+                 gErrLog << *event_fs;
+               }
+               nprintouts++;
             }
          }
       }//pdgc
@@ -896,19 +888,23 @@ void GetCommandLineArgs(int argc, char ** argv)
      gOptMaxNumErrs = parser.ArgAsInt("max-num-of-errors-shown");
      gOptMaxNumErrs = TMath::Max(1,gOptMaxNumErrs);
   }
+  if(parser.OptionExists("max-num-of-printouts")) {
+     gOptMaxNumPrintouts = TMath::Max(0, parser.ArgAsInt("max-num-of-printouts"));
+  }
+  gOptNThreads = RunOpt::Instance()->NThreads();
   
   bool all = parser.OptionExists("all");
 
   // checks
-  gOptCheckEnergyMomentumConservation = all ||
+  gOptCheck[kChkEnergyMomentum] = all ||
      parser.OptionExists("check-energy-momentum-conservation");
-  gOptCheckChargeConservation = all || 
+  gOptCheck[kChkCharge] = all || 
      parser.OptionExists("check-charge-conservation");
-  gOptCheckForNumFinStateNucleonsInconsistentWithTarget = all ||
+  gOptCheck[kChkNumFinStateNucleons] = all ||
      parser.OptionExists("check-for-num-of-final-state-nucleons-inconsistent-with-target");
-  gOptCheckForPseudoParticlesInFinState = all ||
+  gOptCheck[kChkPseudoParticles] = all ||
      parser.OptionExists("check-for-pseudoparticles-in-final-state");
-  gOptCheckForOffMassShellParticlesInFinState = all ||
+  gOptCheck[kChkOffMassShell] = all ||
      parser.OptionExists("check-for-off-mass-shell-particles-in-final-state");
   gOptCheckVertexDistribution = all ||
      parser.OptionExists("check-vertex-distribution");
@@ -920,7 +916,8 @@ void PrintSyntax(void)
 {
   LOG("gevscan", pNOTICE)
     << "\n\n" << "Syntax:" << "\n"
-    << " gevscan -f sample.root [-n n1[,n2]] [-o errlog] [check names]\n";
+    << " gevscan -f sample.root [-n n1[,n2]] [-o errlog]"
+    << " [--max-num-of-printouts n] [--threads n] [check names]\n";
 }
 //_________________________________________________________________________________
 bool CheckRootFilename(string filename)
@@ -37,6 +37,11 @@
                        [-S nrays]
                        [-z zmin]
                        [-d debug flags]
+                       [--swim-cache dx,dtheta]
+                       [--driver-state file] [--resume]
+                       [--shard ishard/nshards]
+                       [--coordinate port --blocks n]
+                       [--coordinated-by host:port]
                        [--seed random_number_seed]
                         --cross-sections xml_file
                        [--event-generator-list list_name]
@@ -46,6 +51,8 @@
                        [--event-record-print-level level]
                        [--mc-job-status-refresh-rate  rate]
                        [--cache-file root_file]
+                       [--workers n]
+                       [--force-interactions]
 
          *** Options :
 
@@ -204,6 +211,68 @@
               The default output filename is:
               gntp.[run_number].ghep.root
               This cmd line arguments lets you override 'gntp'
+           --swim-cache
+              Swim cache cell sizes: flux window cell (m) and direction cell
+              (rad) within which rays are assumed to cross the same sequence
+              of volumes, whose boundaries only are then computed.
+              Only use with ROOTGeomAnalyzer & { GNuMIFlux, GSimpleNtpFlux, GDk2NuFlux }
+              Small volumes missed by the cached ray of a cell are missed by
+              all rays of the cell, so keep the cells small compared to the
+              smallest detector features. [default: no cache]
+           --driver-state
+              A file with the state of the MC job driver (max path lengths &
+              probability scales). If the file exists and was saved by a job
+              with the same configuration and input geometry & flux files,
+              the driver initialisation skips computing them. Otherwise they
+              are computed and saved in it. A job that receives a TERM signal
+              (eg. when pre-empted) saves its state, incl. the flux entry it
+              was reading, in the same file.
+           --resume
+              Used with --driver-state: resume from the flux entry saved with
+              the driver state by a job that was interrupted. Use the same
+              seed as the interrupted job. The exposure of the resumed job
+              includes the one of the interrupted job: use the output files
+              of both jobs together.
+           --shard
+              Deterministic sharded production: the job is shard `ishard'
+              (0, 1, ..., nshards-1) of a production split into nshards
+              jobs, eg. '--shard 17/10000'. The shards use disjoint parts
+              of the input flux: consecutive blocks of the (sorted) flux
+              files if there are at least nshards of them, consecutive
+              blocks of the entries of the chained files otherwise, each
+              read from its first entry on (see
+              GFluxFileConfigI::SetShard()). Each shard generates its share
+              of the requested events (-n) or POT (-e), with a seed derived
+              from the job seed and the shard number (see
+              utils::app_init::ShardSeed()), and `_s<ishard>' is appended to
+              the output file prefix and to the driver state file name (eg
+              gntp_s17.1000.ghep.root). Each output file holds the exposure
+              of its sample in a `gexposure' TFolder (shard, seed, POT,
+              flux neutrinos, events), so that the POT of the merged
+              sample is the sum over the shards. Use the same options (and
+              a max path lengths file, -m, so that all shards normalise
+              their samples alike) for all the shards of a production.
+           --coordinate, --blocks
+              Coordinated production: rather than generating events, serve
+              the workers (see --coordinated-by) of a production split into
+              n blocks (the shards of --shard i/n) at the given TCP port,
+              and stop them once the requested events (-n) or POT (-e) are
+              generated. The blocks are handed out on demand, each with its
+              share of what is left of the request, so that faster nodes
+              generate more blocks and the request is not over-generated.
+              The blocks of workers which fail or go silent (eg. pre-empted
+              nodes) are handed out again. The exposure of each block and
+              of the production is written in [prefix].blocks.txt (see
+              genie::JobCoordinator).
+           --coordinated-by
+              Coordinated production worker: once initialised, generate the
+              blocks handed out by the coordinator at host:port, one after
+              the other, until it stops the production. Block i is generated
+              as shard i (output file gntp_s<i>.[run].ghep.root, flux block
+              i read once, see GFluxFileConfigI::SelectShard()), so all the
+              workers must share a file system and run with the same options
+              (but --coordinated-by). With --workers n, every worker process
+              asks the coordinator for blocks of its own.
            --seed
               Random number seed.
            --cross-sections
@@ -228,6 +297,25 @@
            --cache-file
               Allows users to specify a cache file so that the cache can be
               re-used in subsequent MC jobs.
+           --workers
+              Number of worker processes to fork once the job is initialised
+              (splines loaded, geometry analysed, prob scales computed). The
+              workers share the memory of the initialised job and each one
+              generates its share of the requested events (-n) or POT (-e),
+              with its own seed (derived from the job seed and the worker
+              number, see utils::app_init::WorkerSeed()) and its own output
+              and status files, with `_w<worker>' appended to the output
+              file prefix (eg gntp_w0.1000.ghep.root, gntp_w1.1000.ghep.root).
+              Note that all workers start reading the flux ntuples from the
+              same entry. [default: 1, no workers]
+           --force-interactions
+              Every flux neutrino crossing the geometry interacts, with a
+              vertex chosen along its path in proportion to the path length x
+              cross section of each material, and each event is weighted by
+              the interaction probability of its neutrino. The POT of the
+              sample is then the POT of the flux neutrinos read-in (there is
+              no interaction probability scale) and the event weights must be
+              used. The mode is recorded in the output tree header.
 
          *** Examples:
 
@@ -307,6 +395,7 @@
 #include "Framework/Utils/StringUtils.h"
 #include "Framework/Utils/UnitUtils.h"
 #include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/JobCoordinator.h"
 #include "Framework/Utils/RunOpt.h"
 #include "Framework/Utils/CmdLnArgParser.h"
 #include "Framework/Utils/PrintUtils.h"
@@ -389,6 +478,14 @@ int             gOptNScan = 0;                 // # of geometry scan rays
 double          gOptZmin = -2.0e30;            // starting z position [ if abs() < 1e30 ]
 string          gOptEvFilePrefix;              // event file prefix
 int             gOptDebug = 0;                 // debug flags
+double          gOptSwimCacheDx = 0;           // swim cache flux window cell (m) [0: no cache]
+double          gOptSwimCacheDth = 0;          // swim cache direction cell (rad)
+string          gOptDriverState = "";          // MC job driver state file
+bool            gOptResume = false;            // resume from the flux entry of the driver state?
+int             gOptShard = -1;                // shard of a sharded production (-1: not sharded)...
+int             gOptNShards = 1;               // ...out of so many shards
+int             gOptCoordinatePort = 0;        // coordinator port (0: not the coordinator)
+string          gOptCoordinator = "";          // coordinator host:port (of a coordinated worker)
 long int        gOptRanSeed;                   // random number seed
 string          gOptInpXSecFile;               // cross-section splines
 
@@ -406,6 +503,14 @@ int main(int argc, char ** argv)
   LoadExtraOptions();
   GetCommandLineArgs(argc,argv);
 
+  // the coordinator of a production only hands out its blocks
+  if ( gOptCoordinatePort > 0 ) {
+    JobCoordinator coordinator(gOptNShards, gOptNev, gOptPOT, "POT");
+    bool done = coordinator.Run(gOptCoordinatePort,
+                                gOptEvFilePrefix + ".blocks.txt");
+    return (done) ? 0 : 1;
+  }
+
   if ( ! RunOpt::Instance()->Tune() ) {
     LOG("gmkspl", pFATAL) << " No TuneId in RunOption";
     exit(-1);
@@ -416,6 +521,7 @@ int main(int argc, char ** argv)
   // messenger thresholds, cache file
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
   utils::app_init::CacheFile(RunOpt::Instance()->CacheFile());
+  utils::app_init::MaxXSecTable(RunOpt::Instance()->MaxXSecTableFile());
   utils::app_init::RandGen(gOptRanSeed);
   utils::app_init::XSecTable(gOptInpXSecFile, false);
 
@@ -522,6 +628,9 @@ int main(int argc, char ** argv)
     //
     // *** Using the detailed ntuple neutrino flux description
     //
+    if ( gOptShard >= 0 ) {
+      flux_file_config->SetShard(gOptShard, gOptNShards);
+    }
     flux_file_config->LoadBeamSimData(gOptFluxFile, gOptDetectorLocation);
     flux_file_config->SetUpstreamZ(gOptZmin);  // was "zmin" from bounding_box
     flux_file_config->SetNumOfCycles(0);
@@ -613,10 +722,27 @@ int main(int argc, char ** argv)
   if ( ( gOptExtMaxPlXml != "" ) && ! gOptWriteMaxPlXml ) {
     mcj_driver->UseMaxPathLengths(gOptExtMaxPlXml);
   }
+  // reuse the driver state saved by an identically configured job, if any
+  string state_inputs = gOptRootGeom + "," + gOptFluxFile;
+  if ( gOptShard >= 0 ) {
+    std::ostringstream shard;
+    shard << ",shard:" << gOptShard << "/" << gOptNShards;
+    state_inputs += shard.str();
+  }
+  if ( gOptDriverState != "" ) {
+    mcj_driver->LoadState(gOptDriverState, state_inputs, gOptResume);
+  }
   mcj_driver->Configure();
   mcj_driver->UseSplines();
   mcj_driver->ForceSingleProbScale();
 
+  // enable the swim cache once the max path lengths are known
+  if ( gOptUsingRootGeom && gOptSwimCacheDx > 0 ) {
+    geometry::ROOTGeomAnalyzer * rgeom =
+      dynamic_cast<geometry::ROOTGeomAnalyzer *>(geom_driver);
+    if ( rgeom ) rgeom->SetSwimCacheCells(gOptSwimCacheDx, gOptSwimCacheDth);
+  }
+
   if ( ( gOptExtMaxPlXml != "" ) && gOptWriteMaxPlXml ) {
     geometry::ROOTGeomAnalyzer * rgeom =
       dynamic_cast<geometry::ROOTGeomAnalyzer *>(geom_driver);
@@ -648,13 +774,60 @@ int main(int argc, char ** argv)
     }
   }
 
+  if ( gOptDriverState != "" && ! mcj_driver->StateLoaded() ) {
+    mcj_driver->SaveState(gOptDriverState, state_inputs);
+  }
+
+  // *************************************************************************
+  // * Fork the worker processes, if requested
+  // *************************************************************************
+
+  // The workers share the configured driver (splines, geometry & max path
+  // lengths, prob scales) and each generates its share of the events (or
+  // POT) of the shard
+  int nworkers = RunOpt::Instance()->NWorkers();
+  int iworker  = utils::app_init::ForkWorkers(nworkers);
+
+  // A coordinated worker generates the blocks handed out by the coordinator,
+  // each one as a shard of its own, up to its quota of events or POT
+  long int block_nev = 0;
+  double   block_pot = 0;
+  if ( gOptCoordinator != "" ) {
+    if ( fluxFileConfigI && ! fluxFileConfigI->SelectShard(0, 1) ) {
+      LOG("gevgen_fnal", pFATAL)
+        << "The \"" << gOptFluxDriver << "\" flux driver can not read "
+        << "blocks of the input flux handed out by a coordinator";
+      exit(1);
+    }
+    gOptShard = utils::app_init::CoordinatedBlock(
+                     gOptCoordinator, gOptNShards, block_nev, block_pot);
+    if ( fluxFileConfigI ) {
+      fluxFileConfigI->SelectShard(gOptShard, gOptNShards);
+    }
+    gOptRanSeed = RandomGen::Instance()->GetSeed();
+    iworker  = -1;  // name the outputs after the block only
+    nworkers = 1;
+    gOptNev  = (block_nev > 0) ? block_nev : -1;
+    gOptPOT  = (block_pot > 0) ? block_pot : -1;
+  }
+
+  int    nev  = (gOptNev > 0) ?
+     utils::app_init::WorkerShare(
+       utils::app_init::WorkerShare((long int) gOptNev, gOptShard, gOptNShards),
+       iworker, nworkers) : gOptNev;
+  double npot = (gOptPOT > 0) ?
+     utils::app_init::WorkerShare(
+       utils::app_init::WorkerShare(gOptPOT, gOptShard, gOptNShards),
+       iworker, nworkers) : gOptPOT;
+
   // *************************************************************************
   // * Prepare for writing the output event tree & status file
   // *************************************************************************
 
   // Initialize an Ntuple Writer to save GHEP records into a TTree
   NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
-  ntpw.CustomizeFilenamePrefix(gOptEvFilePrefix);
+  ntpw.CustomizeFilenamePrefix(utils::app_init::WorkerFilename(
+     utils::app_init::ShardFilename(gOptEvFilePrefix, gOptShard), iworker));
   ntpw.Initialize();
 
 
@@ -703,6 +876,8 @@ int main(int argc, char ** argv)
   // Create a MC job monitor for a periodically updated status file
   GMCJMonitor mcjmonitor(gOptRunNu);
   mcjmonitor.SetRefreshRate(RunOpt::Instance()->MCJobStatusRefreshRate());
+  mcjmonitor.CustomizeFilename(utils::app_init::WorkerFilename(
+     utils::app_init::ShardFilename(mcjmonitor.Filename(), gOptShard), iworker));
 
   // *************************************************************************
   // * Event generation loop
@@ -719,15 +894,14 @@ int main(int argc, char ** argv)
 
      // In case the required statistics was expressed as 'number of events'
      // then quit if that number has been generated
-     if ( ievent == gOptNev ) break;
+     if ( ievent == nev ) break;
 
      // In case the required statistics was expressed as 'number of POT'
      // then exit the event loop if the requested POT has been generated.
-     if ( gOptPOT > 0 && fluxExposureI ) {
+     if ( npot > 0 && fluxExposureI ) {
         double fpot = fluxExposureI->GetTotalExposure(); // current POTs used
         double psc  = mcj_driver->GlobProbScale();  // interaction prob. scale
-        double pot  = fpot / psc;                   // POTs for generated sample
-        if ( pot >= gOptPOT ) break;
+        if ( fpot / psc >= npot ) break;            // POTs for generated sample
      }
 
      // Generate a single event using neutrinos coming from the specified flux
@@ -783,6 +957,9 @@ int main(int argc, char ** argv)
   // * Print job statistics &
   // * calculate normalization factor for the generated sample
   // *************************************************************************
+  double      exposure  = 0;
+  std::string exp_units = "";
+  long int    nflux     = mcj_driver->NFluxNeutrinos();
   if ( ! gOptUsingHistFlux && gOptUsingRootGeom ) {
     // POT normalization will only be calculated if event generation was based
     // on beam simulation ntuples (not just histograms) & a detailed detector
@@ -822,12 +999,27 @@ int main(int argc, char ** argv)
 
     ntpw.EventTree()->SetWeight(pot); // store POT
 
+    exposure  = pot;
+    exp_units = exposureUnits;
+    nflux     = nflx;
   }
 
+  // save the exposure of the generated sample, to be summed over the
+  // shards (and workers) of a production
+  utils::app_init::SaveExposure(ntpw.EventTree(), gOptShard, gOptNShards,
+     RandomGen::Instance()->GetSeed(), exposure, exp_units, nflux, ievent);
+
   // *************************************************************************
   // * Save & clean-up
   // *************************************************************************
 
+  // Checkpoint the driver state if the job was interrupted, so that it can
+  // be resumed (see --resume)
+  if ( gSigTERM && gOptDriverState != "" && iworker < 0 &&
+       gOptCoordinator == "" ) {
+    mcj_driver->SaveState(gOptDriverState, state_inputs);
+  }
+
   // Save the generated event tree & close the output file
   ntpw.Save();
 
@@ -1047,6 +1239,25 @@ void GetCommandLineArgs(int argc, char ** argv)
          gOptDebug = 0;
        } //-d
 
+       // swim cache cells
+       if ( parser.OptionExists("swim-cache") ) {
+         LOG("gevgen_fnal", pDEBUG) << "Reading swim cache cell sizes";
+         vector<string> cells =
+            utils::str::Split(parser.ArgAsString("swim-cache"),",");
+         if ( cells.size() != 2 ) {
+           LOG("gevgen_fnal", pFATAL)
+             << "The swim cache needs two cell sizes: dx,dtheta";
+           PrintSyntax();
+           exit(1);
+         }
+         gOptSwimCacheDx  = atof(cells[0].c_str());
+         gOptSwimCacheDth = atof(cells[1].c_str());
+       } else {
+         LOG("gevgen_fnal", pDEBUG) << "Unspecified swim cache - Not using one";
+         gOptSwimCacheDx  = 0;
+         gOptSwimCacheDth = 0;
+       } //--swim-cache
+
      } // root geom && gnumi flux
 
   } // using root geom?
@@ -1134,6 +1345,16 @@ void GetCommandLineArgs(int argc, char ** argv)
   } //-o
 
 
+  // MC job driver state file
+  if( parser.OptionExists("driver-state") ) {
+    LOG("gevgen_fnal", pINFO) << "Reading the MC job driver state file";
+    gOptDriverState = parser.ArgAsString("driver-state");
+    gOptResume      = parser.OptionExists("resume");
+  } else {
+    gOptDriverState = "";
+    gOptResume      = false;
+  }
+
   // random number seed
   if( parser.OptionExists("seed") ) {
     LOG("gevgen_fnal", pINFO) << "Reading random number seed";
@@ -1143,6 +1364,52 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptRanSeed = -1;
   }
 
+  // shard of a sharded production: a part of the flux & a seed of its own
+  if( parser.OptionExists("shard") ) {
+    LOG("gevgen_fnal", pINFO) << "Reading the production shard";
+    bool valid = utils::app_init::ShardOption(
+       parser.ArgAsString("shard"), gOptShard, gOptNShards);
+    if(!valid) {
+      LOG("gevgen_fnal", pFATAL)
+        << "The --shard option expects ishard/nshards "
+        << "with 0 <= ishard < nshards";
+      PrintSyntax();
+      exit(1);
+    }
+    gOptRanSeed = utils::app_init::ShardSeed(gOptRanSeed, gOptShard);
+    if( gOptDriverState != "" ) {
+      gOptDriverState =
+         utils::app_init::ShardFilename(gOptDriverState, gOptShard);
+    }
+  }
+
+  // coordinated production: the coordinator, or one of its workers
+  if( parser.OptionExists("coordinate") ) {
+    LOG("gevgen_fnal", pINFO) << "Reading the coordinator port";
+    gOptCoordinatePort = parser.ArgAsInt("coordinate");
+    gOptNShards = ( parser.OptionExists("blocks") ) ?
+                    parser.ArgAsInt("blocks") : 0;
+    if( gOptCoordinatePort <= 0 || gOptNShards <= 0 ) {
+      LOG("gevgen_fnal", pFATAL)
+        << "The --coordinate option expects a port number and the "
+        << "number of blocks of the production (--blocks n)";
+      PrintSyntax();
+      exit(1);
+    }
+  }
+  if( parser.OptionExists("coordinated-by") ) {
+    LOG("gevgen_fnal", pINFO) << "Reading the coordinator address";
+    gOptCoordinator = parser.ArgAsString("coordinated-by");
+  }
+  if( (gOptCoordinatePort > 0 || gOptCoordinator != "") &&
+      (gOptShard >= 0 || gOptResume) ) {
+    LOG("gevgen_fnal", pFATAL)
+      << "A coordinated production can not be combined with "
+      << "--shard or --resume";
+    PrintSyntax();
+    exit(1);
+  }
+
   // input cross-section file
   if( parser.OptionExists("cross-sections") ) {
     LOG("gevgen_fnal", pINFO) << "Reading cross-section file";
@@ -1263,6 +1530,7 @@ void GetCommandLineArgs(int argc, char ** argv)
   LOG("gevgen_fnal", pNOTICE)
      << "\n - Run number: " << gOptRunNu
      << "\n - Random number seed: " << gOptRanSeed
+     << "\n - Production shard: " << gOptShard << " of " << gOptNShards
      << "\n - Using cross-section file: " << gOptInpXSecFile
      << "\n - Flux     @ " << fluxinfo.str()
      << "\n - Geometry @ " << gminfo.str()
@@ -1282,7 +1550,11 @@ void PrintSyntax(void)
    << "\n            [-n n_of_events] [-e exposure_in_POTs]"
    << "\n            [-o output_event_file_prefix]"
    << "\n            [-F fid_cut_string] [-S nrays_scan]"
-   << "\n            [-z zmin_start]"
+   << "\n            [-z zmin_start] [--swim-cache dx,dtheta]"
+   << "\n            [--driver-state file] [--resume]"
+   << "\n            [--shard ishard/nshards]"
+   << "\n            [--coordinate port --blocks n]"
+   << "\n            [--coordinated-by host:port]"
    << "\n            [--seed random_number_seed]"
    << "\n             --cross-sections xml_file"
    << "\n            [--event-generator-list list_name]"
@@ -1291,6 +1563,8 @@ void PrintSyntax(void)
    << "\n            [--event-record-print-level level]"
    << "\n            [--mc-job-status-refresh-rate  rate]"
    << "\n            [--cache-file root_file]"
+   << "\n            [--workers n]"
+   << "\n            [--force-interactions]"
    << "\n"
    << " Please also read the detailed documentation at "
    << "$GENIE/src/Apps/gFNALExptEvGen.cxx"
@@ -1458,6 +1732,8 @@ void CreateFidSelection (string fidcut, GeomAnalyzerI* geom_driver)
     LOG("gevgen_fnal", pNOTICE) << "Reverse sense of fiducial volume cut";
   }
   rgeom->AdoptGeomVolSelector(fidsel);
+  // place the vertices in the (trimmed) swum path segments
+  rgeom->SetVtxFromSegments(true);
 
 }
 //____________________________________________________________________________
@@ -1556,6 +1832,8 @@ void CreateRockBoxSelection (string fidcut, GeomAnalyzerI* geom_driver)
   else              rocksel->MakeBox(xyzmin,xyzmax);
 
   rgeom->AdoptGeomVolSelector(rocksel);
+  // place the vertices in the (trimmed) swum path segments
+  rgeom->SetVtxFromSegments(true);
 
 }
 
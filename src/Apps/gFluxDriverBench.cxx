@@ -0,0 +1,515 @@
+//____________________________________________________________________________
+/*!
+
+\program gfluxbench
+
+\brief   Throughput benchmark for the flux drivers (GFluxI implementations)
+         registered with the GFluxDriverFactory.
+
+         Instantiates the requested flux driver through the factory,
+         configures it from a generic flux description (see the -f option)
+         and pulls flux neutrinos from it (GFluxI::GenerateNext()), timing
+         every call.
+
+         Writes a machine-readable (XML) summary of:
+          - the driver set-up (loading) time,
+          - the throughput (neutrinos/s) and the mean, median, 99th
+            percentile and max times per GenerateNext() call,
+          - the bytes (and read calls) read through ROOT files and, where
+            the kernel publishes them (/proc/self/io), the bytes read by
+            the process through read() calls and from the storage layer
+            (which also counts pages faulted in from memory-mapped files),
+          - the wall time spent off the CPU while generating (wall time
+            minus the CPU time of the generating thread: mostly waiting on
+            I/O, page faults or on a prefetch thread) and the number of
+            major page faults,
+          - the summed weight and energy of the generated flux neutrinos,
+            by species.
+         The same driver, input and seed can be benchmarked across releases
+         (or storage back-ends) to spot throughput regressions.
+
+         Syntax :
+           gfluxbench -d flux_driver -f flux_description [-c config]
+                      [-n nnu] [-o output_file] [-w]
+                      [--seed random_number_seed]
+                      [--message-thresholds xml_file]
+           gfluxbench -l
+
+         Options :
+           [] Denotes an optional argument
+           -d
+              Flux driver name, as registered with the GFluxDriverFactory
+              (eg genie::flux::GSimpleNtpFlux)
+           -f
+              Flux description, depending on the flux driver type:
+               - ntuple drivers (GSimpleNtpFlux, GNuMIFlux, GJPARCNuFlux):
+                 the flux file name (or pattern)
+                 eg. '-f /data/flux/gsimple_*.root'
+               - histogram driver (GCylindTH1Flux): a ROOT file and a list
+                 of neutrino codes, each followed by the histogram name
+                 in brackets
+                 eg. '-f /data/flux/hst.root,14[numu],-14[numubar]'
+               - atmospheric drivers (GAtmoFlux): a list of flux files,
+                 each followed by the neutrino code in brackets
+                 eg. '-f /data/flux/numu.dat[14],/data/flux/nue.dat[12]'
+               - mono-energetic driver (GMonoEnergeticFlux): the energy
+                 (in GeV) and a list of neutrino codes
+                 eg. '-f 1.0,14,-14'
+           -c
+              Flux configuration: the detector location (GJPARCNuFlux)
+              or the configuration name (GFluxFileConfigI drivers)
+              [ default: "" ]
+           -n
+              Number of flux neutrinos [ default: 1000000 ]
+           -o
+              Output file name [ default: gfluxbench.xml ]
+           -w
+              Generate weighted flux neutrinos
+           -l
+              List the registered flux drivers and exit
+           --seed
+              Random number seed [ default: 1989 ]
+           --message-thresholds
+              Allows users to customize the message stream thresholds.
+              The thresholds are specified using an XML file.
+              See $GENIE/config/Messenger.xml for the XML schema.
+
+         Example:
+
+           gfluxbench -d genie::flux::GSimpleNtpFlux \
+                      -f /data/flux/gsimple_nd.gsflat -c MINOS-NearDet -n 10000000
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <ctime>
+#include <chrono>
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+
+#include <TMath.h>
+#include <TFile.h>
+#include <TH1D.h>
+#include <TLorentzVector.h>
+#include <TVector3.h>
+#include <TROOT.h>
+
+#include "Framework/Conventions/Units.h"
+#include "Framework/EventGen/GFluxI.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/ParticleData/PDGCodeList.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Tools/Flux/GFluxDriverFactory.h"
+#include "Tools/Flux/GFluxFileConfigI.h"
+#include "Tools/Flux/GJPARCNuFlux.h"
+#include "Tools/Flux/GCylindTH1Flux.h"
+#include "Tools/Flux/GAtmoFlux.h"
+#include "Tools/Flux/GMonoEnergeticFlux.h"
+
+using std::string;
+using std::vector;
+using std::map;
+using std::ifstream;
+using std::ofstream;
+using std::endl;
+
+using namespace genie;
+using namespace genie::flux;
+
+// Benchmark results for a flux neutrino species
+struct SpeciesSum {
+  SpeciesSum() : nnu(0), wsum(0.), esum(0.) { }
+  long   nnu;
+  double wsum;        // summed weight
+  double esum;        // summed energy (GeV)
+};
+
+// Process I/O counters (from /proc/self/io, -1 if not available)
+struct IOCounters {
+  IOCounters() : rchar(-1), read_bytes(-1) { }
+  Long64_t rchar;       // bytes read through read() & similar calls
+  Long64_t read_bytes;  // bytes fetched from the storage layer
+};
+
+// Function prototypes
+void       GetCommandLineArgs (int argc, char ** argv);
+GFluxI *   FluxDriver         (void);
+IOCounters ReadIOCounters     (void);
+double     ThreadCPUTime      (void);
+void       ListFluxDrivers    (void);
+void       PrintSyntax        (void);
+
+// User-specified options:
+string   gOptFluxDriver  = "";                // flux driver name
+string   gOptFlux        = "";                // flux description
+string   gOptFluxConfig  = "";                // detector location / config name
+long     gOptNNu         = 1000000;           // number of flux neutrinos
+bool     gOptWeighted    = false;             // generate weighted flux neutrinos?
+string   gOptOutFile     = "gfluxbench.xml";  // output file
+long int gOptRanSeed     = 1989;              // random number seed
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  utils::app_init::RandGen(gOptRanSeed);
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+
+  std::chrono::steady_clock::time_point tload0 = std::chrono::steady_clock::now();
+  GFluxI * flux = FluxDriver();
+  flux->GenerateWeighted(gOptWeighted);
+  double tload = std::chrono::duration<double>(
+                     std::chrono::steady_clock::now() - tload0).count();
+
+  LOG("gfluxbench", pNOTICE)
+    << "Set up " << gOptFluxDriver << " in " << tload << " s";
+
+  // counters at the start of the generation loop
+  Long64_t   root_bytes0 = TFile::GetFileBytesRead();
+  Int_t      root_calls0 = TFile::GetFileReadCalls();
+  IOCounters io0         = ReadIOCounters();
+  struct rusage ru0;
+  getrusage(RUSAGE_SELF, &ru0);
+  double     cpu0        = ThreadCPUTime();
+
+  vector<float> dtcall;
+  dtcall.reserve(gOptNNu);
+  map<int, SpeciesSum> species;
+  long   nfail = 0;
+  double tgen  = 0.;
+
+  std::chrono::steady_clock::time_point tgen0 = std::chrono::steady_clock::now();
+  for(long inu = 0; inu < gOptNNu; inu++) {
+    if(flux->End()) {
+      LOG("gfluxbench", pNOTICE)
+        << "The flux driver has no more flux neutrinos after " << inu;
+      break;
+    }
+    std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    bool ok = flux->GenerateNext();
+    std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+    double dt = std::chrono::duration<double>(t1 - t0).count();
+    dtcall.push_back(dt);
+    tgen += dt;
+    if(!ok) { nfail++; continue; }
+
+    SpeciesSum & sum = species[flux->PdgCode()];
+    sum.nnu++;
+    sum.wsum += flux->Weight();
+    sum.esum += flux->Momentum().Energy();
+  }
+  double twall = std::chrono::duration<double>(
+                     std::chrono::steady_clock::now() - tgen0).count();
+
+  double     cpu1        = ThreadCPUTime();
+  struct rusage ru1;
+  getrusage(RUSAGE_SELF, &ru1);
+  IOCounters io1         = ReadIOCounters();
+  Long64_t   root_bytes  = TFile::GetFileBytesRead() - root_bytes0;
+  Int_t      root_calls  = TFile::GetFileReadCalls() - root_calls0;
+  long       majflt      = ru1.ru_majflt - ru0.ru_majflt;
+
+  // off-cpu time of the generating thread
+  double tcpu  = (cpu0 >= 0 && cpu1 >= 0) ? cpu1 - cpu0 : -1.;
+  double twait = (tcpu >= 0) ? TMath::Max(twall - tcpu, 0.) : -1.;
+
+  // per-call time distribution
+  long   ncalls = dtcall.size();
+  double tmed = 0., tp99 = 0., tmax = 0.;
+  if(ncalls > 0) {
+    std::sort(dtcall.begin(), dtcall.end());
+    tmed = dtcall[ncalls/2];
+    tp99 = dtcall[TMath::Min((long) (0.99 * ncalls), ncalls-1)];
+    tmax = dtcall[ncalls-1];
+  }
+  double ncall_norm = TMath::Max((double) ncalls, 1.);
+  double nnu_per_s  = (ncalls - nfail) / TMath::Max(twall, 1E-9);
+
+  LOG("gfluxbench", pNOTICE)
+    << ncalls - nfail << " flux neutrinos: " << nnu_per_s << " nu/s, "
+    << 1E6 * tgen / ncall_norm << " us/call, "
+    << root_bytes << " bytes read (ROOT), " << twait << " s off-cpu";
+
+  // write out the results
+  ofstream out(gOptOutFile.c_str(), std::ios::out);
+  if(!out.is_open()) {
+    LOG("gfluxbench", pFATAL) << "Could not open file: " << gOptOutFile;
+    gAbortingInErr = true;
+    exit(1);
+  }
+  out << "<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?>" << endl;
+  out << "<!-- generated by gfluxbench: times in s, energies in GeV, sizes in bytes (-1: not available) -->" << endl;
+  out << "<flux_benchmark driver=\"" << gOptFluxDriver
+      << "\" flux=\"" << gOptFlux
+      << "\" config=\"" << gOptFluxConfig
+      << "\" weighted=\"" << (gOptWeighted ? "true" : "false")
+      << "\" seed=\"" << gOptRanSeed
+      << "\" root_version=\"" << gROOT->GetVersion() << "\">" << endl;
+  out << std::setprecision(6);
+  out << "  <load_time> "            << tload                << " </load_time>" << endl;
+  out << "  <ncalls> "               << ncalls               << " </ncalls>" << endl;
+  out << "  <nfailed> "              << nfail                << " </nfailed>" << endl;
+  out << "  <wall_time> "            << twall                << " </wall_time>" << endl;
+  out << "  <generate_time> "        << tgen                 << " </generate_time>" << endl;
+  out << "  <nu_per_s> "             << nnu_per_s            << " </nu_per_s>" << endl;
+  out << "  <time_per_call> "        << tgen / ncall_norm    << " </time_per_call>" << endl;
+  out << "  <time_per_call_median> " << tmed                 << " </time_per_call_median>" << endl;
+  out << "  <time_per_call_p99> "    << tp99                 << " </time_per_call_p99>" << endl;
+  out << "  <time_per_call_max> "    << tmax                 << " </time_per_call_max>" << endl;
+  out << "  <cpu_time> "             << tcpu                 << " </cpu_time>" << endl;
+  out << "  <io_wait_time> "         << twait                << " </io_wait_time>" << endl;
+  out << "  <major_page_faults> "    << majflt               << " </major_page_faults>" << endl;
+  out << "  <root_bytes_read> "      << root_bytes           << " </root_bytes_read>" << endl;
+  out << "  <root_read_calls> "      << root_calls           << " </root_read_calls>" << endl;
+  out << "  <bytes_read> "
+      << ((io0.rchar >= 0 && io1.rchar >= 0) ? io1.rchar - io0.rchar : -1)
+      << " </bytes_read>" << endl;
+  out << "  <storage_bytes_read> "
+      << ((io0.read_bytes >= 0 && io1.read_bytes >= 0) ? io1.read_bytes - io0.read_bytes : -1)
+      << " </storage_bytes_read>" << endl;
+  out << std::setprecision(12);
+  map<int, SpeciesSum>::const_iterator siter;
+  for(siter = species.begin(); siter != species.end(); ++siter) {
+    const SpeciesSum & sum = siter->second;
+    out << "  <species pdg=\"" << siter->first << "\">"
+        << " <nnu> "        << sum.nnu   << " </nnu>"
+        << " <weight_sum> " << sum.wsum  << " </weight_sum>"
+        << " <energy_sum> " << sum.esum  << " </energy_sum>"
+        << " </species>" << endl;
+  }
+  out << "</flux_benchmark>" << endl;
+  out.close();
+
+  LOG("gfluxbench", pNOTICE) << "Saved the benchmark results in: " << gOptOutFile;
+
+  delete flux;
+
+  return 0;
+}
+//____________________________________________________________________________
+GFluxI * FluxDriver(void)
+{
+// Get the flux driver from the factory and configure it from the flux
+// description, according to the interface it implements
+
+  GFluxI * flux =
+    GFluxDriverFactory::Instance().GetFluxDriver(gOptFluxDriver);
+  if(!flux) {
+    LOG("gfluxbench", pFATAL)
+      << "Failed to get the flux driver \"" << gOptFluxDriver
+      << "\" from the GFluxDriverFactory";
+    ListFluxDrivers();
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  GFluxFileConfigI *   file_flux  = dynamic_cast<GFluxFileConfigI *>   (flux);
+  GJPARCNuFlux *       jparc_flux = dynamic_cast<GJPARCNuFlux *>       (flux);
+  GCylindTH1Flux *     hist_flux  = dynamic_cast<GCylindTH1Flux *>     (flux);
+  GAtmoFlux *          atmo_flux  = dynamic_cast<GAtmoFlux *>          (flux);
+  GMonoEnergeticFlux * mono_flux  = dynamic_cast<GMonoEnergeticFlux *> (flux);
+
+  bool ok = true;
+  if(file_flux) {
+    file_flux->LoadBeamSimData(gOptFlux, gOptFluxConfig);
+    file_flux->SetNumOfCycles(0);
+  }
+  else if(jparc_flux) {
+    ok = jparc_flux->LoadBeamSimData(gOptFlux, gOptFluxConfig);
+    jparc_flux->SetNumOfCycles(0);
+  }
+  else if(hist_flux) {
+    // file.root,pdg1[hist1],pdg2[hist2],...
+    vector<string> fv = utils::str::Split(gOptFlux, ",");
+    TFile flux_file(fv[0].c_str(), "read");
+    ok = fv.size() > 1 && flux_file.IsOpen();
+    for(unsigned int i = 1; ok && i < fv.size(); i++) {
+      string::size_type ib = fv[i].find("[");
+      string::size_type ie = fv[i].find("]");
+      ok = (ib != string::npos && ie != string::npos && ie > ib);
+      if(!ok) break;
+      int    pdg   = atoi(fv[i].substr(0, ib).c_str());
+      string hname = fv[i].substr(ib+1, ie-ib-1);
+      TH1D * hst   = dynamic_cast<TH1D *> (flux_file.Get(hname.c_str()));
+      ok = (hst != 0);
+      if(!ok) break;
+      TH1D * spectrum = (TH1D *) hst->Clone();
+      spectrum->SetDirectory(0);
+      hist_flux->AddEnergySpectrum(pdg, spectrum); // owned by the driver
+    }
+    hist_flux->SetNuDirection      (TVector3(0,0,1));
+    hist_flux->SetBeamSpot         (TVector3(0,0,0));
+    hist_flux->SetTransverseRadius (-1);
+  }
+  else if(atmo_flux) {
+    // file1[pdg1],file2[pdg2],...
+    vector<string> fv = utils::str::Split(gOptFlux, ",");
+    for(unsigned int i = 0; ok && i < fv.size(); i++) {
+      string::size_type ib = fv[i].find("[");
+      string::size_type ie = fv[i].find("]");
+      if(ib == string::npos || ie == string::npos || ie < ib) {
+        atmo_flux->AddFluxFile(fv[i]);
+      } else {
+        int pdg = atoi(fv[i].substr(ib+1, ie-ib-1).c_str());
+        atmo_flux->AddFluxFile(pdg, fv[i].substr(0, ib));
+      }
+    }
+    ok = atmo_flux->LoadFluxData();
+  }
+  else if(mono_flux) {
+    // energy,pdg1,pdg2,...
+    vector<string> fv = utils::str::Split(gOptFlux, ",");
+    ok = (fv.size() > 1);
+    if(ok) {
+      double Ev = atof(fv[0].c_str()) * units::GeV;
+      map<int,double> numap;
+      for(unsigned int i = 1; i < fv.size(); i++) {
+        numap[atoi(fv[i].c_str())] = 1. / (fv.size() - 1);
+      }
+      mono_flux->Initialize(Ev, numap);
+    }
+  }
+  else {
+    LOG("gfluxbench", pFATAL)
+      << "Don't know how to configure the flux driver: " << gOptFluxDriver;
+    ok = false;
+  }
+
+  if(!ok) {
+    LOG("gfluxbench", pFATAL)
+      << "Could not configure " << gOptFluxDriver
+      << " from the flux description: " << gOptFlux;
+    PrintSyntax();
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  return flux;
+}
+//____________________________________________________________________________
+IOCounters ReadIOCounters(void)
+{
+  IOCounters io;
+  ifstream in("/proc/self/io");
+  if(!in.is_open()) return io;
+
+  string   key;
+  Long64_t value;
+  while(in >> key >> value) {
+    if      (key == "rchar:")      io.rchar      = value;
+    else if (key == "read_bytes:") io.read_bytes = value;
+  }
+  return io;
+}
+//____________________________________________________________________________
+double ThreadCPUTime(void)
+{
+// CPU time of the calling thread (s), or -1 if not available
+
+#ifdef CLOCK_THREAD_CPUTIME_ID
+  struct timespec ts;
+  if(clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0) {
+    return ts.tv_sec + 1E-9 * ts.tv_nsec;
+  }
+#endif
+  return -1.;
+}
+//____________________________________________________________________________
+void ListFluxDrivers(void)
+{
+  std::ostringstream s;
+  const vector<string> & known =
+    GFluxDriverFactory::Instance().AvailableFluxDrivers();
+  vector<string>::const_iterator itr = known.begin();
+  for( ; itr != known.end(); ++itr) s << "\n  " << (*itr);
+  LOG("gfluxbench", pNOTICE) << "Known flux drivers:" << s.str();
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gfluxbench", pNOTICE) << "Parsing command line arguments";
+
+  // Common run options. Set defaults and read.
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  // Parse run options for this app
+
+  CmdLnArgParser parser(argc,argv);
+
+  if( parser.OptionExists('l') ) {
+    ListFluxDrivers();
+    exit(0);
+  }
+
+  if( parser.OptionExists('d') ) {
+    gOptFluxDriver = parser.ArgAsString('d');
+  } else {
+    LOG("gfluxbench", pFATAL) << "No flux driver was specified - Exiting";
+    PrintSyntax();
+    exit(1);
+  }
+  if( parser.OptionExists('f') ) {
+    gOptFlux = parser.ArgAsString('f');
+  } else {
+    LOG("gfluxbench", pFATAL) << "No flux description was specified - Exiting";
+    PrintSyntax();
+    exit(1);
+  }
+
+  if( parser.OptionExists('c') ) {
+    gOptFluxConfig = parser.ArgAsString('c');
+  }
+  if( parser.OptionExists('n') ) {
+    gOptNNu = parser.ArgAsLong('n');
+  }
+  if( parser.OptionExists('o') ) {
+    gOptOutFile = parser.ArgAsString('o');
+  }
+  gOptWeighted = parser.OptionExists('w');
+  if( parser.OptionExists("seed") ) {
+    gOptRanSeed = parser.ArgAsLong("seed");
+  }
+
+  LOG("gfluxbench", pNOTICE)
+     << "\n Flux driver : " << gOptFluxDriver
+     << "\n Flux : " << gOptFlux
+     << "\n Flux configuration : " << gOptFluxConfig
+     << "\n Flux neutrinos : " << gOptNNu
+     << "\n Weighted : " << (gOptWeighted ? "yes" : "no")
+     << "\n Random number seed : " << gOptRanSeed
+     << "\n Output file : " << gOptOutFile;
+
+  LOG("gfluxbench", pNOTICE) << *RunOpt::Instance();
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gfluxbench", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gfluxbench -d flux_driver -f flux_description [-c config]"
+    << " [-n nnu] [-o output_file] [-w]"
+    << " [--seed random_number_seed]"
+    << " [--message-thresholds xml_file]\n"
+    << "   gfluxbench -l\n\n";
+}
+//____________________________________________________________________________
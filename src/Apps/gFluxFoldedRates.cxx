@@ -0,0 +1,354 @@
+//____________________________________________________________________________
+/*!
+
+\program gfluxrates
+
+\brief   Computes the event rates of each channel, target and flux energy bin,
+         and the flux-averaged cross sections, by folding neutrino flux
+         spectra with the cross section splines (see GFluxFoldedRates).
+         No event is generated: once the event generation drivers are
+         configured, the rates of a full detector take milliseconds.
+
+         Syntax :
+           gfluxrates -f flux -t targets
+                      --cross-sections xml_file
+                      [-o output_file]
+                      [-e min_energy,max_energy]
+                      [--n-bins number_of_bins]
+                      [--n-sub energies_per_bin]
+                      [--threads n]
+                      [--event-generator-list list_name]
+                      [--tune genie_tune]
+                      [--message-thresholds xml_file]
+                      [--xml-path config_xml_dir]
+
+         Options :
+           -f
+               The flux of each neutrino species, as a semicolon separated
+               list of neutrino PDG code:flux pairs, where each flux is either
+               -- A 1-D ROOT histogram (TH1D) of the flux integrated over each
+                  energy bin: `/full/path/file.root,object_name'
+               -- A vector file with 2 columns, energy (GeV) and flux per GeV,
+                  integrated over the bins of the -e and --n-bins options.
+               eg `-f 14:flux.root,numu;-14:flux.root,numubar'
+           -t
+               The targets, as a comma separated list of target PDG codes
+               with the number of target nuclei in brackets (default: 1, ie
+               rates per nucleus), eg `-t 1000060120[4.5E31],1000010010[9E31]'.
+           --cross-sections
+               Name (incl. full path) of an XML file with pre-computed
+               cross-section values. A binary spline file (see gspl2bin) can
+               be used instead. Channels without a spline are left out.
+           -o
+               Name of the output file: a ROOT file of rate histograms if it
+               ends with `.root', otherwise a text table.
+               Default: gfluxrates.txt
+           -e
+               Energy range (GeV) of the bins of vector file fluxes.
+               Default: 0.1,100.
+           --n-bins
+               Number of (linear) energy bins of vector file fluxes.
+               Default: 100.
+           --n-sub
+               Number of energies at which the cross sections are evaluated
+               within each flux energy bin.
+               Default: 10.
+           --threads
+               Number of threads folding the channels.
+          --event-generator-list
+              List of event generators to load in event generation drivers.
+              [default: "Default"].
+          --tune
+              Specifies a GENIE comprehensive neutrino interaction model tune.
+              [default: "Default"].
+           --message-thresholds
+              Allows users to customize the message stream thresholds.
+              The thresholds are specified using an XML file.
+              See $GENIE/config/Messenger.xml for the XML schema.
+           --xml-path
+              A directory to load XML files from - overrides $GXMLPATH, and $GENIE/config
+
+         The rates are in units of the flux normalization x cm^2 x the
+         number of target nuclei (eg. events / POT for a flux in nu / cm^2 /
+         POT per bin).
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <TFile.h>
+#include <TH1D.h>
+#include <TMath.h>
+#include <TSystem.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/Spline.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Framework/Utils/XSecSplineList.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Tools/Flux/GFluxFoldedRates.h"
+
+using std::map;
+using std::set;
+using std::string;
+using std::vector;
+
+using namespace genie;
+using namespace genie::flux;
+
+// Prototypes:
+void   GetCommandLineArgs (int argc, char ** argv);
+void   PrintSyntax        (void);
+TH1D * FluxSpectrum       (int nupdgc, string spec);
+
+// User-specified options:
+map<int,string> gOptFlux;                   // nu pdg code -> flux
+map<int,double> gOptTargets;                // target pdg code -> nuclei
+string   gOptInpXSecFile    = "";           // input cross-section file
+string   gOptOutFile        = "gfluxrates.txt";
+double   gOptEmin           = 0.1;          // GeV
+double   gOptEmax           = 100.;         // GeV
+int      gOptNBins          = 100;
+int      gOptNSub           = 10;
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  if ( ! RunOpt::Instance()->Tune() ) {
+    LOG("gfluxrates", pFATAL) << " No TuneId in RunOption";
+    exit(-1);
+  }
+  RunOpt::Instance()->BuildTune();
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+
+  // only load the splines needed for the input neutrinos and targets
+  set<int> probes;
+  set<int> targets;
+  map<int,string>::const_iterator fit = gOptFlux.begin();
+  for( ; fit != gOptFlux.end(); ++fit) probes.insert(fit->first);
+  map<int,double>::const_iterator tit = gOptTargets.begin();
+  for( ; tit != gOptTargets.end(); ++tit) targets.insert(tit->first);
+  XSecSplineList::Instance()->SetLoadFilter(probes, targets);
+  utils::app_init::XSecTable(gOptInpXSecFile, true);
+
+  GFluxFoldedRates rates;
+  rates.SetNThreads(RunOpt::Instance()->NThreads());
+  rates.SetNSubBins(gOptNSub);
+  for(fit = gOptFlux.begin(); fit != gOptFlux.end(); ++fit) {
+    TH1D * spectrum = FluxSpectrum(fit->first, fit->second);
+    rates.AddFlux(fit->first, spectrum);
+    delete spectrum;
+  }
+  for(tit = gOptTargets.begin(); tit != gOptTargets.end(); ++tit) {
+    rates.AddTarget(tit->first, tit->second);
+  }
+
+  if(!rates.Compute()) {
+    LOG("gfluxrates", pFATAL) << "No rate could be computed";
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  for(fit = gOptFlux.begin(); fit != gOptFlux.end(); ++fit) {
+    for(tit = gOptTargets.begin(); tit != gOptTargets.end(); ++tit) {
+      LOG("gfluxrates", pNOTICE)
+        << "Rate for nu: " << fit->first << ", target: " << tit->first
+        << " = " << rates.TotalRate(fit->first, tit->first);
+    }
+  }
+  LOG("gfluxrates", pNOTICE) << "Total rate = " << rates.TotalRate();
+
+  bool is_root = gOptOutFile.size() > 5 &&
+     gOptOutFile.substr(gOptOutFile.size()-5) == ".root";
+  bool saved = (is_root) ?
+     rates.SaveAsROOT(gOptOutFile) : rates.SaveAsText(gOptOutFile);
+  if(!saved) {
+    LOG("gfluxrates", pFATAL) << "Couldn't save the rates: " << gOptOutFile;
+    gAbortingInErr = true;
+    exit(1);
+  }
+  return 0;
+}
+//____________________________________________________________________________
+TH1D * FluxSpectrum(int nupdgc, string spec)
+{
+// build the flux spectrum of a neutrino from its -f input
+
+  TH1D * spectrum = 0;
+
+  bool input_is_text_file = ! gSystem->AccessPathName(spec.c_str());
+  bool input_is_root_file = spec.find(".root") != string::npos &&
+                            spec.find(",") != string::npos;
+  if(input_is_text_file) {
+    // flux per GeV, integrated over each bin
+    Spline flux(spec);
+    spectrum = new TH1D("spectrum", "neutrino flux", gOptNBins, gOptEmin, gOptEmax);
+    spectrum->SetDirectory(0);
+    const int nsub = 20;
+    for(int ibin = 1; ibin <= gOptNBins; ibin++) {
+      double elow = spectrum->GetBinLowEdge(ibin);
+      double de   = spectrum->GetBinWidth(ibin) / nsub;
+      double sum  = 0.;
+      for(int j = 0; j < nsub; j++) {
+        sum += TMath::Max(0., flux.Evaluate(elow + (j + 0.5) * de)) * de;
+      }
+      spectrum->SetBinContent(ibin, sum);
+    }
+  }
+  else if(input_is_root_file) {
+    vector<string> fv = utils::str::Split(spec, ",");
+    TFile * flux_file = (fv.size() == 2) ?
+       TFile::Open(fv[0].c_str(), "READ") : 0;
+    TH1D * hst = (flux_file && !flux_file->IsZombie()) ?
+       dynamic_cast<TH1D *> (flux_file->Get(fv[1].c_str())) : 0;
+    if(hst) {
+      spectrum = new TH1D(*hst);
+      spectrum->SetDirectory(0);
+    }
+    if(flux_file) {
+      flux_file->Close();
+      delete flux_file;
+    }
+  }
+  if(!spectrum) {
+    LOG("gfluxrates", pFATAL)
+      << "Couldn't get the flux of neutrino: " << nupdgc << " from: " << spec;
+    gAbortingInErr = true;
+    exit(1);
+  }
+  LOG("gfluxrates", pNOTICE)
+    << "Flux of neutrino: " << nupdgc << " from: " << spec
+    << " (integral: " << spectrum->Integral() << ")";
+
+  return spectrum;
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gfluxrates", pNOTICE) << "Parsing command line arguments";
+
+  // Common run options. Set defaults and read.
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  // Parse run options for this app
+
+  CmdLnArgParser parser(argc,argv);
+
+  if( parser.OptionExists('f') ) {
+    vector<string> fluxes = utils::str::Split(parser.ArgAsString('f'), ";");
+    for(unsigned int i = 0; i < fluxes.size(); i++) {
+      string::size_type sep = fluxes[i].find(":");
+      if(sep == string::npos) {
+        LOG("gfluxrates", pFATAL) << "Invalid flux: " << fluxes[i];
+        PrintSyntax();
+        exit(1);
+      }
+      int nupdgc = atoi(fluxes[i].substr(0, sep).c_str());
+      gOptFlux[nupdgc] = fluxes[i].substr(sep+1);
+    }
+  } else {
+    LOG("gfluxrates", pFATAL) << "Unspecified neutrino flux - Exiting";
+    PrintSyntax();
+    exit(1);
+  }
+
+  if( parser.OptionExists('t') ) {
+    vector<string> tgts = utils::str::Split(parser.ArgAsString('t'), ",");
+    for(unsigned int i = 0; i < tgts.size(); i++) {
+      string::size_type open_bracket  = tgts[i].find("[");
+      string::size_type close_bracket = tgts[i].find("]");
+      int    pdg = atoi(tgts[i].substr(0, open_bracket).c_str());
+      double ntg = 1.;
+      if(open_bracket != string::npos && close_bracket != string::npos) {
+        ntg = atof(tgts[i].substr(
+                open_bracket+1, close_bracket-open_bracket-1).c_str());
+      }
+      gOptTargets[pdg] = ntg;
+    }
+  } else {
+    LOG("gfluxrates", pFATAL) << "Unspecified targets - Exiting";
+    PrintSyntax();
+    exit(1);
+  }
+
+  if( parser.OptionExists("cross-sections") ) {
+    gOptInpXSecFile = parser.ArgAsString("cross-sections");
+  } else {
+    LOG("gfluxrates", pFATAL) << "Unspecified cross-section file - Exiting";
+    PrintSyntax();
+    exit(1);
+  }
+
+  if( parser.OptionExists('o') ) {
+    gOptOutFile = parser.ArgAsString('o');
+  }
+
+  if( parser.OptionExists('e') ) {
+    vector<string> erange = utils::str::Split(parser.ArgAsString('e'), ",");
+    if(erange.size() != 2) {
+      LOG("gfluxrates", pFATAL) << "Invalid energy range - Exiting";
+      PrintSyntax();
+      exit(1);
+    }
+    gOptEmin = atof(erange[0].c_str());
+    gOptEmax = atof(erange[1].c_str());
+  }
+  if(gOptEmin < 0. || gOptEmax <= gOptEmin) {
+    LOG("gfluxrates", pFATAL)
+      << "Invalid energy range: [" << gOptEmin << ", " << gOptEmax << "]";
+    exit(1);
+  }
+
+  if( parser.OptionExists("n-bins") ) {
+    gOptNBins = TMath::Max(1, parser.ArgAsInt("n-bins"));
+  }
+  if( parser.OptionExists("n-sub") ) {
+    gOptNSub = TMath::Max(1, parser.ArgAsInt("n-sub"));
+  }
+
+  LOG("gfluxrates", pNOTICE)
+     << "\n Fluxes : " << parser.ArgAsString('f')
+     << "\n Targets : " << parser.ArgAsString('t')
+     << "\n Input cross-section file : " << gOptInpXSecFile
+     << "\n Output file : " << gOptOutFile
+     << "\n Energy bins of vector file fluxes : " << gOptNBins
+     << " in [" << gOptEmin << ", " << gOptEmax << "] GeV"
+     << "\n Energies per bin : " << gOptNSub;
+
+  LOG("gfluxrates", pNOTICE) << *RunOpt::Instance();
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gfluxrates", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gfluxrates -f nupdg:flux[;nupdg:flux...]"
+    << " -t tgtpdg[ntargets],..."
+    << " --cross-sections xml_file"
+    << " [-o output_file]"
+    << " [-e min_energy,max_energy] [--n-bins n] [--n-sub n]"
+    << " [--threads n]"
+    << " [--event-generator-list list_name]"
+    << " [--tune genie_tune]"
+    << " [--xml-path config_xml_dir]"
+    << " [--message-thresholds xml_file]\n\n";
+}
+//____________________________________________________________________________
@@ -0,0 +1,458 @@
+//____________________________________________________________________________
+/*!
+
+\program ggeombench
+
+\brief   Geometry navigation benchmark for the ROOT geometry driver
+         (ROOTGeomAnalyzer).
+
+         Loads a ROOT (or GDML) geometry and fires rays through it, computing
+         for each ray the path lengths (ComputePathLengths()) and, optionally,
+         an interaction vertex (GenerateVertex()) for the target nucleus with
+         the largest path length. The rays are either read from a text file
+         (eg dumped from a flux driver, so that the same flux rays can be
+         replayed for any geometry or ROOT version) or generated on the
+         surface of the geometry's bounding box, pointing inwards.
+
+         Writes a machine-readable (XML) summary of:
+          - the throughput (rays/s) and the mean times per ray of the path
+            length and vertex computations,
+          - the mean number of path segments (volume steps) per ray,
+          - a breakdown of rays, steps and time by the depth (in the volume
+            hierarchy) of the deepest volume crossed by the ray,
+          - the summed path length of each target nucleus and a checksum of
+            all computed path lengths.
+         The checksums of the same geometry, rays and seed can be compared
+         across releases (and ROOT versions) to spot any change in the
+         navigation, and the timings to spot regressions.
+
+         Syntax :
+           ggeombench -f geom_file [-L length_units] [-D density_units]
+                      [-t top_vol_name] [-n nrays] [-o output_file]
+                      [--rays ray_file] [--vertices]
+                      [--seed random_number_seed]
+                      [--message-thresholds xml_file]
+
+         Options :
+           [] Denotes an optional argument
+           -f
+              A ROOT (or GDML) file containing a ROOT/GEANT geometry
+           -L
+              Geometry length units [ default: mm ]
+           -D
+              Geometry density units [ default: gr/cm3 ]
+           -t
+              Top volume name [ default: "" ]
+           -n
+              Number of rays [ default: 100000, or all rays of the ray file ]
+           -o
+              Output file name [ default: ggeombench.xml ]
+           --rays
+              Text file of rays, one per line: x y z (m) px py pz (GeV),
+              in the master coordinates of the geometry.
+              [ default: rays generated on the bounding box surface ]
+           --vertices
+              Also generate a vertex for every ray crossing some material
+           --seed
+              Random number seed [ default: 1989 ]
+           --message-thresholds
+              Allows users to customize the message stream thresholds.
+              The thresholds are specified using an XML file.
+              See $GENIE/config/Messenger.xml for the XML schema.
+
+         Example:
+
+           ggeombench -f mygeometry.root -L cm -D g_cm3 -n 1000000 --vertices
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <TMath.h>
+#include <TLorentzVector.h>
+#include <TVector3.h>
+#include <TGeoManager.h>
+#include <TGeoVolume.h>
+#include <TGeoNode.h>
+#include <TGeoBBox.h>
+#include <TRandom.h>
+#include <TROOT.h>
+
+#include "Framework/EventGen/PathLengthList.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/ParticleData/PDGCodeList.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/UnitUtils.h"
+#include "Tools/Geometry/PathSegmentList.h"
+#include "Tools/Geometry/ROOTGeomAnalyzer.h"
+
+using std::string;
+using std::vector;
+using std::map;
+using std::ifstream;
+using std::ofstream;
+using std::endl;
+
+using namespace genie;
+using namespace genie::geometry;
+
+// Benchmark results of the rays whose deepest volume is at a given depth
+struct DepthBin {
+  DepthBin() : nrays(0), nsteps(0), time(0.) { }
+  long   nrays;
+  long   nsteps;
+  double time;        // path length (and vertex) computation time (s)
+};
+
+// Function prototypes
+void GetCommandLineArgs (int argc, char ** argv);
+void ReadRays           (vector<TLorentzVector> & x4, vector<TLorentzVector> & p4);
+void BoxRays            (const ROOTGeomAnalyzer * geom,
+                         vector<TLorentzVector> & x4, vector<TLorentzVector> & p4);
+void VolumeDepths       (const TGeoVolume * vol, int depth,
+                         map<const TGeoVolume *, int> & depths);
+void PrintSyntax        (void);
+
+// Defaults for optional options:
+string kDefOptGeomLUnits = "mm";     // default geometry length units
+string kDefOptGeomDUnits = "g_cm3";  // default geometry density units
+
+// User-specified options:
+string   gOptGeomFilename   = "";                // input geometry file
+string   gOptRootGeomTopVol = "";                // input root geometry top vol name
+double   gOptGeomLUnits     = 0;                 // input geometry length units
+double   gOptGeomDUnits     = 0;                 // input geometry density units
+long     gOptNRays          = -1;                // number of rays
+string   gOptRayFilename    = "";                // input ray file
+bool     gOptVertices       = false;             // generate vertices?
+string   gOptOutFile        = "ggeombench.xml";  // output file
+long int gOptRanSeed        = 1989;              // random number seed
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  utils::app_init::RandGen(gOptRanSeed);
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+
+  std::chrono::steady_clock::time_point tload0 = std::chrono::steady_clock::now();
+
+  ROOTGeomAnalyzer * geom = new ROOTGeomAnalyzer(gOptGeomFilename);
+  geom -> SetLengthUnits       (gOptGeomLUnits);
+  geom -> SetDensityUnits      (gOptGeomDUnits);
+  geom -> SetWeightWithDensity (true);
+  geom -> SetTopVolName        (gOptRootGeomTopVol);
+
+  double tload = std::chrono::duration<double>(
+                     std::chrono::steady_clock::now() - tload0).count();
+
+  // depth of each volume in the volume hierarchy (the shallowest one for
+  // volumes placed at several depths)
+  map<const TGeoVolume *, int> depths;
+  VolumeDepths(geom->GetGeometry()->GetTopVolume(), 0, depths);
+
+  // rays
+  vector<TLorentzVector> x4;
+  vector<TLorentzVector> p4;
+  if(gOptRayFilename.size() > 0) ReadRays(x4, p4);
+  else                           BoxRays(geom, x4, p4);
+
+  const PDGCodeList & pdglist = geom->ListOfTargetNuclei();
+  const unsigned int nmat = pdglist.size();
+
+  // same random numbers (for the vertices) whatever the rays
+  RandomGen::Instance()->SetSeed(gOptRanSeed);
+
+  map<int, DepthBin> depth_bins;
+  vector<double> plsum(nmat, 0.);
+  ULong64_t checksum = 14695981039346656037ULL; // FNV-1a offset basis
+  long   nsteps = 0;
+  long   nvtx   = 0;
+  double tpl    = 0.;
+  double tvtx   = 0.;
+
+  for(unsigned int iray = 0; iray < x4.size(); iray++) {
+
+    std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    const PathLengthList & pllst = geom->ComputePathLengths(x4[iray], p4[iray]);
+    std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+    double dt = std::chrono::duration<double>(t1 - t0).count();
+    tpl += dt;
+
+    // path lengths: sums, checksum & target with the largest path length
+    int    tgtmax = 0;
+    double plmax  = 0.;
+    unsigned int imat = 0;
+    PathLengthList::const_iterator pl_iter;
+    for(pl_iter = pllst.begin(); pl_iter != pllst.end(); ++pl_iter, ++imat) {
+      double pl = pl_iter->second;
+      plsum[imat] += pl;
+      long long value = (long long) TMath::Nint(1E6 * pl);
+      const unsigned char * bytes = (const unsigned char *) &value;
+      for(unsigned int ib = 0; ib < sizeof(value); ib++) {
+        checksum ^= bytes[ib];
+        checksum *= 1099511628211ULL;  // FNV-1a prime
+      }
+      if(pl > plmax) { plmax = pl; tgtmax = pl_iter->first; }
+    }
+
+    if(gOptVertices && plmax > 0) {
+      std::chrono::steady_clock::time_point t2 = std::chrono::steady_clock::now();
+      geom->GenerateVertex(x4[iray], p4[iray], tgtmax);
+      std::chrono::steady_clock::time_point t3 = std::chrono::steady_clock::now();
+      double dtv = std::chrono::duration<double>(t3 - t2).count();
+      tvtx += dtv;
+      dt   += dtv;
+      nvtx++;
+    }
+
+    // steps & depth of the deepest volume crossed
+    const PathSegmentList & psl = geom->CurrentPathSegmentList();
+    int depth = -1;
+    PathSegmentList::PathSegVCItr_t sitr;
+    for(sitr = psl.begin(); sitr != psl.end(); ++sitr) {
+      map<const TGeoVolume *, int>::const_iterator diter = depths.find(sitr->fVolume);
+      if(diter != depths.end()) depth = TMath::Max(depth, diter->second);
+    }
+    DepthBin & bin = depth_bins[depth];
+    bin.nrays++;
+    bin.nsteps += psl.size();
+    bin.time   += dt;
+    nsteps     += psl.size();
+  }
+
+  double nrays = TMath::Max((double) x4.size(), 1.);
+  double ttot  = tpl + tvtx;
+
+  LOG("ggeombench", pNOTICE)
+    << x4.size() << " rays: " << x4.size() / TMath::Max(ttot, 1E-9)
+    << " rays/s, " << nsteps / nrays << " steps/ray, checksum: "
+    << std::hex << checksum << std::dec;
+
+  // write out the results
+  ofstream out(gOptOutFile.c_str(), std::ios::out);
+  if(!out.is_open()) {
+    LOG("ggeombench", pFATAL) << "Could not open file: " << gOptOutFile;
+    gAbortingInErr = true;
+    exit(1);
+  }
+  out << "<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?>" << endl;
+  out << "<!-- generated by ggeombench: times in s, path lengths in kg/m^2 -->" << endl;
+  out << "<geometry_benchmark geometry=\"" << gOptGeomFilename
+      << "\" top_volume=\"" << gOptRootGeomTopVol
+      << "\" rays=\"" << (gOptRayFilename.size() > 0 ? gOptRayFilename : "box")
+      << "\" seed=\"" << gOptRanSeed
+      << "\" root_version=\"" << gROOT->GetVersion() << "\">" << endl;
+  out << std::setprecision(6);
+  out << "  <load_time> "            << tload                  << " </load_time>" << endl;
+  out << "  <nrays> "                << x4.size()              << " </nrays>" << endl;
+  out << "  <nvertices> "            << nvtx                   << " </nvertices>" << endl;
+  out << "  <time> "                 << ttot                   << " </time>" << endl;
+  out << "  <rays_per_s> "           << x4.size() / TMath::Max(ttot, 1E-9) << " </rays_per_s>" << endl;
+  out << "  <path_length_time_per_ray> " << tpl / nrays        << " </path_length_time_per_ray>" << endl;
+  out << "  <vertex_time_per_ray> "  << tvtx / TMath::Max((double) nvtx, 1.) << " </vertex_time_per_ray>" << endl;
+  out << "  <steps_per_ray> "        << nsteps / nrays         << " </steps_per_ray>" << endl;
+  map<int, DepthBin>::const_iterator biter;
+  for(biter = depth_bins.begin(); biter != depth_bins.end(); ++biter) {
+    const DepthBin & bin = biter->second;
+    double n = TMath::Max((double) bin.nrays, 1.);
+    out << "  <depth value=\"" << biter->first << "\">"
+        << " <nrays> "         << bin.nrays       << " </nrays>"
+        << " <steps_per_ray> " << bin.nsteps / n  << " </steps_per_ray>"
+        << " <time> "          << bin.time        << " </time>"
+        << " <time_per_ray> "  << bin.time / n    << " </time_per_ray>"
+        << " </depth>" << endl;
+  }
+  out << std::setprecision(12);
+  for(unsigned int imat = 0; imat < nmat; imat++) {
+    out << "  <path_length_sum pdg=\"" << pdglist[imat] << "\"> "
+        << plsum[imat] << " </path_length_sum>" << endl;
+  }
+  out << "  <checksum> " << std::hex << checksum << std::dec << " </checksum>" << endl;
+  out << "</geometry_benchmark>" << endl;
+  out.close();
+
+  LOG("ggeombench", pNOTICE) << "Saved the benchmark results in: " << gOptOutFile;
+
+  delete geom;
+
+  return 0;
+}
+//____________________________________________________________________________
+void VolumeDepths(
+   const TGeoVolume * vol, int depth, map<const TGeoVolume *, int> & depths)
+{
+  if(!vol) return;
+
+  map<const TGeoVolume *, int>::iterator diter = depths.find(vol);
+  if(diter != depths.end() && diter->second <= depth) return;
+  depths[vol] = depth;
+
+  for(int i = 0; i < vol->GetNdaughters(); i++) {
+    VolumeDepths(vol->GetNode(i)->GetVolume(), depth+1, depths);
+  }
+}
+//____________________________________________________________________________
+void ReadRays(vector<TLorentzVector> & x4, vector<TLorentzVector> & p4)
+{
+  ifstream in(gOptRayFilename.c_str());
+  if(!in.is_open()) {
+    LOG("ggeombench", pFATAL) << "Could not open ray file: " << gOptRayFilename;
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  double x, y, z, px, py, pz;
+  while(in >> x >> y >> z >> px >> py >> pz) {
+    if(gOptNRays > 0 && (long) x4.size() >= gOptNRays) break;
+    double e = TMath::Sqrt(px*px + py*py + pz*pz);
+    x4.push_back(TLorentzVector(x, y, z, 0.));
+    p4.push_back(TLorentzVector(px, py, pz, e));
+  }
+
+  LOG("ggeombench", pNOTICE)
+    << "Read " << x4.size() << " rays from: " << gOptRayFilename;
+}
+//____________________________________________________________________________
+void BoxRays(const ROOTGeomAnalyzer * geom,
+             vector<TLorentzVector> & x4, vector<TLorentzVector> & p4)
+{
+// Rays starting uniformly on the surface of the master volume bounding box
+// (in master coordinates, SI units), with isotropic inwards directions
+
+  const TGeoBBox * box =
+    dynamic_cast<const TGeoBBox *> (geom->GetGeometry()->GetMasterVolume()->GetShape());
+  if(!box) {
+    LOG("ggeombench", pFATAL) << "Could not get the geometry bounding box";
+    gAbortingInErr = true;
+    exit(1);
+  }
+  double lu = geom->LengthUnits();
+  double d[3] = { box->GetDX() * lu, box->GetDY() * lu, box->GetDZ() * lu };
+  double o[3] = { box->GetOrigin()[0] * lu, box->GetOrigin()[1] * lu,
+                  box->GetOrigin()[2] * lu };
+
+  // face areas (faces -x,+x,-y,+y,-z,+z)
+  double area[3] = { d[1]*d[2], d[0]*d[2], d[0]*d[1] };
+  double atot = 2. * (area[0] + area[1] + area[2]);
+
+  TRandom & rnd = RandomGen::Instance()->RndGeom();
+
+  long nrays = (gOptNRays > 0) ? gOptNRays : 100000;
+  for(long iray = 0; iray < nrays; iray++) {
+    // pick a face
+    double r = atot * rnd.Rndm();
+    int face = 0;
+    for( ; face < 5; face++) {
+      r -= area[face/2];
+      if(r < 0) break;
+    }
+    int    axis = face / 2;
+    double side = (face % 2 == 0) ? -1. : +1.;
+
+    double pos[3];
+    for(int j = 0; j < 3; j++) pos[j] = o[j] + d[j] * (2*rnd.Rndm() - 1);
+    pos[axis] = o[axis] + side * d[axis];
+
+    // isotropic direction, flipped inwards
+    double cost = 2*rnd.Rndm() - 1;
+    double sint = TMath::Sqrt(1 - cost*cost);
+    double phi  = 2*TMath::Pi() * rnd.Rndm();
+    double dir[3] = { sint * TMath::Cos(phi), sint * TMath::Sin(phi), cost };
+    if(dir[axis] * side > 0) dir[axis] = -dir[axis];
+
+    x4.push_back(TLorentzVector(pos[0], pos[1], pos[2], 0.));
+    p4.push_back(TLorentzVector(dir[0], dir[1], dir[2], 1.));
+  }
+
+  LOG("ggeombench", pNOTICE)
+    << "Generated " << x4.size() << " rays on the geometry bounding box";
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("ggeombench", pNOTICE) << "Parsing command line arguments";
+
+  // Common run options. Set defaults and read.
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  // Parse run options for this app
+
+  CmdLnArgParser parser(argc,argv);
+
+  if( parser.OptionExists('f') ) {
+    gOptGeomFilename = parser.ArgAsString('f');
+  } else {
+    LOG("ggeombench", pFATAL) << "No geometry file was specified - Exiting";
+    PrintSyntax();
+    exit(1);
+  }
+
+  string lunits = kDefOptGeomLUnits;
+  string dunits = kDefOptGeomDUnits;
+  if( parser.OptionExists('L') ) lunits = parser.ArgAsString('L');
+  if( parser.OptionExists('D') ) dunits = parser.ArgAsString('D');
+  gOptGeomLUnits = genie::utils::units::UnitFromString(lunits);
+  gOptGeomDUnits = genie::utils::units::UnitFromString(dunits);
+
+  if( parser.OptionExists('t') ) {
+    gOptRootGeomTopVol = parser.ArgAsString('t');
+  }
+  if( parser.OptionExists('n') ) {
+    gOptNRays = parser.ArgAsLong('n');
+  }
+  if( parser.OptionExists('o') ) {
+    gOptOutFile = parser.ArgAsString('o');
+  }
+  if( parser.OptionExists("rays") ) {
+    gOptRayFilename = parser.ArgAsString("rays");
+  }
+  gOptVertices = parser.OptionExists("vertices");
+  if( parser.OptionExists("seed") ) {
+    gOptRanSeed = parser.ArgAsLong("seed");
+  }
+
+  LOG("ggeombench", pNOTICE)
+     << "\n Geometry : " << gOptGeomFilename
+     << "\n Geometry length units : " << gOptGeomLUnits
+     << "\n Geometry density units : " << gOptGeomDUnits
+     << "\n Top volume : " << gOptRootGeomTopVol
+     << "\n Rays : " << (gOptRayFilename.size() > 0 ? gOptRayFilename : "box")
+     << " (" << gOptNRays << ")"
+     << "\n Vertices : " << (gOptVertices ? "yes" : "no")
+     << "\n Random number seed : " << gOptRanSeed
+     << "\n Output file : " << gOptOutFile;
+
+  LOG("ggeombench", pNOTICE) << *RunOpt::Instance();
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("ggeombench", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   ggeombench -f geom_file [-L length_units] [-D density_units]"
+    << " [-t top_volume_name] [-n nrays] [-o output_file]"
+    << " [--rays ray_file] [--vertices]"
+    << " [--seed random_number_seed]"
+    << " [--message-thresholds xml_file]\n\n";
+}
+//____________________________________________________________________________
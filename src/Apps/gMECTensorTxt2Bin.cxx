@@ -0,0 +1,129 @@
+//____________________________________________________________________________
+/*!
+
+\program gmectensor2bin
+
+\brief   Converts the text tables of the MEC hadron tensors (MECHadronTensor)
+         into the binary table files that event generation jobs memory-map
+         at the first use of each target.
+
+         One binary file is written per target. The files are mapped
+         read-only (and shared by all jobs running on the same node) when
+         found at their default location in $GENIE/data/evgen/mectensor/nieves/,
+         otherwise the text tables are read by each job.
+
+         Syntax :
+           gmectensor2bin [-t target_pdg_codes]
+                          [-o output_directory]
+                          [--message-thresholds xml_file]
+
+         Options :
+           -t
+              A comma separated list of target PDG codes.
+              Default: all targets with hadron tensor tables
+           -o
+              Directory of the output binary table files.
+              Default: $GENIE/data/evgen/mectensor/nieves/
+           --message-thresholds
+              Allows users to customize the message stream thresholds.
+              The thresholds are specified using an XML file.
+              See $GENIE/config/Messenger.xml for the XML schema.
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Physics/Multinucleon/XSection/MECHadronTensor.h"
+
+using std::string;
+using std::vector;
+
+using namespace genie;
+
+// Prototypes:
+void GetCommandLineArgs (int argc, char ** argv);
+void PrintSyntax        (void);
+
+// User-specified options:
+vector<int> gOptTargets;        // targets to convert
+string      gOptOutDir  = "";   // output directory
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+
+  MECHadronTensor * hadtensor = MECHadronTensor::Instance();
+
+  if(gOptTargets.empty()) gOptTargets = hadtensor->KnownTensors();
+
+  for(unsigned int i = 0; i < gOptTargets.size(); i++) {
+    int    target  = gOptTargets[i];
+    string binfile = MECHadronTensor::BinaryTensorFile(target);
+    binfile = gOptOutDir + binfile.substr(binfile.rfind('/')+1);
+
+    if(!hadtensor->ConvertTensorTables(target, binfile)) {
+      LOG("gmectensor2bin", pFATAL)
+        << "Couldn't convert the MEC tensor tables of target: " << target;
+      gAbortingInErr = true;
+      exit(1);
+    }
+  }
+  return 0;
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gmectensor2bin", pNOTICE) << "Parsing command line arguments";
+
+  // Common run options. Set defaults and read.
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  // Parse run options for this app
+
+  CmdLnArgParser parser(argc,argv);
+
+  gOptOutDir = MECHadronTensor::TensorDir() + "/";
+
+  if( parser.OptionExists('t') ) {
+    gOptTargets = parser.ArgAsIntTokens('t', ",");
+  }
+  if( parser.OptionExists('o') ) {
+    gOptOutDir = parser.ArgAsString('o');
+    if(gOptOutDir.empty()) {
+      PrintSyntax();
+      exit(1);
+    }
+    if(gOptOutDir[gOptOutDir.size()-1] != '/') gOptOutDir += "/";
+  }
+
+  LOG("gmectensor2bin", pNOTICE)
+     << "\n Number of requested targets : " << gOptTargets.size()
+     << "\n Output directory : " << gOptOutDir;
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gmectensor2bin", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gmectensor2bin [-t target_pdg_codes] [-o output_directory]"
+    << " [--message-thresholds xml_file]\n\n";
+}
+//____________________________________________________________________________
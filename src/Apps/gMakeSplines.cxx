@@ -18,6 +18,15 @@
                   [-e max_energy]
                   [--no-copy]
                   [--seed random_number_seed]
+                  [--threads number_of_threads]
+                  [--knot-tolerance tolerance]
+                  [--resume]
+                  [--integral-cache file]
+                  [--cache-file root_file]
+                  [--shard i/N]
+                  [--tune-integrators xml_file]
+                  [--integrator-precision precision]
+                  [--integrator-config xml_file]
                   [--input-cross-sections xml_file]
                   [--event-generator-list list_name]
                   [--tune genie_tune]
@@ -52,6 +61,55 @@
                Does not write out the input cross-sections in the output file
            --seed
               Random number seed.
+           --threads
+              Number of threads used for integrating the spline knots.
+              The output does not depend on the number of threads.
+              Default: 1.
+           --knot-tolerance
+              Places the knots adaptively, refining the energy intervals
+              where the spline misses the cross section at the interval
+              midpoint by more than the input relative tolerance (eg 0.005).
+              The number of knots (-n) is then the maximum number of knots.
+              Default: off (knots spaced evenly).
+           --resume
+              Resumes an interrupted job. Every computed knot is written to
+              the checkpoint file <output_xml_xsec_file>.ckpt as soon as it
+              is computed (and the file is deleted once the output file is
+              written). With --resume, the knots found in the checkpoint file
+              are re-used instead of being computed again. The job must be
+              resumed with the same options.
+           --integral-cache
+              A file caching the knot integrals across jobs. The integrals
+              are keyed by a hash of the full configuration of the cross
+              section algorithm (incl. its sub-algorithms), the interaction
+              and the energy. Integrals found in the file are re-used and
+              new ones are appended, so that a job for a tune variant only
+              computes the channels whose configuration changed.
+           --cache-file
+              Allows users to specify a cache file so that the cache can be
+              re-used in subsequent MC jobs, eg the pion wavefunction tables
+              of the Alvarez-Ruso coherent pion production model.
+           --shard
+              Only computes shard i (0,...,N-1) of the job: The knots of all
+              splines are grouped in work units of a few consecutive knots
+              and the units are dealt to the N shards in turn. The output file
+              is then a shard file, with the knots of that shard. Run the N
+              shards with otherwise identical options and merge the N shard
+              files with gspladd. Can not be used with --knot-tolerance.
+           --tune-integrators
+              Calibration mode: no splines are built. For each channel, the
+              cross section integral is computed at a few energies with the
+              candidate settings of its integrator (GSL integration type,
+              relative tolerance, max evaluations) and with a high-precision
+              reference. For each integrator, the cheapest settings meeting
+              the --integrator-precision at all points are written to the
+              input XML file, to be used with --integrator-config.
+           --integrator-precision
+              Target relative precision of --tune-integrators.
+              Default: 1E-3.
+           --integrator-config
+              An XML file written by --tune-integrators. Its integrator
+              settings override the ones of the tune configuration.
            --input-cross-sections
               Name (incl. full path) of an XML file with pre-computed
               free-nucleon cross-section values. If loaded, it can speed-up
@@ -107,6 +165,7 @@
 #include "Framework/Utils/PrintUtils.h"
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Utils/CmdLnArgParser.h"
+#include "Physics/XSectionIntegration/XSecIntegratorTuner.h"
 
 #ifdef __GENIE_GEOM_DRIVERS_ENABLED__
 #include "Tools/Geometry/ROOTGeomAnalyzer.h"
@@ -135,6 +194,15 @@ int      gOptNKnots         = -1;
 double   gOptMaxE           = -1.;
 bool     gOptNoCopy         = false;
 long int gOptRanSeed        = -1;   // random number seed
+int      gOptNThreads       = 1;    // number of threads
+double   gOptKnotTol        = -1.;  // rel. tolerance for adaptive knots (<0: off)
+bool     gOptResume         = false; // resume from checkpoint file
+string   gOptIntegralCache  = "";   // integral cache file
+int      gOptShard          = 0;    // shard computed by this job
+int      gOptNShards        = 1;    // number of shards (1: no sharding)
+string   gOptTuneIntgFile   = "";   // output integrator tune file (calibration mode)
+double   gOptIntgPrecision  = 1E-3; // target precision of the integrator calibration
+string   gOptIntgConfFile   = "";   // input integrator tune file
 string   gOptInpXSecFile    = "";   // input cross-section file
 string   gOptOutXSecFile    = "";   // output cross-section file
 
@@ -157,8 +225,39 @@ int main(int argc, char ** argv)
 
   // Init
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+  utils::app_init::CacheFile(RunOpt::Instance()->CacheFile());
   utils::app_init::RandGen(gOptRanSeed);
-  utils::app_init::XSecTable(gOptInpXSecFile, false);
+
+  // tuned integrator settings
+  if(gOptIntgConfFile.size() > 0) {
+    if(!XSecIntegratorTuner::LoadFromXml(gOptIntgConfFile)) {
+      LOG("gmkspl", pFATAL)
+        << "Couldn't load integrator settings from: " << gOptIntgConfFile;
+      gAbortingInErr = true;
+      exit(1);
+    }
+  }
+
+  // the calibration computes all integrals: don't load pre-computed ones
+  bool calibrate = (gOptTuneIntgFile.size() > 0);
+  if(calibrate && gOptInpXSecFile.size() > 0) {
+    LOG("gmkspl", pWARN)
+      << "Ignoring the input cross-sections when tuning the integrators";
+  } else {
+    utils::app_init::XSecTable(gOptInpXSecFile, false);
+  }
+  XSecSplineList::Instance()->SetNThreads(gOptNThreads);
+  XSecSplineList::Instance()->SetKnotTolerance(gOptKnotTol);
+  XSecSplineList::Instance()->SetShard(gOptShard, gOptNShards);
+
+  // checkpoint each computed knot, so that the job can be resumed
+  string checkpoint_file = gOptOutXSecFile + ".ckpt";
+  XSecSplineList::Instance()->SetCheckpointFile(checkpoint_file, gOptResume);
+
+  // re-use the knot integrals computed by earlier jobs
+  if(gOptIntegralCache.size() > 0) {
+    XSecSplineList::Instance()->SetIntegralCacheFile(gOptIntegralCache);
+  }
 
   // Get list of neutrinos and nuclear targets
 
@@ -179,6 +278,30 @@ int main(int argc, char ** argv)
   LOG("gmkspl", pINFO) << "Neutrinos: " << *neutrinos;
   LOG("gmkspl", pINFO) << "Targets: "   << *targets;
 
+  // Calibration mode: tune the integrators of all the init states & exit
+  if(calibrate) {
+    XSecIntegratorTuner tuner(gOptIntgPrecision);
+    PDGCodeList::const_iterator nuiter;
+    PDGCodeList::const_iterator tgtiter;
+    for(nuiter = neutrinos->begin(); nuiter != neutrinos->end(); ++nuiter) {
+      for(tgtiter = targets->begin(); tgtiter != targets->end(); ++tgtiter) {
+        InitialState init_state(*tgtiter, *nuiter);
+        GEVGDriver driver;
+        driver.SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+        driver.Configure(init_state);
+        tuner.Calibrate(driver, init_state, gOptMaxE);
+      }
+    }
+    if(!tuner.SaveAsXml(gOptTuneIntgFile)) {
+      LOG("gmkspl", pFATAL)
+        << "Couldn't save integrator settings: " << gOptTuneIntgFile;
+      exit(1);
+    }
+    delete neutrinos;
+    delete targets;
+    return 0;
+  }
+
   // Loop over all possible input init states and ask the GEVGDriver
   // to build splines for all the interactions that its loaded list
   // of event generators can generate.
@@ -200,7 +323,20 @@ int main(int argc, char ** argv)
   // Save the splines at the requested XML file
   XSecSplineList * xspl = XSecSplineList::Instance();
   bool save_init = !gOptNoCopy;
-  xspl->SaveAsXml(gOptOutXSecFile, save_init);
+  if(gOptNShards > 1) {
+    // only part of the knots were computed: save them for merging
+    if(!xspl->SaveShard(gOptOutXSecFile)) {
+      LOG("gmkspl", pFATAL) << "Couldn't save shard file: " << gOptOutXSecFile;
+      exit(1);
+    }
+  } else {
+    xspl->SaveAsXml(gOptOutXSecFile, save_init);
+  }
+
+  // the job is complete: drop the checkpoint
+  xspl->CloseCheckpointFile();
+  xspl->CloseIntegralCacheFile();
+  gSystem->Unlink(checkpoint_file.c_str());
 
   delete neutrinos;
   delete targets;
@@ -317,6 +453,80 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptRanSeed = -1;
   }
 
+  // number of threads
+  if( parser.OptionExists("threads") ) {
+    LOG("gmkspl", pINFO) << "Reading number of threads";
+    gOptNThreads = parser.ArgAsInt("threads");
+  } else {
+    LOG("gmkspl", pINFO) << "Unspecified number of threads - Using default";
+    gOptNThreads = 1;
+  }
+
+  // tolerance for adaptive knot placement
+  if( parser.OptionExists("knot-tolerance") ) {
+    LOG("gmkspl", pINFO) << "Reading knot tolerance";
+    gOptKnotTol = parser.ArgAsDouble("knot-tolerance");
+  } else {
+    LOG("gmkspl", pINFO) << "Unspecified knot tolerance - Using even knots";
+    gOptKnotTol = -1.;
+  }
+
+  // resume from checkpoint?
+  gOptResume = parser.OptionExists("resume");
+
+  // integral cache file
+  if( parser.OptionExists("integral-cache") ) {
+    LOG("gmkspl", pINFO) << "Reading integral cache file";
+    gOptIntegralCache = parser.ArgAsString("integral-cache");
+  } else {
+    LOG("gmkspl", pINFO) << "Unspecified integral cache file - Not caching";
+    gOptIntegralCache = "";
+  }
+
+  // shard of a distributed job
+  if( parser.OptionExists("shard") ) {
+    LOG("gmkspl", pINFO) << "Reading shard";
+    vector<string> shard = utils::str::Split(parser.ArgAsString("shard"), "/");
+    if(shard.size() == 2) {
+      gOptShard   = atoi(shard[0].c_str());
+      gOptNShards = atoi(shard[1].c_str());
+    }
+    if(shard.size() != 2 || gOptNShards < 1 ||
+       gOptShard < 0 || gOptShard >= gOptNShards) {
+      LOG("gmkspl", pFATAL) << "Invalid shard: " << parser.ArgAsString("shard");
+      PrintSyntax();
+      exit(1);
+    }
+    if(gOptNShards > 1 && gOptKnotTol > 0.) {
+      LOG("gmkspl", pFATAL)
+        << "Adaptive knots (--knot-tolerance) can not be sharded";
+      exit(1);
+    }
+  } else {
+    gOptShard   = 0;
+    gOptNShards = 1;
+  }
+
+  // integrator calibration
+  if( parser.OptionExists("tune-integrators") ) {
+    LOG("gmkspl", pINFO) << "Reading integrator tune output file";
+    gOptTuneIntgFile = parser.ArgAsString("tune-integrators");
+  } else {
+    gOptTuneIntgFile = "";
+  }
+  if( parser.OptionExists("integrator-precision") ) {
+    LOG("gmkspl", pINFO) << "Reading integrator precision";
+    gOptIntgPrecision = parser.ArgAsDouble("integrator-precision");
+  } else {
+    gOptIntgPrecision = 1E-3;
+  }
+  if( parser.OptionExists("integrator-config") ) {
+    LOG("gmkspl", pINFO) << "Reading integrator tune input file";
+    gOptIntgConfFile = parser.ArgAsString("integrator-config");
+  } else {
+    gOptIntgConfFile = "";
+  }
+
   // input cross-section file
   if( parser.OptionExists("input-cross-sections") ) {
     LOG("gmkspl", pINFO) << "Reading cross-section file";
@@ -338,6 +548,14 @@ void GetCommandLineArgs(int argc, char ** argv)
      << "\n Output cross-section file : " << gOptOutXSecFile
      << "\n Input cross-section file : " << gOptInpXSecFile
      << "\n Random number seed : " << gOptRanSeed
+     << "\n Number of threads : " << gOptNThreads
+     << "\n Knot tolerance : " << gOptKnotTol
+     << "\n Resume from checkpoint : " << utils::print::BoolAsYNString(gOptResume)
+     << "\n Integral cache file : " << gOptIntegralCache
+     << "\n Shard : " << gOptShard << "/" << gOptNShards
+     << "\n Integrator tune output : " << gOptTuneIntgFile
+     << "\n Integrator precision : " << gOptIntgPrecision
+     << "\n Integrator config : " << gOptIntgConfFile
      << "\n";
 
   LOG("gmkspl", pNOTICE) << *RunOpt::Instance();
@@ -351,6 +569,12 @@ void PrintSyntax(void)
     << " <-o | --output-cross-section> xsec_xml_file_name"
     << " [-n nknots] [-e max_energy] "
     << " [--seed seed_number]"
+    << " [--threads number_of_threads]"
+    << " [--knot-tolerance tolerance] [--resume] [--shard i/N]"
+    << " [--tune-integrators xml_file] [--integrator-precision precision]"
+    << " [--integrator-config xml_file]"
+    << " [--integral-cache file]"
+    << " [--cache-file root_file]"
     << " [--input-cross-section xml_file]"
     << " [--event-generator-list list_name]"
     << " [--xml-path config_xml_dir]"
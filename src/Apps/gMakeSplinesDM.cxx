@@ -19,6 +19,8 @@
                   [-n nknots]
                   [-e max_energy]
                   [--no-copy]
+                  [--sf-grids]
+                  [--cache-file root_file]
                   [--seed random_number_seed]
                   [--input-cross-sections xml_file]
                   [--event-generator-list list_name]
@@ -58,6 +60,14 @@
                generating thread.
            --no-copy
                Does not write out the input cross-sections in the output file
+           --sf-grids
+               Tabulates the DIS structure functions in (x,Q2) grids at first
+               use and interpolates them (UseSFGrid). The grids do not depend
+               on the DM mass or couplings, so they are shared by the whole
+               scan (and by later jobs, if a GENIE cache file is in use).
+           --cache-file
+              Allows users to specify a cache file so that the cache can be
+              re-used in subsequent MC jobs, eg the SF grids of --sf-grids.
            --seed
               Random number seed.
            --input-cross-sections
@@ -145,6 +155,7 @@ vector<double>   gOptDMMasses;
 vector<double>   gOptMedRatios;
 vector<double>   gOptZpCouplings;
 bool     gOptNoCopy         = false;
+bool     gOptSFGrids        = false;
 long int gOptRanSeed        = -1;   // random number seed
 string   gOptInpXSecFile    = "";   // input cross-section file
 string   gOptOutXSecFile    = "";   // output cross-section file
@@ -161,6 +172,36 @@ int main(int argc, char ** argv)
   }
   RunOpt::Instance()->BuildTune();
 
+  // throw on NaNs and Infs...
+#if defined(HAVE_FENV_H) && defined(HAVE_FEENABLEEXCEPT)
+  feenableexcept(FE_DIVBYZERO | FE_INVALID | FE_OVERFLOW);
+#endif
+
+  // Init (once: the spline list and the cached SF grids are kept across
+  // the DM masses, mediator mass ratios and couplings)
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+  utils::app_init::RandGen(gOptRanSeed);
+  utils::app_init::XSecTable(gOptInpXSecFile, false);
+  utils::app_init::CacheFile(RunOpt::Instance()->CacheFile());
+
+  if (gOptSFGrids) {
+    Registry * r = AlgConfigPool::Instance()->CommonList("Param", "BoostedDarkMatter");
+    r->UnLock();
+    r->Set("UseSFGrid", true);
+    r->Lock();
+  }
+
+  // Get list of nuclear targets
+  PDGCodeList * targets = GetTargetCodes();
+
+  if(!targets || targets->size() == 0 ) {
+    LOG("gmkspl_dm", pFATAL) << "Empty target PDG code list";
+    PrintSyntax();
+    exit(3);
+  }
+
+  LOG("gmkspl_dm", pINFO) << "Targets: "   << *targets;
+
   for (vector<double>::iterator mass = gOptDMMasses.begin(); mass != gOptDMMasses.end(); ++mass) {
     for (vector<double>::iterator ratio = gOptMedRatios.begin(); ratio != gOptMedRatios.end(); ++ratio) {
       for (vector<double>::iterator coup = gOptZpCouplings.begin(); coup != gOptZpCouplings.end(); ++coup) {
@@ -174,30 +215,6 @@ int main(int argc, char ** argv)
             r->Lock();
         }
 
-
-        // throw on NaNs and Infs...
-#if defined(HAVE_FENV_H) && defined(HAVE_FEENABLEEXCEPT)
-        feenableexcept(FE_DIVBYZERO | FE_INVALID | FE_OVERFLOW);
-#endif
-
-        // Init
-        utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
-        utils::app_init::RandGen(gOptRanSeed);
-        utils::app_init::XSecTable(gOptInpXSecFile, false);
-
-        // Get list of neutrinos and nuclear targets
-
-        //  PDGCodeList * neutrinos = GetNeutrinoCodes();
-        PDGCodeList * targets   = GetTargetCodes();
-
-        if(!targets || targets->size() == 0 ) {
-          LOG("gmkspl_dm", pFATAL) << "Empty target PDG code list";
-          PrintSyntax();
-          exit(3);
-        }
-
-        LOG("gmkspl_dm", pINFO) << "Targets: "   << *targets;
-
         // Loop over all possible input init states and ask the GEVGDriver
         // to build splines for all the interactions that its loaded list
         // of event generators can generate.
@@ -214,11 +231,10 @@ int main(int argc, char ** argv)
           driver.Configure(init_state);
           driver.CreateSplines(gOptNKnots, gOptMaxE);
         }
-        delete targets;
       }
     }
   }
-  //  }
+  delete targets;
 
   // Save the splines at the requested XML file
   XSecSplineList * xspl = XSecSplineList::Instance();
@@ -326,6 +342,12 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptNoCopy = true;
   }
 
+  // tabulate the DIS SFs?
+  if( parser.OptionExists("sf-grids") ) {
+    LOG("gmkspl_dm", pINFO) << "Tabulating the DIS structure functions";
+    gOptSFGrids = true;
+  }
+
   // get the mediator coupling
   if( parser.OptionExists('g') ) {
     LOG("gmkspl_dm", pINFO) << "Reading mediator couplings";
@@ -446,6 +468,7 @@ void PrintSyntax(void)
     << " [-g zp_couplings] "
     << " [-z med_ratios] "
     << " [-n nknots] [-e max_energy] "
+    << " [--no-copy] [--sf-grids] [--cache-file root_file]"
     << " [--seed seed_number]"
     << " [--input-cross-section xml_file]"
     << " [--event-generator-list list_name]"
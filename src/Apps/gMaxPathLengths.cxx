@@ -20,7 +20,8 @@
          Syntax :
            gmxpl -f geom_file [-L length_units] [-D density_units] 
                  [-t top_vol_name] [-o output_xml_file] [-n np] [-r nr]
-                 [-seed random_number_seed]
+                 [-seed random_number_seed] [--threads number_of_threads]
+                 [--converge nscans[,tolerance]]
                  [--message-thresholds xml_file]
 
          Options :
@@ -40,6 +41,17 @@
                Name of output XML file [ default: maxpl.xml ]
            --seed 
                Random number seed.
+           --threads
+               Number of threads following the scanning rays through the
+               geometry [ default: 1 ].
+               The output does not depend on the number of threads.
+           --converge
+               Repeat the scan (of np points / surface and nr rays / point)
+               until no max path length has grown by more than the input
+               relative tolerance [ default: 1E-3 ] for nscans consecutive
+               scans. The safety factor that a single scan would have
+               needed is reported.
+               [ default: a single scan ]
           --message-thresholds
               Allows users to customize the message stream thresholds.
               The thresholds are specified using an XML file.
@@ -70,7 +82,9 @@
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cstdlib>
 #include <string>
+#include <vector>
 
 #include <TMath.h>
 
@@ -79,12 +93,14 @@
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/StringUtils.h"
 #include "Framework/Utils/UnitUtils.h"
 #include "Framework/Utils/PrintUtils.h"
 #include "Framework/Utils/AppInit.h"
 #include "Framework/Utils/RunOpt.h"
 
 using std::string;
+using std::vector;
 
 using namespace genie;
 using namespace genie::geometry;
@@ -107,6 +123,9 @@ double    gOptGeomDUnits      = 0;           // input geometry density units
 int       gOptNPoints         = -1;          // input number of points / surf
 int       gOptNRays           = -1;          // input number of rays / point
 long int  gOptRanSeed         = -1;          // random number seed
+int       gOptNThreads        = 1;           // number of threads
+int       gOptConvScans       = 0;           // scans without growth to converge (0: single scan)
+double    gOptConvTol         = 1E-3;        // relative growth tolerance
 
 //____________________________________________________________________________
 int main(int argc, char ** argv)
@@ -131,6 +150,8 @@ int main(int argc, char ** argv)
 
   if(gOptNPoints > 0) geom->SetScannerNPoints(gOptNPoints);
   if(gOptNRays   > 0) geom->SetScannerNRays  (gOptNRays);
+  geom->SetScannerNThreads(gOptNThreads);
+  if(gOptConvScans > 0) geom->SetScannerConvergence(gOptConvScans, gOptConvTol);
 
   // Compute the maximum path lengths
   LOG("gmxpl", pINFO)
@@ -142,6 +163,12 @@ int main(int argc, char ** argv)
       << "Maximum path lengths: " << plmax;
   plmax.SaveAsXml(gOptXMLFilename);
 
+  if(gOptConvScans > 0) {
+    LOG("gmxpl", pNOTICE)
+      << "Safety factor needed by a single scan: "
+      << geom->MaxPlSafetyFactorNeeded();
+  }
+
   delete geom;
 
   return 0;
@@ -239,6 +266,27 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptRanSeed = -1;
   }
 
+  // number of threads
+  if( parser.OptionExists("threads") ) {
+    LOG("gmxpl", pINFO) << "Reading number of threads";
+    gOptNThreads = parser.ArgAsInt("threads");
+  } else {
+    LOG("gmxpl", pINFO) << "Unspecified number of threads - Using default";
+    gOptNThreads = 1;
+  }
+
+  // convergence-controlled scans
+  if( parser.OptionExists("converge") ) {
+    LOG("gmxpl", pINFO) << "Reading max path length convergence scans";
+    vector<string> conv =
+      utils::str::Split(parser.ArgAsString("converge"), ",");
+    gOptConvScans = atoi(conv[0].c_str());
+    if(conv.size() > 1) gOptConvTol = atof(conv[1].c_str());
+  } else {
+    LOG("gmxpl", pINFO) << "Unspecified convergence scans - Using a single scan";
+    gOptConvScans = 0;
+  }
+
   // print the command line arguments
   LOG("gmxpl", pNOTICE)
      << "\n"
@@ -251,6 +299,9 @@ void GetCommandLineArgs(int argc, char ** argv)
   LOG("gmxpl", pNOTICE) << "Scanner points/surface  : " << gOptNPoints;
   LOG("gmxpl", pNOTICE) << "Scanner rays/point      : " << gOptNRays;
   LOG("gmxpl", pNOTICE) << "Random number seed      : " << gOptRanSeed;
+  LOG("gmxpl", pNOTICE) << "Number of threads       : " << gOptNThreads;
+  LOG("gmxpl", pNOTICE) << "Convergence scans       : " << gOptConvScans
+                        << " (tolerance: " << gOptConvTol << ")";
 
   LOG("gmxpl", pNOTICE) << "\n";
   LOG("gmxpl", pNOTICE) << *RunOpt::Instance();
@@ -267,6 +318,8 @@ void PrintSyntax(void)
       << " [-t top_volume_name]"
       << " [-o output_xml_file]"
       << " [-seed random_number_seed]"
+      << " [--threads number_of_threads]"
+      << " [--converge nscans[,tolerance]]"
       << " [--message-thresholds xml_file]\n";
 
 }
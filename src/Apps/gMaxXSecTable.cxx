@@ -0,0 +1,272 @@
+//____________________________________________________________________________
+/*!
+
+\program gmkmxs
+
+\brief   Builds the read-only table of the max differential cross sections
+         used by the kinematic generators as rejection envelopes.
+
+         The app generates events for every input neutrino and target on a
+         log-spaced grid of energies, with max xsec recording switched on, and
+         saves every max xsec value computed by the kinematic generators in a
+         binary table file. Event generation jobs can then map the table with
+         --max-xsec-table instead of repeating the same max xsec scans.
+         The table is only used by jobs with the same tune and event generator
+         list, and only for the models whose configuration did not change.
+
+         Syntax :
+           gmkmxs -p nupdg -t target_pdg_codes
+                  -o output_file
+                  --cross-sections xml_file
+                  [-e min_energy,max_energy]
+                  [--n-energies number_of_energies]
+                  [-n number_of_events_per_energy]
+                  [--seed random_number_seed]
+                  [--event-generator-list list_name]
+                  [--tune genie_tune]
+                  [--message-thresholds xml_file]
+                  [--xml-path config_xml_dir]
+
+         Options :
+           -p
+               A comma separated list of nu PDG codes.
+           -t
+               A comma separated list of tgt PDG codes.
+               PDG code format: 10LZZZAAAI
+           -o
+               Name of the output max xsec table file.
+           --cross-sections
+               Name (incl. full path) of an XML file with pre-computed
+               cross-section values, used for selecting the interactions.
+           -e
+               Energy range of the table (GeV).
+               Default: 0.1,100.
+           --n-energies
+               Number of energies, log-spaced in the energy range.
+               Default: 100.
+           -n
+               Number of events generated at each energy. Channels that are
+               never selected are not in the table (their max xsec are then
+               computed by the jobs using the table).
+               Default: 200.
+           --seed
+              Random number seed.
+          --event-generator-list
+              List of event generators to load in event generation drivers.
+              [default: "Default"].
+          --tune
+              Specifies a GENIE comprehensive neutrino interaction model tune.
+              [default: "Default"].
+           --message-thresholds
+              Allows users to customize the message stream thresholds.
+              The thresholds are specified using an XML file.
+              See $GENIE/config/Messenger.xml for the XML schema.
+           --xml-path
+              A directory to load XML files from - overrides $GXMLPATH, and $GENIE/config
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <TMath.h>
+#include <TLorentzVector.h>
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/GEVGDriver.h"
+#include "Framework/Interaction/InitialState.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Framework/Utils/MaxXSecTable.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+
+using std::string;
+using std::vector;
+
+using namespace genie;
+
+// Prototypes:
+void GetCommandLineArgs (int argc, char ** argv);
+void PrintSyntax        (void);
+
+// User-specified options:
+string   gOptNuPdgCodeList  = "";
+string   gOptTgtPdgCodeList = "";
+string   gOptInpXSecFile    = "";    // input cross-section file
+string   gOptOutFile        = "";    // output max xsec table file
+double   gOptEmin           = 0.1;   // GeV
+double   gOptEmax           = 100.;  // GeV
+int      gOptNEnergies      = 100;
+int      gOptNEvents        = 200;   // events per energy
+long int gOptRanSeed        = -1;    // random number seed
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  if ( ! RunOpt::Instance()->Tune() ) {
+    LOG("gmkmxs", pFATAL) << " No TuneId in RunOption";
+    exit(-1);
+  }
+  RunOpt::Instance()->BuildTune();
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+  utils::app_init::RandGen(gOptRanSeed);
+  utils::app_init::XSecTable(gOptInpXSecFile, true);
+
+  MaxXSecTable * table = MaxXSecTable::Instance();
+  table->SetRecording(true);
+
+  vector<string> nuvec  = utils::str::Split(gOptNuPdgCodeList,  ",");
+  vector<string> tgtvec = utils::str::Split(gOptTgtPdgCodeList, ",");
+
+  double logEmin = TMath::Log(gOptEmin);
+  double dlogE   = (gOptNEnergies > 1) ?
+        (TMath::Log(gOptEmax) - logEmin) / (gOptNEnergies - 1) : 0.;
+
+  for(unsigned int inu = 0; inu < nuvec.size(); inu++) {
+    for(unsigned int itgt = 0; itgt < tgtvec.size(); itgt++) {
+      int nupdgc  = atoi(nuvec [inu ].c_str());
+      int tgtpdgc = atoi(tgtvec[itgt].c_str());
+
+      InitialState init_state(tgtpdgc, nupdgc);
+      GEVGDriver driver;
+      driver.SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+      driver.UseSplines();
+      driver.Configure(init_state);
+
+      LOG("gmkmxs", pNOTICE)
+        << "Scanning max xsec values for: " << init_state.AsString();
+
+      for(int ie = 0; ie < gOptNEnergies; ie++) {
+        double Ev = TMath::Exp(logEmin + ie * dlogE);
+        TLorentzVector nu_p4(0.,0.,Ev,Ev);
+        for(int iev = 0; iev < gOptNEvents; iev++) {
+          EventRecord * event = driver.GenerateEvent(nu_p4);
+          if(event) event->Release();
+        }
+        LOG("gmkmxs", pNOTICE)
+          << "E = " << Ev << " GeV : " << table->NRecorded()
+          << " max xsec branches recorded so far";
+      }
+    }
+  }
+
+  if(!table->Save(gOptOutFile)) {
+    LOG("gmkmxs", pFATAL) << "Couldn't save max xsec table: " << gOptOutFile;
+    gAbortingInErr = true;
+    exit(1);
+  }
+  return 0;
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gmkmxs", pNOTICE) << "Parsing command line arguments";
+
+  // Common run options. Set defaults and read.
+  RunOpt::Instance()->EnableBareXSecPreCalc(true);
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  // Parse run options for this app
+
+  CmdLnArgParser parser(argc,argv);
+
+  if( parser.OptionExists('p') ) {
+    gOptNuPdgCodeList = parser.ArgAsString('p');
+  } else {
+    LOG("gmkmxs", pFATAL) << "Unspecified neutrino PDG code list - Exiting";
+    PrintSyntax();
+    exit(1);
+  }
+
+  if( parser.OptionExists('t') ) {
+    gOptTgtPdgCodeList = parser.ArgAsString('t');
+  } else {
+    LOG("gmkmxs", pFATAL) << "Unspecified target PDG code list - Exiting";
+    PrintSyntax();
+    exit(1);
+  }
+
+  if( parser.OptionExists('o') ) {
+    gOptOutFile = parser.ArgAsString('o');
+  } else {
+    LOG("gmkmxs", pFATAL) << "Unspecified output file - Exiting";
+    PrintSyntax();
+    exit(1);
+  }
+
+  if( parser.OptionExists("cross-sections") ) {
+    gOptInpXSecFile = parser.ArgAsString("cross-sections");
+  } else {
+    LOG("gmkmxs", pFATAL) << "Unspecified cross-section file - Exiting";
+    PrintSyntax();
+    exit(1);
+  }
+
+  if( parser.OptionExists('e') ) {
+    vector<string> erange = utils::str::Split(parser.ArgAsString('e'), ",");
+    if(erange.size() != 2) {
+      LOG("gmkmxs", pFATAL) << "Invalid energy range - Exiting";
+      PrintSyntax();
+      exit(1);
+    }
+    gOptEmin = atof(erange[0].c_str());
+    gOptEmax = atof(erange[1].c_str());
+  }
+  if(gOptEmin <= 0. || gOptEmax <= gOptEmin) {
+    LOG("gmkmxs", pFATAL)
+      << "Invalid energy range: [" << gOptEmin << ", " << gOptEmax << "]";
+    exit(1);
+  }
+
+  if( parser.OptionExists("n-energies") ) {
+    gOptNEnergies = TMath::Max(1, parser.ArgAsInt("n-energies"));
+  }
+  if( parser.OptionExists('n') ) {
+    gOptNEvents = TMath::Max(1, parser.ArgAsInt('n'));
+  }
+  if( parser.OptionExists("seed") ) {
+    gOptRanSeed = parser.ArgAsLong("seed");
+  }
+
+  LOG("gmkmxs", pNOTICE)
+     << "\n Neutrino PDG codes : " << gOptNuPdgCodeList
+     << "\n Target PDG codes : " << gOptTgtPdgCodeList
+     << "\n Input cross-section file : " << gOptInpXSecFile
+     << "\n Output max xsec table : " << gOptOutFile
+     << "\n Energy range : [" << gOptEmin << ", " << gOptEmax << "] GeV"
+     << "\n Number of energies : " << gOptNEnergies
+     << "\n Events per energy : " << gOptNEvents
+     << "\n Random number seed : " << gOptRanSeed;
+
+  LOG("gmkmxs", pNOTICE) << *RunOpt::Instance();
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gmkmxs", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gmkmxs -p nupdg -t tgtpdg -o output_file"
+    << " --cross-sections xml_file"
+    << " [-e min_energy,max_energy] [--n-energies n] [-n nevents]"
+    << " [--seed seed_number]"
+    << " [--event-generator-list list_name]"
+    << " [--tune genie_tune]"
+    << " [--xml-path config_xml_dir]"
+    << " [--message-thresholds xml_file]\n\n";
+}
+//____________________________________________________________________________
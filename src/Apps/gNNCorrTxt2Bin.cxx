@@ -0,0 +1,135 @@
+//____________________________________________________________________________
+/*!
+
+\program gnncorr2bin
+
+\brief   Converts the text tables of the in-medium nucleon-nucleon cross
+         section corrections (INukeNucleonCorr) into the binary table file
+         that event generation jobs memory-map at start-up.
+
+         The binary file holds, for each tabulated nucleus, the corrections
+         in bins of nucleon kinetic energy and nuclear density. It is mapped
+         read-only (and shared by all jobs running on the same node) when
+         found at its default location, $GENIE/data/evgen/nncorr/NNCorrection.bin,
+         otherwise the text tables are read by each job.
+
+         Syntax :
+           gnncorr2bin [-i input_directory]
+                       [-o output_file]
+                       [--message-thresholds xml_file]
+
+         Options :
+           -i
+              Directory of the text tables (NNCorrection_Z_A.txt).
+              Default: $GENIE/data/evgen/nncorr/
+           -o
+              Name of the output binary table file.
+              Default: $GENIE/data/evgen/nncorr/NNCorrection.bin
+           --message-thresholds
+              Allows users to customize the message stream thresholds.
+              The thresholds are specified using an XML file.
+              See $GENIE/config/Messenger.xml for the XML schema.
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <string>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Physics/HadronTransport/INukeNucleonCorr.h"
+
+using std::string;
+
+using namespace genie;
+
+// Prototypes:
+void GetCommandLineArgs (int argc, char ** argv);
+void PrintSyntax        (void);
+
+// User-specified options:
+string gOptInpDir  = "";  // directory of the text tables
+string gOptOutFile = "";  // output binary table file
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+
+  INukeNucleonCorr * nncorr = INukeNucleonCorr::getInstance();
+
+  if(!nncorr->ReadTables(gOptInpDir)) {
+    LOG("gnncorr2bin", pFATAL)
+      << "Couldn't read the nucleon correction tables in: " << gOptInpDir;
+    gAbortingInErr = true;
+    exit(1);
+  }
+  if(!nncorr->SaveTables(gOptOutFile)) {
+    LOG("gnncorr2bin", pFATAL)
+      << "Couldn't save the nucleon correction tables in: " << gOptOutFile;
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  // check the output file can be mapped
+  if(!nncorr->MapTables(gOptOutFile)) {
+    LOG("gnncorr2bin", pFATAL)
+      << "Couldn't map the nucleon correction tables saved in: " << gOptOutFile;
+    gAbortingInErr = true;
+    exit(1);
+  }
+  return 0;
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gnncorr2bin", pNOTICE) << "Parsing command line arguments";
+
+  // Common run options. Set defaults and read.
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  // Parse run options for this app
+
+  CmdLnArgParser parser(argc,argv);
+
+  gOptInpDir  = INukeNucleonCorr::TableDir();
+  gOptOutFile = INukeNucleonCorr::BinaryTableFile();
+
+  if( parser.OptionExists('i') ) {
+    gOptInpDir = parser.ArgAsString('i');
+    if(gOptInpDir.empty()) {
+      PrintSyntax();
+      exit(1);
+    }
+    if(gOptInpDir[gOptInpDir.size()-1] != '/') gOptInpDir += "/";
+  }
+  if( parser.OptionExists('o') ) {
+    gOptOutFile = parser.ArgAsString('o');
+  }
+
+  LOG("gnncorr2bin", pNOTICE)
+     << "\n Input table directory : " << gOptInpDir
+     << "\n Output table file : " << gOptOutFile;
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gnncorr2bin", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gnncorr2bin [-i input_directory] [-o output_file]"
+    << " [--message-thresholds xml_file]\n\n";
+}
+//____________________________________________________________________________
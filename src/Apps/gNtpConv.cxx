@@ -8,9 +8,11 @@
 
          Syntax:
            gntpc -i input_file [-o output_file] -f format [-n nev] [-v vrs] [-c] 
-                 [--seed random_number_seed]
+                 [--seed random_number_seed] [--threads number_of_threads]
                  [--message-thresholds xml_file]
                  [--event-record-print-level level]
+                 [--output-compression alg[:level]] [--output-basket-size size]
+                 [--output-autosave bytes] [--output-autoflush entries_or_bytes]
 
 
          Options :
@@ -25,6 +27,8 @@
               (optional, default: use latest version of each format)
            -c 
               Copy MC job metadata (gconfig and genv TFolders) from the input GHEP file.
+              If the input file only points to the job metadata store file of its
+              configuration (see --output-meta-store), that pointer is copied.
            -f 
               A string that specifies the output file format. 
               >>
@@ -37,6 +41,17 @@
    	       * `ghep_mock_data': 
                      Output file has the same format as the input file (GHEP) but
                      all information other than final state particles is hidden
+   	       * `gflat': 
+                     The flat, columnar GENIE event tree (NtpMCFlatRecord): per-event
+                     scalars and per-particle arrays, one branch per variable.
+                     Readable with RDataFrame / uproot.
+   	       * `ghep': 
+                     Converts a flat (`gflat') or compact (`ghep_compact') event tree
+                     back to the native, full precision GHEP format.
+   	       * `ghep_compact': 
+                     The native GHEP format, with events stored as compact, reduced
+                     precision records (NtpMCCompactEventRecord). They are read back
+                     as normal GHEP event records.
    	       * `rootracker': 
                      A bare-ROOT STDHEP-like GENIE event tree.
    	       * `rootracker_mock_data': 
@@ -81,6 +96,9 @@
                `gst'                  -> *.gst.root
                `gxml'                 -> *.gxml 
                `ghep_mock_data'       -> *.mockd.ghep.root
+               `gflat'                -> *.gflat.root
+               `ghep'                 -> *.ghep.root
+               `ghep_compact'         -> *.cghep.root
                `rootracker'           -> *.gtrac.root
                `rootracker_mock_data' -> *.mockd.gtrac.root
                `t2k_rootracker'       -> *.gtrac.root
@@ -91,6 +109,13 @@
                `ginuke'               -> *.ginuke.root
            --seed
               Random number seed.
+           --threads
+              Number of conversion threads. The input entry range is split
+              in consecutive slices, each converted on a thread of its own
+              into a temporary part file (<output_file>.part<i>); the parts
+              are then merged, keeping the input entry order.
+              Splits the gst, gxml, rootracker (all flavours), nuance_tracker
+              and ginuke conversions; other formats use a single thread.
          --message-thresholds
               Allows users to customize the message stream thresholds.
               The thresholds are specified using an XML file.
@@ -98,6 +123,11 @@
            --event-record-print-level
               Allows users to set the level of information shown when the event
               record is printed in the screen. See GHepRecord::Print().
+           --output-compression, --output-basket-size,
+           --output-autosave, --output-autoflush
+              Compression (zlib, lzma, lz4, zstd, optionally followed by
+              :level), branch basket size, autosave and autoflush settings
+              of the output ROOT file. See utils::app_init::OutputFile().
 		
          Examples:
            (1)  shell% gntpc -i myfile.ghep.root -f t2k_rootracker
@@ -124,12 +154,16 @@
 #include <iomanip>
 #include <vector>
 #include <algorithm>
+#include <thread>
 
 #include "libxml/parser.h"
 #include "libxml/xmlmemory.h"
 
+#include <RVersion.h>
+#include <TROOT.h>
 #include <TSystem.h>
 #include <TFile.h>
+#include <TFileMerger.h>
 #include <TTree.h>
 #include <TFolder.h>
 #include <TBits.h>
@@ -145,8 +179,10 @@
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/GHEP/GHepUtils.h"
 #include "Framework/Ntuple/NtpMCFormat.h"
+#include "Framework/Ntuple/NtpMCJobConfig.h"
 #include "Framework/Ntuple/NtpMCTreeHeader.h"
 #include "Framework/Ntuple/NtpMCEventRecord.h"
+#include "Framework/Ntuple/NtpMCFlatRecord.h"
 #include "Framework/Ntuple/NtpWriter.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Messenger/Messenger.h"
@@ -169,6 +205,7 @@
 using std::string;
 using std::ostringstream;
 using std::ofstream;
+using std::ifstream;
 using std::endl;
 using std::setw;
 using std::setprecision;
@@ -180,19 +217,40 @@ using std::vector;
 using namespace genie;
 using namespace genie::constants;
 
+//a slice of the input entry range, converted by one worker
+typedef struct SGNtpcSlice {
+  Long64_t first;  ///< first input entry
+  Long64_t last;   ///< one past the last input entry
+  string   out;    ///< output file (a temporary part file when converting in parallel)
+  bool     head;   ///< first slice: write the file header and the job metadata
+  bool     tail;   ///< last slice: write the file trailer
+} GNtpcSlice_t;
+
+typedef void (*GNtpcConverter_t)(const GNtpcSlice_t &);
+
+//how the output of the slices is put back together
+typedef enum EGNtpcMerge {
+  kConvMerge_root,   ///< ROOT output: the part trees are merged in entry order
+  kConvMerge_text,   ///< text output: the part files are concatenated in order
+  kConvMerge_serial  ///< not splittable: converted on a single thread
+} GNtpcMerge_t;
+
 //func prototypes
-void   ConvertToGST              (void);
-void   ConvertToGXML             (void);
+void   ConvertSlices             (GNtpcConverter_t converter, GNtpcMerge_t merge);
+void   ConvertToGST              (const GNtpcSlice_t & slice);
+void   ConvertToGXML             (const GNtpcSlice_t & slice);
 void   ConvertToGHepMock         (void);
-void   ConvertToGTracker         (void);
-void   ConvertToGRooTracker      (void);
+void   ConvertGHepFormats        (void);
+void   ConvertToGTracker         (const GNtpcSlice_t & slice);
+void   ConvertToGRooTracker      (const GNtpcSlice_t & slice);
 void   ConvertToGHad             (void);
-void   ConvertToGINuke           (void);
+void   ConvertToGINuke           (const GNtpcSlice_t & slice);
 void   GetCommandLineArgs        (int argc, char ** argv);
 void   PrintSyntax               (void);
 string DefaultOutputFile         (void);
 int    LatestFormatVersionNumber (void);
 bool   CheckRootFilename         (string filename);
+void   CopyJobMeta               (TFile & fin, TFile & fout);
 int    HAProbeFSI                (int, int, int, double [], int [], int, int, int); //Test code
 //format enum
 typedef enum EGNtpcFmt {
@@ -207,7 +265,10 @@ typedef enum EGNtpcFmt {
   kConvFmt_t2k_tracker,
   kConvFmt_nuance_tracker,
   kConvFmt_ghad,
-  kConvFmt_ginuke
+  kConvFmt_ginuke,
+  kConvFmt_gflat,
+  kConvFmt_ghep,
+  kConvFmt_ghep_compact
 } GNtpcFmt_t;
 
 //input options (from command line arguments):
@@ -218,6 +279,7 @@ int        gOptVersion;             ///< output file format version
 Long64_t   gOptN;                   ///< number of events to process
 bool       gOptCopyJobMeta = false; ///< copy MC job metadata (gconfig, genv TFolders)
 long int   gOptRanSeed;             ///< random number seed
+int        gOptNThreads = 1;        ///< number of conversion threads
 
 //genie version used to generate the input event file 
 int gFileMajorVrs = -1;
@@ -243,12 +305,12 @@ int main(int argc, char ** argv)
 
    case (kConvFmt_gst)  :
 
-	ConvertToGST();        
+	ConvertSlices(ConvertToGST, kConvMerge_root);
 	break;  
 
    case (kConvFmt_gxml) :  
 
-	ConvertToGXML();         
+	ConvertSlices(ConvertToGXML, kConvMerge_text);
 	break;
 
    case (kConvFmt_ghep_mock_data) :  
@@ -256,18 +318,31 @@ int main(int argc, char ** argv)
 	ConvertToGHepMock();         
 	break;
 
+   case (kConvFmt_gflat) :  
+   case (kConvFmt_ghep ) :  
+   case (kConvFmt_ghep_compact) :  
+
+	ConvertGHepFormats();         
+	break;
+
    case (kConvFmt_rootracker          ) :  
    case (kConvFmt_rootracker_mock_data) :  
    case (kConvFmt_t2k_rootracker      ) :  
    case (kConvFmt_numi_rootracker     ) :  
 
-	ConvertToGRooTracker(); 
+	ConvertSlices(ConvertToGRooTracker, kConvMerge_root);
 	break;
 
    case (kConvFmt_t2k_tracker   )  :  
+
+	// the K0 -> K0L/K0S conversion draws from the shared random number
+	// generator, so keep it on a single (reproducible) stream
+	ConvertSlices(ConvertToGTracker, kConvMerge_serial);
+	break;
+
    case (kConvFmt_nuance_tracker)  :  
 
-	ConvertToGTracker();        
+	ConvertSlices(ConvertToGTracker, kConvMerge_text);
 	break;
 
    case (kConvFmt_ghad) :  
@@ -277,7 +352,7 @@ int main(int argc, char ** argv)
 
    case (kConvFmt_ginuke) :  
 
-	ConvertToGINuke();         
+	ConvertSlices(ConvertToGINuke, kConvMerge_root);
 	break;
 
    default:
@@ -290,9 +365,122 @@ int main(int argc, char ** argv)
   return 0;
 }
 //____________________________________________________________________________________
+// SPLITTING THE INPUT ENTRY RANGE ACROSS CONVERSION THREADS
+//____________________________________________________________________________________
+void ConvertSlices(GNtpcConverter_t converter, GNtpcMerge_t merge)
+{
+  //-- figure out how many events to analyze & read the input file version
+  Long64_t nmax = 0;
+  {
+    TFile fin(gOptInpFileName.c_str(),"READ");
+    TTree *           tree = dynamic_cast <TTree *>           ( fin.Get("gtree")  );
+    NtpMCTreeHeader * thdr = dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
+    if (!tree) {
+      LOG("gntpc", pERROR) << "Null input GHEP event tree";
+      return;
+    }
+    nmax = (gOptN<0) ? 
+         tree->GetEntries() : TMath::Min(tree->GetEntries(), gOptN);
+    if(thdr) {
+      gFileMajorVrs = utils::system::GenieMajorVrsNum(thdr->cvstag.GetString().Data());
+      gFileMinorVrs = utils::system::GenieMinorVrsNum(thdr->cvstag.GetString().Data());
+      gFileRevisVrs = utils::system::GenieRevisVrsNum(thdr->cvstag.GetString().Data());
+    }
+    fin.Close();
+  }
+  if (nmax<0) {
+    LOG("gntpc", pERROR) << "Number of events = 0";
+    return;
+  }
+
+  //-- number of slices: one per thread, with at least one event each
+  Long64_t nslices = TMath::Max(1LL, TMath::Min((Long64_t)gOptNThreads, nmax));
+  if(nslices > 1 && merge == kConvMerge_serial) {
+    LOG("gntpc", pWARN)
+      << "The requested output format can not be converted in parallel"
+      << " - Using a single thread";
+    nslices = 1;
+  }
+#if ROOT_VERSION_CODE < ROOT_VERSION(6,6,0)
+  if(nslices > 1) {
+    LOG("gntpc", pWARN) 
+      << "Converting in parallel needs ROOT >= 6.06 - Using a single thread";
+    nslices = 1;
+  }
+#endif
+
+  if(nslices == 1) {
+    GNtpcSlice_t slice = { 0, nmax, gOptOutFileName, true, true };
+    converter(slice);
+    return;
+  }
+
+  //-- convert consecutive entry ranges on separate threads, each into a
+  //   part file of its own
+  LOG("gntpc", pNOTICE) 
+     << "*** Converting " << nmax << " events on " << nslices << " threads";
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,6,0)
+  ROOT::EnableThreadSafety();
+#endif
+
+  vector<GNtpcSlice_t> slices(nslices);
+  for(Long64_t islice = 0; islice < nslices; islice++) {
+    ostringstream part;
+    part << gOptOutFileName << ".part" << islice;
+    slices[islice].first = (nmax *  islice   ) / nslices;
+    slices[islice].last  = (nmax * (islice+1)) / nslices;
+    slices[islice].out   = part.str();
+    slices[islice].head  = (islice == 0);
+    slices[islice].tail  = (islice == nslices-1);
+  }
+  vector<std::thread> workers;
+  for(Long64_t islice = 0; islice < nslices; islice++) {
+    workers.push_back(std::thread(converter, std::cref(slices[islice])));
+  }
+  for(unsigned int iw = 0; iw < workers.size(); iw++) {
+    workers[iw].join();
+  }
+
+  //-- put the parts back together, in entry order
+  LOG("gntpc", pNOTICE) 
+     << "*** Merging " << nslices << " parts into: " << gOptOutFileName;
+  bool merged = true;
+  if(merge == kConvMerge_root) {
+    TFileMerger merger(kFALSE);
+    int compression = RunOpt::Instance()->OutputCompression();
+    if(compression >= 0) {
+      merger.OutputFile(gOptOutFileName.c_str(), "RECREATE", compression);
+    } else {
+      merger.OutputFile(gOptOutFileName.c_str(), "RECREATE");
+    }
+    for(Long64_t islice = 0; islice < nslices; islice++) {
+      merger.AddFile(slices[islice].out.c_str(), kFALSE);
+    }
+    merged = merger.Merge();
+  } else {
+    ofstream output(gOptOutFileName.c_str(), ios::out | ios::binary);
+    for(Long64_t islice = 0; islice < nslices; islice++) {
+      ifstream part(slices[islice].out.c_str(), ios::in | ios::binary);
+      if(part.peek() != ifstream::traits_type::eof()) output << part.rdbuf();
+    }
+    output.close();
+    merged = !output.fail();
+  }
+  if(!merged) {
+    LOG("gntpc", pFATAL) 
+      << "Failed to merge the converted parts - Keeping them in place";
+    gAbortingInErr = true;
+    exit(5);
+  }
+  for(Long64_t islice = 0; islice < nslices; islice++) {
+    gSystem->Unlink(slices[islice].out.c_str());
+  }
+}
+//____________________________________________________________________________________
 // GENIE GHEP EVENT TREE FORMAT -> GENIE SUMMARY NTUPLE 
 //____________________________________________________________________________________
-void ConvertToGST(void)
+void ConvertToGST(const GNtpcSlice_t & slice)
 {
   // Some constants
   const double e_h = 1.3; // typical e/h ratio used for computing mean `calorimetric response'
@@ -401,8 +589,9 @@ void ConvertToGST(void)
   // Open output file & create output summary tree & create the tree branches
   //
   LOG("gntpc", pNOTICE) 
-       << "*** Saving summary tree to: " << gOptOutFileName;
-  TFile fout(gOptOutFileName.c_str(),"recreate");
+       << "*** Saving summary tree to: " << slice.out;
+  TFile fout(slice.out.c_str(),"recreate");
+  utils::app_init::OutputFile(&fout);
 
   TTree * s_tree = new TTree("gst","GENIE Summary Event Tree");
 
@@ -503,6 +692,8 @@ void ConvertToGST(void)
   s_tree->Branch("sumKEf",       &brSumKEf,	    "sumKEf/D"      );
   s_tree->Branch("calresp0",     &brCalResp0,	    "calresp0/D"    );
 
+  utils::app_init::OutputTree(s_tree);
+
   // Open the ROOT file and get the TTree & its header
   TFile fin(gOptInpFileName.c_str(),"READ");
   TTree *           er_tree = 0;
@@ -523,20 +714,14 @@ void ConvertToGST(void)
     return;
   }
   
-  // Figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ? 
-       er_tree->GetEntries() : TMath::Min( er_tree->GetEntries(), gOptN );
-  if (nmax<0) {
-    LOG("gntpc", pERROR) << "Number of events = 0";
-    return;
-  }
-
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+  LOG("gntpc", pNOTICE) 
+     << "*** Analyzing: " << slice.last - slice.first << " events"
+     << " [" << slice.first << ", " << slice.last << ")";
 
   TLorentzVector pdummy(0,0,0,0);
 
   // Event loop
-  for(Long64_t iev = 0; iev < nmax; iev++) {
+  for(Long64_t iev = slice.first; iev < slice.last; iev++) {
     er_tree->GetEntry(iev);
 
     NtpMCRecHeader rec_header = mcrec->hdr;
@@ -1065,12 +1250,8 @@ void ConvertToGST(void)
 
 
   // Copy MC job metadata (gconfig and genv TFolders)
-  if(gOptCopyJobMeta) {
-    TFolder * genv    = (TFolder*) fin.Get("genv");
-    TFolder * gconfig = (TFolder*) fin.Get("gconfig");
-    fout.cd();       
-    genv    -> Write("genv");
-    gconfig -> Write("gconfig");
+  if(gOptCopyJobMeta && slice.head) {
+    CopyJobMeta(fin, fout);
   }
 
   fin.Close();
@@ -1081,7 +1262,7 @@ void ConvertToGST(void)
 //____________________________________________________________________________________
 // GENIE GHEP EVENT TREE FORMAT -> GENIE XML EVENT FILE FORMAT 
 //____________________________________________________________________________________
-void ConvertToGXML(void)
+void ConvertToGXML(const GNtpcSlice_t & slice)
 {
   //-- open the ROOT file and get the TTree & its header
   TFile fin(gOptInpFileName.c_str(),"READ");
@@ -1097,26 +1278,23 @@ void ConvertToGXML(void)
   tree->SetBranchAddress("gmcrec", &mcrec);
 
   //-- open the output stream
-  ofstream output(gOptOutFileName.c_str(), ios::out);
+  ofstream output(slice.out.c_str(), ios::out);
 
   //-- add required header
-  output << "<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?>";
-  output << endl << endl;
-  output << "<!-- generated by GENIE gntpc utility -->";   
-  output << endl << endl;
-  output << "<genie_event_list version=\"1.00\">" << endl;
-
-  //-- figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ? 
-       tree->GetEntries() : TMath::Min(tree->GetEntries(), gOptN);
-  if (nmax<0) {
-    LOG("gntpc", pERROR) << "Number of events = 0";
-    return;
+  if(slice.head) {
+    output << "<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?>";
+    output << endl << endl;
+    output << "<!-- generated by GENIE gntpc utility -->";   
+    output << endl << endl;
+    output << "<genie_event_list version=\"1.00\">" << endl;
   }
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+
+  LOG("gntpc", pNOTICE) 
+     << "*** Analyzing: " << slice.last - slice.first << " events"
+     << " [" << slice.first << ", " << slice.last << ")";
 
   //-- event loop
-  for(Long64_t iev = 0; iev < nmax; iev++) {
+  for(Long64_t iev = slice.first; iev < slice.last; iev++) {
     tree->GetEntry(iev);
     NtpMCRecHeader rec_header = mcrec->hdr;
     EventRecord &  event      = *(mcrec->event);
@@ -1216,8 +1394,10 @@ void ConvertToGXML(void)
   } // event loop
 
   //-- add required footer
-  output << endl << endl;
-  output << "<genie_event_list version=\"1.00\">";
+  if(slice.tail) {
+    output << endl << endl;
+    output << "<genie_event_list version=\"1.00\">";
+  }
 
   output.close();
   fin.Close();
@@ -1297,10 +1477,14 @@ void ConvertToGHepMock(void)
   LOG("gntpc", pINFO) << "\nDone converting GENIE's GHEP ntuple";
 }
 //____________________________________________________________________________________
-// GENIE GHEP EVENT TREE FORMAT -> TRACKER FORMATS
+// GENIE GHEP EVENT TREE FORMAT <-> GENIE FLAT / COMPACT GHEP EVENT TREE FORMATS
 //____________________________________________________________________________________
-void ConvertToGTracker(void)
+void ConvertGHepFormats(void)
 {
+  bool to_flat = (gOptOutFileFormat == kConvFmt_gflat);
+  bool compact = (gOptOutFileFormat == kConvFmt_ghep_compact);
+  NtpMCFormat_t out_format = (to_flat) ? kNFFlat : kNFGHEP;
+
   //-- open the ROOT file and get the TTree & its header
   TFile fin(gOptInpFileName.c_str(),"READ");
   TTree *           tree = 0;
@@ -1308,11 +1492,77 @@ void ConvertToGTracker(void)
   tree = dynamic_cast <TTree *>           ( fin.Get("gtree")  );
   thdr = dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
 
+  // GHEP (full or compact) event trees convert to any of the formats,
+  // flat event trees to the GHEP ones
+  NtpMCFormat_t inp_format = (thdr) ? thdr->format : kNFUndefined;
+  bool from_flat = (inp_format == kNFFlat);
+  bool inpok = (inp_format == kNFGHEP) || (from_flat && !to_flat);
+  if(!tree || !inpok) {
+    LOG("gntpc", pFATAL)
+      << "The input file has no event tree convertible to "
+      << NtpMCFormat::AsString(out_format);
+    gAbortingInErr = true;
+    exit(1);
+  }
   LOG("gntpc", pINFO) << "Input tree header: " << *thdr;
 
-  gFileMajorVrs = utils::system::GenieMajorVrsNum(thdr->cvstag.GetString().Data());
-  gFileMinorVrs = utils::system::GenieMinorVrsNum(thdr->cvstag.GetString().Data());
-  gFileRevisVrs = utils::system::GenieRevisVrsNum(thdr->cvstag.GetString().Data());
+  //-- get mc record
+  //   (compact GHEP records are read as NtpMCEventRecords)
+  NtpMCEventRecord * mcrec = 0;
+  NtpMCFlatRecord    flatrec;
+  if(from_flat) flatrec.SetBranchAddresses(tree);
+  else          tree->SetBranchAddress("gmcrec", &mcrec);
+
+  //-- figure out how many events to analyze
+  Long64_t nmax = (gOptN<0) ?
+       tree->GetEntries() : TMath::Min(tree->GetEntries(), gOptN);
+  if (nmax<0) {
+    LOG("gntpc", pERROR) << "Number of events = 0";
+    return;
+  }
+  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+
+  //-- initialize an Ntuple Writer
+  NtpWriter ntpw(out_format, thdr->runnu);
+  ntpw.CustomizeFilename(gOptOutFileName);
+  ntpw.SetCompactGHEP(compact);
+  ntpw.Initialize();
+
+  //-- event loop
+  EventRecord event;
+  for(Long64_t iev = 0; iev < nmax; iev++) {
+    if(from_flat) {
+      flatrec.GetEntry(iev);
+      flatrec.FillEventRecord(event);
+      ntpw.AddEventRecord(flatrec.iev, &event);
+    } else {
+      tree->GetEntry(iev);
+      ntpw.AddEventRecord(mcrec->hdr.ievent, mcrec->event);
+      mcrec->Clear();
+    }
+  } // event loop
+
+  //-- save the converted MC events
+  ntpw.Save();
+
+  fin.Close();
+
+  LOG("gntpc", pINFO) << "\nDone converting GENIE's "
+    << NtpMCFormat::AsString(inp_format) << " ntuple";
+}
+//____________________________________________________________________________________
+// GENIE GHEP EVENT TREE FORMAT -> TRACKER FORMATS
+//____________________________________________________________________________________
+void ConvertToGTracker(const GNtpcSlice_t & slice)
+{
+  //-- open the ROOT file and get the TTree & its header
+  TFile fin(gOptInpFileName.c_str(),"READ");
+  TTree *           tree = 0;
+  NtpMCTreeHeader * thdr = 0;
+  tree = dynamic_cast <TTree *>           ( fin.Get("gtree")  );
+  thdr = dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
+
+  LOG("gntpc", pINFO) << "Input tree header: " << *thdr;
 
   //-- get mc record
   NtpMCEventRecord * mcrec = 0;
@@ -1330,19 +1580,14 @@ void ConvertToGTracker(void)
 #endif
 
   //-- open the output stream
-  ofstream output(gOptOutFileName.c_str(), ios::out);
+  ofstream output(slice.out.c_str(), ios::out);
 
-  //-- figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ? 
-       tree->GetEntries() : TMath::Min(tree->GetEntries(), gOptN);
-  if (nmax<0) {
-    LOG("gntpc", pERROR) << "Number of events = 0";
-    return;
-  }
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+  LOG("gntpc", pNOTICE) 
+     << "*** Analyzing: " << slice.last - slice.first << " events"
+     << " [" << slice.first << ", " << slice.last << ")";
 
   //-- event loop
-  for(Long64_t iev = 0; iev < nmax; iev++) {
+  for(Long64_t iev = slice.first; iev < slice.last; iev++) {
     tree->GetEntry(iev);
     NtpMCRecHeader rec_header = mcrec->hdr;
     EventRecord &  event      = *(mcrec->event);
@@ -1742,7 +1987,7 @@ be agreed with the SKDETSIM maintainers.
   } // event loop
 
   // add tracker end-of-file tag
-  output << "$ stop" << endl;
+  if(slice.tail) output << "$ stop" << endl;
 
   output.close();
   fin.Close();
@@ -1752,7 +1997,7 @@ be agreed with the SKDETSIM maintainers.
 //____________________________________________________________________________________
 // GENIE GHEP EVENT TREE FORMAT -> ROOTRACKER FORMATS 
 //____________________________________________________________________________________
-void ConvertToGRooTracker(void)
+void ConvertToGRooTracker(const GNtpcSlice_t & slice)
 {
   //-- define the output rootracker tree branches
 
@@ -1926,7 +2171,8 @@ void ConvertToGRooTracker(void)
   double     brNumiFluxBeampz;            // Primary proton momentum, Z - component
 
   //-- open the output ROOT file
-  TFile fout(gOptOutFileName.c_str(), "RECREATE");
+  TFile fout(slice.out.c_str(), "RECREATE");
+  utils::app_init::OutputFile(&fout);
 
   //-- create the output ROOT tree
   TTree * rootracker_tree = new TTree("gRooTracker","GENIE event tree rootracker format");
@@ -2091,6 +2337,7 @@ void ConvertToGRooTracker(void)
    rootracker_tree->Branch("NumiFluxBeampy",   &brNumiFluxBeampy,    "NumiFluxBeampy/D");
    rootracker_tree->Branch("NumiFluxBeampz",   &brNumiFluxBeampz,    "NumiFluxBeampz/D");
   }
+  utils::app_init::OutputTree(rootracker_tree);
 
   //-- open the input GENIE ROOT file and get the TTree & its header
   TFile fin(gOptInpFileName.c_str(),"READ");
@@ -2140,17 +2387,12 @@ void ConvertToGRooTracker(void)
     << "--with-flux-drivers in the configuration step.";
 #endif
 
-  //-- figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ? 
-      gtree->GetEntries() : TMath::Min(gtree->GetEntries(), gOptN);
-  if (nmax<0) {
-    LOG("gntpc", pERROR) << "Number of events = 0";
-    return;
-  }
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+  LOG("gntpc", pNOTICE) 
+     << "*** Analyzing: " << slice.last - slice.first << " events"
+     << " [" << slice.first << ", " << slice.last << ")";
 
   //-- event loop
-  for(Long64_t iev = 0; iev < nmax; iev++) {
+  for(Long64_t iev = slice.first; iev < slice.last; iev++) {
     gtree->GetEntry(iev);
 
     NtpMCRecHeader rec_header = mcrec->hdr;
@@ -2485,12 +2727,8 @@ void ConvertToGRooTracker(void)
   rootracker_tree->SetWeight(pot);
 
   // Copy MC job metadata (gconfig and genv TFolders)
-  if(gOptCopyJobMeta) {
-    TFolder * genv    = (TFolder*) fin.Get("genv");
-    TFolder * gconfig = (TFolder*) fin.Get("gconfig");    
-    fout.cd();
-    genv    -> Write("genv");
-    gconfig -> Write("gconfig");
+  if(gOptCopyJobMeta && slice.head) {
+    CopyJobMeta(fin, fout);
   }
 
   fin.Close();
@@ -2748,7 +2986,7 @@ void ConvertToGHad(void)
 //____________________________________________________________________________________
 // GENIE GHEP EVENT TREE -> Summary tree for INTRANUKE studies 
 //____________________________________________________________________________________
-void ConvertToGINuke(void)
+void ConvertToGINuke(const GNtpcSlice_t & slice)
 {
   //-- output tree branch variables
   //
@@ -2783,8 +3021,9 @@ void ConvertToGINuke(void)
   //-- open output file & create output summary tree & create the tree branches
   //
   LOG("gntpc", pNOTICE)
-       << "*** Saving summary tree to: " << gOptOutFileName;
-  TFile fout(gOptOutFileName.c_str(),"recreate");
+       << "*** Saving summary tree to: " << slice.out;
+  TFile fout(slice.out.c_str(),"recreate");
+  utils::app_init::OutputFile(&fout);
    
 TTree * tEvtTree = new TTree("ginuke","GENIE INuke Summary Tree");
   assert(tEvtTree);
@@ -2819,6 +3058,8 @@ TTree * tEvtTree = new TTree("ginuke","GENIE INuke Summary Tree");
   tEvtTree->Branch("npim",      &brNpim,         "npim/I"      );
   tEvtTree->Branch("npi0",      &brNpi0,         "npi0/I"      );
 
+  utils::app_init::OutputTree(tEvtTree);
+
   //-- open the ROOT file and get the TTree & its header
   TFile fin(gOptInpFileName.c_str(),"READ");
   TTree *           er_tree = 0;
@@ -2839,16 +3080,11 @@ TTree * tEvtTree = new TTree("ginuke","GENIE INuke Summary Tree");
     return;
   }
 
-  //-- figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ?
-       er_tree->GetEntries() : TMath::Min( er_tree->GetEntries(), gOptN );
-  if (nmax<0) {
-    LOG("gntpc", pERROR) << "Number of events = 0";
-    return;
-  }
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+  LOG("gntpc", pNOTICE) 
+     << "*** Analyzing: " << slice.last - slice.first << " events"
+     << " [" << slice.first << ", " << slice.last << ")";
 
-  for(Long64_t iev = 0; iev < nmax; iev++) {
+  for(Long64_t iev = slice.first; iev < slice.last; iev++) {
     brIEv = iev; 
     er_tree->GetEntry(iev);
     NtpMCRecHeader rec_header = mcrec->hdr;
@@ -3008,6 +3244,9 @@ void GetCommandLineArgs(int argc, char ** argv)
     else if (fmt == "nuance_tracker" )       { gOptOutFileFormat = kConvFmt_nuance_tracker;        }
     else if (fmt == "ghad")                  { gOptOutFileFormat = kConvFmt_ghad;                  }
     else if (fmt == "ginuke")                { gOptOutFileFormat = kConvFmt_ginuke;                }
+    else if (fmt == "gflat")                 { gOptOutFileFormat = kConvFmt_gflat;                 }
+    else if (fmt == "ghep")                  { gOptOutFileFormat = kConvFmt_ghep;                  }
+    else if (fmt == "ghep_compact")          { gOptOutFileFormat = kConvFmt_ghep_compact;          }
     else                                     { gOptOutFileFormat = kConvFmt_undef;                 }
 
     if(gOptOutFileFormat == kConvFmt_undef) {
@@ -3067,6 +3306,15 @@ void GetCommandLineArgs(int argc, char ** argv)
     LOG("gntpc", pINFO) << "Unspecified random number seed - Using default";
     gOptRanSeed = -1;
   }
+
+  // number of threads
+  if( parser.OptionExists("threads") ) {
+    LOG("gntpc", pINFO) << "Reading number of threads";
+    gOptNThreads = parser.ArgAsInt("threads");
+  } else {
+    LOG("gntpc", pINFO) << "Unspecified number of threads - Using default";
+    gOptNThreads = 1;
+  }
  
   LOG("gntpc", pNOTICE) << "Input filename  = " << gOptInpFileName;
   LOG("gntpc", pNOTICE) << "Output filename = " << gOptOutFileName;
@@ -3075,6 +3323,7 @@ void GetCommandLineArgs(int argc, char ** argv)
   LOG("gntpc", pNOTICE) << "Number of events to be converted = " << gOptN;
   LOG("gntpc", pNOTICE) << "Copy metadata? = " << ((gOptCopyJobMeta) ? "Yes" : "No");
   LOG("gntpc", pNOTICE) << "Random number seed = " << gOptRanSeed;
+  LOG("gntpc", pNOTICE) << "Number of threads = " << gOptNThreads;
 
   LOG("gntpc", pNOTICE) << *RunOpt::Instance();
 }
@@ -3094,6 +3343,9 @@ string DefaultOutputFile(void)
   else if (gOptOutFileFormat == kConvFmt_nuance_tracker       ) { ext = "gtrac_legacy.dat"; }
   else if (gOptOutFileFormat == kConvFmt_ghad                 ) { ext = "ghad.dat";         }
   else if (gOptOutFileFormat == kConvFmt_ginuke               ) { ext = "ginuke.root";      }
+  else if (gOptOutFileFormat == kConvFmt_gflat                ) { ext = "gflat.root";       }
+  else if (gOptOutFileFormat == kConvFmt_ghep                 ) { ext = "ghep.root";        }
+  else if (gOptOutFileFormat == kConvFmt_ghep_compact         ) { ext = "cghep.root";       }
 
   string inpname = gOptInpFileName;
   unsigned int L = inpname.length();
@@ -3104,11 +3356,21 @@ string DefaultOutputFile(void)
     inpname.erase(L-4, L);
   }
 
+  // remove cghep.
+  size_t pos = inpname.find("cghep.");
+  if(pos != string::npos) {
+    inpname.erase(pos, 6);
+  }
   // remove ghep.
-  size_t pos = inpname.find("ghep.");
+  pos = inpname.find("ghep.");
   if(pos != string::npos) {
     inpname.erase(pos, pos+4);
   }
+  // remove gflat.
+  pos = inpname.find("gflat.");
+  if(pos != string::npos) {
+    inpname.erase(pos, 6);
+  }
 
   ostringstream name;
   name << inpname << ext;
@@ -3133,6 +3395,25 @@ int LatestFormatVersionNumber(void)
   return -1;
 }
 //____________________________________________________________________________________
+void CopyJobMeta(TFile & fin, TFile & fout)
+{
+// Copies the pointer to the job metadata store file, if the input file has
+// one, or else the gconfig and genv TFolders
+
+  TObject * jobmeta = fin.Get("gjobmeta");
+  if(jobmeta) {
+    fout.cd();
+    jobmeta -> Write("gjobmeta");
+    return;
+  }
+
+  TFolder * genv    = NtpMCJobConfig::Resolve(&fin, "genv");
+  TFolder * gconfig = NtpMCJobConfig::Resolve(&fin, "gconfig");
+  fout.cd();
+  if(genv   ) genv    -> Write("genv");
+  if(gconfig) gconfig -> Write("gconfig");
+}
+//____________________________________________________________________________________
 void PrintSyntax(void)
 {
   string basedir  = string( gSystem->Getenv("GENIE") );
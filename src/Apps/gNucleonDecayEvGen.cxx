@@ -18,6 +18,7 @@
                      [-t geometry_top_volume_name]
                      [-o output_event_file_prefix]
                      [--seed random_number_seed]
+                     [--threads n_of_threads]
                      [--message-thresholds xml_file]
                      [--event-record-print-level level]
                      [--mc-job-status-refresh-rate  rate]
@@ -99,6 +100,13 @@
               This cmd line arguments lets you override 'gntp'
            --seed
               Random number seed.
+           --threads
+              Number of event generation threads, each with decay generator
+              modules & a random number generator of its own. The set-up of
+              the decay mode & targets is done once per thread, and no flux
+              or cross section is involved, so the event rate scales with
+              the number of threads.
+              [default: 1]
 
 \author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
  University of Liverpool & STFC Rutherford Appleton Laboratory
@@ -117,7 +125,12 @@
 #include <string> 
 #include <vector>
 #include <sstream>
+#include <atomic>
+#include <mutex>
+#include <thread>
 
+#include <RVersion.h>
+#include <TROOT.h>
 #include <TSystem.h> 
 
 #include "Framework/Algorithm/AlgFactory.h"
@@ -146,10 +159,35 @@ using std::ostringstream;
 
 using namespace genie;
 
+// Events generated by all threads, in order
+//
+class EventSink {
+public:
+  EventSink(int nevents, NtpWriter & ntpw, GMCJMonitor & mcjmonitor) :
+    fNEvents(nevents), fNClaimed(0), fIEvent(0),
+    fNtpWriter(ntpw), fMCJMonitor(mcjmonitor) { }
+
+  //! claim the next event to generate (false if all have been claimed)
+  bool Claim (void) { return (fNClaimed++ < fNEvents); }
+  //! add a generated event
+  void Add   (EventRecord * event);
+
+private:
+  int                   fNEvents;    ///< events to generate
+  std::atomic<int>      fNClaimed;   ///< events claimed by the threads
+  int                   fIEvent;     ///< events added
+  std::mutex            fMutex;      ///< guards the output ntuple & monitor
+  NtpWriter &           fNtpWriter;
+  GMCJMonitor &         fMCJMonitor;
+};
+
 // function prototypes
 void  GetCommandLineArgs (int argc, char ** argv);
 void  PrintSyntax        (void);
+void  InitStateMix       (void);
 int   SelectInitState    (void);
+void  GenerateEvents     (EventSink & sink);
+void  NDcyThreadMain     (int ithread, long int seed, EventSink & sink);
 const EventRecordVisitorI * NucleonDecayGenerator(void);
 
 //
@@ -172,6 +210,11 @@ double             gOptGeomLUnits = 0;                     // input geometry len
 double             gOptGeomDUnits = 0;                     // input geometry density units 
 long int           gOptRanSeed = -1;                       // random number seed
 
+// set-up of the event loop
+int                gDecayedNucleonPdg = 0;                 // decayed nucleon PDG
+vector<int>        gInitStates;                            // initial states in the target mix
+vector<double>     gInitStateCProb;                        // ... and their cumulative decay probabilities
+
 //_________________________________________________________________________________________
 int main(int argc, char ** argv)
 {
@@ -182,6 +225,15 @@ int main(int argc, char ** argv)
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
   utils::app_init::RandGen(gOptRanSeed);
 
+  int nthreads = RunOpt::Instance()->NThreads();
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,6,0)
+  if(nthreads > 1) ROOT::EnableThreadSafety();
+#endif
+
+  // Set up the event loop: the decayed nucleon and the decay probabilities
+  // of the targets in the mix
+  InitStateMix();
+
   // Initialize an Ntuple Writer to save GHEP records into a TTree
   NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
   ntpw.CustomizeFilenamePrefix(gOptEvFilePrefix);
@@ -194,54 +246,80 @@ int main(int argc, char ** argv)
   // Set GHEP print level
   GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
 
-  // Get the nucleon decay generator
-  const EventRecordVisitorI * mcgen = NucleonDecayGenerator();
+  // Start the extra generation threads, if requested
+  EventSink sink(gOptNev, ntpw, mcjmonitor);
+  vector<std::thread> threads;
+  long int seed = RandomGen::Instance()->GetSeed();
+  for(int ithread = 1; ithread < nthreads; ithread++) {
+    threads.push_back(std::thread(NDcyThreadMain, ithread, seed, std::ref(sink)));
+  }
 
   // Event loop
-  int ievent = 0;
-  int dpdg = 0;
-  if (gOptDecayedNucleon > 0) {
-    dpdg = gOptDecayedNucleon;
-  } else {
-    dpdg = utils::nucleon_decay::DecayedNucleonPdgCode(gOptDecayMode);
-  }  
+  GenerateEvents(sink);
 
-  while (1)
-  {
-     if(ievent == gOptNev) break;
+  for(unsigned int i = 0; i < threads.size(); i++) threads[i].join();
+
+  // Save the generated event tree & close the output file
+  ntpw.Save();
+
+  LOG("gevgen_ndcy", pNOTICE) << "Done!";
+
+  return 0;
+}
+//_________________________________________________________________________________________
+void GenerateEvents(EventSink & sink)
+{
+  // Get the nucleon decay generator
+  const EventRecordVisitorI * mcgen = NucleonDecayGenerator();
 
-     LOG("gevgen_ndcy", pNOTICE)
-          << " *** Generating event............ " << ievent;
+  int decay = (int)gOptDecayMode;
 
+  while(sink.Claim())
+  {
      EventRecord * event = new EventRecord;
      int target = SelectInitState();
-     int decay  = (int)gOptDecayMode;
-     Interaction * interaction = Interaction::NDecay(target,decay,dpdg);
+     Interaction * interaction = Interaction::NDecay(target,decay,gDecayedNucleonPdg);
      event->AttachSummary(interaction);
 
-     // Simulate decay     
+     // Simulate decay
      mcgen->ProcessEventRecord(event);
 
-     LOG("gevgen_ndcy", pINFO)
-         << "Generated event: " << *event;
-
      // Add event at the output ntuple, refresh the mc job monitor & clean-up
-     ntpw.AddEventRecord(ievent, event);
-     mcjmonitor.Update(ievent,event);
+     sink.Add(event);
      delete event;
-
-     ievent++;
   } // event loop
+}
+//_________________________________________________________________________________________
+void NDcyThreadMain(int ithread, long int seed, EventSink & sink)
+{
+// An extra event generation thread, with private instances of the decay
+// generator modules and a random number generator of its own
 
-  // Save the generated event tree & close the output file
-  ntpw.Save();
+  long int tseed = utils::app_init::ThreadSeed(seed, ithread);
 
-  LOG("gevgen_ndcy", pNOTICE) << "Done!";
+  LOG("gevgen_ndcy", pNOTICE)
+    << "Starting event generation thread " << ithread
+    << " (random number seed: " << tseed << ")";
 
-  return 0;
+  AlgFactory::Instance()->UseThreadPool(true);
+  RandomGen::Instance()->SetThreadSeed(tseed);
+
+  GenerateEvents(sink);
 }
 //_________________________________________________________________________________________
-int SelectInitState(void)
+void EventSink::Add(EventRecord * event)
+{
+  std::lock_guard<std::mutex> lock(fMutex);
+
+  LOG("gevgen_ndcy", pINFO)
+      << "Generated event: " << *event;
+
+  fNtpWriter.AddEventRecord(fIEvent, event);
+  fMCJMonitor.Update(fIEvent, event);
+  fIEvent++;
+}
+//_________________________________________________________________________________________
+void InitStateMix(void)
 {
   if (!utils::nucleon_decay::IsValidMode(gOptDecayMode, gOptDecayedNucleon)) {
     LOG("gevgen_ndcy", pFATAL) << "Not a valid decay mode and/or decayed nucleon...";
@@ -255,10 +333,13 @@ int SelectInitState(void)
   } else {
      dpdg = utils::nucleon_decay::DecayedNucleonPdgCode(gOptDecayMode);
   }
+  gDecayedNucleonPdg = dpdg;
 
-  map<int,double> cprob; // cumulative probability 
+  // cumulative probability
+  gInitStates.clear();
+  gInitStateCProb.clear();
   map<int,double>::const_iterator iter;
- 
+
   double sum_prob = 0;
   for(iter = gOptTgtMix.begin(); iter != gOptTgtMix.end(); ++iter) {
      int pdg_code = iter->first;
@@ -273,20 +354,22 @@ int SelectInitState(void)
      double prob = wgt*nucleon_decay_fraction;
 
      sum_prob += prob;
-     cprob.insert(map<int, double>::value_type(pdg_code, sum_prob));
+     gInitStates.push_back(pdg_code);
+     gInitStateCProb.push_back(sum_prob);
   }
 
   assert(sum_prob > 0.);
-
+}
+//_________________________________________________________________________________________
+int SelectInitState(void)
+{
   RandomGen * rnd = RandomGen::Instance();
-  double r = sum_prob * rnd->RndEvg().Rndm();
+  double r = gInitStateCProb.back() * rnd->RndEvg().Rndm();
 
-  for(iter = cprob.begin(); iter != cprob.end(); ++iter) {
-     int pdg_code = iter->first;
-     double prob  = iter->second;
-     if(r < prob) {
-       LOG("gevgen_ndcy", pNOTICE) << "Selected initial state = " << pdg_code;
-       return pdg_code;
+  for(unsigned int i = 0; i < gInitStates.size(); i++) {
+     if(r < gInitStateCProb[i]) {
+       LOG("gevgen_ndcy", pINFO) << "Selected initial state = " << gInitStates[i];
+       return gInitStates[i];
      }
   }  
 
@@ -536,7 +619,8 @@ void GetCommandLineArgs(int argc, char ** argv)
      << "\n @@ Random number seed: " << gOptRanSeed
      << "\n @@ Decay channel $ " << utils::nucleon_decay::AsString(gOptDecayMode, gOptDecayedNucleon)
      << "\n @@ Geometry      $ " << gminfo.str()
-     << "\n @@ Statistics    $ " << gOptNev << " events";
+     << "\n @@ Statistics    $ " << gOptNev << " events"
+     << "\n @@ Threads       $ " << RunOpt::Instance()->NThreads();
 
   //
   // Temporary warnings...
@@ -566,6 +650,7 @@ void PrintSyntax(void)
    << "\n              -n n_of_events "
    << "\n             [-o output_event_file_prefix]"
    << "\n             [--seed random_number_seed]"
+   << "\n             [--threads n_of_threads]"
    << "\n             [--message-thresholds xml_file]"
    << "\n             [--event-record-print-level level]"
    << "\n             [--mc-job-status-refresh-rate  rate]"
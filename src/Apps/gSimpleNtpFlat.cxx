@@ -0,0 +1,150 @@
+//____________________________________________________________________________
+/*!
+
+\program gsimple2flat
+
+\brief   GENIE utility program converting GSimpleNtpFlux ROOT flux files into
+         the flat, columnar & memory-mapped GSimpleNtpFlatFile format.
+
+         The flux driver (GSimpleNtpFlux) reads files named *.gsflat in this
+         format directly, without streaming each entry through ROOT.
+         The "aux" branch of the input files is not carried over.
+
+         Syntax :
+           gsimple2flat -f input_files -o output_file
+                        [--message-thresholds xml_file]
+
+         Options :
+           -f
+              Input GSimpleNtpFlux ROOT file(s); wildcards are allowed
+              (quote them to protect them from the shell)
+           -o
+              Name of the output flat file [ default: flux.gsflat ]
+          --message-thresholds
+              Allows users to customize the message stream thresholds.
+              The thresholds are specified using an XML file.
+              See $GENIE/config/Messenger.xml for the XML schema.
+
+         Example:
+
+           gsimple2flat -f "gsimple_numi_*.root" -o numi.gsflat
+
+           will write all entries (& meta data) of the gsimple_numi_*.root
+           files into the numi.gsflat flat file.
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <string>
+
+#include <TChain.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Tools/Flux/GSimpleNtpFlatFile.h"
+
+using std::string;
+
+using namespace genie;
+using namespace genie::flux;
+
+// Prototypes:
+void GetCommandLineArgs (int argc, char ** argv);
+void PrintSyntax        (void);
+
+// Defaults for optional options:
+string kDefOptOutFilename = "flux.gsflat"; // default output filename
+
+// User-specified options:
+string gOptInpFilenames = "";  // input GSimpleNtpFlux file(s)
+string gOptOutFilename  = "";  // output flat filename
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+
+  TChain fluxtree("flux");
+  TChain metatree("meta");
+  int nfiles = fluxtree.Add(gOptInpFilenames.c_str());
+  metatree.Add(gOptInpFilenames.c_str());
+  if ( nfiles == 0 || fluxtree.GetEntries() == 0 ) {
+    LOG("gsimple2flat", pFATAL)
+      << "No flux entries in the input file(s): " << gOptInpFilenames;
+    exit(1);
+  }
+
+  LOG("gsimple2flat", pNOTICE)
+    << "Converting " << fluxtree.GetEntries() << " entries of "
+    << nfiles << " file(s) into " << gOptOutFilename;
+
+  TTree * meta = ( metatree.GetEntries() > 0 ) ? &metatree : 0;
+  if ( ! GSimpleNtpFlatFile::Convert(&fluxtree, meta, gOptOutFilename) ) {
+    LOG("gsimple2flat", pFATAL) << "Conversion failed";
+    exit(1);
+  }
+
+  return 0;
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gsimple2flat", pINFO) << "Parsing command line arguments";
+
+  // Common run options.
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  // Parse run options for this app
+
+  CmdLnArgParser parser(argc,argv);
+
+  // input GSimpleNtpFlux file(s)
+  if( parser.OptionExists('f') ) {
+    LOG("gsimple2flat", pDEBUG) << "Reading input filename(s)";
+    gOptInpFilenames = parser.ArgAsString('f');
+  } else {
+    LOG("gsimple2flat", pFATAL) << "Unspecified input filename(s) - Exiting";
+    PrintSyntax();
+    exit(1);
+  } //-f
+
+  // output flat file name
+  if( parser.OptionExists('o') ) {
+    LOG("gsimple2flat", pDEBUG) << "Reading output filename";
+    gOptOutFilename = parser.ArgAsString('o');
+  } else {
+    LOG("gsimple2flat", pDEBUG)
+       << "Unspecified output filename - Using default";
+    gOptOutFilename = kDefOptOutFilename;
+  } // -o
+
+  LOG("gsimple2flat", pNOTICE) << "Input file(s) : " << gOptInpFilenames;
+  LOG("gsimple2flat", pNOTICE) << "Output file   : " << gOptOutFilename;
+
+  LOG("gsimple2flat", pNOTICE) << "\n";
+  LOG("gsimple2flat", pNOTICE) << *RunOpt::Instance();
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gsimple2flat", pNOTICE)
+      << "\n\n" << "Syntax:" << "\n"
+      << "   gsimple2flat"
+      << " -f input_files"
+      << " [-o output_file]"
+      << " [--message-thresholds xml_file]\n";
+}
+//____________________________________________________________________________
@@ -3,11 +3,14 @@
 
 \program gspladd
 
-\brief   Merges XML files containing GENIE cross section splines
+\brief   Merges XML files containing GENIE cross section splines, or
+         binary spline files, or updates a binary spline file in place
 
          Syntax :
            gspladd -f file_list -d directory_list -o output.xml
                    [--message-thresholds xml_file]
+           gspladd -f file_list -o output.gspl
+           gspladd -f file_list -u file.gspl
 
          Options :
            -f 
@@ -17,14 +20,35 @@
               A list of input directories where to look for xml cross section
               files. If more than one then separate using commas.
            -o 
-              output xml file
+              output xml file (a binary spline file if any input file is
+              binary)
+           -u
+              A binary spline file (see gspl2bin) to update in place with
+              the splines of the input files, which replace the ones with
+              the same tune & key (the last input file with a spline wins).
+              Only the knot blocks and index entries of the splines replaced
+              get written (see XSecSplineList::UpdateBinary()), unless the
+              input files add splines to the file, which is then rewritten.
+              Do not update a file while jobs use it.
            --message-thresholds
               Allows users to customize the message stream thresholds.
               The thresholds are specified using an XML file.
               See $GENIE/config/Messenger.xml for the XML schema.
 
          Notes :
-           There must be at least 2 files for the merges to work
+           There must be at least 2 files for the merges of XML files to work.
+           If any input file is binary, the merge streams the knots of the
+           binary files into the binary output without loading their
+           splines (see XSecSplineList::MergeBinary(); the first file with
+           a spline wins): it takes the memory of the file indices only.
+           A single binary input is simply copied, dropping the knot blocks
+           left unused by in-place updates. XML (or shard) inputs are loaded
+           and merged as a single file, in the place of the first of them.
+           The input files can also be the shard files of a distributed
+           gmkspl job (gmkspl --shard i/N): they are merged into complete
+           splines, after checking that all N shards are given once, that
+           they have the same splines and knot grids, and that no knot is
+           missing or computed twice.
 
          Examples :
 
@@ -39,6 +63,15 @@
               can be found in the /path and /other_path directories and write-out
               a single file named xsec_all.xml
 
+           3) shell% gspladd -f xsec.shard0,xsec.shard1,xsec.shard2 -o xsec.xml
+
+              will merge the 3 shards of a gmkspl job into xsec.xml
+
+           4) shell% gspladd -f xsec_fixed_channels.xml -u xsec.gspl
+
+              will replace, in xsec.gspl, the splines of the channels
+              re-computed in xsec_fixed_channels.xml
+
 \author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
          Rutherford Appleton Laboratory
 
@@ -79,6 +112,7 @@ void           PrintSyntax        (void);
 
 //User-specified options:
 string         gOutFile;   ///< output XML file
+string         gUpdFile;   ///< binary file to update in place
 vector<string> gInpFiles;  ///< list of input XML files
 vector<string> gInpDirs;   ///< list of input dirs (to look for XML files)
 vector<string> gAllFiles;  ///< list of all input files
@@ -92,14 +126,78 @@ int main(int argc, char ** argv)
   
   XSecSplineList * xspl = XSecSplineList::Instance();
 
+  bool binary = (gUpdFile.size() > 0);
+  vector<string>::const_iterator bin_iter = gAllFiles.begin();
+  for( ; bin_iter != gAllFiles.end(); ++bin_iter) {
+    binary = binary || XSecSplineList::IsBinaryFile(*bin_iter);
+  }
+  if(binary) {
+    // stream the binary files, with the XML (and shard) files loaded and
+    // saved in a binary file of their own, at the place of the first one
+    string         tmp_file = ( (gUpdFile.size() > 0) ? gUpdFile : gOutFile ) +
+                              ".xml.gspl";
+    vector<string> xml_files;
+    vector<string> bin_files;
+    vector<string>::const_iterator f_iter = gAllFiles.begin();
+    for( ; f_iter != gAllFiles.end(); ++f_iter) {
+      if(XSecSplineList::IsBinaryFile(*f_iter)) {
+        bin_files.push_back(*f_iter);
+        continue;
+      }
+      if(xml_files.size() == 0) bin_files.push_back(tmp_file);
+      xml_files.push_back(*f_iter);
+    }
+    if(xml_files.size() > 0) {
+      vector<string> shard_files;
+      for(unsigned int i = 0; i < xml_files.size(); i++) {
+        if(XSecSplineList::IsShardFile(xml_files[i])) {
+          shard_files.push_back(xml_files[i]);
+          continue;
+        }
+        LOG("gspladd", pNOTICE) << " ---- >> Loading file : " << xml_files[i];
+        XmlParserStatus_t ist = xspl->LoadFromXml(xml_files[i], true);
+        assert(ist==kXmlOK);
+      }
+      if(shard_files.size() > 0 && !xspl->LoadFromShards(shard_files)) {
+        LOG("gspladd", pFATAL) << "Inconsistent shard files - Exiting";
+        exit(1);
+      }
+      xspl->SaveAsBinary(tmp_file);
+    }
+
+    bool ok = (gUpdFile.size() > 0) ?
+       XSecSplineList::UpdateBinary(gUpdFile, bin_files) :
+       XSecSplineList::MergeBinary (bin_files, gOutFile);
+    if(xml_files.size() > 0) gSystem->Unlink(tmp_file.c_str());
+    if(!ok) {
+      LOG("gspladd", pFATAL) << "Could not write the binary spline file - Exiting";
+      exit(1);
+    }
+    return 0;
+  }
+
+  vector<string> shard_files;
   vector<string>::const_iterator file_iter = gAllFiles.begin();
   for( ; file_iter != gAllFiles.end(); ++file_iter) {
     string filename = *file_iter;
+    if(XSecSplineList::IsShardFile(filename)) {
+      shard_files.push_back(filename);
+      continue;
+    }
     LOG("gspladd", pNOTICE) << " ---- >> Loading file : " << filename;
     XmlParserStatus_t ist = xspl->LoadFromXml(filename, true);
     assert(ist==kXmlOK);
   }
 
+  if(shard_files.size() > 0) {
+    LOG("gspladd", pNOTICE)
+       << " ---- >> Merging " << shard_files.size() << " shard files";
+    if(!xspl->LoadFromShards(shard_files)) {
+      LOG("gspladd", pFATAL) << "Inconsistent shard files - Exiting";
+      exit(1);
+    }
+  }
+
   LOG("gspladd",pDEBUG) << *xspl ;
 
   LOG("gspladd", pNOTICE) 
@@ -175,17 +273,31 @@ void GetCommandLineArgs(int argc, char ** argv)
     }
   }
 
+  if( parser.OptionExists('u') ) {
+    LOG("gspladd", pINFO) << "Reading the name of the file to update";
+    gUpdFile = parser.ArgAsString('u');
+  }
+
   if( parser.OptionExists('o') ) {
     LOG("gspladd", pINFO) << "Reading output file name";
     gOutFile = parser.ArgAsString('o');
-  } else {
+  } else if( gUpdFile.size() == 0 ) {
     LOG("gspladd", pFATAL) << "You must specify an output file name";
     PrintSyntax();
     exit(1);
   }
+  if( gUpdFile.size() > 0 && gOutFile.size() > 0 ) {
+    LOG("gspladd", pFATAL) << "Either update a file (-u) or write one (-o)";
+    PrintSyntax();
+    exit(1);
+  }
 
   gAllFiles = GetAllInputFiles();
-  if(gAllFiles.size() <= 1) {
+
+  // a single binary file is enough to update a file or to compact one
+  bool binary = (gUpdFile.size() > 0) ||
+     (gAllFiles.size() == 1 && XSecSplineList::IsBinaryFile(gAllFiles[0]));
+  if(gAllFiles.size() == 0 || (gAllFiles.size() == 1 && !binary)) {
     LOG("gspladd", pFATAL) << "There must be at least 2 input files";
     PrintSyntax();
     exit(1);
@@ -197,7 +309,9 @@ void PrintSyntax(void)
   LOG("gspladd", pNOTICE)
     << "\n\n" << "Syntax:" << "\n"
     << "   gspladd  -f file_list -d directory_list  -o output.xml\n"
-    << "            [--message-thresholds xml_file]\n";
+    << "            [--message-thresholds xml_file]\n"
+    << "   gspladd  -f file_list  -o output.gspl\n"
+    << "   gspladd  -f file_list  -u file.gspl\n";
 
 }
 //____________________________________________________________________________
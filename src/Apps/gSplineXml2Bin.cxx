@@ -0,0 +1,135 @@
+//____________________________________________________________________________
+/*!
+
+\program gspl2bin
+
+\brief   Converts XML files containing GENIE cross section splines into the
+         binary (memory-mapped) spline file format, or back into XML.
+
+         The binary files are read by XSecSplineList::LoadFromBinary() and
+         can be given to any GENIE application in place of the XML file
+         (eg gevgen --cross-sections xsec.gspl).
+
+         Syntax :
+           gspl2bin -f input_file -o output_file [--to-xml]
+                    [--message-thresholds xml_file]
+
+         Options :
+           -f
+              Input cross-section file (XML, or binary if --to-xml is set).
+           -o
+              Output cross-section file.
+           --to-xml
+              Convert a binary spline file back into XML.
+           --message-thresholds
+              Allows users to customize the message stream thresholds.
+              The thresholds are specified using an XML file.
+              See $GENIE/config/Messenger.xml for the XML schema.
+
+         Examples :
+
+           1) shell% gspl2bin -f xsec.xml -o xsec.gspl
+
+              will convert the splines of xsec.xml (all tunes) into the
+              binary file xsec.gspl
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <string>
+
+#include "Framework/Conventions/XmlParserStatus.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/XSecSplineList.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+
+using std::string;
+
+using namespace genie;
+
+void GetCommandLineArgs (int argc, char ** argv);
+void PrintSyntax        (void);
+
+//User-specified options:
+string gInpFile;          ///< input spline file
+string gOutFile;          ///< output spline file
+bool   gToXml = false;    ///< convert binary -> XML (default: XML -> binary)
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+
+  XSecSplineList * xspl = XSecSplineList::Instance();
+
+  XmlParserStatus_t ist = (gToXml) ?
+      xspl->LoadFromBinary(gInpFile) : xspl->LoadFromXml(gInpFile);
+  if(ist != kXmlOK) {
+    LOG("gspl2bin", pFATAL)
+      << "Problem reading file: " << gInpFile
+      << " [" << XmlParserStatus::AsString(ist) << "]";
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  LOG("gspl2bin", pNOTICE)
+     << " ****** Saving " << xspl->NSplines() << " splines into : " << gOutFile;
+  if(gToXml) xspl->SaveAsXml   (gOutFile);
+  else       xspl->SaveAsBinary(gOutFile);
+
+  return 0;
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gspl2bin", pNOTICE) << "Parsing command line arguments";
+
+  // Common run options.
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  // Parse run options for this app
+
+  CmdLnArgParser parser(argc,argv);
+
+  if( parser.OptionExists('f') ) {
+    LOG("gspl2bin", pINFO) << "Reading input file name";
+    gInpFile = parser.ArgAsString('f');
+  } else {
+    LOG("gspl2bin", pFATAL) << "You must specify an input file name";
+    PrintSyntax();
+    exit(1);
+  }
+
+  if( parser.OptionExists('o') ) {
+    LOG("gspl2bin", pINFO) << "Reading output file name";
+    gOutFile = parser.ArgAsString('o');
+  } else {
+    LOG("gspl2bin", pFATAL) << "You must specify an output file name";
+    PrintSyntax();
+    exit(1);
+  }
+
+  gToXml = parser.OptionExists("to-xml");
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gspl2bin", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gspl2bin  -f input_file  -o output_file  [--to-xml]\n"
+    << "             [--message-thresholds xml_file]\n";
+}
+//____________________________________________________________________________
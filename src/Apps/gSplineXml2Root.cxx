@@ -664,8 +664,9 @@ void SaveGraphsToRootFile(void)
     }
 
     const Spline * spl = evg_driver.XSecSpline(interaction);
+    spl->Evaluate(e, xs, kNSplineP);
     for(int i=0; i<kNSplineP; i++) {
-      xs[i] = spl->Evaluate(e[i]) * (1E+38/units::cm2);
+      xs[i] *= (1E+38/units::cm2);
     }
 
     TGraph * gr = new TGraph(kNSplineP, e, xs);
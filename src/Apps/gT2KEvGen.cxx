@@ -24,6 +24,7 @@
                       [-t top_volume_name_at_geom || -t +Vol1-Vol2...]
                       [-P pre_gen_prob_file_name]
                       [-S] [output_name]
+                      [--flux-prob-shard ishard/nshards]
                       [-m max_path_lengths_xml_file]
                       [-L length_units_at_geom]
                       [-D density_units_at_geom]
@@ -32,6 +33,7 @@
                       [-e, -E exposure_in_POTs]
                       [-o output_event_file_prefix]
                       [-R]
+                      [--shard ishard/nshards]
                       [--seed random_number_seed]
                        --cross-sections xml_file
                       [--tune genie_tune]
@@ -40,6 +42,7 @@
                       [--event-record-print-level level]
                       [--mc-job-status-refresh-rate  rate]
                       [--cache-file root_file]
+                      [--force-interactions]
 
          *** Options :
 
@@ -104,6 +107,9 @@
               as the time to pre-calculate the interaction probabilities becomes
               comparable to the event generation time. For smaller flux files there is
               less book-keeping if you just calculate them per job and on the fly.
+              A comma separated list of files (eg. the ones of all the shards
+              pre-generated with the --flux-prob-shard option) can be input:
+              they are merged at loading.
            -S [output_name]
               Pre-generate flux interaction probabilities and save to root
               output file for use with future event generation jobs. With this
@@ -117,9 +123,18 @@
               -P option. The default output interaction probabilities file
               name is constructed as: [FLUXFILENAME].[TOPVOL].flxprobs.root.
               Specifying [output_name] will override this.
+              An [output_name] ending in .gflxprob selects a compact binary
+              format, which is mapped into memory (rather than read) by the
+              event generation jobs: they then start at once, whatever the
+              number of flux entries.
               Introducing multiple functionality to the executable is not
               desirable but is less error prone than duplicating a lot of the
               functionality in a separate application.
+           --flux-prob-shard
+              Used with -S: pre-generate the interaction probabilities of the
+              flux entries with (index % nshards == ishard) only, so that the
+              pre-generation of large flux files can be split over nshards
+              jobs. The files of all shards are merged by the -P option.
            -m
               An XML file (generated by gmxpl) with the max (density weighted)
               path-lengths for each target material in the input ROOT geometry.
@@ -295,6 +310,25 @@
               Tell the flux driver to start looping over the flux ntuples with a
               random offset. May be necessary to avoid biases introduced by always
               starting at the same point when using very large flux input files.
+           --shard
+              Deterministic sharded production: the job is shard `ishard'
+              (0, 1, ..., nshards-1) of a production split into nshards
+              jobs, eg. '--shard 17/10000'. The shards use disjoint parts
+              of the JNUBEAM flux: consecutive blocks of the files of a file
+              series (-f /path/flux.@0@999,...) if there are at least
+              nshards files, consecutive blocks of the entries at the
+              detector location otherwise, each cycled over on its own (see
+              GJPARCNuFlux::SetShard()). The POT normalization (-p) is the
+              one of all the input files, as without --shard. Each shard
+              generates its share of the requested events (-n) or POT (-e,
+              -E), with a seed derived from the job seed and the shard
+              number (see utils::app_init::ShardSeed()), and `_s<ishard>' is
+              appended to the output file prefix (eg gntp_s17.1000.ghep.root).
+              Each output file holds the exposure of its sample in a
+              `gexposure' TFolder (shard, seed, POT, flux neutrinos, events),
+              so that the POT of the merged sample is the sum over the
+              shards. Use the same options for all the shards of a
+              production.
            --seed
               Random number seed.
            --cross-sections
@@ -319,6 +353,14 @@
            --cache-file
               Allows users to specify a cache file so that the cache can be
               re-used in subsequent MC jobs.
+           --force-interactions
+              Every flux neutrino crossing the geometry interacts, with a
+              vertex chosen along its path in proportion to the path length x
+              cross section of each material, and each event is weighted by
+              the interaction probability of its neutrino. The POT of the
+              sample is then the POT of the flux neutrinos read-in (there is
+              no interaction probability scale) and the event weights must be
+              used. The mode is recorded in the output tree header.
 
          *** Examples:
 
@@ -504,7 +546,11 @@ bool            gOptUseFluxProbs = false;      // use pre-calculated flux intera
 bool            gOptSaveFluxProbsFile = false; // special mode: no events generated, calculate and save flux interaction probs to root file
 string          gOptFluxProbFileName;          // filename for file containg flux probs
 string          gOptSaveFluxProbsFileName;     // output filename for pre-generated flux probabilities
+unsigned int    gOptFluxProbShard  = 0;        // shard of the flux entries to pre-generate probabilities for...
+unsigned int    gOptFluxProbNShards = 1;       // ...out of so many shards
 bool            gOptRandomFluxOffset = false;  // start looping over flux file from random start entry
+int             gOptShard = -1;                // shard of a sharded production (-1: not sharded)...
+int             gOptNShards = 1;               // ...out of so many shards
 long int        gOptRanSeed;                   // random number seed
 string          gOptInpXSecFile;               // cross-section splines
 
@@ -525,6 +571,7 @@ int main(int argc, char ** argv)
   // messenger thresholds, cache file
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
   utils::app_init::CacheFile(RunOpt::Instance()->CacheFile());
+  utils::app_init::MaxXSecTable(RunOpt::Instance()->MaxXSecTableFile());
   utils::app_init::RandGen(gOptRanSeed);
   utils::app_init::XSecTable(gOptInpXSecFile, true);
 
@@ -602,6 +649,8 @@ int main(int argc, char ** argv)
     jparc_flux_driver = new flux::GJPARCNuFlux;
     // before loading the beam sim data set whether to use a random offset when looping
     if(gOptRandomFluxOffset == false) jparc_flux_driver->DisableOffset();
+    // ... and which part of the flux to use, for a sharded production
+    if(gOptShard >= 0) jparc_flux_driver->SetShard(gOptShard, gOptNShards);
     // specify input JNUBEAM file & detector location
     bool beam_sim_data_success = jparc_flux_driver->LoadBeamSimData(gOptFluxFile, gOptDetectorLocation);
     if(!beam_sim_data_success) {
@@ -680,6 +729,9 @@ int main(int argc, char ** argv)
       if(gOptSaveFluxProbsFileName.size()>0) name = gOptSaveFluxProbsFileName;
       // Tell the driver save pre-generated probabilities to an output file
       mcj_driver->SaveFluxProbabilities(name);
+      if(gOptFluxProbNShards > 1) {
+        mcj_driver->SetFluxProbabilityShard(gOptFluxProbShard, gOptFluxProbNShards);
+      }
     }
 
     // Either load pre-generated flux probabilities
@@ -773,7 +825,8 @@ int main(int argc, char ** argv)
 
   // Initialize an Ntuple Writer to save GHEP records into a TTree
   NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
-  ntpw.CustomizeFilenamePrefix(gOptEvFilePrefix);
+  ntpw.CustomizeFilenamePrefix(
+     utils::app_init::ShardFilename(gOptEvFilePrefix, gOptShard));
   ntpw.Initialize();
 
   // Add a custom-branch at the standard GENIE event tree so that
@@ -789,6 +842,8 @@ int main(int argc, char ** argv)
   // Create a MC job monitor for a periodically updated status file
   GMCJMonitor mcjmonitor(gOptRunNu);
   mcjmonitor.SetRefreshRate(RunOpt::Instance()->MCJobStatusRefreshRate());
+  mcjmonitor.CustomizeFilename(
+     utils::app_init::ShardFilename(mcjmonitor.Filename(), gOptShard));
 
   // *************************************************************************
   // * Event generation loop
@@ -863,6 +918,8 @@ int main(int argc, char ** argv)
   // * Print job statistics &
   // * calculate normalization factor for the generated sample
   // *************************************************************************
+  double   exposure = 0;
+  long int nflux    = mcj_driver->NFluxNeutrinos();
   if(!gOptUsingHistFlux && gOptUsingRootGeom)
   {
     // POT normalization will only be calculated if event generation was based
@@ -889,8 +946,18 @@ int main(int argc, char ** argv)
             << " POT * " << ((gOptDetectorLocation == "sk") ? "cm^2" : "det");
 
     ntpw.EventTree()->SetWeight(pot); // POT
+
+    exposure = pot;
+    nflux    = nflx;
   }
 
+  // save the exposure of the generated sample, to be summed over the
+  // shards of a production
+  utils::app_init::SaveExposure(ntpw.EventTree(), gOptShard, gOptNShards,
+     RandomGen::Instance()->GetSeed(), exposure,
+     (gOptDetectorLocation == "sk") ? "POT * cm^2" : "POT * det",
+     nflux, ievent);
+
   // *************************************************************************
   // * MC job meta-data
   // *************************************************************************
@@ -1212,13 +1279,16 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptFluxProbFileName = parser.ArgAsString('P');
     if(gOptFluxProbFileName.length() > 0){
       gOptUseFluxProbs = true;
-      bool accessible =
-              !(gSystem->AccessPathName(gOptFluxProbFileName.c_str()));
-      if(!accessible){
-        LOG("gevgen_t2k", pFATAL)
-          << "Can not access pre-calculated flux probabilities file: " << gOptFluxProbFileName;
-        PrintSyntax();
-        exit(1);
+      vector<string> probfiles = utils::str::Split(gOptFluxProbFileName,",");
+      for(unsigned int ifile = 0; ifile < probfiles.size(); ifile++) {
+        bool accessible =
+              !(gSystem->AccessPathName(probfiles[ifile].c_str()));
+        if(!accessible){
+          LOG("gevgen_t2k", pFATAL)
+            << "Can not access pre-calculated flux probabilities file: " << probfiles[ifile];
+          PrintSyntax();
+          exit(1);
+        }
       }
     }
     else {
@@ -1235,6 +1305,25 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptSaveFluxProbsFileName = parser.ArgAsString('S');
   }
 
+  // pre-generating the interaction probs of a single shard of the flux entries
+  if( parser.OptionExists("flux-prob-shard") ){
+    vector<string> shard =
+       utils::str::Split(parser.ArgAsString("flux-prob-shard"),"/");
+    bool valid = (shard.size() == 2);
+    if(valid) {
+      gOptFluxProbShard   = atoi(shard[0].c_str());
+      gOptFluxProbNShards = atoi(shard[1].c_str());
+      valid = gOptFluxProbNShards > 0 && gOptFluxProbShard < gOptFluxProbNShards;
+    }
+    if(!valid || !gOptSaveFluxProbsFile) {
+      LOG("gevgen_t2k", pFATAL)
+       << "The --flux-prob-shard option expects ishard/nshards "
+       << "(with 0 <= ishard < nshards) and the -S option";
+      PrintSyntax();
+      exit(1);
+    }
+  }
+
   // cannot save and run at the same time
   if(gOptUseFluxProbs && gOptSaveFluxProbsFile){
     LOG("gevgen_t2k", pFATAL)
@@ -1319,6 +1408,29 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptRanSeed = -1;
   }
 
+  // shard of a sharded production: a part of the flux, a share of the
+  // exposure & a seed of its own
+  if( parser.OptionExists("shard") ) {
+    LOG("gevgen_t2k", pINFO) << "Reading the production shard";
+    bool valid = utils::app_init::ShardOption(
+       parser.ArgAsString("shard"), gOptShard, gOptNShards);
+    if(!valid) {
+      LOG("gevgen_t2k", pFATAL)
+        << "The --shard option expects ishard/nshards "
+        << "with 0 <= ishard < nshards";
+      PrintSyntax();
+      exit(1);
+    }
+    gOptRanSeed = utils::app_init::ShardSeed(gOptRanSeed, gOptShard);
+    if(gOptNev > 0) {
+      gOptNev = utils::app_init::WorkerShare(
+         (long int) gOptNev, gOptShard, gOptNShards);
+    }
+    if(gOptPOT > 0) {
+      gOptPOT = utils::app_init::WorkerShare(gOptPOT, gOptShard, gOptNShards);
+    }
+  }
+
   // input cross-section file
   if( parser.OptionExists("cross-sections") ) {
     LOG("gevgen_t2k", pINFO) << "Reading cross-section file";
@@ -1452,6 +1564,7 @@ void GetCommandLineArgs(int argc, char ** argv)
   LOG("gevgen_t2k", pNOTICE)
      << "\n -  Run number: " << gOptRunNu
      << "\n -  Random number seed: " << gOptRanSeed
+     << "\n -  Production shard: " << gOptShard << " of " << gOptNShards
      << "\n - Using cross-section file: " << gOptInpXSecFile
      << "\n - Flux     @ " << fluxinfo.str()
      << "\n - Geometry @ " << gminfo.str()
@@ -1472,6 +1585,7 @@ void PrintSyntax(void)
    << "\n           [-t top_volume_name_at_geom]"
    << "\n           [-P pre_gen_prob_file]"
    << "\n           [-S] [output_name]"
+   << "\n           [--flux-prob-shard ishard/nshards]"
    << "\n           [-m max_path_lengths_xml_file]"
    << "\n           [-L length_units_at_geom]"
    << "\n           [-D density_units_at_geom]"
@@ -1480,6 +1594,7 @@ void PrintSyntax(void)
    << "\n           [-e, -E exposure_in_POTs]"
    << "\n           [-o output_event_file_prefix]"
    << "\n           [-R]"
+   << "\n           [--shard ishard/nshards]"
    << "\n           [--seed random_number_seed]"
    << "\n            --cross-sections xml_file"
    << "\n           [--event-generator-list list_name]"
@@ -1488,6 +1603,7 @@ void PrintSyntax(void)
    << "\n           [--event-record-print-level level]"
    << "\n           [--mc-job-status-refresh-rate  rate]"
    << "\n           [--cache-file root_file]"
+   << "\n           [--force-interactions]"
    << "\n"
    << " Please also read the detailed documentation at http://www.genie-mc.org"
    << " or look at the source code: $GENIE/src/Apps/gT2KEvGen.cxx"
@@ -10,8 +10,13 @@
 
 #include <iomanip>
 #include <iostream>
+#include <fstream>
 #include <sstream>
 #include <cstdlib>
+#include <cstring>
+#include <set>
+#include <algorithm>
+#include <stdint.h>
 
 #include "libxml/xmlmemory.h"
 #include "libxml/parser.h"
@@ -26,6 +31,8 @@
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Registry/RegistryItemTypeDef.h"
 #include "Framework/Utils/XmlParserUtils.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/StartupProfile.h"
 
 #include "Framework/Utils/StringUtils.h"
 
@@ -36,6 +43,94 @@ using std::ostringstream;
 
 using namespace genie;
 
+//____________________________________________________________________________
+// Binary configuration snapshot layout (native byte order), in this order:
+//   header
+//   string lengths : nstrings uint32_t
+//   strings        : all the strings (not null-terminated), in one block
+//   XML files      : nfiles SnapFile entries
+//   keys           : nkeys SnapKey entries (config keys, in loading order)
+//   parameters     : nparams SnapParam entries (those of each key in turn)
+// All names and values are indices in the string table, so that the many
+// repeated strings (types, parameter names, ...) are stored only once.
+namespace {
+
+  const char     kSnapMagic[8] = { 'G','E','N','I','E','C','F','G' };
+  const uint32_t kSnapByteOrder = 0x01020304;
+  const uint32_t kSnapVersion   = 1;
+
+  struct SnapHeader {
+    char     magic[8];
+    uint32_t byte_order;
+    uint32_t version;
+    uint32_t tune;         // tune name
+    uint32_t nstrings;
+    uint32_t nfiles;
+    uint32_t nkeys;
+    uint64_t nparams;
+    uint64_t strings_size;
+    uint64_t file_size;
+  };
+
+  struct SnapFile {
+    uint32_t name;         // as resolved in the XML path
+    uint32_t reserved;
+    uint64_t checksum;     // of the file contents (0: file not found)
+  };
+
+  struct SnapKey {
+    uint32_t key;
+    uint32_t nparams;
+  };
+
+  struct SnapParam {
+    uint32_t type;
+    uint32_t name;
+    uint32_t value;
+    uint32_t delim;
+  };
+
+  // FNV-1a hash of the file contents, 0 if the file can not be read
+  uint64_t FileChecksum(const string & filename)
+  {
+    std::ifstream file(filename.c_str(), std::ios::binary);
+    if(!file) return 0;
+    uint64_t sum = 14695981039346656037ULL;
+    char buffer[65536];
+    while(file) {
+      file.read(buffer, sizeof(buffer));
+      std::streamsize n = file.gcount();
+      for(std::streamsize i = 0; i < n; i++) {
+        sum ^= (unsigned char) buffer[i];
+        sum *= 1099511628211ULL;
+      }
+    }
+    return (sum == 0) ? 1 : sum;
+  }
+
+  // the table of the distinct strings in a snapshot
+  class SnapStrings {
+  public:
+    uint32_t Id(const string & s) {
+      map<string, uint32_t>::const_iterator it = fIds.find(s);
+      if(it != fIds.end()) return it->second;
+      uint32_t id = fStrings.size();
+      fIds.insert(map<string, uint32_t>::value_type(s, id));
+      fStrings.push_back(s);
+      return id;
+    }
+    const vector<string> & Strings(void) const { return fStrings; }
+  private:
+    map<string, uint32_t> fIds;
+    vector<string>        fStrings;
+  };
+
+  string CurrentTuneName(void)
+  {
+    TuneId * tune = RunOpt::Instance()->Tune();
+    return (tune) ? tune->Name() : "";
+  }
+}
 //____________________________________________________________________________
 namespace genie {
   ostream & operator<<(ostream & stream, const AlgConfigPool & config_pool)
@@ -95,6 +190,16 @@ bool AlgConfigPool::LoadAlgConfig(void)
 // Loads all algorithm XML configurations and creates a map with all loaded
 // configuration registries
 
+  StartupProfile::Scope phase("AlgConfigPool::LoadAlgConfig");
+
+  //-- use the configuration snapshot instead, if there is a valid one
+  string snapshot = RunOpt::Instance()->ConfigSnapshotFile();
+  if(snapshot.size() > 0) {
+    if(this->LoadSnapshot(snapshot)) return true;
+    SLOG("AlgConfigPool", pWARN)
+        << "Can not use configuration snapshot: " << snapshot;
+  }
+
   SLOG("AlgConfigPool", pINFO)
         << "AlgConfigPool late initialization: Loading all XML config. files";
 
@@ -123,7 +228,7 @@ bool AlgConfigPool::LoadAlgConfig(void)
     SLOG("AlgConfigPool", pINFO)
          << setfill('.') << setw(40) << alg_name << " -> " << file_name;
 
-    string full_path = utils::xml::GetXMLFilePath(file_name);
+    string full_path = this->XmlFilePath(file_name);
     SLOG("AlgConfigPool", pNOTICE)
       << "*** GENIE XML config file " << full_path;
     bool ok = this->LoadSingleAlgConfig(alg_name, full_path);
@@ -141,7 +246,7 @@ bool AlgConfigPool::LoadMasterConfig(void)
 // file to load for each algorithm
 
   //-- get the master config XML file using GXMLPATH + default locations
-  fMasterConfig = utils::xml::GetXMLFilePath("master_config.xml");
+  fMasterConfig = this->XmlFilePath("master_config.xml");
 
   bool is_accessible = ! (gSystem->AccessPathName( fMasterConfig.c_str() ));
   if (!is_accessible) {
@@ -202,7 +307,7 @@ bool AlgConfigPool::LoadGlobalParamLists(void)
   SLOG("AlgConfigPool", pINFO) << "Loading global parameter lists";
 
   // -- get the user config XML file using GXMLPATH + default locations
-  string glob_params = utils::xml::GetXMLFilePath("ModelConfiguration.xml");
+  string glob_params = this->XmlFilePath("ModelConfiguration.xml");
 
   // fixed key prefix
   string key_prefix = "GlobalParameterList";
@@ -219,7 +324,7 @@ bool AlgConfigPool::LoadCommonLists( const string & file_id )
 
   // -- get the user config XML file using GXMLPATH + default locations
   std::string xml_name = "Common" + file_id + ".xml" ;
-  string full_path = utils::xml::GetXMLFilePath( xml_name );
+  string full_path = this->XmlFilePath( xml_name );
 
   // fixed key prefix
   string key_prefix = "Common" + file_id + "List";
@@ -241,7 +346,7 @@ bool AlgConfigPool::LoadTuneGeneratorList(void)
   SLOG("AlgConfigPool", pINFO) << "Loading Tune Gerator List";
 
   // -- get the user config XML file using GXMLPATH + default locations
-  string generator_list_file = utils::xml::GetXMLFilePath("TuneGeneratorList.xml");
+  string generator_list_file = this->XmlFilePath("TuneGeneratorList.xml");
 
   // fixed key prefix
   string key_prefix = "TuneGeneratorList";
@@ -315,6 +420,7 @@ bool AlgConfigPool::LoadRegistries(
 
       // store the key in the key list
       fConfigKeyList.push_back(key.str());
+      fXmlParams.push_back(vector<XmlParam>());
 
       // create a new Registry and fill it with the configuration params
       Registry * config = new Registry(param_set,false);
@@ -323,29 +429,24 @@ bool AlgConfigPool::LoadRegistries(
       while (xml_param != NULL) {
         if( (!xmlStrcmp(xml_param->name, (const xmlChar *) "param")) ) {
 
-            string param_type =
+            XmlParam param;
+            param.type =
                    utils::str::TrimSpaces(
                        utils::xml::GetAttribute(xml_param, "type"));
-            string param_name =
+            param.name =
                    utils::str::TrimSpaces(
                        utils::xml::GetAttribute(xml_param, "name"));
-            string param_value =
+            param.value =
                     utils::xml::TrimSpaces(
                                xmlNodeListGetString(
                                  xml_doc, xml_param->xmlChildrenNode, 1));
+            if ( param.type.find( "vec-" ) == 0 ) {
+              param.delim = utils::str::TrimSpaces(
+                       utils::xml::GetAttribute(xml_param, "delim"));
+            }
 
-
-	    if ( param_type.find( "vec-" ) == 0 ) {
-
-	      param_type = param_type.substr( 4 ) ;
-
-	      string delim = utils::str::TrimSpaces( utils::xml::GetAttribute(xml_param, "delim"));
-
-	      this -> AddParameterVector( config, param_type, param_name, param_value, delim ) ;
-	    }
-	    else this->AddConfigParameter( config,
-					   param_type, param_name,
-					   param_value);
+            this->AddXmlParameter(config, param);
+            fXmlParams.back().push_back(param);
         }
         xml_param = xml_param->next;
       }
@@ -369,6 +470,27 @@ bool AlgConfigPool::LoadRegistries(
   return true;
 }
 //____________________________________________________________________________
+string AlgConfigPool::XmlFilePath(string basename)
+{
+// Resolves an XML file name in the XML path, keeping a record of it so that
+// snapshots can be checked against the XML files they were made from
+
+  fXmlFiles.push_back(basename);
+  return utils::xml::GetXMLFilePath(basename);
+}
+//____________________________________________________________________________
+void AlgConfigPool::AddXmlParameter(Registry * r, const XmlParam & param)
+{
+// Adds a configuration parameter (or parameter vector for 'vec-' types) as
+// read from an XML file
+
+  if ( param.type.find( "vec-" ) == 0 ) {
+    this -> AddParameterVector( r, param.type.substr( 4 ),
+                                param.name, param.value, param.delim ) ;
+  }
+  else this->AddConfigParameter( r, param.type, param.name, param.value );
+}
+//____________________________________________________________________________
 int  AlgConfigPool::AddParameterVector  (Registry * r, string pt, string pn, string pv,
 					 const string & delim ) {
 
@@ -614,6 +736,282 @@ const vector<string> & AlgConfigPool::ConfigKeyList(void) const
   return fConfigKeyList;
 }
 //____________________________________________________________________________
+void AlgConfigPool::LoadAllCommonLists(void)
+{
+// Loads the common lists referred to ("Common<file_id>" parameters, see
+// Algorithm::Configure) by any loaded configuration, and the tunable
+// parameters, which are otherwise only loaded when first looked up
+
+  std::set<string> file_ids;
+  file_ids.insert("Param");
+
+  const string common_key_root = "Common";
+  for(unsigned int ik = 0; ik < fXmlParams.size(); ik++) {
+    const vector<XmlParam> & params = fXmlParams[ik];
+    for(unsigned int ip = 0; ip < params.size(); ip++) {
+      const string & name = params[ip].name;
+      if(name.find(common_key_root) == 0 &&
+         name.size() > common_key_root.size()) {
+        file_ids.insert(name.substr(common_key_root.size()));
+      }
+    }
+  }
+
+  std::set<string>::const_iterator it = file_ids.begin();
+  for( ; it != file_ids.end(); ++it) {
+    string xml_name = common_key_root + *it + ".xml";
+    bool loaded = std::find(fXmlFiles.begin(), fXmlFiles.end(), xml_name)
+                  != fXmlFiles.end();
+    if(!loaded) this->LoadCommonLists(*it);
+  }
+}
+//____________________________________________________________________________
+bool AlgConfigPool::SaveSnapshot(string filename)
+{
+// Saves the configuration into a binary snapshot, with the checksums of all
+// the XML files it was read from. The file is written in the native byte
+// order.
+
+  this->LoadAllCommonLists();
+
+  SLOG("AlgConfigPool", pNOTICE)
+    << "Saving configuration snapshot (" << fConfigKeyList.size()
+    << " configuration sets) in: " << filename;
+
+  SnapStrings strings;
+
+  SnapHeader header;
+  memset(&header, 0, sizeof(SnapHeader));
+  memcpy(header.magic, kSnapMagic, sizeof(kSnapMagic));
+  header.byte_order = kSnapByteOrder;
+  header.version    = kSnapVersion;
+  header.tune       = strings.Id(CurrentTuneName());
+
+  vector<SnapFile> files(fXmlFiles.size());
+  for(unsigned int i = 0; i < fXmlFiles.size(); i++) {
+    memset(&files[i], 0, sizeof(SnapFile));
+    files[i].name     = strings.Id(fXmlFiles[i]);
+    files[i].checksum =
+       FileChecksum(utils::xml::GetXMLFilePath(fXmlFiles[i]));
+  }
+
+  vector<SnapKey>   keys(fConfigKeyList.size());
+  vector<SnapParam> params;
+  for(unsigned int ik = 0; ik < fConfigKeyList.size(); ik++) {
+    keys[ik].key     = strings.Id(fConfigKeyList[ik]);
+    keys[ik].nparams = fXmlParams[ik].size();
+    for(unsigned int ip = 0; ip < fXmlParams[ik].size(); ip++) {
+      const XmlParam & p = fXmlParams[ik][ip];
+      SnapParam sp;
+      sp.type  = strings.Id(p.type);
+      sp.name  = strings.Id(p.name);
+      sp.value = strings.Id(p.value);
+      sp.delim = strings.Id(p.delim);
+      params.push_back(sp);
+    }
+  }
+
+  const vector<string> & table = strings.Strings();
+  vector<uint32_t> lengths(table.size());
+  string block = "";
+  for(unsigned int i = 0; i < table.size(); i++) {
+    lengths[i] = table[i].size();
+    block += table[i];
+  }
+
+  header.nstrings     = table.size();
+  header.nfiles       = files.size();
+  header.nkeys        = keys.size();
+  header.nparams      = params.size();
+  header.strings_size = block.size();
+  header.file_size    = sizeof(SnapHeader) +
+                        lengths.size() * (uint64_t) sizeof(uint32_t) +
+                        block.size() +
+                        files.size()   * (uint64_t) sizeof(SnapFile) +
+                        keys.size()    * (uint64_t) sizeof(SnapKey) +
+                        params.size()  * (uint64_t) sizeof(SnapParam);
+
+  std::ofstream out(filename.c_str(), std::ios::binary | std::ios::trunc);
+  out.write((const char *) &header, sizeof(SnapHeader));
+  if(lengths.size() > 0)
+    out.write((const char *) &lengths[0], lengths.size() * sizeof(uint32_t));
+  out.write(block.data(), block.size());
+  if(files.size() > 0)
+    out.write((const char *) &files[0],  files.size()  * sizeof(SnapFile));
+  if(keys.size() > 0)
+    out.write((const char *) &keys[0],   keys.size()   * sizeof(SnapKey));
+  if(params.size() > 0)
+    out.write((const char *) &params[0], params.size() * sizeof(SnapParam));
+  out.close();
+
+  if(!out) {
+    SLOG("AlgConfigPool", pERROR)
+      << "Could not write configuration snapshot: " << filename;
+    return false;
+  }
+  return true;
+}
+//____________________________________________________________________________
+bool AlgConfigPool::LoadSnapshot(string filename)
+{
+// Builds the configuration registries from a binary snapshot written by
+// SaveSnapshot(). Fails (without loading anything) if the snapshot is not
+// valid or was made for a different tune, or if any of the XML files it was
+// made from changed since.
+
+  SLOG("AlgConfigPool", pNOTICE)
+    << "Loading configuration snapshot: " << filename;
+
+  std::ifstream in(filename.c_str(), std::ios::binary);
+  if(!in) {
+    SLOG("AlgConfigPool", pERROR)
+      << "The configuration snapshot doesn't exist! (filename : "
+      << filename << ")";
+    return false;
+  }
+  vector<char> buffer;
+  in.seekg(0, std::ios::end);
+  std::streamoff size = in.tellg();
+  in.seekg(0, std::ios::beg);
+  if(size > 0) {
+    buffer.resize(size);
+    in.read(&buffer[0], size);
+  }
+  if(!in || size < (std::streamoff) sizeof(SnapHeader)) {
+    SLOG("AlgConfigPool", pERROR)
+      << "The configuration snapshot is empty or truncated! (filename : "
+      << filename << ")";
+    return false;
+  }
+  const char * base = &buffer[0];
+
+  // check the header and that all sections fit in
+  SnapHeader header;
+  memcpy(&header, base, sizeof(SnapHeader));
+  uint64_t offset_lengths = sizeof(SnapHeader);
+  uint64_t offset_strings = offset_lengths +
+                            header.nstrings * (uint64_t) sizeof(uint32_t);
+  uint64_t offset_files   = offset_strings + header.strings_size;
+  uint64_t offset_keys    = offset_files +
+                            header.nfiles * (uint64_t) sizeof(SnapFile);
+  uint64_t offset_params  = offset_keys +
+                            header.nkeys * (uint64_t) sizeof(SnapKey);
+  bool ok =
+     memcmp(header.magic, kSnapMagic, sizeof(kSnapMagic)) == 0 &&
+     header.byte_order == kSnapByteOrder &&
+     header.version    == kSnapVersion   &&
+     header.file_size  == (uint64_t) size &&
+     header.nparams    <= (uint64_t) size / sizeof(SnapParam) &&
+     header.strings_size <= (uint64_t) size &&
+     offset_params + header.nparams * sizeof(SnapParam) == (uint64_t) size &&
+     header.tune < header.nstrings;
+  if(!ok) {
+    SLOG("AlgConfigPool", pERROR)
+      << "The configuration snapshot has an invalid or incompatible header "
+      << "(version: " << header.version << ", expected: " << kSnapVersion
+      << ") (filename : " << filename << ")";
+    return false;
+  }
+
+  // the string table
+  vector<string> strings(header.nstrings);
+  uint64_t pos = offset_strings;
+  for(uint32_t i = 0; i < header.nstrings; i++) {
+    uint32_t length = 0;
+    memcpy(&length, base + offset_lengths + i * sizeof(uint32_t),
+           sizeof(uint32_t));
+    if(pos + length > offset_files) {
+      SLOG("AlgConfigPool", pERROR)
+        << "The configuration snapshot has a corrupted string table! "
+        << "(filename : " << filename << ")";
+      return false;
+    }
+    strings[i].assign(base + pos, length);
+    pos += length;
+  }
+
+  // check that it is for the current tune and that its XML files didn't change
+  if(strings[header.tune] != CurrentTuneName()) {
+    SLOG("AlgConfigPool", pWARN)
+      << "The configuration snapshot was made for tune: "
+      << strings[header.tune] << " (current tune: " << CurrentTuneName() << ")";
+    return false;
+  }
+  vector<string> xml_files(header.nfiles);
+  for(uint32_t i = 0; i < header.nfiles; i++) {
+    SnapFile file;
+    memcpy(&file, base + offset_files + i * sizeof(SnapFile), sizeof(SnapFile));
+    if(file.name >= header.nstrings) {
+      SLOG("AlgConfigPool", pERROR)
+        << "The configuration snapshot has a corrupted file list! "
+        << "(filename : " << filename << ")";
+      return false;
+    }
+    xml_files[i] = strings[file.name];
+    string full_path = utils::xml::GetXMLFilePath(xml_files[i]);
+    if(FileChecksum(full_path) != file.checksum) {
+      SLOG("AlgConfigPool", pWARN)
+        << "The XML file: " << full_path
+        << " changed since the configuration snapshot was made";
+      return false;
+    }
+  }
+
+  // the configuration keys & their parameters
+  vector<string>             keys  (header.nkeys);
+  vector< vector<XmlParam> > params(header.nkeys);
+  uint64_t iparam = 0;
+  for(uint32_t ik = 0; ik < header.nkeys; ik++) {
+    SnapKey key;
+    memcpy(&key, base + offset_keys + ik * sizeof(SnapKey), sizeof(SnapKey));
+    ok = key.key < header.nstrings &&
+         key.nparams <= header.nparams - iparam &&
+         strings[key.key].find("/") != string::npos;
+    for(uint32_t ip = 0; ok && ip < key.nparams; ip++, iparam++) {
+      SnapParam sp;
+      memcpy(&sp, base + offset_params + iparam * sizeof(SnapParam),
+             sizeof(SnapParam));
+      ok = sp.type  < header.nstrings && sp.name  < header.nstrings &&
+           sp.value < header.nstrings && sp.delim < header.nstrings;
+      if(!ok) break;
+      XmlParam param;
+      param.type  = strings[sp.type];
+      param.name  = strings[sp.name];
+      param.value = strings[sp.value];
+      param.delim = strings[sp.delim];
+      params[ik].push_back(param);
+    }
+    if(!ok) {
+      SLOG("AlgConfigPool", pERROR)
+        << "The configuration snapshot has a corrupted configuration list! "
+        << "(filename : " << filename << ")";
+      return false;
+    }
+    keys[ik] = strings[key.key];
+  }
+
+  // build the registries as LoadRegistries() would
+  for(uint32_t ik = 0; ik < header.nkeys; ik++) {
+    string param_set = keys[ik].substr(keys[ik].find("/") + 1);
+    Registry * config = new Registry(param_set,false);
+    for(unsigned int ip = 0; ip < params[ik].size(); ip++) {
+      this->AddXmlParameter(config, params[ik][ip]);
+    }
+    config->SetName(param_set);
+    config->Lock();
+
+    fConfigKeyList.push_back(keys[ik]);
+    fXmlParams    .push_back(params[ik]);
+    fRegistryPool.insert(pair<string, Registry *>(keys[ik], config));
+  }
+  fXmlFiles = xml_files;
+  fSnapshot = filename;
+
+  SLOG("AlgConfigPool", pNOTICE)
+    << "Loaded " << header.nkeys << " configuration sets from snapshot";
+  return true;
+}
+//____________________________________________________________________________
 void AlgConfigPool::Print(ostream & stream) const
 {
   string frame(100,'~');
@@ -6,6 +6,14 @@
 \brief    A singleton class holding all configuration registries built while
           parsing all loaded XML configuration files.
 
+          The fully resolved configuration of a tune can be saved into a
+          binary snapshot (SaveSnapshot(), see the gcfgsnap app). If a
+          snapshot is given through RunOpt (--config-snapshot, or $GCONFSNAP)
+          the registries are built from it, without parsing any XML, provided
+          that it was made for the same tune and that none of the XML files
+          it was made from changed (checked against their checksums).
+          Otherwise the XML files are parsed as usual.
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -54,6 +62,13 @@ public:
 
   const vector<string> & ConfigKeyList (void) const;
 
+  ///< save the configuration (incl. all the common lists referred to) into
+  ///< a binary snapshot
+  bool SaveSnapshot (string filename);
+
+  ///< the snapshot the configuration was loaded from (empty if from XML)
+  string Snapshot (void) const { return fSnapshot; }
+
   void Print(ostream & stream) const;
   friend ostream & operator << (ostream & stream, const AlgConfigPool & cp);
 
@@ -62,6 +77,14 @@ private:
   AlgConfigPool(const AlgConfigPool & config_pool);
   virtual ~AlgConfigPool();
 
+  // a configuration parameter, as read from an XML file
+  struct XmlParam {
+    string type;
+    string name;
+    string value;
+    string delim;
+  };
+
   // methods for loading all algorithm XML configuration files
   string BuildConfigKey      (string alg_name, string param_set) const;
   string BuildConfigKey      (const Algorithm * algorithm) const;
@@ -72,10 +95,14 @@ private:
   bool   LoadTuneGeneratorList(void);
   bool   LoadSingleAlgConfig (string alg_name, string file_name);
   bool   LoadRegistries      (string key_base, string file_name, string root);
+  string XmlFilePath         (string basename);
+  void   AddXmlParameter     (Registry * r, const XmlParam & param);
   int    AddParameterVector  (Registry * r, string pt, string pn, string pv, const string & delim = ";" );
   void   AddConfigParameter  (Registry * r, string pt, string pn, string pv);
   void   AddBasicParameter   (Registry * r, string pt, string pn, string pv);
   void   AddRootObjParameter (Registry * r, string pt, string pn, string pv);
+  bool   LoadSnapshot        (string filename);
+  void   LoadAllCommonLists  (void);
 
 
   static AlgConfigPool * fInstance;
@@ -84,6 +111,9 @@ private:
   map<string, string>     fConfigFiles;   ///< algorithm -> XML config file
   vector<string>          fConfigKeyList; ///< list of all available configuration keys
   string                  fMasterConfig;  ///< lists config files for all algorithms
+  vector<string>          fXmlFiles;      ///< XML files read (names as resolved in the XML path), in reading order
+  vector< vector<XmlParam> > fXmlParams;  ///< parameters of each configuration key (in fConfigKeyList order), as read
+  string                  fSnapshot;      ///< snapshot the configuration was loaded from
 
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
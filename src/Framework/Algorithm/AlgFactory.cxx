@@ -10,6 +10,7 @@
 
 #include <iostream>
 #include <cstdlib>
+#include <mutex>
 
 #include <TROOT.h>
 #include <TClass.h>
@@ -32,6 +33,33 @@ namespace genie {
   }
 }
 //____________________________________________________________________________
+namespace {
+  std::recursive_mutex gAlgFactoryMutex;
+
+  // Private algorithm pool of a thread (see AlgFactory::UseThreadPool),
+  // deleted when the thread exits
+  struct ThreadAlgPool {
+    ThreadAlgPool() : on(false) { }
+   ~ThreadAlgPool() {
+      map<string, Algorithm *>::iterator it = algs.begin();
+      for( ; it != algs.end(); ++it) delete it->second;
+    }
+    bool on;
+    map<string, Algorithm *> algs;
+  };
+  thread_local ThreadAlgPool gThreadAlgPool;
+}
+//____________________________________________________________________________
+AlgFactory::Lock::Lock()
+{
+  gAlgFactoryMutex.lock();
+}
+//____________________________________________________________________________
+AlgFactory::Lock::~Lock()
+{
+  gAlgFactoryMutex.unlock();
+}
+//____________________________________________________________________________
 AlgFactory * AlgFactory::fInstance = 0;
 //____________________________________________________________________________
 AlgFactory::AlgFactory()
@@ -89,8 +117,19 @@ const Algorithm * AlgFactory::GetAlgorithm(string name, string config)
   SLOG("AlgFactory", pDEBUG)
       << "Algorithm: " << key << " requested from AlgFactory";
 
-  map<string, Algorithm *>::const_iterator alg_iter = fAlgPool.find(key);
-  bool found = (alg_iter != fAlgPool.end());
+  // the thread's private pool, if any, is only seen by the thread itself:
+  // the lock is only needed for instantiating (configuring) algorithms
+  map<string, Algorithm *> & pool =
+       (gThreadAlgPool.on) ? gThreadAlgPool.algs : fAlgPool;
+  if(gThreadAlgPool.on) {
+    map<string, Algorithm *>::const_iterator alg_iter = pool.find(key);
+    if(alg_iter != pool.end()) return alg_iter->second;
+  }
+
+  Lock lock;
+
+  map<string, Algorithm *>::const_iterator alg_iter = pool.find(key);
+  bool found = (alg_iter != pool.end());
 
   if(found) {
      LOG("AlgFactory", pDEBUG) << key << " algorithm found in memory";
@@ -102,7 +141,7 @@ const Algorithm * AlgFactory::GetAlgorithm(string name, string config)
      //-- cache the algorithm for future use
      if(alg_base) {
         pair<string, Algorithm *> key_alg_pair(key, alg_base);
-        fAlgPool.insert(key_alg_pair);
+        pool.insert(key_alg_pair);
      } else {
         LOG("AlgFactory", pFATAL)
             << "Algorithm: " << key << " could not be instantiated";
@@ -124,6 +163,7 @@ Algorithm * AlgFactory::AdoptAlgorithm(const AlgId & algid) const
 //____________________________________________________________________________
 Algorithm * AlgFactory::AdoptAlgorithm(string name, string config) const
 {
+   Lock lock;
    Algorithm * alg_base = InstantiateAlgorithm(name, config);
    return alg_base;
 }
@@ -132,9 +172,13 @@ void AlgFactory::ForceReconfiguration(bool ignore_alg_opt_out)
 {
   LOG("AlgFactory", pNOTICE)
        << " ** Forcing algorithm re-configuration";
+  Lock lock;
 
-  map<string, Algorithm *>::iterator alg_iter = fAlgPool.begin();
-  for( ; alg_iter != fAlgPool.end(); ++alg_iter) {
+  // the pool seen by the calling thread
+  map<string, Algorithm *> & pool =
+       (gThreadAlgPool.on) ? gThreadAlgPool.algs : fAlgPool;
+  map<string, Algorithm *>::iterator alg_iter = pool.begin();
+  for( ; alg_iter != pool.end(); ++alg_iter) {
     Algorithm * alg = alg_iter->second;
     bool reconfig = (ignore_alg_opt_out) ? true : alg->AllowReconfig();
     if(reconfig) {
@@ -148,6 +192,20 @@ void AlgFactory::ForceReconfiguration(bool ignore_alg_opt_out)
   }
 }
 //____________________________________________________________________________
+void AlgFactory::UseThreadPool(bool on)
+{
+  LOG("AlgFactory", pNOTICE)
+     << "Using a private algorithm pool for this thread? "
+     << ((on) ? "Yes" : "No");
+
+  gThreadAlgPool.on = on;
+}
+//____________________________________________________________________________
+bool AlgFactory::UsesThreadPool(void) const
+{
+  return gThreadAlgPool.on;
+}
+//____________________________________________________________________________
 Algorithm * AlgFactory::InstantiateAlgorithm(string name, string config) const
 {
 //! Instantiate the requested object based on the registration of its TClass
@@ -157,6 +215,10 @@ Algorithm * AlgFactory::InstantiateAlgorithm(string name, string config) const
   // Get object through ROOT's TROOT::GetClass() mechanism
   LOG("AlgFactory", pDEBUG) << "Instantiating algorithm = " << name;
 
+  // configuration look-ups are expected here, even if the algorithm is
+  // first asked for during event generation
+  Algorithm::HotScope configuring(false);
+
   TClass * tclass = gROOT->GetClass(name.c_str());
   if(!tclass) {
      LOG("AlgFactory", pERROR)
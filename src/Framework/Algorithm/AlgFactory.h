@@ -57,6 +57,27 @@ public:
   //! Use that to propagate modifications made directly at the config pool.
   void ForceReconfiguration(bool ignore_alg_opt_out=false);
 
+  //! Gives the calling thread a private algorithm pool (on = true): the
+  //! algorithms it gets from then on, and their sub-algorithms, are its own
+  //! instances instead of the shared ones of the factory pool. Threads
+  //! generating events with drivers built on their private pools can
+  //! then run the (stateful) physics modules concurrently, at the cost of a
+  //! copy of the configured algorithms per thread. The private instances are
+  //! deleted when the thread exits: delete the drivers using them first.
+  void UseThreadPool  (bool on);
+  bool UsesThreadPool (void) const;
+
+  //! Serialises the factory calls, and the configuration steps that
+  //! algorithms complete on first use (see EventGenerator), across threads.
+  //! Recursive, as configuring an algorithm may instantiate others.
+  class Lock {
+  public:
+    Lock();
+   ~Lock();
+  private:
+    Lock(const Lock &);
+  };
+
   //! print algorithm factory
   void Print(ostream & stream) const;
   friend ostream & operator << (ostream & stream, const AlgFactory & algf);
@@ -11,6 +11,7 @@
 #include <sstream>
 
 #include "Framework/Algorithm/AlgId.h"
+#include "Framework/Utils/StringUtils.h"
 
 using std::ostringstream;
 
@@ -97,7 +98,8 @@ void AlgId::UpdateKey(void)
   key << this->Name();
   if(this->Config().size() > 0) key << "/" << this->Config();
 
-  fKey = key.str();
+  fKey     = key.str();
+  fKeyHash = utils::str::Hash(fKey);
 }
 //____________________________________________________________________________
 void AlgId::Init(void)
@@ -105,5 +107,6 @@ void AlgId::Init(void)
   this->fName   = "";
   this->fConfig = "";
   this->fKey    = "";
+  this->fKeyHash = utils::str::Hash(fKey);
 }
 //____________________________________________________________________________
@@ -21,6 +21,8 @@
 #include <string>
 #include <iostream>
 
+#include <Rtypes.h>
+
 #include "Framework/Registry/RegistryItemTypeDef.h"
 
 using std::string;
@@ -44,6 +46,7 @@ public:
   string Name   (void) const { return fName;   }
   string Config (void) const { return fConfig; }
   string Key    (void) const { return fKey;    }
+  ULong64_t KeyHash (void) const { return fKeyHash; } ///< 64-bit hash of Key()
 
   void   SetId     (string name, string config="");
   void   SetName   (string name);
@@ -62,6 +65,7 @@ private:
   string fName;   ///< Algorithm name (including namespaces)
   string fConfig; ///< Configuration set name
   string fKey;    ///< Unique key: namespace::alg_name/alg_config
+  ULong64_t fKeyHash; ///< Hash of the unique key
 };
 
 }       // genie namespace
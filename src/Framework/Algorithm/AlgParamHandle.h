@@ -0,0 +1,58 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::AlgParamHandle
+
+\brief    A configuration parameter of an algorithm, resolved once (see
+          Algorithm::FindParam) and read afterwards at O(1) cost.
+
+          Algorithm::GetParam looks a parameter up through all the
+          configuration registries of an algorithm (and of its sub-algorithms)
+          by its string key, which is fine at configuration time but not in
+          code run for every event or cross section evaluation. Resolve the
+          parameter in LoadConfig() instead and keep the handle: it points to
+          the registry item, so it stays valid until the algorithm is
+          re-configured (when LoadConfig() resolves it again).
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _ALG_PARAM_HANDLE_H_
+#define _ALG_PARAM_HANDLE_H_
+
+#include <cassert>
+
+#include "Framework/Registry/RegistryItem.h"
+
+namespace genie {
+
+class Algorithm;
+
+template<class T> class AlgParamHandle {
+
+  friend class Algorithm;
+
+public:
+  AlgParamHandle() : fItem(0) { }
+
+  //! Was the parameter found?
+  bool      IsValid (void) const { return fItem != 0; }
+  //! The parameter value
+  const T & Value   (void) const { assert(fItem); return fItem->Data(); }
+  //! Forget the parameter
+  void      Reset   (void)       { fItem = 0; }
+
+private:
+  const RegistryItem<T> * fItem;
+};
+
+}      // genie namespace
+
+#endif // _ALG_PARAM_HANDLE_H_
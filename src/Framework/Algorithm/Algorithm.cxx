@@ -9,22 +9,44 @@
 //____________________________________________________________________________
 
 #include <vector>
+#include <algorithm>
 #include <string>
 #include <sstream>
+#include <cstdlib>
+#include <set>
+#include <mutex>
 
 #include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/Algorithm/Algorithm.h"
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Registry/RegistryItem.h"
 #include "Framework/Utils/StringUtils.h"
 
 using std::vector;
 using std::string;
+using std::ostringstream;
 using std::endl;
 
 using namespace genie;
 using namespace genie::utils;
 
+//____________________________________________________________________________
+namespace {
+
+  // event generation code nesting level of the current thread (HotScope)
+  thread_local int gHotScopeDepth = 0;
+
+  // parameter look-ups during event generation reported so far
+  std::mutex       gParamCheckMutex;
+  std::set<string> gParamCheckReported;
+
+  bool ParamCheckEnabled(void)
+  {
+    static const bool enabled = (std::getenv("GPARAMCHECK") != 0);
+    return enabled;
+  }
+}
 //____________________________________________________________________________
 namespace genie
 {
@@ -302,6 +324,84 @@ AlgCmp_t Algorithm::Compare(const Algorithm * algo) const
   return kAlgCmpUnknown;
 }
 //____________________________________________________________________________
+ULong64_t Algorithm::ConfigHash(void) const
+{
+// Hashes a canonical listing of the configuration, so that algorithms with
+// the same hash compute the same thing (eg to re-use stored results).
+// Sub-algorithms from the AlgFactory pool are followed through the RgAlg
+// items; the configuration of owned sub-algorithms is already merged in.
+
+  ostringstream config;
+  config.precision(17);
+  this->HashConfig(config, 0);
+
+  return utils::str::Hash(config.str());
+}
+//____________________________________________________________________________
+ULong64_t Algorithm::ConfigHash(const vector<string> & skip_keys) const
+{
+  ostringstream config;
+  config.precision(17);
+  this->HashConfig(config, 0, &skip_keys);
+
+  return utils::str::Hash(config.str());
+}
+//____________________________________________________________________________
+void Algorithm::HashConfig(
+   ostream & stream, unsigned int depth, const vector<string> * skip_keys) const
+{
+  stream << "{" << fID.Key();
+
+  // protect against configurations pointing back to themselves
+  const unsigned int kMaxDepth = 32;
+  if(depth > kMaxDepth) {
+    LOG("Algorithm", pWARN)
+      << "Sub-algorithm depth > " << kMaxDepth << " in " << fID.Key();
+    stream << "}";
+    return;
+  }
+
+  const RgIMap & items = this->GetConfig().GetItemMap();
+  RgIMapConstIter iter = items.begin();
+  for( ; iter != items.end(); ++iter) {
+    const RegistryItemI * item = iter->second;
+    if(!item) continue;
+    if(skip_keys && std::find(skip_keys->begin(), skip_keys->end(),
+                              iter->first) != skip_keys->end()) continue;
+    RgType_t type = item->TypeInfo();
+    stream << ";" << iter->first << "=";
+    switch(type) {
+      case (kRgBool) :
+        stream << dynamic_cast<const RegistryItem<RgBool> *>(item)->Data();
+        break;
+      case (kRgInt) :
+        stream << dynamic_cast<const RegistryItem<RgInt>  *>(item)->Data();
+        break;
+      case (kRgDbl) :
+        stream << dynamic_cast<const RegistryItem<RgDbl>  *>(item)->Data();
+        break;
+      case (kRgStr) :
+        stream << dynamic_cast<const RegistryItem<RgStr>  *>(item)->Data();
+        break;
+      case (kRgAlg) :
+      {
+        const RgAlg & id = dynamic_cast<const RegistryItem<RgAlg> *>(item)->Data();
+        stream << id;
+        if(!fOwnsSubstruc) {
+          const Algorithm * subalg =
+               AlgFactory::Instance()->GetAlgorithm(id.name, id.config);
+          if(subalg) subalg->HashConfig(stream, depth+1);
+        }
+        break;
+      }
+      default :
+        item->Print(stream);
+        break;
+    }
+  }
+  stream << "}";
+}
+//____________________________________________________________________________
 void Algorithm::SetId(const AlgId & id)
 {
   fID.Copy(id);
@@ -342,6 +442,72 @@ void Algorithm::Initialize(void)
   fOwnedSubAlgMp  = 0;
 }
 //____________________________________________________________________________
+const RegistryItemI * Algorithm::FindParamItem(const RgKey & key) const
+{
+// Finds the registry item of a parameter in the same order as GetParam():
+// in the local registries (by precedence), then in the owned sub-algorithms
+// or in the sub-algorithms pointed to by the local registries
+
+  for ( unsigned int i = 0 ; i < fConfVect.size() ; ++i ) {
+    const Registry & temp = * fConfVect[i] ;
+    if ( temp.Exists(key) && temp.ItemIsLocal(key) ) {
+      const RegistryItemI * item = 0 ;
+      temp.Get( key, item ) ;
+      return item ;
+    }
+  }
+
+  if ( fOwnsSubstruc ) {
+    for ( AlgMapConstIter iter = fOwnedSubAlgMp->begin() ;
+          iter != fOwnedSubAlgMp->end() ; ++iter ) {
+      const Algorithm * alg = iter->second ;
+      if ( ! alg ) continue ;
+      const RegistryItemI * item = alg->FindParamItem( key ) ;
+      if ( item ) return item ;
+    }
+    return 0 ;
+  }
+
+  AlgFactory * algf = AlgFactory::Instance();
+  for ( unsigned int i = 0 ; i < fConfVect.size() ; ++i ) {
+    const Registry & temp = * fConfVect[i] ;
+    const RgIMap & rgmap = temp.GetItemMap() ;
+    for ( RgIMapConstIter iter = rgmap.begin() ; iter != rgmap.end() ; ++iter ) {
+      if ( iter->second->TypeInfo() != kRgAlg ) continue ;
+      AlgId id( temp.GetAlg( iter->first ) ) ;
+      const RegistryItemI * item =
+         algf->GetAlgorithm( id )->FindParamItem( key ) ;
+      if ( item ) return item ;
+    }
+  }
+  return 0 ;
+}
+//____________________________________________________________________________
+void Algorithm::CheckParamAccess(const RgKey & key) const
+{
+  if ( gHotScopeDepth == 0 || ! ParamCheckEnabled() ) return ;
+
+  {
+    std::lock_guard<std::mutex> lock( gParamCheckMutex ) ;
+    if ( ! gParamCheckReported.insert( fID.Key() + " : " + key ).second ) return ;
+  }
+  LOG("Algorithm", pWARN)
+    << "Parameter: " << key << " of algorithm: " << fID.Key()
+    << " looked up during event generation - Resolve it at configuration "
+    << "instead (Algorithm::FindParam)";
+}
+//____________________________________________________________________________
+Algorithm::HotScope::HotScope(bool hot) :
+fPrevious(gHotScopeDepth)
+{
+  gHotScopeDepth = (hot) ? gHotScopeDepth + 1 : 0;
+}
+//____________________________________________________________________________
+Algorithm::HotScope::~HotScope()
+{
+  gHotScopeDepth = fPrevious;
+}
+//____________________________________________________________________________
 const Algorithm * Algorithm::SubAlg(const RgKey & registry_key) const
 {
 // Returns the sub-algorithm pointed to this algorithm's XML config file using
@@ -26,11 +26,13 @@
 #include <iostream>
 #include <cassert>
 #include <map>
+#include <vector>
 
 #include "Framework/Algorithm/AlgStatus.h"
 #include "Framework/Algorithm/AlgCmp.h"
 #include "Framework/Algorithm/AlgId.h"
 #include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/Algorithm/AlgParamHandle.h"
 #include "Framework/Registry/Registry.h"
 #include "Framework/Registry/RegistryItemTypeDef.h"
 #include "Framework/Messenger/Messenger.h"
@@ -107,6 +109,13 @@ public:
   //! Compare with input algorithm
   virtual AlgCmp_t Compare(const Algorithm * alg) const;
 
+  //! 64-bit hash of the full configuration: the algorithm key and all the
+  //! items of its configuration, including those of its sub-algorithms
+  ULong64_t ConfigHash(void) const;
+  //! the same, leaving out the listed (top-level) configuration items, eg.
+  //! parameters that results stored under the hash do not depend on
+  ULong64_t ConfigHash(const std::vector<string> & skip_keys) const;
+
   //! Set algorithm ID
   virtual void SetId(const AlgId & id);
   virtual void SetId(string name,  string config);
@@ -138,12 +147,29 @@ public:
   static string BuildParamVectKey( const std::string & comm_name, unsigned int i ) ;
   static string BuildParamVectSizeKey( const std::string & comm_name ) ;
 
+  //! Marks the calling thread as running event generation code while in
+  //! scope (see EventGenerator::ProcessEventRecord); hot = false marks it as
+  //! configuring algorithms instead (eg when they are instantiated on first
+  //! use). If $GPARAMCHECK is set, every GetParam call made during event
+  //! generation is reported (once per algorithm and key): parameters used
+  //! there should be resolved at configuration time (see FindParam).
+  class HotScope {
+  public:
+    HotScope(bool hot = true);
+   ~HotScope();
+  private:
+    HotScope(const HotScope &);
+    int fPrevious;
+  };
+
 protected:
   Algorithm();
   Algorithm(string name);
   Algorithm(string name, string config);
 
   void Initialize         (void);
+  void HashConfig         (ostream & stream, unsigned int depth,
+                           const std::vector<string> * skip_keys = 0) const;
   void DeleteConfig       (void);
   void DeleteSubstructure (void);
 
@@ -180,6 +206,13 @@ protected:
   template<class T>
      bool GetParamDef( const RgKey & name, T & p, const T & def ) const ;
 
+  //! Resolve a parameter once (typically in LoadConfig), as GetParam would
+  //! find it, for O(1) access through the handle afterwards.
+  //! Returns true if the parameter is found (missing parameters are fatal
+  //! if is_top_call is true, as in GetParam)
+  template<class T>
+    bool FindParam( const RgKey & name, AlgParamHandle<T> & h, bool is_top_call = true ) const ;
+
   //! Handle to load vectors of parameters
   template<class T>
     int GetParamVect( const std::string & comm_name, std::vector<T> & v,
@@ -194,6 +227,9 @@ protected:
                                                             ///< Otherwise an owned copy is added as a top registry
   int   AddTopRegisties( const vector<Registry*> & rs, bool owns = false ) ; ///< Add registries with top priority, also udated Ownerships
 
+  const RegistryItemI * FindParamItem    (const RgKey & key) const; ///< registry item of a parameter, as looked up by GetParam (0 if not found)
+  void                  CheckParamAccess (const RgKey & key) const; ///< report GetParam calls during event generation (see HotScope)
+
 private:
 
   Registry *   fConfig;        ///< Summary configuration derived from fConvVect, not necessarily allocated
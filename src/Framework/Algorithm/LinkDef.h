@@ -12,5 +12,6 @@
 #pragma link C++ class genie::AlgCmp;
 #pragma link C++ class genie::AlgFactory;
 #pragma link C++ class genie::AlgConfigPool;
+#pragma link C++ class genie::ThreadAlgInstances;
 
 #endif
@@ -0,0 +1,97 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <atomic>
+#include <map>
+#include <mutex>
+
+#include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/Algorithm/Algorithm.h"
+#include "Framework/Algorithm/ThreadAlgInstances.h"
+#include "Framework/Messenger/Messenger.h"
+
+using std::map;
+
+using namespace genie;
+
+//____________________________________________________________________________
+namespace {
+
+  std::atomic<unsigned long> gNThreads(0);   // thread serial numbers
+  std::atomic<unsigned long> gNKeys(0);      // instance table keys
+  std::mutex                 gAdoptMutex;    // serialises the AlgFactory calls
+
+  thread_local unsigned long gThreadSerial = 0;
+
+  unsigned long ThreadSerial(void)
+  {
+    if(gThreadSerial == 0) gThreadSerial = ++gNThreads;
+    return gThreadSerial;
+  }
+
+  // Per-thread algorithm copies, deleted when the thread exits
+  struct ThreadAlgCopies {
+    ~ThreadAlgCopies() {
+      map<unsigned long, Algorithm *>::iterator it = copies.begin();
+      for( ; it != copies.end(); ++it) delete it->second;
+    }
+    map<unsigned long, Algorithm *> copies;
+  };
+  thread_local ThreadAlgCopies gThreadAlgCopies;
+}
+
+//____________________________________________________________________________
+ThreadAlgInstances::ThreadAlgInstances() :
+fOwner(ThreadSerial()),
+fKey(++gNKeys)
+{
+
+}
+//____________________________________________________________________________
+ThreadAlgInstances::ThreadAlgInstances(const ThreadAlgInstances &) :
+fOwner(ThreadSerial()),
+fKey(++gNKeys)
+{
+
+}
+//____________________________________________________________________________
+ThreadAlgInstances::~ThreadAlgInstances()
+{
+
+}
+//____________________________________________________________________________
+const Algorithm * ThreadAlgInstances::Get(const Algorithm * alg) const
+{
+  if(ThreadSerial() == fOwner) return alg;
+
+  map<unsigned long, Algorithm *> & copies = gThreadAlgCopies.copies;
+  map<unsigned long, Algorithm *>::const_iterator iter = copies.find(fKey);
+  if(iter != copies.end()) return iter->second;
+
+  Algorithm * copy = 0;
+  {
+    std::lock_guard<std::mutex> lock(gAdoptMutex);
+    copy = AlgFactory::Instance()->AdoptAlgorithm(alg->Id());
+  }
+  if(!copy) return alg;
+
+  LOG("ThreadAlg", pNOTICE)
+    << "Created instance of " << alg->Id().Key()
+    << " for thread " << ThreadSerial();
+
+  copies[fKey] = copy;
+  return copy;
+}
+//____________________________________________________________________________
+void ThreadAlgInstances::Reset(void)
+{
+  fKey = ++gNKeys;
+}
+//____________________________________________________________________________
@@ -0,0 +1,56 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::ThreadAlgInstances
+
+\brief    Gives each thread using an algorithm its own instance of it.
+
+          For algorithms wrapping a stateful external library object (eg the
+          PYTHIA8 instance of Pythia8Hadro2019), that cannot be shared by
+          concurrent threads. The thread which created the algorithm uses the
+          algorithm itself; any other thread gets a private copy, built with
+          the same name and configuration by the AlgFactory the first time it
+          asks for it, and deleted when the thread exits.
+
+          Reset() (eg on re-configuration of the algorithm) detaches the
+          copies made so far, so that fresh ones are built from the new
+          configuration.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _THREAD_ALG_INSTANCES_H_
+#define _THREAD_ALG_INSTANCES_H_
+
+namespace genie {
+
+class Algorithm;
+
+class ThreadAlgInstances {
+
+public:
+  ThreadAlgInstances();
+  ThreadAlgInstances(const ThreadAlgInstances & instances);
+ ~ThreadAlgInstances();
+
+  //! The calling thread's instance of alg (the algorithm owning this)
+  const Algorithm * Get   (const Algorithm * alg) const;
+  //! Detach the copies made so far
+  void              Reset (void);
+
+private:
+
+  unsigned long fOwner;  ///< serial number of the thread using the original
+  unsigned long fKey;    ///< key of the copies in the per-thread tables
+};
+
+}      // genie namespace
+
+#endif // _THREAD_ALG_INSTANCES_H_
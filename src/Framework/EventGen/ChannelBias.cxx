@@ -0,0 +1,136 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+
+#include "Framework/EventGen/ChannelBias.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/StringUtils.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+namespace genie {
+ ostream & operator << (ostream & stream, const ChannelBias & bias)
+ {
+   bias.Print(stream);
+   return stream;
+ }
+}
+//____________________________________________________________________________
+ChannelBias::ChannelBias()
+{
+
+}
+//____________________________________________________________________________
+ChannelBias::ChannelBias(string spec)
+{
+  this->Set(spec);
+}
+//____________________________________________________________________________
+ChannelBias::~ChannelBias()
+{
+
+}
+//____________________________________________________________________________
+bool ChannelBias::Set(string spec)
+{
+  this->Clear();
+
+  vector<string> rules = utils::str::Split(spec, ",");
+  vector<string>::const_iterator it = rules.begin();
+  for( ; it != rules.end(); ++it) {
+    string rule = utils::str::TrimSpaces(*it);
+    if(rule.empty()) continue;
+
+    size_t pos = rule.find('=');
+    string key = (pos == string::npos) ? "" :
+                 utils::str::TrimSpaces(rule.substr(0, pos));
+    string val = (pos == string::npos) ? "" :
+                 utils::str::TrimSpaces(rule.substr(pos+1));
+    char * end = 0;
+    double factor = std::strtod(val.c_str(), &end);
+    if(key.empty() || val.empty() || *end != 0 || !(factor > 0)) {
+      LOG("ChannelBias", pERROR)
+        << "Bad channel biasing rule: \"" << rule
+        << "\" (expecting key=factor, with a positive factor)";
+      this->Clear();
+      return false;
+    }
+
+    if(key.compare(0, 4, "tgt:") == 0) {
+      int pdg = std::atoi(key.substr(4).c_str());
+      double & f = fTgt.insert(map<int,double>::value_type(pdg, 1.)).first->second;
+      f *= factor;
+    } else {
+      fKey   .push_back(key);
+      fFactor.push_back(factor);
+    }
+  }
+  fSpec = spec;
+  return true;
+}
+//____________________________________________________________________________
+void ChannelBias::Clear(void)
+{
+  fSpec = "";
+  fKey   .clear();
+  fFactor.clear();
+  fTgt   .clear();
+}
+//____________________________________________________________________________
+double ChannelBias::Factor(const Interaction & interaction) const
+{
+  double factor = 1.;
+  for(unsigned int i = 0; i < fKey.size(); i++) {
+    if(this->Matches(fKey[i], interaction)) factor *= fFactor[i];
+  }
+  return factor;
+}
+//____________________________________________________________________________
+double ChannelBias::TargetFactor(int tgtpdg) const
+{
+  map<int,double>::const_iterator it = fTgt.find(tgtpdg);
+  return (it == fTgt.end()) ? 1. : it->second;
+}
+//____________________________________________________________________________
+bool ChannelBias::Matches(
+     const string & key, const Interaction & interaction) const
+{
+  const ProcessInfo & proc = interaction.ProcInfo();
+  const XclsTag &     xcls = interaction.ExclTag();
+
+  if(key == "CC")      return proc.IsWeakCC();
+  if(key == "NC")      return proc.IsWeakNC();
+  if(key == "EM")      return proc.IsEM();
+  if(key == "charm")   return xcls.IsCharmEvent();
+  if(key == "strange") return xcls.IsStrangeEvent();
+  if(key == proc.ScatteringTypeAsString()) return true;
+
+  return interaction.AsString().find(key) != string::npos;
+}
+//____________________________________________________________________________
+void ChannelBias::Print(ostream & stream) const
+{
+  stream << "\n[-] Channel biasing rules:";
+  if(this->IsEmpty()) {
+    stream << " none";
+    return;
+  }
+  for(unsigned int i = 0; i < fKey.size(); i++) {
+    stream << "\n |-> channel " << fKey[i] << " : x " << fFactor[i];
+  }
+  map<int,double>::const_iterator it = fTgt.begin();
+  for( ; it != fTgt.end(); ++it) {
+    stream << "\n |-> target material " << it->first << " : x " << it->second;
+  }
+}
+//____________________________________________________________________________
@@ -0,0 +1,106 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::ChannelBias
+
+\brief    Factors by which the selection probabilities of chosen interaction
+          channels and target materials are inflated (or deflated) for
+          rare-channel studies.
+
+          The biasing rules are given as a comma separated list of key=factor
+          pairs, eg. "COH=50,1Kaon=200,charm=20,tgt:1000260560=0.5".
+          A channel key is matched against an interaction as:
+
+            QES, 1Kaon, DIS, RES, COH, ...  the scattering type
+                                            (ScatteringType::AsString())
+            CC, NC, EM                      the interaction type
+            charm, strange                  charm / strange production
+            anything else                   a sub-string of the interaction
+                                            code, eg. "nu:-14" or "N:2112"
+
+          The factors of all matching keys are multiplied. Keys of the form
+          tgt:<pdg> set the factor of a target material, used by GMCJDriver
+          when choosing the material a flux neutrino interacts in (and never
+          matched against an interaction code).
+
+          The biased selections keep the normalisation exact: The cross
+          sections and interaction probabilities stored in the event record
+          are the unbiased ones, and the event weight is multiplied by the
+          ratio of the unbiased to the biased selection probabilities
+          (see Weight()), so that the sum of weights in each channel is an
+          unbiased estimate of its number of events.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _CHANNEL_BIAS_H_
+#define _CHANNEL_BIAS_H_
+
+#include <map>
+#include <string>
+#include <vector>
+#include <ostream>
+
+using std::map;
+using std::string;
+using std::vector;
+using std::ostream;
+
+namespace genie {
+
+class Interaction;
+class ChannelBias;
+ostream & operator << (ostream & stream, const ChannelBias & bias);
+
+class ChannelBias
+{
+public:
+  ChannelBias();
+  ChannelBias(string spec);
+ ~ChannelBias();
+
+  //! set the rules from a key=factor list (returns false for a bad list,
+  //! leaving no rules)
+  bool   Set            (string spec);
+  void   Clear          (void);
+
+  bool   IsEmpty        (void) const { return fKey.empty() && fTgt.empty(); }
+  bool   HasChannelBias (void) const { return !fKey.empty(); }
+  bool   HasTargetBias  (void) const { return !fTgt.empty(); }
+  string Spec           (void) const { return fSpec;         }
+
+  //! bias factor of an interaction channel (1 if no rule matches)
+  double Factor         (const Interaction & interaction) const;
+  //! bias factor of a target material (1 if no rule matches)
+  double TargetFactor   (int tgtpdg) const;
+
+  //! weight of an entry selected from the biased probabilities b*p instead
+  //! of the probabilities p: (p/sum_p) / (b*p/sum_bp)
+  static double Weight  (double sum_p, double sum_bp, double b)
+  {
+    return (b > 0 && sum_p > 0) ? sum_bp / (b * sum_p) : 0.;
+  }
+
+  void Print (ostream & stream) const;
+  friend ostream & operator << (ostream & stream, const ChannelBias & bias);
+
+private:
+
+  bool Matches (const string & key, const Interaction & interaction) const;
+
+  string          fSpec;   ///< input key=factor list
+  vector<string>  fKey;    ///< channel keys
+  vector<double>  fFactor; ///< channel bias factors
+  map<int,double> fTgt;    ///< target material PDG code -> bias factor
+};
+
+}      // genie namespace
+
+#endif // _CHANNEL_BIAS_H_
@@ -16,9 +16,9 @@
 #include <TMath.h>
 #include <TBits.h>
 #include <TSystem.h>
-#include <TStopwatch.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
+#include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/Conventions/Controls.h"
 #include "Framework/EventGen/EventGenerator.h"
@@ -30,6 +30,10 @@
 #include "Framework/GHEP/GHepFlags.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/EventGenCost.h"
+#include "Framework/Utils/ModuleTimingStats.h"
+#include "Framework/Utils/StartupProfile.h"
+#include "Framework/Utils/TraceScope.h"
 
 using std::ostringstream;
 
@@ -38,6 +42,16 @@ using namespace genie::utils;
 using namespace genie::controls;
 using namespace genie::exceptions;
 
+//___________________________________________________________________________
+namespace {
+  // the reason an event was rejected: its first flag not masked by the user
+  int RejectionReason(const GHepRecord * event_rec)
+  {
+    TBits rejected = *(event_rec->EventFlags()) & *(event_rec->EventMask());
+    unsigned int reason = rejected.FirstSetBit();
+    return (reason < GHepFlags::NFlags()) ? (int) reason : (int) kGenericErr;
+  }
+}
 //___________________________________________________________________________
 EventGenerator::EventGenerator() :
 EventGeneratorI("genie::EventGenerator")
@@ -53,10 +67,8 @@ EventGeneratorI("genie::EventGenerator", config)
 //___________________________________________________________________________
 EventGenerator::~EventGenerator()
 {
-  delete fWatch;
   delete fFiltUnphysMask;
 
-  if(fEVGModuleVec) delete fEVGModuleVec;
   if(fEVGTime)      delete fEVGTime;
   if(fVldContext)   delete fVldContext;
 }
@@ -65,56 +77,97 @@ void EventGenerator::ProcessEventRecord(GHepRecord * event_rec) const
 {
   LOG("EventGenerator", pNOTICE) << "Generating Event...";
 
+  this->LoadModules();
+
+  //-- from here on, parameter look-ups are reported if requested
+  //   (see Algorithm::HotScope)
+  HotScope hot_scope;
+
   //-- Clear previous virtual list folder
   LOG("EventGenerator", pNOTICE) << "Clearing the GHepVirtualListFolder";
   GHepVirtualListFolder * vlfolder = GHepVirtualListFolder::Instance();
   vlfolder->Clear();
 
   //-- Clean previous history + add the bootstrap record in the buffer
+  //   (only needed if a module may ask to step back, unless the full
+  //   history was requested)
   fRecHistory.PurgeHistory();
-  fRecHistory.AddSnapshot(-1, event_rec);
+  bool keep_full_history = fRecHistory.KeepsFullHistory();
+  if(fMayStepBack || keep_full_history) {
+    fRecHistory.AddSnapshot(-1, event_rec);
+  }
 
   //-- Initialize evg thread control flags
+  //   (fast forward: the event is rejected, the thread stops)
   bool ffwd = false;
   unsigned int nexceptions = 0;
 
-  //-- Reset stop-watch
-  fWatch->Reset();
-
-  string mesgh = "Event generation thread: " + this->Id().Key() + 
-                 " -> Running module: ";
+  //-- Reset the module timing (modules may be skipped)
+  std::fill(fEVGTime->begin(), fEVGTime->end(), -1.);
 
-  //-- Loop over the event record processing modules
-  int istep=0;
-  vector<const EventRecordVisitorI *>::const_iterator miter;
+  //-- Loop over the event record processing steps
+  int nsteps = fSteps.size();
+  int istep  = 0;
 
-  for(miter = fEVGModuleVec->begin();
-      miter != fEVGModuleVec->end(); ++miter)
+  while(istep < nsteps)
   {
-    const EventRecordVisitorI * visitor = *miter; // generation module
-
-    string mesg = mesgh + visitor->Id().Key();
-    LOG("EventGenerator", pNOTICE)
-                 << utils::print::PrintFramedMesg(mesg,0,'~');
-    if(ffwd) {
-      LOG("EventGenerator", pNOTICE)
-           << "Fast Forward flag was set - Skipping processing step!";
-      continue;
-    }
+    const Step & step = fSteps[istep];
+    const EventRecordVisitorI * visitor = step.visitor; // generation module
+    int imodule = istep;
+
+    LOG("EventGenerator", pNOTICE) << step.banner;
+    // thread control instructions (fast forward / step back) posted by the
+    // module, either thrown as an EVGThreadException or, for the routine
+    // rejections, set in the record (see GHepRecord::StepBack())
+    EVGThreadException control;
+    bool has_control = false;
     try
     {
-      fWatch->Start();
+      GTRACE_SCOPE_DYN(step.key);
+
+      // steady clock: cheap to read, unlike the CPU time (a system call)
+      double start = EventGenCost::WallTime();
       visitor->ProcessEventRecord(event_rec);
-      fWatch->Stop();
-      fRecHistory.AddSnapshot(istep, event_rec);
-      (*fEVGTime)[istep] = fWatch->CpuTime(); // sec
+      double dt = EventGenCost::WallTime() - start; // sec
+
+      // take any step back request out of the record before it is saved
+      if(event_rec->ReturnStep() >= 0) {
+        control.SetReason("Step back requested");
+        control.SwitchOnStepBack();
+        control.SetReturnStep(event_rec->ReturnStep());
+        event_rec->ClearReturnStep();
+        has_control = true;
+      }
+      if(keep_full_history) fRecHistory.AddSnapshot(istep, event_rec);
+      // summed over the times a module is run again (stepping back)
+      (*fEVGTime)[istep] = TMath::Max(0., (*fEVGTime)[istep]) + dt;
+
+      // the module may have rejected the event without an exception
+      // (see GHepRecord::Reject()): stop the thread right away
+      if(event_rec->IsRejected()) {
+        if(event_rec->Accept()) {
+          LOG("EventGenerator", pWARN)
+            << "An unphysical event was generated and was accepted by the user";
+          break;
+        }
+        LOG("EventGenerator", pWARN)
+          << "An unphysical event was generated and was rejected";
+        ffwd = true;
+        has_control = false;
+      }
     }
-    catch (EVGThreadException exception)
+    catch (const EVGThreadException & exception)
     {
       LOG("EventGenerator", pNOTICE)
            << "An exception was thrown and caught by EventGenerator!";
       LOG("EventGenerator", pNOTICE) << exception;
 
+      control.Copy(exception);
+      has_control = true;
+    }
+
+    if(has_control)
+    {
       nexceptions++;
       if ( nexceptions > kMaxEVGThreadExceptions ) {
          LOG("EventGenerator", pFATAL)
@@ -123,7 +176,6 @@ void EventGenerator::ProcessEventRecord(GHepRecord * event_rec) const
          LOG("EventGenerator", pFATAL) << "Event : \n" << *event_rec ;
          exit(1);
       }
-
       //
       // What should I do with this exception?
       // Check whether the user wants to get this unphysical event anyway
@@ -143,53 +195,87 @@ void EventGenerator::ProcessEventRecord(GHepRecord * event_rec) const
           << "An unphysical event was generated and was rejected";
       }
 
-      // now, follow instructions contained in the exception itself
+      // now, follow the instructions
 
       // make sure we are not asked to go at both directions...
-      assert( !(exception.FastForward() && exception.StepBack()) );
+      assert( !(control.FastForward() && control.StepBack()) );
 
-      ffwd = exception.FastForward();
-      if(exception.StepBack()) {
+      ffwd = control.FastForward();
+      if(control.StepBack()) {
 
          // get return step (if return_step > current_step just ignore it)
-         if(exception.ReturnStep() >= 0 && exception.ReturnStep() <= istep) {
+         if(control.ReturnStep() >= 0 && control.ReturnStep() <= istep) {
 
-           int rstep = exception.ReturnStep();
+           int rstep = control.ReturnStep();
            LOG("EventGenerator", pNOTICE)
                << "Return at processing step " << rstep;
-           advance(miter, rstep-istep-1);
            istep = rstep;
 
            // restore the event record as it was just before the processing
            // step we are about to return to
            LOG("EventGenerator", pNOTICE)
                   << "Restoring GHEP as it was just before the return step";
-           event_rec->ResetRecord();
            istep--;
-           GHepRecord * snapshot = fRecHistory[istep];
-           fRecHistory.PurgeRecentHistory(istep+1);
-           event_rec->Copy(*snapshot);
+           GHepRecordHistory::const_iterator snapshot_iter =
+                                                   fRecHistory.find(istep);
+           if(snapshot_iter == fRecHistory.end() || !snapshot_iter->second) {
+             // the module did not declare it may step back (see
+             // EventRecordVisitorI::MayStepBack) or asked to return to a
+             // step whose snapshot is not kept: give up on this event
+             LOG("EventGenerator", pERROR)
+               << "No GHEP snapshot kept for processing step: " << istep
+               << " - Can not step back. Flagging the event as unphysical";
+             event_rec->EventFlags()->SetBitNumber(kGenericErr, true);
+             ffwd = true;
+             istep = rstep;
+           } else {
+             GHepRecord * snapshot = snapshot_iter->second;
+             fRecHistory.PurgeRecentHistory(istep+1);
+             event_rec->Copy(*snapshot);
+           }
          } // valid-return-step
       } // step-back
-    } // catch exception
+    } // thread control
+
+    if(ffwd) {
+      LOG("EventGenerator", pNOTICE)
+           << "Fast Forward flag was set - Skipping all remaining steps!";
+      ModuleTimingStats::Instance()->AddRejection(
+                                fTimingId, imodule, RejectionReason(event_rec));
+      break;
+    }
 
     istep++;
   }
 
   LOG("EventGenerator", pNOTICE)
               << utils::print::PrintFramedMesg("Thread Summary",0,'*');
-  LOG("EventGenerator", pNOTICE)
+  if(ffwd) {
+    LOG("EventGenerator", pNOTICE)
+           << "The EventRecord was rejected by an EventRecordVisitor";
+  } else {
+    LOG("EventGenerator", pNOTICE)
            << "The EventRecord was visited by all EventRecordVisitors";
+  }
 
   LOG("EventGenerator", pINFO) << "** Event generation timing info **";
-  istep=0;
-  for(miter = fEVGModuleVec->begin();
-                               miter != fEVGModuleVec->end(); ++miter){
-    const EventRecordVisitorI * visitor = *miter;
-
+  for(istep = 0; istep < nsteps; istep++) {
     BLOG("EventGenerator", pINFO)
-       << "module " << visitor->Id().Key() << " -> ~"
-                        << TMath::Max(0.,(*fEVGTime)[istep++]) << " s";
+       << "module " << fSteps[istep].key << " -> ~"
+                        << TMath::Max(0.,(*fEVGTime)[istep]) << " s";
+  }
+
+  //-- Add the module timing to the job statistics
+  ModuleTimingStats::Instance()->Add(fTimingId, *fEVGTime);
+
+  //-- Add the module timing to the generation cost of the current event
+  //   (summed over all attempts to generate it)
+  EventGenCost & cost = EventGenCost::Current();
+  cost.evgen   = this->Id().Key();
+  cost.channel = event_rec->Summary()->AsString();
+  cost.modtime.resize(fEVGTime->size(), 0.);
+  for(unsigned int is = 0; is < fEVGTime->size(); is++) {
+    cost.modtime[is] += TMath::Max(0., (*fEVGTime)[is]);
   }
   LOG("EventGenerator", pNOTICE) << "Done generating event!";
 }
@@ -201,6 +287,7 @@ const InteractionListGeneratorI * EventGenerator::IntListGenerator(void) const
 //___________________________________________________________________________
 const XSecAlgorithmI * EventGenerator::CrossSectionAlg(void) const
 {
+  this->LoadModules();
   return fXSecModel;
 }
 //___________________________________________________________________________
@@ -226,12 +313,13 @@ const GVldContext & EventGenerator::ValidityContext(void) const
 //___________________________________________________________________________
 void EventGenerator::Init(void)
 {
-  fWatch        = new TStopwatch;
+  fTimingId     = -1;
   fVldContext   = 0;
-  fEVGModuleVec = 0;
   fEVGTime      = 0;
   fXSecModel    = 0;
   fIntListGen   = 0;
+  fMayStepBack  = true;
+  fModulesLoaded = false;
 
   fFiltUnphysMask = new TBits(GHepFlags::NFlags());
   fFiltUnphysMask->ResetAllBits(false);
@@ -254,7 +342,6 @@ void EventGenerator::Init(void)
 //___________________________________________________________________________
 void EventGenerator::LoadConfig(void)
 {
-  if(fEVGModuleVec) delete fEVGModuleVec;
   if(fEVGTime)      delete fEVGTime;
   if(fVldContext)   delete fVldContext;
 
@@ -275,9 +362,50 @@ void EventGenerator::LoadConfig(void)
   }
   assert(nsteps>0);
 
-  fEVGModuleVec = new vector<const EventRecordVisitorI *> (nsteps);
-  fEVGTime      = new vector<double>(nsteps);
+  fSteps.assign(nsteps, Step());
+  fEVGTime = new vector<double>(nsteps, 0.);
+
+  //-- load the interaction list generator
+  RgKey ikey = "ILstGen";
+  RgAlg ialg ;
+  GetParam( ikey, ialg ) ;
+  LOG("EventGenerator", pINFO) 
+      << " -- Loading the interaction list generator: " << ialg;
+  fIntListGen = 
+      dynamic_cast<const InteractionListGeneratorI *> (this->SubAlg(ikey));
+  assert(fIntListGen);
+
+  //-- the modules & the cross section model are loaded on first use
+  fXSecModel     = 0;
+  fModulesLoaded = false;
+  fTimingId      = -1;
+}
+//___________________________________________________________________________
+void EventGenerator::LoadModules(void) const
+{
+// Loads the event generation modules & the cross section model when they
+// are first needed (to generate an event, or for the cross sections of the
+// interactions in the list of this thread). So, the (often numerous) models
+// of threads whose interaction lists are empty for all initial states of
+// a job, are never instantiated and configured.
+
+  // checked first without the lock, which would otherwise serialize all
+  // the generation threads at each call
+  if(fModulesLoaded.load(std::memory_order_acquire)) return;
 
+  AlgFactory::Lock lock;
+  if(fModulesLoaded.load(std::memory_order_relaxed)) return;
+
+  HotScope configuring(false);
+  StartupProfile::Scope phase("EventGenerator::LoadModules");
+
+// The steps are resolved here, once: each keeps its module, key & messages,
+// and the loop of ProcessEventRecord() only calls the modules in turn.
+
+  int nsteps = fSteps.size();
+  string mesgh = "Event generation thread: " + this->Id().Key() +
+                 " -> Running module: ";
+  vector<string> modules(nsteps);
   for(int istep = 0; istep < nsteps; istep++) {
 
     ostringstream keystream;
@@ -293,19 +421,25 @@ void EventGenerator::LoadConfig(void)
     const EventRecordVisitorI * visitor =
                dynamic_cast<const EventRecordVisitorI *>(this->SubAlg(key));
 
-    (*fEVGModuleVec)[istep] = visitor;
+    Step & step   = fSteps[istep];
+    step.visitor  = visitor;
+    step.key      = visitor ? visitor->Id().Key() : temp_alg.name;
+    step.banner   = utils::print::PrintFramedMesg(mesgh + step.key, 0, '~');
     (*fEVGTime)[istep]      = 0;
+    modules[istep]          = temp_alg.name + "/" + temp_alg.config;
   }
+  fTimingId = ModuleTimingStats::Instance()->Register(this->Id().Key(), modules);
 
-  //-- load the interaction list generator
-  RgKey ikey = "ILstGen";
-  RgAlg ialg ;
-  GetParam( ikey, ialg ) ;
-  LOG("EventGenerator", pINFO) 
-      << " -- Loading the interaction list generator: " << ialg;
-  fIntListGen = 
-      dynamic_cast<const InteractionListGeneratorI *> (this->SubAlg(ikey));
-  assert(fIntListGen);
+  //-- check whether any module may ask to step back in the processing
+  //   sequence (only then snapshots of the event record need to be kept)
+  fMayStepBack = false;
+  for(int istep = 0; istep < nsteps; istep++) {
+    const EventRecordVisitorI * visitor = fSteps[istep].visitor;
+    if(visitor && visitor->MayStepBack()) fMayStepBack = true;
+  }
+  LOG("EventGenerator", pINFO)
+      << " -- Keeping event record snapshots for stepping back? "
+      << utils::print::BoolAsYNString(fMayStepBack);
 
   //-- load the cross section model
   RgKey xkey    = "XSecModel@" + this->Id().Key();
@@ -317,6 +451,8 @@ void EventGenerator::LoadConfig(void)
     dynamic_cast<const XSecAlgorithmI *> (
       this -> SubAlg( xkey ) ) ;
   assert(fXSecModel);
+
+  fModulesLoaded.store(true, std::memory_order_release);
 }
 //___________________________________________________________________________
 
@@ -8,8 +8,11 @@
 */
 //____________________________________________________________________________
 
+#include <utility>
+
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/EventGen/EventRecordVisitorI.h"
+#include "Framework/EventGen/EventRecordPool.h"
 #include "Framework/GHEP/GHepStatus.h"
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/Messenger/Messenger.h"
@@ -43,11 +46,29 @@ EventRecord::EventRecord(const EventRecord & record) :
 GHepRecord(record)
 {
 
+}
+//___________________________________________________________________________
+EventRecord::EventRecord(EventRecord && record) :
+GHepRecord(std::move(record))
+{
+
 }
 //___________________________________________________________________________
 EventRecord::~EventRecord()
 {
 
+}
+//___________________________________________________________________________
+EventRecord & EventRecord::operator = (const EventRecord & record)
+{
+  GHepRecord::operator = (record);
+  return (*this);
+}
+//___________________________________________________________________________
+EventRecord & EventRecord::operator = (EventRecord && record)
+{
+  GHepRecord::operator = (std::move(record));
+  return (*this);
 }
 //___________________________________________________________________________
 void EventRecord::AcceptVisitor(EventRecordVisitorI * visitor)
@@ -55,6 +76,14 @@ void EventRecord::AcceptVisitor(EventRecordVisitorI * visitor)
   visitor->ProcessEventRecord(this);
 }
 //___________________________________________________________________________
+void EventRecord::Release(void)
+{
+// The record is recycled and may be handed out again by the pool: it must
+// not be used by the caller after this call
+
+  EventRecordPool::Instance()->Release(this);
+}
+//___________________________________________________________________________
 void EventRecord::Copy(const EventRecord & record)
 {
   try {
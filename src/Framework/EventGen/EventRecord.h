@@ -43,9 +43,14 @@ public :
   EventRecord();
   EventRecord(int size);
   EventRecord(const EventRecord & record);
+  EventRecord(EventRecord && record);
   ~EventRecord();
 
+  EventRecord & operator = (const EventRecord & record);
+  EventRecord & operator = (EventRecord && record);
+
   void AcceptVisitor (EventRecordVisitorI * visitor);
+  void Release       (void); ///< hand the record back to the EventRecordPool (instead of deleting it)
   virtual void Copy          (const EventRecord & record);
   virtual void Print         (ostream & stream) const;
 
@@ -0,0 +1,109 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <mutex>
+
+#include "Framework/EventGen/EventRecordPool.h"
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/Messenger/Messenger.h"
+
+using namespace genie;
+
+// guards the free list (records may be released by several worker threads)
+static std::mutex gEventRecordPoolMutex;
+
+//____________________________________________________________________________
+EventRecordPool * EventRecordPool::fInstance = 0;
+//____________________________________________________________________________
+EventRecordPool::EventRecordPool()
+{
+  fInstance = 0;
+  fCapacity = 64;
+}
+//____________________________________________________________________________
+EventRecordPool::~EventRecordPool()
+{
+  vector<EventRecord *>::iterator iter = fFree.begin();
+  for( ; iter != fFree.end(); ++iter) {
+    delete *iter;
+  }
+  fFree.clear();
+
+  fInstance = 0;
+}
+//____________________________________________________________________________
+EventRecordPool * EventRecordPool::Instance()
+{
+  std::lock_guard<std::mutex> lock(gEventRecordPoolMutex);
+
+  if(fInstance == 0) {
+    static EventRecordPool::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new EventRecordPool;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+EventRecord * EventRecordPool::Acquire(void)
+{
+  {
+    std::lock_guard<std::mutex> lock(gEventRecordPoolMutex);
+    if(!fFree.empty()) {
+      EventRecord * event = fFree.back();
+      fFree.pop_back();
+      return event;
+    }
+  }
+  return new EventRecord;
+}
+//____________________________________________________________________________
+void EventRecordPool::Release(EventRecord * event)
+{
+  if(!event) return;
+
+  // empty the record outside the lock, keeping its memory
+  event->RecycleRecord();
+
+  {
+    std::lock_guard<std::mutex> lock(gEventRecordPoolMutex);
+    if(fFree.size() < fCapacity) {
+      fFree.push_back(event);
+      return;
+    }
+  }
+  delete event;
+}
+//____________________________________________________________________________
+void EventRecordPool::SetCapacity(unsigned int n)
+{
+  LOG("EventRecordPool", pINFO)
+     << "Keeping up to " << n << " released event records for re-use";
+
+  std::lock_guard<std::mutex> lock(gEventRecordPoolMutex);
+  fCapacity = n;
+  this->Trim();
+}
+//____________________________________________________________________________
+unsigned int EventRecordPool::NFree(void) const
+{
+  std::lock_guard<std::mutex> lock(gEventRecordPoolMutex);
+  return fFree.size();
+}
+//____________________________________________________________________________
+void EventRecordPool::Trim(void)
+{
+// delete records in excess of the pool capacity (called with the lock held)
+
+  while(fFree.size() > fCapacity) {
+    delete fFree.back();
+    fFree.pop_back();
+  }
+}
+//____________________________________________________________________________
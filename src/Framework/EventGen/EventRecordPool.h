@@ -0,0 +1,77 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::EventRecordPool
+
+\brief    A pool of recyclable EventRecord objects.
+
+          Instead of deleting a generated event, the client may Release() it
+          back to the pool. The next Acquire() hands back the same record,
+          emptied by GHepRecord::RecycleRecord() but with all its memory
+          (particle slots and their 4-vectors, summary, vertex, flags) kept.
+          After a few events, the generation of a new event record no longer
+          allocates any memory on the heap.
+
+          The pool is thread-safe. A released record must not be used again
+          by the client.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _EVENT_RECORD_POOL_H_
+#define _EVENT_RECORD_POOL_H_
+
+#include <vector>
+
+using std::vector;
+
+namespace genie {
+
+class EventRecord;
+
+class EventRecordPool
+{
+public:
+  static EventRecordPool * Instance(void);
+
+  EventRecord * Acquire  (void);                ///< get an empty record
+  void          Release  (EventRecord * event); ///< return a record for re-use
+
+  void          SetCapacity (unsigned int n);   ///< max number of kept records
+  unsigned int  Capacity    (void) const { return fCapacity; }
+  unsigned int  NFree       (void) const;       ///< number of kept records
+
+private:
+  EventRecordPool();
+  EventRecordPool(const EventRecordPool & pool);
+  virtual ~EventRecordPool();
+
+  void Trim (void);
+
+  static EventRecordPool * fInstance;
+
+  vector<EventRecord *> fFree;     ///< released records, ready for re-use
+  unsigned int          fCapacity; ///< max number of kept records
+
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (EventRecordPool::fInstance !=0) {
+            delete EventRecordPool::fInstance;
+            EventRecordPool::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+
+#endif // _EVENT_RECORD_POOL_H_
@@ -36,6 +36,19 @@ public :
 
   virtual void ProcessEventRecord(GHepRecord * event_rec) const = 0;
 
+  //-- routine rejections are posted in the record rather than thrown:
+  //   GHepRecord::Reject() ends the event generation thread and
+  //   GHepRecord::StepBack() asks to return at an earlier processing step.
+  //   EVGThreadExceptions (with the same instructions) are kept for the
+  //   exceptional errors.
+
+  //-- does the module ever ask to step back in the processing sequence
+  //   (by an EVGThreadException or GHepRecord::StepBack())? If none of the
+  //   modules of an event generation thread does, no event record
+  //   snapshots need to be kept.
+
+  virtual bool MayStepBack(void) const { return false; }
+
 protected :
 
   EventRecordVisitorI();
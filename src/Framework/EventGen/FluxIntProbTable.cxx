@@ -0,0 +1,365 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "Framework/EventGen/FluxIntProbTable.h"
+#include "Framework/Conventions/Controls.h"
+#include "Framework/Messenger/Messenger.h"
+
+using namespace genie;
+
+namespace {
+
+  const char      kMagic[8]      = { 'G','F','L','X','P','R','O','B' };
+  const UInt_t    kByteOrderMark = 0x01020304;
+  const UInt_t    kVersion       = 1;
+  const ULong64_t kAlign         = 64;     // column alignment (bytes)
+  const Long64_t  kChunk         = 65536;  // entries written at a time
+  const UInt_t    kMaxSpecies    = 16;
+
+  struct Header_t {
+    char      magic[8];
+    UInt_t    bom;
+    UInt_t    version;
+    ULong64_t nentries;
+    Double_t  maxprob;
+    UInt_t    nspecies;
+    Int_t     pdg[kMaxSpecies];
+    Double_t  sum[kMaxSpecies];
+  };
+
+  enum { kCIndex, kCProb, kCEnu, kCWeight, kCPDG, kNColumns };
+  const UInt_t kWidth[kNColumns] = { 8, 8, 8, 8, 4 };
+
+  // column offsets (from the start of the file) for the input # of entries
+  void Offsets(ULong64_t nentries, ULong64_t * offset)
+  {
+    ULong64_t pos = sizeof(Header_t);
+    for (int icol = 0; icol < kNColumns; ++icol) {
+      pos = ((pos + kAlign - 1) / kAlign) * kAlign;
+      offset[icol] = pos;
+      pos += kWidth[icol] * nentries;
+    }
+    offset[kNColumns] = pos;
+  }
+}
+
+//____________________________________________________________________________
+FluxIntProbTable::FluxIntProbTable() :
+fNEntries(0),
+fSorted(true),
+fMaxProb(0),
+fData(0),
+fSize(0),
+fColIndex(0),
+fColProb(0),
+fColEnu(0),
+fColWeight(0),
+fColPDG(0)
+{
+
+}
+//____________________________________________________________________________
+FluxIntProbTable::~FluxIntProbTable()
+{
+  this->Unmap();
+}
+//____________________________________________________________________________
+bool FluxIntProbTable::IsBinaryFile(const string & fname)
+{
+  const string suffix = ".gflxprob";
+  return ( fname.size() > suffix.size() &&
+           fname.compare(fname.size()-suffix.size(), suffix.size(), suffix) == 0 );
+}
+//____________________________________________________________________________
+void FluxIntProbTable::Clear(void)
+{
+  this->Unmap();
+  fEntries.clear();
+  fNEntries = 0;
+  fSorted   = true;
+  fMaxProb  = 0;
+  fSumProbs.clear();
+}
+//____________________________________________________________________________
+void FluxIntProbTable::Add(
+   Long64_t index, double prob, double enu, double weight, int pdg)
+{
+  // a mapped table is read-only: copy it into memory first
+  if(fData) {
+    FluxIntProbTable mapped;
+    std::swap(mapped.fData, fData);
+    std::swap(mapped.fSize, fSize);
+    mapped.fNEntries  = fNEntries;
+    mapped.fColIndex  = fColIndex;
+    mapped.fColProb   = fColProb;
+    mapped.fColEnu    = fColEnu;
+    mapped.fColWeight = fColWeight;
+    mapped.fColPDG    = fColPDG;
+    this->Clear();
+    this->Merge(mapped);
+  }
+
+  // check for non-negative probabilities & weights
+  assert(prob  +controls::kASmallNum > 0.0);
+  assert(weight+controls::kASmallNum > 0.0);
+
+  Entry_t entry;
+  entry.index  = index;
+  entry.prob   = prob;
+  entry.enu    = enu;
+  entry.weight = weight;
+  entry.pdg    = pdg;
+  if(fNEntries > 0 && index < fEntries.back().index) fSorted = false;
+  fEntries.push_back(entry);
+  fNEntries = fEntries.size();
+}
+//____________________________________________________________________________
+void FluxIntProbTable::Merge(const FluxIntProbTable & table)
+{
+  fEntries.reserve(fEntries.size() + table.NEntries());
+  for(Long64_t irow = 0; irow < table.NEntries(); irow++) {
+    this->Add(table.Index(irow), table.Prob(irow), table.Enu(irow),
+              table.Weight(irow), table.PDG(irow));
+  }
+}
+//____________________________________________________________________________
+void FluxIntProbTable::Sort(void)
+{
+// Sort the entries by flux index, drop duplicate entries (eg. from merging
+// overlapping tables) and compute the table summary
+
+  if(fData) return; // mapped tables are sorted at writing
+
+  struct LessIndex {
+    bool operator() (const Entry_t & a, const Entry_t & b) const
+    { return a.index < b.index; }
+  };
+  if(!fSorted) std::stable_sort(fEntries.begin(), fEntries.end(), LessIndex());
+
+  size_t nkeep = 0;
+  for(size_t i = 0; i < fEntries.size(); i++) {
+    if(nkeep > 0 && fEntries[i].index == fEntries[nkeep-1].index) continue;
+    fEntries[nkeep++] = fEntries[i];
+  }
+  if(nkeep < fEntries.size()) {
+    LOG("FluxIntProb", pWARN)
+      << "Dropped " << fEntries.size() - nkeep
+      << " entries with a duplicate flux index";
+    fEntries.resize(nkeep);
+  }
+  fNEntries = fEntries.size();
+  fSorted   = true;
+
+  fMaxProb = 0;
+  fSumProbs.clear();
+  for(size_t i = 0; i < fEntries.size(); i++) {
+    const Entry_t & entry = fEntries[i];
+    fMaxProb = std::max(fMaxProb, entry.prob);
+    fSumProbs[entry.pdg] += entry.prob * entry.weight;
+  }
+}
+//____________________________________________________________________________
+Long64_t FluxIntProbTable::Find(Long64_t index) const
+{
+  if(!fSorted) {
+    LOG("FluxIntProb", pERROR) << "Can not look-up an unsorted table";
+    return -1;
+  }
+  Long64_t lo = 0;
+  Long64_t hi = fNEntries;
+  while(lo < hi) {
+    Long64_t mid = lo + (hi - lo) / 2;
+    if(this->Index(mid) < index) lo = mid + 1;
+    else hi = mid;
+  }
+  return (lo < fNEntries && this->Index(lo) == index) ? lo : -1;
+}
+//____________________________________________________________________________
+Long64_t FluxIntProbTable::Index(Long64_t irow) const
+{
+  return (fData) ? fColIndex[irow] : fEntries[irow].index;
+}
+//____________________________________________________________________________
+double FluxIntProbTable::Prob(Long64_t irow) const
+{
+  return (fData) ? fColProb[irow] : fEntries[irow].prob;
+}
+//____________________________________________________________________________
+double FluxIntProbTable::Enu(Long64_t irow) const
+{
+  return (fData) ? fColEnu[irow] : fEntries[irow].enu;
+}
+//____________________________________________________________________________
+double FluxIntProbTable::Weight(Long64_t irow) const
+{
+  return (fData) ? fColWeight[irow] : fEntries[irow].weight;
+}
+//____________________________________________________________________________
+int FluxIntProbTable::PDG(Long64_t irow) const
+{
+  return (fData) ? fColPDG[irow] : fEntries[irow].pdg;
+}
+//____________________________________________________________________________
+bool FluxIntProbTable::Write(const string & fname) const
+{
+  if(!fSorted) {
+    LOG("FluxIntProb", pERROR) << "Can not write an unsorted table";
+    return false;
+  }
+  if(fSumProbs.size() > kMaxSpecies) {
+    LOG("FluxIntProb", pERROR)
+      << "Can not write a table of more than " << kMaxSpecies
+      << " neutrino species";
+    return false;
+  }
+
+  Header_t header;
+  memset(&header, 0, sizeof(Header_t));
+  memcpy(header.magic, kMagic, 8);
+  header.bom      = kByteOrderMark;
+  header.version  = kVersion;
+  header.nentries = fNEntries;
+  header.maxprob  = fMaxProb;
+  header.nspecies = fSumProbs.size();
+  map<int, double>::const_iterator it = fSumProbs.begin();
+  for(UInt_t i = 0; it != fSumProbs.end(); ++it, ++i) {
+    header.pdg[i] = it->first;
+    header.sum[i] = it->second;
+  }
+
+  ULong64_t offset[kNColumns+1];
+  Offsets(fNEntries, offset);
+
+  FILE * fp = fopen(fname.c_str(), "wb");
+  if(!fp) {
+    LOG("FluxIntProb", pERROR) << "Can not open " << fname << " for writing";
+    return false;
+  }
+  bool isok = ( fwrite(&header, sizeof(Header_t), 1, fp) == 1 );
+
+  // fill the columns, a chunk of entries at a time
+  vector<char> buffer(kChunk * 8);
+  for(int icol = 0; isok && icol < kNColumns; ++icol) {
+    isok &= ( fseeko(fp, offset[icol], SEEK_SET) == 0 );
+    for(Long64_t first = 0; isok && first < fNEntries; first += kChunk) {
+      Long64_t n = std::min(kChunk, fNEntries - first);
+      for(Long64_t i = 0; i < n; ++i) {
+        char * dest = &buffer[i * kWidth[icol]];
+        Long64_t irow = first + i;
+        Long64_t lval = 0;
+        double   dval = 0;
+        Int_t    ival = 0;
+        switch(icol) {
+          case kCIndex:  lval = this->Index(irow);  memcpy(dest, &lval, 8); break;
+          case kCProb:   dval = this->Prob(irow);   memcpy(dest, &dval, 8); break;
+          case kCEnu:    dval = this->Enu(irow);    memcpy(dest, &dval, 8); break;
+          case kCWeight: dval = this->Weight(irow); memcpy(dest, &dval, 8); break;
+          default:       ival = this->PDG(irow);    memcpy(dest, &ival, 4); break;
+        }
+      }
+      isok &= ( fwrite(&buffer[0], kWidth[icol], n, fp) == (size_t)n );
+    }
+  }
+  isok &= ( fclose(fp) == 0 );
+
+  if(!isok) {
+    LOG("FluxIntProb", pERROR) << "Failed writing " << fname;
+    return false;
+  }
+  LOG("FluxIntProb", pNOTICE)
+    << "Wrote " << fNEntries << " flux interaction probabilities to " << fname;
+  return true;
+}
+//____________________________________________________________________________
+bool FluxIntProbTable::Open(const string & fname)
+{
+  this->Clear();
+
+  int fd = open(fname.c_str(), O_RDONLY);
+  if(fd < 0) {
+    LOG("FluxIntProb", pERROR) << "Can not open " << fname;
+    return false;
+  }
+  struct stat st;
+  if(fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(Header_t)) {
+    LOG("FluxIntProb", pERROR)
+      << fname << " is not a flux interaction probability file";
+    close(fd);
+    return false;
+  }
+  void * addr = mmap(0, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if(addr == MAP_FAILED) {
+    LOG("FluxIntProb", pERROR) << "Can not map " << fname << " into memory";
+    return false;
+  }
+  fData = static_cast<char *>(addr);
+  fSize = st.st_size;
+
+  const Header_t * header = reinterpret_cast<const Header_t *>(fData);
+  ULong64_t offset[kNColumns+1];
+  Offsets(header->nentries, offset);
+  bool isok = ( memcmp(header->magic, kMagic, 8) == 0 &&
+                header->bom == kByteOrderMark &&
+                header->version == kVersion &&
+                header->nspecies <= kMaxSpecies );
+  if(!isok) {
+    LOG("FluxIntProb", pERROR) << fname
+      << " is not a flux interaction probability file (of this version / byte order)";
+    this->Unmap();
+    return false;
+  }
+  if(header->nentries > 0 && offset[kNColumns] > fSize) {
+    LOG("FluxIntProb", pERROR) << fname << " is truncated";
+    this->Unmap();
+    return false;
+  }
+
+  fNEntries  = header->nentries;
+  fSorted    = true;
+  fMaxProb   = header->maxprob;
+  for(UInt_t i = 0; i < header->nspecies; i++) {
+    fSumProbs[header->pdg[i]] = header->sum[i];
+  }
+  fColIndex  = reinterpret_cast<const Long64_t *>(fData + offset[kCIndex ]);
+  fColProb   = reinterpret_cast<const double   *>(fData + offset[kCProb  ]);
+  fColEnu    = reinterpret_cast<const double   *>(fData + offset[kCEnu   ]);
+  fColWeight = reinterpret_cast<const double   *>(fData + offset[kCWeight]);
+  fColPDG    = reinterpret_cast<const Int_t    *>(fData + offset[kCPDG   ]);
+
+  LOG("FluxIntProb", pNOTICE)
+    << "Mapped " << fname << ": " << fNEntries
+    << " flux interaction probabilities";
+  return true;
+}
+//____________________________________________________________________________
+void FluxIntProbTable::Unmap(void)
+{
+  if(fData) munmap(fData, fSize);
+  fData      = 0;
+  fSize      = 0;
+  fColIndex  = 0;
+  fColProb   = 0;
+  fColEnu    = 0;
+  fColWeight = 0;
+  fColPDG    = 0;
+  fNEntries  = fEntries.size();
+}
+//____________________________________________________________________________
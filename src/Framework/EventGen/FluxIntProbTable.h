@@ -0,0 +1,116 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::FluxIntProbTable
+
+\brief    The table of pre-computed flux interaction probabilities used by
+          GMCJDriver (see GMCJDriver::PreCalcFluxProbabilities()), relating
+          the index of each flux entry to its interaction probability, energy,
+          weight and neutrino code.
+
+          The table is either built in memory (by adding, merging and finally
+          sorting entries) or mapped read-only into memory from a compact
+          binary file, so that a job can start generating events from a
+          pre-built table of any size at once. Look-ups are binary searches
+          over the (sorted) flux index column.
+
+          Binary file layout (native byte order, checked through the header):
+
+            header   : char magic[8] "GFLXPROB", uint32 byte order mark,
+                       uint32 version, uint64 # of entries, double max prob,
+                       uint32 # of species, int32 pdg[16], double sum[16]
+                       (sum of weight x prob for each species)
+            columns  : index (int64), prob, energy, weight (double), pdg (int32)
+                       each aligned to 64 bytes
+
+          Files named *.gflxprob are read / written in this format by the
+          GMCJDriver (instead of the gFlxIntProb ROOT tree).
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _FLUX_INT_PROB_TABLE_H_
+#define _FLUX_INT_PROB_TABLE_H_
+
+#include <string>
+#include <vector>
+#include <map>
+
+#include <Rtypes.h>
+
+using std::string;
+using std::vector;
+using std::map;
+
+namespace genie {
+
+class FluxIntProbTable {
+
+public :
+  FluxIntProbTable();
+ ~FluxIntProbTable();
+
+  //! Is the input file name one of a binary table (*.gflxprob)?
+  static bool IsBinaryFile (const string & fname);
+
+  // build in memory
+  void     Clear    (void);
+  void     Add      (Long64_t index, double prob, double enu, double weight, int pdg);
+  void     Merge    (const FluxIntProbTable & table);  ///< append all entries of the input table
+  void     Sort     (void);                            ///< sort by flux index (needed before look-ups)
+
+  // binary files
+  bool     Write    (const string & fname) const;      ///< write a (sorted) table
+  bool     Open     (const string & fname);            ///< map a table into memory
+  bool     IsMapped (void) const { return fData != 0; }
+
+  // access
+  bool     IsSorted (void) const { return fSorted;   }
+  Long64_t NEntries (void) const { return fNEntries; }
+  Long64_t Find     (Long64_t index) const;            ///< row of the input flux index (-1 if not found)
+  Long64_t Index    (Long64_t irow) const;
+  double   Prob     (Long64_t irow) const;
+  double   Enu      (Long64_t irow) const;
+  double   Weight   (Long64_t irow) const;
+  int      PDG      (Long64_t irow) const;
+
+  // summary (computed when sorting, or read from the binary file header)
+  double                   MaxProb  (void) const { return fMaxProb; }
+  const map<int, double> & SumProbs (void) const { return fSumProbs; }
+
+private:
+
+  //! In-memory table entry
+  struct Entry_t {
+    Long64_t index;
+    double   prob;
+    double   enu;
+    double   weight;
+    Int_t    pdg;
+  };
+
+  void     Unmap    (void);
+
+  vector<Entry_t>    fEntries;   ///< in-memory entries
+  Long64_t           fNEntries;  ///< # of entries
+  bool               fSorted;    ///< sorted by flux index?
+  double             fMaxProb;   ///< max interaction probability
+  map<int, double>   fSumProbs;  ///< sum of weight x prob for each neutrino species
+  char *             fData;      ///< start of the mapping (null if in memory)
+  ULong64_t          fSize;      ///< size of the mapping
+  const Long64_t *   fColIndex;  ///< mapped columns
+  const double *     fColProb;
+  const double *     fColEnu;
+  const double *     fColWeight;
+  const Int_t *      fColPDG;
+};
+
+}      // genie namespace
+#endif // _FLUX_INT_PROB_TABLE_H_
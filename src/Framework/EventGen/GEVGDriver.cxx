@@ -10,6 +10,8 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <map>
+#include <mutex>
 #include <sstream>
 
 #include <TSystem.h>
@@ -33,16 +35,29 @@
 #include "Framework/GHEP/GHepFlags.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/EnergyMemo.h"
 #include "Framework/Numerical/Spline.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/Utils/RunOpt.h"
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/StartupProfile.h"
+#include "Framework/Utils/TraceScope.h"
+#include "Framework/Utils/Cache.h"
+#include "Framework/Utils/CacheBranchFx.h"
 
 using std::ostringstream;
 
 using namespace genie;
+
+namespace {
+  // interaction -> generator maps, by event generator list, tune and initial
+  // state, shared by all drivers (and threads)
+  map<string, std::shared_ptr<const InteractionGeneratorMap> > gIntGenMaps;
+  std::mutex gIntGenMapsMutex;
+}
 using namespace genie::controls;
 
 //____________________________________________________________________________
@@ -94,7 +109,7 @@ void GEVGDriver::Init(void)
   // an "interaction" -> "generator" associative contained built for all
   // simulated interactions (from the loaded Event Generators and for the
   // input initial state)
-  fIntGenMap = 0;
+  fIntGenMap.reset();
 
   // A spline describing the sum of all interaction cross sections given an
   // initial state (the init state with which this driver was configured).
@@ -124,7 +139,7 @@ void GEVGDriver::CleanUp(void)
   if (fInitState)        delete fInitState;
   if (fEvGenList)        delete fEvGenList;
   if (fIntSelector)      delete fIntSelector;
-  if (fIntGenMap)        delete fIntGenMap;
+  fIntGenMap.reset();
   if (fXSecSumSpl)       delete fXSecSumSpl;
 }
 //___________________________________________________________________________
@@ -191,12 +206,33 @@ void GEVGDriver::BuildInteractionGeneratorMap(void)
 //! Map each possible interaction, for the given initial state, to one
 //! of the generators loaded up
 
+  // maps already built for this initial state, event generator list and
+  // tune are re-used: they are not modified after being built
+  TuneId * tune = RunOpt::Instance()->Tune();
+  string key = fEventGenList + "/" + (tune ? tune->Name() : string("")) +
+               "/" + fInitState->AsString();
+
+  std::lock_guard<std::mutex> lock(gIntGenMapsMutex);
+
+  map<string, std::shared_ptr<const InteractionGeneratorMap> >::const_iterator
+                                            iter = gIntGenMaps.find(key);
+  if(iter != gIntGenMaps.end()) {
+    LOG("GEVGDriver", pINFO)
+         << "Re-using the interaction -> generator associations of " << key;
+    fIntGenMap = iter->second;
+    return;
+  }
+
   LOG("GEVGDriver", pINFO)
          << "Building the interaction -> generator associations...";
 
-  fIntGenMap = new InteractionGeneratorMap;
-  fIntGenMap->UseGeneratorList(fEvGenList);
-  fIntGenMap->BuildMap(*fInitState);
+  InteractionGeneratorMap * intgenmap = new InteractionGeneratorMap;
+  intgenmap->UseGeneratorList(fEvGenList);
+  intgenmap->BuildMap(*fInitState);
+  intgenmap->UseGeneratorList(0); // the list is owned by this driver only
+
+  fIntGenMap.reset(intgenmap);
+  gIntGenMaps[key] = fIntGenMap;
 
   string mesgh = "Interaction -> Generator assignments for Initial State: ";
 
@@ -228,6 +264,9 @@ void GEVGDriver::SetUnphysEventMask(const TBits & mask)
 EventRecord * GEVGDriver::GenerateEvent(const TLorentzVector & nu4p)
 {
   //-- Build initial state information from inputs
+  GTRACE_SCOPE("GEVGDriver::GenerateEvent");
+  EnergyMemo::NewEvent();
+
   LOG("GEVGDriver", pINFO) << "Creating the initial state";
   InitialState init_state(*fInitState);
   init_state.SetProbeP4(nu4p);
@@ -237,7 +276,7 @@ EventRecord * GEVGDriver::GenerateEvent(const TLorentzVector & nu4p)
   //   event record
   LOG("GEVGDriver", pINFO)
      << "Selecting an Interaction & Bootstraping the EventRecord";
-  fCurrentRecord = fIntSelector->SelectInteraction(fIntGenMap, nu4p);
+  fCurrentRecord = fIntSelector->SelectInteraction(fIntGenMap.get(), nu4p);
 
   if(!fCurrentRecord) {
      LOG("GEVGDriver", pWARN)
@@ -293,6 +332,9 @@ EventRecord * GEVGDriver::GenerateEvent(const TLorentzVector & nu4p)
 
   bool unphys = fCurrentRecord->IsUnphysical();
   if(!unphys) {
+     // the start-up is over once the first event is generated
+     StartupProfile::Instance()->Report();
+
      LOG("GEVGDriver", pINFO) << "Returning the current event!";
      fNRecLevel = 0;
      return fCurrentRecord; // The client 'adopts' the event record
@@ -309,7 +351,7 @@ EventRecord * GEVGDriver::GenerateEvent(const TLorentzVector & nu4p)
      } else {
        LOG("GEVGDriver", pWARN)
           << "The generated unphysical event is rejected";
-       delete fCurrentRecord;
+       fCurrentRecord->Release();
        fCurrentRecord = 0;
        fNRecLevel++; // increase the nested level counter
 
@@ -445,6 +487,10 @@ void GEVGDriver::CreateXSecSumSpline(
 // This spline is used, for example, by the GMCJDriver to select a target
 // material out of all the materials in a detector geometry (summing the
 // cross sections again and again proved to be expensive...)
+// The knots are kept in the GENIE cache, keyed by the tune, the event
+// generator list, the initial state and the knot grid. Drivers configured
+// identically re-use them and, if a cache file is in use (--cache-file),
+// so do later jobs.
 
   LOG("GEVGDriver", pINFO)
      << "Creating spline (sum-xsec = f(" << ((inlogE) ? "logE" : "E")
@@ -456,11 +502,33 @@ void GEVGDriver::CreateXSecSumSpline(
   assert(fUseSplines);
   assert(Emin<Emax && Emin>0 && nk>2);
 
-  double logEmin=0, logEmax=0, dE=0;
-
   double * E    = new double[nk];
   double * xsec = new double[nk];
 
+  Cache * cache = Cache::Instance();
+  string key = this->XSecSumSplineKey(nk, Emin, Emax, inlogE);
+
+  CacheBranchFx * cbranch =
+        dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
+
+  if(cbranch && cbranch->Map().size() == (unsigned int) nk) {
+    LOG("GEVGDriver", pINFO)
+       << "Re-using cached sum-xsec spline knots (key: " << key << ")";
+    int i=0;
+    map<double,double>::const_iterator iter = cbranch->Map().begin();
+    for( ; iter != cbranch->Map().end(); ++iter, ++i) {
+      E[i]    = iter->first;
+      xsec[i] = iter->second;
+    }
+    if (fXSecSumSpl) delete fXSecSumSpl;
+    fXSecSumSpl = new Spline(nk, E, xsec);
+    delete [] E;
+    delete [] xsec;
+    return;
+  }
+
+  double logEmin=0, logEmax=0, dE=0;
+
   if(inlogE) {
     logEmin = TMath::Log(Emin);
     logEmax = TMath::Log(Emax);
@@ -479,12 +547,39 @@ void GEVGDriver::CreateXSecSumSpline(
     E[i]    = e;
     xsec[i] = xs;
   }
+
+  if(cbranch) {
+    cbranch->Reset();
+  } else {
+    cbranch = new CacheBranchFx("sum-xsec knots");
+    cache->AddCacheBranch(key, cbranch);
+  }
+  for(int i=0; i<nk; i++) {
+    cbranch->AddValues(E[i], xsec[i]);
+  }
+
   if (fXSecSumSpl) delete fXSecSumSpl;
   fXSecSumSpl = new Spline(nk, E, xsec);
   delete [] E;
   delete [] xsec;
 }
 //___________________________________________________________________________
+string GEVGDriver::XSecSumSplineKey(
+                         int nk, double Emin, double Emax, bool inlogE) const
+{
+  XSecSplineList * xssl = XSecSplineList::Instance();
+
+  ostringstream grid;
+  grid.precision(17);
+  grid << "nk:" << nk << ";E:[" << Emin << "," << Emax << "]"
+       << ((inlogE) ? ";log" : ";lin");
+
+  Cache * cache = Cache::Instance();
+  return cache->CacheBranchKey("GEVGDriver/XSecSum",
+       xssl->CurrentTune() + "/" + fEventGenList,
+       fInitState->AsString() + ";" + grid.str());
+}
+//___________________________________________________________________________
 const Spline * GEVGDriver::XSecSpline(const Interaction * interaction) const
 {
 // Returns the cross section spline for the input interaction as was
@@ -580,6 +675,8 @@ void GEVGDriver::CreateSplines(int nknots, double emax, bool useLogE)
 // It will check for pre-loaded splines and it will skip the creation of the
 // splines it already finds loaded.
 
+  StartupProfile::Scope phase("GEVGDriver::CreateSplines");
+
   LOG("GEVGDriver", pINFO)
        << "Creating (missing) splines with [UseLogE: "
                                              << ((useLogE) ? "ON]" : "OFF]");
@@ -651,7 +748,7 @@ void GEVGDriver::CreateSplines(int nknots, double emax, bool useLogE)
              SLOG("GEVGDriver", pDEBUG)
                << "The spline wasn't loaded at initialization. "
                << "I can build it now but it might take a while...";
-             xsl->CreateSpline(alg, interaction, nknots, Emin, emax);
+             xsl->QueueSpline(alg, interaction, nknots, Emin, emax);
          } else {
              SLOG("GEVGDriver", pDEBUG) << "Spline was found";
          }
@@ -660,6 +757,9 @@ void GEVGDriver::CreateSplines(int nknots, double emax, bool useLogE)
      ilst = 0;
   } // loop over event generators
 
+  // build the queued splines (spread over the XSecSplineList threads)
+  xsl->CreateQueuedSplines();
+
   LOG("GEVGDriver", pINFO) << *xsl; // print list of splines
 
   fUseSplines = true;
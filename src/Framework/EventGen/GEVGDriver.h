@@ -10,6 +10,9 @@
          To set-up MC jobs involving a multitude of possible initial states,
          including arbitrarily complex neutrino flux and detector geometry
          descriptions, see the GMCJDriver object.
+         The interaction -> generator map of an initial state is built once
+         per (event generator list, tune) and shared, immutable, by all the
+         drivers configured for that initial state.
 
 \author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
  University of Liverpool & STFC Rutherford Appleton Laboratory
@@ -24,6 +27,7 @@
 #ifndef _GEVG_DRIVER_H_
 #define _GEVG_DRIVER_H_
 
+#include <memory>
 #include <ostream>
 #include <string>
 
@@ -113,13 +117,14 @@ private:
   void BuildInteractionGeneratorMap (void);
   void BuildInteractionSelector     (void);
   void AssertIsValidInitState       (void) const;
+  string XSecSumSplineKey           (int nk, double Emin, double Emax, bool inlogE) const;
 
   // Private data members
   InitialState *            fInitState;       ///< initial state information for driver instance
   EventRecord *             fCurrentRecord;   ///< ptr to the event record being processed
   EventGeneratorList *      fEvGenList;       ///< all Event Generators available at this job
   InteractionSelectorI *    fIntSelector;     ///< interaction selector
-  InteractionGeneratorMap * fIntGenMap;       ///< interaction -> generator assosiative container
+  std::shared_ptr<const InteractionGeneratorMap> fIntGenMap; //!< interaction -> generator assosiative container (shared)
   TBits *                   fUnphysEventMask; ///< controls whether unphysical events are returned
   bool                      fUseSplines;      ///< controls whether xsecs are computed or interpolated
   Spline *                  fXSecSumSpl;      ///< sum{xsec(all interactions | this init state)}
@@ -23,3 +23,10 @@ GFluxI::~GFluxI()
 
 }
 //___________________________________________________________________________
+void GFluxI::SetEnergyWindow(int /*pdg*/, double /*emin*/, double /*emax*/)
+{
+// Default: ignore the hint (the event generation driver still rejects flux
+// neutrinos outside the window, but only after the driver generated them)
+
+}
+//___________________________________________________________________________
@@ -46,6 +46,11 @@ public :
   virtual void                   Clear            (Option_t * opt   ) = 0; ///< reset state variables based on opt
   virtual void                   GenerateWeighted (bool gen_weighted) = 0; ///< set whether to generate weighted or unweighted neutrinos
 
+  //
+  // optional: hints from the event generation driver
+  //
+  virtual void                   SetEnergyWindow  (int pdg, double emin, double emax); ///< flux nu's of this species outside [emin,emax] can't interact: they may be skipped, but still counted in the exposure
+
 protected:
   GFluxI();
 };
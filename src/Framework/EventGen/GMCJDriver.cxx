@@ -9,12 +9,19 @@
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cstdio>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <sstream>
 
 #include <TVector3.h>
 #include <TSystem.h>
 #include <TStopwatch.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
+#include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/Units.h"
@@ -29,16 +36,99 @@
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/Interaction/InitialState.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/EnergyMemo.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/Spline.h"
 #include "Framework/ParticleData/PDGUtils.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/BoundedQueue.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/StringUtils.h"
 #include "Framework/Utils/XSecSplineList.h"
+#include "Framework/Utils/EventGenCost.h"
+#include "Framework/Utils/MaxXSecTable.h"
+#include "Framework/Utils/StartupProfile.h"
+#include "Framework/Utils/TraceScope.h"
 #include "Framework/Conventions/Constants.h"
 
 using namespace genie;
 using namespace genie::constants;
 
+// Serializes access to the GEVGDriver objects (and the physics modules they
+// drive) shared between a GMCJDriver and all the workers it has spawned
+static std::mutex gGEVGPoolMutex;
+
+namespace {
+  const char * kStateTreeName = "gMCJDriverState";
+  const char * kStatePlTreeName = "gMaxPathLengths";
+
+  // Checksum of a comma separated list of input files, from the size of
+  // each file and from its first and last MB (flux files can be large:
+  // reading them all would take longer than the initialisation it saves)
+  ULong64_t InputsChecksum(string inputs)
+  {
+    const long kChunk = 1024*1024;
+    string digest;
+    vector<string> files = utils::str::Split(inputs, ",");
+    for(unsigned int i = 0; i < files.size(); i++) {
+      string filename = utils::str::TrimSpaces(files[i]);
+      if(filename.empty()) continue;
+      std::ostringstream entry;
+      entry << filename.substr(filename.rfind('/') + 1) << ":";
+      FILE * file = fopen(filename.c_str(), "rb");
+      if(!file) {
+        entry << "missing;";
+        digest += entry.str();
+        continue;
+      }
+      fseek(file, 0, SEEK_END);
+      long size = ftell(file);
+      entry << size << ":";
+      digest += entry.str();
+      vector<char> buffer(kChunk);
+      long begin[2] = { 0, TMath::Max(kChunk, size - kChunk) };
+      for(int j = 0; j < 2 && begin[j] < size; j++) {
+        fseek(file, begin[j], SEEK_SET);
+        size_t nread = fread(&buffer[0], 1, kChunk, file);
+        digest.append(&buffer[0], nread);
+      }
+      fclose(file);
+      digest += ";";
+    }
+    return utils::str::Hash(digest);
+  }
+}
+
+//____________________________________________________________________________
+struct GMCJDriver::RayItem {
+  RayItem() : end(false), nupdg(0), tgtpdg(0), probscale(0), biasweight(1),
+              nflux(0), cost_nflux(0), cost_ngeomsteps(0), cost_geomtime(0) { }
+  bool           end;             ///< the flux driver reached its End()
+  int            nupdg;           ///< flux neutrino PDG code
+  TLorentzVector p4;              ///< flux neutrino 4-momentum
+  TLorentzVector x4;              ///< flux neutrino 4-position
+  TLorentzVector vtx;             ///< interaction vertex
+  int            tgtpdg;          ///< selected target material
+  PathLengthList pl;              ///< path lengths along the neutrino ray
+  vector<double> tgtprob;         ///< normalized interaction probability of each material
+  double         probscale;       ///< probability scale of the normalized probabilities
+  double         biasweight;      ///< target material bias weight
+  double         nflux;           ///< flux neutrinos thrown so far (including this one)
+  Long64_t       cost_nflux;      ///< flux neutrinos thrown since the previous item
+  Long64_t       cost_ngeomsteps; ///< geometry navigation steps since the previous item
+  double         cost_geomtime;   ///< time in the geometry driver since the previous item (s)
+};
+//____________________________________________________________________________
+struct GMCJDriver::Pipeline {
+  Pipeline(unsigned int depth, GMCJDriver * driver) :
+    queue(depth), stage(driver), stop(false) { }
+  BoundedQueue<RayItem> queue;    ///< interacting neutrinos, in the order they were thrown
+  GMCJDriver *          stage;    ///< worker driver running the flux & geometry stage
+  std::atomic<bool>     stop;     ///< stage asked to stop
+  std::thread           thread;   ///< flux & geometry stage thread
+};
+
 //____________________________________________________________________________
 GMCJDriver::GMCJDriver()
 {
@@ -47,7 +137,17 @@ GMCJDriver::GMCJDriver()
 //___________________________________________________________________________
 GMCJDriver::~GMCJDriver()
 {
+  this->StopPipeline();
+
   if(fUnphysEventMask) delete fUnphysEventMask;
+
+  // workers do not own the GEVGPool, probability scales and flux
+  // interaction probabilities they use
+  if(fMaster) {
+    fPmax.clear();
+    return;
+  }
+
   if (fGPool) delete fGPool;
 
   map<int,TH1D*>::iterator pmax_iter = fPmax.begin();
@@ -59,8 +159,7 @@ GMCJDriver::~GMCJDriver()
   }
   fPmax.clear();
 
-  if(fFluxIntTree) delete fFluxIntTree;
-  if(fFluxIntProbFile) delete fFluxIntProbFile;
+  if(fFluxIntTable) delete fFluxIntTable;
 }
 //___________________________________________________________________________
 void GMCJDriver::SetEventGeneratorList(string listname)
@@ -145,24 +244,142 @@ void GMCJDriver::PreSelectEvents(bool preselect)
   fPreSelect = preselect;
 }
 //___________________________________________________________________________
+void GMCJDriver::ForceInteraction(bool force)
+{
+// Force every flux neutrino crossing a target material to interact: the
+// target is selected in proportion to the interaction probabilities and the
+// event weight is multiplied by the total interaction probability. There is
+// no pre-selection (or batching) of flux neutrinos in that mode.
+//
+  fForceInteraction = force;
+
+  LOG("GMCJDriver", pNOTICE)
+    << "Force the interaction of every flux neutrino (weighted events)? : "
+    << utils::print::BoolAsYNString(force);
+}
+//___________________________________________________________________________
+void GMCJDriver::SetChannelBias(string spec)
+{
+// Set the biasing rules (see ChannelBias). The tgt:<pdg> factors bias the
+// target material selection made by this driver. The channel factors are
+// applied by the interaction selectors of the GEVGDrivers, which read them
+// from the --channel-bias option.
+//
+  if(!fBias.Set(spec)) {
+    LOG("GMCJDriver", pFATAL) << "Invalid channel biasing rules: " << spec;
+    gAbortingInErr = true;
+    exit(1);
+  }
+  if(!fBias.IsEmpty()) {
+    LOG("GMCJDriver", pNOTICE) << fBias;
+  }
+}
+//___________________________________________________________________________
+void GMCJDriver::SetPipelineDepth(unsigned int depth)
+{
+// Run the flux & geometry stage of the event generation on a thread of its
+// own, queuing up to `depth' interacting neutrinos ahead of the physics
+// (0: generate sequentially). See the class documentation for restrictions
+// on the use of the flux driver. Set it before generating any event.
+//
+  if(fPipeline) {
+    LOG("GMCJDriver", pERROR)
+      << "The pipeline is already running - Can not change its depth";
+    return;
+  }
+  fPipelineDepth = depth;
+
+  LOG("GMCJDriver", pNOTICE)
+    << "Flux & geometry pipeline depth (0: no pipeline) : " << depth;
+}
+//___________________________________________________________________________
+void GMCJDriver::SetFluxBatchSize(unsigned int n)
+{
+// Set the number of flux neutrinos that are read ahead and pre-selected
+// (using the maximum path lengths) in a single pass. Batching is used only
+// when pre-selecting events without pre-calculated flux interaction
+// probabilities. See the class documentation for restrictions on the flux
+// driver. The default (n=1) is the standard, one neutrino at a time, mode.
+
+  fFluxBatchSize = (n>0) ? n : 1;
+
+  LOG("GMCJDriver", pNOTICE)
+    << "Flux neutrinos will be pre-selected in batches of " << fFluxBatchSize;
+}
+//___________________________________________________________________________
+void GMCJDriver::SetXSecTableSize(unsigned int nbins)
+{
+// Set the number of energy bins, in [0, Emax], of the table of total cross
+// sections built at Configure(). Use 0 to evaluate the total cross section
+// splines for every flux neutrino instead. Must be called before Configure().
+
+  fXSecTableBins = nbins;
+}
+//___________________________________________________________________________
+void GMCJDriver::SetFluxProbabilityShard(
+                         unsigned int ishard, unsigned int nshards)
+{
+// Pre-calculate the flux interaction probabilities of only one shard (the
+// flux entries with index % nshards == ishard) of the flux file, so that
+// the pre-calculation can be spread over as many jobs. The table saved by
+// each job (see SaveFluxProbabilities) is partial: the tables of all shards
+// must be merged (by LoadFluxProbabilities) before generating events.
+
+  if(nshards == 0 || ishard >= nshards) {
+    LOG("GMCJDriver", pERROR)
+      << "Invalid flux probability shard: " << ishard << " of " << nshards;
+    return;
+  }
+  LOG("GMCJDriver", pNOTICE)
+    << "Pre-calculating the flux interaction probabilities of shard "
+    << ishard << " of " << nshards;
+
+  fFluxIntShard   = ishard;
+  fFluxIntNShards = nshards;
+}
+//___________________________________________________________________________
+void GMCJDriver::AddFluxProbabilityThread(GFluxI * flux, GeomAnalyzerI * geom)
+{
+// Add a thread to the pre-calculation of the flux interaction probabilities.
+// The input flux driver (reading the same flux file as the one used by this
+// driver) and geometry analyzer are used exclusively by the added thread.
+// The flux entries are shared out among this driver and all added threads.
+
+  if(!flux || !geom || flux == fFluxDriver || geom == fGeomAnalyzer) {
+    LOG("GMCJDriver", pERROR)
+      << "A flux probability thread needs its own flux driver and geometry analyzer";
+    return;
+  }
+  fFluxIntThreadFlux.push_back(flux);
+  fFluxIntThreadGeom.push_back(geom);
+}
+//___________________________________________________________________________
 bool GMCJDriver::PreCalcFluxProbabilities(void)
 {
 // Loop over complete set of flux entries satisfying input config options
-// (such as neutrino type) and save the interaction probability in a tree
+// (such as neutrino type) and save the interaction probability in a table
 // relating flux index (entry number in input flux tree) to interaction
-// probability. If a pre-generated flux interaction probability tree has
-// already been loaded then just returns true. Also save tree to a TFile
+// probability. If a pre-generated flux interaction probability table has
+// already been loaded then just returns true. Also save table to a file
 // for use in later jobs if flag is set
+//
+// The flux entries are shared out among this driver and the threads added
+// by AddFluxProbabilityThread() and, if a shard was set (see
+// SetFluxProbabilityShard()), only the entries of that shard are computed.
 //
   bool success = true;
 
-  bool save_to_file = fFluxIntProbFile == 0 && fFluxIntFileName.size()>0;
+  bool save_to_file = fFluxIntFileName.size()>0;
+  if(save_to_file && !gSystem->AccessPathName(fFluxIntFileName.c_str())){
+    LOG("GMCJDriver", pFATAL) << "Cannot overwrite an existing file. Exiting!";
+    exit(1);
+  }
 
   // Clear map storing sum(fBrFluxWeight*fBrFluxIntProb) for each neutrino pdg
   fSumFluxIntProbs.clear();
 
-  // check if already loaded flux interaction probs using LoadFluxProbTree
-  if(fFluxIntTree){
+  // check if already loaded flux interaction probs using LoadFluxProbabilities
+  if(fFluxIntTable){
     LOG("GMCJDriver", pNOTICE) <<
          "Skipping pre-generation of flux interaction probabilities - "<<
          "using pre-generated file";
@@ -171,115 +388,82 @@ bool GMCJDriver::PreCalcFluxProbabilities(void)
   // otherwise create them on the fly now
   else {
 
-    if(save_to_file){
-      fFluxIntProbFile = new TFile(fFluxIntFileName.c_str(), "CREATE");
-      if(fFluxIntProbFile->IsZombie()){
-        LOG("GMCJDriver", pFATAL) << "Cannot overwrite an existing file. Exiting!";
-        exit(1);
-      }
-    }
-
-    // Create the tree to store flux probs
-    fFluxIntTree = new TTree(fFluxIntTreeName.c_str(),
-                         "Tree storing pre-calculated flux interaction probs");
-    fFluxIntTree->Branch("FluxIndex", &fBrFluxIndex, "FluxIndex/I");
-    fFluxIntTree->Branch("FluxIntProb", &fBrFluxIntProb, "FluxIntProb/D");
-    fFluxIntTree->Branch("FluxEnu", &fBrFluxEnu, "FluxEnu/D");
-    fFluxIntTree->Branch("FluxWeight", &fBrFluxWeight, "FluxWeight/D");
-    fFluxIntTree->Branch("FluxPDG", &fBrFluxPDG, "FluxPDG/I");
-    // Associate to file otherwise get std::bad_alloc when writing large trees
-    if(save_to_file) fFluxIntTree->SetDirectory(fFluxIntProbFile);
-
-    fFluxDriver->GenerateWeighted(true);
+    fFluxIntTable = new FluxIntProbTable;
 
     fGlobPmax = 1.0; // Force ComputeInteractionProbabilities to return absolute value
 
-    // Loop over flux entries and calculate interaction probabilities
+    // Set up a helper driver (using its own flux driver & geometry analyzer,
+    // and filling its own table) for each additional thread
+    unsigned int nthreads = 1 + fFluxIntThreadFlux.size();
+    vector<GMCJDriver *>       helpers(nthreads, this);
+    vector<FluxIntProbTable *> tables (nthreads, fFluxIntTable);
+    for(unsigned int ith = 1; ith < nthreads; ith++) {
+      helpers[ith] = new GMCJDriver;
+      helpers[ith]->InitWorker(this);
+      helpers[ith]->UseFluxDriver  (fFluxIntThreadFlux[ith-1]);
+      helpers[ith]->UseGeomAnalyzer(fFluxIntThreadGeom[ith-1]);
+      helpers[ith]->fFluxIntTable = 0;
+      helpers[ith]->fWorkerSeed   = RandomGen::Instance()->GetSeed() + ith;
+      tables [ith] = new FluxIntProbTable;
+    }
+
+    // Loop over flux entries and calculate interaction probabilities: the
+    // entries of the current shard are dealt out to the threads
     TStopwatch stopwatch;
     stopwatch.Start();
-    long int first_index = -1;
-    bool first_loop = true;
-    // loop until at end of flux ntuple
-    while(fFluxDriver->End() == false){
-
-      // get the next flux neutrino
-      bool gotnext = fFluxDriver->GenerateNext();
-      if(!gotnext){
-        LOG("GMCJDriver", pWARN) << "*** Couldn't generate next flux ray! ";
-        continue;
-      }
-
-      // stop if completed a full cycle (this check is necessary as fluxdriver
-      // may be set to loop over more than one cycle before reaching end)
-      bool already_been_here = first_loop ? false : first_index == fFluxDriver->Index();
-      if(already_been_here) break;
-
-      // compute the path lengths for current flux neutrino
-      if(this->ComputePathLengths() == false){ success = false; break;}
-
-      // compute and store the interaction probability
-      double psum = this->ComputeInteractionProbabilities(false /*Based on actual PLs*/);
-      assert(psum+controls::kASmallNum > 0.);
-      fBrFluxIntProb = psum;
-      fBrFluxIndex   = fFluxDriver->Index();
-      fBrFluxEnu     = fFluxDriver->Momentum().E();
-      fBrFluxWeight  = fFluxDriver->Weight();
-      fBrFluxPDG     = fFluxDriver->PdgCode();
-      fFluxIntTree->Fill();
-
-      // store the first index so know when have cycled exactly once
-      if(first_loop){
-        first_index = fFluxDriver->Index();
-        first_loop = false;
-      }
-    } // flux loop
+    unsigned int nslots = nthreads * fFluxIntNShards;
+    vector<char> thread_ok(nthreads, 1);
+    vector<std::thread> threads;
+    for(unsigned int ith = 1; ith < nthreads; ith++) {
+      unsigned int islot = fFluxIntShard + ith * fFluxIntNShards;
+      threads.push_back(std::thread([&helpers, &tables, &thread_ok, ith, islot, nslots]() {
+        thread_ok[ith] = helpers[ith]->PreCalcFluxShard(islot, nslots, *tables[ith]);
+      }));
+    }
+    thread_ok[0] = this->PreCalcFluxShard(fFluxIntShard, nslots, *fFluxIntTable);
+    for(unsigned int ith = 0; ith < threads.size(); ith++) threads[ith].join();
+
+    // Merge the tables of all threads
+    for(unsigned int ith = 0; ith < nthreads; ith++) {
+      success = success && thread_ok[ith];
+      if(ith == 0) continue;
+      fFluxIntTable->Merge(*tables[ith]);
+      delete tables[ith];
+      delete helpers[ith];
+    }
+    fFluxIntTable->Sort();
     stopwatch.Stop();
     LOG("GMCJDriver", pNOTICE)
                     << "Finished pre-calculating flux interaction probabilities. "
-                    << "Total CPU time to process "<< fFluxIntTree->GetEntries()
-                    << " entries: "<< stopwatch.CpuTime();
-
-    // reset the flux driver so can be used at next stage. N.B. This
-    // should also reset flux driver to throw de-weighted flux neutrinos
-    fFluxDriver->Clear("CycleHistory");
+                    << "Total CPU time to process "<< fFluxIntTable->NEntries()
+                    << " entries: "<< stopwatch.CpuTime()
+                    << " (real time: " << stopwatch.RealTime()
+                    << ", threads: " << nthreads << ")";
+    if(fFluxIntNShards > 1) {
+      LOG("GMCJDriver", pWARN)
+        << "Pre-calculated shard " << fFluxIntShard << " of " << fFluxIntNShards
+        << " only: merge the tables of all shards before generating events";
+    }
   }
 
   // If successfully calculated/loaded interaction probabilities then set global
-  // probability scale and, if requested, save tree to output file
+  // probability scale and, if requested, save table to output file
   if(success){
-    fGlobPmax = 0.0;
     double safety_factor = 1.01;
-    for(int i = 0; i< fFluxIntTree->GetEntries(); i++){
-      fFluxIntTree->GetEntry(i);
-      // Check have non-negative probabilities
-      assert(fBrFluxIntProb+controls::kASmallNum > 0.0);
-      assert(fBrFluxWeight+controls::kASmallNum > 0.0);
-      // Update the global maximum
-      fGlobPmax = TMath::Max(fGlobPmax, fBrFluxIntProb*safety_factor);
-      // Update the sum of fBrFluxIntProb*fBrFluxWeight for different species
-      if(fSumFluxIntProbs.find(fBrFluxPDG) == fSumFluxIntProbs.end()){
-        fSumFluxIntProbs[fBrFluxPDG] = 0.0;
-      }
-      fSumFluxIntProbs[fBrFluxPDG] += fBrFluxIntProb * fBrFluxWeight;
-    }
+    fGlobPmax = fFluxIntTable->MaxProb() * safety_factor;
+    fSumFluxIntProbs = fFluxIntTable->SumProbs();
     LOG("GMCJDriver", pNOTICE) <<
         "Updated global probability scale to fGlobPmax = "<< fGlobPmax;
 
     if(save_to_file){
       LOG("GMCJDriver", pNOTICE) <<
           "Saving pre-generated interaction probabilities to file: "<<
-          fFluxIntProbFile->GetName();
-      fFluxIntProbFile->cd();
-      fFluxIntTree->Write();
-    }
-
-    // Also build index for use later
-    if(fFluxIntTree->BuildIndex("FluxIndex") != fFluxIntTree->GetEntries()){
-      LOG("GMCJDriver", pFATAL) <<
-          "Cannot build index using branch \"FluxIndex\" for flux prob tree!";
-      exit(1);
+          fFluxIntFileName;
+      success = this->WriteFluxProbabilities(fFluxIntFileName);
     }
+  }
 
+  if(success){
     // Now that have pre-generated flux probabilities need to trun off event
     // preselection as this is only advantages when using max path lengths
     this->PreSelectEvents(false);
@@ -287,71 +471,309 @@ bool GMCJDriver::PreCalcFluxProbabilities(void)
     LOG("GMCJDriver", pNOTICE) << "Successfully generated/loaded pre-calculate flux interaction probabilities";
   }
   // Otherwise clean up
-  else if(fFluxIntTree){
-    delete fFluxIntTree;
-    fFluxIntTree = 0;
+  else if(fFluxIntTable){
+    delete fFluxIntTable;
+    fFluxIntTable = 0;
   }
 
   // Return whether have successfully pre-calculated flux interaction probabilities
   return success;
 }
 //___________________________________________________________________________
+bool GMCJDriver::PreCalcFluxShard(
+       unsigned int islot, unsigned int nslots, FluxIntProbTable & table)
+{
+// Compute the interaction probabilities of the flux entries with
+// index % nslots == islot, over a single cycle of the flux driver, and add
+// them to the input table
+
+  // helpers use a generator owned by the thread driving them
+  if(fMaster) {
+    RandomGen * rnd = RandomGen::Instance();
+    if(!rnd->HasThreadGenerator()) rnd->SetThreadSeed(fWorkerSeed);
+  }
+
+  fFluxDriver->GenerateWeighted(true);
+
+  bool success = true;
+  long int first_index = -1;
+  bool first_loop = true;
+  // loop until at end of flux ntuple
+  while(fFluxDriver->End() == false){
+
+    // get the next flux neutrino
+    bool gotnext = fFluxDriver->GenerateNext();
+    if(!gotnext){
+      LOG("GMCJDriver", pWARN) << "*** Couldn't generate next flux ray! ";
+      continue;
+    }
+
+    // stop if completed a full cycle (this check is necessary as fluxdriver
+    // may be set to loop over more than one cycle before reaching end)
+    long int index = fFluxDriver->Index();
+    bool already_been_here = first_loop ? false : first_index == index;
+    if(already_been_here) break;
+
+    // store the first index so know when have cycled exactly once
+    if(first_loop){
+      first_index = index;
+      first_loop = false;
+    }
+
+    // skip the entries dealt out to other threads / shards
+    if(nslots > 1 && (index < 0 || index % nslots != islot)) continue;
+
+    // make it the current flux neutrino
+    fCurNuPdg = fFluxDriver->PdgCode();
+    fCurNuP4  = fFluxDriver->Momentum();
+    fCurNuX4  = fFluxDriver->Position();
+
+    // compute the path lengths for current flux neutrino
+    if(this->ComputePathLengths() == false){ success = false; break;}
+
+    // compute and store the interaction probability
+    double psum = this->ComputeInteractionProbabilities(false /*Based on actual PLs*/);
+    assert(psum+controls::kASmallNum > 0.);
+    table.Add(index, psum, fCurNuP4.E(), fFluxDriver->Weight(), fCurNuPdg);
+  } // flux loop
+
+  // reset the flux driver so can be used at next stage. N.B. This
+  // should also reset flux driver to throw de-weighted flux neutrinos
+  fFluxDriver->Clear("CycleHistory");
+
+  return success;
+}
+//___________________________________________________________________________
 bool GMCJDriver::LoadFluxProbabilities(string filename)
 {
 // Load a pre-generated set of flux interaction probabilities from an external
 // file. This is recommended when using large flux files (>100k entries) as
 // for these the time to calculate the interaction probabilities can exceed
-// ~20 minutes. After loading the input tree we call PreCalcFluxProbabilities
+// ~20 minutes. After loading the input table we call PreCalcFluxProbabilities
 // to check that has successfully loaded
+// A comma separated list of files (eg. the ones saved by the jobs of each
+// shard, see SetFluxProbabilityShard) may be input: their tables are merged.
+// A single binary (*.gflxprob) file is mapped into memory, without reading
+// it, so that even the largest tables are available at once.
 //
-  if(fFluxIntProbFile){
+  if(fFluxIntTable){
     LOG("GMCJDriver", pWARN)
      << "Can't load flux interaction prob file as one is already loaded";
     return false;
   }
 
-  fFluxIntProbFile = new TFile(filename.c_str(), "OPEN");
-
-  if(fFluxIntProbFile){
-    fFluxIntTree = dynamic_cast<TTree*>(fFluxIntProbFile->Get(fFluxIntTreeName.c_str()));
-    if(fFluxIntTree){
-      bool set_addresses =
-        fFluxIntTree->SetBranchAddress("FluxIntProb", &fBrFluxIntProb) >= 0 &&
-        fFluxIntTree->SetBranchAddress("FluxIndex", &fBrFluxIndex) >= 0 &&
-        fFluxIntTree->SetBranchAddress("FluxPDG", &fBrFluxPDG) >= 0 &&
-        fFluxIntTree->SetBranchAddress("FluxWeight", &fBrFluxWeight) >= 0 &&
-        fFluxIntTree->SetBranchAddress("FluxEnu", &fBrFluxEnu) >= 0;
-      if(set_addresses){
-        // Finally check that can use them
-        if(this->PreCalcFluxProbabilities()) {
-          LOG("GMCJDriver", pNOTICE)
-           << "Successfully loaded pre-generated flux interaction probabilities";
-          return true;
-        }
-      }
-      // If cannot load then delete tree
-      LOG("GMCJDriver", pERROR) <<
-          "Cannot find expected branches in input flux probability tree!";
-      delete fFluxIntTree; fFluxIntTree = 0;
+  vector<string> files = utils::str::Split(filename, ",");
+  FluxIntProbTable * table = new FluxIntProbTable;
+  bool success = files.size() > 0;
+  if(files.size() == 1 && FluxIntProbTable::IsBinaryFile(files[0])) {
+    success = table->Open(files[0]);
+  }
+  else {
+    for(unsigned int ifile = 0; success && ifile < files.size(); ifile++) {
+      success = this->ReadFluxProbabilities(files[ifile], *table);
     }
-    else LOG("GMCJDriver", pERROR)
-          << "Cannot find tree: "<< fFluxIntTreeName.c_str();
+    table->Sort();
   }
 
+  if(success){
+    // Finally check that can use them
+    fFluxIntTable = table;
+    if(this->PreCalcFluxProbabilities()) {
+      LOG("GMCJDriver", pNOTICE)
+       << "Successfully loaded pre-generated flux interaction probabilities";
+      return true;
+    }
+    table = 0; // deleted by PreCalcFluxProbabilities
+  }
+  if(table) delete table;
+
   LOG("GMCJDriver", pWARN)
      << "Unable to load flux interaction probabilities file";
   return false;
 }
 //___________________________________________________________________________
+bool GMCJDriver::ReadFluxProbabilities(string filename, FluxIntProbTable & table)
+{
+// Add the flux interaction probabilities stored in the input file (a binary
+// table or a ROOT file with a gFlxIntProb tree) to the input table
+
+  if(FluxIntProbTable::IsBinaryFile(filename)) {
+    FluxIntProbTable mapped;
+    if(!mapped.Open(filename)) return false;
+    table.Merge(mapped);
+    return true;
+  }
+
+  TFile file(filename.c_str(), "READ");
+  if(file.IsZombie()) {
+    LOG("GMCJDriver", pERROR) << "Cannot open file: "<< filename;
+    return false;
+  }
+  TTree * tree = dynamic_cast<TTree*>(file.Get(fFluxIntTreeName.c_str()));
+  if(!tree) {
+    LOG("GMCJDriver", pERROR)
+          << "Cannot find tree: "<< fFluxIntTreeName.c_str();
+    return false;
+  }
+  bool set_addresses =
+    tree->SetBranchAddress("FluxIntProb", &fBrFluxIntProb) >= 0 &&
+    tree->SetBranchAddress("FluxIndex", &fBrFluxIndex) >= 0 &&
+    tree->SetBranchAddress("FluxPDG", &fBrFluxPDG) >= 0 &&
+    tree->SetBranchAddress("FluxWeight", &fBrFluxWeight) >= 0 &&
+    tree->SetBranchAddress("FluxEnu", &fBrFluxEnu) >= 0;
+  if(!set_addresses) {
+    LOG("GMCJDriver", pERROR) <<
+        "Cannot find expected branches in input flux probability tree!";
+    return false;
+  }
+  for(Long64_t i = 0; i < tree->GetEntries(); i++) {
+    tree->GetEntry(i);
+    table.Add(fBrFluxIndex, fBrFluxIntProb, fBrFluxEnu, fBrFluxWeight, fBrFluxPDG);
+  }
+  LOG("GMCJDriver", pNOTICE)
+    << "Read " << tree->GetEntries()
+    << " flux interaction probabilities from " << filename;
+  return true;
+}
+//___________________________________________________________________________
+bool GMCJDriver::WriteFluxProbabilities(string filename)
+{
+// Write the flux interaction probability table either as a binary table
+// (files named *.gflxprob) or as a gFlxIntProb tree in a ROOT file
+
+  if(FluxIntProbTable::IsBinaryFile(filename)) {
+    return fFluxIntTable->Write(filename);
+  }
+
+  TFile file(filename.c_str(), "CREATE");
+  if(file.IsZombie()){
+    LOG("GMCJDriver", pERROR) << "Cannot create file: " << filename;
+    return false;
+  }
+  // Create the tree in the file, otherwise get std::bad_alloc when writing
+  // large trees
+  TTree * tree = new TTree(fFluxIntTreeName.c_str(),
+                       "Tree storing pre-calculated flux interaction probs");
+  tree->Branch("FluxIndex", &fBrFluxIndex, "FluxIndex/I");
+  tree->Branch("FluxIntProb", &fBrFluxIntProb, "FluxIntProb/D");
+  tree->Branch("FluxEnu", &fBrFluxEnu, "FluxEnu/D");
+  tree->Branch("FluxWeight", &fBrFluxWeight, "FluxWeight/D");
+  tree->Branch("FluxPDG", &fBrFluxPDG, "FluxPDG/I");
+  for(Long64_t i = 0; i < fFluxIntTable->NEntries(); i++) {
+    fBrFluxIndex   = fFluxIntTable->Index(i);
+    fBrFluxIntProb = fFluxIntTable->Prob(i);
+    fBrFluxEnu     = fFluxIntTable->Enu(i);
+    fBrFluxWeight  = fFluxIntTable->Weight(i);
+    fBrFluxPDG     = fFluxIntTable->PDG(i);
+    tree->Fill();
+  }
+  file.cd();
+  tree->Write();
+  file.Close();
+  return true;
+}
+//___________________________________________________________________________
 void GMCJDriver::SaveFluxProbabilities(string outfilename)
 {
 // Configue the flux driver to save the calculated flux interaction
 // probabilities to the specified output file name for use in later jobs. See
 // the LoadFluxProbTree method for how they are fed into a later job.
+// Output files named *.gflxprob are written in the (compact, memory-mapped
+// at loading) binary format of FluxIntProbTable, others as a ROOT tree.
 //
   fFluxIntFileName = outfilename;
 }
 //___________________________________________________________________________
+bool GMCJDriver::LoadState(string filename, string inputs, bool resume)
+{
+// Use the max path lengths and the probability scales saved with SaveState()
+// by an identically configured job (same tune, event generator list, flux
+// neutrinos, target materials, max flux energy, cross sections and input
+// files) instead of computing them. Call before Configure(), where the saved
+// state is checked against the current one: if they differ the path lengths
+// and probability scales are computed as usual (see StateLoaded()).
+// If resume is set, the flux driver is moved to the flux entry being read
+// when the state was saved and the flux neutrino count continues from the
+// saved one, so that a job can be restarted after a pre-emption from its
+// last checkpoint with the same seed.
+//
+  if(gSystem->AccessPathName(filename.c_str())) {
+    LOG("GMCJDriver", pNOTICE)
+      << "No driver state file: " << filename;
+    return false;
+  }
+  fStateFile   = filename;
+  fStateInputs = inputs;
+  fStateResume = resume;
+  return true;
+}
+//___________________________________________________________________________
+bool GMCJDriver::SaveState(string filename, string inputs) const
+{
+// Save the max path lengths, the probability scales, the checksums of the
+// configuration and of the input files as well as the current flux entry
+// and flux neutrino count (see LoadState()). Can be called any time after
+// Configure(), eg. periodically as a checkpoint.
+// The state is written to a temporary file renamed at the end, so that an
+// interrupted job never leaves a truncated state file behind.
+//
+  if(fMaster || fPmax.empty()) {
+    LOG("GMCJDriver", pERROR)
+      << "Can only save the state of a configured (non-worker) driver";
+    return false;
+  }
+
+  string tmpname = filename + ".tmp";
+  TFile file(tmpname.c_str(), "RECREATE");
+  if(file.IsZombie()) {
+    LOG("GMCJDriver", pERROR) << "Cannot create file: " << tmpname;
+    return false;
+  }
+
+  ULong64_t config_hash = this->StateConfigHash();
+  ULong64_t inputs_hash = InputsChecksum(inputs);
+  Long64_t  flux_index  = (fFluxDriver) ? fFluxDriver->Index() : -1;
+  double    nflux       = fNFluxNeutrinos;
+  TTree * tree = new TTree(kStateTreeName, "GMCJDriver state");
+  tree->Branch("ConfigHash", &config_hash, "ConfigHash/l");
+  tree->Branch("InputsHash", &inputs_hash, "InputsHash/l");
+  tree->Branch("FluxIndex",  &flux_index,  "FluxIndex/L");
+  tree->Branch("NFluxNu",    &nflux,       "NFluxNu/D");
+  tree->Fill();
+
+  int    pdg = 0;
+  double pl  = 0;
+  TTree * pltree = new TTree(kStatePlTreeName, "max path lengths");
+  pltree->Branch("PDG", &pdg, "PDG/I");
+  pltree->Branch("PL",  &pl,  "PL/D");
+  PathLengthList::const_iterator pl_iter = fMaxPathLengths.begin();
+  for( ; pl_iter != fMaxPathLengths.end(); ++pl_iter) {
+    pdg = pl_iter->first;
+    pl  = pl_iter->second;
+    pltree->Fill();
+  }
+
+  file.cd();
+  tree->Write();
+  pltree->Write();
+  map<int,TH1D*>::const_iterator pmax_iter = fPmax.begin();
+  for( ; pmax_iter != fPmax.end(); ++pmax_iter) {
+    std::ostringstream name;
+    name << "pmax_" << pmax_iter->first;
+    pmax_iter->second->Write(name.str().c_str());
+  }
+  file.Close();
+
+  if(gSystem->Rename(tmpname.c_str(), filename.c_str()) != 0) {
+    LOG("GMCJDriver", pERROR) << "Cannot write file: " << filename;
+    return false;
+  }
+  LOG("GMCJDriver", pNOTICE)
+    << "Saved the driver state (flux entry: " << flux_index << ", "
+    << nflux << " flux neutrinos) in: " << filename;
+  return true;
+}
+//___________________________________________________________________________
 void GMCJDriver::Configure(bool calc_prob_scales)
 {
   LOG("GMCJDriver", pNOTICE)
@@ -388,15 +810,31 @@ void GMCJDriver::Configure(bool calc_prob_scales)
   // for each possible initial state)
   this->BootstrapXSecSplineSummation();
 
-  if(calc_prob_scales){
-    // Ask the input geometry driver to compute the max. path length for each
-    // material in the list of target materials (or load a precomputed list)
-    this->GetMaxPathLengthList();
+  // Tabulate the total cross section for each initial state on a dense
+  // energy grid, for fast evaluation of the interaction probabilities
+  this->BuildXSecTable();
+
+  // Find the energy range, for each neutrino, where the interaction
+  // probability can be non-zero and pass it to the flux driver as a hint
+  this->ComputeEnergyWindows();
+  this->HintFluxEnergyWindows();
 
-    // Compute the max. interaction probability to scale all interaction
-    // probabilities to be computed by this driver
-    this->ComputeProbScales();
+  if(calc_prob_scales){
+    // Load the max. path lengths and the probability scales from the state
+    // saved by an identically configured job, if one was given
+    if(!this->ReadState()) {
+      // Ask the input geometry driver to compute the max. path length for each
+      // material in the list of target materials (or load a precomputed list)
+      this->GetMaxPathLengthList();
+
+      // Compute the max. interaction probability to scale all interaction
+      // probabilities to be computed by this driver
+      this->ComputeProbScales();
+    }
   }
+
+  // Skip the flux entries already used by the job that saved the state
+  if(fStateLoaded && fStateResume) this->ResumeFluxDriver();
   LOG("GMCJDriver", pNOTICE) << "Finished configuring GMCJDriver\n\n";
 }
 //___________________________________________________________________________
@@ -421,18 +859,32 @@ void GMCJDriver::InitJob(void)
 
   fGlobPmax           = 0;     // <-- maximum interaction probability (global prob scale)
   fPmax.clear();               // <-- maximum interaction probability per neutrino & per energy bin
+  fPmaxTable.clear();          // <-- the same, as a flat table
+  fPmaxBins           = 0;
+  fPmaxEmin           = 0;
+  fPmaxDE             = 0;
 
   fGenerateUnweighted = false; // <-- default opt to generate weighted events
   fPreSelect          = true;  // <-- default to use pre-selection based on maximum path lengths
+  fForceInteraction   = RunOpt::Instance()->ForceInteractions(); // <-- default: select interacting neutrinos by rejection
+  fCurProbScale       = 0;
+  fCurTgtBiasWeight   = 1.;
+  this->SetChannelBias(RunOpt::Instance()->ChannelBiasing());
 
   fSelTgtPdg          = 0;
   fCurEvt             = 0;
+  fCurNuPdg           = 0;
+  fCurNuP4.SetXYZT(0.,0.,0.,0.);
+  fCurNuX4.SetXYZT(0.,0.,0.,0.);
   fCurVtx.SetXYZT(0.,0.,0.,0.);
 
-  fFluxIntProbFile    = 0;
   fFluxIntTreeName    = "gFlxIntProb";
   fFluxIntFileName    = "";
-  fFluxIntTree        = 0;
+  fFluxIntTable       = 0;
+  fFluxIntShard       = 0;     // <-- pre-calculate the flux probabilities of all flux entries
+  fFluxIntNShards     = 1;
+  fFluxIntThreadFlux.clear();
+  fFluxIntThreadGeom.clear();
   fBrFluxIntProb      = -1.;
   fBrFluxIndex        = -1;
   fBrFluxEnu          = -1.;
@@ -440,6 +892,29 @@ void GMCJDriver::InitJob(void)
   fBrFluxPDG          = 0;
   fSumFluxIntProbs.clear();
 
+  fMaster             = 0;
+  fWorkerSeed         = 0;
+  fHasWorkers         = false;
+
+  fFluxBatchSize      = 1;     // <-- no batched pre-selection of flux neutrinos
+  fBatchNext          = 0;
+
+  fPipelineDepth      = RunOpt::Instance()->PipelineDepth(); // <-- default: no pipeline
+  fPipeline           = 0;
+
+  fXSecTableBins      = 3000;  // <-- energy bins of the total xsec table
+  fXSecTableDE        = 0;
+  fXSecTableNu.clear();
+  fXSecTableTgt.clear();
+  fXSecTable.clear();
+
+  fStateFile          = "";    // <-- compute the path lengths & prob scales at Configure()
+  fStateInputs        = "";
+  fStateResume        = false;
+  fStateLoaded        = false;
+  fStateFluxIndex     = -1;
+  fStateNFluxNu       = 0;
+
   // Throw as many flux neutrinos as necessary till one has interacted
   // so that GenerateEvent() never  returns NULL (except when in error)
   this->KeepOnThrowingFluxNeutrinos(true);
@@ -466,6 +941,116 @@ void GMCJDriver::InitJob(void)
   fCurPathLengths.clear();
 }
 //___________________________________________________________________________
+void GMCJDriver::InitWorker(const GMCJDriver * master)
+{
+// Copy the job configuration and everything computed at Configure() from the
+// input (configured) driver. The GEVGPool, the probability scale histograms
+// and the (read-only) pre-calculated flux interaction probabilities are
+// shared, not copied.
+
+  fMaster             = master;
+
+  fEventGenList       = master->fEventGenList;
+  *fUnphysEventMask   = *(master->fUnphysEventMask);
+  fEmax               = master->fEmax;
+  fNuList             = master->fNuList;
+  fTgtList            = master->fTgtList;
+  fMaxPathLengths     = master->fMaxPathLengths;
+  fGPool              = master->fGPool;
+  fPmax               = master->fPmax;
+  fPmaxTable          = master->fPmaxTable;
+  fPmaxBins           = master->fPmaxBins;
+  fPmaxEmin           = master->fPmaxEmin;
+  fPmaxDE             = master->fPmaxDE;
+  fGlobPmax           = master->fGlobPmax;
+  fMaxPlXmlFilename   = master->fMaxPlXmlFilename;
+  fUseExtMaxPl        = master->fUseExtMaxPl;
+  fUseSplines         = master->fUseSplines;
+  fUseLogE            = master->fUseLogE;
+  fKeepThrowingFluxNu = master->fKeepThrowingFluxNu;
+  fGenerateUnweighted = master->fGenerateUnweighted;
+  fPreSelect          = master->fPreSelect;
+  fForceInteraction   = master->fForceInteraction;
+  fBias               = master->fBias;
+  fFluxBatchSize      = master->fFluxBatchSize;
+  fPipelineDepth      = master->fPipelineDepth;
+  fXSecTableBins      = master->fXSecTableBins;
+  fXSecTableDE        = master->fXSecTableDE;
+  fXSecTableNu        = master->fXSecTableNu;
+  fXSecTableTgt       = master->fXSecTableTgt;
+  fXSecTable          = master->fXSecTable;
+  fEnergyWindow       = master->fEnergyWindow;
+  fFluxIntTable       = master->fFluxIntTable;
+}
+//___________________________________________________________________________
+GMCJDriver * GMCJDriver::SpawnWorker(
+          GFluxI * flux, GeomAnalyzerI * geom, long int seed) const
+{
+// Create a worker driver for multi-threaded event generation.
+// The input flux driver and geometry analyzer are used exclusively by the
+// worker (they must not be the ones used by this driver or by any other
+// worker) and must declare the same (or a subset of the) flux neutrinos and
+// target materials as the ones this driver was configured with.
+// The input seed initializes the random number generator of the thread that
+// drives the worker. The caller adopts the worker.
+
+  if(fMaster) {
+    LOG("GMCJDriver", pERROR) << "Can not spawn a worker from a worker!";
+    return 0;
+  }
+  if(!fGPool || (fPmax.size() == 0 && !fFluxIntTable) || fGlobPmax <= 0) {
+    LOG("GMCJDriver", pERROR)
+      << "Can not spawn a worker before the driver has been configured!";
+    return 0;
+  }
+  if(!flux || !geom || flux == fFluxDriver || geom == fGeomAnalyzer) {
+    LOG("GMCJDriver", pERROR)
+      << "A worker needs its own flux driver and geometry analyzer";
+    return 0;
+  }
+
+  // check that the input drivers are consistent with the configuration
+  PDGCodeList::const_iterator iter;
+  PDGCodeList nulist = flux->FluxParticles();
+  for(iter = nulist.begin(); iter != nulist.end(); ++iter) {
+    if(!fNuList.ExistsInPDGCodeList(*iter)) {
+      LOG("GMCJDriver", pERROR)
+        << "The worker flux driver declares a neutrino (pdg = " << *iter
+        << ") that this driver was not configured for";
+      return 0;
+    }
+  }
+  PDGCodeList tgtlist = geom->ListOfTargetNuclei();
+  for(iter = tgtlist.begin(); iter != tgtlist.end(); ++iter) {
+    if(!fTgtList.ExistsInPDGCodeList(*iter)) {
+      LOG("GMCJDriver", pERROR)
+        << "The worker geometry declares a target (pdg = " << *iter
+        << ") that this driver was not configured for";
+      return 0;
+    }
+  }
+  if(flux->MaxEnergy() > fEmax) {
+    LOG("GMCJDriver", pERROR)
+      << "The worker flux driver maximum energy (" << flux->MaxEnergy()
+      << " GeV) exceeds the one used for computing the probability scales ("
+      << fEmax << " GeV)";
+    return 0;
+  }
+
+  GMCJDriver * worker = new GMCJDriver;
+  worker->InitWorker(this);
+  worker->UseFluxDriver(flux);
+  worker->UseGeomAnalyzer(geom);
+  worker->HintFluxEnergyWindows();
+  worker->fWorkerSeed = seed;
+  fHasWorkers = true;
+
+  LOG("GMCJDriver", pNOTICE)
+    << "Spawned GMCJDriver worker (random number seed: " << seed << ")";
+
+  return worker;
+}
+//___________________________________________________________________________
 void GMCJDriver::GetParticleLists(void)
 {
   // Get the list of flux neutrinos from the flux driver
@@ -485,6 +1070,8 @@ void GMCJDriver::GetParticleLists(void)
 //___________________________________________________________________________
 void GMCJDriver::GetMaxPathLengthList(void)
 {
+  StartupProfile::Scope phase("GMCJDriver::GetMaxPathLengthList");
+
   if(fUseExtMaxPl) {
      LOG("GMCJDriver", pNOTICE)
        << "Loading external max path-length list for input geometry from "
@@ -611,6 +1198,159 @@ void GMCJDriver::BootstrapXSecSplineSummation(void)
      << "Finished summing all interaction xsec splines per initial state";
 }
 //___________________________________________________________________________
+void GMCJDriver::BuildXSecTable(void)
+{
+// Tabulate the total cross section for all (neutrino, target) initial states
+// at equidistant energies in [0, Emax]. The interaction probabilities for
+// each flux neutrino are then computed with an indexed load and a linear
+// interpolation per target, rather than a spline evaluation per target.
+
+  fXSecTableDE = 0;
+  fXSecTableNu.clear();
+  fXSecTableTgt.clear();
+  fXSecTable.clear();
+
+  if(fXSecTableBins == 0 || fEmax <= 0) {
+    LOG("GMCJDriver", pNOTICE)
+      << "Total cross sections will be evaluated from the splines";
+    return;
+  }
+
+  fXSecTableNu.assign  (fNuList.begin(),  fNuList.end());
+  fXSecTableTgt.assign (fTgtList.begin(), fTgtList.end());
+
+  // sort targets the same way as the PathLengthList entries
+  std::sort(fXSecTableTgt.begin(), fXSecTableTgt.end());
+
+  unsigned int nnu    = fXSecTableNu.size();
+  unsigned int ntgt   = fXSecTableTgt.size();
+  unsigned int nknots = fXSecTableBins + 1;
+
+  fXSecTableDE = fEmax / fXSecTableBins;
+  fXSecTable.assign(nnu * nknots * ntgt, 0.);
+
+  vector<const Spline *> splines(ntgt, 0);
+
+  for(unsigned int inu = 0; inu < nnu; inu++) {
+    for(unsigned int itgt = 0; itgt < ntgt; itgt++) {
+      InitialState init_state(fXSecTableTgt[itgt], fXSecTableNu[inu]);
+      GEVGDriver * evgdriver = fGPool->FindDriver(init_state);
+      const Spline * totxsecspl = (evgdriver) ? evgdriver->XSecSumSpline() : 0;
+      if(!totxsecspl) {
+        LOG("GMCJDriver", pFATAL)
+          << "\n * The MC Job driver isn't properly configured!"
+          << "\n * Couldn't retrieve total cross section spline for init state: "
+          << init_state.AsString();
+        exit(1);
+      }
+      splines[itgt] = totxsecspl;
+    }
+    // each table row holds all targets at the same energy
+    for(unsigned int ie = 0; ie < nknots; ie++) {
+      double E = ie * fXSecTableDE;
+      Spline::Evaluate(
+         &splines[0], ntgt, E, &fXSecTable[(inu*nknots + ie)*ntgt]);
+    }
+  }
+
+  LOG("GMCJDriver", pNOTICE)
+    << "Tabulated the total cross section for " << nnu*ntgt
+    << " initial states at " << nknots << " energies in [0, " << fEmax
+    << "] GeV (" << fXSecTable.size()*sizeof(double)/1024 << " kB)";
+}
+//___________________________________________________________________________
+const double * GMCJDriver::XSecTableRow(
+                                 int nupdg, double E, double & f) const
+{
+// Returns the row of the total xsec table (one entry per target) at the
+// energy knot just below E, or 0 if the input is not tabulated. The row of
+// the next knot starts fXSecTableTgt.size() entries later and f is the
+// linear interpolation weight of the next knot.
+
+  if(fXSecTable.size() == 0 || E < 0) return 0;
+
+  unsigned int nnu = fXSecTableNu.size();
+  unsigned int inu = 0;
+  while(inu < nnu && fXSecTableNu[inu] != nupdg) inu++;
+  if(inu == nnu) return 0;
+
+  double x = E / fXSecTableDE;
+  unsigned int ie = (unsigned int) x;
+  if(ie >= fXSecTableBins) {
+    if(E > fEmax) return 0;
+    ie = fXSecTableBins - 1; // E = Emax
+  }
+  f = x - ie;
+
+  unsigned int nknots = fXSecTableBins + 1;
+  return &fXSecTable[(inu*nknots + ie) * fXSecTableTgt.size()];
+}
+//___________________________________________________________________________
+void GMCJDriver::ComputeEnergyWindows(void)
+{
+// For each flux neutrino species find the energy range outside which the
+// total cross section is zero for all targets: below all the process
+// thresholds (the leading run of zero-valued knots of the summed splines,
+// whose range is the GEVGDriver valid energy range) or above the splines.
+// The lower edge is moved down to a total xsec table knot, if tabulated, as
+// the table interpolates linearly between its knots.
+// Flux neutrinos outside the window would always have Psum = 0.
+
+  fEnergyWindow.clear();
+
+  PDGCodeList::const_iterator nuiter;
+  PDGCodeList::const_iterator tgtiter;
+  for(nuiter = fNuList.begin(); nuiter != fNuList.end(); ++nuiter) {
+    int neutrino_pdgc = *nuiter;
+    double emin =  9999999999.;
+    double emax = -1;
+    for(tgtiter = fTgtList.begin(); tgtiter != fTgtList.end(); ++tgtiter) {
+      InitialState init_state(*tgtiter, neutrino_pdgc);
+      GEVGDriver * evgdriver = fGPool->FindDriver(init_state);
+      const Spline * totxsecspl = (evgdriver) ? evgdriver->XSecSumSpline() : 0;
+      if(!totxsecspl) continue;
+
+      int nknots = totxsecspl->NKnots();
+      int k = 0;
+      while(k < nknots && totxsecspl->GetKnotY(k) <= 0) k++;
+      if(k == nknots) continue; // no cross section at all for this target
+
+      double lo = (k > 0) ? totxsecspl->GetKnotX(k-1) : totxsecspl->XMin();
+      if(fXSecTable.size() > 0 && fXSecTableDE > 0) {
+        lo = TMath::Floor(lo/fXSecTableDE) * fXSecTableDE;
+      }
+      emin = TMath::Min(emin, lo);
+      emax = TMath::Max(emax, totxsecspl->XMax());
+    }
+    if(emax < emin) { emin = 0; emax = 0; }
+    fEnergyWindow[neutrino_pdgc] = Range1D_t(emin, emax);
+
+    LOG("GMCJDriver", pNOTICE)
+      << "Energy window for nu = " << neutrino_pdgc
+      << ": [" << emin << ", " << emax << "] GeV";
+  }
+}
+//___________________________________________________________________________
+void GMCJDriver::HintFluxEnergyWindows(void)
+{
+// Let the flux driver skip flux neutrinos that can not interact, before
+// their ray is generated or followed through the geometry
+
+  if(!fFluxDriver) return;
+
+  map<int,Range1D_t>::const_iterator it = fEnergyWindow.begin();
+  for( ; it != fEnergyWindow.end(); ++it) {
+    fFluxDriver->SetEnergyWindow(it->first, it->second.min, it->second.max);
+  }
+}
+//___________________________________________________________________________
+bool GMCJDriver::InEnergyWindow(int nupdg, double E) const
+{
+  map<int,Range1D_t>::const_iterator it = fEnergyWindow.find(nupdg);
+  if(it == fEnergyWindow.end()) return true;
+  return (E >= it->second.min && E <= it->second.max);
+}
+//___________________________________________________________________________
 void GMCJDriver::ComputeProbScales(void)
 {
 // Computing interaction probability scales.
@@ -624,6 +1364,8 @@ void GMCJDriver::ComputeProbScales(void)
 // proportions between differect flux neutrino species or flux neutrinos of
 // different energies.
 
+  StartupProfile::Scope phase("GMCJDriver::ComputeProbScales");
+
   LOG("GMCJDriver", pNOTICE)
     << "Computing the max. interaction probability (probability scale)";
 
@@ -715,29 +1457,231 @@ void GMCJDriver::ComputeProbScales(void)
     fPmax.insert(map<int,TH1D*>::value_type(neutrino_pdgc,pmax_hst));
   } // nu
 
+  this->ComputeGlobProbScale();
+}
+//___________________________________________________________________________
+void GMCJDriver::ComputeGlobProbScale(void)
+{
   // Compute global probability scale
   // Sum Probabilities {
   //   all neutrinos, all targets, @  max path length, @ max energy}
   //
-  {
-    for(nuiter = fNuList.begin(); nuiter != fNuList.end(); ++nuiter) {
-      int neutrino_pdgc = *nuiter;
-      map<int,TH1D*>::const_iterator pmax_iter = fPmax.find(neutrino_pdgc);
-      assert(pmax_iter != fPmax.end());
-      TH1D * pmax_hst = pmax_iter->second;
-      assert(pmax_hst);
-//    double pmax = pmax_hst->GetBinContent(pmax_hst->FindBin(fEmax));
-      double pmax = pmax_hst->GetMaximum();
-      assert(pmax>0);
-//    fGlobPmax += pmax;
-      fGlobPmax = TMath::Max(pmax, fGlobPmax); // ?;
+  fGlobPmax = 0;
+  fPmaxTable.clear();
+  PDGCodeList::const_iterator nuiter;
+  for(nuiter = fNuList.begin(); nuiter != fNuList.end(); ++nuiter) {
+    int neutrino_pdgc = *nuiter;
+    map<int,TH1D*>::const_iterator pmax_iter = fPmax.find(neutrino_pdgc);
+    assert(pmax_iter != fPmax.end());
+    TH1D * pmax_hst = pmax_iter->second;
+    assert(pmax_hst);
+
+    // flat copy of the bin contents, for the per flux neutrino look-ups
+    // (all histograms have the binning of ComputeProbScales())
+    if(nuiter == fNuList.begin()) {
+      fPmaxBins = pmax_hst->GetNbinsX();
+      fPmaxEmin = pmax_hst->GetXaxis()->GetXmin();
+      fPmaxDE   = pmax_hst->GetBinWidth(1);
     }
-    LOG("GMCJDriver", pNOTICE) << "*** Probability scale = " << fGlobPmax;
+    assert((unsigned int) pmax_hst->GetNbinsX() == fPmaxBins);
+    for(unsigned int ie = 1; ie <= fPmaxBins; ie++) {
+      fPmaxTable.push_back(pmax_hst->GetBinContent(ie));
+    }
+
+//  double pmax = pmax_hst->GetBinContent(pmax_hst->FindBin(fEmax));
+    double pmax = pmax_hst->GetMaximum();
+    assert(pmax>0);
+//  fGlobPmax += pmax;
+    fGlobPmax = TMath::Max(pmax, fGlobPmax); // ?;
+  }
+  LOG("GMCJDriver", pNOTICE) << "*** Probability scale = " << fGlobPmax;
+}
+//___________________________________________________________________________
+double GMCJDriver::ProbScale(int nupdg, double E) const
+{
+// The interaction probability scale (max. interaction probability) of the
+// energy bin of E, as in fPmax. Returns 0 outside the binned energy range.
+
+  if(fPmaxDE <= 0) return 0;
+  double x = (E - fPmaxEmin) / fPmaxDE;
+  if(x < 0 || x >= fPmaxBins) return 0;
+
+  unsigned int inu = 0;
+  PDGCodeList::const_iterator nuiter = fNuList.begin();
+  for( ; nuiter != fNuList.end(); ++nuiter, ++inu) {
+    if(*nuiter == nupdg) return fPmaxTable[inu*fPmaxBins + (unsigned int) x];
+  }
+  return 0;
+}
+//___________________________________________________________________________
+ULong64_t GMCJDriver::StateConfigHash(void) const
+{
+// Hash of everything the max path lengths and the probability scales depend
+// on, other than the input files: the tune & event generator list, the flux
+// neutrinos, the target materials, the max flux energy, the max path length
+// source and the total cross sections at the energies the probability
+// scales are computed at (so that any change of the cross section models or
+// of the loaded splines is caught)
+
+  std::ostringstream config;
+  config << MaxXSecTable::ConfigTag() << "/" << fEventGenList << "/nu:";
+  PDGCodeList::const_iterator nuiter, tgtiter;
+  for(nuiter = fNuList.begin(); nuiter != fNuList.end(); ++nuiter) {
+    config << *nuiter << ",";
+  }
+  config << "/tgt:";
+  for(tgtiter = fTgtList.begin(); tgtiter != fTgtList.end(); ++tgtiter) {
+    config << *tgtiter << ",";
+  }
+  config << "/maxpl:" << (fUseExtMaxPl ? fMaxPlXmlFilename : "geom") << "/";
+
+  string digest = config.str();
+  digest.append((const char *) &fEmax, sizeof(double));
+
+  // same energy grid as in ComputeProbScales()
+  double de = fEmax/300.;
+  int n = 2 + (int) ((fEmax + de)/de);
+  for(nuiter = fNuList.begin(); nuiter != fNuList.end(); ++nuiter) {
+    for(tgtiter = fTgtList.begin(); tgtiter != fTgtList.end(); ++tgtiter) {
+      InitialState init_state(*tgtiter, *nuiter);
+      GEVGDriver * evgdriver = fGPool->FindDriver(init_state);
+      if(!evgdriver || !evgdriver->XSecSumSpline()) continue;
+      for(int ie = 0; ie < n; ie++) {
+        double xsec = evgdriver->XSecSumSpline()->Evaluate(ie*de);
+        digest.append((const char *) &xsec, sizeof(double));
+      }
+    }
+  }
+  return utils::str::Hash(digest);
+}
+//___________________________________________________________________________
+bool GMCJDriver::ReadState(void)
+{
+// Read the path lengths and the probability scales of the state file given
+// with LoadState(), if it was saved by an identically configured job with
+// the same input files
+
+  if(fStateFile.empty()) return false;
+
+  StartupProfile::Scope phase("GMCJDriver::ReadState");
+
+  TFile file(fStateFile.c_str(), "READ");
+  TTree * tree = (file.IsZombie()) ? 0 :
+                  dynamic_cast<TTree*>(file.Get(kStateTreeName));
+  TTree * pltree = (file.IsZombie()) ? 0 :
+                  dynamic_cast<TTree*>(file.Get(kStatePlTreeName));
+  if(!tree || !pltree || tree->GetEntries() != 1) {
+    LOG("GMCJDriver", pERROR)
+      << "Cannot read a driver state from: " << fStateFile;
+    return false;
+  }
+
+  ULong64_t config_hash = 0, inputs_hash = 0;
+  Long64_t  flux_index  = -1;
+  double    nflux       = 0;
+  tree->SetBranchAddress("ConfigHash", &config_hash);
+  tree->SetBranchAddress("InputsHash", &inputs_hash);
+  tree->SetBranchAddress("FluxIndex",  &flux_index);
+  tree->SetBranchAddress("NFluxNu",    &nflux);
+  tree->GetEntry(0);
+
+  if(config_hash != this->StateConfigHash()) {
+    LOG("GMCJDriver", pWARN)
+      << "The driver state in " << fStateFile << " was saved with another "
+      << "configuration - Computing the path lengths & prob scales";
+    return false;
+  }
+  if(inputs_hash != InputsChecksum(fStateInputs)) {
+    LOG("GMCJDriver", pWARN)
+      << "The driver state in " << fStateFile << " was saved with other "
+      << "input files - Computing the path lengths & prob scales";
+    return false;
+  }
+
+  // all probability scales must be there before anything is replaced
+  map<int,TH1D*> pmax;
+  PDGCodeList::const_iterator nuiter;
+  for(nuiter = fNuList.begin(); nuiter != fNuList.end(); ++nuiter) {
+    std::ostringstream name;
+    name << "pmax_" << *nuiter;
+    TH1D * hst = dynamic_cast<TH1D*>(file.Get(name.str().c_str()));
+    if(!hst || hst->GetMaximum() <= 0) break;
+    hst = (TH1D*) hst->Clone("pmax_hst");
+    hst->SetDirectory(0);
+    pmax.insert(map<int,TH1D*>::value_type(*nuiter, hst));
+  }
+  if(pmax.size() != fNuList.size()) {
+    LOG("GMCJDriver", pERROR)
+      << "Incomplete driver state in: " << fStateFile;
+    map<int,TH1D*>::iterator it = pmax.begin();
+    for( ; it != pmax.end(); ++it) delete it->second;
+    return false;
+  }
+
+  int    pdg = 0;
+  double pl  = 0;
+  pltree->SetBranchAddress("PDG", &pdg);
+  pltree->SetBranchAddress("PL",  &pl);
+  fMaxPathLengths.clear();
+  for(Long64_t i = 0; i < pltree->GetEntries(); i++) {
+    pltree->GetEntry(i);
+    fMaxPathLengths.SetPathLength(pdg, pl);
+  }
+
+  map<int,TH1D*>::iterator pmax_iter = fPmax.begin();
+  for( ; pmax_iter != fPmax.end(); ++pmax_iter) delete pmax_iter->second;
+  fPmax = pmax;
+  this->ComputeGlobProbScale();
+
+  fStateFluxIndex = (long int) flux_index;
+  fStateNFluxNu   = nflux;
+  fStateLoaded    = true;
+
+  LOG("GMCJDriver", pNOTICE)
+    << "Loaded the path lengths & prob scales from: " << fStateFile;
+  LOG("GMCJDriver", pNOTICE)
+     << "Maximum path length list: " << fMaxPathLengths;
+  return true;
+}
+//___________________________________________________________________________
+void GMCJDriver::ResumeFluxDriver(void)
+{
+// Fast-forward the flux driver to the flux entry it was reading when the
+// loaded state was saved, so that the entries used by the interrupted job
+// are not used again. The skipped flux neutrinos are not propagated through
+// the geometry: the flux neutrino count is restored to the saved one.
+
+  if(fStateFluxIndex < 0) {
+    LOG("GMCJDriver", pWARN)
+      << "No flux entry was saved with the driver state - Not resuming";
+    return;
+  }
+
+  long int nskipped = 0;
+  long int first = -1;
+  while(fFluxDriver->Index() != fStateFluxIndex) {
+    if(fFluxDriver->End() || !fFluxDriver->GenerateNext()) break;
+    if(nskipped++ == 0) first = fFluxDriver->Index();
+    else if(fFluxDriver->Index() == first) break; // went round all entries
   }
+  if(fFluxDriver->Index() != fStateFluxIndex) {
+    LOG("GMCJDriver", pERROR)
+      << "Could not find the saved flux entry " << fStateFluxIndex
+      << " - Not resuming";
+    return;
+  }
+
+  fNFluxNeutrinos = fStateNFluxNu;
+
+  LOG("GMCJDriver", pNOTICE)
+    << "Resuming at flux entry " << fStateFluxIndex << " (skipped "
+    << nskipped << " flux neutrinos) after " << fNFluxNeutrinos
+    << " flux neutrinos";
 }
 //___________________________________________________________________________
 void GMCJDriver::InitEventGeneration(void)
 {
+  EnergyMemo::NewEvent();
   fCurPathLengths.clear();
   fCurEvt    = 0;
   fSelTgtPdg = 0;
@@ -746,12 +1690,23 @@ void GMCJDriver::InitEventGeneration(void)
 //___________________________________________________________________________
 EventRecord * GMCJDriver::GenerateEvent(void)
 {
+  GTRACE_SCOPE("GMCJDriver::GenerateEvent");
+
   LOG("GMCJDriver", pNOTICE) << "Generating next event...";
 
+  // workers use a generator owned by the thread driving them
+  if(fMaster) {
+    RandomGen * rnd = RandomGen::Instance();
+    if(!rnd->HasThreadGenerator()) rnd->SetThreadSeed(fWorkerSeed);
+  }
+
   this->InitEventGeneration();
 
+  if(fPipelineDepth > 0) return this->GenerateEventPipelined();
+
   while(1) {
-    bool flux_end = fFluxDriver->End();
+    // neutrinos already read ahead in a batch are still to be processed
+    bool flux_end = fFluxDriver->End() && (fBatchNext >= fBatchPdg.size());
     if(flux_end) {
        LOG("GMCJDriver", pNOTICE)
            << "No more neutrinos can be thrown by the flux driver";
@@ -773,58 +1728,91 @@ EventRecord * GMCJDriver::GenerateEvent(void)
   return 0;
 }
 //___________________________________________________________________________
-EventRecord * GMCJDriver::GenerateEvent1Try(void)
+bool GMCJDriver::SelectInteractingNeutrino(void)
 {
-// attempt generating a neutrino interaction by firing a single flux neutrino
+// Fire a single flux neutrino and decide whether it interacts. If it does,
+// select the target material it interacts with (returns true)
 //
   RandomGen * rnd = RandomGen::Instance();
 
   double Pno=0, Psum=0;
-  double R = rnd->RndEvg().Rndm();
-  LOG("GMCJDriver", pDEBUG) << "Rndm [0,1] = " << R;
+  double R = 0;
 
-  // Generate a neutrino using the input GFluxI & get current pdgc/p4/x4
-  bool flux_ok = this->GenerateFluxNeutrino();
-  if(!flux_ok) {
-     LOG("GMCJDriver", pERROR)
-        << "** Rejecting current flux neutrino (flux driver err)";
-     return 0;
-  }
+  // In batched mode, get the next flux neutrino that survived the
+  // pre-selection based on the max. path lengths (and its random number)
+  if(this->UsingFluxBatch()) {
+     if(!this->NextBatchedFluxNeutrino(R)) {
+        LOG("GMCJDriver", pNOTICE)
+           << "** Rejecting current flux neutrino";
+        return false;
+     }
+     LOG("GMCJDriver", pDEBUG) << "Rndm [0,1] = " << R;
+  } else {
+     R = rnd->RndEvg().Rndm();
+     LOG("GMCJDriver", pDEBUG) << "Rndm [0,1] = " << R;
+
+     // Generate a neutrino using the input GFluxI & get current pdgc/p4/x4
+     bool flux_ok = this->GenerateFluxNeutrino();
+     if(!flux_ok) {
+        LOG("GMCJDriver", pERROR)
+           << "** Rejecting current flux neutrino (flux driver err)";
+        return false;
+     }
 
-  // Compute the interaction probabilities assuming max. path lengths
-  // and decide whether the neutrino would interact --
-  // Many flux neutrinos should be rejected here, drastically reducing
-  // the number of neutrinos that I need to propagate through the
-  // actual detector geometry (this is skipped when using
-  // pre-calculated flux interaction probabilities)
-  if(fPreSelect) {
-       LOG("GMCJDriver", pNOTICE)
-          << "Computing interaction probabilities for max. path lengths";
+     // Reject flux neutrinos that can not interact with any target
+     // (for flux drivers that ignored the energy window hint)
+     if(!this->InEnergyWindow(fCurNuPdg, fCurNuP4.Energy())) {
+        LOG("GMCJDriver", pNOTICE)
+           << "** Rejecting current flux neutrino (outside energy window)";
+        return false;
+     }
 
-       Psum = this->ComputeInteractionProbabilities(true /* <- max PL*/);
-       Pno  = 1-Psum;
-       LOG("GMCJDriver", pNOTICE)
-          << "The no-interaction probability (max. path lengths) is: "
-          << 100*Pno << " %";
-       if(Pno<0.) {
-           LOG("GMCJDriver", pFATAL)
-             << "Negative no-interaction probability! (P = " << 100*Pno << " %)"
-             << " Particle E=" << fFluxDriver->Momentum().E() << " type=" << fFluxDriver->PdgCode() << "Psum=" << Psum;
-           gAbortingInErr=true;
-           exit(1);
-       }
-       if(R>=1-Pno) {
-  	   LOG("GMCJDriver", pNOTICE)
-              << "** Rejecting current flux neutrino";
-	   return 0;
-       }
-  } // preselect
+     // Compute the interaction probabilities assuming max. path lengths
+     // and decide whether the neutrino would interact --
+     // Many flux neutrinos should be rejected here, drastically reducing
+     // the number of neutrinos that I need to propagate through the
+     // actual detector geometry (this is skipped when using
+     // pre-calculated flux interaction probabilities)
+     if(fPreSelect && !fForceInteraction) {
+          // In unweighted mode, the probabilities are scaled to the global
+          // max but can not exceed the max of the energy bin: most neutrinos
+          // below the energy of the global max are rejected by a single
+          // look-up. Rejections are the same as with the full sum below.
+          if(fGenerateUnweighted &&
+             R >= this->ProbScale(fCurNuPdg, fCurNuP4.Energy())/fGlobPmax) {
+              LOG("GMCJDriver", pNOTICE)
+                 << "** Rejecting current flux neutrino (energy bin scale)";
+              return false;
+          }
+
+          LOG("GMCJDriver", pNOTICE)
+             << "Computing interaction probabilities for max. path lengths";
+
+          Psum = this->ComputeInteractionProbabilities(true /* <- max PL*/);
+          Pno  = 1-Psum;
+          LOG("GMCJDriver", pNOTICE)
+             << "The no-interaction probability (max. path lengths) is: "
+             << 100*Pno << " %";
+          if(Pno<0.) {
+              LOG("GMCJDriver", pFATAL)
+                << "Negative no-interaction probability! (P = " << 100*Pno << " %)"
+                << " Particle E=" << fCurNuP4.E() << " type=" << fCurNuPdg << "Psum=" << Psum;
+              gAbortingInErr=true;
+              exit(1);
+          }
+          if(R>=1-Pno) {
+              LOG("GMCJDriver", pNOTICE)
+                 << "** Rejecting current flux neutrino";
+              return false;
+          }
+     } // preselect
+  } // batched mode
 
   bool pl_ok = false;
 
 
   // If possible use pre-generated flux neutrino interaction probabilities
-  if(fFluxIntTree){
+  if(fFluxIntTable){
     Psum = this->PreGenFluxInteractionProbability();
   }
   // Else compute them in the usual manner
@@ -835,35 +1823,47 @@ EventRecord * GMCJDriver::GenerateEvent1Try(void)
     if(!pl_ok) {
        LOG("GMCJDriver", pERROR)
           << "** Rejecting current flux neutrino (err computing path-lengths)";
-       return 0;
+       return false;
     }
     if(fCurPathLengths.AreAllZero()) {
        LOG("GMCJDriver", pNOTICE)
           << "** Rejecting current flux neutrino (misses generation volume)";
-       return 0;
+       return false;
     }
     Psum = this->ComputeInteractionProbabilities(false /* <- actual PL */);
   }
 
 
-  if(TMath::Abs(Psum) < controls::kASmallNum){
+  // Reject neutrinos with a null interaction probability (any non-zero one
+  // is kept in forced interaction mode, where it weights the event)
+  bool null_prob = (fForceInteraction) ?
+     (Psum <= 0.) : (TMath::Abs(Psum) < controls::kASmallNum);
+  if(null_prob){
     LOG("GMCJDriver", pNOTICE)
        << "** Rejecting current flux neutrino (has null interaction probability)";
-    return 0;
+    return false;
+  }
+
+  // In forced interaction mode the neutrino interacts: pick the random
+  // number used for selecting the target below the probability sum
+  if(fForceInteraction) {
+     R = rnd->RndEvg().Rndm() * Psum;
+     LOG("GMCJDriver", pNOTICE)
+        << "Forcing the interaction (normalized probability: " << Psum << ")";
   }
 
   // Now decide whether the current neutrino interacts
   Pno  = 1-Psum;
   LOG("GMCJDriver", pNOTICE)
      << "The actual 'no interaction' probability is: " << 100*Pno << " %";
-  if(Pno<0.) {
+  if(Pno<0. && !fForceInteraction) {
       LOG("GMCJDriver", pFATAL)
          << "Negative no interactin probability! (P = " << 100*Pno << " %)";
 
       // print info about what caused the problem
-      int                    nupdg = fFluxDriver -> PdgCode  ();
-      const TLorentzVector & nup4  = fFluxDriver -> Momentum ();
-      const TLorentzVector & nux4  = fFluxDriver -> Position ();
+      int                    nupdg = fCurNuPdg;
+      const TLorentzVector & nup4  = fCurNuP4;
+      const TLorentzVector & nux4  = fCurNuX4;
 
       LOG("GMCJDriver", pWARN)
         << "\n [-] Problematic neutrino: "
@@ -883,7 +1883,7 @@ EventRecord * GMCJDriver::GenerateEvent1Try(void)
   if(R>=1-Pno) {
      LOG("GMCJDriver", pNOTICE)
         << "** Rejecting current flux neutrino";
-     return 0;
+     return false;
   }
 
   //
@@ -892,7 +1892,7 @@ EventRecord * GMCJDriver::GenerateEvent1Try(void)
 
   // Calculate path lengths for first time and check potential mismatch if
   // used pre-generated flux interaction probabilities
-  if(fFluxIntTree){
+  if(fFluxIntTable){
     pl_ok = this->ComputePathLengths();
     if(!pl_ok) {
       LOG("GMCJDriver", pFATAL) << "** Cannot calculate path lenths!";
@@ -913,9 +1913,18 @@ EventRecord * GMCJDriver::GenerateEvent1Try(void)
   if(fSelTgtPdg==0) {
      LOG("GMCJDriver", pERROR)
         << "** Rejecting current flux neutrino (failed to select tgt!)";
-     return 0;
+     return false;
   }
 
+  return true;
+}
+//___________________________________________________________________________
+EventRecord * GMCJDriver::GenerateEvent1Try(void)
+{
+// attempt generating a neutrino interaction by firing a single flux neutrino
+//
+  if(!this->SelectInteractingNeutrino()) return 0;
+
   // Ask the GEVGDriver object to select and generate an interaction and
   // its kinematics for the selected initial state & neutrino 4-momentum
   this->GenerateEventKinematics();
@@ -941,6 +1950,131 @@ EventRecord * GMCJDriver::GenerateEvent1Try(void)
   return fCurEvt;
 }
 //___________________________________________________________________________
+EventRecord * GMCJDriver::GenerateEventPipelined(void)
+{
+// Take the next interacting neutrino queued by the flux & geometry stage
+// (with its target material & vertex) and generate its interaction
+
+  if(!fPipeline) this->StartPipeline();
+
+  RayItem item;
+  while(fPipeline->queue.Pop(item)) {
+     fNFluxNeutrinos = item.nflux;
+     EventGenCost & cost = EventGenCost::Current();
+     cost.nflux      += item.cost_nflux;
+     cost.ngeomsteps += item.cost_ngeomsteps;
+     cost.geomtime   += item.cost_geomtime;
+     if(item.end) break;
+
+     fCurNuPdg         = item.nupdg;
+     fCurNuP4          = item.p4;
+     fCurNuX4          = item.x4;
+     fCurVtx           = item.vtx;
+     fSelTgtPdg        = item.tgtpdg;
+     fCurProbScale     = item.probscale;
+     fCurTgtBiasWeight = item.biasweight;
+     fCurPathLengths.swap(item.pl);
+     fCurTgtProb    .swap(item.tgtprob);
+
+     this->GenerateEventKinematics();
+     if(!fCurEvt) {
+        LOG("GMCJDriver", pWARN)
+           << "** Couldn't generate kinematics for selected interaction";
+        if(fKeepThrowingFluxNu) continue;
+        return 0;
+     }
+     fCurEvt->SetVertex(fCurVtx);
+     this->ComputeEventProbability();
+
+     return fCurEvt;
+  }
+
+  LOG("GMCJDriver", pNOTICE)
+      << "No more neutrinos can be thrown by the flux driver";
+  return 0;
+}
+//___________________________________________________________________________
+void GMCJDriver::StartPipeline(void)
+{
+// Start the flux & geometry stage thread. The stage is run by a worker of
+// this driver, using this driver's flux driver & geometry analyzer, and a
+// random number generator seeded from the job (or worker) seed.
+
+  long int seed = (fMaster) ? fWorkerSeed : RandomGen::Instance()->GetSeed();
+
+  GMCJDriver * stage = new GMCJDriver;
+  stage->InitWorker(this);
+  stage->UseFluxDriver(fFluxDriver);
+  stage->UseGeomAnalyzer(fGeomAnalyzer);
+  stage->fPipelineDepth  = 0;
+  stage->fNFluxNeutrinos = fNFluxNeutrinos;
+  stage->fWorkerSeed     = utils::app_init::ThreadSeed(seed, -1);
+
+  fPipeline = new Pipeline(fPipelineDepth, stage);
+  fPipeline->thread =
+     std::thread(&GMCJDriver::RunPipelineStage, stage, fPipeline);
+
+  LOG("GMCJDriver", pNOTICE)
+    << "Started the flux & geometry stage thread (queue depth: "
+    << fPipelineDepth << ", random number seed: " << stage->fWorkerSeed << ")";
+}
+//___________________________________________________________________________
+void GMCJDriver::StopPipeline(void)
+{
+  if(!fPipeline) return;
+
+  fPipeline->stop = true;
+  fPipeline->queue.Close();
+  if(fPipeline->thread.joinable()) fPipeline->thread.join();
+
+  delete fPipeline->stage;
+  delete fPipeline;
+  fPipeline = 0;
+}
+//___________________________________________________________________________
+void GMCJDriver::RunPipelineStage(Pipeline * pipeline)
+{
+// The flux & geometry stage (run by the stage driver, on the stage thread):
+// queue the interacting flux neutrinos, with their target material & vertex,
+// till the flux driver reaches its End() or the pipeline is stopped.
+
+  RandomGen::Instance()->SetThreadSeed(fWorkerSeed);
+
+  EventGenCost & cost = EventGenCost::Current();
+  cost.Reset();
+
+  RayItem item;
+  while(!pipeline->stop) {
+     this->InitEventGeneration();
+
+     // neutrinos already read ahead in a batch are still to be processed
+     bool flux_end = fFluxDriver->End() && (fBatchNext >= fBatchPdg.size());
+     if(!flux_end) {
+        if(!this->SelectInteractingNeutrino()) continue;
+        this->ComputeVertexPosition();
+
+        item.nupdg      = fCurNuPdg;
+        item.p4         = fCurNuP4;
+        item.x4         = fCurNuX4;
+        item.vtx        = fCurVtx;
+        item.tgtpdg     = fSelTgtPdg;
+        item.probscale  = fCurProbScale;
+        item.biasweight = fCurTgtBiasWeight;
+        item.pl.swap(fCurPathLengths);
+        item.tgtprob = fCurTgtProb;
+     }
+     item.end             = flux_end;
+     item.nflux           = fNFluxNeutrinos;
+     item.cost_nflux      = cost.nflux;
+     item.cost_ngeomsteps = cost.ngeomsteps;
+     item.cost_geomtime   = cost.geomtime;
+     cost.Reset();
+
+     if(!pipeline->queue.Push(std::move(item)) || flux_end) break;
+  }
+  pipeline->queue.Close();
+}
+//___________________________________________________________________________
 bool GMCJDriver::GenerateFluxNeutrino(void)
 {
 // Ask the neutrino flux driver to generate a flux neutrino and make sure
@@ -948,7 +2082,11 @@ bool GMCJDriver::GenerateFluxNeutrino(void)
 //
   LOG("GMCJDriver", pNOTICE) << "Generating a flux neutrino";
 
-  bool ok = fFluxDriver->GenerateNext();
+  bool ok = false;
+  {
+    GTRACE_SCOPE("GFluxI::GenerateNext");
+    ok = fFluxDriver->GenerateNext();
+  }
   if(!ok) {
      LOG("GMCJDriver", pERROR)
          << "*** The flux driver couldn't generate a flux neutrino!!";
@@ -956,9 +2094,14 @@ bool GMCJDriver::GenerateFluxNeutrino(void)
   }
 
   fNFluxNeutrinos++;
-  int                    nupdg = fFluxDriver -> PdgCode  ();
-  const TLorentzVector & nup4  = fFluxDriver -> Momentum ();
-  const TLorentzVector & nux4  = fFluxDriver -> Position ();
+  EventGenCost::Current().nflux++;
+  fCurNuPdg = fFluxDriver -> PdgCode  ();
+  fCurNuP4  = fFluxDriver -> Momentum ();
+  fCurNuX4  = fFluxDriver -> Position ();
+
+  int                    nupdg = fCurNuPdg;
+  const TLorentzVector & nup4  = fCurNuP4;
+  const TLorentzVector & nux4  = fCurNuX4;
 
   LOG("GMCJDriver", pNOTICE)
      << "\n [-] Generated flux neutrino: "
@@ -985,6 +2128,209 @@ bool GMCJDriver::GenerateFluxNeutrino(void)
   return true;
 }
 //___________________________________________________________________________
+bool GMCJDriver::UsingFluxBatch(void) const
+{
+  return (fFluxBatchSize > 1 && fPreSelect && !fForceInteraction &&
+          !fFluxIntTable);
+}
+//___________________________________________________________________________
+bool GMCJDriver::FillFluxBatch(void)
+{
+// Read the next batch of flux neutrinos, throw a random number for each one
+// and pre-select them all. Returns false if no flux neutrino could be read.
+
+  RandomGen * rnd = RandomGen::Instance();
+
+  fBatchPdg.clear();
+  fBatchE.clear();
+  fBatchR.clear();
+  fBatchP4.clear();
+  fBatchX4.clear();
+  fBatchNext = 0;
+
+  LOG("GMCJDriver", pNOTICE)
+     << "Generating a batch of " << fFluxBatchSize << " flux neutrinos";
+
+  for(unsigned int i = 0; i < fFluxBatchSize; i++) {
+     if(fFluxDriver->End()) break;
+     bool ok = false;
+     {
+       GTRACE_SCOPE("GFluxI::GenerateNext");
+       ok = fFluxDriver->GenerateNext();
+     }
+     if(!ok) {
+        LOG("GMCJDriver", pERROR)
+            << "*** The flux driver couldn't generate a flux neutrino!!";
+        continue;
+     }
+     fBatchPdg.push_back (fFluxDriver->PdgCode ());
+     fBatchP4.push_back  (fFluxDriver->Momentum());
+     fBatchX4.push_back  (fFluxDriver->Position());
+     fBatchE.push_back   (fBatchP4.back().Energy());
+     fBatchR.push_back   (rnd->RndEvg().Rndm());
+  }
+  if(fBatchPdg.size() == 0) return false;
+
+  this->PreSelectFluxBatch();
+
+  return true;
+}
+//___________________________________________________________________________
+void GMCJDriver::PreSelectFluxBatch(void)
+{
+// Compute the interaction probabilities for max. path lengths for all flux
+// neutrinos of the current batch. That is equivalent to calling
+// ComputeInteractionProbabilities(true) for each neutrino, but the GEVGDriver
+// look-ups and probability scales are obtained once per batch and the inner
+// loop over the batch only interpolates the tabulated total cross sections
+// (or evaluates the total cross section splines, if not tabulated).
+// Neutrinos that the flux driver shouldn't have generated, or that are
+// outside the energy window, get Psum = -1.
+
+  unsigned int n = fBatchPdg.size();
+  fBatchPsum.assign(n, 0.);
+
+  // inverse probability scale and total xsec table row for each neutrino
+  vector<double> pmaxinv(n, 0.);
+  vector<double> xsec_f(n, 0.);
+  vector<const double *> xsec_row(n, (const double *) 0);
+  for(unsigned int i = 0; i < n; i++) {
+     if(fBatchE[i] > fEmax) {
+        LOG("GMCJDriver", pFATAL)
+          << "\n *** Flux driver error ***"
+          << "\n Generated flux v with E = " << fBatchE[i] << " GeV"
+          << "\n Max v energy (declared by flux driver) = " << fEmax << " GeV"
+          << "\n My interaction probability scaling is invalidated!!";
+        fBatchPsum[i] = -1;
+        continue;
+     }
+     if(!fNuList.ExistsInPDGCodeList(fBatchPdg[i])) {
+        LOG("GMCJDriver", pFATAL)
+          << "\n *** Flux driver error ***"
+          << "\n Generated flux v with pdg = " << fBatchPdg[i]
+          << "\n It does not belong to the declared list of flux neutrinos"
+          << "\n I was not configured to handle this!!";
+        fBatchPsum[i] = -1;
+        continue;
+     }
+     if(!this->InEnergyWindow(fBatchPdg[i], fBatchE[i])) {
+        fBatchPsum[i] = -1;
+        continue;
+     }
+     double pmax_bin = this->ProbScale(fBatchPdg[i], fBatchE[i]);
+     double pmax = (fGenerateUnweighted) ? fGlobPmax : pmax_bin;
+     assert(pmax>0);
+     // unweighted: the energy bin scale bounds the probability sum
+     if(fGenerateUnweighted && fBatchR[i] >= pmax_bin/fGlobPmax) {
+        fBatchPsum[i] = -1;
+        continue;
+     }
+     pmaxinv[i] = 1./pmax;
+     xsec_row[i] = this->XSecTableRow(fBatchPdg[i], fBatchE[i], xsec_f[i]);
+  }
+
+  PathLengthList::const_iterator pliter = fMaxPathLengths.begin();
+  for( ; pliter != fMaxPathLengths.end(); ++pliter) {
+     int    mpdg = pliter->first;  // material PDG code
+     double pl   = pliter->second; // density x path-length
+     if(pl <= 0.) continue;
+
+     // the interaction probability is linear in the cross section
+     int    A      = pdg::IonPdgCodeToA(mpdg);
+     double pscale = this->InteractionProbability(1., pl, A);
+
+     // use the tabulated total cross sections, if available
+     unsigned int ntgt = fXSecTableTgt.size();
+     unsigned int itgt = std::lower_bound(fXSecTableTgt.begin(),
+                              fXSecTableTgt.end(), mpdg) - fXSecTableTgt.begin();
+     if(itgt < ntgt && fXSecTableTgt[itgt] == mpdg) {
+        for(unsigned int i = 0; i < n; i++) {
+           if(!xsec_row[i] || fBatchPsum[i] < 0) continue;
+           double xsec_lo = xsec_row[i][itgt];
+           double xsec_hi = xsec_row[i][itgt + ntgt];
+           fBatchPsum[i] +=
+              pscale * (xsec_lo + xsec_f[i]*(xsec_hi-xsec_lo)) * pmaxinv[i];
+        }
+        continue;
+     }
+
+     PDGCodeList::const_iterator nuiter = fNuList.begin();
+     for( ; nuiter != fNuList.end(); ++nuiter) {
+        int nupdg = *nuiter;
+        InitialState init_state(mpdg, nupdg);
+        GEVGDriver * evgdriver = fGPool->FindDriver(init_state);
+        if(!evgdriver) {
+          LOG("GMCJDriver", pFATAL)
+           << "\n * The MC Job driver isn't properly configured!"
+           << "\n * No event generation driver could be found for init state: "
+           << init_state.AsString();
+          exit(1);
+        }
+        const Spline * totxsecspl = evgdriver->XSecSumSpline();
+        if(!totxsecspl) {
+          LOG("GMCJDriver", pFATAL)
+            << "\n * The MC Job driver isn't properly configured!"
+            << "\n * Couldn't retrieve total cross section spline for init state: "
+            << init_state.AsString();
+          exit(1);
+        }
+        for(unsigned int i = 0; i < n; i++) {
+           if(fBatchPdg[i] != nupdg || fBatchPsum[i] < 0) continue;
+           fBatchPsum[i] +=
+              pscale * totxsecspl->Evaluate(fBatchE[i]) * pmaxinv[i];
+        }
+     }
+  }
+
+  for(unsigned int i = 0; i < n; i++) {
+     if(fBatchPsum[i] > 1.) {
+        LOG("GMCJDriver", pFATAL)
+          << "Negative no-interaction probability! (P = "
+          << 100*(1-fBatchPsum[i]) << " %)"
+          << " Particle E=" << fBatchE[i] << " type=" << fBatchPdg[i]
+          << "Psum=" << fBatchPsum[i];
+        gAbortingInErr=true;
+        exit(1);
+     }
+  }
+}
+//___________________________________________________________________________
+bool GMCJDriver::NextBatchedFluxNeutrino(double & R)
+{
+// Make the next flux neutrino of the batch that survived the pre-selection
+// the current one, reading a new batch if needed. Each flux neutrino is
+// counted when processed (not when read ahead), so that the normalization is
+// not affected by the neutrinos left in the batch at the end of the job.
+// Unless the driver keeps throwing flux neutrinos till one interacts, a
+// single flux neutrino is processed per call.
+
+  while(1) {
+     if(fBatchNext >= fBatchPdg.size()) {
+        if(fFluxDriver->End()) return false;
+        if(!this->FillFluxBatch()) return false;
+     }
+     unsigned int i = fBatchNext++;
+     fNFluxNeutrinos++;
+     EventGenCost::Current().nflux++;
+
+     if(fBatchR[i] < fBatchPsum[i]) {
+        fCurNuPdg = fBatchPdg[i];
+        fCurNuP4  = fBatchP4[i];
+        fCurNuX4  = fBatchX4[i];
+        R         = fBatchR[i];
+        LOG("GMCJDriver", pNOTICE)
+           << "\n [-] Pre-selected flux neutrino: "
+           << "\n  |----o PDG-code   : " << fCurNuPdg
+           << "\n  |----o 4-momentum : " << utils::print::P4AsString(&fCurNuP4)
+           << "\n  |----o 4-position : " << utils::print::X4AsString(&fCurNuX4)
+           << "\n  |----o P(max. path lengths) = " << 100*fBatchPsum[i] << " %";
+        return true;
+     }
+     if(!fKeepThrowingFluxNu) return false;
+  }
+  return false;
+}
+//___________________________________________________________________________
 bool GMCJDriver::ComputePathLengths(void)
 {
 // Ask the geometry driver to compute (pathLength x density x weight frac.)
@@ -993,10 +2339,12 @@ bool GMCJDriver::ComputePathLengths(void)
 
   fCurPathLengths.clear();
 
-  const TLorentzVector & nup4  = fFluxDriver -> Momentum ();
-  const TLorentzVector & nux4  = fFluxDriver -> Position ();
+  const TLorentzVector & nup4  = fCurNuP4;
+  const TLorentzVector & nux4  = fCurNuX4;
 
+  double start = EventGenCost::WallTime();
   fCurPathLengths = fGeomAnalyzer->ComputePathLengths(nux4, nup4);
+  EventGenCost::Current().geomtime += EventGenCost::WallTime() - start;
 
   LOG("GMCJDriver", pNOTICE) << fCurPathLengths;
 
@@ -1020,14 +2368,27 @@ double GMCJDriver::ComputeInteractionProbabilities(bool use_max_path_length)
        << "Computing relative interaction probabilities for each material";
 
   // current flux neutrino code & 4-p
-  int                    nupdg = fFluxDriver->PdgCode();
-  const TLorentzVector & nup4  = fFluxDriver->Momentum();
+  int                    nupdg = fCurNuPdg;
+  const TLorentzVector & nup4  = fCurNuP4;
 
-  fCurCumulProbMap.clear();
+  fCurTgtPdg.clear();
+  fCurTgtProb.clear();
+  fCurProbScale = 0;
 
   const PathLengthList & path_length_list =
         (use_max_path_length) ? fMaxPathLengths : fCurPathLengths;
 
+  // probability scale for the current neutrino (looked-up once, at the
+  // first material with a non-zero path length)
+  double pmax = -1;
+
+  // tabulated total xsecs at the current energy (targets are sorted as
+  // the path length list entries, so they are looked-up in a single pass)
+  double f = 0;
+  const double * xsec_row = this->XSecTableRow(nupdg, nup4.Energy(), f);
+  unsigned int ntgt = fXSecTableTgt.size();
+  unsigned int itgt = 0;
+
   double probsum=0;
   PathLengthList::const_iterator pliter;
 
@@ -1040,27 +2401,36 @@ double GMCJDriver::ComputeInteractionProbabilities(bool use_max_path_length)
      double prob  = 0.;                       // interaction probability
      double probn = 0.;                       // normalized interaction probability
 
-     // find the GEVGDriver object that is handling the current init state
-     InitialState init_state(mpdg, nupdg);
-     GEVGDriver * evgdriver = fGPool->FindDriver(init_state);
-     if(!evgdriver) {
-       LOG("GMCJDriver", pFATAL)
-        << "\n * The MC Job driver isn't properly configured!"
-        << "\n * No event generation driver could be found for init state: "
-        << init_state.AsString();
-       exit(1);
-     }
      // compute the interaction xsec and probability (if path-length>0)
      if(pl>0.) {
-        const Spline * totxsecspl = evgdriver->XSecSumSpline();
-        if(!totxsecspl) {
-            LOG("GMCJDriver", pFATAL)
-              << "\n * The MC Job driver isn't properly configured!"
-              << "\n * Couldn't retrieve total cross section spline for init state: "
-              << init_state.AsString();
-            exit(1);
+        while(itgt < ntgt && fXSecTableTgt[itgt] < mpdg) itgt++;
+        bool tabulated =
+           (xsec_row != 0 && itgt < ntgt && fXSecTableTgt[itgt] == mpdg);
+        if(tabulated) {
+            double xsec_lo = xsec_row[itgt];
+            double xsec_hi = xsec_row[itgt + ntgt];
+            xsec = xsec_lo + f * (xsec_hi - xsec_lo);
         } else {
-            xsec = totxsecspl->Evaluate( nup4.Energy() );
+            // find the GEVGDriver object that is handling the current init state
+            InitialState init_state(mpdg, nupdg);
+            GEVGDriver * evgdriver = fGPool->FindDriver(init_state);
+            if(!evgdriver) {
+              LOG("GMCJDriver", pFATAL)
+               << "\n * The MC Job driver isn't properly configured!"
+               << "\n * No event generation driver could be found for init state: "
+               << init_state.AsString();
+              exit(1);
+            }
+            const Spline * totxsecspl = evgdriver->XSecSumSpline();
+            if(!totxsecspl) {
+                LOG("GMCJDriver", pFATAL)
+                  << "\n * The MC Job driver isn't properly configured!"
+                  << "\n * Couldn't retrieve total cross section spline for init state: "
+                  << init_state.AsString();
+                exit(1);
+            } else {
+                xsec = EnergyMemo::Evaluate( totxsecspl, nup4.Energy() );
+            }
         }
         prob = this->InteractionProbability(xsec,pl,A);
         LOG("GMCJDriver", pDEBUG)
@@ -1069,19 +2439,14 @@ double GMCJDriver::ComputeInteractionProbabilities(bool use_max_path_length)
         // scale the interaction probability to the maximum one so as not
         // to have to throw few billions of flux neutrinos before getting
         // an interaction...
-        double pmax = 0;
-        if(fGenerateUnweighted) pmax = fGlobPmax;
-        else {
-           map<int,TH1D*>::const_iterator pmax_iter = fPmax.find(nupdg);
-           assert(pmax_iter != fPmax.end());
-           TH1D * pmax_hst = pmax_iter->second;
-           assert(pmax_hst);
-           int    ie   = pmax_hst->FindBin(nup4.Energy());
-           pmax = pmax_hst->GetBinContent(ie);
+        if(pmax < 0) {
+           if(fGenerateUnweighted) pmax = fGlobPmax;
+           else pmax = this->ProbScale(nupdg, nup4.Energy());
+           LOG("GMCJDriver", pDEBUG)
+             << "Pmax=" << pmax;
+           fCurProbScale = pmax;
         }
         assert(pmax>0);
-        LOG("GMCJDriver", pDEBUG)
-          << "Pmax=" << pmax;
         probn = prob/pmax;
      }
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
@@ -1091,7 +2456,8 @@ double GMCJDriver::ComputeInteractionProbabilities(bool use_max_path_length)
 #endif
 
      probsum += probn;
-     fCurCumulProbMap.insert(map<int,double>::value_type(mpdg,probsum));
+     fCurTgtPdg .push_back(mpdg);
+     fCurTgtProb.push_back(probn);
   }
   return probsum;
 }
@@ -1102,16 +2468,43 @@ int GMCJDriver::SelectTargetMaterial(double R)
 // for a flux neutrino that has already been determined that interacts
 
   LOG("GMCJDriver", pNOTICE) << "Selecting target material";
-  int tgtpdg = 0;
-  map<int,double>::const_iterator probiter = fCurCumulProbMap.begin();
-  for( ; probiter != fCurCumulProbMap.end(); ++probiter) {
-     double prob = probiter->second;
-     if(R<prob) {
-        tgtpdg = probiter->first;
+
+  double psum = 0;
+  for(unsigned int i = 0; i < fCurTgtProb.size(); i++) psum += fCurTgtProb[i];
+
+  // if biasing, the material is selected from the biased probabilities (the
+  // decision that the neutrino interacts, R < psum, is not biased) and the
+  // event is weighted back to the unbiased selection probabilities
+  bool biased = fBias.HasTargetBias();
+  double bpsum = 0;
+  if(biased) {
+     fCurTgtBiasedProb.resize(fCurTgtProb.size());
+     for(unsigned int i = 0; i < fCurTgtProb.size(); i++) {
+        fCurTgtBiasedProb[i] =
+             fBias.TargetFactor(fCurTgtPdg[i]) * fCurTgtProb[i];
+        bpsum += fCurTgtBiasedProb[i];
+     }
+  }
+  const vector<double> & selection = (biased) ? fCurTgtBiasedProb : fCurTgtProb;
+
+  // R was found to be below the probability sum, so R/probsum is uniform
+  // in [0,1) and can be re-used for sampling the alias table - built once
+  // for each interacting neutrino
+  fCurTgtBiasWeight = 1.;
+  if(R < psum && fTgtSampler.Build(selection)) {
+     double u = R / psum;
+     int tgtpdg = fCurTgtPdg[ fTgtSampler.Sample(u) ];
+     if(biased) {
+        double b = fBias.TargetFactor(tgtpdg);
+        fCurTgtBiasWeight = ChannelBias::Weight(psum, bpsum, b);
+     }
+     LOG("GMCJDriver", pNOTICE)
+        << "Selected target material = " << tgtpdg;
+     if(biased) {
         LOG("GMCJDriver", pNOTICE)
-          << "Selected target material = " << tgtpdg;
-        return tgtpdg;
+           << "Target material bias weight = " << fCurTgtBiasWeight;
      }
+     return tgtpdg;
   }
   LOG("GMCJDriver", pERROR)
      << "Could not select target material for an interacting neutrino";
@@ -1120,8 +2513,8 @@ int GMCJDriver::SelectTargetMaterial(double R)
 //___________________________________________________________________________
 void GMCJDriver::GenerateEventKinematics(void)
 {
-  int                    nupdg = fFluxDriver->PdgCode();
-  const TLorentzVector & nup4  = fFluxDriver->Momentum();
+  int                    nupdg = fCurNuPdg;
+  const TLorentzVector & nup4  = fCurNuP4;
 
   // Find the GEVGDriver object that generates interactions for the
   // given initial state (neutrino + target)
@@ -1133,6 +2526,13 @@ void GMCJDriver::GenerateEventKinematics(void)
      exit(1);
   }
 
+  // the GEVGDriver may be shared with other worker threads, and the physics
+  // modules with any other thread, unless they are private to this thread
+  std::unique_lock<std::mutex> lock(gGEVGPoolMutex, std::defer_lock);
+  bool shared = fMaster || fHasWorkers ||
+                !AlgFactory::Instance()->UsesThreadPool();
+  if(shared) lock.lock();
+
   // propagate current unphysical event mask
   evgdriver->SetUnphysEventMask(*fUnphysEventMask);
 
@@ -1144,16 +2544,25 @@ void GMCJDriver::GenerateEventKinematics(void)
 }
 //___________________________________________________________________________
 void GMCJDriver::GenerateVertexPosition(void)
+{
+  this->ComputeVertexPosition();
+
+  fCurEvt->SetVertex(fCurVtx);
+}
+//___________________________________________________________________________
+void GMCJDriver::ComputeVertexPosition(void)
 {
   // Generate an 'interaction position' in the selected material, along
   // the direction of nup4
   LOG("GMCJDriver", pNOTICE)
      << "Asking the geometry analyzer to generate a vertex";
 
-  const TLorentzVector & p4 = fFluxDriver->Momentum ();
-  const TLorentzVector & x4 = fFluxDriver->Position ();
+  const TLorentzVector & p4 = fCurNuP4;
+  const TLorentzVector & x4 = fCurNuX4;
 
+  double start = EventGenCost::WallTime();
   const TVector3 & vtx = fGeomAnalyzer->GenerateVertex(x4, p4, fSelTgtPdg);
+  EventGenCost::Current().geomtime += EventGenCost::WallTime() - start;
 
   TVector3 origin(x4.X(), x4.Y(), x4.Z());
   origin-=vtx; // computes vector dr = origin - vtx
@@ -1166,8 +2575,6 @@ void GMCJDriver::GenerateVertexPosition(void)
      << "|vtx - origin|: dL = " << dL << " m, dt = " << dt << " sec";
 
   fCurVtx.SetXYZT(vtx.x(), vtx.y(), vtx.z(), x4.T() + dt);
-
-  fCurEvt->SetVertex(fCurVtx);
 }
 //___________________________________________________________________________
 void GMCJDriver::ComputeEventProbability(void)
@@ -1196,16 +2603,22 @@ void GMCJDriver::ComputeEventProbability(void)
   double Ev     = nu->P4()->Energy();
 
   double weight = 1.0;
+  if(fForceInteraction) {
+     // the probability that the flux neutrino interacts at all
+     double psum = 0;
+     for(unsigned int i = 0; i < fCurTgtProb.size(); i++) psum += fCurTgtProb[i];
+     weight = psum * fCurProbScale;
+  }
+  else
   if(!fGenerateUnweighted) {
-     map<int,TH1D*>::const_iterator pmax_iter = fPmax.find(nu_pdg);
-     assert(pmax_iter != fPmax.end());
-     TH1D * pmax_hst = pmax_iter->second;
-     assert(pmax_hst);
-     double pmax = pmax_hst->GetBinContent(pmax_hst->FindBin(Ev));
+     double pmax = this->ProbScale(nu_pdg, Ev);
      assert(pmax>0);
      weight = pmax/fGlobPmax;
   }
 
+  // compensate for any biasing of the target material selection
+  weight *= fCurTgtBiasWeight;
+
   // set probability & update weight
   fCurEvt->SetProbability(P);
   fCurEvt->SetWeight(weight * fCurEvt->Weight());
@@ -1230,9 +2643,9 @@ double GMCJDriver::PreGenFluxInteractionProbability()
 // neutrino index (entry number in flux file). Exit if not possible as
 // using meaningless interaction probability leads to incorrect physics
 //
-  if(!fFluxIntTree){
+  if(!fFluxIntTable){
     LOG("GMCJDriver", pERROR) <<
-         "Cannot get pre-computed flux interaction probability as no tree!";
+         "Cannot get pre-computed flux interaction probability as no table!";
     exit(1);
   }
 
@@ -1240,20 +2653,22 @@ double GMCJDriver::PreGenFluxInteractionProbability()
 
   // Check if can find relevant entry and no mismatch in energies -->
   // using correct pre-gen interaction prob file
-  bool found_entry = fFluxIntTree->GetEntryWithIndex(fFluxDriver->Index()) > 0;
+  Long64_t irow = fFluxIntTable->Find(fFluxDriver->Index());
+  bool found_entry = irow >= 0;
   bool enu_match = false;
   if(found_entry){
-    double rel_err = fBrFluxEnu-fFluxDriver->Momentum().E();
-    if(fBrFluxEnu > controls::kASmallNum) rel_err /= fBrFluxEnu;
+    double enu = fFluxIntTable->Enu(irow);
+    double rel_err = enu-fFluxDriver->Momentum().E();
+    if(enu > controls::kASmallNum) rel_err /= enu;
     enu_match = TMath::Abs(rel_err)<controls::kASmallNum;
     if(enu_match == false){
       LOG("GMCJDriver", pERROR) <<
            "Mismatch between: Enu_curr  = "<< fFluxDriver->Momentum().E() <<
-           ", Enu_pre_gen = "<< fBrFluxEnu;
+           ", Enu_pre_gen = "<< enu;
     }
   }
   else {
-    LOG("GMCJDriver", pERROR) << "Cannot find flux entry in interaction prob tree!";
+    LOG("GMCJDriver", pERROR) << "Cannot find flux entry in interaction prob table!";
   }
 
   // Exit if not successful
@@ -1267,6 +2682,6 @@ double GMCJDriver::PreGenFluxInteractionProbability()
     exit(1);
   }
   assert(fGlobPmax+controls::kASmallNum>0.0);
-  return fBrFluxIntProb/fGlobPmax;
+  return fFluxIntTable->Prob(irow)/fGlobPmax;
 }
 //___________________________________________________________________________
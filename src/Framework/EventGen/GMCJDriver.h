@@ -7,6 +7,88 @@
           generation cases involving detailed flux descriptions and detector
           geometry descriptions.
 
+          Multi-threaded event generation: Once a driver has been configured,
+          SpawnWorker() returns light-weight worker drivers, one per thread.
+          All workers share the (read-only) GEVGPool, cross section splines,
+          path-length lists and probability scales of the configured driver,
+          but each one uses its own flux driver, geometry analyzer, random
+          number generator and event state. Each worker must be driven by a
+          single thread and must be deleted before the driver that spawned it.
+          Physics generation by the shared GEVGDrivers is serialized; flux
+          neutrino generation, geometry navigation and the (dominant, for
+          large detectors) interaction rejection loop run in parallel.
+          The sample normalization is obtained by summing the NFluxNeutrinos()
+          of all workers.
+          Alternatively, each thread can use a driver of its own, configured
+          on the thread after AlgFactory::UseThreadPool(true): the physics
+          modules of such drivers are private to the thread, and their
+          generation is not serialized.
+
+          Batched pre-selection: With SetFluxBatchSize(n), the driver reads
+          n flux neutrinos ahead and rejects, in a single pass over the batch,
+          all the ones that would not interact even along the maximum path
+          lengths. Only the surviving neutrinos are propagated through the
+          geometry. As the flux driver is read ahead, its accessors no longer
+          describe the neutrino that interacted: Use batching only with flux
+          drivers whose neutrinos are fully described by their PDG code and
+          4-momentum / 4-position (the ones stored in the event record).
+
+          Pre-calculated flux interaction probabilities: The per flux entry
+          probabilities can be computed by several threads (each one with its
+          own flux driver & geometry analyzer, see AddFluxProbabilityThread())
+          and by several jobs (one shard of the flux entries each, see
+          SetFluxProbabilityShard()), whose tables are merged at loading.
+          Tables saved with a *.gflxprob name are in the compact binary format
+          of FluxIntProbTable and are mapped (not read) into memory at loading.
+
+          Forced interactions: With ForceInteraction(), every flux neutrino
+          that crosses a target material interacts and the event weight is
+          multiplied by the probability that it interacts at all (the sum of
+          the interaction probabilities along its path). There is no
+          rejection step, so samples of rarely interacting neutrinos (eg high
+          energy atmospheric neutrinos in a large geometry) need orders of
+          magnitude fewer flux neutrinos. The weights are absolute: the
+          expected number of events is the sum of the event (and flux
+          driver) weights, for the exposure of the NFluxNeutrinos() thrown.
+          The mode is switched on by default with the --force-interactions
+          option, and then GlobProbScale() returns 1 so that the exposure of
+          the generated sample is the one of the flux neutrinos read-in.
+
+          Biasing: With SetChannelBias() (or the --channel-bias option), the
+          target material of an interacting neutrino is selected from its
+          interaction probability multiplied by the tgt:<pdg> factors of the
+          biasing rules (see ChannelBias), and the interaction channel by the
+          GEVGDrivers from the biased cross sections. The decision of whether
+          a flux neutrino interacts is not biased, and the event weight is
+          multiplied by the ratio of the unbiased to the biased selection
+          probabilities, so that the flux / POT normalisation is exact.
+
+          Pipelined generation: With SetPipelineDepth(n) (or the
+          --pipeline-depth option), the flux & geometry stage of the event
+          generation (flux neutrino generation, pre-selection, path lengths,
+          interaction decision, target material and vertex selection) runs on
+          a thread of its own, which queues up to n interacting neutrinos
+          ahead of the physics stage (interaction selection & generation)
+          run by the thread calling GenerateEvent(). Flux reading and
+          geometry navigation then overlap with the physics (and, with
+          --output-queue-depth, with the output). The stage thread has a
+          random number generator of its own, so events differ from the ones
+          of a sequential job with the same seed. As with batching, the flux
+          driver is read ahead, and must not be used by the caller while
+          generating: its accessors no longer describe the neutrino that
+          interacted. NFluxNeutrinos() counts the flux neutrinos thrown up to
+          the last returned event. GenerateEvent() returns null only once
+          the flux driver reached its End().
+
+          Checkpointing: SaveState() writes the state computed at Configure()
+          (max path lengths and probability scales) together with a checksum
+          of the configuration (tune, event generator list, flux neutrinos,
+          target materials, max energy and total cross sections) and of the
+          input files, and the current flux entry & flux neutrino count.
+          A job calling LoadState() before Configure() skips the computation
+          of the path lengths and probability scales if both checksums match
+          and, if asked to resume, continues from the saved flux entry.
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -22,6 +104,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 
 #include <TH1D.h>
 #include <TLorentzVector.h>
@@ -29,11 +112,16 @@
 #include <TTree.h>
 #include <TBits.h>
 
+#include "Framework/EventGen/ChannelBias.h"
+#include "Framework/EventGen/FluxIntProbTable.h"
 #include "Framework/EventGen/PathLengthList.h"
+#include "Framework/Numerical/AliasSampler.h"
 #include "Framework/ParticleData/PDGCodeList.h"
+#include "Framework/Utils/Range1.h"
 
 using std::string;
 using std::map;
+using std::vector;
 
 namespace genie {
 
@@ -59,19 +147,38 @@ public :
   void KeepOnThrowingFluxNeutrinos (bool keep_on);
   void ForceSingleProbScale        (void);
   void PreSelectEvents             (bool preselect = true);
+  void ForceInteraction            (bool force = true);
+  void SetChannelBias              (string spec);
+  void SetPipelineDepth            (unsigned int depth);
+  void SetFluxBatchSize            (unsigned int n);
+  void SetXSecTableSize            (unsigned int nbins);
+  void SetFluxProbabilityShard     (unsigned int ishard, unsigned int nshards);
+  void AddFluxProbabilityThread    (GFluxI * flux, GeomAnalyzerI * geom);
   bool PreCalcFluxProbabilities    (void);
   bool LoadFluxProbabilities       (string filename);
   void SaveFluxProbabilities       (string outfilename);
+  bool LoadState                   (string filename, string inputs = "", bool resume = false);
   void Configure                   (bool calc_prob_scales = true);
 
   // generate single neutrino event for input flux & geometry
   EventRecord * GenerateEvent (void);
 
+  // multi-threaded mode: create a worker sharing this driver's configuration
+  GMCJDriver * SpawnWorker (GFluxI * flux, GeomAnalyzerI * geom, long int seed) const;
+  bool         IsWorker    (void) const { return (fMaster != 0); }
+
   // info needed for computing the generated sample normalization
-  double   GlobProbScale  (void) const { return fGlobPmax;                  }
+  double   GlobProbScale  (void) const { return (fForceInteraction) ? 1. : fGlobPmax; }
+  bool     ForcesInteractions (void) const { return fForceInteraction;      }
   long int NFluxNeutrinos (void) const { return (long int) fNFluxNeutrinos; }
   map<int, double> SumFluxIntProbs(void) const { return fSumFluxIntProbs;   }
 
+  // save the computed driver state (call after Configure(); inputs is a comma
+  // separated list of input files, eg. the flux and geometry files, whose
+  // checksums are saved with the state)
+  bool SaveState   (string filename, string inputs = "") const;
+  bool StateLoaded (void) const { return fStateLoaded; }
+
   // input flux and geometry drivers
   const GFluxI &        FluxDriver      (void) const { return *fFluxDriver;   }
   const GeomAnalyzerI & GeomAnalyzer    (void) const { return *fGeomAnalyzer; }
@@ -80,8 +187,12 @@ public :
 
 private:
 
+  struct RayItem;   // an interacting neutrino, queued by the flux & geometry stage
+  struct Pipeline;  // the flux & geometry stage thread and its queue
+
   // private methods:
   void          InitJob                         (void);
+  void          InitWorker                      (const GMCJDriver * master);
   void          InitEventGeneration             (void);
   void          GetParticleLists                (void);
   void          GetMaxPathLengthList            (void);
@@ -90,16 +201,39 @@ private:
   void          BootstrapXSecSplines            (void);
   void          BootstrapXSecSplineSummation    (void);
   void          ComputeProbScales               (void);
+  void          ComputeGlobProbScale            (void);
+  double        ProbScale                       (int nupdg, double E) const;
+  ULong64_t     StateConfigHash                 (void) const;
+  bool          ReadState                       (void);
+  void          ResumeFluxDriver                (void);
+  void          BuildXSecTable                  (void);
+  const double* XSecTableRow                    (int nupdg, double E, double & f) const;
+  void          ComputeEnergyWindows            (void);
+  void          HintFluxEnergyWindows           (void);
+  bool          InEnergyWindow                  (int nupdg, double E) const;
   EventRecord * GenerateEvent1Try               (void);
+  bool          SelectInteractingNeutrino       (void);
+  EventRecord * GenerateEventPipelined          (void);
+  void          StartPipeline                   (void);
+  void          StopPipeline                    (void);
   bool          GenerateFluxNeutrino            (void);
+  bool          UsingFluxBatch                  (void) const;
+  bool          FillFluxBatch                   (void);
+  void          PreSelectFluxBatch              (void);
+  bool          NextBatchedFluxNeutrino         (double & R);
   bool          ComputePathLengths              (void);
   double	ComputeInteractionProbabilities (bool use_max_path_length);
   int           SelectTargetMaterial            (double R);
   void          GenerateEventKinematics         (void);
   void          GenerateVertexPosition          (void);
+  void          ComputeVertexPosition           (void);
+  void          RunPipelineStage                (Pipeline * pipeline);
   void          ComputeEventProbability         (void);
   double        InteractionProbability          (double xsec, double pl, int A);
   double        PreGenFluxInteractionProbability(void);
+  bool          PreCalcFluxShard                (unsigned int islot, unsigned int nslots, FluxIntProbTable & table);
+  bool          ReadFluxProbabilities           (string filename, FluxIntProbTable & table);
+  bool          WriteFluxProbabilities          (string filename);
 
   // private data members:
   GEVGPool *      fGPool;              ///< A pool of GEVGDrivers properly configured event generation drivers / one per init state
@@ -110,12 +244,30 @@ private:
   PDGCodeList     fTgtList;            ///< [declared by the geom driver] list of target codes
   PathLengthList  fMaxPathLengths;     ///< [declared by the geom driver] maximum path length list
   PathLengthList  fCurPathLengths;     ///< [current] path length list for current flux neutrino
+  int             fCurNuPdg;           ///< [current] flux neutrino PDG code
+  TLorentzVector  fCurNuP4;            ///< [current] flux neutrino 4-momentum
+  TLorentzVector  fCurNuX4;            ///< [current] flux neutrino 4-position
   TLorentzVector  fCurVtx;             ///< [current] interaction vertex
   EventRecord *   fCurEvt;             ///< [current] generated event
   int             fSelTgtPdg;          ///< [current] selected target material PDG code
-  map<int,double> fCurCumulProbMap;    ///< [current] cummulative interaction probabilities
+  vector<int>     fCurTgtPdg;          ///< [current] materials with an interaction probability (as in the path length list)
+  vector<double>  fCurTgtProb;         ///< [current] normalized interaction probability for each of these materials
+  double          fCurProbScale;       ///< [current] probability scale the interaction probabilities were normalized to
+  vector<double>  fCurTgtBiasedProb;   ///< [current] biased interaction probability for each of these materials
+  double          fCurTgtBiasWeight;   ///< [current] weight compensating the biased target material selection
+  AliasSampler    fTgtSampler;         ///< [current] alias table used for selecting the target material
   double          fNFluxNeutrinos;     ///< [current] number of flux nuetrinos fired by the flux driver so far
   map<int,TH1D*>  fPmax;               ///< [computed at init] interaction probability scale /neutrino /energy for given geometry
+  vector<double>  fPmaxTable;          ///< [computed at init] fPmax bin contents, flattened as [neutrino (as in fNuList)][energy bin]
+  unsigned int    fPmaxBins;           ///< [computed at init] number of energy bins of fPmaxTable
+  double          fPmaxEmin;           ///< [computed at init] low edge of the fPmaxTable energy bins
+  double          fPmaxDE;             ///< [computed at init] width of the fPmaxTable energy bins
+  unsigned int    fXSecTableBins;      ///< [config] number of energy bins of the total xsec table (0: evaluate the splines)
+  double          fXSecTableDE;        ///< [computed at init] energy step of the total xsec table
+  vector<int>     fXSecTableNu;        ///< [computed at init] neutrino codes of the total xsec table
+  vector<int>     fXSecTableTgt;       ///< [computed at init] target codes of the total xsec table (sorted)
+  vector<double>  fXSecTable;          ///< [computed at init] total xsec, flattened as [neutrino][energy knot][target]
+  map<int,Range1D_t> fEnergyWindow;    ///< [computed at init] energy range /neutrino outside which no target has a non-zero total xsec
   double          fGlobPmax;           ///< [computed at init] global interaction probability scale for given flux & geometry
   string          fEventGenList;       ///< [config] list of event generators loaded by this driver (what used to be the $GEVGL setting)
   TBits *         fUnphysEventMask;    ///< [config] controls whether unphysical events are returned (what used to be the $GUNPHYSMASK setting)
@@ -126,9 +278,14 @@ private:
   bool            fKeepThrowingFluxNu; ///< [config] keep firing flux neutrinos till one of them interacts
   bool            fGenerateUnweighted; ///< [config] force single probability scale?
   bool            fPreSelect;          ///< [config] set whether to pre-select events using max interaction paths
-  TFile*          fFluxIntProbFile;    ///< [input] pre-generated flux interaction probability file
-  TTree*          fFluxIntTree;        ///< [computed-or-loaded] pre-computed flux interaction probabilities (expected tree name is "gFlxIntProbs")
-  double          fBrFluxIntProb;      ///< flux interaction probability (set to branch:"FluxIntProb")
+  bool            fForceInteraction;   ///< [config] force every flux neutrino crossing the geometry to interact, weighting it by its interaction probability?
+  ChannelBias     fBias;               ///< [config] target material biasing rules
+  FluxIntProbTable * fFluxIntTable;    ///< [computed-or-loaded] pre-computed flux interaction probabilities (shared with workers)
+  unsigned int    fFluxIntShard;       ///< [config] shard of the flux entries whose interaction probabilities are pre-computed
+  unsigned int    fFluxIntNShards;     ///< [config] number of shards the flux entries are split into
+  vector<GFluxI *>        fFluxIntThreadFlux; ///< [config] flux drivers of the additional pre-computation threads
+  vector<GeomAnalyzerI *> fFluxIntThreadGeom; ///< [config] geometry analyzers of the additional pre-computation threads
+  double          fBrFluxIntProb;      ///< flux interaction probability (set to branch:"FluxIntProb" of the "gFlxIntProb" tree)
   int             fBrFluxIndex;        ///< corresponding entry in flux input tree (set to address of branch:"FluxEntry")
   double          fBrFluxEnu;          ///< corresponding flux P4 (set to address of branch:"FluxP4")
   double          fBrFluxWeight;       ///< corresponding flux weight (set to address of branch: "FluxWeight")
@@ -136,6 +293,25 @@ private:
   string          fFluxIntFileName;    ///< whether to save pre-generated flux tree for use in later jobs
   string          fFluxIntTreeName;    ///< name for tree holding flux probabilities
   map<int, double> fSumFluxIntProbs;   ///< map where the key is flux pdg code and the value is sum of fBrFluxWeight * fBrFluxIntProb for all these flux neutrinos
+  const GMCJDriver * fMaster;          ///< [multi-threaded mode] driver that spawned this worker (null if not a worker)
+  long int        fWorkerSeed;         ///< [multi-threaded mode] seed of the random number generator of the worker thread
+  mutable bool    fHasWorkers;         ///< [multi-threaded mode] were workers spawned (sharing this driver's GEVGPool)?
+  unsigned int    fFluxBatchSize;      ///< [config] number of flux neutrinos read ahead & pre-selected together (1: no batching)
+  unsigned int    fPipelineDepth;      ///< [config] interacting neutrinos queued by the flux & geometry stage thread (0: no pipeline)
+  Pipeline *      fPipeline;           ///< [pipelined mode] flux & geometry stage thread and its queue
+  unsigned int    fBatchNext;          ///< [batched mode] next unprocessed entry of the current batch
+  vector<int>     fBatchPdg;           ///< [batched mode] flux neutrino PDG codes
+  vector<double>  fBatchE;             ///< [batched mode] flux neutrino energies
+  vector<double>  fBatchR;             ///< [batched mode] random number [0,1] thrown for each flux neutrino
+  vector<double>  fBatchPsum;          ///< [batched mode] interaction probability for max. path lengths
+  vector<TLorentzVector> fBatchP4;     ///< [batched mode] flux neutrino 4-momenta
+  vector<TLorentzVector> fBatchX4;     ///< [batched mode] flux neutrino 4-positions
+  string          fStateFile;          ///< [config] driver state file to load at Configure() (see LoadState())
+  string          fStateInputs;        ///< [config] input files whose checksums must match the ones of the loaded state
+  bool            fStateResume;        ///< [config] resume from the flux entry saved with the loaded state?
+  bool            fStateLoaded;        ///< [computed-or-loaded] were the path lengths & prob scales loaded from a state file?
+  long int        fStateFluxIndex;     ///< [loaded] flux entry being read when the loaded state was saved
+  double          fStateNFluxNu;       ///< [loaded] number of flux neutrinos thrown when the loaded state was saved
 };
 
 }      // genie namespace
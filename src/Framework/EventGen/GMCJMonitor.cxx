@@ -11,6 +11,7 @@
 #include <sstream>
 #include <fstream>
 #include <cstdlib>
+#include <cstdio>
 
 #include <TSystem.h>
 #include <TMath.h>
@@ -20,6 +21,11 @@
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/Cache.h"
+#include "Framework/Utils/ChannelCostStats.h"
+#include "Framework/Utils/KineGenStats.h"
+#include "Framework/Utils/ModuleTimingStats.h"
+#include "Framework/Utils/XSecSplineList.h"
 
 using std::ostringstream;
 using std::endl;
@@ -28,6 +34,38 @@ using std::ofstream;
 
 using namespace genie;
 
+namespace {
+  // the status filename without its .status extension: the base of the
+  // names of the other monitoring files
+  string BaseFilename(string filename)
+  {
+    string ext = ".status";
+    if(filename.size() > ext.size() &&
+       filename.compare(filename.size()-ext.size(), ext.size(), ext) == 0) {
+      filename.erase(filename.size()-ext.size());
+    }
+    return filename;
+  }
+
+  // write a file through a temporary one, so that a scraper never reads a
+  // partly written file
+  void WriteAtomically(const string & filename, const string & content)
+  {
+    string tmp = filename + ".tmp";
+    ofstream out(tmp.c_str(), ios::out);
+    if(!out.is_open()) return;
+    out << content;
+    out.close();
+    std::rename(tmp.c_str(), filename.c_str());
+  }
+
+  // rate of a counter between two samples (0 if no time elapsed)
+  double Rate(double n, double n0, double t, double t0)
+  {
+    return (t > t0) ? (n - n0) / (t - t0) : 0.;
+  }
+}
+
 //____________________________________________________________________________
 GMCJMonitor::GMCJMonitor(Long_t runnu) :
 fRunNu(runnu)
@@ -37,7 +75,32 @@ fRunNu(runnu)
 //____________________________________________________________________________
 GMCJMonitor::~GMCJMonitor()
 {
-
+  // end of job: report the kinematic selection statistics
+  KineGenStats * stats = KineGenStats::Instance();
+  if(!stats->IsEmpty()) {
+    LOG("GMCJMonitor", pNOTICE) << *stats;
+  }
+
+  // ... and the event generation module timing, also as a JSON summary
+  // next to the status file
+  ModuleTimingStats * timing = ModuleTimingStats::Instance();
+  if(!timing->IsEmpty()) {
+    LOG("GMCJMonitor", pNOTICE) << *timing;
+    timing->SaveAsJson(BaseFilename(fStatusFile) + ".modtime.json");
+  }
+
+  // ... and the event generation cost per interaction channel
+  ChannelCostStats * chancost = ChannelCostStats::Instance();
+  if(!chancost->IsEmpty()) {
+    LOG("GMCJMonitor", pNOTICE) << *chancost;
+  }
+
+  // ... and the largest memory consumers among the cache branches and the
+  // cross section splines
+  ostringstream usage;
+  Cache::Instance()->PrintUsage(usage);
+  XSecSplineList::Instance()->PrintUsage(usage);
+  LOG("GMCJMonitor", pNOTICE) << usage.str();
 }
 //____________________________________________________________________________
 void GMCJMonitor::SetRefreshRate(int rate)
@@ -67,6 +130,19 @@ void GMCJMonitor::Update(int iev, const EventRecord * event)
   if(!event) status << "NULL" << endl;
   else       status << *event << endl;
 
+  KineGenStats * stats = KineGenStats::Instance();
+  if(!stats->IsEmpty()) status << *stats << endl;
+
+  if(fTelemetry) {
+    JobTelemetrySample sample = JobTelemetry::Instance()->Sample();
+    status << this->Telemetry(sample, kTelemetryText);
+    WriteAtomically(BaseFilename(fStatusFile) + ".prom",
+                    this->Telemetry(sample, kTelemetryPrometheus));
+    WriteAtomically(BaseFilename(fStatusFile) + ".telemetry.json",
+                    this->Telemetry(sample, kTelemetryJson));
+    fPrevious = sample;
+  }
+
   out << status.str();
   out.close();
 
@@ -91,6 +167,75 @@ void GMCJMonitor::Init(void)
   } else fRefreshRate = 100;
 
   fRefreshRate = TMath::Max(1,fRefreshRate);
+
+  // telemetry files, unless disabled
+  fTelemetry = true;
+  if( gSystem->Getenv("GMCJMONTELEMETRY") ) {
+   fTelemetry = (atoi( gSystem->Getenv("GMCJMONTELEMETRY") ) != 0);
+  }
+  fStart    = JobTelemetry::Instance()->Sample();
+  fPrevious = fStart;
+}
+//____________________________________________________________________________
+string GMCJMonitor::Telemetry(
+         const JobTelemetrySample & s, TelemetryFormat_t format) const
+{
+// Formats the throughput & resource metrics, as text (for the status file),
+// as a Prometheus text exposition (for the node exporter textfile collector)
+// or as JSON. Rates are given over the last refresh interval and since the
+// start of the job.
+
+  const JobTelemetrySample & s0 = fStart;
+  const JobTelemetrySample & sp = fPrevious;
+
+  double nev = (double) s.nevents;
+  double nfl = (double) s.nflux;
+  double hit = (s.nsplinelookups > 0) ?
+      1. - (double) s.nsplinemisses / s.nsplinelookups : 0.;
+
+  // name, help, value
+  struct Metric { const char * name; const char * help; double value; };
+  Metric metrics[] = {
+   { "events_total",               "events written out",                       nev },
+   { "events_per_second",          "events/s over the last interval",          Rate(nev, sp.nevents, s.time, sp.time) },
+   { "events_per_second_avg",      "events/s since the start of the job",      Rate(nev, s0.nevents, s.time, s0.time) },
+   { "flux_neutrinos_total",       "flux neutrinos thrown",                    nfl },
+   { "flux_neutrinos_per_second",  "flux neutrinos/s over the last interval",  Rate(nfl, sp.nflux, s.time, sp.time) },
+   { "flux_neutrinos_per_event",   "flux neutrinos thrown per event",          (nev > 0) ? nfl/nev : 0. },
+   { "geometry_seconds_total",     "time in the geometry driver (s)",          s.geomtime },
+   { "geometry_time_fraction",     "geometry time share over the last interval", Rate(s.geomtime, sp.geomtime, s.time, sp.time) },
+   { "geometry_steps_total",       "geometry navigation steps",                (double) s.ngeomsteps },
+   { "resident_memory_bytes",      "resident memory (bytes)",                  s.rss * 1024. * 1024. },
+   { "spline_lookups_total",       "hashed spline look-ups",                   (double) s.nsplinelookups },
+   { "spline_index_hit_ratio",     "spline look-ups found in the hashed index", hit },
+   { "spline_loads_total",         "splines loaded from mapped files",         (double) s.nsplineloads },
+   { "output_queue_events",        "events queued for writing",                (double) s.nqueued },
+   { "output_queue_depth",         "output queue depth (0: synchronous)",      (double) s.queuedepth }
+  };
+  const int nmetrics = sizeof(metrics) / sizeof(Metric);
+
+  ostringstream out;
+  out.precision(10);
+  if(format == kTelemetryPrometheus) {
+    for(int i = 0; i < nmetrics; i++) {
+      out << "# HELP genie_" << metrics[i].name << " " << metrics[i].help << "\n"
+          << "genie_" << metrics[i].name << "{run=\"" << fRunNu << "\"} "
+          << metrics[i].value << "\n";
+    }
+  } else if(format == kTelemetryJson) {
+    out << "{\n  \"run\": " << fRunNu;
+    for(int i = 0; i < nmetrics; i++) {
+      out << ",\n  \"" << metrics[i].name << "\": " << metrics[i].value;
+    }
+    out << "\n}\n";
+  } else {
+    out << "Telemetry:" << endl;
+    out.precision(4);
+    for(int i = 0; i < nmetrics; i++) {
+      out << "  " << metrics[i].help << ": " << metrics[i].value << endl;
+    }
+  }
+  return out.str();
 }
 //____________________________________________________________________________
 
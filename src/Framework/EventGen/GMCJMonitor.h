@@ -6,6 +6,18 @@
 \brief   Simple class to create & update MC job status files and env. vars.
          This is used to be able to keep track of an MC job status even when
          all output is suppressed or redirected to /dev/null.
+         The status file and the end-of-job printout also report the
+         kinematic selection statistics (KineGenStats). At the end of the
+         job, the event generation module timing (ModuleTimingStats) is also
+         reported and saved as genie-mcjob-<run>.modtime.json.
+
+         At every refresh, the job throughput & resource metrics (events/s,
+         flux neutrinos/s and per event, geometry time share, resident
+         memory, spline look-up hit ratio, output queue occupancy; see
+         JobTelemetry) are also added to the status file and written, for
+         the batch monitoring to scrape, as a Prometheus text exposition
+         (genie-mcjob-<run>.prom) and as JSON (genie-mcjob-<run>.telemetry.json).
+         Set $GMCJMONTELEMETRY to 0 to switch the telemetry files off.
 
 \author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
  University of Liverpool & STFC Rutherford Appleton Laboratory
@@ -20,8 +32,14 @@
 #ifndef _G_MC_JOB_MONITOR_H_
 #define _G_MC_JOB_MONITOR_H_
 
+#include <string>
+
 #include <TStopwatch.h>
 
+#include "Framework/Utils/JobTelemetry.h"
+
+using std::string;
+
 namespace genie {
 
 class EventRecord;
@@ -35,16 +53,25 @@ public :
   void SetRefreshRate (int rate);
   void Update (int iev, const EventRecord * event);
   void CustomizeFilename(string filename);
+  string Filename (void) const { return fStatusFile; }
 
 private:
 
-  void Init (void);
+  typedef enum ETelemetryFormat {
+    kTelemetryText, kTelemetryPrometheus, kTelemetryJson
+  } TelemetryFormat_t;
+
+  void   Init      (void);
+  string Telemetry (const JobTelemetrySample & sample, TelemetryFormat_t format) const;
 
   Long_t     fRunNu;       ///< run number
   string     fStatusFile;  ///< name of output status file
   TStopwatch fWatch;
   double     fCpuTime;     ///< total cpu time so far
   int        fRefreshRate; ///< update output every so many events
+  bool       fTelemetry;   ///< write the telemetry files?
+  JobTelemetrySample fStart;    ///< telemetry sample at the start of the job
+  JobTelemetrySample fPrevious; ///< telemetry sample at the previous refresh
 };
 
 }      // genie namespace
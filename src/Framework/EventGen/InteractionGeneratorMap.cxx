@@ -72,6 +72,7 @@ void InteractionGeneratorMap::CleanUp(void)
   delete fInteractionList;
 
   this->clear();
+  fKeyIndex.clear();
 }
 //___________________________________________________________________________
 void InteractionGeneratorMap::Copy(const InteractionGeneratorMap & xsmap)
@@ -91,6 +92,7 @@ void InteractionGeneratorMap::Copy(const InteractionGeneratorMap & xsmap)
 
     this->insert(map<string, const EventGeneratorI *>::value_type(code,evg));
   }
+  fKeyIndex = xsmap.fKeyIndex;
 }
 //___________________________________________________________________________
 void InteractionGeneratorMap::UseGeneratorList(const EventGeneratorList * l)
@@ -148,6 +150,9 @@ void InteractionGeneratorMap::BuildMap(const InitialState & init_state)
               << "\nLinking: " << code << " --> to: " << evgen->Id().Key();
         this->insert(
              map<string, const EventGeneratorI *>::value_type(code,evgen));
+        fKeyIndex.insert(
+             map<InteractionKey, const EventGeneratorI *>::value_type(
+                                                 interaction->Key(),evgen));
      } // loop over interactions
      delete ilst;
      ilst = 0;
@@ -161,11 +166,12 @@ const EventGeneratorI * InteractionGeneratorMap::FindGenerator(
     LOG("IntGenMap", pWARN) << "Null interaction!!";
     return 0;
   }
-  string code = interaction->AsString();
-  InteractionGeneratorMap::const_iterator evgiter = this->find(code);
-  if(evgiter == this->end()) {
+  map<InteractionKey, const EventGeneratorI *>::const_iterator evgiter =
+                                         fKeyIndex.find(interaction->Key());
+  if(evgiter == fKeyIndex.end()) {
     LOG("IntGenMap", pWARN)
-             << "No EventGeneratorI was found for interaction: \n" << code;
+             << "No EventGeneratorI was found for interaction: \n"
+             << interaction->AsString();
     return 0;
   }
   const EventGeneratorI * evg = evgiter->second;
@@ -70,6 +70,8 @@ private:
 
   InitialState *    fInitState;
   InteractionList * fInteractionList;
+
+  map<InteractionKey, const EventGeneratorI *> fKeyIndex; ///< look-up index of FindGenerator()
 };
 
 }      // genie namespace
@@ -7,6 +7,7 @@
 #pragma link C++ namespace genie;
 
 #pragma link C++ class genie::EventRecord;
+#pragma link C++ class genie::EventRecordPool;
 #pragma link C++ class genie::EventRecordVisitorI;
 #pragma link C++ class genie::GVldContext;
 #pragma link C++ class genie::EventGenerator;
@@ -30,6 +31,7 @@
 #pragma link C++ class genie::GFluxI;
 #pragma link C++ class genie::GeomAnalyzerI;
 #pragma link C++ class genie::GMCJMonitor;
+#pragma link C++ class genie::FluxIntProbTable;
 
 #pragma link C++ class genie::XSecAlgorithmI;
 
@@ -20,12 +20,18 @@
 #include "Framework/Conventions/Units.h"
 #include "Framework/EventGen/PhysInteractionSelector.h"
 #include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordPool.h"
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/EventGen/InteractionList.h"
 #include "Framework/EventGen/InteractionGeneratorMap.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/AliasSampler.h"
+#include "Framework/Numerical/EnergyMemo.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/Spline.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Interaction/ScratchInteraction.h"
+#include "Framework/Utils/RunOpt.h"
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Utils/PrintUtils.h"
 
@@ -70,27 +76,21 @@ EventRecord * PhysInteractionSelector::SelectInteraction
      return 0;
   }
 
-  // Get the list of spline objects
-  // Should have been constructed at the job initialization
-  XSecSplineList * xssl = 0;
-  if (fUseSplines) xssl = XSecSplineList::Instance();
-
-  const InteractionList & ilst = igmap->GetInteractionList();
-  vector<double> xseclist(ilst.size());
+  // Get the cross section evaluation table for the input interaction list
+  // (built at the first selection, then re-used for all events)
+  ChannelTable & table = this->Table(igmap);
+  const InteractionList & ilst = *table.fInteractionList;
+  unsigned int n = table.fSpline.size();
 
-  string istate = ilst[0]->InitState().AsString();
   ostringstream msg;
   msg << "Selecting an interaction for the given initial state = "
-      << istate << " at E = " << p4.E() << " GeV";
+      << table.fInitState << " at E = " << p4.E() << " GeV";
 
   LOG("IntSel", pNOTICE)
              << utils::print::PrintFramedMesg(msg.str(), 0, '=');
   LOG("IntSel", pNOTICE)
      << "Computing xsecs for all relevant modeled interactions:";
 
-  unsigned int i=0;
-  InteractionList::const_iterator intliter = ilst.begin();
-
   ostringstream xsec_table_printout;
 
   xsec_table_printout
@@ -99,59 +99,65 @@ EventRecord * PhysInteractionSelector::SelectInteraction
       << " | cross-section (1E-38*cm^2) |" << endl
       << " |"  << setfill('-') << setw(112) << "|" << endl;
 
-  for( ; intliter != ilst.end(); ++intliter) {
+  vector<double> & xseclist = table.fXSec;
 
-     Interaction * interaction = new Interaction(**intliter);
-     interaction->InitStatePtr()->SetProbeP4(p4);
+  // the cross sections only depend on the probe 4-momentum
+  bool memo = table.fXSecValid &&
+     table.fXSecP4[0] == p4.Px() && table.fXSecP4[1] == p4.Py() &&
+     table.fXSecP4[2] == p4.Pz() && table.fXSecP4[3] == p4.E();
 
-     SLOG("IntSel", pDEBUG)
-           << "Computing xsec for: \n  " << interaction->AsString();
+  for(unsigned int i = 0; i < n && !memo; i++) {
 
-     // get the cross section for this interaction
-     const XSecAlgorithmI * xsec_alg =
-               igmap->FindGenerator(interaction)->CrossSectionAlg();
-     assert(xsec_alg);
+     SLOG("IntSel", pDEBUG)
+           << "Computing xsec for: \n  " << table.fName[i];
 
      double xsec = 0; // cross section for this interaction
 
-     bool spline_computed = xssl->SplineExists(xsec_alg, interaction);
-     bool eval = fUseSplines && spline_computed;
-     if (eval) {
-           const InitialState & init = interaction->InitState();
-           const ProcessInfo & proc  = interaction->ProcInfo();
-           // choose ref frame ('Lab' or 'Hit nucleon rest frame')
-           RefFrame_t frame =
-              (proc.IsCoherentProduction() || proc.IsElectronScattering()) ?
-              kRfLab : kRfHitNucRest;
-           double E = init.ProbeE(frame);
+     const Spline * spl = table.fSpline[i];
+     if (spl) {
+           // probe energy in the 'Lab' or 'Hit nucleon rest frame'
+           double E = p4.E();
+           if(table.fBoost[i]) {
+             TLorentzVector p4f(p4);
+             p4f.Boost(-table.fBx[i], -table.fBy[i], -table.fBz[i]);
+             E = p4f.Energy();
+           }
            if(TMath::IsNaN(E)) {
-    		 BLOG("IntSel", pFATAL) << *interaction;
+    		 BLOG("IntSel", pFATAL) << *ilst[i];
     		 BLOG("IntSel", pFATAL) << "E = " << E;
 		 abort();
 	   }
-           const Spline * spl = xssl->GetSpline(xsec_alg,interaction);
            if(spl->ClosestKnotValueIsZero(E,"-")) xsec = 0;
-           else xsec = spl->Evaluate(E);
+           else xsec = EnergyMemo::Evaluate(spl, E);
      } else {
-           xsec = xsec_alg->Integral(interaction);
+           ScratchInteraction interaction(ilst[i]);
+           interaction->InitStatePtr()->SetProbeP4(p4);
+           xsec = table.fXSecAlg[i]->Integral(interaction.Get());
      }
      TMath::Max(0., xsec);
 /*
      LOG("IntSel", pNOTICE)
-       << interaction->AsString()
-       << " --> xsec " << (eval ? "[**interp**]" : "[**calc**]")
+       << table.fName[i]
+       << " --> xsec " << (spl ? "[**interp**]" : "[**calc**]")
        << " = " << xsec/genie::units::cm2 << " cm^2";
 */
-     xsec_table_printout
-           << " | " << setfill(' ') << setw(80) << interaction->AsString()
-           << " | " << setfill(' ') << setw(26) << xsec/(1E-38*genie::units::cm2)
-           << " | " << endl;
-
-     xseclist[i++] = xsec;
-     delete interaction;
+     xseclist[i] = xsec;
 
   } // loop over interaction that can be generated
 
+  table.fXSecP4[0] = p4.Px();
+  table.fXSecP4[1] = p4.Py();
+  table.fXSecP4[2] = p4.Pz();
+  table.fXSecP4[3] = p4.E();
+  table.fXSecValid = true;
+
+  for(unsigned int i = 0; i < n; i++) {
+     xsec_table_printout
+           << " | " << setfill(' ') << setw(80) << table.fName[i]
+           << " | " << setfill(' ') << setw(26) << xseclist[i]/(1E-38*genie::units::cm2)
+           << " | " << endl;
+  }
+
   xsec_table_printout
       << " |"  << setfill('-') << setw(112) << "|" << endl;
 
@@ -164,48 +170,146 @@ EventRecord * PhysInteractionSelector::SelectInteraction
             << "Selecting an entry from the Interaction List";
   double xsec_sum  = 0;
   for(unsigned int iint = 0; iint < xseclist.size(); iint++) {
-     xsec_sum       += xseclist[iint];
-     xseclist[iint]  = xsec_sum;
+     xsec_sum += xseclist[iint];
 
      SLOG("IntSel", pINFO)
              << "Sum{xsec}(0->" << iint << ") = " << xsec_sum;
   }
-  RandomGen * rnd = RandomGen::Instance();
-  double R = xsec_sum * rnd->RndISel().Rndm();
 
-  LOG("IntSel", pINFO)
-      << "Generating Rndm (0. -> max = " << xsec_sum << ") = " << R;
+  // if biasing, the entry is selected from the biased cross sections and
+  // the event is weighted back to the unbiased selection probabilities
+  bool biased = fBias.HasChannelBias();
+  double bxsec_sum = 0;
+  if(biased) {
+     for(unsigned int iint = 0; iint < xseclist.size(); iint++) {
+        table.fBiasedXSec[iint] = table.fBias[iint] * xseclist[iint];
+        bxsec_sum += table.fBiasedXSec[iint];
+     }
+  }
+  const vector<double> & selection = (biased) ? table.fBiasedXSec : xseclist;
 
-  for(unsigned int iint = 0; iint < xseclist.size(); iint++) {
+  // build the alias table - the entry is then selected in constant time,
+  // independently of the number of modelled interactions
+  if(fSampler.Build(selection)) {
+     RandomGen * rnd = RandomGen::Instance();
+     double R = rnd->RndISel().Rndm();
+     unsigned int iint = fSampler.Sample(R);
 
-     SLOG("IntSel", pDEBUG)
-               << "Sum{xsec}(0->" << iint <<") = " << xseclist[iint];
+     LOG("IntSel", pINFO)
+         << "Generating Rndm (0. -> 1.) = " << R << " -> entry " << iint;
 
-     if( R < xseclist[iint] ) {
-       Interaction * selected_interaction = new Interaction (*ilst[iint]);
-       selected_interaction->InitStatePtr()->SetProbeP4(p4);
+     // bootstrap the event record
+     EventRecord * evrec = EventRecordPool::Instance()->Acquire();
+     Interaction * selected_interaction =
+                                  evrec->AttachSummaryCopy(*ilst[iint]);
+     selected_interaction->InitStatePtr()->SetProbeP4(p4);
 
-       // set the cross section for the selected interaction (just extract it
-       // from the array of summed xsecs rather than recomputing it)
-       double xsec_pedestal = (iint > 0) ? xseclist[iint-1] : 0.;
-       double xsec = xseclist[iint] - xsec_pedestal;
-       assert(xsec>0);
+     // set the cross section for the selected interaction (just extract it
+     // from the array of xsecs rather than recomputing it)
+     double xsec = xseclist[iint];
+     assert(xsec>0);
 
-       LOG("IntSel", pNOTICE)
-         << "Selected interaction: " << selected_interaction->AsString();
+     LOG("IntSel", pNOTICE)
+       << "Selected interaction: " << selected_interaction->AsString();
 
-       // bootstrap the event record
-       EventRecord * evrec = new EventRecord;
-       evrec->AttachSummary(selected_interaction);
-       evrec->SetXSec(xsec);
+     evrec->SetXSec(xsec);
 
-       return evrec;
+     if(biased) {
+        double wght =
+           ChannelBias::Weight(xsec_sum, bxsec_sum, table.fBias[iint]);
+        LOG("IntSel", pNOTICE)
+          << "Channel bias factor = " << table.fBias[iint]
+          << " -> event weight x " << wght;
+        evrec->SetWeight(wght * evrec->Weight());
      }
+
+     return evrec;
   }
   LOG("IntSel", pERROR) << "Could not select interaction";
   return 0;
 }
 //___________________________________________________________________________
+PhysInteractionSelector::ChannelTable &
+   PhysInteractionSelector::Table(const InteractionGeneratorMap * igmap) const
+{
+// Resolves, once per interaction list, the cross section algorithm and the
+// spline (if one is to be used) of each interaction, so that no spline keys
+// need to be built and looked-up for each event.
+// The table is re-built if the interaction list, the current tune or the
+// number of loaded splines change.
+
+  const InteractionList & ilst = igmap->GetInteractionList();
+
+  XSecSplineList * xssl = 0;
+  if (fUseSplines) xssl = XSecSplineList::Instance();
+  string tune     = (xssl) ? xssl->CurrentTune() : "";
+  int    nsplines = (xssl) ? xssl->NSplines()    : 0;
+
+  ChannelTable & table = fTables[igmap];
+  bool valid =
+        table.fInteractionList == &ilst       &&
+        table.fSpline.size()   == ilst.size() &&
+        table.fTune            == tune        &&
+        table.fNSplines        == nsplines;
+  if(valid) return table;
+
+  LOG("IntSel", pNOTICE)
+     << "Building the cross section table for "
+     << ilst.size() << " interactions";
+
+  unsigned int n = ilst.size();
+  table.fInteractionList = &ilst;
+  table.fTune            = tune;
+  table.fNSplines        = nsplines;
+  table.fInitState       = (n>0) ? ilst[0]->InitState().AsString() : "";
+  table.fXSecAlg.assign (n, 0);
+  table.fSpline .assign (n, 0);
+  table.fBoost  .assign (n, false);
+  table.fBx     .assign (n, 0.);
+  table.fBy     .assign (n, 0.);
+  table.fBz     .assign (n, 0.);
+  table.fName   .assign (n, "");
+  table.fBias   .assign (n, 1.);
+  table.fXSec   .assign (n, 0.);
+  table.fXSecValid = false;
+  table.fBiasedXSec.assign (n, 0.);
+
+  for(unsigned int i = 0; i < n; i++) {
+     const Interaction * interaction = ilst[i];
+     table.fName[i] = interaction->AsString();
+     table.fBias[i] = fBias.Factor(*interaction);
+     if(table.fBias[i] != 1.) {
+        LOG("IntSel", pNOTICE)
+           << "Biasing the selection of " << table.fName[i]
+           << " by a factor " << table.fBias[i];
+     }
+
+     const XSecAlgorithmI * xsec_alg =
+               igmap->FindGenerator(interaction)->CrossSectionAlg();
+     assert(xsec_alg);
+     table.fXSecAlg[i] = xsec_alg;
+
+     if(xssl && xssl->SplineExists(xsec_alg, interaction)) {
+        table.fSpline[i] = xssl->GetSpline(xsec_alg, interaction);
+     }
+
+     // splines are evaluated at the probe energy in the 'Lab' or in the
+     // 'Hit nucleon rest frame' (as for InitialState::ProbeE())
+     const ProcessInfo & proc = interaction->ProcInfo();
+     bool lab = proc.IsCoherentProduction() || proc.IsElectronScattering();
+     if(!lab) {
+        const TLorentzVector * pnuc4 =
+                   interaction->InitState().Tgt().HitNucP4Ptr();
+        assert(pnuc4);
+        table.fBoost[i] = true;
+        table.fBx[i] = pnuc4->Px() / pnuc4->Energy();
+        table.fBy[i] = pnuc4->Py() / pnuc4->Energy();
+        table.fBz[i] = pnuc4->Pz() / pnuc4->Energy();
+     }
+  }
+  return table;
+}
+//___________________________________________________________________________
 void PhysInteractionSelector::Configure(const Registry & config)
 {
   Algorithm::Configure(config);
@@ -225,5 +329,15 @@ void PhysInteractionSelector::LoadConfigData(void)
   fUseSplines = false ;
   GetParam( "UseStoredXSecs", fUseSplines ) ;
 
+  // channel biasing rules set at the command line
+  if(!fBias.Set(RunOpt::Instance()->ChannelBiasing())) {
+    LOG("IntSel", pFATAL)
+      << "Invalid channel biasing rules: "
+      << RunOpt::Instance()->ChannelBiasing();
+    gAbortingInErr = true;
+    exit(1);
+  }
+  fTables.clear();
+
 }
 //___________________________________________________________________________
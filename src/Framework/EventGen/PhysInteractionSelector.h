@@ -7,6 +7,18 @@
 
          Is a concrete implementation of the InteractionSelectorI interface.
 
+         The selection of chosen channels can be biased by the rules set
+         with the --channel-bias option (see ChannelBias): The interaction
+         is then sampled from the biased cross sections and the event weight
+         is multiplied by the ratio of the unbiased to the biased selection
+         probabilities. The event cross section remains the unbiased one.
+
+         The cross sections of the interaction list are re-used as long as
+         the probe 4-momentum is the same (eg. for mono-energetic beams, or
+         for events re-tried at the same energy), and the splines are
+         evaluated through the per-event EnergyMemo, so that a spline shared
+         by several channels is evaluated once.
+
 \author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
  University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -20,10 +32,25 @@
 #ifndef _PHYS_INTERACTION_SELECTOR_H_
 #define _PHYS_INTERACTION_SELECTOR_H_
 
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Framework/EventGen/ChannelBias.h"
 #include "Framework/EventGen/InteractionSelectorI.h"
+#include "Framework/Numerical/AliasSampler.h"
+
+using std::map;
+using std::string;
+using std::vector;
 
 namespace genie {
 
+class Spline;
+class XSecAlgorithmI;
+class InteractionList;
+class InteractionGeneratorMap;
+
 class PhysInteractionSelector : public InteractionSelectorI {
 
 public :
@@ -41,9 +68,38 @@ public :
   void Configure (string param_set);
 
 private:
-  void LoadConfigData (void);
 
-  bool fUseSplines;
+  //! Cross section evaluation table for the interactions of an
+  //! InteractionGeneratorMap (all vectors follow the interaction list order)
+  struct ChannelTable {
+    ChannelTable() : fInteractionList(0), fNSplines(0), fXSecValid(false) { }
+    const InteractionList *        fInteractionList; ///< interaction list the table was built for
+    string                         fTune;            ///< tune of the resolved splines
+    int                            fNSplines;        ///< number of loaded splines when the table was built
+    string                         fInitState;       ///< initial state code
+    vector<const XSecAlgorithmI *> fXSecAlg;         ///< cross section algorithm of each interaction
+    vector<const Spline *>         fSpline;          ///< cross section spline (0: compute the xsec)
+    vector<bool>                   fBoost;           ///< evaluate at the hit nucleon rest frame energy?
+    vector<double>                 fBx;              ///< hit nucleon velocity (x)
+    vector<double>                 fBy;              ///< hit nucleon velocity (y)
+    vector<double>                 fBz;              ///< hit nucleon velocity (z)
+    vector<string>                 fName;            ///< interaction code (for printouts)
+    vector<double>                 fBias;            ///< channel bias factor of each interaction
+    vector<double>                 fXSec;            ///< cross sections at the last probe 4-momentum
+    double                         fXSecP4[4];       ///< last probe 4-momentum (px,py,pz,E)
+    bool                           fXSecValid;       ///< fXSec computed for fXSecP4?
+    vector<double>                 fBiasedXSec;      ///< work space: biased cross sections at the current energy
+  };
+
+  void           LoadConfigData (void);
+  ChannelTable & Table          (const InteractionGeneratorMap * igmap) const;
+
+  bool        fUseSplines;
+  ChannelBias fBias;     ///< channel biasing rules
+
+  mutable map<const InteractionGeneratorMap *, ChannelTable> fTables; ///< per interaction generator map
+
+  mutable AliasSampler fSampler; ///< alias table, re-built for each selection
 };
 
 }      // genie namespace
@@ -8,12 +8,21 @@
 */
 //____________________________________________________________________________
 
+#include <mutex>
+
 #include "Framework/EventGen//RunningThreadInfo.h"
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/Messenger/Messenger.h"
 
 using namespace genie;
 
+namespace {
+  std::mutex gRunningThreadInfoMutex; // guards the singleton creation
+
+  // event generation thread in charge, for each OS thread
+  thread_local const EventGeneratorI * gRunningThread = 0;
+}
+
 //____________________________________________________________________________
 RunningThreadInfo * RunningThreadInfo::fInstance = 0;
 //____________________________________________________________________________
@@ -29,6 +38,7 @@ RunningThreadInfo::~RunningThreadInfo()
 //____________________________________________________________________________
 RunningThreadInfo * RunningThreadInfo::Instance()
 {
+  std::lock_guard<std::mutex> lock(gRunningThreadInfoMutex);
   if(fInstance == 0) {
     static RunningThreadInfo::Cleaner cleaner;
     cleaner.DummyMethodAndSilentCompiler();
@@ -37,3 +47,13 @@ RunningThreadInfo * RunningThreadInfo::Instance()
   return fInstance;
 }
 //____________________________________________________________________________
+const EventGeneratorI * RunningThreadInfo::RunningThread(void)
+{
+  return gRunningThread;
+}
+//____________________________________________________________________________
+void RunningThreadInfo::UpdateRunningThread(const EventGeneratorI * evg)
+{
+  gRunningThread = evg;
+}
+//____________________________________________________________________________
@@ -8,6 +8,8 @@
 	  can see the "bigger picture" and access the cross section model for
 	  the thread, look-up info for modules that run before or are scheduled
           to run after etc.
+          The running event generation thread is kept per OS thread, so that
+          several threads can generate events concurrently.
 
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
@@ -31,14 +33,8 @@ class RunningThreadInfo
 public:
   static RunningThreadInfo * Instance(void);
 
-  const EventGeneratorI * RunningThread(void)
-  {
-    return fRunningThread;
-  }
-  void UpdateRunningThread(const EventGeneratorI * evg)
-  {
-     fRunningThread = evg;
-  }
+  const EventGeneratorI * RunningThread       (void);
+  void                    UpdateRunningThread (const EventGeneratorI * evg);
 
 private:
   RunningThreadInfo();
@@ -48,9 +44,6 @@ private:
   //! self
   static RunningThreadInfo * fInstance;
 
-  //! current thread
-  const EventGeneratorI * fRunningThread;
-
   //! clean
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
@@ -35,6 +35,21 @@ Algorithm(name, config)
 XSecAlgorithmI::~XSecAlgorithmI()
 {
 
+}
+//___________________________________________________________________________
+void XSecAlgorithmI::XSecBatch(
+    const Interaction * interaction, KinePhaseSpace_t kps,
+    unsigned int n, unsigned int nvars, const KineVar_t * vars,
+    const double * const * kine, double * xsec) const
+{
+  Kinematics * kinematics = interaction->KinePtr();
+
+  for(unsigned int ip = 0; ip < n; ip++) {
+    for(unsigned int iv = 0; iv < nvars; iv++) {
+      kinematics->SetKV(vars[iv], kine[iv][ip]);
+    }
+    xsec[ip] = this->XSec(interaction, kps);
+  }
 }
 //___________________________________________________________________________
 bool XSecAlgorithmI::ValidKinematics(const Interaction* interaction) const
@@ -20,6 +20,7 @@
 
 #include "Framework/Algorithm/Algorithm.h"
 #include "Framework/Conventions/KinePhaseSpace.h"
+#include "Framework/Conventions/KineVar.h"
 #include "Framework/Interaction/Interaction.h"
 
 namespace genie {
@@ -32,6 +33,15 @@ public:
   //! Compute the cross section for the input interaction
   virtual double XSec (const Interaction* i, KinePhaseSpace_t k=kPSfE) const = 0;
 
+  //! Compute the cross section at a block of n kinematic points, given as a
+  //! structure of arrays: kine[iv][ip] is the value of kinematic variable
+  //! vars[iv] at point ip. The default implementation sets each point in the
+  //! input interaction and calls XSec(); models can override it to evaluate
+  //! the whole block at once.
+  virtual void XSecBatch (const Interaction* i, KinePhaseSpace_t k,
+                          unsigned int n, unsigned int nvars, const KineVar_t * vars,
+                          const double * const * kine, double * xsec) const;
+
   //! Integrate the model over the kinematic phase space available to the
   //! input interaction (kinematical cuts can be included)
   virtual double Integral (const Interaction* i) const = 0;
@@ -66,6 +66,7 @@ void XSecAlgorithmMap::CleanUp(void)
   delete fInteractionList;
 
   this->clear();
+  fKeyIndex.clear();
 }
 //___________________________________________________________________________
 void XSecAlgorithmMap::Copy(const XSecAlgorithmMap & xsmap)
@@ -85,6 +86,7 @@ void XSecAlgorithmMap::Copy(const XSecAlgorithmMap & xsmap)
 
     this->insert(map<string, const XSecAlgorithmI *>::value_type(code,alg));
   }
+  fKeyIndex = xsmap.fKeyIndex;
 }
 //___________________________________________________________________________
 void XSecAlgorithmMap::UseGeneratorList(const EventGeneratorList * list)
@@ -148,6 +150,9 @@ void XSecAlgorithmMap::BuildMap(const InitialState & init_state)
               << "\n     --> with xsec algorithm: " << xsec_alg->Id().Key();
          this->insert(
             map<string, const XSecAlgorithmI *>::value_type(code,xsec_alg));
+         fKeyIndex.insert(
+            map<InteractionKey, const XSecAlgorithmI *>::value_type(
+                                              interaction->Key(),xsec_alg));
 
      } // loop over interactions
      delete ilst;
@@ -163,12 +168,12 @@ const XSecAlgorithmI * XSecAlgorithmMap::FindXSecAlgorithm(
     return 0;
   }
 
-  string code = interaction->AsString();
-
-  XSecAlgorithmMap::const_iterator xsec_alg_iter = this->find(code);
-  if(xsec_alg_iter == this->end()) {
+  map<InteractionKey, const XSecAlgorithmI *>::const_iterator xsec_alg_iter =
+                                         fKeyIndex.find(interaction->Key());
+  if(xsec_alg_iter == fKeyIndex.end()) {
     LOG("XSecAlgMap", pWARN)
-         << "No XSecAlgorithmI was found for interaction: \n" << code;
+         << "No XSecAlgorithmI was found for interaction: \n"
+         << interaction->AsString();
     return 0;
   }
 
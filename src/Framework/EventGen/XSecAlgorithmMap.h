@@ -24,6 +24,8 @@
 #include <string>
 #include <ostream>
 
+#include "Framework/Interaction/InteractionKey.h"
+
 using std::map;
 using std::string;
 using std::ostream;
@@ -69,6 +71,8 @@ private:
 
   InitialState *    fInitState;
   InteractionList * fInteractionList;
+
+  map<InteractionKey, const XSecAlgorithmI *> fKeyIndex; ///< look-up index of FindXSecAlgorithm()
 };
 
 }      // genie namespace
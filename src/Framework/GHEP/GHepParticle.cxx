@@ -62,18 +62,18 @@ fStatus(status),
 fFirstMother(mother1),
 fLastMother(mother2),
 fFirstDaughter(daughter1),
-fLastDaughter(daughter2)
+fLastDaughter(daughter2),
+fP4(p),
+fX4(v)
 {
   this->SetPdgCode(pdg);
 
-  fP4 = new TLorentzVector(p);
-  fX4 = new TLorentzVector(v);
-
   fRescatterCode  = -1;
   fPolzTheta      = -999;
   fPolzPhi        = -999;
   fIsBound        = false;
   fRemovalEnergy  = 0.;
+  fListMask       = 0;
 }
 //___________________________________________________________________________
 // TParticle-like constructor
@@ -86,18 +86,18 @@ fStatus(status),
 fFirstMother(mother1),
 fLastMother(mother2),
 fFirstDaughter(daughter1),
-fLastDaughter(daughter2)
+fLastDaughter(daughter2),
+fP4(px,py,pz,En),
+fX4(x,y,z,t)
 {
   this->SetPdgCode(pdg);
 
-  fP4 = new TLorentzVector(px,py,pz,En);
-  fX4 = new TLorentzVector(x,y,z,t);
-
   fRescatterCode  = -1;
   fPolzTheta      = -999;
   fPolzPhi        = -999;
   fIsBound        = false;
   fRemovalEnergy  = 0.;
+  fListMask       = 0;
 }
 //___________________________________________________________________________
 // Copy constructor
@@ -117,54 +117,45 @@ fFirstMother(-1),
 fLastMother(-1),
 fFirstDaughter(-1),
 fLastDaughter(-1),
-fP4(0),
-fX4(0),
+fP4(0,0,0,0),
+fX4(0,0,0,0),
 fPolzTheta(-999.),
 fPolzPhi(-999.),
 fRemovalEnergy(0),
-fIsBound(false)
+fIsBound(false),
+fListMask(0),
+fPdgIndex(-1)
 {
 
 }
 //___________________________________________________________________________
 GHepParticle::~GHepParticle()
 {
-  this->CleanUp();
+
 }
 //___________________________________________________________________________
 string GHepParticle::Name(void) const
 {
-  this->AssertIsKnownParticle();
-
-  TParticlePDG * p = PDGLibrary::Instance()->Find(fPdgCode);
-  return p->GetName();
+  int idx = this->PdgIndex();
+  return PDGLibrary::Instance()->Properties(idx).particle->GetName();
 }
 //___________________________________________________________________________
 double GHepParticle::Mass(void) const
 {
-  this->AssertIsKnownParticle();
-
-  TParticlePDG * p = PDGLibrary::Instance()->Find(fPdgCode);
-  return p->Mass();
+  int idx = this->PdgIndex();
+  return PDGLibrary::Instance()->Properties(idx).mass;
 }
 //___________________________________________________________________________
 double GHepParticle::Charge(void) const
 {
-  this->AssertIsKnownParticle();
-
-  TParticlePDG * p = PDGLibrary::Instance()->Find(fPdgCode);
-  return p->Charge();
+  int idx = this->PdgIndex();
+  return PDGLibrary::Instance()->Properties(idx).charge;
 }
 //___________________________________________________________________________
 double GHepParticle::KinE(bool mass_from_pdg) const
 {
-  if(!fP4) {
-    LOG("GHepParticle", pWARN) << "4-momentum not yet set!";
-    return 0;
-  }
-
-  double En = fP4->Energy();
-  double M = ( (mass_from_pdg) ? this->Mass() : fP4->M() );
+  double En = fP4.Energy();
+  double M = ( (mass_from_pdg) ? this->Mass() : fP4.M() );
   double K = En - M;
 
   K = TMath::Max(K,0.);
@@ -196,17 +187,12 @@ TLorentzVector * GHepParticle::GetP4(void) const
 // see GHepParticle::P4() for a method that does not create a new object and
 // transfers its ownership
 
-  if(fP4) {
-     TLorentzVector * p4 = new TLorentzVector(*fP4);
+  TLorentzVector * p4 = new TLorentzVector(fP4);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-     LOG("GHepParticle", pDEBUG)
-          << "Return vp = " << utils::print::P4AsShortString(p4);
+  LOG("GHepParticle", pDEBUG)
+       << "Return vp = " << utils::print::P4AsShortString(p4);
 #endif
-     return p4;
-  } else {
-    LOG("GHepParticle", pWARN) << "NULL 4-momentum TLorentzVector";
-    return 0;
-  }
+  return p4;
 }
 //___________________________________________________________________________
 TLorentzVector * GHepParticle::GetX4(void) const
@@ -214,17 +200,12 @@ TLorentzVector * GHepParticle::GetX4(void) const
 // see GHepParticle::X4() for a method that does not create a new object and
 // transfers its ownership
 
-  if(fX4) {
-     TLorentzVector * x4 = new TLorentzVector(*fX4);
+  TLorentzVector * x4 = new TLorentzVector(fX4);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-     LOG("GHepParticle", pDEBUG)
-         << "Return x4 = " << utils::print::X4AsString(x4);
+  LOG("GHepParticle", pDEBUG)
+      << "Return x4 = " << utils::print::X4AsString(x4);
 #endif
-     return x4;
-  } else {
-    LOG("GHepParticle", pWARN) << "NULL 4-position TLorentzVector";
-    return 0;
-  }
+  return x4;
 }
 //___________________________________________________________________________
 void GHepParticle::SetPdgCode(int code)
@@ -235,18 +216,12 @@ void GHepParticle::SetPdgCode(int code)
 //___________________________________________________________________________
 void GHepParticle::SetMomentum(const TLorentzVector & p4)
 {
-  if(fP4)
-      fP4->SetPxPyPzE( p4.Px(), p4.Py(), p4.Pz(), p4.Energy() );
-  else
-      fP4 = new TLorentzVector(p4);
+  fP4.SetPxPyPzE( p4.Px(), p4.Py(), p4.Pz(), p4.Energy() );
 }
 //___________________________________________________________________________
 void GHepParticle::SetMomentum(double px, double py, double pz, double En)
 {
-  if(fP4)
-      fP4->SetPxPyPzE(px, py, pz, En);
-  else
-      fP4 = new TLorentzVector(px, py, pz, En);
+  fP4.SetPxPyPzE(px, py, pz, En);
 }
 //___________________________________________________________________________
 void GHepParticle::SetPosition(const TLorentzVector & v4)
@@ -262,8 +237,7 @@ void GHepParticle::SetPosition(double x, double y, double z, double t)
                                << y << ", z = " << z << ", t = " << t << ")";
 #endif
 
-  if(fX4) fX4->SetXYZT(x,y,z,t);
-  else    fX4 = new TLorentzVector(x,y,z,t);
+  fX4.SetXYZT(x,y,z,t);
 }
 //___________________________________________________________________________
 void GHepParticle::SetEnergy(double En)
@@ -288,12 +262,8 @@ void GHepParticle::SetPz(double pz)
 //___________________________________________________________________________
 bool GHepParticle::IsOnMassShell(void) const
 {
-  this->AssertIsKnownParticle();
-
-  TParticlePDG * p = PDGLibrary::Instance()->Find(fPdgCode);
-
-  double Mpdg = p->Mass();
-  double M4p  = (fP4) ? fP4->M() : 0.;
+  double Mpdg = this->Mass();
+  double M4p  = fP4.M();
 
 //  return utils::math::AreEqual(Mpdg, M4p);
 
@@ -398,25 +368,25 @@ void GHepParticle::Init(void)
   fPolzPhi       = -999;
   fIsBound       = false;
   fRemovalEnergy = 0.;
-  fP4            = new TLorentzVector(0,0,0,0);
-  fX4            = new TLorentzVector(0,0,0,0);
+  fListMask      = 0;
+  fPdgIndex      = -1;
+
+  fP4.SetXYZT(0,0,0,0);
+  fX4.SetXYZT(0,0,0,0);
 }
 //___________________________________________________________________________
 void GHepParticle::CleanUp(void)
 {
-// deallocate memory
+// nothing is heap-allocated: the 4-vectors are held inline and just reset
 
-  if(fP4) delete fP4;
-  if(fX4) delete fX4;
-  fP4 = 0;
-  fX4 = 0;
+  fP4.SetXYZT(0,0,0,0);
+  fX4.SetXYZT(0,0,0,0);
 }
 //___________________________________________________________________________
 void GHepParticle::Reset(void)
 {
-// deallocate memory + initialize
+// initialize
 
-  this->CleanUp();
   this->Init();
 }
 //___________________________________________________________________________
@@ -530,12 +500,27 @@ void GHepParticle::Copy(const GHepParticle & particle)
 
   this->fIsBound       = particle.fIsBound;
   this->fRemovalEnergy = particle.fRemovalEnergy;
+
+  this->fListMask = particle.fListMask;
 }
 //___________________________________________________________________________
 void GHepParticle::AssertIsKnownParticle(void) const
 {
-  TParticlePDG * p = PDGLibrary::Instance()->Find(fPdgCode);
-  if(!p) {
+  this->PdgIndex();
+}
+//___________________________________________________________________________
+int GHepParticle::PdgIndex(void) const
+{
+// The PDGLibrary property table entry of the particle. The entry is cached
+// and re-checked against the PDG code, as the code can also be changed by
+// ROOT I/O or a PDGLibrary reload can rebuild the table.
+
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+  if(fPdgIndex >= 0 && fPdgIndex < pdglib->NParticles() &&
+     pdglib->Properties(fPdgIndex).pdgc == fPdgCode) return fPdgIndex;
+
+  fPdgIndex = pdglib->Index(fPdgCode);
+  if(fPdgIndex < 0) {
     LOG("GHepParticle", pFATAL)
       << "\n** You are attempting to insert particle with PDG code = "
       << fPdgCode << " into the event record."
@@ -544,6 +529,7 @@ void GHepParticle::AssertIsKnownParticle(void) const
     gAbortingInErr = true;
     exit(1);
   }
+  return fPdgIndex;
 }
 //___________________________________________________________________________
 bool GHepParticle::operator == (const GHepParticle & p) const
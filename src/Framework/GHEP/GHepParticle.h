@@ -5,6 +5,12 @@
 
 \brief   STDHEP-like event record entry that can fit a particle or a nucleus.
 
+         The momentum & position 4-vectors are held inline, so that creating
+         a particle allocates no memory and the 4-vector accessors need no
+         null checks. P4() and X4() return pointers to them, as for the
+         heap-allocated 4-vectors of class versions <= 2, which are still
+         read from old files (see the I/O rule in LinkDef.h).
+
 \author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
  University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -61,6 +67,7 @@ public :
 
   // Basic properties
   int           Pdg            (void) const { return  fPdgCode;            }
+  int           PdgIndex       (void) const; ///< PDGLibrary property table entry
   GHepStatus_t  Status         (void) const { return  fStatus;             }
   int           RescatterCode  (void) const { return  fRescatterCode;      }
   int           FirstMother    (void) const { return  fFirstMother;        }
@@ -69,32 +76,33 @@ public :
   int           LastDaughter   (void) const { return  fLastDaughter;       }
   bool          HasDaughters   (void) const { return (fFirstDaughter!=-1); }
   bool          IsBound        (void) const { return  fIsBound;            }
+  ULong64_t     ListMask       (void) const { return  fListMask;           } ///< named event lists it belongs to (see GHepRecord::ParticleListId)
 
   string Name   (void) const; ///< Name that corresponds to the PDG code
   double Mass   (void) const; ///< Mass that corresponds to the PDG code
   double Charge (void) const; ///< Chrg that corresponds to the PDG code
 
   // Returns the momentum & position 4-vectors
-  const TLorentzVector * P4 (void) const { return fP4; }
-  const TLorentzVector * X4 (void) const { return fX4; }
-  TLorentzVector * P4 (void) { return fP4; }
-  TLorentzVector * X4 (void) { return fX4; }
+  const TLorentzVector * P4 (void) const { return &fP4; }
+  const TLorentzVector * X4 (void) const { return &fX4; }
+  TLorentzVector * P4 (void) { return &fP4; }
+  TLorentzVector * X4 (void) { return &fX4; }
 
   // Hand over clones of the momentum & position 4-vectors (+ their ownership)
   TLorentzVector * GetP4 (void) const;
   TLorentzVector * GetX4 (void) const;
 
   // Returns the momentum & position 4-vectors components
-  double Px     (void) const { return (fP4) ? fP4->Px()     : 0; } ///< Get Px
-  double Py     (void) const { return (fP4) ? fP4->Py()     : 0; } ///< Get Py
-  double Pz     (void) const { return (fP4) ? fP4->Pz()     : 0; } ///< Get Pz
-  double E      (void) const { return (fP4) ? fP4->Energy() : 0; } ///< Get energy
-  double Energy (void) const { return this->E();                 } ///< Get energy
-  double KinE   (bool mass_from_pdg = false) const;                ///< Get kinetic energy
-  double Vx     (void) const { return (fX4) ? fX4->X()      : 0; } ///< Get production x
-  double Vy     (void) const { return (fX4) ? fX4->Y()      : 0; } ///< Get production y
-  double Vz     (void) const { return (fX4) ? fX4->Z()      : 0; } ///< Get production z
-  double Vt     (void) const { return (fX4) ? fX4->T()      : 0; } ///< Get production time
+  double Px     (void) const { return fP4.Px();     } ///< Get Px
+  double Py     (void) const { return fP4.Py();     } ///< Get Py
+  double Pz     (void) const { return fP4.Pz();     } ///< Get Pz
+  double E      (void) const { return fP4.Energy(); } ///< Get energy
+  double Energy (void) const { return this->E();    } ///< Get energy
+  double KinE   (bool mass_from_pdg = false) const; ///< Get kinetic energy
+  double Vx     (void) const { return fX4.X();      } ///< Get production x
+  double Vy     (void) const { return fX4.Y();      } ///< Get production y
+  double Vz     (void) const { return fX4.Z();      } ///< Get production z
+  double Vt     (void) const { return fX4.T();      } ///< Get production time
 
   // Return removal energy /set only for bound nucleons/
   double RemovalEnergy (void) const { return fRemovalEnergy; } ///< Get removal energy
@@ -128,6 +136,9 @@ public :
   // Set the rescattering code
   void SetRescatterCode(int code) { fRescatterCode = code; }
 
+  // Set the membership in the named event lists (see GHepRecord::AddToList)
+  void SetListMask(ULong64_t mask) { fListMask = mask; }
+
   // Set the mother/daughter links
   void SetFirstMother    (int m)          { fFirstMother   = m; }
   void SetLastMother     (int m)          { fLastMother    = m; }
@@ -178,14 +189,16 @@ private:
   int              fLastMother;     ///< last mother idx
   int              fFirstDaughter;  ///< first daughter idx
   int              fLastDaughter;   ///< last daughter idx
-  TLorentzVector * fP4;             ///< momentum 4-vector (GeV)
-  TLorentzVector * fX4;             ///< position 4-vector (in the target nucleus coordinate system / x,y,z in fm / t=0)
+  TLorentzVector   fP4;             ///< momentum 4-vector (GeV)
+  TLorentzVector   fX4;             ///< position 4-vector (in the target nucleus coordinate system / x,y,z in fm / t=0)
   double           fPolzTheta;      ///< polar polarization angle (rad)
   double           fPolzPhi;        ///< azimuthal polarization angle (rad)
   double           fRemovalEnergy;  ///< removal energy for bound nucleons (GeV)
   bool             fIsBound;        ///< 'is it a bound particle?' flag
+  ULong64_t        fListMask;       //! membership in the named event lists, one bit per list (not saved)
+  mutable int      fPdgIndex;       //! PDGLibrary property table entry of fPdgCode (cache)
 
-ClassDef(GHepParticle, 2)
+ClassDef(GHepParticle, 3)
 
 };
 
@@ -11,6 +11,9 @@
 #include <cassert>
 #include <algorithm>
 #include <iomanip>
+#include <map>
+#include <mutex>
+#include <utility>
 
 #include <TLorentzVector.h>
 #include <TVector3.h>
@@ -34,6 +37,7 @@ using std::setw;
 using std::setprecision;
 using std::setfill;
 using std::ios;
+using std::map;
 
 using namespace genie;
 
@@ -41,6 +45,14 @@ ClassImp(GHepRecord)
 
 int GHepRecord::fPrintLevel = 3;
 
+//___________________________________________________________________________
+// Name -> bit of the GHepParticle list mask, for the named particle lists
+namespace {
+  const int        kMaxParticleLists = 64;
+  map<string, int> gParticleListIds;
+  std::mutex       gParticleListIdsMutex;
+}
+
 //___________________________________________________________________________
 namespace genie {
  ostream & operator << (ostream & stream, const GHepRecord & rec)
@@ -51,30 +63,68 @@ namespace genie {
 }
 //___________________________________________________________________________
 GHepRecord::GHepRecord() :
-TClonesArray("genie::GHepParticle")
+TClonesArray("genie::GHepParticle"),
+fInteraction(0),
+fSpareSummary(0),
+fVtx(0),
+fEventFlags(0),
+fEventMask(0),
+fRejected(false),
+fReturnStep(-1)
 {
   this->InitRecord();
 }
 //___________________________________________________________________________
 GHepRecord::GHepRecord(int size) :
-TClonesArray("genie::GHepParticle", size)
+TClonesArray("genie::GHepParticle", size),
+fInteraction(0),
+fSpareSummary(0),
+fVtx(0),
+fEventFlags(0),
+fEventMask(0),
+fRejected(false),
+fReturnStep(-1)
 {
   this->InitRecord();
 }
 //___________________________________________________________________________
 GHepRecord::GHepRecord(const GHepRecord & record) :
-TClonesArray("genie::GHepParticle", record.GetEntries())
+TClonesArray("genie::GHepParticle", record.GetEntries()),
+fInteraction(0),
+fSpareSummary(0),
+fVtx(0),
+fEventFlags(0),
+fEventMask(0),
+fRejected(false),
+fReturnStep(-1)
 {
   this->InitRecord();
   this->Copy(record);
 }
 //___________________________________________________________________________
+GHepRecord::GHepRecord(GHepRecord && record) :
+TClonesArray("genie::GHepParticle"),
+fInteraction(0),
+fSpareSummary(0),
+fVtx(0),
+fEventFlags(0),
+fEventMask(0),
+fRejected(false),
+fReturnStep(-1)
+{
+  this->SetOwner(true);
+  this->Move(record);
+}
+//___________________________________________________________________________
 GHepRecord::GHepRecord(TRootIOCtor*) :
 TClonesArray("genie::GHepParticle"),
 fInteraction(0),
+fSpareSummary(0),
 fVtx(0),
 fEventFlags(0),
 fEventMask(0),
+fRejected(false),
+fReturnStep(-1),
 fWeight(0.),
 fProb(0.),
 fXSec(0.),
@@ -101,6 +151,24 @@ void GHepRecord::AttachSummary(Interaction * interaction)
   fInteraction = interaction;
 }
 //___________________________________________________________________________
+Interaction * GHepRecord::AttachSummaryCopy(const Interaction & interaction)
+{
+// Attaches a copy of the input interaction, re-using the memory of the
+// current or of the recycled summary whenever possible
+
+  if(!fInteraction) {
+    if(fSpareSummary) {
+      fInteraction  = fSpareSummary;
+      fSpareSummary = 0;
+    } else {
+      fInteraction = new Interaction(interaction);
+      return fInteraction;
+    }
+  }
+  fInteraction->Copy(interaction);
+  return fInteraction;
+}
+//___________________________________________________________________________
 GHepParticle * GHepRecord::Particle(int position) const
 {
 // Returns the GHepParticle from the specified position of the event record.
@@ -171,6 +239,80 @@ int GHepRecord::ParticlePosition(GHepParticle * particle, int start) const
   return -1;
 }
 //___________________________________________________________________________
+int GHepRecord::ParticleListId(string listname)
+{
+  std::lock_guard<std::mutex> lock(gParticleListIdsMutex);
+
+  map<string, int>::const_iterator it = gParticleListIds.find(listname);
+  if(it != gParticleListIds.end()) return it->second;
+
+  int id = gParticleListIds.size();
+  if(id >= kMaxParticleLists) {
+    LOG("GHEP", pFATAL)
+      << "Can not define particle list " << listname << ": at most "
+      << kMaxParticleLists << " named particle lists are supported";
+    gAbortingInErr = true;
+    exit(1);
+  }
+  LOG("GHEP", pINFO) << "Particle list " << listname << " -> id " << id;
+  gParticleListIds.insert(map<string, int>::value_type(listname, id));
+  return id;
+}
+//___________________________________________________________________________
+void GHepRecord::AddToList(int list, int position)
+{
+  assert(list >= 0 && list < kMaxParticleLists);
+
+  GHepParticle * p = this->Particle(position);
+  if(!p) return;
+  p->SetListMask( p->ListMask() | (((ULong64_t) 1) << list) );
+}
+//___________________________________________________________________________
+void GHepRecord::RemoveFromList(int list, int position)
+{
+  assert(list >= 0 && list < kMaxParticleLists);
+
+  GHepParticle * p = this->Particle(position);
+  if(!p) return;
+  p->SetListMask( p->ListMask() & ~(((ULong64_t) 1) << list) );
+}
+//___________________________________________________________________________
+bool GHepRecord::IsInList(int list, int position) const
+{
+  assert(list >= 0 && list < kMaxParticleLists);
+
+  GHepParticle * p = this->Particle(position);
+  if(!p) return false;
+  return (p->ListMask() >> list) & 1;
+}
+//___________________________________________________________________________
+vector<int> GHepRecord::ParticleList(int list) const
+{
+// Returns the positions of the list members, in record order
+
+  assert(list >= 0 && list < kMaxParticleLists);
+
+  vector<int> members;
+  int nentries = this->GetEntries();
+  for(int i = 0; i < nentries; i++) {
+    GHepParticle * p = (GHepParticle *) (*this)[i];
+    if((p->ListMask() >> list) & 1) members.push_back(i);
+  }
+  return members;
+}
+//___________________________________________________________________________
+void GHepRecord::ClearList(int list)
+{
+  assert(list >= 0 && list < kMaxParticleLists);
+
+  ULong64_t mask = ~(((ULong64_t) 1) << list);
+  int nentries = this->GetEntries();
+  for(int i = 0; i < nentries; i++) {
+    GHepParticle * p = (GHepParticle *) (*this)[i];
+    p->SetListMask( p->ListMask() & mask );
+  }
+}
+//___________________________________________________________________________
 vector<int> * GHepRecord::GetStableDescendants(int position) const
 {
 // Returns a list of all stable descendants of the GHEP entry in the input
@@ -498,7 +640,8 @@ void GHepRecord::AddParticle(const GHepParticle & p)
   LOG("GHEP", pINFO)
     << "Adding particle with pdgc = " << p.Pdg() << " at slot = " << pos;
 #endif
-  new ((*this)[pos]) GHepParticle(p);
+  GHepParticle * particle = (GHepParticle *) this->ConstructedAt(pos);
+  particle->Copy(p);
 
   // Update the mother's daughter list. If the newly inserted particle broke
   // compactification, then run CompactifyDaughterLists()
@@ -517,7 +660,15 @@ void GHepRecord::AddParticle(
   LOG("GHEP", pINFO)
            << "Adding particle with pdgc = " << pdg << " at slot = " << pos;
 #endif
-  new ((*this)[pos]) GHepParticle(pdg,status, mom1,mom2,dau1,dau2, p, v);
+  GHepParticle * particle = this->NewParticle(pos);
+  particle->SetPdgCode       (pdg);
+  particle->SetStatus        (status);
+  particle->SetFirstMother   (mom1);
+  particle->SetLastMother    (mom2);
+  particle->SetFirstDaughter (dau1);
+  particle->SetLastDaughter  (dau2);
+  particle->SetMomentum      (p);
+  particle->SetPosition      (v);
 
   // Update the mother's daughter list. If the newly inserted particle broke
   // compactification, then run CompactifyDaughterLists()
@@ -537,14 +688,31 @@ void GHepRecord::AddParticle(
   LOG("GHEP", pINFO)
            << "Adding particle with pdgc = " << pdg << " at slot = " << pos;
 #endif
-  new ( (*this)[pos] ) GHepParticle (
-            pdg, status, mom1, mom2, dau1, dau2, px, py, pz, E, x, y, z, t);
+  GHepParticle * particle = this->NewParticle(pos);
+  particle->SetPdgCode       (pdg);
+  particle->SetStatus        (status);
+  particle->SetFirstMother   (mom1);
+  particle->SetLastMother    (mom2);
+  particle->SetFirstDaughter (dau1);
+  particle->SetLastDaughter  (dau2);
+  particle->SetMomentum      (px, py, pz, E);
+  particle->SetPosition      (x, y, z, t);
 
   // Update the mother's daughter list. If the newly inserted particle broke
   // compactification, then run CompactifyDaughterLists()
   this->UpdateDaughterLists();
 }
 //___________________________________________________________________________
+GHepParticle * GHepRecord::NewParticle(int pos)
+{
+// Returns a particle in its default state at the input slot. A particle left
+// at that slot by RecycleRecord() is re-used so that no memory is allocated.
+
+  GHepParticle * particle = (GHepParticle *) this->ConstructedAt(pos);
+  particle->Reset();
+  return particle;
+}
+//___________________________________________________________________________
 void GHepRecord::UpdateDaughterLists(void)
 {
   int pos = this->GetEntries() - 1; // position of last entry
@@ -837,12 +1005,17 @@ void GHepRecord::InitRecord(void)
   fXSec         = 0.;
   fDiffXSec     = 0.;
   fDiffXSecPhSp = kPSNull;
-  fVtx          = new TLorentzVector(0,0,0,0);
 
-  fEventFlags  = new TBits(GHepFlags::NFlags());
+  // re-use the vertex, flags & mask if they are already allocated
+  if(fVtx) fVtx->SetXYZT(0,0,0,0);
+  else     fVtx = new TLorentzVector(0,0,0,0);
+
+  if(!fEventFlags) fEventFlags = new TBits(GHepFlags::NFlags());
   fEventFlags -> ResetAllBits(false);
+  fRejected   = false;
+  fReturnStep = -1;
 
-  fEventMask   = new TBits(GHepFlags::NFlags());
+  if(!fEventMask) fEventMask = new TBits(GHepFlags::NFlags());
 //fEventMask  -> ResetAllBits(true);
   for(unsigned int i = 0; i < GHepFlags::NFlags(); i++) {
    fEventMask->SetBitNumber(i, true);
@@ -872,11 +1045,36 @@ void GHepRecord::ResetRecord(void)
   this->InitRecord();
 }
 //___________________________________________________________________________
+void GHepRecord::RecycleRecord(void)
+{
+// Resets the record, as ResetRecord() does, but keeps all its memory for
+// re-use: The particles stay constructed in their TClonesArray slots (and
+// get re-used by the next AddParticle() calls), the summary is kept aside
+// for AttachSummaryCopy() and the vertex, flags and mask are reset in place.
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("GHEP", pDEBUG) << "Recycling GHepRecord";
+#endif
+  if(fInteraction) {
+    if(fSpareSummary) delete fSpareSummary;
+    fSpareSummary = fInteraction;
+    fInteraction  = 0;
+  }
+
+  // no 'C' option: the particles are not cleared / deallocated
+  TClonesArray::Clear();
+
+  this->InitRecord();
+}
+//___________________________________________________________________________
 void GHepRecord::Clear(Option_t * opt)
 {
   if (fInteraction) delete fInteraction;
   fInteraction=0;
 
+  if (fSpareSummary) delete fSpareSummary;
+  fSpareSummary=0;
+
   if (fVtx) delete fVtx;
   fVtx=0;
 
@@ -898,22 +1096,26 @@ void GHepRecord::Clear(Option_t * opt)
 //___________________________________________________________________________
 void GHepRecord::Copy(const GHepRecord & record)
 {
-  // clean up
-  this->ResetRecord();
+  // clean up (keeping the memory of the current entries for re-use)
+  this->RecycleRecord();
 
   // copy event record entries
   unsigned int ientry = 0;
   GHepParticle * p = 0;
   TIter ghepiter(&record);
-  while ( (p = (GHepParticle *) ghepiter.Next()) )
-                              new ( (*this)[ientry++] ) GHepParticle(*p);
+  while ( (p = (GHepParticle *) ghepiter.Next()) ) {
+    GHepParticle * particle = (GHepParticle *) this->ConstructedAt(ientry++);
+    particle->Copy(*p);
+  }
 
   // copy summary
-  fInteraction = new Interaction( *record.fInteraction );
+  if(record.fInteraction) this->AttachSummaryCopy(*record.fInteraction);
 
   // copy flags & mask
   *fEventFlags = *(record.EventFlags());
   *fEventMask  = *(record.EventMask());
+  fRejected    = record.fRejected;
+  fReturnStep  = record.fReturnStep;
 
   // copy vtx position
   TLorentzVector * v = record.Vertex();
@@ -927,6 +1129,47 @@ void GHepRecord::Copy(const GHepRecord & record)
   fDiffXSecPhSp = record.fDiffXSecPhSp;
 }
 //___________________________________________________________________________
+void GHepRecord::Move(GHepRecord & record)
+{
+// Takes over the particles, summary, vertex, flags & mask of the input
+// record without copying them. The input record is left empty (as after
+// RecycleRecord()) and may be re-used.
+
+  if(this == &record) return;
+
+  // drop the current particles & take over the input ones
+  TClonesArray::Delete();
+  this->AbsorbObjects(&record);
+
+  std::swap( fInteraction,  record.fInteraction  );
+  std::swap( fSpareSummary, record.fSpareSummary );
+  std::swap( fVtx,          record.fVtx          );
+  std::swap( fEventFlags,   record.fEventFlags   );
+  std::swap( fEventMask,    record.fEventMask    );
+
+  fRejected     = record.fRejected;
+  fReturnStep   = record.fReturnStep;
+  fWeight       = record.fWeight;
+  fProb         = record.fProb;
+  fXSec         = record.fXSec;
+  fDiffXSec     = record.fDiffXSec;
+  fDiffXSecPhSp = record.fDiffXSecPhSp;
+
+  record.RecycleRecord();
+}
+//___________________________________________________________________________
+GHepRecord & GHepRecord::operator = (const GHepRecord & record)
+{
+  if(this != &record) this->Copy(record);
+  return (*this);
+}
+//___________________________________________________________________________
+GHepRecord & GHepRecord::operator = (GHepRecord && record)
+{
+  this->Move(record);
+  return (*this);
+}
+//___________________________________________________________________________
 void GHepRecord::SetUnphysEventMask(const TBits & mask)
 {
  *fEventMask = mask;
@@ -945,6 +1188,25 @@ bool GHepRecord::Accept(void) const
   return accept;
 }
 //___________________________________________________________________________
+void GHepRecord::Reject(GHepFlag_t reason)
+{
+  LOG("GHEP", pNOTICE)
+    << "Event rejected: " << GHepFlags::Describe(reason);
+
+  fEventFlags->SetBitNumber(reason, true);
+  fRejected = true;
+}
+//___________________________________________________________________________
+void GHepRecord::StepBack(GHepFlag_t reason, int return_step)
+{
+  LOG("GHEP", pNOTICE)
+    << "Step back to processing step " << return_step << " requested: "
+    << GHepFlags::Describe(reason);
+
+  fEventFlags->SetBitNumber(reason, true);
+  fReturnStep = TMath::Max(0, return_step);
+}
+//___________________________________________________________________________
 void GHepRecord::SetPrintLevel(int print_level)
 {
   fPrintLevel = print_level;
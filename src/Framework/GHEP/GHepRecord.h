@@ -19,6 +19,7 @@
 #define _GHEP_RECORD_H_
 
 #include <ostream>
+#include <string>
 #include <vector>
 
 #include <TClonesArray.h>
@@ -28,11 +29,13 @@
 #include "Framework/Conventions/KinePhaseSpace.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/GHEP/GHepStatus.h"
+#include "Framework/GHEP/GHepFlags.h"
 
 class TRootIOCtor;
 class TLorentzVector;
 
 using std::ostream;
+using std::string;
 using std::vector;
 
 namespace genie {
@@ -51,13 +54,18 @@ public :
   GHepRecord();
   GHepRecord(int size);
   GHepRecord(const GHepRecord & record);
+  GHepRecord(GHepRecord && record);
   GHepRecord(TRootIOCtor*);
   virtual ~GHepRecord();
 
+  GHepRecord & operator = (const GHepRecord & record); ///< copy (see Copy())
+  GHepRecord & operator = (GHepRecord && record);      ///< move (see Move())
+
   // Methods to attach / get summary information
 
   virtual Interaction * Summary       (void) const;
   virtual void          AttachSummary (Interaction * interaction);
+  virtual Interaction * AttachSummaryCopy (const Interaction & interaction);
 
   // Provide a simplified wrapper of the 'new with placement'
   // TClonesArray object insertion method
@@ -85,6 +93,20 @@ public :
 
   virtual vector<int> * GetStableDescendants(int position) const;
 
+  // Named, event-level particle lists (an alternative to the global
+  // GHepVirtualListFolder). A list is one bit of the GHepParticle list mask,
+  // so the lists live in the record itself, follow the particles when the
+  // record is re-arranged and are emptied with the record. Get the id of a
+  // list once (eg. at configuration) and use it for the per-event calls.
+
+  static  int         ParticleListId (string listname);
+
+  virtual void        AddToList      (int list, int position);
+  virtual void        RemoveFromList (int list, int position);
+  virtual bool        IsInList       (int list, int position) const;
+  virtual vector<int> ParticleList   (int list) const;
+  virtual void        ClearList      (int list);
+
   // Return the mode (lepton+nucleon/nucleus, hadron+nucleon/nucleus, nucleon
   // decay etc...) by looking at the event entries
 
@@ -119,6 +141,24 @@ public :
   virtual bool    IsUnphysical (void) const { return (fEventFlags->CountBits()>0); }
   virtual bool    Accept       (void) const;
 
+  // Terminal rejection: a generation module that finds the event unphysical
+  // (eg. Pauli-blocked, below threshold, failed kinematics) sets the reason
+  // flag and asks for the event generation thread to stop: no other module
+  // runs. Unless the user accepts this class of unphysical events (see
+  // Accept()) the record is then recycled for the next attempt.
+
+  virtual void    Reject       (GHepFlag_t reason);
+  virtual bool    IsRejected   (void) const { return fRejected; }
+
+  // Step back: the non-throwing form of an EVGThreadException asking to
+  // step back. The module sets the reason flag and the processing step to
+  // return at; the event generation thread restores the record as it was
+  // before that step and runs the modules again from there.
+
+  virtual void    StepBack        (GHepFlag_t reason, int return_step);
+  virtual int     ReturnStep      (void) const { return fReturnStep; } ///< -1: no step back requested
+  virtual void    ClearReturnStep (void) { fReturnStep = -1; }
+
   // Methods to set/get the event weight and cross sections
 
   virtual double Weight         (void) const  { return fWeight;   }
@@ -145,8 +185,10 @@ public :
   // Common event record operations
 
   virtual void Copy        (const GHepRecord & record);
+  virtual void Move        (GHepRecord & record);
   virtual void Clear       (Option_t * opt="");
   virtual void ResetRecord (void);
+  virtual void RecycleRecord (void);
   virtual void CompactifyDaughterLists     (void);
   virtual void RemoveIntermediateParticles (void);
 
@@ -166,6 +208,7 @@ protected:
 
   // Attached interaction
   Interaction * fInteraction; ///< attached summary information
+  Interaction * fSpareSummary; //! summary kept by RecycleRecord() for re-use
 
   // Vertex position
   TLorentzVector * fVtx;  ///< vertex in the detector coordinate system
@@ -173,6 +216,8 @@ protected:
   // Flags (and user-specified mask) for the generated event
   TBits * fEventFlags;    ///< event flags indicating various pathologies or an unphysical event
   TBits * fEventMask;     ///< an input bit-field mask allowing one to ignore bits set in fEventFlags
+  bool    fRejected;      //! terminally rejected by a generation module (see Reject())
+  int     fReturnStep;    //! processing step to return at (see StepBack())
 
   // Event weight, probability and cross-sections
   double           fWeight;         ///< event weight
@@ -185,6 +230,8 @@ protected:
   void InitRecord  (void);
   void CleanRecord (void);
 
+  GHepParticle * NewParticle (int pos);
+
   // Methods used by the daughter list compactifier
   virtual void UpdateDaughterLists    (void);
   virtual bool HasCompactDaughterList (int pos);
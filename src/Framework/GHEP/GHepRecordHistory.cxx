@@ -38,21 +38,26 @@ map<int, GHepRecord*>()
 GHepRecordHistory::GHepRecordHistory(const GHepRecordHistory & history) :
 map<int, GHepRecord*>()
 {
-  this->Copy(history);
   this->ReadFlags();
+  this->Copy(history);
 }
 //___________________________________________________________________________
 GHepRecordHistory::~GHepRecordHistory()
 {
   this->PurgeHistory();
+
+  vector<GHepRecord *>::iterator spare_iter = fSpare.begin();
+  for( ; spare_iter != fSpare.end(); ++spare_iter) {
+    delete *spare_iter;
+  }
+  fSpare.clear();
 }
 //___________________________________________________________________________
 void GHepRecordHistory::AddSnapshot(int step, GHepRecord * record)
 {
 // Adds a GHepRecord 'snapshot' at the history buffer
 
-  bool go_on = (fEnabledFull || (fEnabledBootstrapStep && step==-1));
-  if(!go_on) return;
+  if(!this->KeepsSnapshot(step)) return;
 
   if(!record) {
    LOG("GHEP", pWARN)
@@ -65,7 +70,15 @@ void GHepRecordHistory::AddSnapshot(int step, GHepRecord * record)
      LOG("GHEP", pNOTICE)
                      << "Adding GHEP snapshot for processing step: " << step;
 
-     GHepRecord * snapshot = new GHepRecord(*record);
+     // re-use the memory of a purged snapshot, if one is available
+     GHepRecord * snapshot = 0;
+     if(fSpare.empty()) {
+       snapshot = new GHepRecord(*record);
+     } else {
+       snapshot = fSpare.back();
+       fSpare.pop_back();
+       snapshot->Copy(*record);
+     }
      this->insert( map<int, GHepRecord*>::value_type(step,snapshot));
 
   } else {
@@ -89,11 +102,7 @@ void GHepRecordHistory::PurgeHistory(void)
     LOG("GHEP", pINFO)
                   << "Deleting GHEP snapshot for processing step: " << step;
 
-    GHepRecord * record = history_iter->second;
-    if(record) {
-      delete record;
-      record = 0;
-    }
+    this->Recycle(history_iter->second);
   }
   this->clear();
 }
@@ -121,16 +130,33 @@ void GHepRecordHistory::PurgeRecentHistory(int start_step)
     return;
   }
 
-  GHepRecordHistory::iterator history_iter;
-  for(history_iter = this->begin();
-                              history_iter != this->end(); ++history_iter) {
+  GHepRecordHistory::iterator history_iter = this->lower_bound(start_step);
+  while(history_iter != this->end()) {
+     int step = history_iter->first;
+     LOG("GHEP", pINFO)
+                << "Deleting GHEP snapshot for processing step: " << step;
+     this->Recycle(history_iter->second);
+     this->erase(history_iter++);
+  }
+}
+//___________________________________________________________________________
+bool GHepRecordHistory::KeepsSnapshot(int step) const
+{
+  return (fEnabledFull || (fEnabledBootstrapStep && step==-1));
+}
+//___________________________________________________________________________
+void GHepRecordHistory::Recycle(GHepRecord * record)
+{
+// Keep the purged snapshot so that its memory can be re-used. The buffer
+// never needs more records than the history depth.
 
-    if(history_iter->first >= start_step) {
-       int step = history_iter->first;
-       LOG("GHEP", pINFO)
-                  << "Deleting GHEP snapshot for processing step: " << step;
-       this->erase(history_iter);
-    }
+  if(!record) return;
+
+  const unsigned int kMaxSpare = 32;
+  if(fSpare.size() < kMaxSpare) {
+    fSpare.push_back(record);
+  } else {
+    delete record;
   }
 }
 //___________________________________________________________________________
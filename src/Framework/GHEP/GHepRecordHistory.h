@@ -23,10 +23,12 @@
 #define _GHEP_RECORD_HISTORY_H_
 
 #include <map>
+#include <vector>
 #include <string>
 #include <ostream>
 
 using std::map;
+using std::vector;
 using std::string;
 using std::ostream;
 
@@ -50,6 +52,9 @@ public :
   void PurgeRecentHistory (int start_step);
   void ReadFlags          (void);
 
+  bool KeepsSnapshot      (int step) const;
+  bool KeepsFullHistory   (void)     const { return fEnabledFull; }
+
   void Copy  (const GHepRecordHistory & history);
   void Print (ostream & stream) const;
 
@@ -57,8 +62,12 @@ public :
 
 private:
 
+  void Recycle (GHepRecord * record);
+
   bool fEnabledFull;          ///< keep the full GHEP record history
   bool fEnabledBootstrapStep; ///< keep only the record that bootsrapped the generation cycle
+
+  vector<GHepRecord *> fSpare; ///< purged snapshots, re-used (rather than re-allocated) for the next ones
 };
 
 }      // genie namespace
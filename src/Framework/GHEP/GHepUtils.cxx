@@ -8,6 +8,7 @@
 */
 //____________________________________________________________________________
 
+#include <vector>
 
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/GHEP/GHepStatus.h"
@@ -18,6 +19,8 @@
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
 
+using std::vector;
+
 //____________________________________________________________________________
 int genie::utils::ghep::NeutReactionCode(const GHepRecord * event)
 {
@@ -363,3 +366,134 @@ int genie::utils::ghep::NuanceReactionCode(const GHepRecord * event)
   return evtype;
 }
 //____________________________________________________________________________
+int genie::utils::ghep::StripHadronTransport(GHepRecord * event)
+{
+// Removes the entries added by the hadron transport stage: the descendants
+// of the hadrons in the nucleus, the hadronic blob (final state nuclear
+// remnant) and the binding energy pseudo-particles. The hadrons in the
+// nucleus get back an empty daughter list, an unset rescatter code and the
+// position of their mother (the transport moves them to their exit point),
+// and the remnant nucleus is marked again as a final state particle.
+// Decays of particles outside the nucleus are left untouched.
+
+  if(!event || !event->TargetNucleus()) return 0;
+
+  int n = event->GetEntries();
+
+  // mothers always precede their daughters in GHEP
+  vector<bool> drop(n, false);
+  int ndrop = 0;
+  for(int i = 0; i < n; i++) {
+    GHepParticle * p = event->Particle(i);
+    int mom = p->FirstMother();
+    bool transported =
+      (mom >= 0 && mom < i) &&
+      (drop[mom] || event->Particle(mom)->Status() == kIStHadronInTheNucleus);
+    bool added =
+      (p->Status() == kIStFinalStateNuclearRemnant) || (p->Pdg() == kPdgBindino);
+    drop[i] = transported || added;
+    if(!drop[i]) continue;
+    ndrop++;
+
+    // the hadronic blob is a daughter of the remnant nucleus, which the
+    // transport marks as an intermediate state
+    if(p->Status() == kIStFinalStateNuclearRemnant && mom >= 0) {
+      GHepParticle * remnant = event->Particle(mom);
+      if(remnant->Status() == kIStIntermediateState &&
+         pdg::IsIon(remnant->Pdg())) {
+        remnant->SetStatus(kIStStableFinalState);
+      }
+    }
+  }
+  if(ndrop == 0) return 0;
+
+  LOG("GHEP", pINFO)
+    << "Removing " << ndrop << " hadron transport entries from GHEP";
+
+  // new position of each kept entry
+  vector<int> newpos(n, -1);
+  int nkept = 0;
+  for(int i = 0; i < n; i++) {
+    if(!drop[i]) newpos[i] = nkept++;
+  }
+
+  for(int i = 0; i < n; i++) {
+    if(drop[i]) continue;
+    GHepParticle * p = event->Particle(i);
+    if(p->Status() == kIStHadronInTheNucleus) {
+      p->SetRescatterCode(-1);
+      int mom = p->FirstMother();
+      if(mom >= 0) p->SetPosition(*(event->Particle(mom)->X4()));
+    }
+    int mom1 = p->FirstMother();
+    int mom2 = p->LastMother();
+    p->SetFirstMother ( (mom1 >= 0 && mom1 < n) ? newpos[mom1] : -1 );
+    p->SetLastMother  ( (mom2 >= 0 && mom2 < n) ? newpos[mom2] : -1 );
+    p->SetFirstDaughter(-1);
+    p->SetLastDaughter (-1);
+  }
+
+  for(int i = n-1; i >= 0; i--) {
+    if(drop[i]) event->RemoveAt(i);
+  }
+  event->Compress();
+
+  // rebuild the daughter lists from the mother indices
+  for(int i = 0; i < nkept; i++) {
+    int mom = event->Particle(i)->FirstMother();
+    if(mom < 0) continue;
+    GHepParticle * m = event->Particle(mom);
+    if(m->FirstDaughter() < 0) m->SetFirstDaughter(i);
+    m->SetLastDaughter(i);
+  }
+
+  return ndrop;
+}
+//____________________________________________________________________________
+unsigned int genie::utils::ghep::FinalStateTopology(const GHepRecord * event)
+{
+  if(!event) {
+    LOG("GHepUtils", pWARN) << "Null event!";
+    return 0;
+  }
+
+  unsigned int topo = 0;
+
+  int n = event->GetEntries();
+  for(int i = 0; i < n; i++) {
+    const GHepParticle * p = event->Particle(i);
+    if(!p) continue;
+    int pdgc = p->Pdg();
+    // only final state particles
+    if(p->Status() != kIStStableFinalState) continue;
+    // don't count the final state primary lepton as part of the hadronic system
+    if(p->FirstMother() == 0) continue;
+    // skip pseudo-particles
+    if(pdg::IsPseudoParticle(pdgc)) continue;
+
+    FSTopoSpecies_t s = kFSTopoOther;
+    if      (pdgc == kPdgProton  || pdgc == kPdgAntiProton ) s = kFSTopoNucleonP;
+    else if (pdgc == kPdgNeutron || pdgc == kPdgAntiNeutron) s = kFSTopoNucleonN;
+    else if (pdgc == kPdgPiP                               ) s = kFSTopoPiP;
+    else if (pdgc == kPdgPiM                               ) s = kFSTopoPiM;
+    else if (pdgc == kPdgPi0                               ) s = kFSTopoPi0;
+    else if (pdgc == kPdgKP                                ) s = kFSTopoKP;
+    else if (pdgc == kPdgKM                                ) s = kFSTopoKM;
+    else if (pdgc == kPdgK0      || pdgc == kPdgAntiK0     ) s = kFSTopoK0;
+    else if (pdgc == kPdgSigmaP  || pdgc == kPdgSigma0 ||
+             pdgc == kPdgSigmaM  || pdgc == kPdgLambda ||
+             pdgc == kPdgXi0     || pdgc == kPdgXiM    ||
+             pdgc == kPdgOmegaM                        ) s = kFSTopoHyperon;
+
+    // saturating increment of the 3-bit counter
+    if(FinalStateCount(topo, s) < 7) topo += (1u << (3*s));
+  }
+
+  return topo;
+}
+//____________________________________________________________________________
+int genie::utils::ghep::FinalStateCount(unsigned int topo, FSTopoSpecies_t s)
+{
+  return (topo >> (3*s)) & 0x7;
+}
+//____________________________________________________________________________
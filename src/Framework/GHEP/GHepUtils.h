@@ -28,6 +28,33 @@ namespace ghep  {
   int NeutReactionCode   (const GHepRecord * evrec);
   int NuanceReactionCode (const GHepRecord * evrec);
 
+  //! Restore the event record to its state before the hadron transport
+  //! stage, for re-running the hadron transport. Returns the number of
+  //! removed entries (0 if there is no nuclear target or nothing to remove).
+  int StripHadronTransport (GHepRecord * evrec);
+
+  //! Particle species counted in the final state topology word
+  typedef enum EFSTopoSpecies {
+    kFSTopoNucleonP = 0,  ///< p, \bar{p}
+    kFSTopoNucleonN,      ///< n, \bar{n}
+    kFSTopoPiP,           ///< \pi^{+}
+    kFSTopoPiM,           ///< \pi^{-}
+    kFSTopoPi0,           ///< \pi^{0}
+    kFSTopoKP,            ///< K^{+}
+    kFSTopoKM,            ///< K^{-}
+    kFSTopoK0,            ///< K^{0}, \bar{K^{0}}
+    kFSTopoHyperon,       ///< \Sigma^{+,0,-}, \Lambda^{0}, \Xi^{0,-}, \Omega^{-}
+    kFSTopoOther,         ///< anything else
+    kFSTopoNSpecies
+  } FSTopoSpecies_t;
+
+  //! Final state topology of the event (stable final state particles,
+  //! excluding the primary lepton and pseudo-particles), as a word holding
+  //! a 3-bit count (saturating at 7) per species: bits [3*s, 3*s+2] for
+  //! species s. Cheap to store and to select on (see NtpMCEventIndex).
+  unsigned int FinalStateTopology (const GHepRecord * evrec);
+  int          FinalStateCount    (unsigned int topo, FSTopoSpecies_t s);
+
 } // ghep  namespace
 } // utils namespace
 } // genie namespace
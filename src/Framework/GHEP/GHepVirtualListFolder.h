@@ -5,6 +5,11 @@
 
 \brief    A singleton class to manage all named GHepVirtualLists
 
+          The folder is global and not thread-safe. For particle lists of
+          the current event, prefer the named lists of the GHepRecord
+          (GHepRecord::ParticleListId(), AddToList(), ParticleList()),
+          which are held in the record itself.
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -13,6 +13,16 @@
 #pragma link C++ class genie::GHepVirtualList;
 #pragma link C++ class genie::GHepVirtualListFolder;
 
+// GHepParticle v<=2 kept its 4-vectors on the heap
+#pragma read sourceClass="genie::GHepParticle" version="[-2]" \
+             targetClass="genie::GHepParticle" \
+             source="TLorentzVector* fP4; TLorentzVector* fX4" \
+             target="fP4,fX4" \
+             code="{ if(onfile.fP4) { fP4 = *onfile.fP4; delete onfile.fP4; } \
+                     else fP4.SetXYZT(0,0,0,0); \
+                     if(onfile.fX4) { fX4 = *onfile.fX4; delete onfile.fX4; } \
+                     else fX4.SetXYZT(0,0,0,0); }"
+
 #pragma link C++ ioctortype TRootIOCtor;
 
 #endif
@@ -383,6 +383,22 @@ TLorentzVector * InitialState::GetProbeP4(RefFrame_t ref_frame) const
 //___________________________________________________________________________
 double InitialState::ProbeE(RefFrame_t ref_frame) const
 {
+  // LAB (= nuclear target rest frame) and struck nucleon rest frame energies
+  // are computed without allocating a 4-momentum: this is called for every
+  // interaction at every event
+  if(ref_frame == kRfLab || ref_frame == kRfTgtRest) {
+    return fProbeP4->Energy();
+  }
+  if(ref_frame == kRfHitNucRest) {
+    assert( fTgt->HitNucP4Ptr() != 0 );
+    const TLorentzVector * pnuc4 = fTgt->HitNucP4Ptr();
+    TLorentzVector p4(*fProbeP4);
+    p4.Boost(-pnuc4->Px() / pnuc4->Energy(),
+             -pnuc4->Py() / pnuc4->Energy(),
+             -pnuc4->Pz() / pnuc4->Energy());
+    return p4.Energy();
+  }
+
   TLorentzVector * p4 = this->GetProbeP4(ref_frame);
   double E = p4->Energy();
 
@@ -12,12 +12,14 @@
 //____________________________________________________________________________
 
 #include <sstream>
+#include <utility>
 
 #include <TRootIOCtor.h>
 
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/MathUtils.h"
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
@@ -61,6 +63,26 @@ TObject()
   this->Copy(interaction);
 }
 //___________________________________________________________________________
+Interaction::Interaction(Interaction && interaction) :
+TObject(interaction),
+fInitialState (interaction.fInitialState),
+fProcInfo     (interaction.fProcInfo),
+fKinematics   (interaction.fKinematics),
+fExclusiveTag (interaction.fExclusiveTag),
+fKinePhSp     (interaction.fKinePhSp)
+{
+// Takes over the owned objects of the input interaction, which is left
+// empty: it may only be assigned to or destroyed
+
+  if(fKinePhSp) fKinePhSp->UseInteraction(this);
+
+  interaction.fInitialState = 0;
+  interaction.fProcInfo     = 0;
+  interaction.fKinematics   = 0;
+  interaction.fExclusiveTag = 0;
+  interaction.fKinePhSp     = 0;
+}
+//___________________________________________________________________________
 Interaction::Interaction(TRootIOCtor*) :
 TObject(),
 fInitialState(0),
@@ -275,6 +297,61 @@ string Interaction::AsString(void) const
   return interaction.str();
 }
 //___________________________________________________________________________
+ULong64_t Interaction::KeyHash(void) const
+{
+// Hashes the fields coded by AsString() without building the string, so that
+// per-interaction look-ups (eg of cross section splines) can use it on every
+// call. Interactions with the same AsString() have the same hash.
+
+  using utils::math::HashCombine;
+
+  ULong64_t hash = 0;
+  hash = HashCombine(hash, fInitialState->ProbePdg());
+  hash = HashCombine(hash, fInitialState->Tgt().Pdg());
+
+  return this->ChannelHash(hash);
+}
+//___________________________________________________________________________
+InteractionKey Interaction::Key(void) const
+{
+// Packs the probe & target codes and hashes the other fields coded by
+// AsString(): no string is built, so that maps keyed by interaction channel
+// can be looked up on every event.
+
+  return InteractionKey(fInitialState->ProbePdg(),
+                        fInitialState->Tgt().Pdg(), this->ChannelHash(0));
+}
+//___________________________________________________________________________
+ULong64_t Interaction::ChannelHash(ULong64_t hash) const
+{
+  using utils::math::HashCombine;
+
+  const Target & tgt = fInitialState->Tgt();
+
+  hash = HashCombine(hash, tgt.HitNucIsSet() ? tgt.HitNucPdg() : 0);
+  hash = HashCombine(hash, tgt.HitQrkIsSet() ? tgt.HitQrkPdg() : 0);
+  hash = HashCombine(hash, tgt.HitQrkIsSet() && tgt.HitSeaQrk());
+  hash = HashCombine(hash, fProcInfo->InteractionTypeId());
+  hash = HashCombine(hash, fProcInfo->ScatteringTypeId());
+
+  const XclsTag & xcls = *fExclusiveTag;
+  hash = HashCombine(hash, xcls.IsCharmEvent()   ? xcls.CharmHadronPdg()   : -1);
+  hash = HashCombine(hash, xcls.IsStrangeEvent() ? xcls.StrangeHadronPdg() : -1);
+  hash = HashCombine(hash, xcls.NProtons());
+  hash = HashCombine(hash, xcls.NNeutrons());
+  hash = HashCombine(hash, xcls.NPiPlus());
+  hash = HashCombine(hash, xcls.NPiMinus());
+  hash = HashCombine(hash, xcls.NPi0());
+  hash = HashCombine(hash, xcls.NSingleGammas());
+  hash = HashCombine(hash, xcls.NRhoPlus());
+  hash = HashCombine(hash, xcls.NRhoMinus());
+  hash = HashCombine(hash, xcls.NRho0());
+  hash = HashCombine(hash, xcls.Resonance());
+  hash = HashCombine(hash, xcls.DecayMode());
+
+  return hash;
+}
+//___________________________________________________________________________
 void Interaction::Print(ostream & stream) const
 {
   const string line(110, '-');
@@ -299,6 +376,27 @@ Interaction & Interaction::operator = (const Interaction & interaction)
   return (*this);
 }
 //___________________________________________________________________________
+Interaction & Interaction::operator = (Interaction && interaction)
+{
+// Swaps the owned objects (each interaction keeps its own phase space, which
+// refers to it) so the input interaction remains valid
+
+  if(this == &interaction) return (*this);
+  if(!interaction.fInitialState) {
+    // the input was moved from: nothing to take over
+    this->Reset();
+    return (*this);
+  }
+  if(!fInitialState) {
+    this->Init();
+  }
+  std::swap(fInitialState, interaction.fInitialState);
+  std::swap(fProcInfo,     interaction.fProcInfo);
+  std::swap(fKinematics,   interaction.fKinematics);
+  std::swap(fExclusiveTag, interaction.fExclusiveTag);
+  return (*this);
+}
+//___________________________________________________________________________
 //
 //       **** Methods using the "named constructor" C++ idiom ****
 //
@@ -35,6 +35,7 @@
 #include "Framework/Interaction/Kinematics.h"
 #include "Framework/Interaction/XclsTag.h"
 #include "Framework/Interaction/KPhaseSpace.h"
+#include "Framework/Interaction/InteractionKey.h"
 
 using std::ostream;
 using std::string;
@@ -61,6 +62,7 @@ public:
   Interaction();
   Interaction(const InitialState & init, const ProcessInfo & proc);
   Interaction(const Interaction & i);
+  Interaction(Interaction && i);
   Interaction(TRootIOCtor*);
  ~Interaction();
 
@@ -92,11 +94,14 @@ public:
   // Copy, reset, print itself and build string code
   void   Reset    (void);
   void   Copy     (const Interaction & i);
-  string AsString (void) const;
+  string    AsString (void) const;
+  ULong64_t KeyHash  (void) const; ///< 64-bit hash of the fields coded by AsString()
+  InteractionKey Key (void) const; ///< packed key of the fields coded by AsString()
   void   Print    (ostream & stream) const;
 
   // Overloaded operators
   Interaction &    operator =  (const Interaction & i);                   ///< copy
+  Interaction &    operator =  (Interaction && i);                        ///< move
   friend ostream & operator << (ostream & stream, const Interaction & i); ///< print
 
   // Use the "Named Constructor" C++ idiom for fast creation of typical interactions
@@ -170,6 +175,9 @@ private:
   // Utility method for "named ctor"
   static Interaction * Create(int tgt, int probe, ScatteringType_t st, InteractionType_t it);
 
+  // Hashes, from seed, the fields coded by AsString() after the probe & target
+  ULong64_t ChannelHash (ULong64_t seed) const;
+
   // Private data members
   InitialState * fInitialState;  ///< Initial State info
   ProcessInfo *  fProcInfo;      ///< Process info (scattering, weak current,...)
@@ -0,0 +1,43 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <iomanip>
+
+#include "Framework/Interaction/InteractionKey.h"
+#include "Framework/Numerical/MathUtils.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+namespace genie {
+ ostream & operator << (ostream & stream, const InteractionKey & key)
+ {
+   std::ios_base::fmtflags flags = stream.flags();
+   char                    fill  = stream.fill();
+   stream << "nu:" << key.ProbePdg() << ";tgt:" << key.TargetPdg()
+          << ";" << std::hex << std::setw(16) << std::setfill('0') << key.Lo();
+   stream.flags(flags);
+   stream.fill(fill);
+   return stream;
+ }
+}
+//____________________________________________________________________________
+InteractionKey::InteractionKey(int probe, int target, ULong64_t detail) :
+fHi( ((ULong64_t) (UInt_t) probe << 32) | (ULong64_t) (UInt_t) target ),
+fLo( detail )
+{
+
+}
+//____________________________________________________________________________
+ULong64_t InteractionKey::Hash(void) const
+{
+  return utils::math::HashCombine(fHi, (Long64_t) fLo);
+}
+//____________________________________________________________________________
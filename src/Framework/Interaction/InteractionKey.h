@@ -0,0 +1,72 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::InteractionKey
+
+\brief    A packed 128-bit key of an interaction channel, for look-ups on hot
+          paths (event generation and cross section maps, max xsec caches)
+          that used to key on Interaction::AsString().
+
+          The upper word packs the probe and target PDG codes exactly. The
+          lower word is a 64-bit hash of the other fields coded by AsString()
+          (hit nucleon, hit quark, process and exclusive tag). Interactions
+          with the same AsString() have the same key, and different channels
+          of the same probe & target collide with a ~2^-64 probability.
+          The key is computed from the interaction fields without any memory
+          allocation (Interaction::Key()). AsString() remains the readable
+          channel code, for I/O and messages.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _INTERACTION_KEY_H_
+#define _INTERACTION_KEY_H_
+
+#include <ostream>
+
+#include <Rtypes.h>
+
+using std::ostream;
+
+namespace genie {
+
+class InteractionKey;
+ostream & operator << (ostream & stream, const InteractionKey & key);
+
+class InteractionKey {
+
+public:
+  InteractionKey() : fHi(0), fLo(0) { }
+  InteractionKey(int probe, int target, ULong64_t detail);
+
+  ULong64_t Hi   (void) const { return fHi; } ///< packed probe & target PDG codes
+  ULong64_t Lo   (void) const { return fLo; } ///< hash of the other channel fields
+  ULong64_t Hash (void) const;                ///< 64-bit hash of the full key
+
+  int  ProbePdg  (void) const { return (int) (fHi >> 32);            }
+  int  TargetPdg (void) const { return (int) (fHi & 0xffffffffULL);  }
+
+  bool operator == (const InteractionKey & k) const { return fHi == k.fHi && fLo == k.fLo; }
+  bool operator != (const InteractionKey & k) const { return !(*this == k); }
+  bool operator <  (const InteractionKey & k) const
+  {
+    return (fHi < k.fHi) || (fHi == k.fHi && fLo < k.fLo);
+  }
+
+  friend ostream & operator << (ostream & stream, const InteractionKey & key);
+
+private:
+  ULong64_t fHi;
+  ULong64_t fLo;
+};
+
+}      // genie namespace
+
+#endif // _INTERACTION_KEY_H_
@@ -75,9 +75,82 @@ double KPhaseSpace::GetTMaxDFR()
 void KPhaseSpace::UseInteraction(const Interaction * in)
 {
   fInteraction = in;
+
+  fMemoChannel      = 0;
+  fMemoHitNucMass   = 0.;
+  fMemoThresholdSet = false;
+  fMemoThreshold    = 0.;
+  fMemoLimitsMask   = 0;
+  for(int i = 0; i < 8; i++) fMemoP4[i] = 0.;
+}
+//___________________________________________________________________________
+void KPhaseSpace::UpdateChannelMemo(void) const
+{
+// Clears the memo if the channel of the interaction changed
+
+  ULong64_t channel = fInteraction->KeyHash();
+  if(channel == fMemoChannel) return;
+
+  fMemoChannel      = channel;
+  fMemoThresholdSet = false;
+  fMemoLimitsMask   = 0;
+}
+//___________________________________________________________________________
+Range1D_t KPhaseSpace::MemoisedLimits(EMemoLimit ilim) const
+{
+// Returns the memoised limits, computing them if the channel or the probe or
+// struck nucleon 4-momenta changed since they were computed
+
+  assert(fInteraction);
+  this->UpdateChannelMemo();
+
+  const InitialState &   init_state = fInteraction->InitState();
+  const TLorentzVector * probe      = init_state.ProbeP4Ptr();
+  const TLorentzVector * nucleon    = init_state.Tgt().HitNucP4Ptr();
+  double p4[8] = {
+     probe  ->Px(), probe  ->Py(), probe  ->Pz(), probe  ->E(),
+     nucleon->Px(), nucleon->Py(), nucleon->Pz(), nucleon->E() };
+  for(int i = 0; i < 8; i++) {
+    if(p4[i] != fMemoP4[i]) {
+      for(int j = 0; j < 8; j++) fMemoP4[j] = p4[j];
+      fMemoLimitsMask = 0;
+      break;
+    }
+  }
+
+  unsigned int bit = 1u << ilim;
+  if(fMemoLimitsMask & bit) return fMemoLimits[ilim];
+
+  Range1D_t lim;
+  switch(ilim) {
+  case(kMemoW)  : lim = this->ComputeWLim();  break;
+  case(kMemoQ2) : lim = this->ComputeQ2Lim(); break;
+  case(kMemoX)  : lim = this->ComputeXLim();  break;
+  case(kMemoY)  : lim = this->ComputeYLim();  break;
+  default       : lim = Range1D_t(-1.,-1.);   break;
+  }
+  fMemoLimits[ilim] = lim;
+  fMemoLimitsMask  |= bit;
+  return lim;
 }
 //___________________________________________________________________________
 double KPhaseSpace::Threshold(void) const
+{
+// Energy threshold, memoised for the current channel and struck nucleon mass
+
+  assert(fInteraction);
+  this->UpdateChannelMemo();
+
+  double M = fInteraction->InitState().Tgt().HitNucP4Ptr()->M();
+  if(fMemoThresholdSet && M == fMemoHitNucMass) return fMemoThreshold;
+
+  fMemoThreshold    = this->ComputeThreshold();
+  fMemoHitNucMass   = M;
+  fMemoThresholdSet = true;
+  return fMemoThreshold;
+}
+//___________________________________________________________________________
+double KPhaseSpace::ComputeThreshold(void) const
 {
   const ProcessInfo &  pi         = fInteraction->ProcInfo();
   const InitialState & init_state = fInteraction->InitState();
@@ -392,6 +465,11 @@ bool KPhaseSpace::IsAllowed(void) const
 }
 //___________________________________________________________________________
 Range1D_t KPhaseSpace::WLim(void) const
+{
+  return this->MemoisedLimits(kMemoW);
+}
+//____________________________________________________________________________
+Range1D_t KPhaseSpace::ComputeWLim(void) const
 {
 // Computes hadronic invariant mass limits.
 // For QEL the range reduces to the recoil nucleon mass.
@@ -523,6 +601,11 @@ Range1D_t KPhaseSpace::q2Lim_W(void) const
 }
 //____________________________________________________________________________
 Range1D_t KPhaseSpace::Q2Lim(void) const
+{
+  return this->MemoisedLimits(kMemoQ2);
+}
+//____________________________________________________________________________
+Range1D_t KPhaseSpace::ComputeQ2Lim(void) const
 {
   // Computes momentum transfer (Q2>0) limits irrespective of the invariant mass
   // For QEL this is identical to Q2Lim_W (since W is fixed)
@@ -643,6 +726,11 @@ Range1D_t KPhaseSpace::q2Lim(void) const
 }
 //____________________________________________________________________________
 Range1D_t KPhaseSpace::XLim(void) const
+{
+  return this->MemoisedLimits(kMemoX);
+}
+//____________________________________________________________________________
+Range1D_t KPhaseSpace::ComputeXLim(void) const
 {
   // Computes x-limits;
 
@@ -697,6 +785,11 @@ Range1D_t KPhaseSpace::XLim(void) const
 }
 //____________________________________________________________________________
 Range1D_t KPhaseSpace::YLim(void) const
+{
+  return this->MemoisedLimits(kMemoY);
+}
+//____________________________________________________________________________
+Range1D_t KPhaseSpace::ComputeYLim(void) const
 {
   Range1D_t yl;
   yl.min = -1;
@@ -5,6 +5,12 @@
 
 \brief    Kinematical phase space
 
+          The energy threshold and the limits of W, Q2, q2, x and y are
+          memoised: the threshold for the current channel (Interaction::
+          KeyHash()) and struck nucleon mass, the limits for the current
+          channel and probe and struck nucleon 4-momenta. They are only
+          recomputed when one of them changes.
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -21,6 +27,7 @@
 #include <cassert>
 
 #include <TObject.h>
+#include <Rtypes.h>
 
 #include "Framework/Conventions/KineVar.h"
 //#include "Interaction/KPhaseSpaceCut.h"
@@ -70,8 +77,28 @@ public:
 private:
   void Init(void);
 
+  // the actual calculations, memoised by the public methods
+  double     ComputeThreshold (void) const;
+  Range1D_t  ComputeWLim      (void) const;
+  Range1D_t  ComputeQ2Lim     (void) const;
+  Range1D_t  ComputeXLim      (void) const;
+  Range1D_t  ComputeYLim      (void) const;
+
+  // memo of the threshold and of the limits (indexed by the enum below)
+  enum EMemoLimit { kMemoW = 0, kMemoQ2, kMemoX, kMemoY, kNMemoLimits };
+  void      UpdateChannelMemo (void) const;
+  Range1D_t MemoisedLimits    (EMemoLimit ilim) const;
+
   const Interaction * fInteraction;
 
+  mutable ULong64_t fMemoChannel;               //! channel hash the memo refers to
+  mutable double    fMemoHitNucMass;            //! struck nucleon mass the threshold refers to
+  mutable bool      fMemoThresholdSet;          //! is fMemoThreshold valid?
+  mutable double    fMemoThreshold;             //! memoised threshold
+  mutable double    fMemoP4[8];                 //! probe (LAB) & struck nucleon 4-momenta the limits refer to
+  mutable unsigned  fMemoLimitsMask;            //! which of fMemoLimits are valid
+  mutable Range1D_t fMemoLimits[kNMemoLimits];  //! memoised limits
+
 ClassDef(KPhaseSpace,2)
 };
 
@@ -8,6 +8,8 @@
 */
 //____________________________________________________________________________
 
+#include <cassert>
+
 #include <TMath.h>
 #include <TLorentzVector.h>
 #include <TRootIOCtor.h>
@@ -21,6 +23,15 @@ using namespace genie;
 
 ClassImp(Kinematics)
 
+//____________________________________________________________________________
+namespace {
+  // the set-variable mask has one bit per kinematic variable
+  inline ULong64_t KVBit(KineVar_t kv) { return ((ULong64_t) 1) << kv; }
+
+  const ULong64_t kRunningKVMask =
+     KVBit(kKVx) | KVBit(kKVy) | KVBit(kKVQ2) | KVBit(kKVq2) | KVBit(kKVW) | KVBit(kKVt);
+}
+
 //____________________________________________________________________________
 namespace genie {
  ostream & operator << (ostream & stream, const Kinematics & kinematics)
@@ -45,10 +56,11 @@ TObject()
 //____________________________________________________________________________
 Kinematics::Kinematics(TRootIOCtor*) :
 TObject(),
+fKVMask(0),
 fP4Fsl(0),
 fP4HadSyst(0)
 {
-
+  for(int i = 0; i < kNumOfKineVar; i++) fKV[i] = 0.;
 }
 //____________________________________________________________________________
 Kinematics::~Kinematics()
@@ -58,7 +70,9 @@ Kinematics::~Kinematics()
 //____________________________________________________________________________
 void Kinematics::Init(void)
 {
-  fKV.clear();
+  assert(kNumOfKineVar <= 64); // fKVMask bits
+  for(int i = 0; i < kNumOfKineVar; i++) fKV[i] = 0.;
+  fKVMask = 0;
 
   fP4Fsl     = new TLorentzVector;
   fP4HadSyst = new TLorentzVector;
@@ -66,7 +80,7 @@ void Kinematics::Init(void)
 //____________________________________________________________________________
 void Kinematics::CleanUp(void)
 {
-  fKV.clear();
+  fKVMask = 0;
 
   delete fP4Fsl;
   delete fP4HadSyst;
@@ -74,7 +88,7 @@ void Kinematics::CleanUp(void)
 //____________________________________________________________________________
 void Kinematics::Reset(void)
 {
-  fKV.clear();
+  fKVMask = 0;
 
   this->SetFSLeptonP4 (0,0,0,0);
   this->SetHadSystP4  (0,0,0,0);
@@ -84,13 +98,8 @@ void Kinematics::Copy(const Kinematics & kinematics)
 {
   this->Reset();
 
-  map<KineVar_t, double>::const_iterator iter;
-
-  for(iter = kinematics.fKV.begin(); iter != kinematics.fKV.end(); ++iter) {
-    KineVar_t kv  = iter->first;
-    double    val = iter->second;
-    this->SetKV(kv,val);
-  }
+  for(int i = 0; i < kNumOfKineVar; i++) fKV[i] = kinematics.fKV[i];
+  fKVMask = kinematics.fKVMask;
 
   this->SetFSLeptonP4 (*kinematics.fP4Fsl);
   this->SetHadSystP4  (*kinematics.fP4HadSyst);
@@ -316,15 +325,14 @@ void Kinematics::SetHadSystP4(double px, double py, double pz, double E)
 //____________________________________________________________________________
 bool Kinematics::KVSet(KineVar_t kv) const
 {
-  if(fKV.count(kv) == 1) return true;
-  else return false;
+  if(kv < 0 || kv >= kNumOfKineVar) return false;
+  return (fKVMask & KVBit(kv)) != 0;
 }
 //____________________________________________________________________________
 double Kinematics::GetKV(KineVar_t kv) const
 {
   if(this->KVSet(kv)) {
-     map<KineVar_t, double>::const_iterator iter = fKV.find(kv);
-     return iter->second;
+     return fKV[kv];
   } else {
     LOG("Interaction", pWARN)
         << "Kinematic variable: " << KineVar::AsString(kv) << " was not set";
@@ -337,54 +345,42 @@ void Kinematics::SetKV(KineVar_t kv, double value)
   LOG("Interaction", pDEBUG)
             << "Setting " << KineVar::AsString(kv) << " to " << value;
 
-  if(this->KVSet(kv)) {
-     fKV[kv] = value;
-  } else {
-     fKV.insert( map<KineVar_t, double>::value_type(kv,value) );
+  if(kv < 0 || kv >= kNumOfKineVar) {
+    LOG("Interaction", pERROR)
+        << "Can not set invalid kinematic variable: " << (int) kv;
+    return;
   }
+  fKV[kv]  = value;
+  fKVMask |= KVBit(kv);
 }
 //____________________________________________________________________________
 void Kinematics::ClearRunningValues(void)
 {
 // clear the running values (leave the selected ones)
 //
-  fKV.erase( kKVx  );
-  fKV.erase( kKVy  );
-  fKV.erase( kKVQ2 );
-  fKV.erase( kKVq2 );
-  fKV.erase( kKVW  );
-  fKV.erase( kKVt  );
+  fKVMask &= ~kRunningKVMask;
 }
 //____________________________________________________________________________
 void Kinematics::UseSelectedKinematics(void)
 {
 // copy the selected kinematics into the running ones
 //
-  map<KineVar_t, double>::const_iterator iter;
-  iter = fKV.find(kKVSelx);
-  if(iter != fKV.end()) this->Setx(iter->second);
-  iter = fKV.find(kKVSely);
-  if(iter != fKV.end()) this->Sety(iter->second);
-  iter = fKV.find(kKVSelQ2);
-  if(iter != fKV.end()) this->SetQ2(iter->second);
-  iter = fKV.find(kKVSelq2);
-  if(iter != fKV.end()) this->Setq2(iter->second);
-  iter = fKV.find(kKVSelW);
-  if(iter != fKV.end()) this->SetW(iter->second);
-  iter = fKV.find(kKVSelt);
-  if(iter != fKV.end()) this->Sett(iter->second);
+  if(this->KVSet(kKVSelx )) this->Setx (fKV[kKVSelx ]);
+  if(this->KVSet(kKVSely )) this->Sety (fKV[kKVSely ]);
+  if(this->KVSet(kKVSelQ2)) this->SetQ2(fKV[kKVSelQ2]);
+  if(this->KVSet(kKVSelq2)) this->Setq2(fKV[kKVSelq2]);
+  if(this->KVSet(kKVSelW )) this->SetW (fKV[kKVSelW ]);
+  if(this->KVSet(kKVSelt )) this->Sett (fKV[kKVSelt ]);
 }
 //____________________________________________________________________________
 void Kinematics::Print(ostream & stream) const
 {
   stream << "[-] [Kinematics]" << endl;
 
-  map<KineVar_t, double>::const_iterator iter;
-
-  for(iter = fKV.begin(); iter != fKV.end(); ++iter) {
-    KineVar_t kv  = iter->first;
-    double    val = iter->second;
-    stream << " |--> " << KineVar::AsString(kv) << " = " << val << endl;
+  for(int i = 0; i < kNumOfKineVar; i++) {
+    KineVar_t kv = (KineVar_t) i;
+    if(!this->KVSet(kv)) continue;
+    stream << " |--> " << KineVar::AsString(kv) << " = " << fKV[kv] << endl;
   }
 }
 //____________________________________________________________________________
@@ -5,6 +5,10 @@
 
 \brief    Generated/set kinematical variables for an event
 
+          The variables are kept in a fixed array indexed by KineVar_t and a
+          bit mask tells which of them are set, so that getting and setting
+          them (in every cross section call) needs no look-up or allocation.
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -18,14 +22,12 @@
 #ifndef _KINEMATICS_H_
 #define _KINEMATICS_H_
 
-#include <map>
 #include <iostream>
 
 #include <TObject.h>
 
 #include "Framework/Conventions/KineVar.h"
 
-using std::map;
 using std::ostream;
 
 class TRootIOCtor;
@@ -99,11 +101,12 @@ private:
 
   //-- Private data members
 
-  map<KineVar_t, double> fKV;        ///< selected kinematics
-  TLorentzVector *       fP4Fsl;     ///< generated final state primary lepton 4-p  (LAB)
-  TLorentzVector *       fP4HadSyst; ///< generated final state hadronic system 4-p (LAB)
+  double           fKV[kNumOfKineVar]; ///< running & selected kinematics, indexed by KineVar_t
+  ULong64_t        fKVMask;            ///< bit kv is on if fKV[kv] is set
+  TLorentzVector * fP4Fsl;             ///< generated final state primary lepton 4-p  (LAB)
+  TLorentzVector * fP4HadSyst;         ///< generated final state hadronic system 4-p (LAB)
 
-ClassDef(Kinematics,2)
+ClassDef(Kinematics,3)
 };
 
 }       // genie namespace
@@ -14,8 +14,22 @@
 #pragma link C++ class genie::XclsTag;
 #pragma link C++ class genie::KPhaseSpace;
 
-#pragma link C++ class std::map<genie::KineVar_t,double>+; // in Kinematics object
-#pragma link C++ class std::pair<genie::KineVar_t,double>+; // in Kinematics object
+#pragma link C++ class std::map<genie::KineVar_t,double>+; // in Kinematics object (v<=2)
+#pragma link C++ class std::pair<genie::KineVar_t,double>+; // in Kinematics object (v<=2)
+
+// Kinematics v<=2 kept the variables in a map<KineVar_t,double>
+#pragma read sourceClass="genie::Kinematics" version="[-2]" \
+             targetClass="genie::Kinematics" \
+             source="std::map<genie::KineVar_t,double> fKV" \
+             target="fKV,fKVMask" \
+             code="{ fKVMask = 0; \
+                     std::map<genie::KineVar_t,double>::const_iterator it; \
+                     for(it = onfile.fKV.begin(); it != onfile.fKV.end(); ++it) { \
+                       int kv = (int) it->first; \
+                       if(kv < 0 || kv >= genie::kNumOfKineVar) continue; \
+                       fKV[kv]  = it->second; \
+                       fKVMask |= ((ULong64_t) 1) << kv; \
+                     } }"
 
 #pragma link C++ ioctortype TRootIOCtor;
 
@@ -0,0 +1,62 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <vector>
+
+#include "Framework/Interaction/ScratchInteraction.h"
+
+using std::vector;
+using namespace genie;
+
+//____________________________________________________________________________
+// Per-thread pool of scratch interactions
+namespace {
+
+  struct ScratchInteractionPool : public vector<Interaction *> {
+    ~ScratchInteractionPool() {
+      for(iterator iter = begin(); iter != end(); ++iter) delete *iter;
+    }
+  };
+
+  thread_local ScratchInteractionPool gScratchInteractions;
+
+  const UInt_t kInteractionBits = kISkipProcessChk | kISkipKinematicChk |
+                                  kIAssumeFreeNucleon | kIAssumeFreeElectron |
+                                  kINoNuclearCorrection;
+}
+
+//____________________________________________________________________________
+ScratchInteraction::ScratchInteraction(const Interaction & in)
+{
+  this->Acquire(in);
+}
+//____________________________________________________________________________
+ScratchInteraction::ScratchInteraction(const Interaction * in)
+{
+  this->Acquire(*in);
+}
+//____________________________________________________________________________
+ScratchInteraction::~ScratchInteraction()
+{
+  gScratchInteractions.push_back(fInteraction);
+}
+//____________________________________________________________________________
+void ScratchInteraction::Acquire(const Interaction & in)
+{
+  if(gScratchInteractions.empty()) {
+    fInteraction = new Interaction(in);
+  } else {
+    fInteraction = gScratchInteractions.back();
+    gScratchInteractions.pop_back();
+    fInteraction->Copy(in);
+    fInteraction->ResetBit(kInteractionBits);
+  }
+}
+//____________________________________________________________________________
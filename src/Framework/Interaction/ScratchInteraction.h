@@ -0,0 +1,62 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::ScratchInteraction
+
+\brief    Scratch copy of an interaction, for integrands, phase space scans
+          and selectors that vary the kinematics (or the probe energy) of an
+          input interaction they must not modify.
+
+          The copy is taken from a per-thread pool of Interaction objects,
+          which are created once per thread and then re-filled in place: an
+          Interaction::Copy() into an existing object only assigns the
+          fields of its InitialState, Target, ProcessInfo, Kinematics and
+          XclsTag and allocates no memory, whereas a new Interaction(*in)
+          allocates and later frees the full object graph. The scratch
+          interaction goes back to the pool when it goes out of scope.
+          Scratch interactions can be nested (eg. a cross section algorithm
+          taking one while integrating a scratch interaction of its caller).
+
+          As for a copy-constructed Interaction, the status bits of the
+          scratch copy (kISkipProcessChk, ...) are all unset.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _SCRATCH_INTERACTION_H_
+#define _SCRATCH_INTERACTION_H_
+
+#include "Framework/Interaction/Interaction.h"
+
+namespace genie {
+
+class ScratchInteraction {
+
+public:
+  explicit ScratchInteraction (const Interaction & in);
+  explicit ScratchInteraction (const Interaction * in);
+ ~ScratchInteraction ();
+
+  Interaction * Get        (void) const { return fInteraction; }
+  Interaction * operator-> (void) const { return fInteraction; }
+  Interaction & operator*  (void) const { return *fInteraction; }
+
+private:
+  ScratchInteraction (const ScratchInteraction &);
+  ScratchInteraction & operator = (const ScratchInteraction &);
+
+  void Acquire (const Interaction & in);
+
+  Interaction * fInteraction;
+};
+
+}      // genie namespace
+
+#endif // _SCRATCH_INTERACTION_H_
@@ -11,6 +11,8 @@
 #include <iostream>
 #include <vector>
 #include <iomanip>
+#include <atomic>
+#include <unordered_map>
 
 #include "libxml/parser.h"
 #include "libxml/xmlmemory.h"
@@ -33,6 +35,19 @@ using namespace genie;
 
 bool genie::gAbortingInErr = false;
 
+//____________________________________________________________________________
+namespace {
+
+  // Cached priority level of a message stream
+  struct StreamLevel {
+    log4cpp::Category *      category;
+    log4cpp::Priority::Value priority;
+    unsigned int             generation;
+  };
+
+  // Bumped whenever a priority level is set, invalidating all caches
+  std::atomic<unsigned int> gLevelGeneration(1);
+}
 //____________________________________________________________________________
 Messenger * Messenger::fInstance = 0;
 //____________________________________________________________________________
@@ -91,6 +106,31 @@ void Messenger::SetPriorityLevel(
   log4cpp::Category & MSG = log4cpp::Category::getInstance(stream);
 
   MSG.setPriority(priority);
+
+  gLevelGeneration++;
+}
+//____________________________________________________________________________
+log4cpp::Category * Messenger::Enabled(
+   const char * stream, log4cpp::Priority::Value priority)
+{
+// The streams are cached by the address of their name (mostly string
+// literals, one per call site); the name is still checked, as names built
+// at run time may re-use the same address
+
+  static thread_local std::unordered_map<const char *, StreamLevel> levels;
+
+  unsigned int generation = gLevelGeneration.load(std::memory_order_relaxed);
+
+  StreamLevel & level = levels[stream]; // zero generation if new
+  if ( level.generation != generation ||
+       level.category->getName().compare(stream) != 0 )
+  {
+    level.category   = & log4cpp::Category::getInstance(stream);
+    level.priority   = level.category->getChainedPriority();
+    level.generation = generation;
+  }
+
+  return (priority <= level.priority) ? level.category : 0;
 }
 //____________________________________________________________________________
 void Messenger::Configure(void)
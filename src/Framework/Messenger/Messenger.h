@@ -74,6 +74,33 @@ using std::string;
   #define ENDL std::endl
 #endif
 
+/*!
+  \def   __GENIE_MESG_THRESHOLD__
+  \brief The least important priority level of the messages compiled in.
+         Messages of lower priority are compiled out, at no run-time cost
+         (set at build time with ./configure --with-mesg-threshold=...;
+         by default all messages are compiled in).
+
+  \def   GMSG_CATEGORY(stream, priority)
+  \brief Used by the message macros below: runs the message statement
+         following it on the requested log4cpp::Category only if the input
+         priority is compiled in and enabled for the stream. Otherwise the
+         message (and its arguments) is not evaluated at all. It is a single
+         pass 'for' statement rather than an 'if', so that it does not take
+         the 'else' of an enclosing 'if'.
+*/
+
+#ifndef __GENIE_MESG_THRESHOLD__
+  #define __GENIE_MESG_THRESHOLD__ log4cpp::Priority::DEBUG
+#endif
+
+#define GMSG_CATEGORY(stream, priority) \
+  for ( log4cpp::Category * _gmsg_category = \
+          ( (priority) <= (__GENIE_MESG_THRESHOLD__) ) ? \
+             Messenger::Instance()->Enabled(stream, priority) : 0 ; \
+        _gmsg_category != 0 ; _gmsg_category = 0 ) \
+           (*_gmsg_category)
+
 /*!
   \def   SLOG(stream, priority)
   \brief A macro that returns the requested log4cpp::Category
@@ -82,7 +109,7 @@ using std::string;
 */
 
 #define SLOG(stream, priority) \
-           (*Messenger::Instance())(stream) \
+           GMSG_CATEGORY(stream, priority) \
                << priority << "[s] <" \
                << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
@@ -94,7 +121,7 @@ using std::string;
 */
 
 #define LOG(stream, priority) \
-           (*Messenger::Instance())(stream) \
+           GMSG_CATEGORY(stream, priority) \
                << priority << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
@@ -110,42 +137,42 @@ using std::string;
 #ifndef HIDE_GENIE_MSG_LOG_MACROS
 
 #define LOG_FATAL(stream) \
-          (*Messenger::Instance())(stream) \
+          GMSG_CATEGORY(stream, log4cpp::Priority::FATAL) \
                << log4cpp::Priority::FATAL << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_ALERT(stream) \
-          (*Messenger::Instance())(stream) \
+          GMSG_CATEGORY(stream, log4cpp::Priority::ALERT) \
                << log4cpp::Priority::ALERT << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_CRIT(stream) \
-          (*Messenger::Instance())(stream) \
+          GMSG_CATEGORY(stream, log4cpp::Priority::CRIT) \
                << log4cpp::Priority::CRIT << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_ERROR(stream) \
-          (*Messenger::Instance())(stream) \
+          GMSG_CATEGORY(stream, log4cpp::Priority::ERROR) \
                << log4cpp::Priority::ERROR << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_WARN(stream) \
-          (*Messenger::Instance())(stream) \
+          GMSG_CATEGORY(stream, log4cpp::Priority::WARN) \
                << log4cpp::Priority::WARN << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_NOTICE(stream) \
-          (*Messenger::Instance())(stream) \
+          GMSG_CATEGORY(stream, log4cpp::Priority::NOTICE) \
                << log4cpp::Priority::NOTICE << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_INFO(stream) \
-          (*Messenger::Instance())(stream) \
+          GMSG_CATEGORY(stream, log4cpp::Priority::INFO) \
                << log4cpp::Priority::INFO << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_DEBUG(stream) \
-          (*Messenger::Instance())(stream) \
+          GMSG_CATEGORY(stream, log4cpp::Priority::DEBUG) \
                << log4cpp::Priority::DEBUG << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
@@ -159,47 +186,47 @@ using std::string;
 */
 
 #define LLOG(stream, priority) \
-           (*Messenger::Instance())(stream) \
+           GMSG_CATEGORY(stream, priority) \
                << priority << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_FATAL(stream) \
-          (*Messenger::Instance())(stream) \
+          GMSG_CATEGORY(stream, log4cpp::Priority::FATAL) \
                << log4cpp::Priority::FATAL << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_ALERT(stream) \
-          (*Messenger::Instance())(stream) \
+          GMSG_CATEGORY(stream, log4cpp::Priority::ALERT) \
                << log4cpp::Priority::ALERT << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_CRIT(stream) \
-          (*Messenger::Instance())(stream) \
+          GMSG_CATEGORY(stream, log4cpp::Priority::CRIT) \
                << log4cpp::Priority::CRIT << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_ERROR(stream) \
-          (*Messenger::Instance())(stream) \
+          GMSG_CATEGORY(stream, log4cpp::Priority::ERROR) \
                << log4cpp::Priority::ERROR << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_WARN(stream) \
-          (*Messenger::Instance())(stream) \
+          GMSG_CATEGORY(stream, log4cpp::Priority::WARN) \
                << log4cpp::Priority::WARN << "'[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_NOTICE(stream) \
-          (*Messenger::Instance())(stream) \
+          GMSG_CATEGORY(stream, log4cpp::Priority::NOTICE) \
                << log4cpp::Priority::NOTICE << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_INFO(stream) \
-          (*Messenger::Instance())(stream) \
+          GMSG_CATEGORY(stream, log4cpp::Priority::INFO) \
                << log4cpp::Priority::INFO << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_DEBUG(stream) \
-          (*Messenger::Instance())(stream) \
+          GMSG_CATEGORY(stream, log4cpp::Priority::DEBUG) \
                << log4cpp::Priority::DEBUG << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
@@ -210,7 +237,7 @@ using std::string;
 */
 
 #define BLOG(stream, priority) \
-          (*Messenger::Instance())(stream) << priority
+          GMSG_CATEGORY(stream, priority) << priority
 
 /*!
   \def   MAXSLOG(stream, priority, maxcount)
@@ -263,6 +290,12 @@ public:
   log4cpp::Category & operator () (const char * stream);
   void SetPriorityLevel(const char * stream, log4cpp::Priority::Value p);
 
+  //! The category of the input stream if messages of the input priority
+  //! are printed on it, 0 otherwise. The stream priority levels are cached
+  //! per thread (the cache is invalidated by SetPriorityLevel()), so
+  //! priority levels must be set through the Messenger.
+  log4cpp::Category * Enabled(const char * stream, log4cpp::Priority::Value p);
+
   bool SetPrioritiesFromXmlFile(string filename);
 
 private:
@@ -11,8 +11,13 @@
 #pragma link C++ class genie::NtpMCJobEnv;
 #pragma link C++ class genie::NtpMCJobConfig;
 #pragma link C++ class genie::NtpMCRecHeader;
+#pragma link C++ class genie::NtpMCEventCost+;
 #pragma link C++ class genie::NtpMCRecordI;
 #pragma link C++ class genie::NtpMCEventRecord;
+#pragma link C++ class genie::NtpMCCompactEventRecord-;
+#pragma link C++ class genie::NtpMCFlatRecord;
+#pragma link C++ class genie::NtpMCEventIndex;
 #pragma link C++ class genie::NtpWriter;
+#pragma link C++ class genie::NtpReader;
 
 #endif
@@ -0,0 +1,310 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <cmath>
+#include <vector>
+
+#include <TBuffer.h>
+#include <TClass.h>
+#include <TBits.h>
+#include <TMath.h>
+#include <TLorentzVector.h>
+
+#include "Framework/Conventions/Constants.h"
+#include "Framework/Conventions/KinePhaseSpace.h"
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/GHEP/GHepFlags.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Ntuple/NtpMCCompactEventRecord.h"
+
+using namespace genie;
+using namespace genie::constants;
+
+ClassImp(NtpMCCompactEventRecord)
+
+//____________________________________________________________________________
+namespace {
+
+  const double kPositionStep = 1E-4; // position quantisation step (fm)
+
+  // per-particle flags, packed with the status code
+  const unsigned int kPackBound = 1 << 0;   // bound particle
+  const unsigned int kPackPolz  = 1 << 1;   // polarization angles stored
+  const unsigned int kPackErm   = 1 << 2;   // removal energy stored
+  const unsigned int kPackNBits = 3;
+
+  // unsigned integers written 7 bits per byte, the high bit marking that
+  // more bytes follow (so small values take a single byte)
+  void WriteVarUInt(TBuffer & b, ULong64_t v)
+  {
+    while(v >= 0x80) {
+      b << (UChar_t) ((v & 0x7F) | 0x80);
+      v >>= 7;
+    }
+    b << (UChar_t) v;
+  }
+  ULong64_t ReadVarUInt(TBuffer & b)
+  {
+    ULong64_t v = 0;
+    UChar_t   c = 0;
+    for(int shift = 0; shift < 64; shift += 7) {
+      b >> c;
+      v |= (ULong64_t) (c & 0x7F) << shift;
+      if(!(c & 0x80)) break;
+    }
+    return v;
+  }
+  // signed integers zig-zag mapped (0,-1,1,-2,... -> 0,1,2,3,...) first
+  void WriteVarInt(TBuffer & b, Long64_t v)
+  {
+    WriteVarUInt(b, ((ULong64_t) v << 1) ^ (ULong64_t) (v >> 63));
+  }
+  Long64_t ReadVarInt(TBuffer & b)
+  {
+    ULong64_t u = ReadVarUInt(b);
+    return (Long64_t) (u >> 1) ^ -(Long64_t) (u & 1);
+  }
+  // indices are written relative to a reference index; 0 flags an unset
+  // (negative) index
+  void WriteIndex(TBuffer & b, int idx, int ref)
+  {
+    if(idx < 0) { WriteVarUInt(b, 0); return; }
+    Long64_t d = (Long64_t) idx - ref;
+    WriteVarUInt(b, 1 + (((ULong64_t) d << 1) ^ (ULong64_t) (d >> 63)));
+  }
+  int ReadIndex(TBuffer & b, int ref)
+  {
+    ULong64_t u = ReadVarUInt(b);
+    if(u == 0) return -1;
+    u--;
+    return ref + (int) ((Long64_t) (u >> 1) ^ -(Long64_t) (u & 1));
+  }
+  // positions are quantised in kPositionStep steps
+  void WritePosition(TBuffer & b, double x)
+  {
+    const double xmax = 4E18 * kPositionStep;
+    if(!std::isfinite(x)) x = 0;
+    x = (x > xmax) ? xmax : ((x < -xmax) ? -xmax : x);
+    WriteVarInt(b, std::llround(x / kPositionStep));
+  }
+  double ReadPosition(TBuffer & b)
+  {
+    return ReadVarInt(b) * kPositionStep;
+  }
+  bool IsPolarized(const GHepParticle & p)
+  {
+    double theta = p.PolzPolarAngle();
+    double phi   = p.PolzAzimuthAngle();
+    return (theta >= 0 && theta <= kPi && phi >= 0 && phi < 2*kPi);
+  }
+}
+//____________________________________________________________________________
+NtpMCCompactEventRecord::NtpMCCompactEventRecord() :
+NtpMCEventRecord()
+{
+
+}
+//____________________________________________________________________________
+NtpMCCompactEventRecord::~NtpMCCompactEventRecord()
+{
+
+}
+//____________________________________________________________________________
+double NtpMCCompactEventRecord::PositionStep(void)
+{
+  return kPositionStep;
+}
+//____________________________________________________________________________
+void NtpMCCompactEventRecord::Streamer(TBuffer & b)
+{
+  if(b.IsReading()) {
+    UInt_t start = 0, count = 0;
+    b.ReadVersion(&start, &count);
+    b >> this->hdr.ievent;
+    this->ReadEvent(b);
+    b.CheckByteCount(start, count, NtpMCCompactEventRecord::IsA());
+  } else {
+    UInt_t count = b.WriteVersion(NtpMCCompactEventRecord::IsA(), kTRUE);
+    b << this->hdr.ievent;
+    this->WriteEvent(b);
+    b.SetByteCount(count, kTRUE);
+  }
+}
+//____________________________________________________________________________
+void NtpMCCompactEventRecord::WriteEvent(TBuffer & b) const
+{
+  if(!this->event) {
+    b << (UChar_t) 0;
+    return;
+  }
+  b << (UChar_t) 1;
+
+  const EventRecord & ev = *this->event;
+
+  b << ev.Weight();
+  b << ev.Probability();
+  b << ev.XSec();
+  b << ev.DiffXSec();
+  b << (Int_t) ev.DiffXSecVars();
+
+  const TLorentzVector * vtx = ev.Vertex();
+  b << vtx->X() << vtx->Y() << vtx->Z() << vtx->T();
+
+  UInt_t flags = 0, mask = 0;
+  const TBits * evflags = ev.EventFlags();
+  const TBits * evmask  = ev.EventMask();
+  for(unsigned int ibit = 0; ibit < GHepFlags::NFlags() && ibit < 32; ibit++) {
+    if(evflags && evflags->TestBitNumber(ibit)) flags |= (1u << ibit);
+    if(evmask  && evmask ->TestBitNumber(ibit)) mask  |= (1u << ibit);
+  }
+  b << flags << mask;
+
+  // the interaction summary is small: keep it as it is
+  b.WriteObjectAny(ev.Summary(), Interaction::Class());
+
+  int np = ev.GetEntries();
+  WriteVarUInt(b, np);
+  for(int ip = 0; ip < np; ip++) {
+    const GHepParticle * p = ev.Particle(ip);
+    GHepParticle empty;
+    if(!p) p = &empty;
+
+    bool polz = IsPolarized(*p);
+    bool erm  = (p->RemovalEnergy() != 0);
+    unsigned int packed = 0;
+    if(p->IsBound()) packed |= kPackBound;
+    if(polz)         packed |= kPackPolz;
+    if(erm)          packed |= kPackErm;
+    packed |= (unsigned int) (p->Status() + 1) << kPackNBits;
+
+    WriteVarInt  (b, p->Pdg());
+    WriteVarUInt (b, packed);
+    WriteVarInt  (b, p->RescatterCode());
+
+    int m1 = p->FirstMother();
+    int d1 = p->FirstDaughter();
+    WriteIndex (b, m1,                 ip);
+    WriteIndex (b, p->LastMother(),    (m1 < 0) ? ip : m1);
+    WriteIndex (b, d1,                 ip);
+    WriteIndex (b, p->LastDaughter(),  (d1 < 0) ? ip : d1);
+
+    const TLorentzVector * p4 = p->P4();
+    b << (Float_t) p4->Px() << (Float_t) p4->Py()
+      << (Float_t) p4->Pz() << (Float_t) p4->E();
+
+    const TLorentzVector * x4 = p->X4();
+    WritePosition(b, x4->X());
+    WritePosition(b, x4->Y());
+    WritePosition(b, x4->Z());
+    WritePosition(b, x4->T());
+
+    if(polz) {
+      b << (Float_t) p->PolzPolarAngle() << (Float_t) p->PolzAzimuthAngle();
+    }
+    if(erm) {
+      b << (Float_t) p->RemovalEnergy();
+    }
+  }
+}
+//____________________________________________________________________________
+void NtpMCCompactEventRecord::ReadEvent(TBuffer & b)
+{
+  UChar_t has_event = 0;
+  b >> has_event;
+  if(!has_event) {
+    delete this->event;
+    this->event = 0;
+    return;
+  }
+
+  // re-use the record (and its particles) left by the previous read
+  if(!this->event) this->event = new EventRecord;
+  EventRecord & ev = *this->event;
+  ev.RecycleRecord();
+
+  Double_t wght, prob, xsec, dxsec;
+  Int_t    dxsec_ps;
+  b >> wght >> prob >> xsec >> dxsec >> dxsec_ps;
+  ev.SetWeight      (wght);
+  ev.SetProbability (prob);
+  ev.SetXSec        (xsec);
+  ev.SetDiffXSec    (dxsec, (KinePhaseSpace_t) dxsec_ps);
+
+  Double_t vx, vy, vz, vt;
+  b >> vx >> vy >> vz >> vt;
+  ev.SetVertex(vx, vy, vz, vt);
+
+  UInt_t flags = 0, mask = 0;
+  b >> flags >> mask;
+  TBits evmask(GHepFlags::NFlags());
+  for(unsigned int ibit = 0; ibit < GHepFlags::NFlags() && ibit < 32; ibit++) {
+    ev.EventFlags()->SetBitNumber(ibit, (flags >> ibit) & 1u);
+    evmask.SetBitNumber(ibit, (mask >> ibit) & 1u);
+  }
+  ev.SetUnphysEventMask(evmask);
+
+  Interaction * interaction =
+     (Interaction *) b.ReadObjectAny(Interaction::Class());
+  if(interaction) ev.AttachSummary(interaction);
+
+  int np = (int) ReadVarUInt(b);
+  std::vector<int> d1(np), d2(np);
+  for(int ip = 0; ip < np; ip++) {
+    int          pdg    = (int) ReadVarInt(b);
+    unsigned int packed = (unsigned int) ReadVarUInt(b);
+    int          resc   = (int) ReadVarInt(b);
+
+    int m1   = ReadIndex(b, ip);
+    int m2   = ReadIndex(b, (m1 < 0) ? ip : m1);
+    d1[ip]   = ReadIndex(b, ip);
+    d2[ip]   = ReadIndex(b, (d1[ip] < 0) ? ip : d1[ip]);
+
+    Float_t px, py, pz, E;
+    b >> px >> py >> pz >> E;
+    double x = ReadPosition(b);
+    double y = ReadPosition(b);
+    double z = ReadPosition(b);
+    double t = ReadPosition(b);
+
+    GHepParticle p;
+    p.SetPdgCode       (pdg);
+    p.SetStatus        ((GHepStatus_t) ((int) (packed >> kPackNBits) - 1));
+    p.SetRescatterCode (resc);
+    p.SetFirstMother   (m1);
+    p.SetLastMother    (m2);
+    p.SetFirstDaughter (d1[ip]);
+    p.SetLastDaughter  (d2[ip]);
+    p.SetMomentum      (px, py, pz, E);
+    p.SetPosition      (x,  y,  z,  t);
+    p.SetBound         ((packed & kPackBound) != 0);
+    if(packed & kPackPolz) {
+      Float_t theta, phi;
+      b >> theta >> phi;
+      // keep the angles in range after rounding to float
+      p.SetPolarization(TMath::Min((double) theta, kPi),
+                        (phi < 2*kPi) ? (double) phi : 0.);
+    }
+    if(packed & kPackErm) {
+      Float_t erm;
+      b >> erm;
+      p.SetRemovalEnergy(erm);
+    }
+    ev.AddParticle(p);
+  }
+  // the daughter lists are stored as they were: undo any update made
+  // while the particles were being added
+  for(int ip = 0; ip < np; ip++) {
+    GHepParticle * pp = ev.Particle(ip);
+    pp->SetFirstDaughter (d1[ip]);
+    pp->SetLastDaughter  (d2[ip]);
+  }
+}
+//____________________________________________________________________________
@@ -0,0 +1,68 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::NtpMCCompactEventRecord
+
+\brief    A GHEP event tree record (NtpMCEventRecord) with a compact,
+          reduced precision custom streamer.
+
+          Each particle is written as:
+          - pdg code, status, rescattering code and a few flags (bound?,
+            polarized?, removal energy set?) as packed variable-length
+            integers,
+          - mother / daughter indices delta-encoded with respect to the
+            particle position (first mother & daughter) or to the first
+            index (last mother & daughter), as variable-length integers,
+          - the 4-momentum, polarization angles and removal energy as floats
+            (the last two only if set),
+          - the 4-position quantised in steps of PositionStep() (in fm within
+            the hit nucleus), as variable-length integers.
+          The event weight, probability, cross sections, vertex, flags and
+          the interaction summary are kept in full precision.
+
+          Reading rebuilds a normal GHEP EventRecord in `event', so that any
+          code reading NtpMCEventRecord objects can read the compact record
+          as well. The gmcrec branch of the native GHEP event tree holds
+          compact records when NtpWriter::SetCompactGHEP() is enabled (or
+          through RunOpt, --output-ghep-compact).
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_MC_COMPACT_EVENT_RECORD_H_
+#define _NTP_MC_COMPACT_EVENT_RECORD_H_
+
+#include "Framework/Ntuple/NtpMCEventRecord.h"
+
+class TBuffer;
+
+namespace genie {
+
+class NtpMCCompactEventRecord : public NtpMCEventRecord {
+
+public :
+  using NtpMCEventRecord::Copy;
+
+  NtpMCCompactEventRecord();
+  virtual ~NtpMCCompactEventRecord();
+
+  static double PositionStep (void); ///< position quantisation step (fm)
+
+private:
+
+  void WriteEvent (TBuffer & b) const;
+  void ReadEvent  (TBuffer & b);
+
+  ClassDef(NtpMCCompactEventRecord, 1)
+};
+
+}      // genie namespace
+
+#endif // _NTP_MC_COMPACT_EVENT_RECORD_H_
@@ -0,0 +1,91 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include "Framework/Ntuple/NtpMCEventCost.h"
+#include "Framework/Utils/EventGenCost.h"
+
+using namespace genie;
+
+ClassImp(NtpMCEventCost)
+
+//____________________________________________________________________________
+namespace genie {
+  ostream & operator<< (ostream& stream, const NtpMCEventCost & cost)
+  {
+     cost.PrintToStream(stream);
+     return stream;
+  }
+}
+//____________________________________________________________________________
+NtpMCEventCost::NtpMCEventCost() :
+TObject()
+{
+  this->Init();
+}
+//____________________________________________________________________________
+NtpMCEventCost::NtpMCEventCost(const NtpMCEventCost & cost) :
+TObject()
+{
+  this->Copy(cost);
+}
+//____________________________________________________________________________
+NtpMCEventCost::~NtpMCEventCost()
+{
+
+}
+//____________________________________________________________________________
+void NtpMCEventCost::PrintToStream(ostream & stream) const
+{
+  stream << "\n*** Event generation cost: "
+         << "wall time = " << this->time << " s"
+         << ", module CPU time = " << this->cputime << " s"
+         << " (" << this->evgen << ")"
+         << ", kinematic rejections = " << this->nkinerej
+         << ", flux neutrinos = " << this->nflux
+         << ", geometry steps = " << this->ngeomsteps;
+}
+//____________________________________________________________________________
+void NtpMCEventCost::Copy(const NtpMCEventCost & cost)
+{
+  this->time       = cost.time;
+  this->cputime    = cost.cputime;
+  this->evgen      = cost.evgen;
+  this->modtime    = cost.modtime;
+  this->nkinerej   = cost.nkinerej;
+  this->nflux      = cost.nflux;
+  this->ngeomsteps = cost.ngeomsteps;
+}
+//____________________________________________________________________________
+void NtpMCEventCost::Fill(const EventGenCost & cost)
+{
+  this->time       = EventGenCost::WallTime() - cost.start;
+  this->evgen      = cost.evgen;
+  this->modtime.assign(cost.modtime.begin(), cost.modtime.end());
+  this->nkinerej   = cost.nkinerej;
+  this->nflux      = cost.nflux;
+  this->ngeomsteps = cost.ngeomsteps;
+
+  this->cputime = 0;
+  for(unsigned int i = 0; i < this->modtime.size(); i++) {
+    this->cputime += this->modtime[i];
+  }
+}
+//____________________________________________________________________________
+void NtpMCEventCost::Init(void)
+{
+  this->time       = 0;
+  this->cputime    = 0;
+  this->evgen      = "";
+  this->nkinerej   = 0;
+  this->nflux      = 0;
+  this->ngeomsteps = 0;
+  this->modtime.clear();
+}
+//____________________________________________________________________________
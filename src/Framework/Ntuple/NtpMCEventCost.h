@@ -0,0 +1,76 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::NtpMCEventCost
+
+\brief   Ntuple class to hold the generation cost of an event (see
+         EventGenCost), written in the optional `gcost' branch of the event
+         tree, next to the event record (and its NtpMCRecHeader).
+
+         The module CPU times are those of the event generation thread
+         `evgen' of the event, in the order its modules are configured.
+         All other counters (and the wall time) include everything done
+         since the previous event was written out: flux neutrinos that did
+         not interact, rejected vertices and events, etc.
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_MC_EVENT_COST_H_
+#define _NTP_MC_EVENT_COST_H_
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <TObject.h>
+
+using std::ostream;
+using std::string;
+using std::vector;
+
+namespace genie {
+
+struct EventGenCost;
+class NtpMCEventCost;
+ostream & operator << (ostream & stream, const NtpMCEventCost & cost);
+
+class NtpMCEventCost : public TObject {
+
+public :
+  using TObject::Copy; // suppress clang 'hides overloaded virtual function [-Woverloaded-virtual]' warnings
+
+  NtpMCEventCost();
+  NtpMCEventCost(const NtpMCEventCost & cost);
+  virtual ~NtpMCEventCost();
+
+  void Init (void);
+  void Copy (const NtpMCEventCost & cost);
+  void Fill (const EventGenCost & cost);
+
+  void PrintToStream(ostream & stream) const;
+  friend ostream & operator << (ostream & stream, const NtpMCEventCost & cost);
+
+  // Ntuple is treated like a C-struct with public data members and
+  // rule-breaking field data members not prefaced by "f" and mostly lowercase.
+  Double_t          time;       ///< wall time since the previous event (s)
+  Double_t          cputime;    ///< time of all event generation modules (s)
+  string            evgen;      ///< event generation thread (EventGenerator)
+  vector<Double_t>  modtime;    ///< (steady clock) time of each module of that thread (s)
+  Long64_t          nkinerej;   ///< kinematic points rejected by the kinematic selection
+  Long64_t          nflux;      ///< flux neutrinos thrown since the previous event
+  Long64_t          ngeomsteps; ///< geometry navigation steps
+
+  ClassDef(NtpMCEventCost, 1)
+};
+
+}      // genie namespace
+
+#endif // _NTP_MC_EVENT_COST_H_
@@ -0,0 +1,98 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <TTree.h>
+#include <TLorentzVector.h>
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/GHEP/GHepUtils.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpMCEventIndex.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+NtpMCEventIndex::NtpMCEventIndex()
+{
+  this->Init();
+}
+//____________________________________________________________________________
+NtpMCEventIndex::~NtpMCEventIndex()
+{
+
+}
+//____________________________________________________________________________
+void NtpMCEventIndex::Init(void)
+{
+  iev   = 0;
+  probe = tgt = 0;
+  scat  = intr = neut = 0;
+  Ev    = wght = 0.;
+  topo  = 0;
+}
+//____________________________________________________________________________
+TTree * NtpMCEventIndex::CreateTree(void)
+{
+  TTree * tree = new TTree(TreeName(), "GENIE MC event index");
+
+  tree->Branch("iev",   &iev,   "iev/I"  );
+  tree->Branch("probe", &probe, "probe/I");
+  tree->Branch("tgt",   &tgt,   "tgt/I"  );
+  tree->Branch("scat",  &scat,  "scat/I" );
+  tree->Branch("intr",  &intr,  "intr/I" );
+  tree->Branch("neut",  &neut,  "neut/I" );
+  tree->Branch("Ev",    &Ev,    "Ev/D"   );
+  tree->Branch("wght",  &wght,  "wght/D" );
+  tree->Branch("topo",  &topo,  "topo/i" );
+
+  return tree;
+}
+//____________________________________________________________________________
+bool NtpMCEventIndex::SetBranchAddresses(TTree * tree)
+{
+  const char * names[] = {
+    "iev", "probe", "tgt", "scat", "intr", "neut", "Ev", "wght", "topo" };
+  void * addresses[] = {
+    &iev,  &probe,  &tgt,  &scat,  &intr,  &neut,  &Ev,  &wght,  &topo  };
+
+  if(!tree) return false;
+  for(unsigned int i = 0; i < sizeof(names)/sizeof(names[0]); i++) {
+    if(!tree->GetBranch(names[i])) {
+      LOG("Ntp", pWARN) << "No `" << names[i] << "' column in the event index";
+      return false;
+    }
+    tree->SetBranchAddress(names[i], addresses[i]);
+  }
+  return true;
+}
+//____________________________________________________________________________
+void NtpMCEventIndex::Fill(unsigned int ievent, const EventRecord * ev_rec)
+{
+  this->Init();
+  iev = ievent;
+  if(!ev_rec) return;
+
+  wght = ev_rec->Weight();
+
+  const Interaction * interaction = ev_rec->Summary();
+  if(interaction) {
+    const InitialState & init_state = interaction->InitState();
+    probe = init_state.ProbePdg();
+    tgt   = init_state.Tgt().Pdg();
+    scat  = interaction->ProcInfo().ScatteringTypeId();
+    intr  = interaction->ProcInfo().InteractionTypeId();
+    const TLorentzVector * p4v = init_state.ProbeP4Ptr();
+    if(p4v) Ev = p4v->E();
+    neut  = utils::ghep::NeutReactionCode(ev_rec);
+  }
+  topo = utils::ghep::FinalStateTopology(ev_rec);
+}
+//____________________________________________________________________________
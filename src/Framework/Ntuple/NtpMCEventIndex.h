@@ -0,0 +1,75 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::NtpMCEventIndex
+
+\brief    A small event index, written by NtpWriter next to the GHEP event
+          tree as the `gindex' tree (one entry per event tree entry).
+
+          It holds a few per-event columns (event number, probe, target,
+          process, NEUT reaction code, probe energy, weight and final state
+          topology), so that events can be selected without reading and
+          de-serialising the full GHEP records. After a selection, only the
+          matching entries of the event tree need to be read, eg:
+          \code
+            gindex->Draw(">>elist", "probe==14 && intr==2", "entrylist");
+            gtree->SetEntryList((TEntryList*) gDirectory->Get("elist"));
+          \endcode
+          or by looping over the index (see gevpick).
+
+          The topology word is the one of utils::ghep::FinalStateTopology()
+          (3 bits per species, see utils::ghep::FinalStateCount()).
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_MC_EVENT_INDEX_H_
+#define _NTP_MC_EVENT_INDEX_H_
+
+#include <Rtypes.h>
+
+class TTree;
+
+namespace genie {
+
+class EventRecord;
+
+class NtpMCEventIndex {
+
+public :
+  NtpMCEventIndex();
+ ~NtpMCEventIndex();
+
+  static const char * TreeName (void) { return "gindex"; }
+
+  TTree *  CreateTree         (void);          ///< create the (output) index tree
+  bool     SetBranchAddresses (TTree * tree);  ///< connect to an input index tree
+  void     Fill               (unsigned int ievent, const EventRecord * ev_rec);
+
+  // Ntuple is treated like a C-struct with public data members and
+  // rule-breaking field data members not prefaced by "f" and mostly lowercase.
+  Int_t     iev;    ///< event number
+  Int_t     probe;  ///< probe pdg code
+  Int_t     tgt;    ///< target pdg code
+  Int_t     scat;   ///< scattering type (ScatteringType_t)
+  Int_t     intr;   ///< interaction type (InteractionType_t)
+  Int_t     neut;   ///< equivalent NEUT reaction code (0 if none)
+  Double_t  Ev;     ///< probe energy (LAB)
+  Double_t  wght;   ///< event weight
+  UInt_t    topo;   ///< final state topology (utils::ghep::FinalStateTopology())
+
+private:
+
+  void Init (void);
+};
+
+}      // genie namespace
+
+#endif // _NTP_MC_EVENT_INDEX_H_
@@ -0,0 +1,444 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <string>
+
+#include <TTree.h>
+#include <TBranch.h>
+#include <TBits.h>
+#include <TMath.h>
+#include <TLorentzVector.h>
+
+#include "Framework/Conventions/Constants.h"
+#include "Framework/Conventions/KinePhaseSpace.h"
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/GHEP/GHepFlags.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpMCFlatRecord.h"
+#include "Framework/ParticleData/BaryonResonance.h"
+
+using std::string;
+
+using namespace genie;
+using namespace genie::constants;
+
+static const double kUnsetKV = -99999.;
+
+//____________________________________________________________________________
+NtpMCFlatRecord::NtpMCFlatRecord() :
+fTree(0),
+fCapacity(0)
+{
+  this->Init();
+  this->Resize(64);
+}
+//____________________________________________________________________________
+NtpMCFlatRecord::~NtpMCFlatRecord()
+{
+
+}
+//____________________________________________________________________________
+void NtpMCFlatRecord::Init(void)
+{
+  iev = 0;
+  wght = prob = xsec = dxsec = 0.;
+  dxsec_ps = kPSNull;
+  vtx_x = vtx_y = vtx_z = vtx_t = 0.;
+  flags = mask = 0;
+
+  summary = false;
+  probe = tgt = hitnuc = hitqrk = 0;
+  sea = false;
+  scat = intr = 0;
+  resid = kNoResonance;
+  decmode = -1;
+  charm = strange = false;
+  charmh = strangeh = 0;
+  nprot = nneut = npi0 = npip = npim = ngamma = nrho0 = nrhop = nrhom = 0;
+  pxv = pyv = pzv = Ev = 0.;
+  pxn = pyn = pzn = En = rn = 0.;
+  xs = ys = Q2s = Ws = ts = kUnsetKV;
+  pxl = pyl = pzl = El = 0.;
+  pxh = pyh = pzh = Eh = 0.;
+
+  n = 0;
+}
+//____________________________________________________________________________
+bool NtpMCFlatRecord::Resize(int np)
+{
+// Makes room for np particles. Returns true if the arrays were reallocated
+// (their addresses must then be passed on to the connected tree)
+
+  if(np <= fCapacity) return false;
+
+  fCapacity = TMath::Max(np, 2*fCapacity);
+  pdg  .resize(fCapacity);
+  ist  .resize(fCapacity);
+  resc .resize(fCapacity);
+  m1   .resize(fCapacity);
+  m2   .resize(fCapacity);
+  d1   .resize(fCapacity);
+  d2   .resize(fCapacity);
+  px   .resize(fCapacity);
+  py   .resize(fCapacity);
+  pz   .resize(fCapacity);
+  E    .resize(fCapacity);
+  x    .resize(fCapacity);
+  y    .resize(fCapacity);
+  z    .resize(fCapacity);
+  t    .resize(fCapacity);
+  polth.resize(fCapacity);
+  polph.resize(fCapacity);
+  erm  .resize(fCapacity);
+  bound.resize(fCapacity);
+
+  return true;
+}
+//____________________________________________________________________________
+void NtpMCFlatRecord::CreateBranches(TTree * tree)
+{
+  fTree = tree;
+  this->ConnectEvent     (true);
+  this->ConnectParticles (true);
+}
+//____________________________________________________________________________
+void NtpMCFlatRecord::SetBranchAddresses(TTree * tree)
+{
+  fTree = tree;
+  this->ConnectEvent     (false);
+  this->ConnectParticles (false);
+}
+//____________________________________________________________________________
+Int_t NtpMCFlatRecord::GetEntry(Long64_t ientry)
+{
+// Reads the particle count first, so that the per-particle arrays can be
+// enlarged (if needed) before the rest of the entry is read
+
+  if(!fTree) {
+    LOG("Ntp", pERROR) << "No connected input tree";
+    return 0;
+  }
+  Long64_t local = fTree->LoadTree(ientry);
+  if(local < 0) return 0;
+
+  TBranch * brn = fTree->GetBranch("n");
+  if(brn) {
+    brn->GetEntry(local);
+    if(this->Resize(n)) this->ConnectParticles(false);
+  }
+  return fTree->GetEntry(ientry);
+}
+//____________________________________________________________________________
+void NtpMCFlatRecord::ConnectEvent(bool create)
+{
+  this->Connect("iev",      &iev,      'I', false, create);
+  this->Connect("wght",     &wght,     'D', false, create);
+  this->Connect("prob",     &prob,     'D', false, create);
+  this->Connect("xsec",     &xsec,     'D', false, create);
+  this->Connect("dxsec",    &dxsec,    'D', false, create);
+  this->Connect("dxsec_ps", &dxsec_ps, 'I', false, create);
+  this->Connect("vtx_x",    &vtx_x,    'D', false, create);
+  this->Connect("vtx_y",    &vtx_y,    'D', false, create);
+  this->Connect("vtx_z",    &vtx_z,    'D', false, create);
+  this->Connect("vtx_t",    &vtx_t,    'D', false, create);
+  this->Connect("flags",    &flags,    'i', false, create);
+  this->Connect("mask",     &mask,     'i', false, create);
+
+  this->Connect("summary",  &summary,  'O', false, create);
+  this->Connect("probe",    &probe,    'I', false, create);
+  this->Connect("tgt",      &tgt,      'I', false, create);
+  this->Connect("hitnuc",   &hitnuc,   'I', false, create);
+  this->Connect("hitqrk",   &hitqrk,   'I', false, create);
+  this->Connect("sea",      &sea,      'O', false, create);
+  this->Connect("scat",     &scat,     'I', false, create);
+  this->Connect("intr",     &intr,     'I', false, create);
+  this->Connect("resid",    &resid,    'I', false, create);
+  this->Connect("decmode",  &decmode,  'I', false, create);
+  this->Connect("charm",    &charm,    'O', false, create);
+  this->Connect("charmh",   &charmh,   'I', false, create);
+  this->Connect("strange",  &strange,  'O', false, create);
+  this->Connect("strangeh", &strangeh, 'I', false, create);
+  this->Connect("nprot",    &nprot,    'I', false, create);
+  this->Connect("nneut",    &nneut,    'I', false, create);
+  this->Connect("npi0",     &npi0,     'I', false, create);
+  this->Connect("npip",     &npip,     'I', false, create);
+  this->Connect("npim",     &npim,     'I', false, create);
+  this->Connect("ngamma",   &ngamma,   'I', false, create);
+  this->Connect("nrho0",    &nrho0,    'I', false, create);
+  this->Connect("nrhop",    &nrhop,    'I', false, create);
+  this->Connect("nrhom",    &nrhom,    'I', false, create);
+  this->Connect("pxv",      &pxv,      'D', false, create);
+  this->Connect("pyv",      &pyv,      'D', false, create);
+  this->Connect("pzv",      &pzv,      'D', false, create);
+  this->Connect("Ev",       &Ev,       'D', false, create);
+  this->Connect("pxn",      &pxn,      'D', false, create);
+  this->Connect("pyn",      &pyn,      'D', false, create);
+  this->Connect("pzn",      &pzn,      'D', false, create);
+  this->Connect("En",       &En,       'D', false, create);
+  this->Connect("rn",       &rn,       'D', false, create);
+  this->Connect("xs",       &xs,       'D', false, create);
+  this->Connect("ys",       &ys,       'D', false, create);
+  this->Connect("Q2s",      &Q2s,      'D', false, create);
+  this->Connect("Ws",       &Ws,       'D', false, create);
+  this->Connect("ts",       &ts,       'D', false, create);
+  this->Connect("pxl",      &pxl,      'D', false, create);
+  this->Connect("pyl",      &pyl,      'D', false, create);
+  this->Connect("pzl",      &pzl,      'D', false, create);
+  this->Connect("El",       &El,       'D', false, create);
+  this->Connect("pxh",      &pxh,      'D', false, create);
+  this->Connect("pyh",      &pyh,      'D', false, create);
+  this->Connect("pzh",      &pzh,      'D', false, create);
+  this->Connect("Eh",       &Eh,       'D', false, create);
+
+  this->Connect("n",        &n,        'I', false, create);
+}
+//____________________________________________________________________________
+void NtpMCFlatRecord::ConnectParticles(bool create)
+{
+  this->Connect("pdg",   &pdg  [0], 'I', true, create);
+  this->Connect("ist",   &ist  [0], 'I', true, create);
+  this->Connect("resc",  &resc [0], 'I', true, create);
+  this->Connect("m1",    &m1   [0], 'I', true, create);
+  this->Connect("m2",    &m2   [0], 'I', true, create);
+  this->Connect("d1",    &d1   [0], 'I', true, create);
+  this->Connect("d2",    &d2   [0], 'I', true, create);
+  this->Connect("px",    &px   [0], 'D', true, create);
+  this->Connect("py",    &py   [0], 'D', true, create);
+  this->Connect("pz",    &pz   [0], 'D', true, create);
+  this->Connect("E",     &E    [0], 'D', true, create);
+  this->Connect("x",     &x    [0], 'D', true, create);
+  this->Connect("y",     &y    [0], 'D', true, create);
+  this->Connect("z",     &z    [0], 'D', true, create);
+  this->Connect("t",     &t    [0], 'D', true, create);
+  this->Connect("polth", &polth[0], 'D', true, create);
+  this->Connect("polph", &polph[0], 'D', true, create);
+  this->Connect("erm",   &erm  [0], 'D', true, create);
+  this->Connect("bound", &bound[0], 'b', true, create);
+}
+//____________________________________________________________________________
+void NtpMCFlatRecord::Connect(
+  const char * name, void * address, char type, bool array, bool create)
+{
+  if(create) {
+    string leaves = string(name) + (array ? "[n]/" : "/") + type;
+    fTree->Branch(name, address, leaves.c_str());
+  }
+  else if(fTree->GetBranch(name)) {
+    fTree->SetBranchAddress(name, address);
+  }
+  else {
+    LOG("Ntp", pWARN) << "No `" << name << "' column in the input tree";
+  }
+}
+//____________________________________________________________________________
+void NtpMCFlatRecord::Fill(unsigned int ievent, const EventRecord * ev_rec)
+{
+  this->Init();
+  iev = ievent;
+  if(!ev_rec) return;
+
+  const EventRecord & event = *ev_rec;
+
+  wght     = event.Weight();
+  prob     = event.Probability();
+  xsec     = event.XSec();
+  dxsec    = event.DiffXSec();
+  dxsec_ps = event.DiffXSecVars();
+
+  const TLorentzVector * vtx = event.Vertex();
+  if(vtx) {
+    vtx_x = vtx->X(); vtx_y = vtx->Y(); vtx_z = vtx->Z(); vtx_t = vtx->T();
+  }
+  const TBits * evflags = event.EventFlags();
+  const TBits * evmask  = event.EventMask();
+  for(unsigned int ibit = 0; ibit < GHepFlags::NFlags() && ibit < 32; ibit++) {
+    if(evflags && evflags->TestBitNumber(ibit)) flags |= (1u << ibit);
+    if(evmask  && evmask ->TestBitNumber(ibit)) mask  |= (1u << ibit);
+  }
+
+  const Interaction * interaction = event.Summary();
+  if(interaction) {
+    summary = true;
+
+    const InitialState & init_state = interaction->InitState();
+    const Target &       target     = init_state.Tgt();
+    const ProcessInfo &  proc_info  = interaction->ProcInfo();
+    const XclsTag &      xcls       = interaction->ExclTag();
+    const Kinematics &   kine       = interaction->Kine();
+
+    probe  = init_state.ProbePdg();
+    tgt    = target.Pdg();
+    hitnuc = target.HitNucIsSet() ? target.HitNucPdg() : 0;
+    hitqrk = target.HitQrkIsSet() ? target.HitQrkPdg() : 0;
+    sea    = target.HitSeaQrk();
+    scat   = proc_info.ScatteringTypeId();
+    intr   = proc_info.InteractionTypeId();
+
+    resid    = xcls.Resonance();
+    decmode  = xcls.DecayMode();
+    charm    = xcls.IsCharmEvent();
+    charmh   = xcls.CharmHadronPdg();
+    strange  = xcls.IsStrangeEvent();
+    strangeh = xcls.StrangeHadronPdg();
+    nprot    = xcls.NProtons();
+    nneut    = xcls.NNeutrons();
+    npi0     = xcls.NPi0();
+    npip     = xcls.NPiPlus();
+    npim     = xcls.NPiMinus();
+    ngamma   = xcls.NSingleGammas();
+    nrho0    = xcls.NRho0();
+    nrhop    = xcls.NRhoPlus();
+    nrhom    = xcls.NRhoMinus();
+
+    const TLorentzVector * p4v = init_state.ProbeP4Ptr();
+    if(p4v) {
+      pxv = p4v->Px(); pyv = p4v->Py(); pzv = p4v->Pz(); Ev = p4v->E();
+    }
+    if(hitnuc != 0) {
+      const TLorentzVector & p4n = target.HitNucP4();
+      pxn = p4n.Px(); pyn = p4n.Py(); pzn = p4n.Pz(); En = p4n.E();
+      rn  = target.HitNucPosition();
+    }
+
+    if(kine.KVSet(kKVSelx )) xs  = kine.GetKV(kKVSelx );
+    if(kine.KVSet(kKVSely )) ys  = kine.GetKV(kKVSely );
+    if(kine.KVSet(kKVSelQ2)) Q2s = kine.GetKV(kKVSelQ2);
+    if(kine.KVSet(kKVSelW )) Ws  = kine.GetKV(kKVSelW );
+    if(kine.KVSet(kKVSelt )) ts  = kine.GetKV(kKVSelt );
+    const TLorentzVector & p4l = kine.FSLeptonP4();
+    const TLorentzVector & p4h = kine.HadSystP4();
+    pxl = p4l.Px(); pyl = p4l.Py(); pzl = p4l.Pz(); El = p4l.E();
+    pxh = p4h.Px(); pyh = p4h.Py(); pzh = p4h.Pz(); Eh = p4h.E();
+  }
+
+  n = event.GetEntries();
+  if(this->Resize(n) && fTree) this->ConnectParticles(false);
+
+  for(int ip = 0; ip < n; ip++) {
+    const GHepParticle * p = event.Particle(ip);
+    if(!p) {
+      pdg[ip] = 0; ist[ip] = kIStUndefined; resc[ip] = -1;
+      m1[ip] = m2[ip] = d1[ip] = d2[ip] = -1;
+      px[ip] = py[ip] = pz[ip] = E[ip] = x[ip] = y[ip] = z[ip] = t[ip] = 0.;
+      polth[ip] = polph[ip] = -999.; erm[ip] = 0.; bound[ip] = 0;
+      continue;
+    }
+    pdg  [ip] = p->Pdg();
+    ist  [ip] = p->Status();
+    resc [ip] = p->RescatterCode();
+    m1   [ip] = p->FirstMother();
+    m2   [ip] = p->LastMother();
+    d1   [ip] = p->FirstDaughter();
+    d2   [ip] = p->LastDaughter();
+    px   [ip] = p->P4()->Px();
+    py   [ip] = p->P4()->Py();
+    pz   [ip] = p->P4()->Pz();
+    E    [ip] = p->P4()->E();
+    x    [ip] = p->X4()->X();
+    y    [ip] = p->X4()->Y();
+    z    [ip] = p->X4()->Z();
+    t    [ip] = p->X4()->T();
+    polth[ip] = p->PolzPolarAngle();
+    polph[ip] = p->PolzAzimuthAngle();
+    erm  [ip] = p->RemovalEnergy();
+    bound[ip] = p->IsBound() ? 1 : 0;
+  }
+}
+//____________________________________________________________________________
+void NtpMCFlatRecord::FillEventRecord(EventRecord & event) const
+{
+  event.RecycleRecord();
+
+  event.SetWeight      (wght);
+  event.SetProbability (prob);
+  event.SetXSec        (xsec);
+  event.SetDiffXSec    (dxsec, (KinePhaseSpace_t) dxsec_ps);
+  event.SetVertex      (vtx_x, vtx_y, vtx_z, vtx_t);
+
+  TBits evmask(GHepFlags::NFlags());
+  for(unsigned int ibit = 0; ibit < GHepFlags::NFlags() && ibit < 32; ibit++) {
+    event.EventFlags()->SetBitNumber(ibit, (flags >> ibit) & 1u);
+    evmask.SetBitNumber(ibit, (mask >> ibit) & 1u);
+  }
+  event.SetUnphysEventMask(evmask);
+
+  if(summary) {
+    Interaction interaction;
+
+    InitialState * init_state = interaction.InitStatePtr();
+    init_state->SetPdgs(tgt, probe);
+    init_state->SetProbeP4(TLorentzVector(pxv, pyv, pzv, Ev));
+    Target * target = init_state->TgtPtr();
+    if(hitnuc != 0) {
+      target->SetHitNucPdg      (hitnuc);
+      target->SetHitNucP4       (TLorentzVector(pxn, pyn, pzn, En));
+      target->SetHitNucPosition (rn);
+    }
+    if(hitqrk != 0) {
+      target->SetHitQrkPdg (hitqrk);
+      target->SetHitSeaQrk (sea);
+    }
+
+    interaction.ProcInfoPtr()->Set(
+       (ScatteringType_t) scat, (InteractionType_t) intr);
+
+    XclsTag * xcls = interaction.ExclTagPtr();
+    if(charm)   xcls->SetCharm   (charmh);
+    if(strange) xcls->SetStrange (strangeh);
+    xcls->SetNNucleons     (nprot, nneut);
+    xcls->SetNPions        (npip, npi0, npim);
+    xcls->SetNSingleGammas (ngamma);
+    xcls->SetNRhos         (nrhop, nrho0, nrhom);
+    xcls->SetResonance     ((Resonance_t) resid);
+    xcls->SetDecayMode     (decmode);
+
+    Kinematics * kine = interaction.KinePtr();
+    if(xs  != kUnsetKV) kine->Setx  (xs,  true);
+    if(ys  != kUnsetKV) kine->Sety  (ys,  true);
+    if(Q2s != kUnsetKV) kine->SetQ2 (Q2s, true);
+    if(Ws  != kUnsetKV) kine->SetW  (Ws,  true);
+    if(ts  != kUnsetKV) kine->Sett  (ts,  true);
+    kine->SetFSLeptonP4 (pxl, pyl, pzl, El);
+    kine->SetHadSystP4  (pxh, pyh, pzh, Eh);
+
+    event.AttachSummaryCopy(interaction);
+  }
+
+  for(int ip = 0; ip < n; ip++) {
+    GHepParticle p;
+    p.SetPdgCode       (pdg[ip]);
+    p.SetStatus        ((GHepStatus_t) ist[ip]);
+    p.SetRescatterCode (resc[ip]);
+    p.SetFirstMother   (m1[ip]);
+    p.SetLastMother    (m2[ip]);
+    p.SetFirstDaughter (d1[ip]);
+    p.SetLastDaughter  (d2[ip]);
+    p.SetMomentum      (px[ip], py[ip], pz[ip], E[ip]);
+    p.SetPosition      (x[ip],  y[ip],  z[ip],  t[ip]);
+    p.SetBound         (bound[ip] != 0);
+    if(erm[ip] > 0) {
+      p.SetRemovalEnergy(erm[ip]);
+    }
+    if(polth[ip] >= 0 && polth[ip] <= kPi && polph[ip] >= 0 && polph[ip] < 2*kPi) {
+      p.SetPolarization(polth[ip], polph[ip]);
+    }
+    event.AddParticle(p);
+  }
+  // the daughter lists are stored as they were: undo any update made
+  // while the particles were being added
+  for(int ip = 0; ip < n; ip++) {
+    GHepParticle * pp = event.Particle(ip);
+    pp->SetFirstDaughter (d1[ip]);
+    pp->SetLastDaughter  (d2[ip]);
+  }
+}
+//____________________________________________________________________________
@@ -0,0 +1,162 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::NtpMCFlatRecord
+
+\brief    The flat, columnar (kNFFlat) event tree record.
+
+          Instead of a single, unsplit NtpMCEventRecord object, every event
+          is written as plain per-event scalars (weights, cross sections,
+          vertex, event flags and the interaction summary) and jagged
+          per-particle arrays (pdg, status, mothers, daughters, 4-momenta,
+          4-positions, ...) sized by the particle count `n'. Each column is
+          a branch of its own, so an analysis reads (and decompresses) only
+          the variables it uses, and the tree can be read directly with
+          RDataFrame or uproot, without the GENIE libraries.
+
+          Events are flattened with Fill() and rebuilt as GHEP event records
+          with FillEventRecord() (see the gntpc `gflat' and `ghep' formats).
+          The interaction summary is rebuilt from the stored initial state,
+          process, selected kinematics and exclusive tag; running kinematic
+          values are not carried over.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_MC_FLAT_RECORD_H_
+#define _NTP_MC_FLAT_RECORD_H_
+
+#include <vector>
+
+#include <Rtypes.h>
+
+class TTree;
+
+using std::vector;
+
+namespace genie {
+
+class EventRecord;
+
+class NtpMCFlatRecord {
+
+public :
+  NtpMCFlatRecord();
+ ~NtpMCFlatRecord();
+
+  void     CreateBranches     (TTree * tree);   ///< create the columns of an output tree
+  void     SetBranchAddresses (TTree * tree);   ///< connect to the columns of an input tree (or chain)
+  Int_t    GetEntry           (Long64_t ientry); ///< read an entry of the connected input tree
+
+  void     Fill            (unsigned int ievent, const EventRecord * ev_rec); ///< flatten an event
+  void     FillEventRecord (EventRecord & ev_rec) const;                      ///< rebuild the GHEP event
+
+  // Ntuple is treated like a C-struct with public data members and
+  // rule-breaking field data members not prefaced by "f" and mostly lowercase.
+
+  // event
+  Int_t     iev;        ///< event number
+  Double_t  wght;       ///< event weight
+  Double_t  prob;       ///< event probability
+  Double_t  xsec;       ///< cross section of the selected process (1E-38 cm^2)
+  Double_t  dxsec;      ///< differential cross section of the selected kinematics
+  Int_t     dxsec_ps;   ///< differential cross section phase space (KinePhaseSpace_t)
+  Double_t  vtx_x;      ///< vertex (detector coordinate system, SI units)
+  Double_t  vtx_y;
+  Double_t  vtx_z;
+  Double_t  vtx_t;
+  UInt_t    flags;      ///< event flags (GHepFlag_t bits)
+  UInt_t    mask;       ///< unphysical event mask
+
+  // interaction summary
+  Bool_t    summary;    ///< is a summary attached?
+  Int_t     probe;      ///< probe pdg code
+  Int_t     tgt;        ///< target pdg code
+  Int_t     hitnuc;     ///< hit nucleon pdg code (0 if not set)
+  Int_t     hitqrk;     ///< hit quark pdg code (0 if not set)
+  Bool_t    sea;        ///< hit sea quark?
+  Int_t     scat;       ///< scattering type (ScatteringType_t)
+  Int_t     intr;       ///< interaction type (InteractionType_t)
+  Int_t     resid;      ///< resonance (Resonance_t)
+  Int_t     decmode;    ///< resonance decay mode
+  Bool_t    charm;      ///< charm production?
+  Int_t     charmh;     ///< charmed hadron pdg code (0: inclusive)
+  Bool_t    strange;    ///< strange production?
+  Int_t     strangeh;   ///< strange hadron pdg code (0: inclusive)
+  Int_t     nprot;      ///< exclusive tag: # of protons, neutrons, pions, gammas, rhos
+  Int_t     nneut;
+  Int_t     npi0;
+  Int_t     npip;
+  Int_t     npim;
+  Int_t     ngamma;
+  Int_t     nrho0;
+  Int_t     nrhop;
+  Int_t     nrhom;
+  Double_t  pxv;        ///< probe 4-momentum (LAB)
+  Double_t  pyv;
+  Double_t  pzv;
+  Double_t  Ev;
+  Double_t  pxn;        ///< hit nucleon 4-momentum (LAB)
+  Double_t  pyn;
+  Double_t  pzn;
+  Double_t  En;
+  Double_t  rn;         ///< hit nucleon position (fm)
+  Double_t  xs;         ///< selected kinematics (-99999 if not set)
+  Double_t  ys;
+  Double_t  Q2s;
+  Double_t  Ws;
+  Double_t  ts;
+  Double_t  pxl;        ///< generated final state primary lepton 4-momentum (LAB)
+  Double_t  pyl;
+  Double_t  pzl;
+  Double_t  El;
+  Double_t  pxh;        ///< generated final state hadronic system 4-momentum (LAB)
+  Double_t  pyh;
+  Double_t  pzh;
+  Double_t  Eh;
+
+  // particles
+  Int_t             n;      ///< # of particles
+  vector<Int_t>     pdg;    ///< pdg code
+  vector<Int_t>     ist;    ///< status (GHepStatus_t)
+  vector<Int_t>     resc;   ///< rescattering code
+  vector<Int_t>     m1;     ///< first / last mother
+  vector<Int_t>     m2;
+  vector<Int_t>     d1;     ///< first / last daughter
+  vector<Int_t>     d2;
+  vector<Double_t>  px;     ///< 4-momentum (GeV)
+  vector<Double_t>  py;
+  vector<Double_t>  pz;
+  vector<Double_t>  E;
+  vector<Double_t>  x;      ///< 4-position (hit nucleus coordinate system, fm)
+  vector<Double_t>  y;
+  vector<Double_t>  z;
+  vector<Double_t>  t;
+  vector<Double_t>  polth;  ///< polarization polar / azimuthal angles (rad)
+  vector<Double_t>  polph;
+  vector<Double_t>  erm;    ///< removal energy (GeV)
+  vector<UChar_t>   bound;  ///< is it a bound particle?
+
+private:
+
+  void Init             (void);
+  bool Resize           (int np);
+  void ConnectEvent     (bool create);
+  void ConnectParticles (bool create);
+  void Connect          (const char * name, void * address, char type,
+                         bool array, bool create);
+
+  TTree *           fTree;      ///< connected tree
+  int               fCapacity;  ///< allocated size of the per-particle arrays
+};
+
+}      // genie namespace
+
+#endif // _NTP_MC_FLAT_RECORD_H_
@@ -9,12 +9,16 @@
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cstdio>
 #include <vector>
 #include <string>
+#include <stdint.h>
 
 #include <TROOT.h>
+#include <TFile.h>
 #include <TFolder.h>
 #include <TObjString.h>
+#include <TSystem.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/Messenger/Messenger.h"
@@ -28,6 +32,43 @@ using namespace genie;
 
 ClassImp(NtpMCJobConfig)
 
+namespace {
+  // 64-bit FNV-1a of a string (and an end-of-string marker, so that the
+  // hash of a sequence of strings depends on where each one ends)
+  void HashAdd(uint64_t & h, const char * s)
+  {
+    for( ; s && *s; s++) {
+      h ^= (unsigned char) (*s);
+      h *= 1099511628211ULL;
+    }
+    h ^= 0xff;
+    h *= 1099511628211ULL;
+  }
+  // hash of the names & contents (TObjStrings) of a folder tree, in order
+  void HashFolder(uint64_t & h, const TFolder * folder)
+  {
+    if(!folder) return;
+    HashAdd(h, folder->GetName());
+    TIter next(folder->GetListOfFolders());
+    TObject * obj = 0;
+    while( (obj = next()) ) {
+      const TFolder * sub = dynamic_cast<const TFolder *> (obj);
+      if(sub) HashFolder(h, sub);
+      else    HashAdd(h, obj->GetName());
+    }
+    HashAdd(h, "/");
+  }
+  // the value of a key of a `key:value;key:value' entry
+  string EntryValue(string entry, string key)
+  {
+    vector<string> fields = utils::str::Split(entry, ";");
+    for(unsigned int i = 0; i < fields.size(); i++) {
+      if(fields[i].find(key + ":") == 0) return fields[i].substr(key.size()+1);
+    }
+    return "";
+  }
+}
+
 //____________________________________________________________________________
 NtpMCJobConfig::NtpMCJobConfig()
 {
@@ -86,3 +127,108 @@ TFolder * NtpMCJobConfig::Load(void)
   return fConfig;
 }
 //____________________________________________________________________________
+string NtpMCJobConfig::Hash(const TFolder * config, const TFolder * env)
+{
+  uint64_t h = 14695981039346656037ULL;
+  HashFolder(h, config);
+  HashFolder(h, env);
+
+  char hex[17];
+  snprintf(hex, sizeof(hex), "%016llx", (unsigned long long) h);
+  return string(hex);
+}
+//____________________________________________________________________________
+TObjString * NtpMCJobConfig::Store(
+   TFolder * config, TFolder * env, string store)
+{
+  if(!config || !env) return 0;
+
+  string hash = NtpMCJobConfig::Hash(config, env);
+  string path = store + "/gjobmeta_" + hash + ".root";
+
+  // same content, same file: written only by the first job getting here
+  bool exists = !(gSystem->AccessPathName(path.c_str()));
+  if(!exists) {
+    TDirectory * cwd = gDirectory;
+    gSystem->mkdir(store.c_str(), true);
+
+    // written under a temporary name and renamed once complete, so that
+    // concurrent jobs and readers never see a partly written file
+    string temp = path + Form(".%d.tmp", gSystem->GetPid());
+    bool ok = false;
+    TFile * file = TFile::Open(temp.c_str(), "RECREATE");
+    if(file && !file->IsZombie()) {
+      config -> Write("gconfig");
+      env    -> Write("genv");
+      file   -> Close();
+      ok = (gSystem->Rename(temp.c_str(), path.c_str()) == 0);
+    }
+    delete file;
+    if(cwd) cwd->cd();
+
+    if(!ok) {
+      gSystem->Unlink(temp.c_str());
+      LOG("Ntp", pWARN)
+        << "Could not write the job metadata file: " << path
+        << " - The metadata will be stored in the output file";
+      return 0;
+    }
+    LOG("Ntp", pNOTICE) << "Wrote the job metadata file: " << path;
+  }
+
+  string entry = "hash:" + hash + ";file:" + path;
+  return new TObjString(entry.c_str());
+}
+//____________________________________________________________________________
+TFolder * NtpMCJobConfig::Resolve(TFile * file, string name)
+{
+  if(!file) return 0;
+
+  TFolder * folder = dynamic_cast<TFolder *> (file->Get(name.c_str()));
+  if(folder) return folder;
+
+  TObjString * pointer = dynamic_cast<TObjString *> (file->Get("gjobmeta"));
+  if(!pointer) return 0;
+
+  string entry = pointer->GetString().Data();
+  string hash  = EntryValue(entry, "hash");
+  string path  = EntryValue(entry, "file");
+  delete pointer;
+
+  // a relative store path may be relative to the output file location
+  // (if the output files were moved along with the store)
+  if(gSystem->AccessPathName(path.c_str()) && !gSystem->IsAbsoluteFileName(path.c_str())) {
+    TString dir   = gSystem->DirName(file->GetName());
+    string  local = string(dir.Data()) + "/" + path;
+    if(!gSystem->AccessPathName(local.c_str())) path = local;
+  }
+
+  TDirectory * cwd = gDirectory;
+  TFile * store = TFile::Open(path.c_str(), "READ");
+  if(!store || store->IsZombie()) {
+    LOG("Ntp", pERROR)
+      << "Could not open the job metadata file: " << path
+      << " (hash: " << hash << ") of " << file->GetName();
+    delete store;
+    if(cwd) cwd->cd();
+    return 0;
+  }
+
+  TFolder * config = dynamic_cast<TFolder *> (store->Get("gconfig"));
+  TFolder * env    = dynamic_cast<TFolder *> (store->Get("genv"));
+  if(NtpMCJobConfig::Hash(config, env) != hash) {
+    LOG("Ntp", pWARN)
+      << "The content of the job metadata file: " << path
+      << " does not match its hash: " << hash;
+  }
+  store->Close();
+  delete store;
+  if(cwd) cwd->cd();
+
+  if(name == "gconfig") { delete env;    return config; }
+  if(name == "genv"   ) { delete config; return env;    }
+  delete config;
+  delete env;
+  return 0;
+}
+//____________________________________________________________________________
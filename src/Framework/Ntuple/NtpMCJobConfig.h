@@ -6,6 +6,14 @@
 \brief   Stores the GENIE configuration in ROOT TFolders along with the
          output event tree
 
+         With a job metadata store (RunOpt --output-meta-store dir), the
+         configuration (gconfig) and environment (genv) folders are written
+         once, in a content-addressed file of the store (gjobmeta_<hash>.root,
+         shared by all the output files, and jobs, of the same configuration
+         and environment), and the output files only store the hash and the
+         path of that file (as the `gjobmeta' TObjString). Readers get the
+         folders through Resolve(), whichever way they were stored.
+
 \author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
  University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -19,7 +27,13 @@
 #ifndef _NTP_MC_JOB_CONFIG_H_
 #define _NTP_MC_JOB_CONFIG_H_
 
+#include <string>
+
+class TFile;
 class TFolder;
+class TObjString;
+
+using std::string;
 
 namespace genie {
 
@@ -33,6 +47,18 @@ public :
   TFolder * Load      (void);
   TFolder * GetFolder (void) { return fConfig; }
 
+  //! content hash (16 hex digits) of the configuration & environment folders
+  static string       Hash    (const TFolder * config, const TFolder * env);
+
+  //! write the folders in the store directory, unless already there, and
+  //! return the pointer to be written in the output files in their place
+  //! (0 if the store is not writable)
+  static TObjString * Store   (TFolder * config, TFolder * env, string store);
+
+  //! the named job metadata folder (gconfig, genv) of an output file, read
+  //! from the file itself or from the store file it points to
+  static TFolder *    Resolve (TFile * file, string name);
+
 private:
 
   TFolder * fConfig;
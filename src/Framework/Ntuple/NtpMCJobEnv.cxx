@@ -16,10 +16,14 @@
 #include <TSystem.h>
 #include <TFolder.h>
 #include <TObjString.h>
+#include <TH1D.h>
 
 #include "Framework/Conventions/EnvSnapshot.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Ntuple/NtpMCJobEnv.h"
+#include "Framework/Utils/ChannelCostStats.h"
+#include "Framework/Utils/ModuleTimingStats.h"
+#include "Framework/Utils/StartupProfile.h"
 
 using std::string;
 using std::ostringstream;
@@ -30,12 +34,17 @@ using namespace genie::controls;
 //____________________________________________________________________________
 NtpMCJobEnv::NtpMCJobEnv()
 {
-  fEnv = 0;
+  fEnv      = 0;
+  fStartup  = 0;
+  fModTime  = 0;
+  fChanCost = 0;
 }
 //____________________________________________________________________________
 NtpMCJobEnv::~NtpMCJobEnv()
 {
-
+  if (fStartup)  delete fStartup;
+  if (fModTime)  delete fModTime;
+  if (fChanCost) delete fChanCost;
 }
 //____________________________________________________________________________
 TFolder * NtpMCJobEnv::TakeSnapshot(void)
@@ -76,3 +85,103 @@ TFolder * NtpMCJobEnv::TakeSnapshot(void)
   return fEnv;
 }
 //____________________________________________________________________________
+TFolder * NtpMCJobEnv::TakeStartupProfile(void)
+{
+  if (fStartup) delete fStartup;
+
+  LOG("Ntp", pNOTICE)
+      << "Saving the start-up phase costs in a TFolder";
+
+  fStartup = new TFolder("gstartup","GENIE job start-up phases");
+  fStartup->SetOwner(true);
+
+  StartupProfile * profile = StartupProfile::Instance();
+  vector<StartupPhaseCost> phases = profile->Phases();
+  vector<StartupPhaseCost>::const_iterator iter;
+  for(iter = phases.begin(); iter != phases.end(); ++iter) {
+     ostringstream entry;
+     entry << "phase:"  << iter->name
+           << ";depth:" << iter->depth
+           << ";calls:" << iter->ncalls
+           << ";wall:"  << iter->wall
+           << ";cpu:"   << iter->cpu
+           << ";dmem:"  << iter->dmem;
+     fStartup->Add(new TObjString(entry.str().c_str()));
+  }
+  ostringstream total;
+  total << "total:"  << profile->Elapsed()
+        << ";mem:"   << StartupProfile::ResidentMemory();
+  fStartup->Add(new TObjString(total.str().c_str()));
+
+  return fStartup;
+}
+//____________________________________________________________________________
+TFolder * NtpMCJobEnv::TakeModuleTiming(void)
+{
+  if (fModTime) delete fModTime;
+
+  LOG("Ntp", pNOTICE)
+      << "Saving the event generation module timing in a TFolder";
+
+  fModTime = new TFolder("gmodtime","GENIE event generation module timing");
+  fModTime->SetOwner(true);
+
+  // one log10(time/s) histogram per thread and module, and the exact
+  // time sums (for the mean and rms) in a string
+  vector<ModuleTiming> timings = ModuleTimingStats::Instance()->Timings();
+  for(unsigned int i = 0; i < timings.size(); i++) {
+     const ModuleTiming & t = timings[i];
+     if(t.ncalls == 0) continue;
+     ostringstream name, title;
+     name  << "modtime" << i;
+     title << t.evgen << " : " << t.module << ";log10(time/s);calls";
+     TH1D * h = new TH1D(name.str().c_str(), title.str().c_str(),
+        ModuleTiming::kNBins, ModuleTiming::kLogMin, ModuleTiming::kLogMax);
+     h->SetDirectory(0);
+     for(unsigned int ib = 0; ib < t.bins.size(); ib++) {
+        h->SetBinContent(ib, t.bins[ib]);
+     }
+     h->SetEntries(t.ncalls);
+     fModTime->Add(h);
+
+     ostringstream entry;
+     entry << "evgen:"   << t.evgen
+           << ";module:" << t.module
+           << ";calls:"  << t.ncalls
+           << ";sum:"    << t.sum
+           << ";sum2:"   << t.sum2
+           << ";min:"    << t.min
+           << ";max:"    << t.max;
+     fModTime->Add(new TObjString(entry.str().c_str()));
+  }
+  return fModTime;
+}
+//____________________________________________________________________________
+TFolder * NtpMCJobEnv::TakeChannelCost(void)
+{
+  if (fChanCost) delete fChanCost;
+
+  LOG("Ntp", pNOTICE)
+      << "Saving the event generation cost per channel in a TFolder";
+
+  fChanCost = new TFolder("gchancost","GENIE event generation cost per channel");
+  fChanCost->SetOwner(true);
+
+  // one string per channel, the costliest first
+  vector<ChannelCost> costs = ChannelCostStats::Instance()->Costs();
+  for(unsigned int i = 0; i < costs.size(); i++) {
+     const ChannelCost & c = costs[i];
+     ostringstream entry;
+     entry << "channel:"   << c.channel
+           << ";evgen:"    << c.evgen
+           << ";events:"   << c.nevents
+           << ";time:"     << c.time
+           << ";time2:"    << c.time2
+           << ";max:"      << c.tmax
+           << ";kinerej:"  << c.nkinerej
+           << ";fsisteps:" << c.nfsisteps;
+     fChanCost->Add(new TObjString(entry.str().c_str()));
+  }
+  return fChanCost;
+}
+//____________________________________________________________________________
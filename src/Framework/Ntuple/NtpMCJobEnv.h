@@ -4,7 +4,10 @@
 \class   genie::NtpMCJobEnv
 
 \brief   Stores a snapshot of your environment in ROOT TFolder along with the
-         output event tree
+         output event tree. Also stores the start-up phase costs
+         (StartupProfile), the time distributions of the event generation
+         modules (ModuleTimingStats) and the event generation cost per
+         interaction channel (ChannelCostStats) in separate TFolders.
 
 \author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
  University of Liverpool & STFC Rutherford Appleton Laboratory
@@ -30,12 +33,18 @@ public :
   NtpMCJobEnv();
   virtual ~NtpMCJobEnv();
 
-  TFolder * TakeSnapshot (void);
-  TFolder * GetFolder    (void) { return fEnv; }
+  TFolder * TakeSnapshot       (void);
+  TFolder * TakeStartupProfile (void);
+  TFolder * TakeModuleTiming   (void);
+  TFolder * TakeChannelCost    (void);
+  TFolder * GetFolder          (void) { return fEnv; }
 
 private:
 
   TFolder * fEnv;
+  TFolder * fStartup;
+  TFolder * fModTime;
+  TFolder * fChanCost;
 };
 
 }      // genie namespace
@@ -57,6 +57,8 @@ void NtpMCTreeHeader::PrintToStream(ostream & stream) const
   string stune       = this->tune.GetString().Data();
   string stuneDir    = this->tuneDir.GetString().Data();
   string scustomDirs = this->customDirs.GetString().Data();
+  string sgenmode    = this->genmode.GetString().Data();
+  string sbias       = this->bias.GetString().Data();
 
   stream << "Tree Header Info:"                     << endl
          << "MC run number     -> " << this->runnu  << endl
@@ -65,6 +67,8 @@ void NtpMCTreeHeader::PrintToStream(ostream & stream) const
          << "GENIE tune name   -> " << stune        << endl
          << "tune directory    -> " << stuneDir     << endl
          << "custom directories-> " << scustomDirs  << endl
+         << "generation mode   -> " << sgenmode     << endl
+         << "channel biasing   -> " << sbias        << endl
          << "File generated at -> " << this->datime << endl;
 }
 //____________________________________________________________________________
@@ -77,6 +81,8 @@ void NtpMCTreeHeader::Copy(const NtpMCTreeHeader & hdr)
   this->tune.SetString(hdr.tune.GetString().Data());
   this->tuneDir.SetString(hdr.tuneDir.GetString().Data());
   this->customDirs.SetString(hdr.customDirs.GetString().Data());
+  this->genmode.SetString(hdr.genmode.GetString().Data());
+  this->bias.SetString(hdr.bias.GetString().Data());
 }
 //____________________________________________________________________________
 void NtpMCTreeHeader::Init(void)
@@ -106,5 +112,7 @@ void NtpMCTreeHeader::Init(void)
   this->tune.SetString(tunename.c_str());
   this->tuneDir.SetString(tuneDir.c_str());
   this->customDirs.SetString(customDirs.c_str());
+  this->genmode.SetString("standard");
+  this->bias.SetString("");
 }
 //____________________________________________________________________________
@@ -60,8 +60,10 @@ public :
   TObjString    tune;       ///< GENIE Tune Name
   TObjString    tuneDir;    ///< directory from when tune config came
   TObjString    customDirs; ///< any custom directories
+  TObjString    genmode;    ///< event generation mode, for the sample normalisation ("standard" or "forced-interactions": weights are interaction probabilities)
+  TObjString    bias;       ///< channel biasing rules, compensated by the event weights ("": none)
 
-  ClassDef(NtpMCTreeHeader, 3)
+  ClassDef(NtpMCTreeHeader, 4)
 };
 
 }      // genie namespace
@@ -0,0 +1,367 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <algorithm>
+
+#include <RVersion.h>
+#include <TROOT.h>
+#include <TChain.h>
+#include <TObjArray.h>
+#include <TMath.h>
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpReader.h"
+#include "Framework/Ntuple/NtpReaderQueue.h"
+#include "Framework/Ntuple/NtpMCEventRecord.h"
+#include "Framework/Ntuple/NtpMCFlatRecord.h"
+#include "Framework/Ntuple/NtpMCEventIndex.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+NtpReader::NtpReader() :
+fEventChain(new TChain("gtree")),
+fIndexChain(new TChain(NtpMCEventIndex::TreeName())),
+fNtpFormat(kNFUndefined),
+fNtpMCEventRecord(0),
+fNtpMCFlatRecord(0),
+fFlatEvent(0),
+fIndex(new NtpMCEventIndex),
+fHasIndex(false),
+fNEvents(0),
+fLoadedEntry(-1),
+fLoadedEvent(-1),
+fNext(0),
+fCacheSize(30000000),
+fPrefetchDepth(0),
+fQueue(0),
+fQueueEvent(-1),
+fQueueRecord(0),
+fQueueResume(0)
+{
+
+}
+//____________________________________________________________________________
+NtpReader::~NtpReader()
+{
+  this->StopPrefetch();
+  this->Reset();
+  delete fEventChain;
+  delete fIndexChain;
+  delete fIndex;
+}
+//____________________________________________________________________________
+void NtpReader::Reset(void)
+{
+  if(fEventChain) fEventChain->ResetBranchAddresses();
+  if(fIndexChain) fIndexChain->ResetBranchAddresses();
+
+  if(fNtpMCEventRecord) delete fNtpMCEventRecord;
+  if(fNtpMCFlatRecord)  delete fNtpMCFlatRecord;
+  if(fFlatEvent)        delete fFlatEvent;
+  fNtpMCEventRecord = 0;
+  fNtpMCFlatRecord  = 0;
+  fFlatEvent        = 0;
+
+  fNtpFormat   = kNFUndefined;
+  fHasIndex    = false;
+  fNEvents     = 0;
+  fLoadedEntry = -1;
+  fLoadedEvent = -1;
+  fNext        = 0;
+  fOffsets.clear();
+  fFileNames.clear();
+}
+//____________________________________________________________________________
+int NtpReader::AddFiles(string filenames)
+{
+  int nfiles = fEventChain->Add(filenames.c_str());
+  fIndexChain->Add(filenames.c_str());
+
+  LOG("Ntp", pNOTICE)
+     << "Added " << nfiles << " input file(s) matching: " << filenames;
+  return nfiles;
+}
+//____________________________________________________________________________
+bool NtpReader::Initialize(void)
+{
+  this->StopPrefetch();
+  this->Reset();
+
+  fNEvents = fEventChain->GetEntries();
+  if(fNEvents <= 0) {
+    LOG("Ntp", pERROR) << "No events in the input event trees";
+    return false;
+  }
+
+  //-- the first global event of each file & their names
+  int ntrees = fEventChain->GetNtrees();
+  Long64_t * offsets = fEventChain->GetTreeOffset();
+  TObjArray * files = fEventChain->GetListOfFiles();
+  for(int itree = 0; itree < ntrees; itree++) {
+    fOffsets.push_back(offsets[itree]);
+    fFileNames.push_back(files->At(itree)->GetTitle());
+  }
+
+  //-- connect to the event records
+  if(fEventChain->GetBranch("gmcrec")) {
+    fNtpFormat = kNFGHEP;
+    fEventChain->SetBranchAddress("gmcrec", &fNtpMCEventRecord);
+  }
+  else
+  if(fEventChain->GetBranch("iev") && fEventChain->GetBranch("n")) {
+    fNtpFormat       = kNFFlat;
+    fNtpMCFlatRecord = new NtpMCFlatRecord;
+    fFlatEvent       = new EventRecord;
+    fNtpMCFlatRecord->SetBranchAddresses(fEventChain);
+  }
+  else {
+    LOG("Ntp", pERROR) << "Unknown input event tree format";
+    return false;
+  }
+  if(fCacheSize > 0) fEventChain->SetCacheSize(fCacheSize);
+
+  //-- and to the event index, if every file has one
+  fHasIndex = this->ConnectIndex();
+
+  LOG("Ntp", pNOTICE)
+     << "Reading " << fNEvents << " events "
+     << NtpMCFormat::AsString(fNtpFormat) << " from " << ntrees << " file(s)"
+     << (fHasIndex ? ", with an event index" : "");
+  return true;
+}
+//____________________________________________________________________________
+bool NtpReader::ConnectIndex(void)
+{
+// The index entries must match the event entries file by file
+
+  if(fIndexChain->GetEntries() != fNEvents) return false;
+  if(fIndexChain->GetNtrees()  != fEventChain->GetNtrees()) return false;
+
+  Long64_t * offsets = fIndexChain->GetTreeOffset();
+  for(unsigned int itree = 0; itree < fOffsets.size(); itree++) {
+    if(offsets[itree] != fOffsets[itree]) return false;
+  }
+  return fIndex->SetBranchAddresses(fIndexChain);
+}
+//____________________________________________________________________________
+int NtpReader::FileIndex(Long64_t ievent) const
+{
+  if(ievent < 0 || ievent >= fNEvents || fOffsets.empty()) return -1;
+  vector<Long64_t>::const_iterator it =
+      std::upper_bound(fOffsets.begin(), fOffsets.end(), ievent);
+  return (it - fOffsets.begin()) - 1;
+}
+//____________________________________________________________________________
+string NtpReader::FileName(Long64_t ievent) const
+{
+  int ifile = this->FileIndex(ievent);
+  return (ifile < 0) ? "" : fFileNames[ifile];
+}
+//____________________________________________________________________________
+Long64_t NtpReader::LocalEntry(Long64_t ievent) const
+{
+  int ifile = this->FileIndex(ievent);
+  return (ifile < 0) ? -1 : ievent - fOffsets[ifile];
+}
+//____________________________________________________________________________
+bool NtpReader::LoadEntry(Long64_t ievent)
+{
+  if(ievent < 0 || ievent >= fNEvents) return false;
+  if(ievent == fLoadedEntry) return true;
+
+  if(fNtpFormat == kNFGHEP) {
+    // the event record is re-created by the streamer
+    if(fNtpMCEventRecord) fNtpMCEventRecord->Clear();
+    if(fEventChain->GetEntry(ievent) <= 0) return false;
+  }
+  else
+  if(fNtpFormat == kNFFlat) {
+    if(fNtpMCFlatRecord->GetEntry(ievent) <= 0) return false;
+  }
+  else return false;
+
+  fLoadedEntry = ievent;
+  return true;
+}
+//____________________________________________________________________________
+const EventRecord * NtpReader::ReadEvent(Long64_t ievent)
+{
+  if(!this->LoadEntry(ievent)) return 0;
+
+  if(fNtpFormat == kNFGHEP) return fNtpMCEventRecord->event;
+
+  if(fLoadedEvent != ievent) {
+    fNtpMCFlatRecord->FillEventRecord(*fFlatEvent);
+    fLoadedEvent = ievent;
+  }
+  return fFlatEvent;
+}
+//____________________________________________________________________________
+const EventRecord * NtpReader::Event(Long64_t ievent)
+{
+  if(fQueue) {
+    if(ievent == fQueueEvent) return fQueueRecord;
+    this->StopPrefetch();
+  }
+  return this->ReadEvent(ievent);
+}
+//____________________________________________________________________________
+const NtpMCFlatRecord * NtpReader::Columns(Long64_t ievent)
+{
+  if(fNtpFormat != kNFFlat) {
+    LOG("Ntp", pERROR) << "No flat columns in a GHEP event tree";
+    return 0;
+  }
+  this->StopPrefetch();
+  if(!this->LoadEntry(ievent)) return 0;
+  return fNtpMCFlatRecord;
+}
+//____________________________________________________________________________
+int NtpReader::EventNumber(Long64_t ievent)
+{
+  this->StopPrefetch();
+  if(!this->LoadEntry(ievent)) return -1;
+
+  return (fNtpFormat == kNFGHEP) ?
+     fNtpMCEventRecord->hdr.ievent : fNtpMCFlatRecord->iev;
+}
+//____________________________________________________________________________
+void NtpReader::SetFilter(Filter_t filter)
+{
+  this->StopPrefetch();
+  fFilter = filter;
+}
+//____________________________________________________________________________
+bool NtpReader::Accept(Long64_t ievent)
+{
+  if(ievent < 0 || ievent >= fNEvents) return false;
+  if(!fFilter) return true;
+
+  if(fQueue) this->StopPrefetch();
+
+  if(fHasIndex) {
+    if(fIndexChain->GetEntry(ievent) <= 0) return false;
+  } else {
+    // no index: compute its columns from the event itself
+    const EventRecord * event = this->ReadEvent(ievent);
+    if(!event) return false;
+    int iev = (fNtpFormat == kNFGHEP) ?
+       fNtpMCEventRecord->hdr.ievent : fNtpMCFlatRecord->iev;
+    fIndex->Fill(iev, event);
+  }
+  return fFilter(*fIndex);
+}
+//____________________________________________________________________________
+Long64_t NtpReader::NextAccepted(void)
+{
+  while(fNext < fNEvents) {
+    Long64_t ievent = fNext++;
+    bool accept = true;
+    if(fFilter) {
+      if(fHasIndex) {
+        accept = (fIndexChain->GetEntry(ievent) > 0) && fFilter(*fIndex);
+      } else {
+        const EventRecord * event = this->ReadEvent(ievent);
+        if(event) {
+          int iev = (fNtpFormat == kNFGHEP) ?
+             fNtpMCEventRecord->hdr.ievent : fNtpMCFlatRecord->iev;
+          fIndex->Fill(iev, event);
+        }
+        accept = event && fFilter(*fIndex);
+      }
+    }
+    if(accept) return ievent;
+  }
+  return -1;
+}
+//____________________________________________________________________________
+Long64_t NtpReader::Next(void)
+{
+  if(fPrefetchDepth > 0 && !fQueue && fNext < fNEvents) this->StartPrefetch();
+
+  if(fQueue) {
+    fQueueEvent  = fQueue->Pop(&fQueueRecord);
+    fQueueResume = (fQueueEvent >= 0) ? fQueueEvent + 1 : fNEvents;
+    if(fQueueEvent >= 0) return fQueueEvent;
+    this->StopPrefetch();
+    return -1;
+  }
+  return this->NextAccepted();
+}
+//____________________________________________________________________________
+void NtpReader::Rewind(void)
+{
+  this->StopPrefetch();
+  fNext = 0;
+}
+//____________________________________________________________________________
+Long64_t NtpReader::ReadNext(EventRecord & event)
+{
+// Runs on the prefetch thread
+
+  Long64_t ievent = this->NextAccepted();
+  if(ievent < 0) return -1;
+
+  const EventRecord * input = this->ReadEvent(ievent);
+  if(!input) return -1;
+  event.Copy(*input);
+  return ievent;
+}
+//____________________________________________________________________________
+void NtpReader::SetPrefetch(int depth)
+{
+  this->StopPrefetch();
+  fPrefetchDepth = TMath::Max(0, depth);
+
+#if ROOT_VERSION_CODE < ROOT_VERSION(6,6,0)
+  if(fPrefetchDepth > 0) {
+    LOG("Ntp", pWARN)
+      << "Prefetching events needs ROOT >= 6.06 - Reading synchronously";
+    fPrefetchDepth = 0;
+  }
+#else
+  if(fPrefetchDepth > 0) ROOT::EnableThreadSafety();
+#endif
+}
+//____________________________________________________________________________
+void NtpReader::StartPrefetch(void)
+{
+  LOG("Ntp", pINFO)
+     << "Prefetching events through a queue of depth " << fPrefetchDepth;
+
+  fQueueResume = fNext;
+  fQueue = new NtpReaderQueue(fPrefetchDepth,
+      [this] (EventRecord & event) { return this->ReadNext(event); });
+}
+//____________________________________________________________________________
+void NtpReader::StopPrefetch(void)
+{
+  if(!fQueue) return;
+
+  fQueue->Stop();
+  delete fQueue;
+  fQueue = 0;
+
+  // events read ahead, but not taken, are read again by the next Next() calls
+  fNext        = fQueueResume;
+  fQueueEvent  = -1;
+  fQueueRecord = 0;
+  fLoadedEntry = -1;
+  fLoadedEvent = -1;
+}
+//____________________________________________________________________________
+void NtpReader::SetCacheSize(Long64_t bytes)
+{
+  fCacheSize = TMath::Max(0LL, bytes);
+  if(fNtpFormat != kNFUndefined) fEventChain->SetCacheSize(fCacheSize);
+}
+//____________________________________________________________________________
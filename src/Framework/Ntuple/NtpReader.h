@@ -0,0 +1,166 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::NtpReader
+
+\brief   A utility class to read GENIE MC event trees: the counterpart of
+         NtpWriter.
+
+         Reads GHEP (kNFGHEP) or flat (kNFFlat) event trees from any number
+         of files (wildcards accepted) as one sample, with:
+         - random access by global event number across the files (Event()),
+           and the file / entry each event came from (FileName(),
+           LocalEntry()),
+         - sequential iteration over the events passing a filter (Next()).
+           The filter acts on the NtpMCEventIndex columns: if the files have
+           an event index tree (written by NtpWriter) the filter is applied
+           on the index alone, and only accepted events are read. Otherwise
+           the index columns are computed from each event,
+         - reading the next accepted events ahead on a background thread
+           (SetPrefetch()) and a tree cache (SetCacheSize()),
+         - direct access to the columns of the flat format, without building
+           GHEP event records (Columns()).
+
+         Example:
+         \code
+           NtpReader reader;
+           reader.AddFiles("/data/gntp.*.ghep.root");
+           reader.Initialize();
+           reader.SetFilter([](const NtpMCEventIndex & idx)
+                                { return idx.probe == 14; });
+           Long64_t iev = -1;
+           while ( (iev = reader.Next()) >= 0 ) {
+             const EventRecord * event = reader.Event(iev);
+             ...
+           }
+         \endcode
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_READER_H_
+#define _NTP_READER_H_
+
+#include <string>
+#include <vector>
+#include <functional>
+
+#include "Framework/Ntuple/NtpMCFormat.h"
+
+class TChain;
+
+using std::string;
+using std::vector;
+
+namespace genie {
+
+class EventRecord;
+class NtpMCEventRecord;
+class NtpMCFlatRecord;
+class NtpMCEventIndex;
+class NtpReaderQueue;
+
+class NtpReader {
+
+public :
+  typedef std::function<bool (const NtpMCEventIndex &)> Filter_t;
+
+  NtpReader();
+ ~NtpReader();
+
+  ///< add input files (wildcards accepted), before Initialize().
+  ///< Returns the number of files added.
+  int  AddFiles (string filenames);
+
+  ///< connect to the event (and index) trees of the input files
+  bool Initialize (void);
+
+  ///< the number of events in all input files
+  Long64_t NEvents (void) const { return fNEvents; }
+
+  ///< the input event tree format
+  NtpMCFormat_t Format (void) const { return fNtpFormat; }
+
+  ///< the GHEP event record of a given (global) event, built from the flat
+  ///< columns for kNFFlat trees. Valid until the next event is read.
+  const EventRecord * Event (Long64_t ievent);
+
+  ///< the columns of a given (global) event of a kNFFlat tree, as read
+  ///< (no GHEP event record is built). Valid until the next event is read.
+  const NtpMCFlatRecord * Columns (Long64_t ievent);
+
+  ///< the number of the event in the tree it was written in
+  int  EventNumber (Long64_t ievent);
+
+  ///< the file holding a given (global) event and its entry in that file
+  string   FileName   (Long64_t ievent) const;
+  Long64_t LocalEntry (Long64_t ievent) const;
+
+  ///< iterate over the events passing the filter (all events if none is
+  ///< set). Next() returns the next accepted (global) event, or -1 at the end.
+  void     SetFilter (Filter_t filter);
+  bool     Accept    (Long64_t ievent);
+  Long64_t Next      (void);
+  void     Rewind    (void);
+
+  ///< is the filter applied on the event index trees of the input files?
+  bool HasIndex (void) const { return fHasIndex; }
+
+  ///< read the events iterated with Next() ahead on a background thread,
+  ///< through a queue of the input depth (0: no prefetching, the default).
+  ///< Random access with Event() to events other than the one returned
+  ///< last by Next() stops the prefetching until the next Next() call.
+  void SetPrefetch (int depth);
+
+  ///< size of the input tree cache (bytes, 0: no cache)
+  void SetCacheSize (Long64_t bytes);
+
+  ///< the input trees
+  TChain * EventChain (void) const { return fEventChain; }
+  TChain * IndexChain (void) const { return fHasIndex ? fIndexChain : 0; }
+
+private:
+
+  void                Reset          (void);
+  bool                ConnectIndex   (void);
+  const EventRecord * ReadEvent      (Long64_t ievent);
+  bool                LoadEntry      (Long64_t ievent);
+  Long64_t            NextAccepted   (void);
+  Long64_t            ReadNext       (EventRecord & event);
+  void                StartPrefetch  (void);
+  void                StopPrefetch   (void);
+  int                 FileIndex      (Long64_t ievent) const;
+
+  TChain *            fEventChain;       ///< the input event trees
+  TChain *            fIndexChain;       ///< the input index trees
+  NtpMCFormat_t       fNtpFormat;        ///< input event tree format
+  NtpMCEventRecord *  fNtpMCEventRecord; ///< GHEP (kNFGHEP) input record
+  NtpMCFlatRecord *   fNtpMCFlatRecord;  ///< flat (kNFFlat) input record
+  EventRecord *       fFlatEvent;        ///< event built from the flat columns
+  NtpMCEventIndex *   fIndex;            ///< index columns of the current event
+  bool                fHasIndex;         ///< are there index trees for all files?
+  Filter_t            fFilter;           ///< event filter
+  Long64_t            fNEvents;          ///< number of input events
+  vector<Long64_t>    fOffsets;          ///< first global event of each file
+  vector<string>      fFileNames;        ///< input files
+  Long64_t            fLoadedEntry;      ///< entry in the input record(s)
+  Long64_t            fLoadedEvent;      ///< entry in fFlatEvent
+  Long64_t            fNext;             ///< next event to be considered by Next()
+  Long64_t            fCacheSize;        ///< tree cache size
+  int                 fPrefetchDepth;    ///< prefetch queue depth
+  NtpReaderQueue *    fQueue;            ///< prefetch queue (0 if not prefetching)
+  Long64_t            fQueueEvent;       ///< event last taken from the queue
+  const EventRecord * fQueueRecord;      ///< and its record
+  Long64_t            fQueueResume;      ///< next event to be considered once prefetching stops
+};
+
+}      // genie namespace
+
+#endif // _NTP_READER_H_
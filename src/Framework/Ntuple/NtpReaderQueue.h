@@ -0,0 +1,161 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::NtpReaderQueue
+
+\brief    A background reader (prefetcher) for NtpReader.
+
+          A reader thread reads the next events ahead of the consumer (tree
+          reading: decompression & de-serialisation), copies each into a free
+          slot of a fixed pool of event records (re-using its memory) and
+          queues it. The consumer takes the queued events in order; the
+          event taken last stays valid until the next one is taken, when its
+          slot is handed back to the reader thread.
+
+          The reader function runs on the reader thread, so it must only use
+          objects (the input trees & records) that nothing else touches while
+          the queue is running. It returns the number of the event it read,
+          or a negative value when there are no more events.
+
+          Header only, to be used within the NtpReader implementation file
+          (not part of the ROOT dictionary).
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_READER_QUEUE_H_
+#define _NTP_READER_QUEUE_H_
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+#include "Framework/EventGen/EventRecord.h"
+
+namespace genie {
+
+class NtpReaderQueue {
+
+public:
+  typedef std::function<Long64_t (EventRecord &)> Reader_t;
+
+  NtpReaderQueue(int depth, Reader_t reader) :
+    fReader     (reader),
+    fSlots      (depth > 0 ? depth : 1, (EventRecord *) 0),
+    fReadySlot  (fSlots.size(), 0),
+    fReadyEvent (fSlots.size(), 0),
+    fHead       (0),
+    fCount      (0),
+    fCurrent    (-1),
+    fEnd        (false),
+    fStop       (false)
+  {
+    for (unsigned int islot = 0; islot < fSlots.size(); ++islot) {
+      fSlots[islot] = new EventRecord;
+      fFree.push_back(islot);
+    }
+    fThread = std::thread(&NtpReaderQueue::Run, this);
+  }
+ ~NtpReaderQueue()
+  {
+    this->Stop();
+    for (unsigned int islot = 0; islot < fSlots.size(); ++islot) {
+      delete fSlots[islot];
+    }
+  }
+
+  int Depth(void) const { return fSlots.size(); }
+
+  //! Take the next queued event (waits until it is read). Returns its event
+  //! number, or a negative value once all events were taken. The event
+  //! stays valid until the next call.
+  Long64_t Pop(const EventRecord ** event)
+  {
+    std::unique_lock<std::mutex> lock(fMutex);
+    if ( fCurrent >= 0 ) {
+      fFree.push_back(fCurrent);
+      fCurrent = -1;
+      fCond.notify_all();
+    }
+    fCond.wait(lock, [this]{ return fCount > 0 || fEnd; });
+    if ( fCount == 0 ) {
+      *event = 0;
+      return -1;
+    }
+    unsigned int islot  = fReadySlot  [fHead];
+    Long64_t     ievent = fReadyEvent [fHead];
+    fHead = (fHead + 1) % fSlots.size();
+    fCount--;
+    fCurrent = islot;
+    *event   = fSlots[islot];
+    return ievent;
+  }
+
+  //! Stop the reader thread (events read ahead are dropped)
+  void Stop(void)
+  {
+    {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fStop = true;
+    }
+    fCond.notify_all();
+    if ( fThread.joinable() ) fThread.join();
+  }
+
+private:
+
+  void Run(void)
+  {
+    while ( true ) {
+      std::unique_lock<std::mutex> lock(fMutex);
+      fCond.wait(lock, [this]{ return fStop || ! fFree.empty(); });
+      if ( fStop ) return;
+      unsigned int islot = fFree.back();
+      fFree.pop_back();
+      lock.unlock();
+
+      // read outside the lock, so that the consumer can go on meanwhile
+      Long64_t ievent = fReader(*fSlots[islot]);
+
+      lock.lock();
+      if ( ievent < 0 ) {
+        fFree.push_back(islot);
+        fEnd = true;
+        fCond.notify_all();
+        return;
+      }
+      unsigned int iready = (fHead + fCount) % fSlots.size();
+      fReadySlot  [iready] = islot;
+      fReadyEvent [iready] = ievent;
+      fCount++;
+      fCond.notify_all();
+    }
+  }
+
+  Reader_t                   fReader;      ///< reads the next event in
+  std::vector<EventRecord *> fSlots;       ///< pool of event records
+  std::vector<unsigned int>  fFree;        ///< free slots
+  std::vector<unsigned int>  fReadySlot;   ///< ring of queued slots
+  std::vector<Long64_t>      fReadyEvent;  ///< and their event numbers
+  unsigned int               fHead;        ///< next queued slot to be taken
+  unsigned int               fCount;       ///< number of queued slots
+  int                        fCurrent;     ///< slot taken last (-1: none)
+  bool                       fEnd;         ///< no more events to read
+  bool                       fStop;        ///< reader asked to stop
+  std::thread                fThread;      ///< reader thread
+  std::mutex                 fMutex;
+  std::condition_variable    fCond;
+};
+
+} // genie namespace
+
+#endif // _NTP_READER_QUEUE_H_
@@ -10,19 +10,32 @@
 
 #include <cassert>
 #include <sstream>
+#include <utility>
 
 #include <TFile.h>
 #include <TTree.h>
 #include <TClonesArray.h>
 #include <TFolder.h>
+#include <TObjArray.h>
+#include <TObjString.h>
+#include <TROOT.h>
 
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Ntuple/NtpWriter.h"
+#include "Framework/Ntuple/NtpWriterQueue.h"
 #include "Framework/Ntuple/NtpMCEventRecord.h"
+#include "Framework/Ntuple/NtpMCCompactEventRecord.h"
+#include "Framework/Ntuple/NtpMCFlatRecord.h"
+#include "Framework/Ntuple/NtpMCEventIndex.h"
+#include "Framework/Ntuple/NtpMCEventCost.h"
 #include "Framework/Ntuple/NtpMCTreeHeader.h"
 #include "Framework/Ntuple/NtpMCJobConfig.h"
 #include "Framework/Ntuple/NtpMCJobEnv.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/ChannelCostStats.h"
+#include "Framework/Utils/EventGenCost.h"
+#include "Framework/Utils/JobTelemetry.h"
 #include "Framework/Utils/RunOpt.h"
 
 #include "RVersion.h"
@@ -39,7 +52,17 @@ fOutFile(0),
 fOutTree(0),
 fEventBranch(0),
 fNtpMCEventRecord(0),
-fNtpMCTreeHeader(0)
+fNtpMCFlatRecord(0),
+fNtpMCTreeHeader(0),
+fCompactGHEP(RunOpt::Instance()->CompactGHEP()),
+fWriteIndex(RunOpt::Instance()->OutputIndex()),
+fIndex(0),
+fIndexTree(0),
+fWriteCost(RunOpt::Instance()->OutputCost()),
+fEventCost(0),
+fQueueDepth(RunOpt::Instance()->OutputQueueDepth()),
+fQueue(0),
+fNOwnBranches(0)
 {
   LOG("Ntp", pNOTICE) << "Run number: " << runnu;
   LOG("Ntp", pNOTICE)
@@ -50,11 +73,29 @@ fNtpMCTreeHeader(0)
 //____________________________________________________________________________
 NtpWriter::~NtpWriter()
 {
-
+  this->StopQueue();
+  if(fNtpMCEventRecord) delete fNtpMCEventRecord;
+  if(fNtpMCFlatRecord)  delete fNtpMCFlatRecord;
+  if(fIndex)            delete fIndex;
+  if(fEventCost)        delete fEventCost;
 }
 //____________________________________________________________________________
 void NtpWriter::AddEventRecord(int ievent, const EventRecord * ev_rec)
 {
+  this->AddEventRecord(ievent, ev_rec, 0);
+}
+//____________________________________________________________________________
+void NtpWriter::AddEventRecord(int ievent, EventRecord && ev_rec)
+{
+  this->AddEventRecord(ievent, &ev_rec, &ev_rec);
+}
+//____________________________________________________________________________
+void NtpWriter::AddEventRecord(
+   int ievent, const EventRecord * ev_rec, EventRecord * ev_move)
+{
+// Adds the input event to the output tree (or queue). If ev_move is set
+// (the input event itself) its contents may be moved rather than copied.
+
   LOG("Ntp", pINFO) << "Adding event " << ievent << " to output tree";
 
   if(!ev_rec) {
@@ -66,13 +107,58 @@ void NtpWriter::AddEventRecord(int ievent, const EventRecord * ev_rec)
     return;
   }
 
+  // the generation cost is the one accumulated on this (generation) thread
+  // since its previous event
+  NtpMCEventCost   event_cost;
+  NtpMCEventCost * cost = 0;
+  if(fEventCost) {
+    event_cost.Fill(EventGenCost::Current());
+    cost = &event_cost;
+  }
+  JobTelemetry * telemetry = JobTelemetry::Instance();
+  telemetry->AddEvent(EventGenCost::Current());
+  ChannelCostStats::Instance()->Add(EventGenCost::Current());
+  EventGenCost::Current().Reset();
+
+  if(fQueue) {
+    if(fOutTree->GetListOfBranches()->GetEntriesFast() != fNOwnBranches) {
+      LOG("Ntp", pWARN)
+        << "Branches were added to the output tree: Their contents would be "
+        << "read by the writer thread after they moved on to later events. "
+        << "Switching to synchronous writing";
+      this->StopQueue();
+    } else {
+      if(ev_move) fQueue->Push(ievent, std::move(*ev_move), cost);
+      else        fQueue->Push(ievent, *ev_rec, cost);
+      telemetry->SetOutputQueue(fQueue->NQueued(), fQueue->Depth());
+      return;
+    }
+  }
+
+  this->WriteEventRecord(ievent, ev_rec, cost);
+}
+//____________________________________________________________________________
+void NtpWriter::WriteEventRecord(
+   int ievent, const EventRecord * ev_rec, const NtpMCEventCost * cost)
+{
+// Fills the event branch(es) & the tree, on the generation thread or (if
+// the output is queued) on the writer thread. The single record object
+// is re-used for all events.
+
+  if(fEventCost && cost) fEventCost->Copy(*cost);
+
   switch (fNtpFormat) {
      case kNFGHEP:
-          fNtpMCEventRecord = new NtpMCEventRecord();
           fNtpMCEventRecord->Fill(ievent, ev_rec);
           fOutTree->Fill();
-          delete fNtpMCEventRecord;
-          fNtpMCEventRecord = 0;
+          if(fIndexTree) {
+            fIndex->Fill(ievent, ev_rec);
+            fIndexTree->Fill();
+          }
+          break;
+     case kNFFlat:
+          fNtpMCFlatRecord->Fill(ievent, ev_rec);
+          fOutTree->Fill();
           break;
      default:
         break;
@@ -88,6 +174,14 @@ void NtpWriter::Initialize()
 
   //-- create the event branch
   this->CreateEventBranch();
+  if(fWriteCost) this->CreateCostBranch();
+  utils::app_init::OutputTree(fOutTree);
+
+  //-- create the event index tree
+  if(fWriteIndex && fNtpFormat == kNFGHEP) {
+    this->CreateIndexTree();
+    utils::app_init::OutputTree(fIndexTree);
+  }
 
   //-- create the tree header
   this->CreateTreeHeader();
@@ -112,16 +206,75 @@ void NtpWriter::Initialize()
   fNtpMCTreeHeader->tuneDir.SetString(tuneDir.c_str());
   fNtpMCTreeHeader->customDirs.SetString(customDirs.c_str());
 
+  //-- record the generation options relevant to the sample normalisation
+  RunOpt * runopt = RunOpt::Instance();
+  fNtpMCTreeHeader->genmode.SetString(
+     (runopt->ForceInteractions()) ? "forced-interactions" : "standard");
+  fNtpMCTreeHeader->bias.SetString(runopt->ChannelBiasing().c_str());
+
   //-- write the tree header
   fNtpMCTreeHeader->Write();
 
-  //-- save GENIE configuration for this MC Job
+  //-- save GENIE configuration for this MC Job and a snapshot of the
+  //   user's environment, or a pointer to them in the job metadata store
   NtpMCJobConfig configuration;
-  configuration.Load()->Write();
+  NtpMCJobEnv    environment;
+  TFolder * config = configuration.Load();
+  TFolder * env    = environment.TakeSnapshot();
+
+  string store = runopt->OutputMetaStore();
+  TObjString * jobmeta = (store.size() > 0) ?
+     NtpMCJobConfig::Store(config, env, store) : 0;
+  if(jobmeta) {
+    jobmeta->Write("gjobmeta");
+    delete jobmeta;
+  } else {
+    config->Write();
+    env->Write();
+  }
+
+  //-- start the background writer, if requested
+  fNOwnBranches = fOutTree->GetListOfBranches()->GetEntriesFast();
+  if(fQueueDepth > 0) this->StartQueue();
+}
+//____________________________________________________________________________
+void NtpWriter::StartQueue(void)
+{
+  this->StopQueue();
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,6,0)
+  ROOT::EnableThreadSafety();
+  fQueue = new NtpWriterQueue(fQueueDepth,
+     [this](int ievent, const EventRecord * ev_rec,
+            const NtpMCEventCost * cost) {
+        this->WriteEventRecord(ievent, ev_rec, cost);
+     });
+  LOG("Ntp", pNOTICE)
+    << "Writing events on a background thread (queue depth: "
+    << fQueue->Depth() << ")";
+#else
+  LOG("Ntp", pWARN)
+    << "Writing events on a background thread needs ROOT >= 6.06. "
+    << "Writing synchronously";
+#endif
+}
+//____________________________________________________________________________
+void NtpWriter::StopQueue(void)
+{
+// Writes out all queued events and stops the writer thread
 
-  //-- take a snapshot of the user's environment
-  NtpMCJobEnv environment;
-  environment.TakeSnapshot()->Write();
+  if(fQueue) {
+    fQueue->Stop();
+    delete fQueue;
+    fQueue = 0;
+    JobTelemetry::Instance()->SetOutputQueue(0, 0);
+  }
+}
+//____________________________________________________________________________
+TTree * NtpWriter::EventTree(void)
+{
+  if(fQueue) fQueue->Flush();
+  return fOutTree;
 }
 //____________________________________________________________________________
 void NtpWriter::CustomizeFilename(string filename)
@@ -155,6 +308,7 @@ void NtpWriter::OpenFile(string filename)
   // use "TFile::Open()" instead of "new TFile()" so that it can handle
   // alternative URLs (e.g. xrootd, etc)
   fOutFile = TFile::Open(filename.c_str(),"RECREATE");
+  utils::app_init::OutputFile(fOutFile);
 }
 //____________________________________________________________________________
 void NtpWriter::CreateTree(void)
@@ -168,7 +322,6 @@ void NtpWriter::CreateTree(void)
               << ", Format: " << NtpMCFormat::AsString(fNtpFormat);
 
   fOutTree = new TTree("gtree",title.str().c_str());
-  fOutTree->SetAutoSave(200000000);  // autosave when 0.2 Gbyte written
 }
 //____________________________________________________________________________
 void NtpWriter::CreateEventBranch(void)
@@ -177,6 +330,9 @@ void NtpWriter::CreateEventBranch(void)
      case kNFGHEP:
         this->CreateGHEPEventBranch();
         break;
+     case kNFFlat:
+        this->CreateFlatEventBranch();
+        break;
      default:
         LOG("Ntp", pERROR)
            << "Unknown TTree format. Can not create TBranches";
@@ -188,9 +344,14 @@ void NtpWriter::CreateEventBranch(void)
 //____________________________________________________________________________
 void NtpWriter::CreateGHEPEventBranch(void)
 {
-  LOG("Ntp", pINFO) << "Creating a NtpMCEventRecord TBranch";
+  const char * record_class = (fCompactGHEP) ?
+     "genie::NtpMCCompactEventRecord" : "genie::NtpMCEventRecord";
 
-  fNtpMCEventRecord = 0;
+  LOG("Ntp", pINFO) << "Creating a " << record_class << " TBranch";
+
+  if(fNtpMCEventRecord) delete fNtpMCEventRecord;
+  if(fCompactGHEP) fNtpMCEventRecord = new NtpMCCompactEventRecord;
+  else             fNtpMCEventRecord = new NtpMCEventRecord;
   TTree::SetBranchStyle(1);
 
 #if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
@@ -200,12 +361,47 @@ void NtpWriter::CreateGHEPEventBranch(void)
 #endif
 
   fEventBranch = fOutTree->Branch("gmcrec",
-      "genie::NtpMCEventRecord", &fNtpMCEventRecord, 32000, split);
+      record_class, &fNtpMCEventRecord,
+      RunOpt::Instance()->OutputBasketSize(), split);
   // was split=1 ... but, at least w/ ROOT 6.06/04, this generates
   //   Warning in <TTree::Bronch>: genie::NtpMCEventRecord cannot be split, resetting splitlevel to 0
   // which the art framework turns into a fatal error
 }
 //____________________________________________________________________________
+void NtpWriter::CreateFlatEventBranch(void)
+{
+  LOG("Ntp", pINFO) << "Creating the NtpMCFlatRecord TBranches";
+
+  if(fNtpMCFlatRecord) delete fNtpMCFlatRecord;
+
+  fNtpMCFlatRecord = new NtpMCFlatRecord;
+  fNtpMCFlatRecord->CreateBranches(fOutTree);
+
+  fEventBranch = fOutTree->GetBranch("iev");
+}
+//____________________________________________________________________________
+void NtpWriter::CreateCostBranch(void)
+{
+  LOG("Ntp", pINFO) << "Creating the NtpMCEventCost branch";
+
+  if(fEventCost) delete fEventCost;
+
+  fEventCost = new NtpMCEventCost;
+  TBranch * branch = fOutTree->Branch("gcost",
+     "genie::NtpMCEventCost", &fEventCost, 32000, 1);
+  branch->SetAutoDelete(kFALSE);
+}
+//____________________________________________________________________________
+void NtpWriter::CreateIndexTree(void)
+{
+  LOG("Ntp", pINFO) << "Creating the NtpMCEventIndex tree";
+
+  if(fIndex) delete fIndex;
+
+  fIndex     = new NtpMCEventIndex;
+  fIndexTree = fIndex->CreateTree();
+}
+//____________________________________________________________________________
 void NtpWriter::CreateTreeHeader(void)
 {
   LOG("Ntp", pINFO) << "Creating the NtpMCTreeHeader";
@@ -224,8 +420,18 @@ void NtpWriter::Save(void)
 {
   LOG("Ntp", pINFO) << "Saving the output tree";
 
+  this->StopQueue();
+
   if(fOutFile) {
 
+    //-- save the start-up phase costs (incl. the lazy loads of the events)
+    //   the event generation module timing and the cost per channel
+    fOutFile->cd();
+    NtpMCJobEnv environment;
+    environment.TakeStartupProfile()->Write();
+    environment.TakeModuleTiming()->Write();
+    environment.TakeChannelCost()->Write();
+
     fOutFile->Write();
     fOutFile->Close();
     delete fOutFile;
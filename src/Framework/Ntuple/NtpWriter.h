@@ -34,6 +34,10 @@ namespace genie {
 
 class EventRecord;
 class NtpMCEventRecord;
+class NtpMCFlatRecord;
+class NtpMCEventIndex;
+class NtpMCEventCost;
+class NtpWriterQueue;
 class NtpMCTreeHeader;
 
 class NtpWriter {
@@ -48,16 +52,46 @@ public :
   ///< add event
   void AddEventRecord (int ievent, const EventRecord * ev_rec);
 
+  ///< add event, handing its contents over to the output queue (if any)
+  ///< rather than copying them: the input record is left empty
+  void AddEventRecord (int ievent, EventRecord && ev_rec);
+
   ///< save the event tree
   void Save (void);
 
-  ///< get the even tree
-  TTree *  EventTree (void) { return fOutTree; }
+  ///< get the even tree (once all queued events have been written)
+  TTree *  EventTree (void);
+
+  ///< use before Initialize() to write the events on a background thread,
+  ///< through a queue of the input depth (0: write synchronously).
+  ///< The default depth is set through RunOpt (--output-queue-depth).
+  ///< AddEventRecord() may then be called from several generation threads.
+  ///< Falls back to synchronous writing if other branches are added to the
+  ///< event tree, as they would be read after they moved on to later events.
+  void SetOutputQueueDepth (int depth) { fQueueDepth = depth; }
+
+  ///< use before Initialize() to write the GHEP events (kNFGHEP format) as
+  ///< compact, reduced precision NtpMCCompactEventRecords. The default is set
+  ///< through RunOpt (--output-ghep-compact).
+  void SetCompactGHEP (bool compact) { fCompactGHEP = compact; }
+
+  ///< use before Initialize() to switch on/off the event index tree
+  ///< (NtpMCEventIndex) written next to GHEP (kNFGHEP) event trees.
+  ///< On by default, unless switched off through RunOpt (--output-no-index).
+  void SetWriteIndex (bool write) { fWriteIndex = write; }
+
+  ///< use before Initialize() to switch on/off the event generation cost
+  ///< branch (NtpMCEventCost, "gcost") of the event tree. Each event gets
+  ///< the cost accumulated (EventGenCost) on the thread that added it since
+  ///< the previous event. Off by default, unless switched on through RunOpt
+  ///< (--output-event-cost).
+  void SetWriteCost (bool write) { fWriteCost = write; }
 
   ///< use before Initialize() only if you wish to override the default
   ///< filename, or the default filename prefix
   void CustomizeFilename       (string filename);
   void CustomizeFilenamePrefix (string prefix);
+  string Filename              (void) const { return fOutFilename; }
 
 private:
 
@@ -67,6 +101,15 @@ private:
   void CreateTreeHeader      (void);
   void CreateEventBranch     (void);
   void CreateGHEPEventBranch (void);
+  void CreateFlatEventBranch (void);
+  void CreateIndexTree       (void);
+  void CreateCostBranch      (void);
+  void AddEventRecord        (int ievent, const EventRecord * ev_rec,
+                              EventRecord * ev_move);
+  void WriteEventRecord      (int ievent, const EventRecord * ev_rec,
+                              const NtpMCEventCost * cost);
+  void StartQueue            (void);
+  void StopQueue             (void);
 
   NtpMCFormat_t      fNtpFormat;          ///< enumeration of event formats
   Long_t             fRunNu;              ///< run nu
@@ -75,7 +118,17 @@ private:
   TTree *            fOutTree;            ///< output tree
   TBranch *          fEventBranch;        ///< the generated event branch
   NtpMCEventRecord * fNtpMCEventRecord;   ///<
+  NtpMCFlatRecord *  fNtpMCFlatRecord;    ///< flat (kNFFlat) event columns
   NtpMCTreeHeader *  fNtpMCTreeHeader;    ///<
+  bool               fCompactGHEP;        ///< write compact GHEP records?
+  bool               fWriteIndex;         ///< write the event index tree?
+  NtpMCEventIndex *  fIndex;              ///< event index columns
+  TTree *            fIndexTree;          ///< event index tree (null if not written)
+  bool               fWriteCost;          ///< write the event generation cost branch?
+  NtpMCEventCost *   fEventCost;          ///< event generation cost (null if not written)
+  int                fQueueDepth;         ///< output queue depth (0: synchronous writing)
+  NtpWriterQueue *   fQueue;              ///< background writer (null if writing synchronously)
+  int                fNOwnBranches;       ///< number of event tree branches created by the writer
 };
 
 }      // genie namespace
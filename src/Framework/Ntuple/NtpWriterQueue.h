@@ -0,0 +1,191 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::NtpWriterQueue
+
+\brief    A background writer for NtpWriter.
+
+          The generation thread(s) copy each event (and, optionally, its
+          generation cost) into a free slot of a fixed pool of event records
+          (re-using its memory) and queue it; a
+          writer thread takes the queued events in order and writes them out
+          (tree filling: serialisation & compression), then hands the slots
+          back. Pushing only blocks while all slots are queued, so output
+          overlaps with the event generation instead of stalling it.
+
+          Push() may be called from any number of generation threads.
+          The writer function runs on the writer thread, so it must only use
+          objects (the output tree & file) that nothing else touches while
+          the queue is running.
+
+          Header only, to be used within the NtpWriter implementation file
+          (not part of the ROOT dictionary).
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_WRITER_QUEUE_H_
+#define _NTP_WRITER_QUEUE_H_
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/Ntuple/NtpMCEventCost.h"
+
+namespace genie {
+
+class NtpWriterQueue {
+
+public:
+  typedef std::function<
+     void (int, const EventRecord *, const NtpMCEventCost *)> Writer_t;
+
+  NtpWriterQueue(int depth, Writer_t writer) :
+    fWriter     (writer),
+    fSlots      (depth > 0 ? depth : 1, (EventRecord *) 0),
+    fCosts      (fSlots.size()),
+    fHasCost    (fSlots.size(), false),
+    fReadySlot  (fSlots.size(), 0),
+    fReadyEvent (fSlots.size(), 0),
+    fHead       (0),
+    fCount      (0),
+    fStop       (false)
+  {
+    for (unsigned int islot = 0; islot < fSlots.size(); ++islot) {
+      fSlots[islot] = new EventRecord;
+      fFree.push_back(islot);
+    }
+    fThread = std::thread(&NtpWriterQueue::Run, this);
+  }
+ ~NtpWriterQueue()
+  {
+    this->Stop();
+    for (unsigned int islot = 0; islot < fSlots.size(); ++islot) {
+      delete fSlots[islot];
+    }
+  }
+
+  int Depth(void) const { return fSlots.size(); }
+
+  //! Number of events queued and not yet written
+  int NQueued(void)
+  {
+    std::lock_guard<std::mutex> lock(fMutex);
+    return fSlots.size() - fFree.size();
+  }
+
+  //! Copy the input event (and cost, if any) into a free slot and queue it
+  //! for writing (waits for a free slot if all are queued)
+  void Push(int ievent, const EventRecord & event,
+            const NtpMCEventCost * cost = 0)
+  {
+    unsigned int islot = this->TakeSlot();
+    // copy outside the lock, so that other threads can push meanwhile
+    fSlots[islot]->Copy(event);
+    this->Queue(islot, ievent, cost);
+  }
+
+  //! As above, moving the input event contents into the slot (the input
+  //! event is left empty)
+  void Push(int ievent, EventRecord && event,
+            const NtpMCEventCost * cost = 0)
+  {
+    unsigned int islot = this->TakeSlot();
+    fSlots[islot]->Move(event);
+    this->Queue(islot, ievent, cost);
+  }
+
+  //! Wait until all queued events are written
+  void Flush(void)
+  {
+    std::unique_lock<std::mutex> lock(fMutex);
+    fCond.wait(lock, [this]{ return fFree.size() == fSlots.size(); });
+  }
+
+  //! Write all queued events and stop the writer thread
+  void Stop(void)
+  {
+    {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fStop = true;
+    }
+    fCond.notify_all();
+    if ( fThread.joinable() ) fThread.join();
+  }
+
+private:
+
+  //! Wait for a free slot and take it
+  unsigned int TakeSlot(void)
+  {
+    std::unique_lock<std::mutex> lock(fMutex);
+    fCond.wait(lock, [this]{ return ! fFree.empty(); });
+    unsigned int islot = fFree.back();
+    fFree.pop_back();
+    return islot;
+  }
+
+  //! Queue a filled slot for writing
+  void Queue(unsigned int islot, int ievent, const NtpMCEventCost * cost)
+  {
+    fHasCost[islot] = (cost != 0);
+    if(cost) fCosts[islot].Copy(*cost);
+
+    std::lock_guard<std::mutex> lock(fMutex);
+    unsigned int iready = (fHead + fCount) % fSlots.size();
+    fReadySlot  [iready] = islot;
+    fReadyEvent [iready] = ievent;
+    fCount++;
+    fCond.notify_all();
+  }
+
+  void Run(void)
+  {
+    while ( true ) {
+      std::unique_lock<std::mutex> lock(fMutex);
+      fCond.wait(lock, [this]{ return fStop || fCount > 0; });
+      if ( fCount == 0 ) return; // stopped & drained
+      unsigned int islot  = fReadySlot  [fHead];
+      int          ievent = fReadyEvent [fHead];
+      fHead = (fHead + 1) % fSlots.size();
+      fCount--;
+      lock.unlock();
+
+      // write outside the lock, so that the generation can go on meanwhile
+      fWriter(ievent, fSlots[islot], fHasCost[islot] ? &fCosts[islot] : 0);
+
+      lock.lock();
+      fFree.push_back(islot);
+      fCond.notify_all();
+    }
+  }
+
+  Writer_t                   fWriter;      ///< writes an event out
+  std::vector<EventRecord *> fSlots;       ///< pool of event records
+  std::vector<NtpMCEventCost> fCosts;      ///< and of their generation costs
+  std::vector<bool>          fHasCost;     ///< is there a cost in the slot?
+  std::vector<unsigned int>  fFree;        ///< free slots
+  std::vector<unsigned int>  fReadySlot;   ///< ring of queued slots
+  std::vector<int>           fReadyEvent;  ///< and their event numbers
+  unsigned int               fHead;        ///< next queued slot to be written
+  unsigned int               fCount;       ///< number of queued slots
+  bool                       fStop;        ///< writer asked to stop
+  std::thread                fThread;      ///< writer thread
+  std::mutex                 fMutex;
+  std::condition_variable    fCond;
+};
+
+} // genie namespace
+
+#endif // _NTP_WRITER_QUEUE_H_
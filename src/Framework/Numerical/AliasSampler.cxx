@@ -0,0 +1,132 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include "Framework/Numerical/AliasSampler.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+AliasSampler::AliasSampler() :
+fSum(0.)
+{
+
+}
+//____________________________________________________________________________
+AliasSampler::AliasSampler(const vector<double> & weights) :
+fSum(0.)
+{
+  this->Build(weights);
+}
+//____________________________________________________________________________
+AliasSampler::~AliasSampler()
+{
+
+}
+//____________________________________________________________________________
+bool AliasSampler::Build(const vector<double> & weights)
+{
+  if(weights.empty()) {
+    this->Clear();
+    return false;
+  }
+  return this->Build(&weights[0], weights.size());
+}
+//____________________________________________________________________________
+bool AliasSampler::Build(const double * weights, unsigned int n)
+{
+  this->Clear();
+  if(!weights || n == 0) return false;
+
+  fWeight.resize(n);
+  unsigned int imax = 0;
+  for(unsigned int i = 0; i < n; i++) {
+    double w = (weights[i] > 0.) ? weights[i] : 0.;
+    fWeight[i] = w;
+    fSum += w;
+    if(w > fWeight[imax]) imax = i;
+  }
+  if(fSum <= 0.) {
+    this->Clear();
+    return false;
+  }
+
+  fProb  .resize(n);
+  fAlias .resize(n);
+  fScaled.resize(n);
+
+  double scale = n / fSum;
+  for(unsigned int i = 0; i < n; i++) {
+    fScaled[i] = fWeight[i] * scale;
+    fAlias [i] = i;
+    if(fScaled[i] < 1.) fSmall.push_back(i);
+    else                fLarge.push_back(i);
+  }
+
+  // pair each under-full column with an over-full one
+  while(!fSmall.empty() && !fLarge.empty()) {
+    unsigned int is = fSmall.back(); fSmall.pop_back();
+    unsigned int il = fLarge.back();
+    fProb [is] = fScaled[is];
+    fAlias[is] = il;
+    fScaled[il] -= (1. - fScaled[is]);
+    if(fScaled[il] < 1.) {
+      fLarge.pop_back();
+      fSmall.push_back(il);
+    }
+  }
+  // whatever is left is full up to rounding errors - but make sure that a
+  // column with zero weight can never be selected
+  while(!fLarge.empty()) {
+    fProb[fLarge.back()] = 1.;
+    fLarge.pop_back();
+  }
+  while(!fSmall.empty()) {
+    unsigned int is = fSmall.back(); fSmall.pop_back();
+    if(fWeight[is] > 0.) {
+      fProb[is] = 1.;
+    } else {
+      fProb [is] = 0.;
+      fAlias[is] = imax;
+    }
+  }
+  return true;
+}
+//____________________________________________________________________________
+unsigned int AliasSampler::Sample(double r) const
+{
+  unsigned int n = fProb.size();
+  if(n == 0) return 0;
+
+  // split r into a column and a uniform number within that column
+  double x = r * n;
+  unsigned int i = (x > 0.) ? (unsigned int) x : 0;
+  if(i >= n) i = n-1;
+  double u = x - i;
+
+  return (u < fProb[i]) ? i : fAlias[i];
+}
+//____________________________________________________________________________
+double AliasSampler::Probability(unsigned int i) const
+{
+  if(i >= fWeight.size() || fSum <= 0.) return 0.;
+  return fWeight[i] / fSum;
+}
+//____________________________________________________________________________
+void AliasSampler::Clear(void)
+{
+  fProb  .clear();
+  fAlias .clear();
+  fWeight.clear();
+  fScaled.clear();
+  fSmall .clear();
+  fLarge .clear();
+  fSum = 0.;
+}
+//____________________________________________________________________________
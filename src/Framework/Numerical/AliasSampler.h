@@ -0,0 +1,70 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::AliasSampler
+
+\brief    Samples an index from a discrete distribution in constant time
+          using Walker's alias method (table built with Vose's algorithm,
+          M.D.Vose, IEEE Trans. Softw. Eng. 17 (1991) 972).
+
+          Building the table from n (unnormalized) weights costs O(n).
+          Each sample then costs O(1), independently of n, and needs a single
+          uniform random number. Entries with non-positive weights are never
+          selected. The work space is kept between Build() calls so that a
+          sampler re-built for every event does not re-allocate memory.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _ALIAS_SAMPLER_H_
+#define _ALIAS_SAMPLER_H_
+
+#include <vector>
+
+using std::vector;
+
+namespace genie {
+
+class AliasSampler {
+
+public:
+
+  AliasSampler();
+  AliasSampler(const vector<double> & weights);
+ ~AliasSampler();
+
+  //! Build the alias table. Returns false (and leaves an empty sampler)
+  //! if no weight is positive.
+  bool Build (const vector<double> & weights);
+  bool Build (const double * weights, unsigned int n);
+
+  //! Sample an index, given a uniform random number r in [0,1)
+  unsigned int Sample (double r) const;
+
+  void         Clear       (void);
+  bool         IsEmpty     (void) const { return fProb.empty(); }
+  unsigned int Size        (void) const { return fProb.size();  }
+  double       Sum         (void) const { return fSum;          }
+  double       Probability (unsigned int i) const;
+
+private:
+
+  vector<double>       fProb;     ///< probability of keeping column i (vs taking its alias)
+  vector<unsigned int> fAlias;    ///< alias of column i
+  vector<double>       fWeight;   ///< input weights (negative ones set to 0)
+  vector<double>       fScaled;   ///< work space: weights scaled to mean 1
+  vector<unsigned int> fSmall;    ///< work space: columns with scaled weight < 1
+  vector<unsigned int> fLarge;    ///< work space: columns with scaled weight >= 1
+  double               fSum;      ///< sum of weights
+};
+
+}      // genie namespace
+
+#endif // _ALIAS_SAMPLER_H_
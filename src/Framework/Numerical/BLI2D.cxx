@@ -10,6 +10,7 @@
 
 #include <TMath.h>
 
+#include <algorithm>
 #include <cassert>
 #include <limits>
 
@@ -18,6 +19,26 @@
 
 using namespace genie;
 
+//___________________________________________________________________________
+namespace {
+
+  // Index i of the grid interval [v[i], v[i+1]] containing x, for n > 1 and
+  // v[0] <= x <= v[n-1]. The interval found by the previous look-up (hint)
+  // is tried first, as successive look-ups tend to fall in the same one,
+  // otherwise the interval is found by bisection.
+  inline int FindBin(const double * v, int n, double x, int hint)
+  {
+    if(hint >= 0 && hint < n-1 && v[hint] <= x && x <= v[hint+1]) return hint;
+    int i = int(std::upper_bound(v, v+n, x) - v) - 1;
+    return TMath::Min(TMath::Max(i, 0), n-2);
+  }
+
+  // interval hints of the single-point BLI2DNonUnifGrid look-ups
+  thread_local int gNonUnifHintX = 0;
+  thread_local int gNonUnifHintY = 0;
+}
+
+//___________________________________________________________________________
 ClassImp(BLI2DGrid)
 
 //___________________________________________________________________________
@@ -33,6 +54,12 @@ BLI2DGrid::~BLI2DGrid()
   if (fZ) { delete [] fZ; }
 }
 //___________________________________________________________________________
+void BLI2DGrid::Evaluate(
+  const double * x, const double * y, double * z, int n) const
+{
+  for(int i=0; i<n; i++) { z[i] = this->Evaluate(x[i], y[i]); }
+}
+//___________________________________________________________________________
 int BLI2DGrid::IdxZ(int ix, int iy) const
 {
   return ix*fNY+iy;
@@ -91,11 +118,29 @@ bool BLI2DUnifGrid::AddPoint(double x, double y, double z)
 //___________________________________________________________________________
 double BLI2DUnifGrid::Evaluate(double x, double y) const
 {
+  if(fNZ == 0) return 0.;
   if(x < fXmin || x > fXmax) return 0.;
   if(y < fYmin || y > fYmax) return 0.;
 
-  int ix_lo  = TMath::FloorNint( (x - fXmin) / fDX );
-  int iy_lo  = TMath::FloorNint( (y - fYmin) / fDY );
+  return this->Interpolate(x,y);
+}
+//___________________________________________________________________________
+void BLI2DUnifGrid::Evaluate(
+  const double * x, const double * y, double * z, int n) const
+{
+  for(int i=0; i<n; i++) {
+    bool inside = fNZ > 0 &&
+       x[i] >= fXmin && x[i] <= fXmax && y[i] >= fYmin && y[i] <= fYmax;
+    z[i] = (inside) ? this->Interpolate(x[i],y[i]) : 0.;
+  }
+}
+//___________________________________________________________________________
+double BLI2DUnifGrid::Interpolate(double x, double y) const
+{
+  // the lower grid nodes follow directly from the uniform spacing
+  // (the last interval is used at x = xmax, y = ymax)
+  int ix_lo  = TMath::Min( int( (x - fXmin) / fDX ), fNX-2 );
+  int iy_lo  = TMath::Min( int( (y - fYmin) / fDY ), fNY-2 );
   int ix_hi  = ix_lo + 1;
   int iy_hi  = iy_lo + 1;
 
@@ -324,35 +369,37 @@ bool BLI2DNonUnifGrid::AddPoint(double x, double y, double z)
 //___________________________________________________________________________
 double BLI2DNonUnifGrid::Evaluate(double x, double y) const
 {
+  return this->Interpolate(x, y, gNonUnifHintX, gNonUnifHintY);
+}
+//___________________________________________________________________________
+void BLI2DNonUnifGrid::Evaluate(
+  const double * x, const double * y, double * z, int n) const
+{
+  int ix_hint = 0;
+  int iy_hint = 0;
+  for(int i=0; i<n; i++) {
+    z[i] = this->Interpolate(x[i], y[i], ix_hint, iy_hint);
+  }
+}
+//___________________________________________________________________________
+double BLI2DNonUnifGrid::Interpolate(
+  double x, double y, int & ix_hint, int & iy_hint) const
+{
+  // if an error occurs
+  if (fNFillX<2 || fNFillY<2) return 0.;
+
   double evalx=TMath::Min(x,fXmax);
   evalx=TMath::Max(evalx,fXmin);
   double evaly=TMath::Min(y,fYmax);
   evaly=TMath::Max(evaly,fYmin);
 
-  int ix_lo  = -2;
-  int iy_lo  = -2;
-  for (int i=0;i<fNFillX;i++)
-    {
-      if (evalx<=fX[fNFillX-1-i]) ix_lo=fNFillX-2-i;
-      else break;
-    }
-  for (int i=0;i<fNFillY;i++)
-    {
-      if (evaly<=fY[fNFillY-1-i]) iy_lo=fNFillY-2-i;
-      else break;
-    }
+  int ix_lo  = FindBin(fX, fNFillX, evalx, ix_hint);
+  int iy_lo  = FindBin(fY, fNFillY, evaly, iy_hint);
   int ix_hi  = ix_lo + 1;
   int iy_hi  = iy_lo + 1;
 
-  // in case x = xmin
-  if (ix_lo==-1) {ix_lo++; ix_hi++;}
-  if (iy_lo==-1) {iy_lo++; iy_hi++;}
-  // in case x = xmax
-  if (ix_lo==-2) {ix_lo=fNFillX-2; ix_hi=fNFillX-1;}
-  if (iy_lo==-2) {iy_lo=fNFillY-2; iy_hi=fNFillY-1;}
-  // if an error occurs
-  if (ix_lo<0       || iy_lo<0      ) return 0.;
-  if (ix_hi>fNFillX || iy_hi>fNFillY) return 0.;
+  ix_hint = ix_lo;
+  iy_hint = iy_lo;
 
   double x1  = fX[ix_lo];
   double x2  = fX[ix_hi];
@@ -37,6 +37,9 @@ public:
   //-- evaluate the function at the input position
   virtual double Evaluate (double x, double y) const =0;
 
+  //-- evaluate the function at n input positions, z[i] = f(x[i],y[i])
+  virtual void Evaluate (const double * x, const double * y, double * z, int n) const;
+
   // report min/max values
   double XMin (void) const { return fXmin; }
   double XMax (void) const { return fXmax; }
@@ -83,12 +86,14 @@ public:
   //-- add another point in the grid
   bool AddPoint(double x, double y, double z);
 
-  //-- evaluate the function at the input position
+  //-- evaluate the function at the input position(s)
   double Evaluate (double x, double y) const;
+  void   Evaluate (const double * x, const double * y, double * z, int n) const;
 
 private:
 
-  void Init (int nx=0, double xmin=0, double xmax=0, int ny=0, double ymin=0, double ymax=0);
+  void   Init      (int nx=0, double xmin=0, double xmax=0, int ny=0, double ymin=0, double ymax=0);
+  double Interpolate (double x, double y) const;
 
   ClassDef(BLI2DUnifGrid, 1)
   };
@@ -107,12 +112,15 @@ public:
   //-- add another point in the grid
   bool AddPoint(double x, double y, double z);
 
-  //-- evaluate the function at the input position
+  //-- evaluate the function at the input position(s)
   double Evaluate (double x, double y) const;
+  void   Evaluate (const double * x, const double * y, double * z, int n) const;
 
 private:
 
-  void Init (int nx=0, double xmin=0, double xmax=0, int ny=0, double ymin=0, double ymax=0);
+  void   Init      (int nx=0, double xmin=0, double xmax=0, int ny=0, double ymin=0, double ymax=0);
+  double Interpolate (double x, double y, int & ix_hint, int & iy_hint) const;
+
   int      fNFillX;
   int      fNFillY;
 
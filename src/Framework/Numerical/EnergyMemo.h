@@ -0,0 +1,123 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::EnergyMemo
+
+\brief    A per-thread memo of the (spline, energy) evaluations of an event.
+
+          Along the generation of one event the same cross section splines
+          (and max xsec caches) get evaluated at the same energy by several
+          modules: splines shared by several channels (see XSecSplineList),
+          the total cross sections of the target materials, the max xsec of
+          the selected channel on event generation retries, ... Evaluating
+          them through the memo computes each (key, E) value once per event.
+
+          The memo is a small direct-mapped table of the calling thread (no
+          locking): a value may be evicted by an other (key, E) mapped to the
+          same slot, and is then simply computed again. NewEvent(), called by
+          the event generation drivers at the start of each event, forgets
+          all values of the calling thread in constant time.
+          Keys are the addresses of immutable objects (eg. splines), which
+          must not be deleted while events are generated.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _ENERGY_MEMO_H_
+#define _ENERGY_MEMO_H_
+
+#include <cstring>
+#include <stdint.h>
+
+#include "Framework/Numerical/Spline.h"
+
+namespace genie {
+
+class EnergyMemo {
+
+public:
+  //! forget all the values memoized by the calling thread
+  static void NewEvent (void)
+  {
+    Memo & memo = Table();
+    if(++memo.fEpoch == 0) {
+      for(unsigned int i = 0; i < kNSlots; i++) memo.fSlot[i].fEpoch = 0;
+      memo.fEpoch = 1;
+    }
+  }
+
+  //! the value memoized for (key, E) by the calling thread, if any
+  static bool Find (const void * key, double E, double & value)
+  {
+    Memo & memo = Table();
+    const Slot & slot = memo.fSlot[ Index(key, E) ];
+    if(slot.fEpoch != memo.fEpoch || slot.fKey != key || slot.fE != E) {
+      return false;
+    }
+    value = slot.fValue;
+    return true;
+  }
+
+  //! memoize the value of (key, E)
+  static void Store (const void * key, double E, double value)
+  {
+    Memo & memo = Table();
+    Slot & slot = memo.fSlot[ Index(key, E) ];
+    slot.fKey   = key;
+    slot.fE     = E;
+    slot.fValue = value;
+    slot.fEpoch = memo.fEpoch;
+  }
+
+  //! spl->Evaluate(E), computed once per event and thread
+  static double Evaluate (const Spline * spl, double E)
+  {
+    double value = 0;
+    if(Find(spl, E, value)) return value;
+    value = spl->Evaluate(E);
+    Store(spl, E, value);
+    return value;
+  }
+
+private:
+
+  static const unsigned int kNSlots = 256; ///< power of 2
+
+  struct Slot {
+    Slot() : fKey(0), fE(0.), fValue(0.), fEpoch(0) { }
+    const void * fKey;
+    double       fE;
+    double       fValue;
+    unsigned int fEpoch;  ///< event the value was memoized for
+  };
+  struct Memo {
+    Memo() : fEpoch(1) { }
+    Slot         fSlot[kNSlots];
+    unsigned int fEpoch;  ///< current event
+  };
+
+  static Memo & Table (void)
+  {
+    static thread_local Memo memo;
+    return memo;
+  }
+
+  static unsigned int Index (const void * key, double E)
+  {
+    uint64_t bits = 0;
+    std::memcpy(&bits, &E, sizeof(bits));
+    uint64_t h = ((uint64_t) (uintptr_t) key ^ bits) * 0x9E3779B97F4A7C15ULL;
+    return (unsigned int) (h >> 56) & (kNSlots - 1);
+  }
+};
+
+}      // genie namespace
+
+#endif // _ENERGY_MEMO_H_
@@ -0,0 +1,141 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <algorithm>
+
+#include <TMath.h>
+
+#include "Framework/Numerical/GridEnvelope2D.h"
+#include "Framework/Numerical/MathUtils.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+GridEnvelope2D::GridEnvelope2D()
+{
+  this->Reset(1,1);
+}
+//____________________________________________________________________________
+GridEnvelope2D::GridEnvelope2D(unsigned int nu, unsigned int nv)
+{
+  this->Reset(nu,nv);
+}
+//____________________________________________________________________________
+GridEnvelope2D::~GridEnvelope2D()
+{
+
+}
+//____________________________________________________________________________
+void GridEnvelope2D::Reset(unsigned int nu, unsigned int nv)
+{
+  nu = TMath::Max(nu, 1u);
+  nv = TMath::Max(nv, 1u);
+
+  fUEdges.resize(nu+1);
+  fVEdges.resize(nv+1);
+  for(unsigned int i = 0; i <= nu; i++) fUEdges[i] = (double) i / nu;
+  for(unsigned int i = 0; i <= nv; i++) fVEdges[i] = (double) i / nv;
+
+  fHeight.assign(nu*nv, 0.);
+  fSampler.Clear();
+}
+//____________________________________________________________________________
+void GridEnvelope2D::Adapt(const vector<double> & f, double alpha)
+{
+  unsigned int nu = this->NU();
+  unsigned int nv = this->NV();
+  if(f.size() != nu*nv || alpha <= 0.) return;
+
+  // integral of f in each bin of each dimension
+  vector<double> du(nu, 0.), dv(nv, 0.);
+  for(unsigned int iu = 0; iu < nu; iu++) {
+    for(unsigned int iv = 0; iv < nv; iv++) {
+      double fc = TMath::Abs(f[iu*nv+iv]) *
+           (fUEdges[iu+1]-fUEdges[iu]) * (fVEdges[iv+1]-fVEdges[iv]);
+      du[iu] += fc;
+      dv[iv] += fc;
+    }
+  }
+  utils::math::VegasRebin(fUEdges, du, alpha);
+  utils::math::VegasRebin(fVEdges, dv, alpha);
+
+  // the heights refer to the old cells
+  fHeight.assign(nu*nv, 0.);
+  fSampler.Clear();
+}
+//____________________________________________________________________________
+void GridEnvelope2D::SetHeight(unsigned int iu, unsigned int iv, double h)
+{
+  if(iu >= this->NU() || iv >= this->NV()) return;
+  fHeight[iu*this->NV()+iv] = TMath::Max(h, 0.);
+}
+//____________________________________________________________________________
+bool GridEnvelope2D::Build(void)
+{
+  unsigned int nu = this->NU();
+  unsigned int nv = this->NV();
+
+  vector<double> w(nu*nv);
+  for(unsigned int iu = 0; iu < nu; iu++) {
+    for(unsigned int iv = 0; iv < nv; iv++) {
+      w[iu*nv+iv] = fHeight[iu*nv+iv] *
+           (fUEdges[iu+1]-fUEdges[iu]) * (fVEdges[iv+1]-fVEdges[iv]);
+    }
+  }
+  return fSampler.Build(w);
+}
+//____________________________________________________________________________
+double GridEnvelope2D::Sample(
+         double r1, double r2, double r3, double & u, double & v) const
+{
+  u = -1;
+  v = -1;
+  if(fSampler.IsEmpty()) return 0.;
+
+  unsigned int nv   = this->NV();
+  unsigned int cell = fSampler.Sample(r1);
+  unsigned int iu   = cell / nv;
+  unsigned int iv   = cell % nv;
+
+  u = fUEdges[iu] + r2 * (fUEdges[iu+1]-fUEdges[iu]);
+  v = fVEdges[iv] + r3 * (fVEdges[iv+1]-fVEdges[iv]);
+
+  return fHeight[cell];
+}
+//____________________________________________________________________________
+unsigned int GridEnvelope2D::FindBin(
+                               const vector<double> & edges, double x) const
+{
+  vector<double>::const_iterator it =
+                      std::upper_bound(edges.begin(), edges.end(), x);
+  int i = (it - edges.begin()) - 1;
+  int n = edges.size() - 1;
+  if(i < 0)  i = 0;
+  if(i >= n) i = n-1;
+  return i;
+}
+//____________________________________________________________________________
+double GridEnvelope2D::Height(double u, double v) const
+{
+  if(u < 0. || u > 1. || v < 0. || v > 1.) return 0.;
+  return this->Height(this->FindBin(fUEdges,u), this->FindBin(fVEdges,v));
+}
+//____________________________________________________________________________
+double GridEnvelope2D::Height(unsigned int iu, unsigned int iv) const
+{
+  if(iu >= this->NU() || iv >= this->NV()) return 0.;
+  return fHeight[iu*this->NV()+iv];
+}
+//____________________________________________________________________________
+double GridEnvelope2D::Volume(void) const
+{
+  return fSampler.Sum();
+}
+//____________________________________________________________________________
@@ -0,0 +1,84 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::GridEnvelope2D
+
+\brief    A piecewise-constant sampling envelope over the unit square.
+
+          The square is divided in nu x nv cells by a grid whose bin edges
+          can be adapted, VEGAS-style (G.P.Lepage, J.Comput.Phys. 27 (1978)
+          192), so that every bin of each dimension holds an equal share of
+          the sampled function. Each cell carries a height, which should be
+          a majorant of the function in that cell. Points are sampled with a
+          density proportional to the envelope (the cell is picked with an
+          alias table, the point is uniform within the cell) so that, if
+          accepted with probability f/height, they follow f exactly.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _GRID_ENVELOPE_2D_H_
+#define _GRID_ENVELOPE_2D_H_
+
+#include <vector>
+
+#include "Framework/Numerical/AliasSampler.h"
+
+using std::vector;
+
+namespace genie {
+
+class GridEnvelope2D {
+
+public:
+
+  GridEnvelope2D();
+  GridEnvelope2D(unsigned int nu, unsigned int nv);
+ ~GridEnvelope2D();
+
+  //! Set a grid of uniform bins and zero heights
+  void Reset (unsigned int nu, unsigned int nv);
+
+  //! Move the bin edges of both dimensions so that each bin holds an equal
+  //! share of the integral of f, given the values of f at the cell centres
+  //! (f[iu*nv+iv]). Alpha damps the re-binning (0: no change; VEGAS: 1.5).
+  void Adapt (const vector<double> & f, double alpha = 1.5);
+
+  //! Set the cell heights and then build the sampling table.
+  //! Returns false if no height is positive.
+  void   SetHeight (unsigned int iu, unsigned int iv, double h);
+  bool   Build     (void);
+
+  //! Sample a point (u,v) in the unit square, given 3 uniform random numbers
+  //! in [0,1). Returns the envelope height at the sampled point.
+  double Sample    (double r1, double r2, double r3, double & u, double & v) const;
+
+  double       Height  (double u, double v) const;
+  double       Height  (unsigned int iu, unsigned int iv) const;
+  double       UEdge   (unsigned int i) const { return fUEdges[i]; }
+  double       VEdge   (unsigned int i) const { return fVEdges[i]; }
+  unsigned int NU      (void) const { return fUEdges.size()-1; }
+  unsigned int NV      (void) const { return fVEdges.size()-1; }
+  bool         IsBuilt (void) const { return !fSampler.IsEmpty(); }
+  double       Volume  (void) const; ///< integral of the envelope
+
+private:
+
+  unsigned int FindBin (const vector<double> & edges, double x) const;
+
+  vector<double> fUEdges;   ///< bin edges in u (nu+1 values in [0,1])
+  vector<double> fVEdges;   ///< bin edges in v (nv+1 values in [0,1])
+  vector<double> fHeight;   ///< cell heights, cell (iu,iv) at iu*nv+iv
+  AliasSampler   fSampler;  ///< samples cells with probability height*area
+};
+
+}      // genie namespace
+
+#endif // _GRID_ENVELOPE_2D_H_
@@ -68,6 +68,19 @@ double Interpolator2D::Eval(const double & x, const double & y) const
     fAcc_y->acc);
 }
 //____________________________________________________________________________
+void Interpolator2D::Eval(
+  const double * x, const double * y, double * z, const size_t & n) const
+{
+  // the accelerators keep the last grid intervals, so that nearby points
+  // skip the interval search
+  gsl_spline2d     * spl   = fSpline->spl;
+  gsl_interp_accel * acc_x = fAcc_x->acc;
+  gsl_interp_accel * acc_y = fAcc_y->acc;
+  for (size_t i = 0 ; i < n ; i++) {
+    z[i] = gsl_spline2d_eval(spl, x[i], y[i], acc_x, acc_y);
+  }
+}
+//____________________________________________________________________________
 double Interpolator2D::DerivX(const double & x, const double & y) const
 {
   return gsl_spline2d_eval_deriv_x(
@@ -160,6 +173,14 @@ double Interpolator2D::Eval(const double & x, const double & y) const
   return fSpline->spl->Interpolate(x,y);
 }
 //____________________________________________________________________________
+void Interpolator2D::Eval(
+  const double * x, const double * y, double * z, const size_t & n) const
+{
+  for (size_t i = 0 ; i < n ; i++) {
+    z[i] = fSpline->spl->Interpolate(x[i],y[i]);
+  }
+}
+//____________________________________________________________________________
 double Interpolator2D::DerivX(const double & x, const double & y) const
 {
   assert(!"Method requires GSL version 2 or higher.");
@@ -33,6 +33,8 @@ class Interpolator2D
     ~Interpolator2D();
 
     double Eval    (const double & x, const double & y) const;
+    void   Eval    (const double * x, const double * y, double * z,
+                    const size_t & n) const; // z[i] = f(x[i],y[i])
     double DerivX  (const double & x, const double & y) const;
     double DerivY  (const double & x, const double & y) const;
     double DerivXX (const double & x, const double & y) const;
@@ -0,0 +1,129 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <cmath>
+
+#include "Framework/Numerical/InverseCDFSampler.h"
+
+using namespace genie;
+
+namespace {
+  double NonNegative(double f)
+  {
+    return (std::isfinite(f) && f > 0.) ? f : 0.;
+  }
+}
+
+//____________________________________________________________________________
+InverseCDFSampler::InverseCDFSampler() :
+fXmin(0.), fXmax(0.), fDx(0.), fIntegral(0.)
+{
+
+}
+//____________________________________________________________________________
+InverseCDFSampler::InverseCDFSampler(
+    const ROOT::Math::IBaseFunctionOneDim & pdf,
+    double xmin, double xmax, unsigned int n) :
+fXmin(0.), fXmax(0.), fDx(0.), fIntegral(0.)
+{
+  this->Build(pdf, xmin, xmax, n);
+}
+//____________________________________________________________________________
+InverseCDFSampler::~InverseCDFSampler()
+{
+
+}
+//____________________________________________________________________________
+bool InverseCDFSampler::Build(
+    const ROOT::Math::IBaseFunctionOneDim & pdf,
+    double xmin, double xmax, unsigned int n)
+{
+  this->Clear();
+  if(n == 0 || !(xmax > xmin)) return false;
+
+  fXmin = xmin;
+  fXmax = xmax;
+  fDx   = (xmax - xmin) / n;
+
+  fPDF.resize(n+1);
+  for(unsigned int i = 0; i <= n; i++) {
+    fPDF[i] = NonNegative(pdf(xmin + i*fDx));
+  }
+
+  // integrate bin by bin (Simpson's rule, with the PDF at the bin centres)
+  fCDF.resize(n+1);
+  fCDF[0] = 0.;
+  for(unsigned int i = 0; i < n; i++) {
+    double fm = NonNegative(pdf(xmin + (i+0.5)*fDx));
+    fCDF[i+1] = fCDF[i] + fDx * (fPDF[i] + 4*fm + fPDF[i+1]) / 6.;
+  }
+  fIntegral = fCDF[n];
+  if(!(fIntegral > 0.)) {
+    this->Clear();
+    return false;
+  }
+  for(unsigned int i = 1; i <= n; i++) fCDF[i] /= fIntegral;
+  fCDF[n] = 1.;
+
+  // guide table
+  fGuide.resize(n);
+  unsigned int i = 0;
+  for(unsigned int k = 0; k < n; k++) {
+    double u = (double) k / n;
+    while(i < n-1 && fCDF[i+1] <= u) i++;
+    fGuide[k] = i;
+  }
+  return true;
+}
+//____________________________________________________________________________
+double InverseCDFSampler::Sample(double r) const
+{
+  unsigned int n = fGuide.size();
+  if(n == 0) return fXmin;
+
+  // find the bin i with fCDF[i] <= r < fCDF[i+1]
+  unsigned int k = (r > 0.) ? (unsigned int) (r*n) : 0;
+  if(k >= n) k = n-1;
+  unsigned int i = fGuide[k];
+  while(i < n-1 && fCDF[i+1] <= r) i++;
+
+  // invert the CDF within the bin, the PDF varying linearly across it:
+  // F(t) = f0 t + (f1-f0) t^2 / 2 (t in [0,1]) scaled to the bin content
+  double c  = fCDF[i+1] - fCDF[i];
+  double y  = (c > 0.) ? (r - fCDF[i]) / c : 0.5; // fraction of the bin content
+  double f0 = fPDF[i];
+  double f1 = fPDF[i+1];
+  double a  = 0.5 * (f1 - f0);
+  double b  = f0;
+  double s  = y * 0.5 * (f0 + f1);                // a t^2 + b t = s
+  double t  = y;
+  if(s <= 0.) {
+    t = 0.;
+  } else if(std::fabs(a) > 1E-9 * (std::fabs(b) + std::fabs(a))) {
+    double d = b*b + 4*a*s;
+    if(d < 0.) d = 0.;
+    t = 2*s / (b + std::sqrt(d));
+  } else if(b > 0.) {
+    t = s / b;
+  }
+  if(t < 0.) t = 0.;
+  if(t > 1.) t = 1.;
+
+  return fXmin + (i + t) * fDx;
+}
+//____________________________________________________________________________
+void InverseCDFSampler::Clear(void)
+{
+  fPDF  .clear();
+  fCDF  .clear();
+  fGuide.clear();
+  fXmin = fXmax = fDx = fIntegral = 0.;
+}
+//____________________________________________________________________________
@@ -0,0 +1,77 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::InverseCDFSampler
+
+\brief    Samples a continuous 1-D distribution by inverting its tabulated
+          cumulative distribution function.
+
+          Build() tabulates the (unnormalized, non-negative) PDF on a uniform
+          grid of n bins over [xmin, xmax] and integrates it bin by bin with
+          Simpson's rule. Sample() picks a bin in constant time, with a guide
+          table (H.C.Chen and Y.Asau, J.Chin.Inst.Eng. 17 (1974) 10), and
+          inverts the PDF interpolated linearly within that bin. With a few
+          thousand bins, the sampled distribution follows smooth PDFs well
+          within the statistical precision of any sample.
+
+          Sample() is const and keeps no state: a sampler built once (eg. at
+          an algorithm's configuration) can be used by any number of threads.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _INVERSE_CDF_SAMPLER_H_
+#define _INVERSE_CDF_SAMPLER_H_
+
+#include <vector>
+
+#include <Math/IFunction.h>
+
+using std::vector;
+
+namespace genie {
+
+class InverseCDFSampler {
+
+public:
+
+  InverseCDFSampler();
+  InverseCDFSampler(const ROOT::Math::IBaseFunctionOneDim & pdf,
+                    double xmin, double xmax, unsigned int n = 5000);
+ ~InverseCDFSampler();
+
+  //! Build the sampler. Returns false (and leaves an empty sampler) if the
+  //! PDF does not have a positive integral over [xmin, xmax].
+  bool Build (const ROOT::Math::IBaseFunctionOneDim & pdf,
+              double xmin, double xmax, unsigned int n = 5000);
+
+  //! Sample x, given a uniform random number r in [0,1)
+  double Sample (double r) const;
+
+  void   Clear    (void);
+  bool   IsEmpty  (void) const { return fCDF.empty(); }
+  double Integral (void) const { return fIntegral;    }
+  double XMin     (void) const { return fXmin;        }
+  double XMax     (void) const { return fXmax;        }
+
+private:
+
+  double               fXmin;     ///< lower limit
+  double               fXmax;     ///< upper limit
+  double               fDx;       ///< bin width
+  double               fIntegral; ///< PDF integral over [fXmin, fXmax]
+  vector<double>       fPDF;      ///< PDF at the bin edges (negative & non-finite values set to 0)
+  vector<double>       fCDF;      ///< normalized CDF at the bin edges
+  vector<unsigned int> fGuide;    ///< guide table: first bin i with fCDF[i+1] > k/n
+};
+
+}      // genie namespace
+
+#endif // _INVERSE_CDF_SAMPLER_H_
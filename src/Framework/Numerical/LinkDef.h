@@ -9,6 +9,12 @@
 #pragma link C++ namespace genie::utils::gsl;
 
 #pragma link C++ class genie::RandomGen;
+#pragma link C++ class genie::RandomStream;
+#pragma link C++ class genie::AliasSampler;
+#pragma link C++ class genie::InverseCDFSampler;
+#pragma link C++ class genie::NBodyPhaseSpace;
+#pragma link C++ class genie::GridEnvelope2D;
+#pragma link C++ class genie::VegasGrid;
 #pragma link C++ class genie::Spline;
 #pragma link C++ class genie::BLI2DGrid;
 #pragma link C++ class genie::BLI2DUnifGrid;
@@ -284,3 +284,111 @@ double genie::utils::math::NonNegative(float x)
   return TMath::Max( (float)0., x);
 }
 //____________________________________________________________________________
+ULong64_t genie::utils::math::HashCombine(ULong64_t hash, Long64_t value)
+{
+// The value is scrambled with the splitmix64 finalizer and then combined
+// as in boost::hash_combine
+
+  ULong64_t x = (ULong64_t) value + 0x9E3779B97F4A7C15ULL;
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+  x =  x ^ (x >> 31);
+
+  return hash ^ (x + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2));
+}
+//____________________________________________________________________________
+void genie::utils::math::VegasRebin(
+       vector<double> & edges, const vector<double> & d, double alpha)
+{
+// Re-binning of G.P.Lepage, J.Comput.Phys. 27 (1978) 192
+
+  unsigned int n = d.size();
+  if(n < 2) return;
+
+  // smooth the bin contents with their neighbours
+  vector<double> s(n);
+  s[0]   = 0.5*(d[0]+d[1]);
+  s[n-1] = 0.5*(d[n-2]+d[n-1]);
+  for(unsigned int i = 1; i < n-1; i++) s[i] = (d[i-1]+d[i]+d[i+1])/3.;
+
+  double sum = 0.;
+  for(unsigned int i = 0; i < n; i++) sum += s[i];
+  if(sum <= 0.) return;
+
+  // damped importance of each bin
+  vector<double> m(n, 0.);
+  double msum = 0.;
+  for(unsigned int i = 0; i < n; i++) {
+    double r = s[i]/sum;
+    if(r > 0. && r < 1.) {
+      m[i] = TMath::Power((r-1.)/TMath::Log(r), alpha);
+    } else if(r >= 1.) {
+      m[i] = 1.;
+    }
+    msum += m[i];
+  }
+  if(msum <= 0.) return;
+
+  // new edges holding an equal share of the importance
+  vector<double> old(edges);
+  double delta = msum/n;
+  double acc   = 0.;
+  unsigned int j = 0;
+  for(unsigned int k = 1; k < n; k++) {
+    double target = k*delta;
+    while(j < n-1 && acc + m[j] < target) {
+      acc += m[j];
+      j++;
+    }
+    double frac = (m[j] > 0.) ? (target-acc)/m[j] : 0.;
+    frac = TMath::Min(TMath::Max(frac, 0.), 1.);
+    edges[k] = old[j] + frac*(old[j+1]-old[j]);
+  }
+  edges[0] = 0.;
+  edges[n] = 1.;
+}
+//____________________________________________________________________________
+double genie::utils::math::Dilog(double x)
+{
+// Maps x to [-1/2,1/2] with the reflection & inversion relations of Li2 and
+// sums the Bernoulli series in u = -ln(1-x) there (to double precision)
+
+  const double kPi2Over6 = 1.6449340668482264; // Li2(1)
+
+  if(x == 1.) return kPi2Over6;
+  if(x >  1.) {
+    double l = TMath::Log(x);
+    return 2*kPi2Over6 - 0.5*l*l - Dilog(1./x);
+  }
+  if(x < -1.) {
+    double l = TMath::Log(-x);
+    return -kPi2Over6 - 0.5*l*l - Dilog(1./x);
+  }
+  if(x > 0.5) {
+    return kPi2Over6 - TMath::Log(x)*TMath::Log(1.-x) - Dilog(1.-x);
+  }
+  if(x < -0.5) {
+    double l = TMath::Log(1.-x);
+    return -Dilog(x/(x-1.)) - 0.5*l*l;
+  }
+
+  // B(2k)/(2k+1)!, k = 1,...,10
+  const int    kNTerms = 10;
+  const double kCoef[kNTerms] = {
+     2.7777777777777776e-02, -2.7777777777777778e-04,  4.7241118669690098e-06,
+    -9.1857730746619641e-08,  1.8978869988971001e-09, -4.0647616451442256e-11,
+     8.9216910204564523e-13, -1.9939295860721074e-14,  4.5189800296199183e-16,
+    -1.0356517612181247e-17
+  };
+
+  double u   = -TMath::Log(1.-x);
+  double u2  = u*u;
+  double sum = u - 0.25*u2;
+  double p   = u;
+  for(int k = 0; k < kNTerms; k++) {
+    p   *= u2;
+    sum += kCoef[k] * p;
+  }
+  return sum;
+}
+//____________________________________________________________________________
@@ -52,6 +52,16 @@ namespace math
   double NonNegative    (double x);
   double NonNegative    (float  x);
 
+  // Real dilogarithm Li2(x) = -int_0^1 ln(1-xt)/t dt (its real part for x > 1)
+  double    Dilog       (double x);
+
+  // Mixes a value into a 64-bit hash
+  ULong64_t HashCombine (ULong64_t hash, Long64_t value);
+
+  // Moves the edges (in [0,1]) of a VEGAS grid so that each bin holds an
+  // equal share of the bin contents d. Alpha damps the re-binning.
+  void      VegasRebin  (vector<double> & edges, const vector<double> & d, double alpha);
+
 } // math  namespace
 } // utils namespace
 } // genie namespace
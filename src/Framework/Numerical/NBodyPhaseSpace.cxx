@@ -0,0 +1,209 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <algorithm>
+#include <map>
+
+#include <TMath.h>
+#include <TRandom.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/NBodyPhaseSpace.h"
+
+using std::map;
+
+using namespace genie;
+
+//____________________________________________________________________________
+// Per-thread table of max decay weights, keyed by multiplicity, kinetic
+// energy release and total mass bins
+namespace {
+
+  const int    kNWeightSamples  = 1000; // weighted decays to estimate a max weight
+  const double kWeightSafety    = 1.2;  // safety factor on the max weight
+  const double kTBinsPerDecade  = 20.;  // kinetic energy release bins
+  const double kMassBin         = 0.1;  // total mass bins (GeV)
+
+  thread_local map<long, double> gMaxWeights;
+
+  // momentum of the decay products of a 2-body decay a -> b c
+  inline double PDK(double a, double b, double c)
+  {
+    double x = (a-b-c)*(a+b+c)*(a-b+c)*(a+b-c);
+    return TMath::Sqrt(TMath::Max(0., x)) / (2*a);
+  }
+}
+
+//____________________________________________________________________________
+NBodyPhaseSpace::NBodyPhaseSpace() :
+fN(0),
+fTCM(0.),
+fWtNorm(0.)
+{
+
+}
+//____________________________________________________________________________
+NBodyPhaseSpace::~NBodyPhaseSpace()
+{
+
+}
+//____________________________________________________________________________
+bool NBodyPhaseSpace::SetDecay(
+                      const TLorentzVector & p4, int n, const double * mass)
+{
+  fN = 0;
+  if(n < 2 || n > kMaxBodies) return false;
+
+  double mass_sum = 0;
+  for(int i = 0; i < n; i++) {
+    fMass[i]  = mass[i];
+    mass_sum += mass[i];
+  }
+  fTCM = p4.Mag() - mass_sum;
+  if(fTCM <= 0.) return false;
+
+  fN    = n;
+  fBeta = p4.BoostVector();
+
+  // analytical bound of the weight
+  double emmax = fTCM + fMass[0];
+  double emmin = 0.;
+  double wtmax = 1.;
+  for(int i = 1; i < fN; i++) {
+    emmin += fMass[i-1];
+    emmax += fMass[i];
+    wtmax *= PDK(emmax, emmin, fMass[i]);
+  }
+  fWtNorm = 1. / wtmax;
+
+  return true;
+}
+//____________________________________________________________________________
+double NBodyPhaseSpace::Generate(TRandom & rnd)
+{
+  if(fN < 2) return 0.;
+
+  // sorted random numbers -> invariant masses of the sub-systems 0..i
+  double rno    [kMaxBodies];
+  double invmass[kMaxBodies];
+  double pd     [kMaxBodies];
+
+  rno[0] = 0.;
+  for(int i = 1; i < fN-1; i++) rno[i] = rnd.Rndm();
+  rno[fN-1] = 1.;
+  std::sort(rno+1, rno+fN-1);
+
+  double sum = 0.;
+  for(int i = 0; i < fN; i++) {
+    sum       += fMass[i];
+    invmass[i] = rno[i] * fTCM + sum;
+  }
+
+  double wt = fWtNorm;
+  for(int i = 0; i < fN-1; i++) {
+    pd[i] = PDK(invmass[i+1], invmass[i], fMass[i+1]);
+    wt   *= pd[i];
+  }
+
+  // build the decay products, sub-system by sub-system
+  fDecay[0].SetPxPyPzE(0., pd[0], 0., TMath::Sqrt(pd[0]*pd[0] + fMass[0]*fMass[0]));
+  int i = 1;
+  while(true) {
+    fDecay[i].SetPxPyPzE(0., -pd[i-1], 0., TMath::Sqrt(pd[i-1]*pd[i-1] + fMass[i]*fMass[i]));
+
+    double cz  = 2*rnd.Rndm() - 1;
+    double sz  = TMath::Sqrt(1 - cz*cz);
+    double phi = 2*TMath::Pi() * rnd.Rndm();
+    double cy  = TMath::Cos(phi);
+    double sy  = TMath::Sin(phi);
+    for(int j = 0; j <= i; j++) {
+      TLorentzVector & v = fDecay[j];
+      double x = v.Px();
+      double y = v.Py();
+      v.SetPx( cz*x - sz*y );
+      v.SetPy( sz*x + cz*y );   // rotation around z
+      x = v.Px();
+      double z = v.Pz();
+      v.SetPx( cy*x - sy*z );
+      v.SetPz( sy*x + cy*z );   // rotation around y
+    }
+    if(i == fN-1) break;
+
+    double beta = pd[i] / TMath::Sqrt(pd[i]*pd[i] + invmass[i]*invmass[i]);
+    for(int j = 0; j <= i; j++) fDecay[j].Boost(0., beta, 0.);
+    i++;
+  }
+
+  // boost to the frame of the decaying system
+  for(int j = 0; j < fN; j++) fDecay[j].Boost(fBeta);
+
+  return wt;
+}
+//____________________________________________________________________________
+bool NBodyPhaseSpace::GenerateUnweighted(TRandom & rnd, unsigned int max_iter)
+{
+  if(fN < 2) return false;
+
+  double wmax = this->MaxWeight(rnd);
+
+  for(unsigned int itry = 0; itry < max_iter; itry++) {
+    double w = this->Generate(rnd);
+    if(w > wmax) {
+      LOG("NBodyPhaseSpace", pNOTICE)
+        << "Decay weight = " << w << " > max decay weight = " << wmax
+        << " for N = " << fN << ", T = " << fTCM << " GeV - Raising max weight";
+      this->SetMaxWeight(kWeightSafety * w);
+      wmax = kWeightSafety * w;
+    }
+    if(wmax * rnd.Rndm() <= w) return true;
+  }
+
+  LOG("NBodyPhaseSpace", pNOTICE)
+    << "Couldn't generate an unweighted phase space decay after "
+    << max_iter << " attempts";
+  return false;
+}
+//____________________________________________________________________________
+long NBodyPhaseSpace::WeightKey(void) const
+{
+  double mass_sum = 0.;
+  for(int i = 0; i < fN; i++) mass_sum += fMass[i];
+
+  long tbin = (long) TMath::Floor(kTBinsPerDecade * TMath::Log10(fTCM)) + 500;
+  long mbin = (long) TMath::Floor(mass_sum / kMassBin);
+
+  return (mbin * 1000 + tbin) * (kMaxBodies+1) + fN;
+}
+//____________________________________________________________________________
+double NBodyPhaseSpace::MaxWeight(TRandom & rnd)
+{
+  long key = this->WeightKey();
+  map<long, double>::const_iterator iter = gMaxWeights.find(key);
+  if(iter != gMaxWeights.end()) return iter->second;
+
+  double wmax = 0.;
+  for(int k = 0; k < kNWeightSamples; k++) {
+    wmax = TMath::Max(wmax, this->Generate(rnd));
+  }
+  wmax *= kWeightSafety;
+
+  LOG("NBodyPhaseSpace", pINFO)
+    << "Max phase space decay weight for N = " << fN << ", T = " << fTCM
+    << " GeV: " << wmax;
+
+  gMaxWeights[key] = wmax;
+  return wmax;
+}
+//____________________________________________________________________________
+void NBodyPhaseSpace::SetMaxWeight(double wmax)
+{
+  gMaxWeights[this->WeightKey()] = wmax;
+}
+//____________________________________________________________________________
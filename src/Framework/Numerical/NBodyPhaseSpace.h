@@ -0,0 +1,79 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::NBodyPhaseSpace
+
+\brief    An N-body phase space decay generator (GENBOD algorithm, F.James,
+          CERN 68-15, as in ROOT's TGenPhaseSpace) for the decays generated
+          many times per event, such as the compound nucleus break-up.
+
+          Unlike TGenPhaseSpace, it draws its random numbers from the input
+          (GENIE) random number generator, keeps the decay products in fixed
+          arrays, so that no memory is allocated while generating decays, and
+          generates unweighted decays itself: the max weight is tabulated per
+          thread in bins of (multiplicity, kinetic energy release, total
+          decay product mass) and is only
+          estimated once per bin (and raised if a larger weight is found)
+          rather than once per decay.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _NBODY_PHASE_SPACE_H_
+#define _NBODY_PHASE_SPACE_H_
+
+#include <TLorentzVector.h>
+#include <TVector3.h>
+
+class TRandom;
+
+namespace genie {
+
+class NBodyPhaseSpace {
+
+public:
+
+  NBodyPhaseSpace();
+ ~NBodyPhaseSpace();
+
+  //! Max number of decay products
+  static const int kMaxBodies = 18;
+
+  //! Set the decaying system 4-momentum and the masses of the n decay
+  //! products. Returns false if the decay is not kinematically allowed.
+  bool   SetDecay (const TLorentzVector & p4, int n, const double * mass);
+
+  //! Generate a weighted decay. The weight is at most 1.
+  double Generate (TRandom & rnd);
+
+  //! Generate an unweighted decay, trying at most max_iter weighted ones.
+  //! Returns false if no decay was accepted.
+  bool   GenerateUnweighted (TRandom & rnd, unsigned int max_iter);
+
+  int                    NBodies  (void)  const { return fN; }
+  const TLorentzVector & GetDecay (int i) const { return fDecay[i]; }
+
+private:
+
+  long   WeightKey    (void) const;
+  double MaxWeight    (TRandom & rnd);
+  void   SetMaxWeight (double wmax);
+
+  int            fN;                   ///< number of decay products
+  double         fMass  [kMaxBodies];  ///< decay product masses
+  double         fTCM;                 ///< kinetic energy release in the CM frame
+  double         fWtNorm;              ///< inverse of the analytical weight bound
+  TVector3       fBeta;                ///< boost of the decaying system
+  TLorentzVector fDecay [kMaxBodies];  ///< decay products
+};
+
+}      // genie namespace
+
+#endif // _NBODY_PHASE_SPACE_H_
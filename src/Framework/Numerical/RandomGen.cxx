@@ -16,6 +16,7 @@
 #include "Framework/Conventions/Controls.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/RandomStream.h"
 
 using namespace genie::controls;
 
@@ -23,12 +24,39 @@ namespace genie {
 
 //____________________________________________________________________________
 RandomGen * RandomGen::fInstance = 0;
+
+// Per-thread random number generation state used in multi-threaded event
+// generation mode (see RandomGen::SetThreadSeed, RandomGen::SetEventNumber).
+// Threads that never asked for a generator of their own fall back to the
+// shared one. The streams are created at their first use and are deleted
+// when the thread exits.
+namespace {
+  struct RandomGenThreadState {
+    RandomGenThreadState() : fRandom3(0), fStreamId(0), fEvent(0), fHasId(false) {
+      for(int i = 0; i < kMaxRndSubsystems; i++) fStreams[i] = 0;
+    }
+   ~RandomGenThreadState() {
+      if(fRandom3) delete fRandom3;
+      for(int i = 0; i < kMaxRndSubsystems; i++) {
+        if(fStreams[i]) delete fStreams[i];
+      }
+    }
+    static const int kMaxRndSubsystems = 16;
+    TRandom3 *        fRandom3;                     ///< thread TRandom3 (TRandom3 mode)
+    genie::RandomStream * fStreams[kMaxRndSubsystems]; ///< thread streams (counter-based mode)
+    unsigned int      fStreamId;                    ///< thread stream id
+    ULong64_t         fEvent;                       ///< current event number
+    bool              fHasId;                       ///< stream id set explicitly?
+  };
+  thread_local RandomGenThreadState gThreadState;
+}
 //____________________________________________________________________________
 RandomGen::RandomGen()
 {
   LOG("Rndm", pINFO) << "RandomGen late initialization";
 
   fInitalized = false;
+  fUseStreams = false;
   fInstance = 0;
 /*
   // try to get this job's random number seed from the environment
@@ -88,6 +116,8 @@ void RandomGen::SetSeed(long int seed)
      << ((fInitalized) ? ": " : " at random number generator initialization: ")
      << seed;
 
+  fCurrSeed = seed;
+
   // Set the seed number for all internal GENIE random number generators
   this->RndKine ().SetSeed(seed);
   this->RndHadro().SetSeed(seed);
@@ -123,6 +153,93 @@ void RandomGen::SetSeed(long int seed)
   LOG("Rndm", pINFO) << "PYTHIA6  seed = " << pythia6->GetMRPY(1);
 }
 //____________________________________________________________________________
+void RandomGen::SetThreadSeed(long int seed)
+{
+  if(fUseStreams) {
+    this->SetThreadStreamId( (unsigned int) seed );
+    return;
+  }
+
+  LOG("Rndm", pNOTICE)
+     << "Setting thread-local random number seed: " << seed;
+
+  if(!gThreadState.fRandom3) gThreadState.fRandom3 = new TRandom3();
+  gThreadState.fRandom3->SetSeed(seed);
+}
+//____________________________________________________________________________
+bool RandomGen::HasThreadGenerator(void) const
+{
+  if(fUseStreams) return gThreadState.fHasId;
+  return (gThreadState.fRandom3 != 0);
+}
+//____________________________________________________________________________
+void RandomGen::DeleteThreadGenerator(void)
+{
+  if(gThreadState.fRandom3) delete gThreadState.fRandom3;
+  gThreadState.fRandom3 = 0;
+  for(int i = 0; i < RandomGenThreadState::kMaxRndSubsystems; i++) {
+    if(gThreadState.fStreams[i]) delete gThreadState.fStreams[i];
+    gThreadState.fStreams[i] = 0;
+  }
+  gThreadState.fHasId = false;
+}
+//____________________________________________________________________________
+void RandomGen::UseCounterBasedStreams(bool on)
+{
+  LOG("Rndm", pNOTICE)
+     << "Using counter-based (Philox4x32-10) random number streams? "
+     << ((on) ? "Yes" : "No");
+
+  fUseStreams = on;
+}
+//____________________________________________________________________________
+void RandomGen::SetThreadStreamId(unsigned int id)
+{
+// Stream ids are limited to 24 bits (the top 8 bits of the counter word
+// identify the subsystem)
+  if(id > 0xFFFFFF) {
+    LOG("Rndm", pWARN)
+      << "Thread stream id " << id << " exceeds 24 bits - Truncating";
+  }
+  gThreadState.fStreamId = id & 0xFFFFFF;
+  gThreadState.fHasId    = true;
+  for(int i = 0; i < kNRndSubsystems; i++) {
+    RandomStream * stream = gThreadState.fStreams[i];
+    if(stream) stream->SetStream( (i << 24) | gThreadState.fStreamId );
+  }
+}
+//____________________________________________________________________________
+void RandomGen::SetEventNumber(long int n)
+{
+  gThreadState.fEvent = (ULong64_t) n;
+  for(int i = 0; i < kNRndSubsystems; i++) {
+    RandomStream * stream = gThreadState.fStreams[i];
+    if(stream) {
+      stream->SetKey  ( (ULong64_t) fCurrSeed );
+      stream->SetEvent( gThreadState.fEvent   );
+    }
+  }
+}
+//____________________________________________________________________________
+TRandom & RandomGen::Engine(int subsystem) const
+{
+  if(fUseStreams) return this->Stream(subsystem);
+
+  return (gThreadState.fRandom3) ? *gThreadState.fRandom3 : *fRandom3;
+}
+//____________________________________________________________________________
+RandomStream & RandomGen::Stream(int subsystem) const
+{
+  RandomStream * stream = gThreadState.fStreams[subsystem];
+  if(!stream) {
+    UInt_t id = (subsystem << 24) | gThreadState.fStreamId;
+    stream = new RandomStream( (ULong64_t) fCurrSeed, id );
+    stream->SetEvent(gThreadState.fEvent);
+    gThreadState.fStreams[subsystem] = stream;
+  }
+  return *stream;
+}
+//____________________________________________________________________________
 void RandomGen::InitRandomGenerators(long int seed)
 {
   fRandom3 = new TRandom3();
@@ -26,6 +26,8 @@
 
 namespace genie {
 
+class RandomStream;
+
 class RandomGen {
 
 public:
@@ -46,42 +48,67 @@ public:
   //! with a periodicity of 10**6000
   //! See: http://root.cern.ch/root/html/TRandom3.html
 
+  //! Alternatively, UseCounterBasedStreams() switches to independent
+  //! counter-based streams (see RandomStream): one per subsystem and per
+  //! thread, each being a function of (seed, subsystem, thread stream id,
+  //! event number). Events generated with a given event number are then
+  //! reproducible independently of the number of threads in the job and
+  //! threads never share a generator.
+
   //! rnd number generator used by kinematics generators
-  TRandom3 & RndKine (void) const { return *fRandom3; }
+  TRandom & RndKine (void) const { return this->Engine(kRndKine); }
 
   //! rnd number generator used by hadronization models
-  TRandom3 & RndHadro (void) const { return *fRandom3; }
+  TRandom & RndHadro (void) const { return this->Engine(kRndHadro); }
 
   //! rnd number generator used by decay models
-  TRandom3 & RndDec (void) const { return *fRandom3; }
+  TRandom & RndDec (void) const { return this->Engine(kRndDec); }
 
   //! rnd number generator used by intranuclear cascade monte carlos
-  TRandom3 & RndFsi (void) const { return *fRandom3; }
+  TRandom & RndFsi (void) const { return this->Engine(kRndFsi); }
 
   //! rnd number generator used by final state primary lepton generators
-  TRandom3 & RndLep (void) const { return *fRandom3; }
+  TRandom & RndLep (void) const { return this->Engine(kRndLep); }
 
   //! rnd number generator used by interaction selectors
-  TRandom3 & RndISel (void) const { return *fRandom3; }
+  TRandom & RndISel (void) const { return this->Engine(kRndISel); }
 
   //! rnd number generator used by geometry drivers
-  TRandom3 & RndGeom (void) const { return *fRandom3; }
+  TRandom & RndGeom (void) const { return this->Engine(kRndGeom); }
 
   //! rnd number generator used by flux drivers
-  TRandom3 & RndFlux (void) const { return *fRandom3; }
+  TRandom & RndFlux (void) const { return this->Engine(kRndFlux); }
 
   //! rnd number generator used by the event generation drivers
-  TRandom3 & RndEvg (void) const { return *fRandom3; }
+  TRandom & RndEvg (void) const { return this->Engine(kRndEvg); }
 
   //! rnd number generator used by MC integrators & other numerical methods
-  TRandom3 & RndNum (void) const { return *fRandom3; }
+  TRandom & RndNum (void) const { return this->Engine(kRndNum); }
 
   //! rnd number generator for generic usage
-  TRandom3 & RndGen  (void) const { return *fRandom3; }
+  TRandom & RndGen  (void) const { return this->Engine(kRndGen); }
 
   long int GetSeed (void)         const { return fCurrSeed; }
   void     SetSeed (long int seed);
 
+  //! Multi-threaded event generation: give the calling thread its own
+  //! generator, seeded with the input seed. All accessors called from that
+  //! thread return the thread generator from then on, while all other threads
+  //! keep using the shared one. Calling it again simply re-seeds it.
+  //! With counter-based streams, the input is used as the stream id of the
+  //! calling thread instead (the stream key is always the job seed).
+  void     SetThreadSeed        (long int seed);
+  bool     HasThreadGenerator   (void) const;
+  void     DeleteThreadGenerator(void);
+
+  //! Counter-based streams. Switch them on before generating anything.
+  //! SetThreadStreamId() and SetEventNumber() act on the calling thread;
+  //! SetEventNumber() rewinds all of its streams to the start of that event.
+  void     UseCounterBasedStreams   (bool on = true);
+  bool     UsingCounterBasedStreams (void) const { return fUseStreams; }
+  void     SetThreadStreamId        (unsigned int id);
+  void     SetEventNumber           (long int n);
+
 private:
 
   RandomGen();
@@ -90,12 +117,22 @@ private:
 
   static RandomGen * fInstance;
 
+  //! GENIE subsystems drawing random numbers (one stream each)
+  enum ERndSubsystem {
+    kRndKine = 0, kRndHadro, kRndDec, kRndFsi, kRndLep, kRndISel,
+    kRndGeom, kRndFlux, kRndEvg, kRndNum, kRndGen, kNRndSubsystems
+  };
+
   TRandom3 * fRandom3;    ///< Mersenne Twistor
   long int   fCurrSeed;   ///< random number generator seed number
   bool       fInitalized; ///< done initializing singleton?
+  bool       fUseStreams; ///< use counter-based streams?
 
   void InitRandomGenerators(long int seed);
 
+  TRandom &      Engine (int subsystem) const;
+  RandomStream & Stream (int subsystem) const;
+
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
       ~Cleaner() {
@@ -0,0 +1,150 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include "Framework/Numerical/RandomStream.h"
+
+using namespace genie;
+
+ClassImp(RandomStream)
+
+// Philox4x32 multipliers and Weyl sequence key increments
+static const UInt_t kPhiloxM0 = 0xD2511F53;
+static const UInt_t kPhiloxM1 = 0xCD9E8D57;
+static const UInt_t kPhiloxW0 = 0x9E3779B9;
+static const UInt_t kPhiloxW1 = 0xBB67AE85;
+
+// 2^-32: maps a 32-bit word to (0,1) as (word + 0.5) * 2^-32
+static const Double_t kTwoToMinus32 = 2.3283064365386963e-10;
+
+//____________________________________________________________________________
+RandomStream::RandomStream() :
+TRandom()
+{
+  this->SetName("RandomStream");
+  this->SetTitle("Philox4x32-10 counter-based random number stream");
+  fKey      = 0;
+  fStreamId = 0;
+  this->SetEvent(0);
+}
+//____________________________________________________________________________
+RandomStream::RandomStream(ULong64_t seed, UInt_t stream_id) :
+TRandom()
+{
+  this->SetName("RandomStream");
+  this->SetTitle("Philox4x32-10 counter-based random number stream");
+  this->SetKey(seed);
+  fStreamId = stream_id;
+  this->SetEvent(0);
+}
+//____________________________________________________________________________
+RandomStream::~RandomStream()
+{
+
+}
+//____________________________________________________________________________
+void RandomStream::SetKey(ULong64_t seed)
+{
+  fKey  = seed;
+  fSeed = (UInt_t) seed;
+  this->SetEvent(fEvent);
+}
+//____________________________________________________________________________
+void RandomStream::SetStream(UInt_t stream_id)
+{
+  fStreamId = stream_id;
+  this->SetEvent(fEvent);
+}
+//____________________________________________________________________________
+void RandomStream::SetEvent(ULong64_t event)
+{
+  fEvent  = event;
+  fNDraws = 0;
+  fNext   = 4; // force generating a new block at the next draw
+}
+//____________________________________________________________________________
+void RandomStream::Philox(
+        const UInt_t ctr[4], const UInt_t key[2], UInt_t out[4])
+{
+  UInt_t c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+  UInt_t k0 = key[0], k1 = key[1];
+
+  for(int iround = 0; iround < 10; iround++) {
+    if(iround > 0) {
+      k0 += kPhiloxW0;
+      k1 += kPhiloxW1;
+    }
+    ULong64_t p0 = (ULong64_t) kPhiloxM0 * c0;
+    ULong64_t p1 = (ULong64_t) kPhiloxM1 * c2;
+    UInt_t hi0 = (UInt_t) (p0 >> 32), lo0 = (UInt_t) p0;
+    UInt_t hi1 = (UInt_t) (p1 >> 32), lo1 = (UInt_t) p1;
+    c0 = hi1 ^ c1 ^ k0;
+    c1 = lo1;
+    c2 = hi0 ^ c3 ^ k1;
+    c3 = lo0;
+  }
+  out[0] = c0; out[1] = c1; out[2] = c2; out[3] = c3;
+}
+//____________________________________________________________________________
+void RandomStream::NextBlock(void)
+{
+// Counter layout: [draws mod 2^32, stream id, event (low), event (high)].
+// An event can use 2^34 random numbers before its sequence wraps around.
+
+  UInt_t ctr[4] = {
+     (UInt_t)  fNDraws,
+               fStreamId,
+     (UInt_t)  fEvent,
+     (UInt_t) (fEvent >> 32)
+  };
+  UInt_t key[2] = {
+     (UInt_t)  fKey,
+     (UInt_t) (fKey >> 32)
+  };
+  RandomStream::Philox(ctr, key, fBlock);
+  fNDraws++;
+  fNext = 0;
+}
+//____________________________________________________________________________
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+Double_t RandomStream::Rndm(void)
+#else
+Double_t RandomStream::Rndm(Int_t)
+#endif
+{
+  if(fNext >= 4) this->NextBlock();
+  return (fBlock[fNext++] + 0.5) * kTwoToMinus32;
+}
+//____________________________________________________________________________
+void RandomStream::RndmArray(Int_t n, Float_t * array)
+{
+  for(Int_t i = 0; i < n; i++) {
+    if(fNext >= 4) this->NextBlock();
+    // drop the low bits that a float can not hold, to stay in (0,1)
+    array[i] = (Float_t) (((fBlock[fNext++] >> 8) + 0.5) * (1./16777216.));
+  }
+}
+//____________________________________________________________________________
+void RandomStream::RndmArray(Int_t n, Double_t * array)
+{
+  for(Int_t i = 0; i < n; i++) {
+    if(fNext >= 4) this->NextBlock();
+    array[i] = (fBlock[fNext++] + 0.5) * kTwoToMinus32;
+  }
+}
+//____________________________________________________________________________
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+void RandomStream::SetSeed(ULong_t seed)
+#else
+void RandomStream::SetSeed(UInt_t seed)
+#endif
+{
+  this->SetKey( (ULong64_t) seed );
+}
+//____________________________________________________________________________
@@ -0,0 +1,88 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::RandomStream
+
+\brief    A counter-based random number stream (Philox4x32-10, see J.K.Salmon
+          et al, "Parallel Random Numbers: As Easy as 1, 2, 3", SC11).
+
+          Each random number is a pure function of a (key, counter) pair.
+          The 64-bit key is derived from the job seed. The 128-bit counter is
+          made of the event number, a stream id (typically identifying the
+          GENIE subsystem and the thread / worker that uses the stream) and
+          the number of draws since the start of the event.
+          Therefore, setting the same (seed, stream id, event number) always
+          reproduces the same sequence, independently of what happens in any
+          other stream and of the number of threads running the job.
+
+          Implements the TRandom interface so that it can be used in place of
+          the default TRandom3 generator (see RandomGen).
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _RANDOM_STREAM_H_
+#define _RANDOM_STREAM_H_
+
+#include <RVersion.h>
+#include <TRandom.h>
+
+namespace genie {
+
+class RandomStream : public TRandom {
+
+public:
+
+  RandomStream();
+  RandomStream(ULong64_t seed, UInt_t stream_id);
+  virtual ~RandomStream();
+
+  //! Set the key, the stream id and the event number. Each call to
+  //! SetEvent() rewinds the stream to the first draw of that event.
+  void SetKey    (ULong64_t seed);
+  void SetStream (UInt_t stream_id);
+  void SetEvent  (ULong64_t event);
+
+  ULong64_t Key      (void) const { return fKey;      }
+  UInt_t    StreamId (void) const { return fStreamId; }
+  ULong64_t Event    (void) const { return fEvent;    }
+  ULong64_t NDraws   (void) const { return fNDraws;   }
+
+  //! The raw Philox4x32-10 bijection (exposed for testing)
+  static void Philox (const UInt_t ctr[4], const UInt_t key[2], UInt_t out[4]);
+
+  //! TRandom interface
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+  virtual Double_t Rndm      (void);
+  virtual void     SetSeed   (ULong_t seed = 0);
+#else
+  virtual Double_t Rndm      (Int_t i = 0);
+  virtual void     SetSeed   (UInt_t seed = 0);
+#endif
+  virtual void     RndmArray (Int_t n, Float_t  * array);
+  virtual void     RndmArray (Int_t n, Double_t * array);
+
+private:
+
+  void NextBlock (void);
+
+  ULong64_t fKey;      ///< key (derived from the job seed)
+  UInt_t    fStreamId; ///< stream id
+  ULong64_t fEvent;    ///< event number
+  ULong64_t fNDraws;   ///< number of 4-word blocks generated since SetEvent()
+  UInt_t    fBlock[4]; ///< current block of random words
+  int       fNext;     ///< position of the next unused word in fBlock
+
+ClassDef(RandomStream,1)
+};
+
+}      // genie namespace
+
+#endif // _RANDOM_STREAM_H_
@@ -11,6 +11,7 @@
 #include <cassert>
 #include <iomanip>
 #include <cfloat>
+#include <cstring>
 
 #include "libxml/parser.h"
 #include "libxml/xmlmemory.h"
@@ -133,7 +134,13 @@ Spline::Spline(const Spline & spline) :
 {
   LOG("Spline", pDEBUG) << "Spline copy constructor";
 
-  this->LoadFromTSpline3( *spline.GetAsTSpline(), spline.NKnots() );
+  // from the knots, not to re-build the TSpline3 of a compact spline
+  int nknots = spline.NKnots();
+  vector<double> x(nknots), y(nknots);
+  for(int i = 0; i < nknots; i++) spline.GetKnot(i, x[i], y[i]);
+
+  this->InitSpline();
+  if(nknots > 0) this->BuildSpline(nknots, &x[0], &y[0]);
 }
 //___________________________________________________________________________
 Spline::Spline(const TSpline3 & spline, int nknots) :
@@ -154,85 +161,48 @@ bool Spline::LoadFromXmlFile(string filename, string xtag, string ytag)
 {
   LOG("Spline", pDEBUG) << "Retrieving data from file: " << filename;
 
-  xmlDocPtr xml_doc = xmlParseFile(filename.c_str());
+  // stream through the file (no DOM tree): the knots are converted straight
+  // into the x,y arrays
+  xmlTextReaderPtr reader = xmlNewTextReaderFilename(filename.c_str());
 
-  if(xml_doc==NULL) {
-    LOG("Spline", pERROR)
-           << "XML file could not be parsed! [filename: " << filename << "]";
-    return false;
+  int ret = (reader==NULL) ? -1 : xmlTextReaderRead(reader);
+  while (ret == 1 && xmlTextReaderNodeType(reader) != XML_READER_TYPE_ELEMENT) {
+    ret = xmlTextReaderRead(reader);
   }
-
-  xmlNodePtr xmlCur = xmlDocGetRootElement(xml_doc);
-
-  if(xmlCur==NULL) {
+  if(ret != 1) {
     LOG("Spline", pERROR)
-         << "XML doc. has null root element! [filename: " << filename << "]";
+           << "XML file could not be parsed! [filename: " << filename << "]";
+    if(reader) xmlFreeTextReader(reader);
     return false;
   }
-  if( xmlStrcmp(xmlCur->name, (const xmlChar *) "spline") ) {
+  if( !xmlStrEqual(xmlTextReaderConstLocalName(reader), (const xmlChar *) "spline") ) {
     LOG("Spline", pERROR)
       << "XML doc. has invalid root element! [filename: " << filename << "]";
+    xmlFreeTextReader(reader);
     return false;
   }
 
-  string name = utils::str::TrimSpaces(
-                    utils::xml::GetAttribute(xmlCur, "name"));
-  string snkn = utils::str::TrimSpaces(
-                    utils::xml::GetAttribute(xmlCur, "nknots"));
-  int nknots = atoi( snkn.c_str() );
+  string name = utils::xml::GetAttribute(reader, "name");
+
+  vector<double> vx, vy;
+  int nknots = utils::xml::ReadKnots(reader, xtag.c_str(), ytag.c_str(), vx, vy);
+  xmlFreeTextReader(reader);
 
   LOG("Spline", pINFO)
-             << "Parsing XML spline: " << name << ", nknots = " << nknots;
-
-  int      iknot = 0;
-  double * vx    = new double[nknots];
-  double * vy    = new double[nknots];
-
-  xmlNodePtr xmlSplChild = xmlCur->xmlChildrenNode; // <knots>'s
-
-  // loop over all xml tree nodes that are children of the <spline> node
-  while (xmlSplChild != NULL) {
-     LOG("Spline", pDEBUG)
-                 << "Got <spline> children node: " << xmlSplChild->name;
-
-     // enter everytime you find a <knot> tag
-     if( (!xmlStrcmp(xmlSplChild->name, (const xmlChar *) "knot")) ) {
-
-        xmlNodePtr xmlKnotChild = xmlSplChild->xmlChildrenNode;
-
-        // loop over all xml tree nodes that are children of this <knot>
-        while (xmlKnotChild != NULL) {
-           LOG("Spline", pDEBUG)
-                 << "Got <knot> children node: "  << xmlKnotChild->name;
-
-           // enter everytime you find a <E> or a <xsec> tag
-           const xmlChar * tag = xmlKnotChild->name;
-           bool is_xtag = ! xmlStrcmp(tag,(const xmlChar *) xtag.c_str());
-           bool is_ytag = ! xmlStrcmp(tag,(const xmlChar *) ytag.c_str());
-           if (is_xtag || is_ytag) {
-              xmlNodePtr xmlValTagChild = xmlKnotChild->xmlChildrenNode;
-              string val = utils::xml::TrimSpaces(
-                         xmlNodeListGetString(xml_doc, xmlValTagChild, 1));
-
-              if (is_xtag) vx[iknot] = atof(val.c_str());
-              if (is_ytag) vy[iknot] = atof(val.c_str());
-
-              xmlFree(xmlValTagChild);
-              LOG("Spline", pDEBUG) << "tag: " << tag << ", value: " << val;
-           }//if current tag is <E>,<xsec>
-
-           xmlKnotChild = xmlKnotChild->next;
-        }//[end of] loop over tags within <knot>...</knot> tags
-        xmlFree(xmlKnotChild);
-        iknot++;
-     } // if <knot>
-     xmlSplChild = xmlSplChild->next;
-  } //[end of] loop over tags within <spline>...</spline> tags
-  xmlFree(xmlSplChild);
-
-  this->BuildSpline(nknots, vx, vy);
-  delete [] vx;
-  delete [] vy;
+             << "Parsing XML spline: " << name << ", nknots = " << vx.size();
+
+  if(nknots < 0) {
+    LOG("Spline", pERROR)
+           << "XML file could not be parsed! [filename: " << filename << "]";
+    return false;
+  }
+  if(nknots != (int) vx.size()) {
+    LOG("Spline", pWARN)
+      << "Read " << nknots << " knots, expected " << vx.size();
+    nknots = TMath::Min(nknots, (int) vx.size());
+  }
+
+  this->BuildSpline(nknots, &vx[0], &vy[0]);
 
   return true;
 }
@@ -321,8 +291,36 @@ bool Spline::LoadFromTSpline3(const TSpline3 & spline, int nknots)
   return true;
 }
 //___________________________________________________________________________
+bool Spline::LoadFromBuffer(int nknots, const double * knots)
+{
+// Uses the input buffer of (x, y, b, c, d) values for each knot, as written
+// by KnotData(), without copying it. The buffer (eg a memory-mapped spline
+// file) must outlive the spline.
+
+  this->ResetSpline();
+  if(!knots || nknots < 2) {
+     LOG("Spline", pWARN) << "Can't load spline from an invalid knot buffer";
+     return false;
+  }
+  fNKnots = nknots;
+  fKnots  = knots;
+  fXMin   = knots[0];
+  fXMax   = knots[5*(nknots-1)];
+  fYMax   = knots[1];
+  for(int i = 1; i < nknots; i++) {
+     fYMax = TMath::Max(fYMax, knots[5*i+1]);
+  }
+  this->BuildLookup();
+  return true;
+}
+//___________________________________________________________________________
 void Spline::GetKnot(int iknot, double & x, double & y) const
 {
+  if(this->HasTables()) {
+     x = this->KnotX(iknot);
+     y = this->KnotY(iknot);
+     return;
+  }
   if(!fInterpolator) {
      LOG("Spline", pWARN) << "Spline has not been built yet!";
      return;
@@ -332,6 +330,7 @@ void Spline::GetKnot(int iknot, double & x, double & y) const
 //___________________________________________________________________________
 double Spline::GetKnotX(int iknot) const
 {
+  if(this->HasTables()) return this->KnotX(iknot);
   if(!fInterpolator) {
      LOG("Spline", pWARN) << "Spline has not been built yet!";
      return 0;
@@ -343,6 +342,7 @@ double Spline::GetKnotX(int iknot) const
 //___________________________________________________________________________
 double Spline::GetKnotY(int iknot) const
 {
+  if(this->HasTables()) return this->KnotY(iknot);
   if(!fInterpolator) {
      LOG("Spline", pWARN) << "Spline has not been built yet!";
      return 0;
@@ -364,7 +364,11 @@ double Spline::Evaluate(double x) const
   assert(!TMath::IsNaN(x));
 
   double y = 0;
-  if( this->IsWithinValidRange(x) ) {
+  if( this->IsWithinValidRange(x) && this->HasTables() ) {
+
+    y = this->EvaluateNative(x);
+
+  } else if( this->IsWithinValidRange(x) ) {
 
     // we can interpolate within the range of spline knots - be careful with
     // strange cubic spline behaviour when close to knots with y=0
@@ -409,6 +413,71 @@ double Spline::Evaluate(double x) const
   return y;
 }
 //___________________________________________________________________________
+double Spline::EvaluateNative(double x) const
+{
+  return (fKnotsF) ? this->EvaluateNative(fKnotsF, x) :
+                     this->EvaluateNative(fKnots,  x);
+}
+//___________________________________________________________________________
+template<class T> double Spline::EvaluateNative(const T * knots, double x) const
+{
+// Evaluates the spline at x in [xmin, xmax], as Evaluate() does via the
+// TSpline3, using the knot lookup table and the copied TSpline3 coefficients.
+// TSpline3::Eval uses the polynomial of the last knot below x, and that of
+// the penultimate knot at the upper edge.
+
+  double y = 0;
+  int iknot = TMath::Min(this->FindKnot(knots, x), fNKnots-2);
+  const T * cn = knots + 5*iknot;
+  const T * cp = cn + 5;
+
+  bool is0p = utils::math::AreEqual(cp[1],0);
+  bool is0n = utils::math::AreEqual(cn[1],0);
+
+  if(!is0p && !is0n) {
+    double dx = x - cn[0];
+    y = (cn[1] + dx*(cn[2] + dx*(cn[3] + dx*cn[4])));
+  } else if(is0p && is0n) {
+    y = 0;
+  } else {
+    if(is0n) y = cp[1] * (x-cn[0])/(cp[0]-cn[0]);
+    else     y = cn[1] * (x-cn[0])/(cp[0]-cn[0]);
+  }
+  return y;
+}
+//___________________________________________________________________________
+void Spline::Evaluate(const double x[], double y[], unsigned int n) const
+{
+// Evaluates the spline at the n input points. Gives the same values as
+// calling Evaluate(x[i]) for each point, without the per-point printouts.
+
+  if(!this->HasTables()) {
+    for(unsigned int i = 0; i < n; i++) y[i] = this->Evaluate(x[i]);
+    return;
+  }
+  for(unsigned int i = 0; i < n; i++) {
+    y[i] = (this->IsWithinValidRange(x[i])) ? this->EvaluateNative(x[i]) : 0.;
+  }
+}
+//___________________________________________________________________________
+void Spline::Evaluate(
+      const Spline * const spl[], unsigned int nspl, double x, double y[])
+{
+// Evaluates each of the nspl input splines at the same point x.
+// Null splines evaluate to 0.
+
+  for(unsigned int i = 0; i < nspl; i++) {
+    const Spline * s = spl[i];
+    if(!s) {
+      y[i] = 0.;
+    } else if(!s->HasTables()) {
+      y[i] = s->Evaluate(x);
+    } else {
+      y[i] = (s->IsWithinValidRange(x)) ? s->EvaluateNative(x) : 0.;
+    }
+  }
+}
+//___________________________________________________________________________
 void Spline::SaveAsXml(
                 string filename, string xtag, string ytag, string name) const
 {
@@ -440,7 +509,7 @@ void Spline::SaveAsXml(
   double x=0, y=0;
   for(int iknot = 0; iknot < nknots; iknot++)
   {
-    fInterpolator->GetKnot(iknot, x, y);
+    this->GetKnot(iknot, x, y);
 
     ofs  << std::fixed << setprecision(5);
     ofs  << "\t<knot>"
@@ -466,7 +535,7 @@ void Spline::SaveAsText(string filename, string format) const
 
   double x=0, y=0;
   for(int iknot = 0; iknot < nknots; iknot++) {
-    fInterpolator->GetKnot(iknot, x, y);
+    this->GetKnot(iknot, x, y);
     char line[1024];
     sprintf(line,format.c_str(),x,y);
     outtxt << line << endl;
@@ -482,7 +551,8 @@ void Spline::SaveAsROOT(string filename, string name, bool recreate) const
   string opt = ( (recreate) ? "RECREATE" : "UPDATE" );
 
   TFile f(filename.c_str(), opt.c_str());
-  if(fInterpolator) fInterpolator->Write(spline_name.c_str());
+  TSpline3 * interpolator = this->GetAsTSpline();
+  if(interpolator) interpolator->Write(spline_name.c_str());
   f.Close();
 }
 //___________________________________________________________________________
@@ -508,8 +578,10 @@ TGraph * Spline::GetAsTGraph(
 
   for(int i=0; i<np; i++) {
       x[i] = ( (use_log) ? TMath::Power(10, xmin+i*dx) : xmin + i*dx );
-      y[i] = this->Evaluate( x[i] );
+  }
+  this->Evaluate(x, y, np);
 
+  for(int i=0; i<np; i++) {
       // scale with x if needed
       if (scale_with_x) y[i] /= x[i];
 
@@ -534,11 +606,17 @@ void Spline::FindClosestKnot(
 
   if(!pos && !neg) return;
 
-  int iknot = fInterpolator->FindX(x);
+  int iknot = this->FindKnot(x);
 
   double xp=0, yp=0, xn=0, yn=0;
-  fInterpolator->GetKnot(iknot,  xn,yn);
-  fInterpolator->GetKnot(iknot+1,xp,yp);
+  if(this->HasTables()) {
+    int jknot = TMath::Min(iknot+1, fNKnots-1);
+    xn = this->KnotX(iknot); yn = this->KnotY(iknot);
+    xp = this->KnotX(jknot); yp = this->KnotY(jknot);
+  } else {
+    fInterpolator->GetKnot(iknot,  xn,yn);
+    fInterpolator->GetKnot(iknot+1,xp,yp);
+  }
 
   bool p = (TMath::Abs(x-xp) < TMath::Abs(x-xn));
 
@@ -559,6 +637,70 @@ bool Spline::ClosestKnotValueIsZero(double x, Option_t * opt) const
   return false;
 }
 //___________________________________________________________________________
+size_t Spline::ByteSize(void) const
+{
+  size_t nbytes = sizeof(Spline) + fName.capacity();
+  nbytes += fCoeff.capacity()  * sizeof(double);
+  nbytes += fCoeffF.capacity() * sizeof(float);
+  nbytes += fLookup.capacity() * sizeof(int);
+  if(fInterpolator) {
+    nbytes += sizeof(TSpline3) + fNKnots * sizeof(TSplinePoly3);
+  }
+  return nbytes;
+}
+//___________________________________________________________________________
+void Spline::GetKnotData(vector<double> & knots) const
+{
+// The knot x, y and cubic coefficients b, c, d (5 values per knot), as
+// KnotData(), whatever the storage precision (empty if there are none)
+
+  knots.clear();
+  if(fKnots)  knots.assign(fKnots,  fKnots  + 5*fNKnots);
+  if(fKnotsF) knots.assign(fKnotsF, fKnotsF + 5*fNKnots);
+}
+//___________________________________________________________________________
+bool Spline::HasKnotData(const double * knots) const
+{
+  if(!knots) return false;
+  if(fKnots) {
+    return (memcmp(fKnots, knots, 5 * fNKnots * sizeof(double)) == 0);
+  }
+  if(fKnotsF) {
+    for(int i = 0; i < 5*fNKnots; i++) {
+      if(fKnotsF[i] != (float) knots[i]) return false;
+    }
+    return true;
+  }
+  return false;
+}
+//___________________________________________________________________________
+void Spline::Compact(bool single_precision)
+{
+// Splines with no coefficient array (less than 2 knots) keep their TSpline3,
+// and the ones using an external buffer have none and copy nothing
+
+  if(!this->HasTables()) return;
+
+  if(fInterpolator) {
+    delete fInterpolator;
+    fInterpolator = 0;
+  }
+  if(fCoeff.empty()) return;
+
+  if(single_precision) {
+    fCoeffF.assign(fCoeff.begin(), fCoeff.end());
+    fKnotsF = &fCoeffF[0];
+    vector<double>().swap(fCoeff);
+    fKnots = 0;
+    // the rounded knots may sit across the bucket edges
+    this->BuildLookup();
+  } else {
+    vector<double>(fCoeff).swap(fCoeff);
+    fKnots = &fCoeff[0];
+  }
+  vector<int>(fLookup).swap(fLookup);
+}
+//___________________________________________________________________________
 void Spline::Print(ostream & stream) const
 {
   int    nknots = this->NKnots();
@@ -592,14 +734,20 @@ void Spline::Add(const Spline & spl, double c)
   double * x = new double[nknots];
   double * y = new double[nknots];
 
+  double * ys = new double[nknots];
+
   for(int i=0; i<nknots; i++) {
     this->GetKnot(i,x[i],y[i]);
-    y[i] += (c * spl.Evaluate(x[i]));
+  }
+  spl.Evaluate(x, ys, nknots);
+  for(int i=0; i<nknots; i++) {
+    y[i] += (c * ys[i]);
   }
   this->ResetSpline();
   this->BuildSpline(nknots,x,y);
   delete [] x;
   delete [] y;
+  delete [] ys;
 }
 //___________________________________________________________________________
 void Spline::Multiply(const Spline & spl, double c)
@@ -617,14 +765,20 @@ void Spline::Multiply(const Spline & spl, double c)
   double * x = new double[nknots];
   double * y = new double[nknots];
 
+  double * ys = new double[nknots];
+
   for(int i=0; i<nknots; i++) {
     this->GetKnot(i,x[i],y[i]);
-    y[i] *= (c * spl.Evaluate(x[i]));
+  }
+  spl.Evaluate(x, ys, nknots);
+  for(int i=0; i<nknots; i++) {
+    y[i] *= (c * ys[i]);
   }
   this->ResetSpline();
   this->BuildSpline(nknots,x,y);
   delete [] x;
   delete [] y;
+  delete [] ys;
 }
 //___________________________________________________________________________
 void Spline::Divide(const Spline & spl, double c)
@@ -642,14 +796,20 @@ void Spline::Divide(const Spline & spl, double c)
   double * x = new double[nknots];
   double * y = new double[nknots];
 
+  double * ys = new double[nknots];
+
   for(int i=0; i<nknots; i++) {
     this->GetKnot(i,x[i],y[i]);
-    double denom = c * spl.Evaluate(x[i]);
+  }
+  spl.Evaluate(x, ys, nknots);
+  for(int i=0; i<nknots; i++) {
+    double denom = c * ys[i];
     bool denom_is_zero = TMath::Abs(denom) < DBL_EPSILON;
     if(denom_is_zero) {
         LOG("Spline", pERROR) << "** Refusing to divide spline knot by 0";
         delete [] x;
         delete [] y;
+        delete [] ys;
         return;
     }
     y[i] /= denom;
@@ -658,6 +818,7 @@ void Spline::Divide(const Spline & spl, double c)
   this->BuildSpline(nknots,x,y);
   delete [] x;
   delete [] y;
+  delete [] ys;
 }
 //___________________________________________________________________________
 void Spline::Add(double a)
@@ -726,6 +887,15 @@ void Spline::InitSpline(void)
 
   fYCanBeNegative = false;
 
+  fCoeff.clear();
+  fKnots = 0;
+  fCoeffF.clear();
+  fKnotsF = 0;
+  fLookup.clear();
+  fLookupInLog = false;
+  fLookupU0    = 0.;
+  fLookupInvDU = 0.;
+
   LOG("Spline", pDEBUG) << "...done initializing spline";
 }
 //___________________________________________________________________________
@@ -751,6 +921,123 @@ void Spline::BuildSpline(int nentries, double x[], double y[])
 
   fInterpolator = new TSpline3("spl3", x, y, nentries, "0");
 
+  // copy the knots and cubic coefficients in a contiguous array
+  fCoeff.clear();
+  fKnots = 0;
+  fCoeffF.clear();
+  fKnotsF = 0;
+  fLookup.clear();
+  if(nentries > 1) {
+    fCoeff.resize(5*nentries);
+    for(int i = 0; i < nentries; i++) {
+      double * c = &fCoeff[5*i];
+      fInterpolator->GetCoeff(i, c[0], c[1], c[2], c[3], c[4]);
+    }
+    fKnots = &fCoeff[0];
+    this->BuildLookup();
+  }
+
   LOG("Spline", pDEBUG) << "...done building spline";
 }
 //___________________________________________________________________________
+TSpline3 * Spline::GetAsTSpline(void) const
+{
+// Splines loaded from a knot buffer, and compact ones, build their TSpline3
+// only when asked
+
+  if(!fInterpolator && this->HasTables() && fNKnots > 1) {
+    double * x = new double[fNKnots];
+    double * y = new double[fNKnots];
+    for(int i = 0; i < fNKnots; i++) {
+      x[i] = this->KnotX(i);
+      y[i] = this->KnotY(i);
+    }
+    fInterpolator = new TSpline3("spl3", x, y, fNKnots, "0");
+    delete [] x;
+    delete [] y;
+  }
+  return fInterpolator;
+}
+//___________________________________________________________________________
+void Spline::BuildLookup(void)
+{
+  if(fKnotsF) this->BuildLookup(fKnotsF);
+  else        this->BuildLookup(fKnots);
+}
+//___________________________________________________________________________
+template<class T> void Spline::BuildLookup(const T * knots)
+{
+// Split the [xmin, xmax] range in n-1 buckets, equal in x if the knots are
+// equidistant, or else equal in log(x) (x>0), and store the highest knot
+// below the lower edge of each bucket.
+
+  int n = fNKnots;
+
+  double dxmean = (fXMax - fXMin) / (n-1);
+  bool uniform = true;
+  for(int i = 1; i < n && uniform; i++) {
+    double dx = knots[5*i] - knots[5*(i-1)];
+    uniform = (TMath::Abs(dx - dxmean) < 1E-6 * dxmean);
+  }
+  fLookupInLog = (!uniform && fXMin > 0);
+
+  double u0 = (fLookupInLog) ? TMath::Log(fXMin) : fXMin;
+  double u1 = (fLookupInLog) ? TMath::Log(fXMax) : fXMax;
+  if(u1 <= u0) {
+    fLookup.clear();
+    return;
+  }
+  int nb = n-1;
+  fLookupU0    = u0;
+  fLookupInvDU = nb / (u1 - u0);
+
+  fLookup.resize(nb+1);
+  int k = 0;
+  for(int ib = 0; ib <= nb; ib++) {
+    double ub = u0 + ib * (u1 - u0) / nb;
+    double xb = (fLookupInLog) ? TMath::Exp(ub) : ub;
+    while(k < n-1 && knots[5*(k+1)] < xb) k++;
+    fLookup[ib] = k;
+  }
+}
+//___________________________________________________________________________
+int Spline::FindKnot(double x) const
+{
+  if(fKnotsF) return this->FindKnot(fKnotsF, x);
+  if(fKnots)  return this->FindKnot(fKnots,  x);
+
+  return fInterpolator->FindX(x);
+}
+//___________________________________________________________________________
+template<class T> int Spline::FindKnot(const T * knots, double x) const
+{
+// Returns the highest knot strictly below x (0 if x <= xmin, and n-1 if
+// x >= xmax), as TSpline3::FindX
+
+  int n = fNKnots;
+  if(x <= fXMin) return 0;
+  if(x >= fXMax) return n-1;
+
+  int lo = 0;
+  int hi = n-1;
+  int nb = (int) fLookup.size() - 1;
+  if(nb > 0) {
+    double u  = (fLookupInLog) ? TMath::Log(x) : x;
+    double fb = (u - fLookupU0) * fLookupInvDU;
+    int    ib = (fb > 0) ? (int) fb : 0;
+    if(ib >= nb) ib = nb-1;
+    lo = fLookup[ib];
+    hi = TMath::Min(fLookup[ib+1] + 1, n-1);
+    // guard against rounding errors at the bucket edges
+    while(lo > 0   && !(knots[5*lo] < x)) lo--;
+    while(hi < n-1 &&   knots[5*hi] < x ) hi++;
+  }
+  // bisection within the bucket: x(lo) < x <= x(hi)
+  while(hi - lo > 1) {
+    int mid = (lo + hi) / 2;
+    if(knots[5*mid] < x) lo = mid;
+    else                  hi = mid;
+  }
+  return lo;
+}
+//___________________________________________________________________________
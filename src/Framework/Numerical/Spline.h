@@ -5,9 +5,26 @@
 
 \brief    A numeric analysis tool class for interpolating 1-D functions.
 
-          Uses ROOT's TSpline3 for the actual interpolation and can retrieve
-          function (x,y(x)) pairs from an XML file, a flat ascii file, a
-          TNtuple, a TTree or an SQL database.
+          Uses ROOT's TSpline3 for building the interpolating cubic and can
+          retrieve function (x,y(x)) pairs from an XML file, a flat ascii
+          file, a TNtuple, a TTree or an SQL database.
+          The TSpline3 coefficients are copied in a contiguous array that
+          Evaluate() uses directly. A spline can also use such an array from
+          an external buffer (see LoadFromBuffer()), eg a memory-mapped
+          spline file, in which case the TSpline3 is built only if asked.
+          The knot is found in constant time, via a lookup table of equal
+          buckets in x (for uniform grids) or log(x), followed by a bisection
+          within the bucket.
+          For evaluating a spline at many points, or many splines at the
+          same point, use the array versions of Evaluate(): They skip the
+          per-point diagnostics and their inner loops carry no dependencies
+          from one point to the next, so that they can be vectorized.
+          Compact() drops the TSpline3 (and its per-knot TSplinePoly3 objects)
+          of a built spline, which then keeps its contiguous coefficient
+          array only (40 bytes per knot, instead of ~100), evaluating exactly
+          as before. The array can also be stored in single precision (20
+          bytes per knot), changing the evaluated values by less than ~1E-6
+          (relative) for smooth, positive functions such as cross sections.
 
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
@@ -23,6 +40,7 @@
 #define _SPLINE_H_
 
 #include <string>
+#include <vector>
 #include <fstream>
 #include <ostream>
 
@@ -35,6 +53,7 @@ class TSQLServer;
 class TGraph;
 
 using std::string;
+using std::vector;
 using std::ostream;
 using std::ofstream;
 
@@ -67,6 +86,24 @@ public:
   bool   LoadFromTree       (TTree *    tr, string xy, string cut = "");
   bool   LoadFromDBase      (TSQLServer * db,  string query);
   bool   LoadFromTSpline3   (const TSpline3 & spline, int nknots);
+  bool   LoadFromBuffer     (int nknots, const double * knots);
+
+  // Knot x, y and cubic coefficients b, c, d (5 values per knot), or 0
+  // (also for splines stored in single precision, see GetKnotData())
+  const double * KnotData   (void) const { return fKnots; }
+  void   GetKnotData        (vector<double> & knots) const;
+  bool   HasKnotData        (const double * knots) const; ///< same knots as the input ones (to the storage precision)?
+
+  // Compact storage: drop the TSpline3 (it is re-built if asked for, see
+  // GetAsTSpline()) and keep the coefficient array only, optionally in
+  // single precision. Splines using an external knot buffer stay as they are.
+  void   Compact            (bool single_precision = false);
+  bool   IsCompact          (void) const { return (!fInterpolator && this->HasTables()); }
+  bool   IsSinglePrecision  (void) const { return (fKnotsF != 0); }
+
+  // Estimated memory taken by the spline (bytes); knots in an external
+  // buffer (eg. a mapped spline file) are not counted
+  size_t ByteSize           (void) const;
 
   // Get xmin,xmax,nknots, check x variable against valid range and evaluate spline
   int    NKnots             (void) const {return fNKnots;}
@@ -77,6 +114,8 @@ public:
   double XMax               (void) const {return fXMax;  }
   double YMax               (void) const {return fYMax;  }
   double Evaluate           (double x) const;
+  void   Evaluate           (const double x[], double y[], unsigned int n) const;
+  static void Evaluate      (const Spline * const spl[], unsigned int nspl, double x, double y[]);
   bool   IsWithinValidRange (double x) const;
 
   void   SetName (string name) { fName = name; }
@@ -93,7 +132,7 @@ public:
   // Export Spline as TGraph or TSpline3
   TGraph *   GetAsTGraph  (int np = 500, bool xscaling = false,
                            bool inlog=false, double fx=1., double fy=1.) const;
-  TSpline3 * GetAsTSpline (void) const { return fInterpolator; }
+  TSpline3 * GetAsTSpline (void) const;
 
   // Knot manipulation methods in additions to the TSpline3 ones
   void FindClosestKnot(double x, double & xknot, double & yknot, Option_t * opt="-+") const;
@@ -119,6 +158,17 @@ private:
   void InitSpline  (void);
   void ResetSpline (void);
   void BuildSpline (int nentries, double x[], double y[]);
+  void   BuildLookup    (void);
+  int    FindKnot       (double x) const;
+  double EvaluateNative (double x) const;
+  bool   HasTables      (void) const { return (fKnots || fKnotsF); }
+  double KnotX          (int iknot) const { return (fKnotsF) ? fKnotsF[5*iknot]   : fKnots[5*iknot];   }
+  double KnotY          (int iknot) const { return (fKnotsF) ? fKnotsF[5*iknot+1] : fKnots[5*iknot+1]; }
+
+  // the above, for knot tables of either precision
+  template<class T> void   BuildLookup    (const T * knots);
+  template<class T> int    FindKnot       (const T * knots, double x) const;
+  template<class T> double EvaluateNative (const T * knots, double x) const;
 
   // Private data members
   string     fName;
@@ -126,9 +176,19 @@ private:
   double     fXMin;
   double     fXMax;
   double     fYMax;
-  TSpline3 * fInterpolator;
+  mutable TSpline3 * fInterpolator;
   bool       fYCanBeNegative;
 
+  // Evaluation tables (re-built from the knots, not stored)
+  vector<double> fCoeff;        //! x, y and the cubic's b, c, d coefficients for each knot
+  const double * fKnots;        //! points to fCoeff, or to an external knot buffer
+  vector<float>  fCoeffF;       //! fCoeff in single precision (compact splines)
+  const float *  fKnotsF;       //! points to fCoeffF (fKnots is then 0)
+  vector<int>    fLookup;       //! lowest knot of each lookup bucket
+  bool           fLookupInLog;  //! are the lookup buckets equal in log(x)?
+  double         fLookupU0;     //! lower edge of the first bucket
+  double         fLookupInvDU;  //! 1 / bucket width
+
 ClassDef(Spline,1)
 };
 
@@ -0,0 +1,89 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <TMath.h>
+
+#include "Framework/Numerical/VegasGrid.h"
+#include "Framework/Numerical/MathUtils.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+VegasGrid::VegasGrid()
+{
+  this->Reset(1,1);
+}
+//____________________________________________________________________________
+VegasGrid::VegasGrid(unsigned int ndim, unsigned int nbins)
+{
+  this->Reset(ndim,nbins);
+}
+//____________________________________________________________________________
+VegasGrid::~VegasGrid()
+{
+
+}
+//____________________________________________________________________________
+void VegasGrid::Reset(unsigned int ndim, unsigned int nbins)
+{
+  ndim  = TMath::Max(ndim,  1u);
+  nbins = TMath::Max(nbins, 1u);
+
+  fNBins = nbins;
+  fEdges.assign(ndim, vector<double>(nbins+1));
+  fD.assign(ndim, vector<double>(nbins, 0.));
+  for(unsigned int idim = 0; idim < ndim; idim++) {
+    for(unsigned int i = 0; i <= nbins; i++) {
+      fEdges[idim][i] = (double) i / nbins;
+    }
+  }
+}
+//____________________________________________________________________________
+double VegasGrid::Map(
+           const double * r, double * u, unsigned int * bins) const
+{
+  double J = 1.;
+  for(unsigned int idim = 0; idim < fEdges.size(); idim++) {
+    const vector<double> & e = fEdges[idim];
+    double x = r[idim] * fNBins;
+    int i = TMath::FloorNint(x);
+    if(i < 0)            i = 0;
+    if(i >= (int)fNBins) i = fNBins-1;
+    double width = e[i+1] - e[i];
+    u[idim]    = e[i] + (x-i) * width;
+    bins[idim] = i;
+    J *= fNBins * width;
+  }
+  return J;
+}
+//____________________________________________________________________________
+void VegasGrid::Accumulate(const unsigned int * bins, double fJ)
+{
+  for(unsigned int idim = 0; idim < fD.size(); idim++) {
+    if(bins[idim] < fNBins) fD[idim][bins[idim]] += TMath::Abs(fJ);
+  }
+}
+//____________________________________________________________________________
+void VegasGrid::Adapt(double alpha)
+{
+  if(alpha <= 0.) return;
+
+  for(unsigned int idim = 0; idim < fEdges.size(); idim++) {
+    utils::math::VegasRebin(fEdges[idim], fD[idim], alpha);
+    fD[idim].assign(fNBins, 0.);
+  }
+}
+//____________________________________________________________________________
+void VegasGrid::SetEdge(unsigned int idim, unsigned int i, double x)
+{
+  if(idim >= fEdges.size() || i > fNBins) return;
+  fEdges[idim][i] = x;
+}
+//____________________________________________________________________________
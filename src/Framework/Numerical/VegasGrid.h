@@ -0,0 +1,71 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::VegasGrid
+
+\brief    A separable, adaptive importance sampling grid over the unit
+          hypercube (G.P.Lepage, J.Comput.Phys. 27 (1978) 192).
+
+          Each dimension is divided in bins of equal probability but
+          adaptable widths. Map() turns uniform random numbers into a point
+          of the hypercube and returns the jacobian 1/p of the mapping, so
+          that f*J is the weight of a point sampled with the density p.
+          Training accumulates |f*J| per bin of every dimension and Adapt()
+          then moves the bin edges so that the density follows the projections
+          of f. The edges can be read and set, so that a trained grid can be
+          stored and restored.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _VEGAS_GRID_H_
+#define _VEGAS_GRID_H_
+
+#include <vector>
+
+using std::vector;
+
+namespace genie {
+
+class VegasGrid {
+
+public:
+
+  VegasGrid();
+  VegasGrid(unsigned int ndim, unsigned int nbins);
+ ~VegasGrid();
+
+  //! Set uniform bins and clear the accumulated training data
+  void   Reset      (unsigned int ndim, unsigned int nbins);
+
+  //! Map ndim uniform random numbers r in [0,1) to the point u of the unit
+  //! hypercube and to its bin in each dimension. Returns the jacobian 1/p(u).
+  double Map        (const double * r, double * u, unsigned int * bins) const;
+
+  //! Training: add the weight f*J of a point in the input bins, then move the
+  //! bin edges (alpha damps the re-binning; 0: no change; VEGAS: 1.5).
+  void   Accumulate (const unsigned int * bins, double fJ);
+  void   Adapt      (double alpha = 1.5);
+
+  double       Edge    (unsigned int idim, unsigned int i) const { return fEdges[idim][i]; }
+  void         SetEdge (unsigned int idim, unsigned int i, double x);
+  unsigned int NDim    (void) const { return fEdges.size(); }
+  unsigned int NBins   (void) const { return fNBins; }
+
+private:
+
+  unsigned int             fNBins;  ///< number of bins in each dimension
+  vector< vector<double> > fEdges;  ///< bin edges (nbins+1 values in [0,1]) of each dimension
+  vector< vector<double> > fD;      ///< accumulated |f*J| in each bin of each dimension
+};
+
+}      // genie namespace
+
+#endif // _VEGAS_GRID_H_
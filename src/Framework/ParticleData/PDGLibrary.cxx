@@ -14,11 +14,13 @@
 #include <iostream>
 #include <string>
 
+#include <THashList.h>
 #include <TSystem.h>
 
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/ParticleData/PDGUtils.h"
 
 using std::string;
 
@@ -30,6 +32,7 @@ PDGLibrary * PDGLibrary::fInstance = 0;
 PDGLibrary::PDGLibrary()
 {
   if( ! LoadDBase() ) LOG("PDG", pERROR) << "Could not load PDG data";
+  this->BuildIndex();
 
   fInstance =  0;
 }
@@ -63,6 +66,48 @@ TParticlePDG * PDGLibrary::Find(int pdgc)
 
   return fDatabasePDG->GetParticle(pdgc);
 }
+//____________________________________________________________________________
+int PDGLibrary::Index(int pdgc) const
+{
+  std::unordered_map<int, int>::const_iterator iter = fIndex.find(pdgc);
+  if(iter == fIndex.end()) return -1;
+  return iter->second;
+}
+//____________________________________________________________________________
+void PDGLibrary::BuildIndex(void)
+{
+  fProps.clear();
+  fIndex.clear();
+
+  if(!fDatabasePDG) return;
+  const TCollection * particles = fDatabasePDG->ParticleList();
+  if(!particles) return;
+
+  TIter piter(particles);
+  TParticlePDG * particle = 0;
+  while( (particle = (TParticlePDG *) piter.Next()) ) {
+    int pdgc = particle->PdgCode();
+    if(fIndex.count(pdgc) > 0) continue;
+
+    PDGProps props;
+    props.pdgc     = pdgc;
+    props.mass     = particle->Mass();
+    props.width    = particle->Width();
+    props.charge   = particle->Charge();
+    props.particle = particle;
+    props.flags    = 0;
+    if(particle->Stable())    props.flags |= kPDGFlagStable;
+    if(pdg::IsHadron(pdgc))   props.flags |= kPDGFlagHadron;
+    if(pdg::IsLepton(pdgc))   props.flags |= kPDGFlagLepton;
+    if(pdg::IsIon(pdgc))      props.flags |= kPDGFlagIon;
+
+    fIndex[pdgc] = fProps.size();
+    fProps.push_back(props);
+  }
+
+  LOG("PDG", pINFO)
+    << "Indexed the properties of " << fProps.size() << " particles";
+}
 
 //____________________________________________________________________________
 bool PDGLibrary::LoadDBase(void)
@@ -130,6 +175,7 @@ void PDGLibrary::AddDarkMatter(double mass, double med_ratio)
   else {
     assert(med_particle->Mass() == med_mass);
   }
+  this->BuildIndex();
 }
 //____________________________________________________________________________
 // EDIT: need a way to clear and then reload the PDG database
@@ -140,4 +186,5 @@ void PDGLibrary::ReloadDBase(void)
   }
 
   if( ! LoadDBase() ) LOG("PDG", pERROR) << "Could not load PDG data";
+  this->BuildIndex();
 }
@@ -5,6 +5,12 @@
 
 \brief    Singleton class to load & serve a TDatabasePDG.
 
+          Next to the TDatabasePDG it keeps a dense, read-only table of the
+          properties of all its particles (ions, 10LZZZAAAI, included), built
+          whenever the database is (re)loaded or extended. Index() maps a PDG
+          code to its entry, which users such as GHepParticle can cache for
+          O(1) access to its mass, width, charge and flags.
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -21,11 +27,30 @@
 #ifndef _PDG_LIBRARY_H_
 #define _PDG_LIBRARY_H_
 
+#include <unordered_map>
+#include <vector>
+
 #include <TDatabasePDG.h>
 #include <TParticlePDG.h>
 
 namespace genie {
 
+//! Flags of the particle property table entries
+const unsigned int kPDGFlagStable = 1 << 0;
+const unsigned int kPDGFlagHadron = 1 << 1;
+const unsigned int kPDGFlagLepton = 1 << 2;
+const unsigned int kPDGFlagIon    = 1 << 3;
+
+//! An entry of the particle property table
+struct PDGProps {
+  int            pdgc;      ///< PDG code
+  double         mass;      ///< mass (GeV)
+  double         width;     ///< width (GeV)
+  double         charge;    ///< charge (in units of |e|/3, as in TParticlePDG)
+  unsigned int   flags;     ///< kPDGFlag* bits
+  TParticlePDG * particle;  ///< the TDatabasePDG entry
+};
+
 class PDGLibrary
 {
 public:
@@ -36,6 +61,11 @@ public:
   TParticlePDG * Find  (int pdgc);
   void           ReloadDBase (void);
 
+  // Particle property table
+  int              Index       (int pdgc)  const; ///< entry of pdgc, or -1 if unknown
+  int              NParticles  (void)      const { return fProps.size(); }
+  const PDGProps & Properties  (int index) const { return fProps[index]; }
+
   // Add dark matter and mediator with parameters from Boosted Dark Matter app configuration
   // Ideally, this code should be in the Dark Matter app, not here.
   // But presently there is no way to edit the PDGLibrary after it has been created.
@@ -47,11 +77,15 @@ private:
   PDGLibrary(const PDGLibrary & config_pool);
   virtual ~PDGLibrary();
 
-  bool LoadDBase(void);
+  bool LoadDBase  (void);
+  void BuildIndex (void);
 
   static PDGLibrary * fInstance;
   TDatabasePDG      * fDatabasePDG;
 
+  std::vector<PDGProps>             fProps; ///< particle property table
+  std::unordered_map<int, int>      fIndex; ///< PDG code -> property table entry
+
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
       ~Cleaner() {
@@ -74,6 +74,23 @@ namespace genie {
    return value;
  }
  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ template<class T> const RegistryItem<T> * CastRegistryItem(
+      const Registry * r, RgKey key, RgIMapConstIter entry, RgType_t type)
+ {
+  // The item type is checked on its type id (no dynamic_cast needed)
+
+   const RegistryItemI * rib = entry->second;
+   if(rib->TypeInfo() != type) {
+      LOG("Registry", pFATAL)
+         << "*** Item: " << key << " in registry: " << r->Name()
+         << " is of type [" << RgType::AsString(rib->TypeInfo())
+         << "], not [" << RgType::AsString(type) << "]";
+      gAbortingInErr = true;
+      exit(1);
+   }
+   return static_cast<const RegistryItem<T> *> (rib);
+ }
+ //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  ostream & operator << (ostream & stream, const Registry & registry)
  {
    registry.Print(stream);
@@ -194,8 +211,7 @@ bool Registry::ItemIsLocal(RgKey key) const
 void Registry::OverrideGlobalDef(RgKey key)
 {
   if( this->Exists(key) ) {
-     RgIMapConstIter entry = fRegistry.find(key);
-     entry->second->SetLocal(true);
+     this->OwnItem(fRegistry.find(key))->SetLocal(true);
   } else {
      LOG("Registry", pWARN)
         << "*** Can't give 'local' status to  non-existem item ["
@@ -206,8 +222,7 @@ void Registry::OverrideGlobalDef(RgKey key)
 void Registry::LinkToGlobalDef(RgKey key)
 {
   if( this->Exists(key) ) {
-     RgIMapConstIter entry = fRegistry.find(key);
-     entry->second->SetLocal(false);
+     this->OwnItem(fRegistry.find(key))->SetLocal(false);
   } else {
      LOG("Registry", pWARN)
         << "*** Can't give 'global' status to  non-existem item ["
@@ -234,8 +249,7 @@ bool Registry::ItemIsLocked(RgKey key) const
 void Registry::LockItem(RgKey key)
 {
   if( this->Exists(key) ) {
-     RgIMapConstIter entry = fRegistry.find(key);
-     entry->second->Lock();
+     this->OwnItem(fRegistry.find(key))->Lock();
   } else {
      LOG("Registry", pWARN)
            << "*** Can't lock non-existem item [" << key << "]";
@@ -245,8 +259,7 @@ void Registry::LockItem(RgKey key)
 void Registry::UnLockItem(RgKey key)
 {
   if( this->Exists(key) ) {
-     RgIMapConstIter entry = fRegistry.find(key);
-     entry->second->UnLock();
+     this->OwnItem(fRegistry.find(key))->UnLock();
   } else {
     LOG("Registry", pWARN)
        << "*** Can't unlock non-existem item [" << key << "]";
@@ -335,8 +348,8 @@ void Registry::Get(RgKey key, RgBool & item) const
 #endif
 
   RgIMapConstIter entry = this->SafeFind(key);
-  RegistryItemI * rib = entry->second;
-  RegistryItem<RgBool> * ri = dynamic_cast<RegistryItem<RgBool>*> (rib);
+  const RegistryItem<RgBool> * ri =
+            CastRegistryItem<RgBool>(this, key, entry, kRgBool);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("Registry", pDEBUG) << "Item value = " << ri->Data();
@@ -351,8 +364,8 @@ void Registry::Get(RgKey key, RgInt & item) const
 #endif
 
   RgIMapConstIter entry = this->SafeFind(key);
-  RegistryItemI * rib = entry->second;
-  RegistryItem<RgInt> * ri = dynamic_cast< RegistryItem<RgInt> * > (rib);
+  const RegistryItem<RgInt> * ri =
+            CastRegistryItem<RgInt>(this, key, entry, kRgInt);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("Registry", pDEBUG) << "Item value = " << ri->Data();
@@ -367,8 +380,8 @@ void Registry::Get(RgKey key, RgDbl & item) const
 #endif
 
   RgIMapConstIter entry = this->SafeFind(key);
-  RegistryItemI * rib = entry->second;
-  RegistryItem<RgDbl> * ri = dynamic_cast<RegistryItem<RgDbl>*> (rib);
+  const RegistryItem<RgDbl> * ri =
+            CastRegistryItem<RgDbl>(this, key, entry, kRgDbl);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("Registry", pDEBUG) << "Item value = " << ri->Data();
@@ -383,8 +396,8 @@ void Registry::Get(RgKey key, RgStr & item) const
 #endif
 
   RgIMapConstIter entry = this->SafeFind(key);
-  RegistryItemI * rib = entry->second;
-  RegistryItem<RgStr> * ri = dynamic_cast<RegistryItem<RgStr>*> (rib);
+  const RegistryItem<RgStr> * ri =
+            CastRegistryItem<RgStr>(this, key, entry, kRgStr);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("Registry", pDEBUG) << "Item value = " << ri->Data();
@@ -399,8 +412,8 @@ void Registry::Get(RgKey key, RgAlg & item) const
 #endif
 
   RgIMapConstIter entry = this->SafeFind(key);
-  RegistryItemI * rib = entry->second;
-  RegistryItem<RgAlg> * ri = dynamic_cast<RegistryItem<RgAlg>*> (rib);
+  const RegistryItem<RgAlg> * ri =
+            CastRegistryItem<RgAlg>(this, key, entry, kRgAlg);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("Registry", pDEBUG) << "Item value = " << ri->Data();
@@ -416,8 +429,8 @@ void Registry::Get(RgKey key, RgH1F & item) const
 #endif
 
   RgIMapConstIter entry = this->SafeFind(key);
-  RegistryItemI * rib = entry->second;
-  RegistryItem<RgH1F> *ri = dynamic_cast<RegistryItem<RgH1F>*> (rib);
+  const RegistryItem<RgH1F> * ri =
+            CastRegistryItem<RgH1F>(this, key, entry, kRgH1F);
   item = ri->Data();
 
   if(!item) {
@@ -432,8 +445,8 @@ void Registry::Get(RgKey key, RgH2F & item) const
 #endif
 
   RgIMapConstIter entry = this->SafeFind(key);
-  RegistryItemI * rib = entry->second;
-  RegistryItem<RgH2F> *ri = dynamic_cast<RegistryItem<RgH2F>*> (rib);
+  const RegistryItem<RgH2F> * ri =
+            CastRegistryItem<RgH2F>(this, key, entry, kRgH2F);
   item = ri->Data();
 
   if(!item) {
@@ -448,8 +461,8 @@ void Registry::Get(RgKey key, RgTree & item) const
 #endif
 
   RgIMapConstIter entry = this->SafeFind(key);
-  RegistryItemI * rib = entry->second;
-  RegistryItem<RgTree> *ri =  dynamic_cast<RegistryItem<RgTree>*> (rib);
+  const RegistryItem<RgTree> * ri =
+            CastRegistryItem<RgTree>(this, key, entry, kRgTree);
   item = ri->Data();
 
   if(!item) {
@@ -494,9 +507,9 @@ RgAlg Registry::GetAlg(RgKey key) const
 //____________________________________________________________________________
 RgH1F Registry::GetH1F(RgKey key) const
 {
-  RgIMapConstIter entry = fRegistry.find(key);
-  RegistryItemI * rib = entry->second;
-  RegistryItem<RgH1F> *ri = dynamic_cast<RegistryItem<RgH1F>*> (rib);
+  RgIMapConstIter entry = this->SafeFind(key);
+  const RegistryItem<RgH1F> * ri =
+            CastRegistryItem<RgH1F>(this, key, entry, kRgH1F);
 
   RgH1F item = ri->Data();
   return item;
@@ -504,9 +517,9 @@ RgH1F Registry::GetH1F(RgKey key) const
 //____________________________________________________________________________
 RgH2F Registry::GetH2F(RgKey key) const
 {
-  RgIMapConstIter entry = fRegistry.find(key);
-  RegistryItemI * rib = entry->second;
-  RegistryItem<RgH2F> *ri = dynamic_cast<RegistryItem<RgH2F>*> (rib);
+  RgIMapConstIter entry = this->SafeFind(key);
+  const RegistryItem<RgH2F> * ri =
+            CastRegistryItem<RgH2F>(this, key, entry, kRgH2F);
 
   RgH2F item = ri->Data();
   return item;
@@ -514,9 +527,9 @@ RgH2F Registry::GetH2F(RgKey key) const
 //____________________________________________________________________________
 RgTree Registry::GetTree(RgKey key) const
 {
-  RgIMapConstIter entry = fRegistry.find(key);
-  RegistryItemI * rib = entry->second;
-  RegistryItem<RgTree> *ri = dynamic_cast<RegistryItem<RgTree>*> (rib);
+  RgIMapConstIter entry = this->SafeFind(key);
+  const RegistryItem<RgTree> * ri =
+            CastRegistryItem<RgTree>(this, key, entry, kRgTree);
 
   RgTree item = ri->Data();
   return item;
@@ -570,9 +583,7 @@ bool Registry::DeleteEntry(RgKey key)
 {
   if(!fIsReadOnly && Exists(key)) {
       RgIMapIter entry = fRegistry.find(key);
-      RegistryItemI * item = entry->second;
-      delete item;
-      item = 0;
+      ReleaseItem(entry->second);
       fRegistry.erase(entry);
       return true;
   }
@@ -754,33 +765,31 @@ void Registry::Append(const Registry & registry, RgKey prefix)
 
   this->InhibitItemLocks();
 
+  // The input items come in key order and, as they all take the same
+  // prefix, they stay in order: the position of the new item is found
+  // with a single search (none when appending to an empty registry)
+  //
   RgIMapConstIter reg_iter;
   for(reg_iter = registry.fRegistry.begin();
                       reg_iter != registry.fRegistry.end(); reg_iter++) {
 
-     RgKey name     = reg_iter->first;
-     RgKey new_name = prefix + name;
+     const RgKey & name     = reg_iter->first;
+     RgKey         new_name = prefix + name;
 
-     if ( fRegistry.count( new_name ) > 0 ) continue ;
-
-     RgType_t type  = reg_iter -> second -> TypeInfo();
-     string   stype = RgType::AsString(type);
+     RgIMapIter pos = fRegistry.empty() ?
+                        fRegistry.end() : fRegistry.lower_bound(new_name);
+     if ( pos != fRegistry.end() && pos->first == new_name ) continue ;
 
-     LOG("Registry", pINFO)
-         << "Copying [" << stype << "] item named = "
-                                         << name << " as " << new_name;
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+     LOG("Registry", pDEBUG)
+         << "Copying [" << RgType::AsString(reg_iter->second->TypeInfo())
+         << "] item named = " << name << " as " << new_name;
+#endif
 
-     RegistryItemI * cri = registry.CloneRegistryItem( name ) ; // cloned registry item
+     RegistryItemI * cri = registry.ShareRegistryItem( reg_iter ) ;
 
-     RgIMapPair reg_entry(new_name, cri);
+     fRegistry.insert(pos, RgIMapPair(new_name, cri));
 
-     if ( ! fRegistry.insert(reg_entry).second ) {
-    	 // The registry already contained an entry with key new_name
-    	 //   so the new registryItem has to be deleted or we leak memory.
-    	 //   This should not happened as a check is performed
-    	 LOG("Registry", pERROR ) << "Failing to insert item " << new_name ;
-    	 delete cri ;
-     }
    } // loop on the incoming registry items
 }
 //____________________________________________________________________________
@@ -806,23 +815,22 @@ void Registry::Merge(const Registry & registry, RgKey prefix)
      RgKey name     = reg_iter->first;
      RgKey new_name = prefix + name;
 
-     RgType_t type  = reg_iter -> second -> TypeInfo();
-     string   stype = RgType::AsString(type);
-
-     LOG("Registry", pINFO)
-         << "Copying [" << stype << "] item named = "
-                                         << name << " as " << new_name;
-
-     RegistryItemI * cri = registry.CloneRegistryItem( name ) ; // cloned registry item
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+     LOG("Registry", pDEBUG)
+         << "Copying [" << RgType::AsString(reg_iter->second->TypeInfo())
+         << "] item named = " << name << " as " << new_name;
+#endif
 
-     if ( fRegistry.count( new_name ) > 0 ) {
+     RegistryItemI * cri = registry.ShareRegistryItem( reg_iter ) ;
 
-       RegistryItemI * old_ri = fRegistry[new_name] ;
-   	   delete old_ri ;
+     RgIMapIter pos = fRegistry.lower_bound(new_name);
+     if ( pos != fRegistry.end() && pos->first == new_name ) {
+       ReleaseItem( pos->second ) ;
+       pos->second = cri ;
+     } else {
+       fRegistry.insert(pos, RgIMapPair(new_name, cri));
      }
 
-     fRegistry[new_name] = cri ;
-
    } // loop on the incoming registry items
 
 }//____________________________________________________________________________
@@ -852,6 +860,23 @@ RgKeyList Registry::FindKeys(RgKey key_part) const
   return klist;
 }
 //____________________________________________________________________________
+RgKeyList Registry::FindKeysWithPrefix(RgKey prefix) const
+{
+// The keys are kept in order, so the keys starting with the prefix are
+// an adjacent range starting at the first key not less than the prefix
+
+  RgKeyList klist;
+
+  RgIMapConstIter reg_iter = fRegistry.lower_bound(prefix);
+  for( ; reg_iter != fRegistry.end(); reg_iter++) {
+    const RgKey & key = reg_iter->first;
+    if (key.compare(0, prefix.size(), prefix) != 0) break;
+    klist.push_back(key);
+  }
+
+  return klist;
+}
+//____________________________________________________________________________
 void Registry::Init(void)
 {
 // initialize registry properties
@@ -876,13 +901,11 @@ void Registry::Clear(bool force)
   }
   RgIMapIter rit;
   for(rit = fRegistry.begin(); rit != fRegistry.end(); rit++) {
-     RgKey           name = rit->first;
      RegistryItemI * item = rit->second;
      if(!item) {
-       LOG("Registry", pWARN) << "Item with key = " << name << " is null!";
+       LOG("Registry", pWARN) << "Item with key = " << rit->first << " is null!";
      }
-     delete item;
-     item = 0;
+     ReleaseItem(item);
   }
   fRegistry.clear();
 }
@@ -953,3 +976,44 @@ RegistryItemI * Registry::CloneRegistryItem( const RgKey & key ) const {
      return cri ;
 
 }
+//____________________________________________________________________________
+RegistryItemI * Registry::ShareRegistryItem(RgIMapConstIter entry) const
+{
+// Items holding plain values (not histograms or trees, which are deep
+// copied) are shared by the registry copies rather than cloned. Only the
+// items flagged as 'local' are shared, as a cloned item is always 'local'.
+// An item is un-shared (see OwnItem) before any of its flags is changed.
+
+  const RegistryItemI * ri = entry->second;
+  RgType_t type = ri->TypeInfo();
+
+  bool shareable = ( type == kRgBool || type == kRgInt || type == kRgDbl ||
+                     type == kRgStr  || type == kRgAlg );
+
+  if ( shareable && ri->IsLocal() ) {
+    ri->Share();
+    return const_cast<RegistryItemI *> (ri);
+  }
+  return this->CloneRegistryItem( entry->first );
+}
+//____________________________________________________________________________
+RegistryItemI * Registry::OwnItem(RgIMapIter entry)
+{
+// Returns the item at the input position, replacing it with a copy first
+// if it is shared with other registries
+
+  RegistryItemI * ri = entry->second;
+  if ( ri->IsShared() ) {
+    RegistryItemI * cri = ri->Clone();
+    cri->SetLocal( ri->IsLocal() );
+    ReleaseItem( ri );
+    entry->second = cri;
+  }
+  return entry->second;
+}
+//____________________________________________________________________________
+void Registry::ReleaseItem(RegistryItemI * item)
+{
+  if ( item && item->Release() ) delete item;
+}
+//____________________________________________________________________________
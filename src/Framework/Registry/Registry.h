@@ -155,6 +155,7 @@ public:
 
   RgType_t  ItemType (RgKey key)      const;  ///< return item type
   RgKeyList FindKeys (RgKey key_part) const;  ///< create list with all keys containing 'key_part'
+  RgKeyList FindKeysWithPrefix (RgKey prefix) const;  ///< create list with all keys starting with 'prefix'
 
   // Access key->item map
   //
@@ -174,6 +175,9 @@ public:
 private:
 
   RegistryItemI * CloneRegistryItem( const RgKey & key ) const ;   ///< Properly clone a registry Item according to its type
+  RegistryItemI * ShareRegistryItem( RgIMapConstIter entry ) const ; ///< Share (or clone) an item for a registry copy
+  RegistryItemI * OwnItem          ( RgIMapIter entry ) ;            ///< Un-share an item before modifying it
+  static void     ReleaseItem      ( RegistryItemI * item ) ;        ///< Drop an item (deleted by its last owner)
 
   // Registry's private data members
   //
@@ -19,6 +19,7 @@
 #define _REGISTRY_ITEM_I_H_
 
 #include <iostream>
+#include <atomic>
 
 #include "Framework/Registry/RegistryItemTypeId.h"
 
@@ -40,9 +41,22 @@ public:
   virtual void            SetLocal (bool)            = 0;
   virtual void            Print    (ostream &) const = 0;
 
+  // Items can be shared by registry copies (see Registry::Append).
+  // Shared items are not modified: a registry takes its own copy first.
+  //
+  void Share    (void) const { ++fNRefs;             }
+  bool Release  (void) const { return --fNRefs == 0; } ///< true if it was the last owner
+  bool IsShared (void) const { return fNRefs > 1;    }
+
 protected:
 
-  RegistryItemI() { }
+  RegistryItemI() : fNRefs(1) { }
+  RegistryItemI(const RegistryItemI &) : fNRefs(1) { }
+  RegistryItemI & operator = (const RegistryItemI &) { return *this; }
+
+private:
+
+  mutable std::atomic<int> fNRefs; //! number of registries owning the item
 };
 
 }      // genie namespace
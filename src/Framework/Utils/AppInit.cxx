@@ -10,21 +10,56 @@
 
 // for exit()
 #include <cstdlib>
+#include <cstdio>
+#include <ctime>
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <atomic>
+#include <new>
+
+// for fork(), waitpid(), mmap()
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <sys/mman.h>
 
 #include <TSystem.h>
+#include <TFile.h>
+#include <TTree.h>
+#include <TFolder.h>
+#include <TObjString.h>
+#include <TSocket.h>
 
 //#include "Framework/Conventions/XmlParserStatus.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Utils/Cache.h"
+#include "Framework/Utils/MaxXSecTable.h"
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Utils/SystemUtils.h"
 #include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/JobCoordinator.h"
+#include "Framework/Utils/RunOpt.h"
 #include "Framework/Utils/StringUtils.h"
 #include "Framework/Utils/XmlParserUtils.h"
 
 using namespace genie;
 
+namespace {
+  // insert tag before the extension(s) of the file name
+  string InsertFilenameTag(string filename, string tag)
+  {
+    string::size_type dir = filename.rfind('/');
+    string::size_type base = (dir == string::npos) ? 0 : dir + 1;
+    string::size_type ext = filename.find('.', base);
+    if(ext == base) ext = filename.find('.', base + 1); // hidden file
+    if(ext == string::npos) return filename + tag;
+
+    return filename.substr(0, ext) + tag + filename.substr(ext);
+  }
+}
+
 //___________________________________________________________________________
 
 void genie::utils::app_init::RandGen(long int seed)
@@ -41,6 +76,20 @@ void genie::utils::app_init::XSecTable (string inpfile, bool require_table)
 
   XSecSplineList * xspl = XSecSplineList::Instance();
 
+  // spline storage (--spline-storage), applied to the splines as they load
+  string storage = RunOpt::Instance()->SplineStorage();
+  if(storage == "compact" || storage == "single") {
+    xspl->SetCompactStorage(true, storage == "single");
+  }
+  else
+  if(storage != "default") {
+    LOG("AppInit", pFATAL)
+       << "Unknown cross-section spline storage: " << storage
+       << " (use one of: default, compact, single)";
+    gAbortingInErr = true;
+    exit(1);
+  }
+
   // don't try to expand if no filename actually given ...
   string expandedinpfile = "";
   string fullinpfile     = "";
@@ -60,7 +109,8 @@ void genie::utils::app_init::XSecTable (string inpfile, bool require_table)
   // file was specified & exists - load table
   if (utils::system::FileExists(fullinpfile)) {
     xspl = XSecSplineList::Instance();
-    XmlParserStatus_t status = xspl->LoadFromXml(fullinpfile);
+    XmlParserStatus_t status = XSecSplineList::IsBinaryFile(fullinpfile) ?
+          xspl->LoadFromBinary(fullinpfile) : xspl->LoadFromXml(fullinpfile);
     if (status != kXmlOK) {
       LOG("AppInit", pFATAL)
          << "Problem reading file: " << expandedinpfile;
@@ -121,3 +171,380 @@ void genie::utils::app_init::CacheFile(string inp_file)
   }
 }
 //___________________________________________________________________________
+void genie::utils::app_init::MaxXSecTable(string inp_file)
+{
+  if(inp_file.size() > 0) {
+    bool ok = genie::MaxXSecTable::Instance()->Load(inp_file);
+    if(!ok) {
+      LOG("AppInit", pWARN)
+        << "Could not use the max xsec table: " << inp_file
+        << " - The max xsec values will be computed";
+    }
+  }
+}
+//___________________________________________________________________________
+void genie::utils::app_init::OutputFile(TFile * file)
+{
+  if(!file) return;
+
+  int compression = RunOpt::Instance()->OutputCompression();
+  if(compression >= 0) {
+    file->SetCompressionSettings(compression);
+    LOG("AppInit", pNOTICE)
+      << "Output file compression settings: " << compression;
+  }
+}
+//___________________________________________________________________________
+void genie::utils::app_init::OutputTree(TTree * tree)
+{
+  if(!tree) return;
+
+  RunOpt * opt = RunOpt::Instance();
+  tree->SetBasketSize("*", opt->OutputBasketSize());
+  tree->SetAutoSave(opt->OutputAutoSave());
+  if(opt->OutputAutoFlush() != 0) {
+    tree->SetAutoFlush(opt->OutputAutoFlush());
+  }
+}
+//___________________________________________________________________________
+namespace {
+  // event claims (see ClaimEvent()): the counter shared by the workers, or
+  // the one of a job without workers
+  std::atomic<long int> * gSharedClaims = 0;
+  std::atomic<long int>   gLocalClaims(0);
+  int                     gIWorker      = -1;
+  int                     gNWorkers     = 0;
+
+  // the outcome of a coordinated block (see CoordinatedBlock()), saved by
+  // the process generating it in memory shared with its parent
+  struct BlockResult {
+    bool     saved;
+    long int nev;
+    double   exposure;
+    long int nflux;
+  };
+  BlockResult * gBlockResult = 0;
+}
+//___________________________________________________________________________
+int genie::utils::app_init::ForkWorkers(int nworkers)
+{
+  if(nworkers < 2) return -1;
+
+  long int seed = RandomGen::Instance()->GetSeed();
+  bool reseed = ! RandomGen::Instance()->UsingCounterBasedStreams();
+
+  // the event claim counter, shared by the workers
+  void * claims = mmap(0, sizeof(std::atomic<long int>),
+        PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if(claims != MAP_FAILED && std::atomic<long int>(0).is_lock_free()) {
+    gSharedClaims = new (claims) std::atomic<long int>(0);
+  } else {
+    LOG("AppInit", pWARN)
+      << "No shared event claim counter - The workers will claim "
+      << "interleaved events instead";
+  }
+  gNWorkers = nworkers;
+
+  LOG("AppInit", pNOTICE)
+    << "Forking " << nworkers << " event generation workers";
+
+  // don't let the workers inherit (and print again) unflushed output
+  std::cout.flush();
+  std::cerr.flush();
+  fflush(stdout);
+  fflush(stderr);
+
+  std::vector<pid_t> workers;
+  for(int iw = 0; iw < nworkers; iw++) {
+    pid_t pid = fork();
+    if(pid == 0) {
+      long int wseed = (reseed) ? WorkerSeed(seed, iw) : seed;
+      if(reseed) RandomGen::Instance()->SetSeed(wseed);
+      LOG("AppInit", pNOTICE)
+        << "Worker " << iw << " (pid: " << getpid()
+        << ") started with seed " << wseed;
+      gIWorker = iw;
+      return iw;
+    }
+    if(pid < 0) {
+      LOG("AppInit", pFATAL)
+        << "Could not fork worker " << iw << " - Waiting for the "
+        << workers.size() << " workers already started";
+      break;
+    }
+    workers.push_back(pid);
+  }
+
+  int nfailed = nworkers - workers.size();
+  for(unsigned int iw = 0; iw < workers.size(); iw++) {
+    int status = 0;
+    if(waitpid(workers[iw], &status, 0) < 0) {
+      nfailed++;
+      continue;
+    }
+    bool ok = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    if(!ok) nfailed++;
+    LOG("AppInit", (ok ? pNOTICE : pERROR))
+      << "Worker " << iw << " (pid: " << workers[iw] << ") "
+      << (WIFEXITED(status) ? "exited with status " : "was killed by signal ")
+      << (WIFEXITED(status) ? WEXITSTATUS(status) : WTERMSIG(status));
+  }
+
+  LOG("AppInit", pNOTICE)
+    << nworkers - nfailed << " out of " << nworkers
+    << " event generation workers completed successfully";
+
+  exit( (nfailed > 0) ? 1 : 0 );
+}
+//___________________________________________________________________________
+long int genie::utils::app_init::WorkerSeed(long int seed, int iworker)
+{
+  // Mix the job seed and the worker number (splitmix64 finalizer) so that
+  // the worker streams are reproducible but unrelated for nearby seeds.
+  // Keep the result positive and within 31 bits, as accepted by all random
+  // number engines (0 would ask for a time-based seed).
+  unsigned long long z = (unsigned long long) seed +
+                  (unsigned long long) (iworker + 1) * 0x9E3779B97F4A7C15ULL;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  z = z ^ (z >> 31);
+
+  long int wseed = (long int) (z & 0x7FFFFFFFULL);
+  return (wseed == 0) ? 1 : wseed;
+}
+//___________________________________________________________________________
+long int genie::utils::app_init::ThreadSeed(long int seed, int ithread)
+{
+  // as ShardSeed() (see below), with a salt of its own
+  return WorkerSeed(seed ^ 0x544844L, ithread);
+}
+//___________________________________________________________________________
+string genie::utils::app_init::WorkerFilename(string filename, int iworker)
+{
+  if(iworker < 0) return filename;
+
+  std::ostringstream tag;
+  tag << "_w" << iworker;
+
+  return InsertFilenameTag(filename, tag.str());
+}
+//___________________________________________________________________________
+long int genie::utils::app_init::WorkerShare(
+   long int n, int iworker, int nworkers)
+{
+  if(iworker < 0 || nworkers < 1) return n;
+
+  // the remainder goes to the first workers
+  return n / nworkers + ( (iworker < n % nworkers) ? 1 : 0 );
+}
+//___________________________________________________________________________
+double genie::utils::app_init::WorkerShare(
+   double n, int iworker, int nworkers)
+{
+  if(iworker < 0 || nworkers < 1) return n;
+
+  return n / nworkers;
+}
+//___________________________________________________________________________
+long int genie::utils::app_init::ClaimEvent(long int n)
+{
+  long int ievent = -1;
+  if(gSharedClaims) {
+    ievent = (*gSharedClaims)++;
+  }
+  else
+  if(gIWorker >= 0) {
+    // no shared counter: every nworkers-th event, starting at iworker
+    ievent = gIWorker + gNWorkers * (gLocalClaims++);
+  }
+  else {
+    ievent = gLocalClaims++;
+  }
+  return (ievent < n) ? ievent : -1;
+}
+//___________________________________________________________________________
+bool genie::utils::app_init::ShardOption(
+   string opt, int & ishard, int & nshards)
+{
+  std::vector<string> shard = utils::str::Split(opt, "/");
+  if(shard.size() != 2) return false;
+
+  ishard  = atoi(shard[0].c_str());
+  nshards = atoi(shard[1].c_str());
+  return (nshards > 0 && ishard >= 0 && ishard < nshards);
+}
+//___________________________________________________________________________
+long int genie::utils::app_init::ShardSeed(long int seed, int ishard)
+{
+  // as WorkerSeed() but for a salted seed, so that the seeds of the shards
+  // and the ones of their workers (WorkerSeed(ShardSeed(seed,i),j)) are
+  // not the same
+  return WorkerSeed(seed ^ 0x5348ADL, ishard);
+}
+//___________________________________________________________________________
+string genie::utils::app_init::ShardFilename(string filename, int ishard)
+{
+  if(ishard < 0) return filename;
+
+  std::ostringstream tag;
+  tag << "_s" << ishard;
+
+  return InsertFilenameTag(filename, tag.str());
+}
+//___________________________________________________________________________
+void genie::utils::app_init::SaveExposure(
+   TTree * evtree, int ishard, int nshards, long int seed,
+   double exposure, string units, long int nflux, long int nev)
+{
+  if(!evtree || !evtree->GetCurrentFile()) return;
+
+  TDirectory * cwd = gDirectory;
+  evtree->GetCurrentFile()->cd();
+
+  TFolder * folder = new TFolder("gexposure","GENIE event sample exposure");
+  folder->SetOwner(true);
+
+  std::ostringstream entry;
+  entry.precision(15);
+  entry << "shard:"     << ishard
+        << ";nshards:"  << nshards
+        << ";seed:"     << seed
+        << ";exposure:" << exposure
+        << ";units:"    << units
+        << ";nflux:"    << nflux
+        << ";events:"   << nev;
+  folder->Add(new TObjString(entry.str().c_str()));
+  folder->Write();
+  delete folder;
+
+  if(cwd) cwd->cd();
+
+  LOG("AppInit", pNOTICE)
+    << "Saved the event sample exposure: " << entry.str();
+
+  if(gBlockResult) {
+    gBlockResult->nev      = nev;
+    gBlockResult->exposure = exposure;
+    gBlockResult->nflux    = nflux;
+    gBlockResult->saved    = true;
+  }
+}
+//___________________________________________________________________________
+int genie::utils::app_init::CoordinatedBlock(
+   string coordinator, int & nblocks, long int & nev, double & exposure)
+{
+  std::vector<string> address = utils::str::Split(coordinator, ":");
+  if(address.size() != 2) {
+    LOG("AppInit", pFATAL)
+      << "The coordinator address must be host:port (got: "
+      << coordinator << ")";
+    gAbortingInErr = true;
+    exit(1);
+  }
+  // not deleted by the block processes, which must not close it
+  TSocket * sock = new TSocket(address[0].c_str(), atoi(address[1].c_str()));
+  if(!sock->IsValid()) {
+    LOG("AppInit", pFATAL)
+      << "Could not connect to the coordinator at " << coordinator;
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  void * result = mmap(0, sizeof(BlockResult),
+        PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if(result == MAP_FAILED) {
+    LOG("AppInit", pFATAL) << "Could not map the block outcome memory";
+    gAbortingInErr = true;
+    exit(1);
+  }
+  gBlockResult = (BlockResult *) result;
+
+  long int seed = RandomGen::Instance()->GetSeed();
+
+  LOG("AppInit", pNOTICE)
+    << "Connected to the coordinator at " << coordinator;
+
+  int ndone   = 0;
+  int nfailed = 0;
+  while(true) {
+    char msg[256];
+    if(sock->Send("NEXT") <= 0 || sock->Recv(msg, sizeof(msg)) <= 0) {
+      LOG("AppInit", pERROR) << "Lost the connection to the coordinator";
+      nfailed++;
+      break;
+    }
+    std::istringstream reply(msg);
+    string cmd = "";
+    int ib = -1;
+    reply >> cmd;
+    if(cmd == "WAIT") {
+      sleep(5);
+      continue;
+    }
+    if(cmd != "BLOCK") break;
+    reply >> ib >> nblocks >> nev >> exposure;
+
+    gBlockResult->saved = false;
+
+    std::cout.flush();
+    std::cerr.flush();
+    fflush(stdout);
+    fflush(stderr);
+
+    pid_t pid = fork();
+    if(pid == 0) {
+      // a shard of its own: its own seed (also with counter-based streams,
+      // keyed on the job seed) and its own event claims
+      long int bseed = ShardSeed(seed, ib);
+      RandomGen::Instance()->SetSeed(bseed);
+      gSharedClaims = 0;
+      gIWorker      = -1;
+      gNWorkers     = 0;
+      gLocalClaims  = 0;
+      LOG("AppInit", pNOTICE)
+        << "Block " << ib << " of " << nblocks << " (pid: " << getpid()
+        << ") started with seed " << bseed << ": up to " << nev
+        << " events / " << exposure << " exposure (0: no limit)";
+      return ib;
+    }
+
+    std::ostringstream outcome;
+    outcome.precision(15);
+    bool ok = false;
+    if(pid > 0) {
+      int status = 0;
+      time_t last = time(0);
+      while(waitpid(pid, &status, WNOHANG) == 0) {
+        sleep(1);
+        if(time(0) - last < JobCoordinator::kHeartbeat) continue;
+        std::ostringstream alive;
+        alive << "ALIVE " << ib;
+        sock->Send(alive.str().c_str());
+        last = time(0);
+      }
+      ok = WIFEXITED(status) && WEXITSTATUS(status) == 0 &&
+           gBlockResult->saved;
+    }
+    if(ok) {
+      outcome << "DONE " << ib << " " << gBlockResult->nev << " "
+              << gBlockResult->exposure << " " << gBlockResult->nflux;
+      ndone++;
+    } else {
+      outcome << "FAILED " << ib;
+      nfailed++;
+      LOG("AppInit", pERROR) << "Block " << ib << " failed";
+    }
+    if(sock->Send(outcome.str().c_str()) <= 0) {
+      LOG("AppInit", pERROR) << "Lost the connection to the coordinator";
+      break;
+    }
+  }
+
+  LOG("AppInit", pNOTICE)
+    << "Generated " << ndone << " blocks (" << nfailed << " failed)";
+
+  sock->Close();
+  delete sock;
+  exit( (nfailed > 0) ? 1 : 0 );
+}
+//___________________________________________________________________________
@@ -20,6 +20,13 @@
 #ifndef _APP_INIT_UTILS_H_
 #define _APP_INIT_UTILS_H_
 
+#include <string>
+
+using std::string;
+
+class TFile;
+class TTree;
+
 namespace genie {
 namespace utils {
 
@@ -29,6 +36,77 @@ namespace app_init
   void XSecTable      (string inpfile, bool require_table);
   void MesgThresholds (string inpfile);
   void CacheFile      (string inpfile);
+  void MaxXSecTable   (string inpfile);
+
+  // apply the output file / tree options of RunOpt (compression, basket
+  // size, autosave & autoflush cadence); call for trees once their
+  // branches are created
+  void OutputFile     (TFile * file);
+  void OutputTree     (TTree * tree);
+
+  // fork-after-initialisation worker mode: call once the event generation
+  // drivers are configured (so that the workers share, copy-on-write, the
+  // loaded configuration, splines, geometry, flux and probability scales)
+  // and before any output file is opened. Forks nworkers worker processes
+  // and returns the worker number (0, 1, ..., nworkers-1) in each of them,
+  // with the random number generators re-seeded with WorkerSeed() (unless
+  // using counter-based streams, keyed on the job seed and event number). The
+  // calling process only waits for the workers, then exits (with a non-zero
+  // status if any worker failed). If nworkers < 2 nothing is forked and -1
+  // is returned.
+  int    ForkWorkers    (int nworkers);
+  long int WorkerSeed   (long int seed, int iworker);
+
+  // the seed of the random number generator of event generation thread
+  // ithread (see RandomGen::SetThreadSeed()) of a job, or of a worker,
+  // seeded with seed: unrelated to the seeds of the workers and shards
+  long int ThreadSeed   (long int seed, int ithread);
+
+  // the output file name of a worker: `_w<iworker>' is inserted before
+  // the extension(s), eg gntp.0.ghep.root -> gntp_w2.0.ghep.root
+  // (the name is returned unchanged if iworker < 0)
+  string WorkerFilename (string filename, int iworker);
+
+  // the share of worker iworker of n events (or POT ...) split between
+  // nworkers workers (n if iworker < 0)
+  long int WorkerShare  (long int n, int iworker, int nworkers);
+  double   WorkerShare  (double n, int iworker, int nworkers);
+
+  // dynamic scheduling of n events between all the threads of all the
+  // workers: claims the next event, returning its job-wide number (0, 1,
+  // ..., n-1), or -1 once all of them were claimed. The claim counter lives
+  // in memory shared by the workers forked by ForkWorkers(), so that the
+  // events are handed out on demand rather than split in advance and the
+  // workers generating cheaper events simply generate more of them. Call
+  // with the same n from all of them.
+  long int ClaimEvent   (long int n);
+
+  // deterministic sharded production (--shard ishard/nshards), eg. for
+  // batch jobs: parse the option (false if invalid); the seed of a shard,
+  // reproducible and unrelated to the ones of the other shards and of their
+  // workers; the output file name of a shard (`_s<ishard>' inserted as for
+  // the workers; unchanged if ishard < 0); and the exposure metadata saved
+  // with the events of a shard (TFolder `gexposure' in the file of the
+  // event tree), which sum exactly over the shards of a production
+  bool     ShardOption   (string opt, int & ishard, int & nshards);
+  long int ShardSeed     (long int seed, int ishard);
+  string   ShardFilename (string filename, int ishard);
+  void     SaveExposure  (TTree * evtree, int ishard, int nshards,
+                          long int seed, double exposure, string units,
+                          long int nflux, long int nev);
+
+  // coordinated production (--coordinated-by host:port, see JobCoordinator):
+  // call where ForkWorkers() is called (after it, if forking workers too).
+  // Connects to the coordinator and, for each block it hands out, forks a
+  // process generating the block, which returns the block number: the
+  // shard to generate, out of nblocks (with its seed, ShardSeed(), already
+  // set), up to nev events (if > 0) and up to the input exposure (if > 0).
+  // The calling process sends heartbeats while the block gets generated,
+  // reports its outcome (as saved by SaveExposure()) to the coordinator,
+  // and exits once told to stop (with a non-zero status if any block or
+  // the connection failed).
+  int      CoordinatedBlock (string coordinator, int & nblocks,
+                             long int & nev, double & exposure);
 
 } // app_init namespace
 } // utils namespace
@@ -0,0 +1,98 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::BoundedQueue
+
+\brief    A bounded, blocking FIFO queue connecting the stages of a pipeline
+          run by different threads.
+
+          Push() blocks while the queue is full and Pop() while it is empty,
+          so a fast stage can not run further ahead of a slow one than the
+          queue depth. Close() wakes up all waiting threads: Push() fails from
+          then on, and Pop() fails once the queued items have been taken.
+          Items are moved in and out of the queue.
+
+          Header only (not part of the ROOT dictionary).
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _BOUNDED_QUEUE_H_
+#define _BOUNDED_QUEUE_H_
+
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <utility>
+
+namespace genie {
+
+template <class T> class BoundedQueue {
+
+public:
+  BoundedQueue(unsigned int depth) :
+    fSlots  (depth > 0 ? depth : 1),
+    fHead   (0),
+    fCount  (0),
+    fClosed (false)
+  {
+  }
+
+  unsigned int Depth(void) const { return fSlots.size(); }
+
+  //! Queue an item, waiting for a free slot. Returns false if closed.
+  bool Push(T && item)
+  {
+    std::unique_lock<std::mutex> lock(fMutex);
+    fNotFull.wait(lock, [this]{ return fClosed || fCount < fSlots.size(); });
+    if ( fClosed ) return false;
+    fSlots[(fHead + fCount) % fSlots.size()] = std::move(item);
+    fCount++;
+    fNotEmpty.notify_one();
+    return true;
+  }
+
+  //! Take the oldest item, waiting for one. Returns false if the queue was
+  //! closed and all its items have been taken.
+  bool Pop(T & item)
+  {
+    std::unique_lock<std::mutex> lock(fMutex);
+    fNotEmpty.wait(lock, [this]{ return fClosed || fCount > 0; });
+    if ( fCount == 0 ) return false;
+    item = std::move(fSlots[fHead]);
+    fHead = (fHead + 1) % fSlots.size();
+    fCount--;
+    fNotFull.notify_one();
+    return true;
+  }
+
+  void Close(void)
+  {
+    {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fClosed = true;
+    }
+    fNotFull.notify_all();
+    fNotEmpty.notify_all();
+  }
+
+private:
+  std::vector<T>          fSlots;    ///< ring buffer of queued items
+  unsigned int            fHead;     ///< oldest queued item
+  unsigned int            fCount;    ///< number of queued items
+  bool                    fClosed;   ///< no more items can be queued
+  std::mutex              fMutex;
+  std::condition_variable fNotFull;
+  std::condition_variable fNotEmpty;
+};
+
+} // genie namespace
+
+#endif // _BOUNDED_QUEUE_H_
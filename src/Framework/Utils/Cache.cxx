@@ -10,6 +10,12 @@
 
 #include <sstream>
 #include <iostream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <atomic>
 
 #include <TSystem.h>
 #include <TDirectory.h>
@@ -22,6 +28,48 @@
 
 using std::ostringstream;
 using std::endl;
+using std::vector;
+using std::setw;
+using std::setprecision;
+
+namespace {
+
+  typedef map<string, genie::CacheBranchI *> BranchMap;
+
+  // immutable copy of the branch map read by the look-ups
+  std::shared_ptr<const BranchMap> gSnapshot;
+
+  // serialises the changes to the branch map and the snapshot publication
+  std::mutex gCacheMutex;
+
+  // branches added under a key already taken (eg by another thread that
+  // built the same branch at the same time): kept alive for their users
+  vector<genie::CacheBranchI *> gDuplicates;
+
+  // branch look-ups, and those finding the branch
+  std::atomic<Long64_t> gNFinds(0);
+  std::atomic<Long64_t> gNFound(0);
+
+  // number of cache branch removals
+  std::atomic<unsigned int> gGeneration(0);
+
+  // a branch in the usage summary
+  struct BranchUsage {
+    size_t                     nbytes;
+    string                     key;
+    const genie::CacheBranchI * branch;
+    bool operator < (const BranchUsage & other) const {
+      return nbytes > other.nbytes; // largest first
+    }
+  };
+
+  // publish the current branch map; call with gCacheMutex held
+  void Publish(const BranchMap & branches)
+  {
+    std::shared_ptr<const BranchMap> snapshot(new BranchMap(branches));
+    std::atomic_store(&gSnapshot, snapshot);
+  }
+}
 
 namespace genie {
 
@@ -57,6 +105,11 @@ Cache::~Cache()
     fCacheMap->clear();
     delete fCacheMap;
   }
+  for(unsigned int i = 0; i < gDuplicates.size(); i++) {
+    delete gDuplicates[i];
+  }
+  gDuplicates.clear();
+  std::atomic_store(&gSnapshot, std::shared_ptr<const BranchMap>());
   if(fCacheFile) {
     fCacheFile->Close();
     delete fCacheFile;
@@ -79,15 +132,29 @@ Cache * Cache::Instance()
 //____________________________________________________________________________
 CacheBranchI * Cache::FindCacheBranch(string key)
 {
-  map<string, CacheBranchI *>::const_iterator map_iter = fCacheMap->find(key);
+  gNFinds.fetch_add(1, std::memory_order_relaxed);
+
+  std::shared_ptr<const BranchMap> snapshot = std::atomic_load(&gSnapshot);
+  if(!snapshot) return 0;
+
+  BranchMap::const_iterator map_iter = snapshot->find(key);
 
-  if (map_iter == fCacheMap->end()) return 0;
+  if (map_iter == snapshot->end()) return 0;
+  gNFound.fetch_add(1, std::memory_order_relaxed);
   return map_iter->second;
 }
 //____________________________________________________________________________
 void Cache::AddCacheBranch(string key, CacheBranchI * branch)
 {
+  std::lock_guard<std::mutex> lock(gCacheMutex);
+
+  map<string, CacheBranchI *>::const_iterator map_iter = fCacheMap->find(key);
+  if(map_iter != fCacheMap->end()) {
+    if(map_iter->second != branch) gDuplicates.push_back(branch);
+    return;
+  }
   fCacheMap->insert( map<string, CacheBranchI *>::value_type(key,branch) );
+  Publish(*fCacheMap);
 }
 //____________________________________________________________________________
 string Cache::CacheBranchKey(string k0, string k1, string k2) const
@@ -111,6 +178,8 @@ void Cache::RmAllCacheBranches(void)
 {
   LOG("Cache", pNOTICE) << "Removing cache branches";
 
+  std::lock_guard<std::mutex> lock(gCacheMutex);
+
   if(fCacheMap) {
     map<string, CacheBranchI * >::iterator citer;
     for(citer = fCacheMap->begin(); citer != fCacheMap->end(); ++citer) {
@@ -121,7 +190,14 @@ void Cache::RmAllCacheBranches(void)
       }
     }
     fCacheMap->clear();
+    Publish(*fCacheMap);
   }
+  gGeneration++;
+}
+//____________________________________________________________________________
+unsigned int Cache::Generation(void) const
+{
+  return gGeneration;
 }
 //____________________________________________________________________________
 void Cache::RmMatchedCacheBranches(string key_substring)
@@ -135,6 +211,9 @@ void Cache::Load(void)
   LOG("Cache", pNOTICE) << "Loading cache";
 
   if(!fCacheFile) return;
+
+  std::lock_guard<std::mutex> lock(gCacheMutex);
+
   TList * keys = (TList*) fCacheFile->Get("key_list");
   TIter kiter(keys);
   TObjString * keyobj = 0;
@@ -148,6 +227,7 @@ void Cache::Load(void)
      fCacheMap->insert( map<string, CacheBranchI *>::value_type(key,buffer) );
     }
   }
+  Publish(*fCacheMap);
   LOG("Cache", pNOTICE) << "Cache loaded...";
   LOG("Cache", pNOTICE) << *this;
 }
@@ -218,6 +298,75 @@ void Cache::Print(ostream & stream) const
   }
   stream << "\n";
 }
+//____________________________________________________________________________
+size_t Cache::ByteSize(void) const
+{
+  std::shared_ptr<const BranchMap> snapshot = std::atomic_load(&gSnapshot);
+  if(!snapshot) return 0;
+
+  size_t nbytes = 0;
+  BranchMap::const_iterator citer;
+  for(citer = snapshot->begin(); citer != snapshot->end(); ++citer) {
+    if(citer->second) nbytes += citer->second->ByteSize();
+    nbytes += citer->first.capacity();
+  }
+  return nbytes;
+}
+//____________________________________________________________________________
+void Cache::PrintUsage(ostream & stream, unsigned int nmax) const
+{
+  std::shared_ptr<const BranchMap> snapshot = std::atomic_load(&gSnapshot);
+
+  vector<BranchUsage> usage;
+  size_t nbytes = 0;
+  if(snapshot) {
+    BranchMap::const_iterator citer;
+    for(citer = snapshot->begin(); citer != snapshot->end(); ++citer) {
+      if(!citer->second) continue;
+      BranchUsage u;
+      u.nbytes = citer->second->ByteSize();
+      u.key    = citer->first;
+      u.branch = citer->second;
+      usage.push_back(u);
+      nbytes += u.nbytes;
+    }
+  }
+  std::sort(usage.begin(), usage.end());
+
+  stream << "\n [-] GENIE Cache usage (largest branches first):";
+  stream << "\n  | " << std::right
+         << setw(11) << "size (MB)"
+         << setw(17) << "type"
+         << setw(10) << "entries"
+         << setw(12) << "look-ups"
+         << setw(9)  << "hits %"
+         << setw(10) << "inserts" << "  key";
+
+  stream << std::fixed;
+  for(unsigned int i = 0; i < usage.size() && i < nmax; i++) {
+    const CacheBranchI * b = usage[i].branch;
+    double hits = (b->NLookups() > 0) ?
+         100. * b->NHits() / b->NLookups() : 0.;
+    stream << "\n  | " << setprecision(3)
+           << setw(11) << usage[i].nbytes / 1048576.
+           << setw(17) << b->ClassName()
+           << setw(10) << b->NEntries()
+           << setw(12) << b->NLookups() << setprecision(1)
+           << setw(9)  << hits
+           << setw(10) << b->NInserts() << "  " << usage[i].key;
+  }
+  if(usage.size() > nmax) {
+    stream << "\n  | ... and " << usage.size() - nmax << " more";
+  }
+  Long64_t nfinds = gNFinds.load(std::memory_order_relaxed);
+  Long64_t nfound = gNFound.load(std::memory_order_relaxed);
+  stream << setprecision(1)
+         << "\n  | total: " << usage.size() << " branches, "
+         << nbytes / 1048576. << " MB; branch look-ups: " << nfinds
+         << " (" << nfinds - nfound << " not found)";
+  stream.unsetf(std::ios::floatfield);
+  stream << "\n";
+}
 //___________________________________________________________________________
 
 } // genie namespace
@@ -5,6 +5,19 @@
 
 \brief    GENIE Cache Memory
 
+          Cache branch look-ups (FindCacheBranch()) are lock-free: they read
+          an immutable snapshot of the branch map, which is re-published
+          by every change to the map. Changes are serialised. A branch
+          should be filled before it is added, so that other threads never
+          see it half-built. Removing branches is not safe while other
+          threads may be using them. Users holding on to branch pointers
+          re-find them when the cache generation (Generation()) changes,
+          ie. after all branches were removed.
+
+          The usage summary (PrintUsage()) ranks the branches by their
+          estimated memory, and shows the look-ups, hits and insertions of
+          their cached values.
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -54,8 +67,16 @@ public:
   void RmAllCacheBranches    (void);
   void RmMatchedCacheBranches(string key_substring);
 
-  //! print cache buffers
-  void   Print (ostream & stream) const;
+  //! incremented whenever cache branches are removed
+  unsigned int Generation (void) const;
+
+  //! estimated memory taken by all cache branches (bytes)
+  size_t ByteSize (void) const;
+
+  //! print cache buffers, and the usage summary of (at most nmax of) the
+  //! cache branches taking the most memory
+  void   Print      (ostream & stream) const;
+  void   PrintUsage (ostream & stream, unsigned int nmax = 20) const;
   friend ostream & operator << (ostream & stream, const Cache & cache);
 
 private:
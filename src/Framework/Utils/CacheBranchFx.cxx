@@ -8,10 +8,26 @@
 */
 //____________________________________________________________________________
 
+#include <mutex>
+#include <stdint.h>
+
 #include "Framework/Utils/CacheBranchFx.h"
 
 using namespace genie;
 
+namespace {
+
+  // branch mutexes: a branch uses the mutex picked by its address
+  const unsigned int kNBranchMutexes = 64;
+  std::mutex gBranchMutex[kNBranchMutexes];
+
+  std::mutex & BranchMutex(const void * branch)
+  {
+    uintptr_t addr = (uintptr_t) branch;
+    return gBranchMutex[(addr >> 4) % kNBranchMutexes];
+  }
+}
+
 ClassImp(CacheBranchFx);
 
 //____________________________________________________________________________
@@ -51,21 +67,68 @@ void CacheBranchFx::Init(void)
 void CacheBranchFx::CleanUp(void)
 {
   if(fSpline) delete fSpline;
+  for(unsigned int i = 0; i < fRetired.size(); i++) delete fRetired[i];
+  fRetired.clear();
   fFx.clear();
 }
 //____________________________________________________________________________
 void CacheBranchFx::Reset(void)
 {
+  std::lock_guard<std::mutex> lock(BranchMutex(this));
   this->CleanUp();
   this->Init();
 }
 //____________________________________________________________________________
 void CacheBranchFx::AddValues(double x, double y)
 {
-  fFx.insert(map<double,double>::value_type(x,y));
+  std::lock_guard<std::mutex> lock(BranchMutex(this));
+  if(fFx.insert(map<double,double>::value_type(x,y)).second) {
+    this->CountInsert();
+  }
 }
 //____________________________________________________________________________
 void CacheBranchFx::CreateSpline(void)
+{
+  std::lock_guard<std::mutex> lock(BranchMutex(this));
+  this->BuildSpline();
+}
+//____________________________________________________________________________
+void CacheBranchFx::Update(double x, double y, unsigned int nmin)
+{
+  std::lock_guard<std::mutex> lock(BranchMutex(this));
+
+  if(y>0 && fFx.insert(map<double,double>::value_type(x,y)).second) {
+    this->CountInsert();
+  }
+
+  if(!fSpline) {
+    if(fFx.size() > nmin) this->BuildSpline();
+  } else {
+    if(x < fSpline->XMin() || x > fSpline->XMax()) this->BuildSpline();
+  }
+}
+//____________________________________________________________________________
+bool CacheBranchFx::Lookup(
+               double x, double dx, double & y, bool use_spline) const
+{
+  std::lock_guard<std::mutex> lock(BranchMutex(this));
+
+  if(use_spline && fSpline) {
+    bool hit = (x >= fSpline->XMin() && x <= fSpline->XMax());
+    this->CountLookup(hit);
+    if(!hit) return false;
+    y = fSpline->Evaluate(x);
+    return true;
+  }
+  map<double,double>::const_iterator iter = fFx.lower_bound(x);
+  bool hit = (iter != fFx.end() && iter->first - x < dx);
+  this->CountLookup(hit);
+  if(!hit) return false;
+  y = iter->second;
+  return true;
+}
+//____________________________________________________________________________
+void CacheBranchFx::BuildSpline(void)
 {
   int n = fFx.size();
   double * x = new double[n];
@@ -79,7 +142,8 @@ void CacheBranchFx::CreateSpline(void)
     i++;
   }
 
-  if(fSpline) delete fSpline;
+  // keep the old spline alive for anyone still holding it
+  if(fSpline) fRetired.push_back(fSpline);
   fSpline = new Spline(n,x,y);
 
   delete [] x;
@@ -92,8 +156,28 @@ void CacheBranchFx::Print(ostream & stream) const
            << " / spline: " << ((fSpline) ? "built" : "null");
 }
 //____________________________________________________________________________
+Long64_t CacheBranchFx::NEntries(void) const
+{
+  std::lock_guard<std::mutex> lock(BranchMutex(this));
+  return fFx.size();
+}
+//____________________________________________________________________________
+size_t CacheBranchFx::ByteSize(void) const
+{
+  std::lock_guard<std::mutex> lock(BranchMutex(this));
+
+  size_t nbytes = sizeof(CacheBranchFx) + fName.capacity();
+  nbytes += fFx.size() * MapNodeSize(sizeof(map<double,double>::value_type));
+  if(fSpline) nbytes += fSpline->ByteSize();
+  for(unsigned int i = 0; i < fRetired.size(); i++) {
+    nbytes += fRetired[i]->ByteSize() + sizeof(Spline *);
+  }
+  return nbytes;
+}
+//____________________________________________________________________________
 double CacheBranchFx::operator () (double x) const
 {
+  this->CountLookup(fSpline != 0);
   if(!fSpline) return 0;
   else         return fSpline->Evaluate(x);
 }
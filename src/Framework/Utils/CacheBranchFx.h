@@ -5,6 +5,12 @@
 
 \brief    A simple cache branch storing the cached data in a TNtuple
 
+          The branch can be shared by threads: AddValues(), CreateSpline(),
+          Update() and Lookup() are serialised on a mutex picked (by branch
+          address) out of a small pool. A re-built spline replaces the old
+          one, which is kept until the branch is reset, so that a Spl() handed
+          out earlier stays valid. Map() is for single-threaded use.
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -21,6 +27,7 @@
 #include <iostream>
 #include <string>
 #include <map>
+#include <vector>
 
 #include "Framework/Numerical/Spline.h"
 #include "Framework/Utils/CacheBranchI.h"
@@ -28,6 +35,7 @@
 using std::string;
 using std::ostream;
 using std::map;
+using std::vector;
 
 namespace genie {
 
@@ -49,19 +57,32 @@ public:
   void CreateSpline(void);
   void AddValues(double x, double y);
 
+  //! Add (x,y) and build the spline once there are more than nmin values,
+  //! re-building it whenever x falls out of its range
+  void Update(double x, double y, unsigned int nmin);
+
+  //! y(x) from the spline (if use_spline and x is in its range) or else
+  //! from the first value at x' >= x with x'-x < dx (if there is no spline)
+  bool Lookup(double x, double dx, double & y, bool use_spline = true) const;
+
   void Reset (void);
   void Print (ostream & stream) const;
 
+  Long64_t NEntries (void) const;
+  size_t   ByteSize (void) const;
+
   double operator () (double x) const;
   friend ostream & operator << (ostream & stream, const CacheBranchFx & cbntp);
 
 private:
-  void Init    (void);
-  void CleanUp (void);
+  void Init        (void);
+  void CleanUp     (void);
+  void BuildSpline (void);
 
   string             fName;   ///< cache branch name
   map<double,double> fFx;     ///< x->y map
   Spline *           fSpline; ///< spline y = f(x)
+  vector<Spline *>   fRetired; //! replaced splines, deleted at Reset()
 
 ClassDef(CacheBranchFx,1)
 };
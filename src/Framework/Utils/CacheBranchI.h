@@ -5,6 +5,11 @@
 
 \brief    The TObject at the root of concrete cache branches
 
+          Branches count the look-ups of their cached values, those answered
+          from the cache (hits) and the values inserted, and estimate the
+          memory they take, for the Cache usage summary (Cache::PrintUsage).
+          The counters are not saved with the branch.
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -18,6 +23,9 @@
 #ifndef _CACHE_BRANCH_I_H_
 #define _CACHE_BRANCH_I_H_
 
+#include <cstddef>
+#include <atomic>
+
 #include <TObject.h>
 
 namespace genie {
@@ -26,8 +34,41 @@ class CacheBranchI : public TObject
 {
 public:
   virtual ~CacheBranchI() {}
+
+  //! Number of cached entries and estimated memory taken (bytes)
+  virtual Long64_t NEntries (void) const = 0;
+  virtual size_t   ByteSize (void) const = 0;
+
+  //! Usage counters
+  Long64_t NLookups (void) const { return fNLookups.load(std::memory_order_relaxed); }
+  Long64_t NHits    (void) const { return fNHits.load(std::memory_order_relaxed);    }
+  Long64_t NMisses  (void) const { return this->NLookups() - this->NHits();          }
+  Long64_t NInserts (void) const { return fNInserts.load(std::memory_order_relaxed); }
+
 protected:
-  CacheBranchI() : TObject() {}
+  CacheBranchI() : TObject(), fNLookups(0), fNHits(0), fNInserts(0) {}
+
+  void CountLookup (bool hit) const
+  {
+    fNLookups.fetch_add(1, std::memory_order_relaxed);
+    if(hit) fNHits.fetch_add(1, std::memory_order_relaxed);
+  }
+  void CountInsert (Long64_t n = 1) const
+  {
+    fNInserts.fetch_add(n, std::memory_order_relaxed);
+  }
+
+  //! Estimated memory taken by a std::map node holding a value of the input
+  //! size: the value, the tree links and colour, and the allocation overhead
+  static size_t MapNodeSize (size_t value_size)
+  {
+    return value_size + 4*sizeof(void *) + 16;
+  }
+
+private:
+  mutable std::atomic<Long64_t> fNLookups; //! look-ups of cached values
+  mutable std::atomic<Long64_t> fNHits;    //! look-ups answered from the cache
+  mutable std::atomic<Long64_t> fNInserts; //! values inserted
 
 ClassDef(CacheBranchI,0)
 };
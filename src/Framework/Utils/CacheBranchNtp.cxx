@@ -9,6 +9,7 @@
 //____________________________________________________________________________
 
 #include <TNtupleD.h>
+#include <TBranch.h>
 
 #include "Framework/Utils/CacheBranchNtp.h"
 
@@ -78,6 +79,26 @@ void CacheBranchNtp::Print(ostream & stream) const
   }
 }
 //____________________________________________________________________________
+Long64_t CacheBranchNtp::NEntries(void) const
+{
+  return (fNtp) ? fNtp->GetEntries() : 0;
+}
+//____________________________________________________________________________
+size_t CacheBranchNtp::ByteSize(void) const
+{
+// The ntuple is kept in memory: its baskets take (about) the uncompressed
+// size of the filled entries, plus a basket buffer (32 kB, the TNtupleD
+// default) per variable
+
+  size_t nbytes = sizeof(CacheBranchNtp);
+  if(fNtp) {
+    nbytes += sizeof(TNtupleD);
+    nbytes += fNtp->GetNvar() * (sizeof(TBranch) + 32000);
+    nbytes += fNtp->GetEntries() * fNtp->GetNvar() * sizeof(double);
+  }
+  return nbytes;
+}
+//____________________________________________________________________________
 TNtupleD * CacheBranchNtp::operator () (void) const
 {
   return this->Ntuple();
@@ -48,6 +48,9 @@ public:
   void Reset (void);
   void Print (ostream & stream) const;
 
+  Long64_t NEntries (void) const;
+  size_t   ByteSize (void) const;
+
   TNtupleD *       operator () (void) const;
   friend ostream & operator << (ostream & stream, const CacheBranchNtp & cbntp);
 
@@ -0,0 +1,170 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <iomanip>
+#include <algorithm>
+#include <mutex>
+
+#include <TMath.h>
+
+#include "Framework/Utils/ChannelCostStats.h"
+#include "Framework/Utils/EventGenCost.h"
+
+using std::setw;
+using std::setprecision;
+
+namespace {
+  std::mutex gChannelCostMutex; // guards ChannelCostStats::fCosts
+
+  bool Costlier(const genie::ChannelCost & a, const genie::ChannelCost & b)
+  {
+    return a.time > b.time;
+  }
+}
+
+namespace genie {
+
+//____________________________________________________________________________
+ostream & operator << (ostream & stream, const ChannelCostStats & stats)
+{
+  stats.Print(stream);
+  return stream;
+}
+//____________________________________________________________________________
+ChannelCost::ChannelCost() :
+channel(""), evgen(""), nevents(0), time(0.), time2(0.), tmax(0.),
+nkinerej(0), nfsisteps(0)
+{
+
+}
+//____________________________________________________________________________
+ChannelCostStats * ChannelCostStats::fInstance = 0;
+//____________________________________________________________________________
+ChannelCostStats::ChannelCostStats()
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+ChannelCostStats::~ChannelCostStats()
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+ChannelCostStats * ChannelCostStats::Instance()
+{
+  std::lock_guard<std::mutex> lock(gChannelCostMutex);
+  if(fInstance == 0) {
+    static ChannelCostStats::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new ChannelCostStats;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+void ChannelCostStats::Add(const EventGenCost & cost)
+{
+  if(cost.channel.size() == 0) return; // not generated by an EventGenerator
+
+  double t = 0.;
+  for(unsigned int i = 0; i < cost.modtime.size(); i++) t += cost.modtime[i];
+
+  std::lock_guard<std::mutex> lock(gChannelCostMutex);
+
+  ChannelCost & c = fCosts[cost.channel];
+  if(c.nevents == 0) {
+    c.channel = cost.channel;
+    c.evgen   = cost.evgen;
+  }
+  c.nevents++;
+  c.time      += t;
+  c.time2     += t*t;
+  c.tmax       = TMath::Max(c.tmax, t);
+  c.nkinerej  += cost.nkinerej;
+  c.nfsisteps += cost.nfsisteps;
+}
+//____________________________________________________________________________
+void ChannelCostStats::Reset(void)
+{
+  std::lock_guard<std::mutex> lock(gChannelCostMutex);
+  fCosts.clear();
+}
+//____________________________________________________________________________
+bool ChannelCostStats::IsEmpty(void) const
+{
+  std::lock_guard<std::mutex> lock(gChannelCostMutex);
+  return fCosts.empty();
+}
+//____________________________________________________________________________
+vector<ChannelCost> ChannelCostStats::Costs(void) const
+{
+  vector<ChannelCost> costs;
+  {
+    std::lock_guard<std::mutex> lock(gChannelCostMutex);
+    map<string, ChannelCost>::const_iterator iter;
+    for(iter = fCosts.begin(); iter != fCosts.end(); ++iter) {
+      costs.push_back(iter->second);
+    }
+  }
+  std::stable_sort(costs.begin(), costs.end(), Costlier);
+  return costs;
+}
+//____________________________________________________________________________
+void ChannelCostStats::Print(ostream & stream, unsigned int nmax) const
+{
+  vector<ChannelCost> costs = this->Costs();
+
+  Long64_t nevents = 0;
+  double   time    = 0.;
+  for(unsigned int i = 0; i < costs.size(); i++) {
+    nevents += costs[i].nevents;
+    time    += costs[i].time;
+  }
+
+  stream << "\n [-] Event generation cost per channel (costliest first):";
+  stream << "\n  | " << std::right
+         << setw(10) << "events"
+         << setw(9)  << "evt %"
+         << setw(12) << "time (s)"
+         << setw(9)  << "time %"
+         << setw(12) << "mean (s)"
+         << setw(12) << "max (s)"
+         << setw(12) << "kine rej"
+         << setw(12) << "fsi steps" << "  channel";
+
+  for(unsigned int i = 0; i < costs.size() && i < nmax; i++) {
+    const ChannelCost & c = costs[i];
+    double fevt  = (nevents > 0) ? 100. * c.nevents / nevents : 0.;
+    double ftime = (time    > 0) ? 100. * c.time / time       : 0.;
+    stream << "\n  | " << setw(10) << c.nevents
+           << std::fixed << setprecision(2)
+           << setw(9)  << fevt
+           << setprecision(3)
+           << setw(12) << c.time
+           << setprecision(2)
+           << setw(9)  << ftime
+           << std::scientific << setprecision(3)
+           << setw(12) << c.time / c.nevents
+           << setw(12) << c.tmax;
+    stream.unsetf(std::ios::floatfield);
+    stream << setw(12) << c.nkinerej
+           << setw(12) << c.nfsisteps << "  " << c.channel;
+  }
+  if(costs.size() > nmax) {
+    stream << "\n  | ... and " << costs.size() - nmax << " more channels";
+  }
+  stream << std::fixed << setprecision(3)
+         << "\n  | total: " << nevents << " events in " << costs.size()
+         << " channels, " << time << " s";
+  stream.unsetf(std::ios::floatfield);
+  stream << "\n";
+}
+//____________________________________________________________________________
+
+} // genie namespace
@@ -0,0 +1,104 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::ChannelCostStats
+
+\brief    Event generation cost per interaction channel (process, target,
+          hit nucleon, resonance ...): events, time in the event generation
+          modules (total, mean and the costliest event), kinematic selection
+          rejections and intranuclear hadron transport steps. It shows the
+          (possibly rare) channels taking a large share of the job time.
+
+          The statistics are filled from the generation cost of each event
+          (EventGenCost) as it is written out (NtpWriter), attributing all
+          the attempts made to generate an event to the channel finally
+          generated. They are reported by GMCJMonitor and are saved with the
+          job metadata (NtpMCJobEnv).
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _CHANNEL_COST_STATS_H_
+#define _CHANNEL_COST_STATS_H_
+
+#include <map>
+#include <string>
+#include <vector>
+#include <ostream>
+
+#include <Rtypes.h>
+
+using std::map;
+using std::string;
+using std::vector;
+using std::ostream;
+
+namespace genie {
+
+class ChannelCostStats;
+struct EventGenCost;
+
+ostream & operator << (ostream & stream, const ChannelCostStats & stats);
+
+//! The generation cost of one interaction channel
+struct ChannelCost {
+  ChannelCost();
+
+  string   channel;   ///< interaction channel (Interaction::AsString())
+  string   evgen;     ///< event generation thread (EventGenerator) of the channel
+  Long64_t nevents;   ///< events generated
+  double   time;      ///< time in the event generation modules (s)
+  double   time2;     ///< sum of the squared event times (s^2)
+  double   tmax;      ///< time of the costliest event (s)
+  Long64_t nkinerej;  ///< kinematic points rejected by the kinematic selection
+  Long64_t nfsisteps; ///< intranuclear hadron transport steps
+};
+
+class ChannelCostStats {
+
+public:
+  static ChannelCostStats * Instance (void);
+
+  //! Add the generation cost of an event
+  void Add     (const EventGenCost & cost);
+  void Reset   (void);
+  bool IsEmpty (void) const;
+
+  //! The channels, the costliest (in total time) first
+  vector<ChannelCost> Costs (void) const;
+
+  //! Print the (at most) nmax costliest channels
+  void Print (ostream & stream, unsigned int nmax = 40) const;
+  friend ostream & operator << (ostream & stream, const ChannelCostStats & stats);
+
+private:
+  ChannelCostStats();
+  ChannelCostStats(const ChannelCostStats & stats);
+ ~ChannelCostStats();
+
+  static ChannelCostStats * fInstance;
+
+  map<string, ChannelCost> fCosts; ///< channel -> cost
+
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (ChannelCostStats::fInstance !=0) {
+            delete ChannelCostStats::fInstance;
+            ChannelCostStats::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+
+#endif // _CHANNEL_COST_STATS_H_
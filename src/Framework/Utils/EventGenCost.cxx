@@ -0,0 +1,47 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <chrono>
+
+#include "Framework/Utils/EventGenCost.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+EventGenCost::EventGenCost()
+{
+  this->Reset();
+}
+//____________________________________________________________________________
+EventGenCost & EventGenCost::Current(void)
+{
+  thread_local EventGenCost cost;
+  return cost;
+}
+//____________________________________________________________________________
+double EventGenCost::WallTime(void)
+{
+  return std::chrono::duration<double>(
+           std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+//____________________________________________________________________________
+void EventGenCost::Reset(void)
+{
+  start      = WallTime();
+  evgen      = "";
+  channel    = "";
+  nkinerej   = 0;
+  nflux      = 0;
+  ngeomsteps = 0;
+  geomtime   = 0.;
+  nfsisteps  = 0;
+  modtime.clear();
+}
+//____________________________________________________________________________
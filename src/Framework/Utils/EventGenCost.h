@@ -0,0 +1,67 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::EventGenCost
+
+\brief    The generation cost of the event being generated on the current
+          thread: wall time, time per event generation module, kinematic
+          selection rejections, flux neutrinos thrown and geometry navigation
+          steps since the previous event was written out, and the channel
+          (interaction) finally generated.
+
+          The counters are filled by EventGenerator, KineGeneratorWithCache,
+          GMCJDriver, ROOTGeomAnalyzer and Intranuke on the generating thread,
+          and are taken (and reset) by NtpWriter::AddEventRecord(), which can
+          store them in the `gcost' branch of the event tree (NtpMCEventCost)
+          and adds them to the job totals (JobTelemetry) and to the totals
+          per channel (ChannelCostStats).
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _EVENT_GEN_COST_H_
+#define _EVENT_GEN_COST_H_
+
+#include <string>
+#include <vector>
+
+#include <Rtypes.h>
+
+using std::string;
+using std::vector;
+
+namespace genie {
+
+struct EventGenCost {
+  EventGenCost();
+
+  //! the counters of the event being generated on this thread
+  static EventGenCost & Current (void);
+
+  //! a monotonic wall clock (s)
+  static double WallTime (void);
+
+  //! start counting for the next event
+  void Reset (void);
+
+  double          start;      ///< wall time when counting started (s)
+  string          evgen;      ///< event generation thread (EventGenerator) of the event
+  string          channel;    ///< interaction generated (Interaction::AsString())
+  vector<double>  modtime;    ///< (steady clock) time of each module of that thread (s)
+  Long64_t        nkinerej;   ///< kinematic points rejected by the kinematic selection
+  Long64_t        nflux;      ///< flux neutrinos thrown
+  Long64_t        ngeomsteps; ///< geometry navigation steps
+  double          geomtime;   ///< time in the geometry driver (path lengths, vertex) (s)
+  Long64_t        nfsisteps;  ///< intranuclear hadron transport steps
+};
+
+}      // genie namespace
+
+#endif // _EVENT_GEN_COST_H_
@@ -0,0 +1,375 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <ctime>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+
+#include <TSocket.h>
+#include <TServerSocket.h>
+#include <TMonitor.h>
+#include <TInetAddress.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/JobCoordinator.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+JobCoordinator::JobCoordinator(
+    int nblocks, long int nev, double exposure, string units) :
+fNev      ( (nev > 0) ? nev : 0 ),
+fExposure ( (exposure > 0) ? exposure : 0 ),
+fUnits    ( units ),
+fTimeout  ( 600 ),
+fMonitor  ( 0 )
+{
+  Block block;
+  block.state          = kFree;
+  block.quota_nev      = 0;
+  block.quota_exposure = 0;
+  block.nev            = 0;
+  block.exposure       = 0;
+  block.nflux          = 0;
+  block.nfailed        = 0;
+  block.worker         = 0;
+  block.last           = 0;
+  fBlocks.assign( std::max(nblocks, 1), block );
+}
+//____________________________________________________________________________
+JobCoordinator::~JobCoordinator()
+{
+  for(unsigned int i = 0; i < fWorkers.size(); i++) delete fWorkers[i];
+  fWorkers.clear();
+  delete fMonitor;
+}
+//____________________________________________________________________________
+bool JobCoordinator::Run(int port, string summary_file)
+{
+  TServerSocket server(port, kTRUE);
+  if(!server.IsValid()) {
+    LOG("JobCoordinator", pFATAL)
+      << "Could not listen for workers at port " << port;
+    return false;
+  }
+  fMonitor = new TMonitor;
+  fMonitor->Add(&server);
+
+  LOG("JobCoordinator", pNOTICE)
+    << "Coordinating " << fBlocks.size() << " blocks, up to "
+    << ( (fNev > 0) ? fNev : -1 ) << " events and "
+    << ( (fExposure > 0) ? fExposure : -1 ) << " " << fUnits
+    << " - Waiting for the workers at port " << port;
+
+  while(!this->Finished()) {
+    // wake up every second to check for silent workers
+    TSocket * sock = fMonitor->Select(1000);
+    if(sock == &server) {
+      TSocket * worker = server.Accept();
+      if(worker && worker != (TSocket *) -1) {
+        fWorkers.push_back(worker);
+        fMonitor->Add(worker);
+        LOG("JobCoordinator", pNOTICE)
+          << "Worker " << worker->GetInetAddress().GetHostName()
+          << " connected (" << fWorkers.size() << " workers)";
+      }
+    }
+    else
+    if(sock && sock != (TSocket *) -1) {
+      this->Serve(sock);
+    }
+    this->Expire( (long int) time(0) );
+  }
+
+  // stop the workers still connected (waiting for a block)
+  while(!fWorkers.empty()) {
+    fWorkers.back()->Send("STOP");
+    this->Release(fWorkers.back(), "stopped");
+  }
+  fMonitor->Remove(&server);
+  server.Close();
+
+  this->Summary(summary_file);
+
+  // done if the target was reached, or all blocks were generated
+  bool ok = this->Reached();
+  if(fNev <= 0 && fExposure <= 0) {
+    ok = true;
+    for(unsigned int ib = 0; ib < fBlocks.size(); ib++) {
+      ok = ok && (fBlocks[ib].nfailed < kMaxFailures);
+    }
+  }
+  return ok;
+}
+//____________________________________________________________________________
+void JobCoordinator::Serve(TSocket * sock)
+{
+  char msg[256];
+  if(sock->Recv(msg, sizeof(msg)) <= 0) {
+    this->Release(sock, "disconnected");
+    return;
+  }
+
+  std::istringstream in(msg);
+  string   cmd       = "";
+  int      ib        = -1;
+  long int nev       = 0;
+  double   exposure  = 0;
+  long int nflux     = 0;
+  in >> cmd;
+
+  if(cmd == "NEXT") {
+    sock->Send( this->Assign(sock).c_str() );
+  }
+  else if(cmd == "ALIVE") {
+    in >> ib;
+    if(ib >= 0 && ib < (int) fBlocks.size() && fBlocks[ib].worker == sock) {
+      fBlocks[ib].last = (long int) time(0);
+    }
+  }
+  else if(cmd == "DONE") {
+    in >> ib >> nev >> exposure >> nflux;
+    if(in.fail()) {
+      LOG("JobCoordinator", pERROR) << "Bad block report: " << msg;
+      return;
+    }
+    this->Done(sock, ib, nev, exposure, nflux);
+  }
+  else if(cmd == "FAILED") {
+    in >> ib;
+    this->Failed(sock, ib);
+  }
+  else {
+    LOG("JobCoordinator", pWARN) << "Unknown worker message: " << msg;
+  }
+}
+//____________________________________________________________________________
+int JobCoordinator::NextBlock(long int & nev, double & exposure) const
+{
+// The next block to hand out and its quota: the part of the target not yet
+// committed (to the blocks done, or being generated) split between the
+// blocks left. Blocks handed out again keep their quota. Returns -1 if the
+// blocks, or the target, are used up.
+
+  nev      = 0;
+  exposure = 0;
+
+  int      next  = -1;
+  int      nfree = 0;
+  long int cnev  = 0;
+  double   cexp  = 0;
+  for(unsigned int ib = 0; ib < fBlocks.size(); ib++) {
+    const Block & block = fBlocks[ib];
+    if(block.state == kFree) {
+      nfree++;
+      if(next < 0) next = ib;
+    }
+    else if(block.state == kBusy) {
+      cnev += block.quota_nev;
+      cexp += block.quota_exposure;
+    }
+    else {
+      cnev += block.nev;
+      cexp += block.exposure;
+    }
+  }
+  if(next < 0) return -1;
+
+  const Block & block = fBlocks[next];
+  if(fNev > 0) {
+    long int left = fNev - cnev;
+    if(left <= 0) return -1;
+    nev = (left + nfree - 1) / nfree;
+    if(block.quota_nev > 0) nev = std::min(block.quota_nev, left);
+  }
+  if(fExposure > 0) {
+    double left = fExposure - cexp;
+    if(left <= 1E-9 * fExposure) return -1;
+    exposure = left / nfree;
+    if(block.quota_exposure > 0) exposure = std::min(block.quota_exposure, left);
+  }
+  return next;
+}
+//____________________________________________________________________________
+string JobCoordinator::Assign(TSocket * sock)
+{
+  long int nev      = 0;
+  double   exposure = 0;
+  int ib = this->NextBlock(nev, exposure);
+  if(ib < 0) {
+    // blocks being generated may still fail and be handed out again
+    for(unsigned int i = 0; i < fBlocks.size(); i++) {
+      if(fBlocks[i].state == kBusy) return "WAIT";
+    }
+    return "STOP";
+  }
+
+  Block & block = fBlocks[ib];
+  block.state          = kBusy;
+  block.quota_nev      = nev;
+  block.quota_exposure = exposure;
+  block.worker         = sock;
+  block.last           = (long int) time(0);
+  block.host           = sock->GetInetAddress().GetHostName();
+
+  std::ostringstream reply;
+  reply.precision(15);
+  reply << "BLOCK " << ib << " " << fBlocks.size() << " "
+        << nev << " " << exposure;
+
+  LOG("JobCoordinator", pNOTICE)
+    << "Block " << ib << " (" << nev << " events, " << exposure << " "
+    << fUnits << ") -> " << block.host;
+
+  return reply.str();
+}
+//____________________________________________________________________________
+void JobCoordinator::Release(TSocket * sock, const char * why)
+{
+// Forget a worker, handing out again the block it was generating
+
+  for(unsigned int ib = 0; ib < fBlocks.size(); ib++) {
+    Block & block = fBlocks[ib];
+    if(block.state != kBusy || block.worker != sock) continue;
+    LOG("JobCoordinator", pWARN)
+      << "Worker " << block.host << " " << why << " while generating block "
+      << ib << " - Handing it out again";
+    block.state  = kFree;
+    block.worker = 0;
+  }
+
+  vector<TSocket *>::iterator it =
+    std::find(fWorkers.begin(), fWorkers.end(), sock);
+  if(it != fWorkers.end()) fWorkers.erase(it);
+  if(fMonitor) fMonitor->Remove(sock);
+  sock->Close();
+  delete sock;
+}
+//____________________________________________________________________________
+void JobCoordinator::Done(
+  TSocket * sock, int ib, long int nev, double exposure, long int nflux)
+{
+  if(ib < 0 || ib >= (int) fBlocks.size()) return;
+
+  // the first report counts: a block handed out again (eg. to replace a
+  // worker which went silent) is generated alike
+  Block & block = fBlocks[ib];
+  if(block.state == kDone) return;
+
+  block.state    = kDone;
+  block.nev      = nev;
+  block.exposure = exposure;
+  block.nflux    = nflux;
+  block.worker   = 0;
+  block.host     = sock->GetInetAddress().GetHostName();
+
+  LOG("JobCoordinator", pNOTICE)
+    << "Block " << ib << " done by " << block.host << ": " << nev
+    << " events, " << exposure << " " << fUnits;
+}
+//____________________________________________________________________________
+void JobCoordinator::Failed(TSocket * sock, int ib)
+{
+  if(ib < 0 || ib >= (int) fBlocks.size()) return;
+
+  Block & block = fBlocks[ib];
+  if(block.state != kBusy || block.worker != sock) return;
+
+  block.nfailed++;
+  block.worker = 0;
+  if(block.nfailed < kMaxFailures) {
+    block.state = kFree;
+    LOG("JobCoordinator", pWARN)
+      << "Block " << ib << " failed at " << block.host
+      << " - Handing it out again";
+  } else {
+    // give it up (nothing generated)
+    block.state    = kDone;
+    block.nev      = 0;
+    block.exposure = 0;
+    block.nflux    = 0;
+    LOG("JobCoordinator", pERROR)
+      << "Block " << ib << " failed " << block.nfailed << " times - Giving up";
+  }
+}
+//____________________________________________________________________________
+void JobCoordinator::Expire(long int now)
+{
+  for(unsigned int ib = 0; ib < fBlocks.size(); ib++) {
+    Block & block = fBlocks[ib];
+    if(block.state != kBusy || now - block.last <= fTimeout) continue;
+    this->Release(block.worker, "went silent");
+  }
+}
+//____________________________________________________________________________
+bool JobCoordinator::Reached(void) const
+{
+  long int nev      = 0;
+  double   exposure = 0;
+  for(unsigned int ib = 0; ib < fBlocks.size(); ib++) {
+    if(fBlocks[ib].state != kDone) continue;
+    nev      += fBlocks[ib].nev;
+    exposure += fBlocks[ib].exposure;
+  }
+  if(fNev      > 0 && nev >= fNev) return true;
+  if(fExposure > 0 && exposure >= (1 - 1E-9) * fExposure) return true;
+  return false;
+}
+//____________________________________________________________________________
+bool JobCoordinator::Finished(void) const
+{
+  for(unsigned int ib = 0; ib < fBlocks.size(); ib++) {
+    if(fBlocks[ib].state == kBusy) return false;
+  }
+  long int nev      = 0;
+  double   exposure = 0;
+  return this->Reached() || this->NextBlock(nev, exposure) < 0;
+}
+//____________________________________________________________________________
+void JobCoordinator::Summary(string filename) const
+{
+  long int nev      = 0;
+  double   exposure = 0;
+  long int nflux    = 0;
+  int      ndone    = 0;
+
+  std::ostringstream summary;
+  summary.precision(15);
+  summary << "# block events exposure(" << fUnits << ") nflux host" << std::endl;
+  for(unsigned int ib = 0; ib < fBlocks.size(); ib++) {
+    const Block & block = fBlocks[ib];
+    if(block.state != kDone || block.nfailed >= kMaxFailures) continue;
+    summary << ib << " " << block.nev << " " << block.exposure << " "
+            << block.nflux << " " << block.host << std::endl;
+    nev      += block.nev;
+    exposure += block.exposure;
+    nflux    += block.nflux;
+    ndone++;
+  }
+  summary << "# total " << nev << " " << exposure << " " << nflux
+          << " (" << ndone << " of " << fBlocks.size() << " blocks)" << std::endl;
+
+  LOG("JobCoordinator", pNOTICE)
+    << "Production done: " << nev << " events, " << exposure << " " << fUnits
+    << ", " << nflux << " flux neutrinos in " << ndone << " of "
+    << fBlocks.size() << " blocks";
+
+  if(filename.size() == 0) return;
+  std::ofstream out(filename.c_str());
+  if(!out.is_open()) {
+    LOG("JobCoordinator", pERROR)
+      << "Could not write the production summary in " << filename;
+    return;
+  }
+  out << summary.str();
+  LOG("JobCoordinator", pNOTICE) << "Wrote the production summary in " << filename;
+}
+//____________________________________________________________________________
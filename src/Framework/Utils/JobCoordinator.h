@@ -0,0 +1,126 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::JobCoordinator
+
+\brief    The coordinator of an event generation production spread over the
+          worker processes of many nodes (see gevgen_fnal / gevgen_atmo
+          --coordinate and --coordinated-by).
+
+          The production is split into nblocks blocks: the shards of the
+          --shard option (block ib: seed ShardSeed(seed,ib), output file
+          tagged `_s<ib>' and, for flux ntuples, the ib-th block of the flux
+          entries). The workers connect (TCP) and ask for the next block,
+          which the coordinator hands out along with its event / exposure
+          quota: the part of the target not committed yet to the blocks
+          done or being generated, split evenly between the blocks left.
+          So the target is never over-generated (but for the last flux
+          neutrino of a block with an exposure quota) and the blocks which
+          fall short of their quota (eg. flux blocks exhausted) have the
+          rest of their quota moved to the blocks handed out after them.
+          Each worker reports the outcome (events, exposure, flux neutrinos)
+          of each of its blocks, and sends a heartbeat while generating one.
+          The blocks of workers which fail, disconnect or go silent (eg.
+          pre-empted nodes) are handed out again, with the same quota, to
+          other workers. The coordinator stops the workers once the target
+          is reached, or all blocks are done, and writes the production
+          summary: the exposure of each block and of the whole production.
+
+          Protocol (one line per TSocket string message):
+            worker -> coordinator : NEXT | ALIVE <ib> |
+                                    DONE <ib> <nev> <exposure> <nflux> |
+                                    FAILED <ib>
+            coordinator -> worker : BLOCK <ib> <nblocks> <nev> <exposure> |
+                                    WAIT | STOP
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _JOB_COORDINATOR_H_
+#define _JOB_COORDINATOR_H_
+
+#include <string>
+#include <vector>
+
+using std::string;
+using std::vector;
+
+class TMonitor;
+class TSocket;
+
+namespace genie {
+
+class JobCoordinator {
+
+public:
+  //! a production of nblocks blocks, up to nev events (if > 0) and up to
+  //! the input exposure (if > 0), in the input units
+  JobCoordinator(int nblocks, long int nev, double exposure, string units);
+ ~JobCoordinator();
+
+  //! seconds without a message from the worker of a block (default: 600)
+  //! after which the block is handed out again
+  void SetTimeout (int timeout) { fTimeout = timeout; }
+
+  //! serve the workers at the input port until the production is over
+  //! and write its summary (if a file name is given); returns false if
+  //! the target was not reached
+  bool Run (int port, string summary_file = "");
+
+  // the coordinated worker side (see utils::app_init::CoordinatedBlock())
+
+  //! heartbeat period of the workers (s)
+  static const int kHeartbeat = 30;
+
+private:
+
+  //! times the generation of a block may fail before it is given up
+  static const int kMaxFailures = 3;
+
+  enum EBlockState { kFree, kBusy, kDone };
+
+  //! a block of the production
+  struct Block {
+    EBlockState state;
+    long int    quota_nev;      ///< events to generate (0: no limit)
+    double      quota_exposure; ///< exposure to generate (0: no limit)
+    long int    nev;            ///< events generated (once done)
+    double      exposure;       ///< exposure generated (once done)
+    long int    nflux;          ///< flux neutrinos thrown (once done)
+    int         nfailed;        ///< times its generation failed
+    TSocket *   worker;         ///< worker generating it (if busy)
+    long int    last;           ///< last message of its worker (s)
+    string      host;           ///< host of the worker (which) generated it
+  };
+
+  void   Serve     (TSocket * sock);
+  string Assign    (TSocket * sock);
+  int    NextBlock (long int & nev, double & exposure) const;
+  void   Release   (TSocket * sock, const char * why);
+  void   Done      (TSocket * sock, int ib, long int nev, double exposure,
+                    long int nflux);
+  void   Failed    (TSocket * sock, int ib);
+  void   Expire    (long int now);
+  bool   Reached   (void) const;
+  bool   Finished  (void) const;
+  void   Summary   (string filename) const;
+
+  vector<Block>         fBlocks;
+  long int              fNev;        ///< target events (0: none)
+  double                fExposure;   ///< target exposure (0: none)
+  string                fUnits;      ///< exposure units
+  int                   fTimeout;    ///< worker silence timeout (s)
+  vector<TSocket *>     fWorkers;    ///< connected workers
+  TMonitor *            fMonitor;    ///< their sockets & the server one
+};
+
+}      // genie namespace
+
+#endif // _JOB_COORDINATOR_H_
@@ -0,0 +1,96 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <mutex>
+
+#include "Framework/Utils/EventGenCost.h"
+#include "Framework/Utils/JobTelemetry.h"
+#include "Framework/Utils/StartupProfile.h"
+#include "Framework/Utils/XSecSplineList.h"
+
+namespace {
+  std::mutex gJobTelemetryMutex; // guards the creation of the instance
+}
+
+namespace genie {
+
+//____________________________________________________________________________
+JobTelemetrySample::JobTelemetrySample() :
+time(0.), nevents(0), nflux(0), ngeomsteps(0), geomtime(0.),
+nqueued(0), queuedepth(0), rss(0.),
+nsplinelookups(0), nsplinemisses(0), nsplineloads(0)
+{
+
+}
+//____________________________________________________________________________
+JobTelemetry * JobTelemetry::fInstance = 0;
+//____________________________________________________________________________
+JobTelemetry::JobTelemetry() :
+fNEvents    (0),
+fNFlux      (0),
+fNGeomSteps (0),
+fGeomTime   (0),
+fNQueued    (0),
+fQueueDepth (0)
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+JobTelemetry::~JobTelemetry()
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+JobTelemetry * JobTelemetry::Instance()
+{
+  std::lock_guard<std::mutex> lock(gJobTelemetryMutex);
+  if(fInstance == 0) {
+    static JobTelemetry::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new JobTelemetry;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+void JobTelemetry::AddEvent(const EventGenCost & cost)
+{
+  fNEvents   .fetch_add(1,               std::memory_order_relaxed);
+  fNFlux     .fetch_add(cost.nflux,      std::memory_order_relaxed);
+  fNGeomSteps.fetch_add(cost.ngeomsteps, std::memory_order_relaxed);
+  fGeomTime  .fetch_add((Long64_t) (1.e+9 * cost.geomtime),
+                                         std::memory_order_relaxed);
+}
+//____________________________________________________________________________
+void JobTelemetry::SetOutputQueue(int nqueued, int depth)
+{
+  fNQueued   .store(nqueued, std::memory_order_relaxed);
+  fQueueDepth.store(depth,   std::memory_order_relaxed);
+}
+//____________________________________________________________________________
+JobTelemetrySample JobTelemetry::Sample(void) const
+{
+  JobTelemetrySample s;
+  s.time       = EventGenCost::WallTime();
+  s.nevents    = fNEvents   .load(std::memory_order_relaxed);
+  s.nflux      = fNFlux     .load(std::memory_order_relaxed);
+  s.ngeomsteps = fNGeomSteps.load(std::memory_order_relaxed);
+  s.geomtime   = 1.e-9 * fGeomTime.load(std::memory_order_relaxed);
+  s.nqueued    = fNQueued   .load(std::memory_order_relaxed);
+  s.queuedepth = fQueueDepth.load(std::memory_order_relaxed);
+  s.rss        = StartupProfile::ResidentMemory();
+
+  XSecSplineList::Instance()->LookupStats(
+      s.nsplinelookups, s.nsplinemisses, s.nsplineloads);
+
+  return s;
+}
+//____________________________________________________________________________
+
+} // genie namespace
@@ -0,0 +1,95 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::JobTelemetry
+
+\brief    Job-wide throughput and resource counters for the monitoring of
+          event generation jobs: events written out, flux neutrinos thrown
+          and time spent in the geometry driver for them, the output queue
+          occupancy, the spline look-up statistics and the resident memory.
+
+          The counters are relaxed atomics, added once per written event by
+          NtpWriter::AddEventRecord() (from the thread-local EventGenCost),
+          so they are cheap enough to be always on. They are sampled by
+          GMCJMonitor, which derives the rates and writes them out.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _JOB_TELEMETRY_H_
+#define _JOB_TELEMETRY_H_
+
+#include <atomic>
+
+#include <Rtypes.h>
+
+namespace genie {
+
+struct EventGenCost;
+
+//! A sample of the job counters
+struct JobTelemetrySample {
+  JobTelemetrySample();
+
+  double   time;           ///< wall time of the sample (s, steady clock)
+  Long64_t nevents;        ///< events written out
+  Long64_t nflux;          ///< flux neutrinos thrown for them
+  Long64_t ngeomsteps;     ///< geometry navigation steps
+  double   geomtime;       ///< time in the geometry driver (s)
+  int      nqueued;        ///< events queued for writing
+  int      queuedepth;     ///< output queue depth (0: synchronous writing)
+  double   rss;            ///< resident memory (MB)
+  Long64_t nsplinelookups; ///< hashed spline look-ups
+  Long64_t nsplinemisses;  ///< of which not found in the hashed index
+  Long64_t nsplineloads;   ///< splines created from mapped files on first access
+};
+
+class JobTelemetry {
+
+public:
+  static JobTelemetry * Instance (void);
+
+  //! Add the generation cost of a written event
+  void AddEvent       (const EventGenCost & cost);
+  //! Set the output queue occupancy
+  void SetOutputQueue (int nqueued, int depth);
+
+  //! Sample the counters (incl. the resident memory: only a few /proc reads)
+  JobTelemetrySample Sample (void) const;
+
+private:
+  JobTelemetry();
+  JobTelemetry(const JobTelemetry & telemetry);
+ ~JobTelemetry();
+
+  static JobTelemetry * fInstance;
+
+  std::atomic<Long64_t> fNEvents;    ///< events written out
+  std::atomic<Long64_t> fNFlux;      ///< flux neutrinos thrown
+  std::atomic<Long64_t> fNGeomSteps; ///< geometry navigation steps
+  std::atomic<Long64_t> fGeomTime;   ///< time in the geometry driver (ns)
+  std::atomic<int>      fNQueued;    ///< events queued for writing
+  std::atomic<int>      fQueueDepth; ///< output queue depth
+
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (JobTelemetry::fInstance !=0) {
+            delete JobTelemetry::fInstance;
+            JobTelemetry::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+
+#endif // _JOB_TELEMETRY_H_
@@ -0,0 +1,121 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <iomanip>
+#include <mutex>
+
+#include "Framework/Utils/KineGenStats.h"
+
+using std::setw;
+using std::setprecision;
+
+namespace {
+  std::mutex gKineGenStatsMutex; // guards KineGenStats::fCounts
+}
+
+namespace genie {
+
+//____________________________________________________________________________
+ostream & operator << (ostream & stream, const KineGenStats & stats)
+{
+  stats.Print(stream);
+  return stream;
+}
+//____________________________________________________________________________
+KineGenCounts::KineGenCounts() :
+nselections(0), naccepted(0), nthrows(0), novershoots(0),
+nxsec(0), nxsecmax(0), time(0.), timemax(0.)
+{
+
+}
+//____________________________________________________________________________
+void KineGenCounts::Add(const KineGenCounts & counts)
+{
+  nselections += counts.nselections;
+  naccepted   += counts.naccepted;
+  nthrows     += counts.nthrows;
+  novershoots += counts.novershoots;
+  nxsec       += counts.nxsec;
+  nxsecmax    += counts.nxsecmax;
+  time        += counts.time;
+  timemax     += counts.timemax;
+}
+//____________________________________________________________________________
+KineGenStats * KineGenStats::fInstance = 0;
+//____________________________________________________________________________
+KineGenStats::KineGenStats()
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+KineGenStats::~KineGenStats()
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+KineGenStats * KineGenStats::Instance()
+{
+  if(fInstance == 0) {
+    static KineGenStats::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new KineGenStats;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+void KineGenStats::Add(const string & channel, const KineGenCounts & counts)
+{
+  std::lock_guard<std::mutex> lock(gKineGenStatsMutex);
+  fCounts[channel].Add(counts);
+}
+//____________________________________________________________________________
+void KineGenStats::Reset(void)
+{
+  std::lock_guard<std::mutex> lock(gKineGenStatsMutex);
+  fCounts.clear();
+}
+//____________________________________________________________________________
+bool KineGenStats::IsEmpty(void) const
+{
+  std::lock_guard<std::mutex> lock(gKineGenStatsMutex);
+  return fCounts.empty();
+}
+//____________________________________________________________________________
+void KineGenStats::Print(ostream & stream) const
+{
+  std::lock_guard<std::mutex> lock(gKineGenStatsMutex);
+
+  stream << "\n [-] Kinematic selection statistics:";
+  stream << "\n  |  (per accepted event: throws tested against the max xsec,"
+         << " xsec calls, of which computing the max xsec, wall time)";
+
+  map<string, KineGenCounts>::const_iterator iter;
+  for(iter = fCounts.begin(); iter != fCounts.end(); ++iter) {
+    const KineGenCounts & c = iter->second;
+    double nacc = (c.naccepted > 0) ? (double) c.naccepted : 1.;
+    stream << "\n  |--o  " << iter->first;
+    stream << "\n  |       selections: " << c.nselections
+           << ", accepted: " << c.naccepted
+           << ", xsec > max xsec: " << c.novershoots
+           << " in " << c.nthrows << " throws";
+    stream << std::fixed << setprecision(2)
+           << "\n  |       throws/event: "    << setw(10) << c.nthrows/nacc
+           << ", xsec calls/event: "          << setw(10) << c.nxsec/nacc
+           << " (max xsec: "                  << c.nxsecmax/nacc << ")"
+           << std::scientific << setprecision(3)
+           << "\n  |       wall time/event: " << c.time/nacc << " s"
+           << " (max xsec: " << c.timemax/nacc << " s)";
+    stream.unsetf(std::ios::floatfield);
+  }
+  stream << "\n";
+}
+//____________________________________________________________________________
+
+} // genie namespace
@@ -0,0 +1,95 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::KineGenStats
+
+\brief    Kinematic selection statistics of the kinematic generators, per
+          generator and interaction channel: the number of selections and of
+          the throws tested against the max xsec that they took, the cross
+          section calls (incl. those made while computing the max xsec), the
+          throws where the cross section exceeded the max xsec and the wall
+          time. They show where a rejection envelope or a max xsec cache pays
+          off. The statistics are filled by KineGeneratorWithCache and are
+          reported by GMCJMonitor.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _KINE_GEN_STATS_H_
+#define _KINE_GEN_STATS_H_
+
+#include <map>
+#include <string>
+#include <ostream>
+
+#include <Rtypes.h>
+
+using std::map;
+using std::string;
+using std::ostream;
+
+namespace genie {
+
+class KineGenStats;
+
+ostream & operator << (ostream & stream, const KineGenStats & stats);
+
+//! The kinematic selection counters of one channel
+struct KineGenCounts {
+  KineGenCounts();
+  void Add (const KineGenCounts & counts);
+
+  Long64_t nselections; ///< kinematic selections
+  Long64_t naccepted;   ///< selections which ended with accepted kinematics
+  Long64_t nthrows;     ///< kinematic points tested against the max xsec
+  Long64_t novershoots; ///< tested points where xsec > max xsec
+  Long64_t nxsec;       ///< cross section calls
+  Long64_t nxsecmax;    ///< cross section calls made computing the max xsec
+  double   time;        ///< wall time (s)
+  double   timemax;     ///< wall time spent computing the max xsec (s)
+};
+
+class KineGenStats {
+
+public:
+  static KineGenStats * Instance (void);
+
+  //! Add the counters of one (or more) kinematic selections of a channel
+  void Add     (const string & channel, const KineGenCounts & counts);
+  void Reset   (void);
+  bool IsEmpty (void) const;
+
+  void Print (ostream & stream) const;
+  friend ostream & operator << (ostream & stream, const KineGenStats & stats);
+
+private:
+  KineGenStats();
+  KineGenStats(const KineGenStats & stats);
+ ~KineGenStats();
+
+  static KineGenStats * fInstance;
+
+  map<string, KineGenCounts> fCounts; ///< channel -> counters
+
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (KineGenStats::fInstance !=0) {
+            delete KineGenStats::fInstance;
+            KineGenStats::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+
+#endif // _KINE_GEN_STATS_H_
@@ -14,6 +14,7 @@
 */
 //____________________________________________________________________________
 
+#include <algorithm>
 #include <cstdlib>
 #include <limits>
 #include <TMath.h>
@@ -21,9 +22,11 @@
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Interaction/ScratchInteraction.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/Utils/KineUtils.h"
+#include "Framework/Utils/KineUtilsBatch.h"
 #include "Framework/Numerical/MathUtils.h"
 
 using namespace genie;
@@ -66,10 +69,10 @@ double genie::utils::kinematics::PhaseSpaceVolume(
     if(W.max<0) return 0;
     const int kNW = 100;
     double dW = (W.max-W.min)/(kNW-1);
-    Interaction interaction(*in);
+    ScratchInteraction interaction(in);
     for(int iw=0; iw<kNW; iw++) {
-      interaction.KinePtr()->SetW(W.min + iw*dW);
-      Range1D_t Q2 = interaction.PhaseSpace().Q2Lim_W();
+      interaction->KinePtr()->SetW(W.min + iw*dW);
+      Range1D_t Q2 = interaction->PhaseSpace().Q2Lim_W();
       double dQ2 = (Q2.max-Q2.min);
       vol += (dW*dQ2);
     }
@@ -93,21 +96,21 @@ double genie::utils::kinematics::PhaseSpaceVolume(
     const double kdy = (controls::kMaxY - kminy) / (kNy-1);
     const double kdV = kdx*kdy;
 
-    double cW=-1, cQ2 = -1;
+    // (x,y) -> (W,Q2) for a row of y values at a time
+    double vx[kNy], vy[kNy], cW[kNy], cQ2[kNy];
+    for(int iy=0; iy<kNy; iy++) vy[iy] = kminy+iy*kdy;
 
-    Interaction interaction(*in);
+    ScratchInteraction interaction(in);
 
     for(int ix=0; ix<kNx; ix++) {
-      double x = kminx+ix*kdx;
+      std::fill(vx, vx+kNy, kminx+ix*kdx);
+      batch::XYtoWQ2(kNy, Ev, M, vx, vy, cW, cQ2);
       for(int iy=0; iy<kNy; iy++) {
-         double y = kminy+iy*kdy;
+         if(!math::IsWithinLimits(cW[iy], W)) continue;
 
-         XYtoWQ2(Ev, M, cW, cQ2, x, y);
-         if(!math::IsWithinLimits(cW, W)) continue;
-
-         interaction.KinePtr()->SetW(cW);
-         Range1D_t Q2 = interaction.PhaseSpace().Q2Lim_W();
-         if(!math::IsWithinLimits(cQ2, Q2)) continue;
+         interaction->KinePtr()->SetW(cW[iy]);
+         Range1D_t Q2 = interaction->PhaseSpace().Q2Lim_W();
+         if(!math::IsWithinLimits(cQ2[iy], Q2)) continue;
 
          vol += kdV;
       }
@@ -199,8 +202,7 @@ double genie::utils::kinematics::Jacobian(
     const InitialState & init_state = i->InitState();
     double Ev = init_state.ProbeE(kRfHitNucRest);
     double M  = init_state.Tgt().HitNucP4Ptr()->M();
-    double y  = kine.y();
-    J = 2*y*Ev*M;
+    J = batch::JacobianQ2YtoXY(Ev, M, kine.y());
   }
 
   //
@@ -229,8 +231,7 @@ double genie::utils::kinematics::Jacobian(
     const InitialState & init_state = i->InitState();
     double Ev = init_state.ProbeE(kRfHitNucRest);
     double M  = init_state.Tgt().HitNucP4Ptr()->M();
-    double y  = kine.y();
-    J = TMath::Power(2*M*Ev,2) * y;
+    J = batch::JacobianW2Q2toXY(Ev, M, kine.y());
   }
 
   //
@@ -242,9 +243,7 @@ double genie::utils::kinematics::Jacobian(
     const InitialState & init_state = i->InitState();
     double Ev = init_state.ProbeE(kRfHitNucRest);
     double M  = init_state.Tgt().HitNucP4Ptr()->M();
-    double y  = kine.y();
-    double W  = kine.W();
-    J = 2*TMath::Power(M*Ev,2) * y/W;
+    J = batch::JacobianWQ2toXY(Ev, M, kine.W(), kine.y());
   }
 
   // Transformation: {Omegalep,Omegapi}|E -> {Omegalep,Thetapi}|E
@@ -288,21 +287,9 @@ Range1D_t genie::utils::kinematics::InelWLim(double Ev, double M, double ml)
 {
 // Computes W limits for inelastic v interactions
 //
-  double M2 = TMath::Power(M,2);
-  double s  = M2 + 2*M*Ev;
-  assert (s>0);
+  assert (M*M + 2*M*Ev > 0);
 
-  Range1D_t W;
-  W.min  = kNeutronMass + kPhotontest;
-  W.max  = TMath::Sqrt(s) - ml;
-  if(W.max<=W.min) {
-    W.min = -1;
-    W.max = -1;
-    return W;
-  }
-  W.min  += controls::kASmallNum;
-  W.max  -= controls::kASmallNum;
-  return W;
+  return batch::InelWLim(Ev, M, ml);
 }
 //____________________________________________________________________________
 Range1D_t genie::utils::kinematics::InelQ2Lim_W(
@@ -310,37 +297,13 @@ Range1D_t genie::utils::kinematics::InelQ2Lim_W(
 {
 // Computes Q2 limits (>0) @ the input W for inelastic v interactions
 
-  Range1D_t Q2;
-  Q2.min = -1;
-  Q2.max = -1;
-
-  double M2  = TMath::Power(M,  2.);
-  double ml2 = TMath::Power(ml, 2.);
-  double W2  = TMath::Power(W,  2.);
-  double s   = M2 + 2*M*Ev;
+  double s = M*M + 2*M*Ev;
 
   SLOG("KineLimits", pDEBUG) << "s  = " << s;
   SLOG("KineLimits", pDEBUG) << "Ev = " << Ev;
   assert (s>0);
 
-  double auxC = 0.5*(s-M2)/s;
-  double aux1 = s + ml2 - W2;
-  double aux2 = aux1*aux1 - 4*s*ml2;
-
-  (aux2 < 0) ? ( aux2 = 0 ) : ( aux2 = TMath::Sqrt(aux2) );
-
-  Q2.max = -ml2 + auxC * (aux1 + aux2); // => 0
-  Q2.min = -ml2 + auxC * (aux1 - aux2); // => 0
-
-  // guard against overflows
-  Q2.max = TMath::Max(0., Q2.max);
-  Q2.min = TMath::Max(0., Q2.min);
-
-  // limit the minimum Q2
-  if(Q2.min < Q2min_cut) {Q2.min = Q2min_cut;     }
-  if(Q2.max < Q2.min   ) {Q2.min = -1; Q2.max = -1;}
-
-  return Q2;
+  return batch::InelQ2Lim_W(Ev, M, ml, W, Q2min_cut);
 }
 //____________________________________________________________________________
 Range1D_t genie::utils::kinematics::Inelq2Lim_W(
@@ -682,31 +645,14 @@ Range1D_t genie::utils::kinematics::CohQ2Lim(double Mn, double m_produced, doubl
   Q2.min = 0.0;
   Q2.max = std::numeric_limits<double>::max();  // Value must be overriden in user options
 
-  double Mn2 = Mn * Mn;
-  double mlep2 = mlep * mlep;
-  double s = Mn2 + 2.0 * Mn * Ev;
-  double W2min = CohW2Min(Mn, m_produced);
-
   // Looks like Q2min = A * B - C, where A, B, and C are complicated
-  double a = 1.0;
-  double b = mlep2 / s;
-  double c = W2min / s;
-  double lambda = a * a + b * b + c * c - 2.0 * a * b - 2.0 * a * c - 2.0 * b * c;
-  if (lambda > 0) {
-    double A = (s - Mn * Mn) / 2.0;
-    double B = 1 - TMath::Sqrt(lambda);
-    double C = 0.5 * (W2min + mlep2 - Mn2 * (W2min - mlep2) / s );
-    if (A * B - C < 0) {
-      SLOG("KineLimits", pERROR)
-        << "Q2 kinematic limits calculation failed for CohQ2Lim. "
-        << "Assuming Q2min = 0.0";
-    }
-    Q2.min = TMath::Max(0., A * B - C);
-  } else {
+  double Q2min = batch::CohQ2Min(Mn, m_produced, mlep, Ev);
+  if (Q2min < 0) {
     SLOG("KineLimits", pERROR)
       << "Q2 kinematic limits calculation failed for CohQ2Lim. "
       << "Assuming Q2min = 0.0";
   }
+  Q2.min = TMath::Max(0., Q2min);
 
   return Q2;
 }
@@ -1066,16 +1012,7 @@ void genie::utils::kinematics::WQ2toXY(
 // Ev is the neutrino energy at the struck nucleon rest frame
 // M is the nucleon mass - it does not need to be on the mass shell
 
-  double M2  = TMath::Power(M,2);
-  double W2  = TMath::Power(W,2);
-
-  x = Q2 / (W2-M2+Q2);
-  y = (W2-M2+Q2) / (2*M*Ev);
-
-  x = TMath::Min(1.,x);
-  y = TMath::Min(1.,y);
-  x = TMath::Max(0.,x);
-  y = TMath::Max(0.,y);
+  batch::WQ2toXY(Ev, M, W, Q2, x, y);
 
   LOG("KineLimits", pDEBUG)
         << "(W=" << W << ",Q2=" << Q2 << ") => (x="<< x << ", y=" << y<< ")";
@@ -1089,11 +1026,7 @@ void genie::utils::kinematics::XYtoWQ2(
 // Ev is the neutrino energy at the struck nucleon rest frame
 // M is the nucleon mass - it does not need to be on the mass shell
 
-  double M2  = TMath::Power(M,2);
-  double W2  = M2 + 2*Ev*M*y*(1-x);
-
-  W  = TMath::Sqrt(TMath::Max(0., W2));
-  Q2 = 2*x*y*M*Ev;
+  batch::XYtoWQ2(Ev, M, W, Q2, x, y);
 
   LOG("KineLimits", pDEBUG)
       << "(x=" << x << ",y=" << y << " => (W=" << W << ",Q2=" << Q2 << ")";
@@ -1106,9 +1039,7 @@ double genie::utils::kinematics::XYtoW(
 // Ev is the neutrino energy at the struck nucleon rest frame
 // M is the nucleon mass - it does not need to be on the mass shell
 
-  double M2  = TMath::Power(M,2);
-  double W2  = M2 + 2*Ev*M*y*(1-x);
-  double W  = TMath::Sqrt(TMath::Max(0., W2));
+  double W = batch::XYtoW(Ev, M, x, y);
 
   LOG("KineLimits", pDEBUG) << "(x=" << x << ",y=" << y << ") => W=" << W;
 
@@ -1122,7 +1053,7 @@ double genie::utils::kinematics::XYtoQ2(
 // Ev is the neutrino energy at the struck nucleon rest frame
 // M is the nucleon mass - it does not need to be on the mass shell
 
-  double Q2 = 2*x*y*M*Ev;
+  double Q2 = batch::XYtoQ2(Ev, M, x, y);
 
   LOG("KineLimits", pDEBUG) << "(x=" << x << ",y=" << y << ") => Q2=" << Q2;
 
@@ -1137,7 +1068,7 @@ double genie::utils::kinematics::Q2YtoX(
 // M is the nucleon mass - it does not need to be on the mass shell
   assert(Ev > 0. && M  > 0. && Q2 > 0. && y  > 0.);
 
-  double x = Q2 / (2. * y * M * Ev);
+  double x = batch::Q2YtoX(Ev, M, Q2, y);
 
   LOG("KineLimits", pDEBUG) << "(Ev=" << Ev << ",Q2=" << Q2
     << ",y=" << y << ",M=" << M << ") => x=" << x;
@@ -1182,19 +1113,12 @@ void genie::utils::kinematics::ApplyCutsToKineLimits(
                          Range1D_t & range, double min_cut, double max_cut)
 {
   // if the min,max are within the existing limits, the cut can be applied
-  // by narrowing down the xisting limits
-  if ( utils::math::IsWithinLimits(min_cut, range ) ) range.min = min_cut;
-  if ( utils::math::IsWithinLimits(max_cut, range ) ) range.max = max_cut;
-
+  // by narrowing down the xisting limits.
   // if the min-cut is above the existing max-limit or
   // if the max-cut is below the existing min-limit then
   // the range should be invalidated
 
-  if (min_cut > range.max || max_cut < range.min) {
-
-    range.min = 0;
-    range.max = 0;
-  }
+  batch::ApplyCutsToKineLimits(range.min, range.max, min_cut, max_cut);
 }
 //___________________________________________________________________________
 void genie::utils::kinematics::UpdateWQ2FromXY(const Interaction * in)
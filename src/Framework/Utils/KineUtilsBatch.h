@@ -0,0 +1,217 @@
+//____________________________________________________________________________
+/*!
+
+\namespace  genie::utils::kinematics::batch
+
+\brief      Inline and batched versions of the most used kinematical limits,
+            transforms and Jacobians of genie::utils::kinematics.
+
+            The scalar functions are inline, free of messages and asserts,
+            and give the same results as their KineUtils.h namesakes (which
+            now use them). The array versions apply them to n points at the
+            same energy (or n energies), with no function calls in the loop,
+            so that compilers can vectorise them. They are meant for code
+            transforming whole blocks of trial kinematics at once (phase
+            space scans, integrand evaluations, rejection loops).
+
+            Ev: probe energy at the hit nucleon rest frame
+            M : hit nucleon mass (it does not need to be on the mass shell)
+            ml: final state primary lepton mass
+
+\author     Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+            University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created    October 14, 2026
+
+\cpright    Copyright (c) 2003-2020, The GENIE Collaboration
+            For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _KINE_UTILS_BATCH_H_
+#define _KINE_UTILS_BATCH_H_
+
+#include <cmath>
+
+#include "Framework/Conventions/Constants.h"
+#include "Framework/Conventions/Controls.h"
+#include "Framework/Utils/Range1.h"
+
+namespace genie {
+namespace utils {
+namespace kinematics {
+namespace batch {
+
+  //-- kinematical variable transforms
+
+  inline double XYtoW (double Ev, double M, double x, double y)
+  {
+    double W2 = M*M + 2*Ev*M*y*(1-x);
+    return std::sqrt( (W2 > 0.) ? W2 : 0. );
+  }
+  inline double XYtoQ2 (double Ev, double M, double x, double y)
+  {
+    return 2*x*y*M*Ev;
+  }
+  inline void XYtoWQ2 (double Ev, double M,
+                       double & W, double & Q2, double x, double y)
+  {
+    W  = XYtoW  (Ev, M, x, y);
+    Q2 = XYtoQ2 (Ev, M, x, y);
+  }
+  inline void WQ2toXY (double Ev, double M,
+                       double W, double Q2, double & x, double & y)
+  {
+    double nu2M = W*W - M*M + Q2; // 2*M*nu
+    x = Q2 / nu2M;
+    y = nu2M / (2*M*Ev);
+    x = (x < 1.) ? x : 1.;   x = (x > 0.) ? x : 0.;
+    y = (y < 1.) ? y : 1.;   y = (y > 0.) ? y : 0.;
+  }
+  inline double Q2YtoX (double Ev, double M, double Q2, double y)
+  {
+    return Q2 / (2. * y * M * Ev);
+  }
+
+  //-- Jacobians (see utils::kinematics::Jacobian() for the convention)
+
+  //! {W,Q2}|E -> {x,y}|E
+  inline double JacobianWQ2toXY  (double Ev, double M, double W, double y)
+  {
+    return 2*(M*Ev)*(M*Ev) * y/W;
+  }
+  //! {W2,Q2}|E -> {x,y}|E
+  inline double JacobianW2Q2toXY (double Ev, double M, double y)
+  {
+    return (2*M*Ev)*(2*M*Ev) * y;
+  }
+  //! {Q2,y}|E -> {x,y}|E
+  inline double JacobianQ2YtoXY  (double Ev, double M, double y)
+  {
+    return 2*y*Ev*M;
+  }
+
+  //-- kinematical limits
+
+  inline Range1D_t InelWLim (double Ev, double M, double ml)
+  {
+    double s = M*M + 2*M*Ev;
+    Range1D_t W;
+    W.min = constants::kNeutronMass + constants::kPhotontest;
+    W.max = std::sqrt(s) - ml;
+    if(W.max <= W.min) {
+      W.min = -1;
+      W.max = -1;
+      return W;
+    }
+    W.min += controls::kASmallNum;
+    W.max -= controls::kASmallNum;
+    return W;
+  }
+  inline void InelQ2Lim_W (double Ev, double M, double ml, double W,
+             double & Q2min, double & Q2max,
+             double Q2min_cut = controls::kMinQ2Limit)
+  {
+    double M2   = M*M;
+    double ml2  = ml*ml;
+    double s    = M2 + 2*M*Ev;
+    double auxC = 0.5*(s-M2)/s;
+    double aux1 = s + ml2 - W*W;
+    double aux2 = aux1*aux1 - 4*s*ml2;
+    aux2 = (aux2 < 0) ? 0. : std::sqrt(aux2);
+
+    Q2max = -ml2 + auxC * (aux1 + aux2);
+    Q2min = -ml2 + auxC * (aux1 - aux2);
+    Q2max = (Q2max > 0.) ? Q2max : 0.;
+    Q2min = (Q2min > 0.) ? Q2min : 0.;
+
+    if(Q2min < Q2min_cut) { Q2min = Q2min_cut;      }
+    if(Q2max < Q2min    ) { Q2min = -1; Q2max = -1; }
+  }
+  inline Range1D_t InelQ2Lim_W (double Ev, double M, double ml, double W,
+             double Q2min_cut = controls::kMinQ2Limit)
+  {
+    Range1D_t Q2;
+    InelQ2Lim_W(Ev, M, ml, W, Q2.min, Q2.max, Q2min_cut);
+    return Q2;
+  }
+  //! the Q2 min for coherent production of a particle of mass m_produced
+  //! off a nucleus of mass Mn (the max Q2 has no kinematical limit).
+  //! Returns a negative value where the calculation fails.
+  inline double CohQ2Min (double Mn, double m_produced, double mlep, double Ev)
+  {
+    double Mn2    = Mn * Mn;
+    double mlep2  = mlep * mlep;
+    double s      = Mn2 + 2.0 * Mn * Ev;
+    double W2min  = (Mn + m_produced) * (Mn + m_produced);
+    double b      = mlep2 / s;
+    double c      = W2min / s;
+    double lambda = 1. + b*b + c*c - 2.*b - 2.*c - 2.*b*c;
+    if(lambda <= 0) return -1;
+    double A = (s - Mn2) / 2.0;
+    double B = 1 - std::sqrt(lambda);
+    double C = 0.5 * (W2min + mlep2 - Mn2 * (W2min - mlep2) / s );
+    return A * B - C;
+  }
+
+  //-- cuts on kinematical limits
+
+  inline void ApplyCutsToKineLimits (double & min, double & max,
+                                     double min_cut, double max_cut)
+  {
+    if(min_cut >= min && min_cut <= max) min = min_cut;
+    if(max_cut >= min && max_cut <= max) max = max_cut;
+    if(min_cut > max || max_cut < min) { min = 0; max = 0; }
+  }
+
+  //-- array versions: n points at the same Ev and M
+
+  inline void XYtoWQ2 (int n, double Ev, double M,
+         const double * x, const double * y, double * W, double * Q2)
+  {
+    for(int i = 0; i < n; i++) XYtoWQ2(Ev, M, W[i], Q2[i], x[i], y[i]);
+  }
+  inline void WQ2toXY (int n, double Ev, double M,
+         const double * W, const double * Q2, double * x, double * y)
+  {
+    for(int i = 0; i < n; i++) WQ2toXY(Ev, M, W[i], Q2[i], x[i], y[i]);
+  }
+  inline void JacobianWQ2toXY (int n, double Ev, double M,
+         const double * W, const double * y, double * J)
+  {
+    for(int i = 0; i < n; i++) J[i] = JacobianWQ2toXY(Ev, M, W[i], y[i]);
+  }
+  inline void InelQ2Lim_W (int n, double Ev, double M, double ml,
+         const double * W, double * Q2min, double * Q2max,
+         double Q2min_cut = controls::kMinQ2Limit)
+  {
+    for(int i = 0; i < n; i++) {
+      InelQ2Lim_W(Ev, M, ml, W[i], Q2min[i], Q2max[i], Q2min_cut);
+    }
+  }
+
+  //-- array versions: n probe energies
+
+  inline void InelWLim (int n, const double * Ev, double M, double ml,
+         double * Wmin, double * Wmax)
+  {
+    for(int i = 0; i < n; i++) {
+      Range1D_t W = InelWLim(Ev[i], M, ml);
+      Wmin[i] = W.min;
+      Wmax[i] = W.max;
+    }
+  }
+  inline void CohQ2Min (int n, double Mn, double m_produced, double mlep,
+         const double * Ev, double * Q2min)
+  {
+    for(int i = 0; i < n; i++) {
+      Q2min[i] = CohQ2Min(Mn, m_produced, mlep, Ev[i]);
+    }
+  }
+
+} // batch namespace
+} // kinematics namespace
+} // utils namespace
+} // genie namespace
+
+#endif // _KINE_UTILS_BATCH_H_
@@ -28,6 +28,20 @@
 #pragma link C++ class genie::CacheBranchFx;
 #pragma link C++ class genie::CmdLnArgParser;
 #pragma link C++ class genie::XSecSplineList;
+#pragma link C++ class genie::XSecSplineUsage;
+#pragma link C++ class genie::MaxXSecTable;
+#pragma link C++ class genie::KineGenStats;
+#pragma link C++ class genie::EventGenCost;
+#pragma link C++ class genie::ModuleTimingStats;
+#pragma link C++ class genie::ModuleTiming;
+#pragma link C++ class genie::ChannelCostStats;
+#pragma link C++ class genie::ChannelCost;
+#pragma link C++ class genie::JobTelemetry;
+#pragma link C++ class genie::JobTelemetrySample;
+#pragma link C++ class genie::JobCoordinator;
+#pragma link C++ class genie::StartupProfile;
+#pragma link C++ class genie::StartupPhaseCost;
+#pragma link C++ class genie::Pythia6Gate;
 #pragma link C++ class genie::Range1D_t;
 #pragma link C++ class genie::Range1F_t;
 #pragma link C++ class genie::Range1I_t;
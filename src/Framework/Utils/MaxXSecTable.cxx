@@ -0,0 +1,297 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <cstring>
+#include <fstream>
+#include <algorithm>
+#include <vector>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <TMath.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/MaxXSecTable.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/TuneId.h"
+#include "Framework/Utils/StringUtils.h"
+
+using std::vector;
+
+using namespace genie;
+
+//____________________________________________________________________________
+// Max-xsec table file layout (native byte order, offsets in bytes from the
+// start of the file):
+//   header
+//   index : one entry per cache branch, sorted by key
+//   data  : for each branch, (E, max xsec) pairs of doubles sorted by E
+namespace {
+
+  const char     kMxsMagic[8] = { 'G','E','N','I','E','M','X','S' };
+  const uint32_t kMxsByteOrder = 0x01020304;
+  const uint32_t kMxsVersion   = 1;
+
+  struct MxsHeader {
+    char     magic[8];
+    uint32_t byte_order;
+    uint32_t version;
+    uint32_t nbranches;
+    uint32_t reserved;
+    uint64_t config_tag;
+    uint64_t index_offset;
+    uint64_t data_offset;
+    uint64_t file_size;
+  };
+
+  struct MxsIndexEntry {
+    uint64_t key;
+    uint64_t data_offset;
+    uint32_t npoints;
+    uint32_t reserved;
+  };
+
+  bool KeyLess(const MxsIndexEntry & entry, uint64_t key)
+  {
+    return entry.key < key;
+  }
+
+  // max interpolation gap, relative to the energy
+  const double kMxsMaxRelGap = 0.2;
+}
+
+//____________________________________________________________________________
+MaxXSecTable * MaxXSecTable::fInstance = 0;
+//____________________________________________________________________________
+MaxXSecTable::MaxXSecTable()
+{
+  fInstance  = 0;
+  fBase      = 0;
+  fSize      = 0;
+  fIndex     = 0;
+  fNBranches = 0;
+  fRecording = false;
+}
+//____________________________________________________________________________
+MaxXSecTable::~MaxXSecTable()
+{
+  this->Unmap();
+  fInstance = 0;
+}
+//____________________________________________________________________________
+MaxXSecTable * MaxXSecTable::Instance()
+{
+  if(fInstance == 0) {
+    static MaxXSecTable::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new MaxXSecTable;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+ULong64_t MaxXSecTable::ConfigTag(void)
+{
+  RunOpt * runopt = RunOpt::Instance();
+  string tune = (runopt->Tune()) ? runopt->Tune()->Name() : "";
+  return utils::str::Hash(tune + "/" + runopt->EventGeneratorList());
+}
+//____________________________________________________________________________
+void MaxXSecTable::Unmap(void)
+{
+  if(fBase) {
+    munmap((void *) fBase, fSize);
+  }
+  fBase      = 0;
+  fSize      = 0;
+  fIndex     = 0;
+  fNBranches = 0;
+}
+//____________________________________________________________________________
+bool MaxXSecTable::Load(const string & filename)
+{
+  this->Unmap();
+
+  LOG("MaxXSecTable", pNOTICE) << "Loading max xsec table: " << filename;
+
+  int fd = open(filename.c_str(), O_RDONLY);
+  if(fd < 0) {
+    LOG("MaxXSecTable", pERROR) << "Could not open file: " << filename;
+    return false;
+  }
+  struct stat st;
+  if(fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(MxsHeader)) {
+    LOG("MaxXSecTable", pERROR) << "Empty or truncated file: " << filename;
+    close(fd);
+    return false;
+  }
+  size_t size = st.st_size;
+  void * addr = mmap(0, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if(addr == MAP_FAILED) {
+    LOG("MaxXSecTable", pERROR) << "Could not map file: " << filename;
+    return false;
+  }
+  const char * base = (const char *) addr;
+
+  MxsHeader header;
+  memcpy(&header, base, sizeof(MxsHeader));
+  bool ok =
+     memcmp(header.magic, kMxsMagic, sizeof(kMxsMagic)) == 0 &&
+     header.byte_order   == kMxsByteOrder &&
+     header.version      == kMxsVersion   &&
+     header.file_size    == size          &&
+     header.index_offset == sizeof(MxsHeader) &&
+     header.data_offset  == header.index_offset +
+                            header.nbranches * (uint64_t) sizeof(MxsIndexEntry) &&
+     header.data_offset  <= size;
+  if(!ok) {
+    LOG("MaxXSecTable", pERROR)
+      << "Invalid or incompatible file (version: " << header.version
+      << "): " << filename;
+    munmap(addr, size);
+    return false;
+  }
+
+  const MxsIndexEntry * index =
+        (const MxsIndexEntry *) (base + header.index_offset);
+  for(uint32_t i = 0; i < header.nbranches && ok; i++) {
+    ok = index[i].data_offset % 8 == 0 &&
+         index[i].data_offset >= header.data_offset &&
+         index[i].data_offset +
+            2 * sizeof(double) * (uint64_t) index[i].npoints <= size &&
+         index[i].npoints > 0 &&
+         (i == 0 || index[i-1].key < index[i].key);
+  }
+  if(!ok) {
+    LOG("MaxXSecTable", pERROR) << "Corrupted index in file: " << filename;
+    munmap(addr, size);
+    return false;
+  }
+
+  if(header.config_tag != MaxXSecTable::ConfigTag()) {
+    LOG("MaxXSecTable", pERROR)
+      << "The max xsec table " << filename << " was built for another tune "
+      << "or event generator list - Not using it";
+    munmap(addr, size);
+    return false;
+  }
+
+  fBase      = base;
+  fSize      = size;
+  fIndex     = index;
+  fNBranches = header.nbranches;
+
+  LOG("MaxXSecTable", pNOTICE)
+    << "Mapped " << fNBranches << " max xsec branches from: " << filename;
+  return true;
+}
+//____________________________________________________________________________
+double MaxXSecTable::MaxXSec(ULong64_t key, double E) const
+{
+  if(!fBase) return -1.;
+
+  const MxsIndexEntry * first = (const MxsIndexEntry *) fIndex;
+  const MxsIndexEntry * last  = first + fNBranches;
+  const MxsIndexEntry * entry =
+        std::lower_bound(first, last, (uint64_t) key, KeyLess);
+  if(entry == last || entry->key != key) return -1.;
+
+  const double * data = (const double *) (fBase + entry->data_offset);
+  unsigned int n = entry->npoints;
+
+  // first point with energy >= E
+  unsigned int lo = 0, hi = n;
+  while(lo < hi) {
+    unsigned int mid = (lo + hi) / 2;
+    if(data[2*mid] < E) lo = mid + 1;
+    else                hi = mid;
+  }
+  if(lo == n) return -1.;
+  if(data[2*lo] == E) return data[2*lo+1];
+  if(lo == 0) return -1.;
+
+  // use the larger of the two bracketing maxima, if they are close enough
+  double E0 = data[2*(lo-1)];
+  double E1 = data[2*lo];
+  if(E1 - E0 > kMxsMaxRelGap * E) return -1.;
+
+  return TMath::Max(data[2*(lo-1)+1], data[2*lo+1]);
+}
+//____________________________________________________________________________
+void MaxXSecTable::Record(ULong64_t key, double E, double xsec)
+{
+  if(!fRecording || xsec <= 0.) return;
+
+  map<double, double> & points = fRecorded[key];
+  map<double, double>::iterator iter = points.find(E);
+  if(iter == points.end()) points[E] = xsec;
+  else iter->second = TMath::Max(iter->second, xsec);
+}
+//____________________________________________________________________________
+bool MaxXSecTable::Save(const string & filename) const
+{
+  uint32_t nbranches = fRecorded.size();
+
+  MxsHeader header;
+  memset(&header, 0, sizeof(MxsHeader));
+  memcpy(header.magic, kMxsMagic, sizeof(kMxsMagic));
+  header.byte_order   = kMxsByteOrder;
+  header.version      = kMxsVersion;
+  header.nbranches    = nbranches;
+  header.config_tag   = MaxXSecTable::ConfigTag();
+  header.index_offset = sizeof(MxsHeader);
+  header.data_offset  = header.index_offset +
+                        nbranches * (uint64_t) sizeof(MxsIndexEntry);
+
+  // std::map iterates in key order: the index comes out sorted
+  vector<MxsIndexEntry> index;
+  uint64_t offset = header.data_offset;
+  map<ULong64_t, map<double, double> >::const_iterator b_iter;
+  for(b_iter = fRecorded.begin(); b_iter != fRecorded.end(); ++b_iter) {
+    MxsIndexEntry entry;
+    memset(&entry, 0, sizeof(MxsIndexEntry));
+    entry.key         = b_iter->first;
+    entry.data_offset = offset;
+    entry.npoints     = b_iter->second.size();
+    index.push_back(entry);
+    offset += 2 * sizeof(double) * (uint64_t) entry.npoints;
+  }
+  header.file_size = offset;
+
+  std::ofstream out(filename.c_str(), std::ios::out | std::ios::binary);
+  if(!out.is_open()) {
+    LOG("MaxXSecTable", pERROR) << "Could not open file: " << filename;
+    return false;
+  }
+  out.write((const char *) &header, sizeof(MxsHeader));
+  if(nbranches > 0) {
+    out.write((const char *) &index[0], nbranches * sizeof(MxsIndexEntry));
+  }
+  for(b_iter = fRecorded.begin(); b_iter != fRecorded.end(); ++b_iter) {
+    map<double, double>::const_iterator p_iter = b_iter->second.begin();
+    for( ; p_iter != b_iter->second.end(); ++p_iter) {
+      double point[2] = { p_iter->first, p_iter->second };
+      out.write((const char *) point, sizeof(point));
+    }
+  }
+  out.close();
+  if(out.fail()) {
+    LOG("MaxXSecTable", pERROR) << "Error while writing file: " << filename;
+    return false;
+  }
+
+  LOG("MaxXSecTable", pNOTICE)
+    << "Saved " << nbranches << " max xsec branches in: " << filename;
+  return true;
+}
+//____________________________________________________________________________
@@ -0,0 +1,103 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::MaxXSecTable
+
+\brief    A read-only table of the maximum differential cross sections used
+          by the kinematic generators (KineGeneratorWithCache) as rejection
+          envelopes, shared across jobs.
+
+          The table is built once, by gmkmxs, from the max-xsec values that
+          its kinematic generators compute while recording is on, and saved
+          in a binary file. Jobs memory-map the file at start-up: all jobs
+          running on the same node share its pages and nothing is ever
+          written back, so that any number of concurrent jobs can use it.
+
+          The file is tagged with a hash of the tune and of the event
+          generator list it was built with and is only used by jobs with the
+          same tune and generator list. Each entry is keyed by a hash of the
+          full configuration of the kinematic generator and of its cross
+          section model (Algorithm::ConfigHash()) and of the interaction, so
+          entries of a model whose configuration changed are not found.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _MAX_XSEC_TABLE_H_
+#define _MAX_XSEC_TABLE_H_
+
+#include <map>
+#include <string>
+#include <cstddef>
+
+#include <Rtypes.h>
+
+using std::map;
+using std::string;
+
+namespace genie {
+
+class MaxXSecTable {
+
+public:
+  static MaxXSecTable * Instance (void);
+
+  //! Memory-map a table file written by Save(). The file is rejected if it
+  //! is corrupted or was built with another tune or event generator list.
+  bool   Load     (const string & filename);
+  bool   IsLoaded (void) const { return fBase != 0; }
+
+  //! Max xsec for the input key at energy E, from the points bracketing E.
+  //! Returns a negative value if the key is not in the table or E is not
+  //! well covered by the table.
+  double MaxXSec  (ULong64_t key, double E) const;
+
+  //! Building the table: record the max xsec values as they are computed
+  void   SetRecording (bool on) { fRecording = on; }
+  bool   IsRecording  (void) const { return fRecording; }
+  void   Record       (ULong64_t key, double E, double xsec);
+  bool   Save         (const string & filename) const;
+  int    NRecorded    (void) const { return fRecorded.size(); }
+
+  //! Hash of the current tune and event generator list the table is tagged with
+  static ULong64_t ConfigTag (void);
+
+private:
+  MaxXSecTable();
+  MaxXSecTable(const MaxXSecTable & table);
+ ~MaxXSecTable();
+
+  void Unmap (void);
+
+  static MaxXSecTable * fInstance;
+
+  const char *   fBase;      ///< start of the mapped file (0 if no file loaded)
+  size_t         fSize;      ///< size of the mapped file
+  const void *   fIndex;     ///< branch index, sorted by key
+  unsigned int   fNBranches; ///< number of branches in the mapped file
+
+  bool fRecording;                                  ///< record computed max xsecs?
+  map<ULong64_t, map<double, double> > fRecorded;   ///< key -> { E -> max xsec }
+
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (MaxXSecTable::fInstance !=0) {
+            delete MaxXSecTable::fInstance;
+            MaxXSecTable::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+
+#endif // _MAX_XSEC_TABLE_H_
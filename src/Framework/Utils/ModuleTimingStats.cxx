@@ -0,0 +1,278 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <cmath>
+#include <iomanip>
+#include <fstream>
+#include <mutex>
+
+#include "Framework/GHEP/GHepFlags.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/ModuleTimingStats.h"
+
+using std::setw;
+using std::setprecision;
+using std::ofstream;
+
+namespace {
+  std::mutex gModuleTimingMutex; // guards ModuleTimingStats::fTimings
+
+  // escape a string for a JSON document
+  string JsonString(const string & s)
+  {
+    string out = "\"";
+    for(unsigned int i = 0; i < s.size(); i++) {
+      if(s[i] == '"' || s[i] == '\\') out += '\\';
+      out += s[i];
+    }
+    return out + "\"";
+  }
+}
+
+namespace genie {
+
+//____________________________________________________________________________
+ostream & operator << (ostream & stream, const ModuleTimingStats & stats)
+{
+  stats.Print(stream);
+  return stream;
+}
+//____________________________________________________________________________
+const double ModuleTiming::kLogMin = -7.;
+const double ModuleTiming::kLogMax =  2.;
+//____________________________________________________________________________
+ModuleTiming::ModuleTiming() :
+evgen(""), module(""), ncalls(0), sum(0.), sum2(0.), min(0.), max(0.),
+bins(kNBins+2, 0),
+nrej(GHepFlags::NFlags(), 0)
+{
+
+}
+//____________________________________________________________________________
+void ModuleTiming::Add(double t)
+{
+  if(ncalls == 0 || t < min) min = t;
+  if(ncalls == 0 || t > max) max = t;
+  ncalls++;
+  sum  += t;
+  sum2 += t*t;
+
+  int ibin = 0; // underflow (incl. t = 0)
+  if(t > 0.) {
+    double x = (std::log10(t) - kLogMin) / (kLogMax - kLogMin);
+    if      (x >= 1.) ibin = kNBins+1;
+    else if (x >= 0.) ibin = 1 + (int) (x*kNBins);
+  }
+  bins[ibin]++;
+}
+//____________________________________________________________________________
+ModuleTimingStats * ModuleTimingStats::fInstance = 0;
+//____________________________________________________________________________
+ModuleTimingStats::ModuleTimingStats()
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+ModuleTimingStats::~ModuleTimingStats()
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+ModuleTimingStats * ModuleTimingStats::Instance()
+{
+  std::lock_guard<std::mutex> lock(gModuleTimingMutex);
+  if(fInstance == 0) {
+    static ModuleTimingStats::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new ModuleTimingStats;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+int ModuleTimingStats::Register(
+               const string & evgen, const vector<string> & modules)
+{
+  std::lock_guard<std::mutex> lock(gModuleTimingMutex);
+
+  // a handful of threads: a linear search will do
+  for(unsigned int id = 0; id < fTimings.size(); id++) {
+    const vector<ModuleTiming> & timings = fTimings[id];
+    if(timings.size() != modules.size()) continue;
+    bool same = true;
+    for(unsigned int i = 0; same && i < timings.size(); i++) {
+      same = (timings[i].evgen == evgen && timings[i].module == modules[i]);
+    }
+    if(same) return id;
+  }
+
+  vector<ModuleTiming> timings(modules.size());
+  for(unsigned int i = 0; i < modules.size(); i++) {
+    timings[i].evgen  = evgen;
+    timings[i].module = modules[i];
+  }
+  fTimings.push_back(timings);
+  return fTimings.size() - 1;
+}
+//____________________________________________________________________________
+void ModuleTimingStats::Add(int id, const vector<double> & times)
+{
+  std::lock_guard<std::mutex> lock(gModuleTimingMutex);
+  if(id < 0 || id >= (int) fTimings.size()) return;
+
+  vector<ModuleTiming> & timings = fTimings[id];
+  unsigned int n = (times.size() < timings.size()) ? times.size() : timings.size();
+  for(unsigned int i = 0; i < n; i++) {
+    if(times[i] >= 0.) timings[i].Add(times[i]);
+  }
+}
+//____________________________________________________________________________
+void ModuleTimingStats::AddRejection(int id, int imodule, int flag)
+{
+  std::lock_guard<std::mutex> lock(gModuleTimingMutex);
+  if(id < 0 || id >= (int) fTimings.size()) return;
+
+  vector<ModuleTiming> & timings = fTimings[id];
+  if(imodule < 0 || imodule >= (int) timings.size()) return;
+  if(flag < 0 || flag >= (int) timings[imodule].nrej.size()) flag = kGenericErr;
+  timings[imodule].nrej[flag]++;
+}
+//____________________________________________________________________________
+void ModuleTimingStats::Reset(void)
+{
+  std::lock_guard<std::mutex> lock(gModuleTimingMutex);
+  for(unsigned int id = 0; id < fTimings.size(); id++) {
+    vector<ModuleTiming> & timings = fTimings[id];
+    for(unsigned int i = 0; i < timings.size(); i++) {
+      ModuleTiming empty;
+      empty.evgen  = timings[i].evgen;
+      empty.module = timings[i].module;
+      timings[i] = empty;
+    }
+  }
+}
+//____________________________________________________________________________
+bool ModuleTimingStats::IsEmpty(void) const
+{
+  std::lock_guard<std::mutex> lock(gModuleTimingMutex);
+  for(unsigned int id = 0; id < fTimings.size(); id++) {
+    const vector<ModuleTiming> & timings = fTimings[id];
+    for(unsigned int i = 0; i < timings.size(); i++) {
+      if(timings[i].ncalls > 0) return false;
+    }
+  }
+  return true;
+}
+//____________________________________________________________________________
+vector<ModuleTiming> ModuleTimingStats::Timings(void) const
+{
+  std::lock_guard<std::mutex> lock(gModuleTimingMutex);
+  vector<ModuleTiming> all;
+  for(unsigned int id = 0; id < fTimings.size(); id++) {
+    all.insert(all.end(), fTimings[id].begin(), fTimings[id].end());
+  }
+  return all;
+}
+//____________________________________________________________________________
+bool ModuleTimingStats::SaveAsJson(string filename) const
+{
+  vector<ModuleTiming> timings = this->Timings();
+
+  ofstream out(filename.c_str());
+  if(!out.is_open()) {
+    LOG("ModuleTiming", pERROR)
+      << "Can not write the module timing summary to: " << filename;
+    return false;
+  }
+
+  out << "{\n  \"log10_time_min\": " << ModuleTiming::kLogMin
+      << ",\n  \"log10_time_max\": "  << ModuleTiming::kLogMax
+      << ",\n  \"nbins\": "           << ModuleTiming::kNBins
+      << ",\n  \"modules\": [";
+  out << setprecision(6);
+  bool first = true;
+  for(unsigned int i = 0; i < timings.size(); i++) {
+    const ModuleTiming & t = timings[i];
+    if(t.ncalls == 0) continue;
+    out << (first ? "" : ",") << "\n    {";
+    out << "\"evgen\": "    << JsonString(t.evgen)
+        << ", \"module\": " << JsonString(t.module)
+        << ", \"ncalls\": " << t.ncalls
+        << ", \"sum\": "    << t.sum
+        << ", \"sum2\": "   << t.sum2
+        << ", \"min\": "    << t.min
+        << ", \"max\": "    << t.max
+        << ", \"bins\": [";
+    for(unsigned int ib = 0; ib < t.bins.size(); ib++) {
+      out << (ib ? "," : "") << t.bins[ib];
+    }
+    out << "], \"rejected\": [";
+    for(unsigned int ir = 0; ir < t.nrej.size(); ir++) {
+      out << (ir ? "," : "") << t.nrej[ir];
+    }
+    out << "]}";
+    first = false;
+  }
+  out << "\n  ]\n}\n";
+  out.close();
+
+  LOG("ModuleTiming", pNOTICE)
+    << "Saved the module timing summary to: " << filename;
+  return true;
+}
+//____________________________________________________________________________
+void ModuleTimingStats::Print(ostream & stream) const
+{
+  vector<ModuleTiming> timings = this->Timings();
+
+  // the total time of each thread, for the time fractions
+  double total = 0.;
+  for(unsigned int i = 0; i < timings.size(); i++) total += timings[i].sum;
+  if(total <= 0.) total = 1.;
+
+  stream << "\n [-] Event generation module timing:";
+  stream << "\n  | " << std::left << setw(60) << "thread / module" << std::right
+         << setw(10) << "calls"
+         << setw(12) << "mean (s)"
+         << setw(12) << "rms (s)"
+         << setw(12) << "max (s)"
+         << setw(10) << "total %";
+
+  string evgen = "";
+  for(unsigned int i = 0; i < timings.size(); i++) {
+    const ModuleTiming & t = timings[i];
+    if(t.ncalls == 0) continue;
+    if(t.evgen != evgen) {
+      evgen = t.evgen;
+      stream << "\n  |--o  " << evgen;
+    }
+    double mean = t.sum / t.ncalls;
+    double var  = t.sum2 / t.ncalls - mean*mean;
+    double rms  = (var > 0.) ? std::sqrt(var) : 0.;
+    stream << "\n  |       " << std::left << setw(54) << t.module << std::right
+           << setw(10) << t.ncalls
+           << std::scientific << setprecision(3)
+           << setw(12) << mean
+           << setw(12) << rms
+           << setw(12) << t.max
+           << std::fixed << setprecision(2)
+           << setw(10) << 100. * t.sum / total;
+    stream.unsetf(std::ios::floatfield);
+    for(unsigned int ir = 0; ir < t.nrej.size(); ir++) {
+      if(t.nrej[ir] == 0) continue;
+      stream << "\n  |         rejected: " << std::left << setw(44)
+             << GHepFlags::Describe(GHepFlag_t(ir)) << std::right
+             << setw(10) << t.nrej[ir];
+    }
+  }
+  stream << "\n";
+}
+//____________________________________________________________________________
+
+} // genie namespace
@@ -0,0 +1,122 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::ModuleTimingStats
+
+\brief    Time distributions of the event generation modules, per event
+          generation thread (EventGenerator) and module, over all events of
+          the job: number of calls, mean, rms, min and max, and the number of
+          calls per bin of log10(time). They show at once which of the QE,
+          RES, DIS, MEC, ... threads, and which of their modules (kinematics,
+          hadronization, intranuclear transport ...), dominate the generation
+          time of a given configuration.
+
+          The module times are measured by EventGenerator with a monotonic
+          (steady) clock and are added once per event. They are reported by
+          GMCJMonitor at the end of the job (also as a JSON summary) and are
+          saved as histograms with the job metadata (NtpMCJobEnv).
+
+          The events terminally rejected by each module (see
+          GHepRecord::Reject()) are counted per reason (GHEP flag), showing
+          how much generation time goes to events that are thrown away.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _MODULE_TIMING_STATS_H_
+#define _MODULE_TIMING_STATS_H_
+
+#include <string>
+#include <vector>
+#include <ostream>
+
+#include <Rtypes.h>
+
+using std::string;
+using std::vector;
+using std::ostream;
+
+namespace genie {
+
+class ModuleTimingStats;
+
+ostream & operator << (ostream & stream, const ModuleTimingStats & stats);
+
+//! The time distribution of one module of an event generation thread
+struct ModuleTiming {
+  ModuleTiming();
+  void Add (double t);
+
+  //! the log10(time/s) binning of the distribution (with an underflow bin 0
+  //! and an overflow bin kNBins+1)
+  static const int    kNBins  = 45;
+  static const double kLogMin;  // -7: 100 ns
+  static const double kLogMax;  // +2: 100 s
+
+  string           evgen;  ///< event generation thread
+  string           module; ///< module
+  Long64_t         ncalls; ///< number of calls
+  double           sum;    ///< sum of the times (s)
+  double           sum2;   ///< sum of the squared times (s^2)
+  double           min;    ///< min time (s)
+  double           max;    ///< max time (s)
+  vector<Long64_t> bins;   ///< number of calls per log10(time) bin
+  vector<Long64_t> nrej;   ///< number of events rejected by the module, per GHEP flag
+};
+
+class ModuleTimingStats {
+
+public:
+  static ModuleTimingStats * Instance (void);
+
+  //! Register the modules of an event generation thread. Returns the id to
+  //! add their times with (the same id for the same thread and modules).
+  int  Register (const string & evgen, const vector<string> & modules);
+
+  //! Add the module times of one event (negative times: module not run)
+  void Add      (int id, const vector<double> & times);
+  //! Count an event rejected by a module (index in the thread) for a reason
+  void AddRejection (int id, int imodule, int flag);
+  void Reset    (void);
+  bool IsEmpty  (void) const;
+
+  //! The time distributions, per thread and module (in processing order)
+  vector<ModuleTiming> Timings (void) const;
+
+  //! Write the summary as JSON
+  bool SaveAsJson (string filename) const;
+
+  void Print (ostream & stream) const;
+  friend ostream & operator << (ostream & stream, const ModuleTimingStats & stats);
+
+private:
+  ModuleTimingStats();
+  ModuleTimingStats(const ModuleTimingStats & stats);
+ ~ModuleTimingStats();
+
+  static ModuleTimingStats * fInstance;
+
+  vector< vector<ModuleTiming> > fTimings; ///< id -> the timings of the thread modules
+
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (ModuleTimingStats::fInstance !=0) {
+            delete ModuleTimingStats::fInstance;
+            ModuleTimingStats::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+
+#endif // _MODULE_TIMING_STATS_H_
@@ -8,12 +8,82 @@
 */
 //____________________________________________________________________________
 
+#include <vector>
+
 #include <TMath.h>
 
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/Units.h"
 #include "Framework/Utils/PREM.h"
 
+using std::vector;
+using namespace genie;
+
+//___________________________________________________________________________
+// The PREM shells and the look-up tables built from them
+namespace {
+
+  // shell outer radius (km) and density polynomial in x = r/rE (g/cm^3)
+  struct PREMShell_t { double rout, c0, c1, c2, c3; };
+
+  const PREMShell_t kShells[] = {
+    { 1221.5, 13.0885,  0.,     -8.8381,  0.     },
+    { 3480.0, 12.5815, -1.2638, -3.6426, -5.5281 },
+    { 5701.0,  7.9565, -6.4761,  5.5283, -3.0807 },
+    { 5771.0,  5.3197, -1.4836,  0.,      0.     },
+    { 5971.0, 11.2494, -8.0298,  0.,      0.     },
+    { 6151.0,  7.1089, -3.8045,  0.,      0.     },
+    { 6346.6,  2.691,   0.6924,  0.,      0.     },
+    { 6356.0,  2.90,    0.,      0.,      0.     },
+    { 6368.0,  2.60,    0.,      0.,      0.     },
+    { 6371.0,  1.02,    0.,      0.,      0.     }
+  };
+  const int kNShells = sizeof(kShells) / sizeof(PREMShell_t);
+
+  // first shell reaching each 1 km radial bin: a shell look-up is a table
+  // read and at most a couple of comparisons
+  struct ShellIndex_t {
+    vector<unsigned char> first;
+    ShellIndex_t() {
+      int nbins = (int) (constants::kREarth/units::km) + 1;
+      first.resize(nbins);
+      int ishell = 0;
+      for(int ibin = 0; ibin < nbins; ibin++) {
+        while(ishell < kNShells-1 && kShells[ishell].rout < ibin) ishell++;
+        first[ibin] = ishell;
+      }
+    }
+  };
+
+  // mass column density along chords of the Earth, tabulated in the chord
+  // impact parameter b (see ChordColumnDensity())
+  const int    kNChordB  = 2001; // impact parameter grid points in [0, rE]
+  const double kChordDt  = 1.;   // integration step along the chord (km)
+
+  struct ChordTable_t {
+    double         db;     // impact parameter step (km)
+    vector<double> column; // column density / (g/cm^3 * km)
+    ChordTable_t() {
+      double rE = constants::kREarth/units::km;
+      db = rE / (kNChordB-1);
+      column.resize(kNChordB);
+      for(int ib = 0; ib < kNChordB; ib++) {
+        double b    = ib*db;
+        double tmax = TMath::Sqrt(TMath::Max(0., rE*rE - b*b));
+        int    nt   = TMath::Max(2, (int) TMath::Ceil(tmax/kChordDt));
+        double dt   = tmax/nt;
+        double sum  = 0;
+        for(int it = 0; it <= nt; it++) {
+          double t   = it*dt;
+          double rho = utils::prem::Density(TMath::Sqrt(b*b + t*t)*units::km);
+          sum += ( (it == 0 || it == nt) ? 0.5 : 1. ) * rho;
+        }
+        // both halves of the chord
+        column[ib] = 2 * sum * dt / units::g_cm3;
+      }
+    }
+  };
+}
 //___________________________________________________________________________
 double genie::utils::prem::Density(double r)
 {
@@ -21,56 +91,55 @@ double genie::utils::prem::Density(double r)
 // Inputs:  r,   Distance from the centre of the Earth (in std GENIE units)
 // Outputs: rho, Earth density (in std GENIE  units)
 //
+  static const ShellIndex_t index;
 
   r = TMath::Max(0., r/units::km); // convert to km
 
   double rE  = constants::kREarth/units::km;
-  double rho = 0.;
+  if(r > rE) return 0.;
+
   double x   = r / rE;
 
-  if (r <= 1221.5 )
-  {
-    rho = 13.0885 - 8.8381*x*x;
-  }
-  else if (r >  1221.5 && r <= 3480.0 )
-  {
-    rho = 12.5815 - 1.2638*x - 3.6426*x*x - 5.5281*x*x*x;
-  }
-  else if (r >  3480.0 && r <= 5701.0 )
-  {
-    rho = 7.9565  - 6.4761*x + 5.5283*x*x - 3.0807*x*x*x;
-  }
-  else if (r >  5701.0 && r <= 5771.0 )
-  {
-    rho = 5.3197  - 1.4836*x;
-  }
-  else if (r >  5771.0 && r <= 5971.0 )
-  {
-    rho = 11.2494 - 8.0298*x;
-  }
-  else if (r >  5971.0 && r <= 6151.0 )
-  {
-    rho = 7.1089  - 3.8045*x;
-  }
-  else if (r >  6151.0 && r <= 6346.6 )
-  {
-    rho = 2.691   + 0.6924*x;
-  }
-  else if (r >  6346.6 && r <= 6356.0 )
-  {
-    rho = 2.90;
-  }
-  else if (r >  6356.0 && r <= 6368.0 )
-  {
-    rho = 2.60;
-  }
-  else if (r >  6368.0 && r <= rE)
-  {
-    rho = 1.02;
-  }
+  // the shells are closed at their outer radius
+  int ishell = index.first[(int) r];
+  while(r > kShells[ishell].rout) ishell++;
+
+  const PREMShell_t & shell = kShells[ishell];
+  double rho = shell.c0 + x*(shell.c1 + x*(shell.c2 + x*shell.c3));
 
   rho = rho * units::g_cm3;
 
   return rho;
 }
 //___________________________________________________________________________
+double genie::utils::prem::ChordColumnDensity(double b)
+{
+// Return the mass column density along the full chord through the Earth
+// with impact parameter (distance from the Earth centre) b.
+// The column densities are integrated once, on a 1 km grid along the chords
+// of a fine grid in b, and are then linearly interpolated.
+// Inputs:  b,   Impact parameter (in std GENIE units)
+// Outputs: the column density (in std GENIE units; 0 for b >= rE)
+//
+  static const ChordTable_t table;
+
+  double u = TMath::Abs(b/units::km) / table.db;
+  if(u >= kNChordB-1) return 0.;
+
+  int    i = (int) u;
+  double c = table.column[i] + (u-i) * (table.column[i+1] - table.column[i]);
+
+  return c * units::g_cm3 * units::km;
+}
+//___________________________________________________________________________
+int genie::utils::prem::NShells(void)
+{
+  return kNShells;
+}
+//___________________________________________________________________________
+double genie::utils::prem::ShellRadius(int ishell)
+{
+  if(ishell < 0 || ishell >= kNShells) return 0.;
+  return kShells[ishell].rout * units::km;
+}
+//___________________________________________________________________________
@@ -31,6 +31,21 @@ namespace prem
   //
   double Density(double r);
 
+  //
+  // the mass column density along a chord through the Earth, as a function
+  // of its impact parameter b (eg. b = rE*sin(theta) for a neutrino reaching
+  // a detector at the surface from a nadir angle theta). Tabulated at the
+  // first call, then O(1).
+  //
+  double ChordColumnDensity(double b);
+
+  //
+  // the model shells, from the centre outwards: the density is smooth
+  // within each shell and may jump at its outer radius
+  //
+  int    NShells     (void);
+  double ShellRadius (int ishell); ///< shell outer radius (std GENIE units)
+
 } // prem  namespace
 } // utils namespace
 } // genie namespace
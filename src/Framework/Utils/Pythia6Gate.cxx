@@ -0,0 +1,117 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <deque>
+#include <mutex>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/Pythia6Gate.h"
+
+using std::deque;
+
+using namespace genie;
+
+//____________________________________________________________________________
+namespace {
+
+  std::recursive_mutex gPythia6Mutex; // the gate
+
+  // Per-thread queue of deferred PYTHIA6 tasks. Tasks still queued when
+  // the thread exits are dropped.
+  struct Pythia6TaskQueue {
+    ~Pythia6TaskQueue() {
+      for(unsigned int i = 0; i < tasks.size(); i++) delete tasks[i];
+    }
+    deque<Pythia6Task *> tasks;
+  };
+  thread_local Pythia6TaskQueue gPythia6Tasks;
+
+  // Leaves the gate on exit from Flush(), even if a task throws
+  struct Pythia6GateExit {
+    ~Pythia6GateExit() { gPythia6Mutex.unlock(); }
+  };
+}
+
+//____________________________________________________________________________
+Pythia6Gate::Pythia6Gate()
+{
+
+}
+//____________________________________________________________________________
+Pythia6Gate::~Pythia6Gate()
+{
+
+}
+//____________________________________________________________________________
+Pythia6Gate * Pythia6Gate::Instance()
+{
+  // thread-safe initialization
+  static Pythia6Gate gate;
+  return &gate;
+}
+//____________________________________________________________________________
+void Pythia6Gate::Enter(void)
+{
+  gPythia6Mutex.lock();
+}
+//____________________________________________________________________________
+bool Pythia6Gate::TryEnter(void)
+{
+  return gPythia6Mutex.try_lock();
+}
+//____________________________________________________________________________
+void Pythia6Gate::Leave(void)
+{
+  gPythia6Mutex.unlock();
+}
+//____________________________________________________________________________
+void Pythia6Gate::Defer(Pythia6Task * task)
+{
+  if(!task) return;
+  gPythia6Tasks.tasks.push_back(task);
+}
+//____________________________________________________________________________
+unsigned int Pythia6Gate::Flush(bool wait)
+{
+  deque<Pythia6Task *> & tasks = gPythia6Tasks.tasks;
+  if(tasks.empty()) return 0;
+
+  if(wait) {
+    gPythia6Mutex.lock();
+  } else {
+    if(!gPythia6Mutex.try_lock()) return 0;
+  }
+  Pythia6GateExit exit_gate;
+
+  unsigned int nrun = 0;
+  while(!tasks.empty()) {
+    Pythia6Task * task = tasks.front();
+    tasks.pop_front();
+    try {
+      task->Run();
+    }
+    catch (...) {
+      delete task;
+      throw;
+    }
+    delete task;
+    nrun++;
+  }
+
+  LOG("Pythia6Gate", pDEBUG) << "Ran " << nrun << " deferred PYTHIA6 tasks";
+
+  return nrun;
+}
+//____________________________________________________________________________
+unsigned int Pythia6Gate::NQueued(void) const
+{
+  return gPythia6Tasks.tasks.size();
+}
+//____________________________________________________________________________
@@ -0,0 +1,83 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::Pythia6Gate
+
+\brief    Serialises the access to PYTHIA6.
+
+          PYTHIA6 keeps all of its state (event record, particle data, decay
+          tables and parameters) in global Fortran common blocks, so only one
+          thread at a time may use it. All GENIE modules driving PYTHIA6
+          (Pythia6Hadro2019, AGCharm2019, PythiaDecayer) enter this gate, via
+          a Pythia6Gate::Guard, for the whole of their PYTHIA6 work: setting
+          parameters and decay flags, running PYTHIA6 and copying its event
+          record. The gate is recursive, so a module inside the gate may call
+          another one using PYTHIA6.
+
+          A thread entering the gate while another thread is inside waits for
+          it. Threads with other work to do can instead queue their PYTHIA6
+          work as tasks with Defer(), go on with their non-PYTHIA work, and
+          run their queued tasks with Flush(): Flush(false) runs them only if
+          the gate is free right now, Flush(true) waits for it. Each thread
+          has its own queue, whose tasks are run (in the order they were
+          queued) by that thread.
+
+          Multi-threaded jobs should prefer Pythia8Hadro2019, which gives each
+          thread its own PYTHIA8 instance and does not use the gate.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _PYTHIA6_GATE_H_
+#define _PYTHIA6_GATE_H_
+
+namespace genie {
+
+//! A piece of PYTHIA6 work queued with Pythia6Gate::Defer()
+class Pythia6Task {
+public:
+  virtual ~Pythia6Task() {}
+  virtual void Run (void) = 0;
+};
+
+class Pythia6Gate {
+
+public:
+  static Pythia6Gate * Instance (void);
+
+  //! Enter / leave the gate. Enter() waits for another thread inside it.
+  void Enter    (void);
+  bool TryEnter (void);
+  void Leave    (void);
+
+  //! Queue a task (adopted by the gate) to run later inside the gate
+  void         Defer   (Pythia6Task * task);
+  //! Run the tasks queued by the calling thread and return how many ran.
+  //! Unless wait is set, nothing runs if another thread is inside the gate.
+  unsigned int Flush   (bool wait=true);
+  //! Number of tasks queued by the calling thread
+  unsigned int NQueued (void) const;
+
+  //! Keeps the calling thread inside the gate during its lifetime
+  class Guard {
+  public:
+    Guard  () { Pythia6Gate::Instance()->Enter(); }
+   ~Guard  () { Pythia6Gate::Instance()->Leave(); }
+  };
+
+private:
+  Pythia6Gate();
+  Pythia6Gate(const Pythia6Gate & gate);
+ ~Pythia6Gate();
+};
+
+}      // genie namespace
+
+#endif // _PYTHIA6_GATE_H_
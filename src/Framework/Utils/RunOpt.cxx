@@ -66,6 +66,9 @@ void RunOpt::Init(void)
   fTune = 0 ;
   fEnableBareXSecPreCalc = true;
   fCacheFile = "";
+  fMaxXSecTableFile = "";
+  fConfigSnapshotFile = (std::getenv("GCONFSNAP")) ?
+                        string(std::getenv("GCONFSNAP")) : "";
   fMesgThresholds = "";
   fUnphysEventMask = new TBits(GHepFlags::NFlags());
 //fUnphysEventMask->ResetAllBits(true);
@@ -76,6 +79,22 @@ void RunOpt::Init(void)
   fEventRecordPrintLevel  = 3;
   fEventGeneratorList     = "Default";
   fXMLPath = "";
+  fOutputQueueDepth       = 0;
+  fOutputCompression      = -1;
+  fOutputBasketSize       = 32000;
+  fOutputAutoSave         = 200000000;  // autosave when 0.2 Gbyte written
+  fOutputAutoFlush        = 0;
+  fCompactGHEP            = false;
+  fOutputIndex            = true;
+  fOutputCost             = false;
+  fNWorkers               = 1;
+  fNThreads               = 1;
+  fChannelBiasing         = "";
+  fForceInteractions      = false;
+  fPipelineDepth          = 0;
+  fOrderedEvents          = false;
+  fSplineStorage          = "default";
+  fOutputMetaStore        = "";
 }
 //____________________________________________________________________________
 void RunOpt::SetTuneName(string tuneName)
@@ -112,6 +131,14 @@ void RunOpt::ReadFromCommandLine(int argc, char ** argv)
     fCacheFile = parser.ArgAsString("cache-file");
   }
 
+  if( parser.OptionExists("max-xsec-table") ) {
+    fMaxXSecTableFile = parser.ArgAsString("max-xsec-table");
+  }
+
+  if( parser.OptionExists("config-snapshot") ) {
+    fConfigSnapshotFile = parser.ArgAsString("config-snapshot");
+  }
+
   if( parser.OptionExists("message-thresholds") ) {
     fMesgThresholds = parser.ArgAsString("message-thresholds");
   }
@@ -133,6 +160,57 @@ void RunOpt::ReadFromCommandLine(int argc, char ** argv)
     fXMLPath = parser.ArgAsString("xml-path");
   }
 
+  if( parser.OptionExists("output-queue-depth") ) {
+    fOutputQueueDepth = TMath::Max(0, parser.ArgAsInt("output-queue-depth"));
+  }
+
+  if( parser.OptionExists("output-compression") ) {
+    fOutputCompression =
+       this->ParseCompression(parser.ArgAsString("output-compression"));
+  }
+  if( parser.OptionExists("output-basket-size") ) {
+    fOutputBasketSize = TMath::Max(1000, parser.ArgAsInt("output-basket-size"));
+  }
+  if( parser.OptionExists("output-autosave") ) {
+    fOutputAutoSave = parser.ArgAsLong("output-autosave");
+  }
+  if( parser.OptionExists("output-autoflush") ) {
+    fOutputAutoFlush = parser.ArgAsLong("output-autoflush");
+  }
+  if( parser.OptionExists("output-ghep-compact") ) {
+    fCompactGHEP = true;
+  }
+  if( parser.OptionExists("output-no-index") ) {
+    fOutputIndex = false;
+  }
+  if( parser.OptionExists("output-event-cost") ) {
+    fOutputCost = true;
+  }
+  if( parser.OptionExists("workers") ) {
+    fNWorkers = TMath::Max(1, parser.ArgAsInt("workers"));
+  }
+  if( parser.OptionExists("threads") ) {
+    fNThreads = TMath::Max(1, parser.ArgAsInt("threads"));
+  }
+  if( parser.OptionExists("channel-bias") ) {
+    fChannelBiasing = parser.ArgAsString("channel-bias");
+  }
+  if( parser.OptionExists("force-interactions") ) {
+    fForceInteractions = true;
+  }
+  if( parser.OptionExists("pipeline-depth") ) {
+    fPipelineDepth = TMath::Max(0, parser.ArgAsInt("pipeline-depth"));
+  }
+  if( parser.OptionExists("ordered-events") ) {
+    fOrderedEvents = true;
+  }
+  if( parser.OptionExists("spline-storage") ) {
+    fSplineStorage = parser.ArgAsString("spline-storage");
+  }
+  if( parser.OptionExists("output-meta-store") ) {
+    fOutputMetaStore = parser.ArgAsString("output-meta-store");
+  }
+
   if( parser.OptionExists("tune") ) {
     SetTuneName( parser.ArgAsString("tune") ) ;
   }
@@ -154,6 +232,42 @@ void RunOpt::ReadFromCommandLine(int argc, char ** argv)
 
 }
 //____________________________________________________________________________
+int RunOpt::ParseCompression(string spec) const
+{
+// Returns the ROOT compression settings (100 x algorithm + level) for the
+// input `algorithm[:level]' string (algorithm: zlib, lzma, lz4 or zstd)
+// or plain ROOT settings code. The default level is ROOT's default for
+// the algorithm. Returns -1 (ROOT default) if the input can't be parsed.
+
+  string alg   = spec;
+  int    level = -1;
+  string::size_type ic = spec.find(":");
+  if(ic != string::npos) {
+    alg   = spec.substr(0, ic);
+    level = atoi(spec.substr(ic+1).c_str());
+  }
+
+  int ialg = -1;
+  int idef = -1;
+  if      (alg == "zlib") { ialg = 1; idef = 1; }
+  else if (alg == "lzma") { ialg = 2; idef = 7; }
+  else if (alg == "lz4" ) { ialg = 4; idef = 4; }
+  else if (alg == "zstd") { ialg = 5; idef = 5; }
+  else if (alg.size() > 0 && alg.find_first_not_of("0123456789") == string::npos) {
+    return atoi(alg.c_str());
+  }
+
+  if(ialg < 0) {
+    LOG("RunOpt", pERROR)
+      << "Unknown output compression: " << spec << " - Using the ROOT default";
+    return -1;
+  }
+  if(level < 0) level = idef;
+  level = TMath::Min(TMath::Max(level, 0), 9);
+
+  return 100*ialg + level;
+}
+//____________________________________________________________________________
 void RunOpt::Print(ostream & stream) const
 {
   stream << "Global running options:";
@@ -161,12 +275,29 @@ void RunOpt::Print(ostream & stream) const
   stream << "\n Event generator list: " << fEventGeneratorList;
   stream << "\n User-specified message thresholds : " << fMesgThresholds;
   stream << "\n Cache file : " << fCacheFile;
+  stream << "\n Max xsec table file : " << fMaxXSecTableFile;
+  stream << "\n Configuration snapshot file : " << fConfigSnapshotFile;
   stream << "\n Unphysical event mask (bits: "
          << GHepFlags::NFlags()-1 << " -> 0) : " << *fUnphysEventMask;
   stream << "\n Event record print level : " << fEventRecordPrintLevel;
   stream << "\n MC job status file refresh rate: " << fMCJobStatusRefreshRate;
   stream << "\n Pre-calculate all free-nucleon cross-sections? : "
          << ((fEnableBareXSecPreCalc) ? "Yes" : "No");
+  stream << "\n Output queue depth (0: synchronous writing) : " << fOutputQueueDepth;
+  stream << "\n Output compression (-1: ROOT default) : " << fOutputCompression;
+  stream << "\n Output basket size / autosave / autoflush : "
+         << fOutputBasketSize << " / " << fOutputAutoSave << " / " << fOutputAutoFlush;
+  stream << "\n Compact GHEP output records? : " << ((fCompactGHEP) ? "Yes" : "No");
+  stream << "\n Write the event index tree? : " << ((fOutputIndex) ? "Yes" : "No");
+  stream << "\n Write the event generation cost? : " << ((fOutputCost) ? "Yes" : "No");
+  stream << "\n Number of worker processes : " << fNWorkers;
+  stream << "\n Number of event generation threads : " << fNThreads;
+  stream << "\n Channel biasing rules : " << fChannelBiasing;
+  stream << "\n Force flux neutrino interactions? : " << ((fForceInteractions) ? "Yes" : "No");
+  stream << "\n Flux & geometry pipeline depth (0: no pipeline) : " << fPipelineDepth;
+  stream << "\n Reproducible, ordered events? : " << ((fOrderedEvents) ? "Yes" : "No");
+  stream << "\n Cross section spline storage : " << fSplineStorage;
+  stream << "\n Job metadata store (\"\": in each output file) : " << fOutputMetaStore;
 
   if (fXMLPath.size()) {
     stream << "\n XMLPath over-ride : "<<fXMLPath;
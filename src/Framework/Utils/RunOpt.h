@@ -44,12 +44,30 @@ public:
   TuneId * Tune                 (void) const { return fTune;                   }
   string EventGeneratorList     (void) const { return fEventGeneratorList;     }
   string CacheFile              (void) const { return fCacheFile;              }
+  string MaxXSecTableFile       (void) const { return fMaxXSecTableFile;       }
+  string ConfigSnapshotFile     (void) const { return fConfigSnapshotFile;     }
   string MesgThresholdFiles     (void) const { return fMesgThresholds;         }
   TBits* UnphysEventMask        (void) const { return fUnphysEventMask;        }
   int    EventRecordPrintLevel  (void) const { return fEventRecordPrintLevel;  }
   int    MCJobStatusRefreshRate (void) const { return fMCJobStatusRefreshRate; }
   bool   BareXSecPreCalc        (void) const { return fEnableBareXSecPreCalc;  }
   string XMLPath                (void) const { return fXMLPath;  }
+  int    OutputQueueDepth       (void) const { return fOutputQueueDepth;       }
+  int    OutputCompression      (void) const { return fOutputCompression;      }
+  int    OutputBasketSize       (void) const { return fOutputBasketSize;       }
+  Long64_t OutputAutoSave       (void) const { return fOutputAutoSave;         }
+  Long64_t OutputAutoFlush      (void) const { return fOutputAutoFlush;        }
+  bool   CompactGHEP            (void) const { return fCompactGHEP;            }
+  bool   OutputIndex            (void) const { return fOutputIndex;            }
+  bool   OutputCost             (void) const { return fOutputCost;             }
+  int    NWorkers               (void) const { return fNWorkers;               }
+  int    NThreads               (void) const { return fNThreads;               }
+  string ChannelBiasing         (void) const { return fChannelBiasing;         }
+  bool   ForceInteractions      (void) const { return fForceInteractions;      }
+  int    PipelineDepth          (void) const { return fPipelineDepth;          }
+  bool   OrderedEvents          (void) const { return fOrderedEvents;          }
+  string SplineStorage          (void) const { return fSplineStorage;          }
+  string OutputMetaStore        (void) const { return fOutputMetaStore;        }
 
   // If a user accesses the GENIE objects directly, then most of the options above
   // can be set directly to the relevant objects (Messenger, Cache, etc).
@@ -65,12 +83,15 @@ public:
 
 private:
 
-  void Init (void);
+  void Init             (void);
+  int  ParseCompression (string spec) const;
 
   // options
   TuneId * fTune;                    ///< GENIE comprehensive neutrino interaction model tune.
   string fEventGeneratorList;        ///< Name of event generator list to be loaded by the event generation drivers.
   string fCacheFile;                 ///< Name of cache file, is cache is to be re-used.
+  string fMaxXSecTableFile;          ///< Name of read-only max xsec table file (built with gmkmxs).
+  string fConfigSnapshotFile;        ///< Name of binary configuration snapshot file (built with gcfgsnap).
   string fMesgThresholds;            ///< List of files (delimited with : if more than one) with custom mesg stream thresholds.
   TBits* fUnphysEventMask;           ///< Unphysical event mask.
   int    fEventRecordPrintLevel;     ///< GHEP event r ecord print level.
@@ -78,6 +99,22 @@ private:
   bool   fEnableBareXSecPreCalc;     ///< Cache calcs relevant to free-nucleon xsecs before any nuclear xsec computation?
                                      ///< The option switches on/off cacheing calculations which interfere with event reweighting.
   string fXMLPath;                   ///< An path to look for XML in. Higher priority than GXMLPATH
+  int    fOutputQueueDepth;          ///< Depth of the queue of events written out by a background thread (0: write synchronously).
+  int    fOutputCompression;         ///< ROOT compression settings of output files (100 x algorithm + level, -1: ROOT default).
+  int    fOutputBasketSize;          ///< Basket size (bytes) of output tree branches.
+  Long64_t fOutputAutoSave;          ///< Output tree auto-save cadence (see TTree::SetAutoSave()).
+  Long64_t fOutputAutoFlush;         ///< Output tree auto-flush cadence (see TTree::SetAutoFlush(), 0: ROOT default).
+  bool   fCompactGHEP;               ///< Write GHEP events as compact, reduced precision records (NtpMCCompactEventRecord)?
+  bool   fOutputIndex;               ///< Write the event index tree (NtpMCEventIndex) next to GHEP event trees?
+  bool   fOutputCost;                ///< Write the event generation cost (NtpMCEventCost) branch?
+  int    fNWorkers;                  ///< Number of worker processes forked after the job initialisation (1: no workers).
+  int    fNThreads;                  ///< Number of event generation threads, in apps supporting them (1: single threaded).
+  string fChannelBiasing;            ///< Channel & target material biasing rules, as key=factor list (see ChannelBias).
+  bool   fForceInteractions;         ///< Force every flux neutrino crossing the geometry to interact (weighted events, see GMCJDriver)?
+  int    fPipelineDepth;             ///< Interacting neutrinos queued by the GMCJDriver flux & geometry stage thread (0: no pipeline).
+  bool   fOrderedEvents;             ///< Generate each event from counter-based random streams of its number and write the events in number order?
+  string fSplineStorage;             ///< Cross section spline storage: default, compact or single (see XSecSplineList::SetCompactStorage()).
+  string fOutputMetaStore;           ///< Directory of the job metadata files shared by the output files (see NtpMCJobConfig::Store(), "": metadata in each file).
 
   // Self
   static RunOpt * fInstance;
@@ -0,0 +1,181 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <ctime>
+#include <iomanip>
+#include <mutex>
+#include <atomic>
+
+#include <TSystem.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/EventGenCost.h"
+#include "Framework/Utils/StartupProfile.h"
+
+using std::setw;
+using std::setprecision;
+
+namespace {
+  std::mutex gStartupProfileMutex; // guards StartupProfile::fPhases
+
+  thread_local int gPhaseDepth = 0; // nesting depth of the current phase
+
+  std::atomic<bool> gReported(false); // was the summary table printed?
+
+  double CpuTime(void)
+  {
+    return (double) std::clock() / CLOCKS_PER_SEC;
+  }
+}
+
+namespace genie {
+
+//____________________________________________________________________________
+ostream & operator << (ostream & stream, const StartupProfile & profile)
+{
+  profile.Print(stream);
+  return stream;
+}
+//____________________________________________________________________________
+StartupPhaseCost::StartupPhaseCost() :
+name(""), depth(0), ncalls(0), wall(0.), cpu(0.), dmem(0.)
+{
+
+}
+//____________________________________________________________________________
+StartupProfile::Scope::Scope(const char * phase) :
+fPhase (phase),
+fWall  (EventGenCost::WallTime()),
+fCpu   (CpuTime()),
+fMem   (StartupProfile::ResidentMemory()),
+fFirst (StartupProfile::Instance()->NPhases()) // starts the clock, if first
+{
+  gPhaseDepth++;
+}
+//____________________________________________________________________________
+StartupProfile::Scope::~Scope()
+{
+  gPhaseDepth--;
+  StartupProfile::Instance()->Add(fPhase, gPhaseDepth, fFirst,
+     EventGenCost::WallTime() - fWall, CpuTime() - fCpu,
+     StartupProfile::ResidentMemory() - fMem);
+}
+//____________________________________________________________________________
+StartupProfile * StartupProfile::fInstance = 0;
+//____________________________________________________________________________
+StartupProfile::StartupProfile() :
+fStart (EventGenCost::WallTime())
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+StartupProfile::~StartupProfile()
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+StartupProfile * StartupProfile::Instance()
+{
+  std::lock_guard<std::mutex> lock(gStartupProfileMutex);
+  if(fInstance == 0) {
+    static StartupProfile::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new StartupProfile;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+unsigned int StartupProfile::NPhases(void) const
+{
+  std::lock_guard<std::mutex> lock(gStartupProfileMutex);
+  return fPhases.size();
+}
+//____________________________________________________________________________
+void StartupProfile::Add(const char * phase, int depth, unsigned int first,
+   double wall, double cpu, double dmem)
+{
+  std::lock_guard<std::mutex> lock(gStartupProfileMutex);
+
+  // a handful of phases: a linear search will do
+  StartupPhaseCost * cost = 0;
+  for(unsigned int i = 0; i < fPhases.size(); i++) {
+    if(fPhases[i].name == phase) { cost = &fPhases[i]; break; }
+  }
+  if(!cost) {
+    // nested phases end before their parent: put the parent before the
+    // phases first seen while it was running
+    unsigned int pos = (first < fPhases.size()) ? first : fPhases.size();
+    StartupPhaseCost c;
+    c.name  = phase;
+    c.depth = depth;
+    cost = &*fPhases.insert(fPhases.begin() + pos, c);
+  }
+  cost->ncalls++;
+  cost->wall += wall;
+  cost->cpu  += cpu;
+  cost->dmem += dmem;
+}
+//____________________________________________________________________________
+void StartupProfile::Report(void)
+{
+  if(gReported.load(std::memory_order_relaxed)) return; // called per event
+  if(gReported.exchange(true)) return;
+
+  LOG("Startup", pNOTICE) << *this;
+}
+//____________________________________________________________________________
+vector<StartupPhaseCost> StartupProfile::Phases(void) const
+{
+  std::lock_guard<std::mutex> lock(gStartupProfileMutex);
+  return fPhases;
+}
+//____________________________________________________________________________
+double StartupProfile::Elapsed(void) const
+{
+  return EventGenCost::WallTime() - fStart;
+}
+//____________________________________________________________________________
+double StartupProfile::ResidentMemory(void)
+{
+  ProcInfo_t info;
+  if(gSystem->GetProcInfo(&info) != 0) return 0.;
+  return info.fMemResident / 1024.; // kB -> MB
+}
+//____________________________________________________________________________
+void StartupProfile::Print(ostream & stream) const
+{
+  vector<StartupPhaseCost> phases = this->Phases();
+
+  stream << "\n [-] Start-up phases:";
+  stream << "\n  | " << std::left << setw(48) << "phase" << std::right
+         << setw(7)  << "calls"
+         << setw(11) << "wall (s)"
+         << setw(11) << "cpu (s)"
+         << setw(13) << "d(mem) (MB)";
+
+  stream << std::fixed;
+  for(unsigned int i = 0; i < phases.size(); i++) {
+    const StartupPhaseCost & c = phases[i];
+    string label = string(2*c.depth, ' ') + c.name;
+    stream << "\n  | " << std::left << setw(48) << label << std::right
+           << setw(7) << c.ncalls << setprecision(3)
+           << setw(11) << c.wall
+           << setw(11) << c.cpu   << setprecision(1)
+           << setw(13) << c.dmem;
+  }
+  stream << setprecision(3)
+         << "\n  | total: " << this->Elapsed() << " s since the first phase, "
+         << setprecision(1) << ResidentMemory() << " MB resident";
+  stream.unsetf(std::ios::floatfield);
+  stream << "\n";
+}
+//____________________________________________________________________________
+
+} // genie namespace
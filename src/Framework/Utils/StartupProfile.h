@@ -0,0 +1,114 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::StartupProfile
+
+\brief    Wall time, CPU time and resident memory taken by the phases of the
+          job start-up (configuration & spline loading, geometry loading and
+          analysis, probability scales, data table loading ...). The phases
+          are timed by StartupProfile::Scope objects placed in the code, and
+          nested phases are shown nested. The same phase entered many times
+          (eg. loading the tables of each target) is summed up.
+
+          A summary table is printed once the first event is generated
+          (GEVGDriver), and is saved with the job metadata (NtpMCJobEnv).
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _STARTUP_PROFILE_H_
+#define _STARTUP_PROFILE_H_
+
+#include <string>
+#include <vector>
+#include <ostream>
+
+using std::string;
+using std::vector;
+using std::ostream;
+
+namespace genie {
+
+class StartupProfile;
+
+ostream & operator << (ostream & stream, const StartupProfile & profile);
+
+//! The cost of one start-up phase
+struct StartupPhaseCost {
+  StartupPhaseCost();
+
+  string name;   ///< phase name
+  int    depth;  ///< phase nesting depth (0: top level phase)
+  int    ncalls; ///< number of times the phase was entered
+  double wall;   ///< wall time (s)
+  double cpu;    ///< CPU time (s)
+  double dmem;   ///< change of the resident memory (MB)
+};
+
+class StartupProfile {
+
+public:
+  static StartupProfile * Instance (void);
+
+  //! Times the enclosing block as a start-up phase
+  class Scope {
+  public:
+    Scope(const char * phase);
+   ~Scope();
+  private:
+    const char * fPhase; ///< phase name
+    double       fWall;  ///< wall time when entering the phase (s)
+    double       fCpu;   ///< CPU time when entering the phase (s)
+    double       fMem;   ///< resident memory when entering the phase (MB)
+    unsigned int fFirst; ///< number of phases known when entering the phase
+  };
+
+  //! Print the summary table (once: later calls do nothing)
+  void Report (void);
+
+  //! The phases, in the order they were first entered
+  vector<StartupPhaseCost> Phases (void) const;
+
+  //! Wall time since the profile was created (s) and resident memory (MB)
+  double Elapsed        (void) const;
+  static double ResidentMemory (void);
+
+  void Print (ostream & stream) const;
+  friend ostream & operator << (ostream & stream, const StartupProfile & profile);
+
+private:
+  StartupProfile();
+  StartupProfile(const StartupProfile & profile);
+ ~StartupProfile();
+
+  unsigned int NPhases (void) const;
+  void Add (const char * phase, int depth, unsigned int first,
+            double wall, double cpu, double dmem);
+
+  static StartupProfile * fInstance;
+
+  vector<StartupPhaseCost> fPhases;   ///< phases, in the order first entered
+  double                   fStart;    ///< wall time when the profile was created (s)
+
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (StartupProfile::fInstance !=0) {
+            delete StartupProfile::fInstance;
+            StartupProfile::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+
+#endif // _STARTUP_PROFILE_H_
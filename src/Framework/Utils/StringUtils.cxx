@@ -101,3 +101,13 @@ string genie::utils::str::ToLower(string input)
   return input;
 }
 //____________________________________________________________________________
+ULong64_t genie::utils::str::Hash(const string & input)
+{
+  ULong64_t hash = 14695981039346656037ULL;
+  for(unsigned int i=0; i<input.size(); i++) {
+    hash ^= (unsigned char) input[i];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+//____________________________________________________________________________
@@ -21,6 +21,8 @@
 #include <string>
 #include <vector>
 
+#include <Rtypes.h>
+
 using std::string;
 using std::vector;
 
@@ -37,6 +39,7 @@ namespace str
   string         FilterString           (string filt, string input);
   string         ToUpper                (string input);
   string         ToLower                (string input);
+  ULong64_t      Hash                   (const string & input); ///< 64-bit FNV-1a hash
 
   template<class T>
     bool Convert( const vector<std::string> & input, std::vector<T> & v ) ;
@@ -0,0 +1,33 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include "Framework/Utils/TraceScope.h"
+
+#if defined(__GENIE_TRACING_ENABLED__) && defined(__GENIE_TRACING_PERFETTO__)
+
+PERFETTO_TRACK_EVENT_STATIC_STORAGE();
+
+namespace {
+
+  // connect to the system tracing service (traced) at load time: the
+  // track events are recorded only while a tracing session is running
+  struct PerfettoInit {
+    PerfettoInit()
+    {
+      perfetto::TracingInitArgs args;
+      args.backends = perfetto::kSystemBackend;
+      perfetto::Tracing::Initialize(args);
+      perfetto::TrackEvent::Register();
+    }
+  };
+  PerfettoInit gPerfettoInit;
+}
+
+#endif
@@ -0,0 +1,134 @@
+//____________________________________________________________________________
+/*!
+
+\namespace genie::tracing
+
+\brief    Named scopes for sampling & tracing profilers, marking the physics
+          structure of the event generation (generation modules, cross
+          section calls, hadron transport steps, geometry swims, flux reads)
+          that the virtual call chains hide from a plain flame graph.
+
+          GTRACE_SCOPE(name)      names the enclosing block (name: a string
+                                  literal)
+          GTRACE_SCOPE_DYN(name)  the same, for a name known at run time
+                                  (a std::string, eg. an algorithm key)
+
+          Use one scope per block. The scopes are compiled in only if GENIE
+          was configured with --enable-tracing, for the instrumentation API
+          chosen with --with-tracing-api:
+
+            itt       Intel ITT API (VTune, ...)   link: -littnotify
+            tracy     Tracy (on-demand client)     link: -lTracyClient
+            perfetto  Perfetto SDK (system trace)  link: -lperfetto
+
+          Otherwise the macros expand to nothing and their arguments
+          are not evaluated. Built in, the scopes are near free until a
+          profiler attaches: the ITT calls are no-ops without a collector,
+          the Tracy client only records when a server connects, and the
+          Perfetto track events only when a tracing session is running.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _TRACE_SCOPE_H_
+#define _TRACE_SCOPE_H_
+
+#include <string>
+
+#include "Framework/Conventions/GBuild.h"
+
+#define GTRACE_CONCAT_(a,b) a##b
+#define GTRACE_CONCAT(a,b)  GTRACE_CONCAT_(a,b)
+
+#if defined(__GENIE_TRACING_ENABLED__) && \
+    !defined(__CINT__) && !defined(__MAKECINT__) && !defined(__ROOTCLING__)
+
+//____________________________________________________________________________
+#if defined(__GENIE_TRACING_ITT__)
+
+#include <ittnotify.h>
+
+namespace genie {
+namespace tracing {
+
+  inline __itt_domain * Domain(void)
+  {
+    static __itt_domain * domain = __itt_domain_create("GENIE");
+    return domain;
+  }
+
+  //! An ITT task lasting as long as the scope
+  class IttScope {
+  public:
+    IttScope(__itt_string_handle * name)
+    {
+      __itt_task_begin(Domain(), __itt_null, __itt_null, name);
+    }
+    IttScope(const std::string & name)
+    {
+      __itt_task_begin(Domain(), __itt_null, __itt_null,
+         __itt_string_handle_create(name.c_str()));
+    }
+   ~IttScope() { __itt_task_end(Domain()); }
+  };
+
+} // tracing namespace
+} // genie namespace
+
+#define GTRACE_SCOPE(name) \
+  static __itt_string_handle * GTRACE_CONCAT(gtrace_name_,__LINE__) = \
+                                         __itt_string_handle_create(name); \
+  genie::tracing::IttScope GTRACE_CONCAT(gtrace_scope_,__LINE__) \
+                                         (GTRACE_CONCAT(gtrace_name_,__LINE__))
+
+#define GTRACE_SCOPE_DYN(name) \
+  genie::tracing::IttScope GTRACE_CONCAT(gtrace_scope_,__LINE__) \
+                                         (std::string(name))
+
+//____________________________________________________________________________
+#elif defined(__GENIE_TRACING_TRACY__)
+
+#include <tracy/Tracy.hpp>
+
+#define GTRACE_SCOPE(name) ZoneScopedN(name)
+
+#define GTRACE_SCOPE_DYN(name) \
+  ZoneScoped; \
+  { const std::string & gtrace_name = (name); \
+    ZoneName(gtrace_name.c_str(), gtrace_name.size()); }
+
+//____________________________________________________________________________
+#elif defined(__GENIE_TRACING_PERFETTO__)
+
+#include <perfetto.h>
+
+PERFETTO_DEFINE_CATEGORIES(
+  perfetto::Category("genie").SetDescription("GENIE event generation"));
+
+#define GTRACE_SCOPE(name) TRACE_EVENT("genie", name)
+
+#define GTRACE_SCOPE_DYN(name) \
+  const std::string GTRACE_CONCAT(gtrace_name_,__LINE__)(name); \
+  TRACE_EVENT("genie", \
+     perfetto::DynamicString{GTRACE_CONCAT(gtrace_name_,__LINE__)})
+
+#else
+#error "Unknown tracing API: configure --with-tracing-api=itt|tracy|perfetto"
+#endif
+
+//____________________________________________________________________________
+#else
+
+#define GTRACE_SCOPE(name)
+#define GTRACE_SCOPE_DYN(name)
+
+#endif
+
+#endif // _TRACE_SCOPE_H_
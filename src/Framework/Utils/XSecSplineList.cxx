@@ -12,7 +12,21 @@
 #include <cmath>   //provides: std::isnan()
 
 #include <fstream>
+#include <sstream>
+#include <iomanip>
 #include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <cerrno>
+#include <algorithm>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <atomic>
+#include <thread>
+#include <mutex>
 
 #include "libxml/parser.h"
 #include "libxml/xmlmemory.h"
@@ -24,15 +38,149 @@
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/Conventions/Units.h"
 #include "Framework/Conventions/GBuild.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Interaction/ScratchInteraction.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/MathUtils.h"
+#include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/Spline.h"
 #include "Framework/Utils/StringUtils.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/StartupProfile.h"
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Utils/XmlParserUtils.h"
 
 using std::ofstream;
+using std::ifstream;
 using std::endl;
+using std::setw;
+using std::setprecision;
+
+//____________________________________________________________________________
+// Binary spline file layout (native byte order, all offsets in bytes from the
+// start of the file):
+//   header
+//   index      : one entry per spline
+//   strings    : tune names and spline keys (not null-terminated)
+//   knot data  : for each spline, 5 doubles per knot (x, y, b, c, d) as
+//                in Spline::KnotData(), aligned at 8 bytes
+namespace {
+
+  const char     kBinMagic[8] = { 'G','E','N','I','E','S','P','L' };
+  const uint32_t kBinByteOrder = 0x01020304;
+  const uint32_t kBinVersion   = 1;
+
+  struct BinHeader {
+    char     magic[8];
+    uint32_t byte_order;
+    uint32_t version;
+    uint32_t uselog;
+    uint32_t nsplines;
+    uint64_t index_offset;
+    uint64_t strings_offset;
+    uint64_t data_offset;
+    uint64_t file_size;
+  };
+
+  struct BinIndexEntry {
+    uint64_t tune_offset;  // relative to the start of the string table
+    uint32_t tune_length;
+    uint32_t nknots;
+    uint64_t key_offset;   // relative to the start of the string table
+    uint32_t key_length;
+    uint32_t reserved;
+    uint64_t data_offset;
+  };
+
+  uint64_t AlignTo8(uint64_t n) { return (n + 7) & ~((uint64_t) 7); }
+
+  // fill in the header and the knot data offsets of the index of a file of
+  // the given splines (index entries with their knots) and string table
+  void BinLayout(BinHeader & header, vector<BinIndexEntry> & index,
+                 uint64_t strings_size, bool uselog)
+  {
+    memset(&header, 0, sizeof(BinHeader));
+    memcpy(header.magic, kBinMagic, sizeof(kBinMagic));
+    header.byte_order     = kBinByteOrder;
+    header.version        = kBinVersion;
+    header.uselog         = (uselog ? 1 : 0);
+    header.nsplines       = index.size();
+    header.index_offset   = sizeof(BinHeader);
+    header.strings_offset = header.index_offset + index.size() * sizeof(BinIndexEntry);
+    header.data_offset    = AlignTo8(header.strings_offset + strings_size);
+
+    uint64_t offset = header.data_offset;
+    for(unsigned int i = 0; i < index.size(); i++) {
+      index[i].data_offset = offset;
+      offset += 5 * sizeof(double) * (uint64_t) index[i].nknots;
+    }
+    header.file_size = offset;
+  }
+
+  // checks of the header, and of an index entry, of a binary file
+  bool ValidBinHeader(const BinHeader & header, uint64_t size)
+  {
+    return
+     memcmp(header.magic, kBinMagic, sizeof(kBinMagic)) == 0 &&
+     header.byte_order     == kBinByteOrder &&
+     header.version        == kBinVersion   &&
+     header.file_size      == size          &&
+     header.index_offset   == sizeof(BinHeader) &&
+     header.strings_offset == header.index_offset +
+                              header.nsplines * (uint64_t) sizeof(BinIndexEntry) &&
+     header.strings_offset <= header.data_offset &&
+     header.data_offset    <= size;
+  }
+  bool ValidBinEntry(
+     const BinHeader & header, const BinIndexEntry & entry, uint64_t size)
+  {
+    uint64_t strings_size = header.data_offset - header.strings_offset;
+    uint64_t data_size = 5 * sizeof(double) * (uint64_t) entry.nknots;
+    return
+     entry.tune_offset + entry.tune_length <= strings_size &&
+     entry.key_offset  + entry.key_length  <= strings_size &&
+     entry.data_offset % 8 == 0            &&
+     entry.data_offset >= header.data_offset &&
+     entry.data_offset + data_size <= size &&
+     entry.nknots > 1;
+  }
+
+  // guards the hashed spline index and the creation of splines on first
+  // access, as spline look-ups can come from the spline building threads
+  std::mutex gSplineIndexMutex;
+
+  // spline look-up statistics (see XSecSplineList::LookupStats)
+  std::atomic<Long64_t> gNSplineLookups(0);
+  std::atomic<Long64_t> gNSplineMisses(0);
+  std::atomic<Long64_t> gNSplineLoads(0);
+
+  // guards the spline usage counters (XSecSplineList::fUsage); no other
+  // lock is taken while holding it
+  std::mutex gSplineUsageMutex;
+
+  // key prefix (xsec_alg/xsec_config) of a spline key
+  string KeyPrefix(const string & key)
+  {
+    string::size_type pos = key.rfind('/');
+    return (pos == string::npos) ? key : key.substr(0, pos);
+  }
+
+  bool MoreMemory(const genie::XSecSplineUsage & a, const genie::XSecSplineUsage & b)
+  {
+    return a.nbytes + a.nmapped > b.nbytes + b.nmapped;
+  }
+
+  // guards the writes to the checkpoint file
+  std::mutex gCheckpointMutex;
+
+  // guards the integral cache and the writes to the integral cache file
+  std::mutex gIntegralCacheMutex;
+
+  // shard files: header, knot grid and computed knot line tags
+  const char *       kShardHeader    = "#genie_xsec_spline_shard";
+  const char *       kShardGrid      = "#grid";
+  const unsigned int kShardUnitKnots = 10; // knots per work unit
+}
 
 namespace genie {
 
@@ -41,6 +189,13 @@ ostream & operator << (ostream & stream, const XSecSplineList & list)
 {
   list.Print(stream);
   return stream;
+}
+//____________________________________________________________________________
+XSecSplineUsage::XSecSplineUsage() :
+prefix(""), nlookups(0), nhits(0), ninserts(0), nsplines(0), nbytes(0),
+nmapped(0)
+{
+
 }
 //____________________________________________________________________________
 XSecSplineList * XSecSplineList::fInstance = 0;
@@ -53,26 +208,67 @@ XSecSplineList::XSecSplineList()
   fNKnots      = 100;
   fEmin        =   0.01; // GeV
   fEmax        = 100.00; // GeV
+  fNThreads    = 1;
+  fKnotTol     = 0.;
+  fCompact     = false;
+  fCompactSingle = false;
+  fCheckpoint  = 0;
+  fIntegralCache = 0;
+  fShard       = 0;
+  fNShards     = 1;
+  fShardUnit   = 0;
+  fNQueuedKnots= 0;
 }
 //____________________________________________________________________________
 XSecSplineList::~XSecSplineList()
 {
 // Clean up.
 
+  this->ClearSplines();
+  this->CloseCheckpointFile();
+  this->CloseIntegralCacheFile();
+
+  for(unsigned int i = 0; i < fQueue.size(); i++) {
+    delete fQueue[i].fInteraction;
+  }
+  fQueue.clear();
+
+  fInstance = 0;
+}
+//____________________________________________________________________________
+void XSecSplineList::ClearSplines(void)
+{
+// Deletes all splines and then unmaps the binary files that their knots
+// may point to. Only called at clean up, as the splines may still be held
+// by the event generation drivers.
+
+  // splines may be shared by several tunes: delete each one once
+  set<Spline *> splines;
   map<string,  map<string, Spline *> >::iterator mm_iter = fSplineMap.begin();
   for( ; mm_iter != fSplineMap.end(); ++mm_iter) {
     // loop over splines for given tune
     map<string, Spline *> & spl_map_curr_tune = mm_iter->second;
     map<string, Spline *>::iterator m_iter = spl_map_curr_tune.begin();
     for( ; m_iter != spl_map_curr_tune.end(); ++m_iter) {
-      Spline * spline = m_iter->second;
-      delete spline;
-      spline = 0;
+      if(m_iter->second) splines.insert(m_iter->second);
     }
     spl_map_curr_tune.clear();
   }
+  unordered_map<ULong64_t, vector<Spline *> >::iterator st_iter;
+  for(st_iter = fSplineStore.begin(); st_iter != fSplineStore.end(); ++st_iter) {
+    splines.insert(st_iter->second.begin(), st_iter->second.end());
+  }
+  set<Spline *>::iterator s_iter = splines.begin();
+  for( ; s_iter != splines.end(); ++s_iter) delete *s_iter;
+  fSplineStore.clear();
   fSplineMap.clear();
-  fInstance = 0;
+  fLoadedSplineSet.clear();
+  fKeyIndex.clear();
+
+  for(unsigned int i = 0; i < fMappedFiles.size(); i++) {
+    munmap(fMappedFiles[i].first, fMappedFiles[i].second);
+  }
+  fMappedFiles.clear();
 }
 //____________________________________________________________________________
 XSecSplineList * XSecSplineList::Instance()
@@ -88,8 +284,11 @@ XSecSplineList * XSecSplineList::Instance()
 bool XSecSplineList::SplineExists(
             const XSecAlgorithmI * alg, const Interaction * interaction) const
 {
-  string key = this->BuildSplineKey(alg,interaction);
-  return this->SplineExists(key);
+  if(!alg || !interaction || fCurrentTune.size() == 0) {
+    string key = this->BuildSplineKey(alg,interaction);
+    return this->SplineExists(key);
+  }
+  return (this->FindSpline(alg, interaction) != 0);
 }
 //____________________________________________________________________________
 bool XSecSplineList::SplineExists(string key) const
@@ -120,8 +319,100 @@ bool XSecSplineList::SplineExists(string key) const
 const Spline * XSecSplineList::GetSpline(
             const XSecAlgorithmI * alg, const Interaction * interaction) const
 {
-  string key = this->BuildSplineKey(alg,interaction);
-  return this->GetSpline(key);
+  if(!alg || !interaction || fCurrentTune.size() == 0) {
+    string key = this->BuildSplineKey(alg,interaction);
+    return this->GetSpline(key);
+  }
+  Spline ** slot = this->FindSpline(alg, interaction);
+  if(!slot) {
+    SLOG("XSecSplLst", pWARN)
+      << "Couldn't find spline: " << this->BuildSplineKey(alg,interaction)
+      << " in tune: " << fCurrentTune;
+    return 0;
+  }
+  if(!*slot) {
+    return this->Materialize(
+       fCurrentTune, this->BuildSplineKey(alg,interaction), 0);
+  }
+  return *slot;
+}
+//____________________________________________________________________________
+Spline ** XSecSplineList::FindSpline(
+            const XSecAlgorithmI * alg, const Interaction * interaction) const
+{
+// Returns the slot of the spline of the current tune in fSplineMap, or 0 if
+// there is no such spline. The slot is looked up by the hash of the algorithm
+// and interaction keys; the string key is built only at the first look-up of
+// each hash.
+
+  ULong64_t hash = utils::math::HashCombine(
+      alg->Id().KeyHash(), (Long64_t) interaction->KeyHash());
+
+  std::lock_guard<std::mutex> lock(gSplineIndexMutex);
+
+  gNSplineLookups.fetch_add(1, std::memory_order_relaxed);
+  unordered_map<ULong64_t, Spline **>::const_iterator //\/
+  h_iter = fKeyIndex.find(hash);
+  if(h_iter != fKeyIndex.end()) {
+    this->CountLookup(alg, h_iter->second != 0);
+    return h_iter->second;
+  }
+  gNSplineMisses.fetch_add(1, std::memory_order_relaxed);
+
+  Spline ** slot = 0;
+  map<string,  map<string, Spline *> >::iterator //\/
+  mm_iter = fSplineMap.find(fCurrentTune);
+  if(mm_iter != fSplineMap.end()) {
+    string key = this->BuildSplineKey(alg,interaction);
+    map<string, Spline *>::iterator m_iter = mm_iter->second.find(key);
+    if(m_iter != mm_iter->second.end()) slot = &(m_iter->second);
+  }
+  fKeyIndex.insert(
+     unordered_map<ULong64_t, Spline **>::value_type(hash, slot));
+  this->CountLookup(alg, slot != 0);
+  return slot;
+}
+//____________________________________________________________________________
+void XSecSplineList::CountLookup(const XSecAlgorithmI * alg, bool hit) const
+{
+  std::lock_guard<std::mutex> lock(gSplineUsageMutex);
+
+  XSecSplineUsage * usage = 0;
+  unordered_map<ULong64_t, XSecSplineUsage *>::const_iterator //\/
+  u_iter = fUsageIndex.find(alg->Id().KeyHash());
+  if(u_iter != fUsageIndex.end()) {
+    usage = u_iter->second;
+  } else {
+    string prefix = alg->Id().Name() + "/" + alg->Id().Config();
+    usage = &fUsage[prefix];
+    usage->prefix = prefix;
+    fUsageIndex.insert(
+       unordered_map<ULong64_t, XSecSplineUsage *>::value_type(
+          alg->Id().KeyHash(), usage));
+  }
+  usage->nlookups++;
+  if(hit) usage->nhits++;
+}
+//____________________________________________________________________________
+void XSecSplineList::CountLookup(const string & key, bool hit) const
+{
+  string prefix = KeyPrefix(key);
+
+  std::lock_guard<std::mutex> lock(gSplineUsageMutex);
+  XSecSplineUsage & usage = fUsage[prefix];
+  usage.prefix = prefix;
+  usage.nlookups++;
+  if(hit) usage.nhits++;
+}
+//____________________________________________________________________________
+void XSecSplineList::CountInsert(const string & key) const
+{
+  string prefix = KeyPrefix(key);
+
+  std::lock_guard<std::mutex> lock(gSplineUsageMutex);
+  XSecSplineUsage & usage = fUsage[prefix];
+  usage.prefix = prefix;
+  usage.ninserts++;
 }
 //____________________________________________________________________________
 const Spline * XSecSplineList::GetSpline(string key) const
@@ -140,16 +431,21 @@ const Spline * XSecSplineList::GetSpline(string key) const
   if(mm_iter == fSplineMap.end()) {
     SLOG("XSecSplLst", pWARN)
        << "No splines for tune " << fCurrentTune << " were found!";
+    this->CountLookup(key, false);
     return 0;
   }
   const map<string, Spline *> & spl_map_curr_tune = mm_iter->second;
   map<string, Spline *>::const_iterator //\/
   m_iter = spl_map_curr_tune.find(key);
+  this->CountLookup(key, m_iter != spl_map_curr_tune.end());
   if(m_iter == spl_map_curr_tune.end()) {
     SLOG("XSecSplLst", pWARN)
       << "Couldn't find spline: " << key << " in tune: " << fCurrentTune;
     return 0;
   }
+  if(!m_iter->second) {
+    return this->Materialize(fCurrentTune, key, 0);
+  }
   return m_iter->second;
 }
 //____________________________________________________________________________
@@ -166,14 +462,375 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
   // rwh -- uncomment to catch NaN
   // feenableexcept(FE_DIVBYZERO|FE_INVALID|FE_OVERFLOW);
 
-  double xsec[nknots];
-  double E   [nknots];
-
   SLOG("XSecSplLst", pNOTICE)
      << "Creating cross section spline using the algorithm: " << *alg;
 
   string key = this->BuildSplineKey(alg,interaction);
 
+  vector<double> E;
+  vector<double> xsec;
+
+  if(fKnotTol > 0.) {
+    this->AdaptiveKnots(key, alg, interaction, nknots, e_min, e_max, E, xsec);
+  } else {
+    this->KnotEnergies(interaction, nknots, e_min, e_max, E);
+
+    // Compute cross sections for the input interaction at the selected
+    // set of energies
+    //
+    xsec.resize(E.size());
+    for (unsigned int i = 0; i < E.size(); i++) {
+      xsec[i] = this->KnotXSec(key, alg, interaction, E[i]);
+    }
+  }
+
+  this->AddSpline(key, E, xsec);
+}
+//____________________________________________________________________________
+void XSecSplineList::QueueSpline(const XSecAlgorithmI * alg,
+     const Interaction * interaction, int nknots, double e_min, double e_max)
+{
+// Queues a spline to be built at the next CreateQueuedSplines() call.
+// In single-threaded mode, or with adaptive knot placement, the spline is
+// simply built right away (unless the knots are split across shards).
+
+  if((fNThreads <= 1 && fNShards <= 1) || fKnotTol > 0.) {
+    this->CreateSpline(alg, interaction, nknots, e_min, e_max);
+    return;
+  }
+
+  string key = this->BuildSplineKey(alg,interaction);
+  for(unsigned int i = 0; i < fQueue.size(); i++) {
+    if(fQueue[i].fKey == key) return;
+  }
+
+  SLOG("XSecSplLst", pNOTICE) << "Queueing cross section spline: " << key;
+
+  fQueue.push_back(SplineTask());
+  SplineTask & task = fQueue.back();
+  task.fKey         = key;
+  task.fAlg         = alg;
+  task.fInteraction = new Interaction(*interaction);
+  this->KnotEnergies(interaction, nknots, e_min, e_max, task.fE);
+  task.fXSec.assign(task.fE.size(), 0.);
+  task.fFirstKnot = fNQueuedKnots;
+  fNQueuedKnots  += task.fE.size();
+
+  // work units of consecutive knots are dealt to the shards in turn
+  task.fCompute.assign(task.fE.size(), true);
+  if(fNShards > 1) {
+    unsigned int unit = 0;
+    for(unsigned int iknot = 0; iknot < task.fE.size(); iknot++) {
+      if(iknot % kShardUnitKnots == 0) unit = fShardUnit++;
+      task.fCompute[iknot] = (unit % fNShards == fShard);
+    }
+  }
+}
+//____________________________________________________________________________
+void XSecSplineList::CreateQueuedSplines(void)
+{
+// Builds all queued splines, spreading the (spline, knot) integrations over
+// fNThreads threads.
+// The last knot of every spline is integrated first, serially, so that
+// algorithms filling caches at their first call (eg free-nucleon cross
+// section caches of nuclear models) do so before any concurrent call.
+// Knots found in the checkpoint file, or belonging to other shards, are not
+// integrated.
+// Each thread integrates its knots with its own copy of the interaction.
+// With counter-based random number streams, the stream of each knot is
+// set from the knot's position in the queue, so that MC integrations do
+// not depend on which thread (or shard, or resumed job) computed the knot.
+// When sharding, the partly computed splines are kept for SaveShard().
+
+  if(fQueue.size() == 0) return;
+
+  SLOG("XSecSplLst", pNOTICE)
+     << "Creating " << fQueue.size() << " queued cross section splines using "
+     << fNThreads << " threads";
+
+  RandomGen * rnd = RandomGen::Instance();
+  bool     use_streams = rnd->UsingCounterBasedStreams();
+  long int seed        = rnd->GetSeed();
+
+  vector< pair<unsigned int, unsigned int> > knots;
+  for(unsigned int ispl = 0; ispl < fQueue.size(); ispl++) {
+    SplineTask & task = fQueue[ispl];
+    vector<unsigned int> todo;
+    for(unsigned int iknot = 0; iknot < task.fE.size(); iknot++) {
+      if(!task.fCompute[iknot]) continue;
+      if(!this->CheckpointedXSec(task.fKey, task.fE[iknot], task.fXSec[iknot])) {
+        todo.push_back(iknot);
+      }
+    }
+    if(todo.size() == 0) continue;
+    unsigned int ilast = todo.back();
+    if(use_streams) rnd->SetEventNumber(task.fFirstKnot + ilast);
+    task.fXSec[ilast] = this->KnotXSec(
+        task.fKey, task.fAlg, task.fInteraction, task.fE[ilast]);
+    for(unsigned int i = 0; i < todo.size()-1; i++) {
+      knots.push_back( pair<unsigned int, unsigned int>(ispl, todo[i]) );
+    }
+  }
+
+  std::atomic<unsigned int> next(0);
+
+  vector<std::thread> threads;
+  for(unsigned int ithread = 0; ithread < fNThreads; ithread++) {
+    threads.push_back( std::thread( [this, &knots, &next,
+                                     use_streams, seed, ithread] ()
+    {
+      if(use_streams) RandomGen::Instance()->SetThreadStreamId(0);
+      else            RandomGen::Instance()->SetThreadSeed(seed + 1 + ithread);
+
+      unsigned int iwork = 0;
+      while( (iwork = next++) < knots.size() ) {
+        SplineTask & task = fQueue[ knots[iwork].first ];
+        unsigned int iknot = knots[iwork].second;
+        if(use_streams) {
+          RandomGen::Instance()->SetEventNumber(task.fFirstKnot + iknot);
+        }
+        ScratchInteraction interaction(task.fInteraction);
+        task.fXSec[iknot] = this->KnotXSec(
+            task.fKey, task.fAlg, interaction.Get(), task.fE[iknot]);
+      }
+      RandomGen::Instance()->DeleteThreadGenerator();
+    } ) );
+  }
+  for(unsigned int ithread = 0; ithread < threads.size(); ithread++) {
+    threads[ithread].join();
+  }
+
+  // store the splines in queue order
+  for(unsigned int ispl = 0; ispl < fQueue.size(); ispl++) {
+    SplineTask & task = fQueue[ispl];
+    delete task.fInteraction;
+    task.fInteraction = 0;
+    if(fNShards > 1) fShardTasks.push_back(task);
+    else             this->AddSpline(task.fKey, task.fE, task.fXSec);
+  }
+  fQueue.clear();
+}
+//____________________________________________________________________________
+void XSecSplineList::SetShard(unsigned int i, unsigned int n)
+{
+  if(n == 0 || i >= n) {
+    SLOG("XSecSplLst", pERROR)
+      << "Invalid shard: " << i << "/" << n << " - Not sharding";
+    i = 0;
+    n = 1;
+  }
+  fShard   = i;
+  fNShards = n;
+}
+//____________________________________________________________________________
+bool XSecSplineList::SaveShard(const string & filename) const
+{
+// Writes the knots computed by this shard. The file starts with a header
+// (shard number, number of shards, uselog), followed by the full knot grid
+// of every spline queued by the job and by one line per computed knot.
+
+  SLOG("XSecSplLst", pNOTICE)
+    << "Saving knots of shard " << fShard << "/" << fNShards
+    << " in file: " << filename;
+
+  ofstream out(filename.c_str());
+  if(!out.is_open()) {
+    SLOG("XSecSplLst", pERROR) << "Couldn't create file = " << filename;
+    return false;
+  }
+  out << kShardHeader << " " << fShard << " " << fNShards << " "
+      << (fUseLogE ? 1 : 0) << endl;
+
+  char value[64];
+  for(unsigned int ispl = 0; ispl < fShardTasks.size(); ispl++) {
+    const SplineTask & task = fShardTasks[ispl];
+    out << kShardGrid << " " << fCurrentTune << " " << task.fKey
+        << " " << task.fE.size();
+    for(unsigned int iknot = 0; iknot < task.fE.size(); iknot++) {
+      snprintf(value, sizeof(value), " %.17g", task.fE[iknot]);
+      out << value;
+    }
+    out << endl;
+  }
+  for(unsigned int ispl = 0; ispl < fShardTasks.size(); ispl++) {
+    const SplineTask & task = fShardTasks[ispl];
+    for(unsigned int iknot = 0; iknot < task.fE.size(); iknot++) {
+      if(!task.fCompute[iknot]) continue;
+      snprintf(value, sizeof(value), "%.17g %.17g",
+               task.fE[iknot], task.fXSec[iknot]);
+      out << fCurrentTune << " " << task.fKey << " " << value << endl;
+    }
+  }
+  out.close();
+  return !out.fail();
+}
+//____________________________________________________________________________
+bool XSecSplineList::IsShardFile(const string & filename)
+{
+  std::ifstream inp(filename.c_str());
+  string tag;
+  return (inp >> tag) && tag == kShardHeader;
+}
+//____________________________________________________________________________
+bool XSecSplineList::LoadFromShards(const vector<string> & filenames)
+{
+// Merges the shard files written by SaveShard() into splines. All shards of
+// the job must be given (once), list the same splines with the same knot
+// grids, and compute each knot exactly once.
+
+  SLOG("XSecSplLst", pNOTICE)
+    << "Merging splines from " << filenames.size() << " shard files";
+
+  if(filenames.size() == 0) return false;
+
+  // per tune/key: knot grid, xsec, number of times each knot was computed,
+  // and number of shards listing the grid
+  map<string, vector<double> > grids;
+  map<string, vector<double> > xsecs;
+  map<string, vector<int>    > counts;
+  map<string, unsigned int   > ngrids;
+  vector<int> shards;
+  unsigned int nshards = 0;
+  int uselog = -1;
+
+  for(unsigned int ifile = 0; ifile < filenames.size(); ifile++) {
+    const string & filename = filenames[ifile];
+    std::ifstream inp(filename.c_str());
+    string line;
+    // header
+    string tag;
+    unsigned int ishard = 0, n = 0;
+    int log = 0;
+    std::getline(inp, line);
+    std::istringstream header(line);
+    if(!(header >> tag >> ishard >> n >> log) ||
+       tag != kShardHeader || n == 0 || ishard >= n) {
+      SLOG("XSecSplLst", pERROR) << "Not a valid shard file: " << filename;
+      return false;
+    }
+    if(ifile == 0) {
+      nshards = n;
+      uselog  = log;
+      shards.assign(nshards, 0);
+    }
+    if(n != nshards || log != uselog) {
+      SLOG("XSecSplLst", pERROR)
+        << "Shard file " << filename << " (shard " << ishard << "/" << n
+        << ") is not from the same job as the other shards";
+      return false;
+    }
+    shards[ishard]++;
+
+    while(std::getline(inp, line)) {
+      std::istringstream fields(line);
+      string tune, key;
+      if(line.compare(0, strlen(kShardGrid), kShardGrid) == 0) {
+        unsigned int nknots = 0;
+        fields >> tag >> tune >> key >> nknots;
+        vector<double> E(nknots);
+        for(unsigned int i = 0; i < nknots; i++) fields >> E[i];
+        if(fields.fail() || nknots < 2) {
+          SLOG("XSecSplLst", pERROR)
+            << "Corrupted knot grid in " << filename << ": " << key;
+          return false;
+        }
+        string id = tune + " " + key;
+        if(grids.count(id) == 0) {
+          grids [id] = E;
+          xsecs [id].assign(nknots, 0.);
+          counts[id].assign(nknots, 0);
+        } else if(grids[id] != E) {
+          SLOG("XSecSplLst", pERROR)
+            << "Shard file " << filename << " has a different knot grid for: "
+            << key << " (tune: " << tune << ")";
+          return false;
+        }
+        ngrids[id]++;
+      } else {
+        double E = 0., xsec = 0.;
+        if(!(fields >> tune >> key >> E >> xsec)) {
+          SLOG("XSecSplLst", pERROR)
+            << "Corrupted knot in " << filename << ": " << line;
+          return false;
+        }
+        string id = tune + " " + key;
+        map<string, vector<double> >::const_iterator g_iter = grids.find(id);
+        if(g_iter == grids.end()) {
+          SLOG("XSecSplLst", pERROR)
+            << "Knot of unknown spline in " << filename << ": " << key;
+          return false;
+        }
+        const vector<double> & grid = g_iter->second;
+        vector<double>::const_iterator e_iter =
+            std::lower_bound(grid.begin(), grid.end(), E);
+        if(e_iter == grid.end() || *e_iter != E) {
+          SLOG("XSecSplLst", pERROR)
+            << "Knot off the knot grid in " << filename << ": " << line;
+          return false;
+        }
+        unsigned int iknot = e_iter - grid.begin();
+        xsecs [id][iknot] = xsec;
+        counts[id][iknot]++;
+      }
+    }
+  }
+
+  // every shard once, every spline in all shards, every knot once
+  bool ok = true;
+  for(unsigned int ishard = 0; ishard < nshards; ishard++) {
+    if(shards[ishard] != 1) {
+      SLOG("XSecSplLst", pERROR)
+        << "Shard " << ishard << "/" << nshards << " was given "
+        << shards[ishard] << " times";
+      ok = false;
+    }
+  }
+  map<string, vector<int> >::const_iterator c_iter = counts.begin();
+  for( ; c_iter != counts.end(); ++c_iter) {
+    const string & id = c_iter->first;
+    if(ngrids[id] != filenames.size()) {
+      SLOG("XSecSplLst", pERROR)
+        << "Spline " << id << " is only listed by " << ngrids[id] << " shards";
+      ok = false;
+    }
+    for(unsigned int iknot = 0; iknot < c_iter->second.size(); iknot++) {
+      int count = c_iter->second[iknot];
+      if(count != 1) {
+        SLOG("XSecSplLst", pERROR)
+          << "Knot " << iknot << " of spline " << id << " was computed "
+          << count << " times";
+        ok = false;
+      }
+    }
+  }
+  if(!ok) return false;
+
+  this->SetLogE(uselog == 1);
+
+  map<string, vector<double> >::iterator g_iter = grids.begin();
+  for( ; g_iter != grids.end(); ++g_iter) {
+    const string & id = g_iter->first;
+    string tune = id.substr(0, id.find(" "));
+    string key  = id.substr(id.find(" ")+1);
+    if(fSplineMap.count(tune) == 1 && fSplineMap[tune].count(key) == 1) {
+      SLOG("XSecSplLst", pWARN)
+        << "Spline " << key << " already exists - Not overwritten";
+      continue;
+    }
+    vector<double> & E    = g_iter->second;
+    vector<double> & xsec = xsecs[id];
+    Spline * spline = new Spline(E.size(), &E[0], &xsec[0]);
+    this->InsertSpline(tune, key, spline);
+  }
+
+  SLOG("XSecSplLst", pNOTICE)
+    << "Merged " << grids.size() << " splines from " << nshards << " shards";
+  return true;
+}
+//____________________________________________________________________________
+void XSecSplineList::KnotEnergies(const Interaction * interaction,
+   int nknots, double e_min, double e_max, vector<double> & E) const
+{
   // If any of the nknots,e_min,e_max was not set or its value is not acceptable
   // use the list values
   //
@@ -182,6 +839,8 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
   if (nknots <= 2) nknots = this->NKnots();
   assert( e_min < e_max );
 
+  E.resize(nknots);
+
   // Distribute the knots in the energy range (e_min,e_max) :
   // - Will use 5 knots linearly spaced below the energy thresholds so that the
   //   spline behaves correctly in (e_min,Ethr)
@@ -219,34 +878,299 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
   }
   // force last point to avoid floating point cumulative slew
   E[nknots-1] = e_max;
+}
+//____________________________________________________________________________
+double XSecSplineList::KnotXSec(const string & key,
+   const XSecAlgorithmI * alg, const Interaction * interaction, double E) const
+{
+  double xsec = 0.;
+  if(this->CheckpointedXSec(key, E, xsec)) {
+    SLOG("XSecSplLst", pINFO)
+      << "Re-using checkpointed xsec(E = " << E << ") =  "
+      << (1E+38/units::cm2)*xsec << " x 1E-38 cm^2";
+    return xsec;
+  }
+
+  ULong64_t hash = 0;
+  if(fIntegralCache) {
+    hash = utils::math::HashCombine(
+               alg->ConfigHash(), (Long64_t) interaction->KeyHash());
+    if(this->CachedIntegral(hash, E, xsec)) {
+      SLOG("XSecSplLst", pINFO)
+        << "Re-using cached xsec(E = " << E << ") =  "
+        << (1E+38/units::cm2)*xsec << " x 1E-38 cm^2";
+      if(fCheckpoint) {
+        char line[1024];
+        snprintf(line, sizeof(line), "%.17g %.17g", E, xsec);
+        std::lock_guard<std::mutex> lock(gCheckpointMutex);
+        *fCheckpoint << fCurrentTune << " " << key << " " << line << endl;
+      }
+      return xsec;
+    }
+  }
 
-  // Compute cross sections for the input interaction at the selected
-  // set of energies
-  //
   double pr_mass = interaction->InitStatePtr()->Probe()->Mass();
-  for (int i = 0; i < nknots; i++) {
-    TLorentzVector p4(0,0,E[i],E[i]);
-    if (pr_mass > 0.) {
-      double pz = TMath::Max(0.,E[i]*E[i] - pr_mass*pr_mass);
-      pz = TMath::Sqrt(pz);
-      p4.SetPz(pz);
-    }
-    interaction->InitStatePtr()->SetProbeP4(p4);
-    xsec[i] = alg->Integral(interaction);
-    SLOG("XSecSplLst", pNOTICE)
-                       << "xsec(E = " << E[i] << ") =  "
-                       << (1E+38/units::cm2)*xsec[i] << " x 1E-38 cm^2";
-    if ( std::isnan(xsec[i]) ) {
-      // this sometimes happens near threshold, warn and move on
+  TLorentzVector p4(0,0,E,E);
+  if (pr_mass > 0.) {
+    double pz = TMath::Max(0.,E*E - pr_mass*pr_mass);
+    pz = TMath::Sqrt(pz);
+    p4.SetPz(pz);
+  }
+  interaction->InitStatePtr()->SetProbeP4(p4);
+  xsec = alg->Integral(interaction);
+  SLOG("XSecSplLst", pNOTICE)
+                     << "xsec(E = " << E << ") =  "
+                     << (1E+38/units::cm2)*xsec << " x 1E-38 cm^2";
+  if ( std::isnan(xsec) ) {
+    // this sometimes happens near threshold, warn and move on
+    SLOG("XSecSplLst", pWARN)
+                     << "xsec(E = " << E << ") =  "
+                     << (1E+38/units::cm2)*xsec << " x 1E-38 cm^2"
+                     << " : converting NaN to 0.0";
+    xsec = 0.0;
+  }
+
+  if(fCheckpoint) {
+    // full precision, so that a resumed job re-uses the exact knot values
+    char line[1024];
+    snprintf(line, sizeof(line), "%.17g %.17g", E, xsec);
+    std::lock_guard<std::mutex> lock(gCheckpointMutex);
+    *fCheckpoint << fCurrentTune << " " << key << " " << line << endl;
+  }
+  if(fIntegralCache) {
+    this->CacheIntegral(hash, E, xsec);
+  }
+  return xsec;
+}
+//____________________________________________________________________________
+bool XSecSplineList::CheckpointedXSec(
+                           const string & key, double E, double & xsec) const
+{
+  if(fCheckpointKnots.size() == 0) return false;
+
+  map<string, map<double, double> >::const_iterator //\/
+  k_iter = fCheckpointKnots.find(fCurrentTune + " " + key);
+  if(k_iter == fCheckpointKnots.end()) return false;
+  map<double, double>::const_iterator e_iter = k_iter->second.find(E);
+  if(e_iter == k_iter->second.end()) return false;
+  xsec = e_iter->second;
+  return true;
+}
+//____________________________________________________________________________
+bool XSecSplineList::SetCheckpointFile(const string & filename, bool resume)
+{
+// Each line of the checkpoint file holds: tune, spline key, E, xsec
+
+  this->CloseCheckpointFile();
+  fCheckpointKnots.clear();
+
+  if(resume) {
+    std::ifstream inp(filename.c_str());
+    if(!inp.is_open()) {
       SLOG("XSecSplLst", pWARN)
-                       << "xsec(E = " << E[i] << ") =  "
-                       << (1E+38/units::cm2)*xsec[i] << " x 1E-38 cm^2"
-                       << " : converting NaN to 0.0";
-      xsec[i] = 0.0;
+        << "No checkpoint file: " << filename << " - Starting from scratch";
+    } else {
+      int nknots = 0;
+      string line;
+      while(std::getline(inp, line)) {
+        std::istringstream fields(line);
+        string tune, key;
+        double E = 0., xsec = 0.;
+        // a job killed while writing may leave an incomplete last line
+        if(!(fields >> tune >> key >> E >> xsec)) continue;
+        fCheckpointKnots[tune + " " + key][E] = xsec;
+        nknots++;
+      }
+      SLOG("XSecSplLst", pNOTICE)
+        << "Read " << nknots << " knots of " << fCheckpointKnots.size()
+        << " splines from checkpoint file: " << filename;
+    }
+  }
+
+  std::ios_base::openmode mode = (resume) ?
+     (std::ios::out | std::ios::app) : (std::ios::out | std::ios::trunc);
+  fCheckpoint = new std::ofstream(filename.c_str(), mode);
+  if(!fCheckpoint->is_open()) {
+    SLOG("XSecSplLst", pERROR)
+      << "Couldn't open checkpoint file = " << filename;
+    this->CloseCheckpointFile();
+    return false;
+  }
+  SLOG("XSecSplLst", pNOTICE) << "Checkpointing knots to: " << filename;
+  return true;
+}
+//____________________________________________________________________________
+void XSecSplineList::CloseCheckpointFile(void)
+{
+  if(fCheckpoint) {
+    fCheckpoint->close();
+    delete fCheckpoint;
+    fCheckpoint = 0;
+  }
+}
+//____________________________________________________________________________
+bool XSecSplineList::CachedIntegral(
+                              ULong64_t hash, double E, double & xsec) const
+{
+  std::lock_guard<std::mutex> lock(gIntegralCacheMutex);
+
+  map<ULong64_t, map<double, double> >::const_iterator //\/
+  h_iter = fCachedIntegrals.find(hash);
+  if(h_iter == fCachedIntegrals.end()) return false;
+  map<double, double>::const_iterator e_iter = h_iter->second.find(E);
+  if(e_iter == h_iter->second.end()) return false;
+  xsec = e_iter->second;
+  return true;
+}
+//____________________________________________________________________________
+void XSecSplineList::CacheIntegral(ULong64_t hash, double E, double xsec) const
+{
+  char line[1024];
+  snprintf(line, sizeof(line), "%016llx %.17g %.17g",
+           (unsigned long long) hash, E, xsec);
+
+  std::lock_guard<std::mutex> lock(gIntegralCacheMutex);
+  fCachedIntegrals[hash][E] = xsec;
+  *fIntegralCache << line << endl;
+}
+//____________________________________________________________________________
+bool XSecSplineList::SetIntegralCacheFile(const string & filename)
+{
+// Each line of the integral cache file holds: the hash of the algorithm
+// configuration and of the interaction (hex), E, xsec
+
+  this->CloseIntegralCacheFile();
+  fCachedIntegrals.clear();
+
+  std::ifstream inp(filename.c_str());
+  if(inp.is_open()) {
+    int nintegrals = 0;
+    string line;
+    while(std::getline(inp, line)) {
+      std::istringstream fields(line);
+      string hex;
+      double E = 0., xsec = 0.;
+      // a job killed while writing may leave an incomplete last line
+      if(!(fields >> hex >> E >> xsec)) continue;
+      ULong64_t hash = (ULong64_t) strtoull(hex.c_str(), 0, 16);
+      fCachedIntegrals[hash][E] = xsec;
+      nintegrals++;
+    }
+    SLOG("XSecSplLst", pNOTICE)
+      << "Read " << nintegrals << " integrals from integral cache file: "
+      << filename;
+  }
+  inp.close();
+
+  fIntegralCache =
+     new std::ofstream(filename.c_str(), std::ios::out | std::ios::app);
+  if(!fIntegralCache->is_open()) {
+    SLOG("XSecSplLst", pERROR)
+      << "Couldn't open integral cache file = " << filename;
+    this->CloseIntegralCacheFile();
+    return false;
+  }
+  SLOG("XSecSplLst", pNOTICE) << "Caching knot integrals in: " << filename;
+  return true;
+}
+//____________________________________________________________________________
+void XSecSplineList::CloseIntegralCacheFile(void)
+{
+  if(fIntegralCache) {
+    fIntegralCache->close();
+    delete fIntegralCache;
+    fIntegralCache = 0;
+  }
+}
+//____________________________________________________________________________
+void XSecSplineList::AdaptiveKnots(const string & key,
+   const XSecAlgorithmI * alg, const Interaction * interaction, int nknots,
+   double e_min, double e_max, vector<double> & E, vector<double> & xsec) const
+{
+// Places the knots where the cross section needs them: Starts from a coarse
+// grid built by KnotEnergies() and, at each pass, integrates at the midpoint
+// (in E or log E) of every interval still flagged. The midpoint becomes a
+// knot and, if the cubic through the knots of the previous pass misses it by
+// more than fKnotTol (relative to the cross section, or to 1E-3 of the
+// maximum cross section where that is small), both halves are flagged for
+// the next pass. Stops when no interval is flagged or after nknots knots.
+// Intervals below threshold, where the cross section vanishes, are not
+// refined.
+
+  if (nknots <= 2) nknots = this->NKnots();
+
+  const int    kNKnotsCoarse = 15;     // min. knots of the starting grid
+  const double kMinRelWidth  = 1.E-4;  // don't split intervals narrower than that
+  const double kXSecFloor    = 1.E-3;  // in units of the max. cross section
+
+  int ncoarse = TMath::Min(nknots, TMath::Max(kNKnotsCoarse, nknots/4));
+  this->KnotEnergies(interaction, ncoarse, e_min, e_max, E);
+
+  xsec.resize(E.size());
+  for (unsigned int i = 0; i < E.size(); i++) {
+    xsec[i] = this->KnotXSec(key, alg, interaction, E[i]);
+  }
+
+  double Ethr = interaction->PhaseSpace().Threshold();
+  vector<bool> refine(E.size()-1);
+  for (unsigned int i = 0; i < refine.size(); i++) {
+    refine[i] = (E[i] >= Ethr);
+  }
+
+  int npass = 0;
+  while ((int) E.size() < nknots) {
+    Spline spline(E.size(), &E[0], &xsec[0]);
+    double xsec_max = 0.;
+    for (unsigned int i = 0; i < xsec.size(); i++) {
+      xsec_max = TMath::Max(xsec_max, TMath::Abs(xsec[i]));
     }
 
+    vector<double> E_next, xsec_next;
+    vector<bool>   refine_next;
+    int  nleft = nknots - E.size();
+    bool split = false;
+    for (unsigned int i = 0; i < refine.size(); i++) {
+      E_next   .push_back(E[i]);
+      xsec_next.push_back(xsec[i]);
+      double Elo = E[i], Ehi = E[i+1];
+      bool check = refine[i] && nleft > 0 && (Ehi-Elo) > kMinRelWidth*Ehi;
+      if (!check) {
+        refine_next.push_back(false);
+        continue;
+      }
+      double Em = (this->UseLogE() && Elo > 0.) ?
+                  TMath::Sqrt(Elo*Ehi) : 0.5*(Elo+Ehi);
+      double xm = this->KnotXSec(key, alg, interaction, Em);
+      double xs = spline.Evaluate(Em);
+      double scale = TMath::Max(TMath::Abs(xm), kXSecFloor*xsec_max);
+      bool   fail  = (scale > 0.) && (TMath::Abs(xs-xm) > fKnotTol*scale);
+      E_next   .push_back(Em);
+      xsec_next.push_back(xm);
+      refine_next.push_back(fail);
+      refine_next.push_back(fail);
+      split = split || fail;
+      nleft--;
+    }
+    E_next   .push_back(E.back());
+    xsec_next.push_back(xsec.back());
+
+    E     .swap(E_next);
+    xsec  .swap(xsec_next);
+    refine.swap(refine_next);
+    npass++;
+    if (!split) break;
   }
 
+  SLOG("XSecSplLst", pNOTICE)
+    << "Placed " << E.size() << " knots (max: " << nknots << ") in "
+    << npass << " refinement passes";
+}
+//____________________________________________________________________________
+void XSecSplineList::AddSpline(const string & key,
+                    const vector<double> & E, const vector<double> & xsec)
+{
+  int nknots = E.size();
+
   // Warn about odd case of decreasing cross section
   //    but allow for small variation due to integration errors
   const double eps_xsec = 1.0e-5;
@@ -260,7 +1184,8 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
 
   // Build
   //
-  Spline * spline = new Spline(nknots, E, xsec);
+  Spline * spline = this->ShareSpline( new Spline(nknots,
+      const_cast<double *>(&E[0]), const_cast<double *>(&xsec[0])) );
 
   // Save
   //
@@ -274,6 +1199,8 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
   }
   map<string, Spline *> & spl_map_curr_tune = mm_iter->second;
   spl_map_curr_tune.insert( map<string, Spline *>::value_type(key, spline) );
+  fKeyIndex.clear();
+  this->CountInsert(key);
 }
 //____________________________________________________________________________
 int XSecSplineList::NSplines(void) const
@@ -289,6 +1216,117 @@ int XSecSplineList::NSplines(void) const
   return (int) spl_map_curr_tune.size();
 }
 //____________________________________________________________________________
+int XSecSplineList::NDistinctSplines(void) const
+{
+  int n = 0;
+  unordered_map<ULong64_t, vector<Spline *> >::const_iterator st_iter;
+  for(st_iter = fSplineStore.begin(); st_iter != fSplineStore.end(); ++st_iter) {
+    n += st_iter->second.size();
+  }
+  return n;
+}
+//____________________________________________________________________________
+void XSecSplineList::LookupStats(
+       Long64_t & nlookups, Long64_t & nmisses, Long64_t & nloads) const
+{
+  nlookups = gNSplineLookups.load(std::memory_order_relaxed);
+  nmisses  = gNSplineMisses.load(std::memory_order_relaxed);
+  nloads   = gNSplineLoads.load(std::memory_order_relaxed);
+}
+//____________________________________________________________________________
+vector<XSecSplineUsage> XSecSplineList::Usage(void) const
+{
+  map<string, XSecSplineUsage> usage;
+  {
+    std::lock_guard<std::mutex> lock(gSplineUsageMutex);
+    usage = fUsage;
+  }
+
+  // splines may be shared by several tunes: count each one once
+  set<const Spline *> counted;
+  map<string, map<string, Spline *> >::const_iterator mm_iter;
+  for(mm_iter = fSplineMap.begin(); mm_iter != fSplineMap.end(); ++mm_iter) {
+    map<string, Spline *>::const_iterator m_iter = mm_iter->second.begin();
+    for( ; m_iter != mm_iter->second.end(); ++m_iter) {
+      const Spline * spline = m_iter->second;
+      if(!spline || !counted.insert(spline).second) continue;
+      string prefix = KeyPrefix(m_iter->first);
+      XSecSplineUsage & u = usage[prefix];
+      u.prefix = prefix;
+      u.nsplines++;
+      u.nbytes += spline->ByteSize();
+    }
+  }
+  map<string, map<string, MappedSpline> >::const_iterator ms_iter;
+  for(ms_iter = fMappedSplines.begin(); ms_iter != fMappedSplines.end(); ++ms_iter) {
+    map<string, MappedSpline>::const_iterator m_iter = ms_iter->second.begin();
+    for( ; m_iter != ms_iter->second.end(); ++m_iter) {
+      string prefix = KeyPrefix(m_iter->first);
+      XSecSplineUsage & u = usage[prefix];
+      u.prefix = prefix;
+      u.nmapped += 5 * m_iter->second.fNKnots * sizeof(double);
+    }
+  }
+
+  vector<XSecSplineUsage> ranked;
+  map<string, XSecSplineUsage>::const_iterator u_iter;
+  for(u_iter = usage.begin(); u_iter != usage.end(); ++u_iter) {
+    ranked.push_back(u_iter->second);
+  }
+  std::stable_sort(ranked.begin(), ranked.end(), MoreMemory);
+  return ranked;
+}
+//____________________________________________________________________________
+size_t XSecSplineList::ByteSize(void) const
+{
+  vector<XSecSplineUsage> usage = this->Usage();
+  size_t nbytes = 0;
+  for(unsigned int i = 0; i < usage.size(); i++) nbytes += usage[i].nbytes;
+  return nbytes;
+}
+//____________________________________________________________________________
+void XSecSplineList::PrintUsage(ostream & stream, unsigned int nmax) const
+{
+  vector<XSecSplineUsage> usage = this->Usage();
+
+  stream << "\n [-] Cross section spline usage (largest first):";
+  stream << "\n  | " << std::right
+         << setw(11) << "size (MB)"
+         << setw(13) << "mapped (MB)"
+         << setw(9)  << "splines"
+         << setw(12) << "look-ups"
+         << setw(9)  << "hits %"
+         << setw(10) << "inserts" << "  xsec_alg/xsec_config";
+
+  size_t nbytes = 0, nmapped = 0;
+  int nsplines = 0;
+  stream << std::fixed;
+  for(unsigned int i = 0; i < usage.size(); i++) {
+    const XSecSplineUsage & u = usage[i];
+    nbytes   += u.nbytes;
+    nmapped  += u.nmapped;
+    nsplines += u.nsplines;
+    if(i >= nmax) continue;
+    double hits = (u.nlookups > 0) ? 100. * u.nhits / u.nlookups : 0.;
+    stream << "\n  | " << setprecision(3)
+           << setw(11) << u.nbytes  / 1048576.
+           << setw(13) << u.nmapped / 1048576.
+           << setw(9)  << u.nsplines
+           << setw(12) << u.nlookups << setprecision(1)
+           << setw(9)  << hits
+           << setw(10) << u.ninserts << "  " << u.prefix;
+  }
+  if(usage.size() > nmax) {
+    stream << "\n  | ... and " << usage.size() - nmax << " more";
+  }
+  stream << setprecision(1)
+         << "\n  | total: " << nsplines << " splines, "
+         << nbytes / 1048576. << " MB (+ " << nmapped / 1048576.
+         << " MB of mapped knots)";
+  stream.unsetf(std::ios::floatfield);
+  stream << "\n";
+}
+//____________________________________________________________________________
 bool XSecSplineList::IsEmpty(void) const
 {
   int n = this->NSplines();
@@ -316,6 +1354,42 @@ void XSecSplineList::SetMaxE(double Ev)
   if(Ev>0) fEmax = Ev;
 }
 //____________________________________________________________________________
+void XSecSplineList::SetNThreads(unsigned int n)
+{
+  fNThreads = (n>0) ? n : 1;
+}
+//____________________________________________________________________________
+void XSecSplineList::SetCurrentTune(const string & tune)
+{
+  fCurrentTune = tune;
+  fKeyIndex.clear();
+}
+//____________________________________________________________________________
+void XSecSplineList::SetKnotTolerance(double tol)
+{
+  fKnotTol = tol;
+}
+//____________________________________________________________________________
+void XSecSplineList::SetCompactStorage(bool on, bool single_precision)
+{
+  SLOG("XSecSplLst", pNOTICE)
+    << "Compact spline storage? " << ((on) ? "Yes" : "No")
+    << ((on && single_precision) ? " (single precision)" : "");
+
+  fCompact       = on;
+  fCompactSingle = on && single_precision;
+  if(!fCompact) return;
+
+  // the splines stored so far
+  unordered_map<ULong64_t, vector<Spline *> >::iterator s_iter;
+  for(s_iter = fSplineStore.begin(); s_iter != fSplineStore.end(); ++s_iter) {
+    vector<Spline *> & splines = s_iter->second;
+    for(unsigned int i = 0; i < splines.size(); i++) {
+      splines[i]->Compact(fCompactSingle);
+    }
+  }
+}
+//____________________________________________________________________________
 void XSecSplineList::SaveAsXml(const string & filename, bool save_init) const
 {
 //! Save XSecSplineList to XML file
@@ -367,8 +1441,8 @@ void XSecSplineList::SaveAsXml(const string & filename, bool save_init) const
       if(from_init_set && !save_init) continue;
 
       // Add current spline to output file
-      Spline * spline = m_iter->second;
-      spline->SaveAsXml(outxml,"E","xsec", key);
+      const Spline * spline = this->Materialize(tune_name, key, m_iter->second);
+      if(spline) spline->SaveAsXml(outxml,"E","xsec", key);
     }//spline loop
 
     outxml << "  </genie_tune>" << endl;
@@ -385,137 +1459,712 @@ XmlParserStatus_t XSecSplineList::LoadFromXml(const string & filename, bool keep
 //! are added to the existing list. If false, then the existing list is reset
 //! before loading the splines.
 
+  StartupProfile::Scope phase("XSecSplineList::LoadFromXml");
+
   SLOG("XSecSplLst", pNOTICE)
     << "Loading splines from: " << filename;
   SLOG("XSecSplLst", pINFO)
     << "Option to keep pre-existing splines is switched "
     << ( (keep) ? "ON" : "OFF" );
 
-  if(!keep) fSplineMap.clear();
-
-  const int kNodeTypeStartElement = 1;
-  const int kNodeTypeEndElement   = 15;
-  const int kKnotX                = 0;
-  const int kKnotY                = 1;
+  if(!keep) {
+    fSplineMap.clear();
+    fKeyIndex.clear();
+  }
 
-  xmlTextReaderPtr reader;
+  // stream through the file: the knots of each spline are converted straight
+  // into the E,xsec arrays (reused from one spline to the next) and splines
+  // rejected by the load filter are skipped without being parsed
+  xmlTextReaderPtr reader = xmlNewTextReaderFilename(filename.c_str());
+  if (reader == NULL) {
+    LOG("XSecSplLst", pERROR)
+          << "\nXML file could not be found! [filename: " << filename << "]";
+    return kXmlOK;
+  }
 
-  int ret = 0, val_type = -1, iknot = 0, nknots = 0;
-  double * E = 0, * xsec = 0;
-  string spline_name = "";
-  string temp_tune ;
+  vector<double> E, xsec;
+  string temp_tune;
 
-  reader = xmlNewTextReaderFilename(filename.c_str());
-  if (reader != NULL) {
+  int ret = xmlTextReaderRead(reader);
+  while (ret == 1) {
+     if(xmlTextReaderNodeType(reader) != XML_READER_TYPE_ELEMENT) {
         ret = xmlTextReaderRead(reader);
-        while (ret == 1) {
-            xmlChar * name  = xmlTextReaderName     (reader);
-            xmlChar * value = xmlTextReaderValue    (reader);
-            int       type  = xmlTextReaderNodeType (reader);
-            int       depth = xmlTextReaderDepth    (reader);
-
-            if(depth==0 && type==kNodeTypeStartElement) {
-               LOG("XSecSplLst", pDEBUG) << "Root element = " << name;
-               if(xmlStrcmp(name, (const xmlChar *) "genie_xsec_spline_list")) {
-                   LOG("XSecSplLst", pERROR)
-                     << "\nXML doc. has invalid root element! [filename: " << filename << "]";
-                   return kXmlInvalidRoot;
-               }
-
-               xmlChar * xvrs   = xmlTextReaderGetAttribute(reader,(const xmlChar*)"version");
-               xmlChar * xinlog = xmlTextReaderGetAttribute(reader,(const xmlChar*)"uselog");
-               string svrs      = utils::str::TrimSpaces((const char *)xvrs);
-               string sinlog    = utils::str::TrimSpaces((const char *)xinlog);
-
-               LOG("XSecSplLst", pNOTICE)
-                   << "Input x-section spline XML file format version: " << svrs;
-
-               if (atoi(sinlog.c_str()) == 1) this->SetLogE(true);
-               else this->SetLogE(false);
-
-               xmlFree(xvrs);
-               xmlFree(xinlog);
-            }
-
-            if( (!xmlStrcmp(name, (const xmlChar *) "genie_tune")) && type==kNodeTypeStartElement) {
-               xmlChar * xtune = xmlTextReaderGetAttribute(reader,(const xmlChar*)"name");
-               temp_tune    = utils::str::TrimSpaces((const char *)xtune);
-               SLOG("XSecSplLst", pNOTICE) << "Loading x-section splines for GENIE tune: " << temp_tune;
-               xmlFree(xtune);
-            }
-
-            if( (!xmlStrcmp(name, (const xmlChar *) "spline")) && type==kNodeTypeStartElement) {
-               xmlChar * xname = xmlTextReaderGetAttribute(reader,(const xmlChar*)"name");
-               xmlChar * xnkn  = xmlTextReaderGetAttribute(reader,(const xmlChar*)"nknots");
-               string sname    = utils::str::TrimSpaces((const char *)xname);
-               string snkn     = utils::str::TrimSpaces((const char *)xnkn);
-
-               spline_name = sname;
-               SLOG("XSecSplLst", pNOTICE) << "Loading spline: " << spline_name;
-
-               nknots = atoi( snkn.c_str() );
-               iknot=0;
-               E     = new double[nknots];
-               xsec  = new double[nknots];
-
-               xmlFree(xname);
-               xmlFree(xnkn);
-            }
-
-            if( (!xmlStrcmp(name, (const xmlChar *) "E"))    && type==kNodeTypeStartElement) { val_type = kKnotX; }
-            if( (!xmlStrcmp(name, (const xmlChar *) "xsec")) && type==kNodeTypeStartElement) { val_type = kKnotY; }
-
-            if( (!xmlStrcmp(name, (const xmlChar *) "#text")) && depth==5) {
-                if      (val_type==kKnotX) E   [iknot] = atof((const char *)value);
-                else if (val_type==kKnotY) xsec[iknot] = atof((const char *)value);
-            }
-            if( (!xmlStrcmp(name, (const xmlChar *) "knot")) && type==kNodeTypeEndElement) {
-               iknot++;
-            }
-            if( (!xmlStrcmp(name, (const xmlChar *) "spline")) && type==kNodeTypeEndElement) {
+        continue;
+     }
+     const xmlChar * name = xmlTextReaderConstLocalName(reader);
+
+     if(xmlTextReaderDepth(reader) == 0) {
+        LOG("XSecSplLst", pDEBUG) << "Root element = " << name;
+        if(!xmlStrEqual(name, (const xmlChar *) "genie_xsec_spline_list")) {
+           LOG("XSecSplLst", pERROR)
+             << "\nXML doc. has invalid root element! [filename: " << filename << "]";
+           xmlFreeTextReader(reader);
+           return kXmlInvalidRoot;
+        }
+        string svrs   = utils::xml::GetAttribute(reader, "version");
+        string sinlog = utils::xml::GetAttribute(reader, "uselog");
+
+        LOG("XSecSplLst", pNOTICE)
+           << "Input x-section spline XML file format version: " << svrs;
+
+        if (atoi(sinlog.c_str()) == 1) this->SetLogE(true);
+        else this->SetLogE(false);
+     }
+     else
+     if(xmlStrEqual(name, (const xmlChar *) "genie_tune")) {
+        temp_tune = utils::xml::GetAttribute(reader, "name");
+        SLOG("XSecSplLst", pNOTICE) << "Loading x-section splines for GENIE tune: " << temp_tune;
+     }
+     else
+     if(xmlStrEqual(name, (const xmlChar *) "spline")) {
+        string spline_name = utils::xml::GetAttribute(reader, "name");
+        SLOG("XSecSplLst", pNOTICE) << "Loading spline: " << spline_name;
+
+        // skip the whole <spline> element if rejected by the load filter
+        if(!this->PassesLoadFilter(spline_name)) {
+           ret = xmlTextReaderNext(reader);
+           continue;
+        }
+
+        int nknots = utils::xml::ReadKnots(reader, "E", "xsec", E, xsec);
+        if(nknots < 0) { ret = -1; break; }
+        if(nknots != (int) E.size() || nknots == 0) {
+           LOG("XSecSplLst", pERROR)
+             << "Spline " << spline_name << " has " << nknots << " knots, "
+             << "expected " << E.size() << " - Not loading it";
+        }
+        else {
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-               LOG("XSecSplLst", pINFO) << "Done with current spline";
-               for(int i=0; i<nknots; i++) {
-                  LOG("XSecSplLst", pINFO) << "xsec[E = " << E[i] << "] = " << xsec[i];
-               }
+           LOG("XSecSplLst", pINFO) << "Done with current spline";
+           for(int i=0; i<nknots; i++) {
+              LOG("XSecSplLst", pINFO) << "xsec[E = " << E[i] << "] = " << xsec[i];
+           }
 #endif
-               // done looping over knots - build the spline
-               Spline * spline = new Spline(nknots, E, xsec);
-               delete [] E;
-               delete [] xsec;
-
-               // insert the spline to the map
-               map<string,  map<string, Spline *> >::iterator //\/
-               mm_iter = fSplineMap.find( temp_tune );
-               if(mm_iter == fSplineMap.end()) {
-                 map<string, Spline *> spl_map_curr_tune;
-                 fSplineMap.insert( map<string, map<string, Spline *> >::value_type(
-                    temp_tune, spl_map_curr_tune) );
-                 mm_iter = fSplineMap.find( temp_tune );
-               }
-               map<string, Spline *> & spl_map_curr_tune = mm_iter->second;
-               spl_map_curr_tune.insert(
-                  map<string, Spline *>::value_type(spline_name, spline) );
-               fLoadedSplineSet[temp_tune].insert(spline_name);
-            }
-            xmlFree(name);
-            xmlFree(value);
-            ret = xmlTextReaderRead(reader);
-        }
-        xmlFreeTextReader(reader);
-        if (ret != 0) {
-          LOG("XSecSplLst", pERROR)
-            << "\nXML file could not be parsed! [filename: " << filename << "]";
-          return kXmlNotParsed;
+           // done looping over knots - build the spline &
+           // insert it to the map
+           Spline * spline = new Spline(nknots, &E[0], &xsec[0]);
+           this->InsertSpline(temp_tune, spline_name, spline);
         }
-  } else {
+     }
+     ret = xmlTextReaderRead(reader);
+  }
+  xmlFreeTextReader(reader);
+  if (ret != 0) {
+     LOG("XSecSplLst", pERROR)
+       << "\nXML file could not be parsed! [filename: " << filename << "]";
+     return kXmlNotParsed;
+  }
+
+  return kXmlOK;
+}
+//____________________________________________________________________________
+void XSecSplineList::InsertSpline(
+             const string & tune, const string & key, Spline * spline)
+{
+// Adds a loaded spline to the map (and to the set of initially loaded ones)
+
+  map<string,  map<string, Spline *> >::iterator //\/
+  mm_iter = fSplineMap.find( tune );
+  if(mm_iter == fSplineMap.end()) {
+    map<string, Spline *> spl_map_curr_tune;
+    fSplineMap.insert( map<string, map<string, Spline *> >::value_type(
+       tune, spl_map_curr_tune) );
+    mm_iter = fSplineMap.find( tune );
+  }
+  map<string, Spline *> & spl_map_curr_tune = mm_iter->second;
+  spl_map_curr_tune.insert(
+     map<string, Spline *>::value_type(key, this->ShareSpline(spline)) );
+  fLoadedSplineSet[tune].insert(key);
+  fKeyIndex.clear();
+  this->CountInsert(key);
+}
+//____________________________________________________________________________
+Spline * XSecSplineList::Materialize(
+            const string & tune, const string & key, Spline * spline) const
+{
+// Returns the input spline or, if that is null, creates the spline from the
+// knots of a mapped binary file and stores it in the list
+
+  if(spline) return spline;
+
+  map<string, map<string, MappedSpline> >::const_iterator //\/
+  mm_iter = fMappedSplines.find(tune);
+  if(mm_iter == fMappedSplines.end()) return 0;
+  map<string, MappedSpline>::const_iterator m_iter = mm_iter->second.find(key);
+  if(m_iter == mm_iter->second.end()) return 0;
+
+  std::lock_guard<std::mutex> lock(gSplineIndexMutex);
+
+  map<string,  map<string, Spline *> >::iterator //\/
+  sm_iter = fSplineMap.find(tune);
+  if(sm_iter == fSplineMap.end()) return 0;
+  map<string, Spline *>::iterator s_iter = sm_iter->second.find(key);
+  if(s_iter == sm_iter->second.end()) return 0;
+  if(s_iter->second) return s_iter->second; // created by another thread
+
+  SLOG("XSecSplLst", pINFO) << "Loading spline: " << key;
+
+  spline = new Spline;
+  spline->LoadFromBuffer(m_iter->second.fNKnots, m_iter->second.fKnots);
+  spline = this->ShareSpline(spline);
+  gNSplineLoads.fetch_add(1, std::memory_order_relaxed);
+  this->CountInsert(key);
+  s_iter->second = spline;
+  return spline;
+}
+//____________________________________________________________________________
+Spline * XSecSplineList::ShareSpline(Spline * spline) const
+{
+// Returns the stored spline with the same knots as the input one (which is
+// then deleted) or, if there is none, stores and returns the input spline.
+// The knot x, y and cubic coefficients are compared, so that shared splines
+// evaluate identically (to the storage precision, for compact splines).
+// Stored splines are compacted if SetCompactStorage() was called.
+
+  if(!spline || spline->NKnots() <= 0 || !spline->KnotData()) return spline;
+
+  size_t nbytes = 5 * spline->NKnots() * sizeof(double);
+  const char * knots = (const char *) spline->KnotData();
+  ULong64_t hash = utils::str::Hash(string(knots, nbytes));
+
+  vector<Spline *> & stored = fSplineStore[hash];
+  for(unsigned int i = 0; i < stored.size(); i++) {
+    if(stored[i] == spline) return spline;
+    if(stored[i]->NKnots() == spline->NKnots() &&
+       stored[i]->HasKnotData(spline->KnotData())) {
+      delete spline;
+      return stored[i];
+    }
+  }
+  if(fCompact) spline->Compact(fCompactSingle);
+  stored.push_back(spline);
+  return spline;
+}
+//____________________________________________________________________________
+void XSecSplineList::SetLoadFilter(
+                        const set<int> & probes, const set<int> & targets)
+{
+  fFilterProbes  = probes;
+  fFilterTargets = targets;
+}
+//____________________________________________________________________________
+void XSecSplineList::ClearLoadFilter(void)
+{
+  fFilterProbes .clear();
+  fFilterTargets.clear();
+}
+//____________________________________________________________________________
+bool XSecSplineList::PassesLoadFilter(const string & key) const
+{
+// Checks the probe ("nu:<pdg>;") and target ("tgt:<pdg>;") fields of the
+// spline key (see Interaction::AsString()) against the load filter
+
+  if(fFilterProbes.size() > 0) {
+    size_t pos = key.find("/nu:");
+    if(pos != string::npos) {
+      int probe = atoi(key.c_str() + pos + 4);
+      if(fFilterProbes.count(probe) == 0) return false;
+    }
+  }
+  if(fFilterTargets.size() > 0) {
+    size_t pos = key.find(";tgt:");
+    if(pos != string::npos) {
+      int target = atoi(key.c_str() + pos + 5);
+      if(fFilterTargets.count(target) == 0) return false;
+    }
+  }
+  return true;
+}
+//____________________________________________________________________________
+void XSecSplineList::SaveAsBinary(const string & filename, bool save_init) const
+{
+//! Save XSecSplineList to a binary file that can be memory-mapped by
+//! LoadFromBinary(). The file is written in the native byte order.
+
+  SLOG("XSecSplLst", pNOTICE)
+       << "Saving XSecSplineList as binary file: " << filename;
+
+  vector<string>         tunes;
+  vector<string>         keys;
+  vector<const Spline *> splines;
+
+  map<string,  map<string, Spline *> >::const_iterator //\/
+  mm_iter = fSplineMap.begin();
+  for( ; mm_iter != fSplineMap.end(); ++mm_iter) {
+    const string & tune_name = mm_iter->first;
+    const set<string> * init_set_curr_tune = 0;
+    map<string, set<string> >::const_iterator //\/
+    it = fLoadedSplineSet.find(tune_name);
+    if(it != fLoadedSplineSet.end()) init_set_curr_tune = &(it->second);
+
+    const map<string, Spline *> & spl_map_curr_tune = mm_iter->second;
+    map<string, Spline *>::const_iterator //\/
+    m_iter = spl_map_curr_tune.begin();
+    for( ; m_iter != spl_map_curr_tune.end(); ++m_iter) {
+      const string & key = m_iter->first;
+      bool from_init_set =
+         (init_set_curr_tune && init_set_curr_tune->count(key) == 1);
+      if(from_init_set && !save_init) continue;
+
+      const Spline * spline = this->Materialize(tune_name, key, m_iter->second);
+      if(!spline || (!spline->KnotData() && !spline->IsSinglePrecision())) {
+        SLOG("XSecSplLst", pWARN)
+          << "Spline " << key << " has less than 2 knots - Not saved";
+        continue;
+      }
+      tunes  .push_back(tune_name);
+      keys   .push_back(key);
+      splines.push_back(spline);
+    }
+  }
+
+  unsigned int nsplines = splines.size();
+
+  // build the index and the string table
+  vector<BinIndexEntry> index(nsplines);
+  string strings = "";
+  map<string, uint64_t> tune_offsets;
+  for(unsigned int i = 0; i < nsplines; i++) {
+    map<string, uint64_t>::const_iterator t_iter = tune_offsets.find(tunes[i]);
+    if(t_iter == tune_offsets.end()) {
+      t_iter = tune_offsets.insert(
+         map<string, uint64_t>::value_type(tunes[i], strings.size())).first;
+      strings += tunes[i];
+    }
+    memset(&index[i], 0, sizeof(BinIndexEntry));
+    index[i].tune_offset = t_iter->second;
+    index[i].tune_length = tunes[i].size();
+    index[i].key_offset  = strings.size();
+    index[i].key_length  = keys[i].size();
+    index[i].nknots      = splines[i]->NKnots();
+    strings += keys[i];
+  }
+
+  BinHeader header;
+  BinLayout(header, index, strings.size(), fUseLogE);
+
+  ofstream outbin(filename.c_str(), std::ios::out | std::ios::binary);
+  if(!outbin.is_open()) {
+    SLOG("XSecSplLst", pERROR) << "Couldn't create file = " << filename;
+    return;
+  }
+  outbin.write((const char *) &header, sizeof(BinHeader));
+  if(nsplines > 0) {
+    outbin.write((const char *) &index[0], nsplines * sizeof(BinIndexEntry));
+  }
+  outbin.write(strings.data(), strings.size());
+  const char padding[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+  outbin.write(padding,
+     header.data_offset - header.strings_offset - strings.size());
+  vector<double> knots;
+  for(unsigned int i = 0; i < nsplines; i++) {
+    const double * data = splines[i]->KnotData();
+    if(!data) {
+      splines[i]->GetKnotData(knots); // single precision spline
+      data = &knots[0];
+    }
+    outbin.write((const char *) data, 5 * sizeof(double) * index[i].nknots);
+  }
+  if(!outbin.good()) {
+    SLOG("XSecSplLst", pERROR) << "Error while writing file = " << filename;
+  }
+  outbin.close();
+}
+//____________________________________________________________________________
+XmlParserStatus_t XSecSplineList::LoadFromBinary(const string & filename, bool keep)
+{
+//! Load XSecSplineList from a binary file written by SaveAsBinary().
+//! The file is memory-mapped read-only and remains mapped for as long as its
+//! splines are in use. If keep = true, then the loaded splines are added to
+//! the existing list. If false, then the existing list is reset before
+//! loading the splines.
+
+  SLOG("XSecSplLst", pNOTICE)
+    << "Loading splines from binary file: " << filename;
+  SLOG("XSecSplLst", pINFO)
+    << "Option to keep pre-existing splines is switched "
+    << ( (keep) ? "ON" : "OFF" );
+
+  if(!keep) {
+    fSplineMap.clear();
+    fKeyIndex.clear();
+  }
+
+  int fd = open(filename.c_str(), O_RDONLY);
+  if(fd < 0) {
     LOG("XSecSplLst", pERROR)
-          << "\nXML file could not be found! [filename: " << filename << "]";
+          << "\nBinary file could not be found! [filename: " << filename << "]";
+    return kXmlNotParsed;
+  }
+  struct stat st;
+  if(fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(BinHeader)) {
+    LOG("XSecSplLst", pERROR)
+          << "\nBinary file is empty or truncated! [filename: " << filename << "]";
+    close(fd);
+    return kXmlEmpty;
+  }
+  size_t size = st.st_size;
+  void * addr = mmap(0, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if(addr == MAP_FAILED) {
+    LOG("XSecSplLst", pERROR)
+          << "\nBinary file could not be mapped! [filename: " << filename << "]";
+    return kXmlNotParsed;
+  }
+  const char * base = (const char *) addr;
+
+  // check the header and that the index, string table & knot data fit in
+  BinHeader header;
+  memcpy(&header, base, sizeof(BinHeader));
+  bool ok = ValidBinHeader(header, size);
+  if(!ok) {
+    LOG("XSecSplLst", pERROR)
+      << "\nBinary file has an invalid or incompatible header (version: "
+      << header.version << ")! [filename: " << filename << "]";
+    munmap(addr, size);
+    return kXmlInvalidRoot;
+  }
+  const BinIndexEntry * index =
+        (const BinIndexEntry *) (base + header.index_offset);
+  const char * strings = base + header.strings_offset;
+
+  for(uint32_t i = 0; i < header.nsplines; i++) {
+    ok = ValidBinEntry(header, index[i], size);
+    if(!ok) break;
+  }
+  if(!ok) {
+    LOG("XSecSplLst", pERROR)
+          << "\nBinary file has a corrupted index! [filename: " << filename << "]";
+    munmap(addr, size);
+    return kXmlNotParsed;
+  }
+
+  this->SetLogE(header.uselog == 1);
+  fMappedFiles.push_back(pair<void *, size_t>(addr, size));
+
+  // only read the index: the splines are created when first asked for
+  unsigned int nloaded = 0;
+  for(uint32_t i = 0; i < header.nsplines; i++) {
+    const BinIndexEntry & entry = index[i];
+    string tune(strings + entry.tune_offset, entry.tune_length);
+    string key (strings + entry.key_offset,  entry.key_length );
+    if(!this->PassesLoadFilter(key)) continue;
+    if(fSplineMap.count(tune) == 1 && fSplineMap[tune].count(key) == 1) continue;
+    LOG("XSecSplLst", pINFO) << "Indexing spline: " << key;
+
+    MappedSpline mapped;
+    mapped.fNKnots = entry.nknots;
+    mapped.fKnots  = (const double *) (base + entry.data_offset);
+    fMappedSplines[tune][key] = mapped;
+    this->InsertSpline(tune, key, 0);
+    nloaded++;
   }
 
+  SLOG("XSecSplLst", pNOTICE)
+    << "Indexed " << nloaded << " (out of " << header.nsplines
+    << ") splines from: " << filename;
+
   return kXmlOK;
 }
 //____________________________________________________________________________
+bool XSecSplineList::IsBinaryFile(const string & filename)
+{
+// Checks whether the input file starts with the binary spline file signature
+
+  ifstream inp(filename.c_str(), std::ios::in | std::ios::binary);
+  if(!inp.is_open()) return false;
+  char magic[sizeof(kBinMagic)];
+  inp.read(magic, sizeof(magic));
+  return inp.good() && memcmp(magic, kBinMagic, sizeof(kBinMagic)) == 0;
+}
+//____________________________________________________________________________
+namespace {
+  // the header, index and string table (not the knots) of a binary file,
+  // read from the open file
+  struct BinFileIndex {
+    BinHeader             header;
+    vector<BinIndexEntry> index;
+    string                strings;
+
+    string Tune (uint32_t i) const {
+      return strings.substr(index[i].tune_offset, index[i].tune_length);
+    }
+    string Key  (uint32_t i) const {
+      return strings.substr(index[i].key_offset, index[i].key_length);
+    }
+  };
+
+  bool ReadFull(int fd, void * buf, uint64_t n, uint64_t offset)
+  {
+    char * p = (char *) buf;
+    while(n > 0) {
+      ssize_t r = pread(fd, p, n, offset);
+      if(r < 0 && errno == EINTR) continue;
+      if(r <= 0) return false;
+      p += r; n -= r; offset += r;
+    }
+    return true;
+  }
+  bool WriteFull(int fd, const void * buf, uint64_t n, uint64_t offset)
+  {
+    const char * p = (const char *) buf;
+    while(n > 0) {
+      ssize_t w = pwrite(fd, p, n, offset);
+      if(w < 0 && errno == EINTR) continue;
+      if(w <= 0) return false;
+      p += w; n -= w; offset += w;
+    }
+    return true;
+  }
+  // copy n bytes between files through a fixed size buffer
+  bool CopyBytes(int from, uint64_t from_offset,
+                 int to,   uint64_t to_offset, uint64_t n)
+  {
+    const uint64_t kBufferSize = 1 << 20;
+    vector<char> buffer( std::min(n, kBufferSize) );
+    while(n > 0) {
+      uint64_t m = std::min(n, kBufferSize);
+      if(!ReadFull (from, &buffer[0], m, from_offset)) return false;
+      if(!WriteFull(to,   &buffer[0], m, to_offset  )) return false;
+      n -= m; from_offset += m; to_offset += m;
+    }
+    return true;
+  }
+
+  bool ReadBinIndex(int fd, BinFileIndex & bin)
+  {
+    struct stat st;
+    if(fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(BinHeader)) return false;
+    uint64_t size = st.st_size;
+    if(!ReadFull(fd, &bin.header, sizeof(BinHeader), 0)) return false;
+    if(!ValidBinHeader(bin.header, size)) return false;
+
+    const BinHeader & header = bin.header;
+    bin.index.resize(header.nsplines);
+    bin.strings.resize(header.data_offset - header.strings_offset);
+    if(header.nsplines > 0 &&
+       !ReadFull(fd, &bin.index[0], header.nsplines * sizeof(BinIndexEntry),
+                 header.index_offset)) return false;
+    if(bin.strings.size() > 0 &&
+       !ReadFull(fd, &bin.strings[0], bin.strings.size(),
+                 header.strings_offset)) return false;
+    for(uint32_t i = 0; i < header.nsplines; i++) {
+      if(!ValidBinEntry(header, bin.index[i], size)) return false;
+    }
+    return true;
+  }
+  void CloseAll(const vector<int> & fds)
+  {
+    for(unsigned int i = 0; i < fds.size(); i++) close(fds[i]);
+  }
+}
+//____________________________________________________________________________
+bool XSecSplineList::MergeBinary(
+   const vector<string> & inputs, const string & output)
+{
+//! Merge binary spline files (the first input with a given tune & key wins)
+//! into the output file, copying their knot blocks through a fixed size
+//! buffer: only the indices are kept in memory. The output may be one of
+//! the inputs (eg. to drop the unused blocks of an updated file): it is
+//! written in a temporary file, renamed once complete.
+
+  SLOG("XSecSplLst", pNOTICE)
+    << "Merging " << inputs.size() << " binary spline files into: " << output;
+
+  vector<int>          fds;
+  vector<BinFileIndex> bins(inputs.size());
+  for(unsigned int f = 0; f < inputs.size(); f++) {
+    int fd = open(inputs[f].c_str(), O_RDONLY);
+    bool ok = (fd >= 0) && ReadBinIndex(fd, bins[f]) &&
+              bins[f].header.uselog == bins[0].header.uselog;
+    if(!ok) {
+      LOG("XSecSplLst", pERROR)
+        << "\nMissing, invalid or incompatible (log E knots?) binary file! "
+        << "[filename: " << inputs[f] << "]";
+      if(fd >= 0) close(fd);
+      CloseAll(fds);
+      return false;
+    }
+    fds.push_back(fd);
+  }
+
+  // the merged index & string table, and the source of each knot block
+  vector<BinIndexEntry>                  index;
+  vector< pair<unsigned int, uint32_t> > source;  // file, index entry
+  string                                 strings = "";
+  map<string, uint64_t>                  tune_offsets;
+  set< pair<string, string> >            merged;
+  for(unsigned int f = 0; f < bins.size(); f++) {
+    for(uint32_t i = 0; i < bins[f].header.nsplines; i++) {
+      string tune = bins[f].Tune(i);
+      string key  = bins[f].Key (i);
+      if(!merged.insert(pair<string, string>(tune, key)).second) continue;
+
+      map<string, uint64_t>::const_iterator t_iter = tune_offsets.find(tune);
+      if(t_iter == tune_offsets.end()) {
+        t_iter = tune_offsets.insert(
+           map<string, uint64_t>::value_type(tune, strings.size())).first;
+        strings += tune;
+      }
+      BinIndexEntry entry;
+      memset(&entry, 0, sizeof(BinIndexEntry));
+      entry.tune_offset = t_iter->second;
+      entry.tune_length = tune.size();
+      entry.key_offset  = strings.size();
+      entry.key_length  = key.size();
+      entry.nknots      = bins[f].index[i].nknots;
+      strings += key;
+      index .push_back(entry);
+      source.push_back(pair<unsigned int, uint32_t>(f, i));
+    }
+  }
+  BinHeader header;
+  BinLayout(header, index, strings.size(),
+            bins.size() > 0 && bins[0].header.uselog == 1);
+
+  string tmpfile = output + ".tmp";
+  int out = open(tmpfile.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  bool ok = (out >= 0);
+  if(ok) {
+    const char padding[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    ok = WriteFull(out, &header, sizeof(BinHeader), 0) &&
+         (index.size() == 0 ||
+          WriteFull(out, &index[0], index.size() * sizeof(BinIndexEntry),
+                    header.index_offset)) &&
+         WriteFull(out, strings.data(), strings.size(), header.strings_offset) &&
+         WriteFull(out, padding,
+                   header.data_offset - header.strings_offset - strings.size(),
+                   header.strings_offset + strings.size());
+    for(unsigned int i = 0; ok && i < index.size(); i++) {
+      const BinIndexEntry & from = bins[source[i].first].index[source[i].second];
+      ok = CopyBytes(fds[source[i].first], from.data_offset,
+                     out, index[i].data_offset,
+                     5 * sizeof(double) * (uint64_t) index[i].nknots);
+    }
+    ok = (close(out) == 0) && ok;
+  }
+  CloseAll(fds);
+
+  if(!ok || rename(tmpfile.c_str(), output.c_str()) != 0) {
+    SLOG("XSecSplLst", pERROR) << "Error while writing file = " << output;
+    unlink(tmpfile.c_str());
+    return false;
+  }
+
+  SLOG("XSecSplLst", pNOTICE)
+    << "Merged " << index.size() << " splines into: " << output;
+  return true;
+}
+//____________________________________________________________________________
+bool XSecSplineList::UpdateBinary(
+   const string & filename, const vector<string> & updates)
+{
+//! Replace the splines of a binary file by the ones (with the same tune &
+//! key) of the binary update files (the last update file with a given
+//! spline wins). Knot blocks with the same number of knots are overwritten
+//! in place, others are appended, and only the index entries of the splines
+//! moved and the header are rewritten. The file is rewritten by a merge if
+//! the updates add splines new to it.
+
+  SLOG("XSecSplLst", pNOTICE)
+    << "Updating binary spline file: " << filename
+    << " with " << updates.size() << " files";
+
+  int fd = open(filename.c_str(), O_RDWR);
+  BinFileIndex bin;
+  if(fd < 0 || !ReadBinIndex(fd, bin)) {
+    LOG("XSecSplLst", pERROR)
+      << "\nMissing or invalid binary file! [filename: " << filename << "]";
+    if(fd >= 0) close(fd);
+    return false;
+  }
+  map< pair<string, string>, uint32_t > entries;
+  for(uint32_t i = 0; i < bin.header.nsplines; i++) {
+    entries[ pair<string, string>(bin.Tune(i), bin.Key(i)) ] = i;
+  }
+
+  // the spline of the last update file for each tune & key
+  vector<int>          fds;
+  vector<BinFileIndex> upds(updates.size());
+  map< pair<string, string>, pair<unsigned int, uint32_t> > changes;
+  bool grow = false;
+  for(unsigned int u = 0; u < updates.size(); u++) {
+    int ufd = open(updates[u].c_str(), O_RDONLY);
+    bool ok = (ufd >= 0) && ReadBinIndex(ufd, upds[u]) &&
+              upds[u].header.uselog == bin.header.uselog;
+    if(!ok) {
+      LOG("XSecSplLst", pERROR)
+        << "\nMissing, invalid or incompatible (log E knots?) binary file! "
+        << "[filename: " << updates[u] << "]";
+      if(ufd >= 0) close(ufd);
+      CloseAll(fds);
+      close(fd);
+      return false;
+    }
+    fds.push_back(ufd);
+    for(uint32_t i = 0; i < upds[u].header.nsplines; i++) {
+      pair<string, string> id(upds[u].Tune(i), upds[u].Key(i));
+      changes[id] = pair<unsigned int, uint32_t>(u, i);
+      grow = grow || entries.count(id) == 0;
+    }
+  }
+
+  if(grow) {
+    // a larger index: rewrite the file, the updates taking precedence
+    CloseAll(fds);
+    close(fd);
+    SLOG("XSecSplLst", pNOTICE)
+      << "The updates add splines to: " << filename << " - Rewriting it";
+    vector<string> inputs(updates.rbegin(), updates.rend());
+    inputs.push_back(filename);
+    return MergeBinary(inputs, filename);
+  }
+
+  bool     ok        = true;
+  uint64_t end       = bin.header.file_size;
+  int      nreplaced = 0;
+  int      nmoved    = 0;
+  map< pair<string, string>, pair<unsigned int, uint32_t> >::const_iterator
+    c_iter = changes.begin();
+  for( ; ok && c_iter != changes.end(); ++c_iter) {
+    uint32_t                i    = entries[c_iter->first];
+    BinIndexEntry &         to   = bin.index[i];
+    const BinIndexEntry &   from = upds[c_iter->second.first].index[c_iter->second.second];
+    int                     ufd  = fds[c_iter->second.first];
+    uint64_t                size = 5 * sizeof(double) * (uint64_t) from.nknots;
+    if(from.nknots == to.nknots) {
+      ok = CopyBytes(ufd, from.data_offset, fd, to.data_offset, size);
+      nreplaced++;
+    } else {
+      // append the knots, then point the index entry at them
+      end = AlignTo8(end);
+      ok = CopyBytes(ufd, from.data_offset, fd, end, size);
+      to.nknots      = from.nknots;
+      to.data_offset = end;
+      end += size;
+      ok = ok && WriteFull(fd, &to, sizeof(BinIndexEntry),
+                   bin.header.index_offset + i * (uint64_t) sizeof(BinIndexEntry));
+      nmoved++;
+    }
+  }
+  if(ok && end != bin.header.file_size) {
+    bin.header.file_size = end;
+    ok = WriteFull(fd, &bin.header, sizeof(BinHeader), 0);
+  }
+  ok = ok && fsync(fd) == 0;
+  ok = (close(fd) == 0) && ok;
+  CloseAll(fds);
+
+  if(!ok) {
+    SLOG("XSecSplLst", pERROR) << "Error while updating file = " << filename;
+    return false;
+  }
+  SLOG("XSecSplLst", pNOTICE)
+    << "Updated " << nreplaced + nmoved << " splines of: " << filename
+    << " (" << nreplaced << " in place, " << nmoved << " appended)";
+  return true;
+}
+//____________________________________________________________________________
 string XSecSplineList::BuildSplineKey(
             const XSecAlgorithmI * alg, const Interaction * interaction) const
 {
@@ -569,6 +2218,8 @@ void XSecSplineList::Print(ostream & stream) const
   stream << "\n  |-----o  Spline Emin..............." << fNKnots;
   stream << "\n  |-----o  Spline Emax..............." << fEmin;
   stream << "\n  |-----o  Spline NKnots............." << fEmax;
+  stream << "\n  |-----o  Distinct splines stored...." << this->NDistinctSplines();
+  stream << "\n  |-----o  Estimated memory (MB)......." << this->ByteSize() / 1048576.;
   stream << "\n  |";
 
   map<string, map<string, Spline *> >::const_iterator mm_iter;
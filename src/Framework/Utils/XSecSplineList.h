@@ -5,6 +5,95 @@
 
 \brief    List of cross section vs energy splines
 
+          Splines can be built one at a time (CreateSpline()) or queued
+          (QueueSpline()) and built together (CreateQueuedSplines()). With
+          SetNThreads(n>1), the queued (spline, knot) integrations are spread
+          over n threads. The splines are then stored in queue order and each
+          knot is integrated with the knot energies of the serial mode, so
+          the result does not depend on the number of threads (for MC
+          integrators, provided counter-based random number streams are used:
+          each knot is then integrated with its own stream).
+
+          With SetKnotTolerance(tol>0), knots are placed adaptively: starting
+          from a coarse grid, each interval above threshold is checked by
+          integrating at its midpoint and is split in two if the cubic through
+          the current knots misses the midpoint cross section by more than
+          the relative tolerance. The requested number of knots is then the
+          maximum number of knots (integrations) per spline. Adaptive splines
+          are built serially, as soon as they are queued.
+
+          Besides XML, splines can be saved to / loaded from a binary file
+          (SaveAsBinary(), LoadFromBinary()): a header, an index of spline
+          keys and the contiguous knot arrays of all splines. The file is
+          memory-mapped read-only and the splines use the mapped knot arrays
+          directly, so that loading is fast and processes running on the
+          same node share the pages. Only the index is read at load time:
+          each spline is created the first time it is asked for.
+
+          A load filter (SetLoadFilter()) restricts the splines loaded from
+          either file format to the given probes and targets, eg to those
+          of a single-target job.
+
+          Spline look-ups by (algorithm, interaction) use a 64-bit hash of
+          the algorithm key and of the interaction (AlgId::KeyHash(),
+          Interaction::KeyHash()): the string key is only built the first
+          time a given hash is asked for in the current tune. String keys
+          are kept for the XML/binary I/O and the string-based methods.
+
+          Long spline building jobs can be checkpointed (SetCheckpointFile()):
+          every knot cross section is appended to the checkpoint file as soon
+          as it is computed. A job resumed from that file re-uses the knots
+          it finds in it, so that completed splines are rebuilt without any
+          integration and the spline in progress continues from its last
+          computed knot.
+
+          Knot integrals can be kept in a persistent integral cache
+          (SetIntegralCacheFile()), keyed by a hash of the full configuration
+          of the cross section algorithm and its sub-algorithms
+          (Algorithm::ConfigHash()), of the interaction and of the energy.
+          Unlike the checkpoint, the cache is independent of the tune name:
+          a tune variant that changes a single model only re-computes the
+          channels of that model.
+
+          Spline building can be split across jobs (SetShard(i,n)): the
+          knots of the queued splines are grouped in work units of a few
+          consecutive knots, numbered in queue order, and shard i only
+          computes the units u with u%n == i. Each shard writes its knots and
+          the full knot grid of every spline in a shard file (SaveShard()).
+          LoadFromShards() merges the n shard files back into splines, after
+          checking that all shards are present once, that they used the same
+          splines and knot grids, and that every knot was computed once.
+
+          Splines are stored once per distinct set of knots: a spline with
+          the same knots as an already stored one (typically the same channel
+          in several tunes sharing its model configuration) is replaced by
+          the stored, immutable, spline. Jobs loading several tunes (eg. for
+          comparisons) then take little more memory than for a single tune.
+
+          The spline look-ups, hits and insertions are counted per key prefix
+          (xsec_alg/xsec_config) and summarised, together with the estimated
+          memory taken by the splines of each prefix, by PrintUsage().
+
+          With SetCompactStorage(), the stored splines drop their TSpline3
+          and keep their contiguous coefficient arrays only (see
+          Spline::Compact()), evaluating as before, or in single precision
+          (to ~1E-7 relative), which takes 4-5 times less memory than the
+          default storage. Splines of mapped binary files use the mapped
+          knots in either case. Set it before generating events: splines
+          already stored are compacted at once.
+
+          Binary files can be merged and updated without loading their
+          splines: MergeBinary() streams the knot blocks of its inputs into
+          the output (the first input with a given tune & key wins), taking
+          memory for the indices only. UpdateBinary() replaces in place the
+          splines of a file by the ones of the update files: a knot block
+          with an unchanged number of knots is overwritten, an other one is
+          appended at the end of the file and only the index entries of the
+          changed splines (and the header) are rewritten. Splines new to the
+          file need a larger index: the file is then rewritten by a merge.
+          Blocks left unused by appended splines are dropped by any merge.
+          Do not update a file while jobs use (map) it.
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -19,15 +108,20 @@
 #define _XSEC_SPLINE_LIST_H_
 
 #include <ostream>
+#include <fstream>
 #include <map>
 #include <set>
 #include <vector>
 #include <string>
+#include <unordered_map>
+
+#include <Rtypes.h>
 
 #include "Framework/Conventions/XmlParserStatus.h"
 
 using std::map;
 using std::set;
+using std::unordered_map;
 using std::pair;
 using std::vector;
 using std::string;
@@ -42,6 +136,19 @@ class Spline;
 class XSecSplineList;
 ostream & operator << (ostream & stream, const XSecSplineList & xsl);
 
+//! Use of the splines of a cross section algorithm configuration
+struct XSecSplineUsage {
+  XSecSplineUsage();
+
+  string   prefix;    ///< spline key prefix: xsec_alg/xsec_config
+  Long64_t nlookups;  ///< spline look-ups
+  Long64_t nhits;     ///< look-ups finding a spline
+  Long64_t ninserts;  ///< splines built or loaded
+  int      nsplines;  ///< splines stored, over all tunes (shared ones counted once)
+  size_t   nbytes;    ///< estimated memory taken by those splines (bytes)
+  size_t   nmapped;   ///< knot data of those splines in mapped binary files (bytes)
+};
+
 class XSecSplineList {
 
 public:
@@ -52,6 +159,25 @@ public:
   void               SaveAsXml   (const string & filename, bool save_init = true) const;
   XmlParserStatus_t  LoadFromXml (const string & filename, bool keep = false);
 
+  // Save/load to/from binary (memory-mapped) file
+  void               SaveAsBinary   (const string & filename, bool save_init = true) const;
+  XmlParserStatus_t  LoadFromBinary (const string & filename, bool keep = false);
+  static bool        IsBinaryFile   (const string & filename);
+
+  // Merge binary files into one, or replace / add the splines of the update
+  // files in a binary file, copying knot blocks between the files without
+  // loading any spline (see below)
+  static bool        MergeBinary    (const vector<string> & inputs,
+                                     const string & output);
+  static bool        UpdateBinary   (const string & filename,
+                                     const vector<string> & updates);
+
+  // Only load splines for the given probe and target PDG codes (an empty
+  // set accepts any). Splines whose key has no probe/target are always loaded.
+  void   SetLoadFilter   (const set<int> & probes, const set<int> & targets);
+  void   ClearLoadFilter (void);
+  bool   PassesLoadFilter(const string & spline_key) const;
+
   // Print available splines
   void   Print (ostream & stream) const;
   friend ostream & operator << (ostream & stream, const XSecSplineList & xsl);
@@ -59,7 +185,7 @@ public:
   // Set and query current tune.
   // An XSecSplineList can keep splines for numerous tunes and pick the appropriate
   // one for each process, as instructed.
-  void   SetCurrentTune (const string & tune) { fCurrentTune = tune; }
+  void   SetCurrentTune (const string & tune);
   string CurrentTune    (void) const  { return fCurrentTune; }
   bool   HasSplineFromTune( const string & tune ) const { return fSplineMap.count(tune) > 0 ; }
 
@@ -71,8 +197,41 @@ public:
   const Spline * GetSpline    (string spline_key) const;
   void           CreateSpline (const XSecAlgorithmI * alg, const Interaction * i,
                                int nknots = -1, double e_min = -1, double e_max = -1);
+  void           QueueSpline  (const XSecAlgorithmI * alg, const Interaction * i,
+                               int nknots = -1, double e_min = -1, double e_max = -1);
+  void           CreateQueuedSplines (void);
+
+  // Checkpoint every computed knot to a file. With resume = true, the knots
+  // already in the file are read and re-used, and new knots are appended.
+  bool   SetCheckpointFile   (const string & filename, bool resume = false);
+  void   CloseCheckpointFile (void);
+
+  // Keep the knot integrals in a persistent cache: the integrals found in
+  // the file are re-used and any new ones are appended.
+  bool   SetIntegralCacheFile   (const string & filename);
+  void   CloseIntegralCacheFile (void);
+
+  // Distributed spline building: only compute the knots of shard i (of n),
+  // save them in a shard file, and merge all shard files into splines
+  void   SetShard       (unsigned int i, unsigned int n);
+  bool   SaveShard      (const string & filename) const;
+  bool   LoadFromShards (const vector<string> & filenames);
+  static bool IsShardFile (const string & filename);
   int  NSplines (void) const;
   bool IsEmpty  (void) const;
+  int  NDistinctSplines (void) const; ///< spline objects stored, over all tunes
+
+  //! Spline look-up statistics (for the job monitoring): hashed look-ups,
+  //! those not found in the hashed index (string key built), and splines
+  //! created from a mapped file on first access
+  void LookupStats (Long64_t & nlookups, Long64_t & nmisses, Long64_t & nloads) const;
+
+  //! Spline usage per key prefix, the prefixes whose splines take the most
+  //! memory first, the estimated memory taken by all splines (bytes), and
+  //! the usage summary of (at most) the first nmax prefixes
+  vector<XSecSplineUsage> Usage (void) const;
+  size_t ByteSize   (void) const;
+  void   PrintUsage (ostream & stream, unsigned int nmax = 20) const;
 
   // Methods for building / getting keys
   // The results of the following methods depend on the current tune setting
@@ -85,6 +244,12 @@ public:
   void   SetNKnots (int    nk); ///< set default number of knots for building the spline
   void   SetMinE   (double Ev); ///< set default minimum energy for xsec splines
   void   SetMaxE   (double Ev); ///< set default maximum energy for xsec splines
+  void   SetNThreads (unsigned int n); ///< set number of threads for building queued splines
+  void   SetKnotTolerance (double tol); ///< set rel. tolerance for adaptive knot placement (<=0: off)
+  double KnotTolerance (void) const { return fKnotTol; }
+  void   SetCompactStorage (bool on, bool single_precision = false); ///< compact spline storage (see Spline::Compact())
+  bool   CompactStorage    (void) const { return fCompact; }
+  unsigned int NThreads (void) const { return fNThreads; }
   bool   UseLogE   (void) const { return fUseLogE;  }
   int    NKnots    (void) const { return fNKnots;   }
   double Emin      (void) const { return fEmin;     }
@@ -98,6 +263,54 @@ private:
 
   static XSecSplineList * fInstance;
 
+  //! A queued spline: knot energies and cross sections
+  struct SplineTask {
+    string                 fKey;
+    const XSecAlgorithmI * fAlg;
+    Interaction *          fInteraction; ///< owned copy of the input interaction
+    vector<double>         fE;
+    vector<double>         fXSec;
+    vector<bool>           fCompute;     ///< knots computed by this job (all, unless sharding)
+    long int               fFirstKnot;   ///< global index of the first knot, over all queued splines
+  };
+
+  void   KnotEnergies (const Interaction * i, int nknots, double e_min, double e_max,
+                       vector<double> & E) const;
+  double KnotXSec     (const string & key, const XSecAlgorithmI * alg,
+                       const Interaction * i, double E) const;
+  bool   CheckpointedXSec (const string & key, double E, double & xsec) const;
+  bool   CachedIntegral   (ULong64_t hash, double E, double & xsec) const;
+  void   CacheIntegral    (ULong64_t hash, double E, double xsec) const;
+  void   AdaptiveKnots(const string & key, const XSecAlgorithmI * alg, const Interaction * i,
+                       int nknots, double e_min, double e_max,
+                       vector<double> & E, vector<double> & xsec) const;
+  void   AddSpline    (const string & key, const vector<double> & E, const vector<double> & xsec);
+  void   InsertSpline (const string & tune, const string & key, Spline * spline);
+  Spline * Materialize (const string & tune, const string & key, Spline * spline) const;
+  Spline * ShareSpline (Spline * spline) const;
+  Spline ** FindSpline (const XSecAlgorithmI * alg, const Interaction * i) const;
+  void   CountLookup  (const XSecAlgorithmI * alg, bool hit) const;
+  void   CountLookup  (const string & key, bool hit) const;
+  void   CountInsert  (const string & key) const;
+  void   ClearSplines (void);
+
+  vector<SplineTask> fQueue; ///< splines waiting for CreateQueuedSplines()
+  unsigned int       fNThreads;
+  double             fKnotTol;  ///< rel. tolerance for adaptive knot placement (<=0: off)
+  bool               fCompact;        ///< compact the stored splines?
+  bool               fCompactSingle;  ///< ... in single precision?
+
+  std::ofstream *    fCheckpoint;       ///< checkpoint file (0 if not checkpointing)
+  std::ofstream *    fIntegralCache;    ///< integral cache file (0 if not caching)
+  mutable map<ULong64_t, map<double, double> > fCachedIntegrals; ///< config/interaction hash -> { E -> xsec }
+
+  unsigned int       fShard;            ///< shard computed by this job
+  unsigned int       fNShards;          ///< number of shards (1: no sharding)
+  unsigned int       fShardUnit;        ///< next work unit number (over all queued splines so far)
+  long int           fNQueuedKnots;     ///< number of knots queued so far
+  vector<SplineTask> fShardTasks;       ///< partly computed splines of this shard
+  map<string, map<double, double> > fCheckpointKnots; ///< tune/key -> { E -> xsec } read from the checkpoint file
+
   bool   fUseLogE;
   int    fNKnots;
   double fEmin;
@@ -105,8 +318,22 @@ private:
 
   string fCurrentTune; ///< The `active' tune, out the many that can co-exist
 
-  map<string, map<string, Spline *> > fSplineMap;       ///< tune -> { xsec_alg/xsec_config/interaction -> Spline }
+  //! Knots of a spline of a mapped binary file, not yet asked for
+  struct MappedSpline {
+    int            fNKnots;
+    const double * fKnots;
+  };
+
+  mutable map<string, map<string, Spline *> > fSplineMap; ///< tune -> { xsec_alg/xsec_config/interaction -> Spline (0 until first accessed, for binary files) }
+  map<string, map<string, MappedSpline> > fMappedSplines;  ///< tune -> { xsec_alg/xsec_config/interaction -> knots in mapped file }
+  mutable unordered_map<ULong64_t, Spline **> fKeyIndex;  ///< hash(alg, interaction) -> spline slot in fSplineMap for the current tune (0 if none)
+  mutable unordered_map<ULong64_t, vector<Spline *> > fSplineStore; ///< hash of the knots -> distinct splines with these knots (shared by all tunes)
+  mutable map<string, XSecSplineUsage> fUsage;                      ///< key prefix -> spline use counters
+  mutable unordered_map<ULong64_t, XSecSplineUsage *> fUsageIndex;  ///< hash of the xsec algorithm key -> its entry in fUsage
+  set<int>                                fFilterProbes;   ///< load filter: probe PDG codes
+  set<int>                                fFilterTargets;  ///< load filter: target PDG codes
   map<string, set<string>           > fLoadedSplineSet; ///< tune -> { set of initialy loaded splines             }
+  vector< pair<void *, size_t> >       fMappedFiles;     ///< memory-mapped binary spline files (address, size)
 
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
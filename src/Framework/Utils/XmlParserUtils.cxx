@@ -48,6 +48,63 @@ string genie::utils::xml::GetAttribute(xmlNodePtr xml_cur, string attr_name)  {
   return str;
 }
 
+//_________________________________________________________________________
+string genie::utils::xml::GetAttribute(
+                         xmlTextReaderPtr reader, string attr_name)  {
+  xmlChar * xmls = xmlTextReaderGetAttribute(
+                         reader, (const xmlChar *) attr_name.c_str());
+  if(!xmls) return "";
+  string str = TrimSpaces(xmls);
+  xmlFree(xmls);
+  return str;
+}
+
+//_________________________________________________________________________
+int genie::utils::xml::ReadKnots(xmlTextReaderPtr reader,
+     const char * xtag, const char * ytag, vector<double> & x, vector<double> & y)
+{
+  int nknots = atoi( GetAttribute(reader, "nknots").c_str() );
+  if(nknots < 0) nknots = 0;
+  x.assign(nknots, 0.);
+  y.assign(nknots, 0.);
+
+  if(xmlTextReaderIsEmptyElement(reader)) return 0;
+
+  int      depth  = xmlTextReaderDepth(reader); // of <spline>
+  int      iknot  = 0;
+  double * target = 0;  // where the text of the current element goes
+  int      ret    = 0;
+
+  while( (ret = xmlTextReaderRead(reader)) == 1 ) {
+    int type = xmlTextReaderNodeType(reader);
+    if(type == XML_READER_TYPE_ELEMENT) {
+      const xmlChar * name = xmlTextReaderConstLocalName(reader);
+      target = 0;
+      if(iknot < nknots) {
+        if     (xmlStrEqual(name, (const xmlChar *) xtag)) target = &x[iknot];
+        else if(xmlStrEqual(name, (const xmlChar *) ytag)) target = &y[iknot];
+      }
+    }
+    else if(type == XML_READER_TYPE_TEXT) {
+      if(!target) continue;
+      const char * text = (const char *) xmlTextReaderConstValue(reader);
+      char * end = 0;
+      double value = strtod(text, &end);
+      if(end != text) *target = value;
+      target = 0;
+    }
+    else if(type == XML_READER_TYPE_END_ELEMENT) {
+      target = 0;
+      if(xmlTextReaderDepth(reader) == depth) break; // </spline>
+      if(xmlStrEqual(xmlTextReaderConstLocalName(reader),
+                     (const xmlChar *) "knot")) iknot++;
+    }
+  }
+  if(ret != 1) return -1;
+
+  return iknot;
+}
+
 
 //_________________________________________________________________________
 string genie::utils::xml::GetXMLPathList( bool add_tune )   {
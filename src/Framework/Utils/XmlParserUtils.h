@@ -27,6 +27,7 @@
 #if !defined(__CINT__) && !defined(__MAKECINT__)
 #include "libxml/parser.h"
 #include "libxml/xmlmemory.h"
+#include "libxml/xmlreader.h"
 #endif
 
 #include <TSystem.h>
@@ -64,6 +65,25 @@ namespace xml   {
   //_________________________________________________________________________
 
   string GetAttribute(xmlNodePtr xml_cur, string attr_name) ;
+
+  //_________________________________________________________________________
+  // Streaming (pull) reading of large XML files, such as the cross section
+  // spline files, without building the DOM tree: a xmlTextReader walks the
+  // file and node names & text are looked at in place (no copies, no space
+  // trimming), with numeric text converted straight into preallocated arrays.
+  //
+  // GetAttribute() returns the (trimmed) attribute of the element the reader
+  // is at. ReadKnots() must be called with the reader at a spline element
+  //   <spline name="..." nknots="N">
+  //     <knot> <E> x0 </E> <xsec> y0 </xsec> </knot> ...
+  //   </spline>
+  // (the knot x,y tag names are given) and reads it to its end element. The
+  // x,y arrays are resized to nknots (their memory is reused from one spline
+  // to the next). Returns the number of knots read, or -1 if parsing failed.
+
+  string GetAttribute (xmlTextReaderPtr reader, string attr_name) ;
+  int    ReadKnots    (xmlTextReaderPtr reader, const char * xtag, const char * ytag,
+                       vector<double> & x, vector<double> & y) ;
 #endif
 
   //_________________________________________________________________________
@@ -57,6 +57,8 @@ DMDISKinematicsGenerator::~DMDISKinematicsGenerator()
 //___________________________________________________________________________
 void DMDISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 {
+  StatsScope stats(this, evrec);
+
   if(fGenerateUniformly) {
     LOG("DMDISKinematics", pNOTICE)
           << "Generating kinematics uniformly over the allowed phase space";
@@ -140,7 +142,7 @@ void DMDISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
         << " (Q2 = " << interaction->KinePtr()->Q2() << ")";
 
      //-- compute the cross section for current kinematics
-     xsec = fXSecModel->XSec(interaction, kPSxyfE);
+     xsec = this->XSec(interaction, kPSxyfE);
 
      //-- decide whether to accept the current kinematics
      if(!fGenerateUniformly) {
@@ -299,7 +301,7 @@ double DMDISKinematicsGenerator::ComputeMaxXSec(
         interaction->KinePtr()->Setx(gx);
         kinematics::UpdateWQ2FromXY(interaction);
 
-        double xsec = fXSecModel->XSec(interaction, kPSxyfE);
+        double xsec = this->XSec(interaction, kPSxyfE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
         LOG("DMDISKinematics", pINFO) 
                 << "xsec(y=" << gy << ", x=" << gx << ") = " << xsec;
@@ -325,7 +327,7 @@ double DMDISKinematicsGenerator::ComputeMaxXSec(
    	     gx = gx - dxn;
              interaction->KinePtr()->Setx(gx);
              kinematics::UpdateWQ2FromXY(interaction);
-             xsec = fXSecModel->XSec(interaction, kPSxyfE);
+             xsec = this->XSec(interaction, kPSxyfE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
              LOG("DMDISKinematics", pINFO) 
                 << "xsec(y=" << gy << ", x=" << gx << ") = " << xsec;
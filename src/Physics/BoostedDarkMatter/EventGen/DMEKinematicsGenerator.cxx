@@ -56,6 +56,8 @@ DMEKinematicsGenerator::~DMEKinematicsGenerator()
 //___________________________________________________________________________
 void DMEKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 {
+  StatsScope stats(this, evrec);
+
   if(fGenerateUniformly) {
     LOG("DMEKinematics", pNOTICE)
           << "Generating kinematics uniformly over the allowed phase space";
@@ -109,7 +111,7 @@ void DMEKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      LOG("DMEKinematics", pINFO) << "Trying: y = " << y;
 
      //-- computing cross section for the current kinematics
-     xsec = fXSecModel->XSec(interaction, kPSyfE);
+     xsec = this->XSec(interaction, kPSyfE);
 
      //-- decide whether to accept the current kinematics
      if(!fGenerateUniformly) {
@@ -181,7 +183,7 @@ double DMEKinematicsGenerator::ComputeMaxXSec(
   for(int i=0; i<N; i++) {
     double y = ymin + i * dy;
     interaction->KinePtr()->Sety(y);
-    double xsec = fXSecModel->XSec(interaction, kPSyfE);
+    double xsec = this->XSec(interaction, kPSyfE);
 
     SLOG("DMEKinematics", pDEBUG) << "xsec(y = " << y << ") = " << xsec;
     max_xsec = TMath::Max(xsec, max_xsec);
@@ -198,7 +200,7 @@ double DMEKinematicsGenerator::ComputeMaxXSec(
 	 y = y-dy;
          if(y<ymin) break;
          interaction->KinePtr()->Sety(y);
-         xsec = fXSecModel->XSec(interaction, kPSyfE);
+         xsec = this->XSec(interaction, kPSyfE);
          SLOG("DMEKinematics", pDEBUG) << "xsec(y = " << y << ") = " << xsec;
          max_xsec = TMath::Max(xsec, max_xsec);
        }
@@ -66,6 +66,8 @@ DMELEventGenerator::~DMELEventGenerator()
 //___________________________________________________________________________
 void DMELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
 {
+    StatsScope stats(this, evrec);
+
     LOG("DMELEvent", pDEBUG) << "Generating QE event kinematics...";
 
     // Get the random number generators
@@ -190,6 +192,7 @@ void DMELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
         LOG("DMELEvent", pDEBUG) << "cth0 = " << costheta << ", phi0 = " << phi;
         double xsec = genie::utils::ComputeFullDMELPXSec(interaction, fNuclModel,
           fXSecModel, costheta, phi, fEb, fHitNucleonBindingMode, fMinAngleEM, false);
+        this->CountXSec();
 
         // select/reject event
         this->AssertXSecLimits(interaction, xsec, xsec_max);
@@ -492,6 +495,7 @@ double DMELEventGenerator::ComputeMaxXSec(const Interaction * in) const
                   // BindHitNucleon() above
                   double xs = genie::utils::ComputeFullDMELPXSec(interaction,
                     fNuclModel, fXSecModel, costh, phi, dummy_Eb, kOnShell, fMinAngleEM, false);
+                  this->CountXSec();
 
                   if (xs > this_nuc_xsec_max){
                       phi_at_xsec_max = phi;
@@ -57,6 +57,8 @@ DMELKinematicsGenerator::~DMELKinematicsGenerator()
 //___________________________________________________________________________
 void DMELKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 {
+  StatsScope stats(this, evrec);
+
   if(fGenerateUniformly) {
     LOG("DMELKinematics", pNOTICE)
           << "Generating kinematics uniformly over the allowed phase space";
@@ -151,7 +153,7 @@ void DMELKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      LOG("DMELKinematics", pINFO) << "Trying: Q^2 = " << gQ2;
 
      //-- Computing cross section for the current kinematics
-     xsec = fXSecModel->XSec(interaction, kPSQ2fE);
+     xsec = this->XSec(interaction, kPSQ2fE);
 
      //-- Decide whether to accept the current kinematics
      if(!fGenerateUniformly) {
@@ -374,7 +376,7 @@ void DMELKinematicsGenerator::SpectralFuncExperimentalCode(
      interaction->KinePtr()->SetQ2(gQ2tilde);
 
      //-- Computing cross section for the current kinematics
-     xsec = fXSecModel->XSec(interaction, kPSQ2fE);
+     xsec = this->XSec(interaction, kPSQ2fE);
 
      //-- Decide whether to accept the current kinematics
 //     if(!fGenerateUniformly) {
@@ -501,7 +503,7 @@ double DMELKinematicsGenerator::ComputeMaxXSec(
   for(int i=0; i<N; i++) {
      double Q2 = TMath::Exp(logQ2min + i * dlogQ2);
      interaction->KinePtr()->SetQ2(Q2);
-     double xsec = fXSecModel->XSec(interaction, kPSQ2fE);
+     double xsec = this->XSec(interaction, kPSQ2fE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
      LOG("DMELKinematics", pDEBUG)  << "xsec(Q2= " << Q2 << ") = " << xsec;
 #endif
@@ -518,7 +520,7 @@ double DMELKinematicsGenerator::ComputeMaxXSec(
 	 Q2 = TMath::Exp(TMath::Log(Q2) - dlogQ2);
          if(Q2 < rQ2.min) continue;
          interaction->KinePtr()->SetQ2(Q2);
-         xsec = fXSecModel->XSec(interaction, kPSQ2fE);
+         xsec = this->XSec(interaction, kPSQ2fE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
          LOG("DMELKinematics", pDEBUG)  << "xsec(Q2= " << Q2 << ") = " << xsec;
 #endif
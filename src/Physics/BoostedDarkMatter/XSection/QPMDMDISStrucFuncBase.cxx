@@ -1,543 +1,788 @@
-//____________________________________________________________________________
-/*
- Copyright (c) 2003-2020, The GENIE Collaboration
- For the full text of the license visit http://copyright.genie-mc.org
- 
-
- Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
- University of Liverpool & STFC Rutherford Appleton Laboratory
-
-         This GENIE code was adapted from the neugen3 code co-authored by
-         Donna Naples (Pittsburgh U.), Hugh Gallagher (Tufts U), and 
-         Costas Andreopoulos (RAL)
-
-         A fix was installed (Aug 12, 2014) by Brian Tice (Rochester) so that 
-         the nuclear modification to the pdf should be calculated in terms 
-         of the experimental x, not the rescaled x. The same goes for R(x,Q2).
-
-         A fix of the scaling variable used for the relations between structure
-         functions was installed by C. Bronner and J. Morrison Jun 06, 2016
-         after it was confirmed by A. Bodek that x and not the modified 
-         scaling variable should be used there.
-
-         Changes required to implement the GENIE Boosted Dark Matter module
-         were installed by Josh Berger (Univ. of Wisconsin)
-*/
-//____________________________________________________________________________
-
-#include <TMath.h>
-
-#include "Framework/Algorithm/AlgConfigPool.h"
-#include "Framework/Conventions/GBuild.h"
-#include "Framework/Conventions/Constants.h"
-#include "Framework/Conventions/RefFrame.h"
-#include "Framework/Messenger/Messenger.h"
-#include "Physics/BoostedDarkMatter/XSection/QPMDMDISStrucFuncBase.h"
-#include "Physics/PartonDistributions/PDFModelI.h"
-#include "Framework/ParticleData/PDGUtils.h"
-#include "Framework/Utils/KineUtils.h"
-#include "Physics/NuclearState/NuclearUtils.h"
-#include "Framework/Utils/PhysUtils.h"
-
-using namespace genie;
-using namespace genie::constants;
-
-//____________________________________________________________________________
-QPMDMDISStrucFuncBase::QPMDMDISStrucFuncBase() :
-DISStructureFuncModelI()
-{
-  this->InitPDF();
-}
-//____________________________________________________________________________
-QPMDMDISStrucFuncBase::QPMDMDISStrucFuncBase(string name) :
-DISStructureFuncModelI(name)
-{
-  this->InitPDF();
-}
-//____________________________________________________________________________
-QPMDMDISStrucFuncBase::QPMDMDISStrucFuncBase(string name, string config):
-DISStructureFuncModelI(name, config)
-{
-  this->InitPDF();
-}
-//____________________________________________________________________________
-QPMDMDISStrucFuncBase::~QPMDMDISStrucFuncBase()
-{
-  delete fPDF;
-  delete fPDFc;
-}
-//____________________________________________________________________________
-void QPMDMDISStrucFuncBase::Configure(const Registry & config)
-{
-  Algorithm::Configure(config);
-  this->LoadConfig();
-}
-//____________________________________________________________________________
-void QPMDMDISStrucFuncBase::Configure(string param_set)
-{
-  Algorithm::Configure(param_set);
-  this->LoadConfig();
-}
-//____________________________________________________________________________
-void QPMDMDISStrucFuncBase::LoadConfig(void)
-{
-  LOG("DISSF", pDEBUG) << "Loading configuration...";
-
-  //-- pdf
-  const PDFModelI * pdf_model =
-         dynamic_cast<const PDFModelI *> (this->SubAlg("PDF-Set"));
-  fPDF  -> SetModel(pdf_model);
-  fPDFc -> SetModel(pdf_model);
-
-  //-- charm mass
-  GetParam( "Charm-Mass", fMc ) ;
-
-  //-- min Q2 for PDF evaluation
-  GetParam( "PDF-Q2min", fQ2min ) ;
-
-  //-- include R (~FL)?
-  GetParam( "IncludeR", fIncludeR ) ;
-
-  //-- include nuclear factor (shadowing / anti-shadowing / ...)
-  GetParam( "IncludeNuclMod", fIncludeNuclMod ) ;
-
-  //-- Use 2016 SF relation corrections
-  GetParam( "Use2016Corrections", fUse2016Corrections ) ;
-
-  //-- Set min for relation between 2xF1 and F2
-  GetParam( "LowQ2CutoffF1F2", fLowQ2CutoffF1F2 ) ;
-
-  //-- turn charm production off?
-  GetParamDef( "Charm-Prod-Off", fCharmOff, false ) ;
-
-  //-- dark matter couplings
-  GetParam( "UpLeftCharge", fQuL );
-  GetParam( "UpRightCharge", fQuR );
-  GetParam( "CharmLeftCharge", fQcL );
-  GetParam( "CharmRightCharge", fQcR );
-  GetParam( "DownLeftCharge", fQdL );
-  GetParam( "DownRightCharge", fQdR );
-  GetParam( "StrangeLeftCharge", fQsL );
-  GetParam( "StrangeRightCharge", fQsR );
-
-  LOG("DISSF", pDEBUG) << "Done loading configuration";
-}
-//____________________________________________________________________________
-void QPMDMDISStrucFuncBase::InitPDF(void)
-{
-                     // evaluated at:
-  fPDF  = new PDF(); //   x = computed (+/-corrections) scaling var, Q2
-  fPDFc = new PDF(); //   x = computed charm slow re-scaling var,    Q2
-}
-//____________________________________________________________________________
-void QPMDMDISStrucFuncBase::Calculate(const Interaction * interaction) const
-{
-  // Reset mutable members
-  fF1 = 0;
-  fF2 = 0;
-  fF3 = 0;
-  fF4 = 0;
-  fF5 = 0;
-  fF6 = 0;
-
-  // Get process info & perform various checks
-  const ProcessInfo &  proc_info  = interaction->ProcInfo();
-  const InitialState & init_state = interaction->InitState();
-  const Target & tgt = init_state.Tgt();
-
-  int  nuc_pdgc    = tgt.HitNucPdg();
-  int  probe_pdgc  = init_state.ProbePdg();
-  bool is_p        = pdg::IsProton       ( nuc_pdgc    );
-  bool is_n        = pdg::IsNeutron      ( nuc_pdgc    );
-  bool is_dm       = pdg::IsDarkMatter   ( probe_pdgc  );
-  bool is_dmb      = pdg::IsAntiDarkMatter   ( probe_pdgc  );
-  bool is_dmi      = proc_info.IsDarkMatter();
-
-  if ( !is_dm && !is_dmb    ) return;
-  if ( !is_p && !is_n       ) return;
-  if ( tgt.N() == 0 && is_n ) return;
-  if ( tgt.Z() == 0 && is_p ) return;
-
-  // Flags switching on/off quark contributions so that this algorithm can be 
-  // used for both l + N -> l' + X, and l + q -> l' + q' level calculations
-
-  double switch_uv    = 1.;
-  double switch_us    = 1.;
-  double switch_ubar  = 1.;
-  double switch_dv    = 1.;
-  double switch_ds    = 1.;
-  double switch_dbar  = 1.;
-  double switch_s     = 1.;
-  double switch_sbar  = 1.;
-  double switch_c     = 1.;
-  double switch_cbar  = 1.;
-
-  if(tgt.HitQrkIsSet()) {
-
-     switch_uv    = 0.;
-     switch_us    = 0.;
-     switch_ubar  = 0.;
-     switch_dv    = 0.;
-     switch_ds    = 0.;
-     switch_dbar  = 0.;
-     switch_s     = 0.;
-     switch_sbar  = 0.;
-     switch_c     = 0.;
-     switch_cbar  = 0.;
-
-     int  qpdg = tgt.HitQrkPdg();
-     bool sea  = tgt.HitSeaQrk();
-
-     bool is_u    = pdg::IsUQuark     (qpdg);
-     bool is_ubar = pdg::IsAntiUQuark (qpdg);
-     bool is_d    = pdg::IsDQuark     (qpdg);
-     bool is_dbar = pdg::IsAntiDQuark (qpdg);
-     bool is_s    = pdg::IsSQuark     (qpdg);
-     bool is_sbar = pdg::IsAntiSQuark (qpdg);
-     bool is_c    = pdg::IsCQuark     (qpdg);
-     bool is_cbar = pdg::IsAntiCQuark (qpdg);
-
-     if      (!sea && is_u   ) { switch_uv   = 1; }
-     else if ( sea && is_u   ) { switch_us   = 1; }
-     else if ( sea && is_ubar) { switch_ubar = 1; }
-     else if (!sea && is_d   ) { switch_dv   = 1; }
-     else if ( sea && is_d   ) { switch_ds   = 1; }
-     else if ( sea && is_dbar) { switch_dbar = 1; }
-     else if ( sea && is_s   ) { switch_s    = 1; }
-     else if ( sea && is_sbar) { switch_sbar = 1; }
-     else if ( sea && is_c   ) { switch_c    = 1; }
-     else if ( sea && is_cbar) { switch_cbar = 1; }
-     else return;
-
-  }
-
-  // Compute PDFs [both at (scaling-var,Q2) and (slow-rescaling-var,Q2)
-  // Applying all PDF K-factors abd scaling variable corrections
-
-  this -> CalcPDFs (interaction);
-
-  //
-  // Compute structure functions for the EM, NC and CC cases
-  //
-
-  double F2val=0, xF3val=0;
-
-  // ***  DARK MATTER
-  if(is_dmi) {
-
-    if(!is_dm && !is_dmb) return;
-
-    double gvu  = 0.5 * (fQuL  + fQuR);
-    double gau  = 0.5 * (fQuL  - fQuR);
-    double gvc  = 0.5 * (fQcL  + fQcR);
-    double gac  = 0.5 * (fQcL  - fQcR);
-    double gvd  = 0.5 * (fQdL  + fQdR);
-    double gad  = 0.5 * (fQdL  - fQdR);
-    double gvs  = 0.5 * (fQsL  + fQsR);
-    double gas  = 0.5 * (fQsL  - fQsR);
-    double gvu2 = TMath::Power(gvu, 2.);
-    double gau2 = TMath::Power(gau, 2.);
-    double gvc2 = TMath::Power(gvc, 2.);
-    double gac2 = TMath::Power(gac, 2.);
-    double gvd2 = TMath::Power(gvd, 2.);
-    double gad2 = TMath::Power(gad, 2.);
-    double gvs2 = TMath::Power(gvs, 2.);
-    double gas2 = TMath::Power(gas, 2.);
-
-    double q2   = 4.0 * ((switch_uv   * fuv + switch_us   * fus) * (gvu2+gau2) + switch_c    * fc  * (gvc2+gac2) + 
-			 (switch_dv   * fdv + switch_ds   * fds) * (gvd2+gad2) + switch_s    * fs  * (gvs2+gas2));
-    double q3   = 4.0 * ((switch_uv   * fuv + switch_us   * fus) * (2*gvu*gau) + switch_c    * fc  * (2*gvc*gac) + 
-			 (switch_dv   * fdv + switch_ds   * fds) * (2*gvd*gad) + switch_s    * fs  * (2*gvs*gas));
-
-    double qb2  = 4.0 * (switch_ubar * fus * (gvu2+gau2) + switch_cbar * fc  * (gvc2+gac2) + 
-			 switch_dbar * fds * (gvd2+gad2) + switch_sbar * fs  * (gvs2+gas2));    
-    double qb3  = 4.0 * (switch_ubar * fus * (2*gvu*gau) + switch_cbar * fc  * (2*gvc*gac) + 
-			 switch_dbar * fds * (2*gvd*gad) + switch_sbar * fs  * (2*gvs*gas));    
- 
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-    LOG("DISSF", pINFO) << "f2 : q = " << q2 << ", bar{q} = " << qb2;
-    LOG("DISSF", pINFO) << "xf3: q = " << q3 << ", bar{q} = " << qb3;
-#endif
-
-    F2val  = q2+qb2;
-    xF3val = q3-qb3;
-  } 
-
-  double Q2val = this->Q2        (interaction);
-  double x     = this->ScalingVar(interaction);
-  double f     = this->NuclMod   (interaction); // nuclear modification
-  double r     = this->R         (interaction); // R ~ FL
-
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("DISSF", pDEBUG) << "Nucl. mod   = " << f;
-  LOG("DISSF", pDEBUG) << "R(=FL/2xF1) = " << r;
-#endif
-
-  if(fUse2016Corrections) {
-    //It was confirmed by A.Bodek that the modified scaling variable
-    //should just be used to compute the strucure functions F2 and xF3,
-    //but that the usual Bjorken x should be used for the relations
-    //between the structure functions.
-    //For the same reason remove the freezing of Q2 at 0.8 for those relations,
-    //although it has not been explicitly asked to A.Bodek if it should be done.
-
-    const Kinematics & kinematics = interaction->Kine();
-    double bjx = kinematics.x();
-    
-    double a = TMath::Power(bjx,2.) / TMath::Max(Q2val, fLowQ2CutoffF1F2);
-    double c = (1. + 4. * kNucleonMass2 * a) / (1.+r);
-
-    fF3 = f * xF3val/bjx;
-    fF2 = f * F2val;
-    fF1 = fF2 * 0.5*c/bjx;
-    fF5 = fF2/bjx;           // Albright-Jarlskog relation
-    fF4 = 0.;                // Nucl.Phys.B 84, 467 (1975)
-  } 
-  else {
-    double a = TMath::Power(x,2.) / TMath::Max(Q2val, fLowQ2CutoffF1F2);
-    double c = (1. + 4. * kNucleonMass2 * a) / (1.+r);
-    //double a = TMath::Power(x,2.) / Q2val;
-    //double c = (1. + 4. * kNucleonMass * a) / (1.+r);
-
-    fF3 = f * xF3val / x;
-    fF2 = f * F2val;
-    fF1 = fF2 * 0.5 * c / x;
-    fF5 = fF2 / x;         // Albright-Jarlskog relation
-    fF4 = 0.;              // Nucl.Phys.B 84, 467 (1975)
-  }
-
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("DISSF", pDEBUG) 
-     << "F1-F5 = " 
-     << fF1 << ", " << fF2 << ", " << fF3 << ", " << fF4 << ", " << fF5;
-#endif
-}
-//____________________________________________________________________________
-double QPMDMDISStrucFuncBase::Q2(const Interaction * interaction) const
-{
-// Return Q2 from the kinematics or, if not set, compute it from x,y
-// The x might be corrected
-
-  const Kinematics & kinematics = interaction->Kine();
-
-  // if Q2 (or q2) is set then prefer this value
-  if (kinematics.KVSet(kKVQ2) || kinematics.KVSet(kKVq2)) {
-    double Q2val = kinematics.Q2();
-    return Q2val;
-  }
-  // if Q2 was not set, then compute it from x,y,Ev,Mnucleon
-  if (kinematics.KVSet(kKVy)) {
-    const InitialState & init_state = interaction->InitState();
-    double Mn = init_state.Tgt().HitNucP4Ptr()->M(); // could be off-shell
-    //double x     = this->ScalingVar(interaction);       // could be redefined
-    double x     = kinematics.x();
-    double y     = kinematics.y();
-    double Ev    = init_state.ProbeE(kRfHitNucRest);
-    double Q2val = 2*Mn*Ev*x*y;
-    return Q2val;
-  }
-  LOG("DISSF", pERROR) << "Could not compute Q2!";
-  return 0;
-}
-//____________________________________________________________________________
-double QPMDMDISStrucFuncBase::ScalingVar(const Interaction* interaction) const
-{
-// The scaling variable is set to the normal Bjorken x.
-// Override DISStructureFuncModel::ScalingVar() to compute corrections
-
-  return interaction->Kine().x();
-}
-//____________________________________________________________________________
-void QPMDMDISStrucFuncBase::KFactors(const Interaction *, 
-	         double & kuv, double & kdv, double & kus, double & kds) const
-{
-// This is an abstract class: no model-specific correction
-// The PDF scaling variables are set to 1
-// Override this method to compute model-dependent corrections
-
-  kuv = 1.;
-  kdv = 1.;
-  kus = 1.;
-  kds = 1.;
-}
-//____________________________________________________________________________
-double QPMDMDISStrucFuncBase::NuclMod(const Interaction * interaction) const
-{
-// Nuclear modification to Fi
-// The scaling variable can be overwritten to include corrections
-
-  if( interaction->TestBit(kIAssumeFreeNucleon)   ) return 1.0;
-  if( interaction->TestBit(kINoNuclearCorrection) ) return 1.0;
-
-  double f = 1.;
-  if(fIncludeNuclMod) {
-     const Target & tgt  = interaction->InitState().Tgt();
-
-//   The x used for computing the DIS Nuclear correction factor should be the 
-//   experimental x, not the rescaled x or off-shell-rest-frame version of x 
-//   (i.e. selected x).  Since we do not have access to experimental x at this 
-//   point in the calculation, just use selected x. 
-     const Kinematics & kine  = interaction->Kine();
-     double x  = kine.x();
-     int    A = tgt.A(); 
-     f = utils::nuclear::DISNuclFactor(x,A);
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-     LOG("DISSF", pDEBUG) << "Nuclear factor for x of " << x << "  = " << f; 
-#endif
-  }
-
-  return f;
-}
-//____________________________________________________________________________
-double QPMDMDISStrucFuncBase::R(const Interaction * interaction) const
-{
-// Computes R ( ~ longitudinal structure function FL = R * 2xF1)
-// The scaling variable can be overwritten to include corrections
-
-//   The x used for computing the DIS Nuclear correction factor should be the 
-//   experimental x, not the rescaled x or off-shell-rest-frame version of x 
-//   (i.e. selected x).  Since we do not have access to experimental x at this 
-//   point in the calculation, just use selected x. 
-  if(fIncludeR) {
-    const Kinematics & kine  = interaction->Kine();
-    double x  = kine.x();
-//    double x  = this->ScalingVar(interaction);
-    double Q2val = this->Q2(interaction);
-    double Rval  = utils::phys::RWhitlow(x, Q2val);
-    return Rval;
-  }
-  return 0;
-}
-//____________________________________________________________________________
-void QPMDMDISStrucFuncBase::CalcPDFs(const Interaction * interaction) const
-{
-  // Clean-up previous calculation
-  fPDF  -> Reset();
-  fPDFc -> Reset();
-
-  // Get the kinematical variables x,Q2 (could include corrections)
-  double x     = this->ScalingVar(interaction);
-  double Q2val = this->Q2(interaction);
-
-  // Get the hit nucleon mass (could be off-shell)
-  const Target & tgt = interaction->InitState().Tgt();
-  double M = tgt.HitNucP4().M(); 
-
-  // Get the Q2 for which PDFs will be evaluated
-  double Q2pdf = TMath::Max(Q2val, fQ2min);
-
-  // Compute PDFs at (x,Q2)
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("DISSF", pDEBUG) << "Calculating PDFs @ x = " << x << ", Q2 = " << Q2pdf;
-#endif
-  fPDF->Calculate(x, Q2pdf);
-
-  // Check whether it is above charm threshold
-  bool above_charm = 
-           utils::kinematics::IsAboveCharmThreshold(x, Q2val, M, fMc);
-  if(above_charm) {
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-    LOG("DISSF", pDEBUG) 
-      << "The event is above the charm threshold (mcharm = " << fMc << ")";
-#endif
-    if(fCharmOff) {
-       LOG("DISSF", pINFO) << "Charm production is turned off";
-    } else {
-       // compute the slow rescaling var
-       double xc = utils::kinematics::SlowRescalingVar(x, Q2val, M, fMc);    
-       if(xc<0 || xc>1) {
-          LOG("DISSF", pINFO) << "Unphys. slow rescaling var: xc = " << xc;
-       } else {
-          // compute PDFs at (xc,Q2)
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-          LOG("DISSF", pDEBUG) 
-              << "Calculating PDFs @ xc (slow rescaling) = " << x << ", Q2 = " << Q2val;
-#endif
-          fPDFc->Calculate(xc, Q2pdf);
-       }
-    }// charm off?
-  }//above charm thr?
-  else {
-    LOG("DISSF", pDEBUG) 
-     << "The event is below the charm threshold (mcharm = " << fMc << ")";
-  }
-
-  // Compute the K factors
-  double kval_u = 1.;
-  double kval_d = 1.;
-  double ksea_u = 1.;
-  double ksea_d = 1.;
-
-  this->KFactors(interaction, kval_u, kval_d, ksea_u, ksea_d);
-
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("DISSF", pDEBUG) << "K-Factors:";
-  LOG("DISSF", pDEBUG) << "U: Kval = " << kval_u << ", Ksea = " << ksea_u;
-  LOG("DISSF", pDEBUG) << "D: Kval = " << kval_d << ", Ksea = " << ksea_d;
-#endif
-
-  // Apply the K factors
-  //
-  // Always scale d pdfs with d kfactors and u pdfs with u kfactors.
-  // Don't swap the applied kfactors for neutrons.
-  // Debdatta & Donna noted (Sep.2006) that a similar swap in the neugen
-  // implementation was the cause of the difference in nu and nubar F2
-  //
-  fPDF->ScaleUpValence   (kval_u);
-  fPDF->ScaleDownValence (kval_d);
-  fPDF->ScaleUpSea       (ksea_u);
-  fPDF->ScaleDownSea     (ksea_d);
-  fPDF->ScaleStrange     (ksea_d);
-  fPDF->ScaleCharm       (ksea_u);
-  if(above_charm) {
-     fPDFc->ScaleUpValence   (kval_u);
-     fPDFc->ScaleDownValence (kval_d);
-     fPDFc->ScaleUpSea       (ksea_u);
-     fPDFc->ScaleDownSea     (ksea_d);
-     fPDFc->ScaleStrange     (ksea_d);
-     fPDFc->ScaleCharm       (ksea_u);
-  }
-
-  // Rules of thumb 
-  // ---------------------------------------
-  // - For W+ exchange use: -1/3|e| quarks and -2/3|e| antiquarks
-  // - For W- exchange use:  2/3|e| quarks and  1/3|e| antiquarks
-  // - For each qi -> qj transition multiply with the (ij CKM element)^2
-  // - Use isospin symmetry to get neutron's u,d from proton's u,d
-  //    -- neutron d = proton u
-  //    -- neutron u = proton d
-  // - Use u = usea + uvalence. Same for d
-  // - For s,c use q=qbar
-  // - For t,b use q=qbar=0
-
-  fuv   = fPDF  -> UpValence();
-  fus   = fPDF  -> UpSea();
-  fdv   = fPDF  -> DownValence();
-  fds   = fPDF  -> DownSea();
-  fs    = fPDF  -> Strange();
-  fc    = 0.;
-  fuv_c = fPDFc -> UpValence();   // will be 0 if < charm threshold
-  fus_c = fPDFc -> UpSea();       // ...
-  fdv_c = fPDFc -> DownValence(); // ...
-  fds_c = fPDFc -> DownSea();     // ...
-  fs_c  = fPDFc -> Strange();     // ...
-  fc_c  = fPDFc -> Charm();       // ...
-
-  // The above are the proton parton density function. Get the PDFs for the 
-  // hit nucleon (p or n) by swapping u<->d if necessary
-
-  int nuc_pdgc = tgt.HitNucPdg();
-  bool isP = pdg::IsProton  (nuc_pdgc);
-  bool isN = pdg::IsNeutron (nuc_pdgc);
-  assert(isP  || isN);
-
-  double tmp = 0;
-  if (isN) {  // swap u <-> d
-    tmp = fuv;   fuv   = fdv;   fdv   = tmp;
-    tmp = fus;   fus   = fds;   fds   = tmp;
-    tmp = fuv_c; fuv_c = fdv_c; fdv_c = tmp;
-    tmp = fus_c; fus_c = fds_c; fds_c = tmp;
-  }
-
-}
-//____________________________________________________________________________
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ 
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+
+         This GENIE code was adapted from the neugen3 code co-authored by
+         Donna Naples (Pittsburgh U.), Hugh Gallagher (Tufts U), and 
+         Costas Andreopoulos (RAL)
+
+         A fix was installed (Aug 12, 2014) by Brian Tice (Rochester) so that 
+         the nuclear modification to the pdf should be calculated in terms 
+         of the experimental x, not the rescaled x. The same goes for R(x,Q2).
+
+         A fix of the scaling variable used for the relations between structure
+         functions was installed by C. Bronner and J. Morrison Jun 06, 2016
+         after it was confirmed by A. Bodek that x and not the modified 
+         scaling variable should be used there.
+
+         Changes required to implement the GENIE Boosted Dark Matter module
+         were installed by Josh Berger (Univ. of Wisconsin)
+*/
+//____________________________________________________________________________
+
+#include <mutex>
+#include <sstream>
+
+#include <TMath.h>
+#include <TNtupleD.h>
+
+#include "Framework/Algorithm/AlgConfigPool.h"
+#include "Framework/Conventions/GBuild.h"
+#include "Framework/Conventions/Constants.h"
+#include "Framework/Conventions/RefFrame.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Physics/BoostedDarkMatter/XSection/QPMDMDISStrucFuncBase.h"
+#include "Physics/PartonDistributions/PDFModelI.h"
+#include "Framework/ParticleData/PDGUtils.h"
+#include "Framework/Utils/KineUtils.h"
+#include "Physics/NuclearState/NuclearUtils.h"
+#include "Framework/Utils/PhysUtils.h"
+#include "Framework/Utils/Cache.h"
+#include "Framework/Utils/CacheBranchNtp.h"
+
+using std::ostringstream;
+using std::vector;
+
+using namespace genie;
+using namespace genie::constants;
+
+//____________________________________________________________________________
+namespace {
+  // values per SF grid node, the nuclear modification f included:
+  // f*(uv+2us), f*(dv+2ds), f*2s (F2), f*uv, f*dv (xF3) and c/2 (F1/F2*x)
+  const int kNSFGridValues = 6;
+
+  // guards the SF grids, as the algorithm instance is shared
+  std::mutex gSFGridMutex;
+
+  // grid variable in x: log(x/(1-x)) resolves both x->0 and x->1
+  inline double SFGridU(double x) { return TMath::Log(x/(1.-x)); }
+
+  // Catmull-Rom weights of the 4 nodes around t in [0,1) from node 1
+  inline void CatmullRom(double t, double * w)
+  {
+    double t2 = t*t;
+    double t3 = t2*t;
+    w[0] = 0.5 * (   -t3 + 2*t2 - t );
+    w[1] = 0.5 * (  3*t3 - 5*t2 + 2 );
+    w[2] = 0.5 * ( -3*t3 + 4*t2 + t );
+    w[3] = 0.5 * (    t3 -   t2     );
+  }
+
+  // configuration items the SF grids do not depend on: the couplings
+  // (applied at lookup) and the other BoostedDarkMatter parameters
+  const char * kSFGridSkipKeys[] = {
+    "ZpCoupling", "DarkLeftCharge", "DarkRightCharge", "DarkScalarCharge",
+    "UpLeftCharge", "UpRightCharge", "DownLeftCharge", "DownRightCharge",
+    "StrangeLeftCharge", "StrangeRightCharge", "CharmLeftCharge",
+    "CharmRightCharge", "ElectronLeftCharge", "ElectronRightCharge",
+    "DMEL-Mp", "DMEL-Mpi", "DMEL-Meta", "AxialVectorSpin-u",
+    "AxialVectorSpin-d", "AxialVectorSpin-s", "UseSFGrid"
+  };
+}
+
+//____________________________________________________________________________
+QPMDMDISStrucFuncBase::QPMDMDISStrucFuncBase() :
+DISStructureFuncModelI(),
+fUseSFGrid(false)
+{
+  this->InitPDF();
+}
+//____________________________________________________________________________
+QPMDMDISStrucFuncBase::QPMDMDISStrucFuncBase(string name) :
+DISStructureFuncModelI(name),
+fUseSFGrid(false)
+{
+  this->InitPDF();
+}
+//____________________________________________________________________________
+QPMDMDISStrucFuncBase::QPMDMDISStrucFuncBase(string name, string config):
+DISStructureFuncModelI(name, config),
+fUseSFGrid(false)
+{
+  this->InitPDF();
+}
+//____________________________________________________________________________
+QPMDMDISStrucFuncBase::~QPMDMDISStrucFuncBase()
+{
+  delete fPDF;
+  delete fPDFc;
+}
+//____________________________________________________________________________
+void QPMDMDISStrucFuncBase::Configure(const Registry & config)
+{
+  Algorithm::Configure(config);
+  this->LoadConfig();
+}
+//____________________________________________________________________________
+void QPMDMDISStrucFuncBase::Configure(string param_set)
+{
+  Algorithm::Configure(param_set);
+  this->LoadConfig();
+}
+//____________________________________________________________________________
+void QPMDMDISStrucFuncBase::LoadConfig(void)
+{
+  LOG("DISSF", pDEBUG) << "Loading configuration...";
+
+  //-- pdf
+  const PDFModelI * pdf_model =
+         dynamic_cast<const PDFModelI *> (this->SubAlg("PDF-Set"));
+  fPDF  -> SetModel(pdf_model);
+  fPDFc -> SetModel(pdf_model);
+
+  //-- charm mass
+  GetParam( "Charm-Mass", fMc ) ;
+
+  //-- min Q2 for PDF evaluation
+  GetParam( "PDF-Q2min", fQ2min ) ;
+
+  //-- include R (~FL)?
+  GetParam( "IncludeR", fIncludeR ) ;
+
+  //-- include nuclear factor (shadowing / anti-shadowing / ...)
+  GetParam( "IncludeNuclMod", fIncludeNuclMod ) ;
+
+  //-- Use 2016 SF relation corrections
+  GetParam( "Use2016Corrections", fUse2016Corrections ) ;
+
+  //-- Set min for relation between 2xF1 and F2
+  GetParam( "LowQ2CutoffF1F2", fLowQ2CutoffF1F2 ) ;
+
+  //-- turn charm production off?
+  GetParamDef( "Charm-Prod-Off", fCharmOff, false ) ;
+
+  //-- dark matter couplings
+  GetParam( "UpLeftCharge", fQuL );
+  GetParam( "UpRightCharge", fQuR );
+  GetParam( "CharmLeftCharge", fQcL );
+  GetParam( "CharmRightCharge", fQcR );
+  GetParam( "DownLeftCharge", fQdL );
+  GetParam( "DownRightCharge", fQdR );
+  GetParam( "StrangeLeftCharge", fQsL );
+  GetParam( "StrangeRightCharge", fQsR );
+
+  //-- pre-tabulated (x,Q2) SF grids
+  GetParamDef( "UseSFGrid",     fUseSFGrid,     false  ) ;
+  GetParamDef( "SFGrid-NX",     fSFGridNx,      120    ) ;
+  GetParamDef( "SFGrid-NQ2",    fSFGridNQ2,     100    ) ;
+  GetParamDef( "SFGrid-Xmin",   fSFGridXmin,    1.E-4  ) ;
+  GetParamDef( "SFGrid-Xmax",   fSFGridXmax,    0.999  ) ;
+  GetParamDef( "SFGrid-Q2min",  fSFGridQ2min,   1.E-3  ) ;
+  GetParamDef( "SFGrid-Q2max",  fSFGridQ2max,   1.E+4  ) ;
+
+  if(fSFGridNx < 4 || fSFGridNQ2 < 4) {
+    LOG("DISSF", pWARN)
+      << "SF grids need at least 4 x 4 nodes; using the direct calculation";
+    fUseSFGrid = false;
+  }
+
+  // The grids depend on the configuration
+  {
+    std::lock_guard<std::mutex> lock(gSFGridMutex);
+    fSFGrids.clear();
+  }
+
+  LOG("DISSF", pDEBUG) << "Done loading configuration";
+}
+//____________________________________________________________________________
+void QPMDMDISStrucFuncBase::InitPDF(void)
+{
+                     // evaluated at:
+  fPDF  = new PDF(); //   x = computed (+/-corrections) scaling var, Q2
+  fPDFc = new PDF(); //   x = computed charm slow re-scaling var,    Q2
+}
+//____________________________________________________________________________
+void QPMDMDISStrucFuncBase::Calculate(const Interaction * interaction) const
+{
+  // Reset mutable members
+  fF1 = 0;
+  fF2 = 0;
+  fF3 = 0;
+  fF4 = 0;
+  fF5 = 0;
+  fF6 = 0;
+
+  // Get process info & perform various checks
+  const ProcessInfo &  proc_info  = interaction->ProcInfo();
+  const InitialState & init_state = interaction->InitState();
+  const Target & tgt = init_state.Tgt();
+
+  int  nuc_pdgc    = tgt.HitNucPdg();
+  int  probe_pdgc  = init_state.ProbePdg();
+  bool is_p        = pdg::IsProton       ( nuc_pdgc    );
+  bool is_n        = pdg::IsNeutron      ( nuc_pdgc    );
+  bool is_dm       = pdg::IsDarkMatter   ( probe_pdgc  );
+  bool is_dmb      = pdg::IsAntiDarkMatter   ( probe_pdgc  );
+  bool is_dmi      = proc_info.IsDarkMatter();
+
+  if ( !is_dm && !is_dmb    ) return;
+  if ( !is_p && !is_n       ) return;
+  if ( tgt.N() == 0 && is_n ) return;
+  if ( tgt.Z() == 0 && is_p ) return;
+
+  // Flags switching on/off quark contributions so that this algorithm can be 
+  // used for both l + N -> l' + X, and l + q -> l' + q' level calculations
+
+  double switch_uv    = 1.;
+  double switch_us    = 1.;
+  double switch_ubar  = 1.;
+  double switch_dv    = 1.;
+  double switch_ds    = 1.;
+  double switch_dbar  = 1.;
+  double switch_s     = 1.;
+  double switch_sbar  = 1.;
+  double switch_c     = 1.;
+  double switch_cbar  = 1.;
+
+  if(tgt.HitQrkIsSet()) {
+
+     switch_uv    = 0.;
+     switch_us    = 0.;
+     switch_ubar  = 0.;
+     switch_dv    = 0.;
+     switch_ds    = 0.;
+     switch_dbar  = 0.;
+     switch_s     = 0.;
+     switch_sbar  = 0.;
+     switch_c     = 0.;
+     switch_cbar  = 0.;
+
+     int  qpdg = tgt.HitQrkPdg();
+     bool sea  = tgt.HitSeaQrk();
+
+     bool is_u    = pdg::IsUQuark     (qpdg);
+     bool is_ubar = pdg::IsAntiUQuark (qpdg);
+     bool is_d    = pdg::IsDQuark     (qpdg);
+     bool is_dbar = pdg::IsAntiDQuark (qpdg);
+     bool is_s    = pdg::IsSQuark     (qpdg);
+     bool is_sbar = pdg::IsAntiSQuark (qpdg);
+     bool is_c    = pdg::IsCQuark     (qpdg);
+     bool is_cbar = pdg::IsAntiCQuark (qpdg);
+
+     if      (!sea && is_u   ) { switch_uv   = 1; }
+     else if ( sea && is_u   ) { switch_us   = 1; }
+     else if ( sea && is_ubar) { switch_ubar = 1; }
+     else if (!sea && is_d   ) { switch_dv   = 1; }
+     else if ( sea && is_d   ) { switch_ds   = 1; }
+     else if ( sea && is_dbar) { switch_dbar = 1; }
+     else if ( sea && is_s   ) { switch_s    = 1; }
+     else if ( sea && is_sbar) { switch_sbar = 1; }
+     else if ( sea && is_c   ) { switch_c    = 1; }
+     else if ( sea && is_cbar) { switch_cbar = 1; }
+     else return;
+
+  }
+
+  if(fUseSFGrid && is_dmi && !tgt.HitQrkIsSet() &&
+     this->InterpolateSF(interaction)) return;
+
+  // Compute PDFs [both at (scaling-var,Q2) and (slow-rescaling-var,Q2)
+  // Applying all PDF K-factors abd scaling variable corrections
+
+  this -> CalcPDFs (interaction);
+
+  //
+  // Compute structure functions for the EM, NC and CC cases
+  //
+
+  double F2val=0, xF3val=0;
+
+  // ***  DARK MATTER
+  if(is_dmi) {
+
+    if(!is_dm && !is_dmb) return;
+
+    double gvu  = 0.5 * (fQuL  + fQuR);
+    double gau  = 0.5 * (fQuL  - fQuR);
+    double gvc  = 0.5 * (fQcL  + fQcR);
+    double gac  = 0.5 * (fQcL  - fQcR);
+    double gvd  = 0.5 * (fQdL  + fQdR);
+    double gad  = 0.5 * (fQdL  - fQdR);
+    double gvs  = 0.5 * (fQsL  + fQsR);
+    double gas  = 0.5 * (fQsL  - fQsR);
+    double gvu2 = TMath::Power(gvu, 2.);
+    double gau2 = TMath::Power(gau, 2.);
+    double gvc2 = TMath::Power(gvc, 2.);
+    double gac2 = TMath::Power(gac, 2.);
+    double gvd2 = TMath::Power(gvd, 2.);
+    double gad2 = TMath::Power(gad, 2.);
+    double gvs2 = TMath::Power(gvs, 2.);
+    double gas2 = TMath::Power(gas, 2.);
+
+    double q2   = 4.0 * ((switch_uv   * fuv + switch_us   * fus) * (gvu2+gau2) + switch_c    * fc  * (gvc2+gac2) + 
+			 (switch_dv   * fdv + switch_ds   * fds) * (gvd2+gad2) + switch_s    * fs  * (gvs2+gas2));
+    double q3   = 4.0 * ((switch_uv   * fuv + switch_us   * fus) * (2*gvu*gau) + switch_c    * fc  * (2*gvc*gac) + 
+			 (switch_dv   * fdv + switch_ds   * fds) * (2*gvd*gad) + switch_s    * fs  * (2*gvs*gas));
+
+    double qb2  = 4.0 * (switch_ubar * fus * (gvu2+gau2) + switch_cbar * fc  * (gvc2+gac2) + 
+			 switch_dbar * fds * (gvd2+gad2) + switch_sbar * fs  * (gvs2+gas2));    
+    double qb3  = 4.0 * (switch_ubar * fus * (2*gvu*gau) + switch_cbar * fc  * (2*gvc*gac) + 
+			 switch_dbar * fds * (2*gvd*gad) + switch_sbar * fs  * (2*gvs*gas));    
+ 
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+    LOG("DISSF", pINFO) << "f2 : q = " << q2 << ", bar{q} = " << qb2;
+    LOG("DISSF", pINFO) << "xf3: q = " << q3 << ", bar{q} = " << qb3;
+#endif
+
+    F2val  = q2+qb2;
+    xF3val = q3-qb3;
+  } 
+
+  double Q2val = this->Q2        (interaction);
+  double x     = this->ScalingVar(interaction);
+  double f     = this->NuclMod   (interaction); // nuclear modification
+  double r     = this->R         (interaction); // R ~ FL
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("DISSF", pDEBUG) << "Nucl. mod   = " << f;
+  LOG("DISSF", pDEBUG) << "R(=FL/2xF1) = " << r;
+#endif
+
+  if(fUse2016Corrections) {
+    //It was confirmed by A.Bodek that the modified scaling variable
+    //should just be used to compute the strucure functions F2 and xF3,
+    //but that the usual Bjorken x should be used for the relations
+    //between the structure functions.
+    //For the same reason remove the freezing of Q2 at 0.8 for those relations,
+    //although it has not been explicitly asked to A.Bodek if it should be done.
+
+    const Kinematics & kinematics = interaction->Kine();
+    double bjx = kinematics.x();
+    
+    double a = TMath::Power(bjx,2.) / TMath::Max(Q2val, fLowQ2CutoffF1F2);
+    double c = (1. + 4. * kNucleonMass2 * a) / (1.+r);
+
+    fF3 = f * xF3val/bjx;
+    fF2 = f * F2val;
+    fF1 = fF2 * 0.5*c/bjx;
+    fF5 = fF2/bjx;           // Albright-Jarlskog relation
+    fF4 = 0.;                // Nucl.Phys.B 84, 467 (1975)
+  } 
+  else {
+    double a = TMath::Power(x,2.) / TMath::Max(Q2val, fLowQ2CutoffF1F2);
+    double c = (1. + 4. * kNucleonMass2 * a) / (1.+r);
+    //double a = TMath::Power(x,2.) / Q2val;
+    //double c = (1. + 4. * kNucleonMass * a) / (1.+r);
+
+    fF3 = f * xF3val / x;
+    fF2 = f * F2val;
+    fF1 = fF2 * 0.5 * c / x;
+    fF5 = fF2 / x;         // Albright-Jarlskog relation
+    fF4 = 0.;              // Nucl.Phys.B 84, 467 (1975)
+  }
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("DISSF", pDEBUG) 
+     << "F1-F5 = " 
+     << fF1 << ", " << fF2 << ", " << fF3 << ", " << fF4 << ", " << fF5;
+#endif
+}
+//____________________________________________________________________________
+double QPMDMDISStrucFuncBase::Q2(const Interaction * interaction) const
+{
+// Return Q2 from the kinematics or, if not set, compute it from x,y
+// The x might be corrected
+
+  const Kinematics & kinematics = interaction->Kine();
+
+  // if Q2 (or q2) is set then prefer this value
+  if (kinematics.KVSet(kKVQ2) || kinematics.KVSet(kKVq2)) {
+    double Q2val = kinematics.Q2();
+    return Q2val;
+  }
+  // if Q2 was not set, then compute it from x,y,Ev,Mnucleon
+  if (kinematics.KVSet(kKVy)) {
+    const InitialState & init_state = interaction->InitState();
+    double Mn = init_state.Tgt().HitNucP4Ptr()->M(); // could be off-shell
+    //double x     = this->ScalingVar(interaction);       // could be redefined
+    double x     = kinematics.x();
+    double y     = kinematics.y();
+    double Ev    = init_state.ProbeE(kRfHitNucRest);
+    double Q2val = 2*Mn*Ev*x*y;
+    return Q2val;
+  }
+  LOG("DISSF", pERROR) << "Could not compute Q2!";
+  return 0;
+}
+//____________________________________________________________________________
+double QPMDMDISStrucFuncBase::ScalingVar(const Interaction* interaction) const
+{
+// The scaling variable is set to the normal Bjorken x.
+// Override DISStructureFuncModel::ScalingVar() to compute corrections
+
+  return interaction->Kine().x();
+}
+//____________________________________________________________________________
+void QPMDMDISStrucFuncBase::KFactors(const Interaction *, 
+	         double & kuv, double & kdv, double & kus, double & kds) const
+{
+// This is an abstract class: no model-specific correction
+// The PDF scaling variables are set to 1
+// Override this method to compute model-dependent corrections
+
+  kuv = 1.;
+  kdv = 1.;
+  kus = 1.;
+  kds = 1.;
+}
+//____________________________________________________________________________
+double QPMDMDISStrucFuncBase::NuclMod(const Interaction * interaction) const
+{
+// Nuclear modification to Fi
+// The scaling variable can be overwritten to include corrections
+
+  if( interaction->TestBit(kIAssumeFreeNucleon)   ) return 1.0;
+  if( interaction->TestBit(kINoNuclearCorrection) ) return 1.0;
+
+  double f = 1.;
+  if(fIncludeNuclMod) {
+     const Target & tgt  = interaction->InitState().Tgt();
+
+//   The x used for computing the DIS Nuclear correction factor should be the 
+//   experimental x, not the rescaled x or off-shell-rest-frame version of x 
+//   (i.e. selected x).  Since we do not have access to experimental x at this 
+//   point in the calculation, just use selected x. 
+     const Kinematics & kine  = interaction->Kine();
+     double x  = kine.x();
+     int    A = tgt.A(); 
+     f = utils::nuclear::DISNuclFactor(x,A);
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+     LOG("DISSF", pDEBUG) << "Nuclear factor for x of " << x << "  = " << f; 
+#endif
+  }
+
+  return f;
+}
+//____________________________________________________________________________
+double QPMDMDISStrucFuncBase::R(const Interaction * interaction) const
+{
+// Computes R ( ~ longitudinal structure function FL = R * 2xF1)
+// The scaling variable can be overwritten to include corrections
+
+//   The x used for computing the DIS Nuclear correction factor should be the 
+//   experimental x, not the rescaled x or off-shell-rest-frame version of x 
+//   (i.e. selected x).  Since we do not have access to experimental x at this 
+//   point in the calculation, just use selected x. 
+  if(fIncludeR) {
+    const Kinematics & kine  = interaction->Kine();
+    double x  = kine.x();
+//    double x  = this->ScalingVar(interaction);
+    double Q2val = this->Q2(interaction);
+    double Rval  = utils::phys::RWhitlow(x, Q2val);
+    return Rval;
+  }
+  return 0;
+}
+//____________________________________________________________________________
+void QPMDMDISStrucFuncBase::CalcPDFs(const Interaction * interaction) const
+{
+  // Clean-up previous calculation
+  fPDF  -> Reset();
+  fPDFc -> Reset();
+
+  // Get the kinematical variables x,Q2 (could include corrections)
+  double x     = this->ScalingVar(interaction);
+  double Q2val = this->Q2(interaction);
+
+  // Get the hit nucleon mass (could be off-shell)
+  const Target & tgt = interaction->InitState().Tgt();
+  double M = tgt.HitNucP4().M(); 
+
+  // Get the Q2 for which PDFs will be evaluated
+  double Q2pdf = TMath::Max(Q2val, fQ2min);
+
+  // Compute PDFs at (x,Q2)
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("DISSF", pDEBUG) << "Calculating PDFs @ x = " << x << ", Q2 = " << Q2pdf;
+#endif
+  fPDF->Calculate(x, Q2pdf);
+
+  // Check whether it is above charm threshold
+  bool above_charm = 
+           utils::kinematics::IsAboveCharmThreshold(x, Q2val, M, fMc);
+  if(above_charm) {
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+    LOG("DISSF", pDEBUG) 
+      << "The event is above the charm threshold (mcharm = " << fMc << ")";
+#endif
+    if(fCharmOff) {
+       LOG("DISSF", pINFO) << "Charm production is turned off";
+    } else {
+       // compute the slow rescaling var
+       double xc = utils::kinematics::SlowRescalingVar(x, Q2val, M, fMc);    
+       if(xc<0 || xc>1) {
+          LOG("DISSF", pINFO) << "Unphys. slow rescaling var: xc = " << xc;
+       } else {
+          // compute PDFs at (xc,Q2)
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+          LOG("DISSF", pDEBUG) 
+              << "Calculating PDFs @ xc (slow rescaling) = " << x << ", Q2 = " << Q2val;
+#endif
+          fPDFc->Calculate(xc, Q2pdf);
+       }
+    }// charm off?
+  }//above charm thr?
+  else {
+    LOG("DISSF", pDEBUG) 
+     << "The event is below the charm threshold (mcharm = " << fMc << ")";
+  }
+
+  // Compute the K factors
+  double kval_u = 1.;
+  double kval_d = 1.;
+  double ksea_u = 1.;
+  double ksea_d = 1.;
+
+  this->KFactors(interaction, kval_u, kval_d, ksea_u, ksea_d);
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("DISSF", pDEBUG) << "K-Factors:";
+  LOG("DISSF", pDEBUG) << "U: Kval = " << kval_u << ", Ksea = " << ksea_u;
+  LOG("DISSF", pDEBUG) << "D: Kval = " << kval_d << ", Ksea = " << ksea_d;
+#endif
+
+  // Apply the K factors
+  //
+  // Always scale d pdfs with d kfactors and u pdfs with u kfactors.
+  // Don't swap the applied kfactors for neutrons.
+  // Debdatta & Donna noted (Sep.2006) that a similar swap in the neugen
+  // implementation was the cause of the difference in nu and nubar F2
+  //
+  fPDF->ScaleUpValence   (kval_u);
+  fPDF->ScaleDownValence (kval_d);
+  fPDF->ScaleUpSea       (ksea_u);
+  fPDF->ScaleDownSea     (ksea_d);
+  fPDF->ScaleStrange     (ksea_d);
+  fPDF->ScaleCharm       (ksea_u);
+  if(above_charm) {
+     fPDFc->ScaleUpValence   (kval_u);
+     fPDFc->ScaleDownValence (kval_d);
+     fPDFc->ScaleUpSea       (ksea_u);
+     fPDFc->ScaleDownSea     (ksea_d);
+     fPDFc->ScaleStrange     (ksea_d);
+     fPDFc->ScaleCharm       (ksea_u);
+  }
+
+  // Rules of thumb 
+  // ---------------------------------------
+  // - For W+ exchange use: -1/3|e| quarks and -2/3|e| antiquarks
+  // - For W- exchange use:  2/3|e| quarks and  1/3|e| antiquarks
+  // - For each qi -> qj transition multiply with the (ij CKM element)^2
+  // - Use isospin symmetry to get neutron's u,d from proton's u,d
+  //    -- neutron d = proton u
+  //    -- neutron u = proton d
+  // - Use u = usea + uvalence. Same for d
+  // - For s,c use q=qbar
+  // - For t,b use q=qbar=0
+
+  fuv   = fPDF  -> UpValence();
+  fus   = fPDF  -> UpSea();
+  fdv   = fPDF  -> DownValence();
+  fds   = fPDF  -> DownSea();
+  fs    = fPDF  -> Strange();
+  fc    = 0.;
+  fuv_c = fPDFc -> UpValence();   // will be 0 if < charm threshold
+  fus_c = fPDFc -> UpSea();       // ...
+  fdv_c = fPDFc -> DownValence(); // ...
+  fds_c = fPDFc -> DownSea();     // ...
+  fs_c  = fPDFc -> Strange();     // ...
+  fc_c  = fPDFc -> Charm();       // ...
+
+  // The above are the proton parton density function. Get the PDFs for the 
+  // hit nucleon (p or n) by swapping u<->d if necessary
+
+  int nuc_pdgc = tgt.HitNucPdg();
+  bool isP = pdg::IsProton  (nuc_pdgc);
+  bool isN = pdg::IsNeutron (nuc_pdgc);
+  assert(isP  || isN);
+
+  double tmp = 0;
+  if (isN) {  // swap u <-> d
+    tmp = fuv;   fuv   = fdv;   fdv   = tmp;
+    tmp = fus;   fus   = fds;   fds   = tmp;
+    tmp = fuv_c; fuv_c = fdv_c; fdv_c = tmp;
+    tmp = fus_c; fus_c = fds_c; fds_c = tmp;
+  }
+
+}
+//____________________________________________________________________________
+bool QPMDMDISStrucFuncBase::InterpolateSF(const Interaction * interaction) const
+{
+// Interpolates the parton densities in the (x,Q2) grid of the input
+// interaction and combines them with the dark matter couplings.
+// Returns false if the grid does not apply, and the SFs must be calculated.
+
+  double bjx   = interaction->Kine().x();
+  double Q2val = this->Q2(interaction);
+  if(bjx   <= fSFGridXmin  || bjx   >= fSFGridXmax ) return false;
+  if(Q2val <= fSFGridQ2min || Q2val >= fSFGridQ2max) return false;
+
+  const vector<double> & grid = this->SFGrid(interaction);
+
+  // nodes and Catmull-Rom weights around (x,Q2), at least one node away
+  // from the grid edges
+  double umin = SFGridU(fSFGridXmin);
+  double du   = (SFGridU(fSFGridXmax) - umin) / (fSFGridNx-1);
+  double lmin = TMath::Log(fSFGridQ2min);
+  double dl   = (TMath::Log(fSFGridQ2max) - lmin) / (fSFGridNQ2-1);
+
+  double fu = (SFGridU(bjx)       - umin) / du;
+  double fl = (TMath::Log(Q2val)  - lmin) / dl;
+  int iu = TMath::Min(TMath::Max((int) fu, 1), fSFGridNx -3);
+  int il = TMath::Min(TMath::Max((int) fl, 1), fSFGridNQ2-3);
+
+  double wu[4], wl[4];
+  CatmullRom(fu-iu, wu);
+  CatmullRom(fl-il, wl);
+
+  double v[kNSFGridValues] = { 0. };
+  for(int i = 0; i < 4; i++) {
+    for(int j = 0; j < 4; j++) {
+      double w = wu[i] * wl[j];
+      const double * node =
+          &grid[ ((iu-1+i) * fSFGridNQ2 + (il-1+j)) * kNSFGridValues ];
+      for(int k = 0; k < kNSFGridValues; k++) v[k] += w * node[k];
+    }
+  }
+
+  // the couplings, as in Calculate()
+  double gvu = 0.5 * (fQuL + fQuR);
+  double gau = 0.5 * (fQuL - fQuR);
+  double gvd = 0.5 * (fQdL + fQdR);
+  double gad = 0.5 * (fQdL - fQdR);
+  double gvs = 0.5 * (fQsL + fQsR);
+  double gas = 0.5 * (fQsL - fQsR);
+
+  double F2val  = 4.0 * ( v[0] * (gvu*gvu + gau*gau) +
+                          v[1] * (gvd*gvd + gad*gad) +
+                          v[2] * (gvs*gvs + gas*gas) );
+  double xF3val = 4.0 * ( v[3] * (2*gvu*gau) + v[4] * (2*gvd*gad) );
+
+  double xdiv = (fUse2016Corrections) ? bjx : this->ScalingVar(interaction);
+  fF2 = F2val;
+  fF3 = xF3val / xdiv;
+  fF1 = fF2 * v[5] / xdiv;
+  fF5 = fF2 / xdiv;
+  fF4 = 0.;
+  fF6 = 0.;
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("DISSF", pDEBUG)
+     << "F1-F5 (interpolated) = "
+     << fF1 << ", " << fF2 << ", " << fF3 << ", " << fF4 << ", " << fF5;
+#endif
+  return true;
+}
+//____________________________________________________________________________
+const vector<double> & QPMDMDISStrucFuncBase::SFGrid(
+                                      const Interaction * interaction) const
+{
+// Returns the SF grid of the input interaction, taking it from the Cache
+// (possibly loaded from a cache file) or filling it at first use.
+// The cache key leaves out the couplings, so that the grids are shared
+// by all the configurations of a coupling scan.
+
+  ostringstream ikey;
+  ikey << interaction->AsString();
+  if(interaction->TestBit(kIAssumeFreeNucleon))   ikey << ";free-nucleon";
+  if(interaction->TestBit(kINoNuclearCorrection)) ikey << ";no-nucl-corr";
+
+  std::lock_guard<std::mutex> lock(gSFGridMutex);
+
+  map<string, vector<double> >::const_iterator it = fSFGrids.find(ikey.str());
+  if(it != fSFGrids.end()) return it->second;
+
+  vector<double> & grid = fSFGrids[ikey.str()];
+  unsigned int nnodes = fSFGridNx * fSFGridNQ2;
+
+  vector<string> skip_keys(kSFGridSkipKeys, kSFGridSkipKeys +
+                    sizeof(kSFGridSkipKeys) / sizeof(kSFGridSkipKeys[0]));
+
+  Cache * cache = Cache::Instance();
+  ostringstream hkey;
+  hkey << "SFGrid/" << this->ConfigHash(skip_keys);
+  string key = cache->CacheBranchKey(this->Id().Key(), hkey.str(), ikey.str());
+
+  CacheBranchNtp * branch =
+       dynamic_cast<CacheBranchNtp *> (cache->FindCacheBranch(key));
+  if(branch && branch->Ntuple() &&
+     branch->Ntuple()->GetEntries() == (Long64_t) nnodes &&
+     branch->Ntuple()->GetNvar() == kNSFGridValues)
+  {
+     TNtupleD * ntp = branch->Ntuple();
+     grid.resize(nnodes * kNSFGridValues);
+     for(unsigned int n = 0; n < nnodes; n++) {
+       ntp->GetEntry(n);
+       const double * values = ntp->GetArgs();
+       for(int k = 0; k < kNSFGridValues; k++) {
+         grid[n*kNSFGridValues + k] = values[k];
+       }
+     }
+     LOG("DISSF", pINFO) << "Loaded the SF grid of " << ikey.str();
+     return grid;
+  }
+
+  this->FillSFGrid(interaction, grid);
+
+  branch = new CacheBranchNtp("SFGrid", "qu:qd:qs:qvu:qvd:c");
+  for(unsigned int n = 0; n < nnodes; n++) {
+    branch->Ntuple()->Fill(&grid[n*kNSFGridValues]);
+  }
+  cache->AddCacheBranch(key, branch);
+
+  LOG("DISSF", pINFO)
+    << "Tabulated the SFs of " << ikey.str() << " in "
+    << fSFGridNx << " x " << fSFGridNQ2 << " (x,Q2) nodes";
+
+  return grid;
+}
+//____________________________________________________________________________
+void QPMDMDISStrucFuncBase::FillSFGrid(
+       const Interaction * interaction, vector<double> & grid) const
+{
+// Calculates the coupling-independent parts of F2, xF3 and F1 at the (x,Q2)
+// grid nodes, for a copy of the input interaction (see Calculate()).
+
+  grid.assign(fSFGridNx * fSFGridNQ2 * kNSFGridValues, 0.);
+
+  Interaction node(*interaction);
+  Kinematics * kine = node.KinePtr();
+  kine->Reset();
+
+  double umin = SFGridU(fSFGridXmin);
+  double du   = (SFGridU(fSFGridXmax) - umin) / (fSFGridNx-1);
+  double lmin = TMath::Log(fSFGridQ2min);
+  double dl   = (TMath::Log(fSFGridQ2max) - lmin) / (fSFGridNQ2-1);
+
+  for(int i = 0; i < fSFGridNx; i++) {
+    double u   = umin + i*du;
+    double bjx = 1. / (1. + TMath::Exp(-u));
+    for(int j = 0; j < fSFGridNQ2; j++) {
+      double Q2val = TMath::Exp(lmin + j*dl);
+      kine->Setx (bjx);
+      kine->SetQ2(Q2val);
+
+      this->CalcPDFs(&node);
+      double f    = this->NuclMod(&node);
+      double r    = this->R(&node);
+      double xdiv = (fUse2016Corrections) ? bjx : this->ScalingVar(&node);
+      double a    = TMath::Power(xdiv,2.) / TMath::Max(Q2val, fLowQ2CutoffF1F2);
+      double c    = (1. + 4. * kNucleonMass2 * a) / (1.+r);
+
+      double * values = &grid[ (i*fSFGridNQ2 + j) * kNSFGridValues ];
+      values[0] = f * (fuv + 2*fus);
+      values[1] = f * (fdv + 2*fds);
+      values[2] = f * 2*fs;
+      values[3] = f * fuv;
+      values[4] = f * fdv;
+      values[5] = 0.5 * c;
+    }
+  }
+}
+//____________________________________________________________________________
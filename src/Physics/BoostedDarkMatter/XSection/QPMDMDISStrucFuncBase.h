@@ -7,6 +7,15 @@
           Provides common implementation for concrete objects implementing the
           DISStructureFuncModelI interface.
 
+          Optionally (UseSFGrid), the parton densities entering the
+          structure functions of each interaction (target, hit nucleon) are
+          tabulated at first use on a (x, Q2) grid and interpolated with
+          bicubic (Catmull-Rom) splines. The dark matter couplings are
+          applied at lookup and the SFs do not depend on the dark matter
+          mass, so a single grid serves all the couplings and masses of a
+          scan. The grids are kept in the GENIE Cache, and saved with it
+          when a cache file is in use.
+
 \ref      For a discussion of DIS SF see for example E.A.Paschos and J.Y.Yu, 
           Phys.Rev.D 65.033002 and R.Devenish and A.Cooper-Sarkar, OUP 2004.
 
@@ -28,6 +37,10 @@
 #ifndef _DM_QPM_DIS_STRUCTURE_FUNCTIONS_BASE_H_
 #define _DM_QPM_DIS_STRUCTURE_FUNCTIONS_BASE_H_
 
+#include <map>
+#include <string>
+#include <vector>
+
 #include "Physics/DeepInelastic/XSection/DISStructureFuncModelI.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Physics/PartonDistributions/PDF.h"
@@ -87,6 +100,13 @@ protected:
   double fQsR;               ///< Strange Right Dark Matter Coupling
   bool   fUse2016Corrections;///< Use 2016 SF relation corrections
   double fLowQ2CutoffF1F2;   ///< Set min for relation between 2xF1 and F2
+  bool   fUseSFGrid;         ///< interpolate the SFs in pre-tabulated (x,Q2) grids?
+  int    fSFGridNx;          ///< number of x nodes of the SF grids
+  int    fSFGridNQ2;         ///< number of Q2 nodes of the SF grids
+  double fSFGridXmin;        ///< min x of the SF grids
+  double fSFGridXmax;        ///< max x of the SF grids
+  double fSFGridQ2min;       ///< min Q2 of the SF grids
+  double fSFGridQ2max;       ///< max Q2 of the SF grids
 
   mutable double fF1;
   mutable double fF2;
@@ -109,6 +129,15 @@ protected:
   mutable double fs_c; 
   mutable double fc_c; 
 
+private:
+
+  bool InterpolateSF (const Interaction * i) const;
+
+  const std::vector<double> & SFGrid   (const Interaction * i) const;
+  void                        FillSFGrid (const Interaction * i, std::vector<double> & grid) const;
+
+  mutable std::map<std::string, std::vector<double> > fSFGrids; ///< SF grids per interaction
+
 };
 
 }         // genie namespace
@@ -8,6 +8,8 @@
 */
 //____________________________________________________________________________
 
+#include <mutex>
+
 #include <TMath.h>
 #include <Math/Integrator.h>
 
@@ -32,6 +34,14 @@
 using namespace genie;
 using namespace genie::constants;
 
+namespace {
+  // Q2 range (GeV^2) of the D(R) tables. Outside, D(R) is integrated
+  const double kDRTableQ2Min = 1E-4;
+  const double kDRTableQ2Max = 1E+3;
+
+  std::mutex gDRTablesMutex; // guards the D(R) tables of all instances
+}
+
 //____________________________________________________________________________
 KovalenkoQELCharmPXSec::KovalenkoQELCharmPXSec() :
 XSecAlgorithmI("genie::KovalenkoQELCharmPXSec")
@@ -139,6 +149,55 @@ double KovalenkoQELCharmPXSec::ZR(const Interaction * interaction) const
 }
 //____________________________________________________________________________
 double KovalenkoQELCharmPXSec::DR(const Interaction * interaction) const
+{
+// D(R) only depends on Q2 and on the channel, not on the neutrino energy:
+// if tabulated, it is integrated once per channel rather than at every
+// (E,Q2) point of every spline knot and of the kinematics selection
+
+  double Q2 = interaction->Kine().Q2();
+
+  if(fDRTable && Q2 >= kDRTableQ2Min && Q2 < kDRTableQ2Max) {
+    const vector<double> & table = this->DRTable(interaction);
+    int    n = table.size();
+    double u = TMath::Log10(Q2/kDRTableQ2Min) * fDRTableNPerDecade;
+    int    i = TMath::Min((int)u, n-2);
+    double w = u - i;
+    return (1.-w) * table[i] + w * table[i+1];
+  }
+
+  return this->DR(interaction, Q2);
+}
+//____________________________________________________________________________
+const vector<double> & KovalenkoQELCharmPXSec::DRTable(
+                                      const Interaction * interaction) const
+{
+  pair<int,int> key(interaction->InitState().Tgt().HitNucPdg(),
+                    interaction->ExclTag().CharmHadronPdg());
+
+  std::lock_guard<std::mutex> lock(gDRTablesMutex);
+
+  map<pair<int,int>, vector<double> >::const_iterator it = fDRTables.find(key);
+  if(it != fDRTables.end()) return it->second;
+
+  int n = 1 + (int) TMath::Nint(
+            TMath::Log10(kDRTableQ2Max/kDRTableQ2Min) * fDRTableNPerDecade);
+
+  LOG("QELCharmXSec", pNOTICE)
+     << "Tabulating D(R) for nucleon = " << key.first
+     << ", charm hadron = " << key.second << " at " << n << " Q2 points";
+
+  vector<double> & table = fDRTables[key];
+  table.resize(n);
+  for(int i = 0; i < n; i++) {
+    double Q2 = kDRTableQ2Min *
+                  TMath::Power(10., (double)i / fDRTableNPerDecade);
+    table[i] = this->DR(interaction, Q2);
+  }
+  return table;
+}
+//____________________________________________________________________________
+double KovalenkoQELCharmPXSec::DR(
+                            const Interaction * interaction, double Q2) const
 {
   const InitialState & init_state = interaction -> InitState();
 
@@ -147,9 +206,6 @@ double KovalenkoQELCharmPXSec::DR(const Interaction * interaction) const
   pdfs.SetModel(fPDFModel);   // <-- attach algorithm
 
   // Compute integration area = [xi_bar_plus, xi_bar_minus]
-  const Kinematics & kinematics = interaction->Kine();
-
-  double Q2     = kinematics.Q2();
   double Mnuc   = init_state.Tgt().HitNucMass();
   double Mnuc2  = TMath::Power(Mnuc,2);
   double MR     = this->MRes(interaction);
@@ -175,7 +231,7 @@ double KovalenkoQELCharmPXSec::DR(const Interaction * interaction) const
           utils::gsl::Integration1DimTypeFromString("adaptive");
 
   double abstol   = 1;    // We mostly care about relative tolerance
-  double reltol   = 1E-4;
+  double reltol   = fDRRelTol;
   int    nmaxeval = 100000;
   ROOT::Math::Integrator ig(*integrand,ig_type,abstol,reltol,nmaxeval);
   double D = ig.Integral(xi_bar_plus, xi_bar_minus);
@@ -311,6 +367,17 @@ void KovalenkoQELCharmPXSec::LoadConfig(void)
   GetParamDef( "Res-DeltaM-Sigma",  fResDMSigma,   0.20 ) ;      //GeV
   GetParamDef( "Mo",                fMo,           sqrt(0.1) );  //GeV
 
+  // D(R) integration accuracy & tabulation
+  GetParamDef( "DR-RelTolerance",        fDRRelTol,          1E-4  );
+  GetParamDef( "DR-Table",               fDRTable,           false );
+  GetParamDef( "DR-Table-NPerDecade",    fDRTableNPerDecade, 100   );
+  fDRTableNPerDecade = TMath::Max(fDRTableNPerDecade, 1);
+
+  {
+    std::lock_guard<std::mutex> lock(gDRTablesMutex);
+    fDRTables.clear();
+  }
+
   // get PDF model and integrator
 
   fPDFModel = dynamic_cast<const PDFModelI *>(this->SubAlg("PDF-Set"));
@@ -33,11 +33,19 @@
 #ifndef _KOVALENKO_QEL_CHARM_PARTIAL_XSEC_H_
 #define _KOVALENKO_QEL_CHARM_PARTIAL_XSEC_H_
 
+#include <map>
+#include <utility>
+#include <vector>
+
 #include <Math/IFunction.h>
 
 #include "Framework/EventGen/XSecAlgorithmI.h"
 //#include "Numerical/GSFunc.h"
 
+using std::map;
+using std::pair;
+using std::vector;
+
 namespace genie {
 
 class PDF;
@@ -68,6 +76,8 @@ private:
 
   double ZR    (const Interaction * interaction)  const;
   double DR    (const Interaction * interaction)  const;
+  double DR    (const Interaction * interaction, double Q2) const;
+  const vector<double> & DRTable (const Interaction * interaction) const;
   double MRes  (const Interaction * interaction)  const;
   double ResDM (const Interaction * interaction)  const;
   double xiBar (double Q2, double Mnuc, double v) const;
@@ -82,6 +92,13 @@ private:
   double fScSigmaPP;
   double fResDMLambda;
   double fResDMSigma;
+
+  double fDRRelTol;           ///< rel. tolerance of the D(R) integral
+  bool   fDRTable;            ///< tabulate D(R) in Q2 (per channel)?
+  int    fDRTableNPerDecade;  ///< D(R) table points per decade of Q2
+
+  /// D(R) on the log(Q2) grid, by (hit nucleon, charm hadron)
+  mutable map<pair<int,int>, vector<double> > fDRTables;
 };
 
 } // genie namespace
@@ -42,13 +42,13 @@ using namespace genie::utils;
 
 //___________________________________________________________________________
 CEvNSEventGenerator::CEvNSEventGenerator() :
-EventRecordVisitorI("genie::CEvNSEventGenerator")
+KineGeneratorWithCache("genie::CEvNSEventGenerator")
 {
 
 }
 //___________________________________________________________________________
 CEvNSEventGenerator::CEvNSEventGenerator(string config) :
-EventRecordVisitorI("genie::COHElKinematicsGenerator", config)
+KineGeneratorWithCache("genie::CEvNSEventGenerator", config)
 {
 
 }
@@ -60,6 +60,8 @@ CEvNSEventGenerator::~CEvNSEventGenerator()
 //___________________________________________________________________________
 void CEvNSEventGenerator::ProcessEventRecord(GHepRecord * event) const
 {
+  StatsScope stats(this, event);
+
   this -> GenerateKinematics    (event);
   this -> AddFinalStateNeutrino (event);
   this -> AddRecoilNucleus      (event);
@@ -78,8 +80,6 @@ void CEvNSEventGenerator::GenerateKinematics(GHepRecord * event) const
   const KPhaseSpace & kps = interaction->PhaseSpace();
   Range1D_t Q2 = kps.Q2Lim();
   assert(Q2.min > 0. && Q2.min < Q2.max);
-  const InitialState & init_state = interaction -> InitState();
-  double E  = init_state.ProbeE(kRfLab);
   const double Q2min = Q2.min;
   const double Q2max = Q2.max;
   const double dQ2   = Q2max - Q2min;
@@ -97,86 +97,44 @@ void CEvNSEventGenerator::GenerateKinematics(GHepRecord * event) const
     LOG("CEvNS", pFATAL)
       << "Option to generate kinematics uniformly not supported";
     exit(1);
-/*
-    gQ2 = Q2min + dQ2 * rnd->RndKine().Rndm();
-    LOG("CEvNS", pINFO) << "Trying: Q2 = " << gQ2;
-    interaction->KinePtr()->SetQ2(gQ2);
-
-    // Computing cross section for the current kinematics
-    gxsec = fXSecModel->XSec(interaction, kPSQ2fE);
-    if(gxsec<=0){
-      LOG("CEvNS", pWARN)
-        << "Non-positive x-section for selected Q2 = " << gQ2 << "GeV^2";
-    }
-
-    double weight = 1; // to implement if fGenerateUniformly option is enabled
-    LOG("CEvNS", pDEBUG)  << "Kinematics wght = "<< weight;
-    // apply computed weight to the current event weight
-    weight *= event->Weight();
-    LOG("CEvNS", pDEBUG) << "Current event wght = " << weight;
-    event->SetWeight(weight);
-*/
   }
-  else {
-    // For the subsequent kinematic selection with the rejection method:
-    // Calculate the max differential cross section.
-    // Always at Q^2 = 0 for energies and model tested,
-    // but go ahead and do the calculation nevertheless.
-    ROOT::Math::IBaseFunctionOneDim * xsec_func =
-        new utils::gsl::dXSec_dQ2_E(fXSecModel, interaction,-1.);
-    ROOT::Math::BrentMinimizer1D minimizer;
-    minimizer.SetFunction(*xsec_func,Q2min,Q2max);
-    minimizer.Minimize(1000,1,1E-5);
-    double Q2_for_xsec_max = minimizer.XMinimum();
-    interaction->KinePtr()->SetQ2(Q2_for_xsec_max);
-    double xsec_max = fXSecModel->XSec(interaction, kPSQ2fE);
-    delete xsec_func;
-    LOG("CEvNS", pNOTICE)
-      << "Maximizing dsig(Q2;E = " << E << "GeV)/dQ2 gave a value of "
-      << xsec_max/(units::cm2) << " cm2/GeV^2 at Q2 = "
-      << Q2_for_xsec_max << " GeV^2";
-
-    // Try to select a valid Q2
-    unsigned int iter = 0;
-    while(1) {
-       iter++;
-       if(iter > kRjMaxIterations) {
-          LOG("CEvNS", pWARN)
-            << "*** Could not select a valid Q2 after " << iter << " iterations";
-          event->EventFlags()->SetBitNumber(kKineGenErr, true);
-          genie::exceptions::EVGThreadException exception;
-          exception.SetReason("Couldn't select kinematics");
-          exception.SwitchOnFastForward();
-          throw exception;
-       } // max iterations
-
-       gQ2 = Q2min + dQ2 * rnd->RndKine().Rndm();
-       LOG("CEvNS", pINFO) << "Trying: Q2 = " << gQ2;
-       interaction->KinePtr()->SetQ2(gQ2);
-
-       // Computing cross section for the current kinematics
-       gxsec = fXSecModel->XSec(interaction, kPSQ2fE);
-
-       if(gxsec > xsec_max) {
-          double frac = TMath::Abs(gxsec-xsec_max)/xsec_max;
-          if(frac > fMaxXSecDiffTolerance) {
-            LOG("CEvNS", pWARN)
-              << "Current computed cross-section (" << gxsec/(units::cm2)
-              << " cm2/GeV^2) exceeds the maximum cross-section ("
-              << xsec_max/(units::cm2) << " beyond the specified tolerance";
-          }
-       }
-
-       // Decide whether to accept the current kinematic point
-       double t = fSafetyFactor * xsec_max * rnd->RndKine().Rndm();
-       //this->AssertXSecLimits(interaction, gxsec, xsec_max);
-       LOG("CEvNS", pINFO)
-         << "dxsec/dQ2 = " << gxsec/(units::cm2) << " cm2/GeV^2"
-         << "J = 1, rnd = " << t;
-       bool accept = (t<gxsec);
-       if(accept) break; // exit loop
-    } // 1
-  } // generate uniformly
+
+  // For the subsequent kinematic selection with the rejection method:
+  // Calculate the max differential cross section or retrieve it from the
+  // cache. Throw an exception and quit the evg thread if a non-positive
+  // value is found.
+  double xsec_max = this->MaxXSec(event);
+
+  // Try to select a valid Q2
+  unsigned int iter = 0;
+  while(1) {
+     iter++;
+     if(iter > kRjMaxIterations) {
+        LOG("CEvNS", pWARN)
+          << "*** Could not select a valid Q2 after " << iter << " iterations";
+        event->EventFlags()->SetBitNumber(kKineGenErr, true);
+        genie::exceptions::EVGThreadException exception;
+        exception.SetReason("Couldn't select kinematics");
+        exception.SwitchOnFastForward();
+        throw exception;
+     } // max iterations
+
+     gQ2 = Q2min + dQ2 * rnd->RndKine().Rndm();
+     LOG("CEvNS", pINFO) << "Trying: Q2 = " << gQ2;
+     interaction->KinePtr()->SetQ2(gQ2);
+
+     // Computing cross section for the current kinematics
+     gxsec = this->XSec(interaction, kPSQ2fE);
+
+     // Decide whether to accept the current kinematic point
+     this->AssertXSecLimits(interaction, gxsec, xsec_max);
+     double t = xsec_max * rnd->RndKine().Rndm();
+     LOG("CEvNS", pINFO)
+       << "dxsec/dQ2 = " << gxsec/(units::cm2) << " cm2/GeV^2"
+       << "J = 1, rnd = " << t;
+     bool accept = (t<gxsec);
+     if(accept) break; // exit loop
+  } // 1
 
   LOG("CEvNS", pNOTICE) << "Selected Q2 = " << gQ2 << " GeV^2";
 
@@ -294,6 +252,7 @@ void CEvNSEventGenerator::LoadConfig(void)
 
   // max xsec safety factor (for rejection method) and min cached energy
   this->GetParamDef( "MaxXSec-SafetyFactor", fSafetyFactor, 1.05 ) ;
+  this->GetParamDef( "Cache-MinEnergy", fEMin, 0.0 ) ;
 
   // Generate kinematics uniformly over allowed phase space and compute
   // an event weight?
@@ -305,3 +264,49 @@ void CEvNSEventGenerator::LoadConfig(void)
   assert(fMaxXSecDiffTolerance>=0);
 }
 //____________________________________________________________________________
+double CEvNSEventGenerator::ComputeMaxXSec(const Interaction * in) const
+{
+  // Computes the max dsig/dQ2 at the energy of the input interaction.
+  // It is always at Q^2 = 0 for energies and model tested, but go ahead and
+  // do the calculation nevertheless. The value is cached for retrieval during
+  // subsequent event generation, so apply the safety factor as the value
+  // retrieved from the cache might correspond to a slightly different energy.
+
+  const KPhaseSpace & kps = in->PhaseSpace();
+  Range1D_t Q2 = kps.Q2Lim();
+  if(Q2.min <= 0. || Q2.min >= Q2.max) return 0.;
+
+  Interaction * interaction = new Interaction(*in);
+  interaction->SetBit(kISkipProcessChk);
+  interaction->SetBit(kISkipKinematicChk);
+
+  ROOT::Math::IBaseFunctionOneDim * xsec_func =
+      new utils::gsl::dXSec_dQ2_E(fXSecModel, interaction,-1.);
+  ROOT::Math::BrentMinimizer1D minimizer;
+  minimizer.SetFunction(*xsec_func,Q2.min,Q2.max);
+  minimizer.Minimize(1000,1,1E-5);
+  double Q2_for_xsec_max = minimizer.XMinimum();
+  interaction->KinePtr()->SetQ2(Q2_for_xsec_max);
+  double xsec_max = this->XSec(interaction, kPSQ2fE);
+  delete xsec_func;
+
+  LOG("CEvNS", pNOTICE)
+    << "Maximizing dsig(Q2;E = " << this->Energy(in) << "GeV)/dQ2 gave a value of "
+    << xsec_max/(units::cm2) << " cm2/GeV^2 at Q2 = "
+    << Q2_for_xsec_max << " GeV^2";
+
+  delete interaction;
+
+  return fSafetyFactor * xsec_max;
+}
+//___________________________________________________________________________
+double CEvNSEventGenerator::Energy(const Interaction * interaction) const
+{
+  // Override the base class Energy() method to cache the max xsec for the
+  // neutrino energy in the LAB rather than in the hit nucleon rest frame.
+
+  const InitialState & init_state = interaction->InitState();
+  double E = init_state.ProbeE(kRfLab);
+  return E;
+}
+//____________________________________________________________________________
@@ -5,6 +5,9 @@
 
 \brief    Generates complete CEvNS events.
           Is a concrete implementation of the EventRecordVisitorI interface.
+          The max dsig/dQ2 of the rejection method is cached per energy
+          (see KineGeneratorWithCache) rather than searched for at every
+          event.
 
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
@@ -19,14 +22,12 @@
 #ifndef _CEVNS_EVENT_GENERATOR_H_
 #define _CEVNS_EVENT_GENERATOR_H_
 
-#include "Framework/EventGen/EventRecordVisitorI.h"
+#include "Physics/Common/KineGeneratorWithCache.h"
 #include "Framework/Utils/Range1.h"
 
 namespace genie {
 
-class XSecAlgorithmI;
-
-class CEvNSEventGenerator : public EventRecordVisitorI {
+class CEvNSEventGenerator : public KineGeneratorWithCache {
 
 public :
   CEvNSEventGenerator();
@@ -51,11 +52,10 @@ public:
   void AddFinalStateNeutrino (GHepRecord * event) const;
   void AddRecoilNucleus      (GHepRecord * event) const;
 
-  mutable const XSecAlgorithmI * fXSecModel; ///<
-
-  bool   fGenerateUniformly;    ///<
-  double fSafetyFactor;         ///<
-  double fMaxXSecDiffTolerance; ///<
+  // Overload KineGeneratorWithCache methods to compute the max xsec and to
+  // cache it for the neutrino energy in the LAB
+  double ComputeMaxXSec (const Interaction * in) const;
+  double Energy         (const Interaction * in) const;
 };
 
 }      // genie namespace
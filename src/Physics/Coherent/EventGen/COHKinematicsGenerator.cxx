@@ -9,6 +9,9 @@
 //____________________________________________________________________________
 
 #include <cstdlib>
+#include <sstream>
+#include <map>
+#include <mutex>
 
 #include <TROOT.h>
 #include <TMath.h>
@@ -29,26 +32,52 @@
 #include "Framework/GHEP/GHepRecord.h"
 #include "Framework/GHEP/GHepFlags.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/GridEnvelope2D.h"
 #include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/VegasGrid.h"
+#include "Framework/Utils/Cache.h"
+#include "Framework/Utils/CacheBranchFx.h"
 #include "Framework/Utils/KineUtils.h"
 #include "Physics/XSectionIntegration/GSLXSecFunc.h"
 
+using std::ostringstream;
+using std::map;
+
 using namespace genie;
 using namespace genie::constants;
 using namespace genie::controls;
 using namespace genie::utils;
 
+//___________________________________________________________________________
+// Importance sampling grids of the Alvarez-Ruso model, keyed by algorithm,
+// interaction and energy bin and shared by all threads.
+namespace {
+
+  const int kNoImportanceGridBin = -999999;
+
+  struct VegasGridMap : public map<string, VegasGrid *> {
+    ~VegasGridMap() {
+      for(iterator iter = begin(); iter != end(); ++iter) delete iter->second;
+    }
+  };
+
+  VegasGridMap gISGrids;
+  std::mutex   gISGridMutex;
+}
+
 //___________________________________________________________________________
 COHKinematicsGenerator::COHKinematicsGenerator() :
   KineGeneratorWithCache("genie::COHKinematicsGenerator")
 {
   fEnvelope = 0;
+  fARImportanceSampling = false;
 }
 //___________________________________________________________________________
 COHKinematicsGenerator::COHKinematicsGenerator(string config) :
   KineGeneratorWithCache("genie::COHKinematicsGenerator", config)
 {
   fEnvelope = 0;
+  fARImportanceSampling = false;
 }
 //___________________________________________________________________________
 COHKinematicsGenerator::~COHKinematicsGenerator()
@@ -58,6 +87,8 @@ COHKinematicsGenerator::~COHKinematicsGenerator()
 //___________________________________________________________________________
 void COHKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 {
+  StatsScope stats(this, evrec);
+
   if(fGenerateUniformly) {
     LOG("COHKinematics", pNOTICE)
       << "Generating kinematics uniformly over the allowed phase space";
@@ -98,8 +129,15 @@ void COHKinematicsGenerator::CalculateKin_BergerSehgal(GHepRecord * evrec) const
   //   cache. Throw an exception and quit the evg thread if a non-positive
   //   value is found.
   //
+  //   If configured, (Q2,y) are instead sampled from a grid envelope (built
+  //   once per energy bin and cached), and the max xsec is not needed.
+  //
   //   TODO: We are not offering the "fGenerateUniformly" option here.
-  double xsec_max = this->MaxXSec(evrec);
+  const GridEnvelope2D * grid = this->Envelope(interaction);
+  Range1D_t gridQ2, gridy;
+  if(grid && !this->EnvelopeLimits(interaction, gridQ2, gridy)) grid = 0;
+
+  double xsec_max = (grid) ? -1 : this->MaxXSec(evrec);
 
   //-- Get the kinematical limits for the generated x,y
   const KPhaseSpace & kps = interaction->PhaseSpace();
@@ -122,12 +160,19 @@ void COHKinematicsGenerator::CalculateKin_BergerSehgal(GHepRecord * evrec) const
     iter++;
     if(iter > kRjMaxIterations) this->throwOnTooManyIterations(iter,evrec);
 
-    //-- Select unweighted kinematics using importance sampling method.
-    // TODO: The importance sampling envelope is not used. Currently,
-    // we just employ a standard rejection-method approach.
-
-    gy  = ymin  + dy  * rnd->RndKine().Rndm();
-    gQ2 = Q2min + dQ2 * rnd->RndKine().Rndm();
+    //-- Select unweighted kinematics using the grid envelope, if any, or
+    // else a standard rejection-method approach with a flat max xsec.
+    double max = xsec_max;
+    if(grid) {
+      double u = -1, v = -1;
+      max = grid->Sample(rnd->RndKine().Rndm(),
+                rnd->RndKine().Rndm(), rnd->RndKine().Rndm(), u, v);
+      gQ2 = gridQ2.min + u * (gridQ2.max - gridQ2.min);
+      gy  = gridy.min  + v * (gridy.max  - gridy.min);
+    } else {
+      gy  = ymin  + dy  * rnd->RndKine().Rndm();
+      gQ2 = Q2min + dQ2 * rnd->RndKine().Rndm();
+    }
 
     LOG("COHKinematics", pINFO) <<
       "Trying: Q^2 = " << gQ2 << ", y = " << gy; /* << ", t = " << gt; */
@@ -137,10 +182,11 @@ void COHKinematicsGenerator::CalculateKin_BergerSehgal(GHepRecord * evrec) const
     kinematics::UpdateXFromQ2Y(interaction);
 
     // computing cross section for the current kinematics
-    xsec = fXSecModel->XSec(interaction, kPSQ2yfE);
+    xsec = this->XSec(interaction, kPSQ2yfE);
 
     //-- decide whether to accept the current kinematics
-    accept = (xsec_max * rnd->RndKine().Rndm() < xsec);
+    if(grid) this->AssertXSecLimits(interaction, xsec, max);
+    accept = (max * rnd->RndKine().Rndm() < xsec);
 
     //-- If the generated kinematics are accepted, finish-up module's job
     if(accept) {
@@ -257,7 +303,7 @@ void COHKinematicsGenerator::CalculateKin_BergerSehgalFM(GHepRecord * evrec) con
     interaction->KinePtr()->SetQ2(gQ2);
 
     // computing cross section for the current kinematics
-    xsec = fXSecModel->XSec(interaction, kPSxyfE);
+    xsec = this->XSec(interaction, kPSxyfE);
 
     //-- decide whether to accept the current kinematics
     accept = (xsec_max * rnd->RndKine().Rndm() < xsec);
@@ -355,7 +401,7 @@ void COHKinematicsGenerator::CalculateKin_ReinSehgal(GHepRecord * evrec) const
     interaction->KinePtr()->Sety(gy);
 
     // computing cross section for the current kinematics
-    xsec = fXSecModel->XSec(interaction, kPSxyfE);
+    xsec = this->XSec(interaction, kPSxyfE);
 
     //-- decide whether to accept the current kinematics
     if(!fGenerateUniformly) {
@@ -457,44 +503,46 @@ void COHKinematicsGenerator::CalculateKin_AlvarezRuso(GHepRecord * evrec) const
   //   value is found.
   //   If the kinematics are generated uniformly over the allowed phase
   //   space the max xsec is irrelevant
+  //   With importance sampling, the points are sampled from an adapted grid
+  //   and the max xsec is the max weight xsec*J of the sampled points.
   double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+  const VegasGrid * grid =
+       (fGenerateUniformly) ? 0 : this->ImportanceGrid(interaction);
 
-  //Set up limits of integration variables
-  // Primary lepton energy
-  const double E_l_min = interaction->FSPrimLepton()->Mass();
-  const double E_l_max = interaction->InitStatePtr()->GetProbeP4(kRfLab)->E() - kPionMass;
-  // Primary lepton angle with respect to the beam axis
-  const double ctheta_l_min = 0.4;
-  const double ctheta_l_max = 1.0 - kASmallNum;
-  // Pion angle with respect to the beam axis
-  const double ctheta_pi_min = 0.4;
-  const double ctheta_pi_max = 1.0 - kASmallNum;
-  // Pion angle transverse to the beam axis
+  // Lepton azimuth (the pion azimuth is sampled relative to it)
   const double phi_min = kASmallNum;
   const double phi_max = (2.0 * kPi) - kASmallNum;
-  //
-  const double d_E_l = E_l_max - E_l_min;
-  const double d_ctheta_l  = ctheta_l_max  - ctheta_l_min;
-  const double d_ctheta_pi = ctheta_pi_max - ctheta_pi_min;
   const double d_phi = phi_max - phi_min;
 
   //------ Try to select a valid set of kinematics
   unsigned int iter = 0;
   bool accept=false;
   double xsec=-1, g_E_l=-1, g_theta_l=-1, g_phi_l=-1, g_theta_pi=-1, g_phi_pi=-1;
-  double g_ctheta_l, g_ctheta_pi;
+  double g_ctheta_l, g_ctheta_pi, g_dphi_pi, vol=0;
 
   while(1) {
     iter++;
     if(iter > kRjMaxIterations) this->throwOnTooManyIterations(iter,evrec);
 
-    //Select kinematic point
-    g_E_l = E_l_min + d_E_l * rnd->RndKine().Rndm();
-    g_ctheta_l  = ctheta_l_min  + d_ctheta_l  * rnd->RndKine().Rndm();
-    g_ctheta_pi = ctheta_pi_min + d_ctheta_pi * rnd->RndKine().Rndm();
+    //Select kinematic point in the unit hypercube
+    double r[4], u[4];
+    unsigned int bins[4];
+    r[0] = rnd->RndKine().Rndm();
+    r[1] = rnd->RndKine().Rndm();
+    r[2] = rnd->RndKine().Rndm();
     g_phi_l = phi_min + d_phi * rnd->RndKine().Rndm();
+    r[3] = rnd->RndKine().Rndm();
+
+    double J = 1.;
+    if(grid) {
+      J = grid->Map(r, u, bins);
+    } else {
+      for(int i = 0; i < 4; i++) u[i] = r[i];
+    }
+    vol = this->UnitToKin_AlvarezRuso(interaction, u,
+                             g_E_l, g_ctheta_l, g_ctheta_pi, g_dphi_pi);
     // random phi is relative to phi_l
-    g_phi_pi = g_phi_l + (phi_min + d_phi * rnd->RndKine().Rndm());
+    g_phi_pi = g_phi_l + g_dphi_pi;
     g_theta_l = TMath::ACos(g_ctheta_l);
     g_theta_pi = TMath::ACos(g_ctheta_pi);
 
@@ -506,21 +554,22 @@ void COHKinematicsGenerator::CalculateKin_AlvarezRuso(GHepRecord * evrec) const
                         interaction, interaction->KinePtr());
 
     // computing cross section for the current kinematics
-    xsec = fXSecModel->XSec(interaction,kPSElOlOpifE) / (1E-38 * units::cm2);
+    xsec = this->XSec(interaction,kPSElOlOpifE) / (1E-38 * units::cm2);
 
     if (!fGenerateUniformly) {
       //-- decide whether to accept the current kinematics
+      double w   = xsec * J;
       double t   = xsec_max * rnd->RndKine().Rndm();
 
-      LOG("COHKinematics", pINFO) << "Got: xsec = " << xsec << ", t = " <<
-        t << " (max_xsec = " << xsec_max << ")";
+      LOG("COHKinematics", pINFO) << "Got: xsec = " << xsec << ", J = " <<
+        J << ", t = " << t << " (max_xsec = " << xsec_max << ")";
 
-      this->AssertXSecLimits(interaction, xsec, xsec_max);
+      this->AssertXSecLimits(interaction, w, xsec_max);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
       LOG("COHKinematics", pDEBUG)
-        << "xsec= " << xsec << ", J= 1, Rnd= " << t;
+        << "xsec= " << xsec << ", J= " << J << ", Rnd= " << t;
 #endif
-      accept = (t<xsec);
+      accept = (t<w);
     }
     else {
       accept = (xsec>0);
@@ -564,7 +613,6 @@ void COHKinematicsGenerator::CalculateKin_AlvarezRuso(GHepRecord * evrec) const
       // wght = (phase space volume)*(differential xsec)/(event total xsec)
       if(fGenerateUniformly) {
         // Phase space volume needs checking
-        double vol     = d_E_l*d_ctheta_l*d_phi*d_ctheta_pi*d_phi;
         double totxsec = evrec->XSec();
         double wght    = (vol/totxsec)*xsec;
         LOG("COHKinematics", pNOTICE)  << "Kinematics wght = "<< wght;
@@ -684,7 +732,8 @@ double COHKinematicsGenerator::ComputeMaxXSec(const Interaction * in) const
   } else if ((fXSecModel->Id().Name() == "genie::BergerSehgalFMCOHPiPXSec2015")) {
     max_xsec = MaxXSec_BergerSehgalFM(in);
   } else if ((fXSecModel->Id().Name() == "genie::AlvarezRusoCOHPiPXSec")) {
-    max_xsec = MaxXSec_AlvarezRuso(in);
+    const VegasGrid * grid = this->ImportanceGrid(in);
+    max_xsec = (grid) ? MaxWeight_AlvarezRuso(in, *grid) : MaxXSec_AlvarezRuso(in);
   }
   else {
     LOG("COHKinematicsGenerator",pFATAL) <<
@@ -740,7 +789,7 @@ double COHKinematicsGenerator::MaxXSec_BergerSehgal(const Interaction * in) cons
       kinematics::UpdateXFromQ2Y(in);
 
       // Note: We're not stepping through log Q^2, log y - we "unpacked"
-      double xsec = fXSecModel->XSec(in, kPSQ2yfE);
+      double xsec = this->XSec(in, kPSQ2yfE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
       LOG("COHKinematics", pDEBUG)
         << "xsec(Q2= " << Q2 << ", y= " << gy << ", t = " << gt << ") = " << xsec;
@@ -793,7 +842,7 @@ double COHKinematicsGenerator::MaxXSec_BergerSehgalFM(const Interaction * in) co
         in->KinePtr()->Sety(gy);
         in->KinePtr()->Sett(gt);
 
-        double xsec = fXSecModel->XSec(in, kPSxyfE);
+        double xsec = this->XSec(in, kPSxyfE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
         LOG("COHKinematics", pDEBUG)
           << "xsec(Q2= " << Q2 << ", y= " << gy << ", t = " << gt << ") = " << xsec;
@@ -836,7 +885,7 @@ double COHKinematicsGenerator::MaxXSec_ReinSehgal(const Interaction * in) const
       in->KinePtr()->Setx(gx);
       in->KinePtr()->Sety(gy);
 
-      double xsec = fXSecModel->XSec(in, kPSxyfE);
+      double xsec = this->XSec(in, kPSxyfE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
       LOG("COHKinematics", pDEBUG)
         << "xsec(x= " << gx << ", y= " << gy << ") = " << xsec;
@@ -928,6 +977,280 @@ double COHKinematicsGenerator::Energy(const Interaction * interaction) const
   return E;
 }
 //___________________________________________________________________________
+string COHKinematicsGenerator::CacheBranchName(const Interaction * in) const
+{
+  // With importance sampling, the Alvarez-Ruso model caches the max weight of
+  // the points sampled from the grid of each energy bin, in its own branch.
+
+  if(!fXSecModel || fXSecModel->Id().Name() != "genie::AlvarezRusoCOHPiPXSec") {
+    return KineGeneratorWithCache::CacheBranchName(in);
+  }
+  int ibin = this->ImportanceGridBin(in);
+  if(ibin == kNoImportanceGridBin) return KineGeneratorWithCache::CacheBranchName(in);
+
+  ostringstream name;
+  name << KineGeneratorWithCache::CacheBranchName(in) << ";IS-bin:" << ibin;
+  return name.str();
+}
+//___________________________________________________________________________
+int COHKinematicsGenerator::CacheBranchBin(const Interaction * in) const
+{
+  if(!fXSecModel || fXSecModel->Id().Name() != "genie::AlvarezRusoCOHPiPXSec") {
+    return kNoCacheBranchBin;
+  }
+  int ibin = this->ImportanceGridBin(in);
+  return (ibin == kNoImportanceGridBin) ? kNoCacheBranchBin : ibin;
+}
+//___________________________________________________________________________
+bool COHKinematicsGenerator::EnvelopeLimits(
+   const Interaction * interaction, Range1D_t & Q2l, Range1D_t & yl) const
+{
+  // The Berger-Sehgal (Q2,y) are sampled over the same box as with a flat
+  // max xsec: (Q2,y) pairs outside the allowed phase space have a null cross
+  // section and are rejected. The t dependence is integrated out and t is
+  // generated from its exponential form once (Q2,y) are selected.
+  // No envelope is used for the other models.
+
+  if(!fXSecModel ||
+      fXSecModel->Id().Name() != "genie::BergerSehgalCOHPiPXSec2015") {
+    return false;
+  }
+
+  const KPhaseSpace & kps = interaction->PhaseSpace();
+  Range1D_t y = kps.YLim();
+  if(!(y.min>0. && y.max>0. && y.min<1. && y.max<1. && y.min<y.max)) {
+    return false;
+  }
+
+  Q2l.min = fQ2Min + kASmallNum;
+  Q2l.max = fQ2Max - kASmallNum;
+  yl.min  = y.min  + kASmallNum;
+  yl.max  = y.max  - kASmallNum;
+  return (Q2l.min < Q2l.max && yl.min < yl.max);
+}
+//___________________________________________________________________________
+double COHKinematicsGenerator::EnvelopeXSec(
+              const Interaction * interaction, double Q2, double y) const
+{
+  interaction->KinePtr()->Sety(y);
+  interaction->KinePtr()->SetQ2(Q2);
+  kinematics::UpdateXFromQ2Y(interaction);
+
+  double xsec = this->XSec(interaction, kPSQ2yfE);
+  return TMath::Max(0., xsec);
+}
+//___________________________________________________________________________
+double COHKinematicsGenerator::UnitToKin_AlvarezRuso(
+          const Interaction * in, const double * u, double & E_l,
+          double & ctheta_l, double & ctheta_pi, double & dphi_pi) const
+{
+  // Maps a point of the unit hypercube onto the lepton energy, the lepton and
+  // pion polar angle cosines and the pion azimuth relative to the lepton.
+  // Returns the volume of the sampled phase space (incl. the lepton azimuth).
+
+  //Set up limits of integration variables
+  // Primary lepton energy
+  const double E_l_min = in->FSPrimLepton()->Mass();
+  const double E_l_max = in->InitState().ProbeE(kRfLab) - kPionMass;
+  // Primary lepton angle with respect to the beam axis
+  const double ctheta_l_min = 0.4;
+  const double ctheta_l_max = 1.0 - kASmallNum;
+  // Pion angle with respect to the beam axis
+  const double ctheta_pi_min = 0.4;
+  const double ctheta_pi_max = 1.0 - kASmallNum;
+  // Pion angle transverse to the beam axis
+  const double phi_min = kASmallNum;
+  const double phi_max = (2.0 * kPi) - kASmallNum;
+  //
+  const double d_E_l = E_l_max - E_l_min;
+  const double d_ctheta_l  = ctheta_l_max  - ctheta_l_min;
+  const double d_ctheta_pi = ctheta_pi_max - ctheta_pi_min;
+  const double d_phi = phi_max - phi_min;
+
+  E_l       = E_l_min       + d_E_l       * u[0];
+  ctheta_l  = ctheta_l_min  + d_ctheta_l  * u[1];
+  ctheta_pi = ctheta_pi_min + d_ctheta_pi * u[2];
+  dphi_pi   = phi_min       + d_phi       * u[3];
+
+  return d_E_l*d_ctheta_l*d_phi*d_ctheta_pi*d_phi;
+}
+//___________________________________________________________________________
+int COHKinematicsGenerator::ImportanceGridBin(const Interaction * in) const
+{
+  // Energy bin of the importance sampling grid for the input interaction, or
+  // kNoImportanceGridBin if importance sampling is not used
+
+  if(!fARImportanceSampling) return kNoImportanceGridBin;
+
+  double E = this->Energy(in);
+  if(E < fEMin || E <= 0.) return kNoImportanceGridBin;
+
+  return TMath::FloorNint(fARISNEnergyBins * TMath::Log10(E));
+}
+//___________________________________________________________________________
+const VegasGrid * COHKinematicsGenerator::ImportanceGrid(
+                                               const Interaction * in) const
+{
+  // Returns the importance sampling grid for the energy bin of the input
+  // interaction. The grid is trained at the first pass and its bin edges are
+  // saved in the cache, so that they are also stored in the cache file, if
+  // any, and re-used by subsequent jobs. Returns 0 if importance sampling is
+  // not used or if the grid could not be trained.
+
+  int ibin = this->ImportanceGridBin(in);
+  if(ibin == kNoImportanceGridBin) return 0;
+
+  ostringstream name;
+  name << in->AsString() << ";IS-grid:" << ibin;
+
+  Cache * cache = Cache::Instance();
+  string key = cache->CacheBranchKey(this->Id().Key(), name.str());
+
+  {
+    std::lock_guard<std::mutex> lock(gISGridMutex);
+    VegasGridMap::const_iterator iter = gISGrids.find(key);
+    if(iter != gISGrids.end()) return iter->second;
+  }
+
+  const unsigned int ndim  = 4;
+  const unsigned int nbins = TMath::Max(fARISNBins, 1);
+
+  // restore the grid from the cache or else train it (without holding the
+  // lock: another thread may do the same, in which case the first one stored
+  // is kept)
+  VegasGrid * grid = 0;
+  CacheBranchFx * cb =
+            dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
+  if(cb && cb->Map().size() == ndim*(nbins+1)) {
+    grid = new VegasGrid(ndim, nbins);
+    map<double,double>::const_iterator e_iter = cb->Map().begin();
+    for(unsigned int idim = 0; idim < ndim; idim++) {
+      for(unsigned int i = 0; i <= nbins; i++, ++e_iter) {
+        grid->SetEdge(idim, i, e_iter->second);
+      }
+    }
+    LOG("COHKinematics", pNOTICE)
+      << "Restored importance sampling grid from the cache - key = " << key;
+  } else {
+    double Emax = TMath::Power(10., (ibin+1) / fARISNEnergyBins);
+    LOG("COHKinematics", pNOTICE)
+      << "Training importance sampling grid at E = " << Emax
+      << " GeV - key = " << key;
+    grid = this->TrainImportanceGrid(in, Emax);
+  }
+
+  std::lock_guard<std::mutex> lock(gISGridMutex);
+  VegasGridMap::iterator iter = gISGrids.find(key);
+  if(iter != gISGrids.end()) {
+    delete grid;
+    return iter->second;
+  }
+  gISGrids[key] = grid;
+
+  // save the edges of a newly trained grid (replacing the edges of a grid
+  // with another number of bins, read from the cache file)
+  bool save = grid && (!cb || cb->Map().size() != ndim*(nbins+1));
+  if(save) {
+    bool add = (cb == 0);
+    if(add) cb = new CacheBranchFx("importance sampling grid edges");
+    else    cb->Reset();
+    for(unsigned int idim = 0; idim < ndim; idim++) {
+      for(unsigned int i = 0; i <= nbins; i++) {
+        cb->AddValues(idim*(nbins+1) + i, grid->Edge(idim,i));
+      }
+    }
+    if(add) cache->AddCacheBranch(key, cb);
+  }
+  return grid;
+}
+//___________________________________________________________________________
+VegasGrid * COHKinematicsGenerator::TrainImportanceGrid(
+                                    const Interaction * in, double E) const
+{
+  // Adapts a VEGAS grid to the Alvarez-Ruso cross section at energy E.
+  // Returns 0 if no positive cross section was found.
+
+  TLorentzVector * p4 = in->InitState().GetProbeP4(kRfLab);
+  TLorentzVector p4e = (*p4) * (E/p4->E());
+  delete p4;
+
+  Interaction * interaction = new Interaction(*in);
+  interaction->SetBit(kISkipProcessChk);
+  interaction->SetBit(kISkipKinematicChk);
+  interaction->InitStatePtr()->SetProbeP4(p4e);
+
+  VegasGrid * grid = new VegasGrid(4, TMath::Max(fARISNBins, 1));
+
+  unsigned int bins[4];
+  bool found = false;
+  for(int iter = 0; iter < fARISNIterations; iter++) {
+    for(int ip = 0; ip < fARISNPoints; ip++) {
+      double w = this->ImportanceWeight(interaction, *grid, bins);
+      grid->Accumulate(bins, w);
+      found = found || (w > 0.);
+    }
+    grid->Adapt();
+  }
+  delete interaction;
+
+  if(!found) {
+    LOG("COHKinematics", pWARN)
+      << "Null cross section while training importance sampling grid for "
+      << in->AsString() << " at E = " << E << " GeV";
+    delete grid;
+    return 0;
+  }
+  return grid;
+}
+//___________________________________________________________________________
+double COHKinematicsGenerator::ImportanceWeight(const Interaction * in,
+                      const VegasGrid & grid, unsigned int * bins) const
+{
+  // Samples a point from the grid and returns its weight xsec*J
+
+  RandomGen * rnd = RandomGen::Instance();
+
+  double r[4], u[4];
+  for(int i = 0; i < 4; i++) r[i] = rnd->RndKine().Rndm();
+  double J = grid.Map(r, u, bins);
+
+  double E_l, ctheta_l, ctheta_pi, dphi_pi;
+  this->UnitToKin_AlvarezRuso(in, u, E_l, ctheta_l, ctheta_pi, dphi_pi);
+
+  // the cross section does not depend on the lepton azimuth
+  this->SetKinematics(E_l, TMath::ACos(ctheta_l), 0.,
+                      TMath::ACos(ctheta_pi), dphi_pi, in, in->KinePtr());
+
+  double xsec = this->XSec(in,kPSElOlOpifE) / (1E-38 * units::cm2);
+  return xsec * J;
+}
+//___________________________________________________________________________
+double COHKinematicsGenerator::MaxWeight_AlvarezRuso(
+                    const Interaction * in, const VegasGrid & grid) const
+{
+  // The largest weight xsec*J found among points sampled from the grid. It is
+  // used (times the safety factor) as the max xsec in the final rejection
+  // step which turns the importance-sampled points into unit-weight events.
+
+  Interaction * interaction = new Interaction(*in);
+  interaction->SetBit(kISkipProcessChk);
+  interaction->SetBit(kISkipKinematicChk);
+
+  unsigned int bins[4];
+  double max_weight = 0.;
+  for(int ip = 0; ip < fARISNPoints; ip++) {
+    max_weight = TMath::Max(max_weight,
+                   this->ImportanceWeight(interaction, grid, bins));
+  }
+  delete interaction;
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  SLOG("COHKinematics", pDEBUG)
+    << "Max importance sampling weight = " << max_weight;
+#endif
+  return max_weight;
+}
+//___________________________________________________________________________
 double COHKinematicsGenerator::pionMass(const Interaction* in) const
 {
   double m_pi = 0.0;
@@ -994,5 +1317,16 @@ void COHKinematicsGenerator::LoadConfig(void)
                       kinematics::COHImportanceSamplingEnvelope,0.,1,0.,1,2);
   // stop ROOT from deleting this object of its own volition
   gROOT->GetListOfFunctions()->Remove(fEnvelope);
+
+  //-- Importance sampling of the Alvarez-Ruso model kinematics
+  GetParamDef( "AR-ImportanceSampling",                     fARImportanceSampling, false ) ;
+  GetParamDef( "AR-ImportanceSampling-NBins",               fARISNBins,            20    ) ;
+  GetParamDef( "AR-ImportanceSampling-NIterations",         fARISNIterations,      5     ) ;
+  GetParamDef( "AR-ImportanceSampling-NPoints",             fARISNPoints,          2000  ) ;
+  GetParamDef( "AR-ImportanceSampling-EnergyBinsPerDecade", fARISNEnergyBins,      10.   ) ;
+  assert(fARISNEnergyBins > 0.);
+
+  //-- Grid envelope for the Berger-Sehgal (Q2,y)
+  this->LoadEnvelopeConfig();
 }
 //____________________________________________________________________________
@@ -27,6 +27,8 @@ class TF2;
 
 namespace genie {
 
+  class VegasGrid;
+
   class COHKinematicsGenerator : public KineGeneratorWithCache {
 
   public :
@@ -67,6 +69,16 @@ namespace genie {
     // overload KineGeneratorWithCache method to get energy
     double Energy         (const Interaction * in) const;
 
+    // overload KineGeneratorWithCache method to keep the max weights of the
+    // Alvarez-Ruso importance sampling apart from the max xsec
+    string CacheBranchName (const Interaction * in) const;
+    int    CacheBranchBin  (const Interaction * in) const;
+
+    // overload KineGeneratorWithCache methods to sample the Berger-Sehgal
+    // (Q2,y) from a grid envelope
+    bool   EnvelopeLimits  (const Interaction * in, Range1D_t & Q2l, Range1D_t & yl) const;
+    double EnvelopeXSec    (const Interaction * in, double Q2, double y) const;
+
     // TODO: should fEnvelope and fRo be public? They look like they should be private
     mutable TF2 * fEnvelope; ///< 2-D envelope used for importance sampling
     double fRo;              ///< nuclear scale parameter
@@ -75,9 +87,26 @@ namespace genie {
     double pionMass(const Interaction* in) const;
     void   throwOnTooManyIterations(unsigned int iters, GHepRecord* evrec) const;
 
+    // importance sampling of the Alvarez-Ruso model kinematics
+    double            UnitToKin_AlvarezRuso (const Interaction * in, const double * u,
+                                             double & E_l, double & ctheta_l,
+                                             double & ctheta_pi, double & dphi_pi) const;
+    int               ImportanceGridBin     (const Interaction * in) const;
+    const VegasGrid * ImportanceGrid        (const Interaction * in) const;
+    VegasGrid *       TrainImportanceGrid   (const Interaction * in, double E) const;
+    double            ImportanceWeight      (const Interaction * in, const VegasGrid & grid,
+                                             unsigned int * bins) const;
+    double            MaxWeight_AlvarezRuso (const Interaction * in, const VegasGrid & grid) const;
+
     double fQ2Min;  ///< lower bound of integration for Q^2 in Berger-Sehgal Model
     double fQ2Max;  ///< upper bound of integration for Q^2 in Berger-Sehgal Model
     double fTMax;   ///< upper bound for t = (q - p_pi)^2
+
+    bool   fARImportanceSampling; ///< sample the Alvarez-Ruso kinematics from an adapted VEGAS grid?
+    int    fARISNBins;            ///< number of importance grid bins per kinematic variable
+    int    fARISNIterations;      ///< number of importance grid training passes
+    int    fARISNPoints;          ///< number of points per training pass and for the max weight
+    double fARISNEnergyBins;      ///< number of importance grid energy bins per decade
   };
 
 }      // genie namespace
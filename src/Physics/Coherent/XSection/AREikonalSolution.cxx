@@ -25,6 +25,29 @@ namespace alvarezruso {
 cdouble AREikonalSolution::Element(const double radius, const double cosine_rz,
                                    const double e_pion)
 {
+  return this->Element(radius, cosine_rz, e_pion,
+                       this->OpticalPhase(radius, cosine_rz, e_pion));
+}
+
+cdouble AREikonalSolution::Element(const double radius, const double cosine_rz,
+                                   const double e_pion, const cdouble & phase)
+{
+  const double mpik = this->Parent()->GetPiMass();
+  const double mpi = this->Con()->PiPMass();
+  const double hb = this->Con()->HBar() * 1000.0;
+
+  const double ekin = (e_pion - mpik) * hb;
+  const double za = radius * cosine_rz;
+  const double omepi = ekin / hb + mpi;
+  const double ppim = TMath::Sqrt(omepi*omepi - mpi*mpi);
+
+  // Eikonal approximation to the wave function
+  return exp( - cdouble(0,1) * ( ppim*za + phase ) );
+}
+
+cdouble AREikonalSolution::OpticalPhase(const double radius, const double cosine_rz,
+                                        const double e_pion)
+{
 
   const double mpik = this->Parent()->GetPiMass();
   const double mpi = this->Con()->PiPMass();
@@ -86,12 +109,9 @@ cdouble AREikonalSolution::Element(const double radius, const double cosine_rz,
   //Integrate the optical potential through the nucleus
   cdouble resu = integrationtools::RGN1D(za, rmax, nz, sampling, ordez);
 
-  // Eikonal approximation to the wave function
-  cdouble uwaveik = exp( - cdouble(0,1) * ( ppim*za + resu ) );
-
   delete [] ordez; // CA
 
-  return uwaveik;
+  return resu;
 }
 
 
@@ -260,7 +280,7 @@ AREikonalSolution::AREikonalSolution(bool debug, AlvarezRusoCOHPiPDXSec* parent)
   owns_constants = false;
 }
 
-AREikonalSolution::AREikonalSolution(bool debug, ARSampledNucleus* nucl): ARWFSolution(debug), fNucleus(nucl)
+AREikonalSolution::AREikonalSolution(bool debug, const ARSampledNucleus* nucl): ARWFSolution(debug), fNucleus(nucl)
 {
   if( debug_ ) std::cerr << "AREikonalSolution::AREikonalSolution" << std::endl;
   this->constants_ = new ARConstants();
@@ -36,17 +36,24 @@ class AREikonalSolution: public ARWFSolution
   public:
 
     AREikonalSolution(bool debug, AlvarezRusoCOHPiPDXSec* parent);
-    AREikonalSolution(bool debug, ARSampledNucleus* nucl);
+    AREikonalSolution(bool debug, const ARSampledNucleus* nucl);
 
     virtual ~AREikonalSolution();
     virtual std::complex<double>  Element(const double radius, const double cosine_rz,
                  const double e_pion);
     void Solve();
 
+    // Wavefunction for the given integral of the optical potential
+    std::complex<double>  Element(const double radius, const double cosine_rz,
+                 const double e_pion, const std::complex<double> & phase);
+    // Integral of the optical potential along the pion path
+    std::complex<double>  OpticalPhase(const double radius, const double cosine_rz,
+                 const double e_pion);
+
   private:
 
     AlvarezRusoCOHPiPDXSec* Parent() { return this->parent_; }
-    ARSampledNucleus* Nucleus() { return fNucleus; }
+    const ARSampledNucleus* Nucleus() { return fNucleus; }
     ARConstants* Con() { return this->constants_; }
 
     std::complex<double>  PionSelfEnergy(const double rhop_cent, const double rhon_cent,
@@ -58,7 +65,7 @@ class AREikonalSolution: public ARWFSolution
     double Qcm(const double s);
 
     AlvarezRusoCOHPiPDXSec* parent_;
-    ARSampledNucleus* fNucleus;
+    const ARSampledNucleus* fNucleus;
     ARConstants* constants_;
 
     bool owns_constants;
@@ -0,0 +1,117 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <mutex>
+
+#include <TMath.h>
+
+#include "Physics/Coherent/XSection/ARWFCacheBranch.h"
+
+using std::map;
+using std::vector;
+
+ClassImp(genie::alvarezruso::ARWFCacheBranch)
+
+//____________________________________________________________________________
+namespace {
+
+  const double kTpi0 = 10.; // pion kinetic energy scale of the node grid (MeV)
+
+  // node look-ups and insertions of all branches
+  std::mutex gNodeMutex;
+}
+
+namespace genie {
+namespace alvarezruso {
+
+const unsigned int ARWFCacheBranch::kNEvaluations;
+
+//____________________________________________________________________________
+ARWFCacheBranch::ARWFCacheBranch() :
+CacheBranchI(),
+fNPoints(0),
+fLogStep(0.)
+{
+
+}
+//____________________________________________________________________________
+ARWFCacheBranch::ARWFCacheBranch(unsigned int npoints, double log_step) :
+CacheBranchI(),
+fNPoints(npoints),
+fLogStep(log_step)
+{
+
+}
+//____________________________________________________________________________
+ARWFCacheBranch::~ARWFCacheBranch()
+{
+
+}
+//____________________________________________________________________________
+const double * ARWFCacheBranch::Node(int k) const
+{
+  std::lock_guard<std::mutex> lock(gNodeMutex);
+
+  map<int, vector<double> >::const_iterator iter = fNodes.find(k);
+  this->CountLookup(iter != fNodes.end());
+  if(iter == fNodes.end()) return 0;
+  return &(iter->second[0]);
+}
+//____________________________________________________________________________
+const double * ARWFCacheBranch::AddNode(int k, const vector<double> & phases)
+{
+  std::lock_guard<std::mutex> lock(gNodeMutex);
+
+  map<int, vector<double> >::iterator iter = fNodes.find(k);
+  if(iter == fNodes.end()) {
+    iter = fNodes.insert(map<int, vector<double> >::value_type(k, phases)).first;
+    this->CountInsert();
+  }
+  return &(iter->second[0]);
+}
+//____________________________________________________________________________
+int ARWFCacheBranch::NodeIndex(double tpi) const
+{
+  return TMath::FloorNint( TMath::Log(1. + TMath::Max(tpi,0.)/kTpi0) / fLogStep );
+}
+//____________________________________________________________________________
+double ARWFCacheBranch::NodeEnergy(int k) const
+{
+  return kTpi0 * (TMath::Exp(k * fLogStep) - 1.);
+}
+//____________________________________________________________________________
+void ARWFCacheBranch::Reset(void)
+{
+  std::lock_guard<std::mutex> lock(gNodeMutex);
+  fNodes.clear();
+}
+//____________________________________________________________________________
+Long64_t ARWFCacheBranch::NEntries(void) const
+{
+  std::lock_guard<std::mutex> lock(gNodeMutex);
+  return fNodes.size();
+}
+//____________________________________________________________________________
+size_t ARWFCacheBranch::ByteSize(void) const
+{
+  std::lock_guard<std::mutex> lock(gNodeMutex);
+
+  size_t nbytes = sizeof(ARWFCacheBranch);
+  map<int, vector<double> >::const_iterator iter = fNodes.begin();
+  for( ; iter != fNodes.end(); ++iter) {
+    nbytes += MapNodeSize(sizeof(map<int, vector<double> >::value_type));
+    nbytes += iter->second.capacity() * sizeof(double);
+  }
+  return nbytes;
+}
+//____________________________________________________________________________
+
+} //namespace alvarezruso
+} //namespace genie
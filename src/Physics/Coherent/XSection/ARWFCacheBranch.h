@@ -0,0 +1,90 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::alvarezruso::ARWFCacheBranch
+
+\brief    Cache branch holding the eikonal pion wavefunction phases of the
+          Alvarez-Ruso coherent pion production model for one nucleus and
+          pion mass.
+
+          The optical potential integrals (see AREikonalSolution::OpticalPhase)
+          only depend on the nucleus and the pion energy, not on the lepton
+          kinematics. They are tabulated at all nuclear sampling points on a
+          grid uniform in ln(1 + Tpi/T0) and interpolated between its nodes.
+          Nodes are filled lazily, may be shared by threads and, being part of
+          the GENIE cache, are saved to (and re-read from) the cache file, so
+          that spline generation and event generation jobs re-use them.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _AR_WF_CACHE_BRANCH_H_
+#define _AR_WF_CACHE_BRANCH_H_
+
+#include <map>
+#include <vector>
+
+#include "Framework/Utils/CacheBranchI.h"
+
+namespace genie
+{
+namespace alvarezruso
+{
+
+class ARWFCacheBranch : public genie::CacheBranchI
+{
+public:
+
+  //! wavefunction evaluations per sampling point: the wavefunction itself
+  //! and the two points of each of its radial and angular derivatives
+  static const unsigned int kNEvaluations = 5;
+
+  ARWFCacheBranch();
+  ARWFCacheBranch(unsigned int npoints, double log_step);
+  ~ARWFCacheBranch();
+
+  //! Phases (re,im pairs, see Index()) at node k or 0 if not filled yet
+  const double * Node    (int k) const;
+  //! Stores the phases of node k and returns the stored ones (those of
+  //! another thread, if it filled the node first)
+  const double * AddNode (int k, const std::vector<double> & phases);
+
+  //! Node below the input pion kinetic energy (MeV) and node energy
+  int    NodeIndex  (double tpi) const;
+  double NodeEnergy (int k)      const;
+
+  //! Position of evaluation v at sampling point (i,j) in a node
+  unsigned int Index (unsigned int i, unsigned int j, unsigned int v) const
+  {
+    return 2 * (kNEvaluations * (i * fNPoints + j) + v);
+  }
+
+  unsigned int NPoints (void) const { return fNPoints; }
+  unsigned int NValues (void) const { return 2 * kNEvaluations * fNPoints * fNPoints; }
+  double       LogStep (void) const { return fLogStep; }
+
+  void Reset (void);
+
+  Long64_t NEntries (void) const;
+  size_t   ByteSize (void) const;
+
+private:
+
+  unsigned int                        fNPoints; ///< sampling points per nuclear grid dimension
+  double                              fLogStep; ///< node spacing in ln(1 + Tpi/T0)
+  std::map<int, std::vector<double> > fNodes;   ///< node -> phases
+
+ClassDef(ARWFCacheBranch,1)
+};
+
+} //namespace alvarezruso
+} //namespace genie
+
+#endif // _AR_WF_CACHE_BRANCH_H_
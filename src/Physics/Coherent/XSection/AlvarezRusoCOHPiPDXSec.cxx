@@ -17,6 +17,7 @@
 #include <string>
 #include <cstdlib>
 #include <complex>
+#include <vector>
 
 // Root
 #include <TVector3.h>
@@ -34,6 +35,7 @@
 #include "Physics/Coherent/XSection/AlvarezRusoCOHPiPDXSec.h"
 #include "Physics/Coherent/XSection/ARSampledNucleus.h"
 #include "Physics/Coherent/XSection/AREikonalSolution.h"
+#include "Physics/Coherent/XSection/ARWFCacheBranch.h"
 #include "Framework/Numerical/IntegrationTools.h"
 #include "Physics/Coherent/XSection/ARWavefunction.h"
 
@@ -47,19 +49,22 @@ namespace genie {
 namespace alvarezruso {
 
 AlvarezRusoCOHPiPDXSec::AlvarezRusoCOHPiPDXSec(unsigned int Z_, unsigned int A_, const current_t current_,
-   const flavour_t flavour_, const nutype_t nutype_,const formfactors_t ff_)
+   const flavour_t flavour_, const nutype_t nutype_,const formfactors_t ff_,
+   const ARSampledNucleus * nucleus_)
   : debug_(false),
   fZ(Z_),
   fA(A_),
   //~ fSampling( A_ >= 56 ? 48 : 20),
-  fSampling(20),
+  fSampling( nucleus_ ? nucleus_->GetSampling() : 20 ),
   current( current_ ),
   flavour( flavour_ ),
   nutype( nutype_ ),
   formfactors( ff_ ),
   fConstants ( new ARConstants() ),
-  fNucleus   ( new ARSampledNucleus(fZ, fA, fSampling) ),
+  fNucleus   ( nucleus_ ? nucleus_ : new ARSampledNucleus(fZ, fA, fSampling) ),
+  fOwnsNucleus( nucleus_ == 0 ),
   fWfsolution ( new AREikonalSolution(debug_, this) ),
+  fWFCache    ( 0 ),
   fLastE_pi  (-9999999.),
   fUwave      ( new ARWavefunction(fSampling, debug_) ),
   fUwaveDr    ( new ARWavefunction(fSampling, debug_) ),
@@ -76,7 +81,7 @@ AlvarezRusoCOHPiPDXSec::~AlvarezRusoCOHPiPDXSec()
   delete this->fUwave;
   delete this->fUwaveDr;
   delete this->fUwaveDtheta;
-  delete this->fNucleus;
+  if (fOwnsNucleus) delete this->fNucleus;
   delete this->fConstants;
 }
 
@@ -296,63 +301,145 @@ void AlvarezRusoCOHPiPDXSec::SetCurrent()
 /// This is only a function of the nucleus and pion momentum/energy
 /// so if neither of those have changed there is no need to re-calculate
 /// the wavefunction values.
-/// Such a caching has not been implemented here yet!
+/// If a wavefunction cache is set, the integrals of the optical potential
+/// are interpolated between the tabulated pion energies instead.
 
 void AlvarezRusoCOHPiPDXSec::SolveWavefunctions()
 {
-  unsigned int n_points = fNucleus->GetNDensities();
+  if(fWFCache) {
+    this->InterpolateWavefunctions();
+    return;
+  }
 
-  double x2;
-  double radius;
-  double cosine_rz; // angle w.r.t the pion momentum
+  unsigned int n_points = fNucleus->GetNDensities();
 
-  // for calculating derivatives
+  double radius   [ARWFCacheBranch::kNEvaluations];
+  double cosine_rz[ARWFCacheBranch::kNEvaluations];
   double delta_r;
   double delta_c;
-  cdouble uwave_plus;
-  cdouble uwave_minus;
 
   // Loop over grid of points in the nuclear potential
   for(unsigned int i = 0; i != n_points; ++i)
   {
     for(unsigned int j = 0; j != n_points; ++j)
     {
-      //double x1 = fNucleus->SamplePoint1(i); // unused
-      x2 = fNucleus->SamplePoint2(j);
-
-      // radius of position in potential from centre
-      radius = fNucleus->Radius(i,j);
-      // angle of sampling point wrt to neutrino direction
-      cosine_rz = x2 / radius;
-
-      // Calculate wavefunction
-      fUwave->set(i, j, fWfsolution->Element(radius, -cosine_rz,
-                          fP_pi.E()));
-      delta_r = 0.0001;
-      if( radius < delta_r ) delta_r = radius;
-
-      // Calculate derivative of wavefunction in the radial direction
-      uwave_plus  = fWfsolution->Element( (radius+delta_r), -cosine_rz,
-                                     fP_pi.E());
-      uwave_minus = fWfsolution->Element( (radius-delta_r), -cosine_rz,
-                                     fP_pi.E());
-
-      fUwaveDr->set(i, j, (uwave_plus - uwave_minus) / (2.0 * delta_r) );
-
-      // Calculate derivative of wavefunction in the angle space
-      delta_c = 0.0001;
-      if     ( (cosine_rz - delta_c) <= -1.0 )  delta_c = cosine_rz + 1.0 - 1E-12;
-      else if( (cosine_rz + delta_c) >=  1.0 )  delta_c = 1.0 - cosine_rz - 1E-12;
-
-      uwave_plus  = fWfsolution->Element(radius, -(cosine_rz+delta_c),
-                                        fP_pi.E());
-      uwave_minus = fWfsolution->Element(radius, -(cosine_rz-delta_c),
-                                        fP_pi.E());
-      fUwaveDtheta->set( i, j, (uwave_plus - uwave_minus) / (2.0 * delta_c) );
+      this->WavefunctionPoints(i, j, radius, cosine_rz, delta_r, delta_c);
+
+      cdouble uwave[ARWFCacheBranch::kNEvaluations];
+      for(unsigned int v = 0; v != ARWFCacheBranch::kNEvaluations; ++v)
+      {
+        uwave[v] = fWfsolution->Element(radius[v], cosine_rz[v], fP_pi.E());
+      }
+
+      // Wavefunction and its derivatives in the radial direction and in
+      // the angle space
+      fUwave      ->set(i, j, uwave[0]);
+      fUwaveDr    ->set(i, j, (uwave[1] - uwave[2]) / (2.0 * delta_r) );
+      fUwaveDtheta->set(i, j, (uwave[3] - uwave[4]) / (2.0 * delta_c) );
+    }
+  }
+
+}
+
+void AlvarezRusoCOHPiPDXSec::InterpolateWavefunctions()
+{
+  unsigned int n_points = fNucleus->GetNDensities();
+
+  // bracketing nodes of the pion kinetic energy (in MeV)
+  const double tpi = (fP_pi.E() - fM_pi) * fConstants->HBar() * 1000.0;
+  const int k = fWFCache->NodeIndex(tpi);
+  const double * phase_lo = this->WFCacheNode(k);
+  const double * phase_hi = this->WFCacheNode(k+1);
+  const double t_lo = fWFCache->NodeEnergy(k);
+  const double t_hi = fWFCache->NodeEnergy(k+1);
+  const double f = (tpi - t_lo) / (t_hi - t_lo);
+
+  double radius   [ARWFCacheBranch::kNEvaluations];
+  double cosine_rz[ARWFCacheBranch::kNEvaluations];
+  double delta_r;
+  double delta_c;
+
+  for(unsigned int i = 0; i != n_points; ++i)
+  {
+    for(unsigned int j = 0; j != n_points; ++j)
+    {
+      this->WavefunctionPoints(i, j, radius, cosine_rz, delta_r, delta_c);
+
+      cdouble uwave[ARWFCacheBranch::kNEvaluations];
+      for(unsigned int v = 0; v != ARWFCacheBranch::kNEvaluations; ++v)
+      {
+        const unsigned int idx = fWFCache->Index(i,j,v);
+        cdouble phase( (1.0-f) * phase_lo[idx]   + f * phase_hi[idx],
+                       (1.0-f) * phase_lo[idx+1] + f * phase_hi[idx+1] );
+        uwave[v] = fWfsolution->Element(radius[v], cosine_rz[v], fP_pi.E(), phase);
+      }
 
+      fUwave      ->set(i, j, uwave[0]);
+      fUwaveDr    ->set(i, j, (uwave[1] - uwave[2]) / (2.0 * delta_r) );
+      fUwaveDtheta->set(i, j, (uwave[3] - uwave[4]) / (2.0 * delta_c) );
     }
   }
+}
+
+const double * AlvarezRusoCOHPiPDXSec::WFCacheNode(int k)
+{
+  const double * phases = fWFCache->Node(k);
+  if(phases) return phases;
+
+  unsigned int n_points = fNucleus->GetNDensities();
+  const double e_pi = fWFCache->NodeEnergy(k) / (fConstants->HBar() * 1000.0) + fM_pi;
+
+  double radius   [ARWFCacheBranch::kNEvaluations];
+  double cosine_rz[ARWFCacheBranch::kNEvaluations];
+  double delta_r;
+  double delta_c;
 
+  std::vector<double> values(fWFCache->NValues());
+  for(unsigned int i = 0; i != n_points; ++i)
+  {
+    for(unsigned int j = 0; j != n_points; ++j)
+    {
+      this->WavefunctionPoints(i, j, radius, cosine_rz, delta_r, delta_c);
+      for(unsigned int v = 0; v != ARWFCacheBranch::kNEvaluations; ++v)
+      {
+        const unsigned int idx = fWFCache->Index(i,j,v);
+        cdouble phase = fWfsolution->OpticalPhase(radius[v], cosine_rz[v], e_pi);
+        values[idx]   = phase.real();
+        values[idx+1] = phase.imag();
+      }
+    }
+  }
+  return fWFCache->AddNode(k, values);
+}
+
+/*
+ * Radius and cosine (w.r.t the pion momentum) of the wavefunction
+ * evaluations at sampling point (i,j): the point itself, then the points
+ * of the radial (delta_r) and angular (delta_c) derivatives.
+ */
+void AlvarezRusoCOHPiPDXSec::WavefunctionPoints(unsigned int i, unsigned int j,
+  double * radius, double * cosine_rz, double & delta_r, double & delta_c) const
+{
+  //double x1 = fNucleus->SamplePoint1(i); // unused
+  double x2 = fNucleus->SamplePoint2(j);
+
+  // radius of position in potential from centre
+  double r = fNucleus->Radius(i,j);
+  // angle of sampling point wrt to neutrino direction
+  double c = x2 / r;
+
+  delta_r = 0.0001;
+  if( r < delta_r ) delta_r = r;
+
+  delta_c = 0.0001;
+  if     ( (c - delta_c) <= -1.0 )  delta_c = c + 1.0 - 1E-12;
+  else if( (c + delta_c) >=  1.0 )  delta_c = 1.0 - c - 1E-12;
+
+  radius[0] = r;          cosine_rz[0] = -c;
+  radius[1] = r+delta_r;  cosine_rz[1] = -c;
+  radius[2] = r-delta_r;  cosine_rz[2] = -c;
+  radius[3] = r;          cosine_rz[3] = -(c+delta_c);
+  radius[4] = r;          cosine_rz[4] = -(c-delta_c);
 }
 
 cdouble AlvarezRusoCOHPiPDXSec::DeltaPropagatorInMed(LorentzVector delta_momentum)
@@ -1016,7 +1103,7 @@ ARConstants & AlvarezRusoCOHPiPDXSec::GetConstants(void)
   return *fConstants;
 }
 
-ARSampledNucleus & AlvarezRusoCOHPiPDXSec::GetNucleus(void)
+const ARSampledNucleus & AlvarezRusoCOHPiPDXSec::GetNucleus(void) const
 {
   return *fNucleus;
 }
@@ -36,7 +36,8 @@ namespace genie
 namespace alvarezruso
 {
 
-class ARWFSolution;
+class AREikonalSolution;
+class ARWFCacheBranch;
 
 enum current_t{kCC, kNC};
 enum flavour_t{kE, kMu, kTau};
@@ -49,7 +50,8 @@ class AlvarezRusoCOHPiPDXSec
 
     AlvarezRusoCOHPiPDXSec(unsigned int Z_, unsigned int A_, const current_t current_,
           const flavour_t flavour_ = kE, const nutype_t nutype = kNu,
-          const formfactors_t ff_ = kNieves);
+          const formfactors_t ff_ = kNieves,
+          const ARSampledNucleus * nucleus_ = 0);
     ~AlvarezRusoCOHPiPDXSec();
 
     // 5d cross section per nucleon
@@ -58,8 +60,12 @@ class AlvarezRusoCOHPiPDXSec
 
     void SetDebug(bool debug)  {  debug_ = debug;  };
 
-    ARConstants      & GetConstants(void);
-    ARSampledNucleus & GetNucleus  (void);
+    // Take the pion wavefunctions from (and add them to) a table of
+    // eikonal phases rather than solving them at every pion energy
+    void SetWFCache(ARWFCacheBranch * cache)  {  fWFCache = cache;  };
+
+    ARConstants            & GetConstants(void);
+    const ARSampledNucleus & GetNucleus  (void) const;
 
     int GetSampling() const {
       return fSampling;
@@ -101,6 +107,10 @@ class AlvarezRusoCOHPiPDXSec
 
         // Fill the wavefunctions
         void SolveWavefunctions();
+        void InterpolateWavefunctions();
+        const double * WFCacheNode(int k);
+        void WavefunctionPoints(unsigned int i, unsigned int j,
+             double * radius, double * cosine_rz, double & delta_r, double & delta_c) const;
 
         //______________________________________________________________
         // Properties
@@ -121,9 +131,12 @@ class AlvarezRusoCOHPiPDXSec
         // Constants
         ARConstants * fConstants;
         // Nuclear values
-        ARSampledNucleus * fNucleus;
+        const ARSampledNucleus * fNucleus;
+        bool fOwnsNucleus;
         // Wavefunction calculator
-        ARWFSolution* fWfsolution;
+        AREikonalSolution* fWfsolution;
+        // Tabulated wavefunction phases (not owned)
+        ARWFCacheBranch* fWFCache;
 
         // Kinematics of the event
         double fE_nu;     // initial neutrino energy [GeV]
@@ -9,6 +9,7 @@
 //____________________________________________________________________________
 
 #include <iostream>
+#include <sstream>
 
 #include <TMath.h>
 
@@ -22,6 +23,7 @@
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Physics/Coherent/XSection/AlvarezRusoCOHPiPXSec.h"
+#include "Framework/Utils/Cache.h"
 #include "Framework/Utils/HadXSUtils.h"
 #include "Framework/Utils/KineUtils.h"
 
@@ -29,7 +31,9 @@
 #include "Physics/Coherent/XSection/ARSampledNucleus.h"
 #include "Physics/Coherent/XSection/AlvarezRusoCOHPiPDXSec.h"
 #include "Physics/Coherent/XSection/AREikonalSolution.h"
+#include "Physics/Coherent/XSection/ARWFCacheBranch.h"
 
+using std::ostringstream;
 
 using namespace genie;
 using namespace genie::constants;
@@ -42,19 +46,19 @@ AlvarezRusoCOHPiPXSec::AlvarezRusoCOHPiPXSec() :
 XSecAlgorithmI("genie::AlvarezRusoCOHPiPXSec")
 {
   fMultidiff = NULL;
-  fLastInteraction = NULL;
+  fMultidiffKey = -1;
 }
 //____________________________________________________________________________
 AlvarezRusoCOHPiPXSec::AlvarezRusoCOHPiPXSec(string config) :
 XSecAlgorithmI("genie::AlvarezRusoCOHPiPXSec", config)
 {
   fMultidiff = NULL;
-  fLastInteraction = NULL;
+  fMultidiffKey = -1;
 }
 //____________________________________________________________________________
 AlvarezRusoCOHPiPXSec::~AlvarezRusoCOHPiPXSec()
 {
-  if (fMultidiff) delete fMultidiff;
+  this->ClearModels();
 }
 //____________________________________________________________________________
 double AlvarezRusoCOHPiPXSec::XSec(
@@ -66,59 +70,16 @@ double AlvarezRusoCOHPiPXSec::XSec(
   const Kinematics &   kinematics = interaction -> Kine();
   const InitialState & init_state = interaction -> InitState();
 
-  int A       = init_state.Tgt().A(); // mass number
-  int Z       = init_state.Tgt().Z(); // atomic number
   double E_nu = init_state.ProbeE(kRfLab); // neutrino energy
 
   const TLorentzVector p4_lep = kinematics.FSLeptonP4();
   const TLorentzVector p4_pi  = kinematics.HadSystP4();
   double E_lep = p4_lep.E();
 
-  if (fLastInteraction!=interaction) {
-    if (fMultidiff != NULL) {
-      delete fMultidiff;
-      fMultidiff = NULL;
-    }
-
-    current_t current;
-    if ( interaction->ProcInfo().IsWeakCC() ) {
-      current = kCC;
-    }
-    else if ( interaction->ProcInfo().IsWeakNC() ) {
-      current = kNC;
-    }
-    else {
-      LOG("AlvarezRusoCohPi",pDEBUG)<<"Unknown current for AlvarezRuso implementation";
-      return 0.;
-    }
-
-    flavour_t flavour;
-    if ( init_state.ProbePdg() == 12 || init_state.ProbePdg() == -12) {
-      flavour=kE;
-    }
-    else if ( init_state.ProbePdg() == 14 || init_state.ProbePdg() == -14) {
-      flavour=kMu;
-    }
-    else if ( init_state.ProbePdg() == 16 || init_state.ProbePdg() == -16) {
-      flavour=kTau;
-    }
-    else {
-      LOG("AlvarezRusoCohPi",pDEBUG)<<"Unknown probe for AlvarezRuso implementation";
-      return 0.;
-    }
-
-    nutype_t nutype;
-    if ( init_state.ProbePdg() > 0) {
-      nutype = kNu;
-    } else {
-      nutype = kAntiNu;
-    }
-
-    fMultidiff = new AlvarezRusoCOHPiPDXSec(Z, A ,current, flavour, nutype);
-    fLastInteraction = interaction;
-  }
+  AlvarezRusoCOHPiPDXSec * multidiff = this->Multidiff(interaction);
+  if (!multidiff) return 0.;
 
-  double xsec = fMultidiff->DXSec(E_nu, E_lep, p4_lep.Theta(), p4_lep.Phi(), p4_pi.Theta(), p4_pi.Phi());
+  double xsec = multidiff->DXSec(E_nu, E_lep, p4_lep.Theta(), p4_lep.Phi(), p4_pi.Theta(), p4_pi.Phi());
   xsec = xsec * 1E-38 * units::cm2;
 
   if (kps != kPSElOlOpifE) {
@@ -128,6 +89,129 @@ double AlvarezRusoCOHPiPXSec::XSec(
   return (xsec);
 }
 //____________________________________________________________________________
+AlvarezRusoCOHPiPDXSec * AlvarezRusoCOHPiPXSec::Multidiff(
+                                       const Interaction * interaction) const
+{
+  const InitialState & init_state = interaction -> InitState();
+
+  current_t current;
+  if ( interaction->ProcInfo().IsWeakCC() ) {
+    current = kCC;
+  }
+  else if ( interaction->ProcInfo().IsWeakNC() ) {
+    current = kNC;
+  }
+  else {
+    LOG("AlvarezRusoCohPi",pDEBUG)<<"Unknown current for AlvarezRuso implementation";
+    return NULL;
+  }
+
+  flavour_t flavour;
+  if ( init_state.ProbePdg() == 12 || init_state.ProbePdg() == -12) {
+    flavour=kE;
+  }
+  else if ( init_state.ProbePdg() == 14 || init_state.ProbePdg() == -14) {
+    flavour=kMu;
+  }
+  else if ( init_state.ProbePdg() == 16 || init_state.ProbePdg() == -16) {
+    flavour=kTau;
+  }
+  else {
+    LOG("AlvarezRusoCohPi",pDEBUG)<<"Unknown probe for AlvarezRuso implementation";
+    return NULL;
+  }
+
+  nutype_t nutype;
+  if ( init_state.ProbePdg() > 0) {
+    nutype = kNu;
+  } else {
+    nutype = kAntiNu;
+  }
+
+  // The multi-differential cross sections only depend on the target and
+  // channel, so they (and the wavefunctions they solved last) are kept
+  int  tgt = init_state.Tgt().Pdg();
+  long key = (((long) tgt * 2 + current) * 3 + flavour) * 2 + nutype;
+  if (fMultidiff && key == fMultidiffKey) return fMultidiff;
+
+  std::map<long, AlvarezRusoCOHPiPDXSec *>::const_iterator miter =
+                                                         fMultidiffs.find(key);
+  if (miter != fMultidiffs.end()) {
+    fMultidiff    = miter->second;
+    fMultidiffKey = key;
+    return fMultidiff;
+  }
+
+  // The sampled nucleus is shared by all channels of a target
+  int A = init_state.Tgt().A(); // mass number
+  int Z = init_state.Tgt().Z(); // atomic number
+  ARSampledNucleus * nucleus = NULL;
+  std::map<int, ARSampledNucleus *>::const_iterator niter = fNuclei.find(tgt);
+  if (niter != fNuclei.end()) {
+    nucleus = niter->second;
+  } else {
+    nucleus = new ARSampledNucleus(Z, A);
+    fNuclei.insert(std::map<int, ARSampledNucleus *>::value_type(tgt, nucleus));
+  }
+
+  AlvarezRusoCOHPiPDXSec * multidiff =
+     new AlvarezRusoCOHPiPDXSec(Z, A, current, flavour, nutype, kNieves, nucleus);
+  if (fUseLookupTable) {
+    multidiff->SetWFCache(this->WFCache(interaction, nucleus->GetSampling()));
+  }
+  fMultidiffs.insert(
+     std::map<long, AlvarezRusoCOHPiPDXSec *>::value_type(key, multidiff));
+
+  fMultidiff    = multidiff;
+  fMultidiffKey = key;
+  return fMultidiff;
+}
+//____________________________________________________________________________
+ARWFCacheBranch * AlvarezRusoCOHPiPXSec::WFCache(
+          const Interaction * interaction, unsigned int sampling) const
+{
+  // The wavefunctions depend on the nucleus and the pion (charged for CC,
+  // neutral for NC) but not on the neutrino flavour
+  const Target & target = interaction->InitState().Tgt();
+
+  ostringstream params;
+  params << "tgt:" << target.Pdg()
+         << ";cc:" << interaction->ProcInfo().IsWeakCC()
+         << ";sampling:" << sampling
+         << ";step:" << fLookupTableStep;
+
+  Cache * cache = Cache::Instance();
+  string key = cache->CacheBranchKey(this->Id().Key(), "PionWavefunctions", params.str());
+
+  ARWFCacheBranch * branch =
+       dynamic_cast<ARWFCacheBranch *> (cache->FindCacheBranch(key));
+  if (!branch) {
+    LOG("AlvarezRusoCohPi", pINFO)
+      << "Tabulating the pion wavefunctions in cache branch: " << key;
+    branch = new ARWFCacheBranch(2*sampling, fLookupTableStep);
+    cache->AddCacheBranch(key, branch);
+  }
+  return branch;
+}
+//____________________________________________________________________________
+void AlvarezRusoCOHPiPXSec::ClearModels(void)
+{
+  std::map<long, AlvarezRusoCOHPiPDXSec *>::iterator miter;
+  for (miter = fMultidiffs.begin(); miter != fMultidiffs.end(); ++miter) {
+    delete miter->second;
+  }
+  fMultidiffs.clear();
+
+  std::map<int, ARSampledNucleus *>::iterator niter;
+  for (niter = fNuclei.begin(); niter != fNuclei.end(); ++niter) {
+    delete niter->second;
+  }
+  fNuclei.clear();
+
+  fMultidiff    = NULL;
+  fMultidiffKey = -1;
+}
+//____________________________________________________________________________
 double AlvarezRusoCOHPiPXSec::Integral(const Interaction * interaction) const
 {
   double xsec = fXSecIntegrator->Integrate(this,interaction);
@@ -179,6 +263,12 @@ void AlvarezRusoCOHPiPXSec::LoadConfig(void)
   ffPi     = fConfig->GetDoubleDef("fPi",           gc->GetDouble("COHAR-fPi"));
   ffStar   = fConfig->GetDoubleDef("fStar",         gc->GetDouble("COHAR-fStar"));*/
 
+  //-- pion wavefunction tables
+  this->GetParamDef("UseLookupTable",      fUseLookupTable,  true);
+  this->GetParamDef("LookupTable-LogStep", fLookupTableStep, 0.01);
+  if (fLookupTableStep <= 0.) fUseLookupTable = false;
+
+  this->ClearModels();
 
   //-- load the differential cross section integrator
   fXSecIntegrator =
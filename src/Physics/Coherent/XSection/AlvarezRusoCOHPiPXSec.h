@@ -22,6 +22,8 @@
 #ifndef _ALVAREZ_RUSO_COH_XSEC_H_
 #define _ALVAREZ_RUSO_COH_XSEC_H_
 
+#include <map>
+
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Physics/Coherent/XSection/AlvarezRusoCOHPiPDXSec.h"
 
@@ -30,6 +32,10 @@ namespace genie {
 class XSecIntegratorI;
 class Interaction;
 
+namespace alvarezruso {
+  class ARWFCacheBranch;
+}
+
 class AlvarezRusoCOHPiPXSec : public XSecAlgorithmI {
 
 public:
@@ -48,16 +54,26 @@ public:
   void Configure(string config);
 
 private:
-  void LoadConfig(void);
+  void LoadConfig  (void);
+  void ClearModels (void);
+
+  alvarezruso::AlvarezRusoCOHPiPDXSec * Multidiff (const Interaction * i) const;
+  alvarezruso::ARWFCacheBranch *        WFCache   (const Interaction * i,
+                                                   unsigned int sampling) const;
 
   //-- private data members loaded from config Registry or set to defaults
 
   const XSecIntegratorI * fXSecIntegrator;
+  bool   fUseLookupTable;   ///< tabulate the pion wavefunctions in the GENIE cache
+  double fLookupTableStep;  ///< table node spacing in ln(1 + Tpi/10 MeV)
 
+  //-- multi-differential cross sections (per target and channel) and sampled
+  //   nuclei (per target), kept for as long as the configuration
   mutable alvarezruso::AlvarezRusoCOHPiPDXSec * fMultidiff;
-  mutable const Interaction * fLastInteraction;
+  mutable long fMultidiffKey;
+  mutable std::map<long, alvarezruso::AlvarezRusoCOHPiPDXSec *> fMultidiffs;
+  mutable std::map<int,  alvarezruso::ARSampledNucleus *>       fNuclei;
   //Parameters
-  //bool fUseLookupTable;
   //double fa4;
   //double fa5;
   //double fb4;
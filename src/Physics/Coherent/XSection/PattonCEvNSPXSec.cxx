@@ -8,6 +8,8 @@
 */
 //____________________________________________________________________________
 
+#include <mutex>
+
 #include <TMath.h>
 #include <Math/Integrator.h>
 
@@ -30,6 +32,10 @@ using namespace genie;
 using namespace genie::utils;
 using namespace genie::constants;
 
+namespace {
+  std::mutex gDensityMomentsMutex; // guards the density moments of all instances
+}
+
 //____________________________________________________________________________
 PattonCEvNSPXSec::PattonCEvNSPXSec() :
 XSecAlgorithmI("genie::PattonCEvNSPXSec")
@@ -91,10 +97,10 @@ double PattonCEvNSPXSec::XSec(
 
   // Calculation of nuclear density moments used for the evaluation
   // of the neutron form factor
-  double avg_density = this->NuclearDensityMoment(A, 0); // units:: fm^-3
-  double Rn2 = this->NuclearDensityMoment(A, 2) / avg_density; // units: fm^2
-  double Rn4 = this->NuclearDensityMoment(A, 4) / avg_density; // units: fm^4
-  double Rn6 = this->NuclearDensityMoment(A, 6) / avg_density; // units: fm^6
+  const DensityMoments & moments = this->GetDensityMoments(A);
+  double Rn2 = moments.Rn2; // units: fm^2
+  double Rn4 = moments.Rn4; // units: fm^4
+  double Rn6 = moments.Rn6; // units: fm^6
 
   LOG("CEvNS", pDEBUG)
     << "Nuclear density moments:"
@@ -159,10 +165,6 @@ double PattonCEvNSPXSec::NuclearDensityMoment(int A, int k) const
   //   - integer k specifying required nuclear density moment
   // Output:
   //   - nuclear density moment in units of fm^k
-  //
-  // THINGS TO DO:
-  // 1) The calculation can be stored, as it is required only once per nucleus.
-  //    The calculation is very fast so it doesn't matter.
 
   ROOT::Math::IBaseFunctionOneDim * integrand = new
               utils::gsl::wrap::NuclDensityMomentIntegrand(A,k);
@@ -186,6 +188,29 @@ double PattonCEvNSPXSec::NuclearDensityMoment(int A, int k) const
   return moment;
 }
 //____________________________________________________________________________
+const PattonCEvNSPXSec::DensityMoments &
+                          PattonCEvNSPXSec::GetDensityMoments(int A) const
+{
+  // The normalised density moments are required once per nucleus, but at
+  // every cross section evaluation: compute them at the first one (this
+  // takes 4 numerical integrations) and store them.
+
+  std::lock_guard<std::mutex> lock(gDensityMomentsMutex);
+
+  map<int, DensityMoments>::const_iterator iter = fDensityMoments.find(A);
+  if(iter != fDensityMoments.end()) return iter->second;
+
+  double avg_density = this->NuclearDensityMoment(A, 0); // units:: fm^-3
+
+  DensityMoments moments;
+  moments.Rn2 = this->NuclearDensityMoment(A, 2) / avg_density; // units: fm^2
+  moments.Rn4 = this->NuclearDensityMoment(A, 4) / avg_density; // units: fm^4
+  moments.Rn6 = this->NuclearDensityMoment(A, 6) / avg_density; // units: fm^6
+
+  // std::map references stay valid as elements are added
+  return fDensityMoments[A] = moments;
+}
+//____________________________________________________________________________
 double PattonCEvNSPXSec::Integral(const Interaction * interaction) const
 {
   double xsec = fXSecIntegrator->Integrate(this,interaction);
@@ -241,6 +266,12 @@ void PattonCEvNSPXSec::LoadConfig(void)
           fNuclDensMomentCalc_MaxNumOfEvaluations,
           10000);
 
+  // the density moments depend on the above
+  {
+    std::lock_guard<std::mutex> lock(gDensityMomentsMutex);
+    fDensityMoments.clear();
+  }
+
   fXSecIntegrator =
       dynamic_cast<const XSecIntegratorI *> (this->SubAlg("XSec-Integrator"));
   assert(fXSecIntegrator);
@@ -21,8 +21,12 @@
 #ifndef _PATTON_ET_AL_COHERENT_ELASTIC_PXSEC_H_
 #define _PATTON_ET_AL_COHERENT_ELASTIC_PXSEC_H_
 
+#include <map>
+
 #include "Framework/EventGen/XSecAlgorithmI.h"
 
+using std::map;
+
 namespace genie {
 
 class XSecIntegratorI;
@@ -51,6 +55,14 @@ private:
   // Calculate nuclear density moments
   double NuclearDensityMoment(int A, int k) const;
 
+  // The <Rn^2>, <Rn^4>, <Rn^6> moments (fm^k) of nucleus A, computed once
+  struct DensityMoments {
+    double Rn2, Rn4, Rn6;
+  };
+  const DensityMoments & GetDensityMoments(int A) const;
+
+  mutable map<int, DensityMoments> fDensityMoments; ///< A -> nuclear density moments
+
   const XSecIntegratorI * fXSecIntegrator;  ///< cross section integrator
   double fSin2thw;                          ///< sin^2(weinberg angle)
 
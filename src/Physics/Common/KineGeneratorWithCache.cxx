@@ -11,42 +11,129 @@
 #include <sstream>
 #include <cstdlib>
 #include <map>
+#include <vector>
+#include <mutex>
+#include <chrono>
+#include <exception>
 
 //#include <TSQLResult.h>
 //#include <TSQLRow.h>
 #include <TMath.h>
+#include <TLorentzVector.h>
 
 #include "Framework/EventGen/EVGThreadException.h"
 #include "Physics/Common/KineGeneratorWithCache.h"
 #include "Framework/GHEP/GHepRecord.h"
 #include "Framework/GHEP/GHepFlags.h"
+#include "Framework/Interaction/ScratchInteraction.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Utils/Cache.h"
 #include "Framework/Utils/CacheBranchFx.h"
+#include "Framework/Utils/MaxXSecTable.h"
+#include "Framework/Utils/EventGenCost.h"
+#include "Framework/Utils/TraceScope.h"
+#include "Framework/Numerical/EnergyMemo.h"
 #include "Framework/Numerical/MathUtils.h"
+#include "Framework/Numerical/GridEnvelope2D.h"
 
 using std::ostringstream;
 using std::map;
+using std::vector;
 
 using namespace genie;
 
+//___________________________________________________________________________
+// Sampling envelopes, keyed by algorithm, interaction and energy bin and
+// shared by all threads. An entry may be null if no envelope could be built.
+namespace {
+
+  struct EnvelopeKey {
+    ULong64_t      alg;  ///< AlgId::KeyHash() of the kinematics generator
+    InteractionKey in;   ///< Interaction::Key()
+    int            bin;  ///< energy bin
+    bool operator < (const EnvelopeKey & k) const {
+      if(alg != k.alg) return alg < k.alg;
+      if(in  != k.in ) return in  < k.in;
+      return bin < k.bin;
+    }
+  };
+
+  struct EnvelopeMap : public map<EnvelopeKey, GridEnvelope2D *> {
+    ~EnvelopeMap() {
+      for(iterator iter = begin(); iter != end(); ++iter) delete iter->second;
+    }
+  };
+
+  EnvelopeMap gEnvelopes;
+  std::mutex  gEnvelopeMutex;
+
+  // guards the (interaction, bin) -> max xsec cache branch maps
+  std::mutex  gCacheBranchesMutex;
+
+  // counters of the kinematic selection run by this thread (0 if none) and
+  // whether it is computing the max xsec
+  thread_local KineGenCounts * gCounts    = 0;
+  thread_local bool            gInMaxXSec = false;
+
+  double WallTime(void)
+  {
+    return std::chrono::duration<double>(
+             std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  // adds the wall time of a max xsec look-up or computation to the counters
+  struct MaxXSecTimer {
+    MaxXSecTimer() : fStart(WallTime()), fWasIn(gInMaxXSec) { gInMaxXSec = true; }
+   ~MaxXSecTimer() {
+      gInMaxXSec = fWasIn;
+      if(gCounts && !fWasIn) gCounts->timemax += WallTime() - fStart;
+    }
+    double fStart;
+    bool   fWasIn;
+  };
+}
+
 //___________________________________________________________________________
 KineGeneratorWithCache::KineGeneratorWithCache() :
 EventRecordVisitorI()
 {
-
+  fTableKeyModel = 0;
+  fTableKeyHash  = 0;
+  fTableKeySet   = false;
+  fCacheBranchesGen = 0;
+  fUseEnvelope    = false;
+  fEnvNBins1      = 16;
+  fEnvNBins2      = 16;
+  fEnvNIterations = 3;
+  fEnvNEnergyBins = 10.;
 }
 //___________________________________________________________________________
 KineGeneratorWithCache::KineGeneratorWithCache(string name) :
 EventRecordVisitorI(name)
 {
-
+  fTableKeyModel = 0;
+  fTableKeyHash  = 0;
+  fTableKeySet   = false;
+  fCacheBranchesGen = 0;
+  fUseEnvelope    = false;
+  fEnvNBins1      = 16;
+  fEnvNBins2      = 16;
+  fEnvNIterations = 3;
+  fEnvNEnergyBins = 10.;
 }
 //___________________________________________________________________________
 KineGeneratorWithCache::KineGeneratorWithCache(string name, string config) :
 EventRecordVisitorI(name, config)
 {
-
+  fTableKeyModel = 0;
+  fTableKeyHash  = 0;
+  fTableKeySet   = false;
+  fCacheBranchesGen = 0;
+  fUseEnvelope    = false;
+  fEnvNBins1      = 16;
+  fEnvNBins2      = 16;
+  fEnvNIterations = 3;
+  fEnvNEnergyBins = 10.;
 }
 //___________________________________________________________________________
 KineGeneratorWithCache::~KineGeneratorWithCache()
@@ -56,6 +143,8 @@ KineGeneratorWithCache::~KineGeneratorWithCache()
 //___________________________________________________________________________
 double KineGeneratorWithCache::MaxXSec(GHepRecord * event_rec) const
 {
+  MaxXSecTimer timer;
+
   LOG("Kinematics", pINFO)
                 << "Getting max. differential xsec for the rejection method";
 
@@ -69,7 +158,10 @@ double KineGeneratorWithCache::MaxXSec(GHepRecord * event_rec) const
 
   LOG("Kinematics", pINFO)
                   << "Attempting to compute the max{dxsec/dK} value";
-  xsec_max = this->ComputeMaxXSec(interaction);
+  {
+    GTRACE_SCOPE("KineGeneratorWithCache::ComputeMaxXSec");
+    xsec_max = this->ComputeMaxXSec(interaction);
+  }
   if(xsec_max>0) {
      LOG("Kinematics", pINFO) << "max{dxsec/dK} = " << xsec_max;
      this->CacheMaxXSec(interaction, xsec_max);
@@ -110,32 +202,38 @@ double KineGeneratorWithCache::FindMaxXSec(
      return -1.;
   }
 
+  // look-up the shared, read-only max xsec table
+  MaxXSecTable * table = MaxXSecTable::Instance();
+  if(table->IsLoaded()) {
+    double table_max_xsec = table->MaxXSec(this->MaxXSecTableKey(interaction), E);
+    if(table_max_xsec > 0) {
+      LOG("Kinematics", pINFO)
+         << "\nFrom table: max xsec (E=" << E << ") = " << table_max_xsec;
+      return table_max_xsec;
+    }
+  }
+
   // access the the cache branch
   CacheBranchFx * cb = this->AccessCacheBranch(interaction);
 
   // if there are enough points stored in the cache buffer to build a
-  // spline, then intepolate
-  if( cb->Spl() ) {
-     if( E >= cb->Spl()->XMin() && E <= cb->Spl()->XMax()) {
-       double spl_max_xsec = cb->Spl()->Evaluate(E);
-       LOG("Kinematics", pINFO)
-          << "\nInterpolated: max xsec (E=" << E << ") = " << spl_max_xsec;
-       return spl_max_xsec;
-     }
-     LOG("Kinematics", pINFO)
-          << "Outside spline boundaries - Forcing explicit calculation";
-     return -1.;
-  }
-
+  // spline, then intepolate (if building a max xsec table, do not: every
+  // energy not close to a cached one is computed and recorded).
   // if there are not enough points at the cache buffer to have a spline,
   // look whether there is another point that is sufficiently close
+  // (memoized for the event: re-tried events look it up again at this E)
   double dE = TMath::Min(0.25, 0.05*E);
-  const map<double,double> & fmap = cb->Map();
-  map<double,double>::const_iterator iter = fmap.lower_bound(E);
-  if(iter != fmap.end()) {
-     if(TMath::Abs(E - iter->first) < dE) return iter->second;
+  double max_xsec = -1;
+  bool recording = table->IsRecording();
+  if(!recording && EnergyMemo::Find(cb, E, max_xsec)) return max_xsec;
+  if( cb->Lookup(E, dE, max_xsec, !recording) ) {
+     if(!recording) EnergyMemo::Store(cb, E, max_xsec);
+     LOG("Kinematics", pINFO)
+        << "\nCached: max xsec (E=" << E << ") = " << max_xsec;
+     return max_xsec;
   }
-
+  LOG("Kinematics", pINFO)
+       << "No cached max xsec at this energy - Forcing explicit calculation";
   return -1;
 
 /*
@@ -187,16 +285,12 @@ void KineGeneratorWithCache::CacheMaxXSec(
   CacheBranchFx * cb = this->AccessCacheBranch(interaction);
 
   double E = this->Energy(interaction);
-  if(max_xsec>0) cb->AddValues(E,max_xsec);
+  cb->Update(E, max_xsec, 40);
 
-  if(! cb->Spl() ) {
-    if( cb->Map().size() > 40 ) cb->CreateSpline();
-  }
-
-  if( cb->Spl() ) {
-     if( E < cb->Spl()->XMin() || E > cb->Spl()->XMax() ) {
-        cb->CreateSpline();
-     }
+  // building a max xsec table?
+  MaxXSecTable * table = MaxXSecTable::Instance();
+  if(table->IsRecording()) {
+    table->Record(this->MaxXSecTableKey(interaction), E, max_xsec);
   }
 }
 //___________________________________________________________________________
@@ -215,13 +309,28 @@ CacheBranchFx * KineGeneratorWithCache::AccessCacheBranch(
                                       const Interaction * interaction) const
 {
 // Returns the cache branch for this algorithm and this interaction. If no
-// branch is found then one is created.
+// branch is found then one is created. Branches already used by this
+// algorithm are found by (interaction key, bin), without building the
+// string key of the branch.
 
   Cache * cache = Cache::Instance();
 
+  pair<InteractionKey,int> memo_key(
+                  interaction->Key(), this->CacheBranchBin(interaction));
+  {
+    std::lock_guard<std::mutex> lock(gCacheBranchesMutex);
+    if(fCacheBranchesGen != cache->Generation()) {
+      fCacheBranches.clear();
+      fCacheBranchesGen = cache->Generation();
+    }
+    map<pair<InteractionKey,int>, CacheBranchFx *>::const_iterator iter =
+                                                 fCacheBranches.find(memo_key);
+    if(iter != fCacheBranches.end()) return iter->second;
+  }
+
   // build the cache branch key as: namespace::algorithm/config/interaction
   string algkey = this->Id().Key();
-  string intkey = interaction->AsString();
+  string intkey = this->CacheBranchName(interaction);
   string key    = cache->CacheBranchKey(algkey, intkey);
 
   CacheBranchFx * cache_branch =
@@ -233,18 +342,72 @@ CacheBranchFx * KineGeneratorWithCache::AccessCacheBranch(
 
     cache_branch = new CacheBranchFx("max[d^nXSec/d^n{K}] over phase space");
     cache->AddCacheBranch(key, cache_branch);
+
+    // another thread may have added the same branch first: use that one
+    cache_branch =
+              dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
   }
   assert(cache_branch);
 
+  std::lock_guard<std::mutex> lock(gCacheBranchesMutex);
+  if(fCacheBranchesGen == cache->Generation()) {
+    fCacheBranches[memo_key] = cache_branch;
+  }
+
   return cache_branch;
 }
 //___________________________________________________________________________
+string KineGeneratorWithCache::CacheBranchName(
+                                      const Interaction * interaction) const
+{
+// Returns the interaction part of the cache branch key. Kinematic generators
+// should override this method if their max xsec depends on more than the
+// interaction and the energy.
+
+  return interaction->AsString();
+}
+//___________________________________________________________________________
+int KineGeneratorWithCache::CacheBranchBin(
+                                      const Interaction * /*interaction*/) const
+{
+// Returns the bin coding, in the cache branch name, a dependence of the max
+// xsec on more than the interaction and the energy, or kNoCacheBranchBin.
+// Override together with CacheBranchName().
+
+  return kNoCacheBranchBin;
+}
+//___________________________________________________________________________
+ULong64_t KineGeneratorWithCache::MaxXSecTableKey(
+                                      const Interaction * interaction) const
+{
+// Returns the key of this algorithm and this interaction in the max xsec
+// table: it changes with the configuration of this algorithm or of the
+// cross section model it uses. The configuration hash is only re-computed
+// when the cross section model changes.
+
+  if(!fTableKeySet || fTableKeyModel != fXSecModel) {
+    fTableKeyHash = this->ConfigHash();
+    if(fXSecModel) {
+      fTableKeyHash = utils::math::HashCombine(
+                    fTableKeyHash, (Long64_t) fXSecModel->ConfigHash());
+    }
+    fTableKeyModel = fXSecModel;
+    fTableKeySet   = true;
+  }
+  return utils::math::HashCombine(
+                    fTableKeyHash, (Long64_t) interaction->KeyHash());
+}
+//___________________________________________________________________________
 void KineGeneratorWithCache::AssertXSecLimits(
          const Interaction * interaction, double xsec, double xsec_max) const
 {
   // check the computed cross section for the current kinematics against the
   // maximum cross section used in the rejection MC method for the current
   // interaction at the current energy.
+  if(gCounts) {
+    gCounts->nthrows++;
+    if(xsec>xsec_max) gCounts->novershoots++;
+  }
   if(xsec>xsec_max) {
     double f = 200*(xsec-xsec_max)/(xsec_max+xsec);
     if(f>fMaxXSecDiffTolerance) {
@@ -270,3 +433,236 @@ void KineGeneratorWithCache::AssertXSecLimits(
   }
 }
 //___________________________________________________________________________
+KineGeneratorWithCache::StatsScope::StatsScope(
+          const KineGeneratorWithCache * alg, GHepRecord * evrec) :
+fAlg(alg),
+fEventRec(evrec)
+{
+  fCounts.nselections = 1;
+  fStart    = WallTime();
+  fPrevious = gCounts;
+  gCounts   = &fCounts;
+}
+//___________________________________________________________________________
+KineGeneratorWithCache::StatsScope::~StatsScope()
+{
+  // the selection failed if it is left by an exception (eg. too many
+  // iterations) or flagged a kinematics generation error
+  gCounts = fPrevious;
+  fCounts.time = WallTime() - fStart;
+  bool failed = std::uncaught_exception() ||
+                fEventRec->EventFlags()->TestBitNumber(kKineGenErr);
+  fCounts.naccepted = (failed) ? 0 : 1;
+
+  string channel = fAlg->Id().Name() + " : " + fEventRec->Summary()->AsString();
+  KineGenStats::Instance()->Add(channel, fCounts);
+
+  EventGenCost::Current().nkinerej +=
+     TMath::Max(0LL, fCounts.nthrows - fCounts.naccepted);
+}
+//___________________________________________________________________________
+double KineGeneratorWithCache::XSec(
+                  const Interaction * interaction, KinePhaseSpace_t kps) const
+{
+// Cross section of the running model, counted in the selection statistics
+
+  GTRACE_SCOPE("XSecAlgorithmI::XSec");
+
+  this->CountXSec();
+  return fXSecModel->XSec(interaction, kps);
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::CountXSec(void) const
+{
+  if(!gCounts) return;
+  gCounts->nxsec++;
+  if(gInMaxXSec) gCounts->nxsecmax++;
+}
+//___________________________________________________________________________
+const GridEnvelope2D * KineGeneratorWithCache::Envelope(
+                                      const Interaction * interaction) const
+{
+// Returns the sampling envelope for this algorithm and interaction, valid
+// over the energy bin of the input interaction. The envelope is built at the
+// first pass and cached. Returns 0 if envelopes are not used, if the energy is
+// below the caching threshold or if no envelope could be built.
+
+  if(!fUseEnvelope) return 0;
+
+  double E = this->Energy(interaction);
+  if(E < fEMin || E <= 0.) return 0;
+
+  int ibin = TMath::FloorNint(fEnvNEnergyBins * TMath::Log10(E));
+
+  EnvelopeKey key;
+  key.alg = this->Id().KeyHash();
+  key.in  = interaction->Key();
+  key.bin = ibin;
+
+  {
+    std::lock_guard<std::mutex> lock(gEnvelopeMutex);
+    EnvelopeMap::const_iterator iter = gEnvelopes.find(key);
+    if(iter != gEnvelopes.end()) return iter->second;
+  }
+
+  double Emin = TMath::Power(10., ibin     / fEnvNEnergyBins);
+  double Emax = TMath::Power(10., (ibin+1) / fEnvNEnergyBins);
+
+  LOG("Kinematics", pNOTICE)
+    << "Building sampling envelope for E = [" << Emin << ", " << Emax
+    << "] GeV - key = " << this->Id().Key() << "/"
+    << interaction->AsString() << "/" << ibin;
+
+  // build it without holding the lock: another thread may have built the
+  // same envelope meanwhile, in which case the one stored first is kept
+  // (building it is counted as a max xsec computation)
+  GridEnvelope2D * envelope = 0;
+  {
+    MaxXSecTimer timer;
+    envelope = this->BuildEnvelope(interaction, Emin, Emax);
+  }
+
+  std::lock_guard<std::mutex> lock(gEnvelopeMutex);
+  EnvelopeMap::iterator iter = gEnvelopes.find(key);
+  if(iter != gEnvelopes.end()) {
+    delete envelope;
+    return iter->second;
+  }
+  gEnvelopes[key] = envelope;
+  return envelope;
+}
+//___________________________________________________________________________
+GridEnvelope2D * KineGeneratorWithCache::BuildEnvelope(
+       const Interaction * interaction, double Emin, double Emax) const
+{
+// Builds a sampling envelope valid for energies in [Emin, Emax].
+// The envelope lives in the unit square which EnvelopeLimits() maps onto the
+// kinematic variables at the energy of each event. Its grid is adapted to
+// the cross section at the top of the energy bin. The height of each cell is
+// the largest cross section found at its corners and centre at both ends of
+// the energy bin, times the safety factor. Cells where no positive value was
+// found borrow the largest height of their neighbours.
+
+  unsigned int n1 = TMath::Max(fEnvNBins1, 1);
+  unsigned int n2 = TMath::Max(fEnvNBins2, 1);
+
+  double E = this->Energy(interaction);
+  TLorentzVector * p4 = interaction->InitState().GetProbeP4(kRfLab);
+
+  ScratchInteraction scratch(interaction);
+  Interaction * in = scratch.Get();
+  in->SetBit(kISkipProcessChk);
+
+  GridEnvelope2D * envelope = new GridEnvelope2D(n1, n2);
+
+  Range1D_t k1, k2;
+
+  // warm-up: adapt the grid
+  TLorentzVector p4e = (*p4) * (Emax/E);
+  in->InitStatePtr()->SetProbeP4(p4e);
+  if(this->EnvelopeLimits(in, k1, k2)) {
+    vector<double> f(n1*n2);
+    for(int iter = 0; iter < fEnvNIterations; iter++) {
+      for(unsigned int i1 = 0; i1 < n1; i1++) {
+        double u = 0.5 * (envelope->UEdge(i1) + envelope->UEdge(i1+1));
+        for(unsigned int i2 = 0; i2 < n2; i2++) {
+          double v = 0.5 * (envelope->VEdge(i2) + envelope->VEdge(i2+1));
+          f[i1*n2+i2] = this->EnvelopeXSec(in,
+                   k1.min + u * (k1.max-k1.min), k2.min + v * (k2.max-k2.min));
+        }
+      }
+      envelope->Adapt(f);
+    }
+  }
+
+  // cell heights
+  vector<double> h(n1*n2, 0.);
+  double Ebin[2] = { TMath::Max(Emin, fEMin), Emax };
+  for(int ie = 0; ie < 2; ie++) {
+    p4e = (*p4) * (Ebin[ie]/E);
+    in->InitStatePtr()->SetProbeP4(p4e);
+    if(!this->EnvelopeLimits(in, k1, k2)) continue;
+
+    vector<double> fcorner((n1+1)*(n2+1));
+    for(unsigned int i1 = 0; i1 <= n1; i1++) {
+      double u = envelope->UEdge(i1);
+      for(unsigned int i2 = 0; i2 <= n2; i2++) {
+        double v = envelope->VEdge(i2);
+        fcorner[i1*(n2+1)+i2] = this->EnvelopeXSec(in,
+                 k1.min + u * (k1.max-k1.min), k2.min + v * (k2.max-k2.min));
+      }
+    }
+    for(unsigned int i1 = 0; i1 < n1; i1++) {
+      double u = 0.5 * (envelope->UEdge(i1) + envelope->UEdge(i1+1));
+      for(unsigned int i2 = 0; i2 < n2; i2++) {
+        double v = 0.5 * (envelope->VEdge(i2) + envelope->VEdge(i2+1));
+        double fmax = this->EnvelopeXSec(in,
+                 k1.min + u * (k1.max-k1.min), k2.min + v * (k2.max-k2.min));
+        fmax = TMath::Max(fmax, fcorner[ i1   *(n2+1) + i2  ]);
+        fmax = TMath::Max(fmax, fcorner[ i1   *(n2+1) + i2+1]);
+        fmax = TMath::Max(fmax, fcorner[(i1+1)*(n2+1) + i2  ]);
+        fmax = TMath::Max(fmax, fcorner[(i1+1)*(n2+1) + i2+1]);
+        h[i1*n2+i2] = TMath::Max(h[i1*n2+i2], fmax);
+      }
+    }
+  }
+
+  for(unsigned int i1 = 0; i1 < n1; i1++) {
+    for(unsigned int i2 = 0; i2 < n2; i2++) {
+      double hc = h[i1*n2+i2];
+      if(hc <= 0.) {
+        for(int d1 = -1; d1 <= 1; d1++) {
+          for(int d2 = -1; d2 <= 1; d2++) {
+            int j1 = i1 + d1;
+            int j2 = i2 + d2;
+            if(j1 < 0 || j2 < 0 || j1 >= (int)n1 || j2 >= (int)n2) continue;
+            hc = TMath::Max(hc, h[j1*n2+j2]);
+          }
+        }
+      }
+      envelope->SetHeight(i1, i2, fSafetyFactor * hc);
+    }
+  }
+
+  delete p4;
+
+  if(!envelope->Build()) {
+    LOG("Kinematics", pWARN)
+      << "Null sampling envelope for " << interaction->AsString()
+      << " at E = [" << Emin << ", " << Emax << "] GeV";
+    delete envelope;
+    return 0;
+  }
+  return envelope;
+}
+//___________________________________________________________________________
+bool KineGeneratorWithCache::EnvelopeLimits(
+         const Interaction * /*in*/, Range1D_t & k1, Range1D_t & k2) const
+{
+// Ranges of the two kinematic variables sampled from the envelope.
+// Kinematic generators using envelopes must override this method.
+
+  k1.min = k1.max = 0.;
+  k2.min = k2.max = 0.;
+  return false;
+}
+//___________________________________________________________________________
+double KineGeneratorWithCache::EnvelopeXSec(
+         const Interaction * /*in*/, double /*k1*/, double /*k2*/) const
+{
+// Differential cross section in the two kinematic variables sampled from the
+// envelope. Kinematic generators using envelopes must override this method.
+
+  return 0.;
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::LoadEnvelopeConfig(void)
+{
+  this->GetParamDef("Envelope-Enable",              fUseEnvelope,    false);
+  this->GetParamDef("Envelope-NBins1",              fEnvNBins1,      16);
+  this->GetParamDef("Envelope-NBins2",              fEnvNBins2,      16);
+  this->GetParamDef("Envelope-NIterations",         fEnvNIterations, 3);
+  this->GetParamDef("Envelope-EnergyBinsPerDecade", fEnvNEnergyBins, 10.);
+  assert(fEnvNEnergyBins > 0.);
+}
+//___________________________________________________________________________
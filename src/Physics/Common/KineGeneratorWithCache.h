@@ -26,17 +26,24 @@
 #ifndef _KINE_GENERATOR_WITH_CACHE_H_
 #define _KINE_GENERATOR_WITH_CACHE_H_
 
+#include <map>
 #include <string>
+#include <utility>
 
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/EventGen/EventRecordVisitorI.h"
+#include "Framework/Interaction/InteractionKey.h"
 #include "Framework/Utils/Range1.h"
+#include "Framework/Utils/KineGenStats.h"
 
+using std::map;
+using std::pair;
 using std::string;
 
 namespace genie {
 
 class CacheBranchFx;
+class GridEnvelope2D;
 class XSecAlgorithmI;
 
 class KineGeneratorWithCache : public EventRecordVisitorI {
@@ -53,16 +60,69 @@ protected:
   virtual void   CacheMaxXSec   (const Interaction * in, double xsec) const;
   virtual double Energy         (const Interaction * in) const;
 
+  // The max xsec cache branch of an interaction. Generators whose max xsec
+  // depends on more than the interaction and the energy code the extra
+  // dependence both in the branch name and in the branch bin, so that the
+  // branch can be looked up by (Interaction::Key(), bin) on every event.
+  static const int kNoCacheBranchBin = -999999;
+
   virtual CacheBranchFx * AccessCacheBranch (const Interaction * in) const;
+  virtual string          CacheBranchName   (const Interaction * in) const;
+  virtual int             CacheBranchBin    (const Interaction * in) const;
+  virtual ULong64_t       MaxXSecTableKey   (const Interaction * in) const;
 
   virtual void AssertXSecLimits (const Interaction * in, double xsec, double xsec_max) const;
 
+  // Kinematic selection statistics (see KineGenStats). Concrete generators
+  // open a StatsScope for the event at the top of ProcessEventRecord() and
+  // compute cross sections with XSec() (or call CountXSec() when computing
+  // them otherwise). The throws and the max xsec overshoots are counted by
+  // AssertXSecLimits() and the max xsec computations by MaxXSec().
+  class StatsScope {
+  public:
+    StatsScope(const KineGeneratorWithCache * alg, GHepRecord * evrec);
+   ~StatsScope();
+    KineGenCounts & Counts (void) { return fCounts; }
+  private:
+    const KineGeneratorWithCache * fAlg;
+    GHepRecord *                   fEventRec;
+    KineGenCounts                  fCounts;    ///< counters of this selection
+    double                         fStart;     ///< wall time at the start of the selection
+    KineGenCounts *                fPrevious;  ///< counters of the enclosing scope of this thread, if any
+  };
+
+  double XSec      (const Interaction * in, KinePhaseSpace_t kps) const;
+  void   CountXSec (void) const;
+
+  // Optional sampling envelope, adapted to the differential cross section in
+  // two kinematic variables and cached per energy bin. Concrete generators
+  // using it implement EnvelopeLimits() and EnvelopeXSec() and call
+  // LoadEnvelopeConfig() when configured.
+  virtual const GridEnvelope2D * Envelope       (const Interaction * in) const;
+  virtual GridEnvelope2D *       BuildEnvelope  (const Interaction * in, double Emin, double Emax) const;
+  virtual bool                   EnvelopeLimits (const Interaction * in, Range1D_t & k1, Range1D_t & k2) const;
+  virtual double                 EnvelopeXSec   (const Interaction * in, double k1, double k2) const;
+  virtual void                   LoadEnvelopeConfig (void);
+
   mutable const XSecAlgorithmI * fXSecModel;
 
   double fSafetyFactor;         ///< maxxsec -> maxxsec * safety_factor
   double fMaxXSecDiffTolerance; ///< max{100*(xsec-maxxsec)/.5*(xsec+maxxsec)} if xsec>maxxsec
   double fEMin;                 ///< min E for which maxxsec is cached - forcing explicit calc.
   bool   fGenerateUniformly;    ///< uniform over allowed phase space + event weight?
+
+  bool   fUseEnvelope;          ///< sample from an adapted grid envelope rather than a flat max xsec?
+  int    fEnvNBins1;            ///< number of envelope bins in the 1st kinematic variable
+  int    fEnvNBins2;            ///< number of envelope bins in the 2nd kinematic variable
+  int    fEnvNIterations;       ///< number of envelope grid adaptation (warm-up) passes
+  double fEnvNEnergyBins;       ///< number of envelope energy bins per decade
+
+  mutable const XSecAlgorithmI * fTableKeyModel; ///< xsec model fTableKeyHash was computed with
+  mutable ULong64_t              fTableKeyHash;  ///< configuration hash of this algorithm & xsec model
+  mutable bool                   fTableKeySet;   ///< fTableKeyHash computed?
+
+  mutable map<pair<InteractionKey,int>, CacheBranchFx *> fCacheBranches; ///< (interaction, bin) -> max xsec cache branch
+  mutable unsigned int                                   fCacheBranchesGen; ///< Cache::Generation() of fCacheBranches
 };
 
 }      // genie namespace
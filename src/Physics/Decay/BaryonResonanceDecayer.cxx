@@ -37,6 +37,14 @@
 using namespace genie;
 using namespace genie::controls;
 using namespace genie::constants;
+
+namespace {
+  // Decay channel tables
+  const double kChannelTableDW       = 0.01; // spacing of the W nodes (GeV)
+  const double kChannelTableWmax     = 4.0;  // max W node (GeV)
+  const int    kNPhaseSpaceSamples   = 50;   // weighted decays to estimate a max weight
+  const int    kNTablePhaseSpaceSamples = 100; // same, at the W nodes of the tables
+}
 //____________________________________________________________________________
 BaryonResonanceDecayer::BaryonResonanceDecayer() :
 Decayer("genie::BaryonResonanceDecayer")
@@ -65,23 +73,14 @@ void BaryonResonanceDecayer::ProcessEventRecord(GHepRecord * event) const
     << "Running resonance decayer "
     << ((fRunBefHadroTransp) ? "*before*" : "*after*") << " FSI";
 
-  // Loop over particles, find unstable ones and decay them
-  TObjArrayIter piter(event);
-  GHepParticle * p = 0;
-  int ipos = -1;
-
-  while( (p = (GHepParticle *) piter.Next()) ) {
-
-    ipos++;
-    LOG("ResonanceDecay", pDEBUG) << "Checking: " << p->Name();
+  // Loop over particles (including the daughters added on the way),
+  // find unstable ones and decay them
+  for ( int ipos = 0 ; ipos < event -> GetEntriesFast() ; ++ipos ) {
 
-    int pdg_code = p->Pdg();
-    GHepStatus_t status_code = p->Status();
+    GHepParticle * p = event -> Particle( ipos ) ;
+    if ( ! p ) continue ;
 
-    //    std::cout << "Decaing particle " << ipos << " with PDG " << pdg_code << std::endl ; 
-
-    if(!this->IsHandled  (pdg_code)) continue;
-    if(!this->ToBeDecayed(pdg_code, status_code)) continue;
+    if(!this->ToBeDecayed(p)) continue;
 
     LOG("ResonanceDecay", pNOTICE)
           << "Decaying unstable particle: " << p->Name();
@@ -121,26 +120,32 @@ bool BaryonResonanceDecayer::Decay(
     return false;
   }
 
-  bool to_be_deleted ; 
+  bool decayed = false ;
 
-  // Select a decay channel
-  TDecayChannel * selected_decay_channel =
-    this->SelectDecayChannel(decay_particle_id, event, to_be_deleted ) ;
+  // Decay using the decay channel tables, unless W is outside them
+  if ( ! this -> DecayTabulated( decay_particle_id, event, decayed ) ) {
 
-  if(!selected_decay_channel) {
-    LOG("ResonanceDecay", pERROR)
-      << "No decay channel for particle " << decay_particle_id ; 
-    LOG("ResonanceDecay", pERROR) 
-      << *event ; 
+    bool to_be_deleted ; 
 
-    return false;
-  }
+    // Select a decay channel
+    TDecayChannel * selected_decay_channel =
+      this->SelectDecayChannel(decay_particle_id, event, to_be_deleted ) ;
+
+    if(!selected_decay_channel) {
+      LOG("ResonanceDecay", pERROR)
+        << "No decay channel for particle " << decay_particle_id ; 
+      LOG("ResonanceDecay", pERROR) 
+        << *event ; 
 
-  // Decay the exclusive state and copy daughters in the event record
-  bool decayed = this->DecayExclusive(decay_particle_id, event, selected_decay_channel);
+      return false;
+    }
 
-  if ( to_be_deleted ) 
-    delete selected_decay_channel ; 
+    // Decay the exclusive state and copy daughters in the event record
+    decayed = this->DecayExclusive(decay_particle_id, event, selected_decay_channel);
+
+    if ( to_be_deleted ) 
+      delete selected_decay_channel ; 
+  }
 
   if ( ! decayed ) return false ;
 
@@ -267,6 +272,104 @@ TDecayChannel * BaryonResonanceDecayer::SelectDecayChannel( int decay_particle_i
   return sel_ch;
 }
 //____________________________________________________________________________
+bool BaryonResonanceDecayer::DecayTabulated(
+  int decay_particle_id, GHepRecord * event, bool & decayed) const
+{
+// Decays the particle using its decay channel tables. Returns false, without
+// decaying it, if it has no tables or its W is outside them.
+
+  decayed = false ;
+
+  GHepParticle * decay_particle = event->Particle(decay_particle_id);
+  if ( ! decay_particle ) return false ;
+
+  map<int, ChannelTable>::const_iterator it =
+     fChannelTables.find( decay_particle -> Pdg() ) ;
+  if ( it == fChannelTables.end() ) return false ;
+
+  const ChannelTable & table = it -> second ;
+
+  double W = decay_particle -> P4() -> M() ;
+  double x = ( W - table.Wmin ) / kChannelTableDW ;
+  if ( x < 0. || x >= table.nW - 1 ) return false ;
+
+  int    iW = (int) x ;
+  double f  = x - iW ;
+
+  LOG("ResonanceDecay", pINFO)
+    << "Decaying a " << decay_particle -> Name() << " with W = " << W
+    << " using its decay channel tables";
+
+  // Interpolate the branching ratios and suppress the closed channels
+  unsigned int nch = table.channels.size() ;
+  double BR[nch], tot_BR = 0. ;
+  for ( unsigned int ich = 0 ; ich < nch ; ++ich ) {
+    if ( table.fsmass[ich] < W ) {
+      tot_BR += (1.-f) * table.BR[  iW   *nch + ich]
+               +    f  * table.BR[ (iW+1)*nch + ich] ;
+    }
+    BR[ich] = tot_BR ;
+  }
+
+  if ( tot_BR <= 0. ) {
+    SLOG("ResonanceDecay", pWARN)
+      << "None of the " << nch << " decay channels is available @ W = " << W;
+    LOG("ResonanceDecay", pERROR)
+      << "No decay channel for particle " << decay_particle_id ;
+    return true ;
+  }
+
+  // Select a decay channel based on the branching ratios
+  unsigned int ich = 0, sel_ich ;
+  RandomGen * rnd = RandomGen::Instance();
+  double xsel = tot_BR * rnd->RndDec().Rndm();
+  do {
+    sel_ich = ich;
+  } while ( xsel > BR[ich++] && ich < nch ) ;
+
+  LOG("ResonanceDecay", pINFO)
+    << "Selected " << table.channels[sel_ich]->NDaughters()
+    << "-particle decay channel (" << sel_ich << ")";
+
+  double wmax = TMath::Max( table.wmax[  iW   *nch + sel_ich],
+                            table.wmax[ (iW+1)*nch + sel_ich] ) ;
+  if ( wmax <= 0. ) {
+    const vector<double> & masses = table.masses[sel_ich] ;
+    wmax = this -> PhaseSpaceMaxWeight( * decay_particle -> P4(), masses.size(),
+                                        & masses[0], kNPhaseSpaceSamples ) ;
+    if ( wmax <= 0. ) return true ;
+  }
+
+  decayed = this -> DecayExclusive( decay_particle_id, event,
+                                    table.channels[sel_ich],
+                                    & table.masses[sel_ich][0], wmax ) ;
+  return true ;
+}
+//____________________________________________________________________________
+double BaryonResonanceDecayer::PhaseSpaceMaxWeight(
+  const TLorentzVector & p4, unsigned int nd, const double * mass,
+  int nsamples) const
+{
+// Estimates the max phase space decay weight from nsamples weighted decays.
+// Returns 0 if the decay is not kinematically allowed.
+
+  double m[nd];
+  for ( unsigned int i = 0 ; i < nd ; ++i ) m[i] = mass[i] ;
+
+  TLorentzVector decay_p4( p4 ) ;
+  if ( ! fPhaseSpaceGenerator.SetDecay( decay_p4, nd, m ) ) return 0. ;
+
+  // the weight of 2-body decays does not vary
+  if ( nd == 2 ) nsamples = 1 ;
+
+  double wmax = -1;
+  for(int i=0; i<nsamples; i++) {
+     double w = fPhaseSpaceGenerator.Generate();
+     wmax = TMath::Max(wmax,w);
+  }
+  return wmax ;
+}
+//____________________________________________________________________________
 bool BaryonResonanceDecayer::DecayExclusive(
   int decay_particle_id, GHepRecord * event, TDecayChannel * ch) const
 {
@@ -274,16 +377,9 @@ bool BaryonResonanceDecayer::DecayExclusive(
   GHepParticle * decay_particle = event->Particle(decay_particle_id);
   if(!decay_particle) return false ;
 
-  // Get the decayed particle 4-momentum, 4-position and PDG code
-  TLorentzVector decay_particle_p4 = *(decay_particle->P4());
-  TLorentzVector decay_particle_x4 = *(decay_particle->X4());
-  int decay_particle_pdg_code = decay_particle->Pdg();
-
-  // Get the final state mass spectrum and the particle codes
-  // for the selected decay channel
+  // Get the final state mass spectrum for the selected decay channel
   unsigned int nd = ch->NDaughters();
 
-  int    pdgc[nd];
   double mass[nd];
 
   for(unsigned int iparticle = 0; iparticle < nd; iparticle++) {
@@ -292,13 +388,45 @@ bool BaryonResonanceDecayer::DecayExclusive(
      TParticlePDG * daughter = PDGLibrary::Instance()->Find(daughter_code);
      assert(daughter);
 
-     pdgc[iparticle] = daughter_code;
      mass[iparticle] = daughter->Mass();
 
      SLOG("ResonanceDecay", pINFO)
          << "+ daughter[" << iparticle << "]: "
          << daughter->GetName() << " (pdg-code = "
-         << pdgc[iparticle] << ", mass = " << mass[iparticle] << ")";
+         << daughter_code << ", mass = " << mass[iparticle] << ")";
+  }
+
+  // Find the maximum phase space decay weight
+  double wmax = this->PhaseSpaceMaxWeight(
+      *(decay_particle->P4()), nd, mass, kNPhaseSpaceSamples);
+  if ( wmax <= 0. ) return false ;
+
+  return this->DecayExclusive(decay_particle_id, event, ch, mass, wmax);
+}
+//____________________________________________________________________________
+bool BaryonResonanceDecayer::DecayExclusive(
+  int decay_particle_id, GHepRecord * event, TDecayChannel * ch,
+  const double * daughter_mass, double wmax) const
+{
+  // Find the particle to be decayed in the event record
+  GHepParticle * decay_particle = event->Particle(decay_particle_id);
+  if(!decay_particle) return false ;
+
+  // Get the decayed particle 4-momentum, 4-position and PDG code
+  TLorentzVector decay_particle_p4 = *(decay_particle->P4());
+  TLorentzVector decay_particle_x4 = *(decay_particle->X4());
+  int decay_particle_pdg_code = decay_particle->Pdg();
+
+  // Get the final state mass spectrum and the particle codes
+  // for the selected decay channel
+  unsigned int nd = ch->NDaughters();
+
+  int    pdgc[nd];
+  double mass[nd];
+
+  for(unsigned int iparticle = 0; iparticle < nd; iparticle++) {
+     pdgc[iparticle] = ch->DaughterPdgCode(iparticle);
+     mass[iparticle] = daughter_mass[iparticle];
   }
 
   // Check whether the expected channel is Delta->pion+nucleon
@@ -315,13 +443,6 @@ bool BaryonResonanceDecayer::DecayExclusive(
   bool is_permitted = fPhaseSpaceGenerator.SetDecay(decay_particle_p4, nd, mass);
   if ( ! is_permitted ) return false ;
 
-  // Find the maximum phase space decay weight
-  // double wmax = fPhaseSpaceGenerator.GetWtMax();
-  double wmax = -1;
-  for(int i=0; i<50; i++) {
-     double w = fPhaseSpaceGenerator.Generate();
-     wmax = TMath::Max(wmax,w);
-  }
   assert(wmax>0);
   LOG("ResonanceDecay", pINFO)
     << "Max phase space gen. weight for current decay: " << wmax;
@@ -974,6 +1095,98 @@ void BaryonResonanceDecayer::LoadConfig(void) {
     exit( 78 ) ;
 
   }
+
+  this -> BuildChannelTables() ;
   
 }
+//____________________________________________________________________________
+void BaryonResonanceDecayer::BuildChannelTables(void) {
+
+  // Tabulates, for each resonance, its decay channels, and their branching
+  // ratios and max phase space decay weights at W nodes from the lightest
+  // final state mass (rounded down to a node) up to kChannelTableWmax
+
+  fChannelTables.clear() ;
+
+  for ( int ires = kP33_1232 ; ires <= kF17_1970 ; ++ires ) {
+    for ( int Q = -1 ; Q <= 2 ; ++Q ) {
+
+      int pdgc = utils::res::PdgCode( (Resonance_t) ires, Q ) ;
+      if ( pdgc == 0 ) continue ;
+
+      TParticlePDG * res = PDGLibrary::Instance() -> Find( pdgc ) ;
+      if ( ! res ) continue ;
+
+      TObjArray * decay_list = res -> DecayList() ;
+      if ( ! decay_list ) continue ;
+
+      unsigned int nch = decay_list -> GetEntries() ;
+      if ( nch == 0 ) continue ;
+
+      ChannelTable & table = fChannelTables[pdgc] ;
+
+      double fsmass_min = 9999999. ;
+      for ( unsigned int ich = 0 ; ich < nch ; ++ich ) {
+        TDecayChannel * ch = (TDecayChannel *) decay_list -> At(ich) ;
+        table.channels.push_back( ch ) ;
+        double fsmass = this -> FinalStateMass( ch ) ;
+        table.fsmass.push_back( fsmass ) ;
+        fsmass_min = TMath::Min( fsmass_min, fsmass ) ;
+
+        vector<double> masses( ch -> NDaughters() ) ;
+        for ( unsigned int i = 0 ; i < masses.size() ; ++i ) {
+          TParticlePDG * daughter =
+             PDGLibrary::Instance() -> Find( ch -> DaughterPdgCode(i) ) ;
+          masses[i] = daughter ? daughter -> Mass() : 0. ;
+        }
+        table.masses.push_back( masses ) ;
+      }
+
+      table.Wmin = kChannelTableDW * TMath::Floor( fsmass_min / kChannelTableDW ) ;
+      table.nW   = TMath::Max( 0, (int) ( ( kChannelTableWmax - table.Wmin ) / kChannelTableDW ) + 1 ) ;
+      table.BR  .assign( table.nW * nch, 0. ) ;
+      table.wmax.assign( table.nW * nch, 0. ) ;
+
+      bool has_evolved_brs = BaryonResonanceDecayer::HasEvolvedBRs( pdgc ) ;
+
+      for ( int iW = 0 ; iW < table.nW ; ++iW ) {
+
+        double W = table.Wmin + iW * kChannelTableDW ;
+
+        // branching ratios
+        if ( has_evolved_brs ) {
+          double tot = 0. ;
+          for ( unsigned int ich = 0 ; ich < nch ; ++ich ) {
+            double width = this -> EvolveDeltaDecayWidth( pdgc, table.channels[ich], W ) ;
+            table.BR[iW*nch + ich] = TMath::Max( 0., width ) ;
+            tot += table.BR[iW*nch + ich] ;
+          }
+          for ( unsigned int ich = 0 ; ich < nch ; ++ich ) {
+            if ( tot > 0. ) table.BR[iW*nch + ich] /= tot ;
+            else            table.BR[iW*nch + ich]  = 0. ;
+          }
+        }
+        else {
+          for ( unsigned int ich = 0 ; ich < nch ; ++ich ) {
+            table.BR[iW*nch + ich] = table.channels[ich] -> BranchingRatio() ;
+          }
+        }
+
+        // max phase space decay weights
+        TLorentzVector p4( 0., 0., 0., W ) ;
+        for ( unsigned int ich = 0 ; ich < nch ; ++ich ) {
+          const vector<double> & masses = table.masses[ich] ;
+          if ( table.fsmass[ich] >= W || masses.empty() ) continue ;
+          table.wmax[iW*nch + ich] = TMath::Max( 0.,
+             this -> PhaseSpaceMaxWeight( p4, masses.size(), & masses[0],
+                                          kNTablePhaseSpaceSamples ) ) ;
+        }
+      } // W nodes
+
+      LOG("BaryonResonanceDecayer", pINFO)
+        << "Tabulated " << nch << " decay channels of " << res -> GetName()
+        << " at " << table.nW << " W nodes from W = " << table.Wmin << " GeV" ;
+    } // Q
+  } // resonances
+}
 
@@ -10,6 +10,12 @@
           Since the resonance can be produced off-the-mass-shell, decay
           channels with total-mass > W are suppressed.
 
+          The decay channels of each resonance are tabulated at configuration
+          time: daughter masses, and, at nodes in W, the branching ratios
+          (evolved with W for the Delta) and the max phase space decay
+          weights. Decays at W beyond the tables fall back to the direct
+          computation.
+
           Is a concerete implementation of the EventRecordVisitorI interface.
 
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
@@ -25,11 +31,17 @@
 #ifndef _BARYON_RESONANCE_DECAYER_H_
 #define _BARYON_RESONANCE_DECAYER_H_
 
+#include <map>
+#include <vector>
+
 #include <TGenPhaseSpace.h>
 #include <TLorentzVector.h>
 
 #include "Physics/Decay/Decayer.h"
 
+using std::map;
+using std::vector;
+
 namespace genie {
 
 class GHepParticle;
@@ -56,6 +68,24 @@ private:
   TDecayChannel* SelectDecayChannel(int dec_part_id, GHepRecord * event, bool & to_be_deleted ) const;
   // the flag to_be_deleted is referred to the returned decay channel 
   bool           DecayExclusive    (int dec_part_id, GHepRecord * event, TDecayChannel * ch) const;
+  bool           DecayExclusive    (int dec_part_id, GHepRecord * event, TDecayChannel * ch,
+                                    const double * mass, double wmax) const;
+
+  // Decay channel tables of a resonance, at W nodes Wmin + i*dW
+  struct ChannelTable {
+    vector<TDecayChannel *>  channels; ///< decay channels (owned by PDGLibrary)
+    vector<double>           fsmass;   ///< final state mass of each channel
+    vector< vector<double> > masses;   ///< daughter masses of each channel
+    double                   Wmin;     ///< W of the first node
+    int                      nW;       ///< number of W nodes
+    vector<double>           BR;       ///< branching ratios, [iW*nch + ich]
+    vector<double>           wmax;     ///< max phase space weights, [iW*nch + ich]
+  };
+
+  void           BuildChannelTables   (void);
+  bool           DecayTabulated       (int dec_part_id, GHepRecord * event, bool & decayed) const;
+  double         PhaseSpaceMaxWeight  (const TLorentzVector & p4, unsigned int nd, const double * mass,
+                                       int nsamples) const;
 
   // Methods specific for Delta decay
   TObjArray *    EvolveDeltaBR        (int dec_part_pdgc, TObjArray * decay_list, double W) const;
@@ -95,6 +125,8 @@ private:
 
   double fFFScaling ;  // Scaling factor of the form factor of the Delta wrt to Q2
 
+  map<int, ChannelTable> fChannelTables ;  ///< decay channel tables, by resonance PDG code
+
 };
 
 }         // genie namespace
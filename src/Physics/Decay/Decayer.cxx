@@ -15,6 +15,7 @@
 
 #include "Framework/ParticleData/BaryonResUtils.h"
 #include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/GHEP/GHepParticle.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Registry/Registry.h"
 #include "Framework/Utils/StringUtils.h"
@@ -26,19 +27,22 @@ using std::ostringstream;
 using namespace genie;
 //___________________________________________________________________________
 Decayer::Decayer() :
-EventRecordVisitorI()
+EventRecordVisitorI(),
+fStatusMask(0)
 {
 
 }
 //___________________________________________________________________________
 Decayer::Decayer(string name) :
-EventRecordVisitorI(name)
+EventRecordVisitorI(name),
+fStatusMask(0)
 {
 
 }
 //___________________________________________________________________________
 Decayer::Decayer(string name, string config) :
-EventRecordVisitorI(name, config)
+EventRecordVisitorI(name, config),
+fStatusMask(0)
 {
 
 }
@@ -116,6 +120,44 @@ bool Decayer::IsUnstable(int pdg_code) const
   return false;
 }
 //___________________________________________________________________________
+bool Decayer::ToBeDecayed(const GHepParticle * p) const
+{
+// Same as IsHandled(pdgc) && ToBeDecayed(pdgc, ist), using the tables built
+// by BuildDecayTable() at configuration
+
+  int ist = (int) p->Status();
+  if(ist < 0 || ist > 31 || !(fStatusMask & (1u << ist))) return false;
+
+  unsigned int idx = (unsigned int) p->PdgIndex();
+  if(idx < fDecayTable.size()) return fDecayTable[idx];
+
+  // particle added to the PDGLibrary after the configuration
+  return (this->IsHandled(p->Pdg()) && this->ToBeDecayed(p->Pdg(), p->Status()));
+}
+//___________________________________________________________________________
+void Decayer::BuildDecayTable(void)
+{
+// Tabulates, for each entry of the PDGLibrary property table, whether the
+// particle is handled by & unstable for this decayer, and the status codes
+// of the particles to be decayed, so that the event record scan needs no
+// PDG code list look-ups
+
+  // as in ToBeDecayed(pdgc, ist)
+  fStatusMask = (1u << kIStStableFinalState);
+  if(fRunBefHadroTransp) {
+    fStatusMask |= (1u << kIStHadronInTheNucleus) |
+                   (1u << kIStPreDecayResonantState);
+  }
+
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+  int n = pdglib->NParticles();
+  fDecayTable.assign(n, 0);
+  for(int i = 0; i < n; i++) {
+    int pdgc = pdglib->Properties(i).pdgc;
+    fDecayTable[i] = (this->IsHandled(pdgc) && this->IsUnstable(pdgc)) ? 1 : 0;
+  }
+}
+//___________________________________________________________________________
 void Decayer::Configure(const Registry & config)
 {
   Algorithm::Configure(config);
@@ -161,7 +203,7 @@ void Decayer::LoadConfig(void)
 
   // Allow user to specify a list of particles to be decayed
   //
-  RgKeyList klist = GetConfig().FindKeys("DecayParticleWithCode=");
+  RgKeyList klist = GetConfig().FindKeysWithPrefix("DecayParticleWithCode=");
   RgKeyList::const_iterator kiter = klist.begin();
   for( ; kiter != klist.end(); ++kiter) {
     RgKey key = *kiter;
@@ -186,7 +228,7 @@ void Decayer::LoadConfig(void)
 
   // Allow user to inhibit certain decay channels
   //
-  klist = GetConfig().FindKeys("InhibitDecay/");
+  klist = GetConfig().FindKeysWithPrefix("InhibitDecay/");
   kiter = klist.begin();
   for( ; kiter != klist.end(); ++kiter) {
     RgKey key = *kiter;
@@ -216,5 +258,7 @@ void Decayer::LoadConfig(void)
        << "\nConfigured to inhibit decays of: " << fParticlesNotToDecay
        << "\n";
   }
+
+  this->BuildDecayTable();
 }
 //___________________________________________________________________________
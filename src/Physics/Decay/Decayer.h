@@ -23,6 +23,8 @@
 
 class TDecayChannel;
 
+#include <vector>
+
 #include "Framework/EventGen/EventRecordVisitorI.h"
 #include "Framework/ParticleData/PDGCodeList.h"
 #include "Framework/GHEP/GHepStatus.h"
@@ -53,10 +55,17 @@ protected:
   virtual void InhibitDecay  (int pdgc, TDecayChannel * dc=0) const = 0;
   virtual void UnInhibitDecay(int pdgc, TDecayChannel * dc=0) const = 0;
 
+  //! is the input particle handled & to be decayed? (decay table look-up)
+  bool ToBeDecayed (const GHepParticle * p) const;
+  void BuildDecayTable (void);
+
   bool        fGenerateWeighted;    ///< generate weighted or unweighted decays?
   bool        fRunBefHadroTransp;   ///< is invoked before or after FSI?
   PDGCodeList fParticlesToDecay;    ///< list of particles to be decayed
   PDGCodeList fParticlesNotToDecay; ///< list of particles for which decay is inhibited
+
+  std::vector<char> fDecayTable;    ///< handled & unstable? per PDGLibrary property table entry
+  unsigned int      fStatusMask;    ///< bit i set if particles with status code i are to be decayed
 };
 
 }      // genie namespace
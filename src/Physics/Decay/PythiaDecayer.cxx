@@ -10,10 +10,12 @@
 
 #include <vector>
 #include <cassert>
+#include <algorithm>
 
 #include <TClonesArray.h>
 #include <TLorentzVector.h>
 #include <TDecayChannel.h>
+#include <TMath.h>
 #include <RVersion.h>
 #if ROOT_VERSION_CODE >= ROOT_VERSION(5,15,6)
 #include <TMCParticle.h>
@@ -23,6 +25,7 @@
 
 #include "Framework/Conventions/Units.h"
 #include "Framework/Conventions/Constants.h"
+#include "Framework/Conventions/Controls.h"
 #include "Framework/ParticleData/BaryonResUtils.h"
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/ParticleData/PDGCodes.h"
@@ -32,11 +35,13 @@
 #include "Framework/GHEP/GHepRecord.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
+#include "Framework/Utils/Pythia6Gate.h"
 #include "Physics/Decay/PythiaDecayer.h"
 
 using std::vector;
 
 using namespace genie;
+using namespace genie::controls;
 
 // actual PYTHIA calls:
 extern "C" void py1ent_(int *,  int *, double *, double *, double *);
@@ -65,21 +70,13 @@ void PythiaDecayer::ProcessEventRecord(GHepRecord * event) const
     << "Running PYTHIA6 particle decayer "
     << ((fRunBefHadroTransp) ? "*before*" : "*after*") << " FSI";
 
-  // Loop over particles, find unstable ones and decay them
-  TObjArrayIter piter(event);
-  GHepParticle * p = 0;
-  int ipos = -1;
+  // Loop over particles (including the daughters added on the way),
+  // find unstable ones and decay them
+  for(int ipos = 0; ipos < event->GetEntriesFast(); ipos++) {
+    GHepParticle * p = event->Particle(ipos);
+    if(!p) continue;
 
-  while( (p = (GHepParticle *) piter.Next()) ) {
-    ipos++;
-
-    LOG("Pythia6Decay", pDEBUG) << "Checking: " << p->Name();
-
-    int pdg_code = p->Pdg();
-    GHepStatus_t status_code = p->Status();
-
-    if(!this->IsHandled  (pdg_code)) continue;
-    if(!this->ToBeDecayed(pdg_code, status_code)) continue;
+    if(!this->ToBeDecayed(p)) continue;
 
     LOG("Pythia6Decay", pNOTICE)
           << "Decaying unstable particle: " << p->Name();
@@ -94,6 +91,9 @@ void PythiaDecayer::ProcessEventRecord(GHepRecord * event) const
 //____________________________________________________________________________
 bool PythiaDecayer::Decay(int decay_particle_id, GHepRecord * event) const
 {
+  // PYTHIA6 is shared by all threads
+  Pythia6Gate::Guard pythia6_guard;
+
   fWeight = 1.; // reset previous decay weight
 
   // Get particle to be decayed
@@ -115,8 +115,17 @@ bool PythiaDecayer::Decay(int decay_particle_id, GHepRecord * event) const
     return false;
   }
 
+  // Get the channel table of the particle, unless the PYTHIA6 decay flags
+  // were changed since it was built
+  const ChannelTable * table = 0;
+  unsigned int idx = (unsigned int) decay_particle->PdgIndex();
+  if(idx < fChannelTableOf.size() && fChannelTableOf[idx] >= 0) {
+    table = &fChannelTables[ fChannelTableOf[idx] ];
+    if(!this->IsValid(*table)) table = 0;
+  }
+
   // Get sub of BRs and compute weight if decay channels were inhibited
-  double sumbr = this->SumOfBranchingRatios(kc);
+  double sumbr = (table) ? table->sumbr : this->SumOfBranchingRatios(kc);
   if(sumbr <= 0) {
     LOG("Pythia6Decay", pWARN)
        << "The sum of enabled "
@@ -126,6 +135,41 @@ bool PythiaDecayer::Decay(int decay_particle_id, GHepRecord * event) const
   }
   fWeight = 1./sumbr; // update weight to account for inhibited channels
 
+  // Check whether the interaction is off a nuclear target or free nucleon
+  // Depending on whether this module is run before or after the hadron
+  // transport module it would affect the daughters status code
+  GHepParticle * target_nucleus = event->TargetNucleus();
+  bool in_nucleus = (target_nucleus!=0);
+
+  // Select the decay channel: natively decayed channels are decayed here,
+  // the other ones by PYTHIA6 with the native channels switched off
+  bool native_off = false;
+  if(table) {
+    RandomGen * rnd = RandomGen::Instance();
+    double x = table->cdf.back() * rnd->RndDec().Rndm();
+    int ich = std::upper_bound(table->cdf.begin(), table->cdf.end(), x)
+              - table->cdf.begin();
+    ich = TMath::Min(ich, (int)table->cdf.size()-1);
+    if(table->native[ich]) {
+      bool decayed = this->DecayNative(decay_particle_id, event, *table, ich);
+      if(decayed) {
+        double weight = event->Weight() * fWeight;
+        event->SetWeight(weight);
+        decay_particle->SetStatus(kIStDecayedState);
+        return true;
+      }
+      // not allowed for the mass of the decaying particle: let PYTHIA6
+      // decay it through all of its channels
+    } else {
+      native_off = true;
+    }
+  }
+  if(native_off) {
+    for(unsigned int i = 0; i < table->native.size(); i++) {
+      if(table->native[i]) fPythia->SetMDME(table->first+i, 1, 0);
+    }
+  }
+
   // Run PYTHIA6 decay
   int    ip    = 0;
   double E     = decay_particle_p4.Energy();
@@ -134,6 +178,12 @@ bool PythiaDecayer::Decay(int decay_particle_id, GHepRecord * event) const
   fPythia->SetMSTJ(22,1);
   py1ent_(&ip, &decay_particle_pdg_code, &E, &theta, &phi);
 
+  if(native_off) {
+    for(unsigned int i = 0; i < table->native.size(); i++) {
+      if(table->native[i]) fPythia->SetMDME(table->first+i, 1, 1);
+    }
+  }
+
   // Get decay products
   fPythia->GetPrimaries();
   TClonesArray * impl = (TClonesArray *) fPythia->ImportParticles("All");
@@ -145,12 +195,6 @@ bool PythiaDecayer::Decay(int decay_particle_id, GHepRecord * event) const
 
   // Copy the PYTHIA6 container to the GENIE event record
 
-  // Check whether the interaction is off a nuclear target or free nucleon
-  // Depending on whether this module is run before or after the hadron
-  // transport module it would affect the daughters status code
-  GHepParticle * target_nucleus = event->TargetNucleus();
-  bool in_nucleus = (target_nucleus!=0);
-
   TMCParticle * p = 0;
   TIter particle_iter(impl);
   while( (p = (TMCParticle *) particle_iter.Next()) ) {
@@ -180,18 +224,10 @@ bool PythiaDecayer::Decay(int decay_particle_id, GHepRecord * event) const
        << daughter_pdg_code << ", m = " << mcp.Mass()
        << " GeV, E = " << mcp.Energy() << " GeV)";
 
-    bool is_hadron = pdg::IsHadron(daughter_pdg_code);
-    bool hadron_in_nuc = (in_nucleus && is_hadron && fRunBefHadroTransp);
-
-    GHepStatus_t daughter_status_code = (hadron_in_nuc) ?
-         kIStHadronInTheNucleus : kIStStableFinalState;
-
     TLorentzVector daughter_p4(
        mcp.Px(),mcp.Py(),mcp.Pz(),mcp.Energy());
-    event->AddParticle(
-       daughter_pdg_code, daughter_status_code,
-       decay_particle_id,-1,-1,-1,
-       daughter_p4, decay_particle_x4);
+    this->AddDaughter(decay_particle_id, event, daughter_pdg_code,
+       in_nucleus, daughter_p4, decay_particle_x4);
   }
 
   // Update the event weight for each weighted particle decay
@@ -204,6 +240,179 @@ bool PythiaDecayer::Decay(int decay_particle_id, GHepRecord * event) const
   return true;
 }
 //____________________________________________________________________________
+bool PythiaDecayer::DecayNative(
+  int decay_particle_id, GHepRecord * event,
+  const ChannelTable & table, int ich) const
+{
+// Decays the particle through the 2- or 3-body decay channel ich of its
+// channel table, with the flat phase space distribution PYTHIA6 would use
+
+  GHepParticle * decay_particle = event->Particle(decay_particle_id);
+
+  TLorentzVector decay_particle_p4 = *(decay_particle->P4());
+  TLorentzVector decay_particle_x4 = *(decay_particle->X4());
+
+  const vector<double> & mass = table.mass[ich];
+  int nd = mass.size();
+
+  bool is_permitted =
+     fPhaseSpaceGenerator.SetDecay(decay_particle_p4, nd, &mass[0]);
+  if(!is_permitted) return false;
+
+  if(nd == 2) {
+    fPhaseSpaceGenerator.Generate();
+  } else {
+    RandomGen * rnd = RandomGen::Instance();
+    double wmax = fPhaseSpaceGenerator.GetWtMax();
+    unsigned int itry = 0;
+    while(1) {
+      itry++;
+      assert(itry < kMaxUnweightDecayIterations);
+      double w  = fPhaseSpaceGenerator.Generate();
+      double gw = wmax * rnd->RndDec().Rndm();
+      if(gw <= w) break;
+    }
+  }
+
+  LOG("Pythia6Decay", pINFO)
+     << "Decayed " << decay_particle->Name()
+     << " through its PYTHIA6 channel " << table.first + ich << " natively";
+
+  GHepParticle * target_nucleus = event->TargetNucleus();
+  bool in_nucleus = (target_nucleus!=0);
+
+  for(int i = 0; i < nd; i++) {
+    const TLorentzVector & daughter_p4 = *(fPhaseSpaceGenerator.GetDecay(i));
+    this->AddDaughter(decay_particle_id, event, table.pdg[ich][i],
+       in_nucleus, daughter_p4, decay_particle_x4);
+  }
+  return true;
+}
+//____________________________________________________________________________
+void PythiaDecayer::AddDaughter(
+  int decay_particle_id, GHepRecord * event, int pdgc, bool in_nucleus,
+  const TLorentzVector & p4, const TLorentzVector & x4) const
+{
+  bool is_hadron = pdg::IsHadron(pdgc);
+  bool hadron_in_nuc = (in_nucleus && is_hadron && fRunBefHadroTransp);
+
+  GHepStatus_t daughter_status_code = (hadron_in_nuc) ?
+       kIStHadronInTheNucleus : kIStStableFinalState;
+
+  event->AddParticle(
+     pdgc, daughter_status_code,
+     decay_particle_id,-1,-1,-1,
+     p4, x4);
+}
+//____________________________________________________________________________
+void PythiaDecayer::LoadConfig(void)
+{
+  Decayer::LoadConfig();
+
+  this->BuildChannelTables();
+}
+//____________________________________________________________________________
+void PythiaDecayer::BuildChannelTables(void)
+{
+// Tabulates the PYTHIA6 decay channels of each particle to be decayed, with
+// the cumulative branching ratios of the enabled ones, and marks the channels
+// that can be decayed natively: 2 or 3 daughters with fixed masses, stable
+// in PYTHIA6, and no matrix element (flat phase space decay, MDME(i,2)=0).
+// Particles with no such channel are left to PYTHIA6.
+
+  Pythia6Gate::Guard pythia6_guard;
+
+  fChannelTables.clear();
+  fChannelTableOf.assign(fDecayTable.size(), -1);
+
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+
+  for(unsigned int idx = 0; idx < fDecayTable.size(); idx++) {
+    if(!fDecayTable[idx]) continue;
+
+    int pdgc = pdglib->Properties(idx).pdgc;
+    int kc   = fPythia->Pycomp(pdgc);
+    if(kc <= 0) continue;
+    if(fPythia->GetMDCY(kc,1) == 0) continue;
+
+    ChannelTable table;
+    table.kc    = kc;
+    table.sign  = (pdgc < 0) ? -1 : 1;
+    table.first = fPythia->GetMDCY(kc,2);
+    int nch     = fPythia->GetMDCY(kc,3);
+
+    bool   ok     = (nch > 0);
+    bool   native = false;
+    double cdf    = 0.;
+    for(int i = 0; ok && i < nch; i++) {
+      int ichannel = table.first + i;
+      int mdme = fPythia->GetMDME(ichannel,1);
+      if(mdme != 0 && mdme != 1) { ok = false; break; }
+
+      bool on = (mdme == 1);
+      if(on) cdf += fPythia->GetBRAT(ichannel);
+      table.on .push_back(on);
+      table.cdf.push_back(cdf);
+
+      vector<int>    pdgd, kcd;
+      vector<double> mass;
+      bool is_native = (fPythia->GetMDME(ichannel,2) == 0);
+      for(int j = 1; is_native && j <= 5; j++) {
+        int kf = fPythia->GetKFDP(ichannel,j);
+        if(kf == 0) break;
+        int kcj = fPythia->Pycomp(kf);
+        if(kcj <= 0) { is_native = false; break; }
+        if(table.sign < 0 && fPythia->GetKCHG(kcj,3) == 1) kf = -kf;
+        is_native = (fPythia->GetMDCY(kcj,1) == 0 &&
+                     fPythia->GetPMAS(kcj,2) == 0 &&
+                     pdglib->Index(kf) >= 0);
+        pdgd.push_back(kf);
+        kcd .push_back(kcj);
+        mass.push_back(fPythia->GetPMAS(kcj,1));
+      }
+      is_native = is_native && (pdgd.size() == 2 || pdgd.size() == 3);
+      if(!is_native) {
+        pdgd.clear(); kcd.clear(); mass.clear();
+      }
+      native = native || (is_native && on);
+
+      table.native.push_back(is_native);
+      table.pdg   .push_back(pdgd);
+      table.kcd   .push_back(kcd);
+      table.mass  .push_back(mass);
+    }
+    if(!ok || !native || cdf <= 0.) continue;
+
+    table.sumbr = this->SumOfBranchingRatios(kc);
+    if(table.sumbr <= 0.) continue;
+
+    fChannelTableOf[idx] = fChannelTables.size();
+    fChannelTables.push_back(table);
+  }
+
+  LOG("Pythia6Decay", pNOTICE)
+     << "Tabulated the PYTHIA6 decay channels of "
+     << fChannelTables.size() << " particles";
+}
+//____________________________________________________________________________
+bool PythiaDecayer::IsValid(const ChannelTable & table) const
+{
+// Checks that the PYTHIA6 decay flags the table was built with are unchanged
+// (they may be switched by other PYTHIA6 users), in which case the particle
+// is left to PYTHIA6
+
+  for(unsigned int i = 0; i < table.on.size(); i++) {
+    bool on = (fPythia->GetMDME(table.first+i,1) == 1);
+    if(on != (bool) table.on[i]) return false;
+    if(!table.native[i]) continue;
+    const vector<int> & kcd = table.kcd[i];
+    for(unsigned int j = 0; j < kcd.size(); j++) {
+      if(fPythia->GetMDCY(kcd[j],1) != 0) return false;
+    }
+  }
+  return true;
+}
+//____________________________________________________________________________
 void PythiaDecayer::Initialize(void) const
 {
   fPythia = TPythia6::Instance();
@@ -230,6 +439,8 @@ void PythiaDecayer::InhibitDecay(int pdg_code, TDecayChannel * dc) const
 {
   if(! this->IsHandled(pdg_code)) return;
 
+  Pythia6Gate::Guard pythia6_guard;
+
   int kc = fPythia->Pycomp(pdg_code);
 
   if(!dc) {
@@ -253,6 +464,8 @@ void PythiaDecayer::UnInhibitDecay(int pdg_code, TDecayChannel * dc) const
 {
   if(! this->IsHandled(pdg_code)) return;
 
+  Pythia6Gate::Guard pythia6_guard;
+
   int kc = fPythia->Pycomp(pdg_code);
 
   if(!dc) {
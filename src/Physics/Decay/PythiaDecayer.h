@@ -20,7 +20,10 @@
 #ifndef _PYTHIA6_DECAYER_I_H_
 #define _PYTHIA6_DECAYER_I_H_
 
+#include <vector>
+
 #include <TPythia6.h>
+#include <TGenPhaseSpace.h>
 
 #include "Physics/Decay/Decayer.h"
 
@@ -39,6 +42,29 @@ public:
 
 private:
 
+  //! The PYTHIA6 decay channels of a particle, tabulated at configuration.
+  //! Channels with 2 or 3 daughters stable in PYTHIA6 and a flat phase space
+  //! matrix element are decayed natively, the other ones by PYTHIA6.
+  struct ChannelTable {
+    int                   kc;        ///< PYTHIA6 compressed code
+    int                   sign;      ///< -1 for antiparticles
+    int                   first;     ///< first PYTHIA6 decay channel
+    std::vector<char>     on;        ///< channel enabled? (MDME(i,1), as tabulated)
+    std::vector<double>   cdf;       ///< cumulative BR of the enabled channels
+    std::vector<char>     native;    ///< channel decayed natively?
+    std::vector< std::vector<int> >    pdg;   ///< daughter PDG codes (native channels)
+    std::vector< std::vector<int> >    kcd;   ///< daughter compressed codes (native channels)
+    std::vector< std::vector<double> > mass;  ///< daughter masses (native channels)
+    double                sumbr;     ///< sum of branching ratios, see SumOfBranchingRatios()
+  };
+
+  void   LoadConfig             (void);
+  void   BuildChannelTables     (void);
+  bool   IsValid                (const ChannelTable & table)     const;
+  bool   DecayNative            (int ip, GHepRecord * event,
+                                 const ChannelTable & table, int ich) const;
+  void   AddDaughter            (int ip, GHepRecord * event, int pdgc, bool in_nucleus,
+                                 const TLorentzVector & p4, const TLorentzVector & x4) const;
   void   Initialize             (void)                           const;
   bool   IsHandled              (int pdgc)                       const;
   void   InhibitDecay           (int pdgc, TDecayChannel * ch=0) const;
@@ -50,6 +76,10 @@ private:
 
   mutable TPythia6 * fPythia;  ///< PYTHIA6 wrapper class
   mutable double     fWeight;
+
+  std::vector<ChannelTable> fChannelTables; ///< channel tables
+  std::vector<int>          fChannelTableOf;///< channel table of each PDGLibrary property table entry (-1: none)
+  mutable TGenPhaseSpace    fPhaseSpaceGenerator;
 };
 
 }         // genie namespace
@@ -18,7 +18,6 @@
 #include "Framework/Conventions/KineVar.h"
 #include "Framework/Conventions/KinePhaseSpace.h"
 #include "Physics/DeepInelastic/EventGen/DISKinematicsGenerator.h"
-#include "Framework/EventGen/EVGThreadException.h"
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/EventGen/RunningThreadInfo.h"
 #include "Framework/GHEP/GHepRecord.h"
@@ -26,6 +25,7 @@
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/MathUtils.h"
+#include "Framework/Numerical/GridEnvelope2D.h"
 #include "Framework/Utils/KineUtils.h"
 #include "Framework/ParticleData/PDGUtils.h"
 
@@ -53,6 +53,8 @@ DISKinematicsGenerator::~DISKinematicsGenerator()
 //___________________________________________________________________________
 void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 {
+  StatsScope stats(this, evrec);
+
   if(fGenerateUniformly) {
     LOG("DISKinematics", pNOTICE)
           << "Generating kinematics uniformly over the allowed phase space";
@@ -80,11 +82,8 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   Range1D_t W  = kps.Limits(kKVW);
   if(W.max <=0 || W.min>=W.max) {
      LOG("DISKinematics", pWARN) << "No available phase space";
-     evrec->EventFlags()->SetBitNumber(kKineGenErr, true);
-     genie::exceptions::EVGThreadException exception;
-     exception.SetReason("No available phase space");
-     exception.SwitchOnFastForward();
-     throw exception;
+     evrec->Reject(kKineGenErr); // No available phase space
+     return;
   }
 
   Range1D_t xl = kps.Limits(kKVx);
@@ -101,7 +100,13 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //   value is found.
   //   If the kinematics are generated uniformly over the allowed phase
   //   space the max xsec is irrelevant
-  double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+  //   If configured, (x,y) are instead sampled from an envelope adapted to
+  //   d2xsec/dxdy (built once per energy bin and cached), and the max xsec
+  //   is not needed either.
+  const GridEnvelope2D * envelope =
+         (fGenerateUniformly) ? 0 : this->Envelope(interaction);
+  double xsec_max =
+         (fGenerateUniformly || envelope) ? -1 : this->MaxXSec(evrec);
 
   //-- Try to select a valid (x,y) pair using the rejection method
 
@@ -116,16 +121,22 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      if(iter > kRjMaxIterations) {
        LOG("DISKinematics", pWARN)
          << " Couldn't select kinematics after " << iter << " iterations";
-       evrec->EventFlags()->SetBitNumber(kKineGenErr, true);
-       genie::exceptions::EVGThreadException exception;
-       exception.SetReason("Couldn't select kinematics");
-       exception.SwitchOnFastForward();
-       throw exception;
+       evrec->Reject(kKineGenErr); // Couldn't select kinematics
+       return;
      }
 
      //-- random x,y
-     gx = xl.min + dx * rnd->RndKine().Rndm();
-     gy = yl.min + dy * rnd->RndKine().Rndm();
+     //   (from the envelope, whose height is the local max xsec)
+     if(envelope) {
+       double u = -1, v = -1;
+       xsec_max = envelope->Sample(rnd->RndKine().Rndm(),
+                    rnd->RndKine().Rndm(), rnd->RndKine().Rndm(), u, v);
+       gx = xl.min + dx * u;
+       gy = yl.min + dy * v;
+     } else {
+       gx = xl.min + dx * rnd->RndKine().Rndm();
+       gy = yl.min + dy * rnd->RndKine().Rndm();
+     }
      interaction->KinePtr()->Setx(gx);
      interaction->KinePtr()->Sety(gy);
      kinematics::UpdateWQ2FromXY(interaction);
@@ -136,7 +147,7 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
         << " (Q2 = " << interaction->KinePtr()->Q2() << ")";
 
      //-- compute the cross section for current kinematics
-     xsec = fXSecModel->XSec(interaction, kPSxyfE);
+     xsec = this->XSec(interaction, kPSxyfE);
 
      //-- decide whether to accept the current kinematics
      if(!fGenerateUniformly) {
@@ -233,6 +244,8 @@ void DISKinematicsGenerator::LoadConfig(void)
   //   an event weight?
     GetParamDef( "UniformOverPhaseSpace", fGenerateUniformly, false ) ;
 
+  //-- Sample (x,y) from an envelope adapted to the differential xsec?
+    this->LoadEnvelopeConfig();
 }
 //____________________________________________________________________________
 double DISKinematicsGenerator::ComputeMaxXSec(
@@ -314,7 +327,7 @@ double DISKinematicsGenerator::ComputeMaxXSec(
         interaction->KinePtr()->Setx(gx);
         kinematics::UpdateWQ2FromXY(interaction);
 
-        double xsec = fXSecModel->XSec(interaction, kPSxyfE);
+        double xsec = this->XSec(interaction, kPSxyfE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
         LOG("DISKinematics", pINFO)
                 << "xsec(y=" << gy << ", x=" << gx << ") = " << xsec;
@@ -340,7 +353,7 @@ double DISKinematicsGenerator::ComputeMaxXSec(
    	     gx = gx - dxn;
              interaction->KinePtr()->Setx(gx);
              kinematics::UpdateWQ2FromXY(interaction);
-             xsec = fXSecModel->XSec(interaction, kPSxyfE);
+             xsec = this->XSec(interaction, kPSxyfE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
              LOG("DISKinematics", pINFO)
                 << "xsec(y=" << gy << ", x=" << gx << ") = " << xsec;
@@ -375,3 +388,26 @@ double DISKinematicsGenerator::ComputeMaxXSec(
   return max_xsec;
 }
 //___________________________________________________________________________
+bool DISKinematicsGenerator::EnvelopeLimits(
+     const Interaction * interaction, Range1D_t & xl, Range1D_t & yl) const
+{
+  const KPhaseSpace & kps = interaction->PhaseSpace();
+  Range1D_t W = kps.Limits(kKVW);
+  if(W.max <=0 || W.min>=W.max) return false;
+
+  xl = kps.Limits(kKVx);
+  yl = kps.Limits(kKVy);
+  return (xl.min>0 && yl.min>0 && xl.min<xl.max && yl.min<yl.max);
+}
+//___________________________________________________________________________
+double DISKinematicsGenerator::EnvelopeXSec(
+              const Interaction * interaction, double x, double y) const
+{
+  interaction->KinePtr()->Setx(x);
+  interaction->KinePtr()->Sety(y);
+  kinematics::UpdateWQ2FromXY(interaction);
+
+  double xsec = this->XSec(interaction, kPSxyfE);
+  return TMath::Max(0., xsec);
+}
+//___________________________________________________________________________
@@ -47,6 +47,10 @@ public :
 private:
   void   LoadConfig      (void);
   double ComputeMaxXSec  (const Interaction * interaction) const;
+
+  // sampling envelope in (x,y)
+  bool   EnvelopeLimits  (const Interaction * in, Range1D_t & xl, Range1D_t & yl) const;
+  double EnvelopeXSec    (const Interaction * in, double x, double y) const;
 };
 
 }      // genie namespace
@@ -11,7 +11,6 @@
 #include <TMath.h>
 
 #include "Physics/DeepInelastic/EventGen/DISPrimaryLeptonGenerator.h"
-#include "Framework/EventGen/EVGThreadException.h"
 #include "Framework/GHEP/GHepRecord.h"
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/GHEP/GHepFlags.h"
@@ -47,11 +46,9 @@ void DISPrimaryLeptonGenerator::ProcessEventRecord(GHepRecord * evrec) const
   if(evrec->FinalStatePrimaryLepton()->IsOffMassShell()) {
     LOG("LeptonicVertex", pERROR)
                << "*** Selected kinematics lead to off mass shell lepton!";
-     evrec->EventFlags()->SetBitNumber(kLeptoGenErr, true);
-     genie::exceptions::EVGThreadException exception;
-     exception.SetReason("E<m for final state lepton");
-     exception.SwitchOnFastForward();
-     throw exception;
+     // E<m for final state lepton
+     evrec->Reject(kLeptoGenErr);
+     return;
   }
 }
 //___________________________________________________________________________
@@ -44,6 +44,8 @@ public:
   double Gluon       (double x, double q2) const;
   PDF_t  AllPDFs     (double x, double q2) const;
 
+  using PDFModelI::AllPDFs; // the default batched evaluation
+
   //! overload the Algorithm::Configure() methods to load private data
   //! members from configuration options
   void Configure(const Registry & config);
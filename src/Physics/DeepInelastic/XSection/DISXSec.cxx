@@ -20,6 +20,7 @@
 #include "Framework/Conventions/Units.h"
 #include "Physics/DeepInelastic/XSection/DISXSec.h"
 #include "Physics/XSectionIntegration/GSLXSecFunc.h"
+#include "Framework/Interaction/ScratchInteraction.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
@@ -78,7 +79,8 @@ double DISXSec::Integrate(
   //
   XSecSplineList * xsl = XSecSplineList::Instance();
   if(init_state.Tgt().IsNucleus() && !xsl->IsEmpty() ) {
-    Interaction * interaction = new Interaction(*in);
+    ScratchInteraction scratch(in);
+    Interaction * interaction = scratch.Get();
     Target * target = interaction->InitStatePtr()->TgtPtr();
     if(pdg::IsProton(nucpdgc)) { target->SetId(kPdgTgtFreeP); }
     else                       { target->SetId(kPdgTgtFreeN); }
@@ -91,10 +93,8 @@ double DISXSec::Integrate(
           xsec *= NNucl;
           LOG("DISXSec", pINFO)  << "XSec[DIS] (E = " << Ev << " GeV) = " << xsec;
       }
-      delete interaction;
       return xsec;
     }
-    delete interaction;
   }
 
   // There was no corresponding free nucleon spline saved in XSecSplineList that
@@ -106,7 +106,8 @@ double DISXSec::Integrate(
   bool precalc_bare_xsec = RunOpt::Instance()->BareXSecPreCalc();
   if(precalc_bare_xsec) {
      Cache * cache = Cache::Instance();
-     Interaction * interaction = new Interaction(*in);
+     ScratchInteraction scratch(in);
+     Interaction * interaction = scratch.Get();
      string key = this->CacheBranchName(model,interaction);
      LOG("DISXSec", pINFO) << "Finding cache branch with key: " << key;
      CacheBranchFx * cache_branch =
@@ -121,14 +122,14 @@ double DISXSec::Integrate(
      double xsec = cb(Ev);
      if(! interaction->TestBit(kIAssumeFreeNucleon) ) { xsec *= NNucl; }
      LOG("DISXSec", pINFO)  << "XSec[DIS] (E = " << Ev << " GeV) = " << xsec;
-     delete interaction;
      return xsec;
   }
   else {
     // Just go ahead and integrate the input differential cross section for the
     // specified interaction.
     //
-     Interaction * interaction = new Interaction(*in);
+     ScratchInteraction scratch(in);
+     Interaction * interaction = scratch.Get();
      interaction->SetBit(kISkipProcessChk);
 //   interaction->SetBit(kISkipKinematicChk);
 
@@ -171,8 +172,6 @@ double DISXSec::Integrate(
 
      LOG("DISXSec", pINFO)  << "XSec[DIS] (E = " << Ev << " GeV) = " << xsec;
 
-     delete interaction;
-
      return xsec;
   }
   return 0;
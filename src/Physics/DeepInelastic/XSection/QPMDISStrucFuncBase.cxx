@@ -23,7 +23,11 @@
 */
 //____________________________________________________________________________
 
+#include <mutex>
+#include <sstream>
+
 #include <TMath.h>
+#include <TNtupleD.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/Conventions/GBuild.h"
@@ -36,25 +40,57 @@
 #include "Framework/Utils/KineUtils.h"
 #include "Physics/NuclearState/NuclearUtils.h"
 #include "Framework/Utils/PhysUtils.h"
+#include "Framework/Utils/Cache.h"
+#include "Framework/Utils/CacheBranchNtp.h"
+
+using std::ostringstream;
+using std::vector;
 
 using namespace genie;
 using namespace genie::constants;
 
+//____________________________________________________________________________
+namespace {
+  // values per SF grid node: x*F1, F2, x*F3, x*F5 of the light quarks,
+  // then of the charm quarks (F4 = F6 = 0)
+  const int kNSFGridValues = 8;
+
+  // guards the SF grids, as the algorithm instance is shared
+  std::mutex gSFGridMutex;
+
+  // grid variable in x: log(x/(1-x)) resolves both x->0 and x->1
+  inline double SFGridU(double x) { return TMath::Log(x/(1.-x)); }
+
+  // Catmull-Rom weights of the 4 nodes around t in [0,1) from node 1
+  inline void CatmullRom(double t, double * w)
+  {
+    double t2 = t*t;
+    double t3 = t2*t;
+    w[0] = 0.5 * (   -t3 + 2*t2 - t );
+    w[1] = 0.5 * (  3*t3 - 5*t2 + 2 );
+    w[2] = 0.5 * ( -3*t3 + 4*t2 + t );
+    w[3] = 0.5 * (    t3 -   t2     );
+  }
+}
+
 //____________________________________________________________________________
 QPMDISStrucFuncBase::QPMDISStrucFuncBase() :
-DISStructureFuncModelI()
+DISStructureFuncModelI(),
+fUseSFGrid(false)
 {
   this->InitPDF();
 }
 //____________________________________________________________________________
 QPMDISStrucFuncBase::QPMDISStrucFuncBase(string name) :
-DISStructureFuncModelI(name)
+DISStructureFuncModelI(name),
+fUseSFGrid(false)
 {
   this->InitPDF();
 }
 //____________________________________________________________________________
 QPMDISStrucFuncBase::QPMDISStrucFuncBase(string name, string config):
-DISStructureFuncModelI(name, config)
+DISStructureFuncModelI(name, config),
+fUseSFGrid(false)
 {
   this->InitPDF();
 }
@@ -124,6 +160,27 @@ void QPMDISStrucFuncBase::LoadConfig(void)
   GetParam( "WeinbergAngle", thw ) ;
   fSin2thw = TMath::Power(TMath::Sin(thw), 2);
 
+  //-- pre-tabulated (x,Q2) SF grids
+  GetParamDef( "UseSFGrid",     fUseSFGrid,     false  ) ;
+  GetParamDef( "SFGrid-NX",     fSFGridNx,      120    ) ;
+  GetParamDef( "SFGrid-NQ2",    fSFGridNQ2,     100    ) ;
+  GetParamDef( "SFGrid-Xmin",   fSFGridXmin,    1.E-4  ) ;
+  GetParamDef( "SFGrid-Xmax",   fSFGridXmax,    0.999  ) ;
+  GetParamDef( "SFGrid-Q2min",  fSFGridQ2min,   1.E-3  ) ;
+  GetParamDef( "SFGrid-Q2max",  fSFGridQ2max,   1.E+4  ) ;
+
+  if(fSFGridNx < 4 || fSFGridNQ2 < 4) {
+    LOG("DISSF", pWARN)
+      << "SF grids need at least 4 x 4 nodes; using the direct calculation";
+    fUseSFGrid = false;
+  }
+
+  // The grids depend on the configuration
+  {
+    std::lock_guard<std::mutex> lock(gSFGridMutex);
+    fSFGrids.clear();
+  }
+
   LOG("DISSF", pDEBUG) << "Done loading configuration";
 }
 //____________________________________________________________________________
@@ -135,6 +192,14 @@ void QPMDISStrucFuncBase::InitPDF(void)
 }
 //____________________________________________________________________________
 void QPMDISStrucFuncBase::Calculate(const Interaction * interaction) const
+{
+  if(fUseSFGrid && this->InterpolateSF(interaction)) return;
+
+  this->CalculateSF(interaction, kSFCharmAtThreshold);
+}
+//____________________________________________________________________________
+void QPMDISStrucFuncBase::CalculateSF(
+                 const Interaction * interaction, SFCharm_t charm) const
 {
   // Reset mutable members
   fF1 = 0;
@@ -232,7 +297,8 @@ void QPMDISStrucFuncBase::Calculate(const Interaction * interaction) const
   // Compute PDFs [both at (scaling-var,Q2) and (slow-rescaling-var,Q2)
   // Applying all PDF K-factors abd scaling variable corrections
 
-  this -> CalcPDFs (interaction);
+  if(charm == kSFCharmAtThreshold) this -> CalcPDFs (interaction);
+  else                             this -> CalcPDFs (interaction, charm);
 
   //
   // Compute structure functions for the EM, NC and CC cases
@@ -493,6 +559,12 @@ double QPMDISStrucFuncBase::R(const Interaction * interaction) const
 }
 //____________________________________________________________________________
 void QPMDISStrucFuncBase::CalcPDFs(const Interaction * interaction) const
+{
+  this->CalcPDFs(interaction, kSFCharmAtThreshold);
+}
+//____________________________________________________________________________
+void QPMDISStrucFuncBase::CalcPDFs(
+                 const Interaction * interaction, SFCharm_t charm) const
 {
   // Clean-up previous calculation
   fPDF  -> Reset();
@@ -509,15 +581,21 @@ void QPMDISStrucFuncBase::CalcPDFs(const Interaction * interaction) const
   // Get the Q2 for which PDFs will be evaluated
   double Q2pdf = TMath::Max(Q2val, fQ2min);
 
-  // Compute PDFs at (x,Q2)
+  // PDFs are computed at (x,Q2) and, above the charm threshold, at
+  // (xc,Q2), in one batch
+  double xpdf  [2] = { x,     0.    };
+  double Q2pdfs[2] = { Q2pdf, Q2pdf };
+  unsigned int npdf = 1;
+
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("DISSF", pDEBUG) << "Calculating PDFs @ x = " << x << ", Q2 = " << Q2pdf;
 #endif
-  fPDF->Calculate(x, Q2pdf);
 
   // Check whether it is above charm threshold
-  bool above_charm =
-           utils::kinematics::IsAboveCharmThreshold(x, Q2val, M, fMc);
+  bool above_charm = (charm == kSFCharmOn);
+  if(charm == kSFCharmAtThreshold) {
+     above_charm = utils::kinematics::IsAboveCharmThreshold(x, Q2val, M, fMc);
+  }
   if(above_charm) {
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
     LOG("DISSF", pDEBUG)
@@ -536,7 +614,7 @@ void QPMDISStrucFuncBase::CalcPDFs(const Interaction * interaction) const
           LOG("DISSF", pDEBUG)
               << "Calculating PDFs @ xc (slow rescaling) = " << x << ", Q2 = " << Q2val;
 #endif
-          fPDFc->Calculate(xc, Q2pdf);
+          xpdf[npdf++] = xc;
        }
     }// charm off?
   }//above charm thr?
@@ -545,6 +623,11 @@ void QPMDISStrucFuncBase::CalcPDFs(const Interaction * interaction) const
      << "The event is below the charm threshold (mcharm = " << fMc << ")";
   }
 
+  PDF_t pdfs[2];
+  fPDF->Model()->AllPDFs(npdf, xpdf, Q2pdfs, pdfs);
+  fPDF->Set(pdfs[0]);
+  if(npdf > 1) fPDFc->Set(pdfs[1]);
+
   // Compute the K factors
   double kval_u = 1.;
   double kval_d = 1.;
@@ -624,3 +707,181 @@ void QPMDISStrucFuncBase::CalcPDFs(const Interaction * interaction) const
 
 }
 //____________________________________________________________________________
+bool QPMDISStrucFuncBase::InterpolateSF(const Interaction * interaction) const
+{
+// Interpolates the SFs in the (x,Q2) grid of the input interaction.
+// Returns false if the grid does not apply, and the SFs must be calculated.
+
+  const Target & tgt = interaction->InitState().Tgt();
+  if(tgt.HitQrkIsSet()) return false;
+
+  double bjx   = interaction->Kine().x();
+  double Q2val = this->Q2(interaction);
+  if(bjx   <= fSFGridXmin  || bjx   >= fSFGridXmax ) return false;
+  if(Q2val <= fSFGridQ2min || Q2val >= fSFGridQ2max) return false;
+
+  const vector<double> & grid = this->SFGrid(interaction);
+
+  // nodes and Catmull-Rom weights around (x,Q2), at least one node away
+  // from the grid edges
+  double umin = SFGridU(fSFGridXmin);
+  double du   = (SFGridU(fSFGridXmax) - umin) / (fSFGridNx-1);
+  double lmin = TMath::Log(fSFGridQ2min);
+  double dl   = (TMath::Log(fSFGridQ2max) - lmin) / (fSFGridNQ2-1);
+
+  double fu = (SFGridU(bjx)       - umin) / du;
+  double fl = (TMath::Log(Q2val)  - lmin) / dl;
+  int iu = TMath::Min(TMath::Max((int) fu, 1), fSFGridNx -3);
+  int il = TMath::Min(TMath::Max((int) fl, 1), fSFGridNQ2-3);
+
+  double wu[4], wl[4];
+  CatmullRom(fu-iu, wu);
+  CatmullRom(fl-il, wl);
+
+  // the charm quark contribution, above threshold for this hit nucleon
+  double x = this->ScalingVar(interaction);
+  double M = tgt.HitNucP4().M();
+  bool above_charm = !fCharmOff &&
+           utils::kinematics::IsAboveCharmThreshold(x, Q2val, M, fMc);
+  int nval = (above_charm) ? kNSFGridValues : kNSFGridValues/2;
+
+  double sf[kNSFGridValues] = { 0. };
+  for(int i = 0; i < 4; i++) {
+    for(int j = 0; j < 4; j++) {
+      double w = wu[i] * wl[j];
+      const double * node =
+          &grid[ ((iu-1+i) * fSFGridNQ2 + (il-1+j)) * kNSFGridValues ];
+      for(int k = 0; k < nval; k++) sf[k] += w * node[k];
+    }
+  }
+  if(above_charm) {
+    for(int k = 0; k < kNSFGridValues/2; k++) sf[k] += sf[k+kNSFGridValues/2];
+  }
+
+  // tabulated x*F1, x*F3, x*F5: see FillSFGrid()
+  double xdiv = (fUse2016Corrections) ? bjx : x;
+  fF1 = sf[0] / xdiv;
+  fF2 = sf[1];
+  fF3 = sf[2] / xdiv;
+  fF4 = 0.;
+  fF5 = sf[3] / xdiv;
+  fF6 = 0.;
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("DISSF", pDEBUG)
+     << "F1-F5 (interpolated) = "
+     << fF1 << ", " << fF2 << ", " << fF3 << ", " << fF4 << ", " << fF5;
+#endif
+  return true;
+}
+//____________________________________________________________________________
+const vector<double> & QPMDISStrucFuncBase::SFGrid(
+                                      const Interaction * interaction) const
+{
+// Returns the SF grid of the input interaction, taking it from the Cache
+// (possibly loaded from a cache file) or filling it at first use
+
+  ostringstream ikey;
+  ikey << interaction->AsString();
+  if(interaction->TestBit(kIAssumeFreeNucleon))   ikey << ";free-nucleon";
+  if(interaction->TestBit(kINoNuclearCorrection)) ikey << ";no-nucl-corr";
+
+  std::lock_guard<std::mutex> lock(gSFGridMutex);
+
+  map<string, vector<double> >::const_iterator it = fSFGrids.find(ikey.str());
+  if(it != fSFGrids.end()) return it->second;
+
+  vector<double> & grid = fSFGrids[ikey.str()];
+  unsigned int nnodes = fSFGridNx * fSFGridNQ2;
+
+  Cache * cache = Cache::Instance();
+  ostringstream hkey;
+  hkey << "SFGrid/" << this->ConfigHash();
+  string key = cache->CacheBranchKey(this->Id().Key(), hkey.str(), ikey.str());
+
+  CacheBranchNtp * branch =
+       dynamic_cast<CacheBranchNtp *> (cache->FindCacheBranch(key));
+  if(branch && branch->Ntuple() &&
+     branch->Ntuple()->GetEntries() == (Long64_t) nnodes &&
+     branch->Ntuple()->GetNvar() == kNSFGridValues)
+  {
+     TNtupleD * ntp = branch->Ntuple();
+     grid.resize(nnodes * kNSFGridValues);
+     for(unsigned int n = 0; n < nnodes; n++) {
+       ntp->GetEntry(n);
+       const double * values = ntp->GetArgs();
+       for(int k = 0; k < kNSFGridValues; k++) {
+         grid[n*kNSFGridValues + k] = values[k];
+       }
+     }
+     LOG("DISSF", pINFO) << "Loaded the SF grid of " << ikey.str();
+     return grid;
+  }
+
+  this->FillSFGrid(interaction, grid);
+
+  branch = new CacheBranchNtp("SFGrid", "xF1:F2:xF3:xF5:xF1c:F2c:xF3c:xF5c");
+  for(unsigned int n = 0; n < nnodes; n++) {
+    branch->Ntuple()->Fill(&grid[n*kNSFGridValues]);
+  }
+  cache->AddCacheBranch(key, branch);
+
+  LOG("DISSF", pINFO)
+    << "Tabulated the SFs of " << ikey.str() << " in "
+    << fSFGridNx << " x " << fSFGridNQ2 << " (x,Q2) nodes";
+
+  return grid;
+}
+//____________________________________________________________________________
+void QPMDISStrucFuncBase::FillSFGrid(
+       const Interaction * interaction, vector<double> & grid) const
+{
+// Calculates the SFs at the (x,Q2) grid nodes, without and with the charm
+// quark contribution, for a copy of the input interaction.
+// x*F1, x*F3, x*F5 are tabulated, as they are smooth at low x (the x they
+// are multiplied with is the one dividing F2 and xF3 in CalculateSF()).
+
+  grid.assign(fSFGridNx * fSFGridNQ2 * kNSFGridValues, 0.);
+
+  Interaction node(*interaction);
+  Kinematics * kine = node.KinePtr();
+  kine->Reset();
+
+  double umin = SFGridU(fSFGridXmin);
+  double du   = (SFGridU(fSFGridXmax) - umin) / (fSFGridNx-1);
+  double lmin = TMath::Log(fSFGridQ2min);
+  double dl   = (TMath::Log(fSFGridQ2max) - lmin) / (fSFGridNQ2-1);
+
+  for(int i = 0; i < fSFGridNx; i++) {
+    double u   = umin + i*du;
+    double bjx = 1. / (1. + TMath::Exp(-u));
+    for(int j = 0; j < fSFGridNQ2; j++) {
+      double Q2val = TMath::Exp(lmin + j*dl);
+      kine->Setx (bjx);
+      kine->SetQ2(Q2val);
+
+      double x    = this->ScalingVar(&node);
+      double xdiv = (fUse2016Corrections) ? bjx : x;
+      double * values = &grid[ (i*fSFGridNQ2 + j) * kNSFGridValues ];
+
+      this->CalculateSF(&node, kSFCharmOff);
+      values[0] = fF1 * xdiv;
+      values[1] = fF2;
+      values[2] = fF3 * xdiv;
+      values[3] = fF5 * xdiv;
+
+      // charm quark contribution, where the slow rescaling var is physical
+      if(fCharmOff) continue;
+      double M  = node.InitState().Tgt().HitNucP4().M();
+      double xc = utils::kinematics::SlowRescalingVar(x, Q2val, M, fMc);
+      if(xc <= 0 || xc >= 1) continue;
+
+      this->CalculateSF(&node, kSFCharmOn);
+      values[4] = fF1 * xdiv - values[0];
+      values[5] = fF2        - values[1];
+      values[6] = fF3 * xdiv - values[2];
+      values[7] = fF5 * xdiv - values[3];
+    }
+  }
+}
+//____________________________________________________________________________
@@ -7,6 +7,15 @@
           Provides common implementation for concrete objects implementing the
           DISStructureFuncModelI interface.
 
+          Optionally (UseSFGrid), the structure functions of each
+          interaction (probe, target, hit nucleon, current) are tabulated
+          at first use on a (x, Q2) grid and interpolated with bicubic
+          (Catmull-Rom) splines. The light and charm quark contributions
+          are tabulated separately, so that the charm threshold is still
+          applied exactly for the (possibly off-shell) hit nucleon. The
+          grids are kept in the GENIE Cache, and saved with it when a cache
+          file is in use.
+
 \ref      For a discussion of DIS SF see for example E.A.Paschos and J.Y.Yu,
           Phys.Rev.D 65.033002 and R.Devenish and A.Cooper-Sarkar, OUP 2004.
 
@@ -27,6 +36,10 @@
 #ifndef _QPM_DIS_STRUCTURE_FUNCTIONS_BASE_H_
 #define _QPM_DIS_STRUCTURE_FUNCTIONS_BASE_H_
 
+#include <map>
+#include <string>
+#include <vector>
+
 #include "Physics/DeepInelastic/XSection/DISStructureFuncModelI.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Physics/PartonDistributions/PDF.h"
@@ -87,6 +100,13 @@ protected:
   double fSin2thw;           ///<
   bool   fUse2016Corrections;///< Use 2016 SF relation corrections
   double fLowQ2CutoffF1F2;   ///< Set min for relation between 2xF1 and F2
+  bool   fUseSFGrid;         ///< interpolate the SFs in pre-tabulated (x,Q2) grids?
+  int    fSFGridNx;          ///< number of x nodes of the SF grids
+  int    fSFGridNQ2;         ///< number of Q2 nodes of the SF grids
+  double fSFGridXmin;        ///< min x of the SF grids
+  double fSFGridXmax;        ///< max x of the SF grids
+  double fSFGridQ2min;       ///< min Q2 of the SF grids
+  double fSFGridQ2max;       ///< max Q2 of the SF grids
 
   mutable double fF1;
   mutable double fF2;
@@ -109,6 +129,24 @@ protected:
   mutable double fs_c;
   mutable double fc_c;
 
+private:
+
+  //! charm quark contribution in the SF calculation
+  typedef enum ESFCharm {
+    kSFCharmAtThreshold = 0,  ///< above the charm threshold only
+    kSFCharmOff,              ///< never
+    kSFCharmOn                ///< always (for xc < 1)
+  } SFCharm_t;
+
+  void CalculateSF   (const Interaction * i, SFCharm_t charm) const;
+  void CalcPDFs      (const Interaction * i, SFCharm_t charm) const;
+  bool InterpolateSF (const Interaction * i) const;
+
+  const std::vector<double> & SFGrid   (const Interaction * i) const;
+  void                        FillSFGrid (const Interaction * i, std::vector<double> & grid) const;
+
+  mutable std::map<std::string, std::vector<double> > fSFGrids; ///< SF grids per interaction
+
 };
 
 }         // genie namespace
@@ -32,6 +32,7 @@ public :
 
   //-- implement the EventRecordVisitorI interface
   void ProcessEventRecord(GHepRecord * event_rec) const;
+  bool MayStepBack       (void) const { return true; }
 };
 
 }      // genie namespace
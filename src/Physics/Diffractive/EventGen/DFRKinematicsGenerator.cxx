@@ -25,6 +25,7 @@
 #include "Framework/GHEP/GHepRecord.h"
 #include "Framework/GHEP/GHepFlags.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/GridEnvelope2D.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/MathUtils.h"
 #include "Framework/Utils/KineUtils.h"
@@ -55,6 +56,8 @@ DFRKinematicsGenerator::~DFRKinematicsGenerator()
 //___________________________________________________________________________
 void DFRKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 {
+  StatsScope stats(this, evrec);
+
   if(fGenerateUniformly) {
     LOG("DFRKinematics", pNOTICE)
           << "Generating kinematics uniformly over the allowed phase space";
@@ -115,7 +118,16 @@ void DFRKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //   value is found.
   //   If the kinematics are generated uniformly over the allowed phase
   //   space the max xsec is irrelevant
-  double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+  //   If configured, (x,y) are instead sampled from a grid envelope (built
+  //   once per energy bin and cached) and t from exp(-beta*t), and the max
+  //   xsec is not needed either.
+  const GridEnvelope2D * grid =
+         (fGenerateUniformly) ? 0 : this->Envelope(interaction);
+  Range1D_t gridx, gridy;
+  if(grid && !this->EnvelopeLimits(interaction, gridx, gridy)) grid = 0;
+
+  double xsec_max =
+         (fGenerateUniformly || grid) ? -1 : this->MaxXSec(evrec);
 
   //-- Try to select a valid (x,y,t) triplet using the rejection method
 
@@ -123,6 +135,7 @@ void DFRKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   double dy = yl.max - yl.min;
   double dt = tl.max - tl.min;
   double gx=-1, gy=-1, gt=-1, gW=-1, gQ2=-1, xsec=-1;
+  double expbt_max = 1. - TMath::Exp(-fBeta * tl.max);
 
   unsigned int iter = 0;
   bool accept = false;
@@ -138,10 +151,22 @@ void DFRKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
        throw exception;
      }
 
-     //-- random x,y,t
-     gx = xl.min + dx * rnd->RndKine().Rndm();
-     gy = yl.min + dy * rnd->RndKine().Rndm();
-     gt = tl.min + dt * rnd->RndKine().Rndm();
+     double max = xsec_max;
+     if(grid) {
+       //-- x,y from the envelope, t from exp(-beta*t) in [0, tmax]
+       double u = -1, v = -1;
+       max = grid->Sample(rnd->RndKine().Rndm(),
+                 rnd->RndKine().Rndm(), rnd->RndKine().Rndm(), u, v);
+       gx = gridx.min + u * (gridx.max - gridx.min);
+       gy = gridy.min + v * (gridy.max - gridy.min);
+       gt = -TMath::Log(1. - expbt_max * rnd->RndKine().Rndm()) / fBeta;
+       max *= TMath::Exp(-fBeta * gt);
+     } else {
+       //-- random x,y,t
+       gx = xl.min + dx * rnd->RndKine().Rndm();
+       gy = yl.min + dy * rnd->RndKine().Rndm();
+       gt = tl.min + dt * rnd->RndKine().Rndm();
+     }
 
      interaction->KinePtr()->Setx(gx);
      interaction->KinePtr()->Sety(gy);
@@ -151,12 +176,12 @@ void DFRKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
        << "Trying: x = " << gx << ", y = " << gy << ", t = " << gt;
 
      //-- compute the cross section for current kinematics
-     xsec = fXSecModel->XSec(interaction, kPSxytfE);
+     xsec = this->XSec(interaction, kPSxytfE);
 
      //-- decide whether to accept the current kinematics
      if(!fGenerateUniformly) {
-        this->AssertXSecLimits(interaction, xsec, xsec_max);
-        double n = xsec_max * rnd->RndKine().Rndm();
+        this->AssertXSecLimits(interaction, xsec, max);
+        double n = max * rnd->RndKine().Rndm();
         double J = 1;
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
@@ -245,6 +270,8 @@ void DFRKinematicsGenerator::LoadConfig(void)
 
   GetParam( "DFR-Beta", fBeta ) ;
 
+  //-- Grid envelope for (x,y)
+  this->LoadEnvelopeConfig();
 }
 //____________________________________________________________________________
 double DFRKinematicsGenerator::ComputeMaxXSec(
@@ -318,7 +345,7 @@ double DFRKinematicsGenerator::ComputeMaxXSec(
           double gt = tmin + k*dt;
           interaction->KinePtr()->Sett(gt);
 
-          double xsec = fXSecModel->XSec(interaction, kPSxytfE);
+          double xsec = this->XSec(interaction, kPSxytfE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
 	  LOG("DFRKinematics", pINFO)
 	    << "xsec(y=" << gy << ", x=" << gx << ", t=" << gt << ") = " << xsec;
@@ -351,3 +378,54 @@ double DFRKinematicsGenerator::ComputeMaxXSec(
   return max_xsec;
 }
 //___________________________________________________________________________
+bool DFRKinematicsGenerator::EnvelopeLimits(
+     const Interaction * interaction, Range1D_t & xl, Range1D_t & yl) const
+{
+// x,y are sampled over the same ranges as with a flat max xsec
+
+  if(fBeta <= 0.) return false;
+
+  const KPhaseSpace & kps = interaction->PhaseSpace();
+  xl = kps.Limits(kKVx);
+  yl = kps.Limits(kKVy);
+  return (xl.min>0 && yl.min>0 && xl.min<xl.max && yl.min<yl.max);
+}
+//___________________________________________________________________________
+double DFRKinematicsGenerator::EnvelopeXSec(
+              const Interaction * interaction, double x, double y) const
+{
+// The largest d3xsec/dxdydt * exp(beta*t) at the input x,y, found on a
+// coarse scan of the allowed t range. Apart from exp(-beta*t), the cross
+// section depends on t only through the pion energy, and weakly.
+
+  const KPhaseSpace & kps = interaction->PhaseSpace();
+
+  interaction->KinePtr()->Setx(x);
+  interaction->KinePtr()->Sety(y);
+  kinematics::UpdateWQ2FromXY(interaction);
+
+  // the t range depends on x and y and is not defined (NaN) for unphysical
+  // (x,y) pairs
+  Range1D_t Wl  = kps.WLim();
+  Range1D_t Q2l = kps.Q2Lim_W();
+  bool in_phys = math::IsWithinLimits(interaction->KinePtr()->W(), Wl);
+  in_phys = in_phys && math::IsWithinLimits(interaction->KinePtr()->Q2(), Q2l);
+  if(!in_phys) return 0.;
+
+  Range1D_t tl = kps.TLim();
+  double tmin = TMath::Max(tl.min, 0.);
+  double tmax = TMath::Min(tl.max, KPhaseSpace::GetTMaxDFR());
+  if(tmax < tmin) return 0.;
+
+  const int Nt = 5;
+  double dt = (tmax-tmin)/(Nt-1);
+  double max_xsec = 0.;
+  for(int k=0; k<Nt; k++) {
+    double gt = tmin + k*dt;
+    interaction->KinePtr()->Sett(gt);
+    double xsec = this->XSec(interaction, kPSxytfE) * TMath::Exp(fBeta*gt);
+    max_xsec = TMath::Max(xsec, max_xsec);
+  }
+  return max_xsec;
+}
+//___________________________________________________________________________
@@ -43,7 +43,12 @@ private:
   void   LoadConfig      (void);
   double ComputeMaxXSec  (const Interaction * interaction) const;
 
-  double fBeta;
+  // (x,y) are sampled from a grid envelope of the cross section with
+  // its exp(-beta*t) dependence taken out, and t from exp(-beta*t)
+  bool   EnvelopeLimits  (const Interaction * in, Range1D_t & xl, Range1D_t & yl) const;
+  double EnvelopeXSec    (const Interaction * in, double x, double y) const;
+
+  double fBeta;          ///< slope of the t dependence, exp(-beta*t)
 };
 
 }      // genie namespace
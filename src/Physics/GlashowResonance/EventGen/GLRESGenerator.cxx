@@ -13,6 +13,11 @@
 #include <RVersion.h>
 #include <TClonesArray.h>
 #include <TMath.h>
+#if ROOT_VERSION_CODE >= ROOT_VERSION(5,15,6)
+#include <TMCParticle.h>
+#else
+#include <TMCParticle6.h>
+#endif
 
 #include "Framework/Conventions/Constants.h"
 #include "Framework/GHEP/GHepStatus.h"
@@ -23,11 +28,19 @@
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/Utils/Pythia6Gate.h"
 #include "Physics/GlashowResonance/EventGen/GLRESGenerator.h"
 
 using namespace genie;
 using namespace genie::constants;
 
+namespace {
+  // PYTHIA6 keeps a single initialisation (in its common blocks), shared by
+  // all GLRESGenerator instances: the nominal c.m. energy of the current
+  // nu_ebar e- initialisation (0: not initialised yet)
+  double gPythia6GLRESEcm = 0.;
+}
+
 //___________________________________________________________________________
 GLRESGenerator::GLRESGenerator() :
 EventRecordVisitorI("genie::GLRESGenerator")
@@ -86,25 +99,37 @@ void GLRESGenerator::ProcessEventRecord(GHepRecord * event) const
   //
 
   double mass = p4_W.M();
-  char p6frame[10], p6nu[10], p6tgt[10];
-  strcpy(p6frame, "CMS"    );
-  strcpy(p6nu,    "nu_ebar");
-  strcpy(p6tgt,   "e-"     );
-  fPythia->Pyinit(p6frame, p6nu, p6tgt, mass);
+
+  Pythia6Gate::Guard pythia6_guard;
+
+  // PYTHIA6 is initialised once, in its variable energy mode, at a nominal
+  // c.m. energy above the resonance mass: each event is then generated at its
+  // own mass by setting PARP(171) = mass / nominal energy. PYTHIA6 is only
+  // re-initialised (at a higher nominal energy) for an event above it.
+  if(mass > gPythia6GLRESEcm) {
+    gPythia6GLRESEcm = fInitEnergyScale * mass;
+    LOG("GLRES", pNOTICE)
+      << "Initialising PYTHIA6 for nu_ebar e- at a nominal c.m. energy of "
+      << gPythia6GLRESEcm << " GeV";
+    fPythia->SetMSTP(171, 1); // variable energy
+    fPythia->SetMSTP(172, 1); // an event at the requested energy
+    fPythia->SetPARP(171, 1.);
+    char p6frame[10], p6nu[10], p6tgt[10];
+    strcpy(p6frame, "CMS"    );
+    strcpy(p6nu,    "nu_ebar");
+    strcpy(p6tgt,   "e-"     );
+    fPythia->Pyinit(p6frame, p6nu, p6tgt, gPythia6GLRESEcm);
+  }
+  fPythia->SetPARP(171, mass / gPythia6GLRESEcm);
   fPythia->Pyevnt();
-  fPythia->Pylist(1);
 
   // get LUJETS record
   fPythia->GetPrimaries();
   TClonesArray * pythia_particles =
        (TClonesArray *) fPythia->ImportParticles("All");
 
-  // copy PYTHIA container to a new TClonesArray so as to transfer ownership
-  // of the container and of its elements to the calling method
   int np = pythia_particles->GetEntries();
   assert(np>0);
-  TClonesArray * particle_list = new TClonesArray("genie::GHepParticle", np);
-  particle_list->SetOwner(true);
 
   // Vector defining rotation from LAB to LAB' (z:= \vec{resonance momentum})
   TVector3 unitvq = p4_W.Vect().Unit();
@@ -112,13 +137,13 @@ void GLRESGenerator::ProcessEventRecord(GHepRecord * event) const
   // Boost velocity LAB' -> Resonance rest frame
   TVector3 beta(0,0,p4_W.P()/p4_W.Energy());
 
-  GHepParticle * p = 0;
+  TMCParticle * p = 0;
   TIter piter(pythia_particles);
-  while( (p = (GHepParticle *) piter.Next()) ) {
-     int pdgc = p->Pdg();
-     int ist  = p->Status();
+  while( (p = (TMCParticle *) piter.Next()) ) {
+     int pdgc = p->GetKF();
+     int ist  = p->GetKS();
      if(ist == 1) {
-        TLorentzVector p4o(p->Px(), p->Py(), p->Pz(), p->Energy());
+        TLorentzVector p4o(p->GetPx(), p->GetPy(), p->GetPz(), p->GetEnergy());
         p4o.Boost(beta);
         TVector3 p3 = p4o.Vect();
         p3.RotateUz(unitvq);
@@ -145,6 +170,11 @@ void GLRESGenerator::LoadConfig(void)
 {
  fPythia = TPythia6::Instance();
 
+ // nominal c.m. energy of the PYTHIA6 initialisation, relative to the
+ // resonance mass of the event triggering it
+ this->GetParamDef("PYTHIA-InitEnergyScale", fInitEnergyScale, 2.);
+ assert(fInitEnergyScale >= 1.);
+
  // sync GENIE/PYTHIA6 seed number
  RandomGen::Instance();
 }
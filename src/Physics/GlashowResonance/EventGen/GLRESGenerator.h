@@ -5,6 +5,9 @@
 
 \brief    Glashow resonance event generator
 
+          The W- resonance is decayed by PYTHIA6, initialised once in its
+          variable energy mode rather than for each event.
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -43,7 +46,8 @@ private:
 
   void LoadConfig(void);
 
-  mutable TPythia6 * fPythia;   ///< PYTHIA6 wrapper class
+  mutable TPythia6 * fPythia;          ///< PYTHIA6 wrapper class
+  double             fInitEnergyScale; ///< nominal c.m. energy of the PYTHIA6 initialisation / W mass
 };
 
 }      // genie namespace
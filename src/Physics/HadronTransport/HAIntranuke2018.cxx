@@ -48,6 +48,9 @@
 #include <cstdlib>
 #include <sstream>
 #include <exception>
+#include <map>
+#include <mutex>
+#include <vector>
 
 #include <TMath.h>
 
@@ -66,8 +69,10 @@
 #include "Physics/HadronTransport/HAIntranuke2018.h"
 #include "Physics/HadronTransport/INukeHadroData2018.h"
 #include "Physics/HadronTransport/INukeUtils2018.h"
+#include "Physics/HadronTransport/INukeNucleonCorr.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/AliasSampler.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/Spline.h"
 #include "Framework/ParticleData/PDGLibrary.h"
@@ -81,6 +86,8 @@
 //#include "Physics/HadronTransport/INukeOset.h" 
 
 using std::ostringstream;
+using std::map;
+using std::vector;
 
 using namespace genie;
 using namespace genie::utils;
@@ -88,6 +95,31 @@ using namespace genie::utils::intranuke2018;
 using namespace genie::constants;
 using namespace genie::controls;
 
+//___________________________________________________________________________
+// hA fate tables, keyed by algorithm, hadron and nucleus (pions only) and
+// shared by all threads.
+namespace {
+
+  const int    kNMaxFatesHA        = 5;    // max number of hA fates per hadron
+  const double kFateTableTolerance = 1E-3; // max fate probability difference
+
+  struct FateTableHA {
+    int                  nfates;               // number of fates
+    INukeFateHA_t        fates[kNMaxFatesHA];  // fates
+    vector<double>       weight;               // total fate fraction at each KE node
+    vector<AliasSampler> sampler;              // fate sampler at each KE node
+  };
+
+  struct FateTableMap : public map<string, FateTableHA *> {
+    ~FateTableMap() {
+      for(iterator iter = begin(); iter != end(); ++iter) delete iter->second;
+    }
+  };
+
+  FateTableMap gFateTables;
+  std::mutex   gFateTableMutex;
+}
+
 //___________________________________________________________________________
 //___________________________________________________________________________
 // Methods specific to INTRANUKE's HA-mode
@@ -237,13 +269,51 @@ INukeFateHA_t HAIntranuke2018::HadronFateHA(const GHepParticle * p) const
   LOG("HAIntranuke2018", pINFO) 
    << "Selecting hA fate for " << p->Name() << " with KE = " << ke << " MeV";
 
+  if(fUseFateTables) {
+    if(fCheckFateTables) this->CheckFateTable(pdgc, ke);
+    return this->HadronFateTable(pdgc, ke);
+  }
+
+  INukeFateHA_t fates[kNMaxFatesHA];
+  double        fracs[kNMaxFatesHA];
+  int nfates = this->HadronFateFracs(pdgc, ke, fates, fracs);
+  if(nfates == 0) return kIHAFtUndefined;
+
+  // compute total fraction (can be <1 if fates have been switched off)
+  double tf = 0;
+  for(int i = 0; i < nfates; i++) tf += fracs[i];
+
   // try to generate a hadron fate
   unsigned int iter = 0;
   while(iter++ < kRjMaxIterations) {
+    double r = tf * rnd->RndFsi().Rndm();
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+    LOG("HAIntranuke2018", pDEBUG) << "r = " << r << " (max = " << tf << ")";
+#endif
+    double cf=0; // current fraction
+    for(int i = 0; i < nfates; i++) {
+      if(r < (cf += fracs[i])) return fates[i];
+    }
 
-    // handle pions
-    //
-   if (pdgc==kPdgPiP || pdgc==kPdgPiM || pdgc==kPdgPi0) {
+    LOG("HAIntranuke2018", pWARN) 
+      << "No selection after going through all fates! " 
+      << "Total fraction = " << tf << " (r = " << r << ")";
+  }//iterations
+
+  return kIHAFtUndefined; 
+}
+//___________________________________________________________________________
+int HAIntranuke2018::HadronFateFracs(
+     int pdgc, double ke, INukeFateHA_t * fates, double * fracs) const
+{
+// Fills the hA fates available to the input hadron at the input kinetic
+// energy (MeV) and their (tweaked) fractions. Returns the number of fates.
+//
+  int n = 0;
+
+  // handle pions
+  //
+  if (pdgc==kPdgPiP || pdgc==kPdgPiM || pdgc==kPdgPi0) {
 
      double frac_cex      = fHadroData2018->FracADep(pdgc, kIHAFtCEx,     ke, nuclA);
      //     double frac_elas     = fHadroData2018->FracADep(pdgc, kIHAFtElas,    ke, nuclA);
@@ -265,37 +335,15 @@ INukeFateHA_t HAIntranuke2018::HadronFateHA(const GHepParticle * p) const
 
      double frac_rescale = 1./(frac_cex + frac_inel + frac_abs + frac_piprod);
 
-     frac_cex    *= frac_rescale;
-     frac_inel   *= frac_rescale;
-     frac_abs    *= frac_rescale;
-     frac_piprod *= frac_rescale;
-
-
-       // compute total fraction (can be <1 if fates have been switched off)
-       double tf = frac_cex      +
-	 //                   frac_elas     +
-                   frac_inel     +  
-	           frac_abs      +
-                   frac_piprod;
-
-       double r = tf * rnd->RndFsi().Rndm();
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-       LOG("HAIntranuke2018", pDEBUG) << "r = " << r << " (max = " << tf << ")";
-#endif
-       double cf=0; // current fraction
-       if(r < (cf += frac_cex     )) return kIHAFtCEx;     // cex
-       //       if(r < (cf += frac_elas    )) return kIHAFtElas;    // elas
-       if(r < (cf += frac_inel    )) return kIHAFtInelas;  // inelas
-       if(r < (cf += frac_abs     )) return kIHAFtAbs;     // abs
-       if(r < (cf += frac_piprod  )) return kIHAFtPiProd;  // pi prod
-
-       LOG("HAIntranuke2018", pWARN) 
-         << "No selection after going through all fates! " 
-                     << "Total fraction = " << tf << " (r = " << r << ")";
-    }
+     fates[n] = kIHAFtCEx;     fracs[n++] = frac_cex    * frac_rescale;  // cex
+     //     fates[n] = kIHAFtElas;    fracs[n++] = frac_elas   * frac_rescale;  // elas
+     fates[n] = kIHAFtInelas;  fracs[n++] = frac_inel   * frac_rescale;  // inelas
+     fates[n] = kIHAFtAbs;     fracs[n++] = frac_abs    * frac_rescale;  // abs
+     fates[n] = kIHAFtPiProd;  fracs[n++] = frac_piprod * frac_rescale;  // pi prod
+  }
 
-    // handle nucleons
-    else if (pdgc==kPdgProton || pdgc==kPdgNeutron) {
+  // handle nucleons
+  else if (pdgc==kPdgProton || pdgc==kPdgNeutron) {
       double frac_cex      = fHadroData2018->FracAIndep(pdgc, kIHAFtCEx,    ke);
       //double frac_elas     = fHadroData2018->FracAIndep(pdgc, kIHAFtElas,   ke);
       double frac_inel     = fHadroData2018->FracAIndep(pdgc, kIHAFtInelas, ke);
@@ -319,57 +367,170 @@ INukeFateHA_t HAIntranuke2018::HadronFateHA(const GHepParticle * p) const
 
       double frac_rescale = 1./(frac_cex + frac_inel + frac_abs + frac_pipro);
 
-      frac_cex    *= frac_rescale;
-      frac_inel   *= frac_rescale;
-      frac_abs    *= frac_rescale;
-      frac_pipro  *= frac_rescale;
-
-       // compute total fraction (can be <1 if fates have been switched off)
-       double tf = frac_cex      +
-	 //frac_elas     +
-                   frac_inel     +  
-	           frac_abs      +
-	           frac_pipro    +
-	           frac_cmp;  //suarez edit, cmp
-
-       double r = tf * rnd->RndFsi().Rndm();
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-       LOG("HAIntranuke2018", pDEBUG) << "r = " << r << " (max = " << tf << ")";
-#endif
-       double cf=0; // current fraction
-       if(r < (cf += frac_cex     )) return kIHAFtCEx;     // cex
-       //if(r < (cf += frac_elas    )) return kIHAFtElas;    // elas
-       if(r < (cf += frac_inel    )) return kIHAFtInelas;  // inelas
-       if(r < (cf += frac_abs     )) return kIHAFtAbs;     // abs
-       if(r < (cf += frac_pipro   )) return kIHAFtPiProd;  // pi prod 
-       if(r < (cf += frac_cmp     )) return kIHAFtCmp;  //suarez edit, cmp
-
-       LOG("HAIntranuke2018", pWARN) 
-         << "No selection after going through all fates! "
-                        << "Total fraction = " << tf << " (r = " << r << ")";
-    }
-    // handle kaons
-    else if (pdgc==kPdgKP || pdgc==kPdgKM) {
+      fates[n] = kIHAFtCEx;     fracs[n++] = frac_cex   * frac_rescale;  // cex
+      //fates[n] = kIHAFtElas;    fracs[n++] = frac_elas  * frac_rescale;  // elas
+      fates[n] = kIHAFtInelas;  fracs[n++] = frac_inel  * frac_rescale;  // inelas
+      fates[n] = kIHAFtAbs;     fracs[n++] = frac_abs   * frac_rescale;  // abs
+      fates[n] = kIHAFtPiProd;  fracs[n++] = frac_pipro * frac_rescale;  // pi prod
+      fates[n] = kIHAFtCmp;     fracs[n++] = frac_cmp;                   //suarez edit, cmp
+  }
+  // handle kaons
+  else if (pdgc==kPdgKP || pdgc==kPdgKM) {
        double frac_inel     = fHadroData2018->FracAIndep(pdgc, kIHAFtInelas,  ke);
        double frac_abs      = fHadroData2018->FracAIndep(pdgc, kIHAFtAbs,     ke);
 
        LOG("HAIntranuke2018", pDEBUG) 
           << "\n frac{" << INukeHadroFates::AsString(kIHAFtInelas)  << "} = " << frac_inel
 	  << "\n frac{" << INukeHadroFates::AsString(kIHAFtAbs)     << "} = " << frac_abs;
-       // compute total fraction (can be <1 if fates have been switched off)
-       double tf =  frac_inel     +  
-	 frac_abs;
-      double r = tf * rnd->RndFsi().Rndm();
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-       LOG("HAIntranuke2018", pDEBUG) << "r = " << r << " (max = " << tf << ")";
-#endif
-       double cf=0; // current fraction
-       if(r < (cf += frac_inel    )) return kIHAFtInelas;  // inelas
-       if(r < (cf += frac_abs     )) return kIHAFtAbs;     // abs
+
+       fates[n] = kIHAFtInelas;  fracs[n++] = frac_inel;  // inelas
+       fates[n] = kIHAFtAbs;     fracs[n++] = frac_abs;   // abs
+  }
+
+  return n;
+}
+//___________________________________________________________________________
+INukeFateHA_t HAIntranuke2018::HadronFateTable(int pdgc, double ke) const
+{
+// Select a hadron fate in HA mode from the alias tables built at the nodes
+// of the kinetic energy grid of INukeHadroData2018. The fate probabilities
+// are interpolated linearly between the two nodes around ke, as the fate
+// fractions are: a node is picked with its interpolation weight and a fate
+// from the alias table of that node, with a single random number.
+//
+  bool is_pion = (pdgc==kPdgPiP || pdgc==kPdgPiM || pdgc==kPdgPi0);
+  int  targA   = (is_pion) ? TMath::Min(208, nuclA) : 0;
+
+  ostringstream name;
+  name << this->Id().Key() << ";pdg:" << pdgc << ";A:" << targA;
+  string key = name.str();
+
+  const FateTableHA * table = 0;
+  {
+    std::lock_guard<std::mutex> lock(gFateTableMutex);
+    FateTableMap::const_iterator iter = gFateTables.find(key);
+    if(iter != gFateTables.end()) table = iter->second;
+  }
+
+  if(!table) {
+    LOG("HAIntranuke2018", pNOTICE) << "Building hA fate table for " << key;
+
+    int nnodes = fHadroData2018->KEGridN();
+    FateTableHA * new_table = new FateTableHA;
+    new_table->weight .resize(nnodes, 0.);
+    new_table->sampler.resize(nnodes);
+    new_table->nfates = 0;
+    for(int inode = 0; inode < nnodes; inode++) {
+      double fracs[kNMaxFatesHA];
+      new_table->nfates = this->HadronFateFracs(
+        pdgc, fHadroData2018->KEGridNode(inode), new_table->fates, fracs);
+      if(new_table->nfates == 0) break;
+      if(new_table->sampler[inode].Build(fracs, new_table->nfates)) {
+        new_table->weight[inode] = new_table->sampler[inode].Sum();
+      }
     }
-  }//iterations
 
-  return kIHAFtUndefined; 
+    std::lock_guard<std::mutex> lock(gFateTableMutex);
+    FateTableMap::iterator iter = gFateTables.find(key);
+    if(iter != gFateTables.end()) {
+      delete new_table;
+      table = iter->second;
+    } else {
+      gFateTables[key] = new_table;
+      table = new_table;
+    }
+  }
+
+  if(table->nfates == 0) return kIHAFtUndefined;
+
+  double w = 0;
+  int bin = fHadroData2018->KEBin(ke, w);
+  double wlo = (1-w) * table->weight[bin];
+  double whi =    w  * table->weight[bin+1];
+  double tf  = wlo + whi;
+  if(tf <= 0.) {
+    LOG("HAIntranuke2018", pWARN) 
+      << "No fate available for " << pdgc << " at KE = " << ke << " MeV";
+    return kIHAFtUndefined;
+  }
+
+  RandomGen * rnd = RandomGen::Instance();
+  double r = tf * rnd->RndFsi().Rndm();
+  int ifate = (r < wlo) ?
+     table->sampler[bin  ].Sample( r        / wlo) :
+     table->sampler[bin+1].Sample((r - wlo) / whi);
+
+  return table->fates[ifate];
+}
+//___________________________________________________________________________
+void HAIntranuke2018::CheckFateTable(int pdgc, double ke) const
+{
+// Debug mode: compare the fate probabilities sampled from the alias tables
+// at the input kinetic energy with the ones of the direct calculation
+//
+  INukeFateHA_t fates[kNMaxFatesHA];
+  double        fracs[kNMaxFatesHA];
+  int nfates = this->HadronFateFracs(pdgc, ke, fates, fracs);
+  if(nfates == 0) return;
+
+  bool is_pion = (pdgc==kPdgPiP || pdgc==kPdgPiM || pdgc==kPdgPi0);
+  int  targA   = (is_pion) ? TMath::Min(208, nuclA) : 0;
+
+  ostringstream name;
+  name << this->Id().Key() << ";pdg:" << pdgc << ";A:" << targA;
+
+  const FateTableHA * table = 0;
+  {
+    std::lock_guard<std::mutex> lock(gFateTableMutex);
+    FateTableMap::const_iterator iter = gFateTables.find(name.str());
+    if(iter != gFateTables.end()) table = iter->second;
+  }
+  if(!table) return; // built at the first selection
+
+  double w = 0;
+  int bin = fHadroData2018->KEBin(ke, w);
+  double wlo = (1-w) * table->weight[bin];
+  double whi =    w  * table->weight[bin+1];
+
+  double tf = 0;
+  for(int i = 0; i < nfates; i++) tf += fracs[i];
+
+  double maxdiff = 0;
+  for(int i = 0; i < nfates; i++) {
+     double p_direct = (tf > 0.) ? fracs[i] / tf : 0.;
+     double p_table  = (wlo + whi > 0.) ?
+        (wlo * table->sampler[bin  ].Probability(i) +
+         whi * table->sampler[bin+1].Probability(i)) / (wlo + whi) : 0.;
+     maxdiff = TMath::Max(maxdiff, TMath::Abs(p_direct - p_table));
+  }
+
+  if(maxdiff > kFateTableTolerance) {
+    LOG("HAIntranuke2018", pWARN) 
+      << "hA fate table for " << pdgc << " at KE = " << ke << " MeV "
+      << "differs from the direct calculation: max |dP| = " << maxdiff;
+  } else {
+    LOG("HAIntranuke2018", pINFO) 
+      << "hA fate table for " << pdgc << " at KE = " << ke << " MeV: "
+      << "max |dP| = " << maxdiff;
+  }
+}
+//___________________________________________________________________________
+void HAIntranuke2018::ClearFateTables(void) const
+{
+// Deletes the fate tables built with the previous configuration
+
+  string prefix = this->Id().Key() + ";";
+
+  std::lock_guard<std::mutex> lock(gFateTableMutex);
+  FateTableMap::iterator iter = gFateTables.begin();
+  while(iter != gFateTables.end()) {
+    if(iter->first.compare(0, prefix.size(), prefix) == 0) {
+      delete iter->second;
+      gFateTables.erase(iter++);
+    } else {
+      ++iter;
+    }
+  }
 }
 //___________________________________________________________________________
 double HAIntranuke2018::PiBounce(void) const
@@ -633,7 +794,8 @@ void HAIntranuke2018::InelasticHA(
       return;         // another extreme case, best strategy is to exit and go to next event
     }
 
-  GHepParticle t(*p);
+  utils::intranuke2018::ScratchParticle t_clone(*p);
+  GHepParticle & t = *t_clone;
   t.SetPdgCode(tcode);
 
   // set up fermi target
@@ -654,7 +816,8 @@ void HAIntranuke2018::InelasticHA(
       t.SetMomentum(0,0,0,tM);
     }
 
-  GHepParticle * cl = new GHepParticle(*p); // clone particle, to run IntBounce at proper energy
+  utils::intranuke2018::ScratchParticle cl_clone(*p); // clone particle, to run IntBounce at proper energy
+  GHepParticle * cl = cl_clone.Get();
                                             // calculate energy and momentum using invariant mass
   double pM  = p->Mass();
   double E_p = ((*p->P4() + *t.P4()).Mag2() - tM*tM - pM*pM)/(2.0*tM);
@@ -662,7 +825,6 @@ void HAIntranuke2018::InelasticHA(
   cl->SetMomentum(TLorentzVector(P_p,0,0,E_p)); 
                   // momentum doesn't have to be in right direction, only magnitude
   double C3CM = fHadroData2018->IntBounce(cl,tcode,scode,h_fate);
-  delete cl;
   if (C3CM<-1.)   // hope this doesn't occur too often - unphysical but we just pass it on
     {
       LOG("HAIntranuke2018", pWARN) << "unphysical angle chosen in InelasicHA - put particle outside nucleus";
@@ -674,8 +836,10 @@ void HAIntranuke2018::InelasticHA(
     double KE2L = t.KinE();
     LOG("HAIntranuke2018",pINFO)
       <<  "  KE1L = " << KE1L << "   " << KE1L << "  KE2L = " << KE2L; 
-  GHepParticle cl1(*p);
-  GHepParticle cl2(t);
+  utils::intranuke2018::ScratchParticle cl1_clone(*p);
+  utils::intranuke2018::ScratchParticle cl2_clone(t);
+  GHepParticle & cl1 = *cl1_clone;
+  GHepParticle & cl2 = *cl2_clone;
   bool success = utils::intranuke2018::TwoBodyCollision(ev,pcode,tcode,scode,s2code,C3CM,
 					       &cl1,&cl2,fRemnA,fRemnZ,fRemnP4,kIMdHA); 
   if(success)
@@ -775,9 +939,12 @@ void HAIntranuke2018::Inelastic(
   // only absorption/pipro fates allowed
   if (fate == kIHAFtPiProd) {
 
-      GHepParticle s1(*p);
-      GHepParticle s2(*p);
-      GHepParticle s3(*p);
+      utils::intranuke2018::ScratchParticle s1_clone(*p);
+      utils::intranuke2018::ScratchParticle s2_clone(*p);
+      utils::intranuke2018::ScratchParticle s3_clone(*p);
+      GHepParticle & s1 = *s1_clone;
+      GHepParticle & s2 = *s2_clone;
+      GHepParticle & s3 = *s3_clone;
 
       bool success = utils::intranuke2018::PionProduction(
          ev,p,&s1,&s2,&s3,fRemnA,fRemnZ,fRemnP4, fDoFermi,fFermiFac,fFermiMomentum,fNuclmodel);
@@ -980,8 +1147,10 @@ void HAIntranuke2018::Inelastic(
 
 	      // create t particles w/ appropriate momenta, code, and status
 	      // Set target's mom to be the mom of the hadron that was cloned
-	      GHepParticle* t1 = new GHepParticle(*p);
-	      GHepParticle* t2 = new GHepParticle(*p);
+	      utils::intranuke2018::ScratchParticle t1_clone(*p);
+	      utils::intranuke2018::ScratchParticle t2_clone(*p);
+	      GHepParticle* t1 = t1_clone.Get();
+	      GHepParticle* t2 = t2_clone.Get();
 	      t1->SetFirstMother(p->FirstMother());
 	      t1->SetLastMother(p->LastMother());
 	      t2->SetFirstMother(p->FirstMother());
@@ -999,8 +1168,6 @@ void HAIntranuke2018::Inelastic(
 
 	      ev->AddParticle(*t1);
 	      ev->AddParticle(*t2);
-	      delete t1;
-	      delete t2;
 
 	      return;
 	    }
@@ -1541,11 +1708,16 @@ void HAIntranuke2018::LoadConfig(void)
   GetParam( "INUKE-DoCompoundNucleus", fDoCompoundNucleus ) ;
   GetParam( "INUKE-DoFermi",           fDoFermi ) ;
   GetParam( "INUKE-XsecNNCorr",        fXsecNNCorr ) ;
+  // load the NN correction tables now rather than at the first event
+  if(fXsecNNCorr) INukeNucleonCorr::getInstance();
+  GetParamDef( "INUKE-MFPTables",      fUseMFPTables, false ) ;
   GetParamDef( "UseOset",              fUseOset, false ) ;
   GetParamDef( "AltOset",              fAltOset, false ) ;
 
   GetParam( "HAINUKE-DelRPion",    fDelRPion ) ;
   GetParam( "HAINUKE-DelRNucleon", fDelRNucleon ) ;
+  GetParamDef( "HAINUKE-FateTables",      fUseFateTables,   false ) ;
+  GetParamDef( "HAINUKE-FateTablesCheck", fCheckFateTables, false ) ;
 
   GetParamDef( "FSI-Pion-MFPScale",              fPionMFPScale,           1.0 ) ;
   GetParamDef( "FSI-Pion-FracCExScale",          fPionFracCExScale,       1.0 ) ;
@@ -1573,6 +1745,11 @@ void HAIntranuke2018::LoadConfig(void)
   LOG("HAIntranuke2018", pINFO) << "DoFermi?    = " << ((fDoFermi)?(true):(false));
   LOG("HAIntranuke2018", pINFO) << "DoCmpndNuc? = " << ((fDoCompoundNucleus)?(true):(false));
   LOG("HAIntranuke2018", pINFO) << "XsecNNCorr? = " << ((fXsecNNCorr)?(true):(false));
+  LOG("HAIntranuke2018", pINFO) << "MFPTables?  = " << ((fUseMFPTables)?(true):(false));
+  LOG("HAIntranuke2018", pINFO) << "FateTables? = " << ((fUseFateTables)?(true):(false));
+
+  // the fate tables depend on the fate fraction tweaks
+  this->ClearFateTables();
 }
 //___________________________________________________________________________
 /*
@@ -70,6 +70,10 @@ private:
   void  SimulateHadronicFinalStateKinematics (GHepRecord* ev, GHepParticle* p) const;
 
   INukeFateHA_t HadronFateHA     (const GHepParticle* p) const;
+  int           HadronFateFracs  (int pdgc, double ke, INukeFateHA_t * fates, double * fracs) const;
+  INukeFateHA_t HadronFateTable  (int pdgc, double ke) const;
+  void          CheckFateTable   (int pdgc, double ke) const;
+  void          ClearFateTables  (void) const;
   //INukeFateHA_t HadronFateOset   (void) const;
   void          Inelastic        (GHepRecord* ev, GHepParticle* p, INukeFateHA_t fate) const;
   void          ElasHA           (GHepRecord* ev, GHepParticle* p, INukeFateHA_t fate) const;
@@ -79,6 +83,8 @@ private:
   int           HandleCompoundNucleus(GHepRecord* ev, GHepParticle* p, int mom) const;           
 
   mutable int nuclA;     ///< value of A for the target nucleus in hA mode
+  bool fUseFateTables;   ///< select hA fates from per-(hadron,A) alias tables on the KE grid
+  bool fCheckFateTables; ///< compare the tabulated fate probabilities with the direct calculation
   mutable unsigned int fNumIterations;
 };
 
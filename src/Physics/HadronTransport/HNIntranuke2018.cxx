@@ -68,6 +68,7 @@
 #include "Physics/HadronTransport/INukeException.h"
 #include "Physics/HadronTransport/INukeHadroData2018.h"
 #include "Physics/HadronTransport/INukeUtils2018.h"
+#include "Physics/HadronTransport/INukeNucleonCorr.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
@@ -628,7 +629,8 @@ void HNIntranuke2018::AbsorbHN(
 
   // create t particle w/ appropriate momenta, code, and status
   // set target's mom to be the mom of the hadron that was cloned
-  GHepParticle * t = new GHepParticle(*p);
+  utils::intranuke2018::ScratchParticle t_clone(*p);
+  GHepParticle * t = t_clone.Get();
   t->SetFirstMother(p->FirstMother());
   t->SetLastMother(p->LastMother());
 
@@ -652,8 +654,6 @@ void HNIntranuke2018::AbsorbHN(
 
   ev->AddParticle(*p);
   ev->AddParticle(*t);
-
-  delete t; // delete particle clone
 }
 //___________________________________________________________________________
 void HNIntranuke2018::ElasHN(
@@ -716,7 +716,8 @@ void HNIntranuke2018::ElasHN(
     }
 
   // create scattered particle
-  GHepParticle * t = new GHepParticle(*p);
+  utils::intranuke2018::ScratchParticle t_clone(*p);
+  GHepParticle * t = t_clone.Get();
   t->SetPdgCode(tcode);
   double Mt = t->Mass();
   //t->SetMomentum(TLorentzVector(0,0,0,Mt));
@@ -754,15 +755,12 @@ void HNIntranuke2018::ElasHN(
     ev->AddParticle(*t);
   } else
   {
-    delete t; //fixes memory leak
     LOG("HNIntranuke2018", pINFO) << "Elastic in hN failed calling TwoBodyCollision";
     exceptions::INukeException exception;
     exception.SetReason("hN scattering kinematics through TwoBodyCollision failed");
     throw exception;
   }
 
-  delete t;
-
 }
 //___________________________________________________________________________
 void HNIntranuke2018::InelasticHN(GHepRecord* ev, GHepParticle* p) const
@@ -770,9 +768,12 @@ void HNIntranuke2018::InelasticHN(GHepRecord* ev, GHepParticle* p) const
   // Aaron Meyer (Jan 2010)
   // Updated version of InelasticHN 
 
-  GHepParticle s1(*p);  
-  GHepParticle s2(*p);
-  GHepParticle s3(*p);
+  utils::intranuke2018::ScratchParticle s1_clone(*p);
+  utils::intranuke2018::ScratchParticle s2_clone(*p);
+  utils::intranuke2018::ScratchParticle s3_clone(*p);
+  GHepParticle & s1 = *s1_clone;
+  GHepParticle & s2 = *s2_clone;
+  GHepParticle & s3 = *s3_clone;
   
   
   if (utils::intranuke2018::PionProduction(ev,p,&s1,&s2,&s3,fRemnA,fRemnZ,fRemnP4,fDoFermi,fFermiFac,fFermiMomentum,fNuclmodel))
@@ -856,7 +857,8 @@ void HNIntranuke2018::GammaInelasticHN(GHepRecord* ev, GHepParticle* p, INukeFat
   LOG("HNIntranuke2018", pNOTICE)
     << " scattering angle: " << C3CM;
 
-  GHepParticle * t = new GHepParticle(*p);
+  utils::intranuke2018::ScratchParticle t_clone(*p);
+  GHepParticle * t = t_clone.Get();
   t->SetPdgCode(tcode);
   double Mt = t->Mass();
 
@@ -898,8 +900,6 @@ void HNIntranuke2018::GammaInelasticHN(GHepRecord* ev, GHepParticle* p, INukeFat
     ev->AddParticle(*p);
   }
 
-  delete t;
-
 }
 //___________________________________________________________________________
 int HNIntranuke2018::HandleCompoundNucleus(GHepRecord* ev, GHepParticle* p, int mom) const
@@ -915,14 +915,14 @@ int HNIntranuke2018::HandleCompoundNucleus(GHepRecord* ev, GHepParticle* p, int
 	{
 	  if(fRemnA>4)  //this needs to be matched to what is in PreEq and Eq
             {
-              GHepParticle * sp = new GHepParticle(*p);
+              utils::intranuke2018::ScratchParticle sp_clone(*p);
+              GHepParticle * sp = sp_clone.Get();
               sp->SetFirstMother(mom);
 	      // this was PreEquilibrium - now just used for hN
 	      //same arguement lists for PreEq and Eq
 	      utils::intranuke2018::Equilibrium(ev,sp,fRemnA,fRemnZ,fRemnP4,
 					       fDoFermi,fFermiFac,fNuclmodel,fNucRmvE,kIMdHN);
 
-              delete sp;
               return 2;
             }
 	  else
@@ -930,11 +930,11 @@ int HNIntranuke2018::HandleCompoundNucleus(GHepRecord* ev, GHepParticle* p, int
               // nothing left to interact with!
               LOG("HNIntranuke2018", pNOTICE)
                 << "*** Nothing left to interact with, escaping.";
-              GHepParticle * sp = new GHepParticle(*p);
+              utils::intranuke2018::ScratchParticle sp_clone(*p);
+              GHepParticle * sp = sp_clone.Get();
               sp->SetFirstMother(mom);
               sp->SetStatus(kIStStableFinalState);
               ev->AddParticle(*sp);
-              delete sp;
               return 1;
             }
 	}
@@ -973,6 +973,9 @@ void HNIntranuke2018::LoadConfig(void)
   GetParam( "INUKE-DoCompoundNucleus", fDoCompoundNucleus ) ;
   GetParam( "INUKE-DoFermi",           fDoFermi ) ;
   GetParam( "INUKE-XsecNNCorr",        fXsecNNCorr ) ;
+  // load the NN correction tables now rather than at the first event
+  if(fXsecNNCorr) INukeNucleonCorr::getInstance();
+  GetParamDef( "INUKE-MFPTables",      fUseMFPTables, false ) ;
   GetParamDef( "AltOset",              fAltOset, false ) ;
 
   GetParam( "HNINUKE-UseOset",     fUseOset ) ;
@@ -997,6 +1000,7 @@ void HNIntranuke2018::LoadConfig(void)
   LOG("HNIntranuke2018", pWARN) << "useOset     = " << fUseOset;
   LOG("HNIntranuke2018", pWARN) << "altOset     = " << fAltOset;
   LOG("HNIntranuke2018", pWARN) << "XsecNNCorr? = " << ((fXsecNNCorr)?(true):(false));
+  LOG("HNIntranuke2018", pWARN) << "MFPTables?  = " << ((fUseMFPTables)?(true):(false));
 }
 //___________________________________________________________________________
 
@@ -0,0 +1,52 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/GHEP/GHepRecord.h"
+#include "Framework/GHEP/GHepStatus.h"
+#include "Physics/HadronTransport/INukeBatchResult.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+INukeBatchResult::INukeBatchResult()
+{
+  this->Clear();
+}
+//____________________________________________________________________________
+INukeBatchResult::~INukeBatchResult()
+{
+
+}
+//____________________________________________________________________________
+void INukeBatchResult::Clear(void)
+{
+  fOffset.assign(1, 0);
+  fFate.clear();
+  fPdg.clear();
+  fP4.clear();
+  fNFailed = 0;
+}
+//____________________________________________________________________________
+void INukeBatchResult::AddEvent(const GHepRecord & event)
+{
+  GHepParticle * probe = event.Particle(0);
+  fFate.push_back( (probe) ? probe->RescatterCode() : -1 );
+
+  int n = event.GetEntriesFast();
+  for(int i = 0; i < n; i++) {
+    GHepParticle * p = event.Particle(i);
+    if(!p || p->Status() != kIStStableFinalState) continue;
+    fPdg.push_back(p->Pdg());
+    fP4.push_back(*p->P4());
+  }
+  fOffset.push_back(fPdg.size());
+}
+//____________________________________________________________________________
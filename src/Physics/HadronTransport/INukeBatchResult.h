@@ -0,0 +1,69 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::INukeBatchResult
+
+\brief    Compact final states of a batch of hadron + nucleus events
+          transported by Intranuke2018::TransportBatch().
+
+          For each event it keeps the fate of the incident hadron and the PDG
+          code and 4-momentum of each final state particle (status
+          kIStStableFinalState), in flat arrays shared by all events, rather
+          than one full GHEP record per event.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _INUKE_BATCH_RESULT_H_
+#define _INUKE_BATCH_RESULT_H_
+
+#include <vector>
+
+#include <TLorentzVector.h>
+
+using std::vector;
+
+namespace genie {
+
+class GHepRecord;
+
+class INukeBatchResult {
+
+public:
+
+  INukeBatchResult();
+ ~INukeBatchResult();
+
+  //! Remove all events (keeping the memory for re-use)
+  void Clear    (void);
+  //! Append the fate and final state particles of the input event
+  void AddEvent (const GHepRecord & event);
+  //! Count an event whose transport failed (not stored)
+  void AddFailed(void) { fNFailed++; }
+
+  unsigned int           NEvents    (void) const { return fFate.size(); }
+  unsigned int           NFailed    (void) const { return fNFailed; }
+  int                    Fate       (unsigned int iev) const { return fFate[iev]; }
+  unsigned int           NParticles (unsigned int iev) const { return fOffset[iev+1] - fOffset[iev]; }
+  int                    Pdg        (unsigned int iev, unsigned int i) const { return fPdg[fOffset[iev]+i]; }
+  const TLorentzVector & P4         (unsigned int iev, unsigned int i) const { return fP4 [fOffset[iev]+i]; }
+
+private:
+
+  vector<unsigned int>   fOffset;   ///< first particle of each event (+ end of the last one)
+  vector<int>            fFate;     ///< fate (rescattering code) of the incident hadron, per event
+  vector<int>            fPdg;      ///< final state particle PDG codes
+  vector<TLorentzVector> fP4;       ///< final state particle 4-momenta
+  unsigned int           fNFailed;  ///< number of failed events
+};
+
+}      // genie namespace
+
+#endif // _INUKE_BATCH_RESULT_H_
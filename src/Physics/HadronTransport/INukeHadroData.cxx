@@ -42,6 +42,7 @@
 #include "Framework/GHEP/GHepParticle.h"
 #include "Physics/HadronTransport/INukeHadroData.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/StartupProfile.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/Spline.h"
 #include "Framework/ParticleData/PDGCodes.h"
@@ -184,6 +185,8 @@ void INukeHadroData::LoadCrossSections(void)
 {
 // Loads hadronic x-section data
 
+  StartupProfile::Scope phase("INukeHadroData::LoadCrossSections");
+
   //-- Get the top-level directory with input hadron cross-section data
   //   (search for $GINUKEHADRONDATA or use default location)
   string data_dir = (gSystem->Getenv("GINUKEHADRONDATA")) ?
@@ -37,6 +37,7 @@
 
 #include <cassert>
 #include <string>
+#include <mutex>
 
 #include <TSystem.h>
 #include <TNtupleD.h>
@@ -50,6 +51,7 @@
 #include "Framework/GHEP/GHepParticle.h"
 #include "Physics/HadronTransport/INukeHadroData2018.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/StartupProfile.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/Spline.h"
 #include "Framework/ParticleData/PDGCodes.h"
@@ -60,6 +62,12 @@ using std::ios;
 using namespace genie;
 using namespace genie::constants;
 
+//____________________________________________________________________________
+namespace {
+  const double kKEGridStep = 1.0; // MeV, step of the flat x-section tables
+  std::mutex   gPiATableMutex;    // guards INukeHadroData2018::fPiATable
+}
+
 //____________________________________________________________________________
 INukeHadroData2018 * INukeHadroData2018::fInstance = 0;
 //____________________________________________________________________________
@@ -187,6 +195,8 @@ void INukeHadroData2018::LoadCrossSections(void)
 {
 // Loads hadronic x-section data
 
+  StartupProfile::Scope phase("INukeHadroData2018::LoadCrossSections");
+
   //-- Get the top-level directory with input hadron cross-section data
   //   (search for $GINUKEHADRONDATA or use default location)
   string data_dir = (gSystem->Getenv("GINUKEHADRONDATA")) ?
@@ -1174,6 +1184,8 @@ void INukeHadroData2018::LoadCrossSections(void)
    TGraphs_file.Close();
 
    LOG("INukeData", pINFO)  << "Done building x-section splines...";
+
+   this->BuildFlatTables();
    
 }
 //____________________________________________________________________________
@@ -1389,11 +1401,13 @@ double INukeHadroData2018::FracADep(int hpdgc, INukeFateHA_t fate, double ke, in
   // Handle pions (currently the same cross sections are used for pi+, pi-, and pi0)
   if ( hpdgc == kPdgPiP || hpdgc == kPdgPiM || hpdgc == kPdgPi0 ) {
 
-    double frac_cex = TfracPipA_CEx->Interpolate(targA, ke);
-    //double frac_elas = TfracPipA_Elas->Interpolate(targA, ke);
-    double frac_inelas = TfracPipA_Inelas->Interpolate(targA, ke);
-    double frac_abs = TfracPipA_Abs->Interpolate(targA, ke);
-    double frac_pipro = TfracPipA_PiPro->Interpolate(targA, ke);
+    double f[kNPiAColumns];
+    this->Interpolate(this->PiAFracTable(targA), kNPiAColumns, ke, f);
+
+    double frac_cex    = f[kPiACEx];
+    double frac_inelas = f[kPiAInel];
+    double frac_abs    = f[kPiAAbs];
+    double frac_pipro  = f[kPiAPiPro];
 
     // Protect against unitarity violation due to interpolation problems
     // by renormalizing all available fate fractions to unity.
@@ -1426,75 +1440,53 @@ double INukeHadroData2018::FracAIndep(int hpdgc, INukeFateHA_t fate, double ke)
 
   LOG("INukeData", pDEBUG)  << "Querying hA cross section at ke = " << ke;
 
-  // TODO: reduce code duplication here
-  if (hpdgc == kPdgProton) {
-    // handle protons
-    double frac_cex = fFracPA_CEx->Evaluate(ke);
-    double frac_inelas = fFracPA_Inel->Evaluate(ke);
-    double frac_abs = fFracPA_Abs->Evaluate(ke);
-    double frac_pipro = fFracPA_PiPro->Evaluate(ke);
-    double frac_comp = fFracPA_Cmp->Evaluate(ke);
+  int probe = -1;
+  if      (hpdgc == kPdgProton ) probe = kHAProton;
+  else if (hpdgc == kPdgNeutron) probe = kHANeutron;
+  else if (hpdgc == kPdgKP     ) probe = kHAKP;
+  else {
+    LOG("INukeData", pWARN) << "Can't handle particles with pdg code = " << hpdgc;
+    return 0.;
+  }
 
-    // Protect against unitarity violation due to interpolation problems
-    // by renormalizing all available fate fractions to unity.
-    double total = frac_cex + frac_inelas + frac_abs + frac_pipro + frac_comp; // + frac_elas
+  // all fate fractions of the probe from a single bin look-up
+  double f[kNHAColumns];
+  this->Interpolate(&fHATable[probe * fKEGridN * kNHAColumns], kNHAColumns, ke, f);
 
-    if ( fate == kIHAFtCEx ) return frac_cex / total;
-  //else if ( fate == kIHAFtElas   ) return frac_elas / total;
-    else if ( fate == kIHAFtInelas ) return frac_inelas / total;
-    else if ( fate == kIHAFtAbs    ) return frac_abs / total;
-    else if ( fate == kIHAFtPiProd ) return frac_pipro / total;
-    else if ( fate == kIHAFtCmp    ) return frac_comp / total; // cmp - add support for this later
-    else {
-      LOG("INukeData", pWARN)
-        << "Protons don't have this fate: " << INukeHadroFates::AsString(fate);
-      return 0;
-    }
-  }
-  else if (hpdgc == kPdgNeutron) {
-    // handle neutrons
-    double frac_cex = fFracNA_CEx->Evaluate(ke);
-    double frac_inelas = fFracNA_Inel->Evaluate(ke);
-    double frac_abs = fFracNA_Abs->Evaluate(ke);
-    double frac_pipro = fFracNA_PiPro->Evaluate(ke);
-    double frac_comp = fFracNA_Cmp->Evaluate(ke);
+  if (probe == kHAProton || probe == kHANeutron) {
+    // handle nucleons
 
     // Protect against unitarity violation due to interpolation problems
     // by renormalizing all available fate fractions to unity.
-    double total = frac_cex + frac_inelas + frac_abs + frac_pipro + frac_comp; // + frac_elas
+    double total = f[kHACEx] + f[kHAInel] + f[kHAAbs] + f[kHAPiPro] + f[kHACmp]; // + frac_elas
 
-    if ( fate == kIHAFtCEx ) return frac_cex / total;
+    if ( fate == kIHAFtCEx ) return f[kHACEx] / total;
   //else if ( fate == kIHAFtElas   ) return frac_elas / total;
-    else if ( fate == kIHAFtInelas ) return frac_inelas / total;
-    else if ( fate == kIHAFtAbs    ) return frac_abs / total;
-    else if ( fate == kIHAFtPiProd ) return frac_pipro / total;
-    else if ( fate == kIHAFtCmp    ) return frac_comp / total; // cmp - add support for this later
+    else if ( fate == kIHAFtInelas ) return f[kHAInel] / total;
+    else if ( fate == kIHAFtAbs    ) return f[kHAAbs] / total;
+    else if ( fate == kIHAFtPiProd ) return f[kHAPiPro] / total;
+    else if ( fate == kIHAFtCmp    ) return f[kHACmp] / total; // cmp - add support for this later
     else {
       LOG("INukeData", pWARN)
-        << "Neutrons don't have this fate: " << INukeHadroFates::AsString(fate);
+        << (probe == kHAProton ? "Protons" : "Neutrons")
+        << " don't have this fate: " << INukeHadroFates::AsString(fate);
       return 0;
     }
   }
-  else if (hpdgc == kPdgKP) {
-    // handle K+
-    double frac_inelas = fFracKA_Inel->Evaluate(ke);
-  //double frac_elas = fFracKA_Elas->Evaluate(ke);
-    double frac_abs = fFracKA_Abs->Evaluate(ke);
 
-    // Protect against unitarity violation due to interpolation problems
-    // by renormalizing all available fate fractions to unity.
-    double total = frac_inelas + frac_abs; // + frac_elas
+  // handle K+
 
-    if ( fate == kIHAFtInelas ) return frac_inelas / total;
-    else if ( fate == kIHAFtAbs ) return frac_abs / total;
-    else {
-      LOG("INukeData", pWARN)
-        << "K+'s don't have this fate: " << INukeHadroFates::AsString(fate);
-      return 0.;
-    }
+  // Protect against unitarity violation due to interpolation problems
+  // by renormalizing all available fate fractions to unity.
+  double total = f[kHAInel] + f[kHAAbs]; // + frac_elas
+
+  if ( fate == kIHAFtInelas ) return f[kHAInel] / total;
+  else if ( fate == kIHAFtAbs ) return f[kHAAbs] / total;
+  else {
+    LOG("INukeData", pWARN)
+      << "K+'s don't have this fate: " << INukeHadroFates::AsString(fate);
+    return 0.;
   }
-  LOG("INukeData", pWARN) << "Can't handle particles with pdg code = " << hpdgc;
-  return 0.;
 }
 //____________________________________________________________________________
 double INukeHadroData2018::XSec(int hpdgc, INukeFateHN_t fate, double ke, int targA, int targZ) const
@@ -1507,132 +1499,60 @@ double INukeHadroData2018::XSec(int hpdgc, INukeFateHN_t fate, double ke, int ta
 
   LOG("INukeData", pDEBUG)  << "Querying hN cross section at ke = " << ke;
 
-  double xsec=0;
-
-    if (hpdgc == kPdgPiP) {
-    /* handle pi+ */
-         if (fate == kIHNFtCEx   ) {xsec = TMath::Max(0., fXSecPipp_CEx  -> Evaluate(ke)) *  targZ;
-	                            xsec+= TMath::Max(0., fXSecPipn_CEx  -> Evaluate(ke)) * (targA-targZ);
-				    return xsec;}
-    else if (fate == kIHNFtElas  ) {xsec = TMath::Max(0., fXSecPipp_Elas -> Evaluate(ke)) *  targZ;
-	                            xsec+= TMath::Max(0., fXSecPipn_Elas -> Evaluate(ke)) * (targA-targZ);
-				    return xsec;}
-    else if (fate == kIHNFtInelas) {xsec = TMath::Max(0., fXSecPipp_Reac -> Evaluate(ke)) *  targZ;
-				    xsec+= TMath::Max(0., fXSecPipn_Reac -> Evaluate(ke)) * (targA-targZ);
- 				    return xsec;}
-    else if (fate == kIHNFtAbs   ) {xsec = TMath::Max(0., fXSecPipd_Abs  -> Evaluate(ke)) *  targA;
-				    return xsec;}
-    else {
-     LOG("INukeData", pWARN)
-        << "Pi+'s don't have this fate: " << INukeHadroFates::AsString(fate);
-     return 0;
-    }
-
-  } else if (hpdgc == kPdgPiM) {
-    /* handle pi- */
-         if (fate == kIHNFtCEx   ) {xsec = TMath::Max(0., fXSecPipn_CEx  -> Evaluate(ke)) *  targZ;
-	                            xsec+= TMath::Max(0., fXSecPipp_CEx  -> Evaluate(ke)) * (targA-targZ);
-				    return xsec;}
-    else if (fate == kIHNFtElas  ) {xsec = TMath::Max(0., fXSecPipn_Elas -> Evaluate(ke)) *  targZ;
-	                            xsec+= TMath::Max(0., fXSecPipp_Elas -> Evaluate(ke)) * (targA-targZ);
-				    return xsec;}
-    else if (fate == kIHNFtInelas) {xsec = TMath::Max(0., fXSecPipn_Reac -> Evaluate(ke)) *  targZ;
-	                            xsec+= TMath::Max(0., fXSecPipp_Reac -> Evaluate(ke)) * (targA-targZ);
-				    return xsec;}
-    else if (fate == kIHNFtAbs   ) {xsec = TMath::Max(0., fXSecPipd_Abs  -> Evaluate(ke)) *  targA;
-				    return xsec;}
-    else {
-     LOG("INukeData", pWARN)
-        << "Pi-'s don't have this fate: " << INukeHadroFates::AsString(fate);
-     return 0;
-    }
+  int probe = this->HNProbe(hpdgc);
+  if (probe < 0) {
+    LOG("INukeData", pWARN)
+      << "Can't handle particles with pdg code = " << hpdgc;
+    return 0;
+  }
 
-  } else if (hpdgc == kPdgPi0) {
-    /* handle pi0 */
-         if (fate == kIHNFtCEx   ) {xsec = TMath::Max(0., fXSecPi0p_CEx  -> Evaluate(ke)) *  targZ;
-	                            xsec+= TMath::Max(0., fXSecPi0n_CEx  -> Evaluate(ke)) * (targA-targZ);
-				    return xsec;}
-    else if (fate == kIHNFtElas  ) {xsec = TMath::Max(0., fXSecPi0p_Elas -> Evaluate(ke)) *  targZ;
-	                            xsec+= TMath::Max(0., fXSecPi0n_Elas -> Evaluate(ke)) * (targA-targZ);
-				    return xsec;}
-    else if (fate == kIHNFtInelas) {xsec = TMath::Max(0., fXSecPi0p_Reac -> Evaluate(ke)) *  targZ;
-	                            xsec+= TMath::Max(0., fXSecPi0n_Reac -> Evaluate(ke)) * (targA-targZ);
-				    return xsec;}
-    else if (fate == kIHNFtAbs   ) {xsec = TMath::Max(0., fXSecPi0d_Abs  -> Evaluate(ke)) *  targA;
-				    return xsec;}
-    else {
-     LOG("INukeData", pWARN)
-        << "Pi0's don't have this fate: " << INukeHadroFates::AsString(fate);
-     return 0;
-    }
+  double v[kNHNColumns];
+  this->Interpolate(&fHNTable[probe * fKEGridN * kNHNColumns], kNHNColumns, ke, v);
 
-  } else if (hpdgc == kPdgProton) {
-    /* handle protons */
-      if (fate == kIHNFtElas  ) {xsec = TMath::Max(0., fXSecPp_Elas -> Evaluate(ke)) *  targZ;
-	                            xsec+= TMath::Max(0., fXSecPn_Elas -> Evaluate(ke)) * (targA-targZ);
-				    return xsec;}
-    else if (fate == kIHNFtInelas) {xsec = TMath::Max(0., fXSecPp_Reac -> Evaluate(ke)) *  targZ;
-	                            xsec+= TMath::Max(0., fXSecPn_Reac -> Evaluate(ke)) * (targA-targZ);
-				    return xsec;}
-    else if (fate == kIHNFtCmp) {xsec = TMath::Max(0., fXSecPp_Cmp -> Evaluate(ke)) *  targZ;
-                                    xsec+= TMath::Max(0., fXSecPn_Cmp -> Evaluate(ke)) * (targA-targZ);
-				    return xsec;}
-    else {
-     LOG("INukeData", pWARN)
-        << "Protons don't have this fate: " << INukeHadroFates::AsString(fate);
-     return 0;
-    }
+  return this->HNXSec(probe, fate, v, targA, targZ);
+}
+//____________________________________________________________________________
+double INukeHadroData2018::HNXSec(
+    int probe, INukeFateHN_t fate, const double * v, int targA, int targZ) const
+{
+// x-section for the input fate on a target with the input A, Z computed from
+// the interpolated table row v of the input probe
+
+  bool is_pion    = (probe == kHNPiP || probe == kHNPiM || probe == kHNPi0);
+  bool is_nucleon = (probe == kHNProton || probe == kHNNeutron);
+  bool is_kaon    = (probe == kHNKP);
+
+  int nZ = targZ;
+  int nN = targA - targZ;
+
+  int col = -1;
+  if      (fate == kIHNFtCEx    && (is_pion || is_kaon)   ) col = kHNCExP;
+  else if (fate == kIHNFtElas   && (is_pion || is_nucleon || is_kaon)) col = kHNElasP;
+  else if (fate == kIHNFtInelas && (is_pion || is_nucleon)) col = kHNReacP;
+  else if (fate == kIHNFtCmp    && is_nucleon             ) col = kHNCmpP;
+  else if (fate == kIHNFtAbs    && is_pion                ) {
+    return TMath::Max(0., v[kHNAbs]) * targA;
+  }
 
-  } else if (hpdgc == kPdgNeutron) {
-    /* handle protons */
-         if (fate == kIHNFtElas  ) {xsec = TMath::Max(0., fXSecPn_Elas -> Evaluate(ke)) *  targZ;
-	                            xsec+= TMath::Max(0., fXSecNn_Elas -> Evaluate(ke)) * (targA-targZ);
-				    return xsec;}
-    else if (fate == kIHNFtInelas) {xsec = TMath::Max(0., fXSecPn_Reac -> Evaluate(ke)) *  targZ;
-	                            xsec+= TMath::Max(0., fXSecNn_Reac -> Evaluate(ke)) * (targA-targZ);
-				    return xsec;}
-    else if (fate == kIHNFtCmp) {xsec = TMath::Max(0., fXSecPp_Cmp -> Evaluate(ke)) *  targZ;
-                                    xsec+= TMath::Max(0., fXSecPn_Cmp -> Evaluate(ke)) * (targA-targZ);
-                                    return xsec;}
-    else {
-     LOG("INukeData", pWARN)
-        << "Neutrons don't have this fate: " << INukeHadroFates::AsString(fate);
-     return 0;
-    }
-    //Adding here kaons, why elastic only on protons? hA or hN? No _Reac for kaons...
-    } else if (hpdgc == kPdgKP) {
-    /* handle K+ */
-    	if (fate == kIHNFtCEx   ) {xsec = TMath::Max(0., fXSecKpn_CEx  -> Evaluate(ke)) *  targZ;
-	                            xsec+= TMath::Max(0., fXSecKpn_CEx  -> Evaluate(ke)) * (targA-targZ);
-				    return xsec;}
-    	else if (fate == kIHNFtElas  ) {xsec = TMath::Max(0., fXSecKpn_Elas -> Evaluate(ke)) *  targZ;
-	                            xsec+= TMath::Max(0., fXSecKpn_Elas -> Evaluate(ke)) * (targA-targZ);
-				    return xsec;}
-    	/*else if (fate == kIHNFtAbs   ) {xsec = TMath::Max(0., fXSecKpd_Abs  -> Evaluate(ke)) *  targA;
-				    return xsec;}*/
-    	else {
-    		LOG("INukeData", pWARN)
-        	<< "K+'s don't have this fate: " << INukeHadroFates::AsString(fate);
-     	return 0;
+  if (col < 0) {
+    if (probe == kHNGamma) {
+      LOG("INukeData", pWARN)
+        << "Can't handle particles with pdg code = " << kPdgGamma;
+      return 0;
     }
-    //------------------------------------------------
-	 /*   }  else if (hpdgc == kPdgGamma) {
-    / * handle gamma * /
-         if (fate == kIHNFtInelas) {xsec = TMath::Max(0., fXSecGamp_fs   -> Evaluate(ke)) *  targZ;
-	                            xsec+= TMath::Max(0., fXSecGamn_fs   -> Evaluate(ke)) * (targA-targZ);
-				    return xsec;}
-    else {
-     LOG("INukeData", pWARN)
-        << "Gamma's don't have this fate: " << INukeHadroFates::AsString(fate);
-     return 0;
-     }*/
-   }
-  LOG("INukeData", pWARN)
-      << "Can't handle particles with pdg code = " << hpdgc;
+    const char * name[kNHNProbes] =
+      { "Pi+'s", "Pi-'s", "Pi0's", "Protons", "Neutrons", "K+'s", "Gammas" };
+    LOG("INukeData", pWARN)
+      << name[probe] << " don't have this fate: " << INukeHadroFates::AsString(fate);
+    return 0;
+  }
 
-  return 0;
+  // the h+n column follows the h+p column of each channel
+  double xsec = TMath::Max(0., v[col  ]) * nZ;
+  xsec       += TMath::Max(0., v[col+1]) * nN;
+  return xsec;
 }
-
+//____________________________________________________________________________
 double INukeHadroData2018::Frac(int hpdgc, INukeFateHN_t fate, double ke, int targA, int targZ) const
 {
 // return the x-section fraction for the input fate for the particle with the
@@ -1641,29 +1561,188 @@ double INukeHadroData2018::Frac(int hpdgc, INukeFateHN_t fate, double ke, int ta
   ke = TMath::Max(fMinKinEnergy,   ke);
   ke = TMath::Min(fMaxKinEnergyHN, ke);
 
+  int probe = this->HNProbe(hpdgc);
+  if (probe < 0) {
+    LOG("INukeData", pWARN)
+      << "Can't handle particles with pdg code = " << hpdgc;
+    return 0;
+  }
+
+  // the x-section and the total x-section from a single bin look-up
+  double v[kNHNColumns];
+  this->Interpolate(&fHNTable[probe * fKEGridN * kNHNColumns], kNHNColumns, ke, v);
+
   // get x-section
-  double xsec = this->XSec(hpdgc,fate,ke,targA,targZ);
+  double xsec = this->HNXSec(probe, fate, v, targA, targZ);
 
   // get max x-section
   double xsec_tot = 0;
-       if (hpdgc == kPdgPiP    ){xsec_tot = TMath::Max(0., fXSecPipp_Tot  -> Evaluate(ke)) *  targZ;
-				 xsec_tot+= TMath::Max(0., fXSecPipn_Tot  -> Evaluate(ke)) * (targA-targZ);}
-  else if (hpdgc == kPdgPiM    ){xsec_tot = TMath::Max(0., fXSecPipn_Tot  -> Evaluate(ke)) *  targZ;
-                        	 xsec_tot+= TMath::Max(0., fXSecPipp_Tot  -> Evaluate(ke)) * (targA-targZ);}
-  else if (hpdgc == kPdgPi0    ){xsec_tot = TMath::Max(0., fXSecPi0p_Tot  -> Evaluate(ke)) *  targZ;
-                        	 xsec_tot+= TMath::Max(0., fXSecPi0n_Tot  -> Evaluate(ke)) * (targA-targZ);}
-  else if (hpdgc == kPdgProton ){xsec_tot = TMath::Max(0., fXSecPp_Tot    -> Evaluate(ke)) *  targZ;
-                        	 xsec_tot+= TMath::Max(0., fXSecPn_Tot    -> Evaluate(ke)) * (targA-targZ);}
-  else if (hpdgc == kPdgNeutron){xsec_tot = TMath::Max(0., fXSecPn_Tot    -> Evaluate(ke)) *  targZ;
-                        	 xsec_tot+= TMath::Max(0., fXSecNn_Tot    -> Evaluate(ke)) * (targA-targZ);}
-  else if (hpdgc == kPdgGamma  ) xsec_tot = TMath::Max(0., fXSecGamN_Tot  -> Evaluate(ke));
-  else if (hpdgc == kPdgKP     ) xsec_tot = TMath::Max(0., fXSecKpN_Tot   -> Evaluate(ke));
+  if (probe == kHNKP || probe == kHNGamma) {
+    xsec_tot = TMath::Max(0., v[kHNTot]);
+  } else {
+    xsec_tot = TMath::Max(0., v[kHNTotP]) *  targZ;
+    xsec_tot+= TMath::Max(0., v[kHNTotN]) * (targA-targZ);
+  }
 
   // compute fraction
   double frac = (xsec_tot>0) ? xsec/xsec_tot : 0.;
   return frac;
 }
 //____________________________________________________________________________
+void INukeHadroData2018::XSecTot(
+             int hpdgc, double ke, double & xsec_p, double & xsec_n) const
+{
+// return the total hadron+proton and hadron+neutron x-sections for the
+// particle with the input pdg code at the input kinetic energy
+
+  xsec_p = 0.;
+  xsec_n = 0.;
+
+  int probe = this->HNProbe(hpdgc);
+  if (probe < 0) return;
+
+  ke = TMath::Max(fMinKinEnergy,   ke);
+  ke = TMath::Min(fMaxKinEnergyHN, ke);
+
+  double v[kNHNColumns];
+  this->Interpolate(&fHNTable[probe * fKEGridN * kNHNColumns], kNHNColumns, ke, v);
+
+  xsec_p = v[kHNTotP];
+  xsec_n = v[kHNTotN];
+}
+//____________________________________________________________________________
+int INukeHadroData2018::HNProbe(int hpdgc) const
+{
+  if      (hpdgc == kPdgPiP    ) return kHNPiP;
+  else if (hpdgc == kPdgPiM    ) return kHNPiM;
+  else if (hpdgc == kPdgPi0    ) return kHNPi0;
+  else if (hpdgc == kPdgProton ) return kHNProton;
+  else if (hpdgc == kPdgNeutron) return kHNNeutron;
+  else if (hpdgc == kPdgKP     ) return kHNKP;
+  else if (hpdgc == kPdgGamma  ) return kHNGamma;
+  return -1;
+}
+//____________________________________________________________________________
+int INukeHadroData2018::KEBin(double ke, double & w) const
+{
+// grid bin containing ke and the linear interpolation weight of its upper node
+
+  double x = (ke - fKEGridMin) / fKEGridStep;
+  int bin = TMath::Max(0, TMath::Min(fKEGridN-2, (int) x));
+  w = TMath::Max(0., TMath::Min(1., x - bin));
+  return bin;
+}
+//____________________________________________________________________________
+void INukeHadroData2018::Interpolate(
+        const double * table, int ncol, double ke, double * values) const
+{
+// interpolate all ncol columns of a probe table at ke
+
+  double w = 0;
+  int bin = this->KEBin(ke, w);
+
+  const double * lo = table + bin * ncol;
+  const double * hi = lo + ncol;
+  for (int i = 0; i < ncol; i++) {
+    values[i] = lo[i] + w * (hi[i] - lo[i]);
+  }
+}
+//____________________________________________________________________________
+void INukeHadroData2018::FillColumn(
+   vector<double> & table, int ncol, int probe, int col, const Spline * spl)
+{
+  if (!spl) return;
+
+  vector<double> ke(fKEGridN), xsec(fKEGridN);
+  for (int i = 0; i < fKEGridN; i++) ke[i] = fKEGridMin + i * fKEGridStep;
+  spl->Evaluate(&ke[0], &xsec[0], fKEGridN);
+
+  double * row = &table[probe * fKEGridN * ncol];
+  for (int i = 0; i < fKEGridN; i++) row[i*ncol + col] = xsec[i];
+}
+//____________________________________________________________________________
+void INukeHadroData2018::BuildFlatTables(void)
+{
+// Resample the 1-D hN x-section and hA fate fraction splines on the shared
+// kinetic energy grid
+
+  fKEGridMin  = fMinKinEnergy;
+  fKEGridStep = kKEGridStep;
+  fKEGridN    = TMath::Max(2,
+     1 + TMath::CeilNint((fMaxKinEnergyHN - fMinKinEnergy) / fKEGridStep));
+
+  fHNTable.assign(kNHNProbes * fKEGridN * kNHNColumns, 0.);
+
+  const Spline * hn[kNHNProbes][kNHNColumns] = {
+    // TotP           TotN           Tot           CExP           CExN
+    // ElasP          ElasN          ReacP         ReacN          CmpP        CmpN        Abs
+    { fXSecPipp_Tot,  fXSecPipn_Tot, 0,            fXSecPipp_CEx, fXSecPipn_CEx,
+      fXSecPipp_Elas, fXSecPipn_Elas, fXSecPipp_Reac, fXSecPipn_Reac, 0,        0,          fXSecPipd_Abs },
+    { fXSecPipn_Tot,  fXSecPipp_Tot, 0,            fXSecPipn_CEx, fXSecPipp_CEx,
+      fXSecPipn_Elas, fXSecPipp_Elas, fXSecPipn_Reac, fXSecPipp_Reac, 0,        0,          fXSecPipd_Abs },
+    { fXSecPi0p_Tot,  fXSecPi0n_Tot, 0,            fXSecPi0p_CEx, fXSecPi0n_CEx,
+      fXSecPi0p_Elas, fXSecPi0n_Elas, fXSecPi0p_Reac, fXSecPi0n_Reac, 0,        0,          fXSecPi0d_Abs },
+    { fXSecPp_Tot,    fXSecPn_Tot,   0,            0,             0,
+      fXSecPp_Elas,   fXSecPn_Elas,  fXSecPp_Reac, fXSecPn_Reac,  fXSecPp_Cmp, fXSecPn_Cmp, 0 },
+    { fXSecPn_Tot,    fXSecNn_Tot,   0,            0,             0,
+      fXSecPn_Elas,   fXSecNn_Elas,  fXSecPn_Reac, fXSecNn_Reac,  fXSecPp_Cmp, fXSecPn_Cmp, 0 },
+    { fXSecKpN_Tot,   fXSecKpN_Tot,  fXSecKpN_Tot, fXSecKpn_CEx,  fXSecKpn_CEx,
+      fXSecKpn_Elas,  fXSecKpn_Elas, 0,            0,             0,          0,          0 },
+    { fXSecGamp_fs,   fXSecGamn_fs,  fXSecGamN_Tot, 0,            0,
+      0,              0,             0,            0,             0,          0,          0 }
+  };
+  for (int probe = 0; probe < kNHNProbes; probe++) {
+    for (int col = 0; col < kNHNColumns; col++) {
+      this->FillColumn(fHNTable, kNHNColumns, probe, col, hn[probe][col]);
+    }
+  }
+
+  fHATable.assign(kNHAProbes * fKEGridN * kNHAColumns, 0.);
+
+  const Spline * ha[kNHAProbes][kNHAColumns] = {
+    // CEx         Inel          Abs          PiPro          Cmp
+    { fFracPA_CEx, fFracPA_Inel, fFracPA_Abs, fFracPA_PiPro, fFracPA_Cmp },
+    { fFracNA_CEx, fFracNA_Inel, fFracNA_Abs, fFracNA_PiPro, fFracNA_Cmp },
+    { fFracKA_CEx, fFracKA_Inel, fFracKA_Abs, 0,             0           }
+  };
+  for (int probe = 0; probe < kNHAProbes; probe++) {
+    for (int col = 0; col < kNHAColumns; col++) {
+      this->FillColumn(fHATable, kNHAColumns, probe, col, ha[probe][col]);
+    }
+  }
+
+  // the pi+A tables are filled for each A on first use
+  fPiATable.assign(209, vector<double>());
+
+  LOG("INukeData", pINFO)
+    << "Resampled hadron x-sections on " << fKEGridN << " kinetic energies in ["
+    << fKEGridMin << ", " << fKEGridMin + (fKEGridN-1) * fKEGridStep << "] MeV";
+}
+//____________________________________________________________________________
+const double * INukeHadroData2018::PiAFracTable(int targA) const
+{
+// pi+A fate fractions on the kinetic energy grid for the input mass number,
+// interpolated from the (A, ke) TGraph2D's the first time they are needed
+
+  targA = TMath::Max(1, TMath::Min(208, targA));
+
+  std::lock_guard<std::mutex> lock(gPiATableMutex);
+
+  vector<double> & table = fPiATable[targA];
+  if (table.empty()) {
+    TGraph2D * graph[kNPiAColumns] =
+      { TfracPipA_CEx, TfracPipA_Inelas, TfracPipA_Abs, TfracPipA_PiPro };
+    table.assign(fKEGridN * kNPiAColumns, 0.);
+    for (int i = 0; i < fKEGridN; i++) {
+      double ke = TMath::Min(fMaxKinEnergyHA, fKEGridMin + i * fKEGridStep);
+      for (int col = 0; col < kNPiAColumns; col++) {
+        table[i*kNPiAColumns + col] = graph[col]->Interpolate(targA, ke);
+      }
+    }
+  }
+  return &table[0];
+}
+//____________________________________________________________________________
 double INukeHadroData2018::IntBounce(const GHepParticle* p, int target, int scode, INukeFateHN_t fate)
 {
   // This method returns a random cos(ang) according to a distribution
@@ -21,6 +21,13 @@
           data and extrapolations, and INC model results from Mashnik et al.
           for h+Fe56.
 
+          For the cascade stepping, all 1-D hadron+nucleon x-sections and
+          hadron+nucleus fate fractions are also resampled on one shared,
+          uniform kinetic energy grid and stored contiguously per probe
+          (one row of channels per grid node), so that a single bin look-up
+          gives every channel of a probe at once. XSec(), Frac(), XSecTot(),
+          FracAIndep() and FracADep() interpolate linearly in these tables.
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>, Rutherford Lab.
           Steve Dytman <dytman+@pitt.edu>, Pittsburgh Univ.
 	  Aaron Meyer <asm58@pitt.edu>, Pittsburgh Univ.
@@ -38,12 +45,16 @@
 #ifndef _INTRANUKE_HADRON_CROSS_SECTIONS_2018_H_
 #define _INTRANUKE_HADRON_CROSS_SECTIONS_2018_H_
 
+#include <vector>
+
 #include "Physics/HadronTransport/INukeHadroFates2018.h"
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/Numerical/BLI2D.h"
 
 class TGraph2D;
 
+using std::vector;
+
 namespace genie {
 
 class Spline;
@@ -64,6 +75,15 @@ public:
   double Frac (int hpdgc, INukeFateHN_t fate, double ke, int targA=0, int targZ=0) const;
   double IntBounce       (const GHepParticle* p, int target, int s1, INukeFateHN_t fate);
 
+  //! Total hadron+proton and hadron+neutron x-sections (mb) at ke (MeV)
+  void   XSecTot (int hpdgc, double ke, double & xsec_p, double & xsec_n) const;
+
+  //! Shared kinetic energy grid (MeV) of the flat tables: number of nodes,
+  //! node energies and grid bin containing ke (w: weight of its upper node)
+  int    KEGridN    (void)  const { return fKEGridN; }
+  double KEGridNode (int i) const { return fKEGridMin + i * fKEGridStep; }
+  int    KEBin      (double ke, double & w) const;
+
 
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   // hN mode hadron x-section splines
@@ -157,6 +177,22 @@ private:
          string filename, double ke, int npoints, int & curr_point,
          /*double * ke_array,*/ double * costh_array, double * xsec_array, int cols);
 
+  // Flat x-section / fate fraction tables on the shared kinetic energy grid.
+  // Each table holds, for each probe, one row of columns per grid node.
+  enum EHNProbe  { kHNPiP = 0, kHNPiM, kHNPi0, kHNProton, kHNNeutron, kHNKP, kHNGamma, kNHNProbes };
+  enum EHNColumn { kHNTotP = 0, kHNTotN, kHNTot, kHNCExP, kHNCExN, kHNElasP, kHNElasN,
+                   kHNReacP, kHNReacN, kHNCmpP, kHNCmpN, kHNAbs, kNHNColumns };
+  enum EHAProbe  { kHAProton = 0, kHANeutron, kHAKP, kNHAProbes };
+  enum EHAColumn { kHACEx = 0, kHAInel, kHAAbs, kHAPiPro, kHACmp, kNHAColumns };
+  enum EPiAColumn{ kPiACEx = 0, kPiAInel, kPiAAbs, kPiAPiPro, kNPiAColumns };
+
+  void   BuildFlatTables (void);
+  void   FillColumn      (vector<double> & table, int ncol, int probe, int col, const Spline * spl);
+  int    HNProbe         (int hpdgc) const;
+  void   Interpolate     (const double * table, int ncol, double ke, double * values) const;
+  double HNXSec          (int probe, INukeFateHN_t fate, const double * v, int targA, int targZ) const;
+  const double * PiAFracTable (int targA) const;
+
   static INukeHadroData2018 * fInstance;
 
   Spline * fXSecPipn_Tot;      ///< pi+n hN x-section splines
@@ -240,6 +276,13 @@ private:
   BLI2DNonUnifGrid * fhN2dXSecGamPipN_Inelas;
   BLI2DNonUnifGrid * fhN2dXSecGamPimP_Inelas;
 
+  double         fKEGridMin;   ///< first node of the shared kinetic energy grid (MeV)
+  double         fKEGridStep;  ///< kinetic energy grid step (MeV)
+  int            fKEGridN;     ///< number of kinetic energy grid nodes
+  vector<double> fHNTable;     ///< hN x-sections, [EHNProbe][node][EHNColumn]
+  vector<double> fHATable;     ///< hA fate fractions, [EHAProbe][node][EHAColumn]
+  mutable vector< vector<double> > fPiATable; ///< pi+A fate fractions per A, [node][EPiAColumn], filled on demand
+
   //-- Sinleton cleaner
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
@@ -0,0 +1,96 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <TMath.h>
+#include <TLorentzVector.h>
+
+#include "Framework/Conventions/Units.h"
+#include "Framework/ParticleData/PDGLibrary.h"
+#include "Physics/HadronTransport/INukeHadroData2018.h"
+#include "Physics/HadronTransport/INukeMFPTable2018.h"
+#include "Physics/HadronTransport/INukeUtils2018.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+namespace {
+  const int    kMFPNRNodes        = 61;     // radial nodes in [0,rmax]
+  const double kMFPKEMax          = 1.e4;   // MeV
+  const int    kMFPKENodesPerDec  = 40;     // kinetic energy nodes per decade
+}
+//____________________________________________________________________________
+INukeMFPTable2018::INukeMFPTable2018() :
+fNR(0),
+fNKE(0),
+fRMax(0.),
+fLogKEMin(0.),
+fDLogKE(1.)
+{
+
+}
+//____________________________________________________________________________
+INukeMFPTable2018::~INukeMFPTable2018()
+{
+
+}
+//____________________________________________________________________________
+void INukeMFPTable2018::Build(
+    int pdgc, int A, int Z, double rmax,
+    double nRpi, double nRnuc, bool useOset, bool altOset,
+    bool xsecNNCorr, string mode)
+{
+  double kemin = INukeHadroData2018::fMinKinEnergy;
+
+  fNR      = kMFPNRNodes;
+  fRMax    = TMath::Max(rmax, 1.E-3);
+  fLogKEMin = TMath::Log(kemin);
+  fDLogKE  = TMath::Log(10.) / kMFPKENodesPerDec;
+  fNKE     = 2 + TMath::CeilNint((TMath::Log(kMFPKEMax) - fLogKEMin) / fDLogKE);
+
+  fTable.assign(fNR * fNKE, -1.);
+
+  double M = PDGLibrary::Instance()->Find(pdgc)->Mass();
+
+  for(int ike = 0; ike < fNKE; ike++) {
+    double ke = TMath::Exp(fLogKEMin + ike * fDLogKE) * units::MeV; // GeV
+    double E  = ke + M;
+    double p  = TMath::Sqrt(TMath::Max(0., E*E - M*M));
+    TLorentzVector p4(0., 0., p, E);
+    for(int ir = 0; ir < fNR; ir++) {
+      double r = ir * fRMax / (fNR-1);
+      TLorentzVector x4(0., 0., r, 0.);
+      double mfp = utils::intranuke2018::MeanFreePath(
+          pdgc, x4, p4, A, Z, nRpi, nRnuc, useOset, altOset, xsecNNCorr, mode);
+      fTable[ir*fNKE + ike] = (mfp > 0.) ? 1./mfp : -1.;
+    }
+  }
+}
+//____________________________________________________________________________
+double INukeMFPTable2018::InverseMFP(double r, double ke) const
+{
+  if(fTable.empty() || r < 0. || r > fRMax || ke <= 0.) return -1.;
+
+  double xke = (TMath::Log(ke) - fLogKEMin) / fDLogKE;
+  if(xke < 0. || xke > fNKE-1) return -1.;
+  double xr  = r * (fNR-1) / fRMax;
+
+  int ike = TMath::Min(fNKE-2, (int) xke);
+  int ir  = TMath::Min(fNR -2, (int) xr);
+  double wke = xke - ike;
+  double wr  = xr  - ir;
+
+  const double * lo = &fTable[ir*fNKE + ike];
+  const double * hi = lo + fNKE;
+  if(lo[0] < 0. || lo[1] < 0. || hi[0] < 0. || hi[1] < 0.) return -1.;
+
+  return (1.-wr) * ((1.-wke) * lo[0] + wke * lo[1]) +
+              wr * ((1.-wke) * hi[0] + wke * hi[1]);
+}
+//____________________________________________________________________________
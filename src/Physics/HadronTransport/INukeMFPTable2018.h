@@ -0,0 +1,72 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::INukeMFPTable2018
+
+\brief    Table of the inverse mean free path of a hadron species in a
+          nucleus, as a function of the radial position and of the kinetic
+          energy of the hadron, computed once with
+          utils::intranuke2018::MeanFreePath.
+
+          Intranuke2018 uses it to sample the free path of a hadron from
+          the optical depth accumulated along its straight-line track, so
+          that the nuclear density and the hadron+nucleon cross sections
+          are not recomputed at every step of every hadron.
+          The table is bilinear in (r, log(KE)). Look-ups outside the table,
+          or next to a point where the mean free path is not defined, return
+          a negative value so that the caller can compute the mean free path
+          directly.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _INUKE_MFP_TABLE_2018_H_
+#define _INUKE_MFP_TABLE_2018_H_
+
+#include <string>
+#include <vector>
+
+using std::string;
+using std::vector;
+
+namespace genie {
+
+class INukeMFPTable2018 {
+
+public:
+  INukeMFPTable2018();
+ ~INukeMFPTable2018();
+
+  //! Tabulate the inverse mean free path of the hadron with the input PDG
+  //! code in a nucleus (A,Z), for radii in [0,rmax] (fm). The remaining
+  //! inputs are passed to utils::intranuke2018::MeanFreePath.
+  void   Build      (int pdgc, int A, int Z, double rmax,
+                     double nRpi, double nRnuc, bool useOset, bool altOset,
+                     bool xsecNNCorr, string mode);
+
+  //! Inverse mean free path (1/fm) at radius r (fm) and kinetic energy ke
+  //! (MeV). Negative if (r,ke) is not covered by the table.
+  double InverseMFP (double r, double ke) const;
+
+  double RMax       (void) const { return fRMax; }
+
+private:
+
+  int            fNR;        ///< number of radial nodes
+  int            fNKE;       ///< number of kinetic energy nodes
+  double         fRMax;      ///< last radial node (fm)
+  double         fLogKEMin;  ///< log of the first kinetic energy node (MeV)
+  double         fDLogKE;    ///< log kinetic energy step
+  vector<double> fTable;     ///< inverse mfp (1/fm, <0 if undefined), [ir*fNKE+ike]
+};
+
+}      // genie namespace
+
+#endif // _INUKE_MFP_TABLE_2018_H_
@@ -24,6 +24,11 @@ potential in (e,e'p).  GENIE code was adapted from NuWro implementation.
    lookup tables in probe KE and nuclear density (rho) stored in text files
    for He4, C12, Ca40, Fe56, Sn120, and U238.  Use values from the text
    files for KE and rho, interpolation in A.
+ @ Oct, 2026 - CA
+   The tables are loaded once, when the instance is created, and can be
+   saved in a binary file (gnncorr2bin) which is then memory-mapped, and
+   shared, by all jobs on a node. The lookups only read the loaded tables
+   (no TGraph / heap allocation per call, and no first-call loading).
 */
 //____________________________________________________________________________
 #include "Physics/HadronTransport/INukeNucleonCorr.h"
@@ -43,23 +48,85 @@ using namespace genie;
 #include <iostream>
 #include <cmath>
 #include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
-#include <TGraph.h>
 using namespace std;
 
 
-INukeNucleonCorr* INukeNucleonCorr::fInstance = NULL; // initialize instance with NULL
-
-
 const int NRows     = 200;
 const int NColumns  =  17;
 
 string genie_dir(std::getenv("GENIE"));
-//string directory = genie_dir + string("/data/evgen/nncorr/");
-string dir = genie_dir + string("/data/evgen/nncorr/");
-string infile;
-vector<vector<double> > infile_values;
-vector<string> comments;
+
+// Correction table file layout (binary, native byte order, offsets in bytes
+// from the start of the file):
+//   header
+//   A     : mass numbers of the tabulated nuclei (doubles, increasing)
+//   data  : for each nucleus, nrows x ncols doubles, row-major
+namespace {
+
+  const char     kNncMagic[8]  = { 'G','E','N','I','E','N','N','C' };
+  const uint32_t kNncByteOrder = 0x01020304;
+  const uint32_t kNncVersion   = 1;
+
+  struct NncHeader {
+    char     magic[8];
+    uint32_t byte_order;
+    uint32_t version;
+    uint32_t nnuclei;
+    uint32_t nrows;
+    uint32_t ncols;
+    uint32_t reserved;
+    uint64_t a_offset;
+    uint64_t data_offset;
+    uint64_t file_size;
+  };
+
+  // the text tables and the mass numbers of their nuclei
+  const int    kNTextTables = 6;
+  const char * kTextTables[kNTextTables] = {
+      "NNCorrection_2_4.txt",   "NNCorrection_6_12.txt",
+      "NNCorrection_20_40.txt", "NNCorrection_26_56.txt",
+      "NNCorrection_50_120.txt","NNCorrection_92_238.txt" };
+  const double kTextTableA [kNTextTables] = { 4, 12, 40, 56, 120, 238 };
+
+  // columns of the text tables: energy + 17 densities
+  const unsigned int kNTextColumns = 18;
+
+  //This function reads the correction files that will be used to interpolate new correction values for some target//
+  bool read_file(string rfilename, vector<vector<double> > & values)
+  {
+    ifstream file;
+    file.open((char*)rfilename.c_str(), ios::in);
+
+    if (!file.is_open()) {
+      LOG("INukeNucleonCorr",pERROR) << "Could not open " << rfilename;
+      return false;
+    }
+    string line;
+    while (getline(file,line))
+      {
+      if (line.empty() || line[0]=='#') continue;
+      vector<double> temp_vector;
+      istringstream iss(line);
+      string s;
+      for (unsigned int i=0; i<kNTextColumns; i++)
+        {
+        iss >> s;
+        temp_vector.push_back(atof(s.c_str()));
+      }
+      values.push_back(temp_vector);
+    }
+    file.close();
+    LOG("INukeNucleonCorr",pINFO) << "Successful open file " << rfilename;
+    return true;
+  }
+}
 
 
 
@@ -75,6 +142,32 @@ const double INukeNucleonCorr::fLambda1 =  -0.373 / (units::fermi) / fRho0;  //
 
 
 
+// ----- SINGLETON ----- //
+
+INukeNucleonCorr * INukeNucleonCorr::getInstance()
+{
+  // thread-safe initialization: the tables are loaded before first use
+  static INukeNucleonCorr instance;
+  return &instance;
+}
+
+INukeNucleonCorr::INukeNucleonCorr() :
+fMapBase(0),
+fMapSize(0),
+fTableA(0),
+fTables(0),
+fNNuclei(0),
+fNTableRows(0),
+fNTableColumns(0)
+{
+  this->LoadTables();
+}
+
+INukeNucleonCorr::~INukeNucleonCorr()
+{
+  this->Unmap();
+}
+
 // ----- CALCULATIONS ----- //
 
 //! \f$m^* (k,\rho) = m \frac{(\Lambda^2 + k^2)^2}{\Lambda^2 + k^2)^2 - 2\Lambda^2\beta m}\f$
@@ -103,13 +196,6 @@ double INukeNucleonCorr :: localFermiMom (const double rho, const int A, const i
   return pdg == kPdgProton ? pow (factor * rho * Z / A, 1.0 / 3.0) / (units::fermi) :
                              pow (factor * rho * (A - Z) / A, 1.0 / 3.0) / (units::fermi);
 }
-    vector<vector<double> > HeliumValues;
-    vector<vector<double> > CarbonValues;
-    vector<vector<double> > CalciumValues;
-    vector<vector<double> > IronValues;
-    vector<vector<double> > TinValues;
-    vector<vector<double> > UraniumValues;
-    vector<vector<double> > clear;
 
 //! generate random momentum direction and return 4-momentum of target nucleon
 TLorentzVector INukeNucleonCorr :: generateTargetNucleon (const double mass, const double fermiMom)
@@ -190,49 +276,182 @@ double INukeNucleonCorr :: AvgCorrection (const double rho, const int A, const i
 }
 
 
-//This function reads the correction files that will be used to interpolate new correction values for some target//
-void read_file(string rfilename)
+// ----- CORRECTION TABLES ----- //
+
+string INukeNucleonCorr::TableDir(void)
 {
-  ifstream file;
-  file.open((char*)rfilename.c_str(), ios::in);
+  return genie_dir + string("/data/evgen/nncorr/");
+}
 
-  if (file.is_open())
-    {
-    string line;
-    int cur_line = 0;
-    while (getline(file,line))
-      {
-      if (line[0]=='#')
-        {
-        comments.push_back(line);
-        }
-      else {
-        vector<double> temp_vector;
-        istringstream iss(line);
-        string s;
-        for (int i=0; i<18; i++)
-          {
-          iss >> s;
-          temp_vector.push_back(atof(s.c_str()));
-        }
-        infile_values.push_back(temp_vector);
-        cur_line++;
+string INukeNucleonCorr::BinaryTableFile(void)
+{
+  return TableDir() + string("NNCorrection.bin");
+}
+
+bool INukeNucleonCorr::LoadTables(void)
+{
+  string binfile = BinaryTableFile();
+  if (access(binfile.c_str(), R_OK) == 0 && this->MapTables(binfile)) return true;
+
+  LOG("INukeNucleonCorr",pNOTICE)
+    << "No binary nucleon correction table - Reading the text tables";
+  return this->ReadTables(TableDir());
+}
+
+void INukeNucleonCorr::Unmap(void)
+{
+  if (fMapBase) munmap((void *) fMapBase, fMapSize);
+  fMapBase       = 0;
+  fMapSize       = 0;
+  fTableA        = 0;
+  fTables        = 0;
+  fNNuclei       = 0;
+  fNTableRows    = 0;
+  fNTableColumns = 0;
+}
+
+bool INukeNucleonCorr::ReadTables(const string & tabledir)
+{
+  this->Unmap();
+  fOwnedTables.clear();
+
+  const unsigned int nrows = NRows+1;
+  fOwnedTables.resize(kNTextTables + kNTextTables*nrows*kNTextColumns, 0.);
+  for (int k = 0; k < kNTextTables; k++) {
+    vector<vector<double> > values;
+    if (!read_file(tabledir+kTextTables[k], values) || values.size() < nrows) {
+      LOG("INukeNucleonCorr",pERROR)
+        << "Could not read the nucleon correction table "
+        << tabledir << kTextTables[k] << " - No correction applied";
+      fOwnedTables.clear();
+      return false;
+    }
+    fOwnedTables[k] = kTextTableA[k];
+    double * table = &fOwnedTables[kNTextTables + k*nrows*kNTextColumns];
+    for (unsigned int r = 0; r < nrows; r++) {
+      for (unsigned int c = 0; c < kNTextColumns; c++) {
+        table[r*kNTextColumns+c] = values[r][c];
       }
     }
-    LOG("INukeNucleonCorr",pNOTICE) << "Successful open file" << rfilename << "\n";
-
   }
-  else {
-    LOG("INukeNucleonCorr",pNOTICE) << "Could not open " << rfilename << "\n";
 
+  fTableA        = &fOwnedTables[0];
+  fTables        = &fOwnedTables[kNTextTables];
+  fNNuclei       = kNTextTables;
+  fNTableRows    = nrows;
+  fNTableColumns = kNTextColumns;
+
+  LOG("INukeNucleonCorr",pNOTICE)
+    << "Nucleon Corr interpolation files read in successfully";
+  return true;
+}
+
+bool INukeNucleonCorr::MapTables(const string & filename)
+{
+  this->Unmap();
+  fOwnedTables.clear();
+
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    LOG("INukeNucleonCorr",pERROR) << "Could not open file: " << filename;
+    return false;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(NncHeader)) {
+    LOG("INukeNucleonCorr",pERROR) << "Empty or truncated file: " << filename;
+    close(fd);
+    return false;
   }
-  file.close();
+  size_t size = st.st_size;
+  void * addr = mmap(0, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED) {
+    LOG("INukeNucleonCorr",pERROR) << "Could not map file: " << filename;
+    return false;
+  }
+  const char * base = (const char *) addr;
+
+  NncHeader header;
+  memcpy(&header, base, sizeof(NncHeader));
+  bool ok =
+     memcmp(header.magic, kNncMagic, sizeof(kNncMagic)) == 0 &&
+     header.byte_order  == kNncByteOrder &&
+     header.version     == kNncVersion   &&
+     header.file_size   == size          &&
+     header.nnuclei     >  0             &&
+     header.nrows       >= (uint32_t) NRows    &&
+     header.ncols       >= (uint32_t) NColumns &&
+     header.a_offset    == sizeof(NncHeader) &&
+     header.data_offset == header.a_offset + header.nnuclei * sizeof(double) &&
+     header.data_offset + header.nnuclei * (uint64_t) header.nrows *
+                          header.ncols * sizeof(double) == size;
+  const double * tableA = (const double *) (base + header.a_offset);
+  for (uint32_t k = 1; k < header.nnuclei && ok; k++) {
+    ok = tableA[k-1] < tableA[k];
+  }
+  if (!ok) {
+    LOG("INukeNucleonCorr",pERROR)
+      << "Invalid or incompatible file (version: " << header.version
+      << "): " << filename;
+    munmap(addr, size);
+    return false;
+  }
+
+  fMapBase       = base;
+  fMapSize       = size;
+  fTableA        = tableA;
+  fTables        = (const double *) (base + header.data_offset);
+  fNNuclei       = header.nnuclei;
+  fNTableRows    = header.nrows;
+  fNTableColumns = header.ncols;
+
+  LOG("INukeNucleonCorr",pNOTICE)
+    << "Mapped " << fNNuclei << " nucleon correction tables from: " << filename;
+  return true;
 }
 
+bool INukeNucleonCorr::SaveTables(const string & filename) const
+{
+  if (!fTables) {
+    LOG("INukeNucleonCorr",pERROR) << "No nucleon correction tables to save";
+    return false;
+  }
+
+  NncHeader header;
+  memset(&header, 0, sizeof(NncHeader));
+  memcpy(header.magic, kNncMagic, sizeof(kNncMagic));
+  header.byte_order  = kNncByteOrder;
+  header.version     = kNncVersion;
+  header.nnuclei     = fNNuclei;
+  header.nrows       = fNTableRows;
+  header.ncols       = fNTableColumns;
+  header.a_offset    = sizeof(NncHeader);
+  header.data_offset = header.a_offset + fNNuclei * sizeof(double);
+  uint64_t ndata     = fNNuclei * (uint64_t) fNTableRows * fNTableColumns;
+  header.file_size   = header.data_offset + ndata * sizeof(double);
+
+  ofstream out(filename.c_str(), ios::out | ios::binary);
+  if (!out.is_open()) {
+    LOG("INukeNucleonCorr",pERROR) << "Could not open file: " << filename;
+    return false;
+  }
+  out.write((const char *) &header, sizeof(NncHeader));
+  out.write((const char *) fTableA, fNNuclei * sizeof(double));
+  out.write((const char *) fTables, ndata * sizeof(double));
+  out.close();
+  if (out.fail()) {
+    LOG("INukeNucleonCorr",pERROR) << "Error while writing file: " << filename;
+    return false;
+  }
+
+  LOG("INukeNucleonCorr",pNOTICE)
+    << "Saved " << fNNuclei << " nucleon correction tables in: " << filename;
+  return true;
+}
 
 // This function interpolates and returns correction values
 //
-double INukeNucleonCorr :: getAvgCorrection(double rho, double A, double ke)
+double INukeNucleonCorr :: getAvgCorrection(double rho, double A, double ke) const
 {
   //Read in energy and density to determine the row and column of the correction table - adjust for variable binning - throws away some of the accuracy
    int Column = round(rho*100);
@@ -244,88 +463,24 @@ double INukeNucleonCorr :: getAvgCorrection(double rho, double A, double ke)
    if(ke>.1&&ke<=.5) Row = round(.1*1000.+(ke-.1)*200);
    if(ke>.5&&ke<=1) Row = round(.1*1000.+(.5-.1)*200+(ke-.5)*40);
    if(ke>1) Row = NRows-1;
-   //LOG ("INukeNucleonCorr",pNOTICE)
-   //  << "row, column = " << Row << "   " << Column;
-  //If the table of correction values has already been created
-  // return a value. Else, interpolate the needed correction table//
-//  static double cache[NRows][NColumns] = {{-1}};
-  static bool ReadFile = false;
-  if( ReadFile == true ) {
-   int Npoints = 6;
-   TGraph * Interp = new TGraph(Npoints);
-   //LOG("INukeNucleonCorr",pNOTICE)
-   //  << HeliumValues[Row][Column];
-   Interp->SetPoint(0,4,HeliumValues[Row][Column]);
-   Interp->SetPoint(1,12,CarbonValues[Row][Column]);
-   Interp->SetPoint(2,40,CalciumValues[Row][Column]);
-   Interp->SetPoint(3,56,IronValues[Row][Column]);
-   Interp->SetPoint(4,120,TinValues[Row][Column]);
-   Interp->SetPoint(5,238,UraniumValues[Row][Column]);
-
-   //   Interpolated[e][r] = Interp->Eval(A);
-	//	LOG("INukeNucleonCorr",pNOTICE)
-	//	  << "e,r,value= " << e << "   " << r << "   " << Interpolated[e][r];
-   double returnval = Interp->Eval(A);
-   delete Interp;
-   LOG("INukeNucleonCorr",pINFO)
-      << "Nucleon Corr interpolated correction factor = "
-      << returnval  //cache[Row][Column]
-      << " for rho, KE, A= "<<  rho << "  " << ke << "   " << A;
-    //    return cache[Row][Column];
-   return returnval;
-  } else {
-    //Reading in correction files//
-    //    string dir = genie_dir + string("/data/evgen/nncorr/");
-
-    read_file(dir+"NNCorrection_2_4.txt");
-    HeliumValues = infile_values;
-    infile_values = clear;
-
-    read_file(dir+"NNCorrection_6_12.txt");
-    CarbonValues = infile_values;
-    infile_values = clear;
-
-    read_file(dir+"NNCorrection_20_40.txt");
-    CalciumValues = infile_values;
-    infile_values = clear;
-
-    read_file(dir+"NNCorrection_26_56.txt");
-    IronValues = infile_values;
-    infile_values = clear;
-
-    read_file(dir+"NNCorrection_50_120.txt");
-    TinValues = infile_values;
-    infile_values = clear;
-
-    read_file(dir+"NNCorrection_92_238.txt");
-    UraniumValues = infile_values;
-    infile_values = clear;
-
-    LOG("INukeNucleonCorr",pNOTICE)
-      << "Nucleon Corr interpolation files read in successfully";
-    //get interpolated value for first event.
-    int Npoints = 6;
-    TGraph * Interp = new TGraph(Npoints);
-    //LOG("INukeNucleonCorr",pNOTICE)
-    //  << HeliumValues[Row][Column];
-    Interp->SetPoint(0,4,HeliumValues[Row][Column]);
-    Interp->SetPoint(1,12,CarbonValues[Row][Column]);
-    Interp->SetPoint(2,40,CalciumValues[Row][Column]);
-    Interp->SetPoint(3,56,IronValues[Row][Column]);
-    Interp->SetPoint(4,120,TinValues[Row][Column]);
-    Interp->SetPoint(5,238,UraniumValues[Row][Column]);
-
-    //	LOG("INukeNucleonCorr",pNOTICE)
-    //	  << "Row,Column,value= " << Row << "   " << Column << "   " << Interp->Eval(A);
-    double returnval = Interp->Eval(A);
-    delete Interp;
-    ReadFile = true;
-    LOG("INukeNucleonCorr",pINFO)
-      << "Nucleon Corr interpolated correction factor = "
-      << returnval
-      << " for rho, KE, A= "<<  rho << "  " << ke << "   " << A;
-    return returnval;
-  }
+
+  // no tables (already reported when loading): no correction
+  if (!fTables) return 1.;
+
+  // linear interpolation in A between the bracketing tabulated nuclei
+  // (linear extrapolation from the first / last two, as TGraph::Eval)
+  const unsigned int cell  = Row * fNTableColumns + Column;
+  const unsigned int tsize = fNTableRows * fNTableColumns;
+  if (fNNuclei == 1) return fTables[cell];
+
+  unsigned int low = 0;
+  while (low+2 < fNNuclei && fTableA[low+1] <= A) low++;
+  const double xl = fTableA[low];
+  const double xu = fTableA[low+1];
+  const double yl = fTables[ low   *tsize + cell];
+  const double yu = fTables[(low+1)*tsize + cell];
+
+  return yl + (A - xl) * (yu - yl) / (xu - xl);
 }
 
 //This function outputs new correction files a new target if needed//
@@ -11,6 +11,8 @@
 #define INUKE_NUCLEON_CORR_H
 
 #include <iostream>
+#include <string>
+#include <vector>
 
 #include <TGenPhaseSpace.h>
 #include "Framework/ParticleData/PDGCodes.h"
@@ -19,18 +21,46 @@ class INukeNucleonCorr
 {
   public:
     
-    //! get single instance of INukeNucleonCorr; create if necessary
-    static INukeNucleonCorr* getInstance() {return fInstance ? fInstance : (fInstance = new INukeNucleonCorr);}
+    //! get single instance of INukeNucleonCorr; create (and load the correction tables) if necessary
+    static INukeNucleonCorr* getInstance();
     
     //! get the correction for given four-momentum and density
     //    double getAvgCorrection (const double rho, const int A, const int Z, const int pdg, const double Ek);
-    double getAvgCorrection (const double rho, const double A, const double Ek);
+    //! (read-only lookup in the loaded tables, safe to call from any thread)
+    double getAvgCorrection (const double rho, const double A, const double Ek) const;
     void OutputFiles(int A, int Z);
     double AvgCorrection (const double rho, const int A, const int Z, const int pdg, const double Ek);
 
+    // ----- CORRECTION TABLES ----- //
+
+    //! memory-map the binary tables if available, else read the text tables
+    bool LoadTables (void);
+    //! read the text tables (NNCorrection_Z_A.txt) of the input directory
+    bool ReadTables (const std::string & dir);
+    //! memory-map a binary table file written by SaveTables()
+    bool MapTables  (const std::string & filename);
+    //! save the loaded tables in the binary (memory-mapped) format
+    bool SaveTables (const std::string & filename) const;
+
+    bool HasTables  (void) const { return fTables != 0; }
+
+    static std::string TableDir       (void); //!< directory of the text tables
+    static std::string BinaryTableFile(void); //!< default binary table file
+
   private:
   
-    static INukeNucleonCorr *fInstance; //!< single instance of INukeNucleonCorr
+    // ----- CORRECTION TABLES ----- //
+
+    void Unmap (void);
+
+    const char *        fMapBase;      //!< start of the mapped table file (0 if none)
+    size_t              fMapSize;      //!< size of the mapped table file
+    std::vector<double> fOwnedTables;  //!< tables read from text files
+    const double *      fTableA;       //!< mass numbers of the tabulated nuclei (increasing)
+    const double *      fTables;       //!< correction tables, one per nucleus, row-major (energy, density)
+    unsigned int        fNNuclei;      //!< number of tabulated nuclei
+    unsigned int        fNTableRows;   //!< rows (energies) per table
+    unsigned int        fNTableColumns;//!< columns (densities) per table
   
     // ----- MODEL PARAMETERS ----- //
     
@@ -75,7 +105,8 @@ class INukeNucleonCorr
     
     // ----- SINGLETON "BLOCKADES"----- //
         
-    INukeNucleonCorr () {}                                 //!< private constructor (called only by getInstance())
+    INukeNucleonCorr ();                                   //!< private constructor (called only by getInstance())
+   ~INukeNucleonCorr ();
     INukeNucleonCorr (const INukeNucleonCorr&);            //!< block copy constructor
     INukeNucleonCorr& operator= (const INukeNucleonCorr&); //!< block assignment operator
 
@@ -57,21 +57,25 @@ int INukeOsetTable :: processLine (const std::string &line)
   if (int exitCode = checkIntegrity (currentDensityValue, currentEnergyValue))
     return exitCode; // stop in the case of error (exit code != 0)
 
+  // add new node to the table
+  const unsigned int node = fCrossSectionTable.size();
+  fCrossSectionTable.resize (node + fNodeSize, 0.0);
+
   for (unsigned int i = 0; i < fNChannels; i++) // channel loop
   {
     // get qel and cex cross sections for i-th channel
     double xsecQel, xsecCex;
     splitLine >> xsecQel >> xsecCex;
-    // save them in proper vector
-    fQelCrossSectionTable[i].push_back (xsecQel);
-    fCexCrossSectionTable[i].push_back (xsecCex);
+    // save them in proper column
+    fCrossSectionTable[node + fQelColumn + i] = xsecQel;
+    fCrossSectionTable[node + fCexColumn + i] = xsecCex;
   } // channel loop
 
   // get absorption cross section
   double absorption;
   splitLine >> absorption;
-  // save it in proper vector
-  fAbsorptionCrossSectionTable.push_back (absorption);
+  // save it in proper column
+  fCrossSectionTable[node + fAbsColumn] = absorption;
 
   return 0; // no errors
 }
@@ -156,49 +160,59 @@ void INukeOsetTable :: badFile (const char* file, const int &errorCode, const in
 }
 
 //! make bilinear interpolation between four points around (density, energy)
-double INukeOsetTable :: interpolate (const std::vector<double> &data) const
+void INukeOsetTable :: interpolate (double *values) const
 {
   // take four points adjacent to (density, energy) = (d,E):
   // (d0, E0), (d1, E0), (d0, E1), (d1, E1)
   // where d0 < d < d1, E0 < E < E1
   // each point goes in with weight = proper distance
+  // the index and weights are the same for all channels, so all columns
+  // of the four nodes are interpolated together
 
   // total bin width for normalization
-  static const double totalBinWidth = fDensityBinWidth * fEnergyBinWidth;
-  
-  // extract low boundary value from table
-  double lowValue = data[fEnergyHandler.index +
-                         fDensityHandler.index * fNEnergyBins]; // (d0, E0)
-  // high boundaries = low boundary if on edge
-  double highDensityValue = lowValue; // (d1, E0)
-  double highEnergyValue  = lowValue; // (d0, E1)
-  double highValue        = lowValue; // (d1, E1)
-
-  // extract high boundaries values from table (if not on edge)
+  const double totalBinWidth = fDensityBinWidth * fEnergyBinWidth;
+
+  // offsets of the four nodes; high boundaries = low boundary if on edge
+  const unsigned int lowNode = fEnergyHandler.index +
+                               fDensityHandler.index * fNEnergyBins;
+  unsigned int highDensityNode = lowNode; // (d1, E0)
+  unsigned int highEnergyNode  = lowNode; // (d0, E1)
+  unsigned int highNode        = lowNode; // (d1, E1)
+
   if (not fDensityHandler.isEdge)
   {
-    highDensityValue = data[fEnergyHandler.index +
-                            (fDensityHandler.index + 1) * fNEnergyBins];
+    highDensityNode = lowNode + fNEnergyBins;
 
     if (not fEnergyHandler.isEdge)
     {
-      highEnergyValue = data[fEnergyHandler.index + 1 +
-                             fDensityHandler.index * fNEnergyBins];
-      highValue       = data[fEnergyHandler.index + 1 +
-                             (fDensityHandler.index + 1) * fNEnergyBins];
+      highEnergyNode = lowNode + 1;
+      highNode       = lowNode + 1 + fNEnergyBins;
     }
   }
   else if (not fEnergyHandler.isEdge)
-    highEnergyValue = data[fEnergyHandler.index + 1 +
-                           fDensityHandler.index * fNEnergyBins];
-
-  lowValue         *= fDensityHandler.lowWeight  * fEnergyHandler.lowWeight;
-  highDensityValue *= fDensityHandler.highWeight * fEnergyHandler.lowWeight;
-  highEnergyValue  *= fDensityHandler.lowWeight  * fEnergyHandler.highWeight;
-  highValue        *= fDensityHandler.highWeight * fEnergyHandler.highWeight;
-  
-  return (lowValue + highDensityValue + highEnergyValue + highValue) /
-          totalBinWidth;
+    highEnergyNode = lowNode + 1;
+
+  // weights of the four nodes
+  const double lowWeight =
+    fDensityHandler.lowWeight  * fEnergyHandler.lowWeight  / totalBinWidth;
+  const double highDensityWeight =
+    fDensityHandler.highWeight * fEnergyHandler.lowWeight  / totalBinWidth;
+  const double highEnergyWeight =
+    fDensityHandler.lowWeight  * fEnergyHandler.highWeight / totalBinWidth;
+  const double highWeight =
+    fDensityHandler.highWeight * fEnergyHandler.highWeight / totalBinWidth;
+
+  const double *low         = &fCrossSectionTable[lowNode         * fNodeSize];
+  const double *highDensity = &fCrossSectionTable[highDensityNode * fNodeSize];
+  const double *highEnergy  = &fCrossSectionTable[highEnergyNode  * fNodeSize];
+  const double *high        = &fCrossSectionTable[highNode        * fNodeSize];
+
+  // contiguous, fixed-length loop: vectorised by the compiler
+  for (unsigned int i = 0; i < fNodeSize; i++)
+    values[i] = low[i]         * lowWeight        +
+                highDensity[i] * highDensityWeight +
+                highEnergy[i]  * highEnergyWeight  +
+                high[i]        * highWeight;
 }
 
 //! set up table index and weights for given point
@@ -242,11 +256,14 @@ void INukeOsetTable :: setupOset (const double &density, const double &pionTk, c
  */ 
 void INukeOsetTable :: setCrossSections ()
 {
+    double values [fNodeSize];
+    interpolate (values); // all channels in one pass
+
     for (unsigned int i = 0; i < fNChannels; i++) // channel loop
     {
-      fQelCrossSections[i] = interpolate (fQelCrossSectionTable[i]);
-      fCexCrossSections[i] = interpolate (fCexCrossSectionTable[i]);
+      fQelCrossSections[i] = values[fQelColumn + i];
+      fCexCrossSections[i] = values[fCexColumn + i];
     }
 
-    fAbsorptionCrossSection = interpolate (fAbsorptionCrossSectionTable); 
+    fAbsorptionCrossSection = values[fAbsColumn];
 }
@@ -34,33 +34,29 @@ class INukeOsetTable : public INukeOset
 
   private:
   
-  //! quasi-elastic piN cross section
-  /*! vector contains values in the following order:
+  //! cross sections of all channels, interleaved per (density, energy) node
+  /*! nodes are in the following order:
    * d0 e0, d0 e1, ... , d0 en, d1 e0 ... \n
+   * each node holds fNodeSize values: qel and cex cross sections for each
+   * channel (see fQelColumn / fCexColumn), pi absorption cross section and
+   * padding, so that all channels are interpolated in a single pass \n
    * channel = 0 -> pi+n or pi-p, 1 -> pi+p or pi-n, 2 -> pi0
    */
-  std::vector <double> fQelCrossSectionTable [fNChannels]; 
-  
-  //! charge-exchange piN cross section
-  /*! vector contains values in the following order:
-   * d0 e0, d0 e1, ... , d0 en, d1 e0 ... \n
-   * channel = 0 -> pi+n or pi-p, 1 -> pi+p or pi-n, 2 -> pi0
-   */
-  std::vector <double> fCexCrossSectionTable [fNChannels];
-  
-  //! pi absorption cross section
-  /*! vector contains values in the following order:
-   * d0 e0, d0 e1, ... , d0 en, d1 e0 ...
-   */
-  std::vector <double> fAbsorptionCrossSectionTable;
+  std::vector <double> fCrossSectionTable;
+
+  static const unsigned int fNodeSize  = 8;               //!< values per node (padded)
+  static const unsigned int fQelColumn = 0;               //!< column of qel xsec for channel 0
+  static const unsigned int fCexColumn = fNChannels;      //!< column of cex xsec for channel 0
+  static const unsigned int fAbsColumn = 2 * fNChannels;  //!< column of absorption xsec
 
   unsigned int fNDensityBins; //!< number of denisty bins
   unsigned int fNEnergyBins;  //!< number of energy bins
   double fDensityBinWidth;    //!< density step (must be fixed)
   double fEnergyBinWidth;     //!< energy step (must be fixed)
 
-  //! interpolate cross section (method fixed for Oset tables)
-  double interpolate (const std::vector<double> &data) const;
+  //! interpolate cross sections of all channels (method fixed for Oset tables)
+  /*! values must hold fNodeSize entries, filled in the table's column order */
+  void interpolate (double *values) const;
 
   //! process single line from table file, push values to proper vector (method fixed for Oset tables)
   int processLine (const std::string &line);
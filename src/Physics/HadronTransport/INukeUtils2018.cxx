@@ -37,6 +37,8 @@
 */
 //____________________________________________________________________________
 
+#include <vector>
+
 #include <TLorentzVector.h>
 #include <TMath.h>
 #include <TSystem.h>
@@ -53,6 +55,7 @@
 #include "Physics/HadronTransport/INukeUtils2018.h"
 #include "Physics/HadronTransport/INukeHadroData2018.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/NBodyPhaseSpace.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/Spline.h"
 #include "Framework/ParticleData/PDGLibrary.h"
@@ -69,11 +72,25 @@
 #include "TComplex.h"
 
 using std::ostringstream;
+using std::vector;
 using namespace genie;
 using namespace genie::utils;
 using namespace genie::constants;
 using namespace genie::controls;
 
+//____________________________________________________________________________
+// Per-thread pool of the scratch particles of the cascade
+namespace {
+
+  struct ScratchParticlePool : public vector<GHepParticle *> {
+    ~ScratchParticlePool() {
+      for(iterator iter = begin(); iter != end(); ++iter) delete *iter;
+    }
+  };
+
+  thread_local ScratchParticlePool gScratchParticles;
+}
+
 //____________________________________________________________________________
 double genie::utils::intranuke2018::MeanFreePath(
    int pdgc, const TLorentzVector & x4, const TLorentzVector & p4,
@@ -144,21 +161,19 @@ double genie::utils::intranuke2018::MeanFreePath(
   double ppcnt = (double) Z/ (double) A; // % of protons remaining
   INukeHadroData2018 * fHadroData2018 = INukeHadroData2018::Instance();
 
+  // total hadron+proton and hadron+neutron x-sections
+  double sig_p = 0., sig_n = 0.;
+  fHadroData2018 -> XSecTot(pdgc, ke, sig_p, sig_n);
+
   if (is_pion and (INukeMode == "hN2018") and useOset and ke < 350.0)
     sigtot = sigmaTotalOset (ke, rho, pdgc, ppcnt, altOset);
-  else if (pdgc == kPdgPiP)
-    { sigtot = fHadroData2018 -> XSecPipp_Tot() -> Evaluate(ke)*ppcnt;
-      sigtot+= fHadroData2018 -> XSecPipn_Tot() -> Evaluate(ke)*(1-ppcnt);}
-  else if (pdgc == kPdgPi0)
-    { sigtot = fHadroData2018 -> XSecPi0p_Tot() -> Evaluate(ke)*ppcnt;
-      sigtot+= fHadroData2018 -> XSecPi0n_Tot() -> Evaluate(ke)*(1-ppcnt);}
-  else if (pdgc == kPdgPiM)
-    { sigtot = fHadroData2018 -> XSecPipn_Tot() -> Evaluate(ke)*ppcnt;
-      sigtot+= fHadroData2018 -> XSecPipp_Tot() -> Evaluate(ke)*(1-ppcnt);}
+  else if (pdgc == kPdgPiP || pdgc == kPdgPi0 || pdgc == kPdgPiM)
+    { sigtot = sig_p*ppcnt;
+      sigtot+= sig_n*(1-ppcnt);}
   else if (pdgc == kPdgProton)
     {
-      sigtot = fHadroData2018 -> XSecPp_Tot()   -> Evaluate(ke)*ppcnt;
-      //sigtot+= fHadroData2018 -> XSecPn_Tot()   -> Evaluate(ke)*(1-ppcnt);
+      sigtot = sig_p*ppcnt;
+      //sigtot+= sig_n*(1-ppcnt);
 
       PDGLibrary * pLib = PDGLibrary::Instance();
       double hc = 197.327;
@@ -177,7 +192,7 @@ double genie::utils::intranuke2018::MeanFreePath(
           double Pc = TMath::Exp(-B*f);
           sigtot *= Pc;
         }
-      sigtot+= fHadroData2018 -> XSecPn_Tot()   -> Evaluate(ke)*(1-ppcnt);
+      sigtot+= sig_n*(1-ppcnt);
 
       double E0 = TMath::Power(A,0.2)*12.;
       if (INukeMode=="hN2018"){if(ke<E0){sigtot=0.0;}}  //empirical - needed to cut off large number of low energy nucleons
@@ -185,19 +200,19 @@ double genie::utils::intranuke2018::MeanFreePath(
     }
   else if (pdgc == kPdgNeutron)
     {
-      sigtot = fHadroData2018 -> XSecPn_Tot()   -> Evaluate(ke)*ppcnt;
-      sigtot+= fHadroData2018 -> XSecNn_Tot()   -> Evaluate(ke)*(1-ppcnt);
+      sigtot = sig_p*ppcnt;
+      sigtot+= sig_n*(1-ppcnt);
       double E0 = TMath::Power(A,0.2)*12.;
       if (INukeMode=="hN2018"){if(ke<E0){sigtot=0.0;}}  //empirical - needed to cut off large number of low energy nucleons
       //      LOG("INukeUtils",pDEBUG) "sigtot for neutron= " << sigtot << "; KE= " << ke;
     }
   else if (pdgc == kPdgKP)
-    { sigtot = fHadroData2018 -> XSecKpN_Tot()  -> Evaluate(ke);
+    { sigtot = sig_p; // K+N: same x-section on p and n
       // this factor is used to empirically get agreement with tot xs data, justified historically.
       sigtot*=1.1;}
   else if (pdgc == kPdgGamma)
-    { sigtot = fHadroData2018 -> XSecGamp_fs()  -> Evaluate(ke)*ppcnt;
-      sigtot+= fHadroData2018 -> XSecGamn_fs()  -> Evaluate(ke)*(1-ppcnt);}
+    { sigtot = sig_p*ppcnt;
+      sigtot+= sig_n*(1-ppcnt);}
   else {
      return 0;
   }
@@ -600,12 +615,11 @@ void genie::utils::intranuke2018::PreEquilibrium(
   // change particle status for decaying particle - take out as test
   //ev->Particle(f_loc)->SetStatus(kIStIntermediateState);
   // decay a clone particle
-  GHepParticle * t = new GHepParticle(*(ev->Particle(f_loc)));
+  ScratchParticle t_clone(*(ev->Particle(f_loc)));
+  GHepParticle * t = t_clone.Get();
   t->SetFirstMother(f_loc);
   //next statement was in Alex Bell's original code - PreEq, then Equilibrium using particle with highest energy.  Note it gets IST=kIStIntermediateState.
   //genie::utils::intranuke2018::Equilibrium(ev,t,RemnA,RemnZ,RemnP4,DoFermi,FermiFac,Nuclmodel,NucRmvE,mode);
-
-  delete t;
 }
 //___________________________________________________________________________
 // Method to handle Equilibrium reaction
@@ -1705,8 +1719,8 @@ bool genie::utils::intranuke2018::PhaseSpaceDecay(
     << "Composite system p4 = " << utils::print::P4AsString(pd);
 
   // Set the decay
-  TGenPhaseSpace GenPhaseSpace;
-  bool permitted = GenPhaseSpace.SetDecay(*pd, pdgv.size(), mass);
+  NBodyPhaseSpace phase_space;
+  bool permitted = phase_space.SetDecay(*pd, pdgv.size(), mass);
   if(!permitted) {
      LOG("INukeUtils", pERROR)
        << " *** Phase space decay is not permitted \n"
@@ -1725,49 +1739,20 @@ bool genie::utils::intranuke2018::PhaseSpaceDecay(
   p->SetStatus(kIStNucleonClusterTarget);  //kIStDecayedState);
   p->SetPdgCode(kPdgCompNuclCluster);
   ev->AddParticle(*p);
-  // Get the maximum weight
-  double wmax = -1;
-  for(int k=0; k<200; k++) {
-     double w = GenPhaseSpace.Generate();
-     wmax = TMath::Max(wmax,w);
-  }
-  assert(wmax>0);
-
-  LOG("INukeUtils", pINFO)
-   << "Max phase space gen. weight @ current hadronic interaction: " << wmax;
 
   // Generate an unweighted decay
-
+  // (the max weight is tabulated by the phase space generator)
   RandomGen * rnd = RandomGen::Instance();
-  wmax *= 1.2;
-
-  bool accept_decay=false;
-  unsigned int itry=0;
-
-  while(!accept_decay)
-  {
-    itry++;
-
-    if(itry>kMaxUnweightDecayIterations) {
-       // report, clean-up and return
-       LOG("INukeUtils", pNOTICE)
-             << "Couldn't generate an unweighted phase space decay after "
-             << itry << " attempts";
-       delete [] mass;
-       delete pd;
-       return false;
-    }
-
-    double w  = GenPhaseSpace.Generate();
-    double gw = wmax * rnd->RndFsi().Rndm();
-
-    if(w > wmax) {
-       LOG("INukeUtils", pNOTICE)
-           << "Decay weight = " << w << " > max decay weight = " << wmax;
-    }
-
-    LOG("INukeUtils", pNOTICE) << "Decay weight = " << w << " / R = " << gw;
-    accept_decay = (gw<=w);
+  bool accept_decay =
+     phase_space.GenerateUnweighted(rnd->RndFsi(), kMaxUnweightDecayIterations);
+  if(!accept_decay) {
+     // report, clean-up and return
+     LOG("INukeUtils", pNOTICE)
+           << "Couldn't generate an unweighted phase space decay after "
+           << kMaxUnweightDecayIterations << " attempts";
+     delete [] mass;
+     delete pd;
+     return false;
   }
 
   // Insert final state products into the event record
@@ -1795,14 +1780,14 @@ bool genie::utils::intranuke2018::PhaseSpaceDecay(
      bool isnuc = pdg::IsNeutronOrProton(pdgc);
 
      //-- get the 4-momentum of the i-th final state particle
-     TLorentzVector * p4fin = GenPhaseSpace.GetDecay(i++);
+     const TLorentzVector & p4fin = phase_space.GetDecay(i++);
 
      //-- intranuke no longer throws "bindinos" but adds all the energy
      //   not going at a simulated f/s particle at a "hadronic blob"
      //   representing the remnant system: do the binding energy subtraction
      //   here & update the remnant hadronic system 4p
      double M  = PDGLibrary::Instance()->Find(pdgc)->Mass();
-     double En = p4fin->Energy();
+     double En = p4fin.Energy();
 
      double KE = En-M;
 
@@ -1812,12 +1797,12 @@ bool genie::utils::intranuke2018::PhaseSpaceDecay(
      double dE_leftover = TMath::Min(NucRmvE, KE);
      KE -= dE_leftover;
      En  = KE+M;
-     double pmag_old = p4fin->P();
+     double pmag_old = p4fin.P();
      double pmag_new = TMath::Sqrt(TMath::Max(0.,En*En-M*M));
      double scale    = pmag_new / pmag_old;
-     double pxn      = scale * p4fin->Px();
-     double pyn      = scale * p4fin->Py();
-     double pzn      = scale * p4fin->Pz();
+     double pxn      = scale * p4fin.Px();
+     double pyn      = scale * p4fin.Py();
+     double pzn      = scale * p4fin.Pz();
 
      TLorentzVector p4n(pxn,pyn,pzn,En);
      //     LOG("INukeUtils", pNOTICE) << "Px = " << pxn << " Py = " << pyn
@@ -1865,9 +1850,9 @@ bool genie::utils::intranuke2018::PhaseSpaceDecay(
          ev->AddParticle(new_particle);
        }
 
-     double dpx = (1-scale)*p4fin->Px();
-     double dpy = (1-scale)*p4fin->Py();
-     double dpz = (1-scale)*p4fin->Pz();
+     double dpx = (1-scale)*p4fin.Px();
+     double dpy = (1-scale)*p4fin.Py();
+     double dpz = (1-scale)*p4fin.Pz();
      TLorentzVector premnadd(dpx,dpy,dpz,dE_leftover);
      RemnP4 += premnadd;
   }
@@ -1919,3 +1904,21 @@ double genie::utils::intranuke2018::sigmaTotalOset (
   return iNukeOset->getTotalCrossSection();
 
 }
+//____________________________________________________________________________
+genie::utils::intranuke2018::ScratchParticle::ScratchParticle(
+                                                      const GHepParticle & p)
+{
+  if(gScratchParticles.empty()) {
+    fParticle = new GHepParticle(p);
+  } else {
+    fParticle = gScratchParticles.back();
+    gScratchParticles.pop_back();
+    fParticle->Copy(p);
+  }
+}
+//____________________________________________________________________________
+genie::utils::intranuke2018::ScratchParticle::~ScratchParticle()
+{
+  gScratchParticles.push_back(fParticle);
+}
+//____________________________________________________________________________
@@ -115,6 +115,26 @@ namespace intranuke2018
                          const bool &isTableChosen = true
                          );
 
+  //! Scratch copy of a cascade hadron. The copy is taken from a per-thread
+  //! pool of GHepParticles, so that the 4-vectors of the many temporary
+  //! hadron clones of the cascade are allocated once per thread rather than
+  //! once per clone. It goes back to the pool when it goes out of scope.
+  class ScratchParticle {
+  public:
+    explicit ScratchParticle (const GHepParticle & p);
+   ~ScratchParticle ();
+
+    GHepParticle * Get        (void) const { return fParticle; }
+    GHepParticle * operator-> (void) const { return fParticle; }
+    GHepParticle & operator*  (void) const { return *fParticle; }
+
+  private:
+    ScratchParticle (const ScratchParticle &);
+    ScratchParticle & operator = (const ScratchParticle &);
+
+    GHepParticle * fParticle;
+  };
+
 }      // intranuke namespace
 }      // utils     namespace
 }      // genie     namespace
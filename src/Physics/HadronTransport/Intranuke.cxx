@@ -78,6 +78,8 @@
 #include "Framework/ParticleData/PDGCodeList.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/EventGenCost.h"
+#include "Framework/Utils/TraceScope.h"
 #include "Physics/NuclearState/NuclearUtils.h"
 
 using std::ostringstream;
@@ -338,6 +340,9 @@ void Intranuke::TransportHadrons(GHepRecord * evrec) const
     bool has_interacted = false;
     while ( this-> IsInNucleus(sp) ) 
     {
+      GTRACE_SCOPE("Intranuke::Step");
+      EventGenCost::Current().nfsisteps++;
+
       // advance the hadron by a step
       utils::intranuke::StepParticle(sp, fHadStep);
 
@@ -352,6 +357,7 @@ void Intranuke::TransportHadrons(GHepRecord * evrec) const
       LOG("Intranuke", pNOTICE) 
           << "Particle has interacted at location:  " 
           << sp->X4()->Vect().Mag() << " / nucl rad= " << fTrackingRadius;
+      GTRACE_SCOPE("Intranuke::SimulateHadronicFinalState");
 	this->SimulateHadronicFinalState(evrec,sp);
     } else if(has_interacted && fRemnA<=0) {
         // nothing left to interact with!
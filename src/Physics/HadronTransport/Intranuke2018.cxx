@@ -58,21 +58,29 @@
 
 #include <cstdlib>
 #include <sstream>
+#include <map>
+#include <mutex>
 
 #include <TMath.h>
+#include <TVector3.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/Controls.h"
+#include "Framework/Conventions/Units.h"
 #include "Framework/GHEP/GHepStatus.h"
 #include "Framework/GHEP/GHepRecord.h"
 #include "Framework/GHEP/GHepParticle.h"
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EVGThreadException.h"
 #include "Physics/HadronTransport/Intranuke2018.h"
+#include "Physics/HadronTransport/INukeBatchResult.h"
 #include "Physics/HadronTransport/INukeHadroData2018.h"
 #include "Physics/HadronTransport/INukeHadroFates.h"
 #include "Physics/HadronTransport/INukeMode.h"
+#include "Physics/HadronTransport/INukeMFPTable2018.h"
 #include "Physics/HadronTransport/INukeUtils2018.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
@@ -83,30 +91,51 @@
 #include "Framework/ParticleData/PDGCodeList.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/EventGenCost.h"
+#include "Framework/Utils/TraceScope.h"
 #include "Physics/NuclearState/NuclearUtils.h"
 
 using std::ostringstream;
+using std::map;
 
 using namespace genie;
 using namespace genie::utils;
 using namespace genie::constants;
 using namespace genie::controls;
 
+//___________________________________________________________________________
+// Mean free path tables, keyed by algorithm, hadron and remnant nucleus and
+// shared by all threads.
+namespace {
+
+  struct MFPTableMap : public map<string, INukeMFPTable2018 *> {
+    ~MFPTableMap() {
+      for(iterator iter = begin(); iter != end(); ++iter) delete iter->second;
+    }
+  };
+
+  MFPTableMap gMFPTables;
+  std::mutex  gMFPTableMutex;
+}
+
 //___________________________________________________________________________
 Intranuke2018::Intranuke2018() :
-EventRecordVisitorI()
+EventRecordVisitorI(),
+fInBatch(false)
 {
 
 }
 //___________________________________________________________________________
 Intranuke2018::Intranuke2018(string name) :
-EventRecordVisitorI(name)
+EventRecordVisitorI(name),
+fInBatch(false)
 {
 
 }
 //___________________________________________________________________________
 Intranuke2018::Intranuke2018(string name, string config) :
-EventRecordVisitorI(name, config)
+EventRecordVisitorI(name, config),
+fInBatch(false)
 {
 
 }
@@ -153,6 +182,76 @@ void Intranuke2018::ProcessEventRecord(GHepRecord * evrec) const
   this->TransportHadrons(evrec);
 }
 //___________________________________________________________________________
+void Intranuke2018::TransportBatch(int probe, double ke, int target,
+    unsigned int nev, INukeBatchResult & result, long int first_event) const
+{
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+  TParticlePDG * probe_data  = pdglib->Find(probe);
+  TParticlePDG * target_data = pdglib->Find(target);
+  if(!probe_data || !target_data || !pdg::IsIon(target)) {
+    LOG("Intranuke2018", pERROR)
+      << "Can not transport a batch of " << probe << " on " << target;
+    return;
+  }
+
+  // the initial state shared by all events of the batch (as in gevgen_hadron)
+  double mh  = probe_data->Mass();
+  double Eh  = mh + ke;
+  double pzh = TMath::Sqrt(TMath::Max(0., Eh*Eh - mh*mh));
+  TLorentzVector p4h   (0., 0., pzh, Eh);
+  TLorentzVector p4tgt (0., 0., 0., target_data->Mass());
+  TLorentzVector x4null(0., 0., 0., 0.);
+
+  EventRecord initial_state;
+  initial_state.AttachSummary(new Interaction);
+  initial_state.AddParticle(probe,  kIStInitialState, -1,-1,-1,-1, p4h,   x4null);
+  initial_state.AddParticle(target, kIStInitialState, -1,-1,-1,-1, p4tgt, x4null);
+
+  // per batch set-up: generation mode, tracking radius, mean free path tables
+  GHepParticle * nucltgt = initial_state.TargetNucleus();
+  fGMode = initial_state.EventGenerationMode();
+  this->SetTrackingRadius(nucltgt);
+
+  fBatchA = nucltgt->A();
+  fBatchZ = nucltgt->Z();
+  fBatchMFPTables.clear();
+  if(fUseMFPTables) {
+    const int hadrons[] = {
+      kPdgPiP, kPdgPiM, kPdgPi0, kPdgProton, kPdgNeutron, kPdgKP };
+    fRemnA = fBatchA;
+    fRemnZ = fBatchZ;
+    for(unsigned int i = 0; i < sizeof(hadrons)/sizeof(int); i++) {
+      fBatchMFPTables[hadrons[i]] = this->MFPTable(hadrons[i]);
+    }
+  }
+  fInBatch = true;
+
+  RandomGen * rnd = RandomGen::Instance();
+  bool set_streams = (first_event >= 0 && rnd->UsingCounterBasedStreams());
+
+  // the event record is re-used (its entries are recycled) for all events
+  EventRecord event;
+  for(unsigned int iev = 0; iev < nev; iev++) {
+    if(set_streams) rnd->SetEventNumber(first_event + iev);
+
+    event.Copy(initial_state);
+    try {
+      this->GenerateVertex(&event);
+      this->TransportHadrons(&event);
+    }
+    catch (exceptions::EVGThreadException exception) {
+      LOG("Intranuke2018", pNOTICE)
+        << "Transport of batch event " << iev << " failed: " << exception;
+      result.AddFailed();
+      continue;
+    }
+    result.AddEvent(event);
+  }
+
+  fInBatch = false;
+  fBatchMFPTables.clear();
+}
+//___________________________________________________________________________
 void Intranuke2018::GenerateVertex(GHepRecord * evrec) const
 {
 // Sets a vertex in the nucleus periphery
@@ -315,8 +414,9 @@ void Intranuke2018::TransportHadrons(GHepRecord * evrec) const
       << " >> Stepping a " << p->Name() 
                         << " with kinetic E = " << p->KinE() << " GeV";
 
-    // Rescatter a clone, not the original particle
-    GHepParticle * sp = new GHepParticle(*p); 
+    // Rescatter a (scratch) clone, not the original particle
+    utils::intranuke2018::ScratchParticle clone(*p);
+    GHepParticle * sp = clone.Get();
 
     // Set clone's mom to be the hadron that was cloned
     sp->SetFirstMother(icurr); 
@@ -330,22 +430,30 @@ void Intranuke2018::TransportHadrons(GHepRecord * evrec) const
        sp->SetFirstMother(icurr); 
        sp->SetStatus(kIStStableFinalState);
        evrec->AddParticle(*sp);
-       delete sp;
        continue; // <-- skip to next GHEP entry
     }
 
     // Start stepping particle out of the nucleus
     bool has_interacted = false;
-    while ( this-> IsInNucleus(sp) ) 
-    {
-      // advance the hadron by a step
-      utils::intranuke2018::StepParticle(sp, fHadStep);
-
-      // check whether it interacts
-      double d = this->GenerateStep(evrec,sp);
-      has_interacted = (d<fHadStep);
-      if(has_interacted) break;
-    }//stepping
+    if (fUseMFPTables) {
+      GTRACE_SCOPE("Intranuke2018::TrackToInteraction");
+      has_interacted = this->TrackToInteraction(sp);
+    }
+    else {
+      while ( this-> IsInNucleus(sp) ) 
+      {
+        GTRACE_SCOPE("Intranuke2018::Step");
+        EventGenCost::Current().nfsisteps++;
+
+        // advance the hadron by a step
+        utils::intranuke2018::StepParticle(sp, fHadStep);
+
+        // check whether it interacts
+        double d = this->GenerateStep(evrec,sp);
+        has_interacted = (d<fHadStep);
+        if(has_interacted) break;
+      }//stepping
+    }
 
     //updating the position of the original particle with the position of the clone
     evrec->Particle(sp->FirstMother())->SetPosition(*(sp->X4()));
@@ -355,6 +463,7 @@ void Intranuke2018::TransportHadrons(GHepRecord * evrec) const
       LOG("Intranuke2018", pNOTICE) 
           << "Particle has interacted at location:  " 
           << sp->X4()->Vect().Mag() << " / nucl rad= " << fTrackingRadius;
+      GTRACE_SCOPE("Intranuke2018::SimulateHadronicFinalState");
 	this->SimulateHadronicFinalState(evrec,sp);
     } else if(has_interacted && fRemnA<=0) {
         // nothing left to interact with!
@@ -371,7 +480,6 @@ void Intranuke2018::TransportHadrons(GHepRecord * evrec) const
 	evrec->AddParticle(*sp);
 	evrec->Particle(sp->FirstMother())->SetRescatterCode(1);
     }
-    delete sp;
 
     // Current snapshot
     //LOG("Intranuke2018", pINFO) << "Current event record snapshot: " << *evrec;
@@ -429,15 +537,145 @@ double Intranuke2018::GenerateStep(GHepRecord*  /*evrec*/, GHepParticle* p) cons
   return d;
 }
 //___________________________________________________________________________
+bool Intranuke2018::TrackToInteraction(GHepParticle* p) const
+{
+// Moves the hadron along its direction by steps of fHadStep, as the stepping
+// loop in TransportHadrons() does, until it interacts or leaves the nucleus.
+// Returns true if it interacted. Instead of generating a free path at each
+// step, the optical depth to the interaction point is generated once and
+// the inverse mean free path at the end of each step is taken from the
+// tables of the hadron in the remnant nucleus. The hadron is then moved to
+// its final position with a single step.
+
+  int pdgc = p->Pdg();
+
+  double scale = 1.;
+  if (pdgc==kPdgPiP || pdgc==kPdgPiM || pdgc==kPdgPi0) {
+    scale = fPionMFPScale;
+  }
+  else if (pdgc==kPdgProton || pdgc==kPdgNeutron) {
+    scale = fNucleonMFPScale;
+  }
+  string fINukeMode = this->GetINukeMode();
+  if(this->GetGenINukeMode() != "hA") scale = 1.;
+
+  // the kinetic energy does not change along the free path
+  double ke = (p->P4()->Energy() - p->P4()->M()) / units::MeV;
+
+  // the Oset pion x-sections are evaluated at every step, as they are stored
+  // for the hN fate selection
+  bool is_pion = (pdgc==kPdgPiP || pdgc==kPdgPiM || pdgc==kPdgPi0);
+  bool oset    = is_pion && fINukeMode == "hN2018" && fUseOset && ke < 350.0;
+
+  const INukeMFPTable2018 * table = (oset) ? 0 : this->MFPTable(pdgc);
+
+  RandomGen * rnd = RandomGen::Instance();
+  double tau = -1. * TMath::Log(rnd->RndFsi().Rndm());
+
+  TVector3 x0  = p->X4()->Vect();
+  TVector3 dir = p->P4()->Vect().Unit();
+  TLorentzVector x4(*p->X4());
+
+  double rmax = fTrackingRadius + fHadStep; // see IsInNucleus()
+  int    nstep = 0;
+  bool   has_interacted = false;
+
+  while ( x4.Vect().Mag() < rmax )
+  {
+    nstep++;
+    x4.SetVect(x0 + (nstep*fHadStep)*dir);
+
+    double invmfp = (table) ? table->InverseMFP(x4.Vect().Mag(), ke) : -1.;
+    if(invmfp < 0.) {
+      // outside the table: as in GenerateStep()
+      double L = utils::intranuke2018::MeanFreePath(pdgc, x4, *p->P4(), fRemnA,
+                   fRemnZ, fDelRPion, fDelRNucleon, fUseOset, fAltOset, fXsecNNCorr, fINukeMode);
+      if(L <= 0.) { has_interacted = true; break; }
+      invmfp = 1./L;
+    }
+    tau -= fHadStep * invmfp / scale;
+    if(tau < 0.) { has_interacted = true; break; }
+  }
+
+  if(nstep > 0) {
+    utils::intranuke2018::StepParticle(p, nstep*fHadStep);
+  }
+  EventGenCost::Current().nfsisteps += nstep;
+  return has_interacted;
+}
+//___________________________________________________________________________
+const INukeMFPTable2018 * Intranuke2018::MFPTable(int pdgc) const
+{
+// Mean free path table of the input hadron in the current remnant nucleus,
+// built the first time it is needed and kept until the next configuration
+
+  // within a batch, the tables in the (unchanged) target are looked up once
+  if(fInBatch && fRemnA == fBatchA && fRemnZ == fBatchZ) {
+    map<int, const INukeMFPTable2018 *>::const_iterator iter =
+                                            fBatchMFPTables.find(pdgc);
+    if(iter != fBatchMFPTables.end()) return iter->second;
+  }
+
+  ostringstream name;
+  name << this->Id().Key() << ";pdg:" << pdgc
+       << ";A:" << fRemnA << ";Z:" << fRemnZ << ";R:" << fTrackingRadius;
+  string key = name.str();
+
+  {
+    std::lock_guard<std::mutex> lock(gMFPTableMutex);
+    MFPTableMap::const_iterator iter = gMFPTables.find(key);
+    if(iter != gMFPTables.end()) return iter->second;
+  }
+
+  if(fRemnA <= 0) return 0;
+
+  LOG("Intranuke2018", pNOTICE)
+     << "Building mean free path table for " << key;
+
+  // the Oset pion x-sections are never used from the table
+  INukeMFPTable2018 * table = new INukeMFPTable2018;
+  table->Build(pdgc, fRemnA, fRemnZ, fTrackingRadius + fHadStep,
+     fDelRPion, fDelRNucleon, false, fAltOset, fXsecNNCorr, this->GetINukeMode());
+
+  std::lock_guard<std::mutex> lock(gMFPTableMutex);
+  MFPTableMap::iterator iter = gMFPTables.find(key);
+  if(iter != gMFPTables.end()) {
+    delete table;
+    return iter->second;
+  }
+  gMFPTables[key] = table;
+  return table;
+}
+//___________________________________________________________________________
+void Intranuke2018::ClearMFPTables(void) const
+{
+// Deletes the mean free path tables built with the previous configuration
+
+  string prefix = this->Id().Key() + ";";
+
+  std::lock_guard<std::mutex> lock(gMFPTableMutex);
+  MFPTableMap::iterator iter = gMFPTables.begin();
+  while(iter != gMFPTables.end()) {
+    if(iter->first.compare(0, prefix.size(), prefix) == 0) {
+      delete iter->second;
+      gMFPTables.erase(iter++);
+    } else {
+      ++iter;
+    }
+  }
+}
+//___________________________________________________________________________
 void Intranuke2018::Configure(const Registry & config)
 {
   Algorithm::Configure(config);
   this->LoadConfig();
+  this->ClearMFPTables();
 }
 //___________________________________________________________________________
 void Intranuke2018::Configure(string param_set)
 {
   Algorithm::Configure(param_set);
   this->LoadConfig();
+  this->ClearMFPTables();
 }
 //___________________________________________________________________________
@@ -30,6 +30,8 @@
 #ifndef _INTRANUKE_2018_H_
 #define _INTRANUKE_2018_H_
 
+#include <map>
+
 #include <TGenPhaseSpace.h>
 
 #include "Physics/NuclearState/NuclearModelI.h"
@@ -43,10 +45,14 @@
 class TLorentzVector;
 class TVector3;
 
+using std::map;
+
 namespace genie {
 
 class GHepParticle;
+class INukeBatchResult;
 class INukeHadroData2018;
+class INukeMFPTable2018;
 class PDGCodeList;
 class HNIntranuke2018;
 class HAIntranuke2018;
@@ -72,6 +78,15 @@ public :
   virtual string GetINukeMode() const {return "XX2018";};
   virtual string GetGenINukeMode() const {return "XX";};
 
+  //! Transport a batch of nev hadrons (probe, kinetic energy ke) fired at a
+  //! nucleus (target), as in hadron-nucleus mode, and append their final
+  //! states to result. The set-up of the nucleus, of its tracking radius and
+  //! of the mean free path tables is done once for the whole batch. With
+  //! counter-based random streams and first_event >= 0, event i of the batch
+  //! uses the streams of event number first_event+i.
+  void TransportBatch (int probe, double ke, int target, unsigned int nev,
+                       INukeBatchResult & result, long int first_event = -1) const;
+
 protected:
 
   // methods for loading configuration
@@ -85,6 +100,9 @@ protected:
   bool   IsInNucleus        (const GHepParticle* p) const;
   void   SetTrackingRadius  (const GHepParticle* p) const;
   double GenerateStep       (GHepRecord* ev, GHepParticle* p) const;
+  bool   TrackToInteraction (GHepParticle* p) const;
+  const INukeMFPTable2018 * MFPTable (int pdgc) const;
+  void   ClearMFPTables     (void) const;
 
   // virtual functions for individual modes
   virtual void SimulateHadronicFinalState(GHepRecord* ev, GHepParticle* p) const = 0;
@@ -100,6 +118,10 @@ protected:
   mutable int            fRemnZ;         ///< remnant nucleus Z
   mutable TLorentzVector fRemnP4;        ///< P4 of remnant system
   mutable GEvGenMode_t   fGMode;         ///< event generation mode (lepton+A, hadron+A, ...)
+  mutable bool           fInBatch;       ///< transporting a batch?
+  mutable int            fBatchA;        ///< target nucleus A of the current batch
+  mutable int            fBatchZ;        ///< target nucleus Z of the current batch
+  mutable map<int, const INukeMFPTable2018 *> fBatchMFPTables; ///< MFP tables in the batch target, by hadron
 
   // configuration parameters
   double       fR0;           ///< effective nuclear size param
@@ -119,6 +141,7 @@ protected:
   bool         fUseOset;      ///< Oset model for low energy pion in hN
   bool         fAltOset;      ///< NuWro's table-based implementation (not recommended)
   bool         fXsecNNCorr;   ///< use nuclear medium correction for NN cross section
+  bool         fUseMFPTables; ///< sample free paths from tabulated (r,KE) mean free paths
 
   double       fPionMFPScale;       ///< tweaking factors for tuning
   double       fPionFracCExScale;
@@ -9,6 +9,8 @@
 
 #pragma link C++ class genie::INukeHadroData;
 #pragma link C++ class genie::INukeHadroData2018;
+#pragma link C++ class genie::INukeMFPTable2018;
+#pragma link C++ class genie::INukeBatchResult;
 #pragma link C++ class genie::INukeDeltaPropg;
 //#pragma link C++ class genie::INukePhotoPropg;
 
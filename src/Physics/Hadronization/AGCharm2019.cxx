@@ -16,6 +16,7 @@
 #include <TVector3.h>
 #include <TF1.h>
 #include <TROOT.h>
+#include <Math/WrappedTF1.h>
 
 #if ROOT_VERSION_CODE >= ROOT_VERSION(5,15,6)
 #include <TMCParticle.h>
@@ -41,6 +42,7 @@
 #include "Framework/Utils/KineUtils.h"
 #include "Framework/Utils/StringUtils.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/Pythia6Gate.h"
 #include "Physics/Hadronization/AGCharm2019.h"
 #include "Physics/Hadronization/FragmentationFunctionI.h"
 
@@ -242,7 +244,7 @@ TClonesArray * AGCharm2019::Hadronize(
 
      // Generate the charm hadron pT^2 and pL^2 (with respect to the
      // hadronic system direction @ the LAB)
-     double ptc2 = fCharmPT2pdf->GetRandom();
+     double ptc2 = fCharmPT2Sampler.Sample(rnd->RndHadro().Rndm());
      double plc2 = Ec2 - ptc2 - mc2;
      LOG("CharmHad", pINFO)
            << "Trying charm hadron pT^2 (tranv to pHad) = " << ptc2;
@@ -538,6 +540,9 @@ TClonesArray * AGCharm2019::Hadronize(
 */
 
   if(use_pythia) {
+    // PYTHIA6 is shared by all threads
+    Pythia6Gate::Guard pythia6_guard;
+
     int  qrkSyst1 = 0;
     int  qrkSyst2 = 0;
     if(isnu||isdm) { // neutrinos
@@ -815,6 +820,11 @@ void AGCharm2019::LoadConfig(void)
   // stop ROOT from deleting this object of its own volition
   gROOT->GetListOfFunctions()->Remove(fCharmPT2pdf);
 
+  // the pT^2 sampler (inverting its tabulated CDF)
+  ROOT::Math::WrappedTF1 pt2pdf(*fCharmPT2pdf);
+  fCharmPT2Sampler.Build(pt2pdf, 0., 0.6);
+  assert(!fCharmPT2Sampler.IsEmpty());
+
   // neutrino charm fractions: D^0, D^+, Ds^+ (remainder: Lamda_c^+)
   std::vector<double> ec, d0frac, dpfrac, dsfrac ;
 
@@ -33,6 +33,7 @@
 
 #include "Framework/EventGen/EventRecordVisitorI.h"
 #include "Framework/Interaction/Interaction.h"
+#include "Framework/Numerical/InverseCDFSampler.h"
 
 class TPythia6;
 class TF1;
@@ -74,6 +75,7 @@ private:
   //
   bool                           fCharmOnly;   ///< don't hadronize non-charm blob
   TF1 *                          fCharmPT2pdf; ///< charm hadron pT^2 pdf
+  InverseCDFSampler              fCharmPT2Sampler; ///< charm hadron pT^2 sampler (from fCharmPT2pdf)
   const FragmentationFunctionI * fFragmFunc;   ///< charm hadron fragmentation func
 
   double fFracMaxEnergy ;                      ///< Maximum energy available for the Meson fractions
@@ -24,6 +24,7 @@
 //____________________________________________________________________________
 
 #include <cstdlib>
+#include <map>
 
 #include <RVersion.h>
 #include <TSystem.h>
@@ -60,21 +61,45 @@ using namespace genie::constants;
 using namespace genie::controls;
 using namespace genie::utils::print;
 
+//____________________________________________________________________________
+// Multiplicity probability tables: P(n) for n = 2..kMultTableMaxMult, for
+// each initial state class (vp, vn, vbp, vbn), tabulated on a fine W grid
+// starting at Wmin(). Above kMultTableWmax, P(n) is computed directly.
+namespace {
+
+  const int    kMultTableNClass  = 4;
+  const int    kMultTableMaxMult = 18;
+  const int    kMultTableNMult   = kMultTableMaxMult - 1;
+  const double kMultTableWmax    = 5.0;    // GeV
+  const double kMultTableDW      = 0.002;  // GeV
+
+  // Phase space decay max weights are cached in bins of the decaying system
+  // mass and of the total decay product mass
+  const int    kNMaxWeightSamples = 1000;  // weighted decays to estimate a max weight
+  const double kMaxWeightBin      = 0.010; // GeV
+}
+
 //____________________________________________________________________________
 AGKYLowW2019::AGKYLowW2019() :
-EventRecordVisitorI("genie::AGKYLowW2019")
+EventRecordVisitorI("genie::AGKYLowW2019"),
+fHadronCodes(true)
 {
   fBaryonXFpdf  = 0;
   fBaryonPT2pdf = 0;
 //fKNO          = 0;
+  fMultTableNW  = 0;
+  fParticleBuffer = new TClonesArray("genie::GHepParticle", kMultTableMaxMult);
 }
 //____________________________________________________________________________
 AGKYLowW2019::AGKYLowW2019(string config) :
-EventRecordVisitorI("genie::AGKYLowW2019", config)
+EventRecordVisitorI("genie::AGKYLowW2019", config),
+fHadronCodes(true)
 {
   fBaryonXFpdf  = 0;
   fBaryonPT2pdf = 0;
 //fKNO          = 0;
+  fMultTableNW  = 0;
+  fParticleBuffer = new TClonesArray("genie::GHepParticle", kMultTableMaxMult);
 }
 //____________________________________________________________________________
 AGKYLowW2019::~AGKYLowW2019()
@@ -82,6 +107,7 @@ AGKYLowW2019::~AGKYLowW2019()
   if (fBaryonXFpdf ) delete fBaryonXFpdf;
   if (fBaryonPT2pdf) delete fBaryonPT2pdf;
 //if (fKNO         ) delete fKNO;
+  delete fParticleBuffer;
 }
 //____________________________________________________________________________
 // HadronizationModelI interface implementation:
@@ -94,9 +120,11 @@ void AGKYLowW2019::Initialize(void) const
 void AGKYLowW2019::ProcessEventRecord(GHepRecord * event) const {
 
   Interaction * interaction = event->Summary();
-  TClonesArray * particle_list = this->Hadronize(interaction);
 
-  if(! particle_list ) {
+  // hadronize into the particle list kept for re-use across events
+  TClonesArray & particle_list = *fParticleBuffer;
+
+  if(! this->Hadronize(interaction, particle_list) ) {
     LOG("AGKYLowW2019", pWARN) << "Got an empty particle list. Hadronizer failed!";
     LOG("AGKYLowW2019", pWARN) << "Quitting the current event generation thread";
 
@@ -126,9 +154,10 @@ void AGKYLowW2019::ProcessEventRecord(GHepRecord * event) const {
   GHepParticle * neutrino  = event->Probe();
   const TLorentzVector & vtx = *(neutrino->X4());
 
-  GHepParticle * particle = 0;
-  TIter particle_iter(particle_list);
-  while ((particle = (GHepParticle *) particle_iter.Next()))  {
+  int nparticles = particle_list.GetEntriesFast();
+  for(int ip = 0; ip < nparticles; ip++) {
+
+    GHepParticle * particle = (GHepParticle *) particle_list[ip];
 
     int pdgc = particle -> Pdg() ;
 
@@ -159,8 +188,6 @@ void AGKYLowW2019::ProcessEventRecord(GHepRecord * event) const {
     event->AddParticle(*particle);
   }
 
-  delete particle_list ;
-
   // update the weight of the event
   event -> SetWeight ( Weight() * event->Weight() );
 
@@ -170,11 +197,36 @@ TClonesArray * AGKYLowW2019::Hadronize(
                                         const Interaction * interaction) const
 {
 // Generate the hadronic system in a neutrino interaction using a KNO-based
-// model.
+// model. The returned particle list is owned by the caller.
+
+  TClonesArray * particle_list =
+      new TClonesArray("genie::GHepParticle", kMultTableMaxMult);
+
+  if(!this->Hadronize(interaction, *particle_list)) {
+    delete particle_list;
+    return 0;
+  }
+
+  //-- The container 'owns' its elements
+  particle_list->SetOwner(true);
+
+  return particle_list;
+}
+//____________________________________________________________________________
+bool AGKYLowW2019::Hadronize(
+     const Interaction * interaction, TClonesArray & particle_list) const
+{
+// Generate the hadronic system in a neutrino interaction using a KNO-based
+// model, filling the input particle list.
+// The list is cleared without deleting its particles, which are re-used, so
+// that no memory is allocated when hadronizing into the same list again.
+
+  // no 'C' option: the particles are kept for re-use
+  particle_list.Clear();
 
   if(!this->AssertValidity(interaction)) {
      LOG("KNOHad", pWARN) << "Returning a null particle list!";
-     return 0;
+     return false;
   }
   fWeight=1;
 
@@ -182,12 +234,12 @@ TClonesArray * AGKYLowW2019::Hadronize(
   LOG("KNOHad", pINFO) << "W = " << W << " GeV";
 
   //-- Select hadronic shower particles
-  PDGCodeList * pdgcv = this->SelectParticles(interaction);
+  PDGCodeList & pdgcv = fHadronCodes;
 
-  if(!pdgcv) {
+  if(!this->SelectParticles(interaction, pdgcv)) {
     LOG("KNOHad", pNOTICE)
         << "Failed selecting particles for " << *interaction;
-    return 0;
+    return false;
   }
 
   //-- Decay the hadronic final state
@@ -204,51 +256,61 @@ TClonesArray * AGKYLowW2019::Hadronize(
   //      keep the option of using simple phase space decay with reweighting switched
   //      off (for consistency with the neugen/daikon version).
   //
-  TClonesArray * particle_list = 0;
+  bool decayed = false;
   bool reweight_decays = fReWeightDecays;
   if(fUseBaryonXfPt2Param) {
-    bool use_isotropic_decay = (pdgcv->size()==2 && fUseIsotropic2BDecays);
+    bool use_isotropic_decay = (pdgcv.size()==2 && fUseIsotropic2BDecays);
     if(use_isotropic_decay) {
-       particle_list = this->DecayMethod1(W,*pdgcv,false);
+       decayed = this->DecayMethod1(particle_list,W,pdgcv,false);
     } else {
-       particle_list = this->DecayMethod2(W,*pdgcv,reweight_decays);
+       decayed = this->DecayMethod2(particle_list,W,pdgcv,reweight_decays);
     }
   } else {
-   particle_list = this->DecayMethod1(W,*pdgcv,reweight_decays);
+   decayed = this->DecayMethod1(particle_list,W,pdgcv,reweight_decays);
   }
 
-  if(!particle_list) {
+  if(!decayed) {
     LOG("KNOHad", pNOTICE)
         << "Failed decaying a hadronic system @ W=" << W
-        << "with  multiplicity=" << pdgcv->size();
+        << "with  multiplicity=" << pdgcv.size();
 
     // clean-up and exit
-    delete pdgcv;
-    return 0;
+    particle_list.Clear();
+    return false;
   }
 
   //-- Handle unstable particle decays (if requested)
-  this->HandleDecays(particle_list);
-
-  //-- The container 'owns' its elements
-  particle_list->SetOwner(true);
+  this->HandleDecays(&particle_list);
 
-  delete pdgcv;
-
-  return particle_list;
+  return true;
 }
 //____________________________________________________________________________
 PDGCodeList * AGKYLowW2019::SelectParticles(
                                        const Interaction * interaction) const
 {
+  bool allowdup = true;
+  PDGCodeList * pdgcv = new PDGCodeList(allowdup);
+
+  if(!this->SelectParticles(interaction, *pdgcv)) {
+    delete pdgcv;
+    return 0;
+  }
+  return pdgcv;
+}
+//____________________________________________________________________________
+bool AGKYLowW2019::SelectParticles(
+           const Interaction * interaction, PDGCodeList & pdgcv) const
+{
+// Selects the hadronic shower particles, filling the input PDG code list
+// (which must allow duplicate entries)
+
   if(!this->AssertValidity(interaction)) {
      LOG("KNOHad", pWARN) << "Returning a null particle list!";
-     return 0;
+     return false;
   }
 
   unsigned int min_mult = 2;
   unsigned int mult     = 0;
-  PDGCodeList * pdgcv   = 0;
 
   double W = utils::kinematics::W(interaction);
 
@@ -260,19 +322,20 @@ PDGCodeList * AGKYLowW2019::SelectParticles(
    //-- Build the multiplicity probabilities for the input interaction
   LOG("KNOHad", pDEBUG) << "Building Multiplicity Probability distribution";
   LOG("KNOHad", pDEBUG) << *interaction;
-  Option_t * opt = "+LowMultSuppr+Renormalize";
-  TH1D * mprob = this->MultiplicityProb(interaction,opt);
+  double mcdf[kMultTableNMult];
+  int nmult = this->MultiplicityCDF(interaction, mcdf);
 
-  if(!mprob) {
+  if(nmult<=0) {
     LOG("KNOHad", pWARN) << "Null multiplicity probability distribution!";
-    return 0;
+    return false;
   }
-  if(mprob->Integral("width")<=0) {
+  if(mcdf[nmult-1]<=0) {
     LOG("KNOHad", pWARN) << "Empty multiplicity probability distribution!";
-    delete mprob;
-    return 0;
+    return false;
   }
 
+  RandomGen * rnd = RandomGen::Instance();
+
   //----- FIND AN ALLOWED SOLUTION FOR THE HADRONIC FINAL STATE
 
   bool allowed_state=false;
@@ -287,12 +350,14 @@ PDGCodeList * AGKYLowW2019::SelectParticles(
        LOG("KNOHad", pERROR)
          << "Couldn't select hadronic shower particles after: "
          << itry << " attempts!";
-       delete mprob;
-       return 0;
+       return false;
     }
 
     //-- Generate a hadronic multiplicity
-    mult = TMath::Nint( mprob->GetRandom() );
+    double r = mcdf[nmult-1] * rnd->RndHadro().Rndm();
+    int k = 0;
+    while(k < nmult-1 && mcdf[k] <= r) k++;
+    mult = 2 + k;
 
     LOG("KNOHad", pINFO) << "Hadron multiplicity  = " << mult;
 
@@ -317,25 +382,24 @@ PDGCodeList * AGKYLowW2019::SelectParticles(
       } else {
         LOG("KNOHad", pWARN)
            << "Generated multiplicity: " << mult << " is too low! Quitting";
-        delete mprob;
-        return 0;
+        return false;
       }
     }
 
     //-- Determine what kind of particles we have in the final state
-    pdgcv = this->GenerateHadronCodes(mult, maxQ, W);
+    this->GenerateHadronCodes(mult, maxQ, W, pdgcv);
 
     LOG("KNOHad", pNOTICE)
-         << "Generated multiplicity (@ W = " << W << "): " << pdgcv->size();
+         << "Generated multiplicity (@ W = " << W << "): " << pdgcv.size();
 
     // muliplicity might have been forced to smaller value if the invariant
     // mass of the hadronic system was not sufficient
-    mult = pdgcv->size(); // update for potential change
+    mult = pdgcv.size(); // update for potential change
 
     // is it an allowed decay?
     double msum=0;
     vector<int>::const_iterator pdg_iter;
-    for(pdg_iter = pdgcv->begin(); pdg_iter != pdgcv->end(); ++pdg_iter) {
+    for(pdg_iter = pdgcv.begin(); pdg_iter != pdgcv.end(); ++pdg_iter) {
       int pdgc = *pdg_iter;
       double m = PDGLibrary::Instance()->Find(pdgc)->Mass();
 
@@ -348,7 +412,6 @@ PDGCodeList * AGKYLowW2019::SelectParticles(
        LOG("KNOHad", pWARN) << "*** Decay forbidden by kinematics! ***";
        LOG("KNOHad", pWARN) << "sum{mass} = " << msum << ", W = " << W;
        LOG("KNOHad", pWARN) << "Discarding hadronic system & re-trying!";
-       delete pdgcv;
        allowed_state = false;
        continue;
     }
@@ -361,9 +424,7 @@ PDGCodeList * AGKYLowW2019::SelectParticles(
 
   } // attempts
 
-  delete mprob;
-
-  return pdgcv;
+  return true;
 }
 //____________________________________________________________________________
 TH1D * AGKYLowW2019::MultiplicityProb(
@@ -477,6 +538,80 @@ TH1D * AGKYLowW2019::MultiplicityProb(
   return mult_prob;
 }
 //____________________________________________________________________________
+int AGKYLowW2019::MultiplicityCDF(
+                        const Interaction * interaction, double * cdf) const
+{
+// Fills cdf[k] with the cumulative (unnormalized) probability of hadronic
+// multiplicities 2..2+k, including the NeuGEN Rijk factors for W<Wcut, and
+// returns the number of allowed multiplicities (0 if none).
+// The multiplicity distribution is the one given by MultiplicityProb() with
+// the "+LowMultSuppr+Renormalize" option, but it is interpolated from the
+// tables built at configuration time rather than filled in a histogram.
+
+  const InitialState & init_state = interaction->InitState();
+  int nu_pdg  = init_state.ProbePdg();
+  int nuc_pdg = init_state.Tgt().HitNucPdg();
+
+  int iclass = this->KNOClass(nu_pdg, nuc_pdg);
+  if(iclass<0) {
+    LOG("KNOHad", pERROR)
+     << "Invalid initial state (probe = " << nu_pdg << ", "
+     << "hit nucleon = " << nuc_pdg << ")";
+    return 0;
+  }
+
+  double W = utils::kinematics::W(interaction);
+
+  // Max possible multiplicity, as in MultiplicityProb()
+  double maxmult = this->MaxMult(interaction);
+  if(fForceNeuGenLimit && maxmult>10) maxmult=10;
+  if(maxmult>kMultTableMaxMult) maxmult=kMultTableMaxMult;
+
+  if(maxmult<2) {
+     LOG("KNOHad", pWARN) << "Low maximum multiplicity! Quiting.";
+     return 0;
+  }
+  int nmult = TMath::Nint(maxmult) - 1;
+
+  double P[kMultTableNMult];
+  if(nmult==1) {
+    P[0] = 1.;
+  }
+  else {
+    double x  = (W - this->Wmin()) / kMultTableDW;
+    int    iw = (int) TMath::Floor(x);
+    if(iw >= 0 && iw < fMultTableNW-1) {
+      // linear interpolation between the two nearest W nodes
+      double f = x - iw;
+      const double * P0 = &fMultTable[(iclass*fMultTableNW + iw) * kMultTableNMult];
+      const double * P1 = P0 + kMultTableNMult;
+      for(int k = 0; k < nmult; k++) {
+        P[k] = (1-f)*P0[k] + f*P1[k];
+      }
+    } else {
+      double avn = 1.5*this->AverageChMult(nu_pdg, nuc_pdg, W);
+      for(int k = 0; k < nmult; k++) {
+        P[k] = this->KNO(nu_pdg, nuc_pdg, (k+2)/avn) / avn;
+      }
+    }
+  }
+
+  // Apply the NeuGEN probability scaling factors for W<Wcut
+  if(W<fWcut) {
+    double R2=1., R3=1.;
+    this->LowMultScaling(interaction, R2, R3);
+    P[0] *= R2;
+    if(nmult>1) P[1] *= R3;
+  }
+
+  double sum = 0;
+  for(int k = 0; k < nmult; k++) {
+    sum   += P[k];
+    cdf[k] = sum;
+  }
+  return nmult;
+}
+//____________________________________________________________________________
 double AGKYLowW2019::Weight(void) const
 {
   return fWeight;
@@ -622,7 +757,68 @@ void AGKYLowW2019::LoadConfig(void)
   this->GetParam( "DIS-HMultWgt-vbn-NC-m2", fRvbnNCm2 ) ;
   this->GetParam( "DIS-HMultWgt-vbn-NC-m3", fRvbnNCm3 ) ;
 
+  // Tabulate the multiplicity probabilities used for event generation
+  this->BuildMultTables();
 
+  // The phase space decay max weights depend on the configuration
+  fMaxPhaseSpaceWeights.clear();
+}
+//____________________________________________________________________________
+void AGKYLowW2019::BuildMultTables(void)
+{
+// Tabulates the (unnormalized) KNO multiplicity probabilities P(n), for
+// multiplicities 2..18 and for each class of initial state, on a fine W grid.
+// They depend only on the average multiplicity and Levy function parameters,
+// so they are computed once per configuration instead of once per event.
+// Truncation at the max multiplicity and the Rijk factors are applied when
+// the tables are sampled (see MultiplicityCDF()).
+
+  const int probe[kMultTableNClass] = {
+     kPdgNuMu, kPdgNuMu, kPdgAntiNuMu, kPdgAntiNuMu };
+  const int nucleon[kMultTableNClass] = {
+     kPdgProton, kPdgNeutron, kPdgProton, kPdgNeutron };
+
+  double wmin = this->Wmin();
+  fMultTableNW = (int) TMath::Ceil((kMultTableWmax - wmin) / kMultTableDW) + 1;
+  fMultTable.assign(kMultTableNClass * fMultTableNW * kMultTableNMult, 0.);
+
+  for(int ic = 0; ic < kMultTableNClass; ic++) {
+    for(int iw = 0; iw < fMultTableNW; iw++) {
+      double W   = wmin + iw * kMultTableDW;
+      double avn = 1.5*this->AverageChMult(probe[ic], nucleon[ic], W);
+      double * P = &fMultTable[(ic*fMultTableNW + iw) * kMultTableNMult];
+      for(int k = 0; k < kMultTableNMult; k++) {
+        P[k] = this->KNO(probe[ic], nucleon[ic], (k+2)/avn) / avn;
+      }
+    }
+  }
+
+  LOG("KNOHad", pINFO)
+    << "Tabulated multiplicity probabilities at " << fMultTableNW
+    << " W nodes between " << wmin << " and " << kMultTableWmax << " GeV";
+}
+//____________________________________________________________________________
+int AGKYLowW2019::KNOClass(int probe_pdg, int nuc_pdg) const
+{
+// Returns the index of the initial state class (vp, vn, vbp, vbn) which
+// determines the KNO parameters, or -1 for an invalid initial state.
+// As in KNO(), AverageChMult(): charged leptons and dark matter are treated
+// like (anti)neutrinos
+
+  bool is_p     = pdg::IsProton           (nuc_pdg);
+  bool is_n     = pdg::IsNeutron          (nuc_pdg);
+  bool is_nu    = pdg::IsNeutrino         (probe_pdg);
+  bool is_nubar = pdg::IsAntiNeutrino     (probe_pdg);
+  bool is_l     = pdg::IsNegChargedLepton (probe_pdg);
+  bool is_lbar  = pdg::IsPosChargedLepton (probe_pdg);
+  bool is_dm    = pdg::IsDarkMatter       (probe_pdg);
+
+  if      ( is_p && (is_nu    || is_l    || is_dm) ) return 0;
+  else if ( is_n && (is_nu    || is_l    || is_dm) ) return 1;
+  else if ( is_p && (is_nubar || is_lbar)          ) return 2;
+  else if ( is_n && (is_nubar || is_lbar)          ) return 3;
+
+  return -1;
 }
 //____________________________________________________________________________
 double AGKYLowW2019::KNO(int probe_pdg, int nuc_pdg, double z) const
@@ -726,7 +922,7 @@ int AGKYLowW2019::HadronShowerCharge(const Interaction* interaction) const
   return hadronShowerCharge;
 }
 //____________________________________________________________________________
-TClonesArray * AGKYLowW2019::DecayMethod1(
+bool AGKYLowW2019::DecayMethod1(TClonesArray & plist,
                double W, const PDGCodeList & pdgv, bool reweight_decays) const
 {
 // Simple phase space decay including all generated particles.
@@ -735,21 +931,19 @@ TClonesArray * AGKYLowW2019::DecayMethod1(
   LOG("KNOHad", pINFO) << "** Using Hadronic System Decay method 1";
 
   TLorentzVector p4had(0,0,0,W);
-  TClonesArray * plist = new TClonesArray("genie::GHepParticle", pdgv.size());
 
   // do the decay
-  bool ok = this->PhaseSpaceDecay(*plist, p4had, pdgv, 0, reweight_decays);
+  bool ok = this->PhaseSpaceDecay(plist, p4had, pdgv, 0, reweight_decays);
 
-  // clean-up and return NULL
+  // clean-up and return false
   if(!ok) {
-     plist->Delete();
-     delete plist;
-     return 0;
+     plist.Clear();
+     return false;
   }
-  return plist;
+  return true;
 }
 //____________________________________________________________________________
-TClonesArray * AGKYLowW2019::DecayMethod2(
+bool AGKYLowW2019::DecayMethod2(TClonesArray & plist,
                double W, const PDGCodeList & pdgv, bool reweight_decays) const
 {
 // Generate the baryon based on experimental pT^2 and xF distributions
@@ -759,7 +953,7 @@ TClonesArray * AGKYLowW2019::DecayMethod2(
   LOG("KNOHad", pINFO) << "** Using Hadronic System Decay method 2";
 
   // If only 2 particles are input then don't call the phase space decayer
-  if(pdgv.size() == 2) return this->DecayBackToBack(W,pdgv);
+  if(pdgv.size() == 2) return this->DecayBackToBack(plist,W,pdgv);
 
   // Now handle the more general case:
 
@@ -771,22 +965,13 @@ TClonesArray * AGKYLowW2019::DecayMethod2(
   // Check baryon code
   // ...
 
-  // Strip the PDG list from the baryon
-  bool allowdup = true;
-  PDGCodeList pdgv_strip(pdgv.size()-1, allowdup);
-  for(unsigned int i=1; i<pdgv.size(); i++) pdgv_strip[i-1] = pdgv[i];
-
-  // Get the sum of all masses for the particles in the stripped list
+  // Get the sum of all masses for the particles other than the baryon
+  // (these are decayed by the phase space decayer)
   double mass_sum = 0;
-  vector<int>::const_iterator pdg_iter = pdgv_strip.begin();
-  for( ; pdg_iter != pdgv_strip.end(); ++pdg_iter) {
-    int pdgc = *pdg_iter;
-    mass_sum += PDGLibrary::Instance()->Find(pdgc)->Mass();
+  for(unsigned int i=1; i<pdgv.size(); i++) {
+    mass_sum += PDGLibrary::Instance()->Find(pdgv[i])->Mass();
   }
 
-  // Create the particle list
-  TClonesArray * plist = new TClonesArray("genie::GHepParticle", pdgv.size());
-
   RandomGen * rnd = RandomGen::Instance();
   TLorentzVector p4had(0,0,0,W);
   TLorentzVector p4N  (0,0,0,0);
@@ -832,10 +1017,7 @@ TClonesArray * AGKYLowW2019::DecayMethod2(
         << "Generated baryon with P4 = " << utils::print::P4AsString(&p4N);
 
     // Insert the baryon at the event record
-    new ((*plist)[0]) GHepParticle(
-      baryon,kIStStableFinalState, -1,-1,-1,-1,
-      p4N.Px(),p4N.Py(),p4N.Pz(),p4N.Energy(), 0,0,0,0
-    );
+    this->SetParticle(plist, 0, baryon, p4N);
 
     // Do a phase space decay for the N-1 particles and add them to the list
     LOG("KNOHad", pINFO)
@@ -845,27 +1027,20 @@ TClonesArray * AGKYLowW2019::DecayMethod2(
         << ", Particle masses = " << mass_sum;
 
     bool is_ok = this->PhaseSpaceDecay(
-                          *plist, p4d, pdgv_strip, 1, reweight_decays);
+                          plist, p4d, pdgv, 1, reweight_decays);
 
     got_hadsyst_4p = is_ok;
 
     if(!got_hadsyst_4p) {
       got_baryon_4p = false;
-      plist->Delete();
+      plist.Clear();
     }
   }
 
-  // clean-up and return NULL
-  if(0) {
-     LOG("KNOHad", pERROR) << "*** Decay forbidden by kinematics! ***";
-     plist->Delete();
-     delete plist;
-     return 0;
-  }
-  return plist;
+  return true;
 }
 //____________________________________________________________________________
-TClonesArray * AGKYLowW2019::DecayBackToBack(
+bool AGKYLowW2019::DecayBackToBack(TClonesArray & plist,
                                      double W, const PDGCodeList & pdgv) const
 {
 // Handles a special case (only two particles) of the 2nd decay method
@@ -877,9 +1052,6 @@ TClonesArray * AGKYLowW2019::DecayBackToBack(
 
   RandomGen * rnd = RandomGen::Instance();
 
-  // Create the particle list
-  TClonesArray * plist = new TClonesArray("genie::GHepParticle", pdgv.size());
-
   // Get xF,pT2 distribution (y-) maxima for the rejection method
   double xFo  = 1.1 * fBaryonXFpdf ->GetMaximum(-1,1);
   double pT2o = 1.1 * fBaryonPT2pdf->GetMaximum( 0,1);
@@ -892,20 +1064,19 @@ TClonesArray * AGKYLowW2019::DecayBackToBack(
 
     // Find an allowed (unweighted) phase space decay for the 2 particles
     // and add them to the list
-    bool ok = this->PhaseSpaceDecay(*plist, p4, pdgv, 0, false);
+    bool ok = this->PhaseSpaceDecay(plist, p4, pdgv, 0, false);
 
-    // If the decay isn't allowed clean-up and return NULL
+    // If the decay isn't allowed clean-up and return false
     if(!ok) {
       LOG("KNOHad", pERROR) << "*** Decay forbidden by kinematics! ***";
-      plist->Delete();
-      delete plist;
-      return 0;
+      plist.Clear();
+      return false;
     }
 
     // If the decay was allowed, then compute the baryon xF,pT2 and accept/
     // reject the phase space decays so as to reproduce the xF,pT2 PDFs
 
-    GHepParticle * baryon = (GHepParticle *) (*plist)[0];
+    GHepParticle * baryon = (GHepParticle *) plist[0];
     assert(pdg::IsNeutronOrProton(baryon->Pdg()));
 
     double px  = baryon->Px();
@@ -928,62 +1099,55 @@ TClonesArray * AGKYLowW2019::DecayBackToBack(
 
     LOG("KNOHad", pINFO) << ((accepted) ? "Decay accepted":"Decay rejected");
   }
-  return plist;
+  return true;
 }
 //____________________________________________________________________________
 bool AGKYLowW2019::PhaseSpaceDecay(
-         TClonesArray & plist, TLorentzVector & pd,
+         TClonesArray & plist, const TLorentzVector & pd,
                    const PDGCodeList & pdgv, int offset, bool reweight) const
 {
-// General method decaying the input particle system 'pdgv' with available 4-p
-// given by 'pd'. The decayed system is used to populate the input GHepParticle
-// array starting from the slot 'offset'.
+// General method decaying the particles 'pdgv' from the slot 'offset' on,
+// with available 4-p given by 'pd'. The decayed system is used to populate
+// the input GHepParticle array starting from the same slot 'offset'.
 //
   LOG("KNOHad", pINFO) << "*** Performing a Phase Space Decay";
   LOG("KNOHad", pINFO) << "pT reweighting is " << (reweight ? "on" : "off");
 
-  assert ( offset      >= 0);
-  assert ( pdgv.size() >  1);
+  int nbodies = (int) pdgv.size() - offset;
+
+  assert ( offset  >= 0);
+  assert ( nbodies >  1);
+  assert ( nbodies <= NBodyPhaseSpace::kMaxBodies);
 
   // Get the decay product masses
 
-  vector<int>::const_iterator pdg_iter;
-  int i = 0;
-  double * mass = new double[pdgv.size()];
-  double   sum  = 0;
-  for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
-    int pdgc = *pdg_iter;
-    double m = PDGLibrary::Instance()->Find(pdgc)->Mass();
-    mass[i++] = m;
+  double mass[NBodyPhaseSpace::kMaxBodies];
+  double sum = 0;
+  for(int i = 0; i < nbodies; i++) {
+    double m = PDGLibrary::Instance()->Find(pdgv[offset+i])->Mass();
+    mass[i] = m;
     sum += m;
   }
 
   LOG("KNOHad", pINFO)
-    << "Decaying N = " << pdgv.size() << " particles / total mass = " << sum;
+    << "Decaying N = " << nbodies << " particles / total mass = " << sum;
   LOG("KNOHad", pINFO)
     << "Decaying system p4 = " << utils::print::P4AsString(&pd);
 
   // Set the decay
-  bool permitted = fPhaseSpaceGenerator.SetDecay(pd, pdgv.size(), mass);
+  bool permitted = fPhaseSpaceGenerator.SetDecay(pd, nbodies, mass);
   if(!permitted) {
      LOG("KNOHad", pERROR)
        << " *** Phase space decay is not permitted \n"
        << " Total particle mass = " << sum << "\n"
        << " Decaying system p4 = " << utils::print::P4AsString(&pd);
-
-     // clean-up and return
-     delete [] mass;
      return false;
   }
 
+  RandomGen * rnd = RandomGen::Instance();
+
   // Get the maximum weight
-  //double wmax = fPhaseSpaceGenerator.GetWtMax();
-  double wmax = -1;
-  for(int idec=0; idec<200; idec++) {
-     double w = fPhaseSpaceGenerator.Generate();
-     if(reweight) { w *= this->ReWeightPt2(pdgv); }
-     wmax = TMath::Max(wmax,w);
-  }
+  double wmax = this->MaxPhaseSpaceWeight(nbodies, pd.Mag(), sum, reweight);
   assert(wmax>0);
 
   LOG("KNOHad", pNOTICE)
@@ -991,13 +1155,11 @@ bool AGKYLowW2019::PhaseSpaceDecay(
 
   // Generate a weighted or unweighted decay
 
-  RandomGen * rnd = RandomGen::Instance();
-
   if(fGenerateWeighted)
   {
     // *** generating weighted decays ***
-    double w = fPhaseSpaceGenerator.Generate();
-    if(reweight) { w *= this->ReWeightPt2(pdgv); }
+    double w = fPhaseSpaceGenerator.Generate(rnd->RndHadro());
+    if(reweight) { w *= this->ReWeightPt2(nbodies); }
     fWeight *= TMath::Max(w/wmax, 1.);
   }
   else
@@ -1012,19 +1174,21 @@ bool AGKYLowW2019::PhaseSpaceDecay(
        itry++;
 
        if(itry>kMaxUnweightDecayIterations) {
-         // report, clean-up and return
+         // report and return
          LOG("KNOHad", pWARN)
              << "Couldn't generate an unweighted phase space decay after "
              << itry << " attempts";
-         delete [] mass;
          return false;
        }
 
-       double w  = fPhaseSpaceGenerator.Generate();
-       if(reweight) { w *= this->ReWeightPt2(pdgv); }
+       double w  = fPhaseSpaceGenerator.Generate(rnd->RndHadro());
+       if(reweight) { w *= this->ReWeightPt2(nbodies); }
        if(w > wmax) {
           LOG("KNOHad", pWARN)
-           << "Decay weight = " << w << " > max decay weight = " << wmax;
+           << "Decay weight = " << w << " > max decay weight = " << wmax
+           << " - Raising max weight";
+          this->SetMaxPhaseSpaceWeight(nbodies, pd.Mag(), sum, reweight, w);
+          wmax = 2.3 * w;
        }
        double gw = wmax * rnd->RndHadro().Rndm();
        accept_decay = (gw<=w);
@@ -1037,7 +1201,6 @@ bool AGKYLowW2019::PhaseSpaceDecay(
        if(return_after_not_accepted_decay && !accept_decay) {
            LOG("KNOHad", pWARN)
              << "Was instructed to return after a not-accepted decay";
-           delete [] mass;
            return false;
        }
      }
@@ -1045,41 +1208,76 @@ bool AGKYLowW2019::PhaseSpaceDecay(
 
   // Insert final state products into a TClonesArray of GHepParticle's
 
-  i=0;
-  for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
-
-     //-- current PDG code
-     int pdgc = *pdg_iter;
-
-     //-- get the 4-momentum of the i-th final state particle
-     TLorentzVector * p4fin = fPhaseSpaceGenerator.GetDecay(i);
-
-     new ( plist[offset+i] ) GHepParticle(
-           pdgc,                 /* PDG Code                         */
-           kIStStableFinalState, /* GHepStatus_t                     */
-          -1,                    /* first mother particle            */
-          -1,                    /* second mother particle           */
-          -1,                    /* first daughter particle          */
-          -1,                    /* last daughter particle           */
-           p4fin->Px(),          /* 4-momentum: px component         */
-           p4fin->Py(),          /* 4-momentum: py component         */
-           p4fin->Pz(),          /* 4-momentum: pz component         */
-           p4fin->Energy(),      /* 4-momentum: E  component         */
-           0,                    /* production vertex 4-vector: vx   */
-           0,                    /* production vertex 4-vector: vy   */
-           0,                    /* production vertex 4-vector: vz   */
-           0                     /* production vertex 4-vector: time */
-        );
-     i++;
+  for(int i = 0; i < nbodies; i++) {
+     this->SetParticle(plist, offset+i, pdgv[offset+i],
+                       fPhaseSpaceGenerator.GetDecay(i));
   }
 
-  // Clean-up
-  delete [] mass;
-
   return true;
 }
 //____________________________________________________________________________
-double AGKYLowW2019::ReWeightPt2(const PDGCodeList & pdgcv) const
+long AGKYLowW2019::MaxPhaseSpaceWeightKey(
+          int nbodies, double M, double mass_sum, bool reweight) const
+{
+  long mbin = (long) TMath::Floor(M        / kMaxWeightBin);
+  long sbin = (long) TMath::Floor(mass_sum / kMaxWeightBin);
+
+  return ((mbin * 10000 + sbin) * (NBodyPhaseSpace::kMaxBodies+1) + nbodies) * 2
+          + (reweight ? 1 : 0);
+}
+//____________________________________________________________________________
+double AGKYLowW2019::MaxPhaseSpaceWeight(
+          int nbodies, double M, double mass_sum, bool reweight) const
+{
+// Returns the max weight for the phase space decay currently set in the
+// phase space generator. It is estimated once per bin of multiplicity,
+// decaying system mass and total decay product mass, from weighted decays
+// of the current system, rather than once per decay.
+
+  long key = this->MaxPhaseSpaceWeightKey(nbodies, M, mass_sum, reweight);
+
+  map<long, double>::const_iterator iter = fMaxPhaseSpaceWeights.find(key);
+  if(iter != fMaxPhaseSpaceWeights.end()) return iter->second;
+
+  RandomGen * rnd = RandomGen::Instance();
+
+  double wmax = -1;
+  for(int idec=0; idec<kNMaxWeightSamples; idec++) {
+     double w = fPhaseSpaceGenerator.Generate(rnd->RndHadro());
+     if(reweight) { w *= this->ReWeightPt2(nbodies); }
+     wmax = TMath::Max(wmax,w);
+  }
+
+  LOG("KNOHad", pINFO)
+     << "Max phase space gen. weight for N = " << nbodies << ", M = " << M
+     << " GeV, total mass = " << mass_sum << " GeV: " << wmax;
+
+  fMaxPhaseSpaceWeights[key] = wmax;
+  return wmax;
+}
+//____________________________________________________________________________
+void AGKYLowW2019::SetMaxPhaseSpaceWeight(
+  int nbodies, double M, double mass_sum, bool reweight, double wmax) const
+{
+  long key = this->MaxPhaseSpaceWeightKey(nbodies, M, mass_sum, reweight);
+  fMaxPhaseSpaceWeights[key] = wmax;
+}
+//____________________________________________________________________________
+void AGKYLowW2019::SetParticle(TClonesArray & plist,
+                 int slot, int pdgc, const TLorentzVector & p4) const
+{
+// Sets the particle at the input slot of the particle list, re-using the
+// particle possibly left there by a previous call
+
+  GHepParticle * particle = (GHepParticle *) plist.ConstructedAt(slot);
+  particle->Reset();
+  particle->SetPdgCode  (pdgc);
+  particle->SetStatus   (kIStStableFinalState);
+  particle->SetMomentum (p4);
+  particle->SetPosition (0,0,0,0);
+}
+//____________________________________________________________________________
+double AGKYLowW2019::ReWeightPt2(int nbodies) const
 {
 // Phase Space Decay re-weighting to reproduce exp(-pT2/<pT2>) pion pT2
 // distributions.
@@ -1088,13 +1286,13 @@ double AGKYLowW2019::ReWeightPt2(const PDGCodeList & pdgcv) const
 
   double w = 1;
 
-  for(unsigned int i = 0; i < pdgcv.size(); i++) {
+  for(int i = 0; i < nbodies; i++) {
 
      //int pdgc = pdgcv[i];
      //if(pdgc!=kPdgPiP&&pdgc!=kPdgPiM) continue;
 
-     TLorentzVector * p4 = fPhaseSpaceGenerator.GetDecay(i);
-     double pt2 = TMath::Power(p4->Px(),2) + TMath::Power(p4->Py(),2);
+     const TLorentzVector & p4 = fPhaseSpaceGenerator.GetDecay(i);
+     double pt2 = TMath::Power(p4.Px(),2) + TMath::Power(p4.Py(),2);
      double wi  = TMath::Exp(-fPhSpRwA*TMath::Sqrt(pt2));
      //double wi = (9.41 * TMath::Landau(pt2,0.24,0.12));
 
@@ -1103,19 +1301,18 @@ double AGKYLowW2019::ReWeightPt2(const PDGCodeList & pdgcv) const
   return w;
 }
 //____________________________________________________________________________
-PDGCodeList * AGKYLowW2019::GenerateHadronCodes(
-                                   int multiplicity, int maxQ, double W) const
+void AGKYLowW2019::GenerateHadronCodes(
+        int multiplicity, int maxQ, double W, PDGCodeList & pdgc) const
 {
 // Selection of fragments (identical as in NeuGEN).
+// The final state hadron PDG codes are set in the input list.
 
   // Get PDG library and rnd num generator
   PDGLibrary * pdg = PDGLibrary::Instance();
   RandomGen * rnd = RandomGen::Instance();
 
-  // Create vector to add final state hadron PDG codes
-  bool allowdup=true;
-  PDGCodeList * pdgc = new PDGCodeList(allowdup);
-  //pdgc->reserve(multiplicity);
+  // Clear the list of final state hadron PDG codes
+  pdgc.clear();
   int hadrons_to_add = multiplicity;
 
   //
@@ -1123,7 +1320,7 @@ PDGCodeList * AGKYLowW2019::GenerateHadronCodes(
   //
 
   int baryon_code = this->GenerateBaryonPdgCode(multiplicity, maxQ, W);
-  pdgc->push_back(baryon_code);
+  pdgc.push_back(baryon_code);
 
   bool baryon_is_strange = (baryon_code == kPdgSigmaP ||
                             baryon_code == kPdgLambda ||
@@ -1136,7 +1333,7 @@ PDGCodeList * AGKYLowW2019::GenerateHadronCodes(
   if(baryon_chg_is_pos) maxQ -= 1;
   if(baryon_chg_is_neg) maxQ += 1;
   hadrons_to_add--;
-  W -= pdg->Find( (*pdgc)[0] )->Mass();
+  W -= pdg->Find( pdgc[0] )->Mass();
 
   //
   // Assign remaining hadrons up to n = multiplicity
@@ -1151,7 +1348,7 @@ PDGCodeList * AGKYLowW2019::GenerateHadronCodes(
         if(multiplicity == 2) {
            if(maxQ == 1) {
               LOG("KNOHad", pDEBUG) << " -> Adding a K+";
-              pdgc->push_back( kPdgKP );
+              pdgc.push_back( kPdgKP );
 
               // update n-of-hadrons to add, avail. shower charge & invariant mass
               maxQ -= 1;
@@ -1160,7 +1357,7 @@ PDGCodeList * AGKYLowW2019::GenerateHadronCodes(
            }
            else if(maxQ == 0) {
               LOG("KNOHad", pDEBUG) << " -> Adding a K0";
-              pdgc->push_back( kPdgK0 );
+              pdgc.push_back( kPdgK0 );
 
               // update n-of-hadrons to add, avail. shower charge & invariant mass
               hadrons_to_add--;
@@ -1171,7 +1368,7 @@ PDGCodeList * AGKYLowW2019::GenerateHadronCodes(
         //only two particles left to balance charge
         else if(multiplicity == 3 && maxQ == 2) {
            LOG("KNOHad", pDEBUG) << " -> Adding a K+";
-           pdgc->push_back( kPdgKP );
+           pdgc.push_back( kPdgKP );
 
            // update n-of-hadrons to add, avail. shower charge & invariant mass
            maxQ -= 1;
@@ -1180,7 +1377,7 @@ PDGCodeList * AGKYLowW2019::GenerateHadronCodes(
         }
         else if(multiplicity == 3 && maxQ == -1) { //adding K+ makes it impossible to balance charge
            LOG("KNOHad", pDEBUG) << " -> Adding a K0";
-           pdgc->push_back( kPdgK0 );
+           pdgc.push_back( kPdgK0 );
 
            // update n-of-hadrons to add, avail. shower charge & invariant mass
            hadrons_to_add--;
@@ -1192,7 +1389,7 @@ PDGCodeList * AGKYLowW2019::GenerateHadronCodes(
            double y = rnd->RndHadro().Rndm();
            if(y < 0.5) {
               LOG("KNOHad", pDEBUG) <<" -> Adding a K+";
-              pdgc->push_back( kPdgKP );
+              pdgc.push_back( kPdgKP );
 
               // update n-of-hadrons to add, avail. shower charge & invariant mass
               maxQ -= 1;
@@ -1201,7 +1398,7 @@ PDGCodeList * AGKYLowW2019::GenerateHadronCodes(
            }
            else {
               LOG("KNOHad", pDEBUG) <<" -> Adding a K0";
-              pdgc->push_back( kPdgK0 );
+              pdgc.push_back( kPdgK0 );
 
               // update n-of-hadrons to add, avail. shower charge & invariant mass
               hadrons_to_add--;
@@ -1216,7 +1413,7 @@ PDGCodeList * AGKYLowW2019::GenerateHadronCodes(
      if (maxQ < 0) {
         // Need more negative charge
         LOG("KNOHad", pDEBUG) << "Need more negative charge -> Adding a pi-";
-        pdgc->push_back( kPdgPiM );
+        pdgc.push_back( kPdgPiM );
 
         // update n-of-hadrons to add, avail. shower charge & invariant mass
         maxQ += 1;
@@ -1227,7 +1424,7 @@ PDGCodeList * AGKYLowW2019::GenerateHadronCodes(
      } else if (maxQ > 0) {
         // Need more positive charge
         LOG("KNOHad", pDEBUG) << "Need more positive charge -> Adding a pi+";
-        pdgc->push_back( kPdgPiP );
+        pdgc.push_back( kPdgPiP );
 
         // update n-of-hadrons to add, avail. shower charge & invariant mass
         maxQ -= 1;
@@ -1265,7 +1462,7 @@ PDGCodeList * AGKYLowW2019::GenerateHadronCodes(
 
         LOG("KNOHad", pDEBUG)
                   << "Odd number of hadrons left to add -> Adding a pi0";
-        pdgc->push_back( kPdgPi0 );
+        pdgc.push_back( kPdgPi0 );
 
         // update n-of-hadrons to add & available invariant mass
         hadrons_to_add--;
@@ -1284,8 +1481,8 @@ PDGCodeList * AGKYLowW2019::GenerateHadronCodes(
          // Add a pi0 pair
          if (x >= 0 && x < fPpi0) {
             LOG("KNOHad", pDEBUG) << " -> Adding a pi0pi0 pair";
-            pdgc->push_back( kPdgPi0 );
-            pdgc->push_back( kPdgPi0 );
+            pdgc.push_back( kPdgPi0 );
+            pdgc.push_back( kPdgPi0 );
             hadrons_to_add -= 2; // update the number of hadrons to add
             W -= M2pi0; // update the available invariant mass
          }
@@ -1294,8 +1491,8 @@ PDGCodeList * AGKYLowW2019::GenerateHadronCodes(
          else if (x < fPpi0 + fPpic) {
             if(W >= M2pic) {
                 LOG("KNOHad", pDEBUG) << " -> Adding a pi+pi- pair";
-                pdgc->push_back( kPdgPiP );
-                pdgc->push_back( kPdgPiM );
+                pdgc.push_back( kPdgPiP );
+                pdgc.push_back( kPdgPiM );
                 hadrons_to_add -= 2; // update the number of hadrons to add
                 W -= M2pic; // update the available invariant mass
             } else {
@@ -1308,8 +1505,8 @@ PDGCodeList * AGKYLowW2019::GenerateHadronCodes(
          else if (x < fPpi0 + fPpic + fPKc) {
             if(W >= M2Kc) {
                 LOG("KNOHad", pDEBUG) << " -> Adding a K+K- pair";
-                pdgc->push_back( kPdgKP );
-                pdgc->push_back( kPdgKM );
+                pdgc.push_back( kPdgKP );
+                pdgc.push_back( kPdgKM );
                 hadrons_to_add -= 2; // update the number of hadrons to add
                 W -= M2Kc; // update the available invariant mass
             } else {
@@ -1322,8 +1519,8 @@ PDGCodeList * AGKYLowW2019::GenerateHadronCodes(
          else if (x <= fPpi0 + fPpic + fPKc + fPK0) {
             if( W >= M2K0 ) {
                 LOG("KNOHad", pDEBUG) << " -> Adding a K0 K0bar pair";
-                pdgc->push_back( kPdgK0     );
-                pdgc->push_back( kPdgAntiK0 );
+                pdgc.push_back( kPdgK0     );
+                pdgc.push_back( kPdgAntiK0 );
                 hadrons_to_add -= 2; // update the number of hadrons to add
                 W -= M2K0; // update the available invariant mass
             } else {
@@ -1336,8 +1533,8 @@ PDGCodeList * AGKYLowW2019::GenerateHadronCodes(
 	 else if (x <= fPpi0 + fPpic + fPKc + fPK0 + fPpi0eta) {
             if( W >= Mpi0eta ) {
                 LOG("KNOHad", pDEBUG) << " -> Adding a Pi0-Eta pair";
-                pdgc->push_back( kPdgPi0 );
-                pdgc->push_back( kPdgEta );
+                pdgc.push_back( kPdgPi0 );
+                pdgc.push_back( kPdgEta );
                 hadrons_to_add -= 2; // update the number of hadrons to add
                 W -= Mpi0eta; // update the available invariant mass
             } else {
@@ -1350,8 +1547,8 @@ PDGCodeList * AGKYLowW2019::GenerateHadronCodes(
 	 else if(x <= fPpi0 + fPpic + fPKc + fPK0 + fPpi0eta + fPeta) {
 	   if( W >= M2Eta ){
 	     LOG("KNOHad", pDEBUG) << " -> Adding a eta-eta pair";
-	     pdgc->push_back( kPdgEta );
-	     pdgc->push_back( kPdgEta );
+	     pdgc.push_back( kPdgEta );
+	     pdgc.push_back( kPdgEta );
 	     hadrons_to_add -= 2; // update the number of hadrons to add
 	     W -= M2Eta; // update the available invariant mass
 	   }  else {
@@ -1373,8 +1570,6 @@ PDGCodeList * AGKYLowW2019::GenerateHadronCodes(
 
      } // while there are more hadrons to add
   } // if charge is balanced (maxQ == 0)
-
-  return pdgc;
 }
 //____________________________________________________________________________
 int AGKYLowW2019::GenerateBaryonPdgCode(
@@ -1571,6 +1766,47 @@ void AGKYLowW2019::ApplyRijk( const Interaction * interaction,
   //
   if(!mp) return;
 
+  double R2=1., R3=1.;
+  this->LowMultScaling(interaction, R2, R3);
+
+  //
+  // Apply to the multiplicity probability distribution
+  //
+
+  int nbins = mp->GetNbinsX();
+  for(int i = 1; i <= nbins; i++) {
+    int n = TMath::Nint( mp->GetBinCenter(i) );
+
+    double R=1;
+    if      (n==2) R=R2;
+    else if (n==3) R=R3;
+
+    if(n==2 || n==3) {
+      double P   = mp->GetBinContent(i);
+      double Psc = R*P;
+      LOG("Hadronization", pDEBUG)
+	<< "n=" << n << "/ Scaling factor R = "
+	<< R << "/ P " << P << " --> " << Psc;
+      mp->SetBinContent(i, Psc);
+    }
+    if(n>3) break;
+  }
+
+  // renormalize the histogram?
+  if(norm) {
+    double histo_norm = mp->Integral("width");
+    if(histo_norm>0) mp->Scale(1.0/histo_norm);
+  }
+}
+//____________________________________________________________________________
+void AGKYLowW2019::LowMultScaling( const Interaction * interaction,
+                                  double & R2, double & R3 ) const
+{
+  // Get the NEUGEN multiplicity probability scaling factors R2, R3
+  //
+  R2=1.;
+  R3=1.;
+
   const InitialState & init_state = interaction->InitState();
   int probe_pdg = init_state.ProbePdg();
   int nuc_pdg   = init_state.Tgt().HitNucPdg();
@@ -1582,12 +1818,6 @@ void AGKYLowW2019::ApplyRijk( const Interaction * interaction,
   // EDIT
   bool is_dm = proc_info.IsDarkMatter();
 
-  //
-  // get the R2, R3 factors
-  //
-
-  double R2=1., R3=1.;
-
   // weak CC or NC case
   // EDIT
   if(is_CC || is_NC || is_dm) {
@@ -1644,35 +1874,6 @@ void AGKYLowW2019::ApplyRijk( const Interaction * interaction,
 	      << "Invalid initial state: " << init_state;
 	  }
   }//em?
-
-  //
-  // Apply to the multiplicity probability distribution
-  //
-
-  int nbins = mp->GetNbinsX();
-  for(int i = 1; i <= nbins; i++) {
-    int n = TMath::Nint( mp->GetBinCenter(i) );
-
-    double R=1;
-    if      (n==2) R=R2;
-    else if (n==3) R=R3;
-
-    if(n==2 || n==3) {
-      double P   = mp->GetBinContent(i);
-      double Psc = R*P;
-      LOG("Hadronization", pDEBUG)
-	<< "n=" << n << "/ Scaling factor R = "
-	<< R << "/ P " << P << " --> " << Psc;
-      mp->SetBinContent(i, Psc);
-    }
-    if(n>3) break;
-  }
-
-  // renormalize the histogram?
-  if(norm) {
-    double histo_norm = mp->Integral("width");
-    if(histo_norm>0) mp->Scale(1.0/histo_norm);
-  }
 }
 //____________________________________________________________________________
 double AGKYLowW2019::Wmin(void) const
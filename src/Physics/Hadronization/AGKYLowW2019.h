@@ -41,13 +41,19 @@
 #ifndef _KNO_HADRONIZATION_H_
 #define _KNO_HADRONIZATION_H_
 
-#include <TGenPhaseSpace.h>
+#include <map>
+#include <vector>
 
 #include "Physics/Decay/Decayer.h"
 #include "Framework/EventGen/EventRecordVisitorI.h"
+#include "Framework/Numerical/NBodyPhaseSpace.h"
+#include "Framework/ParticleData/PDGCodeList.h"
 
+using std::map;
+using std::vector;
 
 class TF1;
+class TClonesArray;
 
 namespace genie {
 
@@ -77,32 +83,46 @@ private:
   void           LoadConfig            (void);
   void           Initialize            (void)                                        const;
   TClonesArray * Hadronize             (const Interaction* )                         const;
+  bool           Hadronize             (const Interaction*, TClonesArray & plist)    const;
   double         Weight                (void)                                        const;
   PDGCodeList *  SelectParticles       (const Interaction*)                          const;
+  bool           SelectParticles       (const Interaction*, PDGCodeList & pdgv)      const;
   TH1D *         MultiplicityProb      (const Interaction*, Option_t* opt = "")      const;
+  int            MultiplicityCDF       (const Interaction*, double * cdf)            const;
   bool           AssertValidity        (const Interaction * i)                       const;
-  PDGCodeList *  GenerateHadronCodes   (int mult, int maxQ, double W)                const;
+  void           GenerateHadronCodes   (int mult, int maxQ, double W, PDGCodeList & pdgv) const;
   int            GenerateBaryonPdgCode (int mult, int maxQ, double W)                const;
   int            HadronShowerCharge    (const Interaction * )                        const;
   double         KNO                   (int nu, int nuc, double z)                   const;
   double         AverageChMult         (int nu, int nuc, double W)                   const;
   void           HandleDecays          (TClonesArray * particle_list)                const;
-  double         ReWeightPt2           (const PDGCodeList & pdgcv)                   const;
+  double         ReWeightPt2           (int nbodies)                                 const;
   double         MaxMult               (const Interaction * i)                       const;
   TH1D *         CreateMultProbHist    (double maxmult)                              const;
   void           ApplyRijk             (const Interaction * i, bool norm, TH1D * mp) const;
+  void           LowMultScaling        (const Interaction * i, double & R2, double & R3) const;
+  int            KNOClass              (int nu, int nuc)                             const;
+  void           BuildMultTables       (void);
   double         Wmin                  (void)                                        const;
 
-  TClonesArray* DecayMethod1    (double W, const PDGCodeList & pdgv, bool reweight_decays) const;
-  TClonesArray* DecayMethod2    (double W, const PDGCodeList & pdgv, bool reweight_decays) const;
-  TClonesArray* DecayBackToBack (double W, const PDGCodeList & pdgv) const;
+  bool DecayMethod1    (TClonesArray & pl, double W, const PDGCodeList & pdgv, bool reweight_decays) const;
+  bool DecayMethod2    (TClonesArray & pl, double W, const PDGCodeList & pdgv, bool reweight_decays) const;
+  bool DecayBackToBack (TClonesArray & pl, double W, const PDGCodeList & pdgv) const;
 
   bool PhaseSpaceDecay(
-         TClonesArray & pl, TLorentzVector & pd,
+         TClonesArray & pl, const TLorentzVector & pd,
 	   const PDGCodeList & pdgv, int offset=0, bool reweight=false) const;
 
-  mutable TGenPhaseSpace fPhaseSpaceGenerator; ///< a phase space generator
-  mutable double         fWeight;              ///< weight for generated event
+  long   MaxPhaseSpaceWeightKey (int n, double M, double mass_sum, bool reweight)              const;
+  double MaxPhaseSpaceWeight    (int n, double M, double mass_sum, bool reweight)              const;
+  void   SetMaxPhaseSpaceWeight (int n, double M, double mass_sum, bool reweight, double wmax) const;
+  void   SetParticle            (TClonesArray & pl, int slot, int pdgc, const TLorentzVector & p4) const;
+
+  mutable NBodyPhaseSpace  fPhaseSpaceGenerator;  ///< a phase space generator
+  mutable map<long,double> fMaxPhaseSpaceWeights; ///< max phase space decay weights, per (multiplicity, mass) bin
+  mutable PDGCodeList      fHadronCodes;          ///< hadron PDG codes of the event being hadronized
+  mutable double           fWeight;               ///< weight for generated event
+  TClonesArray *           fParticleBuffer;       ///< particle list re-used by ProcessEventRecord()
 
   // Configuration parameters
   // Note: additional configuration parameters common to all hadronizers
@@ -140,6 +160,10 @@ private:
   TF1 *    fBaryonXFpdf;         ///< baryon xF PDF
   TF1 *    fBaryonPT2pdf;        ///< baryon pT^2 PDF
 
+  // Multiplicity probability tables (see BuildMultTables())
+  vector<double> fMultTable;     ///< unnormalized P(n), n=2..18, per initial state (vp,vn,vbp,vbn) and W node
+  int            fMultTableNW;   ///< number of W nodes
+
   // nuegen parameters
   double   fWcut;      ///< Rijk applied for W<Wcut (see DIS/RES join scheme)
   double   fRvpCCm2;   ///< Rijk: vp,  CC, multiplicity = 2
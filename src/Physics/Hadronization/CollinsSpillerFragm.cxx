@@ -15,13 +15,15 @@ using namespace genie;
 
 //___________________________________________________________________________
 CollinsSpillerFragm::CollinsSpillerFragm() :
-FragmentationFunctionI("genie::CollinsSpillerFragm")
+FragmentationFunctionI("genie::CollinsSpillerFragm"),
+fFunc(0)
 {
 
 }
 //___________________________________________________________________________
 CollinsSpillerFragm::CollinsSpillerFragm(string config) :
-FragmentationFunctionI("genie::CollinsSpillerFragm", config)
+FragmentationFunctionI("genie::CollinsSpillerFragm", config),
+fFunc(0)
 {
 
 }
@@ -42,8 +44,9 @@ double CollinsSpillerFragm::Value(double z) const
 double CollinsSpillerFragm::GenerateZ(void) const
 {
 // Return a random number using the fragmentation function as PDF
+// (inverting its CDF, tabulated at configuration)
 
-  return fFunc->GetRandom();
+  return this->SampleZ();
 }
 //___________________________________________________________________________
 void CollinsSpillerFragm::Configure(const Registry & config)
@@ -60,6 +63,7 @@ void CollinsSpillerFragm::Configure(string config)
 //___________________________________________________________________________
 void CollinsSpillerFragm::BuildFunction(void)
 {
+  delete fFunc;
   fFunc = new TF1("fFunc",genie::utils::frgmfunc::collins_spiller_func,0,1,2);
 
   fFunc->SetParNames("Norm","Epsilon");
@@ -80,5 +84,7 @@ void CollinsSpillerFragm::BuildFunction(void)
     N = 1./I;
   }
   fFunc->SetParameters(N,e);
+
+  this->BuildZSampler();
 }
 //___________________________________________________________________________
@@ -8,10 +8,24 @@
 */
 //____________________________________________________________________________
 
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
 #include "Physics/Hadronization/FragmentationFunctionI.h"
 
 using namespace genie;
 
+namespace {
+  // FragmentationFunctionI::Value() as a ROOT::Math function of z
+  class FragmFuncZ : public ROOT::Math::IBaseFunctionOneDim {
+  public:
+    FragmFuncZ(const FragmentationFunctionI & f) : fF(f) { }
+    ROOT::Math::IBaseFunctionOneDim * Clone (void) const { return new FragmFuncZ(fF); }
+  private:
+    double DoEval (double z) const { return fF.Value(z); }
+    const FragmentationFunctionI & fF;
+  };
+}
+
 //___________________________________________________________________________
 FragmentationFunctionI::FragmentationFunctionI() :
 Algorithm()
@@ -36,3 +50,18 @@ FragmentationFunctionI::~FragmentationFunctionI()
 
 }
 //___________________________________________________________________________
+void FragmentationFunctionI::BuildZSampler(void)
+{
+  FragmFuncZ func(*this);
+  bool ok = fZSampler.Build(func, 0., 1.);
+  if(!ok) {
+    LOG("CharmHad", pERROR)
+      << this->Id().Key() << ": no positive integral over z in [0,1]";
+  }
+}
+//___________________________________________________________________________
+double FragmentationFunctionI::SampleZ(void) const
+{
+  return fZSampler.Sample(RandomGen::Instance()->RndHadro().Rndm());
+}
+//___________________________________________________________________________
@@ -7,6 +7,10 @@
           Defines the FragmentationFunctionI interface to be implemented by
           any algorithmic class implementing a fragmentation function.
 
+          Concrete fragmentation functions build, at their configuration, an
+          inverse-CDF sampler of z (BuildZSampler()) with which GenerateZ()
+          generates z without any integration and re-entrantly.
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -21,6 +25,7 @@
 #define _FRAGMENTATION_FUNCTION_I_H_
 
 #include "Framework/Algorithm/Algorithm.h"
+#include "Framework/Numerical/InverseCDFSampler.h"
 
 namespace genie {
 
@@ -35,11 +40,19 @@ public:
   virtual double Value     (double z) const = 0;
   virtual double GenerateZ (void)     const = 0;
 
+  //! the inverse-CDF sampler of z, built from Value() at configuration
+  const InverseCDFSampler & ZSampler (void) const { return fZSampler; }
+
 protected:
 
   FragmentationFunctionI();
   FragmentationFunctionI(string name);
   FragmentationFunctionI(string name, string config);
+
+  void   BuildZSampler (void);  ///< tabulates Value() over [0,1]
+  double SampleZ       (void) const; ///< z from the ZSampler(), using the hadronization random stream
+
+  InverseCDFSampler fZSampler;
 };
 
 }      // genie namespace
@@ -17,13 +17,15 @@ using namespace genie;
 
 //___________________________________________________________________________
 PetersonFragm::PetersonFragm() :
-FragmentationFunctionI("genie::PetersonFragm")
+FragmentationFunctionI("genie::PetersonFragm"),
+fFunc(0)
 {
 
 }
 //___________________________________________________________________________
 PetersonFragm::PetersonFragm(string config) :
-FragmentationFunctionI("genie::PetersonFragm", config)
+FragmentationFunctionI("genie::PetersonFragm", config),
+fFunc(0)
 {
   this->BuildFunction();
 }
@@ -44,8 +46,9 @@ double PetersonFragm::Value(double z) const
 double PetersonFragm::GenerateZ(void) const
 {
 // Return a random number using the fragmentation function as PDF
+// (inverting its CDF, tabulated at configuration)
 
-  return fFunc->GetRandom();
+  return this->SampleZ();
 }
 //___________________________________________________________________________
 void PetersonFragm::Configure(const Registry & config)
@@ -62,6 +65,7 @@ void PetersonFragm::Configure(string config)
 //___________________________________________________________________________
 void PetersonFragm::BuildFunction(void)
 {
+  delete fFunc;
   fFunc = new TF1("fFunc",genie::utils::frgmfunc::peterson_func,0,1,2);
 
   fFunc->SetParNames("Norm","Epsilon");
@@ -88,5 +92,7 @@ void PetersonFragm::BuildFunction(void)
     N = 1./I;
   }
   fFunc->SetParameters(N,e);
+
+  this->BuildZSampler();
 }
 //___________________________________________________________________________
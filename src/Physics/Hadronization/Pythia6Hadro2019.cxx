@@ -23,6 +23,7 @@
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/Utils/KineUtils.h"
+#include "Framework/Utils/Pythia6Gate.h"
 #include "Physics/Hadronization/Pythia6Hadro2019.h"
 
 #ifdef __GENIE_PYTHIA6_ENABLED__
@@ -64,6 +65,8 @@ void Pythia6Hadro2019::ProcessEventRecord(GHepRecord *
 ) const
 {
 #ifdef __GENIE_PYTHIA6_ENABLED__
+  // PYTHIA6 (and this module's per-event state) is shared by all threads
+  Pythia6Gate::Guard pythia6_guard;
   PythiaBaseHadro2019::ProcessEventRecord(event);
 #else
   LOG("Pythia6Had", pFATAL)
@@ -310,6 +313,7 @@ void Pythia6Hadro2019::LoadConfig(void)
   PythiaBaseHadro2019::LoadConfig();
 
 #ifdef __GENIE_PYTHIA6_ENABLED__
+  Pythia6Gate::Guard pythia6_guard;
   fPythia->SetPARJ(2,  fSSBarSuppression       );
   fPythia->SetPARJ(21, fGaussianPt2            );
   fPythia->SetPARJ(23, fNonGaussianPt2Tail     );
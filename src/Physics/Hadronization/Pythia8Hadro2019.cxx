@@ -11,6 +11,10 @@
 */
 //____________________________________________________________________________
 
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+
 #include <RVersion.h>
 #include <TClonesArray.h>
 // Avoid the inclusion of dlfcn.h by Pythia.h that CINT is not able to process
@@ -37,9 +41,22 @@
 #include "Pythia8/Pythia.h"
 #endif
 
+using std::ostringstream;
+
 using namespace genie;
 using namespace genie::constants;
 
+#if defined(__GENIE_PYTHIA8_ENABLED__) && PYTHIA_VERSION_INTEGER >= 8235
+//____________________________________________________________________________
+// Process-wide PYTHIA8 instance whose settings and particle data (read from
+// the PYTHIA8 XML database, the most costly part of the initialization)
+// are copied into the instances used for hadronization
+namespace {
+  std::mutex        gPythia8TemplateMutex;
+  Pythia8::Pythia * gPythia8Template = 0;
+}
+#endif
+
 //____________________________________________________________________________
 Pythia8Hadro2019::Pythia8Hadro2019() :
 PythiaBaseHadro2019("genie::Pythia8Hadro2019")
@@ -56,7 +73,10 @@ PythiaBaseHadro2019("genie::Pythia8Hadro2019", config)
 Pythia8Hadro2019::~Pythia8Hadro2019()
 {
 #ifdef __GENIE_PYTHIA8_ENABLED__
-  delete fPythia;
+  map<string, Pythia8::Pythia *>::iterator it = fPythiaInstances.begin();
+  for( ; it != fPythiaInstances.end(); ++it) delete it->second;
+  fPythiaInstances.clear();
+  fPythia = 0;
 #endif
 }
 //____________________________________________________________________________
@@ -67,7 +87,11 @@ void Pythia8Hadro2019::ProcessEventRecord(GHepRecord *
 ) const
 {
 #ifdef __GENIE_PYTHIA8_ENABLED__
-  PythiaBaseHadro2019::ProcessEventRecord(event);
+  // each thread hadronizes with its own instance (and PYTHIA8)
+  const Pythia8Hadro2019 * hadronizer =
+     dynamic_cast<const Pythia8Hadro2019 *> (fThreadInstances.Get(this));
+  if(!hadronizer) hadronizer = this;
+  hadronizer->PythiaBaseHadro2019::ProcessEventRecord(event);
 #else
   LOG("Pythia8Had", pFATAL)
     << "Calling GENIE/PYTHIA8 hadronization modules without enabling PYTHIA8";
@@ -123,14 +147,16 @@ bool Pythia8Hadro2019::Hadronize(GHepRecord *
   LOG("Pythia8Had", pDEBUG) << "Appending quark/diquark into the PYTHIA8 event";
   fPythia->event.append(fLeadingQuark,   23, 101, 0, 0., 0., pzAcm, eA, mA);
   fPythia->event.append(fRemnantDiquark, 23, 0, 101, 0., 0., pzBcm, eB, mB);
-  fPythia->event.list();
 
-  LOG("Pythia8Had", pDEBUG) << "Generating next PYTHIA8 event";
-  fPythia->next();
+  LOG("Pythia8Had", pDEBUG) << "Fragmenting the q-qq string";
+  if(!fPythia->forceHadronLevel()) {
+    LOG("Pythia8Had", pWARN) << "PYTHIA8 string fragmentation failed";
+    return false;
+  }
 
-  // List the event information
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   fPythia->event.list();
-  fPythia->stat();
+#endif
 
   // Get LUJETS record
   LOG("Pythia8Had", pDEBUG) << "Copying PYTHIA8 event record into GENIE's";
@@ -334,42 +360,95 @@ void Pythia8Hadro2019::LoadConfig(void)
   PythiaBaseHadro2019::LoadConfig();
 
 #ifdef __GENIE_PYTHIA8_ENABLED__
-  fPythia->settings.parm("StringFlav:probStoUD",         fSSBarSuppression);
-  fPythia->settings.parm("Diffraction:primKTwidth",      fGaussianPt2);
-  fPythia->settings.parm("StringPT:enhancedFraction",    fNonGaussianPt2Tail);
-  fPythia->settings.parm("StringFragmentation:stopMass", fRemainingECutoff);
-  fPythia->settings.parm("StringFlav:probQQtoQ",         fDiQuarkSuppression);
-  fPythia->settings.parm("StringFlav:mesonUDvector",     fLightVMesonSuppression);
-  fPythia->settings.parm("StringFlav:mesonSvector",      fSVMesonSuppression);
-  fPythia->settings.parm("StringZ:aLund",                fLunda);
-  fPythia->settings.parm("StringZ:bLund",                fLundb);
-  fPythia->settings.parm("StringZ:aExtraDiquark",        fLundaDiq);
-
-  fPythia->init(); // needed again to read the above?
+  // reuse the instance initialized for these parameters, if any
+  string key = this->FragmentationKey();
+  map<string, Pythia8::Pythia *>::const_iterator iter = fPythiaInstances.find(key);
+  if(iter != fPythiaInstances.end()) {
+    LOG("Pythia8Had", pINFO) << "Reusing initialized PYTHIA8 instance";
+    fPythia = iter->second;
+  }
+  else {
+    fPythia = this->NewPythia();
+
+    fPythia->settings.parm("StringFlav:probStoUD",         fSSBarSuppression);
+    fPythia->settings.parm("Diffraction:primKTwidth",      fGaussianPt2);
+    fPythia->settings.parm("StringPT:enhancedFraction",    fNonGaussianPt2Tail);
+    fPythia->settings.parm("StringFragmentation:stopMass", fRemainingECutoff);
+    fPythia->settings.parm("StringFlav:probQQtoQ",         fDiQuarkSuppression);
+    fPythia->settings.parm("StringFlav:mesonUDvector",     fLightVMesonSuppression);
+    fPythia->settings.parm("StringFlav:mesonSvector",      fSVMesonSuppression);
+    fPythia->settings.parm("StringZ:aLund",                fLunda);
+    fPythia->settings.parm("StringZ:bLund",                fLundb);
+    fPythia->settings.parm("StringZ:aExtraDiquark",        fLundaDiq);
+
+    fPythia->init();
+
+    fPythiaInstances[key] = fPythia;
+  }
 
 #endif
 
+  // other threads need instances with the new configuration
+  fThreadInstances.Reset();
+
   LOG("Pythia8Had", pDEBUG) << this->GetConfig();
 }
 //____________________________________________________________________________
 void Pythia8Hadro2019::Initialize(void)
 {
 #ifdef __GENIE_PYTHIA8_ENABLED__
-  fPythia = new Pythia8::Pythia();
-
-  fPythia->readString("ProcessLevel:all = off");
-  fPythia->readString("Print:quiet      = on");
+  // instances are created and initialized when configured
+  fPythia = 0;
+#endif
+}
+//____________________________________________________________________________
+string Pythia8Hadro2019::FragmentationKey(void) const
+{
+  ostringstream key;
+  key << std::setprecision(17)
+      << fSSBarSuppression       << ";" << fGaussianPt2        << ";"
+      << fNonGaussianPt2Tail     << ";" << fRemainingECutoff   << ";"
+      << fDiQuarkSuppression     << ";" << fLightVMesonSuppression << ";"
+      << fSVMesonSuppression     << ";" << fLunda              << ";"
+      << fLundb                  << ";" << fLundaDiq;
+  return key.str();
+}
+//____________________________________________________________________________
+#ifdef __GENIE_PYTHIA8_ENABLED__
+Pythia8::Pythia * Pythia8Hadro2019::NewPythia(void) const
+{
+#if PYTHIA_VERSION_INTEGER >= 8235
+  Pythia8::Pythia * pythia = 0;
+  {
+    std::lock_guard<std::mutex> lock(gPythia8TemplateMutex);
+    if(!gPythia8Template) {
+      gPythia8Template = new Pythia8::Pythia();
+      gPythia8Template->readString("ProcessLevel:all = off");
+      gPythia8Template->readString("Print:quiet      = on");
+    }
+    pythia = new Pythia8::Pythia(
+       gPythia8Template->settings, gPythia8Template->particleData, false);
+  }
+#else
+  // older PYTHIA8 versions can not copy the settings and particle data
+  Pythia8::Pythia * pythia = new Pythia8::Pythia();
+  pythia->readString("ProcessLevel:all = off");
+  pythia->readString("Print:quiet      = on");
+#endif
 
   // sync GENIE and PYTHIA8 seeds
   RandomGen * rnd = RandomGen::Instance();
   long int seed = rnd->GetSeed();
-  fPythia->readString("Random:setSeed = on");
-  fPythia->settings.mode("Random:seed", seed);
+  // threads with their own random number generator seed their own instance
+  if(rnd->HasThreadGenerator()) {
+    seed = 1 + rnd->RndHadro().Integer(900000000);
+  }
+  pythia->readString("Random:setSeed = on");
+  pythia->settings.mode("Random:seed", seed);
   LOG("Pythia8Had", pINFO)
-    << "PYTHIA8  seed = " << fPythia->settings.mode("Random:seed");
+    << "PYTHIA8  seed = " << pythia->settings.mode("Random:seed");
 
-  fPythia->init();
-
-#endif
+  return pythia;
 }
+#endif
 //____________________________________________________________________________
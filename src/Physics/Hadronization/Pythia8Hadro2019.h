@@ -6,6 +6,20 @@
 \brief    Provides access to the PYTHIA hadronization models. \n
           Is a concrete implementation of the EventRecordVisitorI interface.
 
+          PYTHIA8 instances may not be shared by concurrent threads: each
+          thread hadronizing events gets its own instance of this module (and
+          of PYTHIA8), seeded from its own random number generator if it has
+          one (see RandomGen::SetThreadSeed()).
+
+          The PYTHIA8 instances are initialized once per set of fragmentation
+          parameters and kept: re-configuring the module with parameters it
+          has already seen (eg switching back and forth between tunes) reuses
+          the instance initialized for them. New instances copy the settings
+          and particle data of a process-wide template rather than reading
+          the PYTHIA8 XML database again. Between events only the PYTHIA8
+          event record is reset, and the q-qq string is fragmented with
+          forceHadronLevel().
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -22,6 +36,10 @@
 #ifndef _PYTHIA8_HADRONIZATION_H_
 #define _PYTHIA8_HADRONIZATION_H_
 
+#include <map>
+#include <string>
+
+#include "Framework/Algorithm/ThreadAlgInstances.h"
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Physics/Hadronization/PythiaBaseHadro2019.h"
@@ -30,6 +48,9 @@
 #include "Pythia8/Pythia.h"
 #endif
 
+using std::map;
+using std::string;
+
 namespace genie {
 
 class GHepParticle;
@@ -57,13 +78,19 @@ private:
   void SetDesiredDecayFlags       (void) const;
   void RestoreOriginalDecayFlags  (void) const;
 
-  void LoadConfig (void);
-  void Initialize (void);
+  void   LoadConfig      (void);
+  void   Initialize      (void);
+  string FragmentationKey(void) const;
 
 #ifdef __GENIE_PYTHIA8_ENABLED__
-  mutable Pythia8::Pythia * fPythia; ///< PYTHIA8 instance
+  Pythia8::Pythia * NewPythia (void) const;
+
+  mutable Pythia8::Pythia * fPythia;  ///< PYTHIA8 instance of the current configuration
+  map<string, Pythia8::Pythia *> fPythiaInstances; ///< initialized instances, per fragmentation parameter set
 #endif
 
+  ThreadAlgInstances fThreadInstances; ///< instances used by other threads
+
 };
 
 }         // genie namespace
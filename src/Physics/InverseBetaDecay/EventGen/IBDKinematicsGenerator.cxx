@@ -57,6 +57,8 @@ IBDKinematicsGenerator::~IBDKinematicsGenerator()
 //___________________________________________________________________________
 void IBDKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 {
+  StatsScope stats(this, evrec);
+
   if(fGenerateUniformly) {
     LOG("IBD", pNOTICE)
           << "Generating kinematics uniformly over the allowed phase space";
@@ -133,7 +135,7 @@ void IBDKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      LOG("IBD", pINFO) << "Trying: Q^2 = " << gQ2;
 
      //-- Computing cross section for the current kinematics
-     xsec = fXSecModel->XSec(interaction, kPSQ2fE);
+     xsec = this->XSec(interaction, kPSQ2fE);
 
      //-- Decide whether to accept the current kinematics
      if(!fGenerateUniformly) {
@@ -225,8 +227,9 @@ void IBDKinematicsGenerator::LoadConfig(void)
 	GetParamDef( "MaxXSec-SafetyFactor", fSafetyFactor, 1.25 ) ;
 
 	//-- Minimum energy for which max xsec would be cached, forcing explicit
-	//   calculation for lower eneries
-	GetParamDef( "Cache-MinEnergy", fEMin, 1.00 ) ;
+	//   calculation for lower eneries (IBD events are all at MeV energies:
+	//   cache at all energies)
+	GetParamDef( "Cache-MinEnergy", fEMin, 0.00 ) ;
 
 	//-- Maximum allowed fractional cross section deviation from maxim cross
 	//   section used in rejection method
@@ -271,7 +274,7 @@ double IBDKinematicsGenerator::ComputeMaxXSec(
   for(int i=0; i<N; i++) {
      double Q2 = TMath::Exp(logQ2min + i * dlogQ2);
      interaction->KinePtr()->SetQ2(Q2);
-     double xsec = fXSecModel->XSec(interaction, kPSQ2fE);
+     double xsec = this->XSec(interaction, kPSQ2fE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
      LOG("IBD", pDEBUG)  << "xsec(Q2= " << Q2 << ") = " << xsec;
 #endif
@@ -288,7 +291,7 @@ double IBDKinematicsGenerator::ComputeMaxXSec(
 	 Q2 = TMath::Exp(TMath::Log(Q2) - dlogQ2);
          if(Q2 < rQ2.min) continue;
          interaction->KinePtr()->SetQ2(Q2);
-         xsec = fXSecModel->XSec(interaction, kPSQ2fE);
+         xsec = this->XSec(interaction, kPSQ2fE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
          LOG("IBD", pDEBUG)  << "xsec(Q2= " << Q2 << ") = " << xsec;
 #endif
@@ -11,7 +11,11 @@
 */
 //____________________________________________________________________________
 
+#include <sstream>
+#include <mutex>
+
 #include <TMath.h>
+#include <TLorentzVector.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/EventGen/XSecAlgorithmI.h"
@@ -30,6 +34,7 @@
 #include "Physics/NuclearState/NuclearModelI.h"
 #include "Physics/Multinucleon/XSection/MECHadronTensor.h"
 #include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/GridEnvelope2D.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/ParticleData/PDGLibrary.h"
@@ -41,6 +46,24 @@ using namespace genie::utils;
 using namespace genie::constants;
 using namespace genie::controls;
 
+using std::ostringstream;
+
+//___________________________________________________________________________
+// Tables of d2xsec/dq0dq3 for direct sampling of the Nieves et al. lepton
+// kinematics, keyed by model, probe, target and energy node. Shared by all
+// threads. An entry may be null if no table could be built.
+namespace {
+
+  struct NSVTableMap : public map<string, GridEnvelope2D *> {
+    ~NSVTableMap() {
+      for(iterator iter = begin(); iter != end(); ++iter) delete iter->second;
+    }
+  };
+
+  NSVTableMap gNSVTables;
+  std::mutex  gNSVTableMutex;
+}
+
 //___________________________________________________________________________
 MECGenerator::MECGenerator() :
 EventRecordVisitorI("genie::MECGenerator")
@@ -649,6 +672,12 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
   bool accept = false;
   unsigned int iter = 0;
 
+  // If configured, sample (q0,q3) directly from d2xsec/dq0dq3 tabulated at
+  // the energy nodes around Enu: (T,Costh) then follow the cross section
+  // (up to the table granularity) and need no accept/reject test
+  const GridEnvelope2D * table =
+      (fNSVDirectSampling) ? this->NSVSamplingTable(interaction) : 0;
+
   // loop over different (randomly) selected T and Costh
   while (!accept) {
       iter++;
@@ -664,13 +693,28 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
           throw exception;
       }
 
-      // generate random kinetic energy T and Costh
-      T = TMin + (TMax-TMin)*rnd->RndKine().Rndm();
-      Costh = CosthMin + (CosthMax-CosthMin)*rnd->RndKine().Rndm();
-
-      // Calculate useful values for judging this choice
-      Plep = TMath::Sqrt( T * (T + (2.0 * LepMass)));  // ok is sqrt(E2 - m2)
-      Q3 = TMath::Sqrt(Plep*Plep + Enu*Enu - 2.0 * Plep * Enu * Costh);
+      if(table) {
+          // generate (q0,q3) from the table and the matching T and Costh
+          double u = -1, v = -1;
+          table->Sample(rnd->RndKine().Rndm(), rnd->RndKine().Rndm(),
+                        rnd->RndKine().Rndm(), u, v);
+          Q0 = u * fQ3Max;
+          Q3 = v * fQ3Max;
+          Elep = Enu - Q0;
+          if (Elep <= LepMass) continue;
+          Plep = TMath::Sqrt(Elep*Elep - LepMass*LepMass);
+          Costh = (Enu*Enu + Plep*Plep - Q3*Q3) / (2.0 * Enu * Plep);
+          if (Costh < -1.0 || Costh > 1.0) continue;
+          T = Elep - LepMass;
+      } else {
+          // generate random kinetic energy T and Costh
+          T = TMin + (TMax-TMin)*rnd->RndKine().Rndm();
+          Costh = CosthMin + (CosthMax-CosthMin)*rnd->RndKine().Rndm();
+
+          // Calculate useful values for judging this choice
+          Plep = TMath::Sqrt( T * (T + (2.0 * LepMass)));  // ok is sqrt(E2 - m2)
+          Q3 = TMath::Sqrt(Plep*Plep + Enu*Enu - 2.0 * Plep * Enu * Costh);
+      }
 
       // Don't bother doing hard work if the selected Q3 is greater than Q3Max
       if (Q3 < fQ3Max){
@@ -723,13 +767,18 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
               interaction->ExclTagPtr()->SetResonance(genie::kNoResonance);
               double XSecPN = fXSecModel->XSec(interaction, kPSTlctl);
 
-              if (XSec > XSecMax) {
+              if (table) {
+                  // kinematics sampled from the cross section itself
+                  accept = XSec > 0;
+              } else {
+                if (XSec > XSecMax) {
                   LOG("MEC", pERROR) << "XSec is > XSecMax for nucleus " << TgtPDG << " "
 				   << XSec << " > " << XSecMax
 				   << " don't let this happen.";
+                }
+                assert(XSec <= XSecMax);
+                accept = XSec > XSecMax*rnd->RndKine().Rndm();
               }
-              assert(XSec <= XSecMax);
-              accept = XSec > XSecMax*rnd->RndKine().Rndm();
               LOG("MEC", pINFO) << "Xsec, Max, Accept: " << XSec << ", "
                   << XSecMax << ", " << accept;
 
@@ -1064,5 +1113,112 @@ void MECGenerator::LoadConfig(void)
     assert(fNuclModel);
 
     GetParam( "NSV-Q3Max", fQ3Max ) ;
+
+    // Sample the Nieves et al. lepton kinematics directly from tabulated
+    // d2xsec/dq0dq3 instead of using the accept/reject loop?
+    GetParamDef( "NSV-DirectSampling",                    fNSVDirectSampling,      false ) ;
+    GetParamDef( "NSV-DirectSampling-NBins",              fNSVSamplingNBins,       100   ) ;
+    GetParamDef( "NSV-DirectSampling-EnergyBinsPerDecade", fNSVSamplingNEnergyBins, 20.  ) ;
+    assert(fNSVSamplingNEnergyBins > 0.);
+}
+//___________________________________________________________________________
+const GridEnvelope2D * MECGenerator::NSVSamplingTable(
+                                           const Interaction * in) const
+{
+// Returns the table to sample (q0,q3) from for the input interaction. Tables
+// are built once at log-spaced energy nodes and cached. The table of one of
+// the two nodes around the probe energy is picked at random, with the linear
+// interpolation weights in log(E), so that the sampled distribution is
+// interpolated between the two nodes.
+
+  double E = in->InitState().ProbeE(kRfLab);
+  if(E <= 0.) return 0;
+
+  double nodeE = fNSVSamplingNEnergyBins * TMath::Log10(E);
+  int    inode = TMath::FloorNint(nodeE);
+  if(RandomGen::Instance()->RndKine().Rndm() < nodeE - inode) inode++;
+
+  ostringstream key;
+  key << fXSecModel->Id().Key()
+      << "/nu:"   << in->InitState().ProbePdg()
+      << ";tgt:"  << in->InitState().TgtPdg()
+      << ";node:" << inode;
+
+  {
+    std::lock_guard<std::mutex> lock(gNSVTableMutex);
+    NSVTableMap::const_iterator iter = gNSVTables.find(key.str());
+    if(iter != gNSVTables.end()) return iter->second;
+  }
+
+  double Enode = TMath::Power(10., inode / fNSVSamplingNEnergyBins);
+  LOG("MEC", pNOTICE)
+    << "Building the d2xsec/dq0dq3 sampling table at E = " << Enode
+    << " GeV - key = " << key.str();
+
+  // build it without holding the lock: if another thread built the same
+  // table meanwhile, keep the one stored first
+  GridEnvelope2D * table = this->BuildNSVSamplingTable(in, Enode);
+
+  std::lock_guard<std::mutex> lock(gNSVTableMutex);
+  NSVTableMap::iterator iter = gNSVTables.find(key.str());
+  if(iter != gNSVTables.end()) {
+    delete table;
+    return iter->second;
+  }
+  gNSVTables[key.str()] = table;
+  return table;
+}
+//___________________________________________________________________________
+GridEnvelope2D * MECGenerator::BuildNSVSamplingTable(
+                               const Interaction * in, double Enode) const
+{
+// Tabulates d2xsec/dq0dq3 = d2xsec/dTldcostl * q3/(E*Plep), for all (pp,nn or
+// np) clusters, at the centres of a grid of q0,q3 in [0,Q3Max] at the input
+// energy. Points outside the allowed lepton kinematics get a null value.
+
+  int nbins = TMath::Max(fNSVSamplingNBins, 1);
+
+  Interaction * interaction = new Interaction(*in);
+  interaction->SetBit(kISkipProcessChk);
+  interaction->SetBit(kISkipKinematicChk);
+
+  TLorentzVector * p4 = in->InitState().GetProbeP4(kRfLab);
+  TLorentzVector p4node = (*p4) * (Enode / p4->E());
+  interaction->InitStatePtr()->SetProbeP4(p4node);
+  delete p4;
+
+  int NuPDG = interaction->InitState().ProbePdg();
+  interaction->InitStatePtr()->TgtPtr()->SetHitNucPdg(
+                          (NuPDG > 0) ? kPdgClusterNN : kPdgClusterPP);
+  interaction->ExclTagPtr()->SetResonance(genie::kNoResonance);
+
+  double ml = interaction->FSPrimLepton()->Mass();
+  double dq = fQ3Max / nbins;
+
+  GridEnvelope2D * table = new GridEnvelope2D(nbins, nbins);
+  for(int i0 = 0; i0 < nbins; i0++) {
+    double q0   = (i0 + 0.5) * dq;
+    double El   = Enode - q0;
+    if(El <= ml) continue;
+    double Pl   = TMath::Sqrt(El*El - ml*ml);
+    for(int i3 = 0; i3 < nbins; i3++) {
+      double q3 = (i3 + 0.5) * dq;
+      double ctl = (Enode*Enode + Pl*Pl - q3*q3) / (2.0 * Enode * Pl);
+      if(ctl < -1.0 || ctl > 1.0) continue;
+      interaction->KinePtr()->SetKV(kKVTl,  El - ml);
+      interaction->KinePtr()->SetKV(kKVctl, ctl);
+      double xsec = fXSecModel->XSec(interaction, kPSTlctl);
+      table->SetHeight(i0, i3, xsec * q3 / (Enode * Pl));
+    }
+  }
+  delete interaction;
+
+  if(!table->Build()) {
+    LOG("MEC", pWARN)
+      << "Null d2xsec/dq0dq3 sampling table at E = " << Enode << " GeV";
+    delete table;
+    return 0;
+  }
+  return table;
 }
 //___________________________________________________________________________
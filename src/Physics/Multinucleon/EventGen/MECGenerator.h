@@ -30,6 +30,8 @@ namespace genie {
 
 class XSecAlgorithmI;
 class NuclearModelI;
+class Interaction;
+class GridEnvelope2D;
 
 class MECGenerator : public EventRecordVisitorI {
 
@@ -40,6 +42,7 @@ public :
 
   // implement the EventRecordVisitorI interface
   void ProcessEventRecord (GHepRecord * event) const;
+  bool MayStepBack        (void) const { return true; }
 
   // overload the Algorithm::Configure() methods to load private data
   // members from configuration options
@@ -58,6 +61,8 @@ private:
   void    DecayNucleonCluster               (GHepRecord * event) const;
   void    SelectNSVLeptonKinematics         (GHepRecord * event) const;
   void    GenerateNSVInitialHadrons         (GHepRecord * event) const;
+  const GridEnvelope2D * NSVSamplingTable  (const Interaction * in) const;
+  GridEnvelope2D *  BuildNSVSamplingTable   (const Interaction * in, double E) const;
   PDGCodeList NucleonClusterConstituents    (int pdgc)           const;
 
   mutable const XSecAlgorithmI * fXSecModel;
@@ -65,6 +70,9 @@ private:
   const NuclearModelI *          fNuclModel;
 
   double fQ3Max;
+  bool   fNSVDirectSampling;      ///< sample (q0,q3) from tabulated d2xsec/dq0dq3, without rejection?
+  int    fNSVSamplingNBins;       ///< number of q0 and q3 bins of the sampling tables
+  double fNSVSamplingNEnergyBins; ///< number of sampling table energies per decade
 };
 
 }      // genie namespace
@@ -7,30 +7,173 @@
 //_________________________________________________________________________
 
 #include <cstdlib>
+#include <cstring>
 #include <string>
 #include <fstream>
 #include <cassert>
 #include <algorithm>
+#include <mutex>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/StartupProfile.h"
 #include "Framework/Numerical/Spline.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/ParticleData/PDGLibrary.h"
-#include "Framework/Numerical/BLI2D.h"
 #include "Physics/Multinucleon/XSection/MECHadronTensor.h"
 
 #include <TSystem.h>
 #include <TFile.h>
+#include <TMath.h>
 
 using std::ostringstream;
 using std::istream;
+using std::ofstream;
 using std::ios;
 
 using namespace genie;
 using namespace genie::constants;
 
+//_________________________________________________________________________
+// Dimensions of the Nieves hadron tensor tables, and the binary table file
+// layout (native byte order, offsets in bytes from the start of the file):
+//   header
+//   data : for each tensor type, nqz x nq0 nodes (qz-major) of nw doubles
+namespace {
+
+  const int    kNTensorTypes = MECHadronTensor::kMHTValenciaDeltapn + 1;
+  const int    kNWPoints     = 5;    // tensor components
+  const int    kNQ0Points    = 120;
+  const int    kNQzPoints    = 120;
+  const int    kNQ0QzPoints  = kNQ0Points*kNQzPoints;
+  const double kArrayStep    = 0.01; // GeV, the first node is at kArrayStep
+  // if later we use tables that are not 120x120
+  // then extract these constants to the config file with the input table specs
+  // or find a way for the input tables to be self-descriptive.
+
+  const char * kTensorLocation  = "/data/evgen/mectensor/nieves";
+  const char * kTensorFileStart = "HadTensor120-Nieves-";
+  const char * kTensorFileEnd   = "-20150210";
+
+  // possible future feature, allow a model to not deliver Delta tensors.
+  const char * kTensorTypeNames[kNTensorTypes] = {
+     "FullAll", "Fullpn", "DeltaAll", "Deltapn" };
+
+  const char     kMhtMagic[8]  = { 'G','E','N','I','E','M','H','T' };
+  const uint32_t kMhtByteOrder = 0x01020304;
+  const uint32_t kMhtVersion   = 2;
+
+  struct MhtHeader {
+    char     magic[8];
+    uint32_t byte_order;
+    uint32_t version;
+    uint32_t ntypes;
+    uint32_t nw;
+    uint32_t nqz;
+    uint32_t nq0;
+    double   step;
+    uint64_t data_offset;
+    uint64_t file_size;
+  };
+
+  const size_t kNData = (size_t) kNTensorTypes * kNWPoints * kNQ0QzPoints;
+
+  // guards the lazy loading of the tensor tables
+  std::mutex gTensorMutex;
+}
+//_________________________________________________________________________
+MECHadronTensorGrid::MECHadronTensorGrid(
+   int nx, double xmin, double dx, int ny, double ymin, double dy,
+   int ncomp, const double * z) :
+fNX(nx),
+fNY(ny),
+fXmin(xmin),
+fDX(dx),
+fYmin(ymin),
+fDY(dy),
+fNComp(ncomp),
+fZ(z)
+{
+
+}
+//_________________________________________________________________________
+MECHadronTensorGrid::~MECHadronTensorGrid()
+{
+
+}
+//_________________________________________________________________________
+const double * MECHadronTensorGrid::Cell(
+                       double x, double y, double & fx, double & fy) const
+{
+// Returns the nodes of the lower corner of the cell containing (x,y)
+// and the position of (x,y) in the cell, in units of the steps
+
+  double evalx = TMath::Max(TMath::Min(x, this->XMax()), fXmin);
+  double evaly = TMath::Max(TMath::Min(y, this->YMax()), fYmin);
+
+  fx = (evalx - fXmin) / fDX;
+  fy = (evaly - fYmin) / fDY;
+  int ix = TMath::Min((int) fx, fNX-2);
+  int iy = TMath::Min((int) fy, fNY-2);
+  fx -= ix;
+  fy -= iy;
+
+  return fZ + (ix*fNY + iy) * fNComp;
+}
+//_________________________________________________________________________
+void MECHadronTensorGrid::Evaluate(double x, double y, double * w) const
+{
+  double fx, fy;
+  const double * z11 = this->Cell(x, y, fx, fy);
+  const double * z12 = z11 + fNComp;         // (ix,   iy+1)
+  const double * z21 = z11 + fNY*fNComp;     // (ix+1, iy  )
+  const double * z22 = z21 + fNComp;         // (ix+1, iy+1)
+
+  double w11 = (1-fx) * (1-fy);
+  double w21 =    fx  * (1-fy);
+  double w12 = (1-fx) *    fy;
+  double w22 =    fx  *    fy;
+  for(int k = 0; k < fNComp; k++) {
+    w[k] = w11*z11[k] + w21*z21[k] + w12*z12[k] + w22*z22[k];
+  }
+}
+//_________________________________________________________________________
+double MECHadronTensorGrid::Evaluate(double x, double y, int k) const
+{
+  double fx, fy;
+  const double * z11 = this->Cell(x, y, fx, fy) + k;
+  const double * z12 = z11 + fNComp;
+  const double * z21 = z11 + fNY*fNComp;
+  const double * z22 = z21 + fNComp;
+
+  double z1 = *z11 * (1-fx) + *z21 * fx;
+  double z2 = *z12 * (1-fx) + *z22 * fx;
+  return z1 * (1-fy) + z2 * fy;
+}
+//_________________________________________________________________________
+MECHadronTensor::MECHadronTensorTable::MECHadronTensorTable() :
+MapBase(0),
+MapSize(0)
+{
+
+}
+//_________________________________________________________________________
+MECHadronTensor::MECHadronTensorTable::~MECHadronTensorTable()
+{
+  map<MECHadronTensor::MECHadronTensorType_t,
+      const MECHadronTensorGrid *>::iterator it = Table.begin();
+  for( ; it != Table.end(); ++it) {
+    delete it->second;
+  }
+  Table.clear();
+  if(MapBase) munmap((void *) MapBase, MapSize);
+}
 //_________________________________________________________________________
 MECHadronTensor * MECHadronTensor::fgInstance = 0;
 //_________________________________________________________________________
@@ -55,34 +198,18 @@ MECHadronTensor::MECHadronTensor()
   // likewise never want Rf208, I used the density for Pb208
   // likewise never want Ba112, I used the density for Cd112
 
-  // this one loads all known targets when instantiated, regardless of what the user wants.
-  // is there a point to being efficient, check if the requested one is loaded ?
-  // TODO  there is a fail if the spline file is missing one of the known targets
-  // and the user requests a mix of two targets.
-  vector<int>::const_iterator it=fKnownTensors.begin();
-  for( ; it!=fKnownTensors.end(); ++it) {
-    this->LoadTensorTables(*it);
-    // this method will fail silently if the target list here does not match later.
-  }
+  // The tables of each target are loaded at their first use (see TensorTable())
+
   fgInstance = 0;
 }
 //_________________________________________________________________________
 MECHadronTensor::~MECHadronTensor()
 {
-	vector<int>::const_iterator it=fKnownTensors.begin();
-	for( ; it!=fKnownTensors.end(); ++it) {
-		MECHadronTensor::MECHadronTensorTable table = fTargetTensorTables[*it];
-		for(int tensorType = 0; tensorType <= MECHadronTensor::kMHTValenciaDeltapn; ++tensorType) {
-			vector<genie::BLI2DNonUnifGrid*> Grids = table.Table[(MECHadronTensor::MECHadronTensorType_t)tensorType];
-			for (vector<genie::BLI2DNonUnifGrid*>::iterator gridit = Grids.begin() ; gridit != Grids.end(); ++gridit){
-				genie::BLI2DNonUnifGrid *hadTensorGrid = *gridit;
-				if(hadTensorGrid) {
-				  delete hadTensorGrid;
-				  hadTensorGrid=0;
-				}
-			}
-		}
-	}
+  map<int, MECHadronTensorTable *>::iterator it = fTargetTensorTables.begin();
+  for( ; it != fTargetTensorTables.end(); ++it) {
+    delete it->second;
+  }
+  fTargetTensorTables.clear();
 }
 //_________________________________________________________________________
 MECHadronTensor * MECHadronTensor::Instance()
@@ -119,74 +246,89 @@ bool MECHadronTensor::KnownTensor(int targetpdg)
   return std::count(fKnownTensors.begin(), fKnownTensors.end(), targetpdg)!=0;
 }
 //_________________________________________________________________________
-const vector<genie::BLI2DNonUnifGrid *> &
+const MECHadronTensorGrid *
    MECHadronTensor::TensorTable(int targetpdg, MECHadronTensorType_t type)
 {
-  return fTargetTensorTables[targetpdg].Table[type];
+  MECHadronTensorTable * table = 0;
+  {
+    std::lock_guard<std::mutex> lock(gTensorMutex);
+    map<int, MECHadronTensorTable *>::const_iterator it =
+       fTargetTensorTables.find(targetpdg);
+    if(it != fTargetTensorTables.end()) {
+      table = it->second;
+    } else {
+      table = this->LoadTensorTables(targetpdg);
+      fTargetTensorTables[targetpdg] = table;
+    }
+  }
+  if(!table) return 0;
+
+  map<MECHadronTensorType_t, const MECHadronTensorGrid *>::const_iterator
+     tit = table->Table.find(type);
+  if(tit == table->Table.end()) return 0;
+  return tit->second;
+}
+//_________________________________________________________________________
+string MECHadronTensor::TensorDir(void)
+{
+  // Ideally, the xml configuration can override the default location
+  return string(gSystem->Getenv("GENIE")) + kTensorLocation;
 }
 //_________________________________________________________________________
-void MECHadronTensor::LoadTensorTables(int targetpdg)
+string MECHadronTensor::BinaryTensorFile(int targetpdg)
+{
+  ostringstream filename;
+  filename << TensorDir() << "/" << kTensorFileStart << targetpdg
+           << kTensorFileEnd << ".bin";
+  return filename.str();
+}
+//_________________________________________________________________________
+MECHadronTensor::MECHadronTensorTable *
+   MECHadronTensor::LoadTensorTables(int targetpdg)
 {
 // Load the hadron tensor tables.
 // For the Nieves model they are in ${GENIE}/data/evgen/mectensor/nieves/
 
-  // define dimensions of data in the hadron tensor files
-  int nwpoints = 5;
-  const int nq0points = 120;
-  const int nqzpoints = 120;
-  const int nq0qzpoints = nq0points*nqzpoints;
-  double arraystep = 0.01; // GeV
-  // if later we use tables that are not 120x120
-  // then extract these constants to the config file with the input table specs
-  // or find a way for the input tables to be self-descriptive.
-
-  string tensorLocation  = string("/data/evgen/mectensor/nieves");
-  string tensorFileStart = "HadTensor120-Nieves-";
-  string tensorFileEnd   = "-20150210.dat";
+  StartupProfile::Scope phase("MECHadronTensor::LoadTensorTables");
 
-  if(!KnownTarget(targetpdg)){
+  if(!KnownTensor(targetpdg)){
     LOG("MECHadronTensor", pERROR)
       << "No MEC tensor table for target with PDG code: "
       << targetpdg;
-    return;
+    return 0;
   }
 
-  // define directory of hadron tensor files
-  // Ideally, the xml configuration can override the default location
-  string data_dir = string(gSystem->Getenv("GENIE")) + tensorLocation;
-
-  // define arrays to fill from data files
-  double hadtensor_q0_array[nq0points];
-  double hadtensor_qz_array[nqzpoints];
-  double hadtensor_w_array[nwpoints][nq0qzpoints];
+  MECHadronTensorTable * table = new MECHadronTensorTable;
 
-  // fill q0 array (in GeV)
-  // 240 5MeV bins or 120 10 MeV bins
-  for (int a = 0; a < nq0points; a++){
-    hadtensor_q0_array[a]=double(a+1)*arraystep;
+  string binfile = BinaryTensorFile(targetpdg);
+  if(access(binfile.c_str(), R_OK) == 0 && this->MapTensorTables(binfile, *table)) {
+    return table;
   }
 
-  // fill qz array (in GeV)
-  for (int a = 0; a < nqzpoints; a++){
-    hadtensor_qz_array[a]=double(a+1)*arraystep;
+  LOG("MECHadronTensor", pNOTICE)
+    << "No binary MEC tensor table for target " << targetpdg
+    << " - Reading the text tables";
+  if(!this->ReadTensorTables(targetpdg, *table)) {
+    delete table;
+    return 0;
   }
+  return table;
+}
+//_________________________________________________________________________
+bool MECHadronTensor::ReadTensorTables(
+                         int targetpdg, MECHadronTensorTable & table)
+{
+  string data_dir = TensorDir();
 
-  // possible future feature, allow a model to not deliver Delta tensors.
-  std::map<MECHadronTensor::MECHadronTensorType_t, std::string> tensorTypeNames;
-  tensorTypeNames[MECHadronTensor::kMHTValenciaFullAll]  = "FullAll";
-  tensorTypeNames[MECHadronTensor::kMHTValenciaFullpn]   = "Fullpn";
-  tensorTypeNames[MECHadronTensor::kMHTValenciaDeltaAll] = "DeltaAll";
-  tensorTypeNames[MECHadronTensor::kMHTValenciaDeltapn]  = "Deltapn";
+  table.Data.assign(kNData, 0.);
 
-  // iterate over all four hadron tensor types in the map above.
-  for(int tensorType = 0;
-          tensorType <= MECHadronTensor::kMHTValenciaDeltapn; ++tensorType) {
+  // iterate over all four hadron tensor types
+  for(int tensorType = 0; tensorType < kNTensorTypes; ++tensorType) {
 
     // build filenames from the bits of string
     ostringstream datafile;
-    datafile << data_dir << "/" << tensorFileStart << targetpdg << "-"
-	     << tensorTypeNames[(MECHadronTensor::MECHadronTensorType_t)tensorType]
-	     << tensorFileEnd;
+    datafile << data_dir << "/" << kTensorFileStart << targetpdg << "-"
+	     << kTensorTypeNames[tensorType] << kTensorFileEnd << ".dat";
 
     // make sure data files are available
     LOG("MECHadronTensor", pDEBUG)
@@ -194,33 +336,134 @@ void MECHadronTensor::LoadTensorTables(int targetpdg)
     assert (! gSystem->AccessPathName(datafile.str().c_str()));
 
     // read data file
-    ReadHadTensorqzq0File(
-      datafile.str(), nwpoints, nqzpoints, nq0points, hadtensor_w_array
-    );
-
-    //loop over all 5 tensors
-    for (int i = 0; i < nwpoints; i++){
-
-      // create a non uniform grid from tensor data
-      genie::BLI2DNonUnifGrid *hadTensorGrid =
-           new genie::BLI2DNonUnifGrid(
-               nqzpoints,
-               nq0points,
-               hadtensor_qz_array,
-               hadtensor_q0_array,
-               hadtensor_w_array[i]
-           );
-
-      // and store in a map using the target PDG as a key
-      fTargetTensorTables[targetpdg].Table[
-         (MECHadronTensor::MECHadronTensorType_t)tensorType].push_back(hadTensorGrid);
+    double * w = &table.Data[(size_t) tensorType * kNWPoints * kNQ0QzPoints];
+    if(!ReadHadTensorqzq0File(
+          datafile.str(), kNWPoints, kNQzPoints, kNQ0Points, w)) {
+      table.Data.clear();
+      return false;
     }
   }
+
+  this->BuildGrids(&table.Data[0], table);
+  return true;
+}
+//_________________________________________________________________________
+bool MECHadronTensor::MapTensorTables(
+                   const string & filename, MECHadronTensorTable & table)
+{
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    LOG("MECHadronTensor", pERROR) << "Could not open file: " << filename;
+    return false;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(MhtHeader)) {
+    LOG("MECHadronTensor", pERROR) << "Empty or truncated file: " << filename;
+    close(fd);
+    return false;
+  }
+  size_t size = st.st_size;
+  void * addr = mmap(0, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED) {
+    LOG("MECHadronTensor", pERROR) << "Could not map file: " << filename;
+    return false;
+  }
+  const char * base = (const char *) addr;
+
+  MhtHeader header;
+  memcpy(&header, base, sizeof(MhtHeader));
+  bool ok =
+     memcmp(header.magic, kMhtMagic, sizeof(kMhtMagic)) == 0 &&
+     header.byte_order  == kMhtByteOrder         &&
+     header.version     == kMhtVersion           &&
+     header.file_size   == size                  &&
+     header.ntypes      == (uint32_t) kNTensorTypes &&
+     header.nw          == (uint32_t) kNWPoints  &&
+     header.nqz         == (uint32_t) kNQzPoints &&
+     header.nq0         == (uint32_t) kNQ0Points &&
+     header.step        == kArrayStep            &&
+     header.data_offset == sizeof(MhtHeader)     &&
+     header.data_offset + kNData * sizeof(double) == size;
+  if (!ok) {
+    LOG("MECHadronTensor", pERROR)
+      << "Invalid or incompatible file (version: " << header.version
+      << "): " << filename;
+    munmap(addr, size);
+    return false;
+  }
+
+  table.MapBase = addr;
+  table.MapSize = size;
+  this->BuildGrids((const double *) (base + header.data_offset), table);
+
+  LOG("MECHadronTensor", pNOTICE) << "Mapped MEC tensor tables from: " << filename;
+  return true;
+}
+//_________________________________________________________________________
+void MECHadronTensor::BuildGrids(
+                     const double * data, MECHadronTensorTable & table)
+{
+// Create the grids of all tensor types, each holding the 5 components.
+// In the tables the first axis is |q| (qz) and the second is q0, both
+// starting at kArrayStep.
+
+  for(int tensorType = 0; tensorType < kNTensorTypes; ++tensorType) {
+    const double * w = data + (size_t) tensorType * kNWPoints * kNQ0QzPoints;
+    table.Table[(MECHadronTensor::MECHadronTensorType_t)tensorType] =
+       new MECHadronTensorGrid(
+          kNQzPoints, kArrayStep, kArrayStep,
+          kNQ0Points, kArrayStep, kArrayStep, kNWPoints, w);
+  }
+}
+//_________________________________________________________________________
+bool MECHadronTensor::ConvertTensorTables(
+                               int targetpdg, const string & filename)
+{
+  if(!KnownTensor(targetpdg)){
+    LOG("MECHadronTensor", pERROR)
+      << "No MEC tensor table for target with PDG code: " << targetpdg;
+    return false;
+  }
+
+  MECHadronTensorTable table;
+  if(!this->ReadTensorTables(targetpdg, table)) return false;
+
+  MhtHeader header;
+  memset(&header, 0, sizeof(MhtHeader));
+  memcpy(header.magic, kMhtMagic, sizeof(kMhtMagic));
+  header.byte_order  = kMhtByteOrder;
+  header.version     = kMhtVersion;
+  header.ntypes      = kNTensorTypes;
+  header.nw          = kNWPoints;
+  header.nqz         = kNQzPoints;
+  header.nq0         = kNQ0Points;
+  header.step        = kArrayStep;
+  header.data_offset = sizeof(MhtHeader);
+  header.file_size   = header.data_offset + kNData * sizeof(double);
+
+  ofstream out(filename.c_str(), ios::out | ios::binary);
+  if (!out.is_open()) {
+    LOG("MECHadronTensor", pERROR) << "Could not open file: " << filename;
+    return false;
+  }
+  out.write((const char *) &header, sizeof(MhtHeader));
+  out.write((const char *) &table.Data[0], kNData * sizeof(double));
+  out.close();
+  if (out.fail()) {
+    LOG("MECHadronTensor", pERROR) << "Error while writing file: " << filename;
+    return false;
+  }
+
+  LOG("MECHadronTensor", pNOTICE)
+    << "Saved the MEC tensor tables of target " << targetpdg
+    << " in: " << filename;
+  return true;
 }
 //_________________________________________________________________________
-void MECHadronTensor::ReadHadTensorqzq0File(
+bool MECHadronTensor::ReadHadTensorqzq0File(
   string filename, int nwpoints, int nqzpoints, int nq0points,
-  double hadtensor_w_array[][14400])
+  double * hadtensor_w_array)
 {
   // open file
   std::ifstream tensor_stream(filename.c_str(), ios::in);
@@ -228,15 +471,17 @@ void MECHadronTensor::ReadHadTensorqzq0File(
   // check file exists
   if(!tensor_stream.good()){
     LOG("MECHadronTensor", pERROR) << "Bad file name: " << filename;
-    return;
+    return false;
   }
 
+  int nij = nqzpoints*nq0points;
   double temp;
-  for (int ij = 0; ij < (nqzpoints*nq0points); ij++){
+  for (int ij = 0; ij < nij; ij++){
     for (int k = 0; k < nwpoints; k++) {
       tensor_stream >> temp;
-      hadtensor_w_array[k][ij]=temp;
+      hadtensor_w_array[ij*nwpoints+k]=temp;
     }
   }
+  return true;
 }
 //_________________________________________________________________________
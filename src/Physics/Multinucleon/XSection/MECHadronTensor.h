@@ -7,6 +7,12 @@
           to aid in the implementation (and improve the CPU efficiency of)
           MEC cross-section models.
 
+          The tables of a target are loaded at their first use. They are
+          memory-mapped read-only (and shared by all jobs running on the same
+          node) from the binary table file of the target, written by the
+          gmectensor2bin utility, if found in the tensor table directory,
+          otherwise they are read from the text tables.
+
 \author   Code contributed by Jackie Schwehr
           Substantial refactorization by the core GENIE group.
 
@@ -28,19 +34,60 @@
 #include <map>
 #include <vector>
 #include <string>
+#include <cstddef>
 
 #ifndef ROOT_Rtypes
 #include "Rtypes.h"
 #endif
 
-#include "Framework/Numerical/BLI2D.h"
-
 using std::map;
 using std::vector;
 using std::string;
 
 namespace genie {
 
+// ....................................................................
+// The components of a hadron tensor tabulated on a regular (x,y) grid, with
+// all the components of a node stored together, bilinearly interpolated.
+// The grid does not own its nodes, which belong to the MECHadronTensor (and
+// may be memory-mapped).
+//
+class MECHadronTensorGrid
+{
+public:
+  MECHadronTensorGrid(int nx, double xmin, double dx,
+                      int ny, double ymin, double dy,
+                      int ncomp, const double * z);
+ ~MECHadronTensorGrid();
+
+  //-- evaluate all components at the input position (clamped to the grid),
+  //   with a single cell look-up. w must hold NComponents() values.
+  void   Evaluate (double x, double y, double * w) const;
+
+  //-- evaluate component k at the input position (clamped to the grid)
+  double Evaluate (double x, double y, int k) const;
+
+  int    NComponents (void) const { return fNComp; }
+
+  double XMin (void) const { return fXmin; }
+  double XMax (void) const { return fXmin + (fNX-1)*fDX; }
+  double YMin (void) const { return fYmin; }
+  double YMax (void) const { return fYmin + (fNY-1)*fDY; }
+
+private:
+  int            fNX;    ///< number of x nodes
+  int            fNY;    ///< number of y nodes
+  double         fXmin;  ///< first x node
+  double         fDX;    ///< x step
+  double         fYmin;  ///< first y node
+  double         fDY;    ///< y step
+  int            fNComp; ///< number of components
+  const double * fZ;     ///< values at the nodes, z[(ix*ny+iy)*ncomp+k] (not owned)
+
+  //-- find the cell of the input position and the weights of its nodes
+  const double * Cell (double x, double y, double & fx, double & fy) const;
+};
+
 class MECHadronTensor
 {
 public:
@@ -59,15 +106,22 @@ public:
   MECHadronTensorType_t;
 
   // ................................................................
-  // MEC hadron tensor table
+  // MEC hadron tensor table: the grids of all tensor types of a target,
+  // and the storage of their nodes
   //
 
   class MECHadronTensorTable
   {
   public:
-     MECHadronTensorTable() { }
-    ~MECHadronTensorTable() { /* note: should delete the grids! */ }
-     map<MECHadronTensor::MECHadronTensorType_t, vector<genie::BLI2DNonUnifGrid *> > Table;
+     MECHadronTensorTable();
+    ~MECHadronTensorTable();
+     map<MECHadronTensor::MECHadronTensorType_t, const MECHadronTensorGrid *> Table;
+     vector<double> Data;     ///< nodes read from the text tables
+     const void *   MapBase;  ///< start of the mapped binary table file (0 if none)
+     size_t         MapSize;  ///< size of the mapped binary table file
+  private:
+     MECHadronTensorTable(const MECHadronTensorTable &);
+     MECHadronTensorTable & operator = (const MECHadronTensorTable &);
   };
 
   // ................................................................
@@ -80,10 +134,19 @@ public:
   // method to return whether the targetpdg is in fKnownTensors
   bool KnownTensor(int targetpdg);
 
-  // method to access a specific set of tables
-  const vector<genie::BLI2DNonUnifGrid *> &
+  // targets with explicit tensor tables
+  const vector<int> & KnownTensors(void) const { return fKnownTensors; }
+
+  // method to access a specific tensor (loaded at first access), or 0 if unknown
+  const MECHadronTensorGrid *
      TensorTable(int targetpdg, MECHadronTensor::MECHadronTensorType_t type);
 
+  // read the text tables of a target and save them in a binary table file
+  bool ConvertTensorTables(int targetpdg, const string & filename);
+
+  static string TensorDir        (void);           ///< tensor table directory
+  static string BinaryTensorFile (int targetpdg);  ///< default binary table file of a target
+
 private:
 
   // Ctors & dtor
@@ -94,20 +157,23 @@ private:
   // Self
   static MECHadronTensor * fgInstance;
 
-  // Load available hadron tensor tables.
-  // NOTES: All tables are loaded by the ctor - Consider loading them on demand.
-  //        This will also need to be extended to load tensors for requested model.
-  void LoadTensorTables(int targetpdg);
+  // Load the hadron tensor tables of a target, from its binary table file
+  // if available, otherwise from the text tables.
+  // NOTES: This will need to be extended to load tensors for requested model.
+  MECHadronTensorTable * LoadTensorTables (int targetpdg);
+  bool ReadTensorTables (int targetpdg, MECHadronTensorTable & table);
+  bool MapTensorTables  (const string & filename, MECHadronTensorTable & table);
+  void BuildGrids       (const double * data, MECHadronTensorTable & table);
 
-  // This map holds all known tensor tables (target PDG code is the key)
-  std::map<int, MECHadronTensorTable> fTargetTensorTables;
+  // This map holds all loaded tensor tables (target PDG code is the key)
+  std::map<int, MECHadronTensorTable *> fTargetTensorTables;
 
   // List of targets for which we can provide a calculation
   // some known targets use scale from the tensor table from another target.
   std::vector<int> fKnownTensors;
 
-  // that array size 14400 is 120x120.  Could go dynamic in the future, or not.
-  void ReadHadTensorqzq0File(string filename, int nwpoints, int nqzpoints, int nq0points, double hadtensor_w_array[][14400]);
+  // reads the nwpoints tensor components, stored as w[ij*nwpoints+k]
+  bool ReadHadTensorqzq0File(string filename, int nwpoints, int nqzpoints, int nq0points, double * hadtensor_w_array);
 
   // singleton cleaner
   struct Cleaner {
@@ -135,13 +135,14 @@ double NievesSimoVacasMECPXSec2016::XSec(
     double Q0    = 0;
     double Q3    = 0;
     genie::utils::mec::Getq0q3FromTlCostl(Tl, costl, Ev, ml, Q0, Q3);
-    const vector <genie::BLI2DNonUnifGrid *> &
+    const genie::MECHadronTensorGrid *
         tensor_table = hadtensor->TensorTable(
                 tensorpdg, MECHadronTensor::kMHTValenciaFullAll);
-    double Q0min = tensor_table[0]->XMin();
-    double Q0max = tensor_table[0]->XMax();
-    double Q3min = tensor_table[0]->YMin();
-    double Q3max = tensor_table[0]->YMax();
+    if(!tensor_table) return 0.0;
+    double Q0min = tensor_table->XMin();
+    double Q0max = tensor_table->XMax();
+    double Q3min = tensor_table->YMin();
+    double Q3max = tensor_table->YMax();
     if(Q0 < Q0min || Q0 > Q0max || Q3 < Q3min || Q3 > Q3max) {
         return 0.0;
     }
@@ -12,5 +12,6 @@
 #pragma link C++ class genie::mueloss::BezrukovBugaevModel;
 #pragma link C++ class genie::mueloss::KokoulinPetrukhinModel;
 #pragma link C++ class genie::mueloss::PetrukhinShestakovModel;
+#pragma link C++ class genie::mueloss::MuELossTable;
 
 #endif
@@ -0,0 +1,188 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <cassert>
+#include <mutex>
+
+#include <TMath.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Physics/MuonEnergyLoss/MuELossTable.h"
+
+using namespace genie;
+using namespace genie::mueloss;
+
+namespace {
+  std::mutex gMuELossTableMutex; // guards MuELossTable::fTables
+}
+
+//____________________________________________________________________________
+MuELossTable::MuELossTable(
+   const vector<const MuELossI *> & models, int nperdecade, double emin) :
+fModels (models),
+fEmin   (emin),
+fEmax   (kMaxMuE)
+{
+  assert(fModels.size() > 0);
+  assert(nperdecade > 0 && fEmin > kMuonMass && fEmin < fEmax);
+
+  fNPoints = 1 + TMath::CeilNint(nperdecade * TMath::Log10(fEmax/fEmin));
+  fLogEmin = TMath::Log(fEmin);
+  fDLogE   = TMath::Log(fEmax/fEmin) / (fNPoints-1);
+}
+//____________________________________________________________________________
+MuELossTable::~MuELossTable()
+{
+  map<MuELMaterial_t, Table *>::iterator it = fTables.begin();
+  for( ; it != fTables.end(); ++it) delete it->second;
+  fTables.clear();
+}
+//____________________________________________________________________________
+double MuELossTable::dE_dx(double E, MuELMaterial_t m) const
+{
+  if(E < fEmin || E >= fEmax) {
+    // outside the grid: ask the models
+    double de_dx = 0;
+    for(unsigned int k = 0; k < fModels.size(); k++) {
+      de_dx += fModels[k]->dE_dx(E, m);
+    }
+    return de_dx;
+  }
+  return this->Interpolate(this->GetTable(m).sum, E);
+}
+//____________________________________________________________________________
+double MuELossTable::dE_dx(double E, MuELMaterial_t m, MuELProcess_t p) const
+{
+  if(p == eMupSum) return this->dE_dx(E, m);
+
+  for(unsigned int k = 0; k < fModels.size(); k++) {
+    if(fModels[k]->Process() != p) continue;
+    if(E < fEmin || E >= fEmax) return fModels[k]->dE_dx(E, m);
+    return this->Interpolate(this->GetTable(m).dedx[k], E);
+  }
+  return 0;
+}
+//____________________________________________________________________________
+double MuELossTable::Range(double E, MuELMaterial_t m) const
+{
+  if(E <= fEmin) return 0;
+  const Table & table = this->GetTable(m);
+  if(E >= fEmax) return table.range.back();
+  return this->Interpolate(table.range, E);
+}
+//____________________________________________________________________________
+double MuELossTable::Energy(double range, MuELMaterial_t m) const
+{
+  if(range <= 0) return fEmin;
+
+  const Table & table = this->GetTable(m);
+
+  // below the 2nd grid point: interpolate between the first two
+  double r1 = table.range[1];
+  if(range < r1) {
+    return fEmin + (TMath::Exp(fLogEmin + fDLogE) - fEmin) * range/r1;
+  }
+  if(range >= table.range.back()) return fEmax;
+
+  double x = TMath::Log(range/r1) / table.dlogr;
+  int    j = TMath::Min((int) x, (int) table.energy.size() - 2);
+  double f = x - j;
+  return TMath::Exp((1-f) * table.energy[j] + f * table.energy[j+1]);
+}
+//____________________________________________________________________________
+double MuELossTable::Energy(double E, double x, MuELMaterial_t m) const
+{
+  double range = this->Range(E, m) - x;
+  if(range <= 0) return 0;
+  return this->Energy(range, m);
+}
+//____________________________________________________________________________
+void MuELossTable::Build(MuELMaterial_t m) const
+{
+  this->GetTable(m);
+}
+//____________________________________________________________________________
+const MuELossTable::Table & MuELossTable::GetTable(MuELMaterial_t m) const
+{
+  std::lock_guard<std::mutex> lock(gMuELossTableMutex);
+
+  map<MuELMaterial_t, Table *>::const_iterator it = fTables.find(m);
+  if(it != fTables.end()) return *(it->second);
+
+  Table * table = this->NewTable(m);
+  fTables.insert(map<MuELMaterial_t, Table *>::value_type(m, table));
+  return *table;
+}
+//____________________________________________________________________________
+MuELossTable::Table * MuELossTable::NewTable(MuELMaterial_t m) const
+{
+  LOG("MuELoss", pNOTICE)
+    << "Tabulating muon energy losses in " << MuELMaterial::AsString(m)
+    << " (" << fNPoints << " energies in [" << fEmin << ", " << fEmax << "] GeV)";
+
+  Table * table = new Table;
+  table->dedx.resize(fModels.size(), vector<double>(fNPoints, 0.));
+  table->sum.resize(fNPoints, 0.);
+  table->range.resize(fNPoints, 0.);
+
+  // -dE/dx at the grid energies (the models vanish at kMaxMuE: the last
+  // point is computed just below it)
+  for(int i = 0; i < fNPoints; i++) {
+    double E = TMath::Exp(fLogEmin + i*fDLogE);
+    if(i == fNPoints-1) E = fEmax * (1 - 1E-9);
+    for(unsigned int k = 0; k < fModels.size(); k++) {
+      double de_dx = fModels[k]->dE_dx(E, m);
+      table->dedx[k][i] = de_dx;
+      table->sum[i]    += de_dx;
+    }
+  }
+
+  // CSDA range: integrate dE / (-dE/dx) from the lowest grid energy
+  // (trapezoidal rule in E on the log(E) grid)
+  for(int i = 1; i < fNPoints; i++) {
+    double E0 = TMath::Exp(fLogEmin + (i-1)*fDLogE);
+    double E1 = TMath::Exp(fLogEmin +  i   *fDLogE);
+    double s0 = table->sum[i-1];
+    double s1 = table->sum[i];
+    double dr = (s0 > 0 && s1 > 0) ? 0.5 * (E1-E0) * (1/s0 + 1/s1) : 0;
+    table->range[i] = table->range[i-1] + dr;
+  }
+
+  // the range inversion table: log(E) at a uniform grid in log(range)
+  // (the range being monotonic in E)
+  double r1 = table->range[1];
+  double rN = table->range[fNPoints-1];
+  assert(r1 > 0 && rN > r1);
+  table->dlogr = TMath::Log(rN/r1) / (fNPoints-1);
+  table->energy.resize(fNPoints, 0.);
+  int i = 1;
+  for(int j = 0; j < fNPoints; j++) {
+    double range = r1 * TMath::Exp(j * table->dlogr);
+    if(j == fNPoints-1) range = rN;
+    while(i < fNPoints-2 && table->range[i+1] < range) i++;
+    double f = (range - table->range[i]) / (table->range[i+1] - table->range[i]);
+    f = TMath::Max(0., TMath::Min(1., f));
+    table->energy[j] = fLogEmin + (i+f) * fDLogE;
+  }
+
+  return table;
+}
+//____________________________________________________________________________
+double MuELossTable::Interpolate(const vector<double> & v, double E) const
+{
+// linear interpolation in log(E) of a table at the grid energies
+// (E within the grid)
+
+  double x = (TMath::Log(E) - fLogEmin) / fDLogE;
+  int    i = TMath::Max(0, TMath::Min((int) x, fNPoints - 2));
+  double f = x - i;
+  return (1-f) * v[i] + f * v[i+1];
+}
+//____________________________________________________________________________
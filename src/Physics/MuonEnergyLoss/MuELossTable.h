@@ -0,0 +1,95 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::mueloss::MuELossTable
+
+\brief    Tabulated muon energy losses, for muon propagation.
+
+          The -dE/dx of a set of MuELossI models (eg. ionization, pair
+          production, bremsstrahlung and nuclear interaction), their sum, the
+          CSDA range and its inverse, on a log(E) grid spanning the muon
+          energies the models know about (up to kMaxMuE).
+          The tables of a material are built from the models at its first
+          use (or at Build()). Afterwards all lookups are O(1) interpolations
+          and no integration is performed.
+
+          Units are the ones of MuELossI::dE_dx() (-dE/dx in GeV^-2), so the
+          ranges are mass thicknesses in natural units (GeV^3). Eg. to get
+          the range in g/cm^2, write: range /= (units::g/units::cm2).
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _MUELOSS_TABLE_H_
+#define _MUELOSS_TABLE_H_
+
+#include <map>
+#include <vector>
+
+#include "Physics/MuonEnergyLoss/MuELossI.h"
+
+using std::map;
+using std::vector;
+
+namespace genie   {
+namespace mueloss {
+
+class MuELossTable
+{
+public:
+  MuELossTable(const vector<const MuELossI *> & models,
+               int nperdecade = 50, double emin = kMuonMass + 1E-3);
+ ~MuELossTable();
+
+  //! -dE/dx of all models, or of the model for the process p (GeV^-2)
+  double dE_dx  (double E, MuELMaterial_t m) const;
+  double dE_dx  (double E, MuELMaterial_t m, MuELProcess_t p) const;
+
+  //! CSDA range of a muon of energy E (0 below the lowest grid energy)
+  double Range  (double E, MuELMaterial_t m) const;
+  //! energy of a muon with the given CSDA range (inverse of Range())
+  double Energy (double range, MuELMaterial_t m) const;
+  //! energy after crossing a mass thickness x (0: the muon stopped)
+  double Energy (double E, double x, MuELMaterial_t m) const;
+
+  //! build the tables of a material now (rather than at its first use)
+  void   Build  (MuELMaterial_t m) const;
+
+  double MinEnergy (void) const { return fEmin; }
+  double MaxEnergy (void) const { return fEmax; }
+
+private:
+
+  //! the tables of a material
+  struct Table {
+    vector< vector<double> > dedx;   ///< -dE/dx of each model at the grid energies
+    vector<double>           sum;    ///< -dE/dx of all models at the grid energies
+    vector<double>           range;  ///< CSDA range at the grid energies
+    vector<double>           energy; ///< log(E) at a uniform grid in log(range) / (range(1),range(N)]
+    double                   dlogr;  ///< log(range) step of the inversion table
+  };
+
+  const Table & GetTable (MuELMaterial_t m) const;
+  Table *       NewTable (MuELMaterial_t m) const;
+  double        Interpolate (const vector<double> & v, double E) const;
+
+  vector<const MuELossI *>             fModels;   ///< the tabulated models
+  int                                  fNPoints;  ///< log(E) grid points
+  double                               fEmin;     ///< lowest grid energy
+  double                               fEmax;     ///< highest grid energy
+  double                               fLogEmin;  ///< log(fEmin)
+  double                               fDLogE;    ///< log(E) grid step
+  mutable map<MuELMaterial_t, Table *> fTables;   ///< material -> tables
+};
+
+}       // mueloss namespace
+}       // genie   namespace
+
+#endif  // _MUELOSS_TABLE_H_
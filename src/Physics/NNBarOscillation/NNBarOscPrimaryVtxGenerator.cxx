@@ -58,7 +58,7 @@ void NNBarOscPrimaryVtxGenerator::ProcessEventRecord(GHepRecord * event) const
   fCurrDecayMode = (NNBarOscMode_t) interaction->ExclTag().DecayMode();
 
   // spit out that info -j
-  LOG("NNBarOsc", pNOTICE)
+  LOG("NNBarOsc", pINFO)
     << "Simulating decay " << genie::utils::nnbar_osc::AsString(fCurrDecayMode)
     << " for an initial state with code: " << fCurrInitStatePdg;
 
@@ -93,33 +93,24 @@ void NNBarOscPrimaryVtxGenerator::AddInitialState(GHepRecord * event) const
   GHepStatus_t stfs = kIStStableFinalState;
 
   int ipdg = fCurrInitStatePdg;
+  const DecaySetup & setup = this->Setup();
 
   // add initial nucleus
-  double Mi  = PDGLibrary::Instance()->Find(ipdg)->Mass();
-  TLorentzVector p4i(0,0,0,Mi);
+  TLorentzVector p4i(0,0,0,setup.Mi);
   event->AddParticle(ipdg,stis,-1,-1,-1,-1, p4i, v4);
 
   // add oscillating neutron
   int neutpdg = kPdgNeutron;
-  double mneut = PDGLibrary::Instance()->Find(neutpdg)->Mass();
-  TLorentzVector p4neut(0,0,0,mneut);
+  TLorentzVector p4neut(0,0,0,setup.mneut);
   event->AddParticle(neutpdg,stdc,0,-1,-1,-1, p4neut, v4);
 
   // add annihilation nucleon
-  int dpdg = genie::utils::nnbar_osc::AnnihilatingNucleonPdgCode(fCurrDecayMode);
-  double mn = PDGLibrary::Instance()->Find(dpdg)->Mass();
-  TLorentzVector p4n(0,0,0,mn);
-  event->AddParticle(dpdg,stdc, 0,-1,-1,-1, p4n, v4);
+  TLorentzVector p4n(0,0,0,setup.mn);
+  event->AddParticle(setup.npdg,stdc, 0,-1,-1,-1, p4n, v4);
 
   // add nuclear remnant
-  int A = pdg::IonPdgCodeToA(ipdg);
-  int Z = pdg::IonPdgCodeToZ(ipdg);
-  A--; A--;
-  if(dpdg == kPdgProton) { Z--; }
-  int rpdg = pdg::IonPdgCode(A, Z);
-  double Mf  = PDGLibrary::Instance()->Find(rpdg)->Mass();
-  TLorentzVector p4f(0,0,0,Mf);
-  event->AddParticle(rpdg,stfs,0,-1,-1,-1, p4f, v4);
+  TLorentzVector p4f(0,0,0,setup.Mf);
+  event->AddParticle(setup.rpdg,stfs,0,-1,-1,-1, p4f, v4);
 }
 //____________________________________________________________________________
 void NNBarOscPrimaryVtxGenerator::GenerateOscillatingNeutronPosition(
@@ -133,21 +124,13 @@ void NNBarOscPrimaryVtxGenerator::GenerateOscillatingNeutronPosition(
 
   RandomGen * rnd = RandomGen::Instance();
 
-  double R0 = 1.3;
-  double dA = (double)A;
-  double R = R0 * TMath::Power(dA, 1./3.);
-
   LOG("NNBarOsc", pINFO)
       << "Generating vertex according to a realistic nuclear density profile";
 
-  // get inputs to the rejection method
-  double ymax = -1;
-  double rmax = 3*R;
-  double dr   = R/40.;
-  for(double r = 0; r < rmax; r+=dr) {
-      ymax = TMath::Max(ymax, r*r * utils::nuclear::Density(r,A));
-  }
-  ymax *= 1.2;
+  // inputs to the rejection method (see Setup())
+  const DecaySetup & setup = this->Setup();
+  double ymax = setup.ymax;
+  double rmax = setup.rmax;
 
   // select a vertex using the rejection method
   TLorentzVector vtx(0,0,0,0);
@@ -269,27 +252,15 @@ void NNBarOscPrimaryVtxGenerator::GenerateDecayProducts(
 {
   LOG("NNBarOsc", pINFO) << "Generating decay...";
 
-  PDGCodeList pdgv = genie::utils::nnbar_osc::DecayProductList(fCurrDecayMode);
-  LOG("NNBarOsc", pINFO) << "Decay product IDs: " << pdgv;
-  assert ( pdgv.size() >  1);
+  const DecaySetup * setup = &this->Setup();
+  LOG("NNBarOsc", pINFO) << "Decay product IDs: " << setup->products;
+  assert ( setup->products.size() >  1);
 
   LOG("NNBarOsc", pINFO) << "Performing a phase space decay...";
-
-  // Get the decay product masses
-
-  vector<int>::const_iterator pdg_iter;
-  int idx = 0;
-  double * mass = new double[pdgv.size()];
-  double   sum  = 0;
-  for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
-    int pdgc = *pdg_iter;
-    double m = PDGLibrary::Instance()->Find(pdgc)->Mass();
-    mass[idx++] = m;
-    sum += m;
-  }
-
   LOG("NNBarOsc", pINFO)
-    << "Decaying N = " << pdgv.size() << " particles / total mass = " << sum;
+    << "Decaying N = " << setup->products.size() << " particles / total mass = "
+    << setup->mass_sum;
+
   int initial_nucleus_id      = 0;
   int oscillating_neutron_id  = 1;
   int annihilation_nucleon_id = 2;
@@ -302,27 +273,20 @@ void NNBarOscPrimaryVtxGenerator::GenerateDecayProducts(
   GHepParticle * annihilation_nucleon = event->Particle(annihilation_nucleon_id);
   assert(annihilation_nucleon);
 
-  Target tgt(initial_nucleus->Pdg());
-  tgt.SetHitNucPdg(kPdgNeutron);
-
   // get their momentum 4-vectors and boost into rest frame
-  TLorentzVector * p4_1 = oscillating_neutron->GetP4();
-  TLorentzVector * p4_2 = annihilation_nucleon->GetP4();
-  TLorentzVector * p4d = new TLorentzVector(*p4_1 + *p4_2);
-  TVector3 boost = p4d->BoostVector();
-  p4d->Boost(-boost);
+  TLorentzVector p4d = *oscillating_neutron->P4() + *annihilation_nucleon->P4();
+  TVector3 boost = p4d.BoostVector();
+  p4d.Boost(-boost);
 
   // get decay position
-  TLorentzVector * v4d = annihilation_nucleon->GetX4();
-
-  delete p4_1;
-  delete p4_2;
+  TLorentzVector v4(*annihilation_nucleon->X4());
 
   LOG("NNBarOsc", pINFO)
-    << "Decaying system p4 = " << utils::print::P4AsString(p4d);
+    << "Decaying system p4 = " << utils::print::P4AsString(&p4d);
 
   // Set the decay
-  bool permitted = fPhaseSpaceGenerator.SetDecay(*p4d, pdgv.size(), mass);
+  bool permitted = fPhaseSpace.SetDecay(
+              p4d, setup->products.size(), &setup->masses[0]);
 
   // If the decay is not energetically allowed, select a new final state
   while(!permitted) {
@@ -365,7 +329,6 @@ void NNBarOscPrimaryVtxGenerator::GenerateDecayProducts(
 
     // randomly generate a number between 1 and 0
     RandomGen * rnd = RandomGen::Instance();
-    rnd->SetSeed(0);
     double p = rnd->RndNum().Rndm();
 
     // loop through all modes, figure out which one our random number corresponds to
@@ -388,115 +351,46 @@ void NNBarOscPrimaryVtxGenerator::GenerateDecayProducts(
 
     fCurrDecayMode = (NNBarOscMode_t) interaction->ExclTag().DecayMode();
 
-    pdgv = genie::utils::nnbar_osc::DecayProductList(fCurrDecayMode);
-    LOG("NNBarOsc", pINFO) << "Decay product IDs: " << pdgv;
-    assert ( pdgv.size() > 1);
+    setup = &this->Setup();
+    LOG("NNBarOsc", pINFO) << "Decay product IDs: " << setup->products;
+    assert ( setup->products.size() > 1);
 
     // get the decay particles again
     LOG("NNBarOsc", pINFO) << "Performing a phase space decay...";
-    idx = 0;
-    delete [] mass;
-    mass = new double[pdgv.size()];
-    sum = 0;
-    for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
-      int pdgc = *pdg_iter;
-      double m = PDGLibrary::Instance()->Find(pdgc)->Mass();
-      mass[idx++] = m;
-      sum += m;
-    }
-
     LOG("NNBarOsc", pINFO)
-      << "Decaying N = " << pdgv.size() << " particles / total mass = " << sum;
+      << "Decaying N = " << setup->products.size() << " particles / total mass = "
+      << setup->mass_sum;
     LOG("NNBarOsc", pINFO)
-      << "Decaying system p4 = " << utils::print::P4AsString(p4d);
+      << "Decaying system p4 = " << utils::print::P4AsString(&p4d);
 
-    permitted = fPhaseSpaceGenerator.SetDecay(*p4d, pdgv.size(), mass);
+    permitted = fPhaseSpace.SetDecay(
+              p4d, setup->products.size(), &setup->masses[0]);
   }
 
-  if(!permitted) {
-     LOG("NNBarOsc", pERROR)
-       << " *** Phase space decay is not permitted \n"
-       << " Total particle mass = " << sum << "\n"
-       << " Decaying system p4 = " << utils::print::P4AsString(p4d);
-     // clean-up
-     delete [] mass;
-     delete p4d;
-     delete v4d;
-     // throw exception
+  // Generate an unweighted decay (the max weight is tabulated)
+  RandomGen * rnd = RandomGen::Instance();
+  bool accept_decay = fPhaseSpace.GenerateUnweighted(
+               rnd->RndHadro(), controls::kMaxUnweightDecayIterations);
+  if(!accept_decay) {
+     LOG("NNBarOsc", pWARN)
+         << "Couldn't generate an unweighted phase space decay after "
+         << controls::kMaxUnweightDecayIterations << " attempts";
      genie::exceptions::EVGThreadException exception;
-     exception.SetReason("Decay not permitted kinematically");
+     exception.SetReason("Couldn't select decay after N attempts");
      exception.SwitchOnFastForward();
      throw exception;
   }
 
-  // Get the maximum weight
-  //double wmax = fPhaseSpaceGenerator.GetWtMax();
-  double wmax = -1;
-  for(int i=0; i<200; i++) {
-     double w = fPhaseSpaceGenerator.Generate();
-     wmax = TMath::Max(wmax,w);
-  }
-  assert(wmax>0);
-  wmax *= 2;
-
-  LOG("NNBarOsc", pNOTICE)
-     << "Max phase space gen. weight @ current hadronic system: " << wmax;
-
-  // Generate an unweighted decay
-  RandomGen * rnd = RandomGen::Instance();
-
-  bool accept_decay=false;
-  unsigned int itry=0;
-  while(!accept_decay)
-  {
-     itry++;
-
-     if(itry > controls::kMaxUnweightDecayIterations) {
-       // report, clean-up and return
-       LOG("NNBarOsc", pWARN)
-           << "Couldn't generate an unweighted phase space decay after "
-           << itry << " attempts";
-       // clean up
-       delete [] mass;
-       delete p4d;
-       delete v4d;
-       // throw exception
-       genie::exceptions::EVGThreadException exception;
-       exception.SetReason("Couldn't select decay after N attempts");
-       exception.SwitchOnFastForward();
-       throw exception;
-     }
-     double w  = fPhaseSpaceGenerator.Generate();
-     if(w > wmax) {
-        LOG("NNBarOsc", pWARN)
-           << "Decay weight = " << w << " > max decay weight = " << wmax;
-     }
-     double gw = wmax * rnd->RndHadro().Rndm();
-     accept_decay = (gw<=w);
-
-     LOG("NNBarOsc", pINFO)
-        << "Decay weight = " << w << " / R = " << gw
-        << " - accepted: " << accept_decay;
-
-  } //!accept_decay
-
-  // Insert final state products into a TClonesArray of GHepParticle's
-  TLorentzVector v4(*v4d);
-  int idp = 0;
-  for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
-     int pdgc = *pdg_iter;
-     TLorentzVector * p4fin = fPhaseSpaceGenerator.GetDecay(idp);
+  // Insert final state products into the event record
+  const PDGCodeList & pdgv = setup->products;
+  for(unsigned int idp = 0; idp < pdgv.size(); idp++) {
+     int pdgc = pdgv[idp];
+     TLorentzVector p4fin = fPhaseSpace.GetDecay(idp);
      GHepStatus_t ist =
         utils::nnbar_osc::DecayProductStatus(fNucleonIsBound, pdgc);
-     p4fin->Boost(boost);
-     event->AddParticle(pdgc, ist, oscillating_neutron_id,-1,-1,-1, *p4fin, v4);
-     idp++;
+     p4fin.Boost(boost);
+     event->AddParticle(pdgc, ist, oscillating_neutron_id,-1,-1,-1, p4fin, v4);
   }
-
-  // Clean-up
-  delete [] mass;
-  delete p4d;
-  delete v4d;
 }
 //___________________________________________________________________________
 void NNBarOscPrimaryVtxGenerator::Configure(const Registry & config)
@@ -521,5 +415,66 @@ void NNBarOscPrimaryVtxGenerator::LoadConfig(void)
   RgKey nuclkey = "NuclearModel";
   fNuclModel = dynamic_cast<const NuclearModelI *> (this->SubAlg(nuclkey));
   assert(fNuclModel);
+
+  fSetups.clear();
+}
+//___________________________________________________________________________
+const NNBarOscPrimaryVtxGenerator::DecaySetup &
+  NNBarOscPrimaryVtxGenerator::Setup(void) const
+{
+// Returns the set-up of the current annihilation mode & initial state,
+// computing it at its first event
+
+  int  ipdg = fCurrInitStatePdg;
+  long key  = (long) ipdg * 1000 + (long) fCurrDecayMode;
+
+  std::map<long, DecaySetup>::const_iterator iter = fSetups.find(key);
+  if(iter != fSetups.end()) return iter->second;
+
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+  DecaySetup & setup = fSetups[key];
+
+  // annihilation products
+  setup.products = genie::utils::nnbar_osc::DecayProductList(fCurrDecayMode);
+  setup.mass_sum = 0;
+  for(unsigned int i = 0; i < setup.products.size(); i++) {
+    double m = pdglib->Find(setup.products[i])->Mass();
+    setup.masses.push_back(m);
+    setup.mass_sum += m;
+  }
+
+  // initial state & nuclear remnant
+  setup.npdg  = genie::utils::nnbar_osc::AnnihilatingNucleonPdgCode(fCurrDecayMode);
+  setup.Mi    = pdglib->Find(ipdg)->Mass();
+  setup.mneut = pdglib->Find(kPdgNeutron)->Mass();
+  setup.mn    = pdglib->Find(setup.npdg)->Mass();
+  int A = pdg::IonPdgCodeToA(ipdg);
+  int Z = pdg::IonPdgCodeToZ(ipdg);
+  if(setup.npdg == kPdgProton) { Z--; }
+  setup.rpdg = pdg::IonPdgCode(A-2, Z);
+  setup.Mf   = pdglib->Find(setup.rpdg)->Mass();
+
+  // bound of r^2 x nuclear density, for the vertex rejection method
+  setup.rmax = 0;
+  setup.ymax = 0;
+  if(A > 2) {
+    double R0 = 1.3;
+    double R  = R0 * TMath::Power((double)A, 1./3.);
+    double dr = R/40.;
+    double ymax = -1;
+    setup.rmax = 3*R;
+    for(double r = 0; r < setup.rmax; r+=dr) {
+      ymax = TMath::Max(ymax, r*r * utils::nuclear::Density(r,A));
+    }
+    setup.ymax = 1.2 * ymax;
+  }
+
+  LOG("NNBarOsc", pNOTICE)
+    << "Set up " << genie::utils::nnbar_osc::AsString(fCurrDecayMode)
+    << " for an initial state with code: " << ipdg
+    << " (" << setup.products.size() << " annihilation products, total mass = "
+    << setup.mass_sum << " GeV)";
+
+  return setup;
 }
 //___________________________________________________________________________
@@ -10,6 +10,10 @@
 
           Adapted from the NucleonDecay package (Author: Costas Andreopoulos).
 
+          As in NucleonDecayPrimaryVtxGenerator, the set-up of each
+          annihilation mode & initial state is computed at its first event
+          and kept, and the phase space max weights are tabulated.
+
 \created  November, 2016
 
 \cpright  Copyright (c) 2003-2020, The GENIE Collaboration
@@ -20,12 +24,15 @@
 #ifndef _NNBAR_OSC_PRIMARY_VTX_GENERATOR_H_
 #define _NNBAR_OSC_PRIMARY_VTX_GENERATOR_H_
 
-#include <TGenPhaseSpace.h>
 #include <TFile.h>
 #include <TH1.h>
+#include <map>
 #include <string>
+#include <vector>
 
 #include "Framework/EventGen/EventRecordVisitorI.h"
+#include "Framework/Numerical/NBodyPhaseSpace.h"
+#include "Framework/ParticleData/PDGCodeList.h"
 #include "Physics/NNBarOscillation/NNBarOscMode.h"
 
 namespace genie {
@@ -55,10 +62,29 @@ private:
    void GenerateFermiMomentum              (GHepRecord * event) const;
    void GenerateDecayProducts              (GHepRecord * event) const;
 
+   //! set-up of an annihilation mode & initial state
+   struct DecaySetup {
+     PDGCodeList         products; ///< annihilation products
+     std::vector<double> masses;   ///< annihilation product masses
+     double              mass_sum; ///< sum of the annihilation product masses
+     int                 npdg;     ///< annihilating nucleon PDG code
+     double              Mi;       ///< initial nucleus mass
+     double              mneut;    ///< oscillating neutron mass
+     double              mn;       ///< annihilating nucleon mass
+     int                 rpdg;     ///< remnant nucleus PDG code
+     double              Mf;       ///< remnant nucleus mass
+     double              rmax;     ///< max vertex radius (A > 2)
+     double              ymax;     ///< max r^2 x density, for the vertex selection
+   };
+
+   const DecaySetup & Setup (void) const;
+
    mutable int                fCurrInitStatePdg;
    mutable NNBarOscMode_t     fCurrDecayMode;
    mutable bool               fNucleonIsBound;
-   mutable TGenPhaseSpace     fPhaseSpaceGenerator;
+   mutable NBodyPhaseSpace    fPhaseSpace;
+
+   mutable std::map<long, DecaySetup> fSetups; ///< (init state, mode) -> set-up
 
    const NuclearModelI * fNuclModel;
 };
@@ -45,6 +45,8 @@ NuEKinematicsGenerator::~NuEKinematicsGenerator()
 //___________________________________________________________________________
 void NuEKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 {
+  StatsScope stats(this, evrec);
+
   if(fGenerateUniformly) {
     LOG("NuEKinematics", pNOTICE)
           << "Generating kinematics uniformly over the allowed phase space";
@@ -98,7 +100,7 @@ void NuEKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      LOG("NuEKinematics", pINFO) << "Trying: y = " << y;
 
      //-- computing cross section for the current kinematics
-     xsec = fXSecModel->XSec(interaction, kPSyfE);
+     xsec = this->XSec(interaction, kPSyfE);
 
      //-- decide whether to accept the current kinematics
      if(!fGenerateUniformly) {
@@ -170,7 +172,7 @@ double NuEKinematicsGenerator::ComputeMaxXSec(
   for(int i=0; i<N; i++) {
     double y = ymin + i * dy;
     interaction->KinePtr()->Sety(y);
-    double xsec = fXSecModel->XSec(interaction, kPSyfE);
+    double xsec = this->XSec(interaction, kPSyfE);
 
     SLOG("NuEKinematics", pDEBUG) << "xsec(y = " << y << ") = " << xsec;
     max_xsec = TMath::Max(xsec, max_xsec);
@@ -187,7 +189,7 @@ double NuEKinematicsGenerator::ComputeMaxXSec(
 	 y = y-dy;
          if(y<ymin) break;
          interaction->KinePtr()->Sety(y);
-         xsec = fXSecModel->XSec(interaction, kPSyfE);
+         xsec = this->XSec(interaction, kPSyfE);
          SLOG("NuEKinematics", pDEBUG) << "xsec(y = " << y << ") = " << xsec;
          max_xsec = TMath::Max(xsec, max_xsec);
        }
@@ -9,7 +9,6 @@
 //____________________________________________________________________________
 
 #include <TMath.h>
-#include <Math/Integrator.h>
 
 #include "Physics/XSectionIntegration/XSecIntegratorI.h"
 #include "Framework/Conventions/GBuild.h"
@@ -18,7 +17,7 @@
 #include "Physics/NuElectron/XSection/BardinIMDRadCorPXSec.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Utils/KineUtils.h"
-#include "Framework/Numerical/GSLUtils.h"
+#include "Framework/Numerical/MathUtils.h"
 
 using namespace genie;
 using namespace genie::constants;
@@ -157,32 +156,21 @@ double BardinIMDRadCorPXSec::P(int i, double r, double y) const
 //____________________________________________________________________________
 double BardinIMDRadCorPXSec::Li2(double z) const
 {
+// The dilogarithm integral int ln(1-zt)/t dt over t in [epsilon, 1-epsilon],
+// as used in the radiative corrections. It equals Li2(epsilon*z) -
+// Li2((1-epsilon)*z), which is evaluated in closed form rather than with a
+// numerical integration (5 per differential cross section evaluation).
+
   double epsilon = 1e-2;
   double tmin = epsilon;
   double tmax = 1. - epsilon;
 
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("BardinIMD", pDEBUG)
-    << "Summing BardinIMDRadCorIntegrand in [" << tmin<< ", " << tmax<< "]";
-#endif
-
-  ROOT::Math::IBaseFunctionOneDim * integrand = new
-          utils::gsl::wrap::BardinIMDRadCorIntegrand(z);
-  ROOT::Math::IntegrationOneDim::Type ig_type =
-          utils::gsl::Integration1DimTypeFromString("adaptive");
-
-  double abstol   = 1;    // We mostly care about relative tolerance
-  double reltol   = 1E-4;
-  int    nmaxeval = 100000;
-  ROOT::Math::Integrator ig(*integrand,ig_type,abstol,reltol,nmaxeval);
-  double li2 = ig.Integral(tmin, tmax);
+  double li2 = utils::math::Dilog(tmin*z) - utils::math::Dilog(tmax*z);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("BardinIMD", pDEBUG) << "Li2(z = " << z << ")" << li2;
 #endif
 
-  delete integrand;
-
   return li2;
 }
 //____________________________________________________________________________
@@ -265,44 +253,7 @@ void BardinIMDRadCorPXSec::Configure(string param_set)
 //____________________________________________________________________________
 void BardinIMDRadCorPXSec::LoadConfig(void)
 {
-  ////fIntegrator =
-////      dynamic_cast<const IntegratorI *> (this->SubAlg("Integrator"));
-/////  assert(fIntegrator);
-
   fXSecIntegrator =
       dynamic_cast<const XSecIntegratorI *> (this->SubAlg("XSec-Integrator"));
   assert(fXSecIntegrator);
 }
-//____________________________________________________________________________
-// Auxiliary scalar function for internal integration
-//____________________________________________________________________________
-utils::gsl::wrap::BardinIMDRadCorIntegrand::BardinIMDRadCorIntegrand(double z):
-ROOT::Math::IBaseFunctionOneDim()
-{
-  fZ = z;
-}
-//____________________________________________________________________________
-utils::gsl::wrap::BardinIMDRadCorIntegrand::~BardinIMDRadCorIntegrand()
-{
-
-}
-//____________________________________________________________________________
-unsigned int utils::gsl::wrap::BardinIMDRadCorIntegrand::NDim(void) const
-{
-  return 1;
-}
-//____________________________________________________________________________
-double utils::gsl::wrap::BardinIMDRadCorIntegrand::DoEval(double xin) const
-{
-  if(xin<=0) return 0.;
-  if(xin*fZ >= 1.) return 0.;
-  double f = TMath::Log(1.-fZ*xin)/xin;
-  return f;
-}
-//____________________________________________________________________________
-ROOT::Math::IBaseFunctionOneDim *
-  utils::gsl::wrap::BardinIMDRadCorIntegrand::Clone(void) const
-{
-  return new utils::gsl::wrap::BardinIMDRadCorIntegrand(fZ);
-}
-//____________________________________________________________________________
@@ -29,7 +29,6 @@
 #ifndef _BARDIN_IMD_RADIATIVE_CORRECTIONS_PARTIAL_XSEC_H_
 #define _BARDIN_IMD_RADIATIVE_CORRECTIONS_PARTIAL_XSEC_H_
 
-#include <Math/IFunction.h>
 #include "Framework/EventGen/XSecAlgorithmI.h"
 
 namespace genie {
@@ -66,47 +65,9 @@ private:
   double C   (int    i,  int k,    double r) const;
 
   // Private data members
-//  const IntegratorI *      fIntegrator;     ///< num integrator for BardinIMDRadCorIntegrand
   const XSecIntegratorI *  fXSecIntegrator; ///< differential x-sec integrator
 };
 
 } // genie namespace
 
-//____________________________________________________________________________
-/*!
-\class    genie::BardinIMDRadCorIntegrand
-
-\brief    Auxiliary scalar function for the internal integration in Bardin's
-          IMD d2xsec/dxdy cross section algorithm
-
-\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
-          University of Liverpool & STFC Rutherford Appleton Laboratory
-
-\created  February 20, 2006
-*/
-//____________________________________________________________________________
-
-namespace genie {
- namespace utils {
-  namespace gsl   {
-   namespace wrap   {
-
-    class BardinIMDRadCorIntegrand : public ROOT::Math::IBaseFunctionOneDim
-    {
-     public:
-       BardinIMDRadCorIntegrand(double z);
-      ~BardinIMDRadCorIntegrand();
-       // ROOT::Math::IBaseFunctionOneDim interface
-       unsigned int                      NDim   (void)       const;
-       double                            DoEval (double xin) const;
-       ROOT::Math::IBaseFunctionOneDim * Clone  (void)       const;
-     private:
-       double fZ;
-     };
-
-   } // wrap namespace
-  } // gsl namespace
- } // utils namespace
-} // genie namespace
-
 #endif  // _BARDIN_IMD_RADIATIVE_CORRECTIONS_PARTIAL_XSEC_H_
@@ -89,7 +89,53 @@ double IMDAnnihilationPXSec::XSec(
 //____________________________________________________________________________
 double IMDAnnihilationPXSec::Integral(const Interaction * interaction) const
 {
-  double xsec = fXSecIntegrator->Integrate(this,interaction);
+  if(! fAnalyticIntegral) {
+    double xsec = fXSecIntegrator->Integrate(this,interaction);
+    return xsec;
+  }
+
+  // dxsec/dy is a polynomial in y: integrate it in closed form over the
+  // y range the numerical integrator would have used
+
+  if(! this -> ValidProcess(interaction) ) return 0.;
+
+  const KPhaseSpace & kps = interaction->PhaseSpace();
+  if(!kps.IsAboveThreshold()) {
+     LOG("IMDAnnihilation", pDEBUG)  << "*** below energy threshold";
+     return 0;
+  }
+  Range1D_t yl = kps.Limits(kKVy);
+
+  const InitialState & init_state = interaction -> InitState();
+
+  double Ev = init_state.ProbeE(kRfLab);
+  double twoMeEv = 2*kElectronMass*Ev;
+  double A  = kGF2/kPi;
+
+  // the GENIE y range, in Marciano's y (as in XSec()), clipped to its
+  // physical range
+  double y0   = 1 - (kMuonMass2 + kElectronMass2)/twoMeEv;
+  double ymin = TMath::Max(0.,  y0 - yl.max);
+  double ymax = TMath::Min(1 - kMuonMass2/(twoMeEv + kElectronMass2), y0 - yl.min);
+  if(ymax <= ymin) return 0;
+
+  // primitive of 2meEv (1-y)^2 - (mmu^2-me^2) (1-y)
+  double dm2  = kMuonMass2 - kElectronMass2;
+  double Fmax = -twoMeEv*TMath::Power(1-ymax,3)/3. + 0.5*dm2*TMath::Power(1-ymax,2);
+  double Fmin = -twoMeEv*TMath::Power(1-ymin,3)/3. + 0.5*dm2*TMath::Power(1-ymin,2);
+
+  double xsec = A * (Fmax - Fmin);
+
+  LOG("IMDAnnihilation", pDEBUG)
+    << "*** XSec[IMD] [free e-] (E=" << Ev << ") = " << xsec;
+
+  //----- If requested return the free electron xsec even for nuclear target
+  if( interaction->TestBit(kIAssumeFreeElectron) ) return xsec;
+
+  //----- Scale for the number of scattering centers at the target
+  int Ne = init_state.Tgt().Z(); // num of scattering centers
+  xsec *= Ne;
+
   return xsec;
 }
 //____________________________________________________________________________
@@ -123,5 +169,8 @@ void IMDAnnihilationPXSec::LoadConfig(void)
   fXSecIntegrator =
       dynamic_cast<const XSecIntegratorI *> (this->SubAlg("XSec-Integrator"));
   assert(fXSecIntegrator);
+
+  // integrate dxsec/dy analytically? (or with the XSec-Integrator)
+  GetParamDef( "AnalyticIntegral", fAnalyticIntegral, true ) ;
 }
 //____________________________________________________________________________
@@ -53,6 +53,7 @@ private:
 
   const XSecIntegratorI * fXSecIntegrator;
 
+  bool fAnalyticIntegral; // integrate dxsec/dy in closed form?
 };
 
 }       // genie namespace
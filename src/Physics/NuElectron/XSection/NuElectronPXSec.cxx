@@ -50,7 +50,6 @@ double NuElectronPXSec::XSec(
   //----- get initial state & kinematics
   const InitialState & init_state = interaction -> InitState();
   const Kinematics &   kinematics = interaction -> Kine();
-  const ProcessInfo &  proc_info  = interaction -> ProcInfo();
 
   double Ev = init_state.ProbeE(kRfLab);
   double me = kElectronMass;
@@ -61,54 +60,10 @@ double NuElectronPXSec::XSec(
   if(y > 1/(1+0.5*me/Ev)) return 0;
   if(y < 0) return 0;
 
-  double xsec = 0; // <-- dxsec/dy
-
-  int inu = init_state.ProbePdg();
-
-  // nue + e- -> nue + e- [CC + NC + interference]
-  if(pdg::IsNuE(inu))
-  {
-    double em = -0.5 - fSin28w;
-    double ep = -fSin28w;
-    xsec = TMath::Power(em,2) + TMath::Power(ep*(1-y),2) - ep*em*me*y/Ev;
-    xsec *= A;
-  }
-
-  // nuebar + e- -> nue + e- [CC + NC + interference]
-  if(pdg::IsAntiNuE(inu))
-  {
-    double em = -0.5 - fSin28w;
-    double ep = -fSin28w;
-    xsec = TMath::Power(ep,2) + TMath::Power(em*(1-y),2) - ep*em*me*y/Ev;
-    xsec *= A;
-  }
-
-  // numu/nutau + e- -> numu/nutau + e- [NC]
-  if( (pdg::IsNuMu(inu)||pdg::IsNuTau(inu)) && proc_info.IsWeakNC() )
-  {
-    double em = 0.5 - fSin28w;
-    double ep = -fSin28w;
-    xsec = TMath::Power(em,2) + TMath::Power(ep*(1-y),2) - ep*em*me*y/Ev;
-    xsec *= A;
-  }
+  double a = 0, b = 0, c = 0;
+  if(! this->Couplings(interaction, a, b, c)) return 0;
 
-  // numubar/nutaubar + e- -> numubar/nutaubar + e- [NC]
-  if( (pdg::IsAntiNuMu(inu)||pdg::IsAntiNuTau(inu)) && proc_info.IsWeakNC() )
-  {
-    double em = 0.5 - fSin28w;
-    double ep = -fSin28w;
-    xsec = TMath::Power(ep,2) + TMath::Power(em*(1-y),2) - ep*em*me*y/Ev;
-    xsec *= A;
-  }
-
-  // numu/nutau + e- -> l- + nu_e [CC}
-  if( (pdg::IsNuMu(inu)||pdg::IsNuTau(inu)) && proc_info.IsWeakCC() ) xsec=0;
-/*
-    double ml  = (pdg::IsNuMu(inu)) ? kMuonMass : kTauMass;
-    double ml2 = TMath::Power(ml,2);
-    xsec = (kGF2*s/kPi)*(1-ml2/s);
-    xsec = TMath::Max(0.,xsec); // if s<ml2 => xsec<0 : force to xsec=0
-*/
+  double xsec = A * (a + b*TMath::Power(1-y,2) + c*y); // <-- dxsec/dy
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("Elastic", pDEBUG)
@@ -134,10 +89,110 @@ double NuElectronPXSec::XSec(
 //____________________________________________________________________________
 double NuElectronPXSec::Integral(const Interaction * interaction) const
 {
-  double xsec = fXSecIntegrator->Integrate(this,interaction);
+  if(! fAnalyticIntegral) {
+    double xsec = fXSecIntegrator->Integrate(this,interaction);
+    return xsec;
+  }
+
+  // dxsec/dy is a polynomial in y: integrate it in closed form over the
+  // y range the numerical integrator would have used
+
+  if(! this -> ValidProcess(interaction) ) return 0.;
+
+  const KPhaseSpace & kps = interaction->PhaseSpace();
+  if(!kps.IsAboveThreshold()) {
+     LOG("NuEXSec", pDEBUG)  << "*** Below energy threshold";
+     return 0;
+  }
+  Range1D_t yl = kps.Limits(kKVy);
+
+  double a = 0, b = 0, c = 0;
+  if(! this->Couplings(interaction, a, b, c)) return 0;
+
+  const InitialState & init_state = interaction -> InitState();
+
+  double Ev = init_state.ProbeE(kRfLab);
+  double me = kElectronMass;
+  double A  = kGF2*2*me*Ev/kPi;
+
+  // the GENIE y range, in Marciano's y (as in XSec()), clipped to its
+  // physical range
+  double ymin = TMath::Max(0.,              1 - me/Ev - yl.max);
+  double ymax = TMath::Min(1/(1+0.5*me/Ev), 1 - me/Ev - yl.min);
+  if(ymax <= ymin) return 0;
+
+  // primitive of a + b (1-y)^2 + c y
+  double Fmax = a*ymax - b*TMath::Power(1-ymax,3)/3. + 0.5*c*ymax*ymax;
+  double Fmin = a*ymin - b*TMath::Power(1-ymin,3)/3. + 0.5*c*ymin*ymin;
+
+  double xsec = A * (Fmax - Fmin);
+
+  LOG("NuEXSec", pDEBUG)
+    << "*** XSec[ve-] [free e-] (E=" << Ev << ") = " << xsec;
+
+  //----- If requested return the free electron xsec even for nuclear target
+  if( interaction->TestBit(kIAssumeFreeElectron) ) return xsec;
+
+  //----- Scale for the number of scattering centers at the target
+  int Ne = init_state.Tgt().Z(); // num of scattering centers
+  xsec *= Ne;
+
   return xsec;
 }
 //____________________________________________________________________________
+bool NuElectronPXSec::Couplings(
+   const Interaction * interaction, double & a, double & b, double & c) const
+{
+  const InitialState & init_state = interaction -> InitState();
+  const ProcessInfo &  proc_info  = interaction -> ProcInfo();
+
+  double Ev = init_state.ProbeE(kRfLab);
+  double me = kElectronMass;
+
+  int inu = init_state.ProbePdg();
+
+  double em = 0, ep = 0;
+  bool   nubar = false;
+
+  // nue + e- -> nue + e- [CC + NC + interference]
+  if(pdg::IsNuE(inu))
+  {
+    em = -0.5 - fSin28w;
+    ep = -fSin28w;
+  }
+  // nuebar + e- -> nue + e- [CC + NC + interference]
+  else if(pdg::IsAntiNuE(inu))
+  {
+    em = -0.5 - fSin28w;
+    ep = -fSin28w;
+    nubar = true;
+  }
+  // numu/nutau + e- -> numu/nutau + e- [NC]
+  else if( (pdg::IsNuMu(inu)||pdg::IsNuTau(inu)) && proc_info.IsWeakNC() )
+  {
+    em = 0.5 - fSin28w;
+    ep = -fSin28w;
+  }
+  // numubar/nutaubar + e- -> numubar/nutaubar + e- [NC]
+  else if( (pdg::IsAntiNuMu(inu)||pdg::IsAntiNuTau(inu)) && proc_info.IsWeakNC() )
+  {
+    em = 0.5 - fSin28w;
+    ep = -fSin28w;
+    nubar = true;
+  }
+  // numu/nutau + e- -> l- + nu_e [CC}
+  else {
+    a = b = c = 0;
+    return false;
+  }
+
+  a = nubar ? ep*ep : em*em;
+  b = nubar ? em*em : ep*ep;
+  c = -ep*em*me/Ev;
+
+  return true;
+}
+//____________________________________________________________________________
 bool NuElectronPXSec::ValidProcess(const Interaction * interaction) const
 {
   if(interaction->TestBit(kISkipProcessChk)) return true;
@@ -170,6 +225,9 @@ void NuElectronPXSec::LoadConfig(void)
   fSin28w = TMath::Power(TMath::Sin(thw), 2);
   fSin48w = TMath::Power(TMath::Sin(thw), 4);
 
+  // integrate dxsec/dy analytically? (or with the XSec-Integrator)
+  GetParamDef( "AnalyticIntegral", fAnalyticIntegral, true ) ;
+
   // load XSec Integrator
   fXSecIntegrator =
       dynamic_cast<const XSecIntegratorI *> (this->SubAlg("XSec-Integrator"));
@@ -54,12 +54,17 @@ public:
   void Configure(string config);
 
 private:
-  void LoadConfig (void);
+  void   LoadConfig (void);
+
+  //-- dxsec/dy = A [a + b (1-y)^2 + c y], with y the Marciano y: the a,b,c
+  //   of the interaction channel (returns false if the xsec vanishes)
+  bool   Couplings  (const Interaction * i, double & a, double & b, double & c) const;
 
   const XSecIntegratorI * fXSecIntegrator;
 
   double fSin28w; // sin^2(theta-weinberg)
   double fSin48w;
+  bool   fAnalyticIntegral; // integrate dxsec/dy in closed form?
 };
 
 }       // genie namespace
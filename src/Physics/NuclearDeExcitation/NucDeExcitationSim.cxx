@@ -39,6 +39,56 @@ using namespace genie::utils;
 using namespace genie::constants;
 using namespace genie::controls;
 
+//___________________________________________________________________________
+// Nuclear de-excitation gamma ray data: Each row is a de-excitation mode
+// given as the probability of the hole shell, of the excited state of the
+// remnant for that shell, and of the gamma ray branch of that state. Modes
+// emitting no gamma ray (holes leaving the remnant at its ground state or
+// excited states above the particle emission threshold) are not listed.
+// Adding a nucleus only requires adding its rows.
+namespace {
+
+  struct DeExMode_t {
+    int         Z;        // target nucleus Z
+    int         hitnuc;   // hit nucleon pdg code (the hole)
+    const char* state;    // hole shell and excited state
+    double      Pshell;   // probability of a hole in that shell
+    double      Plevel;   // probability of the excited state for that shell
+    double      Pbranch;  // probability of the gamma ray branch of that state
+    int         ngamma;   // number of gamma rays in the branch
+    double      E[2];     // gamma ray energies (GeV)
+  };
+
+  // 16O: H.Ejiri, Phys.Rev.C48,1442(1993);
+  //      K.Kobayashi et al., Nucl.Phys.B (proc Suppl) 139 (2005)
+  // p-holes: P1/2 (0.25, g.s.), P3/2 (0.47) and S1/2 (0.28) shells.
+  // n-holes: P1/2 (0.25, g.s.), P3/2 (0.44) and S1/2 (0.09) shells.
+  const DeExMode_t kDeExModes[] = {
+    { 8, kPdgProton,  "P3/2, 6.32 MeV",  0.47, 0.872,  1.,    1, { 0.00632, 0.       } },
+    { 8, kPdgProton,  "P3/2, 9.93 MeV",  0.47, 0.064,  0.78,  1, { 0.00993, 0.       } },
+    { 8, kPdgProton,  "P3/2, 9.93 MeV",  0.47, 0.064,  0.22,  2, { 0.00993, 0.00361  } },
+    { 8, kPdgProton,  "S1/2, 3.09 MeV",  0.28, 0.0625, 1.,    1, { 0.00309, 0.       } },
+    { 8, kPdgProton,  "S1/2, 3.68 MeV",  0.28, 0.1875, 1.,    1, { 0.00368, 0.       } },
+    { 8, kPdgProton,  "S1/2, 3.85 MeV",  0.28, 0.075,  0.013, 1, { 0.00309, 0.       } },
+    { 8, kPdgProton,  "S1/2, 3.85 MeV",  0.28, 0.075,  0.360, 1, { 0.00369, 0.       } },
+    { 8, kPdgProton,  "S1/2, 3.85 MeV",  0.28, 0.075,  0.625, 1, { 0.00385, 0.       } },
+    { 8, kPdgProton,  "S1/2, 4.44 MeV",  0.28, 0.1375, 1.,    1, { 0.00444, 0.       } },
+    { 8, kPdgProton,  "S1/2, 4.92 MeV",  0.28, 0.1375, 1.,    1, { 0.00492, 0.       } },
+    { 8, kPdgProton,  "S1/2, 5.11 MeV",  0.28, 0.0125, 1.,    1, { 0.00511, 0.       } },
+    { 8, kPdgProton,  "S1/2, 6.09 MeV",  0.28, 0.0125, 1.,    1, { 0.00609, 0.       } },
+    { 8, kPdgProton,  "S1/2, 6.73 MeV",  0.28, 0.075,  0.04,  1, { 0.00609, 0.       } },
+    { 8, kPdgProton,  "S1/2, 6.73 MeV",  0.28, 0.075,  0.96,  1, { 0.00673, 0.       } },
+    { 8, kPdgProton,  "S1/2, 7.01 MeV",  0.28, 0.0563, 1.,    1, { 0.00701, 0.       } },
+    { 8, kPdgProton,  "S1/2, 7.03 MeV",  0.28, 0.0563, 1.,    1, { 0.00703, 0.       } },
+    { 8, kPdgProton,  "S1/2, 7.34 MeV",  0.28, 0.1874, 0.050, 1, { 0.00609, 0.       } },
+    { 8, kPdgProton,  "S1/2, 7.34 MeV",  0.28, 0.1874, 0.033, 1, { 0.00673, 0.       } },
+    { 8, kPdgProton,  "S1/2, 7.34 MeV",  0.28, 0.1874, 0.017, 1, { 0.00734, 0.       } },
+    { 8, kPdgNeutron, "P3/2, 6.18 MeV",  0.44, 1.,     1.,    1, { 0.00618, 0.       } },
+    { 8, kPdgNeutron, "S1/2, 7.03 MeV",  0.09, 1.,     0.222, 1, { 0.00703, 0.       } }
+  };
+  const unsigned int kNDeExModes = sizeof(kDeExModes) / sizeof(DeExMode_t);
+}
+
 //___________________________________________________________________________
 NucDeExcitationSim::NucDeExcitationSim() :
 EventRecordVisitorI("genie::NucDeExcitationSim")
@@ -68,242 +118,98 @@ void NucDeExcitationSim::ProcessEventRecord(GHepRecord * evrec) const
       << "No nuclear target found - Won't simulate nuclear de-excitation";
     return;
   }
+  GHepParticle * hitnuc = evrec->HitNucleon();
+  if(!hitnuc) return;
+
+  map<int, DeExTable>::const_iterator it =
+     fTables.find(this->TableKey(nucltgt->Z(), hitnuc->Pdg()));
+  if(it == fTables.end()) {
+    LOG("NucDeEx", pINFO)
+      << "No de-excitation table for Z = " << nucltgt->Z()
+      << " and hit nucleon = " << hitnuc->Pdg();
+    return;
+  }
+  const DeExTable & table = it->second;
 
-  if(nucltgt->Z()==8) this->OxygenTargetSim(evrec);
+  RandomGen * rnd = RandomGen::Instance();
+  unsigned int imode = table.sampler.Sample(rnd->RndDec().Rndm());
+
+  LOG("NucDeEx", pNOTICE)
+     << "Selected de-excitation mode: " << table.modes[imode];
+
+  const vector<double> & gammas = table.gammas[imode];
+  for(unsigned int ig = 0; ig < gammas.size(); ig++) {
+    this->AddPhoton(evrec, gammas[ig], -1);
+  }
 
   LOG("NucDeEx", pINFO)
      << "Done with this event";
 }
 //___________________________________________________________________________
-void NucDeExcitationSim::OxygenTargetSim(GHepRecord * evrec) const
+void NucDeExcitationSim::Configure(const Registry & config)
 {
-  LOG("NucDeEx", pNOTICE)
-     << "Simulating nuclear de-excitation gamma rays for Oxygen target";
-
-  //LOG("NucDeEx", pNOTICE) << *evrec;
-
-  GHepParticle * hitnuc = evrec->HitNucleon();
-  if(!hitnuc) return;
-
-  bool p_hole = (hitnuc->Pdg() == kPdgProton);
-  double dt   = -1;
-
-  RandomGen * rnd = RandomGen::Instance();
-
-  //
-  // ****** P-Hole
-  //
-  if (p_hole) {
-    //
-    // * Define all the data required for simulating deexcitations of p-hole states
-    //
-
-    // > probabilities for creating a p-hole in the P1/2, P3/2, S1/2 shells
-    double Pp12 = 0.25;              // P1/2
-    double Pp32 = 0.47;              // P3/2
-    double Ps12 = 1. - Pp12 - Pp32;  // S1/2
-
-    // > excited state energy levels & probabilities for P3/2-shell p-holes
-    const int np32 = 3;
-    double p32Elv[np32] = { 0.00632, 0.00993, 0.01070 };
-    double p32Plv[np32] = { 0.872,   0.064,   0.064   };
-    // - probabilities for deexcitation modes of P3/2-shell p-hole state '1'
-    double p32Plv1_1gamma  = 0.78;  // prob to decay via 1 gamma
-    double p32Plv1_cascade = 0.22;  // prob to decay via gamma cascade
-
-    // > excited state energy levels & probabilities for S1/2-shell p-holes
-    const int ns12 = 11;
-    double s12Elv[ns12] = {
-               0.00309, 0.00368, 0.00385, 0.00444, 0.00492,
-               0.00511, 0.00609, 0.00673, 0.00701, 0.00703, 0.00734 };
-    double s12Plv[ns12] = {
-               0.0625,  0.1875,  0.075,   0.1375,  0.1375,
-               0.0125,  0.0125,  0.075,   0.0563,  0.0563,  0.1874  };
-    // - gamma energies and probabilities for S1/2-shell p-hole excited
-    //   states '2','7' and '10' with >1 deexcitation modes
-    const int ns12lv2 = 3;
-    double s12Elv2[ns12lv2]    = { 0.00309, 0.00369, 0.00385 };
-    double s12Plv2[ns12lv2]    = { 0.013,   0.360,   0.625   };
-    const int ns12lv7 = 2;
-    double s12Elv7[ns12lv7]    = { 0.00609, 0.00673 };
-    double s12Plv7[ns12lv7]    = { 0.04,    0.96    };
-    const int ns12lv10 = 3;
-    double s12Elv10[ns12lv10]  = { 0.00609, 0.00673, 0.00734 };
-    double s12Plv10[ns12lv10]  = { 0.050,   0.033,   0.017   };
-
-    // Select one of the P1/2, P3/2 or S1/2
-    double rshell = rnd->RndDec().Rndm();
-    //
-    // >> P1/2 shell
-    //
-    if(rshell < Pp12) {
-        LOG("NucDeEx", pNOTICE)
-          << "Hit nucleon left a P1/2 shell p-hole. Remnant is at g.s.";
-        return;
-    }
-    //
-    // >> P3/2 shell
-    //
-    else
-    if(rshell < Pp12 + Pp32) {
-        LOG("NucDeEx", pNOTICE)
-            << "Hit nucleon left a P3/2 shell p-hole";
-        // Select one of the excited states
-        double rdecmode  = rnd->RndDec().Rndm();
-        double prob_sum  = 0;
-        int    sel_state = -1;
-        for(int istate=0; istate<np32; istate++) {
-            prob_sum += p32Plv[istate];
-            if(rdecmode < prob_sum) {
-              sel_state = istate;
-              break;
-            }
-        }
-        LOG("NucDeEx", pNOTICE)
-            << "Selected P3/2 excited state = " << sel_state;
-
-        // Decay that excited state
-        // >> 6.32 MeV state
-        if(sel_state==0) {
-            this->AddPhoton(evrec, p32Elv[0], dt);
-        }
-        // >> 9.93 MeV state
-        else
-        if(sel_state==1) {
-            double r = rnd->RndDec().Rndm();
-            // >>> emit a single gamma
-            if(r < p32Plv1_1gamma) {
-               this->AddPhoton(evrec, p32Elv[1], dt);
-            }
-            // >>> emit a cascade of gammas
-            else
-            if(r < p32Plv1_1gamma + p32Plv1_cascade) {
-               this->AddPhoton(evrec, p32Elv[1],           dt);
-               this->AddPhoton(evrec, p32Elv[1]-p32Elv[0], dt);
-            }
-        }
-        // >> 10.7 MeV state
-        else
-        if(sel_state==2) {
-           // Above the particle production threshold - need to emit
-           // a 0.5 MeV kinetic energy proton.
-           // Will neglect that given that it is a very low energy
-           // kinetic energy nucleon and the intranuke break-up nucleon
-           // cross sections are already tuned.
-           return;
-        }
-    } //p3/2
-    //
-    // >> S1/2 shell
-    //
-    else if (rshell < Pp12 + Pp32 + Ps12) {
-        LOG("NucDeEx", pNOTICE)
-            << "Hit nucleon left an S1/2 shell p-hole";
-        // Select one of the excited states caused by a S1/2 shell hole
-        double rdecmode  = rnd->RndDec().Rndm();
-        double prob_sum  = 0;
-        int    sel_state = -1;
-        for(int istate=0; istate<ns12; istate++) {
-            prob_sum += s12Plv[istate];
-            if(rdecmode < prob_sum) {
-              sel_state = istate;
-              break;
-            }
-        }
-        LOG("NucDeEx", pNOTICE)
-            << "Selected S1/2 excited state = " << sel_state;
-
-        // Decay that excited state
-        bool multiple_decay_modes =
-              (sel_state==2 || sel_state==7 || sel_state==10);
-        if(!multiple_decay_modes) {
-          this->AddPhoton(evrec, s12Elv[sel_state], dt);
-        } else {
-          int ndec = -1;
-          double * pdec = 0, * edec = 0;
-          switch(sel_state) {
-           case(2) :
-              ndec = ns12lv2;  pdec = s12Plv2;  edec = s12Elv2;
-              break;
-           case(7) :
-              ndec = ns12lv7;  pdec = s12Plv7;  edec = s12Elv7;
-              break;
-           case(10) :
-              ndec = ns12lv10; pdec = s12Plv10; edec = s12Elv10;
-              break;
-           default:
-             return;
-          }
-          double r = rnd->RndDec().Rndm();
-          double decmode_prob_sum = 0;
-          int sel_decmode = -1;
-          for(int idecmode=0; idecmode < ndec; idecmode++) {
-             decmode_prob_sum += pdec[idecmode];
-             if(r < decmode_prob_sum) {
-                 sel_decmode = idecmode;
-                 break;
-             }
-          }
-          if(sel_decmode == -1) return;
-          this->AddPhoton(evrec, edec[sel_decmode], dt);
-        }//mult.dec.ch
-
-    } // s1/2
-    else {
-    }
-  } // p-hole
-
-  //
-  // ****** n-hole
-  //
-  else {
-    //
-    // * Define all the data required for simulating deexcitations of n-hole states
-    //
-
-    // > probabilities for creating a n-hole in the P1/2, P3/2, S1/2 shells
-    double Pp12 = 0.25;  // P1/2
-    double Pp32 = 0.44;  // P3/2
-    double Ps12 = 0.09;  // S1/2
-    //>
-    double p32Elv = 0.00618;
-    //>
-    double s12Elv = 0.00703;
-    double s12Plv = 0.222;
-
-    // Select one of the P1/2, P3/2 or S1/2
-    double rshell = rnd->RndDec().Rndm();
-    //
-    // >> P1/2 shell
-    //
-    if(rshell < Pp12) {
-        LOG("NucDeEx", pNOTICE)
-          << "Hit nucleon left a P1/2 shell n-hole. Remnant is at g.s.";
-        return;
-    }
-    //
-    // >> P3/2 shell
-    //
-    else
-    if(rshell < Pp12 + Pp32) {
-        LOG("NucDeEx", pNOTICE)
-            << "Hit nucleon left a P3/2 shell n-hole";
-        this->AddPhoton(evrec, p32Elv, dt);
+  Algorithm::Configure(config);
+  this->LoadConfig();
+}
+//___________________________________________________________________________
+void NucDeExcitationSim::Configure(string config)
+{
+  Algorithm::Configure(config);
+  this->LoadConfig();
+}
+//___________________________________________________________________________
+void NucDeExcitationSim::LoadConfig(void)
+{
+// Build, for each tabulated (nucleus, hole) pair, the list of de-excitation
+// modes (including the one emitting no gamma ray) and their alias table
+
+  fTables.clear();
+
+  map<int, double> psum;
+  for(unsigned int i = 0; i < kNDeExModes; i++) {
+    const DeExMode_t & m = kDeExModes[i];
+    int key = this->TableKey(m.Z, m.hitnuc);
+    DeExTable & table = fTables[key];
+    if(table.modes.empty()) {
+      ostringstream nodeex;
+      nodeex << "Z = " << m.Z << ", " << ((m.hitnuc==kPdgProton) ? "p" : "n")
+             << "-hole, no de-excitation gamma";
+      table.modes  .push_back(nodeex.str());
+      table.gammas .push_back(vector<double>());
+      table.weights.push_back(0.);
     }
-    //
-    // >> S1/2 shell
-    //
-    else
-    if(rshell < Pp12 + Pp32 + Ps12) {
-        LOG("NucDeEx", pNOTICE)
-            << "Hit nucleon left a S1/2 shell n-hole";
-        // only one of the deexcitation modes involve a (7.03 MeV) photon
-        double r = rnd->RndDec().Rndm();
-        if(r < s12Plv) this->AddPhoton(evrec, s12Elv,dt);
+    double P = m.Pshell * m.Plevel * m.Pbranch;
+    ostringstream mode;
+    mode << "Z = " << m.Z << ", " << ((m.hitnuc==kPdgProton) ? "p" : "n")
+         << "-hole, " << m.state << " ->";
+    vector<double> gammas;
+    for(int ig = 0; ig < m.ngamma; ig++) {
+      gammas.push_back(m.E[ig]);
+      mode << " " << m.E[ig]/units::MeV << " MeV";
     }
-    else {
+    table.modes  .push_back(mode.str());
+    table.gammas .push_back(gammas);
+    table.weights.push_back(P);
+    psum[key] += P;
+  }
+
+  map<int, DeExTable>::iterator it = fTables.begin();
+  for( ; it != fTables.end(); ++it) {
+    DeExTable & table = it->second;
+    table.weights[0] = TMath::Max(0., 1. - psum[it->first]);
+    table.sampler.Build(table.weights);
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+    for(unsigned int im = 0; im < table.modes.size(); im++) {
+      LOG("NucDeEx", pDEBUG)
+        << table.modes[im] << " : P = " << table.sampler.Probability(im);
     }
-  } //n-hole
+#endif
+  }
+}
+//___________________________________________________________________________
+int NucDeExcitationSim::TableKey(int Z, int hitnuc_pdgc) const
+{
+  return 2*Z + ((hitnuc_pdgc == kPdgProton) ? 1 : 0);
 }
 //___________________________________________________________________________
 void NucDeExcitationSim::AddPhoton(
@@ -5,6 +5,11 @@
 
 \brief    Generates nuclear de-excitation gamma rays
 
+          The de-excitation modes of each tabulated nucleus, for a proton
+          or a neutron hole, are built from a table of shell, excited state
+          and gamma ray branch probabilities at configuration and sampled
+          with an alias table.
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -22,9 +27,18 @@
 #ifndef _NUCLEAR_DEEXCITATION_H_
 #define _NUCLEAR_DEEXCITATION_H_
 
+#include <map>
+#include <string>
+#include <vector>
+
 #include <TLorentzVector.h>
 
 #include "Framework/EventGen/EventRecordVisitorI.h"
+#include "Framework/Numerical/AliasSampler.h"
+
+using std::map;
+using std::string;
+using std::vector;
 
 namespace genie {
 
@@ -38,11 +52,28 @@ public :
   //-- implement the EventRecordVisitorI interface
   void ProcessEventRecord (GHepRecord * evrec) const;
 
+  //-- override the Algorithm::Configure methods to load configuration
+  //   data to private data members
+  void Configure (const Registry & config);
+  void Configure (string config);
+
 private:
-  void           OxygenTargetSim      (GHepRecord * evrec) const;
+
+  //! de-excitation modes for a nucleus and hole
+  struct DeExTable {
+    vector<string>          modes;    ///< description of each mode
+    vector<vector<double> > gammas;   ///< gamma ray energies of each mode
+    vector<double>          weights;  ///< probability of each mode
+    AliasSampler            sampler;  ///< alias table of the modes
+  };
+
+  void           LoadConfig           (void);
+  int            TableKey             (int Z, int hitnuc_pdgc) const;
   void           AddPhoton            (GHepRecord * evrec, double E0, double t) const;
   double         PhotonEnergySmearing (double E0, double t) const;
   TLorentzVector Photon4P             (double E) const;
+
+  map<int, DeExTable> fTables;  ///< de-excitation modes per (Z, hole)
 };
 
 }      // genie namespace
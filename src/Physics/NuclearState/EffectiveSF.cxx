@@ -13,6 +13,7 @@
 
 #include <sstream>
 #include <cstdlib>
+#include <algorithm>
 #include <TMath.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
@@ -51,15 +52,15 @@ NuclearModelI("genie::EffectiveSF", config)
 //____________________________________________________________________________
 EffectiveSF::~EffectiveSF()
 {
-  map<string, TH1D*>::iterator iter = fProbDistroMap.begin();
-  for( ; iter != fProbDistroMap.begin(); ++iter) {
-    TH1D * hst = iter->second;
+  map<pair<int,int>, ProbTable>::iterator iter = fProbTables.begin();
+  for( ; iter != fProbTables.end(); ++iter) {
+    TH1D * hst = iter->second.fProb;
     if(hst) {
       delete hst;
       hst=0;
     }
   }
-  fProbDistroMap.clear();
+  fProbTables.clear();
 }
 //____________________________________________________________________________
 // Set the removal energy, 3 momentum, and FermiMover interaction type
@@ -74,14 +75,14 @@ bool EffectiveSF::GenerateNucleon(const Target & target) const
   //
 
   if ( target.A() > 1 ) {
-    TH1D * prob = this->ProbDistro(target);
-    if(!prob) {
+    const ProbTable * table = this->GetProbTable(target);
+    if(!table) {
       LOG("EffectiveSF", pNOTICE)
               << "Null nucleon momentum probability distribution";
       exit(1);
     }
 
-    double p = prob->GetRandom();
+    double p = this->SampleMomentum(*table);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
     LOG("EffectiveSF", pDEBUG) << "|p,nucleon| = " << p;
@@ -129,10 +130,11 @@ bool EffectiveSF::GenerateNucleon(const Target & target) const
 double EffectiveSF::Prob(double mom, double w, const Target & target) const
 {
   if(w < 0) {
-     TH1D * prob_distr = this->ProbDistro(target);
-     int bin = prob_distr->FindBin(mom);
-     double y  = prob_distr->GetBinContent(bin);
-     double dx = prob_distr->GetBinWidth(bin);
+     const ProbTable * table = this->GetProbTable(target);
+     if(!table) return 0;
+     int bin = table->fProb->FindBin(mom);
+     double y  = table->fProb->GetBinContent(bin);
+     double dx = table->fDp;
      double prob  = y * dx;
      return prob;
   }
@@ -140,13 +142,16 @@ double EffectiveSF::Prob(double mom, double w, const Target & target) const
 }
 //____________________________________________________________________________
 // Check the map of nucleons to see if we have a probability distribution to
-// compute with.  If not, make one.
+// compute with.  If not, make one, with the cdf used for sampling. The map is
+// keyed on pdg codes, so that no string is formatted per generated nucleon.
 //____________________________________________________________________________
-TH1D * EffectiveSF::ProbDistro(const Target & target) const
+const EffectiveSF::ProbTable * EffectiveSF::GetProbTable(
+  const Target & target) const
 {
   //-- return stored /if already computed/
-  map<string, TH1D*>::iterator it = fProbDistroMap.find(target.AsString());
-  if(it != fProbDistroMap.end()) return it->second;
+  pair<int,int> key(target.Pdg(), target.HitNucPdg());
+  map<pair<int,int>, ProbTable>::const_iterator it = fProbTables.find(key);
+  if(it != fProbTables.end()) return &(it->second);
 
   LOG("EffectiveSF", pNOTICE)
              << "Computing P = f(p_nucleon) for: " << target.AsString();
@@ -156,8 +161,44 @@ TH1D * EffectiveSF::ProbDistro(const Target & target) const
   //-- get information for the nuclear target
   int nucleon_pdgc = target.HitNucPdg();
   assert( pdg::IsProton(nucleon_pdgc) || pdg::IsNeutron(nucleon_pdgc) );
-  return this->MakeEffectiveSF(target);
-
+  TH1D * prob = this->MakeEffectiveSF(target);
+  if(!prob) return 0;
+
+  //-- tabulate the cdf of the bins
+  ProbTable & table = fProbTables[key];
+  table.fProb = prob;
+  table.fDp   = prob->GetBinWidth(1);
+  int nbins = prob->GetNbinsX();
+  table.fCDF.resize(nbins+1);
+  table.fCDF[0] = 0.;
+  for(int i = 1; i <= nbins; i++) {
+    table.fCDF[i] = table.fCDF[i-1] + prob->GetBinContent(i);
+  }
+  double sum = table.fCDF[nbins];
+  if(sum > 0) {
+    for(int i = 1; i <= nbins; i++) table.fCDF[i] /= sum;
+  }
+  return &table;
+}
+//____________________________________________________________________________
+// Samples |p| from the bin cdf, uniformly within the selected bin (as
+// TH1::GetRandom() would, but with the GENIE random number generators).
+//____________________________________________________________________________
+double EffectiveSF::SampleMomentum(const ProbTable & table) const
+{
+  const vector<double> & cdf = table.fCDF;
+  int nbins = cdf.size() - 1;
+  if(nbins < 1 || cdf[nbins] <= 0) return 0;
+
+  double r = RandomGen::Instance()->RndGen().Rndm();
+  int ibin = std::upper_bound(cdf.begin(), cdf.end(), r) - cdf.begin() - 1;
+  if(ibin < 0)      ibin = 0;
+  if(ibin >= nbins) ibin = nbins - 1;
+
+  double p = table.fDp * ibin;
+  double dc = cdf[ibin+1] - cdf[ibin];
+  if(dc > 0) p += table.fDp * (r - cdf[ibin]) / dc;
+  return p;
 }
 //____________________________________________________________________________
 // If transverse enhancement form factor modification is enabled, we must
@@ -186,7 +227,7 @@ TH1D * EffectiveSF::MakeEffectiveSF(const Target & target) const
   if(it != fProbDistParams.end()) {
     vector<double> v = it->second;
     return this->MakeEffectiveSF(v[0], v[1], v[2], v[3],
-                                 v[4], v[5], v[6], target);
+                                 v[4], v[5], v[6]);
   }
 
   // Then check in the ranges of A
@@ -195,19 +236,18 @@ TH1D * EffectiveSF::MakeEffectiveSF(const Target & target) const
     if (target.A() >= range_it->first.first && target.A() <= range_it->first.second) {
       vector<double> v = range_it->second;
       return this->MakeEffectiveSF(v[0], v[1], v[2], v[3],
-                                   v[4], v[5], v[6], target);
+                                   v[4], v[5], v[6]);
     }
   }
 
   return NULL;
 }
 //____________________________________________________________________________
-// Makes a momentum distribution using the factors below (see reference) and
-// inserts it into the nucleus/momentum distribution map.
+// Makes a momentum distribution using the factors below (see reference).
 //____________________________________________________________________________
 TH1D * EffectiveSF::MakeEffectiveSF(double bs, double bp, double alpha,
                                     double beta, double c1, double c2,
-                                    double c3, const Target & target) const
+                                    double c3) const
 {
   //-- create the probability distribution
   int npbins = (int) (1000 * fPMax);
@@ -237,9 +277,6 @@ TH1D * EffectiveSF::MakeEffectiveSF(double bs, double bp, double alpha,
   //-- normalize the probability distribution
   prob->Scale( 1.0 / prob->Integral("width") );
 
-  //-- store
-  fProbDistroMap.insert(
-      map<string, TH1D*>::value_type(target.AsString(),prob));
   return prob;
 }
 //____________________________________________________________________________
@@ -22,6 +22,7 @@
 #define _EFFECTIVE_SF_H_
 
 #include <map>
+#include <vector>
 
 #include <TH1D.h>
 
@@ -55,13 +56,20 @@ public:
   void Configure (string param_set);
 
 private:
-  TH1D * ProbDistro (const Target & t) const;
+  //! the tabulated momentum distribution of a target & hit nucleon
+  struct ProbTable {
+    TH1D *         fProb; ///< dP/dp
+    vector<double> fCDF;  ///< cumulative bin probabilities, fCDF[0] = 0
+    double         fDp;   ///< bin width
+  };
+
+  const ProbTable * GetProbTable (const Target & t) const;
+  double            SampleMomentum (const ProbTable & table) const;
 
   TH1D * MakeEffectiveSF(const Target & target) const;
 
   TH1D * MakeEffectiveSF(double bs, double bp, double alpha, double beta,
-                         double c1, double c2, double c3,
-                         const Target & target) const;
+                         double c1, double c2, double c3) const;
 
   double ReturnBindingEnergy(const Target & target) const;
   double GetTransEnh1p1hMod(const Target& target) const;
@@ -69,7 +77,7 @@ private:
   double Returnf1p1h(const Target & target) const;
   void   LoadConfig (void);
 
-  mutable map<string, TH1D *> fProbDistroMap;
+  mutable map<pair<int,int>, ProbTable> fProbTables; ///< (target, hit nucleon) -> table
   double fPMax;
   double fPCutOff;
   bool   fEjectSecondNucleon2p2h;
@@ -14,6 +14,8 @@
 */
 //____________________________________________________________________________
 
+#include <mutex>
+
 #include <TMath.h>
 
 #include "Framework/Messenger/Messenger.h"
@@ -22,6 +24,11 @@
 
 using namespace genie;
 
+//____________________________________________________________________________
+namespace {
+  // guards the cache of resolved table entries, as the tables are shared
+  std::mutex gKFCacheMutex;
+}
 //____________________________________________________________________________
 FermiMomentumTable::FermiMomentumTable()
 {
@@ -40,14 +47,13 @@ FermiMomentumTable::~FermiMomentumTable()
 void FermiMomentumTable::AddTableEntry(int tgt_pdgc, KF_t kf)
 {
   fKFSets.insert(map<int, KF_t>::value_type(tgt_pdgc, kf));
+
+  std::lock_guard<std::mutex> lock(gKFCacheMutex);
+  fClosestKF.clear();
 }
 //____________________________________________________________________________
 double FermiMomentumTable::FindClosestKF(int tgt_pdgc, int nucleon_pdgc) const
 {
-  LOG("FermiP", pINFO)
-       << "Finding Fermi momenta table entry for (tgt = "
-                      << tgt_pdgc << ", nucl = " << nucleon_pdgc << ")";
-
   if(fKFSets.size()==0) {
       LOG("FermiP", pWARN)
          << "The Fermi momenta table is empty! Returning kf(tgt = "
@@ -55,21 +61,37 @@ double FermiMomentumTable::FindClosestKF(int tgt_pdgc, int nucleon_pdgc) const
       return 0;
   }
 
-  double kf=0;
-  bool isp = pdg::IsProton(nucleon_pdgc);
+  const KF_t & kft = this->ClosestEntry(tgt_pdgc);
+  return (pdg::IsProton(nucleon_pdgc)) ? kft.p : kft.n;
+}
+//____________________________________________________________________________
+const KF_t & FermiMomentumTable::ClosestEntry(int tgt_pdgc) const
+{
+// Returns the table entry for the input target, or for the closest (in Z)
+// nucleus in the table if there is no exact match. Entries are only ever
+// added to the cache, so the returned reference remains valid.
+
+  std::lock_guard<std::mutex> lock(gKFCacheMutex);
+
+  unordered_map<int, KF_t>::const_iterator cached = fClosestKF.find(tgt_pdgc);
+  if(cached != fClosestKF.end()) return cached->second;
 
-  if(fKFSets.count(tgt_pdgc) == 1) {
+  LOG("FermiP", pINFO)
+       << "Finding Fermi momenta table entry for tgt = " << tgt_pdgc;
+
+  map<int, KF_t>::const_iterator table_iter = fKFSets.find(tgt_pdgc);
+  if(table_iter != fKFSets.end()) {
      LOG("FermiP", pDEBUG) << "Got exact match in Fermi momenta table";
-     map<int, KF_t>::const_iterator table_iter = fKFSets.find(tgt_pdgc);
-     if(isp) kf = table_iter->second.p;
-     else    kf = table_iter->second.n;
-     LOG("FermiP", pINFO) << "kF = " << kf;
-     return kf;
+     return fClosestKF.insert(
+        unordered_map<int, KF_t>::value_type(tgt_pdgc, table_iter->second)).first->second;
   }
   LOG("FermiP", pINFO) << "Couldn't find exact match in Fermi momenta table";
 
   int  Z   = pdg::IonPdgCodeToZ(tgt_pdgc);
   int    Ac=9999, Zc=9999, dZmin=9999;
+  KF_t kf;
+  kf.p = 0;
+  kf.n = 0;
   map<int, KF_t>::const_iterator kfiter;
   for(kfiter=fKFSets.begin(); kfiter!=fKFSets.end(); ++kfiter) {
     int pdgc = kfiter->first;
@@ -79,14 +101,14 @@ double FermiMomentumTable::FindClosestKF(int tgt_pdgc, int nucleon_pdgc) const
       dZmin = dZ;
       Zc = Zt;
       Ac = pdg::IonPdgCodeToA(pdgc);
-      KF_t kft  = kfiter->second;
-      if(isp) kf=kft.p;
-      else    kf=kft.n;
+      kf = kfiter->second;
     }
   }
   LOG("FermiP", pINFO)
-       << "The closest nucleus in table is pdgc = " << pdg::IonPdgCode(Ac,Zc);
-  LOG("FermiP", pINFO) << "kF = " << kf;
-  return kf;
+       << "The closest nucleus in table is pdgc = " << pdg::IonPdgCode(Ac,Zc)
+       << ": kF(p) = " << kf.p << ", kF(n) = " << kf.n;
+
+  return fClosestKF.insert(
+      unordered_map<int, KF_t>::value_type(tgt_pdgc, kf)).first->second;
 }
 //____________________________________________________________________________
@@ -5,6 +5,10 @@
 
 \brief    A table of Fermi momentum constants
 
+          The table entry used for each target (the exact or the closest
+          match) is resolved at the first look-up and cached, so repeated
+          look-ups for the same target cost a single hash table search.
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -20,8 +24,10 @@
 #define _FERMI_MOMENTUM_TABLE_H_
 
 #include <map>
+#include <unordered_map>
 
 using std::map;
+using std::unordered_map;
 
 namespace genie {
 
@@ -41,7 +47,10 @@ public:
   void   AddTableEntry (int target_pdgc, KF_t kf);
 
 private:
+  const KF_t & ClosestEntry (int target_pdgc) const;
+
   map<int, KF_t> fKFSets; // the actual Fermi momenta table
+  mutable unordered_map<int, KF_t> fClosestKF; // resolved entry per target
 };
 
 }      // genie namespace
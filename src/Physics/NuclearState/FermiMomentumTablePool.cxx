@@ -80,16 +80,16 @@ const FermiMomentumTable * FermiMomentumTablePool::GetTable(string name)
   map<string, FermiMomentumTable *>::const_iterator table_iter;
   FermiMomentumTable * table = 0;
 
-  if(fKFSets.count(name) == 1) {
-     table_iter = fKFSets.find(name);
+  table_iter = fKFSets.find(name);
+  if(table_iter != fKFSets.end()) {
      table = table_iter->second;
      if(table) return table;
   }
-  if(fKFSets.count(defopt) == 1) {
+  table_iter = fKFSets.find(defopt);
+  if(table_iter != fKFSets.end()) {
      LOG("FermiP", pWARN)
          << "Fermi momentum table: [" << name << "] was not found! "
                                << "Switching to table: [" << defopt << "]";
-     table_iter = fKFSets.find(defopt);
      table = table_iter->second;
      if(table) return table;
   }
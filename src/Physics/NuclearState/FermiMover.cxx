@@ -42,7 +42,6 @@
 
 #include "Physics/NuclearState/NuclearModel.h"
 #include "Physics/NuclearState/NuclearModelI.h"
-#include "Framework/EventGen/EVGThreadException.h"
 #include "Framework/GHEP/GHepRecord.h"
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/GHEP/GHepStatus.h"
@@ -89,6 +88,7 @@ void FermiMover::ProcessEventRecord(GHepRecord * evrec) const
 
   // give hit nucleon a Fermi momentum
   this->KickHitNucleon(evrec);
+  if(evrec->IsRejected()) return;
 
   // add a recoiled nucleus remnant
   this->AddTargetNucleusRemnant(evrec);
@@ -247,11 +247,9 @@ void FermiMover::KickHitNucleon(GHepRecord * evrec) const
      LOG("FermiMover", pNOTICE)
               << "Ev (@ nucleon rest frame) = " << Ev << ", Ethr = " << Ethr;
 
-     evrec->EventFlags()->SetBitNumber(kBelowThrNRF, true);
-     genie::exceptions::EVGThreadException exception;
-     exception.SetReason("E < Ethr after generating nucleon Fermi momentum");
-     exception.SwitchOnFastForward();
-     throw exception;
+     // E < Ethr after generating nucleon Fermi momentum
+     evrec->Reject(kBelowThrNRF);
+     return;
   }
   if(eject_nucleon_pdg != 0) {
     this->Emit2ndNucleonFromSRC(evrec, eject_nucleon_pdg);
@@ -31,6 +31,10 @@ using namespace genie;
 using namespace genie::constants;
 using namespace genie::utils;
 
+//____________________________________________________________________________
+namespace {
+  const int kNPBinsPerGeV = 1000; // momentum bins used by Prob()
+}
 //____________________________________________________________________________
 LocalFGM::LocalFGM() :
 NuclearModelI("genie::LocalFGM")
@@ -59,14 +63,8 @@ bool LocalFGM::GenerateNucleon(const Target & target,
 
   //-- set fermi momentum vector
   //
-  TH1D * prob = this->ProbDistro(target,hitNucleonRadius);
-  if(!prob) {
-    LOG("LocalFGM", pNOTICE)
-              << "Null nucleon momentum probability distribution";
-    exit(1);
-  }
-  double p = prob->GetRandom();
-  delete prob;
+  double KF = this->LocalFermiMomentum(target,hitNucleonRadius);
+  double p  = this->GenerateMomentum(KF);
   LOG("LocalFGM", pINFO) << "|p,nucleon| = " << p;
 
   RandomGen * rnd = RandomGen::Instance();
@@ -97,26 +95,20 @@ double LocalFGM::Prob(double p, double w, const Target & target,
 			     double hitNucleonRadius) const
 {
   if(w<0) {
-    TH1D * prob = this->ProbDistro(target, hitNucleonRadius);
-    int bin = prob->FindBin(p);
-    double y  = prob->GetBinContent(bin);
-    double dx = prob->GetBinWidth(bin);
-    double pr  = y*dx;
-    delete prob;
-    return pr;
+    // probability of the momentum bin (of the binning the distribution
+    // used to be tabulated in) containing p
+    if(p < 0 || p >= fPMax) return 0;
+    int    npbins = TMath::Max(1, (int) (kNPBinsPerGeV*fPMax));
+    double dx     = fPMax / npbins;
+    double pc     = (TMath::Floor(p/dx) + 0.5) * dx;
+    double KF     = this->LocalFermiMomentum(target, hitNucleonRadius);
+    return this->MomentumDensity(pc, KF) * dx;
   }
   return 1;
 }
 //____________________________________________________________________________
-// *** The TH1D object must be deleted after it is used ***
-TH1D * LocalFGM::ProbDistro(const Target & target, double r) const
+double LocalFGM::LocalFermiMomentum(const Target & target, double r) const
 {
-  LOG("LocalFGM", pNOTICE)
-             << "Computing P = f(p_nucleon) for: " << target.AsString()
-	     << ", Nucleon Radius = " << r;
-  LOG("LocalFGM", pNOTICE)
-             << ", P(max) = " << fPMax;
-
   //-- get information for the nuclear target
   int nucleon_pdgc = target.HitNucPdg();
   assert(pdg::IsProton(nucleon_pdgc) || pdg::IsNeutron(nucleon_pdgc));
@@ -131,56 +123,69 @@ TH1D * LocalFGM::ProbDistro(const Target & target, double r) const
   double KF= TMath::Power(3*kPi2*numNuc*genie::utils::nuclear::Density(r,A),
 			    1.0/3.0) *hbarc;
 
-  LOG("LocalFGM",pNOTICE) << "KF = " << KF;
-
-  double a  = 2.0;
-  double C  = 4. * kPi * TMath::Power(KF,3) / 3.;
-
-  // Do not include nucleon correlation tail
-  //double R  = 1. / (1.- KF/4.);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("LocalFGM", pDEBUG) << "a  = " << a;
-  LOG("LocalFGM", pDEBUG) << "C  = " << C;
-  //LOG("LocalFGM", pDEBUG) << "R  = " << R;
+  LOG("LocalFGM", pDEBUG)
+     << "KF = " << KF << " for: " << target.AsString()
+     << ", Nucleon Radius = " << r;
 #endif
 
-  //-- create the probability distribution
-
-  int npbins = (int) (1000*fPMax);
-  TH1D * prob = new TH1D("", "", npbins, 0, fPMax);
-  prob->SetDirectory(0);
+  return KF;
+}
+//____________________________________________________________________________
+void LocalFGM::MomentumWeights(double KF, double & wfg, double & wsrc) const
+{
+// Integrals over [0, fPMax] of the Fermi gas (p <= KF) and of the correlated
+// nucleon tail (KF < p < fPCutOff) parts of the momentum distribution.
+// Use expression with fSRC_Fraction to allow the possibility of using the
+// Correlated Fermi Gas Model with a high momentum tail: |phi(p)|^2 is
+// constant below KF and falls as 1/p^4 above it.
+
+  double pfg = TMath::Min(KF, fPMax);
+  wfg  = (1 - fSRC_Fraction) * TMath::Power(pfg/KF, 3.);
+  wsrc = (KF < fPCutOff) ? fSRC_Fraction : 0.;
+}
+//____________________________________________________________________________
+double LocalFGM::MomentumDensity(double p, double KF) const
+{
+// Normalized probability density dProbability/dp = 4*pi * p^2 * |phi(p)|^2
 
-  double dp = fPMax / (npbins-1);
-//  double iC = (C>0) ? 1./C : 0.; // unused variables
-//  double kfa_pi_2 = TMath::Power(KF*a/kPi,2); // unused variables
+  if(p < 0 || p > fPMax || KF <= 0) return 0;
 
-  for(int i = 0; i < npbins; i++) {
-     double p  = i * dp;
-     double p2 = TMath::Power(p,2);
+  double wfg = 0, wsrc = 0;
+  this->MomentumWeights(KF, wfg, wsrc);
+  double norm = wfg + wsrc;
+  if(norm <= 0) return 0;
 
-     // use expression with fSRC_Fraction to allow the possibility of 
-     // using the Correlated Fermi Gas Model with a high momentum tail
+  double dP_dp = 0;
+  if (p <= KF) {
+     dP_dp = 3 * p*p / TMath::Power(KF,3.) * (1 - fSRC_Fraction);
+  } else if (p < fPCutOff) {
+     dP_dp = fSRC_Fraction / (1./KF - 1./fPCutOff) / (p*p);
+  }
+  return dP_dp / norm;
+}
+//____________________________________________________________________________
+double LocalFGM::GenerateMomentum(double KF) const
+{
+// Generate |p| by inverting the cumulative distribution of MomentumDensity():
+// p^3 is uniform in the Fermi gas part and 1/p is uniform in the tail
 
-     // calculate |phi(p)|^2
-     double phi2 = 0;
-        if (p <= KF){
-            phi2 = (1./(4*kPi)) * (3/TMath::Power(KF,3.)) * ( 1 - fSRC_Fraction );
-        }else if( p > KF && p < fPCutOff ){
-            phi2 = (1./(4*kPi)) * ( fSRC_Fraction / (1./KF - 1./fPCutOff) ) / TMath::Power(p,4.);
-        }
+  if(KF <= 0) return 0;
 
-     // calculate probability density : dProbability/dp
-     double dP_dp = 4*kPi * p2 * phi2;
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-     LOG("LocalFGM", pDEBUG) << "p = " << p << ", dP/dp = " << dP_dp;
-#endif
-     prob->Fill(p, dP_dp);
-  }
+  double wfg = 0, wsrc = 0;
+  this->MomentumWeights(KF, wfg, wsrc);
+  double norm = wfg + wsrc;
+  if(norm <= 0) return 0;
 
-  //-- normalize the probability distribution
-  prob->Scale( 1.0 / prob->Integral("width") );
+  RandomGen * rnd = RandomGen::Instance();
+  double u = norm * rnd->RndGen().Rndm();
 
-  return prob;
+  if(u < wfg) {
+     double pfg = TMath::Min(KF, fPMax);
+     return pfg * TMath::Power(u/wfg, 1./3.);
+  }
+  double x = (u - wfg) / wsrc;
+  return 1. / (1./KF - x * (1./KF - 1./fPCutOff));
 }
 //____________________________________________________________________________
 void LocalFGM::Configure(const Registry & config)
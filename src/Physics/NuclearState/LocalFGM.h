@@ -6,6 +6,11 @@
 \brief    local Fermi gas model. Implements the NuclearModelI 
           interface.
 
+          The nucleon momentum distribution depends on the position of the
+          hit nucleon only through the local Fermi momentum, and is sampled
+          by inverting its (analytical) cumulative distribution, so that no
+          histogram is built per generated nucleon.
+
 \ref      
 
 \author   Joe Johnston, Steven Dytman
@@ -23,8 +28,6 @@
 
 #include <map>
 
-#include <TH1D.h>
-
 #include "Physics/NuclearState/NuclearModelI.h"
 
 using std::map;
@@ -64,8 +67,11 @@ public:
   void Configure (string param_set)
 ;
 private:
-  void   LoadConfig (void);
-  TH1D * ProbDistro (const Target & t, double r) const;
+  void   LoadConfig         (void);
+  double LocalFermiMomentum (const Target & t, double r) const;
+  double MomentumDensity    (double p, double KF) const;
+  double GenerateMomentum   (double KF) const;
+  void   MomentumWeights    (double KF, double & wfg, double & wsrc) const;
 
   map<int, double> fNucRmvE;
 
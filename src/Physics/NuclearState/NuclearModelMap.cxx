@@ -123,6 +123,9 @@ void NuclearModelMap::LoadConfig(void)
 {
 
   fDefGlobModel = 0;
+  fRefinedModels.clear();
+  fModelByZ.clear();
+
   // load default global model (should work for all nuclei)
   RgAlg dgmodel ;
   GetParam( "NuclearModel", dgmodel ) ;
@@ -158,6 +161,15 @@ void NuclearModelMap::LoadConfig(void)
     }
   }
 
+  // resolve the model for each element, so that selecting the model for
+  // a target (done several times per event) is a single vector look-up
+  int Zmax = (fRefinedModels.empty()) ? -1 : fRefinedModels.rbegin()->first;
+  fModelByZ.assign(Zmax+1, fDefGlobModel);
+  for (map<int,const NuclearModelI*>::const_iterator it = fRefinedModels.begin();
+      it != fRefinedModels.end(); ++it) {
+    if(it->first >= 0) fModelByZ[it->first] = it->second;
+  }
+
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   for (map<int,const NuclearModelI*>::iterator it = fRefinedModels.begin();
       it != fRefinedModels.end(); ++it) {
@@ -172,9 +184,7 @@ const NuclearModelI * NuclearModelMap::SelectModel(const Target & t) const
 {
   int Z = t.Z();
 
-  map<int,const NuclearModelI*>::const_iterator it = fRefinedModels.find(Z);
-
-  if(it != fRefinedModels.end()) return it->second;
+  if(Z >= 0 && Z < (int)fModelByZ.size()) return fModelByZ[Z];
   else return fDefGlobModel;
 }
 //____________________________________________________________________________
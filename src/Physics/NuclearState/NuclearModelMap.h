@@ -6,6 +6,8 @@
 \brief    This class is a hook for  nuclear models and allows associating each
           one of them with specific nuclei.
           Is a concrete implementation of the NuclearModelI interface.
+          The model to use for each element is resolved at configuration
+          and looked up by Z.
 
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
@@ -22,9 +24,11 @@
 #define _NUCLEAR_MODEL_MAP_H_
 
 #include <map>
+#include <vector>
 #include "Physics/NuclearState/NuclearModelI.h"
 
 using std::map;
+using std::vector;
 
 namespace genie {
 
@@ -64,6 +68,7 @@ private:
 
   const NuclearModelI * fDefGlobModel;            ///< default basic model (should work for all nuclei)
   map<int, const NuclearModelI *> fRefinedModels; ///< refinements for specific elements
+  vector<const NuclearModelI *>   fModelByZ;      ///< model to use for each Z, up to the largest refined Z
 };
 
 }      // genie namespace
@@ -35,6 +35,9 @@
 //____________________________________________________________________________
 
 #include <cstdlib>
+#include <atomic>
+#include <mutex>
+#include <vector>
 
 #include <TMath.h>
 
@@ -51,9 +54,29 @@
 #include "Physics/NuclearState/NuclearUtils.h"
 #include "Physics/NuclearState/NuclearModelI.h"
 
+using std::vector;
 using namespace genie;
 using namespace genie::constants;
 
+//____________________________________________________________________________
+// Radial density tables of the nuclei (see Density())
+namespace {
+
+  const int    kDensityTableMaxA = 300;
+  const double kDensityTableDr   = 0.005; // fm
+
+  struct DensityTable_t {
+    double         rmax; ///< tabulated range: [0, rmax) fm
+    vector<double> rho;  ///< density at r = i*kDensityTableDr (fm^-3)
+  };
+
+  std::atomic<const DensityTable_t *> gDensityTables[kDensityTableMaxA+1];
+  std::mutex                          gDensityTablesMutex;
+
+  double DensityCalc (double r, int A, double ring);
+  const DensityTable_t * DensityTable (int A);
+}
+
 
 //____________________________________________________________________________
 double genie::utils::nuclear::BindEnergy(const Target & target)
@@ -388,6 +411,27 @@ double genie::utils::nuclear::Density(double r, int A, double ring)
 {
 // [by S.Dytman]
 //
+// Without a ring (ie. anywhere but in hadron transport) the density is
+// interpolated in a radial table of the nucleus, built at its first use and
+// spanning the radii where the density is not negligible.
+
+  if(ring == 0. && A > 0 && A <= kDensityTableMaxA && r >= 0.) {
+    const DensityTable_t * table = DensityTable(A);
+    if(r < table->rmax) {
+      double u  = r / kDensityTableDr;
+      int    i  = (int) u;
+      double r0 = table->rho[i];
+      return r0 + (u-i) * (table->rho[i+1] - r0);
+    }
+  }
+  return DensityCalc(r, A, ring);
+}
+//___________________________________________________________________________
+namespace {
+double DensityCalc(double r, int A, double ring)
+{
+  using namespace genie::utils::nuclear;
+
   if(A>20) {
     double c = 1., z = 1.;
 
@@ -430,6 +474,35 @@ double genie::utils::nuclear::Density(double r, int A, double ring)
   return 0;
 }
 //___________________________________________________________________________
+const DensityTable_t * DensityTable(int A)
+{
+  const DensityTable_t * table = gDensityTables[A].load(std::memory_order_acquire);
+  if(table) return table;
+
+  std::lock_guard<std::mutex> lock(gDensityTablesMutex);
+  table = gDensityTables[A].load(std::memory_order_relaxed);
+  if(table) return table;
+
+  // by the end of the table, the density has fallen by at least e^-20
+  // (Woods-Saxon: c + 20z) or e^-25 (harmonic oscillator: 5a) from its
+  // central value, for all the parameter values used in DensityCalc()
+  double rmax = 0;
+  if     (A > 20) rmax = TMath::Max(6.62, TMath::Power(A,0.35)) + 20*0.56;
+  else if(A >  4) rmax = 5*1.83;
+  else            rmax = 5*1.9/TMath::Sqrt(2.);
+
+  DensityTable_t * t = new DensityTable_t;
+  int n   = (int) (rmax / kDensityTableDr) + 1;
+  t->rmax = (n-1) * kDensityTableDr;
+  t->rho.resize(n+1);
+  for(int i = 0; i <= n; i++) {
+    t->rho[i] = DensityCalc(i*kDensityTableDr, A, 0.);
+  }
+  gDensityTables[A].store(t, std::memory_order_release);
+  return t;
+}
+}
+//___________________________________________________________________________
 double genie::utils::nuclear::DensityGaus(
                              double r, double a, double alf, double ring)
 {
@@ -15,6 +15,8 @@
 */
 //____________________________________________________________________________
 
+#include <cmath>
+
 #include <TLorentzVector.h>
 #include <TVector3.h>
 
@@ -22,7 +24,6 @@
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/Units.h"
-#include "Framework/EventGen/EVGThreadException.h"
 #include "Physics/NuclearState/PauliBlocker.h"
 
 #include "Physics/NuclearState/NuclearModel.h"
@@ -101,29 +102,24 @@ void PauliBlocker::ProcessEventRecord(GHepRecord * evrec) const
    // check for pauli blocking
   bool is_blocked = (p < kf);
 
-  // if it is blocked, set & thow an exception
+  // if it is blocked, step back (QEL) or reject the event
   if ( is_blocked ) {
     LOG("PauliBlock", pNOTICE)
       << " *** The generated event is Pauli-blocked ("
       << "|p_{nucleon}| = " << p << " GeV < Fermi momentum = " << kf << " GeV) ***";
 
-    evrec->EventFlags()->SetBitNumber(kPauliBlock, true);
-    genie::exceptions::EVGThreadException exception;
-    exception.SetReason("Pauli-blocked event");
-
     // Include dark matter elastic
     if(proc.IsQuasiElastic() || proc.IsDarkMatterElastic()) {
       // nuclear suppression taken into account at the QEL cross
       // section - should attempt to regenerate the event as QEL
-      exception.SwitchOnStepBack();
-      exception.SetReturnStep(0);
-    } else {
-      // end this event generation thread and start again at the
-      // interaction selection step
-      // - this is irrelevant for the time being as we only handle QEL-
-      exception.SwitchOnFastForward();
+      evrec->StepBack(kPauliBlock, 0);
+      return;
     }
-    throw exception;
+    // end this event generation thread and start again at the
+    // interaction selection step
+    // - this is irrelevant for the time being as we only handle QEL-
+    evrec->Reject(kPauliBlock);
+    return;
   }
 }
 //___________________________________________________________________________
@@ -153,6 +149,8 @@ void PauliBlocker::LoadModelType(void){
   // Check if the model is a local Fermi gas
   fLFG = (nuclModel && nuclModel->ModelType(Target()) == kNucmLocalFermiGas);
 
+  fKFCache.clear();
+
   if ( !fLFG ) {
     // get the Fermi momentum table for relativistic Fermi gas
 	GetParam( "FermiMomentumTable", fKFTableName ) ;
@@ -170,17 +168,30 @@ double PauliBlocker::GetFermiMomentum(const Target& tgt, int pdg_Nf,
 {
   // Pauli blocking should only be applied for nucleons
   assert( pdg::IsProton(pdg_Nf) || pdg::IsNeutron(pdg_Nf) );
+
+  // The per target & nucleon part is computed at the first request only
+  std::pair<int,int> key(tgt.Pdg(), pdg_Nf);
+  std::map<std::pair<int,int>, double>::const_iterator it = fKFCache.find(key);
   double kF = 0.;
-  if ( fLFG ) {
-    int A = tgt.A();
-    bool is_p = pdg::IsProton( pdg_Nf );
-    int numNuc = (is_p) ? tgt.Z() : tgt.N();
-    double hbarc = kLightSpeed * kPlankConstant / units::fermi;
-    kF = TMath::Power(3 * kPi2 * numNuc *
-      genie::utils::nuclear::Density(radius, A), 1.0/3.0) * hbarc;
+  if ( it != fKFCache.end() ) {
+    kF = it->second;
   }
   else {
-    kF = fKFTable->FindClosestKF(tgt.Pdg(), pdg_Nf);
+    if ( fLFG ) {
+      bool is_p = pdg::IsProton( pdg_Nf );
+      int numNuc = (is_p) ? tgt.Z() : tgt.N();
+      double hbarc = kLightSpeed * kPlankConstant / units::fermi;
+      kF = std::pow(3 * kPi2 * numNuc, 1.0/3.0) * hbarc;
+    }
+    else {
+      kF = fKFTable->FindClosestKF(tgt.Pdg(), pdg_Nf);
+    }
+    fKFCache[key] = kF;
+  }
+
+  if ( fLFG ) {
+    // the density is interpolated from the tables of utils::nuclear
+    kF *= std::cbrt( genie::utils::nuclear::Density(radius, tgt.A()) );
   }
 
   return kF;
@@ -26,6 +26,8 @@
 #ifndef _PAULI_BLOCKER_H_
 #define _PAULI_BLOCKER_H_
 
+#include <map>
+
 #include "Framework/EventGen/EventRecordVisitorI.h"
 #include "Framework/Interaction/Target.h"
 
@@ -42,6 +44,7 @@ public :
 
   //-- implement the EventRecordVisitorI interface
   void ProcessEventRecord(GHepRecord * event_rec) const;
+  bool MayStepBack       (void) const { return true; }
 
   //-- override the Algorithm::Configure methods to load configuration
   //   data to private data members
@@ -58,6 +61,10 @@ private:
    bool fLFG;
    const FermiMomentumTable * fKFTable;
    string fKFTableName;
+
+   /// (target pdg, nucleon pdg) -> the Fermi momentum (RFG), or
+   /// hbarc*(3 pi^2 N)^(1/3), to be multiplied by cbrt(density(r)) (LFG)
+   mutable std::map<std::pair<int,int>, double> fKFCache;
 };
 
 }      // genie namespace
@@ -15,6 +15,9 @@
 */
 //____________________________________________________________________________
 
+#include <algorithm>
+#include <set>
+
 #include <TSystem.h>
 #include <TNtupleD.h>
 #include <TGraph2D.h>
@@ -27,34 +30,38 @@
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/Numerical/RandomGen.h"
 
+using std::set;
+
 using namespace genie;
 using namespace genie::constants;
 using namespace genie::controls;
 
+namespace {
+  // number of nodes of the grids the spectral functions are resampled on,
+  // if the input tables are not regular grids themselves
+  const int kNSFGridNodes = 101;
+}
 //____________________________________________________________________________
 SpectralFunc::SpectralFunc() :
 NuclearModelI("genie::SpectralFunc")
 {
-  fSfFe56 = 0;
-  fSfC12  = 0;
+
 }
 //____________________________________________________________________________
 SpectralFunc::SpectralFunc(string config) :
 NuclearModelI("genie::SpectralFunc", config)
 {
-  fSfFe56 = 0;
-  fSfC12  = 0;
+
 }
 //____________________________________________________________________________
 SpectralFunc::~SpectralFunc()
 {
-//if (fSfFe56) delete fSfFe56;
-//if (fSfC12 ) delete fSfC12;
+
 }
 //____________________________________________________________________________
 bool SpectralFunc::GenerateNucleon(const Target & target) const
 {
-  TGraph2D * sf = this->SelectSpectralFunction(target);
+  const SFGrid * sf = this->SelectSpectralFunction(target);
 
   if(!sf) {
     fCurrRemovalEnergy = 0.;
@@ -62,20 +69,25 @@ bool SpectralFunc::GenerateNucleon(const Target & target) const
     return false;
   }
 
-  double kmin    = sf->GetXmin(); // momentum range
-  double kmax    = sf->GetXmax();
-  double wmin    = sf->GetYmin(); // removal energy range
-  double wmax    = sf->GetYmax();
-  double probmax = sf->GetZmax(); // maximum probability
-  probmax *= 1.1;
+  const vector<double> & cdf = sf->cdf;
+  int nwc = sf->nw - 1;
 
-  double dk = kmax - kmin;
-  double dw = wmax - wmin;
+  RandomGen * rnd = RandomGen::Instance();
 
-  LOG("SpectralFunc", pINFO) << "Momentum range = ["   << kmin << ", " << kmax << "]"; 
-  LOG("SpectralFunc", pINFO) << "Rmv energy range = [" << wmin << ", " << wmax << "]";
+  // select a (momentum, removal energy) cell
+  double x = cdf.back() * rnd->RndGen().Rndm();
+  int icell = std::upper_bound(cdf.begin(), cdf.end(), x) - cdf.begin();
+  icell = TMath::Min(icell, (int)cdf.size() - 1);
+  int i = icell / nwc;
+  int j = icell % nwc;
 
-  RandomGen * rnd = RandomGen::Instance();
+  // select a point within the cell from the bilinear interpolation of the
+  // spectral function
+  double p00 = sf->prob[ i   *sf->nw + j  ];
+  double p01 = sf->prob[ i   *sf->nw + j+1];
+  double p10 = sf->prob[(i+1)*sf->nw + j  ];
+  double p11 = sf->prob[(i+1)*sf->nw + j+1];
+  double probmax = TMath::Max( TMath::Max(p00,p01), TMath::Max(p10,p11) );
 
   unsigned int niter = 0;
   while(1) {
@@ -86,17 +98,16 @@ bool SpectralFunc::GenerateNucleon(const Target & target) const
     }
     niter++;
 
-    // random pair
-    double kc = kmin + dk * rnd->RndGen().Rndm();
-    double wc = wmin + dw * rnd->RndGen().Rndm();
-    LOG("SpectralFunc", pINFO) << "Trying p = " << kc << ", w = " << wc;
-
-    // accept/reject
-    double prob  = this->Prob(kc,wc, target);
+    double u = rnd->RndGen().Rndm();
+    double v = rnd->RndGen().Rndm();
+    double prob = (1-u)*(1-v)*p00 + (1-u)*v*p01 + u*(1-v)*p10 + u*v*p11;
     double probg = probmax * rnd->RndGen().Rndm();
     bool accept = (probg < prob);
     if(!accept) continue;
 
+    double kc = sf->kmin + (i+u) * sf->dk;
+    double wc = sf->wmin + (j+v) * sf->dw;
+
     LOG("SpectralFunc", pINFO) << "|p,nucleon| = " << kc; 
     LOG("SpectralFunc", pINFO) << "|w,nucleon| = " << wc;
 
@@ -123,10 +134,28 @@ bool SpectralFunc::GenerateNucleon(const Target & target) const
 double SpectralFunc::Prob(
                          double p, double w, const Target & target) const
 {
-  TGraph2D * sf = this->SelectSpectralFunction(target);
+  const SFGrid * sf = this->SelectSpectralFunction(target);
   if(!sf) return 0;
 
-  return sf->Interpolate(p,w);
+  return this->Interpolate(*sf, p, w);
+}
+//____________________________________________________________________________
+double SpectralFunc::Interpolate(
+                         const SFGrid & sf, double k, double w) const
+{
+  double x = (k - sf.kmin) / sf.dk;
+  double y = (w - sf.wmin) / sf.dw;
+  if(x < 0. || y < 0. || x > sf.nk-1 || y > sf.nw-1) return 0;
+
+  int i = TMath::Min( (int) x, sf.nk-2 );
+  int j = TMath::Min( (int) y, sf.nw-2 );
+  double u = x - i;
+  double v = y - j;
+
+  return (1-u)*(1-v) * sf.prob[ i   *sf.nw + j  ] +
+         (1-u)*   v  * sf.prob[ i   *sf.nw + j+1] +
+            u *(1-v) * sf.prob[(i+1)*sf.nw + j  ] +
+            u *   v  * sf.prob[(i+1)*sf.nw + j+1];
 }
 //____________________________________________________________________________
 void SpectralFunc::Configure(const Registry & config)
@@ -160,14 +189,8 @@ void SpectralFunc::LoadConfig(void)
   LOG("SpectralFunc", pDEBUG) << "Loaded " << sfdata_fe56.GetEntries() << " Fe56 points";
   LOG("SpectralFunc", pDEBUG) << "Loaded " << sfdata_c12.GetEntries()  << " C12 points";
 
-  if (fSfFe56) delete fSfFe56;
-  if (fSfC12 ) delete fSfC12;
-
-  fSfFe56 = this->Convert2Graph(sfdata_fe56);
-  fSfC12  = this->Convert2Graph(sfdata_c12);
-
-  fSfFe56->SetName("sf_fe56");
-  fSfC12 ->SetName("sf_c12");
+  this->Convert2Grid(sfdata_fe56, fSfFe56);
+  this->Convert2Grid(sfdata_c12,  fSfC12 );
 }
 //____________________________________________________________________________
 TGraph2D * SpectralFunc::Convert2Graph(TNtupleD & sfdata) const
@@ -190,17 +213,107 @@ TGraph2D * SpectralFunc::Convert2Graph(TNtupleD & sfdata) const
   return sfgraph;
 }
 //____________________________________________________________________________
-TGraph2D * SpectralFunc::SelectSpectralFunction(const Target & t) const
+void SpectralFunc::Convert2Grid(TNtupleD & sfdata, SFGrid & grid) const
+{
+  const double eps = 1E-9;
+
+  grid = SFGrid();
+
+  TGraph2D * sfgraph = this->Convert2Graph(sfdata);
+  int np = sfgraph->GetN();
+  if(np < 4) {
+    delete sfgraph;
+    return;
+  }
+  double * k = sfgraph->GetX();
+  double * e = sfgraph->GetY();
+  double * p = sfgraph->GetZ();
+
+  // check whether the input points are a regular grid
+  set<double> kset, eset;
+  for(int i=0; i<np; i++) {
+    kset.insert( eps * TMath::Nint(k[i]/eps) );
+    eset.insert( eps * TMath::Nint(e[i]/eps) );
+  }
+  int nk = kset.size();
+  int nw = eset.size();
+  bool regular = (nk >= 2 && nw >= 2 && nk*nw == np);
+  if(regular) {
+    double dk = (*kset.rbegin() - *kset.begin()) / (nk-1);
+    double dw = (*eset.rbegin() - *eset.begin()) / (nw-1);
+    int i = 0;
+    for(set<double>::const_iterator it = kset.begin(); it != kset.end(); ++it, ++i)
+       regular = regular && TMath::Abs(*it - (*kset.begin() + i*dk)) < 1E-6;
+    i = 0;
+    for(set<double>::const_iterator it = eset.begin(); it != eset.end(); ++it, ++i)
+       regular = regular && TMath::Abs(*it - (*eset.begin() + i*dw)) < 1E-6;
+  }
+
+  if(regular) {
+    grid.nk   = nk;
+    grid.kmin = *kset.begin();
+    grid.dk   = (*kset.rbegin() - grid.kmin) / (nk-1);
+    grid.nw   = nw;
+    grid.wmin = *eset.begin();
+    grid.dw   = (*eset.rbegin() - grid.wmin) / (nw-1);
+    grid.prob.assign(nk*nw, 0.);
+    for(int ip=0; ip<np; ip++) {
+      int i = TMath::Nint( (k[ip] - grid.kmin) / grid.dk );
+      int j = TMath::Nint( (e[ip] - grid.wmin) / grid.dw );
+      grid.prob[i*nw + j] = TMath::Max(0., p[ip]);
+    }
+  } else {
+    // resample the (Delaunay) interpolation of the input points
+    grid.nk   = kNSFGridNodes;
+    grid.kmin = sfgraph->GetXmin();
+    grid.dk   = (sfgraph->GetXmax() - grid.kmin) / (grid.nk-1);
+    grid.nw   = kNSFGridNodes;
+    grid.wmin = sfgraph->GetYmin();
+    grid.dw   = (sfgraph->GetYmax() - grid.wmin) / (grid.nw-1);
+    grid.prob.assign(grid.nk*grid.nw, 0.);
+    for(int i=0; i<grid.nk; i++) {
+      for(int j=0; j<grid.nw; j++) {
+        double ki = grid.kmin + i*grid.dk;
+        double wj = grid.wmin + j*grid.dw;
+        grid.prob[i*grid.nw + j] = TMath::Max(0., sfgraph->Interpolate(ki,wj));
+      }
+    }
+  }
+  delete sfgraph;
+
+  // cumulative probability of the grid cells
+  grid.cdf.assign( (grid.nk-1)*(grid.nw-1), 0. );
+  double sum = 0.;
+  for(int i=0; i<grid.nk-1; i++) {
+    for(int j=0; j<grid.nw-1; j++) {
+      sum += 0.25 * ( grid.prob[ i   *grid.nw + j] + grid.prob[ i   *grid.nw + j+1] +
+                      grid.prob[(i+1)*grid.nw + j] + grid.prob[(i+1)*grid.nw + j+1] );
+      grid.cdf[i*(grid.nw-1) + j] = sum;
+    }
+  }
+
+  LOG("SpectralFunc", pINFO)
+    << "Spectral function on a " << (regular ? "" : "resampled ")
+    << grid.nk << " x " << grid.nw << " grid: "
+    << "momentum range = ["   << grid.kmin << ", " << grid.kmin + (grid.nk-1)*grid.dk << "], "
+    << "rmv energy range = [" << grid.wmin << ", " << grid.wmin + (grid.nw-1)*grid.dw << "]";
+}
+//____________________________________________________________________________
+const SpectralFunc::SFGrid * SpectralFunc::SelectSpectralFunction(
+  const Target & t) const
 {
-  TGraph2D * sf = 0;
+  const SFGrid * sf = 0;
   int pdgc = t.Pdg();
 
-  if      (pdgc == kPdgTgtC12)  sf = fSfC12;
-  else if (pdgc == kPdgTgtFe56) sf = fSfFe56;
+  if      (pdgc == kPdgTgtC12)  sf = &fSfC12;
+  else if (pdgc == kPdgTgtFe56) sf = &fSfFe56;
   else {
     LOG("SpectralFunc", pERROR) 
      << "** The spectral function for target " << pdgc << " isn't available";
   }
+  if(sf && (sf->cdf.empty() || sf->cdf.back() <= 0.)) {
+    sf = 0;
+  }
   if(!sf) {
     LOG("SpectralFunc", pERROR) << "** Null spectral function";
   }
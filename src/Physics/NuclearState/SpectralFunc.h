@@ -6,6 +6,13 @@
 \brief    A realistic spectral function - based nuclear model.
           Is a concrete implementation of the NuclearModelI interface.
 
+          At configuration, each spectral function is put on a regular grid
+          in (momentum, removal energy): the input table itself if it is one,
+          otherwise its (Delaunay) interpolation. Between grid nodes it is
+          interpolated bilinearly, and nucleons are generated by picking a
+          grid cell from the cumulative probability of the cells and then a
+          point within the cell.
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -21,8 +28,12 @@
 #ifndef _SPECTRAL_FUNCTION_H_
 #define _SPECTRAL_FUNCTION_H_
 
+#include <vector>
+
 #include "Physics/NuclearState/NuclearModelI.h"
 
+using std::vector;
+
 class TNtupleD;
 class TGraph2D;
 
@@ -52,12 +63,26 @@ public:
   void Configure (string config);
 
 private:
-  void       LoadConfig             (void);
-  TGraph2D * Convert2Graph          (TNtupleD & data) const;
-  TGraph2D * SelectSpectralFunction (const Target & target) const; 
 
-  TGraph2D * fSfFe56;   ///< Benhar's Fe56 SF
-  TGraph2D * fSfC12;    ///< Benhar's C12 SF
+  // A spectral function on a regular grid
+  struct SFGrid {
+    SFGrid() : kmin(0), dk(0), nk(0), wmin(0), dw(0), nw(0) {}
+    double kmin, dk;     ///< momentum nodes, kmin + i*dk, i < nk
+    int    nk;
+    double wmin, dw;     ///< removal energy nodes, wmin + j*dw, j < nw
+    int    nw;
+    vector<double> prob; ///< probability at the nodes, [i*nw + j]
+    vector<double> cdf;  ///< cumulative probability of the cells, [i*(nw-1) + j]
+  };
+
+  void           LoadConfig             (void);
+  TGraph2D *     Convert2Graph          (TNtupleD & data) const;
+  void           Convert2Grid           (TNtupleD & data, SFGrid & grid) const;
+  double         Interpolate            (const SFGrid & grid, double k, double w) const;
+  const SFGrid * SelectSpectralFunction (const Target & target) const; 
+
+  SFGrid fSfFe56;   ///< Benhar's Fe56 SF
+  SFGrid fSfC12;    ///< Benhar's C12 SF
 };
 
 }      // genie namespace
@@ -14,6 +14,7 @@
 */
 //____________________________________________________________________________
 
+#include <algorithm>
 #include <sstream>
 
 #include <TSystem.h>
@@ -36,15 +37,21 @@ using namespace genie::constants;
 using namespace genie::controls;
 using namespace genie::utils;
 
+namespace {
+  const int kNSFkBins = 1000; // momentum bins of the fSFk tables
+}
+
 //____________________________________________________________________________
 SpectralFunc1d::SpectralFunc1d() :
-NuclearModelI("genie::SpectralFunc1d")
+NuclearModelI("genie::SpectralFunc1d"),
+fSFkDp(0.)
 {
 
 }
 //____________________________________________________________________________
 SpectralFunc1d::SpectralFunc1d(string config) :
-NuclearModelI("genie::SpectralFunc1d", config)
+NuclearModelI("genie::SpectralFunc1d", config),
+fSFkDp(0.)
 {
 
 }
@@ -64,37 +71,31 @@ bool SpectralFunc1d::GenerateNucleon(const Target & target) const
 
   // Select fermi momentum from the integrated (over removal energies) s/f.
   //
-  spl_it = fSFk.find(Z);
-  dbl_it = fMaxProb.find(Z);
-  if(spl_it == fSFk.end() || dbl_it == fMaxProb.end()) {
+  map<int, vector<double> >::const_iterator prob_it = fSFkProb.find(Z);
+  map<int, vector<double> >::const_iterator cdf_it  = fSFkCDF.find(Z);
+  if(prob_it == fSFkProb.end() || cdf_it == fSFkCDF.end() ||
+     cdf_it->second.back() <= 0.) {
     fCurrRemovalEnergy = 0.;
     fCurrMomentum.SetXYZ(0.,0.,0.);
     return false;
   }
-
-  double prob_max = dbl_it->second;
-  LOG("SpectralFunc1", pDEBUG) << "Max probability = " << prob_max;
-
-  double p = 0;
-  unsigned int niter = 0;
-  while(1) {
-    if(niter > kRjMaxIterations) {
-       LOG("SpectralFunc1", pWARN)
-        << "Couldn't generate a hit nucleon after " << niter << " iterations";
-       return false;
-    }
-    niter++;
-
-    if(fUseRFGMomentumCutoff) p = fPCutOff * rnd->RndGen().Rndm();
-    else p = rnd->RndGen().Rndm();
-
-    double prob  = spl_it->second->Evaluate(p);
-    double probg = prob_max * rnd->RndGen().Rndm();
-    LOG("SpectralFunc1", pDEBUG) << "Trying p = " << p << " / prob = " << prob;
-
-    bool accept = (probg<prob);
-    if(accept) break;
+  const vector<double> & prob = prob_it->second;
+  const vector<double> & cdf  = cdf_it ->second;
+
+  // select a momentum bin, then a momentum within it from the linear
+  // interpolation of the s/f across the bin
+  double x = cdf.back() * rnd->RndGen().Rndm();
+  int ibin = std::upper_bound(cdf.begin(), cdf.end(), x) - cdf.begin();
+  ibin = TMath::Min(ibin, (int)cdf.size() - 1);
+
+  double f0 = prob[ibin];
+  double f1 = prob[ibin+1];
+  double u  = rnd->RndGen().Rndm();
+  double t  = u;
+  if(TMath::Abs(f1-f0) > 1E-9 * TMath::Max(f0,f1)) {
+    t = (TMath::Sqrt(f0*f0 + (f1*f1 - f0*f0)*u) - f0) / (f1 - f0);
   }
+  double p = (ibin + t) * fSFkDp;
 
   LOG("SpectralFunc1", pINFO) << "|p,nucleon| = " << p;
 
@@ -184,22 +185,6 @@ void SpectralFunc1d::LoadConfig(void)
   spl = new Spline(fe56_sf1dw_file);
   fSFw.insert(map<int, Spline*>::value_type(26,spl));
 
-  // scan for max.
-  map<int, Spline*>::const_iterator spliter;
-  int    n    = 100;
-  double pmin =  0.000;
-  double dp   =  0.010;
-  for(spliter = fSFk.begin(); spliter != fSFk.end(); ++spliter) {
-    double prob_max = 0;
-    int Z = spliter->first;
-    spl = spliter->second;
-    for(int i=0; i<n; i++) {
-       double p = pmin + i*dp;
-       prob_max = TMath::Max(prob_max, spl->Evaluate(p));
-    }
-    fMaxProb.insert(map<int,double>::value_type(Z,prob_max));
-  }
-
   // Check whether to use the same removal energies as in the FG model or
   // to use the average removal energy for the selected fermi momentum
   // (computed from the spectral function itself)
@@ -211,6 +196,28 @@ void SpectralFunc1d::LoadConfig(void)
   //Get the momentum cutoff
   GetParam( "RFG-MomentumCutOff", fPCutOff ) ;
 
+  // tabulate the momentum distributions and their cumulative probabilities
+  // over the generated momentum range
+  double pmax = (fUseRFGMomentumCutoff) ? fPCutOff : 1.;
+  fSFkDp = pmax / kNSFkBins;
+  map<int, Spline*>::const_iterator spliter;
+  for(spliter = fSFk.begin(); spliter != fSFk.end(); ++spliter) {
+    int Z = spliter->first;
+    spl = spliter->second;
+    vector<double> & prob = fSFkProb[Z];
+    vector<double> & cdf  = fSFkCDF [Z];
+    prob.resize(kNSFkBins+1);
+    cdf .resize(kNSFkBins);
+    for(int i=0; i<=kNSFkBins; i++) {
+       prob[i] = TMath::Max(0., spl->Evaluate(i*fSFkDp));
+    }
+    double sum = 0.;
+    for(int i=0; i<kNSFkBins; i++) {
+       sum   += 0.5 * (prob[i] + prob[i+1]);
+       cdf[i] = sum;
+    }
+  }
+
   // Removal energies as used in the FG model
   // Load removal energy for specific nuclei from either the algorithm's
   // configuration file or the UserPhysicsOptions file.
@@ -247,7 +254,8 @@ void SpectralFunc1d::CleanUp(void)
   fSFk.clear();
   fSFw.clear();
   fNucRmvE.clear();
-  fMaxProb.clear();
+  fSFkProb.clear();
+  fSFkCDF.clear();
 }
 //____________________________________________________________________________
 
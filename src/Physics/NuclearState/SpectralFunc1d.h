@@ -7,6 +7,10 @@
 	  A beta version.
           Implements the NuclearModelI interface.
 
+          The momentum distribution is tabulated at configuration on a
+          regular grid, and momenta are generated from its cumulative
+          distribution (linear within the grid bins).
+
 \ref      
 
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
@@ -24,10 +28,12 @@
 #define _SPECTRAL_FUNCTION_1D_H_
 
 #include <map>
+#include <vector>
 
 #include "Physics/NuclearState/NuclearModelI.h"
 
 using std::map;
+using std::vector;
 
 namespace genie {
 
@@ -68,7 +74,9 @@ private:
   map<int, Spline *> fSFk;     ///< All available spectral funcs integrated over removal energy
   map<int, Spline *> fSFw;     ///< Average nucleon removal as a function of pF - computed from the spectral function
   map<int, double>   fNucRmvE; ///< Removal energies as used in FG model
-  map<int, double>   fMaxProb; ///< Max SF(k) probability used in rejection method
+  double                  fSFkDp;   ///< momentum spacing of the fSFk tables
+  map<int, vector<double> > fSFkProb; ///< fSFk at momenta i*fSFkDp
+  map<int, vector<double> > fSFkCDF;  ///< cumulative fSFk probability of the bins [i*fSFkDp, (i+1)*fSFkDp]
 };
 
 }         // genie namespace
@@ -32,14 +32,16 @@ using namespace genie;
 
 //____________________________________________________________________________
 NucleonDecayPrimaryVtxGenerator::NucleonDecayPrimaryVtxGenerator() :
-EventRecordVisitorI("genie::NucleonDecayPrimaryVtxGenerator")
+EventRecordVisitorI("genie::NucleonDecayPrimaryVtxGenerator"),
+fCurrSetup(0)
 {
 
 }
 //____________________________________________________________________________
 NucleonDecayPrimaryVtxGenerator::NucleonDecayPrimaryVtxGenerator(
   string config) :
-EventRecordVisitorI("genie::NucleonDecayPrimaryVtxGenerator",config)
+EventRecordVisitorI("genie::NucleonDecayPrimaryVtxGenerator",config),
+fCurrSetup(0)
 {
 
 }
@@ -57,11 +59,12 @@ void NucleonDecayPrimaryVtxGenerator::ProcessEventRecord(
   fCurrDecayMode = (NucleonDecayMode_t) interaction->ExclTag().DecayMode();
   fCurrDecayedNucleon = interaction->InitState().Tgt().HitNucPdg();
 
-  LOG("NucleonDecay", pNOTICE)
+  LOG("NucleonDecay", pINFO)
     << "Simulating decay " << utils::nucleon_decay::AsString(fCurrDecayMode, fCurrDecayedNucleon)
     << " for an initial state with code: " << fCurrInitStatePdg;
 
   fNucleonIsBound = (pdg::IonPdgCodeToA(fCurrInitStatePdg) > 1);
+  fCurrSetup      = &this->Setup();
 
   this->AddInitialState(event);
   this->GenerateDecayedNucleonPosition(event);
@@ -96,30 +99,23 @@ void NucleonDecayPrimaryVtxGenerator::AddInitialState(
   GHepStatus_t stfs = kIStStableFinalState;
 
   int ipdg = fCurrInitStatePdg;
+  const DecaySetup & setup = *fCurrSetup;
 
   // Decayed nucleon is a bound one.
   if(fNucleonIsBound)
   {
     // add initial nucleus
-    double Mi  = PDGLibrary::Instance()->Find(ipdg)->Mass();
-    TLorentzVector p4i(0,0,0,Mi);
+    TLorentzVector p4i(0,0,0,setup.Mi);
     event->AddParticle(ipdg,stis,-1,-1,-1,-1, p4i, v4);
 
     // add decayed nucleon
     int dpdg = fCurrDecayedNucleon;
-    double mn = PDGLibrary::Instance()->Find(dpdg)->Mass();
-    TLorentzVector p4n(0,0,0,mn);
+    TLorentzVector p4n(0,0,0,setup.mn);
     event->AddParticle(dpdg,stdc, 0,-1,-1,-1, p4n, v4);
 
     // add nuclear remnant
-    int A = pdg::IonPdgCodeToA(ipdg);
-    int Z = pdg::IonPdgCodeToZ(ipdg);
-    A--;
-    if(dpdg == kPdgProton) { Z--; }
-    int rpdg = pdg::IonPdgCode(A, Z);
-    double Mf  = PDGLibrary::Instance()->Find(rpdg)->Mass();
-    TLorentzVector p4f(0,0,0,Mf);
-    event->AddParticle(rpdg,stfs,0,-1,-1,-1, p4f, v4);
+    TLorentzVector p4f(0,0,0,setup.Mf);
+    event->AddParticle(setup.rpdg,stfs,0,-1,-1,-1, p4f, v4);
   }
 
   // Decayed nucleon is a free one
@@ -146,8 +142,7 @@ void NucleonDecayPrimaryVtxGenerator::AddInitialState(
        throw exception;
     }
     // add initial nucleon
-    double mn  = PDGLibrary::Instance()->Find(ipdg)->Mass();
-    TLorentzVector p4i(0,0,0,mn);
+    TLorentzVector p4i(0,0,0,setup.Mi);
     event->AddParticle(dpdg,stis,-1,-1,-1,-1, p4i, v4);
     // add decayed nucleon
     event->AddParticle(dpdg,stdc,0,-1,-1,-1, p4i, v4);
@@ -165,21 +160,12 @@ void NucleonDecayPrimaryVtxGenerator::GenerateDecayedNucleonPosition(
 
   RandomGen * rnd = RandomGen::Instance();
 
-  double R0 = 1.3;
-  double dA = (double)A;
-  double R = R0 * TMath::Power(dA, 1./3.);
-
   LOG("NucleonDecay", pINFO)
       << "Generating vertex according to a realistic nuclear density profile";
 
-  // get inputs to the rejection method
-  double ymax = -1;
-  double rmax = 3*R;
-  double dr   = R/40.;
-  for(double r = 0; r < rmax; r+=dr) {
-      ymax = TMath::Max(ymax, r*r * utils::nuclear::Density(r,A));
-  }
-  ymax *= 1.2;
+  // inputs to the rejection method (see Setup())
+  double ymax = fCurrSetup->ymax;
+  double rmax = fCurrSetup->rmax;
 
   // select a vertex using the rejection method
   TLorentzVector vtx(0,0,0,0);
@@ -254,8 +240,8 @@ void NucleonDecayPrimaryVtxGenerator::GenerateFermiMomentum(
 
   double pF2 = p3.Mag2(); // (fermi momentum)^2
 
-  double Mi  = PDGLibrary::Instance()->Find(initial_nucleus->Pdg())-> Mass(); // initial nucleus mass
-  double Mf  = PDGLibrary::Instance()->Find(remnant_nucleus->Pdg())-> Mass(); // remnant nucleus mass
+  double Mi  = fCurrSetup->Mi; // initial nucleus mass
+  double Mf  = fCurrSetup->Mf; // remnant nucleus mass
 
   double EN = Mi - TMath::Sqrt(pF2 + Mf*Mf);
 
@@ -271,48 +257,32 @@ void NucleonDecayPrimaryVtxGenerator::GenerateDecayProducts(
 {
   LOG("NucleonDecay", pINFO) << "Generating decay...";
 
-  PDGCodeList pdgv = utils::nucleon_decay::DecayProductList(fCurrDecayMode, fCurrDecayedNucleon);
+  const DecaySetup & setup = *fCurrSetup;
+  const PDGCodeList & pdgv = setup.products;
   LOG("NucleonDecay", pINFO) << "Decay product IDs: " << pdgv;
   assert ( pdgv.size() >  1);
 
   LOG("NucleonDecay", pINFO) << "Performing a phase space decay...";
-
-  // Get the decay product masses
-
-  vector<int>::const_iterator pdg_iter;
-  int i = 0;
-  double * mass = new double[pdgv.size()];
-  double   sum  = 0;
-  for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
-    int pdgc = *pdg_iter;
-    double m = PDGLibrary::Instance()->Find(pdgc)->Mass();
-    mass[i++] = m;
-    sum += m;
-  }
-
   LOG("NucleonDecay", pINFO)
-    << "Decaying N = " << pdgv.size() << " particles / total mass = " << sum;
+    << "Decaying N = " << pdgv.size() << " particles / total mass = "
+    << setup.mass_sum;
 
   int decayed_nucleon_id = 1;
   GHepParticle * decayed_nucleon = event->Particle(decayed_nucleon_id);
   assert(decayed_nucleon);
-  TLorentzVector * p4d = decayed_nucleon->GetP4();
-  TLorentzVector * v4d = decayed_nucleon->GetX4();
+  const TLorentzVector & p4d = *decayed_nucleon->P4();
+  const TLorentzVector & v4d = *decayed_nucleon->X4();
 
   LOG("NucleonDecay", pINFO)
-    << "Decaying system p4 = " << utils::print::P4AsString(p4d);
+    << "Decaying system p4 = " << utils::print::P4AsString(&p4d);
 
   // Set the decay
-  bool permitted = fPhaseSpaceGenerator.SetDecay(*p4d, pdgv.size(), mass);
+  bool permitted = fPhaseSpace.SetDecay(p4d, pdgv.size(), &setup.masses[0]);
   if(!permitted) {
      LOG("NucleonDecay", pERROR)
        << " *** Phase space decay is not permitted \n"
-       << " Total particle mass = " << sum << "\n"
-       << " Decaying system p4 = " << utils::print::P4AsString(p4d);
-     // clean-up
-     delete [] mass;
-     delete p4d;
-     delete v4d;
+       << " Total particle mass = " << setup.mass_sum << "\n"
+       << " Decaying system p4 = " << utils::print::P4AsString(&p4d);
      // throw exception
      genie::exceptions::EVGThreadException exception;
      exception.SetReason("Decay not permitted kinematically");
@@ -320,73 +290,29 @@ void NucleonDecayPrimaryVtxGenerator::GenerateDecayProducts(
      throw exception;
   }
 
-  // Get the maximum weight
-  //double wmax = fPhaseSpaceGenerator.GetWtMax();
-  double wmax = -1;
-  for(int idec=0; idec<200; idec++) {
-     double w = fPhaseSpaceGenerator.Generate();
-     wmax = TMath::Max(wmax,w);
-  }
-  assert(wmax>0);
-  wmax *= 2;
-
-  LOG("NucleonDecay", pNOTICE)
-     << "Max phase space gen. weight @ current hadronic system: " << wmax;
-
-  // Generate an unweighted decay
+  // Generate an unweighted decay (the max weight is tabulated)
   RandomGen * rnd = RandomGen::Instance();
+  bool accept_decay = fPhaseSpace.GenerateUnweighted(
+               rnd->RndHadro(), controls::kMaxUnweightDecayIterations);
+  if(!accept_decay) {
+     LOG("NucleonDecay", pWARN)
+         << "Couldn't generate an unweighted phase space decay after "
+         << controls::kMaxUnweightDecayIterations << " attempts";
+     genie::exceptions::EVGThreadException exception;
+     exception.SetReason("Couldn't select decay after N attempts");
+     exception.SwitchOnFastForward();
+     throw exception;
+  }
 
-  bool accept_decay=false;
-  unsigned int itry=0;
-  while(!accept_decay)
-  {
-     itry++;
-
-     if(itry > controls::kMaxUnweightDecayIterations) {
-       // report, clean-up and return
-       LOG("NucleonDecay", pWARN)
-           << "Couldn't generate an unweighted phase space decay after "
-           << itry << " attempts";
-       // clean up
-       delete [] mass;
-       delete p4d;
-       delete v4d;
-       // throw exception
-       genie::exceptions::EVGThreadException exception;
-       exception.SetReason("Couldn't select decay after N attempts");
-       exception.SwitchOnFastForward();
-       throw exception;
-     }
-     double w  = fPhaseSpaceGenerator.Generate();
-     if(w > wmax) {
-        LOG("NucleonDecay", pWARN)
-           << "Decay weight = " << w << " > max decay weight = " << wmax;
-     }
-     double gw = wmax * rnd->RndHadro().Rndm();
-     accept_decay = (gw<=w);
-
-     LOG("NucleonDecay", pINFO)
-        << "Decay weight = " << w << " / R = " << gw
-        << " - accepted: " << accept_decay;
-
-  } //!accept_decay
-
-  // Insert final state products into a TClonesArray of GHepParticle's
-  TLorentzVector v4(*v4d);
-  int idp = 0;
-  for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
-     int pdgc = *pdg_iter;
-     TLorentzVector * p4fin = fPhaseSpaceGenerator.GetDecay(idp);
+  // Insert final state products into the event record
+  TLorentzVector v4(v4d);
+  for(unsigned int idp = 0; idp < pdgv.size(); idp++) {
+     int pdgc = pdgv[idp];
      GHepStatus_t ist =
         utils::nucleon_decay::DecayProductStatus(fNucleonIsBound, pdgc);
-     event->AddParticle(pdgc, ist, decayed_nucleon_id,-1,-1,-1, *p4fin, v4);
-     idp++;
+     event->AddParticle(pdgc, ist, decayed_nucleon_id,-1,-1,-1,
+                        fPhaseSpace.GetDecay(idp), v4);
   }
-
-  // Clean-up
-  delete [] mass;
-  delete p4d;
-  delete v4d;
 }
 //____________________________________________________________________________
 void NucleonDecayPrimaryVtxGenerator::Configure(const Registry & config)
@@ -411,5 +337,72 @@ void NucleonDecayPrimaryVtxGenerator::LoadConfig(void)
   RgKey nuclkey = "NuclearModel";
   fNuclModel = dynamic_cast<const NuclearModelI *> (this->SubAlg(nuclkey));
   assert(fNuclModel);
+
+  fSetups.clear();
+  fCurrSetup = 0;
+}
+//___________________________________________________________________________
+const NucleonDecayPrimaryVtxGenerator::DecaySetup &
+  NucleonDecayPrimaryVtxGenerator::Setup(void) const
+{
+// Returns the set-up of the current decay mode & initial state, computing it
+// at its first event
+
+  int  ipdg = fCurrInitStatePdg;
+  int  dpdg = fCurrDecayedNucleon;
+  long key  = ((long) ipdg * 1000 + (long) fCurrDecayMode) * 2 +
+              ((dpdg == kPdgProton) ? 1 : 0);
+
+  std::map<long, DecaySetup>::const_iterator iter = fSetups.find(key);
+  if(iter != fSetups.end()) return iter->second;
+
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+  DecaySetup & setup = fSetups[key];
+
+  // decay products
+  setup.products =
+     utils::nucleon_decay::DecayProductList(fCurrDecayMode, dpdg);
+  setup.mass_sum = 0;
+  for(unsigned int i = 0; i < setup.products.size(); i++) {
+    double m = pdglib->Find(setup.products[i])->Mass();
+    setup.masses.push_back(m);
+    setup.mass_sum += m;
+  }
+
+  // initial state & nuclear remnant
+  setup.Mi   = pdglib->Find(ipdg)->Mass();
+  setup.mn   = pdglib->Find(dpdg)->Mass();
+  setup.rpdg = 0;
+  setup.Mf   = 0;
+  int A = pdg::IonPdgCodeToA(ipdg);
+  if(A > 1) {
+    int Z = pdg::IonPdgCodeToZ(ipdg);
+    if(dpdg == kPdgProton) { Z--; }
+    setup.rpdg = pdg::IonPdgCode(A-1, Z);
+    setup.Mf   = pdglib->Find(setup.rpdg)->Mass();
+  }
+
+  // bound of r^2 x nuclear density, for the vertex rejection method
+  setup.rmax = 0;
+  setup.ymax = 0;
+  if(A > 2) {
+    double R0 = 1.3;
+    double R  = R0 * TMath::Power((double)A, 1./3.);
+    double dr = R/40.;
+    double ymax = -1;
+    setup.rmax = 3*R;
+    for(double r = 0; r < setup.rmax; r+=dr) {
+      ymax = TMath::Max(ymax, r*r * utils::nuclear::Density(r,A));
+    }
+    setup.ymax = 1.2 * ymax;
+  }
+
+  LOG("NucleonDecay", pNOTICE)
+    << "Set up decay " << utils::nucleon_decay::AsString(fCurrDecayMode, dpdg)
+    << " for an initial state with code: " << ipdg
+    << " (" << setup.products.size() << " decay products, total mass = "
+    << setup.mass_sum << " GeV)";
+
+  return setup;
 }
 //___________________________________________________________________________
@@ -5,6 +5,12 @@
 
 \brief    Utilities for simulating nucleon decay
 
+          The set-up of each decay mode & initial state (decay product
+          masses, nuclear masses, the nuclear density bound of the vertex
+          generation) is computed at its first event and kept, and the
+          phase space max weights are tabulated (NBodyPhaseSpace), so that
+          samples of a fixed mode & target cost no per-event set-up.
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -18,9 +24,12 @@
 #ifndef _NUCLEON_DECAY_PRIMARY_VTX_GENERATOR_H_
 #define _NUCLEON_DECAY_PRIMARY_VTX_GENERATOR_H_
 
-#include <TGenPhaseSpace.h>
+#include <map>
+#include <vector>
 
 #include "Framework/EventGen/EventRecordVisitorI.h"
+#include "Framework/Numerical/NBodyPhaseSpace.h"
+#include "Framework/ParticleData/PDGCodeList.h"
 #include "Physics/NucleonDecay/NucleonDecayMode.h"
 
 namespace genie {
@@ -50,11 +59,29 @@ private:
    void GenerateFermiMomentum          (GHepRecord * event) const;
    void GenerateDecayProducts          (GHepRecord * event) const;
 
+   //! set-up of a decay mode & initial state
+   struct DecaySetup {
+     PDGCodeList         products; ///< decay products
+     std::vector<double> masses;   ///< decay product masses
+     double              mass_sum; ///< sum of the decay product masses
+     double              Mi;       ///< initial nucleus (or nucleon) mass
+     double              mn;       ///< decayed nucleon mass
+     int                 rpdg;     ///< remnant nucleus PDG code (bound nucleons)
+     double              Mf;       ///< remnant nucleus mass (bound nucleons)
+     double              rmax;     ///< max vertex radius (A > 2)
+     double              ymax;     ///< max r^2 x density, for the vertex selection
+   };
+
+   const DecaySetup & Setup (void) const;
+
    mutable int                fCurrInitStatePdg;
    mutable NucleonDecayMode_t fCurrDecayMode;
    mutable int                fCurrDecayedNucleon;
    mutable bool               fNucleonIsBound;
-   mutable TGenPhaseSpace     fPhaseSpaceGenerator;
+   mutable const DecaySetup * fCurrSetup;
+   mutable NBodyPhaseSpace    fPhaseSpace;
+
+   mutable std::map<long, DecaySetup> fSetups; ///< (init state, mode, nucleon) -> set-up
 
    const NuclearModelI * fNuclModel;
 };
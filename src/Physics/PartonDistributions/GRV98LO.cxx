@@ -11,6 +11,7 @@
 #include <sstream>
 #include <fstream>
 #include <cstdlib>
+#include <algorithm>
 
 #include <TSystem.h>
 #include <TMath.h>
@@ -23,25 +24,13 @@ using namespace genie;
 
 //____________________________________________________________________________
 GRV98LO::GRV98LO() :
-PDFModelI("genie::GRV98LO"),
- fXUVF(NULL),
- fXDVF(NULL),
- fXDEF(NULL),
- fXUDF(NULL),
- fXSF (NULL),
- fXGF (NULL)
+PDFModelI("genie::GRV98LO")
 {
   this->Initialize();
 }
 //____________________________________________________________________________
 GRV98LO::GRV98LO(string config) :
-PDFModelI("genie::GRV98LO", config),
- fXUVF(NULL),
- fXDVF(NULL),
- fXDEF(NULL),
- fXUDF(NULL),
- fXSF (NULL),
- fXGF (NULL)
+PDFModelI("genie::GRV98LO", config)
 {
   LOG("GRV98LO", pDEBUG) << "GRV98LO configuration:\n " << GetConfig() ;
 
@@ -50,12 +39,7 @@ PDFModelI("genie::GRV98LO", config),
 //____________________________________________________________________________
 GRV98LO::~GRV98LO()
 {
-  if (fXUVF) {delete fXUVF; fXUVF = NULL;}
-  if (fXDVF) {delete fXDVF; fXDVF = NULL;}
-  if (fXDEF) {delete fXDEF; fXDEF = NULL;}
-  if (fXUDF) {delete fXUDF; fXUDF = NULL;}
-  if (fXSF ) {delete fXSF ; fXSF  = NULL;}
-  if (fXGF ) {delete fXGF ; fXGF  = NULL;}
+
 }
 //____________________________________________________________________________
 double GRV98LO::UpValence(double x, double Q2) const
@@ -125,6 +109,25 @@ PDF_t GRV98LO::AllPDFs(double x, double Q2) const
   LOG("GRV98LO", pDEBUG)
     << "Inputs x = " << x << ", Q2 = " << Q2;
 
+  this->Interpolate(x, Q2, pdf);
+
+  return pdf;
+}
+//____________________________________________________________________________
+void GRV98LO::AllPDFs(
+   unsigned int n, const double * x, const double * Q2, PDF_t * pdfs) const
+{
+  if(!fInitialized) {
+    for(unsigned int i = 0; i < n; i++) pdfs[i] = this->AllPDFs(x[i], Q2[i]);
+    return;
+  }
+  for(unsigned int i = 0; i < n; i++) {
+    this->Interpolate(x[i], Q2[i], pdfs[i]);
+  }
+}
+//____________________________________________________________________________
+void GRV98LO::Interpolate(double x, double Q2, PDF_t & pdf) const
+{
   // apply kinematical limits
 //Q2 = TMath::Max(Q2, fGridQ2[0]);
   if(Q2 <= 0.8) Q2 = 0.80001;
@@ -134,6 +137,30 @@ PDF_t GRV98LO::AllPDFs(double x, double Q2) const
 
   double logx  = std::log(x);
   double logQ2 = std::log(Q2);
+
+  // grid intervals [j,j+1] in log(x) and [i,i+1] in log(Q2)
+  int j = std::upper_bound(fGridLogXbj, fGridLogXbj+kNXbj, logx ) - fGridLogXbj - 1;
+  int i = std::upper_bound(fGridLogQ2,  fGridLogQ2 +kNQ2,  logQ2) - fGridLogQ2  - 1;
+  j = std::min(std::max(j, 0), kNXbj-2);
+  i = std::min(std::max(i, 0), kNQ2 -2);
+
+  double t = (logx  - fGridLogXbj[j]) / (fGridLogXbj[j+1] - fGridLogXbj[j]);
+  double u = (logQ2 - fGridLogQ2 [i]) / (fGridLogQ2 [i+1] - fGridLogQ2 [i]);
+  double w00 = (1-t)*(1-u);
+  double w10 =    t *(1-u);
+  double w01 = (1-t)*   u ;
+  double w11 =    t *   u ;
+
+  const double * k00 = fKnots[i  ][j  ];
+  const double * k10 = fKnots[i  ][j+1];
+  const double * k01 = fKnots[i+1][j  ];
+  const double * k11 = fKnots[i+1][j+1];
+
+  double f[kNParton];
+  for(int k = 0; k < kNParton; k++) {
+    f[k] = w00*k00[k] + w10*k10[k] + w01*k01[k] + w11*k11[k];
+  }
+
   double x1    = 1-x;
   double xv    = std::sqrt(x);
   double xs    = std::pow(x, -0.2);
@@ -142,14 +169,14 @@ PDF_t GRV98LO::AllPDFs(double x, double Q2) const
   double x1p5  = x1*x1p4;
   double x1p7  = x1p3*x1p4;
 
-  double uv = fXUVF->Eval(logx,logQ2) * x1p3 * xv;
-  double dv = fXDVF->Eval(logx,logQ2) * x1p4 * xv;
-  double de = fXDEF->Eval(logx,logQ2) * x1p7 * xv;
-  double ud = fXUDF->Eval(logx,logQ2) * x1p7 * xs;
+  double uv = f[0] * x1p3 * xv;
+  double dv = f[1] * x1p4 * xv;
+  double de = f[2] * x1p7 * xv;
+  double ud = f[3] * x1p7 * xs;
   double us = 0.5 * (ud - de);
   double ds = 0.5 * (ud + de);
-  double ss = fXSF->Eval(logx,logQ2)  * x1p7 * xs;
-  double gl = fXGF->Eval(logx,logQ2)  * x1p5 * xs;
+  double ss = f[4] * x1p7 * xs;
+  double gl = f[5] * x1p5 * xs;
 
   pdf.uval = uv;
   pdf.dval = dv;
@@ -160,8 +187,6 @@ PDF_t GRV98LO::AllPDFs(double x, double Q2) const
   pdf.bot  = 0.;
   pdf.top  = 0.;
   pdf.gl   = gl;
-
-  return pdf;
 }
 //____________________________________________________________________________
 void GRV98LO::Configure(const Registry & config)
@@ -285,25 +310,11 @@ void GRV98LO::Initialize(void)
 
   grid_file.close();
 
-  // arrays for interpolation routines
+  // knots for the interpolation
   //
 
-  vector<double> gridLogQ2 (kNQ2);
-  vector<double> gridLogXbj(kNXbj);
-  vector<double> knotsXUVF(kNQ2*kNXbj);
-  vector<double> knotsXDVF(kNQ2*kNXbj);
-  vector<double> knotsXDEF(kNQ2*kNXbj);
-  vector<double> knotsXUDF(kNQ2*kNXbj);
-  vector<double> knotsXSF (kNQ2*kNXbj);
-  vector<double> knotsXGF (kNQ2*kNXbj);
-
-  k=0;
   for(int i=0; i < kNQ2; i++) {
-    double logQ2 = std::log(fGridQ2[i]);
-    gridLogQ2[i] = logQ2;
     for(int j=0; j < kNXbj - 1; j++) {
-       double logx  = std::log(fGridXbj[j]);
-       gridLogXbj[j] = logx;
        double xb0v  = std::sqrt(fGridXbj[j]);
        double xb0s  = std::pow(fGridXbj[j], -0.2);
        double xb1   = 1 - fGridXbj[j];
@@ -311,32 +322,16 @@ void GRV98LO::Initialize(void)
        double xb1p4 = std::pow(xb1, 4.);
        double xb1p5 = std::pow(xb1, 5.);
        double xb1p7 = std::pow(xb1, 7.);
-       knotsXUVF[k] = fParton[0][i][j] / (xb1p3 * xb0v);
-       knotsXDVF[k] = fParton[1][i][j] / (xb1p4 * xb0v);
-       knotsXDEF[k] = fParton[2][i][j] / (xb1p7 * xb0v);
-       knotsXUDF[k] = fParton[3][i][j] / (xb1p7 * xb0s);
-       knotsXSF [k] = fParton[4][i][j] / (xb1p7 * xb0s);
-       knotsXGF [k] = fParton[5][i][j] / (xb1p5 * xb0s);
-       k++;
+       fKnots[i][j][0] = fParton[0][i][j] / (xb1p3 * xb0v);
+       fKnots[i][j][1] = fParton[1][i][j] / (xb1p4 * xb0v);
+       fKnots[i][j][2] = fParton[2][i][j] / (xb1p7 * xb0v);
+       fKnots[i][j][3] = fParton[3][i][j] / (xb1p7 * xb0s);
+       fKnots[i][j][4] = fParton[4][i][j] / (xb1p7 * xb0s);
+       fKnots[i][j][5] = fParton[5][i][j] / (xb1p5 * xb0s);
     }
-    double logxmax = TMath::Log(fGridXbj[kNXbj-1]);
-    gridLogXbj[kNXbj-1] = logxmax;
-    knotsXUVF[k] = 0;
-    knotsXDVF[k] = 0;
-    knotsXDEF[k] = 0;
-    knotsXUDF[k] = 0;
-    knotsXSF [k] = 0;
-    knotsXGF [k] = 0;
-    k++;
+    for(int p=0; p < kNParton; p++) fKnots[i][kNXbj-1][p] = 0;
   }
 
-  fXUVF = new Interpolator2D(gridLogXbj.size(),&gridLogXbj[0],gridLogQ2.size(),&gridLogQ2[0],&knotsXUVF[0]);
-  fXDVF = new Interpolator2D(gridLogXbj.size(),&gridLogXbj[0],gridLogQ2.size(),&gridLogQ2[0],&knotsXDVF[0]);
-  fXDEF = new Interpolator2D(gridLogXbj.size(),&gridLogXbj[0],gridLogQ2.size(),&gridLogQ2[0],&knotsXDEF[0]);
-  fXUDF = new Interpolator2D(gridLogXbj.size(),&gridLogXbj[0],gridLogQ2.size(),&gridLogQ2[0],&knotsXUDF[0]);
-  fXSF  = new Interpolator2D(gridLogXbj.size(),&gridLogXbj[0],gridLogQ2.size(),&gridLogQ2[0],&knotsXSF [0]);
-  fXGF  = new Interpolator2D(gridLogXbj.size(),&gridLogXbj[0],gridLogQ2.size(),&gridLogQ2[0],&knotsXGF [0]);
-
   fInitialized = true;
 }
 //____________________________________________________________________________
@@ -16,6 +16,11 @@
           M. Glueck, E. Reya, A. Vogt,
           Eur. Phys. J. C5 (1998) 461-470; hep-ph/9806404
 
+          All parton densities are interpolated (bilinearly in log(x),
+          log(Q2)) in one pass, after a single grid search per (x,Q2)
+          point. The evaluation does not modify the object, so it is
+          re-entrant.
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC, Rutherford Appleton Laboratory
 
@@ -30,7 +35,6 @@
 #define _GRV98LO_H_
 
 #include "Physics/PartonDistributions/PDFModelI.h"
-#include "Framework/Numerical/Interpolator2D.h"
 
 namespace genie {
 
@@ -53,6 +57,8 @@ public:
   double Top         (double x, double Q2) const;
   double Gluon       (double x, double Q2) const;
   PDF_t  AllPDFs     (double x, double Q2) const;
+  void   AllPDFs     (unsigned int n,
+                      const double * x, const double * Q2, PDF_t * pdfs) const;
 
   // override the default "Configure" implementation
   // of the Algorithm interface
@@ -63,6 +69,7 @@ public:
 private:
 
   void Initialize   (void);
+  void Interpolate  (double x, double Q2, PDF_t & pdf) const;
 
   bool fInitialized;
 
@@ -82,14 +89,10 @@ private:
   double fGridLogXbj[kNXbj]; // log(Bjorken-x) values in grid
   double fParton    [kNParton][kNQ2][kNXbj-1]; // PARTON (NPART,NQ,NX-1) array in original code
   //
-  // arrays for the interpolation routine
+  // interpolation knots: the parton densities divided by their x->0,1
+  // behaviour, with the flavours of each grid point stored contiguously
   //
-  Interpolator2D * fXUVF; // = f(logx,logQ2)
-  Interpolator2D * fXDVF;
-  Interpolator2D * fXDEF;
-  Interpolator2D * fXUDF;
-  Interpolator2D * fXSF;
-  Interpolator2D * fXGF;
+  double fKnots     [kNQ2][kNXbj][kNParton]; // = f(logx,logQ2)
 };
 
 }         // genie namespace
@@ -44,6 +44,8 @@ public:
   double Gluon       (double x, double Q2) const;
   PDF_t  AllPDFs     (double x, double Q2) const;
 
+  using PDFModelI::AllPDFs; // the default batched evaluation
+
   // Override the default "Confugure" implementation
   // of the Algorithm interface
 
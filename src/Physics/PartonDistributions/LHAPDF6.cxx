@@ -115,12 +115,38 @@ PDF_t LHAPDF6::AllPDFs(double x, double Q2) const
   pdf.gl   = pdfvec[6];
   return pdf;
 }
+//____________________________________________________________________________
+void LHAPDF6::AllPDFs(
+   unsigned int n, const double * x, const double * Q2, PDF_t * pdfs) const
+{
+  // one xf buffer for the whole batch
+  std::vector<double> pdfvec;
+  for(unsigned int i = 0; i < n; i++) {
+    fLHAPDF->xfxQ2(x[i],Q2[i],pdfvec);
+    PDF_t & pdf = pdfs[i];
+    pdf.uval = pdfvec[8] - pdfvec[4];
+    pdf.dval = pdfvec[7] - pdfvec[5];
+    pdf.usea = pdfvec[4];
+    pdf.dsea = pdfvec[5];
+    pdf.str  = pdfvec[9];
+    pdf.chm  = pdfvec[10];
+    pdf.bot  = pdfvec[11];
+    pdf.top  = pdfvec[12];
+    pdf.gl   = pdfvec[6];
+  }
+}
 #else
 PDF_t LHAPDF6::AllPDFs(double, double) const
 {
   LOG("LHAPDF6",pFATAL) << "LHAPDF6 not enabled.";
   exit(-1);
 }
+//____________________________________________________________________________
+void LHAPDF6::AllPDFs(unsigned int, const double *, const double *, PDF_t *) const
+{
+  LOG("LHAPDF6",pFATAL) << "LHAPDF6 not enabled.";
+  exit(-1);
+}
 #endif
 //____________________________________________________________________________
 void LHAPDF6::Configure(const Registry & config)
@@ -49,6 +49,8 @@ public:
   double Top         (double x, double Q2) const;
   double Gluon       (double x, double Q2) const;
   PDF_t  AllPDFs     (double x, double Q2) const;
+  void   AllPDFs     (unsigned int n,
+                      const double * x, const double * Q2, PDF_t * pdfs) const;
 
   // Override the default "Configure" implementation
   // of the Algorithm interface
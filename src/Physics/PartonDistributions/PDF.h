@@ -45,6 +45,9 @@ public:
   //-- methods to set a PDFModelI and compute PDFs
   void   SetModel  (const PDFModelI * model);
   void   Calculate (double x, double q2);
+  void   Set       (const PDF_t & pdfs); ///< PDFs computed by the model (eg in a batch)
+
+  const PDFModelI * Model (void) const { return fModel; }
 
   //-- methods to access the computed PDFs
   double UpValence   (void) const { return fUpValence;   }
@@ -44,6 +44,12 @@ public:
   virtual double Gluon       (double x, double Q2) const = 0;
   virtual PDF_t  AllPDFs     (double x, double Q2) const = 0;
 
+  //-- all PDFs at n (x,Q2) points: pdfs[i] = AllPDFs(x[i],Q2[i]).
+  //   Models with a cheaper batched evaluation should override it.
+
+  virtual void   AllPDFs     (unsigned int n,
+                              const double * x, const double * Q2, PDF_t * pdfs) const;
+
 protected:
 
   PDFModelI();
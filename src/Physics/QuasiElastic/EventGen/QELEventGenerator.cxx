@@ -13,7 +13,11 @@
 */
 //____________________________________________________________________________
 
+#include <sstream>
+#include <mutex>
+
 #include <TMath.h>
+#include <TLorentzVector.h>
 
 #include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/Algorithm/AlgConfigPool.h"
@@ -22,7 +26,6 @@
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/KineVar.h"
 #include "Framework/Conventions/KinePhaseSpace.h"
-#include "Framework/EventGen/EVGThreadException.h"
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/EventGen/RunningThreadInfo.h"
 #include "Framework/GHEP/GHepRecord.h"
@@ -36,6 +39,8 @@
 #include "Physics/QuasiElastic/EventGen/QELEventGenerator.h"
 
 #include "Physics/NuclearState/NuclearModelI.h"
+#include "Physics/NuclearState/NuclearUtils.h"
+#include "Framework/Utils/CacheBranchFx.h"
 #include "Framework/Numerical/MathUtils.h"
 #include "Framework/Utils/KineUtils.h"
 #include "Framework/Utils/PrintUtils.h"
@@ -45,6 +50,12 @@ using namespace genie::controls;
 using namespace genie::constants;
 using namespace genie::utils;
 
+using std::ostringstream;
+
+namespace {
+  std::mutex gPrecomputeMutex; // guards QELEventGenerator::fPrecomputed
+}
+
 //___________________________________________________________________________
 QELEventGenerator::QELEventGenerator() :
     KineGeneratorWithCache("genie::QELEventGenerator")
@@ -65,6 +76,8 @@ QELEventGenerator::~QELEventGenerator()
 //___________________________________________________________________________
 void QELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
 {
+    StatsScope stats(this, evrec);
+
     LOG("QELEvent", pDEBUG) << "Generating QE event kinematics...";
 
     // Get the random number generators
@@ -144,11 +157,8 @@ void QELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
             LOG("QELEvent", pWARN)
                 << "Couldn't select a valid (pNi, Eb, cos_theta_0, phi_0) tuple after "
                 << iter << " iterations";
-            evrec->EventFlags()->SetBitNumber(kKineGenErr, true);
-            genie::exceptions::EVGThreadException exception;
-            exception.SetReason("Couldn't select kinematics");
-            exception.SwitchOnFastForward();
-            throw exception;
+            evrec->Reject(kKineGenErr); // Couldn't select kinematics
+            return;
         }
 
         // If the target is a composite nucleus, then sample an initial nucleon
@@ -189,6 +199,7 @@ void QELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
         LOG("QELEvent", pDEBUG) << "cth0 = " << costheta << ", phi0 = " << phi;
         double xsec = genie::utils::ComputeFullQELPXSec(interaction, fNuclModel,
           fXSecModel, costheta, phi, fEb, fHitNucleonBindingMode, fMinAngleEM, false);
+        this->CountXSec();
 
         // select/reject event
         this->AssertXSecLimits(interaction, xsec, xsec_max);
@@ -398,6 +409,17 @@ void QELEventGenerator::LoadConfig(void)
     fHitNucleonBindingMode = genie::utils::StringToQELBindingMode( binding_mode );
 
     GetParamDef( "MaxXSecNucleonThrows", fMaxXSecNucleonThrows, 800 );
+
+    // Tabulate the max xsec on a grid of energies (and of hit nucleon radii
+    // for the local Fermi gas model) at the first event of each interaction,
+    // instead of searching for it at new energies during event generation?
+    GetParamDef( "PrecomputeMaxXSec",            fPrecomputeMaxXSec,   false );
+    GetParamDef( "PrecomputeMaxXSec-NEnergies", fPrecomputeNEnergies, 60    );
+    GetParamDef( "PrecomputeMaxXSec-EMin",      fPrecomputeEMin,      0.1   );
+    GetParamDef( "PrecomputeMaxXSec-EMax",      fPrecomputeEMax,      100.  );
+    GetParamDef( "PrecomputeMaxXSec-NRadii",    fPrecomputeNRadii,    10    );
+    GetParamDef( "PrecomputeMaxXSec-RMax",      fPrecomputeRMax,      3.    );
+    fPrecomputed.clear();
 }
 //____________________________________________________________________________
 double QELEventGenerator::ComputeMaxXSec(const Interaction * in) const
@@ -491,6 +513,7 @@ double QELEventGenerator::ComputeMaxXSec(const Interaction * in) const
                   // BindHitNucleon() above
                   double xs = genie::utils::ComputeFullQELPXSec(interaction,
                     fNuclModel, fXSecModel, costh, phi, dummy_Eb, kOnShell, fMinAngleEM, false);
+                  this->CountXSec();
 
                   if (xs > this_nuc_xsec_max){
                       phi_at_xsec_max = phi;
@@ -533,3 +556,125 @@ double QELEventGenerator::ComputeMaxXSec(const Interaction * in) const
     return xsec_max;
 }
 //____________________________________________________________________________
+double QELEventGenerator::FindMaxXSec(const Interaction * in) const
+{
+// If the max xsec is tabulated, interpolate the table (also below the
+// Cache-MinEnergy threshold, since the table points are not event energies)
+
+  if(!fPrecomputeMaxXSec) return KineGeneratorWithCache::FindMaxXSec(in);
+
+  this->PrecomputeMaxXSec(in);
+
+  double E = this->Energy(in);
+  if(E >= fPrecomputeEMin && E <= fPrecomputeEMax) {
+    double xsec_max = -1;
+    CacheBranchFx * cb = this->AccessCacheBranch(in);
+    if(cb->Lookup(E, 0., xsec_max, true) && xsec_max > 0.) {
+      LOG("QELEvent", pINFO)
+         << "Tabulated: max xsec (E=" << E << ") = " << xsec_max;
+      return xsec_max;
+    }
+  }
+  return KineGeneratorWithCache::FindMaxXSec(in);
+}
+//____________________________________________________________________________
+double QELEventGenerator::Energy(const Interaction * in) const
+{
+// The max xsec computed by ComputeMaxXSec() is found for a nucleon of its own
+// choice and does not depend on the momentum of the hit nucleon: when the max
+// xsec is tabulated, it is tabulated versus the probe energy in the LAB
+
+  if(fPrecomputeMaxXSec) return in->InitState().ProbeE(kRfLab);
+
+  return KineGeneratorWithCache::Energy(in);
+}
+//____________________________________________________________________________
+string QELEventGenerator::CacheBranchName(const Interaction * in) const
+{
+  int ibin = this->RadiusBin(in);
+  if(ibin < 0) return KineGeneratorWithCache::CacheBranchName(in);
+
+  ostringstream name;
+  name << KineGeneratorWithCache::CacheBranchName(in) << ";r-bin:" << ibin;
+  return name.str();
+}
+//____________________________________________________________________________
+int QELEventGenerator::CacheBranchBin(const Interaction * in) const
+{
+  int ibin = this->RadiusBin(in);
+  return (ibin < 0) ? kNoCacheBranchBin : ibin;
+}
+//____________________________________________________________________________
+int QELEventGenerator::RadiusBin(const Interaction * in) const
+{
+// Hit nucleon radius bin of the max xsec tables. The max nucleon momentum,
+// and the max xsec, only depend on the radius for the local Fermi gas model.
+// Returns -1 if the max xsec is not tabulated vs radius.
+
+  if(!fPrecomputeMaxXSec || fPrecomputeNRadii < 1) return -1;
+
+  const Target & tgt = in->InitState().Tgt();
+  if(!tgt.IsNucleus()) return -1;
+  if(fNuclModel->ModelType(tgt) != kNucmLocalFermiGas) return -1;
+
+  double rmax = fPrecomputeRMax * utils::nuclear::Radius(tgt.A());
+  if(rmax <= 0.) return -1;
+
+  int ibin = TMath::FloorNint(fPrecomputeNRadii * tgt.HitNucPosition() / rmax);
+  return TMath::Min(TMath::Max(ibin, 0), fPrecomputeNRadii-1);
+}
+//____________________________________________________________________________
+void QELEventGenerator::PrecomputeMaxXSec(const Interaction * in) const
+{
+// Fills the cache branch of the input interaction (and hit nucleon radius
+// bin) with the max xsec at fPrecomputeNEnergies energies, so that all later
+// events just interpolate. In each radius bin the max xsec is computed at the
+// inner edge, where the local Fermi momentum is the largest. Energies outside
+// the table are handled as before.
+
+  CacheBranchFx * cb = this->AccessCacheBranch(in);
+  {
+    std::lock_guard<std::mutex> lock(gPrecomputeMutex);
+    if(fPrecomputed.count(cb) > 0) return;
+    fPrecomputed.insert(cb);
+  }
+
+  int    nE   = TMath::Max(fPrecomputeNEnergies, 2);
+  double Emin = TMath::Max(fPrecomputeEMin, 1E-3);
+  double Emax = fPrecomputeEMax;
+  if(Emax <= Emin) return;
+
+  LOG("QELEvent", pNOTICE)
+    << "Tabulating the max xsec at " << nE << " energies in [" << Emin
+    << ", " << Emax << "] GeV for " << this->CacheBranchName(in);
+
+  Interaction * interaction = new Interaction(*in);
+  interaction->SetBit( kISkipProcessChk );
+  interaction->SetBit( kISkipKinematicChk );
+
+  int ibin = this->RadiusBin(in);
+  if(ibin >= 0) {
+    const Target & tgt = in->InitState().Tgt();
+    double rmax = fPrecomputeRMax * utils::nuclear::Radius(tgt.A());
+    interaction->InitStatePtr()->TgtPtr()->SetHitNucPosition(
+                                             ibin * rmax / fPrecomputeNRadii);
+  }
+
+  TLorentzVector * p4 = in->InitState().GetProbeP4(kRfLab);
+  double E = p4->E();
+
+  double logEmin = TMath::Log(Emin);
+  double dlogE   = (TMath::Log(Emax) - logEmin) / (nE-1);
+  for(int ie = 0; ie < nE; ie++) {
+    double Ei = TMath::Exp(logEmin + ie * dlogE);
+    TLorentzVector p4i = (*p4) * (Ei/E);
+    interaction->InitStatePtr()->SetProbeP4(p4i);
+
+    double xsec_max = this->ComputeMaxXSec(interaction);
+    if(xsec_max > 0.) cb->Update(Ei, xsec_max, 2);
+  }
+
+  delete p4;
+  delete interaction;
+}
+//____________________________________________________________________________
@@ -19,14 +19,20 @@
 #ifndef _QEL_EVENT_GENERATOR_H_
 #define _QEL_EVENT_GENERATOR_H_
 
+#include <set>
+
 #include "Physics/NuclearState/NuclearModelI.h"
 #include "Physics/Common/KineGeneratorWithCache.h"
 #include "Physics/QuasiElastic/XSection/QELUtils.h"
 #include "Framework/Utils/Range1.h"
 #include "Framework/Conventions/Controls.h"
 
+using std::set;
+
 namespace genie {
 
+class CacheBranchFx;
+
 class QELEventGenerator: public KineGeneratorWithCache {
 
 public :
@@ -49,6 +55,14 @@ private:
   void   LoadConfig     (void);
   double ComputeMaxXSec(const Interaction* in) const;
 
+  // max xsec tables, precomputed per energy and hit nucleon radius bin
+  double FindMaxXSec       (const Interaction * in) const;
+  double Energy            (const Interaction * in) const;
+  string CacheBranchName   (const Interaction * in) const;
+  int    CacheBranchBin    (const Interaction * in) const;
+  int    RadiusBin         (const Interaction * in) const;
+  void   PrecomputeMaxXSec (const Interaction * in) const;
+
   void AddTargetNucleusRemnant (GHepRecord * evrec) const; ///< add a recoiled nucleus remnant
 
   const NuclearModelI *  fNuclModel;   ///< nuclear model
@@ -63,6 +77,15 @@ private:
   /// momentum to use in ComputeMaxXSec()
   int fMaxXSecNucleonThrows;
 
+  bool   fPrecomputeMaxXSec;   ///< tabulate the max xsec at the first event of each interaction?
+  int    fPrecomputeNEnergies; ///< number of (log-spaced) energies in the max xsec table
+  double fPrecomputeEMin;      ///< min energy of the max xsec table
+  double fPrecomputeEMax;      ///< max energy of the max xsec table
+  int    fPrecomputeNRadii;    ///< number of hit nucleon radius bins (LocalFGM only)
+  double fPrecomputeRMax;      ///< max tabulated hit nucleon radius, in units of the nuclear radius
+
+  mutable set<const CacheBranchFx *> fPrecomputed; ///< cache branches already tabulated
+
 }; // class definition
 
 } // genie namespace
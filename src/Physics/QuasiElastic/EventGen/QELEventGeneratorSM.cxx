@@ -78,6 +78,8 @@ QELEventGeneratorSM::~QELEventGeneratorSM()
 //___________________________________________________________________________
 void QELEventGeneratorSM::ProcessEventRecord(GHepRecord * evrec) const
 {
+  StatsScope stats(this, evrec);
+
   LOG("QELEvent", pINFO) << "Generating QE event kinematics...";
 
   if(fGenerateUniformly) {
@@ -177,7 +179,7 @@ void QELEventGeneratorSM::ProcessEventRecord(GHepRecord * evrec) const
      Kinematics * kinematics = interaction->KinePtr();
      kinematics->SetKV(kKVQ2, gQ2);
      kinematics->SetKV(kKVv, v);
-     xsec = fXSecModel->XSec(interaction, fkps);
+     xsec = this->XSec(interaction, fkps);
 
       //-- Decide whether to accept the current kinematics
      if(!fGenerateUniformly)
@@ -470,7 +472,7 @@ double QELEventGeneratorSM::ComputeMaxXSec(const Interaction * interaction) cons
           kinematics->SetKV(kKVQ2, Q2);
           kinematics->SetKV(kKVv, v);
           // Compute the QE cross section for the current kinematics
-          double xs = fXSecModel->XSec(interaction, fkps);
+          double xs = this->XSec(interaction, fkps);
           if (xs > tmp_xsec_max)
             tmp_xsec_max = xs;
        } // Done with v scan
@@ -512,7 +514,7 @@ double QELEventGeneratorSM::ComputeMaxXSec2(const Interaction * interaction) con
           kinematics->SetKV(kKVQ2, Q2);
           kinematics->SetKV(kKVv, v);
           // Compute the QE cross section for the current kinematics
-          double xs = fXSecModel->XSec(interaction, fkps);
+          double xs = this->XSec(interaction, fkps);
           if (xs > tmp_xsec_max)
             tmp_xsec_max = xs;
        } // Done with v scan
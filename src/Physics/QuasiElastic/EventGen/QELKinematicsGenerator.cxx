@@ -15,7 +15,6 @@
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/KineVar.h"
 #include "Framework/Conventions/KinePhaseSpace.h"
-#include "Framework/EventGen/EVGThreadException.h"
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/EventGen/RunningThreadInfo.h"
 #include "Framework/GHEP/GHepRecord.h"
@@ -53,6 +52,8 @@ QELKinematicsGenerator::~QELKinematicsGenerator()
 //___________________________________________________________________________
 void QELKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 {
+  StatsScope stats(this, evrec);
+
   if(fGenerateUniformly) {
     LOG("QELKinematics", pNOTICE)
           << "Generating kinematics uniformly over the allowed phase space";
@@ -90,11 +91,8 @@ void QELKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
   if(Q2.max <=0 || Q2.min>=Q2.max) {
      LOG("QELKinematics", pWARN) << "No available phase space";
-     evrec->EventFlags()->SetBitNumber(kKineGenErr, true);
-     genie::exceptions::EVGThreadException exception;
-     exception.SetReason("No available phase space");
-     exception.SwitchOnFastForward();
-     throw exception;
+     evrec->Reject(kKineGenErr); // No available phase space
+     return;
   }
 
   //-- For the subsequent kinematic selection with the rejection method:
@@ -122,11 +120,8 @@ void QELKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      if(iter > kRjMaxIterations) {
         LOG("QELKinematics", pWARN)
           << "Couldn't select a valid Q^2 after " << iter << " iterations";
-        evrec->EventFlags()->SetBitNumber(kKineGenErr, true);
-        genie::exceptions::EVGThreadException exception;
-        exception.SetReason("Couldn't select kinematics");
-        exception.SwitchOnFastForward();
-        throw exception;
+        evrec->Reject(kKineGenErr); // Couldn't select kinematics
+        return;
      }
 
      //-- Generate a Q2 value within the allowed phase space
@@ -144,7 +139,7 @@ void QELKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      LOG("QELKinematics", pINFO) << "Trying: Q^2 = " << gQ2;
 
      //-- Computing cross section for the current kinematics
-     xsec = fXSecModel->XSec(interaction, kPSQ2fE);
+     xsec = this->XSec(interaction, kPSQ2fE);
 
      //-- Decide whether to accept the current kinematics
      if(!fGenerateUniformly) {
@@ -275,11 +270,8 @@ void QELKinematicsGenerator::SpectralFuncExperimentalCode(
 
   if(Q2.max <=0 || Q2.min>=Q2.max) {
      LOG("QELKinematics", pWARN) << "No available phase space";
-     evrec->EventFlags()->SetBitNumber(kKineGenErr, true);
-     genie::exceptions::EVGThreadException exception;
-     exception.SetReason("No available phase space");
-     exception.SwitchOnFastForward();
-     throw exception;
+     evrec->Reject(kKineGenErr); // No available phase space
+     return;
   }
 
   //-- For the subsequent kinematic selection with the rejection method:
@@ -316,11 +308,8 @@ void QELKinematicsGenerator::SpectralFuncExperimentalCode(
      if(iter > kRjMaxIterations) {
         LOG("QELKinematics", pWARN)
           << "Couldn't select a valid Q^2 after " << iter << " iterations";
-        evrec->EventFlags()->SetBitNumber(kKineGenErr, true);
-        genie::exceptions::EVGThreadException exception;
-        exception.SetReason("Couldn't select kinematics");
-        exception.SwitchOnFastForward();
-        throw exception;
+        evrec->Reject(kKineGenErr); // Couldn't select kinematics
+        return;
      }
 
      //-- Generate a Q2 value within the allowed phase space
@@ -366,7 +355,7 @@ void QELKinematicsGenerator::SpectralFuncExperimentalCode(
      interaction->KinePtr()->SetQ2(gQ2tilde);
 
      //-- Computing cross section for the current kinematics
-     xsec = fXSecModel->XSec(interaction, kPSQ2fE);
+     xsec = this->XSec(interaction, kPSQ2fE);
 
      //-- Decide whether to accept the current kinematics
 //     if(!fGenerateUniformly) {
@@ -492,7 +481,7 @@ double QELKinematicsGenerator::ComputeMaxXSec(
   for(int i=0; i<N; i++) {
      double Q2 = TMath::Exp(logQ2min + i * dlogQ2);
      interaction->KinePtr()->SetQ2(Q2);
-     double xsec = fXSecModel->XSec(interaction, kPSQ2fE);
+     double xsec = this->XSec(interaction, kPSQ2fE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
      LOG("QELKinematics", pDEBUG)  << "xsec(Q2= " << Q2 << ") = " << xsec;
 #endif
@@ -509,7 +498,7 @@ double QELKinematicsGenerator::ComputeMaxXSec(
 	 Q2 = TMath::Exp(TMath::Log(Q2) - dlogQ2);
          if(Q2 < rQ2.min) continue;
          interaction->KinePtr()->SetQ2(Q2);
-         xsec = fXSecModel->XSec(interaction, kPSQ2fE);
+         xsec = this->XSec(interaction, kPSQ2fE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
          LOG("QELKinematics", pDEBUG)  << "xsec(Q2= " << Q2 << ") = " << xsec;
 #endif
@@ -24,6 +24,7 @@
 #include "Physics/QuasiElastic/XSection/LwlynSmithQELCCPXSec.h"
 
 #include "Physics/NuclearState/NuclearModelI.h"
+#include "Framework/Interaction/ScratchInteraction.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGLibrary.h"
@@ -68,21 +69,76 @@ double LwlynSmithQELCCPXSec::XSec(
     return this->FullDifferentialXSec(interaction);
   }
 
-  // Get kinematics & init-state parameters
-  const Kinematics &   kinematics = interaction -> Kine();
+  // Get init-state parameters
   const InitialState & init_state = interaction -> InitState();
   const Target & target = init_state.Tgt();
 
   double E  = init_state.ProbeE(kRfHitNucRest);
-  double E2 = TMath::Power(E,2);
   double ml = interaction->FSPrimLepton()->Mass();
   double M  = target.HitNucMass();
-  double q2 = kinematics.q2();
 
   // One of the xsec terms changes sign for antineutrinos
   bool is_neutrino = pdg::IsNeutrino(init_state.ProbePdg());
   int sign = (is_neutrino) ? -1 : 1;
 
+  //----- number of scattering centers in the target
+  int nucpdgc = target.HitNucPdg();
+  int NNucl = (pdg::IsProton(nucpdgc)) ? target.Z() : target.N();
+
+  double xsec = this->FreeNucleonXSec(interaction, E, ml, M, sign);
+
+  return this->ApplyFactors(interaction, kps, xsec, NNucl);
+}
+//____________________________________________________________________________
+void LwlynSmithQELCCPXSec::XSecBatch(
+    const Interaction * interaction, KinePhaseSpace_t kps,
+    unsigned int n, unsigned int nvars, const KineVar_t * vars,
+    const double * const * kine, double * xsec) const
+{
+  // The full differential xsec needs the 4-momenta of each point
+  if(kps == kPSQELEvGen || ! this -> ValidProcess(interaction) ) {
+    XSecAlgorithmI::XSecBatch(interaction, kps, n, nvars, vars, kine, xsec);
+    return;
+  }
+
+  // The init-state parameters are the same for all points of the block.
+  // The points share FreeNucleonXSec() and ApplyFactors() with XSec(), so
+  // the results are identical to the ones of per point XSec() calls.
+  const InitialState & init_state = interaction -> InitState();
+  const Target & target = init_state.Tgt();
+
+  double E  = init_state.ProbeE(kRfHitNucRest);
+  double ml = interaction->FSPrimLepton()->Mass();
+  double M  = target.HitNucMass();
+
+  bool is_neutrino = pdg::IsNeutrino(init_state.ProbePdg());
+  int sign = (is_neutrino) ? -1 : 1;
+
+  int nucpdgc = target.HitNucPdg();
+  int NNucl = (pdg::IsProton(nucpdgc)) ? target.Z() : target.N();
+
+  Kinematics * kinematics = interaction->KinePtr();
+
+  for(unsigned int ip = 0; ip < n; ip++) {
+    for(unsigned int iv = 0; iv < nvars; iv++) {
+      kinematics->SetKV(vars[iv], kine[iv][ip]);
+    }
+    if(! this -> ValidKinematics (interaction) ) {
+      LOG("LwlynSmith",pWARN) << "not valid kinematics";
+      xsec[ip] = 0.;
+      continue;
+    }
+    double xs = this->FreeNucleonXSec(interaction, E, ml, M, sign);
+    xsec[ip] = this->ApplyFactors(interaction, kps, xs, NNucl);
+  }
+}
+//____________________________________________________________________________
+double LwlynSmithQELCCPXSec::FreeNucleonXSec(const Interaction * interaction,
+  double E, double ml, double M, int sign) const
+{
+  double E2 = TMath::Power(E,2);
+  double q2 = interaction->Kine().q2();
+
   // Calculate the QEL form factors
   fFormFactors.Calculate(interaction);
 
@@ -127,6 +183,12 @@ double LwlynSmithQELCCPXSec::XSec(
                  << "A(Q2) = " << A << ", B(Q2) = " << B << ", C(Q2) = " << C;
 #endif
 
+  return xsec;
+}
+//____________________________________________________________________________
+double LwlynSmithQELCCPXSec::ApplyFactors(const Interaction * interaction,
+  KinePhaseSpace_t kps, double xsec, int NNucl) const
+{
   //----- The algorithm computes dxsec/dQ2
   //      Check whether variable tranformation is needed
   if(kps!=kPSQ2fE) {
@@ -147,10 +209,6 @@ double LwlynSmithQELCCPXSec::XSec(
   //      (R(Q2) is adapted from NeuGEN - see comments therein)
   double R = nuclear::NuclQELXSecSuppression("Default", 0.5, interaction);
 
-  //----- number of scattering centers in the target
-  int nucpdgc = target.HitNucPdg();
-  int NNucl = (pdg::IsProton(nucpdgc)) ? target.Z() : target.N();
-
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("LwlynSmith", pDEBUG)
        << "Nuclear suppression factor R(Q2) = " << R << ", NNucl = " << NNucl;
@@ -317,10 +375,10 @@ double LwlynSmithQELCCPXSec::Integral(const Interaction * in) const
   if(fLFG || E < fEnergyCutOff) {
     // clone the input interaction so as to tweak the
     // hit nucleon 4-momentum in the averaging loop
-    Interaction in_curr(*in);
+    ScratchInteraction in_curr(in);
 
     // hit target
-    Target * tgt = in_curr.InitState().TgtPtr();
+    Target * tgt = in_curr->InitState().TgtPtr();
 
     // get nuclear masses (init & final state nucleus)
     int nucleon_pdgc = tgt->HitNucPdg();
@@ -352,7 +410,7 @@ double LwlynSmithQELCCPXSec::Integral(const Interaction * in) const
     vg->Configure("Default");
     for(int inuc=0;inuc<nnuc;inuc++){
       // Generate a position in the nucleus
-      TVector3 nucpos = vg->GenerateVertex(&in_curr,tgt->A());
+      TVector3 nucpos = vg->GenerateVertex(in_curr.Get(),tgt->A());
       tgt->SetHitNucPosition(nucpos.Mag());
 
       // Generate a nucleon
@@ -365,7 +423,7 @@ double LwlynSmithQELCCPXSec::Integral(const Interaction * in) const
       p4N->SetPz (p3N.Pz());
       p4N->SetE  (EN);
 
-      double xsec = fXSecIntegrator->Integrate(this,&in_curr);
+      double xsec = fXSecIntegrator->Integrate(this,in_curr.Get());
       xsec_sum += xsec;
     }
     double xsec_avg = xsec_sum / nnuc;
@@ -426,6 +484,15 @@ void LwlynSmithQELCCPXSec::LoadConfig(void)
   assert(fFormFactorsModel);
   fFormFactors.SetModel(fFormFactorsModel); // <-- attach algorithm
 
+  // optionally, tabulate the form factors in Q2
+  bool   ff_grid         = false;
+  double ff_grid_Q2max   = 10.;
+  int    ff_grid_npoints = 2000;
+  GetParamDef( "FormFactors-Grid",         ff_grid,         false );
+  GetParamDef( "FormFactors-Grid-Q2Max",   ff_grid_Q2max,   10.   );
+  GetParamDef( "FormFactors-Grid-NPoints", ff_grid_npoints, 2000  );
+  fFormFactors.SetGrid(ff_grid, ff_grid_Q2max, ff_grid_npoints);
+
    // load XSec Integrator
   fXSecIntegrator =
       dynamic_cast<const XSecIntegratorI *> (this->SubAlg("XSec-Integrator"));
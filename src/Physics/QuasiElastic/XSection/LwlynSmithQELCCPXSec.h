@@ -43,6 +43,9 @@ public:
 
   // XSecAlgorithmI interface implementation
   double XSec            (const Interaction * i, KinePhaseSpace_t k) const;
+  void   XSecBatch       (const Interaction * i, KinePhaseSpace_t k,
+                          unsigned int n, unsigned int nvars, const KineVar_t * vars,
+                          const double * const * kine, double * xsec) const;
   double Integral        (const Interaction * i) const;
   bool   ValidProcess    (const Interaction * i) const;
 
@@ -54,6 +57,13 @@ public:
 private:
   double FullDifferentialXSec(const Interaction * i) const;
 
+  /// The scaled free nucleon dxsec/dQ2 at the Q2 set in the interaction
+  double FreeNucleonXSec(const Interaction * i,
+                         double E, double ml, double M, int sign) const;
+  /// The Jacobian and nuclear factors applied to the free nucleon dxsec/dQ2
+  double ApplyFactors   (const Interaction * i, KinePhaseSpace_t k,
+                         double xsec, int NNucl) const;
+
   void LoadConfig (void);
 
   mutable QELFormFactors       fFormFactors;      ///<
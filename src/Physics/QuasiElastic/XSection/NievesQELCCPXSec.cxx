@@ -14,6 +14,7 @@
 #include <Math/IFunction.h>
 #include <Math/Integrator.h>
 #include <complex>
+#include <mutex>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Physics/XSectionIntegration/XSecIntegratorI.h"
@@ -49,6 +50,14 @@ using namespace genie::constants;
 using namespace genie::controls;
 using namespace genie::utils;
 
+//____________________________________________________________________________
+namespace {
+  const int kNVcNodes = 201; // radial nodes of the tabulated Coulomb potential
+
+  // guards the per-nucleus Coulomb potential tables, as the algorithm
+  // instance is shared
+  std::mutex gVcTableMutex;
+}
 //____________________________________________________________________________
 NievesQELCCPXSec::NievesQELCCPXSec() :
 XSecAlgorithmI("genie::NievesQELCCPXSec")
@@ -485,6 +494,10 @@ void NievesQELCCPXSec::LoadConfig(void)
 
   // Decide whether or not it should be used in XSec()
   GetParamDef( "DoPauliBlocking", fDoPauliBlocking, true );
+
+  // The Coulomb potential tables depend on the Rmax settings
+  std::lock_guard<std::mutex> lock(gVcTableMutex);
+  fVcTables.clear();
 }
 //___________________________________________________________________________
 void NievesQELCCPXSec::CNCTCLimUcalc(TLorentzVector qTildeP4,
@@ -502,8 +515,9 @@ void NievesQELCCPXSec::CNCTCLimUcalc(TLorentzVector qTildeP4,
 
     //Density gives the nuclear density, normalized to 1
     //Input radius r must be in fm
-    double rhop = nuclear::Density(r,A)*Z;
-    double rhon = nuclear::Density(r,A)*N;
+    double rhor = nuclear::Density(r,A);
+    double rhop = rhor*Z;
+    double rhon = rhor*N;
     double rho = rhop + rhon;
     double rho0 = A*nuclear::Density(0,A);
 
@@ -799,11 +813,55 @@ std::complex<double> NievesQELCCPXSec::deltaLindhard(double q0,
 }
 
 //____________________________________________________________________________
-// Gives coulomb potential in units of GeV
+// Gives coulomb potential in units of GeV, interpolated in the table of
+// the potential of the target nucleus (built at its first use)
 double NievesQELCCPXSec::vcr(const Target * target, double Rcurr) const{
   if(target->IsNucleus()){
-    int A = target->A();
-    int Z = target->Z();
+    const VcTable & table = this->CoulombTable(target->A(), target->Z());
+
+    if(Rcurr >= table.Rmax){
+      LOG("Nieves",pNOTICE) << "Radius greater than maximum radius for coulomb corrections."
+                          << " Integrating to max radius.";
+      return table.Vc.back();
+    }
+    if(Rcurr <= 0.) return table.Vc.front();
+
+    double x  = Rcurr / table.dR;
+    int    i  = TMath::Min((int) x, kNVcNodes-2);
+    double dx = x - i;
+    return (1.-dx) * table.Vc[i] + dx * table.Vc[i+1];
+  }else{
+    // If target is not a nucleus the potential will be 0
+    return 0.0;
+  }
+}
+//____________________________________________________________________________
+const NievesQELCCPXSec::VcTable &
+   NievesQELCCPXSec::CoulombTable(int A, int Z) const
+{
+  std::lock_guard<std::mutex> lock(gVcTableMutex);
+
+  int key = pdg::IonPdgCode(A,Z);
+  map<int, VcTable>::const_iterator it = fVcTables.find(key);
+  if(it != fVcTables.end()) return it->second;
+
+  VcTable & table = fVcTables[key];
+  table.Rmax = this->CoulombRmax(A);
+  table.dR   = table.Rmax / (kNVcNodes-1);
+  table.Vc.resize(kNVcNodes);
+  for(int i = 0; i < kNVcNodes; i++) {
+    table.Vc[i] = this->vcrIntegral(A, Z, i*table.dR, table.Rmax);
+  }
+
+  LOG("Nieves", pINFO)
+    << "Tabulated the Coulomb potential of nucleus " << key
+    << " in " << kNVcNodes << " radii up to Rmax = " << table.Rmax << " fm";
+
+  return table;
+}
+//____________________________________________________________________________
+double NievesQELCCPXSec::CoulombRmax(int A) const
+{
     double Rmax = 0.;
 
     if ( fCoulombRmaxMode == kMatchNieves ) {
@@ -830,13 +888,14 @@ double NievesQELCCPXSec::vcr(const Target * target, double Rcurr) const{
       gAbortingInErr = true;
       std::exit(1);
     }
-
-    if(Rcurr >= Rmax){
-      LOG("Nieves",pNOTICE) << "Radius greater than maximum radius for coulomb corrections."
-                          << " Integrating to max radius.";
-      Rcurr = Rmax;
-    }
-
+    return Rmax;
+}
+//____________________________________________________________________________
+// Coulomb potential (GeV) at radius Rcurr <= Rmax, integrating the nuclear
+// charge density up to Rmax
+double NievesQELCCPXSec::vcrIntegral(
+                         int A, int Z, double Rcurr, double Rmax) const
+{
     ROOT::Math::IBaseFunctionOneDim * func = new
       utils::gsl::wrap::NievesQELvcrIntegrand(Rcurr,A,Z);
     ROOT::Math::IntegrationOneDim::Type ig_type =
@@ -852,10 +911,6 @@ double NievesQELCCPXSec::vcr(const Target * target, double Rcurr) const{
     // Multiply by Z to normalize densities to number of protons
     // Multiply by hbarc to put result in GeV instead of fm
     return -kAem*4*kPi*result*fhbarc;
-  }else{
-    // If target is not a nucleus the potential will be 0
-    return 0.0;
-  }
 }
 //____________________________________________________________________________
 int NievesQELCCPXSec::leviCivita(int input[]) const{
@@ -26,6 +26,8 @@
 #include "Physics/QuasiElastic/XSection/QELFormFactors.h"
 #include "Physics/NuclearState/FermiMomentumTable.h"
 #include <complex>
+#include <map>
+#include <vector>
 #include <Math/IFunction.h>
 #include "Physics/NuclearState/NuclearModelI.h"
 #include "Physics/NuclearState/PauliBlocker.h"
@@ -133,6 +135,18 @@ private:
   // Potential for coulomb correction
   double vcr(const Target * target, double r) const;
 
+  /// Coulomb potential of a nucleus, tabulated in radius
+  struct VcTable {
+    double              Rmax;  ///< max radius (fm), the potential is flat beyond
+    double              dR;    ///< radial step (fm)
+    std::vector<double> Vc;    ///< potential (GeV) at i*dR
+  };
+  const VcTable & CoulombTable (int A, int Z) const;
+  double          CoulombRmax  (int A) const;
+  double          vcrIntegral  (int A, int Z, double Rcurr, double Rmax) const;
+
+  mutable std::map<int, VcTable> fVcTables;  ///< Coulomb potential tables per nucleus pdg code
+
   //input must be length 4. Returns 1 if input is an even permutation of 0123,
   //-1 if input is an odd permutation of 0123, and 0 if any two elements
   //are equal
@@ -8,8 +8,14 @@
 */
 //____________________________________________________________________________
 
+#include <cmath>
+#include <functional>
+#include <map>
+#include <mutex>
 #include <string>
 
+#include <TMath.h>
+
 #include "Physics/QuasiElastic/XSection/QELFormFactors.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/MathUtils.h"
@@ -18,8 +24,20 @@ using namespace genie;
 using namespace genie::utils;
 
 using std::endl;
+using std::map;
 using std::string;
 
+namespace {
+  // The grid nodes are uniform in u = ln(1+Q2/kGridQ2Scale): a node spacing
+  // ~kGridQ2Scale*du at low Q2 resolves the pion pole of Fp (Q2 ~ -mpi^2),
+  // and ~Q2*du at high Q2 is plenty for dipole-like form factors
+  const double kGridQ2Scale = 0.01; // GeV^2
+
+  // Grids shared by all QELFormFactors objects (and threads), by GridKey()
+  map<ULong64_t, vector<double> > gGrids;
+  std::mutex                      gGridsMutex;
+}
+
 //____________________________________________________________________________
 namespace genie
 {
@@ -44,6 +62,20 @@ void QELFormFactors::SetModel(const QELFormFactorsModelI * model)
 {
   this->Reset();
   this->fModel = model;
+  if(model) {
+    fModelKey = std::hash<string>()(model->Id().Key());
+  }
+}
+//____________________________________________________________________________
+void QELFormFactors::SetGrid(bool enable, double Q2max, int npoints)
+{
+  fUseGrid     = enable && Q2max > 0. && npoints > 1;
+  fGridQ2Max   = Q2max;
+  fGridNPoints = npoints;
+  fGridDu      = (fUseGrid) ?
+                 std::log(1. + Q2max/kGridQ2Scale) / (npoints-1) : 0.;
+  fGridKey     = 0;
+  fGrid        = 0;
 }
 //____________________________________________________________________________
 void QELFormFactors::Calculate(const Interaction * interaction)
@@ -55,12 +87,93 @@ void QELFormFactors::Calculate(const Interaction * interaction)
     return;
   }
 
+  if(fUseGrid) {
+    double Q2 = -1. * interaction->Kine().q2();
+    if(Q2 >= 0. && Q2 < fGridQ2Max) {
+      const vector<double> & grid = this->Grid(interaction);
+      double u = std::log(1. + Q2/kGridQ2Scale) / fGridDu;
+      int    i = TMath::Min((int)u, fGridNPoints-2);
+      double w = u - i;
+      const double * f0 = &grid[4*i];
+      const double * f1 = f0 + 4;
+      this -> fF1V   = (1.-w) * f0[0] + w * f1[0];
+      this -> fxiF2V = (1.-w) * f0[1] + w * f1[1];
+      this -> fFA    = (1.-w) * f0[2] + w * f1[2];
+      this -> fFp    = (1.-w) * f0[3] + w * f1[3];
+      return;
+    }
+  }
+
   this -> fF1V   = fModel -> F1V   (interaction);
   this -> fxiF2V = fModel -> xiF2V (interaction);
   this -> fFA    = fModel -> FA    (interaction);
   this -> fFp    = fModel -> Fp    (interaction);
 }
 //____________________________________________________________________________
+ULong64_t QELFormFactors::GridKey(const Interaction * interaction) const
+{
+// The form factors depend on Q2 and on the channel: probe, target (eg. the
+// transverse enhancement is A-dependent), hit nucleon, process and, for
+// Delta S = 1 scattering, the produced hyperon
+
+  const InitialState & init = interaction->InitState();
+  const ProcessInfo  & proc = interaction->ProcInfo();
+
+  ULong64_t key = fModelKey;
+  key = math::HashCombine(key, init.ProbePdg());
+  key = math::HashCombine(key, init.Tgt().Pdg());
+  key = math::HashCombine(key, init.Tgt().HitNucPdg());
+  key = math::HashCombine(key, (Long64_t) proc.ScatteringTypeId());
+  key = math::HashCombine(key, (Long64_t) proc.InteractionTypeId());
+  key = math::HashCombine(key, interaction->ExclTag().StrangeHadronPdg());
+  key = math::HashCombine(key, fGridNPoints);
+  key = math::HashCombine(key, std::llround(1.e6*fGridQ2Max));
+  return key;
+}
+//____________________________________________________________________________
+const vector<double> & QELFormFactors::Grid(const Interaction * interaction)
+{
+  ULong64_t key = this->GridKey(interaction);
+  if(fGrid && key == fGridKey) return *fGrid;
+
+  {
+    std::lock_guard<std::mutex> lock(gGridsMutex);
+    map<ULong64_t, vector<double> >::const_iterator it = gGrids.find(key);
+    if(it != gGrids.end()) {
+      fGridKey = key;
+      fGrid    = &(it->second);
+      return *fGrid;
+    }
+  }
+
+  LOG("QELFF", pNOTICE)
+     << "Tabulating the " << fModel->Id().Key() << " form factors for "
+     << interaction->AsString() << " at " << fGridNPoints
+     << " Q2 points in [0, " << fGridQ2Max << "] GeV^2";
+
+  // the model sees a copy of the interaction with the Q2 of each node
+  Interaction in(*interaction);
+  Kinematics * kine = in.KinePtr();
+  vector<double> grid(4*fGridNPoints);
+  for(int i = 0; i < fGridNPoints; i++) {
+    double Q2 = (i == fGridNPoints-1) ?
+                fGridQ2Max : kGridQ2Scale * (std::exp(i*fGridDu) - 1.);
+    kine->SetQ2(Q2);
+    grid[4*i  ] = fModel -> F1V   (&in);
+    grid[4*i+1] = fModel -> xiF2V (&in);
+    grid[4*i+2] = fModel -> FA    (&in);
+    grid[4*i+3] = fModel -> Fp    (&in);
+  }
+
+  // another thread may have built the same grid meanwhile: keep the first
+  std::lock_guard<std::mutex> lock(gGridsMutex);
+  std::pair<map<ULong64_t, vector<double> >::iterator, bool> res =
+                             gGrids.insert(std::make_pair(key, grid));
+  fGridKey = key;
+  fGrid    = &(res.first->second);
+  return *fGrid;
+}
+//____________________________________________________________________________
 void QELFormFactors::Reset(Option_t * opt)
 {
 // Reset the QELFormFactors object (data & attached model). If the input
@@ -72,13 +185,25 @@ void QELFormFactors::Reset(Option_t * opt)
   this->fFp    = 0;
 
   string option(opt);
-  if(option.find("D") == string::npos) {this->fModel = 0;}
+  if(option.find("D") == string::npos) {
+    this->fModel    = 0;
+    this->fModelKey = 0;
+    this->SetGrid(false);
+  }
 }
 //____________________________________________________________________________
 void QELFormFactors::Copy(const QELFormFactors & ff)
 {
   this->fModel = ff.fModel;
 
+  this->fUseGrid     = ff.fUseGrid;
+  this->fGridQ2Max   = ff.fGridQ2Max;
+  this->fGridNPoints = ff.fGridNPoints;
+  this->fGridDu      = ff.fGridDu;
+  this->fModelKey    = ff.fModelKey;
+  this->fGridKey     = ff.fGridKey;
+  this->fGrid        = ff.fGrid;
+
   this->fF1V   = ff.fF1V;
   this->fxiF2V = ff.fxiF2V;
   this->fFA    = ff.fFA;
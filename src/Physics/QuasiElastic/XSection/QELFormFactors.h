@@ -9,6 +9,10 @@
           It can accept requests to calculate itself, for a given interaction,
           that it then delegates to the algorithmic object, implementing the
           QELFormFactorsModelI interface, that it finds attached to itself.
+          Optionally (SetGrid()) the form factors are tabulated, per model and
+          channel, on a Q2 grid at their first request and then interpolated:
+          the spline integration and the QEL event generation evaluate them
+          millions of times at a few thousand distinct Q2 scales.
 
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
@@ -24,11 +28,13 @@
 #define _QEL_FORM_FACTORS_H_
 
 #include <iostream>
+#include <vector>
 
 #include "Physics/QuasiElastic/XSection/QELFormFactorsModelI.h"
 #include "Framework/Interaction/Interaction.h"
 
 using std::ostream;
+using std::vector;
 
 namespace genie {
 
@@ -46,6 +52,11 @@ public:
   //! Attach an algorithm
   void   SetModel  (const QELFormFactorsModelI * model);
 
+  //! Tabulate the form factors for 0 <= Q2 < Q2max on a grid of npoints
+  //! nodes (denser at low Q2) and interpolate them. Beyond the grid, or if
+  //! disabled, Calculate() calls the attached model
+  void   SetGrid   (bool enable, double Q2max = 10., int npoints = 2000);
+
   //! Compute the form factors for the input interaction using the attached model
   void   Calculate (const Interaction * interaction);
 
@@ -75,12 +86,23 @@ public:
 
 private:
 
+  const vector<double> & Grid    (const Interaction * interaction);
+  ULong64_t              GridKey (const Interaction * interaction) const;
+
   double fF1V;
   double fxiF2V;
   double fFA;
   double fFp;
 
   const QELFormFactorsModelI * fModel;
+
+  bool                   fUseGrid;      ///< tabulate & interpolate the form factors?
+  double                 fGridQ2Max;    ///< upper Q2 of the grid
+  int                    fGridNPoints;  ///< grid nodes
+  double                 fGridDu;       ///< grid step in u = ln(1+Q2/Q2scale)
+  ULong64_t              fModelKey;     ///< hash of the attached model (name & config)
+  ULong64_t              fGridKey;      ///< key of the last used grid
+  const vector<double> * fGrid;         //!< last used grid (F1V,xiF2V,FA,Fp per node)
 };
 
 }        // genie namespace
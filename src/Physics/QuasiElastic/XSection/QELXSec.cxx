@@ -24,6 +24,7 @@
 
 #include "Physics/NuclearState/NuclearModelI.h"
 #include "Physics/XSectionIntegration/GSLXSecFunc.h"
+#include "Framework/Interaction/ScratchInteraction.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/ParticleData/PDGUtils.h"
@@ -69,7 +70,8 @@ double QELXSec::Integrate(
   LOG("QELXSec", pDEBUG)
           << "Q2 integration range = (" << rQ2.min << ", " << rQ2.max << ")";
 
-  Interaction * interaction = new Interaction(*in);
+  ScratchInteraction scratch(in);
+  Interaction * interaction = scratch.Get();
   interaction->SetBit(kISkipProcessChk);
   interaction->SetBit(kISkipKinematicChk);
 
@@ -85,7 +87,6 @@ double QELXSec::Integrate(
   //LOG("QELXSec", pDEBUG) << "XSec[QEL] (E = " << E << ") = " << xsec;
 
   delete func;
-  delete interaction;
 
   return xsec;
 }
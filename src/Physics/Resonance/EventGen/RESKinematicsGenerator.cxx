@@ -17,7 +17,6 @@
 #include "Framework/Conventions/Controls.h"
 #include "Framework/Conventions/KineVar.h"
 #include "Framework/Conventions/KinePhaseSpace.h"
-#include "Framework/EventGen/EVGThreadException.h"
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/EventGen//RunningThreadInfo.h"
 #include "Framework/GHEP/GHepRecord.h"
@@ -25,6 +24,7 @@
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/MathUtils.h"
+#include "Framework/Numerical/GridEnvelope2D.h"
 #include "Framework/ParticleData/BaryonResonance.h"
 #include "Framework/ParticleData/BaryonResUtils.h"
 #include "Framework/Utils/KineUtils.h"
@@ -54,6 +54,8 @@ RESKinematicsGenerator::~RESKinematicsGenerator()
 //___________________________________________________________________________
 void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 {
+  StatsScope stats(this, evrec);
+
   if(fGenerateUniformly) {
     LOG("RESKinematics", pNOTICE)
           << "Generating kinematics uniformly over the allowed phase space";
@@ -83,11 +85,8 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
   if(W.max <=0 || W.min>=W.max) {
      LOG("RESKinematics", pWARN) << "No available phase space";
-     evrec->EventFlags()->SetBitNumber(kKineGenErr, true);
-     genie::exceptions::EVGThreadException exception;
-     exception.SetReason("No available phase space");
-     exception.SwitchOnFastForward();
-     throw exception;
+     evrec->Reject(kKineGenErr); // No available phase space
+     return;
   }
 
   const InitialState & init_state = interaction -> InitState();
@@ -101,10 +100,20 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //   value is found.
   //   If the kinematics are generated uniformly over the allowed phase
   //   space the max xsec is irrelevant
-  double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+  //   If configured, (W,QD2) are instead sampled from a tabulated envelope
+  //   (built once per resonance and energy bin and cached), and the max xsec
+  //   is not needed either.
+  const GridEnvelope2D * grid =
+         (fGenerateUniformly) ? 0 : this->Envelope(interaction);
+  Range1D_t gridW, gridQD2;
+  if(grid && !this->EnvelopeLimits(interaction, gridW, gridQD2)) grid = 0;
+
+  double xsec_max =
+         (fGenerateUniformly || grid) ? -1 : this->MaxXSec(evrec);
 
   //-- Try to select a valid W, Q2 pair using the rejection method
   double dW   = W.max - W.min;
+  double grid_max = -1;
   double xsec = -1;
 
   unsigned int iter = 0;
@@ -115,11 +124,8 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
          LOG("RESKinematics", pWARN)
               << "*** Could not select a valid (W,Q^2) pair after "
                                                     << iter << " iterations";
-         evrec->EventFlags()->SetBitNumber(kKineGenErr, true);
-         genie::exceptions::EVGThreadException exception;
-         exception.SetReason("Couldn't select kinematics");
-         exception.SwitchOnFastForward();
-         throw exception;
+         evrec->Reject(kKineGenErr); // Couldn't select kinematics
+         return;
      }
 
      double gW   = 0; // current hadronic invariant mass
@@ -137,6 +143,17 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
        interaction->SetBit(kISkipKinematicChk);
 
+     } else if(grid) {
+
+       // > Selecting unweighted event kinematics from the tabulated envelope:
+       // W and QD2 follow its piecewise-constant majorant of J*d2xsec/dWdQ2
+         double u = -1, v = -1;
+         grid_max = grid->Sample(rnd->RndKine().Rndm(),
+                      rnd->RndKine().Rndm(), rnd->RndKine().Rndm(), u, v);
+         gW   = gridW.min   + u * (gridW.max   - gridW.min);
+         gQD2 = gridQD2.min + v * (gridQD2.max - gridQD2.min);
+         gQ2  = utils::kinematics::QD2toQ2(gQD2);
+
      } else {
 
 
@@ -202,13 +219,13 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      interaction->KinePtr()->SetQ2(gQ2);
 
      //-- Computing cross section for the current kinematics
-     xsec = fXSecModel->XSec(interaction, kPSWQ2fE);
+     xsec = this->XSec(interaction, kPSWQ2fE);
 
      //-- Decide whether to accept the current kinematics
      if(!fGenerateUniformly) {
 
           // unified neutrino / electron scattering
-          double max = fEnvelope->Eval(gQD2, gW);
+          double max = (grid) ? grid_max : fEnvelope->Eval(gQD2, gW);
           double t   = max * rnd->RndKine().Rndm();
           double J   = kinematics::Jacobian(interaction,kPSWQ2fE,kPSWQD2fE);
 
@@ -301,6 +318,9 @@ void RESKinematicsGenerator::LoadConfig(void)
   // an event weight?
   this->GetParamDef("UniformOverPhaseSpace", fGenerateUniformly, false);
 
+  // Sample (W,QD2) from an envelope tabulated per resonance and energy bin?
+  this->LoadEnvelopeConfig();
+
   // Envelope employed when importance sampling is used
   // (initialize with dummy range)
   if(fEnvelope) delete fEnvelope;
@@ -367,7 +387,7 @@ double RESKinematicsGenerator::ComputeMaxXSec(
     for(int iq2=0; iq2<NQ2; iq2++) {
       double Q2 = TMath::Exp(logQ2min + iq2 * dlogQ2);
       interaction->KinePtr()->SetQ2(Q2);
-      double xsec = fXSecModel->XSec(interaction, kPSWQ2fE);
+      double xsec = this->XSec(interaction, kPSWQ2fE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
       LOG("RESKinematics", pDEBUG)
                 << "xsec(W= " << md << ", Q2= " << Q2 << ") = " << xsec;
@@ -385,7 +405,7 @@ double RESKinematicsGenerator::ComputeMaxXSec(
 	  Q2 = TMath::Exp(TMath::Log(Q2) - dlogQ2);
           if(Q2 < rQ2.min) continue;
           interaction->KinePtr()->SetQ2(Q2);
-          xsec = fXSecModel->XSec(interaction, kPSWQ2fE);
+          xsec = this->XSec(interaction, kPSWQ2fE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
           LOG("RESKinematics", pDEBUG)
                  << "xsec(W= " << md << ", Q2= " << Q2 << ") = " << xsec;
@@ -436,7 +456,7 @@ double RESKinematicsGenerator::ComputeMaxXSec(
       for(int iq2=0; iq2<NQ2; iq2++) {
         double Q2 = TMath::Exp(logQ2min + iq2 * dlogQ2);
         interaction->KinePtr()->SetQ2(Q2);
-        double xsec = fXSecModel->XSec(interaction, kPSWQ2fE);
+        double xsec = this->XSec(interaction, kPSWQ2fE);
         LOG("RESKinematics", pDEBUG)
                 << "xsec(W= " << W << ", Q2= " << Q2 << ") = " << xsec;
         max_xsec = TMath::Max(xsec, max_xsec);
@@ -452,7 +472,7 @@ double RESKinematicsGenerator::ComputeMaxXSec(
 	   Q2 = TMath::Exp(TMath::Log(Q2) - dlogQ2);
            if(Q2 < rQ2.min) continue;
            interaction->KinePtr()->SetQ2(Q2);
-           xsec = fXSecModel->XSec(interaction, kPSWQ2fE);
+           xsec = this->XSec(interaction, kPSWQ2fE);
            LOG("RESKinematics", pDEBUG)
                  << "xsec(W= " << W << ", Q2= " << Q2 << ") = " << xsec;
            max_xsec = TMath::Max(xsec, max_xsec);
@@ -477,3 +497,42 @@ double RESKinematicsGenerator::ComputeMaxXSec(
   return max_xsec;
 }
 //___________________________________________________________________________
+bool RESKinematicsGenerator::EnvelopeLimits(
+   const Interaction * interaction, Range1D_t & Wl, Range1D_t & QD2l) const
+{
+// W is sampled over the allowed range and QD2 over the range matching the
+// Q2 range at W.min (as for the TF2 envelope): (W,Q2) pairs outside the
+// allowed phase space have a null cross section and are rejected.
+
+  const KPhaseSpace & kps = interaction->PhaseSpace();
+  Wl = kps.Limits(kKVW);
+  if(Wl.max <=0 || Wl.min>=Wl.max) return false;
+
+  double W = interaction->Kine().W();
+  interaction->KinePtr()->SetW(Wl.min);
+  Range1D_t Q2 = kps.Q2Lim_W();
+  interaction->KinePtr()->SetW(W);
+
+  bool is_em = interaction->ProcInfo().IsEM();
+  double Q2min = (is_em) ? Q2.min + kASmallNum : kASmallNum;
+  double Q2max = Q2.max - kASmallNum;
+  if(Q2max <= Q2min) return false;
+
+  QD2l.min = utils::kinematics::Q2toQD2(Q2max);
+  QD2l.max = utils::kinematics::Q2toQD2(Q2min);
+  return true;
+}
+//___________________________________________________________________________
+double RESKinematicsGenerator::EnvelopeXSec(
+              const Interaction * interaction, double W, double QD2) const
+{
+  double Q2 = utils::kinematics::QD2toQ2(QD2);
+  interaction->KinePtr()->SetW(W);
+  interaction->KinePtr()->SetQ2(Q2);
+
+  double xsec = this->XSec(interaction, kPSWQ2fE);
+  if(xsec <= 0.) return 0.;
+  double J = kinematics::Jacobian(interaction, kPSWQ2fE, kPSWQD2fE);
+  return J * xsec;
+}
+//___________________________________________________________________________
@@ -45,6 +45,10 @@ private:
   void   LoadConfig      (void);
   double ComputeMaxXSec  (const Interaction * interaction) const;
 
+  // tabulated sampling envelope in (W,QD2)
+  bool   EnvelopeLimits  (const Interaction * in, Range1D_t & Wl, Range1D_t & QD2l) const;
+  double EnvelopeXSec    (const Interaction * in, double W, double QD2) const;
+
   mutable TF2 * fEnvelope; ///< 2-D envelope used for importance sampling
   double fWcut;            ///< Wcut parameter in DIS/RES join scheme
 };
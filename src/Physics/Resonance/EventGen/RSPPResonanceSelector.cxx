@@ -10,6 +10,12 @@
 
 #include <vector>
 #include <sstream>
+#include <map>
+#include <unordered_map>
+#include <mutex>
+#include <cmath>
+
+#include <TMath.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/EventGen/XSecAlgorithmI.h"
@@ -19,6 +25,7 @@
 #include "Framework/GHEP/GHepStatus.h"
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/GHEP/GHepRecord.h"
+#include "Framework/Interaction/InteractionKey.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/ParticleData/PDGLibrary.h"
@@ -27,9 +34,38 @@
 
 using std::vector;
 using std::ostringstream;
+using std::map;
+using std::pair;
 
 using namespace genie;
 
+//___________________________________________________________________________
+// Tables of the resonance contributions, keyed by selector, cross section
+// algorithm and channel, and shared by all threads. The nodes of a table,
+// keyed by their packed (E,W,Q2) grid indices, hold the xsec of each
+// resonance of the selector.
+namespace {
+
+  typedef std::unordered_map<ULong64_t, vector<double> > ResNodeMap;
+  typedef pair<const void *, const XSecAlgorithmI *>     ResTableOwner;
+  typedef map<pair<ResTableOwner, InteractionKey>, ResNodeMap> ResTableMap;
+
+  ResTableMap gResTables;
+  std::mutex  gResTableMutex;
+
+  const int kResTableNodeBits = 21; // per grid coordinate
+  const int kResTableNodeMax  = (1 << (kResTableNodeBits-1)) - 1;
+
+  ULong64_t ResTableNode(int iE, int iW, int iQ2)
+  {
+    const ULong64_t mask = (1ULL << kResTableNodeBits) - 1;
+    return  ( (ULong64_t) (iE  + kResTableNodeMax) & mask )
+         | (( (ULong64_t) (iW  + kResTableNodeMax) & mask ) <<   kResTableNodeBits )
+         | (( (ULong64_t) (iQ2 + kResTableNodeMax) & mask ) << 2*kResTableNodeBits );
+  }
+}
+
+
 //___________________________________________________________________________
 RSPPResonanceSelector::RSPPResonanceSelector() :
 HadronicSystemGenerator("genie::RSPPResonanceSelector")
@@ -88,35 +124,27 @@ Resonance_t RSPPResonanceSelector::SelectResonance(GHepRecord * evrec) const
   const EventGeneratorI * evg = rtinfo->RunningThread();
   const XSecAlgorithmI * xsecalg = evg->CrossSectionAlg();
 
-  //-- Loop over all considered baryon resonances and compute the double
-  //   differential cross section for the selected kinematical variables
+  //-- Compute the double differential cross section of all considered
+  //   baryon resonances for the selected kinematical variables, or
+  //   interpolate it from the tables
 
-  double xsec_sum  = 0;
   unsigned int nres = fResList.NResonances();
-  vector<double> xsec_vec(nres);
+  vector<double> xsec(nres, 0.);
 
-  for(unsigned int ires = 0; ires < nres; ires++) {
-
-     //-- Current resonance
-     Resonance_t res = fResList.ResonanceId(ires);
+  bool tabulated =
+     fUseTables && this->TabulatedXSec(interaction, xsecalg, q_res, &xsec[0]);
+  if(!tabulated) {
+     this->ResonanceXSec(interaction, xsecalg, q_res, &xsec[0]);
+  }
 
-     //-- Set the current resonance at the interaction summary
-     //   compute the differential cross section d^2xsec/dWdQ^2
-     //   (do it only for resonances that can conserve charge)
-     interaction->ExclTagPtr()->SetResonance(res);
+  double xsec_sum  = 0;
+  vector<double> xsec_vec(nres);
 
-     double xsec = 0;
-     bool   skip = (q_res==2 && !utils::res::IsDelta(res));
+  for(unsigned int ires = 0; ires < nres; ires++) {
 
-     if(!skip) xsec = xsecalg->XSec(interaction,kPSWQ2fE);
-     else {
-       SLOG("RESSelector", pNOTICE)
-                 << "RES: " << utils::res::AsString(res)
-                         << " would not conserve charge -- skipping it";
-     }
      //-- For the ith resonance store the sum of (xsec) * (breit-wigner)
      //   for the resonances in the range [0,i]
-     xsec_sum      += xsec;
+     xsec_sum      += xsec[ires];
      xsec_vec[ires] = xsec_sum;
 
      SLOG("RESSelector", pNOTICE)
@@ -152,6 +180,135 @@ Resonance_t RSPPResonanceSelector::SelectResonance(GHepRecord * evrec) const
   return kNoResonance;
 }
 //___________________________________________________________________________
+void RSPPResonanceSelector::ResonanceXSec(
+   Interaction * interaction, const XSecAlgorithmI * xsecalg,
+   int q_res, double * xsec) const
+{
+// Computes d^2xsec/dWdQ^2 of each considered resonance at the current
+// kinematics (running values) of the input interaction
+
+  unsigned int nres = fResList.NResonances();
+
+  for(unsigned int ires = 0; ires < nres; ires++) {
+
+     //-- Current resonance
+     Resonance_t res = fResList.ResonanceId(ires);
+
+     //-- Set the current resonance at the interaction summary
+     //   compute the differential cross section d^2xsec/dWdQ^2
+     //   (do it only for resonances that can conserve charge)
+     interaction->ExclTagPtr()->SetResonance(res);
+
+     xsec[ires] = 0;
+     bool skip = (q_res==2 && !utils::res::IsDelta(res));
+
+     if(!skip) xsec[ires] = xsecalg->XSec(interaction,kPSWQ2fE);
+     else {
+       SLOG("RESSelector", pNOTICE)
+                 << "RES: " << utils::res::AsString(res)
+                         << " would not conserve charge -- skipping it";
+     }
+  }
+}
+//___________________________________________________________________________
+bool RSPPResonanceSelector::TabulatedXSec(
+   Interaction * interaction, const XSecAlgorithmI * xsecalg,
+   int q_res, double * xsec) const
+{
+// Interpolates (trilinearly, in log10(E), W and Q2) d^2xsec/dWdQ^2 of each
+// considered resonance from the 8 nodes of the table of the channel around
+// the current kinematics. Missing nodes are computed and added to the table.
+// Returns false if any of these nodes has no valid resonance contribution
+// (eg. it is outside the kinematically allowed region).
+
+  unsigned int nres = fResList.NResonances();
+  if(nres == 0) return false;
+
+  const InitialState & init_state = interaction->InitState();
+  double E  = init_state.ProbeE(kRfHitNucRest);
+  double W  = interaction->Kine().W();
+  double Q2 = interaction->Kine().Q2();
+  if(E <= 0) return false;
+
+  double x[3] = { std::log10(E)/fTableDlog10E, W/fTableDW, Q2/fTableDQ2 };
+  int    i[3];
+  double f[3];
+  for(int k = 0; k < 3; k++) {
+    if(!(std::fabs(x[k]) < kResTableNodeMax - 1)) return false;
+    i[k] = (int) std::floor(x[k]);
+    f[k] = x[k] - i[k];
+  }
+
+  InteractionKey ikey = interaction->Key();
+  ResNodeMap * nodes = 0;
+  {
+    std::lock_guard<std::mutex> lock(gResTableMutex);
+    nodes = &gResTables[ std::make_pair(
+                ResTableOwner(this, xsecalg), ikey) ];
+  }
+
+  vector<double> node(nres);
+  TLorentzVector * probe_p4 = 0;
+
+  for(unsigned int ires = 0; ires < nres; ires++) xsec[ires] = 0;
+
+  bool valid = true;
+  for(int corner = 0; corner < 8 && valid; corner++) {
+    int    j[3];
+    double w = 1.;
+    for(int k = 0; k < 3; k++) {
+      int up = (corner >> k) & 1;
+      j[k] = i[k] + up;
+      w   *= (up) ? f[k] : 1.-f[k];
+    }
+    ULong64_t node_key = ResTableNode(j[0], j[1], j[2]);
+
+    bool found = false;
+    {
+      std::lock_guard<std::mutex> lock(gResTableMutex);
+      ResNodeMap::const_iterator it = nodes->find(node_key);
+      if(it != nodes->end()) {
+        node  = it->second;
+        found = true;
+      }
+    }
+
+    if(!found) {
+      // compute the node at its energy (the probe momentum is scaled, as
+      // for a massless probe, along with its energy at the hit nucleon rest
+      // frame) and kinematics
+      if(!probe_p4) probe_p4 = new TLorentzVector(*init_state.ProbeP4Ptr());
+      double Enode = TMath::Power(10., j[0]*fTableDlog10E);
+      interaction->InitStatePtr()->SetProbeP4( (*probe_p4) * (Enode/E) );
+      interaction->KinePtr()->SetW (j[1]*fTableDW);
+      interaction->KinePtr()->SetQ2(j[2]*fTableDQ2);
+
+      this->ResonanceXSec(interaction, xsecalg, q_res, &node[0]);
+
+      std::lock_guard<std::mutex> lock(gResTableMutex);
+      (*nodes)[node_key] = node;
+    }
+
+    double sum = 0;
+    for(unsigned int ires = 0; ires < nres; ires++) {
+      if(!(node[ires] >= 0) || std::isinf(node[ires])) valid = false;
+      sum += node[ires];
+      xsec[ires] += w * node[ires];
+    }
+    valid = valid && (sum > 0);
+  }
+
+  // restore the running kinematics & probe energy
+  if(probe_p4) {
+    interaction->InitStatePtr()->SetProbeP4(*probe_p4);
+    interaction->KinePtr()->SetW (W);
+    interaction->KinePtr()->SetQ2(Q2);
+    delete probe_p4;
+  }
+
+  return valid;
+}
+//___________________________________________________________________________
 void RSPPResonanceSelector::AddResonance(GHepRecord * evrec) const
 {
   // compute RES p4 = p4(neutrino) + p4(hit nucleon) - p4(primary lepton)
@@ -195,5 +352,12 @@ void RSPPResonanceSelector::LoadConfig(void)
 
   fResList.DecodeFromNameList(resonances);
   LOG("RESSelector", pINFO) << fResList;
+
+  this->GetParamDef("UseResonanceTables",      fUseTables,    true );
+  this->GetParamDef("ResonanceTable-Dlog10E",  fTableDlog10E, 0.1  );
+  this->GetParamDef("ResonanceTable-DW",       fTableDW,      0.01 );
+  this->GetParamDef("ResonanceTable-DQ2",      fTableDQ2,     0.05 );
+  fUseTables = fUseTables &&
+     fTableDlog10E > 0 && fTableDW > 0 && fTableDQ2 > 0;
 }
 //____________________________________________________________________________
@@ -7,6 +7,12 @@
           proceeding through resonance productions and adds it to the event
           record. The resonance is selected based on its contribution to the
           selected exclusive reaction cross section.
+          The resonance contributions can be interpolated from tables (per
+          cross section algorithm and channel, on a grid of the probe energy
+          at the hit nucleon rest frame, W and Q2) whose nodes are computed
+          the first time they are needed and shared by all threads. Events
+          falling next to nodes outside the kinematically allowed region are
+          treated with the exact calculation.
           Is a concrete implementation of the EventRecordVisitorI interface.
 
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
@@ -28,6 +34,8 @@
 
 namespace genie {
 
+class XSecAlgorithmI;
+
 class RSPPResonanceSelector : public HadronicSystemGenerator {
 
 public :
@@ -48,8 +56,16 @@ private:
 
   Resonance_t SelectResonance   (GHepRecord * event_rec) const;
   void        AddResonance      (GHepRecord * event_rec) const;
-
-  BaryonResList fResList; ///< baryon resonances taken into account
+  void        ResonanceXSec     (Interaction * interaction, const XSecAlgorithmI * xsecalg,
+                                 int q_res, double * xsec) const;
+  bool        TabulatedXSec     (Interaction * interaction, const XSecAlgorithmI * xsecalg,
+                                 int q_res, double * xsec) const;
+
+  BaryonResList fResList;       ///< baryon resonances taken into account
+  bool          fUseTables;     ///< interpolate the resonance contributions from tables?
+  double        fTableDlog10E;  ///< table node spacing in log10(E/GeV)
+  double        fTableDW;       ///< table node spacing in W (GeV)
+  double        fTableDQ2;      ///< table node spacing in Q2 (GeV^2)
 };
 
 }      // genie namespace
@@ -23,6 +23,8 @@
 */
 //____________________________________________________________________________
 
+#include <atomic>
+
 #include <TMath.h>
 #include <TSystem.h>
 
@@ -53,15 +55,36 @@
 using namespace genie;
 using namespace genie::constants;
 
+//____________________________________________________________________________
+namespace {
+
+  // Per-thread memo of the free nucleon d^2xsec/dWdQ2 of each resonance at
+  // the last kinematic point it was computed at. Summing over resonances,
+  // or over the pion production channels of a resonance, at the same point
+  // (eg ReinSehgalSPPPXSec, RSPPResonanceSelector) reuses these values.
+  struct ResonanceMemo_t {
+    unsigned long     config;   // configuration the value refers to (0: unset)
+    double            W, q2, E, Mnuc;
+    int               probe, nucleon;
+    InteractionType_t process;
+    double            xsec;
+  };
+  const int kNMemoResonances = kF17_1970 + 1;
+  thread_local ResonanceMemo_t gResonanceMemo[kNMemoResonances];
+
+  std::atomic<unsigned long> gNMemoConfigs(0); // configuration serial numbers
+}
 //____________________________________________________________________________
 BSKLNBaseRESPXSec2014::BSKLNBaseRESPXSec2014(string name) :
-XSecAlgorithmI(name)
+XSecAlgorithmI(name),
+fMemoConfig(0)
 {
 
 }
 //____________________________________________________________________________
 BSKLNBaseRESPXSec2014::BSKLNBaseRESPXSec2014(string name, string config) :
-XSecAlgorithmI(name, config)
+XSecAlgorithmI(name, config),
+fMemoConfig(0)
 {
 
 }
@@ -85,7 +108,6 @@ double BSKLNBaseRESPXSec2014::XSec(
   const Kinematics & kinematics = interaction -> Kine();
   double W  = kinematics.W();
   double q2 = kinematics.q2();
-  double costh = kinematics.FSLeptonP4().CosTheta();
 
   // Under the DIS/RES joining scheme, xsec(RES)=0 for W>=Wcut
   if(fUsingDisResJoin) {
@@ -99,6 +121,144 @@ double BSKLNBaseRESPXSec2014::XSec(
     }
   }
 
+  // Get the free nucleon d^2xsec/dWdQ2 (times the Breit-Wigner factor)
+  // of the input resonance, unless this thread has just computed it
+  // at the same kinematic point
+  Resonance_t resonance = interaction->ExclTag().Resonance();
+  int    nucpdgc = target.HitNucPdg();
+  double E       = init_state.ProbeE(kRfHitNucRest);
+  double Mnuc    = target.HitNucMass();
+
+  double xsec = 0.;
+  ResonanceMemo_t & memo = gResonanceMemo[resonance];
+  if(memo.config  == fMemoConfig &&
+     memo.W       == W           && memo.q2   == q2   &&
+     memo.E       == E           && memo.Mnuc == Mnuc &&
+     memo.probe   == init_state.ProbePdg() && memo.nucleon == nucpdgc &&
+     memo.process == proc_info.InteractionTypeId())
+  {
+     xsec = memo.xsec;
+  }
+  else {
+     xsec = this->ResonanceXSec(interaction);
+     memo.config  = fMemoConfig;
+     memo.W       = W;
+     memo.q2      = q2;
+     memo.E       = E;
+     memo.Mnuc    = Mnuc;
+     memo.probe   = init_state.ProbePdg();
+     memo.nucleon = nucpdgc;
+     memo.process = proc_info.InteractionTypeId();
+     memo.xsec    = xsec;
+  }
+  if(xsec == 0.) return 0.;
+
+  bool is_p  = pdg::IsProton (nucpdgc);
+  bool is_CC = proc_info.IsWeakCC();
+  bool is_NC = proc_info.IsWeakNC();
+
+  double W2    = TMath::Power(W,    2);
+  double Mnuc2 = TMath::Power(Mnuc, 2);
+  double k     = 0.5 * (W2 - Mnuc2)/Mnuc;
+  double v     = k - 0.5 * q2/Mnuc;
+  double Q2    = TMath::Power(v, 2) - q2;
+
+  // The algorithm computes d^2xsec/dWdQ2
+  // Check whether variable tranformation is needed
+  if ( kps != kPSWQ2fE ) {
+     double J = utils::kinematics::Jacobian(interaction,kPSWQ2fE,kps);
+     xsec *= J;
+  }
+
+  // Apply given scaling factor
+  if      (is_CC) { xsec *= fXSecScaleCC; }
+  else if (is_NC) { xsec *= fXSecScaleNC; }
+
+  // If requested return the free nucleon xsec even for input nuclear tgt
+  if ( interaction->TestBit(kIAssumeFreeNucleon) ) return xsec;
+
+  int Z = target.Z();
+  int A = target.A();
+  int N = A-Z;
+
+  // Take into account the number of scattering centers in the target
+  int NNucl = (is_p) ? Z : N;
+  xsec*=NNucl; // nuclear xsec (no nuclear suppression factor)
+
+  if ( fUsePauliBlocking && A!=1 )
+  {
+    // Calculation of Pauli blocking according references:
+    //
+    //     [1] S.L. Adler,  S. Nussinov,  and  E.A.  Paschos,  "Nuclear
+    //         charge exchange corrections to leptonic pion  production
+    //         in  the (3,3) resonance  region,"  Phys. Rev. D 9 (1974)
+    //         2125-2143 [Erratum Phys. Rev. D 10 (1974) 1669].
+    //     [2] J.Y. Yu, "Neutrino interactions and  nuclear  effects in
+    //         oscillation experiments and the  nonperturbative disper-
+    //         sive  sector in strong (quasi-)abelian  fields,"  Ph. D.
+    //         Thesis, Dortmund U., Dortmund, 2002 (unpublished).
+    //     [3] E.A. Paschos, J.Y. Yu,  and  M. Sakuda,  "Neutrino  pro-
+    //         duction  of  resonances,"  Phys. Rev. D 69 (2004) 014013
+    //         [arXiv: hep-ph/0308130].
+
+    double P_Fermi = 0.0;
+
+    // Maximum value of Fermi momentum of target nucleon (GeV)
+    if ( A<6 || ! fUseRFGParametrization )
+    {
+        // look up the Fermi momentum for this target
+        FermiMomentumTablePool * kftp = FermiMomentumTablePool::Instance();
+        const FermiMomentumTable * kft = kftp->GetTable(fKFTable);
+        P_Fermi = kft->FindClosestKF(pdg::IonPdgCode(A, Z), nucpdgc);
+     }
+     else {
+        // define the Fermi momentum for this target
+        P_Fermi = utils::nuclear::FermiMomentumForIsoscalarNucleonParametrization(target);
+        // correct the Fermi momentum for the struck nucleon
+        if(is_p) { P_Fermi *= TMath::Power( 2.*Z/A, 1./3); }
+        else     { P_Fermi *= TMath::Power( 2.*N/A, 1./3); }
+     }
+
+     double FactorPauli_RES = 1.0;
+
+     double k0 = 0., q = 0., q0 = 0.;
+
+     if (P_Fermi > 0.)
+     {
+        k0 = (W2-Mnuc2-Q2)/(2*W);
+        k = TMath::Sqrt(k0*k0+Q2);  // previous value of k is overridden
+        q0 = (W2-Mnuc2+kPionMass2)/(2*W);
+        q = TMath::Sqrt(q0*q0-kPionMass2);
+     }
+
+     if ( 2*P_Fermi < k-q )
+        FactorPauli_RES = 1.0;
+     if ( 2*P_Fermi >= k+q )
+        FactorPauli_RES = ((3*k*k+q*q)/(2*P_Fermi)-(5*TMath::Power(k,4)+TMath::Power(q,4)+10*k*k*q*q)/(40*TMath::Power(P_Fermi,3)))/(2*k);
+     if ( 2*P_Fermi >= k-q && 2*P_Fermi <= k+q )
+        FactorPauli_RES = ((q+k)*(q+k)-4*P_Fermi*P_Fermi/5-TMath::Power(k-q, 3)/(2*P_Fermi)+TMath::Power(k-q, 5)/(40*TMath::Power(P_Fermi, 3)))/(4*q*k);
+
+     xsec *= FactorPauli_RES;
+  }
+  return xsec;
+}
+//____________________________________________________________________________
+double BSKLNBaseRESPXSec2014::ResonanceXSec(
+                                    const Interaction * interaction) const
+{
+// Free nucleon d^2xsec/dWdQ2 of the input resonance, weighted with its
+// Breit-Wigner factor
+
+  const InitialState & init_state = interaction -> InitState();
+  const ProcessInfo &  proc_info  = interaction -> ProcInfo();
+  const Target & target = init_state.Tgt();
+
+  // Get kinematical parameters
+  const Kinematics & kinematics = interaction -> Kine();
+  double W  = kinematics.W();
+  double q2 = kinematics.q2();
+  double costh = kinematics.FSLeptonP4().CosTheta();
+
   // Get the input baryon resonance
   Resonance_t resonance = interaction->ExclTag().Resonance();
   string      resname   = utils::res::AsString(resonance);
@@ -337,20 +497,21 @@ double BSKLNBaseRESPXSec2014::XSec(
   double nomg   = IR * fOmega;
   double mq_w   = Mnuc*Q/W;
 
-  fFKR.Lamda  = sq2omg * mq_w;
-  fFKR.Tv     = GV / (3.*W*sq2omg);
-  fFKR.Rv     = kSqrt2 * mq_w*(W+Mnuc)*GV / d;
-  fFKR.S      = (-q2/Q2) * (3*W*Mnuc + q2 - Mnuc2) * GV / (6*Mnuc2);
-  fFKR.Ta     = (2./3.) * (fZeta/sq2omg) * mq_w * GA / d;
-  fFKR.Ra     = (kSqrt2/6.) * fZeta * (GA/W) * (W+Mnuc + 2*nomg*W/d );
-  fFKR.B      = fZeta/(3.*W*sq2omg) * (1 + (W2-Mnuc2+q2)/ d) * GA;
-  fFKR.C      = fZeta/(6.*Q) * (W2 - Mnuc2 + nomg*(W2-Mnuc2+q2)/d) * (GA/Mnuc);
-  fFKR.R      = fFKR.Rv;
-  fFKR.Rplus  = - (fFKR.Rv + fFKR.Ra);
-  fFKR.Rminus = - (fFKR.Rv - fFKR.Ra);
-  fFKR.T      = fFKR.Tv;
-  fFKR.Tplus  = - (fFKR.Tv + fFKR.Ta);
-  fFKR.Tminus = - (fFKR.Tv - fFKR.Ta);
+  FKR fkr;
+  fkr.Lamda  = sq2omg * mq_w;
+  fkr.Tv     = GV / (3.*W*sq2omg);
+  fkr.Rv     = kSqrt2 * mq_w*(W+Mnuc)*GV / d;
+  fkr.S      = (-q2/Q2) * (3*W*Mnuc + q2 - Mnuc2) * GV / (6*Mnuc2);
+  fkr.Ta     = (2./3.) * (fZeta/sq2omg) * mq_w * GA / d;
+  fkr.Ra     = (kSqrt2/6.) * fZeta * (GA/W) * (W+Mnuc + 2*nomg*W/d );
+  fkr.B      = fZeta/(3.*W*sq2omg) * (1 + (W2-Mnuc2+q2)/ d) * GA;
+  fkr.C      = fZeta/(6.*Q) * (W2 - Mnuc2 + nomg*(W2-Mnuc2+q2)/d) * (GA/Mnuc);
+  fkr.R      = fkr.Rv;
+  fkr.Rplus  = - (fkr.Rv + fkr.Ra);
+  fkr.Rminus = - (fkr.Rv - fkr.Ra);
+  fkr.T      = fkr.Tv;
+  fkr.Tplus  = - (fkr.Tv + fkr.Ta);
+  fkr.Tminus = - (fkr.Tv - fkr.Ta);
 
   //JN KNL
   double KNL_S_plus = 0;
@@ -364,11 +525,11 @@ double BSKLNBaseRESPXSec2014::XSec(
     KNL_S_plus  = (KNL_vstar_plus*vstar  - KNL_Qstar_plus *Qstar )* (Mnuc2 -q2 - 3*W*Mnuc ) * GV / (6*Mnuc2)/Q2; //possibly missing minus sign ()
     KNL_S_minus = (KNL_vstar_minus*vstar - KNL_Qstar_minus*Qstar )* (Mnuc2 -q2 - 3*W*Mnuc ) * GV / (6*Mnuc2)/Q2;
 
-    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"KNL S= " <<KNL_S_plus<<"\t"<<KNL_S_minus<<"\t"<<fFKR.S;
+    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"KNL S= " <<KNL_S_plus<<"\t"<<KNL_S_minus<<"\t"<<fkr.S;
 
     KNL_B_plus  = fZeta/(3.*W*sq2omg)/Qstar * (KNL_Qstar_plus  + KNL_vstar_plus *Qstar/a/Mnuc ) * GA;
     KNL_B_minus = fZeta/(3.*W*sq2omg)/Qstar * (KNL_Qstar_minus + KNL_vstar_minus*Qstar/a/Mnuc ) * GA;
-    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"KNL B= " <<KNL_B_plus<<"\t"<<KNL_B_minus<<"\t"<<fFKR.B;
+    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"KNL B= " <<KNL_B_plus<<"\t"<<KNL_B_minus<<"\t"<<fkr.B;
 
     KNL_C_plus = ( (KNL_Qstar_plus*Qstar - KNL_vstar_plus*vstar ) * ( 1./3. + vstar/a/Mnuc)
         + KNL_vstar_plus*(2./3.*W +q2/a/Mnuc + nomg/3./a/Mnuc) )* fZeta * (GA/2./W/Qstar);
@@ -376,7 +537,7 @@ double BSKLNBaseRESPXSec2014::XSec(
     KNL_C_minus = ( (KNL_Qstar_minus*Qstar - KNL_vstar_minus*vstar ) * ( 1./3. + vstar/a/Mnuc)
         + KNL_vstar_minus*(2./3.*W +q2/a/Mnuc + nomg/3./a/Mnuc) )* fZeta * (GA/2./W/Qstar);
 
-    LOG("BSKLNBaseRESPXSec2014",pINFO)  <<"KNL C= "<<KNL_C_plus<<"\t"<<KNL_C_minus<<"\t"<<fFKR.C;
+    LOG("BSKLNBaseRESPXSec2014",pINFO)  <<"KNL C= "<<KNL_C_plus<<"\t"<<KNL_C_minus<<"\t"<<fkr.C;
   }
   double BRS_S_plus = 0;
   double BRS_S_minus = 0;
@@ -404,26 +565,26 @@ double BSKLNBaseRESPXSec2014::XSec(
 
     BRS_S_plus = KNL_S_plus;
     BRS_S_minus = KNL_S_minus;
-    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"BRS S= " <<KNL_S_plus<<"\t"<<KNL_S_minus<<"\t"<<fFKR.S;
+    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"BRS S= " <<KNL_S_plus<<"\t"<<KNL_S_minus<<"\t"<<fkr.S;
 
     BRS_B_plus = KNL_B_plus + fZeta*GA/2./W/Qstar*( KNL_Qstar_plus*vstar - KNL_vstar_plus*Qstar)
       *( 2./3 /sq2omg *(vstar + Qstar*Qstar/Mnuc/a))/(kPionMass2 -q2);
 
     BRS_B_minus = KNL_B_minus + fZeta*GA/2./W/Qstar*( KNL_Qstar_minus*vstar - KNL_vstar_minus*Qstar)
       *( 2./3 /sq2omg *(vstar + Qstar*Qstar/Mnuc/a))/(kPionMass2 -q2);
-    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"BRS B= " <<KNL_B_plus<<"\t"<<KNL_B_minus<<"\t"<<fFKR.B;
+    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"BRS B= " <<KNL_B_plus<<"\t"<<KNL_B_minus<<"\t"<<fkr.B;
 
     BRS_C_plus = KNL_C_plus  + fZeta*GA/2./W/Qstar*( KNL_Qstar_plus*vstar - KNL_vstar_plus*Qstar)
       * Qstar*(2./3.*W +q2/Mnuc/a +nomg/3./a/Mnuc)/(kPionMass2 -q2);
 
     BRS_C_minus = KNL_C_minus  + fZeta*GA/2./W/Qstar*( KNL_Qstar_minus*vstar - KNL_vstar_minus*Qstar)
       * Qstar*(2./3.*W +q2/Mnuc/a +nomg/3./a/Mnuc)/(kPionMass2 -q2);
-    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"BRS C= " <<KNL_C_plus<<"\t"<<KNL_C_minus<<"\t"<<fFKR.C;
+    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"BRS C= " <<KNL_C_plus<<"\t"<<KNL_C_minus<<"\t"<<fkr.C;
   }
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("FKR", pDEBUG)
-    << "FKR params for RES = " << resname << " : " << fFKR;
+    << "FKR params for RES = " << resname << " : " << fkr;
 #endif
 
   // Calculate the Rein-Sehgal Helicity Amplitudes
@@ -490,28 +651,28 @@ double BSKLNBaseRESPXSec2014::XSec(
       }
       else
         if(is_CC && is_KLN ){
-          fFKR.S = KNL_S_minus;        //2 times fFKR.S?
-          fFKR.B = KNL_B_minus;
-          fFKR.C = KNL_C_minus;
+          fkr.S = KNL_S_minus;        //2 times fkr.S?
+          fkr.B = KNL_B_minus;
+          fkr.C = KNL_C_minus;
 
           hamplmod_KNL_minus = fHAmplModelCC;
 
           assert(hamplmod_KNL_minus);
 
-          const RSHelicityAmpl & hampl_KNL_minus = hamplmod_KNL_minus->Compute(resonance, fFKR);
+          const RSHelicityAmpl & hampl_KNL_minus = hamplmod_KNL_minus->Compute(resonance, fkr);
 
           sigL_minus = (hampl_KNL_minus.Amp2Plus3 () + hampl_KNL_minus.Amp2Plus1 ());
           sigR_minus = (hampl_KNL_minus.Amp2Minus3() + hampl_KNL_minus.Amp2Minus1());
           sigS_minus = (hampl_KNL_minus.Amp20Plus () + hampl_KNL_minus.Amp20Minus());
 
 
-          fFKR.S = KNL_S_plus;
-          fFKR.B = KNL_B_plus;
-          fFKR.C = KNL_C_plus;
+          fkr.S = KNL_S_plus;
+          fkr.B = KNL_B_plus;
+          fkr.C = KNL_C_plus;
           hamplmod_KNL_plus = fHAmplModelCC;
           assert(hamplmod_KNL_plus);
 
-          const RSHelicityAmpl & hampl_KNL_plus = hamplmod_KNL_plus->Compute(resonance, fFKR);
+          const RSHelicityAmpl & hampl_KNL_plus = hamplmod_KNL_plus->Compute(resonance, fkr);
 
           sigL_plus = (hampl_KNL_plus.Amp2Plus3 () + hampl_KNL_plus.Amp2Plus1 ());
           sigR_plus = (hampl_KNL_plus.Amp2Minus3() + hampl_KNL_plus.Amp2Minus1());
@@ -520,26 +681,26 @@ double BSKLNBaseRESPXSec2014::XSec(
         }
         else
           if(is_CC && is_BRS ){
-            fFKR.S = BRS_S_minus;
-            fFKR.B = BRS_B_minus;
-            fFKR.C = BRS_C_minus;
+            fkr.S = BRS_S_minus;
+            fkr.B = BRS_B_minus;
+            fkr.C = BRS_C_minus;
 
             hamplmod_BRS_minus = fHAmplModelCC;
             assert(hamplmod_BRS_minus);
 
-            const RSHelicityAmpl & hampl_BRS_minus = hamplmod_BRS_minus->Compute(resonance, fFKR);
+            const RSHelicityAmpl & hampl_BRS_minus = hamplmod_BRS_minus->Compute(resonance, fkr);
 
             sigL_minus = (hampl_BRS_minus.Amp2Plus3 () + hampl_BRS_minus.Amp2Plus1 ());
             sigR_minus = (hampl_BRS_minus.Amp2Minus3() + hampl_BRS_minus.Amp2Minus1());
             sigS_minus = (hampl_BRS_minus.Amp20Plus () + hampl_BRS_minus.Amp20Minus());
 
-            fFKR.S = BRS_S_plus;
-            fFKR.B = BRS_B_plus;
-            fFKR.C = BRS_C_plus;
+            fkr.S = BRS_S_plus;
+            fkr.B = BRS_B_plus;
+            fkr.C = BRS_C_plus;
             hamplmod_BRS_plus = fHAmplModelCC;
             assert(hamplmod_BRS_plus);
 
-            const RSHelicityAmpl & hampl_BRS_plus = hamplmod_BRS_plus->Compute(resonance, fFKR);
+            const RSHelicityAmpl & hampl_BRS_plus = hamplmod_BRS_plus->Compute(resonance, fkr);
 
             sigL_plus = (hampl_BRS_plus.Amp2Plus3 () + hampl_BRS_plus.Amp2Plus1 ());
             sigR_plus = (hampl_BRS_plus.Amp2Minus3() + hampl_BRS_plus.Amp2Minus1());
@@ -564,7 +725,7 @@ double BSKLNBaseRESPXSec2014::XSec(
   else {
      assert(hamplmod);
 
-     const RSHelicityAmpl & hampl = hamplmod->Compute(resonance, fFKR);
+     const RSHelicityAmpl & hampl = hamplmod->Compute(resonance, fkr);
 
      sigL = scLR* (hampl.Amp2Plus3 () + hampl.Amp2Plus1 ());
      sigR = scLR* (hampl.Amp2Minus3() + hampl.Amp2Minus1());
@@ -589,7 +750,7 @@ double BSKLNBaseRESPXSec2014::XSec(
       LOG("BSKLNBaseRESPXSec2014",pINFO) << "A-="<<KNL_Alambda_minus<<" A+="<<KNL_Alambda_plus;
       // protect against sigRSR=sigRSL=sigRSS=0
       LOG("BSKLNBaseRESPXSec2014",pINFO) <<q2<<"\t"<<xsec<<"\t"<<sig0*(V2*sigR + U2*sigL + 2*UV*sigS)<<"\t"<<xsec/TMath::Max(sig0*(V2*sigRSR + U2*sigRSL + 2*UV*sigRSS),1.0e-100);
-      LOG("BSKLNBaseRESPXSec2014",pINFO) <<"fFKR.B="<<fFKR.B<<" fFKR.C="<<fFKR.C<<" fFKR.S="<<fFKR.S;
+      LOG("BSKLNBaseRESPXSec2014",pINFO) <<"fkr.B="<<fkr.B<<" fkr.C="<<fkr.C<<" fkr.S="<<fkr.S;
       LOG("BSKLNBaseRESPXSec2014",pINFO) <<"CL-="<<TMath::Power(KNL_cL_minus,2)<<" CL+="<<TMath::Power(KNL_cL_plus,2)<<" U2="<<U2;
       LOG("BSKLNBaseRESPXSec2014",pINFO) <<"SL-="<<sigL_minus<<" SL+="<<sigL_plus<<" SL="<<sigRSL;
 
@@ -633,83 +794,6 @@ double BSKLNBaseRESPXSec2014::XSec(
       << "](W=" << W << ", q2=" << q2 << ", E=" << E << ") = " << xsec;
 #endif
 
-  // The algorithm computes d^2xsec/dWdQ2
-  // Check whether variable tranformation is needed
-  if ( kps != kPSWQ2fE ) {
-     double J = utils::kinematics::Jacobian(interaction,kPSWQ2fE,kps);
-     xsec *= J;
-  }
-
-  // Apply given scaling factor
-  if      (is_CC) { xsec *= fXSecScaleCC; }
-  else if (is_NC) { xsec *= fXSecScaleNC; }
-
-  // If requested return the free nucleon xsec even for input nuclear tgt
-  if ( interaction->TestBit(kIAssumeFreeNucleon) ) return xsec;
-
-  int Z = target.Z();
-  int A = target.A();
-  int N = A-Z;
-
-  // Take into account the number of scattering centers in the target
-  int NNucl = (is_p) ? Z : N;
-  xsec*=NNucl; // nuclear xsec (no nuclear suppression factor)
-
-  if ( fUsePauliBlocking && A!=1 )
-  {
-    // Calculation of Pauli blocking according references:
-    //
-    //     [1] S.L. Adler,  S. Nussinov,  and  E.A.  Paschos,  "Nuclear
-    //         charge exchange corrections to leptonic pion  production
-    //         in  the (3,3) resonance  region,"  Phys. Rev. D 9 (1974)
-    //         2125-2143 [Erratum Phys. Rev. D 10 (1974) 1669].
-    //     [2] J.Y. Yu, "Neutrino interactions and  nuclear  effects in
-    //         oscillation experiments and the  nonperturbative disper-
-    //         sive  sector in strong (quasi-)abelian  fields,"  Ph. D.
-    //         Thesis, Dortmund U., Dortmund, 2002 (unpublished).
-    //     [3] E.A. Paschos, J.Y. Yu,  and  M. Sakuda,  "Neutrino  pro-
-    //         duction  of  resonances,"  Phys. Rev. D 69 (2004) 014013
-    //         [arXiv: hep-ph/0308130].
-
-    double P_Fermi = 0.0;
-
-    // Maximum value of Fermi momentum of target nucleon (GeV)
-    if ( A<6 || ! fUseRFGParametrization )
-    {
-        // look up the Fermi momentum for this target
-        FermiMomentumTablePool * kftp = FermiMomentumTablePool::Instance();
-        const FermiMomentumTable * kft = kftp->GetTable(fKFTable);
-        P_Fermi = kft->FindClosestKF(pdg::IonPdgCode(A, Z), nucpdgc);
-     }
-     else {
-        // define the Fermi momentum for this target
-        P_Fermi = utils::nuclear::FermiMomentumForIsoscalarNucleonParametrization(target);
-        // correct the Fermi momentum for the struck nucleon
-        if(is_p) { P_Fermi *= TMath::Power( 2.*Z/A, 1./3); }
-        else     { P_Fermi *= TMath::Power( 2.*N/A, 1./3); }
-     }
-
-     double FactorPauli_RES = 1.0;
-
-     double k0 = 0., q = 0., q0 = 0.;
-
-     if (P_Fermi > 0.)
-     {
-        k0 = (W2-Mnuc2-Q2)/(2*W);
-        k = TMath::Sqrt(k0*k0+Q2);  // previous value of k is overridden
-        q0 = (W2-Mnuc2+kPionMass2)/(2*W);
-        q = TMath::Sqrt(q0*q0-kPionMass2);
-     }
-
-     if ( 2*P_Fermi < k-q )
-        FactorPauli_RES = 1.0;
-     if ( 2*P_Fermi >= k+q )
-        FactorPauli_RES = ((3*k*k+q*q)/(2*P_Fermi)-(5*TMath::Power(k,4)+TMath::Power(q,4)+10*k*k*q*q)/(40*TMath::Power(P_Fermi,3)))/(2*k);
-     if ( 2*P_Fermi >= k-q && 2*P_Fermi <= k+q )
-        FactorPauli_RES = ((q+k)*(q+k)-4*P_Fermi*P_Fermi/5-TMath::Power(k-q, 3)/(2*P_Fermi)+TMath::Power(k-q, 5)/(40*TMath::Power(P_Fermi, 3)))/(4*q*k);
-
-     xsec *= FactorPauli_RES;
-  }
   return xsec;
 }
 //____________________________________________________________________________
@@ -760,6 +844,9 @@ void BSKLNBaseRESPXSec2014::Configure(string config)
 //____________________________________________________________________________
 void BSKLNBaseRESPXSec2014::LoadConfig(void)
 {
+  // Invalidate the values memoised with the previous configuration
+  fMemoConfig = ++gNMemoConfigs;
+
   // Cross section scaling factors
   this->GetParam( "RES-CC-XSecScale", fXSecScaleCC ) ;
   this->GetParam( "RES-NC-XSecScale", fXSecScaleNC ) ;
@@ -65,9 +65,8 @@ namespace genie {
       BSKLNBaseRESPXSec2014(string name);
       BSKLNBaseRESPXSec2014(string name, string config);
 
-      void LoadConfig (void);
-
-      mutable FKR fFKR;
+      void   LoadConfig    (void);
+      double ResonanceXSec (const Interaction * i) const;
 
       const RSHelicityAmplModelI * fHAmplModelCC;
       const RSHelicityAmplModelI * fHAmplModelNCp;
@@ -100,6 +99,8 @@ namespace genie {
       bool fKLN;
       bool fBRS;
 
+      unsigned long fMemoConfig;   ///< serial number of this configuration, keying the per-thread memo
+
       bool fGA;
       bool fGV;
 
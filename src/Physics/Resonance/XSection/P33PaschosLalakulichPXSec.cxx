@@ -117,9 +117,9 @@ double P33PaschosLalakulichPXSec::XSec(
   double Gamma_R=Gamma_R0*pow((this->PPiStar(W,MN)/this->PPiStar(MR,MN)),3);
 
   // check for other option
-  if ( GetConfig().Exists("running-gamma") ) {
+  if ( fRunningGamma.IsValid() ) {
 
-     string gamma_model = GetConfig().GetString("running-gamma");
+     const string & gamma_model = fRunningGamma.Value();
 
      if ( gamma_model.find("Hagiwara") != string::npos )
      {
@@ -295,6 +295,8 @@ void P33PaschosLalakulichPXSec::LoadConfig(void)
 
   GetParamDef( "TurnOnPauliSuppr", fTurnOnPauliCorrection, false ) ;
 
+  FindParam( "running-gamma", fRunningGamma, false ) ;
+
   //-- load the differential cross section integrator
   fXSecIntegrator =
       dynamic_cast<const XSecIntegratorI *> (this->SubAlg("XSec-Integrator"));
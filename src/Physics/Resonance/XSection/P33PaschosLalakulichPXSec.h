@@ -59,6 +59,8 @@ private:
 
   const XSecIntegratorI *   fXSecIntegrator;
 
+  AlgParamHandle<RgStr> fRunningGamma; //! running Gamma model (if configured)
+
   bool   fTurnOnPauliCorrection;
   double fMa;
   double fMv;
@@ -30,6 +30,8 @@ public:
   virtual ~RSHelicityAmplModelI();
 
   // define the RSHelicityAmplModelI interface
+  // (the returned amplitudes belong to the calling thread and are
+  //  overwritten by its next Compute() call)
   virtual const RSHelicityAmpl & Compute(Resonance_t res, const FKR & fkr) const = 0;
 
 protected:
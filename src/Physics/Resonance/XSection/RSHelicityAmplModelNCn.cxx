@@ -19,6 +19,12 @@
 using namespace genie;
 using namespace genie::constants;
 
+//____________________________________________________________________________
+namespace {
+  // helicity amplitudes computed by the calling thread
+  thread_local RSHelicityAmpl gAmpl;
+}
+
 //____________________________________________________________________________
 RSHelicityAmplModelNCn::RSHelicityAmplModelNCn() :
 RSHelicityAmplModelI("genie::RSHelicityAmplModelNCn")
@@ -51,12 +57,12 @@ const RSHelicityAmpl &
      double Rm2xiR = fkr.Rminus + rx;
      double Rp2xiR = fkr.Rplus  + rx;
 
-     fAmpl.fMinus1 =  -kSqrt2 * Rm2xiR;
-     fAmpl.fPlus1  =   kSqrt2 * Rp2xiR;
-     fAmpl.fMinus3 =  -kSqrt6 * Rm2xiR;
-     fAmpl.fPlus3  =   kSqrt6 * Rp2xiR;
-     fAmpl.f0Minus = 2*kSqrt2 * fkr.C;
-     fAmpl.f0Plus  =   fAmpl.f0Minus;
+     gAmpl.fMinus1 =  -kSqrt2 * Rm2xiR;
+     gAmpl.fPlus1  =   kSqrt2 * Rp2xiR;
+     gAmpl.fMinus3 =  -kSqrt6 * Rm2xiR;
+     gAmpl.fPlus3  =   kSqrt6 * Rp2xiR;
+     gAmpl.f0Minus = 2*kSqrt2 * fkr.C;
+     gAmpl.f0Plus  =   gAmpl.f0Minus;
      break;
    }
    case (kS11_1535) :
@@ -70,12 +76,12 @@ const RSHelicityAmpl &
      double a       = kSqrt3_2 * (1-2*xi) * fkr.Lamda * fkr.S;
      double b       = kSqrt2_3 * (fkr.Lamda * fkr.C - 3*fkr.B);
 
-     fAmpl.fMinus1 = -1*kSqrt3 * Tm2xiT - kSqrt2_3 * LRmxiR;
-     fAmpl.fPlus1  =    kSqrt3 * Tp2xiT + kSqrt2_3 * LRpxiR;
-     fAmpl.fMinus3 =  0.;
-     fAmpl.fPlus3  =  0.;
-     fAmpl.f0Minus =  a-b;
-     fAmpl.f0Plus  = -a-b;
+     gAmpl.fMinus1 = -1*kSqrt3 * Tm2xiT - kSqrt2_3 * LRmxiR;
+     gAmpl.fPlus1  =    kSqrt3 * Tp2xiT + kSqrt2_3 * LRpxiR;
+     gAmpl.fMinus3 =  0.;
+     gAmpl.fPlus3  =  0.;
+     gAmpl.f0Minus =  a-b;
+     gAmpl.f0Plus  = -a-b;
      break;
    }
    case (kD13_1520) :
@@ -89,12 +95,12 @@ const RSHelicityAmpl &
      double a       = kSqrt3 * (1-2*xi) * fkr.Lamda * fkr.S;
      double b       = k2_Sqrt3 * fkr.Lamda * fkr.C;
 
-     fAmpl.fMinus1 = -kSqrt3_2 * Tm2xiT + k2_Sqrt3 * LRmxiR;
-     fAmpl.fPlus1  = -kSqrt3_2 * Tp2xiT + k2_Sqrt3 * LRpxiR;
-     fAmpl.fMinus3 = -k3_Sqrt2 * Tm2xiT;
-     fAmpl.fPlus3  = -k3_Sqrt2 * Tp2xiT;
-     fAmpl.f0Minus =  a - b;
-     fAmpl.f0Plus  =  a + b;
+     gAmpl.fMinus1 = -kSqrt3_2 * Tm2xiT + k2_Sqrt3 * LRmxiR;
+     gAmpl.fPlus1  = -kSqrt3_2 * Tp2xiT + k2_Sqrt3 * LRpxiR;
+     gAmpl.fMinus3 = -k3_Sqrt2 * Tm2xiT;
+     gAmpl.fPlus3  = -k3_Sqrt2 * Tp2xiT;
+     gAmpl.f0Minus =  a - b;
+     gAmpl.f0Plus  =  a + b;
      break;
    }
    case (kS11_1650) :
@@ -103,12 +109,12 @@ const RSHelicityAmpl &
      double LRm4xiR = fkr.Lamda * (fkr.Rminus + xr);
      double LRp4xiR = fkr.Lamda * (fkr.Rplus  + xr);
 
-     fAmpl.fMinus1 = -k1_Sqrt24 * LRm4xiR;
-     fAmpl.fPlus1  =  k1_Sqrt24 * LRp4xiR;
-     fAmpl.fMinus3 =  0.;
-     fAmpl.fPlus3  =  0.;
-     fAmpl.f0Minus =  k1_Sqrt6 * (fkr.Lamda * fkr.C - 3*fkr.B);
-     fAmpl.f0Plus  =  fAmpl.f0Minus;
+     gAmpl.fMinus1 = -k1_Sqrt24 * LRm4xiR;
+     gAmpl.fPlus1  =  k1_Sqrt24 * LRp4xiR;
+     gAmpl.fMinus3 =  0.;
+     gAmpl.fPlus3  =  0.;
+     gAmpl.f0Minus =  k1_Sqrt6 * (fkr.Lamda * fkr.C - 3*fkr.B);
+     gAmpl.f0Plus  =  gAmpl.f0Minus;
      break;
    }
    case (kD13_1700) :
@@ -117,12 +123,12 @@ const RSHelicityAmpl &
      double LRm4xiR = fkr.Lamda * (fkr.Rminus + xr);
      double LRp4xiR = fkr.Lamda * (fkr.Rplus  + xr);
 
-     fAmpl.fMinus1 = -k1_Sqrt120 * LRm4xiR;
-     fAmpl.fPlus1  = -k1_Sqrt120 * LRp4xiR;
-     fAmpl.fMinus3 = -k3_Sqrt40  * LRm4xiR;
-     fAmpl.fPlus3  = -k3_Sqrt40  * LRp4xiR;
-     fAmpl.f0Minus = -k1_Sqrt30  * fkr.Lamda * fkr.C;
-     fAmpl.f0Plus  =  -1.* fAmpl.f0Minus;
+     gAmpl.fMinus1 = -k1_Sqrt120 * LRm4xiR;
+     gAmpl.fPlus1  = -k1_Sqrt120 * LRp4xiR;
+     gAmpl.fMinus3 = -k3_Sqrt40  * LRm4xiR;
+     gAmpl.fPlus3  = -k3_Sqrt40  * LRp4xiR;
+     gAmpl.f0Minus = -k1_Sqrt30  * fkr.Lamda * fkr.C;
+     gAmpl.f0Plus  =  -1.* gAmpl.f0Minus;
      break;
    }
    case (kD15_1675) :
@@ -131,12 +137,12 @@ const RSHelicityAmpl &
      double LRm4xiR = fkr.Lamda * (fkr.Rminus + xr);
      double LRp4xiR = fkr.Lamda * (fkr.Rplus  + xr);
 
-     fAmpl.fMinus1 =  kSqrt3_40 * LRm4xiR;
-     fAmpl.fPlus1  = -kSqrt3_40 * LRp4xiR;
-     fAmpl.fMinus3 =  kSqrt3_20 * LRm4xiR;
-     fAmpl.fPlus3  = -kSqrt3_20 * LRp4xiR;
-     fAmpl.f0Minus = -kSqrt3_10 * (fkr.Lamda * fkr.C);
-     fAmpl.f0Plus  =  fAmpl.f0Minus;
+     gAmpl.fMinus1 =  kSqrt3_40 * LRm4xiR;
+     gAmpl.fPlus1  = -kSqrt3_40 * LRp4xiR;
+     gAmpl.fMinus3 =  kSqrt3_20 * LRm4xiR;
+     gAmpl.fPlus3  = -kSqrt3_20 * LRp4xiR;
+     gAmpl.f0Minus = -kSqrt3_10 * (fkr.Lamda * fkr.C);
+     gAmpl.f0Plus  =  gAmpl.f0Minus;
      break;
    }
    case (kS31_1620) :
@@ -150,12 +156,12 @@ const RSHelicityAmpl &
      double a       = kSqrt3_2 * (1-2*xi) * fkr.Lamda * fkr.S;
      double b       = k1_Sqrt6 * (fkr.Lamda * fkr.C - 3*fkr.B);
 
-     fAmpl.fMinus1 =  kSqrt3 * Tm2xiT - k1_Sqrt6 * LRm2xiR;
-     fAmpl.fPlus1  = -kSqrt3 * Tp2xiT + k1_Sqrt6 * LRp2xiR;
-     fAmpl.fMinus3 =  0.;
-     fAmpl.fPlus3  =  0.;
-     fAmpl.f0Minus = -a-b;
-     fAmpl.f0Plus  =  a-b;
+     gAmpl.fMinus1 =  kSqrt3 * Tm2xiT - k1_Sqrt6 * LRm2xiR;
+     gAmpl.fPlus1  = -kSqrt3 * Tp2xiT + k1_Sqrt6 * LRp2xiR;
+     gAmpl.fMinus3 =  0.;
+     gAmpl.fPlus3  =  0.;
+     gAmpl.f0Minus = -a-b;
+     gAmpl.f0Plus  =  a-b;
      break;
    }
    case (kD33_1700) :
@@ -169,12 +175,12 @@ const RSHelicityAmpl &
      double a       = kSqrt3 * (1-2*xi) * fkr.Lamda * fkr.S;
      double b       = k1_Sqrt3 * fkr.Lamda * fkr.C;
 
-     fAmpl.fMinus1 = kSqrt3_2 * Tm2xiT + k1_Sqrt3 * LRm2xiR;
-     fAmpl.fPlus1  = kSqrt3_2 * Tp2xiT + k1_Sqrt3 * LRp2xiR;
-     fAmpl.fMinus3 = k3_Sqrt2 * Tm2xiT;
-     fAmpl.fPlus3  = k3_Sqrt2 * Tp2xiT;
-     fAmpl.f0Minus = -a-b;
-     fAmpl.f0Plus  = -a+b;
+     gAmpl.fMinus1 = kSqrt3_2 * Tm2xiT + k1_Sqrt3 * LRm2xiR;
+     gAmpl.fPlus1  = kSqrt3_2 * Tp2xiT + k1_Sqrt3 * LRp2xiR;
+     gAmpl.fMinus3 = k3_Sqrt2 * Tm2xiT;
+     gAmpl.fPlus3  = k3_Sqrt2 * Tp2xiT;
+     gAmpl.f0Minus = -a-b;
+     gAmpl.f0Plus  = -a+b;
      break;
    }
    case (kP11_1440) :
@@ -187,12 +193,12 @@ const RSHelicityAmpl &
      double a       = 0.25*kSqrt3 * L2 * fkr.S;
      double b       = c * (L2 * fkr.C - 2 * fkr.Lamda * fkr.B);
 
-     fAmpl.fMinus1 = c * L2RmxiR;
-     fAmpl.fPlus1  = c * L2RpxiR;
-     fAmpl.fMinus3 = 0.;
-     fAmpl.fPlus3  = 0.;
-     fAmpl.f0Minus = a - b;
-     fAmpl.f0Plus  = a + b;
+     gAmpl.fMinus1 = c * L2RmxiR;
+     gAmpl.fPlus1  = c * L2RpxiR;
+     gAmpl.fMinus3 = 0.;
+     gAmpl.fPlus3  = 0.;
+     gAmpl.f0Minus = a - b;
+     gAmpl.f0Plus  = a + b;
      break;
    }
    case (kP33_1600) :
@@ -202,12 +208,12 @@ const RSHelicityAmpl &
      double L2RmxiR = L2 * (fkr.Rminus + xr);
      double L2RpxiR = L2 * (fkr.Rplus  + xr);
 
-     fAmpl.fMinus1 =  k1_Sqrt6 * L2RmxiR;
-     fAmpl.fPlus1  = -k1_Sqrt6 * L2RpxiR;
-     fAmpl.fMinus3 =  k1_Sqrt2 * L2RmxiR;
-     fAmpl.fPlus3  = -k1_Sqrt2 * L2RpxiR;
-     fAmpl.f0Minus = -kSqrt2_3 * (L2 * fkr.C - 2 * fkr.Lamda * fkr.B);
-     fAmpl.f0Plus  =  fAmpl.f0Minus;
+     gAmpl.fMinus1 =  k1_Sqrt6 * L2RmxiR;
+     gAmpl.fPlus1  = -k1_Sqrt6 * L2RpxiR;
+     gAmpl.fMinus3 =  k1_Sqrt2 * L2RmxiR;
+     gAmpl.fPlus3  = -k1_Sqrt2 * L2RpxiR;
+     gAmpl.f0Minus = -kSqrt2_3 * (L2 * fkr.C - 2 * fkr.Lamda * fkr.B);
+     gAmpl.f0Plus  =  gAmpl.f0Minus;
      break;
    }
    case (kP13_1720) :
@@ -221,12 +227,12 @@ const RSHelicityAmpl &
      double a       = kSqrt3_20 * L2 * fkr.S;
      double b       = kSqrt5_12 * (L2 * fkr.C - 5 * fkr.Lamda * fkr.B);
 
-     fAmpl.fMinus1 =  kSqrt27_40 * LTm + kSqrt5_12 * L2RmxiR;
-     fAmpl.fPlus1  = -kSqrt27_40 * LTp - kSqrt5_12 * L2RpxiR;
-     fAmpl.fMinus3 = -kSqrt9_40 * LTm;
-     fAmpl.fPlus3  =  kSqrt9_40 * LTp;
-     fAmpl.f0Minus = -a+b;
-     fAmpl.f0Plus  =  a+b;
+     gAmpl.fMinus1 =  kSqrt27_40 * LTm + kSqrt5_12 * L2RmxiR;
+     gAmpl.fPlus1  = -kSqrt27_40 * LTp - kSqrt5_12 * L2RpxiR;
+     gAmpl.fMinus3 = -kSqrt9_40 * LTm;
+     gAmpl.fPlus3  =  kSqrt9_40 * LTp;
+     gAmpl.f0Minus = -a+b;
+     gAmpl.f0Plus  =  a+b;
      break;
    }
    case (kF15_1680) :
@@ -240,12 +246,12 @@ const RSHelicityAmpl &
      double a       = k3_Sqrt40 * L2 * fkr.S;
      double b       = kSqrt5_8  * L2 * fkr.C;
 
-     fAmpl.fMinus1 =  k3_Sqrt20 * LTm - kSqrt5_8 * L2RmxiR;
-     fAmpl.fPlus1  =  k3_Sqrt20 * LTp - kSqrt5_8 * L2RpxiR;
-     fAmpl.fMinus3 =  kSqrt18_20 * LTm;
-     fAmpl.fPlus3  =  kSqrt18_20 * LTp;
-     fAmpl.f0Minus =  -a+b;
-     fAmpl.f0Plus  =  -a-b;
+     gAmpl.fMinus1 =  k3_Sqrt20 * LTm - kSqrt5_8 * L2RmxiR;
+     gAmpl.fPlus1  =  k3_Sqrt20 * LTp - kSqrt5_8 * L2RpxiR;
+     gAmpl.fMinus3 =  kSqrt18_20 * LTm;
+     gAmpl.fPlus3  =  kSqrt18_20 * LTp;
+     gAmpl.f0Minus =  -a+b;
+     gAmpl.f0Plus  =  -a-b;
      break;
    }
    case (kP31_1910) :
@@ -253,12 +259,12 @@ const RSHelicityAmpl &
      double xr       = 2*xi*fkr.R;
      double L2       = TMath::Power(fkr.Lamda, 2);
 
-     fAmpl.fMinus1 = -k1_Sqrt15 * L2 * (fkr.Rminus + xr);
-     fAmpl.fPlus1  = -k1_Sqrt15 * L2 * (fkr.Rplus  + xr);
-     fAmpl.fMinus3 =  0.;
-     fAmpl.fPlus3  =  0.;
-     fAmpl.f0Minus = -kSqrt4_15 * (L2 * fkr.C - 5 * fkr.Lamda * fkr.B);
-     fAmpl.f0Plus  = -1.* fAmpl.f0Minus;
+     gAmpl.fMinus1 = -k1_Sqrt15 * L2 * (fkr.Rminus + xr);
+     gAmpl.fPlus1  = -k1_Sqrt15 * L2 * (fkr.Rplus  + xr);
+     gAmpl.fMinus3 =  0.;
+     gAmpl.fPlus3  =  0.;
+     gAmpl.f0Minus = -kSqrt4_15 * (L2 * fkr.C - 5 * fkr.Lamda * fkr.B);
+     gAmpl.f0Plus  = -1.* gAmpl.f0Minus;
      break;
    }
    case (kP33_1920) :
@@ -268,12 +274,12 @@ const RSHelicityAmpl &
      double L2Rm2xiR = L2 * (fkr.Rminus + xr);
      double L2Rp2xiR = L2 * (fkr.Rplus  + xr);
 
-     fAmpl.fMinus1 =  k1_Sqrt15 * L2Rm2xiR;
-     fAmpl.fPlus1  = -k1_Sqrt15 * L2Rp2xiR;
-     fAmpl.fMinus3 = -k1_Sqrt5  * L2Rm2xiR;
-     fAmpl.fPlus3  =  k1_Sqrt5  * L2Rp2xiR;
-     fAmpl.f0Minus = -(2./kSqrt15) * (L2 * fkr.C - 5 * fkr.Lamda * fkr.B);
-     fAmpl.f0Plus  =  fAmpl.f0Minus;
+     gAmpl.fMinus1 =  k1_Sqrt15 * L2Rm2xiR;
+     gAmpl.fPlus1  = -k1_Sqrt15 * L2Rp2xiR;
+     gAmpl.fMinus3 = -k1_Sqrt5  * L2Rm2xiR;
+     gAmpl.fPlus3  =  k1_Sqrt5  * L2Rp2xiR;
+     gAmpl.f0Minus = -(2./kSqrt15) * (L2 * fkr.C - 5 * fkr.Lamda * fkr.B);
+     gAmpl.f0Plus  =  gAmpl.f0Minus;
      break;
    }
    case (kF35_1905) :
@@ -283,12 +289,12 @@ const RSHelicityAmpl &
      double L2Rm2xiR = L2 * (fkr.Rminus + xr);
      double L2Rp2xiR = L2 * (fkr.Rplus  + xr);
 
-     fAmpl.fMinus1 =  k1_Sqrt35  * L2Rm2xiR;
-     fAmpl.fPlus1  =  k1_Sqrt35  * L2Rp2xiR;
-     fAmpl.fMinus3 =  kSqrt18_35 * L2Rm2xiR;
-     fAmpl.fPlus3  =  kSqrt18_35 * L2Rp2xiR;
-     fAmpl.f0Minus =  k2_Sqrt35  * L2 * fkr.C;
-     fAmpl.f0Plus  =  -1. * fAmpl.f0Minus;
+     gAmpl.fMinus1 =  k1_Sqrt35  * L2Rm2xiR;
+     gAmpl.fPlus1  =  k1_Sqrt35  * L2Rp2xiR;
+     gAmpl.fMinus3 =  kSqrt18_35 * L2Rm2xiR;
+     gAmpl.fPlus3  =  kSqrt18_35 * L2Rp2xiR;
+     gAmpl.f0Minus =  k2_Sqrt35  * L2 * fkr.C;
+     gAmpl.f0Plus  =  -1. * gAmpl.f0Minus;
      break;
    }
    case (kF37_1950) :
@@ -298,12 +304,12 @@ const RSHelicityAmpl &
      double L2Rm2xiR = L2 * (fkr.Rminus + xr);
      double L2Rp2xiR = L2 * (fkr.Rplus  + xr);
 
-     fAmpl.fMinus1 =  -kSqrt6_35 * L2Rm2xiR;
-     fAmpl.fPlus1  =   kSqrt6_35 * L2Rp2xiR;
-     fAmpl.fMinus3 =  -kSqrt2_7  * L2Rm2xiR;
-     fAmpl.fPlus3  =   kSqrt2_7  * L2Rp2xiR;
-     fAmpl.f0Minus = 2*kSqrt6_35 * L2 * fkr.C;
-     fAmpl.f0Plus  =  fAmpl.f0Minus;
+     gAmpl.fMinus1 =  -kSqrt6_35 * L2Rm2xiR;
+     gAmpl.fPlus1  =   kSqrt6_35 * L2Rp2xiR;
+     gAmpl.fMinus3 =  -kSqrt2_7  * L2Rm2xiR;
+     gAmpl.fPlus3  =   kSqrt2_7  * L2Rp2xiR;
+     gAmpl.f0Minus = 2*kSqrt6_35 * L2 * fkr.C;
+     gAmpl.f0Plus  =  gAmpl.f0Minus;
      break;
    }
    case (kP11_1710) :
@@ -315,39 +321,39 @@ const RSHelicityAmpl &
      double a       = kSqrt3_8 * (1-2*xi) * L2 * fkr.S;
      double b       = k1_Sqrt6 * (L2 * fkr.C - 2 * fkr.Lamda * fkr.B);
 
-     fAmpl.fMinus1 = -k1_Sqrt6 * L2RmxiR;
-     fAmpl.fPlus1  = -k1_Sqrt6 * L2RpxiR;
-     fAmpl.fMinus3 = 0.;
-     fAmpl.fPlus3  = 0.;
-     fAmpl.f0Minus = -a+b;
-     fAmpl.f0Plus  = -a-b;
+     gAmpl.fMinus1 = -k1_Sqrt6 * L2RmxiR;
+     gAmpl.fPlus1  = -k1_Sqrt6 * L2RpxiR;
+     gAmpl.fMinus3 = 0.;
+     gAmpl.fPlus3  = 0.;
+     gAmpl.f0Minus = -a+b;
+     gAmpl.f0Plus  = -a-b;
      break;
    }
    case (kF17_1970) :
    {
-     fAmpl.fMinus1 = 0.;
-     fAmpl.fPlus1  = 0.;
-     fAmpl.fMinus3 = 0.;
-     fAmpl.fPlus3  = 0.;
-     fAmpl.f0Minus = 0.;
-     fAmpl.f0Plus  = 0.;
+     gAmpl.fMinus1 = 0.;
+     gAmpl.fPlus1  = 0.;
+     gAmpl.fMinus3 = 0.;
+     gAmpl.fPlus3  = 0.;
+     gAmpl.f0Minus = 0.;
+     gAmpl.f0Plus  = 0.;
      break;
    }
    default:
    {
      LOG("RSHAmpl", pWARN) << "*** UNRECOGNIZED RESONANCE!";
-     fAmpl.fMinus1 = 0.;
-     fAmpl.fPlus1  = 0.;
-     fAmpl.fMinus3 = 0.;
-     fAmpl.fPlus3  = 0.;
-     fAmpl.f0Minus = 0.;
-     fAmpl.f0Plus  = 0.;
+     gAmpl.fMinus1 = 0.;
+     gAmpl.fPlus1  = 0.;
+     gAmpl.fMinus3 = 0.;
+     gAmpl.fPlus3  = 0.;
+     gAmpl.f0Minus = 0.;
+     gAmpl.f0Plus  = 0.;
      break;
    }
 
   }//switch
 
-  return fAmpl;
+  return gAmpl;
 }
 //____________________________________________________________________________
 void RSHelicityAmplModelNCn::Configure(const Registry & config)
@@ -43,7 +43,6 @@ public:
 private:
   void LoadConfig(void);
 
-  mutable RSHelicityAmpl fAmpl;
   double fSin28w;
 };
 
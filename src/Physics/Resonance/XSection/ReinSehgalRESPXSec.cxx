@@ -161,24 +161,25 @@ double ReinSehgalRESPXSec::XSec(
   double nomg   = IR * fOmega;
   double mq_w   = Mnuc*Q/W;
 
-  fFKR.Lamda  = sq2omg * mq_w;
-  fFKR.Tv     = GV / (3.*W*sq2omg);
-  fFKR.Rv     = kSqrt2 * mq_w*(W+Mnuc)*GV / d;
-  fFKR.S      = (-q2/Q2) * (3*W*Mnuc + q2 - Mnuc2) * GV / (6*Mnuc2);
-  fFKR.Ta     = (2./3.) * (fZeta/sq2omg) * mq_w * GA / d;
-  fFKR.Ra     = (kSqrt2/6.) * fZeta * (GA/W) * (W+Mnuc + 2*nomg*W/d );
-  fFKR.B      = fZeta/(3.*W*sq2omg) * (1 + (W2-Mnuc2+q2)/ d) * GA;
-  fFKR.C      = fZeta/(6.*Q) * (W2 - Mnuc2 + nomg*(W2-Mnuc2+q2)/d) * (GA/Mnuc);
-  fFKR.R      = fFKR.Rv;
-  fFKR.Rplus  = - (fFKR.Rv + fFKR.Ra);
-  fFKR.Rminus = - (fFKR.Rv - fFKR.Ra);
-  fFKR.T      = fFKR.Tv;
-  fFKR.Tplus  = - (fFKR.Tv + fFKR.Ta);
-  fFKR.Tminus = - (fFKR.Tv - fFKR.Ta);
+  FKR fkr;
+  fkr.Lamda  = sq2omg * mq_w;
+  fkr.Tv     = GV / (3.*W*sq2omg);
+  fkr.Rv     = kSqrt2 * mq_w*(W+Mnuc)*GV / d;
+  fkr.S      = (-q2/Q2) * (3*W*Mnuc + q2 - Mnuc2) * GV / (6*Mnuc2);
+  fkr.Ta     = (2./3.) * (fZeta/sq2omg) * mq_w * GA / d;
+  fkr.Ra     = (kSqrt2/6.) * fZeta * (GA/W) * (W+Mnuc + 2*nomg*W/d );
+  fkr.B      = fZeta/(3.*W*sq2omg) * (1 + (W2-Mnuc2+q2)/ d) * GA;
+  fkr.C      = fZeta/(6.*Q) * (W2 - Mnuc2 + nomg*(W2-Mnuc2+q2)/d) * (GA/Mnuc);
+  fkr.R      = fkr.Rv;
+  fkr.Rplus  = - (fkr.Rv + fkr.Ra);
+  fkr.Rminus = - (fkr.Rv - fkr.Ra);
+  fkr.T      = fkr.Tv;
+  fkr.Tplus  = - (fkr.Tv + fkr.Ta);
+  fkr.Tminus = - (fkr.Tv - fkr.Ta);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("FKR", pDEBUG)
-     << "FKR params for RES = " << resname << " : " << fFKR;
+     << "FKR params for RES = " << resname << " : " << fkr;
 #endif
 
   // Calculate the Rein-Sehgal Helicity Amplitudes
@@ -199,7 +200,7 @@ double ReinSehgalRESPXSec::XSec(
   }
   assert(hamplmod);
 
-  const RSHelicityAmpl & hampl = hamplmod->Compute(resonance, fFKR);
+  const RSHelicityAmpl & hampl = hamplmod->Compute(resonance, fkr);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("RSHAmpl", pDEBUG)
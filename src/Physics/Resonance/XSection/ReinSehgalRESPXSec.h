@@ -61,8 +61,6 @@ private:
 
   void LoadConfig (void);
 
-  mutable FKR fFKR;
-
   const RSHelicityAmplModelI * fHAmplModelCC;
   const RSHelicityAmplModelI * fHAmplModelNCp;
   const RSHelicityAmplModelI * fHAmplModelNCn;
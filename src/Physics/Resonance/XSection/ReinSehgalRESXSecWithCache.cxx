@@ -9,6 +9,10 @@
 //____________________________________________________________________________
 
 #include <sstream>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <thread>
 
 #include <TMath.h>
 #include <Math/IFunction.h>
@@ -25,19 +29,27 @@
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/Numerical/MathUtils.h"
 #include "Framework/Utils/KineUtils.h"
+#include "Framework/Interaction/ScratchInteraction.h"
 #include "Framework/Utils/Cache.h"
 #include "Framework/Utils/CacheBranchFx.h"
+#include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Numerical/GSLUtils.h"
 #include "Physics/XSectionIntegration/GSLXSecFunc.h"
 #include "Physics/Resonance/XSection/ReinSehgalRESXSecWithCache.h"
 
 using std::ostringstream;
+using std::vector;
 
 using namespace genie;
 using namespace genie::controls;
 using namespace genie::constants;
 //using namespace genie::units;
 
+//____________________________________________________________________________
+namespace {
+  std::mutex gCacheFillMutex; // serialises the cache fills
+}
+
 //____________________________________________________________________________
 ReinSehgalRESXSecWithCache::ReinSehgalRESXSecWithCache() :
 XSecIntegratorI()
@@ -65,7 +77,15 @@ ReinSehgalRESXSecWithCache::~ReinSehgalRESXSecWithCache()
 void ReinSehgalRESXSecWithCache::CacheResExcitationXSec(
                                                  const Interaction * in) const
 {
-// Cache resonance neutrino production data from free nucleons
+// Cache resonance neutrino production data from free nucleons.
+// The (resonance, energy) integrations are spread over the number of threads
+// set for building cross section splines (XSecSplineList::NThreads()), each
+// thread integrating with its own copy of the interaction. The cache branches
+// are filled before they are added to the cache, so that no thread ever sees
+// a half-built branch, and their content does not depend on the number of
+// threads.
+
+  std::lock_guard<std::mutex> lock(gCacheFillMutex);
 
   Cache * cache = Cache::Instance();
 
@@ -77,116 +97,165 @@ void ReinSehgalRESXSecWithCache::CacheResExcitationXSec(
   const double Emin       = 0.01;
   const int    nknots_min = (int) (10*(TMath::Log(fEMax)-TMath::Log(Emin)));
   const int    nknots     = TMath::Max(40, nknots_min);
-  double * E = new double[nknots]; // knot 'x'
-
-  TLorentzVector p4(0,0,0,0);
 
   int nu_code  = in->InitState().ProbePdg();
   int nuc_code = in->InitState().Tgt().HitNucPdg();
   int tgt_code = (nuc_code==kPdgProton) ? kPdgTgtFreeP : kPdgTgtFreeN;
 
-  Interaction * interaction = new Interaction(*in);
-  interaction->InitStatePtr()->SetPdgs(tgt_code, nu_code);
-  interaction->InitStatePtr()->TgtPtr()->SetHitNucPdg(nuc_code);
+  InteractionType_t wkcur = in->ProcInfo().InteractionTypeId();
+
+  // Resonances not cached yet (possibly cached by another thread while
+  // this one was waiting) and their spline knots
+  vector<ResExcitationTask> tasks;
 
-  InteractionType_t wkcur = interaction->ProcInfo().InteractionTypeId();
   unsigned int nres = fResList.NResonances();
   for(unsigned int ires = 0; ires < nres; ires++) {
 
          // Get next resonance from the resonance list
          Resonance_t res = fResList.ResonanceId(ires);
 
-         interaction->ExclTagPtr()->SetResonance(res);
-
          // Get a unique cache branch name
          string key = this->CacheBranchName(res, wkcur, nu_code, nuc_code);
+         if(cache->FindCacheBranch(key)) continue;
 
-         // Make sure the cache branch does not already exists
-         CacheBranchFx * cache_branch =
-             dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
-         assert(!cache_branch);
-
-         // Create the new cache branch
-         LOG("ReinSehgalResC", pNOTICE)
-                        << "\n ** Creating cache branch - key = " << key;
-         cache_branch = new CacheBranchFx("RES Excitation XSec");
-         cache->AddCacheBranch(key, cache_branch);
-         assert(cache_branch);
+         tasks.push_back(ResExcitationTask());
+         ResExcitationTask & task = tasks.back();
+         task.fKey         = key;
+         task.fInteraction = new Interaction(*in);
+         task.fInteraction->InitStatePtr()->SetPdgs(tgt_code, nu_code);
+         task.fInteraction->InitStatePtr()->TgtPtr()->SetHitNucPdg(nuc_code);
+         task.fInteraction->ExclTagPtr()->SetResonance(res);
 
-         const KPhaseSpace & kps = interaction->PhaseSpace();
+         const KPhaseSpace & kps = task.fInteraction->PhaseSpace();
          double Ethr = kps.Threshold();
-         LOG("ReinSehgalResC", pNOTICE) << "E threshold = " << Ethr;
+         task.fEthr = Ethr;
+         LOG("ReinSehgalResC", pNOTICE)
+            << "E threshold (R:" << utils::res::AsString(res) << ") = " << Ethr;
 
          // Distribute the knots in the energy range as is being done in the
          // XSecSplineList so that the energy threshold is treated correctly
          // in the spline - see comments there in.
+         task.fE.resize(nknots);
          int nkb = (Ethr>Emin) ? 5 : 0; // number of knots <  threshold
          int nka = nknots-nkb;          // number of knots >= threshold
          // knots < energy threshold
          double dEb =  (Ethr>Emin) ? (Ethr - Emin) / nkb : 0;
          for(int i=0; i<nkb; i++) {
-            E[i] = Emin + i*dEb;
+            task.fE[i] = Emin + i*dEb;
          }
          // knots >= energy threshold
          double E0  = TMath::Max(Ethr,Emin);
          double dEa = (TMath::Log10(fEMax) - TMath::Log10(E0)) /(nka-1);
          for(int i=0; i<nka; i++) {
-            E[i+nkb] = TMath::Power(10., TMath::Log10(E0) + i * dEa);
+            task.fE[i+nkb] = TMath::Power(10., TMath::Log10(E0) + i * dEa);
          }
+         task.fXSec.assign(nknots, 0.);
+  }//ires
+
+  if(tasks.size() == 0) return;
+
+  // Compute cross sections at the given set of energies
+  unsigned int nwork    = tasks.size() * nknots;
+  unsigned int nthreads =
+      TMath::Min(XSecSplineList::Instance()->NThreads(), nwork);
+
+  LOG("ReinSehgalResC", pNOTICE)
+     << "Computing RES excitation cross sections for " << tasks.size()
+     << " resonances at " << nknots << " energies using " << nthreads
+     << " thread(s)";
+
+  std::atomic<unsigned int> next(0);
+  std::function<void (void)> worker = [this, &tasks, &next, nwork, nknots] ()
+  {
+     unsigned int iwork = 0;
+     while( (iwork = next++) < nwork ) {
+        ResExcitationTask & task = tasks[iwork / nknots];
+        unsigned int ie = iwork % nknots;
+        ScratchInteraction interaction(task.fInteraction);
+        task.fXSec[ie] = this->ResExcitationXSec(interaction.Get(), task.fE[ie], task.fEthr);
+     }
+  };
+  if(nthreads <= 1) {
+    worker();
+  } else {
+    vector<std::thread> threads;
+    for(unsigned int ithread = 0; ithread < nthreads; ithread++) {
+      threads.push_back( std::thread(worker) );
+    }
+    for(unsigned int ithread = 0; ithread < threads.size(); ithread++) {
+      threads[ithread].join();
+    }
+  }
+
+  // Build the splines and store them in the cache
+  for(unsigned int itask = 0; itask < tasks.size(); itask++) {
+         ResExcitationTask & task = tasks[itask];
 
-         // Compute cross sections at the given set of energies
+         LOG("ReinSehgalResC", pNOTICE)
+                        << "\n ** Creating cache branch - key = " << task.fKey;
+         CacheBranchFx * cache_branch = new CacheBranchFx("RES Excitation XSec");
          for(int ie=0; ie<nknots; ie++) {
-             double xsec = 0.;
-             double Ev   = E[ie];
-             p4.SetPxPyPzE(0,0,Ev,Ev);
-             interaction->InitStatePtr()->SetProbeP4(p4);
-
-             if(Ev>Ethr+kASmallNum) {
-               // Get W integration range and the wider possible Q2 range
-               // (for all W)
-               Range1D_t rW  = kps.Limits(kKVW);
-               Range1D_t rQ2 = kps.Limits(kKVQ2);
-
-               LOG("ReinSehgalResC", pINFO)
-	         << "*** Integrating d^2 XSec/dWdQ^2 for R: "
-     	                 << utils::res::AsString(res) << " at Ev = " << Ev;
-               LOG("ReinSehgalResC", pINFO)
-                                << "{W}   = " << rW.min  << ", " << rW.max;
-      	       LOG("ReinSehgalResC", pINFO)
-                               << "{Q^2} = " << rQ2.min << ", " << rQ2.max;
-
-               if(rW.max<rW.min || rQ2.max<rQ2.min || rW.min<0 || rQ2.min<0) {
-     	          LOG("ReinSehgalResC", pINFO)
-                              << "** Not allowed kinematically, xsec=0";
-               } else {
-
-                  ROOT::Math::IBaseFunctionMultiDim * func =
-                      new utils::gsl::d2XSec_dWdQ2_E(fSingleResXSecModel, interaction);
-                  ROOT::Math::IntegrationMultiDim::Type ig_type =
-                      utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
-                  ROOT::Math::IntegratorMultiDim ig(ig_type,0,fGSLRelTol,fGSLMaxEval);
-                  ig.SetFunction(*func);
-                  double kine_min[2] = { rW.min, rQ2.min };
-                  double kine_max[2] = { rW.max, rQ2.max };
-                  xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
-                  delete func;
-               }
-             } else {
-                 LOG("ReinSehgalResC", pINFO)
- 		       << "** Below threshold E = " << Ev << " <= " << Ethr;
-             }
-             cache_branch->AddValues(Ev,xsec);
-             SLOG("ReinSehgalResC", pNOTICE)
-               << "RES XSec (R:" << utils::res::AsString(res)
-    	       << ", E="<< Ev << ") = "<< xsec/(1E-38 *genie::units::cm2) << " x 1E-38 cm^2";
-         }//spline knots
-
-         // Build the spline
+             cache_branch->AddValues(task.fE[ie], task.fXSec[ie]);
+         }
          cache_branch->CreateSpline();
-  }//ires
+         cache->AddCacheBranch(task.fKey, cache_branch);
 
-  delete [] E;
-  delete interaction;
+         delete task.fInteraction;
+  }
+}
+//____________________________________________________________________________
+double ReinSehgalRESXSecWithCache::ResExcitationXSec(
+                       Interaction * interaction, double Ev, double Ethr) const
+{
+// Free nucleon resonance excitation cross section at the input energy
+
+  Resonance_t res = interaction->ExclTag().Resonance();
+
+  double xsec = 0.;
+  TLorentzVector p4(0,0,Ev,Ev);
+  interaction->InitStatePtr()->SetProbeP4(p4);
+
+  if(Ev>Ethr+kASmallNum) {
+    const KPhaseSpace & kps = interaction->PhaseSpace();
+
+    // Get W integration range and the wider possible Q2 range
+    // (for all W)
+    Range1D_t rW  = kps.Limits(kKVW);
+    Range1D_t rQ2 = kps.Limits(kKVQ2);
+
+    LOG("ReinSehgalResC", pINFO)
+      << "*** Integrating d^2 XSec/dWdQ^2 for R: "
+      << utils::res::AsString(res) << " at Ev = " << Ev;
+    LOG("ReinSehgalResC", pINFO)
+                     << "{W}   = " << rW.min  << ", " << rW.max;
+    LOG("ReinSehgalResC", pINFO)
+                    << "{Q^2} = " << rQ2.min << ", " << rQ2.max;
+
+    if(rW.max<rW.min || rQ2.max<rQ2.min || rW.min<0 || rQ2.min<0) {
+       LOG("ReinSehgalResC", pINFO)
+                   << "** Not allowed kinematically, xsec=0";
+    } else {
+
+       ROOT::Math::IBaseFunctionMultiDim * func =
+           new utils::gsl::d2XSec_dWdQ2_E(fSingleResXSecModel, interaction);
+       ROOT::Math::IntegrationMultiDim::Type ig_type =
+           utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
+       ROOT::Math::IntegratorMultiDim ig(ig_type,0,fGSLRelTol,fGSLMaxEval);
+       ig.SetFunction(*func);
+       double kine_min[2] = { rW.min, rQ2.min };
+       double kine_max[2] = { rW.max, rQ2.max };
+       xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
+       delete func;
+    }
+  } else {
+      LOG("ReinSehgalResC", pINFO)
+            << "** Below threshold E = " << Ev << " <= " << Ethr;
+  }
+  SLOG("ReinSehgalResC", pNOTICE)
+    << "RES XSec (R:" << utils::res::AsString(res)
+    << ", E="<< Ev << ") = "<< xsec/(1E-38 *genie::units::cm2) << " x 1E-38 cm^2";
+
+  return xsec;
 }
 //____________________________________________________________________________
 string ReinSehgalRESXSecWithCache::CacheBranchName(
@@ -8,6 +8,8 @@
           the cross section calculation for multiple nuclear targets (eg at the
           spline construction phase). This class integrates cross sections faster,
           than ReinSehgalRESXSecWithCache because of integration area transformation.
+          The (resonance, energy) integrations filling the cache are spread
+          over the XSecSplineList threads.
 
 \ref      D.Rein and L.M.Sehgal, Neutrino Excitation of Baryon Resonances
           and Single Pion Production, Ann.Phys.133, 79 (1981)
@@ -29,6 +31,8 @@
 #ifndef _REIN_SEHGAL_RES_XSEC_WITH_CACHE_FAST_H_
 #define _REIN_SEHGAL_RES_XSEC_WITH_CACHE_FAST_H_
 
+#include <vector>
+
 #include <Math/IFunction.h>
 #include <Math/IntegratorMultiDim.h>
 
@@ -51,8 +55,18 @@ protected:
   // Don't implement the XSecIntegratorI interface - leave it for the concrete
   // subclasses. Just define utility methods and data
   void   CacheResExcitationXSec (const Interaction * interaction) const;
+  double ResExcitationXSec      (Interaction * interaction, double Ev, double Ethr) const;
   string CacheBranchName(Resonance_t r, InteractionType_t it, int nu, int nuc) const;
 
+  // A resonance to be cached: its free nucleon interaction and spline knots
+  struct ResExcitationTask {
+    string              fKey;
+    Interaction *       fInteraction;
+    double              fEthr;
+    std::vector<double> fE;
+    std::vector<double> fXSec;
+  };
+
   bool   fUsingDisResJoin;
   double fWcut;
   double fEMax;
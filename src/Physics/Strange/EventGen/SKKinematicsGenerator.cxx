@@ -58,6 +58,8 @@ SKKinematicsGenerator::~SKKinematicsGenerator()
 //___________________________________________________________________________
 void SKKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 {
+  StatsScope stats(this, evrec);
+
   if(fGenerateUniformly) {
     LOG("SKKinematics", pNOTICE)
           << "Generating kinematics uniformly over the allowed phase space";
@@ -185,7 +187,7 @@ void SKKinematicsGenerator::CalculateKin_AtharSingleKaon(GHepRecord * evrec) con
 
 
      // computing cross section for the current kinematics
-     xsec = fXSecModel->XSec(interaction, kPSTkTlctl);
+     xsec = this->XSec(interaction, kPSTkTlctl);
 
      //-- decide whether to accept the current kinematics
      if(!fGenerateUniformly) {
@@ -304,7 +306,7 @@ double SKKinematicsGenerator::ComputeMaxXSec(const Interaction * in) const
         in->KinePtr()->SetKV(kKVctl, ctl);
         in->KinePtr()->SetKV(kKVphikq, phikq);
 
-        double xsec = fXSecModel->XSec(in, kPSTkTlctl);
+        double xsec = this->XSec(in, kPSTkTlctl);
 
         // xsec returned by model is d4sigma/(dtk dtl dcosthetal dphikq)
         // convert lepton theta to log(1-costheta) by multiplying by jacobian 1 - costheta
@@ -0,0 +1,155 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <map>
+
+#include "Physics/Strange/XSection/AlamSimoAtharVacasSKAmplitude.h"
+
+using std::map;
+
+using namespace genie;
+
+//____________________________________________________________________________
+namespace {
+
+  // packing of the exponents in the generated tables
+  const int          kKineBits = 2;
+  const int          kParBits  = 3;
+  const unsigned int kKineMask = (1 << kKineBits) - 1;
+  const unsigned int kParMask  = (1 << kParBits)  - 1;
+}
+
+//____________________________________________________________________________
+AlamSimoAtharVacasSKAmplitude::AlamSimoAtharVacasSKAmplitude()
+{
+
+}
+//____________________________________________________________________________
+AlamSimoAtharVacasSKAmplitude::~AlamSimoAtharVacasSKAmplitude()
+{
+
+}
+//____________________________________________________________________________
+void AlamSimoAtharVacasSKAmplitude::SetParameters(
+                    int reaction, const double * parameters, double factor)
+{
+  const SKAmplitudeTable_t & table = SKAmplitudeTable(reaction);
+
+  // evaluate the coefficient of each kinematic monomial
+  double power[kNParameters][kParMask+1];
+  for(int i = 0; i < kNParameters; i++) {
+    power[i][0] = 1.;
+    for(unsigned int e = 1; e <= kParMask; e++) {
+      power[i][e] = power[i][e-1] * parameters[i];
+    }
+  }
+  std::vector<double> coefficient(table.nmonomials, 0.);
+  for(unsigned int it = 0; it < table.nterms; it++) {
+    const SKAmplitudeTerm_t & term = table.terms[it];
+    double value = term.value;
+    for(int i = 0; i < kNParameters; i++) {
+      value *= power[i][(term.exponents >> (kParBits*i)) & kParMask];
+    }
+    coefficient[term.monomial] += value;
+  }
+
+  // factorise the kinematic monomials
+  const int eshift = 2 * kNPairsE * kKineBits;
+  const unsigned int emask = (1u << eshift) - 1;
+
+  map<unsigned int, unsigned int> energy_index;
+  map<unsigned int, map<unsigned int, double> > terms; // propagator -> energy -> coefficient
+  for(unsigned int im = 0; im < table.nmonomials; im++) {
+    unsigned int emon = table.monomials[im] & emask;
+    unsigned int pmon = table.monomials[im] >> eshift;
+    if(energy_index.find(emon) == energy_index.end()) {
+      unsigned int n = energy_index.size();
+      energy_index[emon] = n;
+    }
+    terms[pmon][energy_index[emon]] += factor * coefficient[im];
+  }
+
+  // monomials as indices in the power tables of the variable pairs
+  fEnergyMonomials.assign(kNPairsE * energy_index.size(), 0);
+  map<unsigned int, unsigned int>::const_iterator eiter = energy_index.begin();
+  for( ; eiter != energy_index.end(); ++eiter) {
+    for(int ip = 0; ip < kNPairsE; ip++) {
+      unsigned int e1 = (eiter->first >> (kKineBits*(2*ip)))   & kKineMask;
+      unsigned int e2 = (eiter->first >> (kKineBits*(2*ip+1))) & kKineMask;
+      fEnergyMonomials[kNPairsE*eiter->second + ip] = e1 * (kMaxPower+1) + e2;
+    }
+  }
+
+  const int npp = kNPairs - kNPairsE;
+  fPropagatorMonomials.clear();
+  fPropagatorEnd  .clear();
+  fTermMonomial   .clear();
+  fTermCoefficient.clear();
+  map<unsigned int, map<unsigned int, double> >::const_iterator piter = terms.begin();
+  for( ; piter != terms.end(); ++piter) {
+    for(int ip = 0; ip < npp; ip++) {
+      unsigned int e1 = (piter->first >> (kKineBits*(2*ip)))   & kKineMask;
+      unsigned int e2 = (piter->first >> (kKineBits*(2*ip+1))) & kKineMask;
+      fPropagatorMonomials.push_back(e1 * (kMaxPower+1) + e2);
+    }
+    map<unsigned int, double>::const_iterator titer = piter->second.begin();
+    for( ; titer != piter->second.end(); ++titer) {
+      fTermMonomial   .push_back(titer->first);
+      fTermCoefficient.push_back(titer->second);
+    }
+    fPropagatorEnd.push_back(fTermMonomial.size());
+  }
+}
+//____________________________________________________________________________
+double AlamSimoAtharVacasSKAmplitude::Evaluate(const double * x) const
+{
+  const int npw = (kMaxPower+1) * (kMaxPower+1);
+  const int npp = kNPairs - kNPairsE;
+
+  // products of the powers of the variable pairs
+  double power[kMaxPower+1];
+  double pair [kNPairs][npw];
+  for(int ip = 0; ip < kNPairs; ip++) {
+    double x2 = (2*ip+1 < kNKineVars) ? x[2*ip+1] : 1.;
+    power[0] = 1.;
+    for(int e = 1; e <= kMaxPower; e++) power[e] = power[e-1] * x2;
+    double x1e = 1.;
+    for(int e1 = 0; e1 <= kMaxPower; e1++) {
+      for(int e2 = 0; e2 <= kMaxPower; e2++) {
+        pair[ip][e1*(kMaxPower+1) + e2] = x1e * power[e2];
+      }
+      x1e *= x[2*ip];
+    }
+  }
+
+  // monomials of the energies and invariants
+  const unsigned int nemon = fEnergyMonomials.size() / kNPairsE;
+  std::vector<double> emon(nemon);
+  for(unsigned int i = 0; i < nemon; i++) {
+    const unsigned char * idx = &fEnergyMonomials[kNPairsE*i];
+    emon[i] = pair[0][idx[0]] * pair[1][idx[1]] * pair[2][idx[2]];
+  }
+
+  // sum over the monomials of the propagators
+  double sum = 0.;
+  unsigned int it = 0;
+  for(unsigned int ip = 0; ip < fPropagatorEnd.size(); ip++) {
+    double psum = 0.;
+    for( ; it < fPropagatorEnd[ip]; it++) {
+      psum += fTermCoefficient[it] * emon[fTermMonomial[it]];
+    }
+    const unsigned char * idx = &fPropagatorMonomials[npp*ip];
+    double pmon = 1.;
+    for(int k = 0; k < npp; k++) pmon *= pair[kNPairsE+k][idx[k]];
+    sum += pmon * psum;
+  }
+  return sum;
+}
+//____________________________________________________________________________
@@ -0,0 +1,100 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::AlamSimoAtharVacasSKAmplitude
+
+\brief    Squared matrix element of the Alam, Simo, Athar and Vacas single
+          kaon production model for one reaction and lepton flavour.
+
+          The matrix element is a polynomial of the kinematic variables
+          (see Evaluate()), up to the overall coupling and form factor.
+          Its coefficients are polynomials of the kinematics-independent
+          parameters (masses and couplings), tabulated in
+          AlamSimoAtharVacasSKAmplitudeTables.cxx. That file is generated by
+          $GENIE/src/scripts/utils/gen_sk_amplitudes.py from the expanded
+          matrix elements of $GENIE/src/contrib/nirkko/singlekaon_xsec.cxx.
+          SetParameters() evaluates the coefficients once, so that Evaluate()
+          only sums the kinematic monomials.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _ALAM_SIMO_ATHAR_VACAS_SINGLE_KAON_AMPLITUDE_H_
+#define _ALAM_SIMO_ATHAR_VACAS_SINGLE_KAON_AMPLITUDE_H_
+
+#include <vector>
+
+namespace genie {
+
+//! A term of a matrix element coefficient: the kinematic monomial it
+//! multiplies, the (packed) exponents of the parameters and a number
+typedef struct SSKAmplitudeTerm {
+  int                monomial;
+  unsigned long long exponents;
+  double             value;
+} SKAmplitudeTerm_t;
+
+//! The (packed) kinematic monomials and the terms of a matrix element
+typedef struct SSKAmplitudeTable {
+  unsigned int              nmonomials;
+  const unsigned int *      monomials;
+  unsigned int              nterms;
+  const SKAmplitudeTerm_t * terms;
+} SKAmplitudeTable_t;
+
+//! Tables of reaction 1 (NN), 2 (NP) or 3 (PP), see
+//! AlamSimoAtharVacasSKPXSec2014
+const SKAmplitudeTable_t & SKAmplitudeTable(int reaction);
+
+class AlamSimoAtharVacasSKAmplitude {
+
+public:
+
+  //! Kinematic variables, in the order they are passed to Evaluate()
+  enum EKineVar {
+    kEnu = 0, kElep, kEkaon, kakk1, kakpk, kapkk1, kC1, kC3, kC6, kC7, kC8,
+    kNKineVars
+  };
+  //! Kinematics-independent parameters, in the order of SetParameters()
+  enum EParameter {
+    kam = 0, kamk, kamSig, kamLam, kaml, kC2, kC4, kC5, kC9, kFm1, kFm2, kf,
+    kNParameters
+  };
+
+  AlamSimoAtharVacasSKAmplitude();
+ ~AlamSimoAtharVacasSKAmplitude();
+
+  //! Evaluates the coefficients of the input reaction for the input
+  //! parameters, all multiplied by the input overall factor
+  void SetParameters (int reaction, const double * parameters, double factor);
+
+  //! Matrix element at the input kinematic variables
+  double Evaluate (const double * x) const;
+
+private:
+
+  static const int kMaxPower = 3;                    ///< max exponent of a kinematic variable
+  static const int kNPairs   = (kNKineVars + 1) / 2; ///< kinematic variables are paired
+  static const int kNPairsE  = 3;                    ///< pairs of energies and invariants (Enu ... apkk1)
+
+  // The monomials are factorised into a monomial of the energies and
+  // invariants and a monomial of the propagators (C1 ... C8). The matrix
+  // element is a sum over the (few) monomials of the propagators, each
+  // multiplying a sparse sum over the monomials of the energies.
+
+  std::vector<unsigned char> fEnergyMonomials;     ///< kNPairsE power table indices per monomial
+  std::vector<unsigned char> fPropagatorMonomials; ///< kNPairs-kNPairsE power table indices per monomial
+  std::vector<unsigned int>  fPropagatorEnd;       ///< end of the terms of each propagator monomial
+  std::vector<unsigned int>  fTermMonomial;        ///< energy monomial of each term
+  std::vector<double>        fTermCoefficient;     ///< coefficient of each term
+};
+
+}       // genie namespace
+#endif  // _ALAM_SIMO_ATHAR_VACAS_SINGLE_KAON_AMPLITUDE_H_
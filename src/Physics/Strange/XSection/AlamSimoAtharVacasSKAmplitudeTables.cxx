@@ -0,0 +1,4251 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+//
+// Tables of the single-kaon production matrix elements.
+// Generated by $GENIE/src/scripts/utils/gen_sk_amplitudes.py from the
+// matrix elements of $GENIE/src/contrib/nirkko/singlekaon_xsec.cxx.
+// DO NOT EDIT.
+//
+// Kinematic monomials: exponents (2 bits each) of Enu, Elep, Ekaon, akk1, akpk, apkk1, C1, C3, C6, C7, C8.
+// Terms: monomial, exponents (3 bits each) of am, amk, amSig, amLam, aml, C2, C4, C5, C9, Fm1, Fm2, f, coefficient.
+//____________________________________________________________________________
+
+#include "Physics/Strange/XSection/AlamSimoAtharVacasSKAmplitude.h"
+
+namespace {
+
+  // nu + n -> l- + n + K+: 403 kinematic monomials, 1164 terms
+  const unsigned int kMonomialsNN[403] = {
+    0x100100, 0x040100, 0x001100, 0x101100, 0x041100, 0x005100, 0x002100, 0x006100,
+    0x100500, 0x040500, 0x001500, 0x101500, 0x041500, 0x005500, 0x002500, 0x006500,
+    0x101200, 0x041200, 0x005200, 0x002200, 0x006200, 0x000040, 0x100040, 0x040040,
+    0x001040, 0x101040, 0x041040, 0x005040, 0x009040, 0x002040, 0x006040, 0x00a040,
+    0x001440, 0x101440, 0x041440, 0x009440, 0x002440, 0x00a440, 0x009840, 0x002840,
+    0x00a840, 0x001140, 0x101140, 0x041140, 0x005140, 0x009140, 0x002140, 0x006140,
+    0x00a140, 0x101540, 0x041540, 0x009540, 0x00a540, 0x009240, 0x002240, 0x00a240,
+    0x001080, 0x101080, 0x041080, 0x009080, 0x002080, 0x00a080, 0x009480, 0x002480,
+    0x00a480, 0x009180, 0x002180, 0x00a180, 0x200110, 0x140110, 0x080110, 0x001110,
+    0x101110, 0x041110, 0x005110, 0x002110, 0x006110, 0x200510, 0x140510, 0x080510,
+    0x101510, 0x041510, 0x002510, 0x006510, 0x002210, 0x006210, 0x200050, 0x140050,
+    0x080050, 0x004050, 0x008050, 0x001050, 0x101050, 0x041050, 0x005050, 0x009050,
+    0x002050, 0x006050, 0x00a050, 0x008450, 0x001450, 0x101450, 0x041450, 0x009450,
+    0x002450, 0x00a450, 0x002850, 0x00a850, 0x008150, 0x001150, 0x101150, 0x041150,
+    0x009150, 0x002150, 0x006150, 0x00a150, 0x00a550, 0x002250, 0x00a250, 0x008090,
+    0x001090, 0x101090, 0x041090, 0x009090, 0x002090, 0x00a090, 0x002490, 0x00a490,
+    0x002190, 0x00a190, 0x002120, 0x008060, 0x101060, 0x041060, 0x005060, 0x009060,
+    0x002060, 0x006060, 0x00a060, 0x101460, 0x041460, 0x002460, 0x101160, 0x041160,
+    0x002160, 0x1010a0, 0x0410a0, 0x0090a0, 0x0020a0, 0x00a0a0, 0x002070, 0x006070,
+    0x00a070, 0x00a0b0, 0x000104, 0x200104, 0x140104, 0x080104, 0x004104, 0x001104,
+    0x101104, 0x041104, 0x005104, 0x002104, 0x006104, 0x200504, 0x140504, 0x080504,
+    0x001504, 0x101504, 0x041504, 0x001204, 0x101204, 0x041204, 0x000044, 0x200044,
+    0x140044, 0x080044, 0x008044, 0x001044, 0x101044, 0x041044, 0x009044, 0x002044,
+    0x00a044, 0x008444, 0x009444, 0x002444, 0x00a444, 0x008144, 0x001144, 0x101144,
+    0x041144, 0x009144, 0x00a144, 0x008084, 0x009084, 0x002084, 0x00a084, 0x001114,
+    0x101114, 0x041114, 0x005114, 0x002114, 0x006114, 0x101514, 0x041514, 0x101214,
+    0x041214, 0x008054, 0x001054, 0x101054, 0x041054, 0x009054, 0x002054, 0x00a054,
+    0x009454, 0x002454, 0x00a454, 0x101154, 0x041154, 0x009154, 0x00a154, 0x009094,
+    0x002094, 0x00a094, 0x002124, 0x006124, 0x009064, 0x002064, 0x00a064, 0x002464,
+    0x00a464, 0x00a164, 0x0020a4, 0x00a0a4, 0x001108, 0x008048, 0x009048, 0x002048,
+    0x00a048, 0x009058, 0x002058, 0x00a058, 0x002068, 0x00a068, 0x000001, 0x004001,
+    0x001001, 0x101001, 0x041001, 0x005001, 0x002001, 0x006001, 0x000401, 0x001401,
+    0x101401, 0x041401, 0x005401, 0x002401, 0x006401, 0x001801, 0x101801, 0x041801,
+    0x200101, 0x140101, 0x080101, 0x004101, 0x101101, 0x041101, 0x005101, 0x002101,
+    0x006101, 0x200501, 0x140501, 0x080501, 0x001501, 0x101501, 0x041501, 0x000041,
+    0x200041, 0x140041, 0x080041, 0x004041, 0x008041, 0x001041, 0x101041, 0x041041,
+    0x005041, 0x009041, 0x002041, 0x006041, 0x00a041, 0x008441, 0x001441, 0x101441,
+    0x041441, 0x009441, 0x00a441, 0x008141, 0x009141, 0x002141, 0x00a141, 0x008081,
+    0x009081, 0x002081, 0x00a081, 0x004011, 0x001011, 0x101011, 0x041011, 0x005011,
+    0x002011, 0x006011, 0x001411, 0x101411, 0x041411, 0x005411, 0x002411, 0x006411,
+    0x101811, 0x041811, 0x101111, 0x041111, 0x005111, 0x002111, 0x006111, 0x101511,
+    0x041511, 0x008051, 0x001051, 0x101051, 0x041051, 0x005051, 0x009051, 0x002051,
+    0x006051, 0x00a051, 0x101451, 0x041451, 0x009451, 0x00a451, 0x009151, 0x002151,
+    0x00a151, 0x009091, 0x002091, 0x00a091, 0x005021, 0x002021, 0x006021, 0x002421,
+    0x006421, 0x002121, 0x006121, 0x009061, 0x002061, 0x006061, 0x00a061, 0x00a461,
+    0x002161, 0x00a161, 0x0020a1, 0x00a0a1, 0x000005, 0x004005, 0x001005, 0x005005,
+    0x002005, 0x006005, 0x001405, 0x001105, 0x008045, 0x009045, 0x00a045, 0x001015,
+    0x005015, 0x002015, 0x006015, 0x009055, 0x00a055, 0x002025, 0x006025, 0x00a065,
+    0x004002, 0x005002, 0x002002, 0x006002, 0x001402, 0x008042, 0x009042, 0x002042,
+    0x00a042, 0x005012, 0x002012, 0x006012, 0x009052, 0x002052, 0x00a052, 0x002022,
+    0x006022, 0x002062, 0x00a062,
+  };
+  const genie::SKAmplitudeTerm_t kTermsNN[1164] = {
+    {   0, 0x0001042001ULL, 48.0}, {   1, 0x000004a001ULL, 48.0},
+    {   2, 0x0000042041ULL, -64.0}, {   2, 0x0000082041ULL, 128.0},
+    {   2, 0x00000c2041ULL, -64.0}, {   2, 0x0008042011ULL, 64.0},
+    {   2, 0x0008082011ULL, 32.0}, {   2, 0x0000042002ULL, -64.0},
+    {   2, 0x0000082002ULL, 128.0}, {   2, 0x00000c2002ULL, -64.0},
+    {   2, 0x0008042042ULL, 64.0}, {   2, 0x0008082042ULL, -64.0},
+    {   2, 0x0008042003ULL, 64.0}, {   2, 0x0008082003ULL, -64.0},
+    {   3, 0x0009044041ULL, 16.0}, {   3, 0x0001042011ULL, -48.0},
+    {   3, 0x0009044002ULL, 16.0}, {   4, 0x000804c041ULL, 16.0},
+    {   4, 0x000004a011ULL, -48.0}, {   4, 0x000804c002ULL, 16.0},
+    {   5, 0x0000084041ULL, -48.0}, {   5, 0x0000082051ULL, 16.0},
+    {   5, 0x0000084002ULL, -48.0}, {   5, 0x0000082012ULL, 16.0},
+    {   6, 0x0000082051ULL, -64.0}, {   6, 0x00000c2051ULL, 128.0},
+    {   6, 0x0000102051ULL, -64.0}, {   6, 0x0008082091ULL, -32.0},
+    {   6, 0x00080c2091ULL, -64.0}, {   6, 0x0008082021ULL, -32.0},
+    {   6, 0x00080c2021ULL, -64.0}, {   6, 0x0000082012ULL, -64.0},
+    {   6, 0x00000c2012ULL, 128.0}, {   6, 0x0000102012ULL, -64.0},
+    {   6, 0x00080c2052ULL, -256.0}, {   6, 0x0008082013ULL, 32.0},
+    {   6, 0x00080c2013ULL, -192.0}, {   7, 0x0000104051ULL, 64.0},
+    {   7, 0x0000104012ULL, 64.0}, {   8, 0x0001040001ULL, 64.0},
+    {   9, 0x0000048001ULL, 64.0}, {  10, 0x0000080041ULL, 256.0},
+    {  10, 0x0000080002ULL, 256.0}, {  11, 0x0009042041ULL, 32.0},
+    {  11, 0x0001040011ULL, -64.0}, {  11, 0x0009042002ULL, 32.0},
+    {  12, 0x000804a041ULL, 32.0}, {  12, 0x0000048011ULL, -64.0},
+    {  12, 0x000804a002ULL, 32.0}, {  13, 0x0000082041ULL, -96.0},
+    {  13, 0x0000082002ULL, -96.0}, {  14, 0x0000080051ULL, -128.0},
+    {  14, 0x0000100051ULL, -128.0}, {  14, 0x0000080012ULL, -128.0},
+    {  14, 0x0000100012ULL, -128.0}, {  15, 0x0000102051ULL, 128.0},
+    {  15, 0x0000102012ULL, 128.0}, {  16, 0x0009042041ULL, 32.0},
+    {  16, 0x0009042002ULL, 32.0}, {  17, 0x000804a041ULL, 32.0},
+    {  17, 0x000804a002ULL, 32.0}, {  18, 0x0000082041ULL, 96.0},
+    {  18, 0x0000082002ULL, 96.0}, {  19, 0x0010082051ULL, 128.0},
+    {  19, 0x0010082012ULL, 128.0}, {  20, 0x0000102051ULL, -128.0},
+    {  20, 0x0000102012ULL, -128.0}, {  21, 0x0000000002ULL, -32.0},
+    {  21, 0x0000080002ULL, 32.0}, {  22, 0x0001042001ULL, 16.0},
+    {  22, 0x0001040011ULL, -32.0}, {  23, 0x000004a001ULL, 16.0},
+    {  23, 0x0000048011ULL, -32.0}, {  24, 0x0008082011ULL, 96.0},
+    {  25, 0x0001042011ULL, -16.0}, {  25, 0x0009042051ULL, -32.0},
+    {  25, 0x0001040021ULL, 32.0}, {  25, 0x0009042012ULL, -32.0},
+    {  26, 0x000004a011ULL, -16.0}, {  26, 0x000804a051ULL, -32.0},
+    {  26, 0x0000048021ULL, 32.0}, {  26, 0x000804a012ULL, -32.0},
+    {  27, 0x0000082051ULL, 64.0}, {  27, 0x0000082012ULL, 64.0},
+    {  28, 0x0000084051ULL, -32.0}, {  28, 0x0000084012ULL, -32.0},
+    {  29, 0x0008082091ULL, -96.0}, {  29, 0x0008082021ULL, -96.0},
+    {  29, 0x0010082061ULL, 32.0}, {  29, 0x0008082052ULL, -192.0},
+    {  29, 0x0000080092ULL, 32.0}, {  29, 0x0000100092ULL, -32.0},
+    {  29, 0x0010082092ULL, 64.0}, {  29, 0x0000080022ULL, 32.0},
+    {  29, 0x0000100022ULL, -32.0}, {  29, 0x0010082022ULL, 64.0},
+    {  29, 0x0008082013ULL, -96.0}, {  29, 0x0000080053ULL, 64.0},
+    {  29, 0x0000100053ULL, -64.0}, {  29, 0x0010082053ULL, 128.0},
+    {  29, 0x0000080014ULL, 32.0}, {  29, 0x0000100014ULL, -32.0},
+    {  29, 0x0010082014ULL, 64.0}, {  30, 0x0000102061ULL, -64.0},
+    {  30, 0x0000102092ULL, -64.0}, {  30, 0x0000102022ULL, -64.0},
+    {  30, 0x0000102053ULL, -128.0}, {  30, 0x0000102014ULL, -64.0},
+    {  31, 0x0000104061ULL, 32.0}, {  31, 0x0000104092ULL, 32.0},
+    {  31, 0x0000104022ULL, 32.0}, {  31, 0x0000104053ULL, 64.0},
+    {  31, 0x0000104014ULL, 32.0}, {  32, 0x0000040041ULL, 64.0},
+    {  32, 0x0000080041ULL, 128.0}, {  32, 0x00000c0041ULL, 64.0},
+    {  32, 0x0008040011ULL, -64.0}, {  32, 0x0008080011ULL, 64.0},
+    {  32, 0x0000040002ULL, 64.0}, {  32, 0x0000080002ULL, 128.0},
+    {  32, 0x00000c0002ULL, 64.0}, {  32, 0x0008040042ULL, -64.0},
+    {  32, 0x0008080042ULL, -64.0}, {  32, 0x0008040003ULL, -64.0},
+    {  32, 0x0008080003ULL, -64.0}, {  33, 0x0009042041ULL, -16.0},
+    {  33, 0x0009042002ULL, -16.0}, {  34, 0x000804a041ULL, -16.0},
+    {  34, 0x000804a002ULL, -16.0}, {  35, 0x0000084041ULL, 16.0},
+    {  35, 0x0000082051ULL, -16.0}, {  35, 0x0000084002ULL, 16.0},
+    {  35, 0x0000082012ULL, -16.0}, {  36, 0x0000080051ULL, -64.0},
+    {  36, 0x00000c0051ULL, -128.0}, {  36, 0x0000100051ULL, -64.0},
+    {  36, 0x0010082051ULL, -96.0}, {  36, 0x0008080091ULL, -64.0},
+    {  36, 0x00080c0091ULL, 64.0}, {  36, 0x0008080021ULL, -64.0},
+    {  36, 0x00080c0021ULL, 64.0}, {  36, 0x0000080012ULL, -64.0},
+    {  36, 0x00000c0012ULL, -128.0}, {  36, 0x0000100012ULL, -64.0},
+    {  36, 0x0010082012ULL, -96.0}, {  36, 0x00080c0052ULL, 256.0},
+    {  36, 0x0008080013ULL, 64.0}, {  36, 0x00080c0013ULL, 192.0},
+    {  37, 0x0000104051ULL, -32.0}, {  37, 0x0000104012ULL, -32.0},
+    {  38, 0x0000082041ULL, 32.0}, {  38, 0x0000082002ULL, 32.0},
+    {  39, 0x0010080051ULL, -128.0}, {  39, 0x0010080012ULL, -128.0},
+    {  40, 0x0000102051ULL, -64.0}, {  40, 0x0000102012ULL, -64.0},
+    {  41, 0x0000040041ULL, 64.0}, {  41, 0x0000080041ULL, -128.0},
+    {  41, 0x00000c0041ULL, 64.0}, {  41, 0x0008040011ULL, -64.0},
+    {  41, 0x0008080011ULL, -64.0}, {  41, 0x0000040002ULL, 64.0},
+    {  41, 0x0000080002ULL, -128.0}, {  41, 0x00000c0002ULL, 64.0},
+    {  41, 0x0008040042ULL, -64.0}, {  41, 0x0008080042ULL, 64.0},
+    {  41, 0x0008040003ULL, -64.0}, {  41, 0x0008080003ULL, 64.0},
+    {  42, 0x0009042041ULL, -16.0}, {  42, 0x0009042002ULL, -16.0},
+    {  43, 0x000804a041ULL, -16.0}, {  43, 0x000804a002ULL, -16.0},
+    {  44, 0x0000082041ULL, 96.0}, {  44, 0x0000082002ULL, 96.0},
+    {  45, 0x0000084041ULL, -16.0}, {  45, 0x0000082051ULL, 16.0},
+    {  45, 0x0000084002ULL, -16.0}, {  45, 0x0000082012ULL, 16.0},
+    {  46, 0x0000080051ULL, 64.0}, {  46, 0x00000c0051ULL, -128.0},
+    {  46, 0x0000100051ULL, 64.0}, {  46, 0x0010082051ULL, 96.0},
+    {  46, 0x0008080091ULL, 64.0}, {  46, 0x00080c0091ULL, 64.0},
+    {  46, 0x0008080021ULL, 64.0}, {  46, 0x00080c0021ULL, 64.0},
+    {  46, 0x0000080012ULL, 64.0}, {  46, 0x00000c0012ULL, -128.0},
+    {  46, 0x0000100012ULL, 64.0}, {  46, 0x0010082012ULL, 96.0},
+    {  46, 0x00080c0052ULL, 256.0}, {  46, 0x0008080013ULL, -64.0},
+    {  46, 0x00080c0013ULL, 192.0}, {  47, 0x0000102051ULL, -128.0},
+    {  47, 0x0000102012ULL, -128.0}, {  48, 0x0000104051ULL, 32.0},
+    {  48, 0x0000104012ULL, 32.0}, {  49, 0x0009040041ULL, -128.0},
+    {  49, 0x0009040002ULL, -128.0}, {  50, 0x0008048041ULL, -128.0},
+    {  50, 0x0008048002ULL, -128.0}, {  51, 0x0000082041ULL, -64.0},
+    {  51, 0x0000082002ULL, -64.0}, {  52, 0x0000102051ULL, 128.0},
+    {  52, 0x0000102012ULL, 128.0}, {  53, 0x0000082041ULL, 32.0},
+    {  53, 0x0000082002ULL, 32.0}, {  54, 0x0010080051ULL, -128.0},
+    {  54, 0x0010080012ULL, -128.0}, {  55, 0x0000102051ULL, -64.0},
+    {  55, 0x0000102012ULL, -64.0}, {  56, 0x0008080011ULL, -128.0},
+    {  57, 0x0009040051ULL, 64.0}, {  57, 0x0009040012ULL, 64.0},
+    {  58, 0x0008048051ULL, 64.0}, {  58, 0x0008048012ULL, 64.0},
+    {  59, 0x0000082051ULL, 64.0}, {  59, 0x0000082012ULL, 64.0},
+    {  60, 0x0008080091ULL, 128.0}, {  60, 0x0008080021ULL, 128.0},
+    {  60, 0x0008080052ULL, 256.0}, {  60, 0x0010080092ULL, -64.0},
+    {  60, 0x0010080022ULL, -64.0}, {  60, 0x0008080013ULL, 128.0},
+    {  60, 0x0010080053ULL, -128.0}, {  60, 0x0010080014ULL, -64.0},
+    {  61, 0x0000102061ULL, -64.0}, {  61, 0x0000102092ULL, -64.0},
+    {  61, 0x0000102022ULL, -64.0}, {  61, 0x0000102053ULL, -128.0},
+    {  61, 0x0000102014ULL, -64.0}, {  62, 0x0000082041ULL, -32.0},
+    {  62, 0x0000082002ULL, -32.0}, {  63, 0x0010080051ULL, 128.0},
+    {  63, 0x0010080012ULL, 128.0}, {  64, 0x0000102051ULL, 64.0},
+    {  64, 0x0000102012ULL, 64.0}, {  65, 0x0000082041ULL, 32.0},
+    {  65, 0x0000082002ULL, 32.0}, {  66, 0x0010080051ULL, -128.0},
+    {  66, 0x0010080012ULL, -128.0}, {  67, 0x0000102051ULL, -64.0},
+    {  67, 0x0000102012ULL, -64.0}, {  68, 0x0002002001ULL, -16.0},
+    {  69, 0x000100a001ULL, -32.0}, {  70, 0x0000012001ULL, -16.0},
+    {  71, 0x0008042041ULL, 64.0}, {  71, 0x0008082041ULL, 64.0},
+    {  71, 0x0008042002ULL, -64.0}, {  72, 0x0001042041ULL, -64.0},
+    {  72, 0x0001082041ULL, 32.0}, {  72, 0x0001042002ULL, 32.0},
+    {  72, 0x0001082002ULL, 32.0}, {  73, 0x000004a041ULL, -64.0},
+    {  73, 0x000008a041ULL, 32.0}, {  73, 0x000004a002ULL, 32.0},
+    {  73, 0x000008a002ULL, 32.0}, {  74, 0x0000082042ULL, -32.0},
+    {  74, 0x0000082003ULL, -32.0}, {  75, 0x0000082081ULL, -64.0},
+    {  75, 0x00000c2081ULL, 128.0}, {  75, 0x0000102081ULL, -64.0},
+    {  75, 0x0008082051ULL, -64.0}, {  75, 0x00080c2051ULL, -128.0},
+    {  75, 0x0008082082ULL, 64.0}, {  75, 0x00080c2082ULL, -128.0},
+    {  75, 0x0008082012ULL, 64.0}, {  75, 0x00080c2012ULL, 128.0},
+    {  75, 0x0000082003ULL, 64.0}, {  75, 0x00000c2003ULL, -128.0},
+    {  75, 0x0000102003ULL, 64.0}, {  75, 0x0008082004ULL, -64.0},
+    {  75, 0x00080c2004ULL, 128.0}, {  76, 0x0000104081ULL, 64.0},
+    {  76, 0x0000104003ULL, -64.0}, {  77, 0x0002000001ULL, -32.0},
+    {  78, 0x0001008001ULL, -64.0}, {  79, 0x0000010001ULL, -32.0},
+    {  80, 0x0001040041ULL, -128.0}, {  81, 0x0000048041ULL, -128.0},
+    {  82, 0x0000080081ULL, -128.0}, {  82, 0x0000100081ULL, -128.0},
+    {  82, 0x0000080003ULL, 128.0}, {  82, 0x0000100003ULL, 128.0},
+    {  83, 0x0000102081ULL, 128.0}, {  83, 0x0000102003ULL, -128.0},
+    {  84, 0x0010082081ULL, 128.0}, {  84, 0x0010082003ULL, -128.0},
+    {  85, 0x0000102081ULL, -128.0}, {  85, 0x0000102003ULL, 128.0},
+    {  86, 0x0002002001ULL, -4.0}, {  86, 0x0002000011ULL, 16.0},
+    {  87, 0x000100a001ULL, -8.0}, {  87, 0x0001008011ULL, 32.0},
+    {  88, 0x0000012001ULL, -4.0}, {  88, 0x0000010011ULL, 16.0},
+    {  89, 0x0000002001ULL, -32.0}, {  90, 0x0000004001ULL, 12.0},
+    {  90, 0x0000002011ULL, -4.0}, {  91, 0x0008082041ULL, 96.0},
+    {  91, 0x0008082002ULL, -96.0}, {  92, 0x0001042041ULL, -16.0},
+    {  92, 0x0009042011ULL, -32.0}, {  92, 0x0001040051ULL, 32.0},
+    {  92, 0x0001042002ULL, 16.0}, {  92, 0x0001040012ULL, -32.0},
+    {  93, 0x000004a041ULL, -16.0}, {  93, 0x000804a011ULL, -32.0},
+    {  93, 0x0000048051ULL, 32.0}, {  93, 0x000004a002ULL, 16.0},
+    {  93, 0x0000048012ULL, -32.0}, {  94, 0x0000082011ULL, 64.0},
+    {  95, 0x0000084011ULL, -32.0}, {  96, 0x0008082051ULL, -192.0},
+    {  96, 0x0010082091ULL, 16.0}, {  96, 0x0010082021ULL, 16.0},
+    {  96, 0x0008082012ULL, 192.0}, {  96, 0x0000080052ULL, 64.0},
+    {  96, 0x0000100052ULL, -64.0}, {  96, 0x0010082052ULL, 32.0},
+    {  96, 0x0000080013ULL, -64.0}, {  96, 0x0000100013ULL, 64.0},
+    {  96, 0x0010082013ULL, -112.0}, {  97, 0x0000102091ULL, -32.0},
+    {  97, 0x0000102021ULL, -32.0}, {  97, 0x0000102052ULL, 64.0},
+    {  97, 0x0000102013ULL, 96.0}, {  98, 0x0000104091ULL, 16.0},
+    {  98, 0x0000104021ULL, 16.0}, {  98, 0x0000104052ULL, -32.0},
+    {  98, 0x0000104013ULL, -48.0}, {  99, 0x0000002001ULL, -8.0},
+    { 100, 0x0008040041ULL, -64.0}, { 100, 0x0008080041ULL, 64.0},
+    { 100, 0x0008040002ULL, 64.0}, { 100, 0x0008080002ULL, -64.0},
+    { 101, 0x0001040041ULL, -32.0}, { 101, 0x0001080041ULL, -32.0},
+    { 101, 0x0009040011ULL, -32.0}, { 101, 0x0001040002ULL, -32.0},
+    { 101, 0x0001080002ULL, -32.0}, { 102, 0x0000048041ULL, -32.0},
+    { 102, 0x0000088041ULL, -32.0}, { 102, 0x0008048011ULL, -32.0},
+    { 102, 0x0000048002ULL, -32.0}, { 102, 0x0000088002ULL, -32.0},
+    { 103, 0x0000082042ULL, 32.0}, { 103, 0x0000082003ULL, 32.0},
+    { 104, 0x0000080081ULL, -64.0}, { 104, 0x00000c0081ULL, -128.0},
+    { 104, 0x0000100081ULL, -64.0}, { 104, 0x0010082081ULL, -96.0},
+    { 104, 0x0008080051ULL, -128.0}, { 104, 0x00080c0051ULL, 128.0},
+    { 104, 0x0008080082ULL, 128.0}, { 104, 0x00080c0082ULL, 128.0},
+    { 104, 0x0008080012ULL, 128.0}, { 104, 0x00080c0012ULL, -128.0},
+    { 104, 0x0000080003ULL, 64.0}, { 104, 0x00000c0003ULL, 128.0},
+    { 104, 0x0000100003ULL, 64.0}, { 104, 0x0010082003ULL, 96.0},
+    { 104, 0x0008080004ULL, -128.0}, { 104, 0x00080c0004ULL, -128.0},
+    { 105, 0x0000104081ULL, -32.0}, { 105, 0x0000104003ULL, 32.0},
+    { 106, 0x0010080081ULL, -128.0}, { 106, 0x0010080003ULL, 128.0},
+    { 107, 0x0000102081ULL, -64.0}, { 107, 0x0000102003ULL, 64.0},
+    { 108, 0x0000002001ULL, 8.0}, { 109, 0x0008040041ULL, -64.0},
+    { 109, 0x0008080041ULL, -64.0}, { 109, 0x0008040002ULL, 64.0},
+    { 109, 0x0008080002ULL, 64.0}, { 110, 0x0001040041ULL, 32.0},
+    { 110, 0x0001080041ULL, -32.0}, { 110, 0x0009040011ULL, 32.0},
+    { 110, 0x0001040002ULL, 32.0}, { 110, 0x0001080002ULL, -32.0},
+    { 111, 0x0000048041ULL, 32.0}, { 111, 0x0000088041ULL, -32.0},
+    { 111, 0x0008048011ULL, 32.0}, { 111, 0x0000048002ULL, 32.0},
+    { 111, 0x0000088002ULL, -32.0}, { 112, 0x0000082042ULL, -32.0},
+    { 112, 0x0000082003ULL, -32.0}, { 113, 0x0000080081ULL, 64.0},
+    { 113, 0x00000c0081ULL, -128.0}, { 113, 0x0000100081ULL, 64.0},
+    { 113, 0x0010082081ULL, 96.0}, { 113, 0x0008080051ULL, 128.0},
+    { 113, 0x00080c0051ULL, 128.0}, { 113, 0x0008080082ULL, -128.0},
+    { 113, 0x00080c0082ULL, 128.0}, { 113, 0x0008080012ULL, -128.0},
+    { 113, 0x00080c0012ULL, -128.0}, { 113, 0x0000080003ULL, -64.0},
+    { 113, 0x00000c0003ULL, 128.0}, { 113, 0x0000100003ULL, -64.0},
+    { 113, 0x0010082003ULL, -96.0}, { 113, 0x0008080004ULL, 128.0},
+    { 113, 0x00080c0004ULL, -128.0}, { 114, 0x0000102081ULL, -128.0},
+    { 114, 0x0000102003ULL, 128.0}, { 115, 0x0000104081ULL, 32.0},
+    { 115, 0x0000104003ULL, -32.0}, { 116, 0x0000102081ULL, 128.0},
+    { 116, 0x0000102003ULL, -128.0}, { 117, 0x0010080081ULL, -128.0},
+    { 117, 0x0010080003ULL, 128.0}, { 118, 0x0000102081ULL, -64.0},
+    { 118, 0x0000102003ULL, 64.0}, { 119, 0x0000002001ULL, -24.0},
+    { 120, 0x0008080041ULL, -128.0}, { 120, 0x0008080002ULL, 128.0},
+    { 121, 0x0009040011ULL, 64.0}, { 122, 0x0008048011ULL, 64.0},
+    { 123, 0x0000082011ULL, 64.0}, { 124, 0x0008080051ULL, 256.0},
+    { 124, 0x0008080012ULL, -256.0}, { 124, 0x0010080052ULL, -128.0},
+    { 124, 0x0010080013ULL, 128.0}, { 125, 0x0000102091ULL, -32.0},
+    { 125, 0x0000102021ULL, -32.0}, { 125, 0x0000102052ULL, 64.0},
+    { 125, 0x0000102013ULL, 96.0}, { 126, 0x0010080081ULL, 128.0},
+    { 126, 0x0010080003ULL, -128.0}, { 127, 0x0000102081ULL, 64.0},
+    { 127, 0x0000102003ULL, -64.0}, { 128, 0x0010080081ULL, -128.0},
+    { 128, 0x0010080003ULL, 128.0}, { 129, 0x0000102081ULL, -64.0},
+    { 129, 0x0000102003ULL, 64.0}, { 130, 0x0008082042ULL, 128.0},
+    { 130, 0x00080c2042ULL, 256.0}, { 131, 0x0000002002ULL, 8.0},
+    { 132, 0x0009042002ULL, 64.0}, { 133, 0x000804a002ULL, 64.0},
+    { 134, 0x0000082002ULL, -128.0}, { 135, 0x0000084002ULL, 64.0},
+    { 136, 0x0008082042ULL, 384.0}, { 136, 0x0010082082ULL, -32.0},
+    { 136, 0x0010082012ULL, -64.0}, { 136, 0x0000080043ULL, -128.0},
+    { 136, 0x0000100043ULL, 128.0}, { 136, 0x0010082043ULL, -192.0},
+    { 136, 0x0010082004ULL, -32.0}, { 137, 0x0000102082ULL, 64.0},
+    { 137, 0x0000102012ULL, 128.0}, { 137, 0x0000102043ULL, 128.0},
+    { 137, 0x0000102004ULL, 64.0}, { 138, 0x0000104082ULL, -32.0},
+    { 138, 0x0000104012ULL, -64.0}, { 138, 0x0000104043ULL, -64.0},
+    { 138, 0x0000104004ULL, -32.0}, { 139, 0x0009040002ULL, 64.0},
+    { 140, 0x0008048002ULL, 64.0}, { 141, 0x0008080042ULL, 256.0},
+    { 141, 0x00080c0042ULL, -256.0}, { 142, 0x0009040002ULL, -64.0},
+    { 143, 0x0008048002ULL, -64.0}, { 144, 0x0008080042ULL, -256.0},
+    { 144, 0x00080c0042ULL, -256.0}, { 145, 0x0009040002ULL, -128.0},
+    { 146, 0x0008048002ULL, -128.0}, { 147, 0x0000082002ULL, -128.0},
+    { 148, 0x0008080042ULL, -512.0}, { 148, 0x0010080043ULL, 256.0},
+    { 149, 0x0000102082ULL, 64.0}, { 149, 0x0000102012ULL, 128.0},
+    { 149, 0x0000102043ULL, 128.0}, { 149, 0x0000102004ULL, 64.0},
+    { 150, 0x0010082003ULL, 64.0}, { 151, 0x0000102003ULL, -128.0},
+    { 152, 0x0000104003ULL, 64.0}, { 153, 0x0000102003ULL, -128.0},
+    { 154, 0x0000000001ULL, -32.0}, { 154, 0x0000040001ULL, -64.0},
+    { 154, 0x0000080001ULL, -32.0}, { 155, 0x0002002001ULL, -16.0},
+    { 156, 0x000100a001ULL, -32.0}, { 157, 0x0000012001ULL, -16.0},
+    { 158, 0x0000002001ULL, 32.0}, { 159, 0x0008042041ULL, 64.0},
+    { 159, 0x0008082041ULL, -32.0}, { 159, 0x0000040011ULL, 64.0},
+    { 159, 0x0000080011ULL, 128.0}, { 159, 0x00000c0011ULL, 64.0},
+    { 159, 0x0008042002ULL, 64.0}, { 159, 0x0008082002ULL, -32.0},
+    { 159, 0x0000080042ULL, -128.0}, { 159, 0x00000c0042ULL, 128.0},
+    { 159, 0x0000080003ULL, -128.0}, { 159, 0x00000c0003ULL, 128.0},
+    { 160, 0x0001042041ULL, -16.0}, { 160, 0x0009042011ULL, -16.0},
+    { 160, 0x0001040051ULL, 32.0}, { 160, 0x0001042002ULL, -16.0},
+    { 160, 0x0001040012ULL, 32.0}, { 161, 0x000004a041ULL, -16.0},
+    { 161, 0x000804a011ULL, -16.0}, { 161, 0x0000048051ULL, 32.0},
+    { 161, 0x000004a002ULL, -16.0}, { 161, 0x0000048012ULL, 32.0},
+    { 162, 0x0000082011ULL, -64.0}, { 162, 0x0000082042ULL, 32.0},
+    { 162, 0x0000082003ULL, 32.0}, { 163, 0x0000080091ULL, 32.0},
+    { 163, 0x00000c0091ULL, 64.0}, { 163, 0x0000100091ULL, 32.0},
+    { 163, 0x0000080021ULL, -32.0}, { 163, 0x00000c0021ULL, -64.0},
+    { 163, 0x0000100021ULL, -32.0}, { 163, 0x0000080052ULL, 128.0},
+    { 163, 0x0000100052ULL, 128.0}, { 163, 0x0000080013ULL, 96.0},
+    { 163, 0x00000c0013ULL, -64.0}, { 163, 0x0000100013ULL, 96.0},
+    { 164, 0x0000102091ULL, -32.0}, { 164, 0x0000102021ULL, 32.0},
+    { 164, 0x0000102052ULL, -128.0}, { 164, 0x0000102013ULL, -96.0},
+    { 165, 0x0002000001ULL, -32.0}, { 166, 0x0001008001ULL, -64.0},
+    { 167, 0x0000010001ULL, -32.0}, { 168, 0x0008040041ULL, 64.0},
+    { 168, 0x0008080041ULL, -64.0}, { 168, 0x0008040002ULL, 64.0},
+    { 168, 0x0008080002ULL, -64.0}, { 169, 0x0001040041ULL, -32.0},
+    { 169, 0x0001080041ULL, -32.0}, { 169, 0x0009040011ULL, -32.0},
+    { 169, 0x0001040002ULL, -32.0}, { 169, 0x0001080002ULL, -32.0},
+    { 170, 0x0000048041ULL, -32.0}, { 170, 0x0000088041ULL, -32.0},
+    { 170, 0x0008048011ULL, -32.0}, { 170, 0x0000048002ULL, -32.0},
+    { 170, 0x0000088002ULL, -32.0}, { 171, 0x0008040041ULL, -64.0},
+    { 171, 0x0008080041ULL, -64.0}, { 171, 0x0008040002ULL, -64.0},
+    { 171, 0x0008080002ULL, -64.0}, { 172, 0x0001040041ULL, -32.0},
+    { 172, 0x0001080041ULL, 32.0}, { 172, 0x0009040011ULL, -32.0},
+    { 172, 0x0001040002ULL, -32.0}, { 172, 0x0001080002ULL, 32.0},
+    { 173, 0x0000048041ULL, -32.0}, { 173, 0x0000088041ULL, 32.0},
+    { 173, 0x0008048011ULL, -32.0}, { 173, 0x0000048002ULL, -32.0},
+    { 173, 0x0000088002ULL, 32.0}, { 174, 0x0000000001ULL, -32.0},
+    { 174, 0x0000040001ULL, -64.0}, { 174, 0x0000080001ULL, -32.0},
+    { 175, 0x0002002001ULL, -4.0}, { 175, 0x0002000011ULL, 16.0},
+    { 176, 0x000100a001ULL, -8.0}, { 176, 0x0001008011ULL, 32.0},
+    { 177, 0x0000012001ULL, -4.0}, { 177, 0x0000010011ULL, 16.0},
+    { 178, 0x0000004001ULL, -4.0}, { 178, 0x0000002011ULL, 12.0},
+    { 179, 0x0000040011ULL, 64.0}, { 179, 0x0000080011ULL, 128.0},
+    { 179, 0x00000c0011ULL, 64.0}, { 179, 0x0008080012ULL, -128.0},
+    { 180, 0x0009042011ULL, -16.0}, { 180, 0x0001040051ULL, 32.0},
+    { 180, 0x0001080051ULL, 32.0}, { 180, 0x0009040021ULL, 32.0},
+    { 180, 0x0001040012ULL, 32.0}, { 180, 0x0001080012ULL, 32.0},
+    { 181, 0x000804a011ULL, -16.0}, { 181, 0x0000048051ULL, 32.0},
+    { 181, 0x0000088051ULL, 32.0}, { 181, 0x0008048021ULL, 32.0},
+    { 181, 0x0000048012ULL, 32.0}, { 181, 0x0000088012ULL, 32.0},
+    { 182, 0x0000084011ULL, 16.0}, { 182, 0x0000082021ULL, -16.0},
+    { 183, 0x0000080091ULL, 32.0}, { 183, 0x00000c0091ULL, 64.0},
+    { 183, 0x0000100091ULL, 32.0}, { 183, 0x0010082091ULL, 48.0},
+    { 183, 0x0000080021ULL, -32.0}, { 183, 0x00000c0021ULL, -64.0},
+    { 183, 0x0000100021ULL, -32.0}, { 183, 0x0010082021ULL, -48.0},
+    { 183, 0x0000080052ULL, 64.0}, { 183, 0x00000c0052ULL, 128.0},
+    { 183, 0x0000100052ULL, 64.0}, { 183, 0x0010082052ULL, 96.0},
+    { 183, 0x00080c0092ULL, -128.0}, { 183, 0x0008080022ULL, 128.0},
+    { 183, 0x0000080013ULL, 32.0}, { 183, 0x00000c0013ULL, 64.0},
+    { 183, 0x0000100013ULL, 32.0}, { 183, 0x0010082013ULL, 48.0},
+    { 183, 0x00080c0053ULL, -256.0}, { 183, 0x00080c0014ULL, -128.0},
+    { 184, 0x0000104091ULL, 16.0}, { 184, 0x0000104021ULL, -16.0},
+    { 184, 0x0000104052ULL, 32.0}, { 184, 0x0000104013ULL, 16.0},
+    { 185, 0x0000002001ULL, -8.0}, { 186, 0x0000082011ULL, 32.0},
+    { 186, 0x0000082042ULL, -32.0}, { 186, 0x0000082003ULL, -32.0},
+    { 187, 0x0010080091ULL, 64.0}, { 187, 0x0010080021ULL, -64.0},
+    { 187, 0x0010080052ULL, 256.0}, { 187, 0x0010080013ULL, 192.0},
+    { 188, 0x0000102091ULL, 32.0}, { 188, 0x0000102021ULL, -32.0},
+    { 188, 0x0000102052ULL, 128.0}, { 188, 0x0000102013ULL, 96.0},
+    { 189, 0x0000002001ULL, 8.0}, { 190, 0x0008040041ULL, -128.0},
+    { 190, 0x0008040002ULL, -128.0}, { 191, 0x0009040011ULL, -64.0},
+    { 192, 0x0008048011ULL, -64.0}, { 193, 0x0000082011ULL, -32.0},
+    { 193, 0x0000082042ULL, 32.0}, { 193, 0x0000082003ULL, 32.0},
+    { 194, 0x0000102091ULL, -32.0}, { 194, 0x0000102021ULL, 32.0},
+    { 194, 0x0000102052ULL, -128.0}, { 194, 0x0000102013ULL, -96.0},
+    { 195, 0x0000002001ULL, 8.0}, { 196, 0x0000082011ULL, -32.0},
+    { 197, 0x0010080091ULL, -64.0}, { 197, 0x0010080021ULL, 64.0},
+    { 197, 0x0010080052ULL, -128.0}, { 197, 0x0010080013ULL, -64.0},
+    { 198, 0x0000102091ULL, -32.0}, { 198, 0x0000102021ULL, 32.0},
+    { 198, 0x0000102052ULL, -64.0}, { 198, 0x0000102013ULL, -32.0},
+    { 199, 0x0000040002ULL, -128.0}, { 199, 0x0000080002ULL, -256.0},
+    { 199, 0x00000c0002ULL, -128.0}, { 200, 0x0009042002ULL, 32.0},
+    { 201, 0x000804a002ULL, 32.0}, { 202, 0x0000082002ULL, 128.0},
+    { 203, 0x0000080082ULL, 64.0}, { 203, 0x00000c0082ULL, -128.0},
+    { 203, 0x0000100082ULL, 64.0}, { 203, 0x0000080012ULL, 128.0},
+    { 203, 0x00000c0012ULL, 256.0}, { 203, 0x0000100012ULL, 128.0},
+    { 203, 0x0000080004ULL, -64.0}, { 203, 0x00000c0004ULL, 128.0},
+    { 203, 0x0000100004ULL, -64.0}, { 204, 0x0000102082ULL, -64.0},
+    { 204, 0x0000102012ULL, -128.0}, { 204, 0x0000102004ULL, 64.0},
+    { 205, 0x0009040002ULL, 64.0}, { 206, 0x0008048002ULL, 64.0},
+    { 207, 0x0009040002ULL, 64.0}, { 208, 0x0008048002ULL, 64.0},
+    { 209, 0x0000002002ULL, -16.0}, { 210, 0x0000040002ULL, -128.0},
+    { 210, 0x0000080002ULL, -256.0}, { 210, 0x00000c0002ULL, -128.0},
+    { 210, 0x0008040042ULL, 64.0}, { 210, 0x0008080042ULL, -64.0},
+    { 210, 0x0008040003ULL, 64.0}, { 210, 0x0008080003ULL, 192.0},
+    { 211, 0x0009042002ULL, 32.0}, { 211, 0x0009040012ULL, -64.0},
+    { 212, 0x000804a002ULL, 32.0}, { 212, 0x0008048012ULL, -64.0},
+    { 213, 0x0000084002ULL, -32.0}, { 213, 0x0000082012ULL, 64.0},
+    { 214, 0x0000080012ULL, 128.0}, { 214, 0x00000c0012ULL, 256.0},
+    { 214, 0x0000100012ULL, 128.0}, { 214, 0x0010082012ULL, 192.0},
+    { 214, 0x0008080052ULL, 128.0}, { 214, 0x00080c0052ULL, -128.0},
+    { 214, 0x0008080013ULL, -384.0}, { 214, 0x00080c0013ULL, -128.0},
+    { 215, 0x0000104012ULL, 64.0}, { 216, 0x0000082002ULL, -64.0},
+    { 217, 0x0010080082ULL, 128.0}, { 217, 0x0010080012ULL, 256.0},
+    { 217, 0x0010080004ULL, -128.0}, { 218, 0x0000102082ULL, 64.0},
+    { 218, 0x0000102012ULL, 128.0}, { 218, 0x0000102004ULL, -64.0},
+    { 219, 0x0009040002ULL, 128.0}, { 220, 0x0008048002ULL, 128.0},
+    { 221, 0x0000082002ULL, 64.0}, { 222, 0x0000102082ULL, -64.0},
+    { 222, 0x0000102012ULL, -128.0}, { 222, 0x0000102004ULL, 64.0},
+    { 223, 0x0000082002ULL, 64.0}, { 224, 0x0010080012ULL, -256.0},
+    { 225, 0x0000102012ULL, -128.0}, { 226, 0x0000080003ULL, -128.0},
+    { 226, 0x00000c0003ULL, -256.0}, { 226, 0x0000100003ULL, -128.0},
+    { 227, 0x0000102003ULL, 128.0}, { 228, 0x0000082003ULL, -64.0},
+    { 229, 0x0000080003ULL, -128.0}, { 229, 0x00000c0003ULL, -256.0},
+    { 229, 0x0000100003ULL, -128.0}, { 229, 0x0010082003ULL, -192.0},
+    { 229, 0x0008080043ULL, -256.0}, { 229, 0x00080c0043ULL, 256.0},
+    { 229, 0x0008080004ULL, 256.0}, { 229, 0x00080c0004ULL, 256.0},
+    { 230, 0x0000104003ULL, -64.0}, { 231, 0x0010080003ULL, -256.0},
+    { 232, 0x0000102003ULL, -128.0}, { 233, 0x0000102003ULL, 128.0},
+    { 234, 0x0010080003ULL, 256.0}, { 235, 0x0000102003ULL, 128.0},
+    { 236, 0x0008040042ULL, -64.0}, { 236, 0x0008080042ULL, 64.0},
+    { 236, 0x0008040003ULL, -64.0}, { 236, 0x0008080003ULL, 64.0},
+    { 237, 0x0000002002ULL, 8.0}, { 238, 0x0000082012ULL, -32.0},
+    { 239, 0x0010080092ULL, -64.0}, { 239, 0x0010080022ULL, 64.0},
+    { 239, 0x0010080053ULL, -128.0}, { 239, 0x0010080014ULL, -64.0},
+    { 240, 0x0000102092ULL, -32.0}, { 240, 0x0000102022ULL, 32.0},
+    { 240, 0x0000102053ULL, -64.0}, { 240, 0x0000102014ULL, -32.0},
+    { 241, 0x0000082003ULL, 64.0}, { 242, 0x0010080013ULL, -256.0},
+    { 243, 0x0000102013ULL, -128.0}, { 244, 0x0010080004ULL, 256.0},
+    { 245, 0x0000102004ULL, 128.0}, { 246, 0x0000002001ULL, -32.0},
+    { 246, 0x0000042001ULL, 64.0}, { 246, 0x0000082001ULL, -32.0},
+    { 247, 0x0000004001ULL, 16.0}, { 247, 0x0000002011ULL, -16.0},
+    { 248, 0x0000042011ULL, -64.0}, { 248, 0x0000082011ULL, 128.0},
+    { 248, 0x00000c2011ULL, -64.0}, { 248, 0x0008082051ULL, -32.0},
+    { 248, 0x0008082012ULL, -96.0}, { 249, 0x0009044011ULL, 16.0},
+    { 249, 0x0001042051ULL, 16.0}, { 249, 0x0001082051ULL, -32.0},
+    { 249, 0x0001042012ULL, 16.0}, { 249, 0x0001082012ULL, -32.0},
+    { 250, 0x000804c011ULL, 16.0}, { 250, 0x000004a051ULL, 16.0},
+    { 250, 0x000008a051ULL, -32.0}, { 250, 0x000004a012ULL, 16.0},
+    { 250, 0x000008a012ULL, -32.0}, { 251, 0x0000084011ULL, -48.0},
+    { 251, 0x0000082021ULL, 16.0}, { 252, 0x0000082091ULL, 32.0},
+    { 252, 0x00000c2091ULL, -64.0}, { 252, 0x0000102091ULL, 32.0},
+    { 252, 0x0000082021ULL, -32.0}, { 252, 0x00000c2021ULL, 64.0},
+    { 252, 0x0000102021ULL, -32.0}, { 252, 0x0000082052ULL, 64.0},
+    { 252, 0x00000c2052ULL, -128.0}, { 252, 0x0000102052ULL, 64.0},
+    { 252, 0x00080c2092ULL, 128.0}, { 252, 0x0008082022ULL, 64.0},
+    { 252, 0x0000082013ULL, 32.0}, { 252, 0x00000c2013ULL, -64.0},
+    { 252, 0x0000102013ULL, 32.0}, { 252, 0x00080c2053ULL, 256.0},
+    { 252, 0x00080c2014ULL, 128.0}, { 253, 0x0000104091ULL, -32.0},
+    { 253, 0x0000104021ULL, 32.0}, { 253, 0x0000104052ULL, -64.0},
+    { 253, 0x0000104013ULL, -32.0}, { 254, 0x0000000001ULL, -32.0},
+    { 254, 0x0000040001ULL, 64.0}, { 254, 0x0000080001ULL, -32.0},
+    { 255, 0x0008042041ULL, -64.0}, { 255, 0x0008082041ULL, 32.0},
+    { 255, 0x0000040011ULL, -64.0}, { 255, 0x0000080011ULL, 128.0},
+    { 255, 0x00000c0011ULL, -64.0}, { 255, 0x0008042002ULL, -64.0},
+    { 255, 0x0008082002ULL, 32.0}, { 255, 0x0000080042ULL, -128.0},
+    { 255, 0x00000c0042ULL, -128.0}, { 255, 0x0000080003ULL, -128.0},
+    { 255, 0x00000c0003ULL, -128.0}, { 256, 0x0001042041ULL, 16.0},
+    { 256, 0x0009042011ULL, 48.0}, { 256, 0x0001040051ULL, 32.0},
+    { 256, 0x0001042002ULL, 16.0}, { 256, 0x0001040012ULL, 32.0},
+    { 257, 0x000004a041ULL, 16.0}, { 257, 0x000804a011ULL, 48.0},
+    { 257, 0x0000048051ULL, 32.0}, { 257, 0x000004a002ULL, 16.0},
+    { 257, 0x0000048012ULL, 32.0}, { 258, 0x0000082011ULL, -32.0},
+    { 258, 0x0000082042ULL, 64.0}, { 258, 0x0000082003ULL, 64.0},
+    { 259, 0x0000080091ULL, 32.0}, { 259, 0x00000c0091ULL, -64.0},
+    { 259, 0x0000100091ULL, 32.0}, { 259, 0x0000080021ULL, -32.0},
+    { 259, 0x00000c0021ULL, 64.0}, { 259, 0x0000100021ULL, -32.0},
+    { 259, 0x0000080052ULL, 128.0}, { 259, 0x0000100052ULL, 128.0},
+    { 259, 0x0000080013ULL, 96.0}, { 259, 0x00000c0013ULL, 64.0},
+    { 259, 0x0000100013ULL, 96.0}, { 260, 0x0000102091ULL, -32.0},
+    { 260, 0x0000102021ULL, 32.0}, { 260, 0x0000102052ULL, -128.0},
+    { 260, 0x0000102013ULL, -96.0}, { 261, 0x0008040041ULL, -64.0},
+    { 261, 0x0008080041ULL, 64.0}, { 261, 0x0008040002ULL, -64.0},
+    { 261, 0x0008080002ULL, 64.0}, { 262, 0x0001040041ULL, 32.0},
+    { 262, 0x0001080041ULL, 32.0}, { 262, 0x0009040011ULL, 32.0},
+    { 262, 0x0001040002ULL, 32.0}, { 262, 0x0001080002ULL, 32.0},
+    { 263, 0x0000048041ULL, 32.0}, { 263, 0x0000088041ULL, 32.0},
+    { 263, 0x0008048011ULL, 32.0}, { 263, 0x0000048002ULL, 32.0},
+    { 263, 0x0000088002ULL, 32.0}, { 264, 0x0002002001ULL, 16.0},
+    { 265, 0x000100a001ULL, 32.0}, { 266, 0x0000012001ULL, 16.0},
+    { 267, 0x0000002001ULL, -32.0}, { 268, 0x0009042011ULL, 32.0},
+    { 269, 0x000804a011ULL, 32.0}, { 270, 0x0000082011ULL, 96.0},
+    { 270, 0x0000082042ULL, -96.0}, { 270, 0x0000082003ULL, -96.0},
+    { 271, 0x0010082091ULL, -64.0}, { 271, 0x0010082021ULL, 64.0},
+    { 271, 0x0010082052ULL, -256.0}, { 271, 0x0010082013ULL, -192.0},
+    { 272, 0x0000102091ULL, 64.0}, { 272, 0x0000102021ULL, -64.0},
+    { 272, 0x0000102052ULL, 256.0}, { 272, 0x0000102013ULL, 192.0},
+    { 273, 0x0002000001ULL, 32.0}, { 274, 0x0001008001ULL, 64.0},
+    { 275, 0x0000010001ULL, 32.0}, { 276, 0x0008040041ULL, 64.0},
+    { 276, 0x0008080041ULL, 64.0}, { 276, 0x0008040002ULL, 64.0},
+    { 276, 0x0008080002ULL, 64.0}, { 277, 0x0001040041ULL, 32.0},
+    { 277, 0x0001080041ULL, -32.0}, { 277, 0x0009040011ULL, 32.0},
+    { 277, 0x0001040002ULL, 32.0}, { 277, 0x0001080002ULL, -32.0},
+    { 278, 0x0000048041ULL, 32.0}, { 278, 0x0000088041ULL, -32.0},
+    { 278, 0x0008048011ULL, 32.0}, { 278, 0x0000048002ULL, 32.0},
+    { 278, 0x0000088002ULL, -32.0}, { 279, 0x0000000001ULL, 32.0},
+    { 279, 0x0000040001ULL, -64.0}, { 279, 0x0000080001ULL, 32.0},
+    { 280, 0x0002002001ULL, 4.0}, { 280, 0x0002000011ULL, -16.0},
+    { 281, 0x000100a001ULL, 8.0}, { 281, 0x0001008011ULL, -32.0},
+    { 282, 0x0000012001ULL, 4.0}, { 282, 0x0000010011ULL, -16.0},
+    { 283, 0x0000002001ULL, -32.0}, { 284, 0x0000004001ULL, 4.0},
+    { 284, 0x0000002011ULL, -12.0}, { 285, 0x0000040011ULL, 64.0},
+    { 285, 0x0000080011ULL, -128.0}, { 285, 0x00000c0011ULL, 64.0},
+    { 285, 0x0008080012ULL, 128.0}, { 286, 0x0009042011ULL, -16.0},
+    { 286, 0x0001040051ULL, -32.0}, { 286, 0x0001080051ULL, 32.0},
+    { 286, 0x0009040021ULL, -32.0}, { 286, 0x0001040012ULL, -32.0},
+    { 286, 0x0001080012ULL, 32.0}, { 287, 0x000804a011ULL, -16.0},
+    { 287, 0x0000048051ULL, -32.0}, { 287, 0x0000088051ULL, 32.0},
+    { 287, 0x0008048021ULL, -32.0}, { 287, 0x0000048012ULL, -32.0},
+    { 287, 0x0000088012ULL, 32.0}, { 288, 0x0000082011ULL, 96.0},
+    { 289, 0x0000084011ULL, -16.0}, { 289, 0x0000082021ULL, 16.0},
+    { 290, 0x0000080091ULL, -32.0}, { 290, 0x00000c0091ULL, 64.0},
+    { 290, 0x0000100091ULL, -32.0}, { 290, 0x0010082091ULL, -48.0},
+    { 290, 0x0000080021ULL, 32.0}, { 290, 0x00000c0021ULL, -64.0},
+    { 290, 0x0000100021ULL, 32.0}, { 290, 0x0010082021ULL, 48.0},
+    { 290, 0x0000080052ULL, -64.0}, { 290, 0x00000c0052ULL, 128.0},
+    { 290, 0x0000100052ULL, -64.0}, { 290, 0x0010082052ULL, -96.0},
+    { 290, 0x00080c0092ULL, -128.0}, { 290, 0x0008080022ULL, -128.0},
+    { 290, 0x0000080013ULL, -32.0}, { 290, 0x00000c0013ULL, 64.0},
+    { 290, 0x0000100013ULL, -32.0}, { 290, 0x0010082013ULL, -48.0},
+    { 290, 0x00080c0053ULL, -256.0}, { 290, 0x00080c0014ULL, -128.0},
+    { 291, 0x0000102091ULL, 64.0}, { 291, 0x0000102021ULL, -64.0},
+    { 291, 0x0000102052ULL, 128.0}, { 291, 0x0000102013ULL, 64.0},
+    { 292, 0x0000104091ULL, -16.0}, { 292, 0x0000104021ULL, 16.0},
+    { 292, 0x0000104052ULL, -32.0}, { 292, 0x0000104013ULL, -16.0},
+    { 293, 0x0000002001ULL, 8.0}, { 294, 0x0008040041ULL, 128.0},
+    { 294, 0x0008040002ULL, 128.0}, { 295, 0x0009040011ULL, -64.0},
+    { 296, 0x0008048011ULL, -64.0}, { 297, 0x0000082011ULL, -32.0},
+    { 297, 0x0000082042ULL, 32.0}, { 297, 0x0000082003ULL, 32.0},
+    { 298, 0x0000102091ULL, -32.0}, { 298, 0x0000102021ULL, 32.0},
+    { 298, 0x0000102052ULL, -128.0}, { 298, 0x0000102013ULL, -96.0},
+    { 299, 0x0000002001ULL, -8.0}, { 300, 0x0000082011ULL, 32.0},
+    { 300, 0x0000082042ULL, -32.0}, { 300, 0x0000082003ULL, -32.0},
+    { 301, 0x0010080091ULL, 64.0}, { 301, 0x0010080021ULL, -64.0},
+    { 301, 0x0010080052ULL, 256.0}, { 301, 0x0010080013ULL, 192.0},
+    { 302, 0x0000102091ULL, 32.0}, { 302, 0x0000102021ULL, -32.0},
+    { 302, 0x0000102052ULL, 128.0}, { 302, 0x0000102013ULL, 96.0},
+    { 303, 0x0000002001ULL, -8.0}, { 304, 0x0000082011ULL, 32.0},
+    { 305, 0x0010080091ULL, 64.0}, { 305, 0x0010080021ULL, -64.0},
+    { 305, 0x0010080052ULL, 128.0}, { 305, 0x0010080013ULL, 64.0},
+    { 306, 0x0000102091ULL, 32.0}, { 306, 0x0000102021ULL, -32.0},
+    { 306, 0x0000102052ULL, 64.0}, { 306, 0x0000102013ULL, 32.0},
+    { 307, 0x0000002002ULL, 32.0}, { 308, 0x0000042002ULL, 128.0},
+    { 308, 0x0000082002ULL, -256.0}, { 308, 0x00000c2002ULL, 128.0},
+    { 308, 0x0008042042ULL, -64.0}, { 308, 0x0008042003ULL, -64.0},
+    { 308, 0x0008082003ULL, 128.0}, { 309, 0x0009044002ULL, -32.0},
+    { 310, 0x000804c002ULL, -32.0}, { 311, 0x0000084002ULL, 96.0},
+    { 311, 0x0000082012ULL, -64.0}, { 312, 0x0000082012ULL, 128.0},
+    { 312, 0x00000c2012ULL, -256.0}, { 312, 0x0000102012ULL, 128.0},
+    { 312, 0x0008082052ULL, 64.0}, { 312, 0x00080c2052ULL, 128.0},
+    { 312, 0x0008082013ULL, -192.0}, { 312, 0x00080c2013ULL, 128.0},
+    { 313, 0x0000104012ULL, -128.0}, { 314, 0x0000040002ULL, 128.0},
+    { 314, 0x0000080002ULL, -256.0}, { 314, 0x00000c0002ULL, 128.0},
+    { 315, 0x0009042002ULL, -96.0}, { 316, 0x000804a002ULL, -96.0},
+    { 317, 0x0000082002ULL, 64.0}, { 318, 0x0000080082ULL, 64.0},
+    { 318, 0x00000c0082ULL, 128.0}, { 318, 0x0000100082ULL, 64.0},
+    { 318, 0x0000080012ULL, 128.0}, { 318, 0x00000c0012ULL, -256.0},
+    { 318, 0x0000100012ULL, 128.0}, { 318, 0x0000080004ULL, -64.0},
+    { 318, 0x00000c0004ULL, -128.0}, { 318, 0x0000100004ULL, -64.0},
+    { 319, 0x0000102082ULL, -64.0}, { 319, 0x0000102012ULL, -128.0},
+    { 319, 0x0000102004ULL, 64.0}, { 320, 0x0009040002ULL, -64.0},
+    { 321, 0x0008048002ULL, -64.0}, { 322, 0x0009042002ULL, -64.0},
+    { 323, 0x000804a002ULL, -64.0}, { 324, 0x0000082002ULL, -192.0},
+    { 325, 0x0010082082ULL, -128.0}, { 325, 0x0010082012ULL, -256.0},
+    { 325, 0x0010082004ULL, 128.0}, { 326, 0x0000102082ULL, 128.0},
+    { 326, 0x0000102012ULL, 256.0}, { 326, 0x0000102004ULL, -128.0},
+    { 327, 0x0009040002ULL, -64.0}, { 328, 0x0008048002ULL, -64.0},
+    { 329, 0x0000002002ULL, 16.0}, { 330, 0x0000040002ULL, -128.0},
+    { 330, 0x0000080002ULL, 256.0}, { 330, 0x00000c0002ULL, -128.0},
+    { 330, 0x0008040042ULL, 64.0}, { 330, 0x0008080042ULL, 64.0},
+    { 330, 0x0008040003ULL, 64.0}, { 330, 0x0008080003ULL, -192.0},
+    { 331, 0x0009042002ULL, 32.0}, { 331, 0x0009040012ULL, 64.0},
+    { 332, 0x000804a002ULL, 32.0}, { 332, 0x0008048012ULL, 64.0},
+    { 333, 0x0000082002ULL, -192.0}, { 334, 0x0000084002ULL, 32.0},
+    { 334, 0x0000082012ULL, -64.0}, { 335, 0x0000080012ULL, -128.0},
+    { 335, 0x00000c0012ULL, 256.0}, { 335, 0x0000100012ULL, -128.0},
+    { 335, 0x0010082012ULL, -192.0}, { 335, 0x0008080052ULL, -128.0},
+    { 335, 0x00080c0052ULL, -128.0}, { 335, 0x0008080013ULL, 384.0},
+    { 335, 0x00080c0013ULL, -128.0}, { 336, 0x0000102012ULL, 256.0},
+    { 337, 0x0000104012ULL, -64.0}, { 338, 0x0009040002ULL, 128.0},
+    { 339, 0x0008048002ULL, 128.0}, { 340, 0x0000082002ULL, 64.0},
+    { 341, 0x0000102082ULL, -64.0}, { 341, 0x0000102012ULL, -128.0},
+    { 341, 0x0000102004ULL, 64.0}, { 342, 0x0000082002ULL, -64.0},
+    { 343, 0x0010080082ULL, 128.0}, { 343, 0x0010080012ULL, 256.0},
+    { 343, 0x0010080004ULL, -128.0}, { 344, 0x0000102082ULL, 64.0},
+    { 344, 0x0000102012ULL, 128.0}, { 344, 0x0000102004ULL, -64.0},
+    { 345, 0x0000082002ULL, -64.0}, { 346, 0x0010080012ULL, 256.0},
+    { 347, 0x0000102012ULL, 128.0}, { 348, 0x0000082003ULL, 64.0},
+    { 349, 0x0000082003ULL, -128.0}, { 349, 0x00000c2003ULL, 256.0},
+    { 349, 0x0000102003ULL, -128.0}, { 349, 0x0008082043ULL, -128.0},
+    { 349, 0x00080c2043ULL, -256.0}, { 349, 0x0008082004ULL, 128.0},
+    { 349, 0x00080c2004ULL, -256.0}, { 350, 0x0000104003ULL, 128.0},
+    { 351, 0x0000080003ULL, -128.0}, { 351, 0x00000c0003ULL, 256.0},
+    { 351, 0x0000100003ULL, -128.0}, { 352, 0x0000102003ULL, 128.0},
+    { 353, 0x0010082003ULL, 256.0}, { 354, 0x0000102003ULL, -256.0},
+    { 355, 0x0000082003ULL, 64.0}, { 356, 0x0000080003ULL, 128.0},
+    { 356, 0x00000c0003ULL, -256.0}, { 356, 0x0000100003ULL, 128.0},
+    { 356, 0x0010082003ULL, 192.0}, { 356, 0x0008080043ULL, 256.0},
+    { 356, 0x00080c0043ULL, 256.0}, { 356, 0x0008080004ULL, -256.0},
+    { 356, 0x00080c0004ULL, 256.0}, { 357, 0x0000102003ULL, -256.0},
+    { 358, 0x0000104003ULL, 64.0}, { 359, 0x0000102003ULL, 128.0},
+    { 360, 0x0010080003ULL, -256.0}, { 361, 0x0000102003ULL, -128.0},
+    { 362, 0x0010080003ULL, -256.0}, { 363, 0x0000102003ULL, -128.0},
+    { 364, 0x0000000002ULL, 64.0}, { 364, 0x0000080002ULL, 64.0},
+    { 365, 0x0000002002ULL, -32.0}, { 366, 0x0000080012ULL, -256.0},
+    { 367, 0x0000082012ULL, 96.0}, { 368, 0x0000080092ULL, -64.0},
+    { 368, 0x0000100092ULL, -64.0}, { 368, 0x0000080022ULL, 64.0},
+    { 368, 0x0000100022ULL, 64.0}, { 368, 0x0000080053ULL, -128.0},
+    { 368, 0x0000100053ULL, -128.0}, { 368, 0x0000080014ULL, -64.0},
+    { 368, 0x0000100014ULL, -64.0}, { 369, 0x0000102092ULL, 64.0},
+    { 369, 0x0000102022ULL, -64.0}, { 369, 0x0000102053ULL, 128.0},
+    { 369, 0x0000102014ULL, 64.0}, { 370, 0x0008040042ULL, 64.0},
+    { 370, 0x0008080042ULL, -64.0}, { 370, 0x0008040003ULL, 64.0},
+    { 370, 0x0008080003ULL, -64.0}, { 371, 0x0008040042ULL, 64.0},
+    { 371, 0x0008080042ULL, 64.0}, { 371, 0x0008040003ULL, 64.0},
+    { 371, 0x0008080003ULL, 64.0}, { 372, 0x0000002002ULL, -16.0},
+    { 373, 0x0000082012ULL, 64.0}, { 374, 0x0000102092ULL, 64.0},
+    { 374, 0x0000102022ULL, -64.0}, { 374, 0x0000102053ULL, 128.0},
+    { 374, 0x0000102014ULL, 64.0}, { 375, 0x0000080003ULL, 512.0},
+    { 376, 0x0000082003ULL, -192.0}, { 377, 0x0000080013ULL, -256.0},
+    { 377, 0x0000100013ULL, -256.0}, { 378, 0x0000102013ULL, 256.0},
+    { 379, 0x0000082003ULL, -128.0}, { 380, 0x0000102013ULL, 256.0},
+    { 381, 0x0000080004ULL, 256.0}, { 381, 0x0000100004ULL, 256.0},
+    { 382, 0x0000102004ULL, -256.0}, { 383, 0x0000102004ULL, -256.0},
+    { 384, 0x0000002002ULL, 32.0}, { 385, 0x0000082012ULL, -96.0},
+    { 386, 0x0010082092ULL, 64.0}, { 386, 0x0010082022ULL, -64.0},
+    { 386, 0x0010082053ULL, 128.0}, { 386, 0x0010082014ULL, 64.0},
+    { 387, 0x0000102092ULL, -64.0}, { 387, 0x0000102022ULL, 64.0},
+    { 387, 0x0000102053ULL, -128.0}, { 387, 0x0000102014ULL, -64.0},
+    { 388, 0x0008040042ULL, -64.0}, { 388, 0x0008080042ULL, -64.0},
+    { 388, 0x0008040003ULL, -64.0}, { 388, 0x0008080003ULL, -64.0},
+    { 389, 0x0000002002ULL, 8.0}, { 390, 0x0000082012ULL, -32.0},
+    { 391, 0x0010080092ULL, -64.0}, { 391, 0x0010080022ULL, 64.0},
+    { 391, 0x0010080053ULL, -128.0}, { 391, 0x0010080014ULL, -64.0},
+    { 392, 0x0000102092ULL, -32.0}, { 392, 0x0000102022ULL, 32.0},
+    { 392, 0x0000102053ULL, -64.0}, { 392, 0x0000102014ULL, -32.0},
+    { 393, 0x0000082003ULL, 192.0}, { 394, 0x0010082013ULL, 256.0},
+    { 395, 0x0000102013ULL, -256.0}, { 396, 0x0000082003ULL, 64.0},
+    { 397, 0x0010080013ULL, -256.0}, { 398, 0x0000102013ULL, -128.0},
+    { 399, 0x0010082004ULL, -256.0}, { 400, 0x0000102004ULL, 256.0},
+    { 401, 0x0010080004ULL, 256.0}, { 402, 0x0000102004ULL, 128.0},
+  };
+
+  // nu + n -> l- + p + K0: 726 kinematic monomials, 3288 terms
+  const unsigned int kMonomialsNP[726] = {
+    0x040100, 0x010100, 0x050100, 0x020100, 0x014100, 0x001100, 0x041100, 0x011100,
+    0x005100, 0x015100, 0x002100, 0x006100, 0x040500, 0x010500, 0x050500, 0x020500,
+    0x014500, 0x001500, 0x041500, 0x011500, 0x005500, 0x015500, 0x002500, 0x006500,
+    0x010200, 0x050200, 0x020200, 0x014200, 0x041200, 0x011200, 0x005200, 0x015200,
+    0x002200, 0x006200, 0x000040, 0x040040, 0x010040, 0x050040, 0x020040, 0x014040,
+    0x001040, 0x041040, 0x011040, 0x005040, 0x015040, 0x009040, 0x002040, 0x006040,
+    0x00a040, 0x010440, 0x050440, 0x020440, 0x014440, 0x001440, 0x041440, 0x011440,
+    0x015440, 0x009440, 0x002440, 0x00a440, 0x020840, 0x014840, 0x011840, 0x015840,
+    0x009840, 0x002840, 0x00a840, 0x010140, 0x050140, 0x020140, 0x014140, 0x001140,
+    0x041140, 0x011140, 0x005140, 0x015140, 0x009140, 0x002140, 0x006140, 0x00a140,
+    0x050540, 0x020540, 0x014540, 0x041540, 0x015540, 0x009540, 0x00a540, 0x020240,
+    0x014240, 0x011240, 0x015240, 0x009240, 0x002240, 0x00a240, 0x010080, 0x050080,
+    0x020080, 0x014080, 0x001080, 0x041080, 0x011080, 0x015080, 0x009080, 0x002080,
+    0x00a080, 0x020480, 0x014480, 0x011480, 0x015480, 0x009480, 0x002480, 0x00a480,
+    0x020180, 0x014180, 0x011180, 0x015180, 0x009180, 0x002180, 0x00a180, 0x080110,
+    0x010110, 0x050110, 0x020110, 0x014110, 0x001110, 0x041110, 0x011110, 0x005110,
+    0x015110, 0x002110, 0x006110, 0x080510, 0x050510, 0x020510, 0x041510, 0x011510,
+    0x015510, 0x002510, 0x006510, 0x020210, 0x011210, 0x015210, 0x002210, 0x006210,
+    0x080050, 0x010050, 0x050050, 0x020050, 0x004050, 0x014050, 0x008050, 0x001050,
+    0x041050, 0x011050, 0x005050, 0x015050, 0x009050, 0x002050, 0x006050, 0x00a050,
+    0x010450, 0x050450, 0x020450, 0x014450, 0x008450, 0x001450, 0x041450, 0x011450,
+    0x015450, 0x009450, 0x002450, 0x00a450, 0x020850, 0x011850, 0x015850, 0x002850,
+    0x00a850, 0x010150, 0x050150, 0x020150, 0x014150, 0x008150, 0x001150, 0x041150,
+    0x011150, 0x015150, 0x009150, 0x002150, 0x006150, 0x00a150, 0x020550, 0x015550,
+    0x00a550, 0x020250, 0x011250, 0x015250, 0x002250, 0x00a250, 0x010090, 0x050090,
+    0x020090, 0x014090, 0x008090, 0x001090, 0x041090, 0x011090, 0x015090, 0x009090,
+    0x002090, 0x00a090, 0x020490, 0x011490, 0x015490, 0x002490, 0x00a490, 0x020190,
+    0x011190, 0x015190, 0x002190, 0x00a190, 0x020120, 0x011120, 0x002120, 0x010060,
+    0x050060, 0x020060, 0x014060, 0x008060, 0x041060, 0x011060, 0x005060, 0x015060,
+    0x009060, 0x002060, 0x006060, 0x00a060, 0x050460, 0x020460, 0x041460, 0x011460,
+    0x002460, 0x050160, 0x020160, 0x041160, 0x011160, 0x002160, 0x0500a0, 0x0200a0,
+    0x0140a0, 0x0410a0, 0x0110a0, 0x0150a0, 0x0090a0, 0x0020a0, 0x00a0a0, 0x020070,
+    0x011070, 0x015070, 0x002070, 0x006070, 0x00a070, 0x0200b0, 0x0150b0, 0x00a0b0,
+    0x000104, 0x080104, 0x010104, 0x050104, 0x020104, 0x004104, 0x014104, 0x001104,
+    0x041104, 0x011104, 0x005104, 0x015104, 0x002104, 0x006104, 0x080504, 0x010504,
+    0x050504, 0x001504, 0x041504, 0x011504, 0x010204, 0x050204, 0x001204, 0x041204,
+    0x011204, 0x000044, 0x080044, 0x010044, 0x050044, 0x020044, 0x014044, 0x008044,
+    0x001044, 0x041044, 0x011044, 0x015044, 0x009044, 0x002044, 0x00a044, 0x020444,
+    0x014444, 0x008444, 0x011444, 0x015444, 0x009444, 0x002444, 0x00a444, 0x010144,
+    0x050144, 0x020144, 0x014144, 0x008144, 0x001144, 0x041144, 0x011144, 0x015144,
+    0x009144, 0x00a144, 0x020084, 0x014084, 0x008084, 0x011084, 0x015084, 0x009084,
+    0x002084, 0x00a084, 0x010114, 0x050114, 0x020114, 0x014114, 0x001114, 0x041114,
+    0x011114, 0x005114, 0x015114, 0x002114, 0x006114, 0x050514, 0x041514, 0x011514,
+    0x050214, 0x041214, 0x011214, 0x010054, 0x050054, 0x020054, 0x014054, 0x008054,
+    0x001054, 0x041054, 0x011054, 0x015054, 0x009054, 0x002054, 0x00a054, 0x020454,
+    0x014454, 0x011454, 0x015454, 0x009454, 0x002454, 0x00a454, 0x050154, 0x020154,
+    0x014154, 0x041154, 0x011154, 0x015154, 0x009154, 0x00a154, 0x020094, 0x014094,
+    0x011094, 0x015094, 0x009094, 0x002094, 0x00a094, 0x020124, 0x011124, 0x015124,
+    0x002124, 0x006124, 0x020064, 0x014064, 0x011064, 0x015064, 0x009064, 0x002064,
+    0x00a064, 0x020464, 0x011464, 0x015464, 0x002464, 0x00a464, 0x020164, 0x015164,
+    0x00a164, 0x0200a4, 0x0110a4, 0x0150a4, 0x0020a4, 0x00a0a4, 0x010108, 0x001108,
+    0x011108, 0x020048, 0x014048, 0x008048, 0x011048, 0x015048, 0x009048, 0x002048,
+    0x00a048, 0x011118, 0x020058, 0x014058, 0x011058, 0x015058, 0x009058, 0x002058,
+    0x00a058, 0x020068, 0x011068, 0x015068, 0x002068, 0x00a068, 0x000001, 0x010001,
+    0x050001, 0x020001, 0x004001, 0x014001, 0x001001, 0x041001, 0x011001, 0x005001,
+    0x015001, 0x002001, 0x006001, 0x000401, 0x010401, 0x050401, 0x020401, 0x001401,
+    0x041401, 0x011401, 0x005401, 0x015401, 0x002401, 0x006401, 0x010801, 0x050801,
+    0x001801, 0x041801, 0x011801, 0x080101, 0x010101, 0x050101, 0x020101, 0x004101,
+    0x014101, 0x041101, 0x011101, 0x005101, 0x015101, 0x002101, 0x006101, 0x080501,
+    0x010501, 0x050501, 0x001501, 0x041501, 0x011501, 0x000041, 0x080041, 0x010041,
+    0x050041, 0x020041, 0x004041, 0x014041, 0x008041, 0x001041, 0x041041, 0x011041,
+    0x005041, 0x015041, 0x009041, 0x002041, 0x006041, 0x00a041, 0x010441, 0x050441,
+    0x020441, 0x014441, 0x008441, 0x001441, 0x041441, 0x011441, 0x015441, 0x009441,
+    0x00a441, 0x020141, 0x014141, 0x008141, 0x011141, 0x015141, 0x009141, 0x002141,
+    0x00a141, 0x020081, 0x014081, 0x008081, 0x011081, 0x015081, 0x009081, 0x002081,
+    0x00a081, 0x010011, 0x050011, 0x020011, 0x004011, 0x014011, 0x001011, 0x041011,
+    0x011011, 0x005011, 0x015011, 0x002011, 0x006011, 0x010411, 0x050411, 0x020411,
+    0x001411, 0x041411, 0x011411, 0x005411, 0x015411, 0x002411, 0x006411, 0x050811,
+    0x041811, 0x011811, 0x010111, 0x050111, 0x020111, 0x014111, 0x041111, 0x011111,
+    0x005111, 0x015111, 0x002111, 0x006111, 0x050511, 0x041511, 0x011511, 0x010051,
+    0x050051, 0x020051, 0x014051, 0x008051, 0x001051, 0x041051, 0x011051, 0x005051,
+    0x015051, 0x009051, 0x002051, 0x006051, 0x00a051, 0x050451, 0x020451, 0x014451,
+    0x041451, 0x011451, 0x015451, 0x009451, 0x00a451, 0x020151, 0x014151, 0x011151,
+    0x015151, 0x009151, 0x002151, 0x00a151, 0x020091, 0x014091, 0x011091, 0x015091,
+    0x009091, 0x002091, 0x00a091, 0x020021, 0x014021, 0x011021, 0x005021, 0x015021,
+    0x002021, 0x006021, 0x020421, 0x011421, 0x015421, 0x002421, 0x006421, 0x020121,
+    0x011121, 0x015121, 0x002121, 0x006121, 0x020061, 0x014061, 0x011061, 0x015061,
+    0x009061, 0x002061, 0x006061, 0x00a061, 0x020461, 0x015461, 0x00a461, 0x020161,
+    0x011161, 0x015161, 0x002161, 0x00a161, 0x0200a1, 0x0110a1, 0x0150a1, 0x0020a1,
+    0x00a0a1, 0x000005, 0x010005, 0x020005, 0x004005, 0x014005, 0x001005, 0x011005,
+    0x005005, 0x015005, 0x002005, 0x006005, 0x010405, 0x001405, 0x011405, 0x010105,
+    0x001105, 0x011105, 0x020045, 0x014045, 0x008045, 0x015045, 0x009045, 0x00a045,
+    0x010015, 0x020015, 0x014015, 0x001015, 0x011015, 0x005015, 0x015015, 0x002015,
+    0x006015, 0x011415, 0x011115, 0x020055, 0x014055, 0x015055, 0x009055, 0x00a055,
+    0x020025, 0x011025, 0x015025, 0x002025, 0x006025, 0x020065, 0x015065, 0x00a065,
+    0x010002, 0x020002, 0x004002, 0x014002, 0x011002, 0x005002, 0x015002, 0x002002,
+    0x006002, 0x010402, 0x001402, 0x011402, 0x020042, 0x014042, 0x008042, 0x011042,
+    0x015042, 0x009042, 0x002042, 0x00a042, 0x010012, 0x020012, 0x014012, 0x011012,
+    0x005012, 0x015012, 0x002012, 0x006012, 0x011412, 0x020052, 0x014052, 0x011052,
+    0x015052, 0x009052, 0x002052, 0x00a052, 0x020022, 0x011022, 0x015022, 0x002022,
+    0x006022, 0x020062, 0x011062, 0x015062, 0x002062, 0x00a062,
+  };
+  const genie::SKAmplitudeTerm_t kTermsNP[3288] = {
+    {   0, 0x0000012001ULL, 96.0}, {   1, 0x0000202201ULL, 32.0},
+    {   1, 0x0000402201ULL, 10.666666666666666}, {   1, 0x000020a201ULL, 32.0},
+    {   1, 0x000040a201ULL, 10.666666666666666}, {   1, 0x0000604201ULL, -5.333333333333333},
+    {   1, 0x0040202011ULL, -10.666666666666666}, {   1, 0x004020a011ULL, 5.333333333333333},
+    {   1, 0x0000202002ULL, 32.0}, {   1, 0x0000402002ULL, 10.666666666666666},
+    {   1, 0x000020a002ULL, 32.0}, {   1, 0x000040a002ULL, 10.666666666666666},
+    {   1, 0x0000604002ULL, -5.333333333333333}, {   1, 0x0040202202ULL, -10.666666666666666},
+    {   1, 0x004020a202ULL, -10.666666666666666}, {   1, 0x0040202003ULL, -10.666666666666666},
+    {   1, 0x004020a003ULL, -10.666666666666666}, {   2, 0x004020c201ULL, 5.333333333333333},
+    {   2, 0x000020a011ULL, -48.0}, {   2, 0x004020c002ULL, 5.333333333333333},
+    {   3, 0x0000402211ULL, -16.0}, {   3, 0x0000602211ULL, -10.666666666666666},
+    {   3, 0x0000802211ULL, -1.7777777777777777}, {   3, 0x0000a04211ULL, 1.7777777777777777},
+    {   3, 0x0040402411ULL, -2.6666666666666665}, {   3, 0x0040602411ULL, 1.7777777777777777},
+    {   3, 0x0040402021ULL, -2.6666666666666665}, {   3, 0x0040602021ULL, 1.7777777777777777},
+    {   3, 0x0000402012ULL, -16.0}, {   3, 0x0000602012ULL, -10.666666666666666},
+    {   3, 0x0000802012ULL, -1.7777777777777777}, {   3, 0x0000a04012ULL, 1.7777777777777777},
+    {   3, 0x0040602212ULL, 7.111111111111111}, {   3, 0x0040402013ULL, 2.6666666666666665},
+    {   3, 0x0040602013ULL, 5.333333333333333}, {   4, 0x0000404201ULL, -2.6666666666666665},
+    {   4, 0x0000402211ULL, 2.6666666666666665}, {   4, 0x0000404002ULL, -2.6666666666666665},
+    {   4, 0x0000402012ULL, 2.6666666666666665}, {   5, 0x0000042041ULL, 32.0},
+    {   5, 0x0000082041ULL, -32.0}, {   5, 0x000004a041ULL, 32.0},
+    {   5, 0x000008a041ULL, -32.0}, {   5, 0x0008042011ULL, -32.0},
+    {   5, 0x000804a011ULL, 16.0}, {   5, 0x0000042002ULL, 32.0},
+    {   5, 0x0000082002ULL, -32.0}, {   5, 0x000004a002ULL, 32.0},
+    {   5, 0x000008a002ULL, -32.0}, {   5, 0x0008042042ULL, -32.0},
+    {   5, 0x000804a042ULL, -32.0}, {   5, 0x0008042003ULL, -32.0},
+    {   5, 0x000804a003ULL, -32.0}, {   6, 0x000804c041ULL, 16.0},
+    {   6, 0x000004a011ULL, -48.0}, {   6, 0x000804c002ULL, 16.0},
+    {   7, 0x0000242211ULL, -16.0}, {   7, 0x0000442211ULL, -5.333333333333333},
+    {   7, 0x0000282211ULL, 16.0}, {   7, 0x0000482211ULL, 5.333333333333333},
+    {   7, 0x0000684211ULL, -2.6666666666666665}, {   7, 0x0000242051ULL, -16.0},
+    {   7, 0x0000442051ULL, -5.333333333333333}, {   7, 0x0000282051ULL, 16.0},
+    {   7, 0x0000482051ULL, 5.333333333333333}, {   7, 0x0000684051ULL, -2.6666666666666665},
+    {   7, 0x0040242251ULL, -2.6666666666666665}, {   7, 0x0008242251ULL, -8.0},
+    {   7, 0x0008442251ULL, 5.333333333333333}, {   7, 0x0040282251ULL, -5.333333333333333},
+    {   7, 0x0040242021ULL, -2.6666666666666665}, {   7, 0x0008242021ULL, -8.0},
+    {   7, 0x0008442021ULL, 5.333333333333333}, {   7, 0x0040282021ULL, -5.333333333333333},
+    {   7, 0x0000242012ULL, -32.0}, {   7, 0x0000442012ULL, -10.666666666666666},
+    {   7, 0x0000282012ULL, 32.0}, {   7, 0x0000482012ULL, 10.666666666666666},
+    {   7, 0x0000684012ULL, -5.333333333333333}, {   7, 0x0040242212ULL, 2.6666666666666665},
+    {   7, 0x0008242212ULL, -8.0}, {   7, 0x0008442212ULL, 10.666666666666666},
+    {   7, 0x0040282212ULL, -10.666666666666666}, {   7, 0x0040242052ULL, -2.6666666666666665},
+    {   7, 0x0008242052ULL, 8.0}, {   7, 0x0008442052ULL, 10.666666666666666},
+    {   7, 0x0040282052ULL, -10.666666666666666}, {   7, 0x0040242013ULL, 2.6666666666666665},
+    {   7, 0x0008242013ULL, 8.0}, {   7, 0x0008442013ULL, 16.0},
+    {   7, 0x0040282013ULL, -16.0}, {   8, 0x0000084041ULL, 24.0},
+    {   8, 0x0000082051ULL, -8.0}, {   8, 0x0000084002ULL, 24.0},
+    {   8, 0x0000082012ULL, -8.0}, {   9, 0x0000484211ULL, -2.6666666666666665},
+    {   9, 0x0000484051ULL, -2.6666666666666665}, {   9, 0x0000484012ULL, -5.333333333333333},
+    {  10, 0x0000082051ULL, -16.0}, {  10, 0x00000c2051ULL, 32.0},
+    {  10, 0x0000102051ULL, -16.0}, {  10, 0x0008082091ULL, -8.0},
+    {  10, 0x00080c2091ULL, -16.0}, {  10, 0x0008082021ULL, -8.0},
+    {  10, 0x00080c2021ULL, -16.0}, {  10, 0x0000082012ULL, -16.0},
+    {  10, 0x00000c2012ULL, 32.0}, {  10, 0x0000102012ULL, -16.0},
+    {  10, 0x00080c2052ULL, -64.0}, {  10, 0x0008082013ULL, 8.0},
+    {  10, 0x00080c2013ULL, -48.0}, {  11, 0x0000104051ULL, 16.0},
+    {  11, 0x0000104012ULL, 16.0}, {  12, 0x0000010001ULL, 128.0},
+    {  13, 0x0000400201ULL, 21.333333333333332}, {  13, 0x0000208201ULL, 64.0},
+    {  13, 0x0000602201ULL, -10.666666666666666}, {  13, 0x0000400002ULL, 21.333333333333332},
+    {  13, 0x0000208002ULL, 64.0}, {  13, 0x0000602002ULL, -10.666666666666666},
+    {  14, 0x004020a201ULL, 10.666666666666666}, {  14, 0x0000208011ULL, -64.0},
+    {  14, 0x004020a002ULL, 10.666666666666666}, {  15, 0x0000400211ULL, -32.0},
+    {  15, 0x0000800211ULL, -3.5555555555555554}, {  15, 0x0000a02211ULL, 3.5555555555555554},
+    {  15, 0x0000400012ULL, -32.0}, {  15, 0x0000800012ULL, -3.5555555555555554},
+    {  15, 0x0000a02012ULL, 3.5555555555555554}, {  16, 0x0000402201ULL, -5.333333333333333},
+    {  16, 0x0000402002ULL, -5.333333333333333}, {  17, 0x0000080041ULL, -64.0},
+    {  17, 0x0000048041ULL, 64.0}, {  17, 0x0000080002ULL, -64.0},
+    {  17, 0x0000048002ULL, 64.0}, {  18, 0x000804a041ULL, 32.0},
+    {  18, 0x0000048011ULL, -64.0}, {  18, 0x000804a002ULL, 32.0},
+    {  19, 0x0000240211ULL, -32.0}, {  19, 0x0000480211ULL, 10.666666666666666},
+    {  19, 0x0000682211ULL, -5.333333333333333}, {  19, 0x0000240051ULL, -32.0},
+    {  19, 0x0000480051ULL, 10.666666666666666}, {  19, 0x0000682051ULL, -5.333333333333333},
+    {  19, 0x0000240012ULL, -64.0}, {  19, 0x0000480012ULL, 21.333333333333332},
+    {  19, 0x0000682012ULL, -10.666666666666666}, {  20, 0x0000082041ULL, 48.0},
+    {  20, 0x0000082002ULL, 48.0}, {  21, 0x0000482211ULL, -5.333333333333333},
+    {  21, 0x0000482051ULL, -5.333333333333333}, {  21, 0x0000482012ULL, -10.666666666666666},
+    {  22, 0x0000080051ULL, -32.0}, {  22, 0x0000100051ULL, -32.0},
+    {  22, 0x0000080012ULL, -32.0}, {  22, 0x0000100012ULL, -32.0},
+    {  23, 0x0000102051ULL, 32.0}, {  23, 0x0000102012ULL, 32.0},
+    {  24, 0x0000602201ULL, 10.666666666666666}, {  24, 0x0000602002ULL, 10.666666666666666},
+    {  25, 0x004020a201ULL, 10.666666666666666}, {  25, 0x004020a002ULL, 10.666666666666666},
+    {  26, 0x0080402211ULL, 3.5555555555555554}, {  26, 0x0000a02211ULL, -3.5555555555555554},
+    {  26, 0x0080402012ULL, 3.5555555555555554}, {  26, 0x0000a02012ULL, -3.5555555555555554},
+    {  27, 0x0000402201ULL, 5.333333333333333}, {  27, 0x0000402002ULL, 5.333333333333333},
+    {  28, 0x000804a041ULL, 32.0}, {  28, 0x000804a002ULL, 32.0},
+    {  29, 0x0048242211ULL, 10.666666666666666}, {  29, 0x0000682211ULL, 5.333333333333333},
+    {  29, 0x0048242051ULL, 10.666666666666666}, {  29, 0x0000682051ULL, 5.333333333333333},
+    {  29, 0x0048242012ULL, 21.333333333333332}, {  29, 0x0000682012ULL, 10.666666666666666},
+    {  30, 0x0000082041ULL, -48.0}, {  30, 0x0000082002ULL, -48.0},
+    {  31, 0x0000482211ULL, 5.333333333333333}, {  31, 0x0000482051ULL, 5.333333333333333},
+    {  31, 0x0000482012ULL, 10.666666666666666}, {  32, 0x0010082051ULL, 32.0},
+    {  32, 0x0010082012ULL, 32.0}, {  33, 0x0000102051ULL, -32.0},
+    {  33, 0x0000102012ULL, -32.0}, {  34, 0x0000000002ULL, -32.0},
+    {  34, 0x0000010002ULL, 32.0}, {  35, 0x0000012001ULL, 32.0},
+    {  35, 0x0000010011ULL, -64.0}, {  36, 0x004020a011ULL, 16.0},
+    {  36, 0x0000602211ULL, 5.333333333333333}, {  36, 0x0000400012ULL, 10.666666666666666},
+    {  36, 0x0000208012ULL, -32.0}, {  36, 0x0000602012ULL, 5.333333333333333},
+    {  37, 0x000020a011ULL, -16.0}, {  37, 0x004020a211ULL, -10.666666666666666},
+    {  37, 0x0000208021ULL, 32.0}, {  37, 0x004020a012ULL, -10.666666666666666},
+    {  38, 0x0040402411ULL, -8.0}, {  38, 0x0040402021ULL, -8.0},
+    {  38, 0x0080402221ULL, 0.8888888888888888}, {  38, 0x0000a02221ULL, -1.7777777777777777},
+    {  38, 0x0000c04221ULL, 0.8888888888888888}, {  38, 0x0040402212ULL, -16.0},
+    {  38, 0x0000400412ULL, 8.0}, {  38, 0x0000800412ULL, -0.8888888888888888},
+    {  38, 0x0080402412ULL, 1.7777777777777777}, {  38, 0x0000a02412ULL, -1.7777777777777777},
+    {  38, 0x0000c04412ULL, 0.8888888888888888}, {  38, 0x0000400022ULL, 8.0},
+    {  38, 0x0000800022ULL, -0.8888888888888888}, {  38, 0x0080402022ULL, 1.7777777777777777},
+    {  38, 0x0000a02022ULL, -1.7777777777777777}, {  38, 0x0000c04022ULL, 0.8888888888888888},
+    {  38, 0x0040402013ULL, -8.0}, {  38, 0x0000400213ULL, 16.0},
+    {  38, 0x0000800213ULL, -1.7777777777777777}, {  38, 0x0080402213ULL, 3.5555555555555554},
+    {  38, 0x0000a02213ULL, -3.5555555555555554}, {  38, 0x0000c04213ULL, 1.7777777777777777},
+    {  38, 0x0000400014ULL, 8.0}, {  38, 0x0000800014ULL, -0.8888888888888888},
+    {  38, 0x0080402014ULL, 1.7777777777777777}, {  38, 0x0000a02014ULL, -1.7777777777777777},
+    {  38, 0x0000c04014ULL, 0.8888888888888888}, {  39, 0x0000402211ULL, 5.333333333333333},
+    {  39, 0x0000604211ULL, -5.333333333333333}, {  39, 0x0000402012ULL, 5.333333333333333},
+    {  39, 0x0000604012ULL, -5.333333333333333}, {  40, 0x000804a011ULL, 48.0},
+    {  40, 0x0000080012ULL, -32.0}, {  40, 0x0000048012ULL, -32.0},
+    {  41, 0x000004a011ULL, -16.0}, {  41, 0x000804a051ULL, -32.0},
+    {  41, 0x0000048021ULL, 32.0}, {  41, 0x000804a012ULL, -32.0},
+    {  42, 0x0040242251ULL, -8.0}, {  42, 0x0008242251ULL, -24.0},
+    {  42, 0x0040242021ULL, -8.0}, {  42, 0x0008242021ULL, -24.0},
+    {  42, 0x0048242221ULL, 2.6666666666666665}, {  42, 0x0000682221ULL, 2.6666666666666665},
+    {  42, 0x0048242061ULL, 2.6666666666666665}, {  42, 0x0000682061ULL, 2.6666666666666665},
+    {  42, 0x0040242212ULL, -8.0}, {  42, 0x0008242212ULL, -24.0},
+    {  42, 0x0040242052ULL, -8.0}, {  42, 0x0008242052ULL, -24.0},
+    {  42, 0x0000240252ULL, 16.0}, {  42, 0x0000480252ULL, 5.333333333333333},
+    {  42, 0x0048242252ULL, 10.666666666666666}, {  42, 0x0000682252ULL, 5.333333333333333},
+    {  42, 0x0000240022ULL, 16.0}, {  42, 0x0000480022ULL, 5.333333333333333},
+    {  42, 0x0048242022ULL, 10.666666666666666}, {  42, 0x0000682022ULL, 5.333333333333333},
+    {  42, 0x0040242013ULL, -8.0}, {  42, 0x0008242013ULL, -24.0},
+    {  42, 0x0000240213ULL, 16.0}, {  42, 0x0000480213ULL, 5.333333333333333},
+    {  42, 0x0048242213ULL, 10.666666666666666}, {  42, 0x0000682213ULL, 5.333333333333333},
+    {  42, 0x0000240053ULL, 16.0}, {  42, 0x0000480053ULL, 5.333333333333333},
+    {  42, 0x0048242053ULL, 10.666666666666666}, {  42, 0x0000682053ULL, 5.333333333333333},
+    {  42, 0x0000240014ULL, 16.0}, {  42, 0x0000480014ULL, 5.333333333333333},
+    {  42, 0x0048242014ULL, 10.666666666666666}, {  42, 0x0000682014ULL, 5.333333333333333},
+    {  43, 0x0000082051ULL, -32.0}, {  43, 0x0000082012ULL, -32.0},
+    {  44, 0x0000482221ULL, 2.6666666666666665}, {  44, 0x0000684221ULL, -2.6666666666666665},
+    {  44, 0x0000482061ULL, 2.6666666666666665}, {  44, 0x0000684061ULL, -2.6666666666666665},
+    {  44, 0x0000482252ULL, 5.333333333333333}, {  44, 0x0000684252ULL, -5.333333333333333},
+    {  44, 0x0000482022ULL, 5.333333333333333}, {  44, 0x0000684022ULL, -5.333333333333333},
+    {  44, 0x0000482213ULL, 5.333333333333333}, {  44, 0x0000684213ULL, -5.333333333333333},
+    {  44, 0x0000482053ULL, 5.333333333333333}, {  44, 0x0000684053ULL, -5.333333333333333},
+    {  44, 0x0000482014ULL, 5.333333333333333}, {  44, 0x0000684014ULL, -5.333333333333333},
+    {  45, 0x0000084051ULL, 16.0}, {  45, 0x0000084012ULL, 16.0},
+    {  46, 0x0008082091ULL, -24.0}, {  46, 0x0008082021ULL, -24.0},
+    {  46, 0x0010082061ULL, 8.0}, {  46, 0x0008082052ULL, -48.0},
+    {  46, 0x0000080092ULL, 8.0}, {  46, 0x0000100092ULL, -8.0},
+    {  46, 0x0010082092ULL, 16.0}, {  46, 0x0000080022ULL, 8.0},
+    {  46, 0x0000100022ULL, -8.0}, {  46, 0x0010082022ULL, 16.0},
+    {  46, 0x0008082013ULL, -24.0}, {  46, 0x0000080053ULL, 16.0},
+    {  46, 0x0000100053ULL, -16.0}, {  46, 0x0010082053ULL, 32.0},
+    {  46, 0x0000080014ULL, 8.0}, {  46, 0x0000100014ULL, -8.0},
+    {  46, 0x0010082014ULL, 16.0}, {  47, 0x0000102061ULL, -16.0},
+    {  47, 0x0000102092ULL, -16.0}, {  47, 0x0000102022ULL, -16.0},
+    {  47, 0x0000102053ULL, -32.0}, {  47, 0x0000102014ULL, -16.0},
+    {  48, 0x0000104061ULL, 8.0}, {  48, 0x0000104092ULL, 8.0},
+    {  48, 0x0000104022ULL, 8.0}, {  48, 0x0000104053ULL, 16.0},
+    {  48, 0x0000104014ULL, 8.0}, {  49, 0x0000200201ULL, -32.0},
+    {  49, 0x0000400201ULL, 10.666666666666666}, {  49, 0x0000208201ULL, 32.0},
+    {  49, 0x0000408201ULL, -10.666666666666666}, {  49, 0x0040200011ULL, 10.666666666666666},
+    {  49, 0x0040208011ULL, 10.666666666666666}, {  49, 0x0000200002ULL, -32.0},
+    {  49, 0x0000400002ULL, 10.666666666666666}, {  49, 0x0000208002ULL, 32.0},
+    {  49, 0x0000408002ULL, -10.666666666666666}, {  49, 0x0040200202ULL, 10.666666666666666},
+    {  49, 0x0040208202ULL, -10.666666666666666}, {  49, 0x0040200003ULL, 10.666666666666666},
+    {  49, 0x0040208003ULL, -10.666666666666666}, {  50, 0x004020a201ULL, -5.333333333333333},
+    {  50, 0x004020a002ULL, -5.333333333333333}, {  51, 0x0000400211ULL, -16.0},
+    {  51, 0x0000600211ULL, 10.666666666666666}, {  51, 0x0000800211ULL, -1.7777777777777777},
+    {  51, 0x0080402211ULL, -2.6666666666666665}, {  51, 0x0000c04211ULL, -0.8888888888888888},
+    {  51, 0x0040400411ULL, -5.333333333333333}, {  51, 0x0040600411ULL, -1.7777777777777777},
+    {  51, 0x0040400021ULL, -5.333333333333333}, {  51, 0x0040600021ULL, -1.7777777777777777},
+    {  51, 0x0000400012ULL, -16.0}, {  51, 0x0000600012ULL, 10.666666666666666},
+    {  51, 0x0000800012ULL, -1.7777777777777777}, {  51, 0x0080402012ULL, -2.6666666666666665},
+    {  51, 0x0000c04012ULL, -0.8888888888888888}, {  51, 0x0040600212ULL, -7.111111111111111},
+    {  51, 0x0040400013ULL, 5.333333333333333}, {  51, 0x0040600013ULL, -5.333333333333333},
+    {  52, 0x0000604201ULL, 2.6666666666666665}, {  52, 0x0000602211ULL, -2.6666666666666665},
+    {  52, 0x0000604002ULL, 2.6666666666666665}, {  52, 0x0000602012ULL, -2.6666666666666665},
+    {  53, 0x0000040041ULL, -32.0}, {  53, 0x0000080041ULL, -32.0},
+    {  53, 0x0000048041ULL, 32.0}, {  53, 0x0000088041ULL, 32.0},
+    {  53, 0x0008040011ULL, 32.0}, {  53, 0x0008048011ULL, 32.0},
+    {  53, 0x0000040002ULL, -32.0}, {  53, 0x0000080002ULL, -32.0},
+    {  53, 0x0000048002ULL, 32.0}, {  53, 0x0000088002ULL, 32.0},
+    {  53, 0x0008040042ULL, 32.0}, {  53, 0x0008048042ULL, -32.0},
+    {  53, 0x0008040003ULL, 32.0}, {  53, 0x0008048003ULL, -32.0},
+    {  54, 0x000804a041ULL, -16.0}, {  54, 0x000804a002ULL, -16.0},
+    {  55, 0x0000240211ULL, -16.0}, {  55, 0x0000440211ULL, 5.333333333333333},
+    {  55, 0x0000280211ULL, -16.0}, {  55, 0x0000480211ULL, 5.333333333333333},
+    {  55, 0x0048242211ULL, -8.0}, {  55, 0x0000240051ULL, -16.0},
+    {  55, 0x0000440051ULL, 5.333333333333333}, {  55, 0x0000280051ULL, -16.0},
+    {  55, 0x0000480051ULL, 5.333333333333333}, {  55, 0x0048242051ULL, -8.0},
+    {  55, 0x0040240251ULL, -5.333333333333333}, {  55, 0x0008240251ULL, -16.0},
+    {  55, 0x0008440251ULL, -5.333333333333333}, {  55, 0x0040280251ULL, 5.333333333333333},
+    {  55, 0x0040240021ULL, -5.333333333333333}, {  55, 0x0008240021ULL, -16.0},
+    {  55, 0x0008440021ULL, -5.333333333333333}, {  55, 0x0040280021ULL, 5.333333333333333},
+    {  55, 0x0000240012ULL, -32.0}, {  55, 0x0000440012ULL, 10.666666666666666},
+    {  55, 0x0000280012ULL, -32.0}, {  55, 0x0000480012ULL, 10.666666666666666},
+    {  55, 0x0048242012ULL, -16.0}, {  55, 0x0008440212ULL, -10.666666666666666},
+    {  55, 0x0040280212ULL, 10.666666666666666}, {  55, 0x0008440052ULL, -10.666666666666666},
+    {  55, 0x0040280052ULL, 10.666666666666666}, {  55, 0x0040240013ULL, 5.333333333333333},
+    {  55, 0x0008240013ULL, 16.0}, {  55, 0x0008440013ULL, -16.0},
+    {  55, 0x0040280013ULL, 16.0}, {  56, 0x0000684211ULL, 2.6666666666666665},
+    {  56, 0x0000684051ULL, 2.6666666666666665}, {  56, 0x0000684012ULL, 5.333333333333333},
+    {  57, 0x0000084041ULL, -8.0}, {  57, 0x0000082051ULL, 8.0},
+    {  57, 0x0000084002ULL, -8.0}, {  57, 0x0000082012ULL, 8.0},
+    {  58, 0x0000080051ULL, -16.0}, {  58, 0x00000c0051ULL, -32.0},
+    {  58, 0x0000100051ULL, -16.0}, {  58, 0x0010082051ULL, -24.0},
+    {  58, 0x0008080091ULL, -16.0}, {  58, 0x00080c0091ULL, 16.0},
+    {  58, 0x0008080021ULL, -16.0}, {  58, 0x00080c0021ULL, 16.0},
+    {  58, 0x0000080012ULL, -16.0}, {  58, 0x00000c0012ULL, -32.0},
+    {  58, 0x0000100012ULL, -16.0}, {  58, 0x0010082012ULL, -24.0},
+    {  58, 0x00080c0052ULL, 64.0}, {  58, 0x0008080013ULL, 16.0},
+    {  58, 0x00080c0013ULL, 48.0}, {  59, 0x0000104051ULL, -8.0},
+    {  59, 0x0000104012ULL, -8.0}, {  60, 0x0080400211ULL, -3.5555555555555554},
+    {  60, 0x0000c02211ULL, -1.7777777777777777}, {  60, 0x0080400012ULL, -3.5555555555555554},
+    {  60, 0x0000c02012ULL, -1.7777777777777777}, {  61, 0x0000602201ULL, 5.333333333333333},
+    {  61, 0x0000602002ULL, 5.333333333333333}, {  62, 0x0048240211ULL, -10.666666666666666},
+    {  62, 0x0048240051ULL, -10.666666666666666}, {  62, 0x0048240012ULL, -21.333333333333332},
+    {  63, 0x0000682211ULL, 5.333333333333333}, {  63, 0x0000682051ULL, 5.333333333333333},
+    {  63, 0x0000682012ULL, 10.666666666666666}, {  64, 0x0000082041ULL, -16.0},
+    {  64, 0x0000082002ULL, -16.0}, {  65, 0x0010080051ULL, -32.0},
+    {  65, 0x0010080012ULL, -32.0}, {  66, 0x0000102051ULL, -16.0},
+    {  66, 0x0000102012ULL, -16.0}, {  67, 0x0000200201ULL, -32.0},
+    {  67, 0x0000400201ULL, -10.666666666666666}, {  67, 0x0000208201ULL, -32.0},
+    {  67, 0x0000408201ULL, -10.666666666666666}, {  67, 0x0000602201ULL, 10.666666666666666},
+    {  67, 0x0040200011ULL, 10.666666666666666}, {  67, 0x0040208011ULL, -10.666666666666666},
+    {  67, 0x0000200002ULL, -32.0}, {  67, 0x0000400002ULL, -10.666666666666666},
+    {  67, 0x0000208002ULL, -32.0}, {  67, 0x0000408002ULL, -10.666666666666666},
+    {  67, 0x0000602002ULL, 10.666666666666666}, {  67, 0x0040200202ULL, 10.666666666666666},
+    {  67, 0x0040208202ULL, 10.666666666666666}, {  67, 0x0040200003ULL, 10.666666666666666},
+    {  67, 0x0040208003ULL, 10.666666666666666}, {  68, 0x004020a201ULL, -5.333333333333333},
+    {  68, 0x004020a002ULL, -5.333333333333333}, {  69, 0x0000400211ULL, 16.0},
+    {  69, 0x0000600211ULL, 10.666666666666666}, {  69, 0x0000800211ULL, 1.7777777777777777},
+    {  69, 0x0080402211ULL, 2.6666666666666665}, {  69, 0x0000a02211ULL, -3.5555555555555554},
+    {  69, 0x0000c04211ULL, 0.8888888888888888}, {  69, 0x0040400411ULL, 5.333333333333333},
+    {  69, 0x0040600411ULL, -1.7777777777777777}, {  69, 0x0040400021ULL, 5.333333333333333},
+    {  69, 0x0040600021ULL, -1.7777777777777777}, {  69, 0x0000400012ULL, 16.0},
+    {  69, 0x0000600012ULL, 10.666666666666666}, {  69, 0x0000800012ULL, 1.7777777777777777},
+    {  69, 0x0080402012ULL, 2.6666666666666665}, {  69, 0x0000a02012ULL, -3.5555555555555554},
+    {  69, 0x0000c04012ULL, 0.8888888888888888}, {  69, 0x0040600212ULL, -7.111111111111111},
+    {  69, 0x0040400013ULL, -5.333333333333333}, {  69, 0x0040600013ULL, -5.333333333333333},
+    {  70, 0x0000402201ULL, 5.333333333333333}, {  70, 0x0000604201ULL, -2.6666666666666665},
+    {  70, 0x0000602211ULL, 2.6666666666666665}, {  70, 0x0000402002ULL, 5.333333333333333},
+    {  70, 0x0000604002ULL, -2.6666666666666665}, {  70, 0x0000602012ULL, 2.6666666666666665},
+    {  71, 0x0000040041ULL, -32.0}, {  71, 0x0000080041ULL, 32.0},
+    {  71, 0x0000048041ULL, -32.0}, {  71, 0x0000088041ULL, 32.0},
+    {  71, 0x0008040011ULL, 32.0}, {  71, 0x0008048011ULL, -32.0},
+    {  71, 0x0000040002ULL, -32.0}, {  71, 0x0000080002ULL, 32.0},
+    {  71, 0x0000048002ULL, -32.0}, {  71, 0x0000088002ULL, 32.0},
+    {  71, 0x0008040042ULL, 32.0}, {  71, 0x0008048042ULL, 32.0},
+    {  71, 0x0008040003ULL, 32.0}, {  71, 0x0008048003ULL, 32.0},
+    {  72, 0x000804a041ULL, -16.0}, {  72, 0x000804a002ULL, -16.0},
+    {  73, 0x0000240211ULL, 16.0}, {  73, 0x0000440211ULL, 5.333333333333333},
+    {  73, 0x0000280211ULL, -16.0}, {  73, 0x0000480211ULL, -5.333333333333333},
+    {  73, 0x0048242211ULL, 8.0}, {  73, 0x0000682211ULL, 5.333333333333333},
+    {  73, 0x0000240051ULL, 16.0}, {  73, 0x0000440051ULL, 5.333333333333333},
+    {  73, 0x0000280051ULL, -16.0}, {  73, 0x0000480051ULL, -5.333333333333333},
+    {  73, 0x0048242051ULL, 8.0}, {  73, 0x0000682051ULL, 5.333333333333333},
+    {  73, 0x0040240251ULL, 5.333333333333333}, {  73, 0x0008240251ULL, 16.0},
+    {  73, 0x0008440251ULL, -5.333333333333333}, {  73, 0x0040280251ULL, 5.333333333333333},
+    {  73, 0x0040240021ULL, 5.333333333333333}, {  73, 0x0008240021ULL, 16.0},
+    {  73, 0x0008440021ULL, -5.333333333333333}, {  73, 0x0040280021ULL, 5.333333333333333},
+    {  73, 0x0000240012ULL, 32.0}, {  73, 0x0000440012ULL, 10.666666666666666},
+    {  73, 0x0000280012ULL, -32.0}, {  73, 0x0000480012ULL, -10.666666666666666},
+    {  73, 0x0048242012ULL, 16.0}, {  73, 0x0000682012ULL, 10.666666666666666},
+    {  73, 0x0008440212ULL, -10.666666666666666}, {  73, 0x0040280212ULL, 10.666666666666666},
+    {  73, 0x0008440052ULL, -10.666666666666666}, {  73, 0x0040280052ULL, 10.666666666666666},
+    {  73, 0x0040240013ULL, -5.333333333333333}, {  73, 0x0008240013ULL, -16.0},
+    {  73, 0x0008440013ULL, -16.0}, {  73, 0x0040280013ULL, 16.0},
+    {  74, 0x0000082041ULL, -48.0}, {  74, 0x0000082002ULL, -48.0},
+    {  75, 0x0000482211ULL, 5.333333333333333}, {  75, 0x0000684211ULL, -2.6666666666666665},
+    {  75, 0x0000482051ULL, 5.333333333333333}, {  75, 0x0000684051ULL, -2.6666666666666665},
+    {  75, 0x0000482012ULL, 10.666666666666666}, {  75, 0x0000684012ULL, -5.333333333333333},
+    {  76, 0x0000084041ULL, 8.0}, {  76, 0x0000082051ULL, -8.0},
+    {  76, 0x0000084002ULL, 8.0}, {  76, 0x0000082012ULL, -8.0},
+    {  77, 0x0000080051ULL, 16.0}, {  77, 0x00000c0051ULL, -32.0},
+    {  77, 0x0000100051ULL, 16.0}, {  77, 0x0010082051ULL, 24.0},
+    {  77, 0x0008080091ULL, 16.0}, {  77, 0x00080c0091ULL, 16.0},
+    {  77, 0x0008080021ULL, 16.0}, {  77, 0x00080c0021ULL, 16.0},
+    {  77, 0x0000080012ULL, 16.0}, {  77, 0x00000c0012ULL, -32.0},
+    {  77, 0x0000100012ULL, 16.0}, {  77, 0x0010082012ULL, 24.0},
+    {  77, 0x00080c0052ULL, 64.0}, {  77, 0x0008080013ULL, -16.0},
+    {  77, 0x00080c0013ULL, 48.0}, {  78, 0x0000102051ULL, -32.0},
+    {  78, 0x0000102012ULL, -32.0}, {  79, 0x0000104051ULL, 8.0},
+    {  79, 0x0000104012ULL, 8.0}, {  80, 0x0040208201ULL, -42.666666666666664},
+    {  80, 0x0040208002ULL, -42.666666666666664}, {  81, 0x0000c02211ULL, 3.5555555555555554},
+    {  81, 0x0000c02012ULL, 3.5555555555555554}, {  82, 0x0000602201ULL, -10.666666666666666},
+    {  82, 0x0000602002ULL, -10.666666666666666}, {  83, 0x0008048041ULL, -128.0},
+    {  83, 0x0008048002ULL, -128.0}, {  84, 0x0000682211ULL, -10.666666666666666},
+    {  84, 0x0000682051ULL, -10.666666666666666}, {  84, 0x0000682012ULL, -21.333333333333332},
+    {  85, 0x0000082041ULL, 32.0}, {  85, 0x0000082002ULL, 32.0},
+    {  86, 0x0000102051ULL, 32.0}, {  86, 0x0000102012ULL, 32.0},
+    {  87, 0x0080400211ULL, -3.5555555555555554}, {  87, 0x0000c02211ULL, -1.7777777777777777},
+    {  87, 0x0080400012ULL, -3.5555555555555554}, {  87, 0x0000c02012ULL, -1.7777777777777777},
+    {  88, 0x0000602201ULL, 5.333333333333333}, {  88, 0x0000602002ULL, 5.333333333333333},
+    {  89, 0x0048240211ULL, -10.666666666666666}, {  89, 0x0048240051ULL, -10.666666666666666},
+    {  89, 0x0048240012ULL, -21.333333333333332}, {  90, 0x0000682211ULL, 5.333333333333333},
+    {  90, 0x0000682051ULL, 5.333333333333333}, {  90, 0x0000682012ULL, 10.666666666666666},
+    {  91, 0x0000082041ULL, -16.0}, {  91, 0x0000082002ULL, -16.0},
+    {  92, 0x0010080051ULL, -32.0}, {  92, 0x0010080012ULL, -32.0},
+    {  93, 0x0000102051ULL, -16.0}, {  93, 0x0000102012ULL, -16.0},
+    {  94, 0x0040208011ULL, -21.333333333333332}, {  95, 0x0040208211ULL, 21.333333333333332},
+    {  95, 0x0040208012ULL, 21.333333333333332}, {  96, 0x0040400411ULL, 10.666666666666666},
+    {  96, 0x0040400021ULL, 10.666666666666666}, {  96, 0x0000c02221ULL, -1.7777777777777777},
+    {  96, 0x0040400212ULL, 21.333333333333332}, {  96, 0x0080400412ULL, -1.7777777777777777},
+    {  96, 0x0000c02412ULL, -1.7777777777777777}, {  96, 0x0080400022ULL, -1.7777777777777777},
+    {  96, 0x0000c02022ULL, -1.7777777777777777}, {  96, 0x0040400013ULL, 10.666666666666666},
+    {  96, 0x0080400213ULL, -3.5555555555555554}, {  96, 0x0000c02213ULL, -3.5555555555555554},
+    {  96, 0x0080400014ULL, -1.7777777777777777}, {  96, 0x0000c02014ULL, -1.7777777777777777},
+    {  97, 0x0000602211ULL, 10.666666666666666}, {  97, 0x0000602012ULL, 10.666666666666666},
+    {  98, 0x0008048011ULL, -64.0}, {  99, 0x0008048051ULL, 64.0},
+    {  99, 0x0008048012ULL, 64.0}, { 100, 0x0040240251ULL, 10.666666666666666},
+    { 100, 0x0008240251ULL, 32.0}, { 100, 0x0040240021ULL, 10.666666666666666},
+    { 100, 0x0008240021ULL, 32.0}, { 100, 0x0040240212ULL, 10.666666666666666},
+    { 100, 0x0008240212ULL, 32.0}, { 100, 0x0040240052ULL, 10.666666666666666},
+    { 100, 0x0008240052ULL, 32.0}, { 100, 0x0048240252ULL, -10.666666666666666},
+    { 100, 0x0048240022ULL, -10.666666666666666}, { 100, 0x0040240013ULL, 10.666666666666666},
+    { 100, 0x0008240013ULL, 32.0}, { 100, 0x0048240213ULL, -10.666666666666666},
+    { 100, 0x0048240053ULL, -10.666666666666666}, { 100, 0x0048240014ULL, -10.666666666666666},
+    { 101, 0x0000682221ULL, 5.333333333333333}, { 101, 0x0000682061ULL, 5.333333333333333},
+    { 101, 0x0000682252ULL, 10.666666666666666}, { 101, 0x0000682022ULL, 10.666666666666666},
+    { 101, 0x0000682213ULL, 10.666666666666666}, { 101, 0x0000682053ULL, 10.666666666666666},
+    { 101, 0x0000682014ULL, 10.666666666666666}, { 102, 0x0000082051ULL, -32.0},
+    { 102, 0x0000082012ULL, -32.0}, { 103, 0x0008080091ULL, 32.0},
+    { 103, 0x0008080021ULL, 32.0}, { 103, 0x0008080052ULL, 64.0},
+    { 103, 0x0010080092ULL, -16.0}, { 103, 0x0010080022ULL, -16.0},
+    { 103, 0x0008080013ULL, 32.0}, { 103, 0x0010080053ULL, -32.0},
+    { 103, 0x0010080014ULL, -16.0}, { 104, 0x0000102061ULL, -16.0},
+    { 104, 0x0000102092ULL, -16.0}, { 104, 0x0000102022ULL, -16.0},
+    { 104, 0x0000102053ULL, -32.0}, { 104, 0x0000102014ULL, -16.0},
+    { 105, 0x0080400211ULL, 3.5555555555555554}, { 105, 0x0000c02211ULL, 1.7777777777777777},
+    { 105, 0x0080400012ULL, 3.5555555555555554}, { 105, 0x0000c02012ULL, 1.7777777777777777},
+    { 106, 0x0000602201ULL, -5.333333333333333}, { 106, 0x0000602002ULL, -5.333333333333333},
+    { 107, 0x0048240211ULL, 10.666666666666666}, { 107, 0x0048240051ULL, 10.666666666666666},
+    { 107, 0x0048240012ULL, 21.333333333333332}, { 108, 0x0000682211ULL, -5.333333333333333},
+    { 108, 0x0000682051ULL, -5.333333333333333}, { 108, 0x0000682012ULL, -10.666666666666666},
+    { 109, 0x0000082041ULL, 16.0}, { 109, 0x0000082002ULL, 16.0},
+    { 110, 0x0010080051ULL, 32.0}, { 110, 0x0010080012ULL, 32.0},
+    { 111, 0x0000102051ULL, 16.0}, { 111, 0x0000102012ULL, 16.0},
+    { 112, 0x0080400211ULL, -3.5555555555555554}, { 112, 0x0000c02211ULL, -1.7777777777777777},
+    { 112, 0x0080400012ULL, -3.5555555555555554}, { 112, 0x0000c02012ULL, -1.7777777777777777},
+    { 113, 0x0000602201ULL, 5.333333333333333}, { 113, 0x0000602002ULL, 5.333333333333333},
+    { 114, 0x0048240211ULL, -10.666666666666666}, { 114, 0x0048240051ULL, -10.666666666666666},
+    { 114, 0x0048240012ULL, -21.333333333333332}, { 115, 0x0000682211ULL, 5.333333333333333},
+    { 115, 0x0000682051ULL, 5.333333333333333}, { 115, 0x0000682012ULL, 10.666666666666666},
+    { 116, 0x0000082041ULL, -16.0}, { 116, 0x0000082002ULL, -16.0},
+    { 117, 0x0010080051ULL, -32.0}, { 117, 0x0010080012ULL, -32.0},
+    { 118, 0x0000102051ULL, -16.0}, { 118, 0x0000102012ULL, -16.0},
+    { 119, 0x0000012001ULL, -64.0}, { 120, 0x0040202201ULL, -10.666666666666666},
+    { 120, 0x004020a201ULL, 10.666666666666666}, { 120, 0x0040202002ULL, 10.666666666666666},
+    { 121, 0x000020a201ULL, -64.0}, { 121, 0x000040a201ULL, -10.666666666666666},
+    { 121, 0x000020a002ULL, 32.0}, { 121, 0x000040a002ULL, -10.666666666666666},
+    { 122, 0x0000402401ULL, -16.0}, { 122, 0x0000602401ULL, -10.666666666666666},
+    { 122, 0x0000802401ULL, -1.7777777777777777}, { 122, 0x0000a04401ULL, 1.7777777777777777},
+    { 122, 0x0040402211ULL, -5.333333333333333}, { 122, 0x0040602211ULL, 3.5555555555555554},
+    { 122, 0x0040402402ULL, 5.333333333333333}, { 122, 0x0040602402ULL, 3.5555555555555554},
+    { 122, 0x0040402012ULL, 5.333333333333333}, { 122, 0x0040602012ULL, -3.5555555555555554},
+    { 122, 0x0000402003ULL, 16.0}, { 122, 0x0000602003ULL, 10.666666666666666},
+    { 122, 0x0000802003ULL, 1.7777777777777777}, { 122, 0x0000a04003ULL, -1.7777777777777777},
+    { 122, 0x0040402004ULL, -5.333333333333333}, { 122, 0x0040602004ULL, -3.5555555555555554},
+    { 123, 0x0000402202ULL, -5.333333333333333}, { 123, 0x0000402003ULL, -5.333333333333333},
+    { 124, 0x0008042041ULL, -32.0}, { 124, 0x000804a041ULL, 32.0},
+    { 124, 0x0008042002ULL, 32.0}, { 125, 0x000004a041ULL, -64.0},
+    { 125, 0x000008a041ULL, 32.0}, { 125, 0x000004a002ULL, 32.0},
+    { 125, 0x000008a002ULL, 32.0}, { 126, 0x0000242241ULL, -32.0},
+    { 126, 0x0000442241ULL, -10.666666666666666}, { 126, 0x0000282241ULL, 32.0},
+    { 126, 0x0000482241ULL, 10.666666666666666}, { 126, 0x0000684241ULL, -5.333333333333333},
+    { 126, 0x0040242211ULL, -5.333333333333333}, { 126, 0x0008442211ULL, 5.333333333333333},
+    { 126, 0x0040282211ULL, -5.333333333333333}, { 126, 0x0008242051ULL, -16.0},
+    { 126, 0x0008442051ULL, 5.333333333333333}, { 126, 0x0040282051ULL, -5.333333333333333},
+    { 126, 0x0040242242ULL, 5.333333333333333}, { 126, 0x0008242242ULL, 16.0},
+    { 126, 0x0008442242ULL, 10.666666666666666}, { 126, 0x0040282242ULL, -10.666666666666666},
+    { 126, 0x0040242012ULL, 5.333333333333333}, { 126, 0x0008242012ULL, 16.0},
+    { 126, 0x0008442012ULL, -10.666666666666666}, { 126, 0x0040282012ULL, 10.666666666666666},
+    { 126, 0x0000242003ULL, 32.0}, { 126, 0x0000442003ULL, 10.666666666666666},
+    { 126, 0x0000282003ULL, -32.0}, { 126, 0x0000482003ULL, -10.666666666666666},
+    { 126, 0x0000684003ULL, 5.333333333333333}, { 126, 0x0040242203ULL, -5.333333333333333},
+    { 126, 0x0008242203ULL, 16.0}, { 126, 0x0040242043ULL, 5.333333333333333},
+    { 126, 0x0008242043ULL, -16.0}, { 126, 0x0040242004ULL, -5.333333333333333},
+    { 126, 0x0008242004ULL, -16.0}, { 126, 0x0008442004ULL, -10.666666666666666},
+    { 126, 0x0040282004ULL, 10.666666666666666}, { 127, 0x0000082042ULL, 16.0},
+    { 127, 0x0000082003ULL, 16.0}, { 128, 0x0000484241ULL, -5.333333333333333},
+    { 128, 0x0000484003ULL, 5.333333333333333}, { 129, 0x0000082081ULL, -16.0},
+    { 129, 0x00000c2081ULL, 32.0}, { 129, 0x0000102081ULL, -16.0},
+    { 129, 0x0008082051ULL, -16.0}, { 129, 0x00080c2051ULL, -32.0},
+    { 129, 0x0008082082ULL, 16.0}, { 129, 0x00080c2082ULL, -32.0},
+    { 129, 0x0008082012ULL, 16.0}, { 129, 0x00080c2012ULL, 32.0},
+    { 129, 0x0000082003ULL, 16.0}, { 129, 0x00000c2003ULL, -32.0},
+    { 129, 0x0000102003ULL, 16.0}, { 129, 0x0008082004ULL, -16.0},
+    { 129, 0x00080c2004ULL, 32.0}, { 130, 0x0000104081ULL, 16.0},
+    { 130, 0x0000104003ULL, -16.0}, { 131, 0x0000010001ULL, -128.0},
+    { 132, 0x0000208201ULL, -128.0}, { 133, 0x0000400401ULL, -32.0},
+    { 133, 0x0000800401ULL, -3.5555555555555554}, { 133, 0x0000a02401ULL, 3.5555555555555554},
+    { 133, 0x0000400003ULL, 32.0}, { 133, 0x0000800003ULL, 3.5555555555555554},
+    { 133, 0x0000a02003ULL, -3.5555555555555554}, { 134, 0x0000048041ULL, -128.0},
+    { 135, 0x0000240241ULL, -64.0}, { 135, 0x0000480241ULL, 21.333333333333332},
+    { 135, 0x0000682241ULL, -10.666666666666666}, { 135, 0x0000240003ULL, 64.0},
+    { 135, 0x0000480003ULL, -21.333333333333332}, { 135, 0x0000682003ULL, 10.666666666666666},
+    { 136, 0x0000482241ULL, -10.666666666666666}, { 136, 0x0000482003ULL, 10.666666666666666},
+    { 137, 0x0000080081ULL, -32.0}, { 137, 0x0000100081ULL, -32.0},
+    { 137, 0x0000080003ULL, 32.0}, { 137, 0x0000100003ULL, 32.0},
+    { 138, 0x0000102081ULL, 32.0}, { 138, 0x0000102003ULL, -32.0},
+    { 139, 0x0080402401ULL, 3.5555555555555554}, { 139, 0x0000a02401ULL, -3.5555555555555554},
+    { 139, 0x0080402003ULL, -3.5555555555555554}, { 139, 0x0000a02003ULL, 3.5555555555555554},
+    { 140, 0x0048242241ULL, 21.333333333333332}, { 140, 0x0000682241ULL, 10.666666666666666},
+    { 140, 0x0048242003ULL, -21.333333333333332}, { 140, 0x0000682003ULL, -10.666666666666666},
+    { 141, 0x0000482241ULL, 10.666666666666666}, { 141, 0x0000482003ULL, -10.666666666666666},
+    { 142, 0x0010082081ULL, 32.0}, { 142, 0x0010082003ULL, -32.0},
+    { 143, 0x0000102081ULL, -32.0}, { 143, 0x0000102003ULL, 32.0},
+    { 144, 0x0000012001ULL, -16.0}, { 144, 0x0000010011ULL, 64.0},
+    { 145, 0x004020a201ULL, 16.0}, { 145, 0x0000602011ULL, 5.333333333333333},
+    { 145, 0x004020a002ULL, -16.0}, { 145, 0x0000400202ULL, 10.666666666666666},
+    { 145, 0x0000208202ULL, -32.0}, { 145, 0x0000400003ULL, -10.666666666666666},
+    { 145, 0x0000208003ULL, 32.0}, { 146, 0x000020a201ULL, -16.0},
+    { 146, 0x004020a011ULL, -10.666666666666666}, { 146, 0x0000208211ULL, 32.0},
+    { 146, 0x000020a002ULL, 16.0}, { 146, 0x0000208012ULL, -32.0},
+    { 147, 0x0040402211ULL, -16.0}, { 147, 0x0080402411ULL, 0.4444444444444444},
+    { 147, 0x0000a02411ULL, -0.8888888888888888}, { 147, 0x0000c04411ULL, 0.4444444444444444},
+    { 147, 0x0080402021ULL, 0.4444444444444444}, { 147, 0x0000a02021ULL, -0.8888888888888888},
+    { 147, 0x0000c04021ULL, 0.4444444444444444}, { 147, 0x0040402012ULL, 16.0},
+    { 147, 0x0000400212ULL, 16.0}, { 147, 0x0000800212ULL, -1.7777777777777777},
+    { 147, 0x0080402212ULL, 0.8888888888888888}, { 147, 0x0000a02212ULL, 1.7777777777777777},
+    { 147, 0x0000c04212ULL, -0.8888888888888888}, { 147, 0x0000400013ULL, -16.0},
+    { 147, 0x0000800013ULL, 1.7777777777777777}, { 147, 0x0080402013ULL, -3.1111111111111107},
+    { 147, 0x0000a02013ULL, 2.6666666666666665}, { 147, 0x0000c04013ULL, -1.3333333333333333},
+    { 148, 0x0000002001ULL, -32.0}, { 149, 0x0000402011ULL, 5.333333333333333},
+    { 149, 0x0000604011ULL, -5.333333333333333}, { 150, 0x0000004001ULL, 12.0},
+    { 150, 0x0000002011ULL, -4.0}, { 151, 0x000804a041ULL, 48.0},
+    { 151, 0x000804a002ULL, -48.0}, { 151, 0x0000080042ULL, -32.0},
+    { 151, 0x0000048042ULL, -32.0}, { 151, 0x0000080003ULL, 32.0},
+    { 151, 0x0000048003ULL, 32.0}, { 152, 0x000004a041ULL, -16.0},
+    { 152, 0x000804a011ULL, -32.0}, { 152, 0x0000048051ULL, 32.0},
+    { 152, 0x000004a002ULL, 16.0}, { 152, 0x0000048012ULL, -32.0},
+    { 153, 0x0040242211ULL, -8.0}, { 153, 0x0008242211ULL, -24.0},
+    { 153, 0x0040242051ULL, -8.0}, { 153, 0x0008242051ULL, -24.0},
+    { 153, 0x0048242251ULL, 2.6666666666666665}, { 153, 0x0000682251ULL, 2.6666666666666665},
+    { 153, 0x0048242021ULL, 2.6666666666666665}, { 153, 0x0000682021ULL, 2.6666666666666665},
+    { 153, 0x0040242012ULL, 16.0}, { 153, 0x0008242012ULL, 48.0},
+    { 153, 0x0000240212ULL, 16.0}, { 153, 0x0000480212ULL, 5.333333333333333},
+    { 153, 0x0048242212ULL, 2.6666666666666665}, { 153, 0x0000682212ULL, -2.6666666666666665},
+    { 153, 0x0000240052ULL, 16.0}, { 153, 0x0000480052ULL, 5.333333333333333},
+    { 153, 0x0048242052ULL, 2.6666666666666665}, { 153, 0x0000682052ULL, -2.6666666666666665},
+    { 153, 0x0000240013ULL, -32.0}, { 153, 0x0000480013ULL, -10.666666666666666},
+    { 153, 0x0048242013ULL, -18.666666666666664}, { 153, 0x0000682013ULL, -8.0},
+    { 154, 0x0000082011ULL, -32.0}, { 155, 0x0000482251ULL, 2.6666666666666665},
+    { 155, 0x0000684251ULL, -2.6666666666666665}, { 155, 0x0000482021ULL, 2.6666666666666665},
+    { 155, 0x0000684021ULL, -2.6666666666666665}, { 155, 0x0000482212ULL, -2.6666666666666665},
+    { 155, 0x0000684212ULL, 2.6666666666666665}, { 155, 0x0000482052ULL, -2.6666666666666665},
+    { 155, 0x0000684052ULL, 2.6666666666666665}, { 155, 0x0000482013ULL, -8.0},
+    { 155, 0x0000684013ULL, 8.0}, { 156, 0x0000084011ULL, 16.0},
+    { 157, 0x0008082051ULL, -48.0}, { 157, 0x0010082091ULL, 4.0},
+    { 157, 0x0010082021ULL, 4.0}, { 157, 0x0008082012ULL, 48.0},
+    { 157, 0x0000080052ULL, 16.0}, { 157, 0x0000100052ULL, -16.0},
+    { 157, 0x0010082052ULL, 8.0}, { 157, 0x0000080013ULL, -16.0},
+    { 157, 0x0000100013ULL, 16.0}, { 157, 0x0010082013ULL, -28.0},
+    { 158, 0x0000102091ULL, -8.0}, { 158, 0x0000102021ULL, -8.0},
+    { 158, 0x0000102052ULL, 16.0}, { 158, 0x0000102013ULL, 24.0},
+    { 159, 0x0000104091ULL, 4.0}, { 159, 0x0000104021ULL, 4.0},
+    { 159, 0x0000104052ULL, -8.0}, { 159, 0x0000104013ULL, -12.0},
+    { 160, 0x0040200201ULL, 10.666666666666666}, { 160, 0x0040208201ULL, 10.666666666666666},
+    { 160, 0x0040200002ULL, -10.666666666666666}, { 160, 0x0040208002ULL, -10.666666666666666},
+    { 161, 0x0000208201ULL, -32.0}, { 161, 0x0000408201ULL, 10.666666666666666},
+    { 161, 0x0040208011ULL, -10.666666666666666}, { 161, 0x0000208002ULL, -32.0},
+    { 161, 0x0000408002ULL, 10.666666666666666}, { 162, 0x0000400401ULL, -16.0},
+    { 162, 0x0000600401ULL, 10.666666666666666}, { 162, 0x0000800401ULL, -1.7777777777777777},
+    { 162, 0x0080402401ULL, -2.6666666666666665}, { 162, 0x0000c04401ULL, -0.8888888888888888},
+    { 162, 0x0040400211ULL, -10.666666666666666}, { 162, 0x0040600211ULL, -3.5555555555555554},
+    { 162, 0x0040400402ULL, 10.666666666666666}, { 162, 0x0040600402ULL, -3.5555555555555554},
+    { 162, 0x0040400012ULL, 10.666666666666666}, { 162, 0x0040600012ULL, 3.5555555555555554},
+    { 162, 0x0000400003ULL, 16.0}, { 162, 0x0000600003ULL, -10.666666666666666},
+    { 162, 0x0000800003ULL, 1.7777777777777777}, { 162, 0x0080402003ULL, 2.6666666666666665},
+    { 162, 0x0000c04003ULL, 0.8888888888888888}, { 162, 0x0040400004ULL, -10.666666666666666},
+    { 162, 0x0040600004ULL, 3.5555555555555554}, { 163, 0x0000602202ULL, 5.333333333333333},
+    { 163, 0x0000602003ULL, 5.333333333333333}, { 164, 0x0000002001ULL, -8.0},
+    { 165, 0x0008040041ULL, 32.0}, { 165, 0x0008048041ULL, 32.0},
+    { 165, 0x0008040002ULL, -32.0}, { 165, 0x0008048002ULL, -32.0},
+    { 166, 0x0000048041ULL, -32.0}, { 166, 0x0000088041ULL, -32.0},
+    { 166, 0x0008048011ULL, -32.0}, { 166, 0x0000048002ULL, -32.0},
+    { 166, 0x0000088002ULL, -32.0}, { 167, 0x0000240241ULL, -32.0},
+    { 167, 0x0000440241ULL, 10.666666666666666}, { 167, 0x0000280241ULL, -32.0},
+    { 167, 0x0000480241ULL, 10.666666666666666}, { 167, 0x0048242241ULL, -16.0},
+    { 167, 0x0040240211ULL, -5.333333333333333}, { 167, 0x0008240211ULL, -16.0},
+    { 167, 0x0008440211ULL, -5.333333333333333}, { 167, 0x0040280211ULL, 5.333333333333333},
+    { 167, 0x0040240051ULL, -5.333333333333333}, { 167, 0x0008240051ULL, -16.0},
+    { 167, 0x0008440051ULL, -5.333333333333333}, { 167, 0x0040280051ULL, 5.333333333333333},
+    { 167, 0x0040240242ULL, 10.666666666666666}, { 167, 0x0008240242ULL, 32.0},
+    { 167, 0x0008440242ULL, -10.666666666666666}, { 167, 0x0040280242ULL, 10.666666666666666},
+    { 167, 0x0040240012ULL, 10.666666666666666}, { 167, 0x0008240012ULL, 32.0},
+    { 167, 0x0008440012ULL, 10.666666666666666}, { 167, 0x0040280012ULL, -10.666666666666666},
+    { 167, 0x0000240003ULL, 32.0}, { 167, 0x0000440003ULL, -10.666666666666666},
+    { 167, 0x0000280003ULL, 32.0}, { 167, 0x0000480003ULL, -10.666666666666666},
+    { 167, 0x0048242003ULL, 16.0}, { 167, 0x0040240004ULL, -10.666666666666666},
+    { 167, 0x0008240004ULL, -32.0}, { 167, 0x0008440004ULL, 10.666666666666666},
+    { 167, 0x0040280004ULL, -10.666666666666666}, { 168, 0x0000684241ULL, 5.333333333333333},
+    { 168, 0x0000684003ULL, -5.333333333333333}, { 169, 0x0000082042ULL, -16.0},
+    { 169, 0x0000082003ULL, -16.0}, { 170, 0x0000080081ULL, -16.0},
+    { 170, 0x00000c0081ULL, -32.0}, { 170, 0x0000100081ULL, -16.0},
+    { 170, 0x0010082081ULL, -24.0}, { 170, 0x0008080051ULL, -32.0},
+    { 170, 0x00080c0051ULL, 32.0}, { 170, 0x0008080082ULL, 32.0},
+    { 170, 0x00080c0082ULL, 32.0}, { 170, 0x0008080012ULL, 32.0},
+    { 170, 0x00080c0012ULL, -32.0}, { 170, 0x0000080003ULL, 16.0},
+    { 170, 0x00000c0003ULL, 32.0}, { 170, 0x0000100003ULL, 16.0},
+    { 170, 0x0010082003ULL, 24.0}, { 170, 0x0008080004ULL, -32.0},
+    { 170, 0x00080c0004ULL, -32.0}, { 171, 0x0000104081ULL, -8.0},
+    { 171, 0x0000104003ULL, 8.0}, { 172, 0x0080400401ULL, -3.5555555555555554},
+    { 172, 0x0000c02401ULL, -1.7777777777777777}, { 172, 0x0080400003ULL, 3.5555555555555554},
+    { 172, 0x0000c02003ULL, 1.7777777777777777}, { 173, 0x0048240241ULL, -21.333333333333332},
+    { 173, 0x0048240003ULL, 21.333333333333332}, { 174, 0x0000682241ULL, 10.666666666666666},
+    { 174, 0x0000682003ULL, -10.666666666666666}, { 175, 0x0010080081ULL, -32.0},
+    { 175, 0x0010080003ULL, 32.0}, { 176, 0x0000102081ULL, -16.0},
+    { 176, 0x0000102003ULL, 16.0}, { 177, 0x0040200201ULL, 10.666666666666666},
+    { 177, 0x0040208201ULL, -10.666666666666666}, { 177, 0x0040200002ULL, -10.666666666666666},
+    { 177, 0x0040208002ULL, 10.666666666666666}, { 178, 0x0000208201ULL, 32.0},
+    { 178, 0x0000408201ULL, 10.666666666666666}, { 178, 0x0040208011ULL, 10.666666666666666},
+    { 178, 0x0000208002ULL, 32.0}, { 178, 0x0000408002ULL, 10.666666666666666},
+    { 179, 0x0000400401ULL, 16.0}, { 179, 0x0000600401ULL, 10.666666666666666},
+    { 179, 0x0000800401ULL, 1.7777777777777777}, { 179, 0x0080402401ULL, 2.6666666666666665},
+    { 179, 0x0000a02401ULL, -3.5555555555555554}, { 179, 0x0000c04401ULL, 0.8888888888888888},
+    { 179, 0x0040400211ULL, 10.666666666666666}, { 179, 0x0040600211ULL, -3.5555555555555554},
+    { 179, 0x0040400402ULL, -10.666666666666666}, { 179, 0x0040600402ULL, -3.5555555555555554},
+    { 179, 0x0040400012ULL, -10.666666666666666}, { 179, 0x0040600012ULL, 3.5555555555555554},
+    { 179, 0x0000400003ULL, -16.0}, { 179, 0x0000600003ULL, -10.666666666666666},
+    { 179, 0x0000800003ULL, -1.7777777777777777}, { 179, 0x0080402003ULL, -2.6666666666666665},
+    { 179, 0x0000a02003ULL, 3.5555555555555554}, { 179, 0x0000c04003ULL, -0.8888888888888888},
+    { 179, 0x0040400004ULL, 10.666666666666666}, { 179, 0x0040600004ULL, 3.5555555555555554},
+    { 180, 0x0000602202ULL, -5.333333333333333}, { 180, 0x0000602003ULL, -5.333333333333333},
+    { 181, 0x0000002001ULL, 8.0}, { 182, 0x0008040041ULL, 32.0},
+    { 182, 0x0008048041ULL, -32.0}, { 182, 0x0008040002ULL, -32.0},
+    { 182, 0x0008048002ULL, 32.0}, { 183, 0x0000048041ULL, 32.0},
+    { 183, 0x0000088041ULL, -32.0}, { 183, 0x0008048011ULL, 32.0},
+    { 183, 0x0000048002ULL, 32.0}, { 183, 0x0000088002ULL, -32.0},
+    { 184, 0x0000240241ULL, 32.0}, { 184, 0x0000440241ULL, 10.666666666666666},
+    { 184, 0x0000280241ULL, -32.0}, { 184, 0x0000480241ULL, -10.666666666666666},
+    { 184, 0x0048242241ULL, 16.0}, { 184, 0x0000682241ULL, 10.666666666666666},
+    { 184, 0x0040240211ULL, 5.333333333333333}, { 184, 0x0008240211ULL, 16.0},
+    { 184, 0x0008440211ULL, -5.333333333333333}, { 184, 0x0040280211ULL, 5.333333333333333},
+    { 184, 0x0040240051ULL, 5.333333333333333}, { 184, 0x0008240051ULL, 16.0},
+    { 184, 0x0008440051ULL, -5.333333333333333}, { 184, 0x0040280051ULL, 5.333333333333333},
+    { 184, 0x0040240242ULL, -10.666666666666666}, { 184, 0x0008240242ULL, -32.0},
+    { 184, 0x0008440242ULL, -10.666666666666666}, { 184, 0x0040280242ULL, 10.666666666666666},
+    { 184, 0x0040240012ULL, -10.666666666666666}, { 184, 0x0008240012ULL, -32.0},
+    { 184, 0x0008440012ULL, 10.666666666666666}, { 184, 0x0040280012ULL, -10.666666666666666},
+    { 184, 0x0000240003ULL, -32.0}, { 184, 0x0000440003ULL, -10.666666666666666},
+    { 184, 0x0000280003ULL, 32.0}, { 184, 0x0000480003ULL, 10.666666666666666},
+    { 184, 0x0048242003ULL, -16.0}, { 184, 0x0000682003ULL, -10.666666666666666},
+    { 184, 0x0040240004ULL, 10.666666666666666}, { 184, 0x0008240004ULL, 32.0},
+    { 184, 0x0008440004ULL, 10.666666666666666}, { 184, 0x0040280004ULL, -10.666666666666666},
+    { 185, 0x0000482241ULL, 10.666666666666666}, { 185, 0x0000684241ULL, -5.333333333333333},
+    { 185, 0x0000482003ULL, -10.666666666666666}, { 185, 0x0000684003ULL, 5.333333333333333},
+    { 186, 0x0000082042ULL, 16.0}, { 186, 0x0000082003ULL, 16.0},
+    { 187, 0x0000080081ULL, 16.0}, { 187, 0x00000c0081ULL, -32.0},
+    { 187, 0x0000100081ULL, 16.0}, { 187, 0x0010082081ULL, 24.0},
+    { 187, 0x0008080051ULL, 32.0}, { 187, 0x00080c0051ULL, 32.0},
+    { 187, 0x0008080082ULL, -32.0}, { 187, 0x00080c0082ULL, 32.0},
+    { 187, 0x0008080012ULL, -32.0}, { 187, 0x00080c0012ULL, -32.0},
+    { 187, 0x0000080003ULL, -16.0}, { 187, 0x00000c0003ULL, 32.0},
+    { 187, 0x0000100003ULL, -16.0}, { 187, 0x0010082003ULL, -24.0},
+    { 187, 0x0008080004ULL, 32.0}, { 187, 0x00080c0004ULL, -32.0},
+    { 188, 0x0000102081ULL, -32.0}, { 188, 0x0000102003ULL, 32.0},
+    { 189, 0x0000104081ULL, 8.0}, { 189, 0x0000104003ULL, -8.0},
+    { 190, 0x0000c02401ULL, 3.5555555555555554}, { 190, 0x0000c02003ULL, -3.5555555555555554},
+    { 191, 0x0000682241ULL, -21.333333333333332}, { 191, 0x0000682003ULL, 21.333333333333332},
+    { 192, 0x0000102081ULL, 32.0}, { 192, 0x0000102003ULL, -32.0},
+    { 193, 0x0080400401ULL, -3.5555555555555554}, { 193, 0x0000c02401ULL, -1.7777777777777777},
+    { 193, 0x0080400003ULL, 3.5555555555555554}, { 193, 0x0000c02003ULL, 1.7777777777777777},
+    { 194, 0x0048240241ULL, -21.333333333333332}, { 194, 0x0048240003ULL, 21.333333333333332},
+    { 195, 0x0000682241ULL, 10.666666666666666}, { 195, 0x0000682003ULL, -10.666666666666666},
+    { 196, 0x0010080081ULL, -32.0}, { 196, 0x0010080003ULL, 32.0},
+    { 197, 0x0000102081ULL, -16.0}, { 197, 0x0000102003ULL, 16.0},
+    { 198, 0x0040208201ULL, -21.333333333333332}, { 198, 0x0040208002ULL, 21.333333333333332},
+    { 199, 0x0040208011ULL, 21.333333333333332}, { 200, 0x0040400211ULL, 21.333333333333332},
+    { 200, 0x0000c02411ULL, -0.8888888888888888}, { 200, 0x0000c02021ULL, -0.8888888888888888},
+    { 200, 0x0040400012ULL, -21.333333333333332}, { 200, 0x0080400212ULL, -3.5555555555555554},
+    { 200, 0x0000c02212ULL, 1.7777777777777777}, { 200, 0x0080400013ULL, 3.5555555555555554},
+    { 200, 0x0000c02013ULL, 2.6666666666666665}, { 201, 0x0000602011ULL, 10.666666666666666},
+    { 202, 0x0000002001ULL, -24.0}, { 203, 0x0008048041ULL, -64.0},
+    { 203, 0x0008048002ULL, 64.0}, { 204, 0x0008048011ULL, 64.0},
+    { 205, 0x0040240211ULL, 10.666666666666666}, { 205, 0x0008240211ULL, 32.0},
+    { 205, 0x0040240051ULL, 10.666666666666666}, { 205, 0x0008240051ULL, 32.0},
+    { 205, 0x0040240012ULL, -21.333333333333332}, { 205, 0x0008240012ULL, -64.0},
+    { 205, 0x0048240212ULL, -10.666666666666666}, { 205, 0x0048240052ULL, -10.666666666666666},
+    { 205, 0x0048240013ULL, 21.333333333333332}, { 206, 0x0000682251ULL, 5.333333333333333},
+    { 206, 0x0000682021ULL, 5.333333333333333}, { 206, 0x0000682212ULL, -5.333333333333333},
+    { 206, 0x0000682052ULL, -5.333333333333333}, { 206, 0x0000682013ULL, -16.0},
+    { 207, 0x0000082011ULL, -32.0}, { 208, 0x0008080051ULL, 64.0},
+    { 208, 0x0008080012ULL, -64.0}, { 208, 0x0010080052ULL, -32.0},
+    { 208, 0x0010080013ULL, 32.0}, { 209, 0x0000102091ULL, -8.0},
+    { 209, 0x0000102021ULL, -8.0}, { 209, 0x0000102052ULL, 16.0},
+    { 209, 0x0000102013ULL, 24.0}, { 210, 0x0080400401ULL, 3.5555555555555554},
+    { 210, 0x0000c02401ULL, 1.7777777777777777}, { 210, 0x0080400003ULL, -3.5555555555555554},
+    { 210, 0x0000c02003ULL, -1.7777777777777777}, { 211, 0x0048240241ULL, 21.333333333333332},
+    { 211, 0x0048240003ULL, -21.333333333333332}, { 212, 0x0000682241ULL, -10.666666666666666},
+    { 212, 0x0000682003ULL, 10.666666666666666}, { 213, 0x0010080081ULL, 32.0},
+    { 213, 0x0010080003ULL, -32.0}, { 214, 0x0000102081ULL, 16.0},
+    { 214, 0x0000102003ULL, -16.0}, { 215, 0x0080400401ULL, -3.5555555555555554},
+    { 215, 0x0000c02401ULL, -1.7777777777777777}, { 215, 0x0080400003ULL, 3.5555555555555554},
+    { 215, 0x0000c02003ULL, 1.7777777777777777}, { 216, 0x0048240241ULL, -21.333333333333332},
+    { 216, 0x0048240003ULL, 21.333333333333332}, { 217, 0x0000682241ULL, 10.666666666666666},
+    { 217, 0x0000682003ULL, -10.666666666666666}, { 218, 0x0010080081ULL, -32.0},
+    { 218, 0x0010080003ULL, 32.0}, { 219, 0x0000102081ULL, -16.0},
+    { 219, 0x0000102003ULL, 16.0}, { 220, 0x0040402202ULL, 10.666666666666666},
+    { 220, 0x0040602202ULL, -7.111111111111111}, { 221, 0x0040242202ULL, 10.666666666666666},
+    { 221, 0x0008442202ULL, -10.666666666666666}, { 221, 0x0040282202ULL, 10.666666666666666},
+    { 221, 0x0008242042ULL, 32.0}, { 221, 0x0008442042ULL, -10.666666666666666},
+    { 221, 0x0040282042ULL, 10.666666666666666}, { 222, 0x0008082042ULL, 32.0},
+    { 222, 0x00080c2042ULL, 64.0}, { 223, 0x0000602002ULL, -10.666666666666666},
+    { 224, 0x004020a002ULL, 21.333333333333332}, { 225, 0x0040402202ULL, 32.0},
+    { 225, 0x0080402402ULL, -0.8888888888888888}, { 225, 0x0000a02402ULL, 1.7777777777777777},
+    { 225, 0x0000c04402ULL, -0.8888888888888888}, { 225, 0x0080402012ULL, -1.7777777777777777},
+    { 225, 0x0000a02012ULL, 3.5555555555555554}, { 225, 0x0000c04012ULL, -1.7777777777777777},
+    { 225, 0x0000400203ULL, -32.0}, { 225, 0x0000800203ULL, 3.5555555555555554},
+    { 225, 0x0080402203ULL, -5.333333333333333}, { 225, 0x0000a02203ULL, 3.5555555555555554},
+    { 225, 0x0000c04203ULL, -1.7777777777777777}, { 225, 0x0080402004ULL, -0.8888888888888888},
+    { 225, 0x0000a02004ULL, 1.7777777777777777}, { 225, 0x0000c04004ULL, -0.8888888888888888},
+    { 226, 0x0000402002ULL, -10.666666666666666}, { 226, 0x0000604002ULL, 10.666666666666666},
+    { 227, 0x0000002002ULL, 8.0}, { 228, 0x000804a002ULL, 64.0},
+    { 229, 0x0040242202ULL, 16.0}, { 229, 0x0008242202ULL, 48.0},
+    { 229, 0x0040242042ULL, 16.0}, { 229, 0x0008242042ULL, 48.0},
+    { 229, 0x0048242242ULL, -5.333333333333333}, { 229, 0x0000682242ULL, -5.333333333333333},
+    { 229, 0x0048242012ULL, -10.666666666666666}, { 229, 0x0000682012ULL, -10.666666666666666},
+    { 229, 0x0000240203ULL, -32.0}, { 229, 0x0000480203ULL, -10.666666666666666},
+    { 229, 0x0048242203ULL, -16.0}, { 229, 0x0000682203ULL, -5.333333333333333},
+    { 229, 0x0000240043ULL, -32.0}, { 229, 0x0000480043ULL, -10.666666666666666},
+    { 229, 0x0048242043ULL, -16.0}, { 229, 0x0000682043ULL, -5.333333333333333},
+    { 229, 0x0048242004ULL, -5.333333333333333}, { 229, 0x0000682004ULL, -5.333333333333333},
+    { 230, 0x0000082002ULL, 64.0}, { 231, 0x0000482242ULL, -5.333333333333333},
+    { 231, 0x0000684242ULL, 5.333333333333333}, { 231, 0x0000482012ULL, -10.666666666666666},
+    { 231, 0x0000684012ULL, 10.666666666666666}, { 231, 0x0000482203ULL, -5.333333333333333},
+    { 231, 0x0000684203ULL, 5.333333333333333}, { 231, 0x0000482043ULL, -5.333333333333333},
+    { 231, 0x0000684043ULL, 5.333333333333333}, { 231, 0x0000482004ULL, -5.333333333333333},
+    { 231, 0x0000684004ULL, 5.333333333333333}, { 232, 0x0000084002ULL, -32.0},
+    { 233, 0x0008082042ULL, 96.0}, { 233, 0x0010082082ULL, -8.0},
+    { 233, 0x0010082012ULL, -16.0}, { 233, 0x0000080043ULL, -32.0},
+    { 233, 0x0000100043ULL, 32.0}, { 233, 0x0010082043ULL, -48.0},
+    { 233, 0x0010082004ULL, -8.0}, { 234, 0x0000102082ULL, 16.0},
+    { 234, 0x0000102012ULL, 32.0}, { 234, 0x0000102043ULL, 32.0},
+    { 234, 0x0000102004ULL, 16.0}, { 235, 0x0000104082ULL, -8.0},
+    { 235, 0x0000104012ULL, -16.0}, { 235, 0x0000104043ULL, -16.0},
+    { 235, 0x0000104004ULL, -8.0}, { 236, 0x0040208002ULL, 21.333333333333332},
+    { 237, 0x0040400202ULL, 21.333333333333332}, { 237, 0x0040600202ULL, 7.111111111111111},
+    { 238, 0x0008048002ULL, 64.0}, { 239, 0x0040240202ULL, 10.666666666666666},
+    { 239, 0x0008240202ULL, 32.0}, { 239, 0x0008440202ULL, 10.666666666666666},
+    { 239, 0x0040280202ULL, -10.666666666666666}, { 239, 0x0040240042ULL, 10.666666666666666},
+    { 239, 0x0008240042ULL, 32.0}, { 239, 0x0008440042ULL, 10.666666666666666},
+    { 239, 0x0040280042ULL, -10.666666666666666}, { 240, 0x0008080042ULL, 64.0},
+    { 240, 0x00080c0042ULL, -64.0}, { 241, 0x0040208002ULL, -21.333333333333332},
+    { 242, 0x0040400202ULL, -21.333333333333332}, { 242, 0x0040600202ULL, 7.111111111111111},
+    { 243, 0x0008048002ULL, -64.0}, { 244, 0x0040240202ULL, -10.666666666666666},
+    { 244, 0x0008240202ULL, -32.0}, { 244, 0x0008440202ULL, 10.666666666666666},
+    { 244, 0x0040280202ULL, -10.666666666666666}, { 244, 0x0040240042ULL, -10.666666666666666},
+    { 244, 0x0008240042ULL, -32.0}, { 244, 0x0008440042ULL, 10.666666666666666},
+    { 244, 0x0040280042ULL, -10.666666666666666}, { 245, 0x0008080042ULL, -64.0},
+    { 245, 0x00080c0042ULL, -64.0}, { 246, 0x0040208002ULL, -42.666666666666664},
+    { 247, 0x0040400202ULL, -42.666666666666664}, { 247, 0x0000c02402ULL, 1.7777777777777777},
+    { 247, 0x0000c02012ULL, 3.5555555555555554}, { 247, 0x0080400203ULL, 7.111111111111111},
+    { 247, 0x0000c02203ULL, 3.5555555555555554}, { 247, 0x0000c02004ULL, 1.7777777777777777},
+    { 248, 0x0000602002ULL, -21.333333333333332}, { 249, 0x0008048002ULL, -128.0},
+    { 250, 0x0040240202ULL, -21.333333333333332}, { 250, 0x0008240202ULL, -64.0},
+    { 250, 0x0040240042ULL, -21.333333333333332}, { 250, 0x0008240042ULL, -64.0},
+    { 250, 0x0048240203ULL, 21.333333333333332}, { 250, 0x0048240043ULL, 21.333333333333332},
+    { 251, 0x0000682242ULL, -10.666666666666666}, { 251, 0x0000682012ULL, -21.333333333333332},
+    { 251, 0x0000682203ULL, -10.666666666666666}, { 251, 0x0000682043ULL, -10.666666666666666},
+    { 251, 0x0000682004ULL, -10.666666666666666}, { 252, 0x0000082002ULL, 64.0},
+    { 253, 0x0008080042ULL, -128.0}, { 253, 0x0010080043ULL, 64.0},
+    { 254, 0x0000102082ULL, 16.0}, { 254, 0x0000102012ULL, 32.0},
+    { 254, 0x0000102043ULL, 32.0}, { 254, 0x0000102004ULL, 16.0},
+    { 255, 0x0080402003ULL, 1.7777777777777777}, { 255, 0x0000a02003ULL, -3.5555555555555554},
+    { 255, 0x0000c04003ULL, 1.7777777777777777}, { 256, 0x0048242003ULL, 10.666666666666666},
+    { 256, 0x0000682003ULL, 10.666666666666666}, { 257, 0x0000482003ULL, 10.666666666666666},
+    { 257, 0x0000684003ULL, -10.666666666666666}, { 258, 0x0010082003ULL, 16.0},
+    { 259, 0x0000102003ULL, -32.0}, { 260, 0x0000104003ULL, 16.0},
+    { 261, 0x0000c02003ULL, -3.5555555555555554}, { 262, 0x0000682003ULL, 21.333333333333332},
+    { 263, 0x0000102003ULL, -32.0}, { 264, 0x0000000001ULL, -32.0},
+    { 264, 0x0000008001ULL, 64.0}, { 264, 0x0000010001ULL, -32.0},
+    { 265, 0x0000012001ULL, -64.0}, { 266, 0x0040202201ULL, -10.666666666666666},
+    { 266, 0x004020a201ULL, -5.333333333333333}, { 266, 0x0000200011ULL, -32.0},
+    { 266, 0x0000400011ULL, 10.666666666666666}, { 266, 0x0000208011ULL, 32.0},
+    { 266, 0x0000408011ULL, -10.666666666666666}, { 266, 0x0000602011ULL, -5.333333333333333},
+    { 266, 0x0040202002ULL, -10.666666666666666}, { 266, 0x004020a002ULL, -5.333333333333333},
+    { 266, 0x0000400202ULL, -10.666666666666666}, { 266, 0x0000208202ULL, -32.0},
+    { 266, 0x0000408202ULL, -21.333333333333332}, { 266, 0x0000400003ULL, -10.666666666666666},
+    { 266, 0x0000208003ULL, -32.0}, { 266, 0x0000408003ULL, -21.333333333333332},
+    { 267, 0x000020a201ULL, -16.0}, { 267, 0x004020a011ULL, -5.333333333333333},
+    { 267, 0x0000208211ULL, 32.0}, { 267, 0x000020a002ULL, -16.0},
+    { 267, 0x0000208012ULL, 32.0}, { 268, 0x0000400411ULL, 8.0},
+    { 268, 0x0000600411ULL, -5.333333333333333}, { 268, 0x0000800411ULL, 0.8888888888888888},
+    { 268, 0x0000a02411ULL, -0.8888888888888888}, { 268, 0x0000400021ULL, -8.0},
+    { 268, 0x0000600021ULL, 5.333333333333333}, { 268, 0x0000800021ULL, -0.8888888888888888},
+    { 268, 0x0000a02021ULL, 0.8888888888888888}, { 268, 0x0000400212ULL, 32.0},
+    { 268, 0x0000800212ULL, 3.5555555555555554}, { 268, 0x0000a02212ULL, -3.5555555555555554},
+    { 268, 0x0000400013ULL, 24.0}, { 268, 0x0000600013ULL, 5.333333333333333},
+    { 268, 0x0000800013ULL, 2.6666666666666665}, { 268, 0x0000a02013ULL, -2.6666666666666665},
+    { 269, 0x0000002001ULL, 32.0}, { 270, 0x0000402011ULL, -5.333333333333333},
+    { 270, 0x0000402202ULL, 5.333333333333333}, { 270, 0x0000402003ULL, 5.333333333333333},
+    { 271, 0x0008042041ULL, -32.0}, { 271, 0x000804a041ULL, -16.0},
+    { 271, 0x0000040011ULL, -32.0}, { 271, 0x0000080011ULL, -32.0},
+    { 271, 0x0000048011ULL, 32.0}, { 271, 0x0000088011ULL, 32.0},
+    { 271, 0x0008042002ULL, -32.0}, { 271, 0x000804a002ULL, -16.0},
+    { 271, 0x0000080042ULL, 32.0}, { 271, 0x0000048042ULL, -32.0},
+    { 271, 0x0000088042ULL, 64.0}, { 271, 0x0000080003ULL, 32.0},
+    { 271, 0x0000048003ULL, -32.0}, { 271, 0x0000088003ULL, 64.0},
+    { 272, 0x000004a041ULL, -16.0}, { 272, 0x000804a011ULL, -16.0},
+    { 272, 0x0000048051ULL, 32.0}, { 272, 0x000004a002ULL, -16.0},
+    { 272, 0x0000048012ULL, 32.0}, { 273, 0x0040242211ULL, 2.6666666666666665},
+    { 273, 0x0008242211ULL, -8.0}, { 273, 0x0008442211ULL, -5.333333333333333},
+    { 273, 0x0040282211ULL, -5.333333333333333}, { 273, 0x0040242051ULL, -2.6666666666666665},
+    { 273, 0x0008242051ULL, 8.0}, { 273, 0x0008442051ULL, 5.333333333333333},
+    { 273, 0x0040282051ULL, 5.333333333333333}, { 273, 0x0000240251ULL, 16.0},
+    { 273, 0x0000440251ULL, -5.333333333333333}, { 273, 0x0000280251ULL, 16.0},
+    { 273, 0x0000480251ULL, -5.333333333333333}, { 273, 0x0000682251ULL, 2.6666666666666665},
+    { 273, 0x0000240021ULL, -16.0}, { 273, 0x0000440021ULL, 5.333333333333333},
+    { 273, 0x0000280021ULL, -16.0}, { 273, 0x0000480021ULL, 5.333333333333333},
+    { 273, 0x0000682021ULL, -2.6666666666666665}, { 273, 0x0000240212ULL, 32.0},
+    { 273, 0x0000440212ULL, 5.333333333333333}, { 273, 0x0000280212ULL, 16.0},
+    { 273, 0x0000480212ULL, -10.666666666666666}, { 273, 0x0000682212ULL, 2.6666666666666665},
+    { 273, 0x0000240052ULL, 32.0}, { 273, 0x0000440052ULL, -5.333333333333333},
+    { 273, 0x0000280052ULL, -16.0}, { 273, 0x0000480052ULL, -10.666666666666666},
+    { 273, 0x0000682052ULL, 8.0}, { 273, 0x0000240013ULL, 48.0},
+    { 273, 0x0000440013ULL, 5.333333333333333}, { 273, 0x0000280013ULL, -16.0},
+    { 273, 0x0000480013ULL, -16.0}, { 273, 0x0000682013ULL, 8.0},
+    { 274, 0x0000082011ULL, 32.0}, { 274, 0x0000082042ULL, -16.0},
+    { 274, 0x0000082003ULL, -16.0}, { 275, 0x0000482251ULL, 2.6666666666666665},
+    { 275, 0x0000482021ULL, -2.6666666666666665}, { 275, 0x0000482212ULL, 8.0},
+    { 275, 0x0000482052ULL, 2.6666666666666665}, { 275, 0x0000482013ULL, 8.0},
+    { 276, 0x0000080091ULL, 8.0}, { 276, 0x00000c0091ULL, 16.0},
+    { 276, 0x0000100091ULL, 8.0}, { 276, 0x0000080021ULL, -8.0},
+    { 276, 0x00000c0021ULL, -16.0}, { 276, 0x0000100021ULL, -8.0},
+    { 276, 0x0000080052ULL, 32.0}, { 276, 0x0000100052ULL, 32.0},
+    { 276, 0x0000080013ULL, 24.0}, { 276, 0x00000c0013ULL, -16.0},
+    { 276, 0x0000100013ULL, 24.0}, { 277, 0x0000102091ULL, -8.0},
+    { 277, 0x0000102021ULL, 8.0}, { 277, 0x0000102052ULL, -32.0},
+    { 277, 0x0000102013ULL, -24.0}, { 278, 0x0000010001ULL, -128.0},
+    { 279, 0x0040200201ULL, -10.666666666666666}, { 279, 0x0040208201ULL, -10.666666666666666},
+    { 279, 0x0040200002ULL, -10.666666666666666}, { 279, 0x0040208002ULL, -10.666666666666666},
+    { 280, 0x0000208201ULL, -32.0}, { 280, 0x0000408201ULL, 10.666666666666666},
+    { 280, 0x0040208011ULL, -10.666666666666666}, { 280, 0x0000208002ULL, -32.0},
+    { 280, 0x0000408002ULL, 10.666666666666666}, { 281, 0x0008040041ULL, -32.0},
+    { 281, 0x0008048041ULL, -32.0}, { 281, 0x0008040002ULL, -32.0},
+    { 281, 0x0008048002ULL, -32.0}, { 282, 0x0000048041ULL, -32.0},
+    { 282, 0x0000088041ULL, -32.0}, { 282, 0x0008048011ULL, -32.0},
+    { 282, 0x0000048002ULL, -32.0}, { 282, 0x0000088002ULL, -32.0},
+    { 283, 0x0040240211ULL, 5.333333333333333}, { 283, 0x0008240211ULL, -16.0},
+    { 283, 0x0008440211ULL, -5.333333333333333}, { 283, 0x0040280211ULL, -5.333333333333333},
+    { 283, 0x0040240051ULL, -5.333333333333333}, { 283, 0x0008240051ULL, 16.0},
+    { 283, 0x0008440051ULL, 5.333333333333333}, { 283, 0x0040280051ULL, 5.333333333333333},
+    { 284, 0x0040200201ULL, 10.666666666666666}, { 284, 0x0040208201ULL, -10.666666666666666},
+    { 284, 0x0040200002ULL, 10.666666666666666}, { 284, 0x0040208002ULL, -10.666666666666666},
+    { 285, 0x0000208201ULL, -32.0}, { 285, 0x0000408201ULL, -10.666666666666666},
+    { 285, 0x0040208011ULL, -10.666666666666666}, { 285, 0x0000208002ULL, -32.0},
+    { 285, 0x0000408002ULL, -10.666666666666666}, { 286, 0x0008040041ULL, 32.0},
+    { 286, 0x0008048041ULL, -32.0}, { 286, 0x0008040002ULL, 32.0},
+    { 286, 0x0008048002ULL, -32.0}, { 287, 0x0000048041ULL, -32.0},
+    { 287, 0x0000088041ULL, 32.0}, { 287, 0x0008048011ULL, -32.0},
+    { 287, 0x0000048002ULL, -32.0}, { 287, 0x0000088002ULL, 32.0},
+    { 288, 0x0040240211ULL, 5.333333333333333}, { 288, 0x0008240211ULL, -16.0},
+    { 288, 0x0008440211ULL, 5.333333333333333}, { 288, 0x0040280211ULL, 5.333333333333333},
+    { 288, 0x0040240051ULL, -5.333333333333333}, { 288, 0x0008240051ULL, 16.0},
+    { 288, 0x0008440051ULL, -5.333333333333333}, { 288, 0x0040280051ULL, -5.333333333333333},
+    { 289, 0x0000000001ULL, -32.0}, { 289, 0x0000008001ULL, 64.0},
+    { 289, 0x0000010001ULL, -32.0}, { 290, 0x0000012001ULL, -16.0},
+    { 290, 0x0000010011ULL, 64.0}, { 291, 0x0000200011ULL, -32.0},
+    { 291, 0x0000400011ULL, 10.666666666666666}, { 291, 0x0000208011ULL, 32.0},
+    { 291, 0x0000408011ULL, -10.666666666666666}, { 291, 0x0040208012ULL, -21.333333333333332},
+    { 292, 0x004020a011ULL, -5.333333333333333}, { 292, 0x0000208211ULL, 32.0},
+    { 292, 0x0000408211ULL, -10.666666666666666}, { 292, 0x0040208021ULL, 10.666666666666666},
+    { 292, 0x0000208012ULL, 32.0}, { 292, 0x0000408012ULL, -10.666666666666666},
+    { 293, 0x0000400411ULL, 8.0}, { 293, 0x0000600411ULL, -5.333333333333333},
+    { 293, 0x0000800411ULL, 0.8888888888888888}, { 293, 0x0080402411ULL, 1.3333333333333333},
+    { 293, 0x0000c04411ULL, 0.4444444444444444}, { 293, 0x0000400021ULL, -8.0},
+    { 293, 0x0000600021ULL, 5.333333333333333}, { 293, 0x0000800021ULL, -0.8888888888888888},
+    { 293, 0x0080402021ULL, -1.3333333333333333}, { 293, 0x0000c04021ULL, -0.4444444444444444},
+    { 293, 0x0000400212ULL, 16.0}, { 293, 0x0000600212ULL, -10.666666666666666},
+    { 293, 0x0000800212ULL, 1.7777777777777777}, { 293, 0x0080402212ULL, 2.6666666666666665},
+    { 293, 0x0000c04212ULL, 0.8888888888888888}, { 293, 0x0040600412ULL, 3.5555555555555554},
+    { 293, 0x0040400022ULL, 10.666666666666666}, { 293, 0x0000400013ULL, 8.0},
+    { 293, 0x0000600013ULL, -5.333333333333333}, { 293, 0x0000800013ULL, 0.8888888888888888},
+    { 293, 0x0080402013ULL, 1.3333333333333333}, { 293, 0x0000c04013ULL, 0.4444444444444444},
+    { 293, 0x0040600213ULL, 7.111111111111111}, { 293, 0x0040600014ULL, 3.5555555555555554},
+    { 294, 0x0000604011ULL, 2.6666666666666665}, { 294, 0x0000602021ULL, -2.6666666666666665},
+    { 295, 0x0000004001ULL, -4.0}, { 295, 0x0000002011ULL, 12.0},
+    { 296, 0x0000040011ULL, -32.0}, { 296, 0x0000080011ULL, -32.0},
+    { 296, 0x0000048011ULL, 32.0}, { 296, 0x0000088011ULL, 32.0},
+    { 296, 0x0008048012ULL, -64.0}, { 297, 0x000804a011ULL, -16.0},
+    { 297, 0x0000048051ULL, 32.0}, { 297, 0x0000088051ULL, 32.0},
+    { 297, 0x0008048021ULL, 32.0}, { 297, 0x0000048012ULL, 32.0},
+    { 297, 0x0000088012ULL, 32.0}, { 298, 0x0000240251ULL, 16.0},
+    { 298, 0x0000440251ULL, -5.333333333333333}, { 298, 0x0000280251ULL, 16.0},
+    { 298, 0x0000480251ULL, -5.333333333333333}, { 298, 0x0048242251ULL, 8.0},
+    { 298, 0x0000240021ULL, -16.0}, { 298, 0x0000440021ULL, 5.333333333333333},
+    { 298, 0x0000280021ULL, -16.0}, { 298, 0x0000480021ULL, 5.333333333333333},
+    { 298, 0x0048242021ULL, -8.0}, { 298, 0x0000240212ULL, 16.0},
+    { 298, 0x0000440212ULL, -5.333333333333333}, { 298, 0x0000280212ULL, 16.0},
+    { 298, 0x0000480212ULL, -5.333333333333333}, { 298, 0x0048242212ULL, 8.0},
+    { 298, 0x0000240052ULL, 16.0}, { 298, 0x0000440052ULL, -5.333333333333333},
+    { 298, 0x0000280052ULL, 16.0}, { 298, 0x0000480052ULL, -5.333333333333333},
+    { 298, 0x0048242052ULL, 8.0}, { 298, 0x0008440252ULL, 10.666666666666666},
+    { 298, 0x0040280252ULL, -10.666666666666666}, { 298, 0x0040240022ULL, 10.666666666666666},
+    { 298, 0x0008240022ULL, 32.0}, { 298, 0x0000240013ULL, 16.0},
+    { 298, 0x0000440013ULL, -5.333333333333333}, { 298, 0x0000280013ULL, 16.0},
+    { 298, 0x0000480013ULL, -5.333333333333333}, { 298, 0x0048242013ULL, 8.0},
+    { 298, 0x0008440213ULL, 10.666666666666666}, { 298, 0x0040280213ULL, -10.666666666666666},
+    { 298, 0x0008440053ULL, 10.666666666666666}, { 298, 0x0040280053ULL, -10.666666666666666},
+    { 298, 0x0008440014ULL, 10.666666666666666}, { 298, 0x0040280014ULL, -10.666666666666666},
+    { 299, 0x0000684251ULL, -2.6666666666666665}, { 299, 0x0000684021ULL, 2.6666666666666665},
+    { 299, 0x0000684212ULL, -2.6666666666666665}, { 299, 0x0000684052ULL, -2.6666666666666665},
+    { 299, 0x0000684013ULL, -2.6666666666666665}, { 300, 0x0000084011ULL, -8.0},
+    { 300, 0x0000082021ULL, 8.0}, { 301, 0x0000080091ULL, 8.0},
+    { 301, 0x00000c0091ULL, 16.0}, { 301, 0x0000100091ULL, 8.0},
+    { 301, 0x0010082091ULL, 12.0}, { 301, 0x0000080021ULL, -8.0},
+    { 301, 0x00000c0021ULL, -16.0}, { 301, 0x0000100021ULL, -8.0},
+    { 301, 0x0010082021ULL, -12.0}, { 301, 0x0000080052ULL, 16.0},
+    { 301, 0x00000c0052ULL, 32.0}, { 301, 0x0000100052ULL, 16.0},
+    { 301, 0x0010082052ULL, 24.0}, { 301, 0x00080c0092ULL, -32.0},
+    { 301, 0x0008080022ULL, 32.0}, { 301, 0x0000080013ULL, 8.0},
+    { 301, 0x00000c0013ULL, 16.0}, { 301, 0x0000100013ULL, 8.0},
+    { 301, 0x0010082013ULL, 12.0}, { 301, 0x00080c0053ULL, -64.0},
+    { 301, 0x00080c0014ULL, -32.0}, { 302, 0x0000104091ULL, 4.0},
+    { 302, 0x0000104021ULL, -4.0}, { 302, 0x0000104052ULL, 8.0},
+    { 302, 0x0000104013ULL, 4.0}, { 303, 0x0080400411ULL, 1.7777777777777777},
+    { 303, 0x0000c02411ULL, 0.8888888888888888}, { 303, 0x0080400021ULL, -1.7777777777777777},
+    { 303, 0x0000c02021ULL, -0.8888888888888888}, { 303, 0x0080400212ULL, 7.111111111111111},
+    { 303, 0x0000c02212ULL, 3.5555555555555554}, { 303, 0x0080400013ULL, 5.333333333333333},
+    { 303, 0x0000c02013ULL, 2.6666666666666665}, { 304, 0x0000602011ULL, 5.333333333333333},
+    { 304, 0x0000602202ULL, -5.333333333333333}, { 304, 0x0000602003ULL, -5.333333333333333},
+    { 305, 0x0000002001ULL, -8.0}, { 306, 0x0048240251ULL, 10.666666666666666},
+    { 306, 0x0048240021ULL, -10.666666666666666}, { 306, 0x0048240212ULL, 21.333333333333332},
+    { 306, 0x0048240052ULL, 21.333333333333332}, { 306, 0x0048240013ULL, 32.0},
+    { 307, 0x0000682251ULL, -5.333333333333333}, { 307, 0x0000682021ULL, 5.333333333333333},
+    { 307, 0x0000682212ULL, -10.666666666666666}, { 307, 0x0000682052ULL, -10.666666666666666},
+    { 307, 0x0000682013ULL, -16.0}, { 308, 0x0000082011ULL, -16.0},
+    { 308, 0x0000082042ULL, 16.0}, { 308, 0x0000082003ULL, 16.0},
+    { 309, 0x0010080091ULL, 16.0}, { 309, 0x0010080021ULL, -16.0},
+    { 309, 0x0010080052ULL, 64.0}, { 309, 0x0010080013ULL, 48.0},
+    { 310, 0x0000102091ULL, 8.0}, { 310, 0x0000102021ULL, -8.0},
+    { 310, 0x0000102052ULL, 32.0}, { 310, 0x0000102013ULL, 24.0},
+    { 311, 0x0040200201ULL, 21.333333333333332}, { 311, 0x0040200002ULL, 21.333333333333332},
+    { 312, 0x0040208011ULL, -21.333333333333332}, { 313, 0x0000c02411ULL, -0.8888888888888888},
+    { 313, 0x0000c02021ULL, 0.8888888888888888}, { 313, 0x0000c02212ULL, -3.5555555555555554},
+    { 313, 0x0000c02013ULL, -2.6666666666666665}, { 314, 0x0000602011ULL, -5.333333333333333},
+    { 314, 0x0000602202ULL, 5.333333333333333}, { 314, 0x0000602003ULL, 5.333333333333333},
+    { 315, 0x0000002001ULL, 8.0}, { 316, 0x0008040041ULL, 64.0},
+    { 316, 0x0008040002ULL, 64.0}, { 317, 0x0008048011ULL, -64.0},
+    { 318, 0x0008440211ULL, 10.666666666666666}, { 318, 0x0040280211ULL, 10.666666666666666},
+    { 318, 0x0008440051ULL, -10.666666666666666}, { 318, 0x0040280051ULL, -10.666666666666666},
+    { 319, 0x0000682251ULL, 5.333333333333333}, { 319, 0x0000682021ULL, -5.333333333333333},
+    { 319, 0x0000682212ULL, 10.666666666666666}, { 319, 0x0000682052ULL, 10.666666666666666},
+    { 319, 0x0000682013ULL, 16.0}, { 320, 0x0000082011ULL, 16.0},
+    { 320, 0x0000082042ULL, -16.0}, { 320, 0x0000082003ULL, -16.0},
+    { 321, 0x0000102091ULL, -8.0}, { 321, 0x0000102021ULL, 8.0},
+    { 321, 0x0000102052ULL, -32.0}, { 321, 0x0000102013ULL, -24.0},
+    { 322, 0x0080400411ULL, -1.7777777777777777}, { 322, 0x0000c02411ULL, -0.8888888888888888},
+    { 322, 0x0080400021ULL, 1.7777777777777777}, { 322, 0x0000c02021ULL, 0.8888888888888888},
+    { 322, 0x0080400212ULL, -3.5555555555555554}, { 322, 0x0000c02212ULL, -1.7777777777777777},
+    { 322, 0x0080400013ULL, -1.7777777777777777}, { 322, 0x0000c02013ULL, -0.8888888888888888},
+    { 323, 0x0000602011ULL, -5.333333333333333}, { 324, 0x0000002001ULL, 8.0},
+    { 325, 0x0048240251ULL, -10.666666666666666}, { 325, 0x0048240021ULL, 10.666666666666666},
+    { 325, 0x0048240212ULL, -10.666666666666666}, { 325, 0x0048240052ULL, -10.666666666666666},
+    { 325, 0x0048240013ULL, -10.666666666666666}, { 326, 0x0000682251ULL, 5.333333333333333},
+    { 326, 0x0000682021ULL, -5.333333333333333}, { 326, 0x0000682212ULL, 5.333333333333333},
+    { 326, 0x0000682052ULL, 5.333333333333333}, { 326, 0x0000682013ULL, 5.333333333333333},
+    { 327, 0x0000082011ULL, 16.0}, { 328, 0x0010080091ULL, -16.0},
+    { 328, 0x0010080021ULL, 16.0}, { 328, 0x0010080052ULL, -32.0},
+    { 328, 0x0010080013ULL, -16.0}, { 329, 0x0000102091ULL, -8.0},
+    { 329, 0x0000102021ULL, 8.0}, { 329, 0x0000102052ULL, -16.0},
+    { 329, 0x0000102013ULL, -8.0}, { 330, 0x0000200002ULL, 64.0},
+    { 330, 0x0000400002ULL, -21.333333333333332}, { 330, 0x0000208002ULL, -64.0},
+    { 330, 0x0000408002ULL, 21.333333333333332}, { 330, 0x0000602002ULL, 10.666666666666666},
+    { 331, 0x004020a002ULL, 10.666666666666666}, { 332, 0x0000400402ULL, 16.0},
+    { 332, 0x0000600402ULL, 10.666666666666666}, { 332, 0x0000800402ULL, 1.7777777777777777},
+    { 332, 0x0000a02402ULL, -1.7777777777777777}, { 332, 0x0000400012ULL, 32.0},
+    { 332, 0x0000600012ULL, -21.333333333333332}, { 332, 0x0000800012ULL, 3.5555555555555554},
+    { 332, 0x0000a02012ULL, -3.5555555555555554}, { 332, 0x0000400004ULL, -16.0},
+    { 332, 0x0000600004ULL, -10.666666666666666}, { 332, 0x0000800004ULL, -1.7777777777777777},
+    { 332, 0x0000a02004ULL, 1.7777777777777777}, { 333, 0x0000402002ULL, 10.666666666666666},
+    { 334, 0x0000040002ULL, 64.0}, { 334, 0x0000080002ULL, 64.0},
+    { 334, 0x0000048002ULL, -64.0}, { 334, 0x0000088002ULL, -64.0},
+    { 335, 0x000804a002ULL, 32.0}, { 336, 0x0040242202ULL, -5.333333333333333},
+    { 336, 0x0008242202ULL, 16.0}, { 336, 0x0008442202ULL, 10.666666666666666},
+    { 336, 0x0040282202ULL, 10.666666666666666}, { 336, 0x0040242042ULL, 5.333333333333333},
+    { 336, 0x0008242042ULL, -16.0}, { 336, 0x0008442042ULL, -10.666666666666666},
+    { 336, 0x0040282042ULL, -10.666666666666666}, { 336, 0x0000240242ULL, 32.0},
+    { 336, 0x0000440242ULL, 10.666666666666666}, { 336, 0x0000280242ULL, -32.0},
+    { 336, 0x0000480242ULL, -10.666666666666666}, { 336, 0x0000682242ULL, 5.333333333333333},
+    { 336, 0x0000240012ULL, 64.0}, { 336, 0x0000440012ULL, -21.333333333333332},
+    { 336, 0x0000280012ULL, 64.0}, { 336, 0x0000480012ULL, -21.333333333333332},
+    { 336, 0x0000682012ULL, 10.666666666666666}, { 336, 0x0000440203ULL, -10.666666666666666},
+    { 336, 0x0000280203ULL, -32.0}, { 336, 0x0000682203ULL, 5.333333333333333},
+    { 336, 0x0000440043ULL, 10.666666666666666}, { 336, 0x0000280043ULL, 32.0},
+    { 336, 0x0000682043ULL, -5.333333333333333}, { 336, 0x0000240004ULL, -32.0},
+    { 336, 0x0000440004ULL, -10.666666666666666}, { 336, 0x0000280004ULL, 32.0},
+    { 336, 0x0000480004ULL, 10.666666666666666}, { 336, 0x0000682004ULL, -5.333333333333333},
+    { 337, 0x0000082002ULL, -64.0}, { 338, 0x0000482242ULL, 5.333333333333333},
+    { 338, 0x0000482012ULL, 10.666666666666666}, { 338, 0x0000482203ULL, -5.333333333333333},
+    { 338, 0x0000482043ULL, 5.333333333333333}, { 338, 0x0000482004ULL, -5.333333333333333},
+    { 339, 0x0000080082ULL, 16.0}, { 339, 0x00000c0082ULL, -32.0},
+    { 339, 0x0000100082ULL, 16.0}, { 339, 0x0000080012ULL, 32.0},
+    { 339, 0x00000c0012ULL, 64.0}, { 339, 0x0000100012ULL, 32.0},
+    { 339, 0x0000080004ULL, -16.0}, { 339, 0x00000c0004ULL, 32.0},
+    { 339, 0x0000100004ULL, -16.0}, { 340, 0x0000102082ULL, -16.0},
+    { 340, 0x0000102012ULL, -32.0}, { 340, 0x0000102004ULL, 16.0},
+    { 341, 0x0040208002ULL, 21.333333333333332}, { 342, 0x0008048002ULL, 64.0},
+    { 343, 0x0040240202ULL, -10.666666666666666}, { 343, 0x0008240202ULL, 32.0},
+    { 343, 0x0008440202ULL, 10.666666666666666}, { 343, 0x0040280202ULL, 10.666666666666666},
+    { 343, 0x0040240042ULL, 10.666666666666666}, { 343, 0x0008240042ULL, -32.0},
+    { 343, 0x0008440042ULL, -10.666666666666666}, { 343, 0x0040280042ULL, -10.666666666666666},
+    { 344, 0x0040208002ULL, 21.333333333333332}, { 345, 0x0008048002ULL, 64.0},
+    { 346, 0x0040240202ULL, -10.666666666666666}, { 346, 0x0008240202ULL, 32.0},
+    { 346, 0x0008440202ULL, -10.666666666666666}, { 346, 0x0040280202ULL, -10.666666666666666},
+    { 346, 0x0040240042ULL, 10.666666666666666}, { 346, 0x0008240042ULL, -32.0},
+    { 346, 0x0008440042ULL, 10.666666666666666}, { 346, 0x0040280042ULL, 10.666666666666666},
+    { 347, 0x0000200002ULL, 64.0}, { 347, 0x0000400002ULL, -21.333333333333332},
+    { 347, 0x0000208002ULL, -64.0}, { 347, 0x0000408002ULL, 21.333333333333332},
+    { 347, 0x0040200202ULL, -10.666666666666666}, { 347, 0x0040208202ULL, -10.666666666666666},
+    { 347, 0x0040200003ULL, -10.666666666666666}, { 347, 0x0040208003ULL, 32.0},
+    { 348, 0x004020a002ULL, 10.666666666666666}, { 348, 0x0040208012ULL, -21.333333333333332},
+    { 349, 0x0000400012ULL, 32.0}, { 349, 0x0000600012ULL, -21.333333333333332},
+    { 349, 0x0000800012ULL, 3.5555555555555554}, { 349, 0x0080402012ULL, 5.333333333333333},
+    { 349, 0x0000c04012ULL, 1.7777777777777777}, { 349, 0x0040400212ULL, 10.666666666666666},
+    { 349, 0x0040600212ULL, 3.5555555555555554}, { 349, 0x0040400013ULL, -32.0},
+    { 349, 0x0040600013ULL, 3.5555555555555554}, { 350, 0x0000604002ULL, -5.333333333333333},
+    { 350, 0x0000602012ULL, 10.666666666666666}, { 351, 0x0000002002ULL, -16.0},
+    { 352, 0x0000040002ULL, 64.0}, { 352, 0x0000080002ULL, 64.0},
+    { 352, 0x0000048002ULL, -64.0}, { 352, 0x0000088002ULL, -64.0},
+    { 352, 0x0008040042ULL, -32.0}, { 352, 0x0008048042ULL, -32.0},
+    { 352, 0x0008040003ULL, -32.0}, { 352, 0x0008048003ULL, 96.0},
+    { 353, 0x000804a002ULL, 32.0}, { 353, 0x0008048012ULL, -64.0},
+    { 354, 0x0000240012ULL, 64.0}, { 354, 0x0000440012ULL, -21.333333333333332},
+    { 354, 0x0000280012ULL, 64.0}, { 354, 0x0000480012ULL, -21.333333333333332},
+    { 354, 0x0048242012ULL, 32.0}, { 354, 0x0040240212ULL, 5.333333333333333},
+    { 354, 0x0008240212ULL, 16.0}, { 354, 0x0008440212ULL, 5.333333333333333},
+    { 354, 0x0040280212ULL, -5.333333333333333}, { 354, 0x0040240052ULL, 5.333333333333333},
+    { 354, 0x0008240052ULL, 16.0}, { 354, 0x0008440052ULL, 5.333333333333333},
+    { 354, 0x0040280052ULL, -5.333333333333333}, { 354, 0x0040240013ULL, -32.0},
+    { 354, 0x0008240013ULL, -96.0}, { 354, 0x0008440013ULL, 10.666666666666666},
+    { 354, 0x0040280013ULL, -10.666666666666666}, { 355, 0x0000684012ULL, -10.666666666666666},
+    { 356, 0x0000084002ULL, 16.0}, { 356, 0x0000082012ULL, -32.0},
+    { 357, 0x0000080012ULL, 32.0}, { 357, 0x00000c0012ULL, 64.0},
+    { 357, 0x0000100012ULL, 32.0}, { 357, 0x0010082012ULL, 48.0},
+    { 357, 0x0008080052ULL, 32.0}, { 357, 0x00080c0052ULL, -32.0},
+    { 357, 0x0008080013ULL, -96.0}, { 357, 0x00080c0013ULL, -32.0},
+    { 358, 0x0000104012ULL, 16.0}, { 359, 0x0080400402ULL, 3.5555555555555554},
+    { 359, 0x0000c02402ULL, 1.7777777777777777}, { 359, 0x0080400012ULL, 7.111111111111111},
+    { 359, 0x0000c02012ULL, 3.5555555555555554}, { 359, 0x0080400004ULL, -3.5555555555555554},
+    { 359, 0x0000c02004ULL, -1.7777777777777777}, { 360, 0x0000602002ULL, -10.666666666666666},
+    { 361, 0x0048240242ULL, 21.333333333333332}, { 361, 0x0048240012ULL, 42.666666666666664},
+    { 361, 0x0048240004ULL, -21.333333333333332}, { 362, 0x0000682242ULL, -10.666666666666666},
+    { 362, 0x0000682012ULL, -21.333333333333332}, { 362, 0x0000682004ULL, 10.666666666666666},
+    { 363, 0x0000082002ULL, 32.0}, { 364, 0x0010080082ULL, 32.0},
+    { 364, 0x0010080012ULL, 64.0}, { 364, 0x0010080004ULL, -32.0},
+    { 365, 0x0000102082ULL, 16.0}, { 365, 0x0000102012ULL, 32.0},
+    { 365, 0x0000102004ULL, -16.0}, { 366, 0x0040208002ULL, 42.666666666666664},
+    { 367, 0x0000c02402ULL, -1.7777777777777777}, { 367, 0x0000c02012ULL, -3.5555555555555554},
+    { 367, 0x0000c02004ULL, 1.7777777777777777}, { 368, 0x0000602002ULL, 10.666666666666666},
+    { 369, 0x0008048002ULL, 128.0}, { 370, 0x0008440202ULL, -21.333333333333332},
+    { 370, 0x0040280202ULL, -21.333333333333332}, { 370, 0x0008440042ULL, 21.333333333333332},
+    { 370, 0x0040280042ULL, 21.333333333333332}, { 371, 0x0000682242ULL, 10.666666666666666},
+    { 371, 0x0000682012ULL, 21.333333333333332}, { 371, 0x0000682004ULL, -10.666666666666666},
+    { 372, 0x0000082002ULL, -32.0}, { 373, 0x0000102082ULL, -16.0},
+    { 373, 0x0000102012ULL, -32.0}, { 373, 0x0000102004ULL, 16.0},
+    { 374, 0x0080400012ULL, -7.111111111111111}, { 374, 0x0000c02012ULL, -3.5555555555555554},
+    { 375, 0x0000602002ULL, 10.666666666666666}, { 376, 0x0048240012ULL, -42.666666666666664},
+    { 377, 0x0000682012ULL, 21.333333333333332}, { 378, 0x0000082002ULL, -32.0},
+    { 379, 0x0010080012ULL, -64.0}, { 380, 0x0000102012ULL, -32.0},
+    { 381, 0x0000400003ULL, -32.0}, { 381, 0x0000600003ULL, 21.333333333333332},
+    { 381, 0x0000800003ULL, -3.5555555555555554}, { 381, 0x0000a02003ULL, 3.5555555555555554},
+    { 382, 0x0000240003ULL, -64.0}, { 382, 0x0000440003ULL, 21.333333333333332},
+    { 382, 0x0000280003ULL, -64.0}, { 382, 0x0000480003ULL, 21.333333333333332},
+    { 382, 0x0000682003ULL, -10.666666666666666}, { 383, 0x0000482003ULL, -10.666666666666666},
+    { 384, 0x0000080003ULL, -32.0}, { 384, 0x00000c0003ULL, -64.0},
+    { 384, 0x0000100003ULL, -32.0}, { 385, 0x0000102003ULL, 32.0},
+    { 386, 0x0000400003ULL, -32.0}, { 386, 0x0000600003ULL, 21.333333333333332},
+    { 386, 0x0000800003ULL, -3.5555555555555554}, { 386, 0x0080402003ULL, -5.333333333333333},
+    { 386, 0x0000c04003ULL, -1.7777777777777777}, { 386, 0x0040400203ULL, -21.333333333333332},
+    { 386, 0x0040600203ULL, -7.111111111111111}, { 386, 0x0040400004ULL, 21.333333333333332},
+    { 386, 0x0040600004ULL, -7.111111111111111}, { 387, 0x0000602003ULL, -10.666666666666666},
+    { 388, 0x0000240003ULL, -64.0}, { 388, 0x0000440003ULL, 21.333333333333332},
+    { 388, 0x0000280003ULL, -64.0}, { 388, 0x0000480003ULL, 21.333333333333332},
+    { 388, 0x0048242003ULL, -32.0}, { 388, 0x0040240203ULL, -10.666666666666666},
+    { 388, 0x0008240203ULL, -32.0}, { 388, 0x0008440203ULL, -10.666666666666666},
+    { 388, 0x0040280203ULL, 10.666666666666666}, { 388, 0x0040240043ULL, -10.666666666666666},
+    { 388, 0x0008240043ULL, -32.0}, { 388, 0x0008440043ULL, -10.666666666666666},
+    { 388, 0x0040280043ULL, 10.666666666666666}, { 388, 0x0040240004ULL, 21.333333333333332},
+    { 388, 0x0008240004ULL, 64.0}, { 388, 0x0008440004ULL, -21.333333333333332},
+    { 388, 0x0040280004ULL, 21.333333333333332}, { 389, 0x0000684003ULL, 10.666666666666666},
+    { 390, 0x0000082003ULL, 32.0}, { 391, 0x0000080003ULL, -32.0},
+    { 391, 0x00000c0003ULL, -64.0}, { 391, 0x0000100003ULL, -32.0},
+    { 391, 0x0010082003ULL, -48.0}, { 391, 0x0008080043ULL, -64.0},
+    { 391, 0x00080c0043ULL, 64.0}, { 391, 0x0008080004ULL, 64.0},
+    { 391, 0x00080c0004ULL, 64.0}, { 392, 0x0000104003ULL, -16.0},
+    { 393, 0x0080400003ULL, -7.111111111111111}, { 393, 0x0000c02003ULL, -3.5555555555555554},
+    { 394, 0x0048240003ULL, -42.666666666666664}, { 395, 0x0000682003ULL, 21.333333333333332},
+    { 396, 0x0010080003ULL, -64.0}, { 397, 0x0000102003ULL, -32.0},
+    { 398, 0x0000c02003ULL, 3.5555555555555554}, { 399, 0x0000682003ULL, -21.333333333333332},
+    { 400, 0x0000102003ULL, 32.0}, { 401, 0x0080400003ULL, 7.111111111111111},
+    { 401, 0x0000c02003ULL, 3.5555555555555554}, { 402, 0x0048240003ULL, 42.666666666666664},
+    { 403, 0x0000682003ULL, -21.333333333333332}, { 404, 0x0010080003ULL, 64.0},
+    { 405, 0x0000102003ULL, 32.0}, { 406, 0x0040200202ULL, 10.666666666666666},
+    { 406, 0x0040208202ULL, 10.666666666666666}, { 406, 0x0040200003ULL, 10.666666666666666},
+    { 406, 0x0040208003ULL, 10.666666666666666}, { 407, 0x0008040042ULL, 32.0},
+    { 407, 0x0008048042ULL, 32.0}, { 407, 0x0008040003ULL, 32.0},
+    { 407, 0x0008048003ULL, 32.0}, { 408, 0x0040240212ULL, -5.333333333333333},
+    { 408, 0x0008240212ULL, 16.0}, { 408, 0x0008440212ULL, 5.333333333333333},
+    { 408, 0x0040280212ULL, 5.333333333333333}, { 408, 0x0040240052ULL, 5.333333333333333},
+    { 408, 0x0008240052ULL, -16.0}, { 408, 0x0008440052ULL, -5.333333333333333},
+    { 408, 0x0040280052ULL, -5.333333333333333}, { 409, 0x0080400412ULL, -1.7777777777777777},
+    { 409, 0x0000c02412ULL, -0.8888888888888888}, { 409, 0x0080400022ULL, 1.7777777777777777},
+    { 409, 0x0000c02022ULL, 0.8888888888888888}, { 409, 0x0080400213ULL, -3.5555555555555554},
+    { 409, 0x0000c02213ULL, -1.7777777777777777}, { 409, 0x0080400014ULL, -1.7777777777777777},
+    { 409, 0x0000c02014ULL, -0.8888888888888888}, { 410, 0x0000602012ULL, -5.333333333333333},
+    { 411, 0x0000002002ULL, 8.0}, { 412, 0x0048240252ULL, -10.666666666666666},
+    { 412, 0x0048240022ULL, 10.666666666666666}, { 412, 0x0048240213ULL, -10.666666666666666},
+    { 412, 0x0048240053ULL, -10.666666666666666}, { 412, 0x0048240014ULL, -10.666666666666666},
+    { 413, 0x0000682252ULL, 5.333333333333333}, { 413, 0x0000682022ULL, -5.333333333333333},
+    { 413, 0x0000682213ULL, 5.333333333333333}, { 413, 0x0000682053ULL, 5.333333333333333},
+    { 413, 0x0000682014ULL, 5.333333333333333}, { 414, 0x0000082012ULL, 16.0},
+    { 415, 0x0010080092ULL, -16.0}, { 415, 0x0010080022ULL, 16.0},
+    { 415, 0x0010080053ULL, -32.0}, { 415, 0x0010080014ULL, -16.0},
+    { 416, 0x0000102092ULL, -8.0}, { 416, 0x0000102022ULL, 8.0},
+    { 416, 0x0000102053ULL, -16.0}, { 416, 0x0000102014ULL, -8.0},
+    { 417, 0x0040240203ULL, 10.666666666666666}, { 417, 0x0008240203ULL, -32.0},
+    { 417, 0x0008440203ULL, -10.666666666666666}, { 417, 0x0040280203ULL, -10.666666666666666},
+    { 417, 0x0040240043ULL, -10.666666666666666}, { 417, 0x0008240043ULL, 32.0},
+    { 417, 0x0008440043ULL, 10.666666666666666}, { 417, 0x0040280043ULL, 10.666666666666666},
+    { 418, 0x0080400013ULL, -7.111111111111111}, { 418, 0x0000c02013ULL, -3.5555555555555554},
+    { 419, 0x0000602003ULL, 10.666666666666666}, { 420, 0x0048240013ULL, -42.666666666666664},
+    { 421, 0x0000682013ULL, 21.333333333333332}, { 422, 0x0000082003ULL, -32.0},
+    { 423, 0x0010080013ULL, -64.0}, { 424, 0x0000102013ULL, -32.0},
+    { 425, 0x0080400004ULL, 7.111111111111111}, { 425, 0x0000c02004ULL, 3.5555555555555554},
+    { 426, 0x0048240004ULL, 42.666666666666664}, { 427, 0x0000682004ULL, -21.333333333333332},
+    { 428, 0x0010080004ULL, 64.0}, { 429, 0x0000102004ULL, 32.0},
+    { 430, 0x0000002001ULL, -32.0}, { 430, 0x000000a001ULL, -64.0},
+    { 430, 0x0000012001ULL, -32.0}, { 431, 0x0000202011ULL, 32.0},
+    { 431, 0x0000402011ULL, 10.666666666666666}, { 431, 0x000020a011ULL, 32.0},
+    { 431, 0x000040a011ULL, 10.666666666666666}, { 431, 0x0000604011ULL, -5.333333333333333},
+    { 431, 0x004020a211ULL, -5.333333333333333}, { 431, 0x004020a012ULL, -16.0},
+    { 432, 0x004020c011ULL, 5.333333333333333}, { 432, 0x000020a211ULL, 16.0},
+    { 432, 0x000040a211ULL, 10.666666666666666}, { 432, 0x000020a012ULL, 16.0},
+    { 432, 0x000040a012ULL, 10.666666666666666}, { 433, 0x0000402411ULL, 8.0},
+    { 433, 0x0000602411ULL, 5.333333333333333}, { 433, 0x0000802411ULL, 0.8888888888888888},
+    { 433, 0x0000a04411ULL, -0.8888888888888888}, { 433, 0x0000402021ULL, -8.0},
+    { 433, 0x0000602021ULL, -5.333333333333333}, { 433, 0x0000802021ULL, -0.8888888888888888},
+    { 433, 0x0000a04021ULL, 0.8888888888888888}, { 433, 0x0000402212ULL, 16.0},
+    { 433, 0x0000602212ULL, 10.666666666666666}, { 433, 0x0000802212ULL, 1.7777777777777777},
+    { 433, 0x0000a04212ULL, -1.7777777777777777}, { 433, 0x0040602412ULL, -3.5555555555555554},
+    { 433, 0x0040402022ULL, 5.333333333333333}, { 433, 0x0000402013ULL, 8.0},
+    { 433, 0x0000602013ULL, 5.333333333333333}, { 433, 0x0000802013ULL, 0.8888888888888888},
+    { 433, 0x0000a04013ULL, -0.8888888888888888}, { 433, 0x0040602213ULL, -7.111111111111111},
+    { 433, 0x0040602014ULL, -3.5555555555555554}, { 434, 0x0000004001ULL, 16.0},
+    { 434, 0x0000002011ULL, -16.0}, { 435, 0x0000404011ULL, -2.6666666666666665},
+    { 435, 0x0000402021ULL, 2.6666666666666665}, { 436, 0x0000042011ULL, 32.0},
+    { 436, 0x0000082011ULL, -32.0}, { 436, 0x000004a011ULL, 32.0},
+    { 436, 0x000008a011ULL, -32.0}, { 436, 0x000804a051ULL, -16.0},
+    { 436, 0x000804a012ULL, -48.0}, { 437, 0x000804c011ULL, 16.0},
+    { 437, 0x000004a051ULL, 16.0}, { 437, 0x000008a051ULL, -32.0},
+    { 437, 0x000004a012ULL, 16.0}, { 437, 0x000008a012ULL, -32.0},
+    { 438, 0x0000242251ULL, 16.0}, { 438, 0x0000442251ULL, 5.333333333333333},
+    { 438, 0x0000282251ULL, -16.0}, { 438, 0x0000482251ULL, -5.333333333333333},
+    { 438, 0x0000684251ULL, 2.6666666666666665}, { 438, 0x0000242021ULL, -16.0},
+    { 438, 0x0000442021ULL, -5.333333333333333}, { 438, 0x0000282021ULL, 16.0},
+    { 438, 0x0000482021ULL, 5.333333333333333}, { 438, 0x0000684021ULL, -2.6666666666666665},
+    { 438, 0x0040242221ULL, 2.6666666666666665}, { 438, 0x0008242221ULL, -8.0},
+    { 438, 0x0040242061ULL, -2.6666666666666665}, { 438, 0x0008242061ULL, 8.0},
+    { 438, 0x0000242212ULL, 16.0}, { 438, 0x0000442212ULL, 5.333333333333333},
+    { 438, 0x0000282212ULL, -16.0}, { 438, 0x0000482212ULL, -5.333333333333333},
+    { 438, 0x0000684212ULL, 2.6666666666666665}, { 438, 0x0000242052ULL, 16.0},
+    { 438, 0x0000442052ULL, 5.333333333333333}, { 438, 0x0000282052ULL, -16.0},
+    { 438, 0x0000482052ULL, -5.333333333333333}, { 438, 0x0000684052ULL, 2.6666666666666665},
+    { 438, 0x0008442252ULL, -10.666666666666666}, { 438, 0x0040282252ULL, 10.666666666666666},
+    { 438, 0x0040242022ULL, 5.333333333333333}, { 438, 0x0008242022ULL, 16.0},
+    { 438, 0x0000242013ULL, 16.0}, { 438, 0x0000442013ULL, 5.333333333333333},
+    { 438, 0x0000282013ULL, -16.0}, { 438, 0x0000482013ULL, -5.333333333333333},
+    { 438, 0x0000684013ULL, 2.6666666666666665}, { 438, 0x0008442213ULL, -10.666666666666666},
+    { 438, 0x0040282213ULL, 10.666666666666666}, { 438, 0x0008442053ULL, -10.666666666666666},
+    { 438, 0x0040282053ULL, 10.666666666666666}, { 438, 0x0008442014ULL, -10.666666666666666},
+    { 438, 0x0040282014ULL, 10.666666666666666}, { 439, 0x0000084011ULL, 24.0},
+    { 439, 0x0000082021ULL, -8.0}, { 440, 0x0000484251ULL, 2.6666666666666665},
+    { 440, 0x0000484021ULL, -2.6666666666666665}, { 440, 0x0000484212ULL, 2.6666666666666665},
+    { 440, 0x0000484052ULL, 2.6666666666666665}, { 440, 0x0000484013ULL, 2.6666666666666665},
+    { 441, 0x0000082091ULL, 8.0}, { 441, 0x00000c2091ULL, -16.0},
+    { 441, 0x0000102091ULL, 8.0}, { 441, 0x0000082021ULL, -8.0},
+    { 441, 0x00000c2021ULL, 16.0}, { 441, 0x0000102021ULL, -8.0},
+    { 441, 0x0000082052ULL, 16.0}, { 441, 0x00000c2052ULL, -32.0},
+    { 441, 0x0000102052ULL, 16.0}, { 441, 0x00080c2092ULL, 32.0},
+    { 441, 0x0008082022ULL, 16.0}, { 441, 0x0000082013ULL, 8.0},
+    { 441, 0x00000c2013ULL, -16.0}, { 441, 0x0000102013ULL, 8.0},
+    { 441, 0x00080c2053ULL, 64.0}, { 441, 0x00080c2014ULL, 32.0},
+    { 442, 0x0000104091ULL, -8.0}, { 442, 0x0000104021ULL, 8.0},
+    { 442, 0x0000104052ULL, -16.0}, { 442, 0x0000104013ULL, -8.0},
+    { 443, 0x0000000001ULL, -32.0}, { 443, 0x0000008001ULL, -64.0},
+    { 443, 0x0000010001ULL, -32.0}, { 444, 0x0040202201ULL, 10.666666666666666},
+    { 444, 0x004020a201ULL, 5.333333333333333}, { 444, 0x0000200011ULL, 32.0},
+    { 444, 0x0000400011ULL, 10.666666666666666}, { 444, 0x0000208011ULL, 32.0},
+    { 444, 0x0000408011ULL, 10.666666666666666}, { 444, 0x0000602011ULL, -5.333333333333333},
+    { 444, 0x0040202002ULL, 10.666666666666666}, { 444, 0x004020a002ULL, 5.333333333333333},
+    { 444, 0x0000400202ULL, -10.666666666666666}, { 444, 0x0000208202ULL, -32.0},
+    { 444, 0x0000408202ULL, 21.333333333333332}, { 444, 0x0000602202ULL, 10.666666666666666},
+    { 444, 0x0000400003ULL, -10.666666666666666}, { 444, 0x0000208003ULL, -32.0},
+    { 444, 0x0000408003ULL, 21.333333333333332}, { 444, 0x0000602003ULL, 10.666666666666666},
+    { 445, 0x000020a201ULL, 16.0}, { 445, 0x004020a011ULL, 16.0},
+    { 445, 0x0000208211ULL, 32.0}, { 445, 0x000020a002ULL, 16.0},
+    { 445, 0x0000208012ULL, 32.0}, { 446, 0x0000400411ULL, 8.0},
+    { 446, 0x0000600411ULL, 5.333333333333333}, { 446, 0x0000800411ULL, 0.8888888888888888},
+    { 446, 0x0000a02411ULL, -0.8888888888888888}, { 446, 0x0000400021ULL, -8.0},
+    { 446, 0x0000600021ULL, -5.333333333333333}, { 446, 0x0000800021ULL, -0.8888888888888888},
+    { 446, 0x0000a02021ULL, 0.8888888888888888}, { 446, 0x0000400212ULL, 32.0},
+    { 446, 0x0000800212ULL, 3.5555555555555554}, { 446, 0x0000a02212ULL, -3.5555555555555554},
+    { 446, 0x0000400013ULL, 24.0}, { 446, 0x0000600013ULL, -5.333333333333333},
+    { 446, 0x0000800013ULL, 2.6666666666666665}, { 446, 0x0000a02013ULL, -2.6666666666666665},
+    { 447, 0x0008042041ULL, 32.0}, { 447, 0x000804a041ULL, 16.0},
+    { 447, 0x0000040011ULL, 32.0}, { 447, 0x0000080011ULL, -32.0},
+    { 447, 0x0000048011ULL, 32.0}, { 447, 0x0000088011ULL, -32.0},
+    { 447, 0x0008042002ULL, 32.0}, { 447, 0x000804a002ULL, 16.0},
+    { 447, 0x0000080042ULL, 32.0}, { 447, 0x0000048042ULL, -32.0},
+    { 447, 0x0000088042ULL, -64.0}, { 447, 0x0000080003ULL, 32.0},
+    { 447, 0x0000048003ULL, -32.0}, { 447, 0x0000088003ULL, -64.0},
+    { 448, 0x000004a041ULL, 16.0}, { 448, 0x000804a011ULL, 48.0},
+    { 448, 0x0000048051ULL, 32.0}, { 448, 0x000004a002ULL, 16.0},
+    { 448, 0x0000048012ULL, 32.0}, { 449, 0x0040242211ULL, -2.6666666666666665},
+    { 449, 0x0008242211ULL, 8.0}, { 449, 0x0008442211ULL, 5.333333333333333},
+    { 449, 0x0040282211ULL, 5.333333333333333}, { 449, 0x0040242051ULL, 2.6666666666666665},
+    { 449, 0x0008242051ULL, -8.0}, { 449, 0x0008442051ULL, -5.333333333333333},
+    { 449, 0x0040282051ULL, -5.333333333333333}, { 449, 0x0000240251ULL, 16.0},
+    { 449, 0x0000440251ULL, 5.333333333333333}, { 449, 0x0000280251ULL, -16.0},
+    { 449, 0x0000480251ULL, -5.333333333333333}, { 449, 0x0000682251ULL, 2.6666666666666665},
+    { 449, 0x0000240021ULL, -16.0}, { 449, 0x0000440021ULL, -5.333333333333333},
+    { 449, 0x0000280021ULL, 16.0}, { 449, 0x0000480021ULL, 5.333333333333333},
+    { 449, 0x0000682021ULL, -2.6666666666666665}, { 449, 0x0000240212ULL, 32.0},
+    { 449, 0x0000440212ULL, -5.333333333333333}, { 449, 0x0000280212ULL, -16.0},
+    { 449, 0x0000480212ULL, -10.666666666666666}, { 449, 0x0000682212ULL, 8.0},
+    { 449, 0x0000240052ULL, 32.0}, { 449, 0x0000440052ULL, 5.333333333333333},
+    { 449, 0x0000280052ULL, 16.0}, { 449, 0x0000480052ULL, -10.666666666666666},
+    { 449, 0x0000682052ULL, 2.6666666666666665}, { 449, 0x0000240013ULL, 48.0},
+    { 449, 0x0000440013ULL, -5.333333333333333}, { 449, 0x0000280013ULL, 16.0},
+    { 449, 0x0000480013ULL, -16.0}, { 449, 0x0000682013ULL, 8.0},
+    { 450, 0x0000082011ULL, 16.0}, { 450, 0x0000082042ULL, -32.0},
+    { 450, 0x0000082003ULL, -32.0}, { 451, 0x0000482251ULL, 2.6666666666666665},
+    { 451, 0x0000482021ULL, -2.6666666666666665}, { 451, 0x0000482212ULL, 2.6666666666666665},
+    { 451, 0x0000482052ULL, 8.0}, { 451, 0x0000482013ULL, 8.0},
+    { 452, 0x0000080091ULL, 8.0}, { 452, 0x00000c0091ULL, -16.0},
+    { 452, 0x0000100091ULL, 8.0}, { 452, 0x0000080021ULL, -8.0},
+    { 452, 0x00000c0021ULL, 16.0}, { 452, 0x0000100021ULL, -8.0},
+    { 452, 0x0000080052ULL, 32.0}, { 452, 0x0000100052ULL, 32.0},
+    { 452, 0x0000080013ULL, 24.0}, { 452, 0x00000c0013ULL, 16.0},
+    { 452, 0x0000100013ULL, 24.0}, { 453, 0x0000102091ULL, -8.0},
+    { 453, 0x0000102021ULL, 8.0}, { 453, 0x0000102052ULL, -32.0},
+    { 453, 0x0000102013ULL, -24.0}, { 454, 0x0040200201ULL, 10.666666666666666},
+    { 454, 0x0040208201ULL, 10.666666666666666}, { 454, 0x0040200002ULL, 10.666666666666666},
+    { 454, 0x0040208002ULL, 10.666666666666666}, { 455, 0x0000208201ULL, 32.0},
+    { 455, 0x0000408201ULL, -10.666666666666666}, { 455, 0x0040208011ULL, 10.666666666666666},
+    { 455, 0x0000208002ULL, 32.0}, { 455, 0x0000408002ULL, -10.666666666666666},
+    { 456, 0x0008040041ULL, 32.0}, { 456, 0x0008048041ULL, 32.0},
+    { 456, 0x0008040002ULL, 32.0}, { 456, 0x0008048002ULL, 32.0},
+    { 457, 0x0000048041ULL, 32.0}, { 457, 0x0000088041ULL, 32.0},
+    { 457, 0x0008048011ULL, 32.0}, { 457, 0x0000048002ULL, 32.0},
+    { 457, 0x0000088002ULL, 32.0}, { 458, 0x0040240211ULL, -5.333333333333333},
+    { 458, 0x0008240211ULL, 16.0}, { 458, 0x0008440211ULL, 5.333333333333333},
+    { 458, 0x0040280211ULL, 5.333333333333333}, { 458, 0x0040240051ULL, 5.333333333333333},
+    { 458, 0x0008240051ULL, -16.0}, { 458, 0x0008440051ULL, -5.333333333333333},
+    { 458, 0x0040280051ULL, -5.333333333333333}, { 459, 0x0000012001ULL, 64.0},
+    { 460, 0x0000602011ULL, 10.666666666666666}, { 460, 0x0000602202ULL, -10.666666666666666},
+    { 460, 0x0000602003ULL, -10.666666666666666}, { 461, 0x004020a011ULL, 10.666666666666666},
+    { 462, 0x0080402411ULL, -1.7777777777777777}, { 462, 0x0000a02411ULL, 1.7777777777777777},
+    { 462, 0x0080402021ULL, 1.7777777777777777}, { 462, 0x0000a02021ULL, -1.7777777777777777},
+    { 462, 0x0080402212ULL, -7.111111111111111}, { 462, 0x0000a02212ULL, 7.111111111111111},
+    { 462, 0x0080402013ULL, -5.333333333333333}, { 462, 0x0000a02013ULL, 5.333333333333333},
+    { 463, 0x0000002001ULL, -32.0}, { 464, 0x0000402011ULL, 5.333333333333333},
+    { 464, 0x0000402202ULL, -5.333333333333333}, { 464, 0x0000402003ULL, -5.333333333333333},
+    { 465, 0x000804a011ULL, 32.0}, { 466, 0x0048242251ULL, -10.666666666666666},
+    { 466, 0x0000682251ULL, -5.333333333333333}, { 466, 0x0048242021ULL, 10.666666666666666},
+    { 466, 0x0000682021ULL, 5.333333333333333}, { 466, 0x0048242212ULL, -21.333333333333332},
+    { 466, 0x0000682212ULL, -10.666666666666666}, { 466, 0x0048242052ULL, -21.333333333333332},
+    { 466, 0x0000682052ULL, -10.666666666666666}, { 466, 0x0048242013ULL, -32.0},
+    { 466, 0x0000682013ULL, -16.0}, { 467, 0x0000082011ULL, -48.0},
+    { 467, 0x0000082042ULL, 48.0}, { 467, 0x0000082003ULL, 48.0},
+    { 468, 0x0000482251ULL, -5.333333333333333}, { 468, 0x0000482021ULL, 5.333333333333333},
+    { 468, 0x0000482212ULL, -10.666666666666666}, { 468, 0x0000482052ULL, -10.666666666666666},
+    { 468, 0x0000482013ULL, -16.0}, { 469, 0x0010082091ULL, -16.0},
+    { 469, 0x0010082021ULL, 16.0}, { 469, 0x0010082052ULL, -64.0},
+    { 469, 0x0010082013ULL, -48.0}, { 470, 0x0000102091ULL, 16.0},
+    { 470, 0x0000102021ULL, -16.0}, { 470, 0x0000102052ULL, 64.0},
+    { 470, 0x0000102013ULL, 48.0}, { 471, 0x0000010001ULL, 128.0},
+    { 472, 0x0040200201ULL, -10.666666666666666}, { 472, 0x0040208201ULL, 10.666666666666666},
+    { 472, 0x0040200002ULL, -10.666666666666666}, { 472, 0x0040208002ULL, 10.666666666666666},
+    { 473, 0x0000208201ULL, 32.0}, { 473, 0x0000408201ULL, 10.666666666666666},
+    { 473, 0x0040208011ULL, 10.666666666666666}, { 473, 0x0000208002ULL, 32.0},
+    { 473, 0x0000408002ULL, 10.666666666666666}, { 474, 0x0008040041ULL, -32.0},
+    { 474, 0x0008048041ULL, 32.0}, { 474, 0x0008040002ULL, -32.0},
+    { 474, 0x0008048002ULL, 32.0}, { 475, 0x0000048041ULL, 32.0},
+    { 475, 0x0000088041ULL, -32.0}, { 475, 0x0008048011ULL, 32.0},
+    { 475, 0x0000048002ULL, 32.0}, { 475, 0x0000088002ULL, -32.0},
+    { 476, 0x0040240211ULL, -5.333333333333333}, { 476, 0x0008240211ULL, 16.0},
+    { 476, 0x0008440211ULL, -5.333333333333333}, { 476, 0x0040280211ULL, -5.333333333333333},
+    { 476, 0x0040240051ULL, 5.333333333333333}, { 476, 0x0008240051ULL, -16.0},
+    { 476, 0x0008440051ULL, 5.333333333333333}, { 476, 0x0040280051ULL, 5.333333333333333},
+    { 477, 0x0000000001ULL, 32.0}, { 477, 0x0000008001ULL, 64.0},
+    { 477, 0x0000010001ULL, 32.0}, { 478, 0x0000012001ULL, 16.0},
+    { 478, 0x0000010011ULL, -64.0}, { 479, 0x0000200011ULL, -32.0},
+    { 479, 0x0000400011ULL, -10.666666666666666}, { 479, 0x0000208011ULL, -32.0},
+    { 479, 0x0000408011ULL, -10.666666666666666}, { 479, 0x0000602011ULL, 10.666666666666666},
+    { 479, 0x0040208012ULL, 21.333333333333332}, { 480, 0x004020a011ULL, -5.333333333333333},
+    { 480, 0x0000208211ULL, -32.0}, { 480, 0x0000408211ULL, -10.666666666666666},
+    { 480, 0x0040208021ULL, -10.666666666666666}, { 480, 0x0000208012ULL, -32.0},
+    { 480, 0x0000408012ULL, -10.666666666666666}, { 481, 0x0000400411ULL, -8.0},
+    { 481, 0x0000600411ULL, -5.333333333333333}, { 481, 0x0000800411ULL, -0.8888888888888888},
+    { 481, 0x0080402411ULL, -1.3333333333333333}, { 481, 0x0000a02411ULL, 1.7777777777777777},
+    { 481, 0x0000c04411ULL, -0.4444444444444444}, { 481, 0x0000400021ULL, 8.0},
+    { 481, 0x0000600021ULL, 5.333333333333333}, { 481, 0x0000800021ULL, 0.8888888888888888},
+    { 481, 0x0080402021ULL, 1.3333333333333333}, { 481, 0x0000a02021ULL, -1.7777777777777777},
+    { 481, 0x0000c04021ULL, 0.4444444444444444}, { 481, 0x0000400212ULL, -16.0},
+    { 481, 0x0000600212ULL, -10.666666666666666}, { 481, 0x0000800212ULL, -1.7777777777777777},
+    { 481, 0x0080402212ULL, -2.6666666666666665}, { 481, 0x0000a02212ULL, 3.5555555555555554},
+    { 481, 0x0000c04212ULL, -0.8888888888888888}, { 481, 0x0040600412ULL, 3.5555555555555554},
+    { 481, 0x0040400022ULL, -10.666666666666666}, { 481, 0x0000400013ULL, -8.0},
+    { 481, 0x0000600013ULL, -5.333333333333333}, { 481, 0x0000800013ULL, -0.8888888888888888},
+    { 481, 0x0080402013ULL, -1.3333333333333333}, { 481, 0x0000a02013ULL, 1.7777777777777777},
+    { 481, 0x0000c04013ULL, -0.4444444444444444}, { 481, 0x0040600213ULL, 7.111111111111111},
+    { 481, 0x0040600014ULL, 3.5555555555555554}, { 482, 0x0000002001ULL, -32.0},
+    { 483, 0x0000402011ULL, 5.333333333333333}, { 483, 0x0000604011ULL, -2.6666666666666665},
+    { 483, 0x0000602021ULL, 2.6666666666666665}, { 484, 0x0000004001ULL, 4.0},
+    { 484, 0x0000002011ULL, -12.0}, { 485, 0x0000040011ULL, -32.0},
+    { 485, 0x0000080011ULL, 32.0}, { 485, 0x0000048011ULL, -32.0},
+    { 485, 0x0000088011ULL, 32.0}, { 485, 0x0008048012ULL, 64.0},
+    { 486, 0x000804a011ULL, -16.0}, { 486, 0x0000048051ULL, -32.0},
+    { 486, 0x0000088051ULL, 32.0}, { 486, 0x0008048021ULL, -32.0},
+    { 486, 0x0000048012ULL, -32.0}, { 486, 0x0000088012ULL, 32.0},
+    { 487, 0x0000240251ULL, -16.0}, { 487, 0x0000440251ULL, -5.333333333333333},
+    { 487, 0x0000280251ULL, 16.0}, { 487, 0x0000480251ULL, 5.333333333333333},
+    { 487, 0x0048242251ULL, -8.0}, { 487, 0x0000682251ULL, -5.333333333333333},
+    { 487, 0x0000240021ULL, 16.0}, { 487, 0x0000440021ULL, 5.333333333333333},
+    { 487, 0x0000280021ULL, -16.0}, { 487, 0x0000480021ULL, -5.333333333333333},
+    { 487, 0x0048242021ULL, 8.0}, { 487, 0x0000682021ULL, 5.333333333333333},
+    { 487, 0x0000240212ULL, -16.0}, { 487, 0x0000440212ULL, -5.333333333333333},
+    { 487, 0x0000280212ULL, 16.0}, { 487, 0x0000480212ULL, 5.333333333333333},
+    { 487, 0x0048242212ULL, -8.0}, { 487, 0x0000682212ULL, -5.333333333333333},
+    { 487, 0x0000240052ULL, -16.0}, { 487, 0x0000440052ULL, -5.333333333333333},
+    { 487, 0x0000280052ULL, 16.0}, { 487, 0x0000480052ULL, 5.333333333333333},
+    { 487, 0x0048242052ULL, -8.0}, { 487, 0x0000682052ULL, -5.333333333333333},
+    { 487, 0x0008440252ULL, 10.666666666666666}, { 487, 0x0040280252ULL, -10.666666666666666},
+    { 487, 0x0040240022ULL, -10.666666666666666}, { 487, 0x0008240022ULL, -32.0},
+    { 487, 0x0000240013ULL, -16.0}, { 487, 0x0000440013ULL, -5.333333333333333},
+    { 487, 0x0000280013ULL, 16.0}, { 487, 0x0000480013ULL, 5.333333333333333},
+    { 487, 0x0048242013ULL, -8.0}, { 487, 0x0000682013ULL, -5.333333333333333},
+    { 487, 0x0008440213ULL, 10.666666666666666}, { 487, 0x0040280213ULL, -10.666666666666666},
+    { 487, 0x0008440053ULL, 10.666666666666666}, { 487, 0x0040280053ULL, -10.666666666666666},
+    { 487, 0x0008440014ULL, 10.666666666666666}, { 487, 0x0040280014ULL, -10.666666666666666},
+    { 488, 0x0000082011ULL, -48.0}, { 489, 0x0000482251ULL, -5.333333333333333},
+    { 489, 0x0000684251ULL, 2.6666666666666665}, { 489, 0x0000482021ULL, 5.333333333333333},
+    { 489, 0x0000684021ULL, -2.6666666666666665}, { 489, 0x0000482212ULL, -5.333333333333333},
+    { 489, 0x0000684212ULL, 2.6666666666666665}, { 489, 0x0000482052ULL, -5.333333333333333},
+    { 489, 0x0000684052ULL, 2.6666666666666665}, { 489, 0x0000482013ULL, -5.333333333333333},
+    { 489, 0x0000684013ULL, 2.6666666666666665}, { 490, 0x0000084011ULL, 8.0},
+    { 490, 0x0000082021ULL, -8.0}, { 491, 0x0000080091ULL, -8.0},
+    { 491, 0x00000c0091ULL, 16.0}, { 491, 0x0000100091ULL, -8.0},
+    { 491, 0x0010082091ULL, -12.0}, { 491, 0x0000080021ULL, 8.0},
+    { 491, 0x00000c0021ULL, -16.0}, { 491, 0x0000100021ULL, 8.0},
+    { 491, 0x0010082021ULL, 12.0}, { 491, 0x0000080052ULL, -16.0},
+    { 491, 0x00000c0052ULL, 32.0}, { 491, 0x0000100052ULL, -16.0},
+    { 491, 0x0010082052ULL, -24.0}, { 491, 0x00080c0092ULL, -32.0},
+    { 491, 0x0008080022ULL, -32.0}, { 491, 0x0000080013ULL, -8.0},
+    { 491, 0x00000c0013ULL, 16.0}, { 491, 0x0000100013ULL, -8.0},
+    { 491, 0x0010082013ULL, -12.0}, { 491, 0x00080c0053ULL, -64.0},
+    { 491, 0x00080c0014ULL, -32.0}, { 492, 0x0000102091ULL, 16.0},
+    { 492, 0x0000102021ULL, -16.0}, { 492, 0x0000102052ULL, 32.0},
+    { 492, 0x0000102013ULL, 16.0}, { 493, 0x0000104091ULL, -4.0},
+    { 493, 0x0000104021ULL, 4.0}, { 493, 0x0000104052ULL, -8.0},
+    { 493, 0x0000104013ULL, -4.0}, { 494, 0x0040200201ULL, -21.333333333333332},
+    { 494, 0x0040200002ULL, -21.333333333333332}, { 495, 0x0040208011ULL, -21.333333333333332},
+    { 496, 0x0000c02411ULL, -0.8888888888888888}, { 496, 0x0000c02021ULL, 0.8888888888888888},
+    { 496, 0x0000c02212ULL, -3.5555555555555554}, { 496, 0x0000c02013ULL, -2.6666666666666665},
+    { 497, 0x0000602011ULL, -5.333333333333333}, { 497, 0x0000602202ULL, 5.333333333333333},
+    { 497, 0x0000602003ULL, 5.333333333333333}, { 498, 0x0000002001ULL, 8.0},
+    { 499, 0x0008040041ULL, -64.0}, { 499, 0x0008040002ULL, -64.0},
+    { 500, 0x0008048011ULL, -64.0}, { 501, 0x0008440211ULL, -10.666666666666666},
+    { 501, 0x0040280211ULL, -10.666666666666666}, { 501, 0x0008440051ULL, 10.666666666666666},
+    { 501, 0x0040280051ULL, 10.666666666666666}, { 502, 0x0000682251ULL, 5.333333333333333},
+    { 502, 0x0000682021ULL, -5.333333333333333}, { 502, 0x0000682212ULL, 10.666666666666666},
+    { 502, 0x0000682052ULL, 10.666666666666666}, { 502, 0x0000682013ULL, 16.0},
+    { 503, 0x0000082011ULL, 16.0}, { 503, 0x0000082042ULL, -16.0},
+    { 503, 0x0000082003ULL, -16.0}, { 504, 0x0000102091ULL, -8.0},
+    { 504, 0x0000102021ULL, 8.0}, { 504, 0x0000102052ULL, -32.0},
+    { 504, 0x0000102013ULL, -24.0}, { 505, 0x0080400411ULL, 1.7777777777777777},
+    { 505, 0x0000c02411ULL, 0.8888888888888888}, { 505, 0x0080400021ULL, -1.7777777777777777},
+    { 505, 0x0000c02021ULL, -0.8888888888888888}, { 505, 0x0080400212ULL, 7.111111111111111},
+    { 505, 0x0000c02212ULL, 3.5555555555555554}, { 505, 0x0080400013ULL, 5.333333333333333},
+    { 505, 0x0000c02013ULL, 2.6666666666666665}, { 506, 0x0000602011ULL, 5.333333333333333},
+    { 506, 0x0000602202ULL, -5.333333333333333}, { 506, 0x0000602003ULL, -5.333333333333333},
+    { 507, 0x0000002001ULL, -8.0}, { 508, 0x0048240251ULL, 10.666666666666666},
+    { 508, 0x0048240021ULL, -10.666666666666666}, { 508, 0x0048240212ULL, 21.333333333333332},
+    { 508, 0x0048240052ULL, 21.333333333333332}, { 508, 0x0048240013ULL, 32.0},
+    { 509, 0x0000682251ULL, -5.333333333333333}, { 509, 0x0000682021ULL, 5.333333333333333},
+    { 509, 0x0000682212ULL, -10.666666666666666}, { 509, 0x0000682052ULL, -10.666666666666666},
+    { 509, 0x0000682013ULL, -16.0}, { 510, 0x0000082011ULL, -16.0},
+    { 510, 0x0000082042ULL, 16.0}, { 510, 0x0000082003ULL, 16.0},
+    { 511, 0x0010080091ULL, 16.0}, { 511, 0x0010080021ULL, -16.0},
+    { 511, 0x0010080052ULL, 64.0}, { 511, 0x0010080013ULL, 48.0},
+    { 512, 0x0000102091ULL, 8.0}, { 512, 0x0000102021ULL, -8.0},
+    { 512, 0x0000102052ULL, 32.0}, { 512, 0x0000102013ULL, 24.0},
+    { 513, 0x0080400411ULL, 1.7777777777777777}, { 513, 0x0000c02411ULL, 0.8888888888888888},
+    { 513, 0x0080400021ULL, -1.7777777777777777}, { 513, 0x0000c02021ULL, -0.8888888888888888},
+    { 513, 0x0080400212ULL, 3.5555555555555554}, { 513, 0x0000c02212ULL, 1.7777777777777777},
+    { 513, 0x0080400013ULL, 1.7777777777777777}, { 513, 0x0000c02013ULL, 0.8888888888888888},
+    { 514, 0x0000602011ULL, 5.333333333333333}, { 515, 0x0000002001ULL, -8.0},
+    { 516, 0x0048240251ULL, 10.666666666666666}, { 516, 0x0048240021ULL, -10.666666666666666},
+    { 516, 0x0048240212ULL, 10.666666666666666}, { 516, 0x0048240052ULL, 10.666666666666666},
+    { 516, 0x0048240013ULL, 10.666666666666666}, { 517, 0x0000682251ULL, -5.333333333333333},
+    { 517, 0x0000682021ULL, 5.333333333333333}, { 517, 0x0000682212ULL, -5.333333333333333},
+    { 517, 0x0000682052ULL, -5.333333333333333}, { 517, 0x0000682013ULL, -5.333333333333333},
+    { 518, 0x0000082011ULL, -16.0}, { 519, 0x0010080091ULL, 16.0},
+    { 519, 0x0010080021ULL, -16.0}, { 519, 0x0010080052ULL, 32.0},
+    { 519, 0x0010080013ULL, 16.0}, { 520, 0x0000102091ULL, 8.0},
+    { 520, 0x0000102021ULL, -8.0}, { 520, 0x0000102052ULL, 16.0},
+    { 520, 0x0000102013ULL, 8.0}, { 521, 0x0000202002ULL, -64.0},
+    { 521, 0x0000402002ULL, -21.333333333333332}, { 521, 0x000020a002ULL, -64.0},
+    { 521, 0x000040a002ULL, -21.333333333333332}, { 521, 0x0000604002ULL, 10.666666666666666},
+    { 521, 0x0040202202ULL, 10.666666666666666}, { 521, 0x0040202003ULL, 10.666666666666666},
+    { 521, 0x004020a003ULL, 21.333333333333332}, { 522, 0x004020c002ULL, -10.666666666666666},
+    { 523, 0x0000402012ULL, 32.0}, { 523, 0x0000602012ULL, 21.333333333333332},
+    { 523, 0x0000802012ULL, 3.5555555555555554}, { 523, 0x0000a04012ULL, -3.5555555555555554},
+    { 523, 0x0040402212ULL, 5.333333333333333}, { 523, 0x0040602212ULL, -3.5555555555555554},
+    { 523, 0x0040402013ULL, -16.0}, { 523, 0x0040602013ULL, -3.5555555555555554},
+    { 524, 0x0000002002ULL, 32.0}, { 525, 0x0000404002ULL, 5.333333333333333},
+    { 525, 0x0000402012ULL, -10.666666666666666}, { 526, 0x0000042002ULL, -64.0},
+    { 526, 0x0000082002ULL, 64.0}, { 526, 0x000004a002ULL, -64.0},
+    { 526, 0x000008a002ULL, 64.0}, { 526, 0x0008042042ULL, 32.0},
+    { 526, 0x0008042003ULL, 32.0}, { 526, 0x000804a003ULL, 64.0},
+    { 527, 0x000804c002ULL, -32.0}, { 528, 0x0000242012ULL, 64.0},
+    { 528, 0x0000442012ULL, 21.333333333333332}, { 528, 0x0000282012ULL, -64.0},
+    { 528, 0x0000482012ULL, -21.333333333333332}, { 528, 0x0000684012ULL, 10.666666666666666},
+    { 528, 0x0040242212ULL, -5.333333333333333}, { 528, 0x0008242212ULL, 32.0},
+    { 528, 0x0008442212ULL, -5.333333333333333}, { 528, 0x0040282212ULL, 5.333333333333333},
+    { 528, 0x0040242052ULL, 10.666666666666666}, { 528, 0x0008242052ULL, -16.0},
+    { 528, 0x0008442052ULL, -5.333333333333333}, { 528, 0x0040282052ULL, 5.333333333333333},
+    { 528, 0x0040242013ULL, -16.0}, { 528, 0x0008242013ULL, -48.0},
+    { 528, 0x0008442013ULL, -10.666666666666666}, { 528, 0x0040282013ULL, 10.666666666666666},
+    { 529, 0x0000084002ULL, -48.0}, { 529, 0x0000082012ULL, 32.0},
+    { 530, 0x0000484012ULL, 10.666666666666666}, { 531, 0x0000082012ULL, 32.0},
+    { 531, 0x00000c2012ULL, -64.0}, { 531, 0x0000102012ULL, 32.0},
+    { 531, 0x0008082052ULL, 16.0}, { 531, 0x00080c2052ULL, 32.0},
+    { 531, 0x0008082013ULL, -48.0}, { 531, 0x00080c2013ULL, 32.0},
+    { 532, 0x0000104012ULL, -32.0}, { 533, 0x0000200002ULL, -64.0},
+    { 533, 0x0000400002ULL, -21.333333333333332}, { 533, 0x0000208002ULL, -64.0},
+    { 533, 0x0000408002ULL, -21.333333333333332}, { 533, 0x0000602002ULL, 10.666666666666666},
+    { 534, 0x004020a002ULL, -32.0}, { 535, 0x0000400402ULL, 16.0},
+    { 535, 0x0000600402ULL, -10.666666666666666}, { 535, 0x0000800402ULL, 1.7777777777777777},
+    { 535, 0x0000a02402ULL, -1.7777777777777777}, { 535, 0x0000400012ULL, 32.0},
+    { 535, 0x0000600012ULL, 21.333333333333332}, { 535, 0x0000800012ULL, 3.5555555555555554},
+    { 535, 0x0000a02012ULL, -3.5555555555555554}, { 535, 0x0000400004ULL, -16.0},
+    { 535, 0x0000600004ULL, 10.666666666666666}, { 535, 0x0000800004ULL, -1.7777777777777777},
+    { 535, 0x0000a02004ULL, 1.7777777777777777}, { 536, 0x0000040002ULL, -64.0},
+    { 536, 0x0000080002ULL, 64.0}, { 536, 0x0000048002ULL, -64.0},
+    { 536, 0x0000088002ULL, 64.0}, { 537, 0x000804a002ULL, -96.0},
+    { 538, 0x0040242202ULL, 5.333333333333333}, { 538, 0x0008242202ULL, -16.0},
+    { 538, 0x0008442202ULL, -10.666666666666666}, { 538, 0x0040282202ULL, -10.666666666666666},
+    { 538, 0x0040242042ULL, -5.333333333333333}, { 538, 0x0008242042ULL, 16.0},
+    { 538, 0x0008442042ULL, 10.666666666666666}, { 538, 0x0040282042ULL, 10.666666666666666},
+    { 538, 0x0000240242ULL, 32.0}, { 538, 0x0000440242ULL, -10.666666666666666},
+    { 538, 0x0000280242ULL, 32.0}, { 538, 0x0000480242ULL, -10.666666666666666},
+    { 538, 0x0000682242ULL, 5.333333333333333}, { 538, 0x0000240012ULL, 64.0},
+    { 538, 0x0000440012ULL, 21.333333333333332}, { 538, 0x0000280012ULL, -64.0},
+    { 538, 0x0000480012ULL, -21.333333333333332}, { 538, 0x0000682012ULL, 10.666666666666666},
+    { 538, 0x0000440203ULL, 10.666666666666666}, { 538, 0x0000280203ULL, 32.0},
+    { 538, 0x0000682203ULL, -5.333333333333333}, { 538, 0x0000440043ULL, -10.666666666666666},
+    { 538, 0x0000280043ULL, -32.0}, { 538, 0x0000682043ULL, 5.333333333333333},
+    { 538, 0x0000240004ULL, -32.0}, { 538, 0x0000440004ULL, 10.666666666666666},
+    { 538, 0x0000280004ULL, -32.0}, { 538, 0x0000480004ULL, 10.666666666666666},
+    { 538, 0x0000682004ULL, -5.333333333333333}, { 539, 0x0000082002ULL, -32.0},
+    { 540, 0x0000482242ULL, 5.333333333333333}, { 540, 0x0000482012ULL, 10.666666666666666},
+    { 540, 0x0000482203ULL, 5.333333333333333}, { 540, 0x0000482043ULL, -5.333333333333333},
+    { 540, 0x0000482004ULL, -5.333333333333333}, { 541, 0x0000080082ULL, 16.0},
+    { 541, 0x00000c0082ULL, 32.0}, { 541, 0x0000100082ULL, 16.0},
+    { 541, 0x0000080012ULL, 32.0}, { 541, 0x00000c0012ULL, -64.0},
+    { 541, 0x0000100012ULL, 32.0}, { 541, 0x0000080004ULL, -16.0},
+    { 541, 0x00000c0004ULL, -32.0}, { 541, 0x0000100004ULL, -16.0},
+    { 542, 0x0000102082ULL, -16.0}, { 542, 0x0000102012ULL, -32.0},
+    { 542, 0x0000102004ULL, 16.0}, { 543, 0x0040208002ULL, -21.333333333333332},
+    { 544, 0x0008048002ULL, -64.0}, { 545, 0x0040240202ULL, 10.666666666666666},
+    { 545, 0x0008240202ULL, -32.0}, { 545, 0x0008440202ULL, -10.666666666666666},
+    { 545, 0x0040280202ULL, -10.666666666666666}, { 545, 0x0040240042ULL, -10.666666666666666},
+    { 545, 0x0008240042ULL, 32.0}, { 545, 0x0008440042ULL, 10.666666666666666},
+    { 545, 0x0040280042ULL, 10.666666666666666}, { 546, 0x0000602002ULL, -21.333333333333332},
+    { 547, 0x004020a002ULL, -21.333333333333332}, { 548, 0x0080402402ULL, -3.5555555555555554},
+    { 548, 0x0000a02402ULL, 3.5555555555555554}, { 548, 0x0080402012ULL, -7.111111111111111},
+    { 548, 0x0000a02012ULL, 7.111111111111111}, { 548, 0x0080402004ULL, 3.5555555555555554},
+    { 548, 0x0000a02004ULL, -3.5555555555555554}, { 549, 0x0000402002ULL, -10.666666666666666},
+    { 550, 0x000804a002ULL, -64.0}, { 551, 0x0048242242ULL, -21.333333333333332},
+    { 551, 0x0000682242ULL, -10.666666666666666}, { 551, 0x0048242012ULL, -42.666666666666664},
+    { 551, 0x0000682012ULL, -21.333333333333332}, { 551, 0x0048242004ULL, 21.333333333333332},
+    { 551, 0x0000682004ULL, 10.666666666666666}, { 552, 0x0000082002ULL, 96.0},
+    { 553, 0x0000482242ULL, -10.666666666666666}, { 553, 0x0000482012ULL, -21.333333333333332},
+    { 553, 0x0000482004ULL, 10.666666666666666}, { 554, 0x0010082082ULL, -32.0},
+    { 554, 0x0010082012ULL, -64.0}, { 554, 0x0010082004ULL, 32.0},
+    { 555, 0x0000102082ULL, 32.0}, { 555, 0x0000102012ULL, 64.0},
+    { 555, 0x0000102004ULL, -32.0}, { 556, 0x0040208002ULL, -21.333333333333332},
+    { 557, 0x0008048002ULL, -64.0}, { 558, 0x0040240202ULL, 10.666666666666666},
+    { 558, 0x0008240202ULL, -32.0}, { 558, 0x0008440202ULL, 10.666666666666666},
+    { 558, 0x0040280202ULL, 10.666666666666666}, { 558, 0x0040240042ULL, -10.666666666666666},
+    { 558, 0x0008240042ULL, 32.0}, { 558, 0x0008440042ULL, -10.666666666666666},
+    { 558, 0x0040280042ULL, -10.666666666666666}, { 559, 0x0000200002ULL, 64.0},
+    { 559, 0x0000400002ULL, 21.333333333333332}, { 559, 0x0000208002ULL, 64.0},
+    { 559, 0x0000408002ULL, 21.333333333333332}, { 559, 0x0000602002ULL, -21.333333333333332},
+    { 559, 0x0040200202ULL, -10.666666666666666}, { 559, 0x0040208202ULL, 10.666666666666666},
+    { 559, 0x0040200003ULL, -10.666666666666666}, { 559, 0x0040208003ULL, -32.0},
+    { 560, 0x004020a002ULL, 10.666666666666666}, { 560, 0x0040208012ULL, 21.333333333333332},
+    { 561, 0x0000400012ULL, -32.0}, { 561, 0x0000600012ULL, -21.333333333333332},
+    { 561, 0x0000800012ULL, -3.5555555555555554}, { 561, 0x0080402012ULL, -5.333333333333333},
+    { 561, 0x0000a02012ULL, 7.111111111111111}, { 561, 0x0000c04012ULL, -1.7777777777777777},
+    { 561, 0x0040400212ULL, -10.666666666666666}, { 561, 0x0040600212ULL, 3.5555555555555554},
+    { 561, 0x0040400013ULL, 32.0}, { 561, 0x0040600013ULL, 3.5555555555555554},
+    { 562, 0x0000402002ULL, -10.666666666666666}, { 562, 0x0000604002ULL, 5.333333333333333},
+    { 562, 0x0000602012ULL, -10.666666666666666}, { 563, 0x0000002002ULL, 16.0},
+    { 564, 0x0000040002ULL, 64.0}, { 564, 0x0000080002ULL, -64.0},
+    { 564, 0x0000048002ULL, 64.0}, { 564, 0x0000088002ULL, -64.0},
+    { 564, 0x0008040042ULL, -32.0}, { 564, 0x0008048042ULL, 32.0},
+    { 564, 0x0008040003ULL, -32.0}, { 564, 0x0008048003ULL, -96.0},
+    { 565, 0x000804a002ULL, 32.0}, { 565, 0x0008048012ULL, 64.0},
+    { 566, 0x0000240012ULL, -64.0}, { 566, 0x0000440012ULL, -21.333333333333332},
+    { 566, 0x0000280012ULL, 64.0}, { 566, 0x0000480012ULL, 21.333333333333332},
+    { 566, 0x0048242012ULL, -32.0}, { 566, 0x0000682012ULL, -21.333333333333332},
+    { 566, 0x0040240212ULL, -5.333333333333333}, { 566, 0x0008240212ULL, -16.0},
+    { 566, 0x0008440212ULL, 5.333333333333333}, { 566, 0x0040280212ULL, -5.333333333333333},
+    { 566, 0x0040240052ULL, -5.333333333333333}, { 566, 0x0008240052ULL, -16.0},
+    { 566, 0x0008440052ULL, 5.333333333333333}, { 566, 0x0040280052ULL, -5.333333333333333},
+    { 566, 0x0040240013ULL, 32.0}, { 566, 0x0008240013ULL, 96.0},
+    { 566, 0x0008440013ULL, 10.666666666666666}, { 566, 0x0040280013ULL, -10.666666666666666},
+    { 567, 0x0000082002ULL, 96.0}, { 568, 0x0000482012ULL, -21.333333333333332},
+    { 568, 0x0000684012ULL, 10.666666666666666}, { 569, 0x0000084002ULL, -16.0},
+    { 569, 0x0000082012ULL, 32.0}, { 570, 0x0000080012ULL, -32.0},
+    { 570, 0x00000c0012ULL, 64.0}, { 570, 0x0000100012ULL, -32.0},
+    { 570, 0x0010082012ULL, -48.0}, { 570, 0x0008080052ULL, -32.0},
+    { 570, 0x00080c0052ULL, -32.0}, { 570, 0x0008080013ULL, 96.0},
+    { 570, 0x00080c0013ULL, -32.0}, { 571, 0x0000102012ULL, 64.0},
+    { 572, 0x0000104012ULL, -16.0}, { 573, 0x0040208002ULL, 42.666666666666664},
+    { 574, 0x0000c02402ULL, -1.7777777777777777}, { 574, 0x0000c02012ULL, -3.5555555555555554},
+    { 574, 0x0000c02004ULL, 1.7777777777777777}, { 575, 0x0000602002ULL, 10.666666666666666},
+    { 576, 0x0008048002ULL, 128.0}, { 577, 0x0008440202ULL, 21.333333333333332},
+    { 577, 0x0040280202ULL, 21.333333333333332}, { 577, 0x0008440042ULL, -21.333333333333332},
+    { 577, 0x0040280042ULL, -21.333333333333332}, { 578, 0x0000682242ULL, 10.666666666666666},
+    { 578, 0x0000682012ULL, 21.333333333333332}, { 578, 0x0000682004ULL, -10.666666666666666},
+    { 579, 0x0000082002ULL, -32.0}, { 580, 0x0000102082ULL, -16.0},
+    { 580, 0x0000102012ULL, -32.0}, { 580, 0x0000102004ULL, 16.0},
+    { 581, 0x0080400402ULL, 3.5555555555555554}, { 581, 0x0000c02402ULL, 1.7777777777777777},
+    { 581, 0x0080400012ULL, 7.111111111111111}, { 581, 0x0000c02012ULL, 3.5555555555555554},
+    { 581, 0x0080400004ULL, -3.5555555555555554}, { 581, 0x0000c02004ULL, -1.7777777777777777},
+    { 582, 0x0000602002ULL, -10.666666666666666}, { 583, 0x0048240242ULL, 21.333333333333332},
+    { 583, 0x0048240012ULL, 42.666666666666664}, { 583, 0x0048240004ULL, -21.333333333333332},
+    { 584, 0x0000682242ULL, -10.666666666666666}, { 584, 0x0000682012ULL, -21.333333333333332},
+    { 584, 0x0000682004ULL, 10.666666666666666}, { 585, 0x0000082002ULL, 32.0},
+    { 586, 0x0010080082ULL, 32.0}, { 586, 0x0010080012ULL, 64.0},
+    { 586, 0x0010080004ULL, -32.0}, { 587, 0x0000102082ULL, 16.0},
+    { 587, 0x0000102012ULL, 32.0}, { 587, 0x0000102004ULL, -16.0},
+    { 588, 0x0080400012ULL, 7.111111111111111}, { 588, 0x0000c02012ULL, 3.5555555555555554},
+    { 589, 0x0000602002ULL, -10.666666666666666}, { 590, 0x0048240012ULL, 42.666666666666664},
+    { 591, 0x0000682012ULL, -21.333333333333332}, { 592, 0x0000082002ULL, 32.0},
+    { 593, 0x0010080012ULL, 64.0}, { 594, 0x0000102012ULL, 32.0},
+    { 595, 0x0000402003ULL, -32.0}, { 595, 0x0000602003ULL, -21.333333333333332},
+    { 595, 0x0000802003ULL, -3.5555555555555554}, { 595, 0x0000a04003ULL, 3.5555555555555554},
+    { 595, 0x0040402203ULL, -10.666666666666666}, { 595, 0x0040602203ULL, 7.111111111111111},
+    { 595, 0x0040402004ULL, 10.666666666666666}, { 595, 0x0040602004ULL, 7.111111111111111},
+    { 596, 0x0000402003ULL, 10.666666666666666}, { 597, 0x0000242003ULL, -64.0},
+    { 597, 0x0000442003ULL, -21.333333333333332}, { 597, 0x0000282003ULL, 64.0},
+    { 597, 0x0000482003ULL, 21.333333333333332}, { 597, 0x0000684003ULL, -10.666666666666666},
+    { 597, 0x0008242203ULL, -32.0}, { 597, 0x0008442203ULL, 10.666666666666666},
+    { 597, 0x0040282203ULL, -10.666666666666666}, { 597, 0x0040242043ULL, -10.666666666666666},
+    { 597, 0x0008442043ULL, 10.666666666666666}, { 597, 0x0040282043ULL, -10.666666666666666},
+    { 597, 0x0040242004ULL, 10.666666666666666}, { 597, 0x0008242004ULL, 32.0},
+    { 597, 0x0008442004ULL, 21.333333333333332}, { 597, 0x0040282004ULL, -21.333333333333332},
+    { 598, 0x0000082003ULL, -32.0}, { 599, 0x0000484003ULL, -10.666666666666666},
+    { 600, 0x0000082003ULL, -32.0}, { 600, 0x00000c2003ULL, 64.0},
+    { 600, 0x0000102003ULL, -32.0}, { 600, 0x0008082043ULL, -32.0},
+    { 600, 0x00080c2043ULL, -64.0}, { 600, 0x0008082004ULL, 32.0},
+    { 600, 0x00080c2004ULL, -64.0}, { 601, 0x0000104003ULL, 32.0},
+    { 602, 0x0000400003ULL, -32.0}, { 602, 0x0000600003ULL, -21.333333333333332},
+    { 602, 0x0000800003ULL, -3.5555555555555554}, { 602, 0x0000a02003ULL, 3.5555555555555554},
+    { 603, 0x0000240003ULL, -64.0}, { 603, 0x0000440003ULL, -21.333333333333332},
+    { 603, 0x0000280003ULL, 64.0}, { 603, 0x0000480003ULL, 21.333333333333332},
+    { 603, 0x0000682003ULL, -10.666666666666666}, { 604, 0x0000482003ULL, -10.666666666666666},
+    { 605, 0x0000080003ULL, -32.0}, { 605, 0x00000c0003ULL, 64.0},
+    { 605, 0x0000100003ULL, -32.0}, { 606, 0x0000102003ULL, 32.0},
+    { 607, 0x0080402003ULL, 7.111111111111111}, { 607, 0x0000a02003ULL, -7.111111111111111},
+    { 608, 0x0048242003ULL, 42.666666666666664}, { 608, 0x0000682003ULL, 21.333333333333332},
+    { 609, 0x0000482003ULL, 21.333333333333332}, { 610, 0x0010082003ULL, 64.0},
+    { 611, 0x0000102003ULL, -64.0}, { 612, 0x0000400003ULL, 32.0},
+    { 612, 0x0000600003ULL, 21.333333333333332}, { 612, 0x0000800003ULL, 3.5555555555555554},
+    { 612, 0x0080402003ULL, 5.333333333333333}, { 612, 0x0000a02003ULL, -7.111111111111111},
+    { 612, 0x0000c04003ULL, 1.7777777777777777}, { 612, 0x0040400203ULL, 21.333333333333332},
+    { 612, 0x0040600203ULL, -7.111111111111111}, { 612, 0x0040400004ULL, -21.333333333333332},
+    { 612, 0x0040600004ULL, -7.111111111111111}, { 613, 0x0000602003ULL, 10.666666666666666},
+    { 614, 0x0000240003ULL, 64.0}, { 614, 0x0000440003ULL, 21.333333333333332},
+    { 614, 0x0000280003ULL, -64.0}, { 614, 0x0000480003ULL, -21.333333333333332},
+    { 614, 0x0048242003ULL, 32.0}, { 614, 0x0000682003ULL, 21.333333333333332},
+    { 614, 0x0040240203ULL, 10.666666666666666}, { 614, 0x0008240203ULL, 32.0},
+    { 614, 0x0008440203ULL, -10.666666666666666}, { 614, 0x0040280203ULL, 10.666666666666666},
+    { 614, 0x0040240043ULL, 10.666666666666666}, { 614, 0x0008240043ULL, 32.0},
+    { 614, 0x0008440043ULL, -10.666666666666666}, { 614, 0x0040280043ULL, 10.666666666666666},
+    { 614, 0x0040240004ULL, -21.333333333333332}, { 614, 0x0008240004ULL, -64.0},
+    { 614, 0x0008440004ULL, -21.333333333333332}, { 614, 0x0040280004ULL, 21.333333333333332},
+    { 615, 0x0000482003ULL, 21.333333333333332}, { 615, 0x0000684003ULL, -10.666666666666666},
+    { 616, 0x0000082003ULL, -32.0}, { 617, 0x0000080003ULL, 32.0},
+    { 617, 0x00000c0003ULL, -64.0}, { 617, 0x0000100003ULL, 32.0},
+    { 617, 0x0010082003ULL, 48.0}, { 617, 0x0008080043ULL, 64.0},
+    { 617, 0x00080c0043ULL, 64.0}, { 617, 0x0008080004ULL, -64.0},
+    { 617, 0x00080c0004ULL, 64.0}, { 618, 0x0000102003ULL, -64.0},
+    { 619, 0x0000104003ULL, 16.0}, { 620, 0x0000c02003ULL, 3.5555555555555554},
+    { 621, 0x0000682003ULL, -21.333333333333332}, { 622, 0x0000102003ULL, 32.0},
+    { 623, 0x0080400003ULL, -7.111111111111111}, { 623, 0x0000c02003ULL, -3.5555555555555554},
+    { 624, 0x0048240003ULL, -42.666666666666664}, { 625, 0x0000682003ULL, 21.333333333333332},
+    { 626, 0x0010080003ULL, -64.0}, { 627, 0x0000102003ULL, -32.0},
+    { 628, 0x0080400003ULL, -7.111111111111111}, { 628, 0x0000c02003ULL, -3.5555555555555554},
+    { 629, 0x0048240003ULL, -42.666666666666664}, { 630, 0x0000682003ULL, 21.333333333333332},
+    { 631, 0x0010080003ULL, -64.0}, { 632, 0x0000102003ULL, -32.0},
+    { 633, 0x0000000002ULL, 64.0}, { 633, 0x0000010002ULL, 64.0},
+    { 634, 0x0000400012ULL, -21.333333333333332}, { 634, 0x0000208012ULL, -64.0},
+    { 634, 0x0000602012ULL, 10.666666666666666}, { 635, 0x0000400412ULL, -16.0},
+    { 635, 0x0000800412ULL, -1.7777777777777777}, { 635, 0x0000a02412ULL, 1.7777777777777777},
+    { 635, 0x0000400022ULL, 16.0}, { 635, 0x0000800022ULL, 1.7777777777777777},
+    { 635, 0x0000a02022ULL, -1.7777777777777777}, { 635, 0x0000400213ULL, -32.0},
+    { 635, 0x0000800213ULL, -3.5555555555555554}, { 635, 0x0000a02213ULL, 3.5555555555555554},
+    { 635, 0x0000400014ULL, -16.0}, { 635, 0x0000800014ULL, -1.7777777777777777},
+    { 635, 0x0000a02014ULL, 1.7777777777777777}, { 636, 0x0000002002ULL, -32.0},
+    { 637, 0x0000402012ULL, 5.333333333333333}, { 638, 0x0000080012ULL, 64.0},
+    { 638, 0x0000048012ULL, -64.0}, { 639, 0x0000240252ULL, -32.0},
+    { 639, 0x0000480252ULL, 10.666666666666666}, { 639, 0x0000682252ULL, -5.333333333333333},
+    { 639, 0x0000240022ULL, 32.0}, { 639, 0x0000480022ULL, -10.666666666666666},
+    { 639, 0x0000682022ULL, 5.333333333333333}, { 639, 0x0000240213ULL, -32.0},
+    { 639, 0x0000480213ULL, 10.666666666666666}, { 639, 0x0000682213ULL, -5.333333333333333},
+    { 639, 0x0000240053ULL, -32.0}, { 639, 0x0000480053ULL, 10.666666666666666},
+    { 639, 0x0000682053ULL, -5.333333333333333}, { 639, 0x0000240014ULL, -32.0},
+    { 639, 0x0000480014ULL, 10.666666666666666}, { 639, 0x0000682014ULL, -5.333333333333333},
+    { 640, 0x0000082012ULL, -48.0}, { 641, 0x0000482252ULL, -5.333333333333333},
+    { 641, 0x0000482022ULL, 5.333333333333333}, { 641, 0x0000482213ULL, -5.333333333333333},
+    { 641, 0x0000482053ULL, -5.333333333333333}, { 641, 0x0000482014ULL, -5.333333333333333},
+    { 642, 0x0000080092ULL, -16.0}, { 642, 0x0000100092ULL, -16.0},
+    { 642, 0x0000080022ULL, 16.0}, { 642, 0x0000100022ULL, 16.0},
+    { 642, 0x0000080053ULL, -32.0}, { 642, 0x0000100053ULL, -32.0},
+    { 642, 0x0000080014ULL, -16.0}, { 642, 0x0000100014ULL, -16.0},
+    { 643, 0x0000102092ULL, 16.0}, { 643, 0x0000102022ULL, -16.0},
+    { 643, 0x0000102053ULL, 32.0}, { 643, 0x0000102014ULL, 16.0},
+    { 644, 0x0040200202ULL, -10.666666666666666}, { 644, 0x0040208202ULL, -10.666666666666666},
+    { 644, 0x0040200003ULL, -10.666666666666666}, { 644, 0x0040208003ULL, -10.666666666666666},
+    { 645, 0x0008040042ULL, -32.0}, { 645, 0x0008048042ULL, -32.0},
+    { 645, 0x0008040003ULL, -32.0}, { 645, 0x0008048003ULL, -32.0},
+    { 646, 0x0040240212ULL, 5.333333333333333}, { 646, 0x0008240212ULL, -16.0},
+    { 646, 0x0008440212ULL, -5.333333333333333}, { 646, 0x0040280212ULL, -5.333333333333333},
+    { 646, 0x0040240052ULL, -5.333333333333333}, { 646, 0x0008240052ULL, 16.0},
+    { 646, 0x0008440052ULL, 5.333333333333333}, { 646, 0x0040280052ULL, 5.333333333333333},
+    { 647, 0x0040200202ULL, -10.666666666666666}, { 647, 0x0040208202ULL, 10.666666666666666},
+    { 647, 0x0040200003ULL, -10.666666666666666}, { 647, 0x0040208003ULL, 10.666666666666666},
+    { 648, 0x0008040042ULL, -32.0}, { 648, 0x0008048042ULL, 32.0},
+    { 648, 0x0008040003ULL, -32.0}, { 648, 0x0008048003ULL, 32.0},
+    { 649, 0x0040240212ULL, -5.333333333333333}, { 649, 0x0008240212ULL, 16.0},
+    { 649, 0x0008440212ULL, -5.333333333333333}, { 649, 0x0040280212ULL, -5.333333333333333},
+    { 649, 0x0040240052ULL, 5.333333333333333}, { 649, 0x0008240052ULL, -16.0},
+    { 649, 0x0008440052ULL, 5.333333333333333}, { 649, 0x0040280052ULL, 5.333333333333333},
+    { 650, 0x0000c02412ULL, 1.7777777777777777}, { 650, 0x0000c02022ULL, -1.7777777777777777},
+    { 650, 0x0000c02213ULL, 3.5555555555555554}, { 650, 0x0000c02014ULL, 1.7777777777777777},
+    { 651, 0x0000602012ULL, 10.666666666666666}, { 652, 0x0000002002ULL, -16.0},
+    { 653, 0x0000682252ULL, -10.666666666666666}, { 653, 0x0000682022ULL, 10.666666666666666},
+    { 653, 0x0000682213ULL, -10.666666666666666}, { 653, 0x0000682053ULL, -10.666666666666666},
+    { 653, 0x0000682014ULL, -10.666666666666666}, { 654, 0x0000082012ULL, -32.0},
+    { 655, 0x0000102092ULL, 16.0}, { 655, 0x0000102022ULL, -16.0},
+    { 655, 0x0000102053ULL, 32.0}, { 655, 0x0000102014ULL, 16.0},
+    { 656, 0x0000400003ULL, 42.666666666666664}, { 656, 0x0000208003ULL, 128.0},
+    { 656, 0x0000602003ULL, -21.333333333333332}, { 657, 0x0000400013ULL, -64.0},
+    { 657, 0x0000800013ULL, -7.111111111111111}, { 657, 0x0000a02013ULL, 7.111111111111111},
+    { 658, 0x0000402003ULL, -10.666666666666666}, { 659, 0x0000080003ULL, -128.0},
+    { 659, 0x0000048003ULL, 128.0}, { 660, 0x0000240013ULL, -128.0},
+    { 660, 0x0000480013ULL, 42.666666666666664}, { 660, 0x0000682013ULL, -21.333333333333332},
+    { 661, 0x0000082003ULL, 96.0}, { 662, 0x0000482013ULL, -21.333333333333332},
+    { 663, 0x0000080013ULL, -64.0}, { 663, 0x0000100013ULL, -64.0},
+    { 664, 0x0000102013ULL, 64.0}, { 665, 0x0040240203ULL, -10.666666666666666},
+    { 665, 0x0008240203ULL, 32.0}, { 665, 0x0008440203ULL, 10.666666666666666},
+    { 665, 0x0040280203ULL, 10.666666666666666}, { 665, 0x0040240043ULL, 10.666666666666666},
+    { 665, 0x0008240043ULL, -32.0}, { 665, 0x0008440043ULL, -10.666666666666666},
+    { 665, 0x0040280043ULL, -10.666666666666666}, { 666, 0x0040240203ULL, 10.666666666666666},
+    { 666, 0x0008240203ULL, -32.0}, { 666, 0x0008440203ULL, 10.666666666666666},
+    { 666, 0x0040280203ULL, 10.666666666666666}, { 666, 0x0040240043ULL, -10.666666666666666},
+    { 666, 0x0008240043ULL, 32.0}, { 666, 0x0008440043ULL, -10.666666666666666},
+    { 666, 0x0040280043ULL, -10.666666666666666}, { 667, 0x0000c02013ULL, 7.111111111111111},
+    { 668, 0x0000602003ULL, -21.333333333333332}, { 669, 0x0000682013ULL, -42.666666666666664},
+    { 670, 0x0000082003ULL, 64.0}, { 671, 0x0000102013ULL, 64.0},
+    { 672, 0x0000400004ULL, 64.0}, { 672, 0x0000800004ULL, 7.111111111111111},
+    { 672, 0x0000a02004ULL, -7.111111111111111}, { 673, 0x0000240004ULL, 128.0},
+    { 673, 0x0000480004ULL, -42.666666666666664}, { 673, 0x0000682004ULL, 21.333333333333332},
+    { 674, 0x0000482004ULL, 21.333333333333332}, { 675, 0x0000080004ULL, 64.0},
+    { 675, 0x0000100004ULL, 64.0}, { 676, 0x0000102004ULL, -64.0},
+    { 677, 0x0000c02004ULL, -7.111111111111111}, { 678, 0x0000682004ULL, 42.666666666666664},
+    { 679, 0x0000102004ULL, -64.0}, { 680, 0x0000602012ULL, -10.666666666666666},
+    { 681, 0x0080402412ULL, 1.7777777777777777}, { 681, 0x0000a02412ULL, -1.7777777777777777},
+    { 681, 0x0080402022ULL, -1.7777777777777777}, { 681, 0x0000a02022ULL, 1.7777777777777777},
+    { 681, 0x0080402213ULL, 3.5555555555555554}, { 681, 0x0000a02213ULL, -3.5555555555555554},
+    { 681, 0x0080402014ULL, 1.7777777777777777}, { 681, 0x0000a02014ULL, -1.7777777777777777},
+    { 682, 0x0000002002ULL, 32.0}, { 683, 0x0000402012ULL, -5.333333333333333},
+    { 684, 0x0048242252ULL, 10.666666666666666}, { 684, 0x0000682252ULL, 5.333333333333333},
+    { 684, 0x0048242022ULL, -10.666666666666666}, { 684, 0x0000682022ULL, -5.333333333333333},
+    { 684, 0x0048242213ULL, 10.666666666666666}, { 684, 0x0000682213ULL, 5.333333333333333},
+    { 684, 0x0048242053ULL, 10.666666666666666}, { 684, 0x0000682053ULL, 5.333333333333333},
+    { 684, 0x0048242014ULL, 10.666666666666666}, { 684, 0x0000682014ULL, 5.333333333333333},
+    { 685, 0x0000082012ULL, 48.0}, { 686, 0x0000482252ULL, 5.333333333333333},
+    { 686, 0x0000482022ULL, -5.333333333333333}, { 686, 0x0000482213ULL, 5.333333333333333},
+    { 686, 0x0000482053ULL, 5.333333333333333}, { 686, 0x0000482014ULL, 5.333333333333333},
+    { 687, 0x0010082092ULL, 16.0}, { 687, 0x0010082022ULL, -16.0},
+    { 687, 0x0010082053ULL, 32.0}, { 687, 0x0010082014ULL, 16.0},
+    { 688, 0x0000102092ULL, -16.0}, { 688, 0x0000102022ULL, 16.0},
+    { 688, 0x0000102053ULL, -32.0}, { 688, 0x0000102014ULL, -16.0},
+    { 689, 0x0040200202ULL, 10.666666666666666}, { 689, 0x0040208202ULL, -10.666666666666666},
+    { 689, 0x0040200003ULL, 10.666666666666666}, { 689, 0x0040208003ULL, -10.666666666666666},
+    { 690, 0x0008040042ULL, 32.0}, { 690, 0x0008048042ULL, -32.0},
+    { 690, 0x0008040003ULL, 32.0}, { 690, 0x0008048003ULL, -32.0},
+    { 691, 0x0040240212ULL, 5.333333333333333}, { 691, 0x0008240212ULL, -16.0},
+    { 691, 0x0008440212ULL, 5.333333333333333}, { 691, 0x0040280212ULL, 5.333333333333333},
+    { 691, 0x0040240052ULL, -5.333333333333333}, { 691, 0x0008240052ULL, 16.0},
+    { 691, 0x0008440052ULL, -5.333333333333333}, { 691, 0x0040280052ULL, -5.333333333333333},
+    { 692, 0x0080400412ULL, -1.7777777777777777}, { 692, 0x0000c02412ULL, -0.8888888888888888},
+    { 692, 0x0080400022ULL, 1.7777777777777777}, { 692, 0x0000c02022ULL, 0.8888888888888888},
+    { 692, 0x0080400213ULL, -3.5555555555555554}, { 692, 0x0000c02213ULL, -1.7777777777777777},
+    { 692, 0x0080400014ULL, -1.7777777777777777}, { 692, 0x0000c02014ULL, -0.8888888888888888},
+    { 693, 0x0000602012ULL, -5.333333333333333}, { 694, 0x0000002002ULL, 8.0},
+    { 695, 0x0048240252ULL, -10.666666666666666}, { 695, 0x0048240022ULL, 10.666666666666666},
+    { 695, 0x0048240213ULL, -10.666666666666666}, { 695, 0x0048240053ULL, -10.666666666666666},
+    { 695, 0x0048240014ULL, -10.666666666666666}, { 696, 0x0000682252ULL, 5.333333333333333},
+    { 696, 0x0000682022ULL, -5.333333333333333}, { 696, 0x0000682213ULL, 5.333333333333333},
+    { 696, 0x0000682053ULL, 5.333333333333333}, { 696, 0x0000682014ULL, 5.333333333333333},
+    { 697, 0x0000082012ULL, 16.0}, { 698, 0x0010080092ULL, -16.0},
+    { 698, 0x0010080022ULL, 16.0}, { 698, 0x0010080053ULL, -32.0},
+    { 698, 0x0010080014ULL, -16.0}, { 699, 0x0000102092ULL, -8.0},
+    { 699, 0x0000102022ULL, 8.0}, { 699, 0x0000102053ULL, -16.0},
+    { 699, 0x0000102014ULL, -8.0}, { 700, 0x0000602003ULL, 21.333333333333332},
+    { 701, 0x0080402013ULL, 7.111111111111111}, { 701, 0x0000a02013ULL, -7.111111111111111},
+    { 702, 0x0000402003ULL, 10.666666666666666}, { 703, 0x0048242013ULL, 42.666666666666664},
+    { 703, 0x0000682013ULL, 21.333333333333332}, { 704, 0x0000082003ULL, -96.0},
+    { 705, 0x0000482013ULL, 21.333333333333332}, { 706, 0x0010082013ULL, 64.0},
+    { 707, 0x0000102013ULL, -64.0}, { 708, 0x0040240203ULL, -10.666666666666666},
+    { 708, 0x0008240203ULL, 32.0}, { 708, 0x0008440203ULL, -10.666666666666666},
+    { 708, 0x0040280203ULL, -10.666666666666666}, { 708, 0x0040240043ULL, 10.666666666666666},
+    { 708, 0x0008240043ULL, -32.0}, { 708, 0x0008440043ULL, 10.666666666666666},
+    { 708, 0x0040280043ULL, 10.666666666666666}, { 709, 0x0080400013ULL, -7.111111111111111},
+    { 709, 0x0000c02013ULL, -3.5555555555555554}, { 710, 0x0000602003ULL, 10.666666666666666},
+    { 711, 0x0048240013ULL, -42.666666666666664}, { 712, 0x0000682013ULL, 21.333333333333332},
+    { 713, 0x0000082003ULL, -32.0}, { 714, 0x0010080013ULL, -64.0},
+    { 715, 0x0000102013ULL, -32.0}, { 716, 0x0080402004ULL, -7.111111111111111},
+    { 716, 0x0000a02004ULL, 7.111111111111111}, { 717, 0x0048242004ULL, -42.666666666666664},
+    { 717, 0x0000682004ULL, -21.333333333333332}, { 718, 0x0000482004ULL, -21.333333333333332},
+    { 719, 0x0010082004ULL, -64.0}, { 720, 0x0000102004ULL, 64.0},
+    { 721, 0x0080400004ULL, 7.111111111111111}, { 721, 0x0000c02004ULL, 3.5555555555555554},
+    { 722, 0x0048240004ULL, 42.666666666666664}, { 723, 0x0000682004ULL, -21.333333333333332},
+    { 724, 0x0010080004ULL, 64.0}, { 725, 0x0000102004ULL, 32.0},
+  };
+
+  // nu + p -> l- + p + K+: 918 kinematic monomials, 3407 terms
+  const unsigned int kMonomialsPP[918] = {
+    0x100100, 0x040100, 0x010100, 0x110100, 0x050100, 0x020100, 0x014100, 0x024100,
+    0x001100, 0x101100, 0x041100, 0x011100, 0x005100, 0x015100, 0x002100, 0x006100,
+    0x100500, 0x040500, 0x010500, 0x110500, 0x050500, 0x020500, 0x014500, 0x024500,
+    0x001500, 0x101500, 0x041500, 0x011500, 0x005500, 0x015500, 0x002500, 0x006500,
+    0x110200, 0x050200, 0x020200, 0x014200, 0x024200, 0x101200, 0x041200, 0x011200,
+    0x005200, 0x015200, 0x002200, 0x006200, 0x000040, 0x100040, 0x040040, 0x010040,
+    0x110040, 0x050040, 0x020040, 0x014040, 0x024040, 0x018040, 0x028040, 0x001040,
+    0x101040, 0x041040, 0x011040, 0x005040, 0x015040, 0x009040, 0x019040, 0x002040,
+    0x006040, 0x00a040, 0x010440, 0x110440, 0x050440, 0x020440, 0x018440, 0x028440,
+    0x001440, 0x101440, 0x041440, 0x011440, 0x009440, 0x019440, 0x002440, 0x00a440,
+    0x020840, 0x018840, 0x028840, 0x011840, 0x009840, 0x019840, 0x002840, 0x00a840,
+    0x010140, 0x110140, 0x050140, 0x020140, 0x014140, 0x024140, 0x018140, 0x028140,
+    0x001140, 0x101140, 0x041140, 0x011140, 0x005140, 0x015140, 0x009140, 0x019140,
+    0x002140, 0x006140, 0x00a140, 0x110540, 0x050540, 0x018540, 0x028540, 0x101540,
+    0x041540, 0x009540, 0x019540, 0x00a540, 0x020240, 0x018240, 0x028240, 0x011240,
+    0x009240, 0x019240, 0x002240, 0x00a240, 0x010080, 0x110080, 0x050080, 0x020080,
+    0x018080, 0x028080, 0x001080, 0x101080, 0x041080, 0x011080, 0x009080, 0x019080,
+    0x002080, 0x00a080, 0x020480, 0x018480, 0x028480, 0x011480, 0x009480, 0x019480,
+    0x002480, 0x00a480, 0x020180, 0x018180, 0x028180, 0x011180, 0x009180, 0x019180,
+    0x002180, 0x00a180, 0x200110, 0x140110, 0x080110, 0x010110, 0x110110, 0x050110,
+    0x020110, 0x014110, 0x024110, 0x001110, 0x101110, 0x041110, 0x011110, 0x005110,
+    0x015110, 0x002110, 0x006110, 0x200510, 0x140510, 0x080510, 0x110510, 0x050510,
+    0x020510, 0x024510, 0x101510, 0x041510, 0x011510, 0x015510, 0x002510, 0x006510,
+    0x020210, 0x024210, 0x011210, 0x015210, 0x002210, 0x006210, 0x200050, 0x140050,
+    0x080050, 0x010050, 0x110050, 0x050050, 0x020050, 0x004050, 0x014050, 0x024050,
+    0x008050, 0x018050, 0x028050, 0x001050, 0x101050, 0x041050, 0x011050, 0x005050,
+    0x015050, 0x009050, 0x019050, 0x002050, 0x006050, 0x00a050, 0x010450, 0x110450,
+    0x050450, 0x020450, 0x008450, 0x018450, 0x028450, 0x001450, 0x101450, 0x041450,
+    0x011450, 0x009450, 0x019450, 0x002450, 0x00a450, 0x020850, 0x028850, 0x011850,
+    0x019850, 0x002850, 0x00a850, 0x010150, 0x110150, 0x050150, 0x020150, 0x024150,
+    0x008150, 0x018150, 0x028150, 0x001150, 0x101150, 0x041150, 0x011150, 0x015150,
+    0x009150, 0x019150, 0x002150, 0x006150, 0x00a150, 0x028550, 0x019550, 0x00a550,
+    0x020250, 0x028250, 0x011250, 0x019250, 0x002250, 0x00a250, 0x010090, 0x110090,
+    0x050090, 0x020090, 0x008090, 0x018090, 0x028090, 0x001090, 0x101090, 0x041090,
+    0x011090, 0x009090, 0x019090, 0x002090, 0x00a090, 0x020490, 0x028490, 0x011490,
+    0x019490, 0x002490, 0x00a490, 0x020190, 0x028190, 0x011190, 0x019190, 0x002190,
+    0x00a190, 0x020120, 0x011120, 0x002120, 0x110060, 0x050060, 0x020060, 0x014060,
+    0x024060, 0x008060, 0x018060, 0x028060, 0x101060, 0x041060, 0x011060, 0x005060,
+    0x015060, 0x009060, 0x019060, 0x002060, 0x006060, 0x00a060, 0x110460, 0x050460,
+    0x020460, 0x101460, 0x041460, 0x011460, 0x002460, 0x110160, 0x050160, 0x020160,
+    0x101160, 0x041160, 0x011160, 0x002160, 0x1100a0, 0x0500a0, 0x0200a0, 0x0180a0,
+    0x0280a0, 0x1010a0, 0x0410a0, 0x0110a0, 0x0090a0, 0x0190a0, 0x0020a0, 0x00a0a0,
+    0x020070, 0x024070, 0x028070, 0x011070, 0x015070, 0x019070, 0x002070, 0x006070,
+    0x00a070, 0x0280b0, 0x0190b0, 0x00a0b0, 0x000104, 0x200104, 0x140104, 0x080104,
+    0x010104, 0x110104, 0x050104, 0x020104, 0x004104, 0x014104, 0x024104, 0x001104,
+    0x101104, 0x041104, 0x011104, 0x005104, 0x015104, 0x002104, 0x006104, 0x200504,
+    0x140504, 0x080504, 0x010504, 0x110504, 0x050504, 0x001504, 0x101504, 0x041504,
+    0x011504, 0x010204, 0x110204, 0x050204, 0x001204, 0x101204, 0x041204, 0x011204,
+    0x000044, 0x200044, 0x140044, 0x080044, 0x010044, 0x110044, 0x050044, 0x020044,
+    0x008044, 0x018044, 0x028044, 0x001044, 0x101044, 0x041044, 0x011044, 0x009044,
+    0x019044, 0x002044, 0x00a044, 0x020444, 0x008444, 0x018444, 0x028444, 0x011444,
+    0x009444, 0x019444, 0x002444, 0x00a444, 0x010144, 0x110144, 0x050144, 0x008144,
+    0x018144, 0x028144, 0x001144, 0x101144, 0x041144, 0x011144, 0x009144, 0x019144,
+    0x00a144, 0x020084, 0x008084, 0x018084, 0x028084, 0x011084, 0x009084, 0x019084,
+    0x002084, 0x00a084, 0x010114, 0x110114, 0x050114, 0x020114, 0x014114, 0x024114,
+    0x001114, 0x101114, 0x041114, 0x011114, 0x005114, 0x015114, 0x002114, 0x006114,
+    0x110514, 0x050514, 0x101514, 0x041514, 0x011514, 0x110214, 0x050214, 0x101214,
+    0x041214, 0x011214, 0x010054, 0x110054, 0x050054, 0x020054, 0x008054, 0x018054,
+    0x028054, 0x001054, 0x101054, 0x041054, 0x011054, 0x009054, 0x019054, 0x002054,
+    0x00a054, 0x020454, 0x018454, 0x028454, 0x011454, 0x009454, 0x019454, 0x002454,
+    0x00a454, 0x110154, 0x050154, 0x018154, 0x028154, 0x101154, 0x041154, 0x011154,
+    0x009154, 0x019154, 0x00a154, 0x020094, 0x018094, 0x028094, 0x011094, 0x009094,
+    0x019094, 0x002094, 0x00a094, 0x020124, 0x024124, 0x011124, 0x015124, 0x002124,
+    0x006124, 0x020064, 0x018064, 0x028064, 0x011064, 0x009064, 0x019064, 0x002064,
+    0x00a064, 0x020464, 0x028464, 0x011464, 0x019464, 0x002464, 0x00a464, 0x028164,
+    0x019164, 0x00a164, 0x0200a4, 0x0280a4, 0x0110a4, 0x0190a4, 0x0020a4, 0x00a0a4,
+    0x010108, 0x001108, 0x011108, 0x020048, 0x008048, 0x018048, 0x028048, 0x011048,
+    0x009048, 0x019048, 0x002048, 0x00a048, 0x011118, 0x020058, 0x018058, 0x028058,
+    0x011058, 0x009058, 0x019058, 0x002058, 0x00a058, 0x020068, 0x028068, 0x011068,
+    0x019068, 0x002068, 0x00a068, 0x000001, 0x010001, 0x110001, 0x050001, 0x020001,
+    0x004001, 0x014001, 0x024001, 0x001001, 0x101001, 0x041001, 0x011001, 0x005001,
+    0x015001, 0x002001, 0x006001, 0x000401, 0x010401, 0x110401, 0x050401, 0x020401,
+    0x014401, 0x024401, 0x001401, 0x101401, 0x041401, 0x011401, 0x005401, 0x015401,
+    0x002401, 0x006401, 0x010801, 0x110801, 0x050801, 0x001801, 0x101801, 0x041801,
+    0x011801, 0x200101, 0x140101, 0x080101, 0x110101, 0x050101, 0x020101, 0x004101,
+    0x014101, 0x024101, 0x101101, 0x041101, 0x011101, 0x005101, 0x015101, 0x002101,
+    0x006101, 0x200501, 0x140501, 0x080501, 0x010501, 0x110501, 0x050501, 0x001501,
+    0x101501, 0x041501, 0x011501, 0x000041, 0x200041, 0x140041, 0x080041, 0x010041,
+    0x110041, 0x050041, 0x020041, 0x004041, 0x014041, 0x024041, 0x008041, 0x018041,
+    0x028041, 0x001041, 0x101041, 0x041041, 0x011041, 0x005041, 0x015041, 0x009041,
+    0x019041, 0x002041, 0x006041, 0x00a041, 0x010441, 0x110441, 0x050441, 0x008441,
+    0x018441, 0x028441, 0x001441, 0x101441, 0x041441, 0x011441, 0x009441, 0x019441,
+    0x00a441, 0x020141, 0x008141, 0x018141, 0x028141, 0x011141, 0x009141, 0x019141,
+    0x002141, 0x00a141, 0x020081, 0x008081, 0x018081, 0x028081, 0x011081, 0x009081,
+    0x019081, 0x002081, 0x00a081, 0x010011, 0x110011, 0x050011, 0x020011, 0x004011,
+    0x014011, 0x024011, 0x001011, 0x101011, 0x041011, 0x011011, 0x005011, 0x015011,
+    0x002011, 0x006011, 0x010411, 0x110411, 0x050411, 0x020411, 0x014411, 0x024411,
+    0x001411, 0x101411, 0x041411, 0x011411, 0x005411, 0x015411, 0x002411, 0x006411,
+    0x110811, 0x050811, 0x101811, 0x041811, 0x011811, 0x110111, 0x050111, 0x020111,
+    0x014111, 0x024111, 0x101111, 0x041111, 0x011111, 0x005111, 0x015111, 0x002111,
+    0x006111, 0x110511, 0x050511, 0x101511, 0x041511, 0x011511, 0x010051, 0x110051,
+    0x050051, 0x020051, 0x014051, 0x024051, 0x008051, 0x018051, 0x028051, 0x001051,
+    0x101051, 0x041051, 0x011051, 0x005051, 0x015051, 0x009051, 0x019051, 0x002051,
+    0x006051, 0x00a051, 0x110451, 0x050451, 0x018451, 0x028451, 0x101451, 0x041451,
+    0x011451, 0x009451, 0x019451, 0x00a451, 0x020151, 0x018151, 0x028151, 0x011151,
+    0x009151, 0x019151, 0x002151, 0x00a151, 0x020091, 0x018091, 0x028091, 0x011091,
+    0x009091, 0x019091, 0x002091, 0x00a091, 0x020021, 0x014021, 0x024021, 0x011021,
+    0x005021, 0x015021, 0x002021, 0x006021, 0x020421, 0x024421, 0x011421, 0x015421,
+    0x002421, 0x006421, 0x020121, 0x024121, 0x011121, 0x015121, 0x002121, 0x006121,
+    0x020061, 0x024061, 0x018061, 0x028061, 0x011061, 0x015061, 0x009061, 0x019061,
+    0x002061, 0x006061, 0x00a061, 0x028461, 0x019461, 0x00a461, 0x020161, 0x028161,
+    0x011161, 0x019161, 0x002161, 0x00a161, 0x0200a1, 0x0280a1, 0x0110a1, 0x0190a1,
+    0x0020a1, 0x00a0a1, 0x000005, 0x010005, 0x020005, 0x004005, 0x014005, 0x024005,
+    0x001005, 0x011005, 0x005005, 0x015005, 0x002005, 0x006005, 0x010405, 0x001405,
+    0x011405, 0x010105, 0x001105, 0x011105, 0x008045, 0x018045, 0x028045, 0x009045,
+    0x019045, 0x00a045, 0x010015, 0x020015, 0x014015, 0x024015, 0x001015, 0x011015,
+    0x005015, 0x015015, 0x002015, 0x006015, 0x011415, 0x011115, 0x018055, 0x028055,
+    0x009055, 0x019055, 0x00a055, 0x020025, 0x024025, 0x011025, 0x015025, 0x002025,
+    0x006025, 0x028065, 0x019065, 0x00a065, 0x020002, 0x004002, 0x014002, 0x024002,
+    0x011002, 0x005002, 0x015002, 0x002002, 0x006002, 0x010402, 0x001402, 0x011402,
+    0x020042, 0x008042, 0x018042, 0x028042, 0x011042, 0x009042, 0x019042, 0x002042,
+    0x00a042, 0x020012, 0x014012, 0x024012, 0x011012, 0x005012, 0x015012, 0x002012,
+    0x006012, 0x011412, 0x020052, 0x018052, 0x028052, 0x011052, 0x009052, 0x019052,
+    0x002052, 0x00a052, 0x020022, 0x024022, 0x011022, 0x015022, 0x002022, 0x006022,
+    0x020062, 0x028062, 0x011062, 0x019062, 0x002062, 0x00a062,
+  };
+  const genie::SKAmplitudeTerm_t kTermsPP[3407] = {
+    {   0, 0x0201002001ULL, -96.0}, {   1, 0x020000a001ULL, 96.0},
+    {   2, 0x0000202201ULL, 64.0}, {   2, 0x0200202201ULL, 64.0},
+    {   2, 0x0000402201ULL, 21.333333333333332}, {   2, 0x0200402201ULL, 21.333333333333332},
+    {   2, 0x0040202011ULL, -21.333333333333332}, {   2, 0x0240202011ULL, 10.666666666666666},
+    {   2, 0x0000202002ULL, 64.0}, {   2, 0x0200202002ULL, 64.0},
+    {   2, 0x0000402002ULL, 21.333333333333332}, {   2, 0x0200402002ULL, 21.333333333333332},
+    {   2, 0x0040202202ULL, -21.333333333333332}, {   2, 0x0240202202ULL, -21.333333333333332},
+    {   2, 0x0040202003ULL, -21.333333333333332}, {   2, 0x0240202003ULL, -21.333333333333332},
+    {   3, 0x0041204201ULL, -2.6666666666666665}, {   3, 0x0001202011ULL, 24.0},
+    {   3, 0x0041204002ULL, -2.6666666666666665}, {   4, 0x004020c201ULL, 2.6666666666666665},
+    {   4, 0x000020a011ULL, -24.0}, {   4, 0x004020c002ULL, 2.6666666666666665},
+    {   5, 0x0000402211ULL, -16.0}, {   5, 0x0000602211ULL, -10.666666666666666},
+    {   5, 0x0000802211ULL, -1.7777777777777777}, {   5, 0x0040402411ULL, -2.6666666666666665},
+    {   5, 0x0040602411ULL, 1.7777777777777777}, {   5, 0x0040402021ULL, -2.6666666666666665},
+    {   5, 0x0040602021ULL, 1.7777777777777777}, {   5, 0x0000402012ULL, -16.0},
+    {   5, 0x0000602012ULL, -10.666666666666666}, {   5, 0x0000802012ULL, -1.7777777777777777},
+    {   5, 0x0040602212ULL, 7.111111111111111}, {   5, 0x0040402013ULL, 2.6666666666666665},
+    {   5, 0x0040602013ULL, 5.333333333333333}, {   6, 0x0000404201ULL, -16.0},
+    {   6, 0x0000402211ULL, 5.333333333333333}, {   6, 0x0000404002ULL, -16.0},
+    {   6, 0x0000402012ULL, 5.333333333333333}, {   7, 0x0000804211ULL, 1.7777777777777777},
+    {   7, 0x0000804012ULL, 1.7777777777777777}, {   8, 0x0000042041ULL, -64.0},
+    {   8, 0x0200042041ULL, -64.0}, {   8, 0x0000082041ULL, 64.0},
+    {   8, 0x0200082041ULL, 64.0}, {   8, 0x0008042011ULL, 64.0},
+    {   8, 0x0208042011ULL, -32.0}, {   8, 0x0000042002ULL, -64.0},
+    {   8, 0x0200042002ULL, -64.0}, {   8, 0x0000082002ULL, 64.0},
+    {   8, 0x0200082002ULL, 64.0}, {   8, 0x0008042042ULL, 64.0},
+    {   8, 0x0208042042ULL, 64.0}, {   8, 0x0008042003ULL, 64.0},
+    {   8, 0x0208042003ULL, 64.0}, {   9, 0x0009044041ULL, 8.0},
+    {   9, 0x0001042011ULL, -24.0}, {   9, 0x0009044002ULL, 8.0},
+    {  10, 0x000804c041ULL, -8.0}, {  10, 0x000004a011ULL, 24.0},
+    {  10, 0x000804c002ULL, -8.0}, {  11, 0x0000242211ULL, 16.0},
+    {  11, 0x0000442211ULL, 5.333333333333333}, {  11, 0x0000282211ULL, -16.0},
+    {  11, 0x0000482211ULL, -5.333333333333333}, {  11, 0x0000242051ULL, 16.0},
+    {  11, 0x0000442051ULL, 5.333333333333333}, {  11, 0x0000282051ULL, -16.0},
+    {  11, 0x0000482051ULL, -5.333333333333333}, {  11, 0x0040242251ULL, 2.6666666666666665},
+    {  11, 0x0008242251ULL, 8.0}, {  11, 0x0008442251ULL, -5.333333333333333},
+    {  11, 0x0040282251ULL, 5.333333333333333}, {  11, 0x0040242021ULL, 2.6666666666666665},
+    {  11, 0x0008242021ULL, 8.0}, {  11, 0x0008442021ULL, -5.333333333333333},
+    {  11, 0x0040282021ULL, 5.333333333333333}, {  11, 0x0000242012ULL, 32.0},
+    {  11, 0x0000442012ULL, 10.666666666666666}, {  11, 0x0000282012ULL, -32.0},
+    {  11, 0x0000482012ULL, -10.666666666666666}, {  11, 0x0040242212ULL, -2.6666666666666665},
+    {  11, 0x0008242212ULL, 8.0}, {  11, 0x0008442212ULL, -10.666666666666666},
+    {  11, 0x0040282212ULL, 10.666666666666666}, {  11, 0x0040242052ULL, 2.6666666666666665},
+    {  11, 0x0008242052ULL, -8.0}, {  11, 0x0008442052ULL, -10.666666666666666},
+    {  11, 0x0040282052ULL, 10.666666666666666}, {  11, 0x0040242013ULL, -2.6666666666666665},
+    {  11, 0x0008242013ULL, -8.0}, {  11, 0x0008442013ULL, -16.0},
+    {  11, 0x0040282013ULL, 16.0}, {  12, 0x0000084041ULL, -48.0},
+    {  12, 0x0000082051ULL, 16.0}, {  12, 0x0000084002ULL, -48.0},
+    {  12, 0x0000082012ULL, 16.0}, {  13, 0x0000484211ULL, 5.333333333333333},
+    {  13, 0x0000484051ULL, 5.333333333333333}, {  13, 0x0000484012ULL, 10.666666666666666},
+    {  14, 0x0000082051ULL, -16.0}, {  14, 0x00000c2051ULL, 32.0},
+    {  14, 0x0000102051ULL, -16.0}, {  14, 0x0008082091ULL, -8.0},
+    {  14, 0x00080c2091ULL, -16.0}, {  14, 0x0008082021ULL, -8.0},
+    {  14, 0x00080c2021ULL, -16.0}, {  14, 0x0000082012ULL, -16.0},
+    {  14, 0x00000c2012ULL, 32.0}, {  14, 0x0000102012ULL, -16.0},
+    {  14, 0x00080c2052ULL, -64.0}, {  14, 0x0008082013ULL, 8.0},
+    {  14, 0x00080c2013ULL, -48.0}, {  15, 0x0000104051ULL, 16.0},
+    {  15, 0x0000104012ULL, 16.0}, {  16, 0x0201000001ULL, -128.0},
+    {  17, 0x0200008001ULL, 128.0}, {  18, 0x0200200201ULL, 128.0},
+    {  18, 0x0000400201ULL, 42.666666666666664}, {  18, 0x0200200002ULL, 128.0},
+    {  18, 0x0000400002ULL, 42.666666666666664}, {  19, 0x0041202201ULL, -5.333333333333333},
+    {  19, 0x0001200011ULL, 32.0}, {  19, 0x0041202002ULL, -5.333333333333333},
+    {  20, 0x004020a201ULL, 5.333333333333333}, {  20, 0x0000208011ULL, -32.0},
+    {  20, 0x004020a002ULL, 5.333333333333333}, {  21, 0x0000400211ULL, -32.0},
+    {  21, 0x0000800211ULL, -3.5555555555555554}, {  21, 0x0000400012ULL, -32.0},
+    {  21, 0x0000800012ULL, -3.5555555555555554}, {  22, 0x0000402201ULL, -32.0},
+    {  22, 0x0000402002ULL, -32.0}, {  23, 0x0000802211ULL, 3.5555555555555554},
+    {  23, 0x0000802012ULL, 3.5555555555555554}, {  24, 0x0200040041ULL, -128.0},
+    {  24, 0x0000080041ULL, 128.0}, {  24, 0x0200040002ULL, -128.0},
+    {  24, 0x0000080002ULL, 128.0}, {  25, 0x0009042041ULL, 16.0},
+    {  25, 0x0001040011ULL, -32.0}, {  25, 0x0009042002ULL, 16.0},
+    {  26, 0x000804a041ULL, -16.0}, {  26, 0x0000048011ULL, 32.0},
+    {  26, 0x000804a002ULL, -16.0}, {  27, 0x0000240211ULL, 32.0},
+    {  27, 0x0000480211ULL, -10.666666666666666}, {  27, 0x0000240051ULL, 32.0},
+    {  27, 0x0000480051ULL, -10.666666666666666}, {  27, 0x0000240012ULL, 64.0},
+    {  27, 0x0000480012ULL, -21.333333333333332}, {  28, 0x0000082041ULL, -96.0},
+    {  28, 0x0000082002ULL, -96.0}, {  29, 0x0000482211ULL, 10.666666666666666},
+    {  29, 0x0000482051ULL, 10.666666666666666}, {  29, 0x0000482012ULL, 21.333333333333332},
+    {  30, 0x0000080051ULL, -32.0}, {  30, 0x0000100051ULL, -32.0},
+    {  30, 0x0000080012ULL, -32.0}, {  30, 0x0000100012ULL, -32.0},
+    {  31, 0x0000102051ULL, 32.0}, {  31, 0x0000102012ULL, 32.0},
+    {  32, 0x0041202201ULL, -5.333333333333333}, {  32, 0x0041202002ULL, -5.333333333333333},
+    {  33, 0x004020a201ULL, 5.333333333333333}, {  33, 0x004020a002ULL, 5.333333333333333},
+    {  34, 0x0080402211ULL, 3.5555555555555554}, {  34, 0x0080402012ULL, 3.5555555555555554},
+    {  35, 0x0000402201ULL, 32.0}, {  35, 0x0000402002ULL, 32.0},
+    {  36, 0x0000802211ULL, -3.5555555555555554}, {  36, 0x0000802012ULL, -3.5555555555555554},
+    {  37, 0x0009042041ULL, 16.0}, {  37, 0x0009042002ULL, 16.0},
+    {  38, 0x000804a041ULL, -16.0}, {  38, 0x000804a002ULL, -16.0},
+    {  39, 0x0048242211ULL, -10.666666666666666}, {  39, 0x0048242051ULL, -10.666666666666666},
+    {  39, 0x0048242012ULL, -21.333333333333332}, {  40, 0x0000082041ULL, 96.0},
+    {  40, 0x0000082002ULL, 96.0}, {  41, 0x0000482211ULL, -10.666666666666666},
+    {  41, 0x0000482051ULL, -10.666666666666666}, {  41, 0x0000482012ULL, -21.333333333333332},
+    {  42, 0x0010082051ULL, 32.0}, {  42, 0x0010082012ULL, 32.0},
+    {  43, 0x0000102051ULL, -32.0}, {  43, 0x0000102012ULL, -32.0},
+    {  44, 0x0000000002ULL, -128.0}, {  44, 0x0400000002ULL, 128.0},
+    {  45, 0x0201002001ULL, -32.0}, {  45, 0x0201000011ULL, 64.0},
+    {  46, 0x020000a001ULL, 32.0}, {  46, 0x0200008011ULL, -64.0},
+    {  47, 0x0240202011ULL, 32.0}, {  47, 0x0200200012ULL, -64.0},
+    {  47, 0x0000400012ULL, 21.333333333333332}, {  48, 0x0001202011ULL, 8.0},
+    {  48, 0x0041202211ULL, 5.333333333333333}, {  48, 0x0001200021ULL, -16.0},
+    {  48, 0x0041202012ULL, 5.333333333333333}, {  49, 0x000020a011ULL, -8.0},
+    {  49, 0x004020a211ULL, -5.333333333333333}, {  49, 0x0000208021ULL, 16.0},
+    {  49, 0x004020a012ULL, -5.333333333333333}, {  50, 0x0040402411ULL, -8.0},
+    {  50, 0x0040402021ULL, -8.0}, {  50, 0x0080402221ULL, 0.8888888888888888},
+    {  50, 0x0040402212ULL, -16.0}, {  50, 0x0000400412ULL, 8.0},
+    {  50, 0x0000800412ULL, -0.8888888888888888}, {  50, 0x0080402412ULL, 1.7777777777777777},
+    {  50, 0x0000400022ULL, 8.0}, {  50, 0x0000800022ULL, -0.8888888888888888},
+    {  50, 0x0080402022ULL, 1.7777777777777777}, {  50, 0x0040402013ULL, -8.0},
+    {  50, 0x0000400213ULL, 16.0}, {  50, 0x0000800213ULL, -1.7777777777777777},
+    {  50, 0x0080402213ULL, 3.5555555555555554}, {  50, 0x0000400014ULL, 8.0},
+    {  50, 0x0000800014ULL, -0.8888888888888888}, {  50, 0x0080402014ULL, 1.7777777777777777},
+    {  51, 0x0000402211ULL, 21.333333333333332}, {  51, 0x0000402012ULL, 21.333333333333332},
+    {  52, 0x0000802221ULL, -1.7777777777777777}, {  52, 0x0000802412ULL, -1.7777777777777777},
+    {  52, 0x0000802022ULL, -1.7777777777777777}, {  52, 0x0000802213ULL, -3.5555555555555554},
+    {  52, 0x0000802014ULL, -1.7777777777777777}, {  53, 0x0000404211ULL, -10.666666666666666},
+    {  53, 0x0000404012ULL, -10.666666666666666}, {  54, 0x0000804221ULL, 0.8888888888888888},
+    {  54, 0x0000804412ULL, 0.8888888888888888}, {  54, 0x0000804022ULL, 0.8888888888888888},
+    {  54, 0x0000804213ULL, 1.7777777777777777}, {  54, 0x0000804014ULL, 0.8888888888888888},
+    {  55, 0x0208042011ULL, -96.0}, {  55, 0x0200040012ULL, 64.0},
+    {  55, 0x0000080012ULL, 64.0}, {  56, 0x0001042011ULL, -8.0},
+    {  56, 0x0009042051ULL, -16.0}, {  56, 0x0001040021ULL, 16.0},
+    {  56, 0x0009042012ULL, -16.0}, {  57, 0x000004a011ULL, 8.0},
+    {  57, 0x000804a051ULL, 16.0}, {  57, 0x0000048021ULL, -16.0},
+    {  57, 0x000804a012ULL, 16.0}, {  58, 0x0040242251ULL, 8.0},
+    {  58, 0x0008242251ULL, 24.0}, {  58, 0x0040242021ULL, 8.0},
+    {  58, 0x0008242021ULL, 24.0}, {  58, 0x0048242221ULL, -2.6666666666666665},
+    {  58, 0x0048242061ULL, -2.6666666666666665}, {  58, 0x0040242212ULL, 8.0},
+    {  58, 0x0008242212ULL, 24.0}, {  58, 0x0040242052ULL, 8.0},
+    {  58, 0x0008242052ULL, 24.0}, {  58, 0x0000240252ULL, -16.0},
+    {  58, 0x0000480252ULL, -5.333333333333333}, {  58, 0x0048242252ULL, -10.666666666666666},
+    {  58, 0x0000240022ULL, -16.0}, {  58, 0x0000480022ULL, -5.333333333333333},
+    {  58, 0x0048242022ULL, -10.666666666666666}, {  58, 0x0040242013ULL, 8.0},
+    {  58, 0x0008242013ULL, 24.0}, {  58, 0x0000240213ULL, -16.0},
+    {  58, 0x0000480213ULL, -5.333333333333333}, {  58, 0x0048242213ULL, -10.666666666666666},
+    {  58, 0x0000240053ULL, -16.0}, {  58, 0x0000480053ULL, -5.333333333333333},
+    {  58, 0x0048242053ULL, -10.666666666666666}, {  58, 0x0000240014ULL, -16.0},
+    {  58, 0x0000480014ULL, -5.333333333333333}, {  58, 0x0048242014ULL, -10.666666666666666},
+    {  59, 0x0000082051ULL, 64.0}, {  59, 0x0000082012ULL, 64.0},
+    {  60, 0x0000482221ULL, -5.333333333333333}, {  60, 0x0000482061ULL, -5.333333333333333},
+    {  60, 0x0000482252ULL, -10.666666666666666}, {  60, 0x0000482022ULL, -10.666666666666666},
+    {  60, 0x0000482213ULL, -10.666666666666666}, {  60, 0x0000482053ULL, -10.666666666666666},
+    {  60, 0x0000482014ULL, -10.666666666666666}, {  61, 0x0000084051ULL, -32.0},
+    {  61, 0x0000084012ULL, -32.0}, {  62, 0x0000484221ULL, 2.6666666666666665},
+    {  62, 0x0000484061ULL, 2.6666666666666665}, {  62, 0x0000484252ULL, 5.333333333333333},
+    {  62, 0x0000484022ULL, 5.333333333333333}, {  62, 0x0000484213ULL, 5.333333333333333},
+    {  62, 0x0000484053ULL, 5.333333333333333}, {  62, 0x0000484014ULL, 5.333333333333333},
+    {  63, 0x0008082091ULL, -24.0}, {  63, 0x0008082021ULL, -24.0},
+    {  63, 0x0010082061ULL, 8.0}, {  63, 0x0008082052ULL, -48.0},
+    {  63, 0x0000080092ULL, 8.0}, {  63, 0x0000100092ULL, -8.0},
+    {  63, 0x0010082092ULL, 16.0}, {  63, 0x0000080022ULL, 8.0},
+    {  63, 0x0000100022ULL, -8.0}, {  63, 0x0010082022ULL, 16.0},
+    {  63, 0x0008082013ULL, -24.0}, {  63, 0x0000080053ULL, 16.0},
+    {  63, 0x0000100053ULL, -16.0}, {  63, 0x0010082053ULL, 32.0},
+    {  63, 0x0000080014ULL, 8.0}, {  63, 0x0000100014ULL, -8.0},
+    {  63, 0x0010082014ULL, 16.0}, {  64, 0x0000102061ULL, -16.0},
+    {  64, 0x0000102092ULL, -16.0}, {  64, 0x0000102022ULL, -16.0},
+    {  64, 0x0000102053ULL, -32.0}, {  64, 0x0000102014ULL, -16.0},
+    {  65, 0x0000104061ULL, 8.0}, {  65, 0x0000104092ULL, 8.0},
+    {  65, 0x0000104022ULL, 8.0}, {  65, 0x0000104053ULL, 16.0},
+    {  65, 0x0000104014ULL, 8.0}, {  66, 0x0000200201ULL, -64.0},
+    {  66, 0x0200200201ULL, 64.0}, {  66, 0x0000400201ULL, 21.333333333333332},
+    {  66, 0x0200400201ULL, -21.333333333333332}, {  66, 0x0040200011ULL, 21.333333333333332},
+    {  66, 0x0240200011ULL, 21.333333333333332}, {  66, 0x0000200002ULL, -64.0},
+    {  66, 0x0200200002ULL, 64.0}, {  66, 0x0000400002ULL, 21.333333333333332},
+    {  66, 0x0200400002ULL, -21.333333333333332}, {  66, 0x0040200202ULL, 21.333333333333332},
+    {  66, 0x0240200202ULL, -21.333333333333332}, {  66, 0x0040200003ULL, 21.333333333333332},
+    {  66, 0x0240200003ULL, -21.333333333333332}, {  67, 0x0041202201ULL, 2.6666666666666665},
+    {  67, 0x0041202002ULL, 2.6666666666666665}, {  68, 0x004020a201ULL, -2.6666666666666665},
+    {  68, 0x004020a002ULL, -2.6666666666666665}, {  69, 0x0000400211ULL, -16.0},
+    {  69, 0x0000600211ULL, 10.666666666666666}, {  69, 0x0000800211ULL, -1.7777777777777777},
+    {  69, 0x0080402211ULL, -2.6666666666666665}, {  69, 0x0040400411ULL, -5.333333333333333},
+    {  69, 0x0040600411ULL, -1.7777777777777777}, {  69, 0x0040400021ULL, -5.333333333333333},
+    {  69, 0x0040600021ULL, -1.7777777777777777}, {  69, 0x0000400012ULL, -16.0},
+    {  69, 0x0000600012ULL, 10.666666666666666}, {  69, 0x0000800012ULL, -1.7777777777777777},
+    {  69, 0x0080402012ULL, -2.6666666666666665}, {  69, 0x0040600212ULL, -7.111111111111111},
+    {  69, 0x0040400013ULL, 5.333333333333333}, {  69, 0x0040600013ULL, -5.333333333333333},
+    {  70, 0x0000404201ULL, 5.333333333333333}, {  70, 0x0000402211ULL, -5.333333333333333},
+    {  70, 0x0000404002ULL, 5.333333333333333}, {  70, 0x0000402012ULL, -5.333333333333333},
+    {  71, 0x0000804211ULL, -0.8888888888888888}, {  71, 0x0000804012ULL, -0.8888888888888888},
+    {  72, 0x0000040041ULL, 64.0}, {  72, 0x0200040041ULL, -64.0},
+    {  72, 0x0000080041ULL, 64.0}, {  72, 0x0200080041ULL, -64.0},
+    {  72, 0x0008040011ULL, -64.0}, {  72, 0x0208040011ULL, -64.0},
+    {  72, 0x0000040002ULL, 64.0}, {  72, 0x0200040002ULL, -64.0},
+    {  72, 0x0000080002ULL, 64.0}, {  72, 0x0200080002ULL, -64.0},
+    {  72, 0x0008040042ULL, -64.0}, {  72, 0x0208040042ULL, 64.0},
+    {  72, 0x0008040003ULL, -64.0}, {  72, 0x0208040003ULL, 64.0},
+    {  73, 0x0009042041ULL, -8.0}, {  73, 0x0009042002ULL, -8.0},
+    {  74, 0x000804a041ULL, 8.0}, {  74, 0x000804a002ULL, 8.0},
+    {  75, 0x0000240211ULL, 16.0}, {  75, 0x0000440211ULL, -5.333333333333333},
+    {  75, 0x0000280211ULL, 16.0}, {  75, 0x0000480211ULL, -5.333333333333333},
+    {  75, 0x0048242211ULL, 8.0}, {  75, 0x0000240051ULL, 16.0},
+    {  75, 0x0000440051ULL, -5.333333333333333}, {  75, 0x0000280051ULL, 16.0},
+    {  75, 0x0000480051ULL, -5.333333333333333}, {  75, 0x0048242051ULL, 8.0},
+    {  75, 0x0040240251ULL, 5.333333333333333}, {  75, 0x0008240251ULL, 16.0},
+    {  75, 0x0008440251ULL, 5.333333333333333}, {  75, 0x0040280251ULL, -5.333333333333333},
+    {  75, 0x0040240021ULL, 5.333333333333333}, {  75, 0x0008240021ULL, 16.0},
+    {  75, 0x0008440021ULL, 5.333333333333333}, {  75, 0x0040280021ULL, -5.333333333333333},
+    {  75, 0x0000240012ULL, 32.0}, {  75, 0x0000440012ULL, -10.666666666666666},
+    {  75, 0x0000280012ULL, 32.0}, {  75, 0x0000480012ULL, -10.666666666666666},
+    {  75, 0x0048242012ULL, 16.0}, {  75, 0x0008440212ULL, 10.666666666666666},
+    {  75, 0x0040280212ULL, -10.666666666666666}, {  75, 0x0008440052ULL, 10.666666666666666},
+    {  75, 0x0040280052ULL, -10.666666666666666}, {  75, 0x0040240013ULL, -5.333333333333333},
+    {  75, 0x0008240013ULL, -16.0}, {  75, 0x0008440013ULL, 16.0},
+    {  75, 0x0040280013ULL, -16.0}, {  76, 0x0000084041ULL, 16.0},
+    {  76, 0x0000082051ULL, -16.0}, {  76, 0x0000084002ULL, 16.0},
+    {  76, 0x0000082012ULL, -16.0}, {  77, 0x0000484211ULL, -2.6666666666666665},
+    {  77, 0x0000484051ULL, -2.6666666666666665}, {  77, 0x0000484012ULL, -5.333333333333333},
+    {  78, 0x0000080051ULL, -16.0}, {  78, 0x00000c0051ULL, -32.0},
+    {  78, 0x0000100051ULL, -16.0}, {  78, 0x0010082051ULL, -24.0},
+    {  78, 0x0008080091ULL, -16.0}, {  78, 0x00080c0091ULL, 16.0},
+    {  78, 0x0008080021ULL, -16.0}, {  78, 0x00080c0021ULL, 16.0},
+    {  78, 0x0000080012ULL, -16.0}, {  78, 0x00000c0012ULL, -32.0},
+    {  78, 0x0000100012ULL, -16.0}, {  78, 0x0010082012ULL, -24.0},
+    {  78, 0x00080c0052ULL, 64.0}, {  78, 0x0008080013ULL, 16.0},
+    {  78, 0x00080c0013ULL, 48.0}, {  79, 0x0000104051ULL, -8.0},
+    {  79, 0x0000104012ULL, -8.0}, {  80, 0x0080400211ULL, -3.5555555555555554},
+    {  80, 0x0080400012ULL, -3.5555555555555554}, {  81, 0x0000402201ULL, 10.666666666666666},
+    {  81, 0x0000402002ULL, 10.666666666666666}, {  82, 0x0000802211ULL, -1.7777777777777777},
+    {  82, 0x0000802012ULL, -1.7777777777777777}, {  83, 0x0048240211ULL, 10.666666666666666},
+    {  83, 0x0048240051ULL, 10.666666666666666}, {  83, 0x0048240012ULL, 21.333333333333332},
+    {  84, 0x0000082041ULL, 32.0}, {  84, 0x0000082002ULL, 32.0},
+    {  85, 0x0000482211ULL, -5.333333333333333}, {  85, 0x0000482051ULL, -5.333333333333333},
+    {  85, 0x0000482012ULL, -10.666666666666666}, {  86, 0x0010080051ULL, -32.0},
+    {  86, 0x0010080012ULL, -32.0}, {  87, 0x0000102051ULL, -16.0},
+    {  87, 0x0000102012ULL, -16.0}, {  88, 0x0000200201ULL, -64.0},
+    {  88, 0x0200200201ULL, -64.0}, {  88, 0x0000400201ULL, -21.333333333333332},
+    {  88, 0x0200400201ULL, -21.333333333333332}, {  88, 0x0040200011ULL, 21.333333333333332},
+    {  88, 0x0240200011ULL, -21.333333333333332}, {  88, 0x0000200002ULL, -64.0},
+    {  88, 0x0200200002ULL, -64.0}, {  88, 0x0000400002ULL, -21.333333333333332},
+    {  88, 0x0200400002ULL, -21.333333333333332}, {  88, 0x0040200202ULL, 21.333333333333332},
+    {  88, 0x0240200202ULL, 21.333333333333332}, {  88, 0x0040200003ULL, 21.333333333333332},
+    {  88, 0x0240200003ULL, 21.333333333333332}, {  89, 0x0041202201ULL, 2.6666666666666665},
+    {  89, 0x0041202002ULL, 2.6666666666666665}, {  90, 0x004020a201ULL, -2.6666666666666665},
+    {  90, 0x004020a002ULL, -2.6666666666666665}, {  91, 0x0000400211ULL, 16.0},
+    {  91, 0x0000600211ULL, 10.666666666666666}, {  91, 0x0000800211ULL, 1.7777777777777777},
+    {  91, 0x0080402211ULL, 2.6666666666666665}, {  91, 0x0040400411ULL, 5.333333333333333},
+    {  91, 0x0040600411ULL, -1.7777777777777777}, {  91, 0x0040400021ULL, 5.333333333333333},
+    {  91, 0x0040600021ULL, -1.7777777777777777}, {  91, 0x0000400012ULL, 16.0},
+    {  91, 0x0000600012ULL, 10.666666666666666}, {  91, 0x0000800012ULL, 1.7777777777777777},
+    {  91, 0x0080402012ULL, 2.6666666666666665}, {  91, 0x0040600212ULL, -7.111111111111111},
+    {  91, 0x0040400013ULL, -5.333333333333333}, {  91, 0x0040600013ULL, -5.333333333333333},
+    {  92, 0x0000402201ULL, 32.0}, {  92, 0x0000402002ULL, 32.0},
+    {  93, 0x0000802211ULL, -3.5555555555555554}, {  93, 0x0000802012ULL, -3.5555555555555554},
+    {  94, 0x0000404201ULL, -5.333333333333333}, {  94, 0x0000402211ULL, 5.333333333333333},
+    {  94, 0x0000404002ULL, -5.333333333333333}, {  94, 0x0000402012ULL, 5.333333333333333},
+    {  95, 0x0000804211ULL, 0.8888888888888888}, {  95, 0x0000804012ULL, 0.8888888888888888},
+    {  96, 0x0000040041ULL, 64.0}, {  96, 0x0200040041ULL, 64.0},
+    {  96, 0x0000080041ULL, -64.0}, {  96, 0x0200080041ULL, -64.0},
+    {  96, 0x0008040011ULL, -64.0}, {  96, 0x0208040011ULL, 64.0},
+    {  96, 0x0000040002ULL, 64.0}, {  96, 0x0200040002ULL, 64.0},
+    {  96, 0x0000080002ULL, -64.0}, {  96, 0x0200080002ULL, -64.0},
+    {  96, 0x0008040042ULL, -64.0}, {  96, 0x0208040042ULL, -64.0},
+    {  96, 0x0008040003ULL, -64.0}, {  96, 0x0208040003ULL, -64.0},
+    {  97, 0x0009042041ULL, -8.0}, {  97, 0x0009042002ULL, -8.0},
+    {  98, 0x000804a041ULL, 8.0}, {  98, 0x000804a002ULL, 8.0},
+    {  99, 0x0000240211ULL, -16.0}, {  99, 0x0000440211ULL, -5.333333333333333},
+    {  99, 0x0000280211ULL, 16.0}, {  99, 0x0000480211ULL, 5.333333333333333},
+    {  99, 0x0048242211ULL, -8.0}, {  99, 0x0000240051ULL, -16.0},
+    {  99, 0x0000440051ULL, -5.333333333333333}, {  99, 0x0000280051ULL, 16.0},
+    {  99, 0x0000480051ULL, 5.333333333333333}, {  99, 0x0048242051ULL, -8.0},
+    {  99, 0x0040240251ULL, -5.333333333333333}, {  99, 0x0008240251ULL, -16.0},
+    {  99, 0x0008440251ULL, 5.333333333333333}, {  99, 0x0040280251ULL, -5.333333333333333},
+    {  99, 0x0040240021ULL, -5.333333333333333}, {  99, 0x0008240021ULL, -16.0},
+    {  99, 0x0008440021ULL, 5.333333333333333}, {  99, 0x0040280021ULL, -5.333333333333333},
+    {  99, 0x0000240012ULL, -32.0}, {  99, 0x0000440012ULL, -10.666666666666666},
+    {  99, 0x0000280012ULL, 32.0}, {  99, 0x0000480012ULL, 10.666666666666666},
+    {  99, 0x0048242012ULL, -16.0}, {  99, 0x0008440212ULL, 10.666666666666666},
+    {  99, 0x0040280212ULL, -10.666666666666666}, {  99, 0x0008440052ULL, 10.666666666666666},
+    {  99, 0x0040280052ULL, -10.666666666666666}, {  99, 0x0040240013ULL, 5.333333333333333},
+    {  99, 0x0008240013ULL, 16.0}, {  99, 0x0008440013ULL, 16.0},
+    {  99, 0x0040280013ULL, -16.0}, { 100, 0x0000082041ULL, 96.0},
+    { 100, 0x0000082002ULL, 96.0}, { 101, 0x0000482211ULL, -10.666666666666666},
+    { 101, 0x0000482051ULL, -10.666666666666666}, { 101, 0x0000482012ULL, -21.333333333333332},
+    { 102, 0x0000084041ULL, -16.0}, { 102, 0x0000082051ULL, 16.0},
+    { 102, 0x0000084002ULL, -16.0}, { 102, 0x0000082012ULL, 16.0},
+    { 103, 0x0000484211ULL, 2.6666666666666665}, { 103, 0x0000484051ULL, 2.6666666666666665},
+    { 103, 0x0000484012ULL, 5.333333333333333}, { 104, 0x0000080051ULL, 16.0},
+    { 104, 0x00000c0051ULL, -32.0}, { 104, 0x0000100051ULL, 16.0},
+    { 104, 0x0010082051ULL, 24.0}, { 104, 0x0008080091ULL, 16.0},
+    { 104, 0x00080c0091ULL, 16.0}, { 104, 0x0008080021ULL, 16.0},
+    { 104, 0x00080c0021ULL, 16.0}, { 104, 0x0000080012ULL, 16.0},
+    { 104, 0x00000c0012ULL, -32.0}, { 104, 0x0000100012ULL, 16.0},
+    { 104, 0x0010082012ULL, 24.0}, { 104, 0x00080c0052ULL, 64.0},
+    { 104, 0x0008080013ULL, -16.0}, { 104, 0x00080c0013ULL, 48.0},
+    { 105, 0x0000102051ULL, -32.0}, { 105, 0x0000102012ULL, -32.0},
+    { 106, 0x0000104051ULL, 8.0}, { 106, 0x0000104012ULL, 8.0},
+    { 107, 0x0041200201ULL, 21.333333333333332}, { 107, 0x0041200002ULL, 21.333333333333332},
+    { 108, 0x0040208201ULL, -21.333333333333332}, { 108, 0x0040208002ULL, -21.333333333333332},
+    { 109, 0x0000402201ULL, -21.333333333333332}, { 109, 0x0000402002ULL, -21.333333333333332},
+    { 110, 0x0000802211ULL, 3.5555555555555554}, { 110, 0x0000802012ULL, 3.5555555555555554},
+    { 111, 0x0009040041ULL, -64.0}, { 111, 0x0009040002ULL, -64.0},
+    { 112, 0x0008048041ULL, 64.0}, { 112, 0x0008048002ULL, 64.0},
+    { 113, 0x0000082041ULL, -64.0}, { 113, 0x0000082002ULL, -64.0},
+    { 114, 0x0000482211ULL, 10.666666666666666}, { 114, 0x0000482051ULL, 10.666666666666666},
+    { 114, 0x0000482012ULL, 21.333333333333332}, { 115, 0x0000102051ULL, 32.0},
+    { 115, 0x0000102012ULL, 32.0}, { 116, 0x0080400211ULL, -3.5555555555555554},
+    { 116, 0x0080400012ULL, -3.5555555555555554}, { 117, 0x0000402201ULL, 10.666666666666666},
+    { 117, 0x0000402002ULL, 10.666666666666666}, { 118, 0x0000802211ULL, -1.7777777777777777},
+    { 118, 0x0000802012ULL, -1.7777777777777777}, { 119, 0x0048240211ULL, 10.666666666666666},
+    { 119, 0x0048240051ULL, 10.666666666666666}, { 119, 0x0048240012ULL, 21.333333333333332},
+    { 120, 0x0000082041ULL, 32.0}, { 120, 0x0000082002ULL, 32.0},
+    { 121, 0x0000482211ULL, -5.333333333333333}, { 121, 0x0000482051ULL, -5.333333333333333},
+    { 121, 0x0000482012ULL, -10.666666666666666}, { 122, 0x0010080051ULL, -32.0},
+    { 122, 0x0010080012ULL, -32.0}, { 123, 0x0000102051ULL, -16.0},
+    { 123, 0x0000102012ULL, -16.0}, { 124, 0x0240200011ULL, -42.666666666666664},
+    { 125, 0x0041200211ULL, -10.666666666666666}, { 125, 0x0041200012ULL, -10.666666666666666},
+    { 126, 0x0040208211ULL, 10.666666666666666}, { 126, 0x0040208012ULL, 10.666666666666666},
+    { 127, 0x0040400411ULL, 10.666666666666666}, { 127, 0x0040400021ULL, 10.666666666666666},
+    { 127, 0x0040400212ULL, 21.333333333333332}, { 127, 0x0080400412ULL, -1.7777777777777777},
+    { 127, 0x0080400022ULL, -1.7777777777777777}, { 127, 0x0040400013ULL, 10.666666666666666},
+    { 127, 0x0080400213ULL, -3.5555555555555554}, { 127, 0x0080400014ULL, -1.7777777777777777},
+    { 128, 0x0000402211ULL, 21.333333333333332}, { 128, 0x0000402012ULL, 21.333333333333332},
+    { 129, 0x0000802221ULL, -1.7777777777777777}, { 129, 0x0000802412ULL, -1.7777777777777777},
+    { 129, 0x0000802022ULL, -1.7777777777777777}, { 129, 0x0000802213ULL, -3.5555555555555554},
+    { 129, 0x0000802014ULL, -1.7777777777777777}, { 130, 0x0208040011ULL, 128.0},
+    { 131, 0x0009040051ULL, 32.0}, { 131, 0x0009040012ULL, 32.0},
+    { 132, 0x0008048051ULL, -32.0}, { 132, 0x0008048012ULL, -32.0},
+    { 133, 0x0040240251ULL, -10.666666666666666}, { 133, 0x0008240251ULL, -32.0},
+    { 133, 0x0040240021ULL, -10.666666666666666}, { 133, 0x0008240021ULL, -32.0},
+    { 133, 0x0040240212ULL, -10.666666666666666}, { 133, 0x0008240212ULL, -32.0},
+    { 133, 0x0040240052ULL, -10.666666666666666}, { 133, 0x0008240052ULL, -32.0},
+    { 133, 0x0048240252ULL, 10.666666666666666}, { 133, 0x0048240022ULL, 10.666666666666666},
+    { 133, 0x0040240013ULL, -10.666666666666666}, { 133, 0x0008240013ULL, -32.0},
+    { 133, 0x0048240213ULL, 10.666666666666666}, { 133, 0x0048240053ULL, 10.666666666666666},
+    { 133, 0x0048240014ULL, 10.666666666666666}, { 134, 0x0000082051ULL, 64.0},
+    { 134, 0x0000082012ULL, 64.0}, { 135, 0x0000482221ULL, -5.333333333333333},
+    { 135, 0x0000482061ULL, -5.333333333333333}, { 135, 0x0000482252ULL, -10.666666666666666},
+    { 135, 0x0000482022ULL, -10.666666666666666}, { 135, 0x0000482213ULL, -10.666666666666666},
+    { 135, 0x0000482053ULL, -10.666666666666666}, { 135, 0x0000482014ULL, -10.666666666666666},
+    { 136, 0x0008080091ULL, 32.0}, { 136, 0x0008080021ULL, 32.0},
+    { 136, 0x0008080052ULL, 64.0}, { 136, 0x0010080092ULL, -16.0},
+    { 136, 0x0010080022ULL, -16.0}, { 136, 0x0008080013ULL, 32.0},
+    { 136, 0x0010080053ULL, -32.0}, { 136, 0x0010080014ULL, -16.0},
+    { 137, 0x0000102061ULL, -16.0}, { 137, 0x0000102092ULL, -16.0},
+    { 137, 0x0000102022ULL, -16.0}, { 137, 0x0000102053ULL, -32.0},
+    { 137, 0x0000102014ULL, -16.0}, { 138, 0x0080400211ULL, 3.5555555555555554},
+    { 138, 0x0080400012ULL, 3.5555555555555554}, { 139, 0x0000402201ULL, -10.666666666666666},
+    { 139, 0x0000402002ULL, -10.666666666666666}, { 140, 0x0000802211ULL, 1.7777777777777777},
+    { 140, 0x0000802012ULL, 1.7777777777777777}, { 141, 0x0048240211ULL, -10.666666666666666},
+    { 141, 0x0048240051ULL, -10.666666666666666}, { 141, 0x0048240012ULL, -21.333333333333332},
+    { 142, 0x0000082041ULL, -32.0}, { 142, 0x0000082002ULL, -32.0},
+    { 143, 0x0000482211ULL, 5.333333333333333}, { 143, 0x0000482051ULL, 5.333333333333333},
+    { 143, 0x0000482012ULL, 10.666666666666666}, { 144, 0x0010080051ULL, 32.0},
+    { 144, 0x0010080012ULL, 32.0}, { 145, 0x0000102051ULL, 16.0},
+    { 145, 0x0000102012ULL, 16.0}, { 146, 0x0080400211ULL, -3.5555555555555554},
+    { 146, 0x0080400012ULL, -3.5555555555555554}, { 147, 0x0000402201ULL, 10.666666666666666},
+    { 147, 0x0000402002ULL, 10.666666666666666}, { 148, 0x0000802211ULL, -1.7777777777777777},
+    { 148, 0x0000802012ULL, -1.7777777777777777}, { 149, 0x0048240211ULL, 10.666666666666666},
+    { 149, 0x0048240051ULL, 10.666666666666666}, { 149, 0x0048240012ULL, 21.333333333333332},
+    { 150, 0x0000082041ULL, 32.0}, { 150, 0x0000082002ULL, 32.0},
+    { 151, 0x0000482211ULL, -5.333333333333333}, { 151, 0x0000482051ULL, -5.333333333333333},
+    { 151, 0x0000482012ULL, -10.666666666666666}, { 152, 0x0010080051ULL, -32.0},
+    { 152, 0x0010080012ULL, -32.0}, { 153, 0x0000102051ULL, -16.0},
+    { 153, 0x0000102012ULL, -16.0}, { 154, 0x0002002001ULL, -16.0},
+    { 155, 0x000100a001ULL, 32.0}, { 156, 0x0000012001ULL, -16.0},
+    { 157, 0x0040202201ULL, -21.333333333333332}, { 157, 0x0240202201ULL, 21.333333333333332},
+    { 157, 0x0040202002ULL, 21.333333333333332}, { 158, 0x0001202201ULL, 32.0},
+    { 158, 0x0001402201ULL, 5.333333333333333}, { 158, 0x0001202002ULL, -16.0},
+    { 158, 0x0001402002ULL, 5.333333333333333}, { 159, 0x000020a201ULL, -32.0},
+    { 159, 0x000040a201ULL, -5.333333333333333}, { 159, 0x000020a002ULL, 16.0},
+    { 159, 0x000040a002ULL, -5.333333333333333}, { 160, 0x0000402401ULL, -16.0},
+    { 160, 0x0000602401ULL, -10.666666666666666}, { 160, 0x0000802401ULL, -1.7777777777777777},
+    { 160, 0x0040402211ULL, -5.333333333333333}, { 160, 0x0040602211ULL, 3.5555555555555554},
+    { 160, 0x0040402402ULL, 5.333333333333333}, { 160, 0x0040602402ULL, 3.5555555555555554},
+    { 160, 0x0040402012ULL, 5.333333333333333}, { 160, 0x0040602012ULL, -3.5555555555555554},
+    { 160, 0x0000402003ULL, 16.0}, { 160, 0x0000602003ULL, 10.666666666666666},
+    { 160, 0x0000802003ULL, 1.7777777777777777}, { 160, 0x0040402004ULL, -5.333333333333333},
+    { 160, 0x0040602004ULL, -3.5555555555555554}, { 161, 0x0000402202ULL, -10.666666666666666},
+    { 161, 0x0000402003ULL, -10.666666666666666}, { 162, 0x0000804401ULL, 1.7777777777777777},
+    { 162, 0x0000804003ULL, -1.7777777777777777}, { 163, 0x0008042041ULL, 64.0},
+    { 163, 0x0208042041ULL, -64.0}, { 163, 0x0008042002ULL, -64.0},
+    { 164, 0x0001042041ULL, -32.0}, { 164, 0x0001082041ULL, 16.0},
+    { 164, 0x0001042002ULL, 16.0}, { 164, 0x0001082002ULL, 16.0},
+    { 165, 0x000004a041ULL, 32.0}, { 165, 0x000008a041ULL, -16.0},
+    { 165, 0x000004a002ULL, -16.0}, { 165, 0x000008a002ULL, -16.0},
+    { 166, 0x0000242241ULL, 32.0}, { 166, 0x0000442241ULL, 10.666666666666666},
+    { 166, 0x0000282241ULL, -32.0}, { 166, 0x0000482241ULL, -10.666666666666666},
+    { 166, 0x0040242211ULL, 5.333333333333333}, { 166, 0x0008442211ULL, -5.333333333333333},
+    { 166, 0x0040282211ULL, 5.333333333333333}, { 166, 0x0008242051ULL, 16.0},
+    { 166, 0x0008442051ULL, -5.333333333333333}, { 166, 0x0040282051ULL, 5.333333333333333},
+    { 166, 0x0040242242ULL, -5.333333333333333}, { 166, 0x0008242242ULL, -16.0},
+    { 166, 0x0008442242ULL, -10.666666666666666}, { 166, 0x0040282242ULL, 10.666666666666666},
+    { 166, 0x0040242012ULL, -5.333333333333333}, { 166, 0x0008242012ULL, -16.0},
+    { 166, 0x0008442012ULL, 10.666666666666666}, { 166, 0x0040282012ULL, -10.666666666666666},
+    { 166, 0x0000242003ULL, -32.0}, { 166, 0x0000442003ULL, -10.666666666666666},
+    { 166, 0x0000282003ULL, 32.0}, { 166, 0x0000482003ULL, 10.666666666666666},
+    { 166, 0x0040242203ULL, 5.333333333333333}, { 166, 0x0008242203ULL, -16.0},
+    { 166, 0x0040242043ULL, -5.333333333333333}, { 166, 0x0008242043ULL, 16.0},
+    { 166, 0x0040242004ULL, 5.333333333333333}, { 166, 0x0008242004ULL, 16.0},
+    { 166, 0x0008442004ULL, 10.666666666666666}, { 166, 0x0040282004ULL, -10.666666666666666},
+    { 167, 0x0000082042ULL, -32.0}, { 167, 0x0000082003ULL, -32.0},
+    { 168, 0x0000484241ULL, 10.666666666666666}, { 168, 0x0000484003ULL, -10.666666666666666},
+    { 169, 0x0000082081ULL, -16.0}, { 169, 0x00000c2081ULL, 32.0},
+    { 169, 0x0000102081ULL, -16.0}, { 169, 0x0008082051ULL, -16.0},
+    { 169, 0x00080c2051ULL, -32.0}, { 169, 0x0008082082ULL, 16.0},
+    { 169, 0x00080c2082ULL, -32.0}, { 169, 0x0008082012ULL, 16.0},
+    { 169, 0x00080c2012ULL, 32.0}, { 169, 0x0000082003ULL, 16.0},
+    { 169, 0x00000c2003ULL, -32.0}, { 169, 0x0000102003ULL, 16.0},
+    { 169, 0x0008082004ULL, -16.0}, { 169, 0x00080c2004ULL, 32.0},
+    { 170, 0x0000104081ULL, 16.0}, { 170, 0x0000104003ULL, -16.0},
+    { 171, 0x0002000001ULL, -32.0}, { 172, 0x0001008001ULL, 64.0},
+    { 173, 0x0000010001ULL, -32.0}, { 174, 0x0001200201ULL, 64.0},
+    { 175, 0x0000208201ULL, -64.0}, { 176, 0x0000400401ULL, -32.0},
+    { 176, 0x0000800401ULL, -3.5555555555555554}, { 176, 0x0000400003ULL, 32.0},
+    { 176, 0x0000800003ULL, 3.5555555555555554}, { 177, 0x0000802401ULL, 3.5555555555555554},
+    { 177, 0x0000802003ULL, -3.5555555555555554}, { 178, 0x0001040041ULL, -64.0},
+    { 179, 0x0000048041ULL, 64.0}, { 180, 0x0000240241ULL, 64.0},
+    { 180, 0x0000480241ULL, -21.333333333333332}, { 180, 0x0000240003ULL, -64.0},
+    { 180, 0x0000480003ULL, 21.333333333333332}, { 181, 0x0000482241ULL, 21.333333333333332},
+    { 181, 0x0000482003ULL, -21.333333333333332}, { 182, 0x0000080081ULL, -32.0},
+    { 182, 0x0000100081ULL, -32.0}, { 182, 0x0000080003ULL, 32.0},
+    { 182, 0x0000100003ULL, 32.0}, { 183, 0x0000102081ULL, 32.0},
+    { 183, 0x0000102003ULL, -32.0}, { 184, 0x0080402401ULL, 3.5555555555555554},
+    { 184, 0x0080402003ULL, -3.5555555555555554}, { 185, 0x0000802401ULL, -3.5555555555555554},
+    { 185, 0x0000802003ULL, 3.5555555555555554}, { 186, 0x0048242241ULL, -21.333333333333332},
+    { 186, 0x0048242003ULL, 21.333333333333332}, { 187, 0x0000482241ULL, -21.333333333333332},
+    { 187, 0x0000482003ULL, 21.333333333333332}, { 188, 0x0010082081ULL, 32.0},
+    { 188, 0x0010082003ULL, -32.0}, { 189, 0x0000102081ULL, -32.0},
+    { 189, 0x0000102003ULL, 32.0}, { 190, 0x0002002001ULL, -4.0},
+    { 190, 0x0002000011ULL, 16.0}, { 191, 0x000100a001ULL, 8.0},
+    { 191, 0x0001008011ULL, -32.0}, { 192, 0x0000012001ULL, -4.0},
+    { 192, 0x0000010011ULL, 16.0}, { 193, 0x0240202201ULL, 32.0},
+    { 193, 0x0240202002ULL, -32.0}, { 193, 0x0200200202ULL, -64.0},
+    { 193, 0x0000400202ULL, 21.333333333333332}, { 193, 0x0200200003ULL, 64.0},
+    { 193, 0x0000400003ULL, -21.333333333333332}, { 194, 0x0001202201ULL, 8.0},
+    { 194, 0x0041202011ULL, 5.333333333333333}, { 194, 0x0001200211ULL, -16.0},
+    { 194, 0x0001202002ULL, -8.0}, { 194, 0x0001200012ULL, 16.0},
+    { 195, 0x000020a201ULL, -8.0}, { 195, 0x004020a011ULL, -5.333333333333333},
+    { 195, 0x0000208211ULL, 16.0}, { 195, 0x000020a002ULL, 8.0},
+    { 195, 0x0000208012ULL, -16.0}, { 196, 0x0040402211ULL, -16.0},
+    { 196, 0x0080402411ULL, 0.4444444444444444}, { 196, 0x0080402021ULL, 0.4444444444444444},
+    { 196, 0x0040402012ULL, 16.0}, { 196, 0x0000400212ULL, 16.0},
+    { 196, 0x0000800212ULL, -1.7777777777777777}, { 196, 0x0080402212ULL, 0.8888888888888888},
+    { 196, 0x0000400013ULL, -16.0}, { 196, 0x0000800013ULL, 1.7777777777777777},
+    { 196, 0x0080402013ULL, -3.1111111111111107}, { 197, 0x0000002001ULL, -128.0},
+    { 198, 0x0000402011ULL, 21.333333333333332}, { 199, 0x0000802411ULL, -0.8888888888888888},
+    { 199, 0x0000802021ULL, -0.8888888888888888}, { 199, 0x0000802212ULL, 1.7777777777777777},
+    { 199, 0x0000802013ULL, 2.6666666666666665}, { 200, 0x0000004001ULL, 48.0},
+    { 200, 0x0000002011ULL, -16.0}, { 201, 0x0000404011ULL, -10.666666666666666},
+    { 202, 0x0000804411ULL, 0.4444444444444444}, { 202, 0x0000804021ULL, 0.4444444444444444},
+    { 202, 0x0000804212ULL, -0.8888888888888888}, { 202, 0x0000804013ULL, -1.3333333333333333},
+    { 203, 0x0208042041ULL, -96.0}, { 203, 0x0208042002ULL, 96.0},
+    { 203, 0x0200040042ULL, 64.0}, { 203, 0x0000080042ULL, 64.0},
+    { 203, 0x0200040003ULL, -64.0}, { 203, 0x0000080003ULL, -64.0},
+    { 204, 0x0001042041ULL, -8.0}, { 204, 0x0009042011ULL, -16.0},
+    { 204, 0x0001040051ULL, 16.0}, { 204, 0x0001042002ULL, 8.0},
+    { 204, 0x0001040012ULL, -16.0}, { 205, 0x000004a041ULL, 8.0},
+    { 205, 0x000804a011ULL, 16.0}, { 205, 0x0000048051ULL, -16.0},
+    { 205, 0x000004a002ULL, -8.0}, { 205, 0x0000048012ULL, 16.0},
+    { 206, 0x0040242211ULL, 8.0}, { 206, 0x0008242211ULL, 24.0},
+    { 206, 0x0040242051ULL, 8.0}, { 206, 0x0008242051ULL, 24.0},
+    { 206, 0x0048242251ULL, -2.6666666666666665}, { 206, 0x0048242021ULL, -2.6666666666666665},
+    { 206, 0x0040242012ULL, -16.0}, { 206, 0x0008242012ULL, -48.0},
+    { 206, 0x0000240212ULL, -16.0}, { 206, 0x0000480212ULL, -5.333333333333333},
+    { 206, 0x0048242212ULL, -2.6666666666666665}, { 206, 0x0000240052ULL, -16.0},
+    { 206, 0x0000480052ULL, -5.333333333333333}, { 206, 0x0048242052ULL, -2.6666666666666665},
+    { 206, 0x0000240013ULL, 32.0}, { 206, 0x0000480013ULL, 10.666666666666666},
+    { 206, 0x0048242013ULL, 18.666666666666664}, { 207, 0x0000082011ULL, 64.0},
+    { 208, 0x0000482251ULL, -5.333333333333333}, { 208, 0x0000482021ULL, -5.333333333333333},
+    { 208, 0x0000482212ULL, 5.333333333333333}, { 208, 0x0000482052ULL, 5.333333333333333},
+    { 208, 0x0000482013ULL, 16.0}, { 209, 0x0000084011ULL, -32.0},
+    { 210, 0x0000484251ULL, 2.6666666666666665}, { 210, 0x0000484021ULL, 2.6666666666666665},
+    { 210, 0x0000484212ULL, -2.6666666666666665}, { 210, 0x0000484052ULL, -2.6666666666666665},
+    { 210, 0x0000484013ULL, -8.0}, { 211, 0x0008082051ULL, -48.0},
+    { 211, 0x0010082091ULL, 4.0}, { 211, 0x0010082021ULL, 4.0},
+    { 211, 0x0008082012ULL, 48.0}, { 211, 0x0000080052ULL, 16.0},
+    { 211, 0x0000100052ULL, -16.0}, { 211, 0x0010082052ULL, 8.0},
+    { 211, 0x0000080013ULL, -16.0}, { 211, 0x0000100013ULL, 16.0},
+    { 211, 0x0010082013ULL, -28.0}, { 212, 0x0000102091ULL, -8.0},
+    { 212, 0x0000102021ULL, -8.0}, { 212, 0x0000102052ULL, 16.0},
+    { 212, 0x0000102013ULL, 24.0}, { 213, 0x0000104091ULL, 4.0},
+    { 213, 0x0000104021ULL, 4.0}, { 213, 0x0000104052ULL, -8.0},
+    { 213, 0x0000104013ULL, -12.0}, { 214, 0x0040200201ULL, 21.333333333333332},
+    { 214, 0x0240200201ULL, 21.333333333333332}, { 214, 0x0040200002ULL, -21.333333333333332},
+    { 214, 0x0240200002ULL, -21.333333333333332}, { 215, 0x0001200201ULL, 16.0},
+    { 215, 0x0001400201ULL, -5.333333333333333}, { 215, 0x0041200011ULL, 5.333333333333333},
+    { 215, 0x0001200002ULL, 16.0}, { 215, 0x0001400002ULL, -5.333333333333333},
+    { 216, 0x0000208201ULL, -16.0}, { 216, 0x0000408201ULL, 5.333333333333333},
+    { 216, 0x0040208011ULL, -5.333333333333333}, { 216, 0x0000208002ULL, -16.0},
+    { 216, 0x0000408002ULL, 5.333333333333333}, { 217, 0x0000400401ULL, -16.0},
+    { 217, 0x0000600401ULL, 10.666666666666666}, { 217, 0x0000800401ULL, -1.7777777777777777},
+    { 217, 0x0080402401ULL, -2.6666666666666665}, { 217, 0x0040400211ULL, -10.666666666666666},
+    { 217, 0x0040600211ULL, -3.5555555555555554}, { 217, 0x0040400402ULL, 10.666666666666666},
+    { 217, 0x0040600402ULL, -3.5555555555555554}, { 217, 0x0040400012ULL, 10.666666666666666},
+    { 217, 0x0040600012ULL, 3.5555555555555554}, { 217, 0x0000400003ULL, 16.0},
+    { 217, 0x0000600003ULL, -10.666666666666666}, { 217, 0x0000800003ULL, 1.7777777777777777},
+    { 217, 0x0080402003ULL, 2.6666666666666665}, { 217, 0x0040400004ULL, -10.666666666666666},
+    { 217, 0x0040600004ULL, 3.5555555555555554}, { 218, 0x0000002001ULL, -32.0},
+    { 219, 0x0000402202ULL, 10.666666666666666}, { 219, 0x0000402003ULL, 10.666666666666666},
+    { 220, 0x0000804401ULL, -0.8888888888888888}, { 220, 0x0000804003ULL, 0.8888888888888888},
+    { 221, 0x0008040041ULL, -64.0}, { 221, 0x0208040041ULL, -64.0},
+    { 221, 0x0008040002ULL, 64.0}, { 221, 0x0208040002ULL, 64.0},
+    { 222, 0x0001040041ULL, -16.0}, { 222, 0x0001080041ULL, -16.0},
+    { 222, 0x0009040011ULL, -16.0}, { 222, 0x0001040002ULL, -16.0},
+    { 222, 0x0001080002ULL, -16.0}, { 223, 0x0000048041ULL, 16.0},
+    { 223, 0x0000088041ULL, 16.0}, { 223, 0x0008048011ULL, 16.0},
+    { 223, 0x0000048002ULL, 16.0}, { 223, 0x0000088002ULL, 16.0},
+    { 224, 0x0000240241ULL, 32.0}, { 224, 0x0000440241ULL, -10.666666666666666},
+    { 224, 0x0000280241ULL, 32.0}, { 224, 0x0000480241ULL, -10.666666666666666},
+    { 224, 0x0048242241ULL, 16.0}, { 224, 0x0040240211ULL, 5.333333333333333},
+    { 224, 0x0008240211ULL, 16.0}, { 224, 0x0008440211ULL, 5.333333333333333},
+    { 224, 0x0040280211ULL, -5.333333333333333}, { 224, 0x0040240051ULL, 5.333333333333333},
+    { 224, 0x0008240051ULL, 16.0}, { 224, 0x0008440051ULL, 5.333333333333333},
+    { 224, 0x0040280051ULL, -5.333333333333333}, { 224, 0x0040240242ULL, -10.666666666666666},
+    { 224, 0x0008240242ULL, -32.0}, { 224, 0x0008440242ULL, 10.666666666666666},
+    { 224, 0x0040280242ULL, -10.666666666666666}, { 224, 0x0040240012ULL, -10.666666666666666},
+    { 224, 0x0008240012ULL, -32.0}, { 224, 0x0008440012ULL, -10.666666666666666},
+    { 224, 0x0040280012ULL, 10.666666666666666}, { 224, 0x0000240003ULL, -32.0},
+    { 224, 0x0000440003ULL, 10.666666666666666}, { 224, 0x0000280003ULL, -32.0},
+    { 224, 0x0000480003ULL, 10.666666666666666}, { 224, 0x0048242003ULL, -16.0},
+    { 224, 0x0040240004ULL, 10.666666666666666}, { 224, 0x0008240004ULL, 32.0},
+    { 224, 0x0008440004ULL, -10.666666666666666}, { 224, 0x0040280004ULL, 10.666666666666666},
+    { 225, 0x0000082042ULL, 32.0}, { 225, 0x0000082003ULL, 32.0},
+    { 226, 0x0000484241ULL, -5.333333333333333}, { 226, 0x0000484003ULL, 5.333333333333333},
+    { 227, 0x0000080081ULL, -16.0}, { 227, 0x00000c0081ULL, -32.0},
+    { 227, 0x0000100081ULL, -16.0}, { 227, 0x0010082081ULL, -24.0},
+    { 227, 0x0008080051ULL, -32.0}, { 227, 0x00080c0051ULL, 32.0},
+    { 227, 0x0008080082ULL, 32.0}, { 227, 0x00080c0082ULL, 32.0},
+    { 227, 0x0008080012ULL, 32.0}, { 227, 0x00080c0012ULL, -32.0},
+    { 227, 0x0000080003ULL, 16.0}, { 227, 0x00000c0003ULL, 32.0},
+    { 227, 0x0000100003ULL, 16.0}, { 227, 0x0010082003ULL, 24.0},
+    { 227, 0x0008080004ULL, -32.0}, { 227, 0x00080c0004ULL, -32.0},
+    { 228, 0x0000104081ULL, -8.0}, { 228, 0x0000104003ULL, 8.0},
+    { 229, 0x0080400401ULL, -3.5555555555555554}, { 229, 0x0080400003ULL, 3.5555555555555554},
+    { 230, 0x0000802401ULL, -1.7777777777777777}, { 230, 0x0000802003ULL, 1.7777777777777777},
+    { 231, 0x0048240241ULL, 21.333333333333332}, { 231, 0x0048240003ULL, -21.333333333333332},
+    { 232, 0x0000482241ULL, -10.666666666666666}, { 232, 0x0000482003ULL, 10.666666666666666},
+    { 233, 0x0010080081ULL, -32.0}, { 233, 0x0010080003ULL, 32.0},
+    { 234, 0x0000102081ULL, -16.0}, { 234, 0x0000102003ULL, 16.0},
+    { 235, 0x0040200201ULL, 21.333333333333332}, { 235, 0x0240200201ULL, -21.333333333333332},
+    { 235, 0x0040200002ULL, -21.333333333333332}, { 235, 0x0240200002ULL, 21.333333333333332},
+    { 236, 0x0001200201ULL, -16.0}, { 236, 0x0001400201ULL, -5.333333333333333},
+    { 236, 0x0041200011ULL, -5.333333333333333}, { 236, 0x0001200002ULL, -16.0},
+    { 236, 0x0001400002ULL, -5.333333333333333}, { 237, 0x0000208201ULL, 16.0},
+    { 237, 0x0000408201ULL, 5.333333333333333}, { 237, 0x0040208011ULL, 5.333333333333333},
+    { 237, 0x0000208002ULL, 16.0}, { 237, 0x0000408002ULL, 5.333333333333333},
+    { 238, 0x0000400401ULL, 16.0}, { 238, 0x0000600401ULL, 10.666666666666666},
+    { 238, 0x0000800401ULL, 1.7777777777777777}, { 238, 0x0080402401ULL, 2.6666666666666665},
+    { 238, 0x0040400211ULL, 10.666666666666666}, { 238, 0x0040600211ULL, -3.5555555555555554},
+    { 238, 0x0040400402ULL, -10.666666666666666}, { 238, 0x0040600402ULL, -3.5555555555555554},
+    { 238, 0x0040400012ULL, -10.666666666666666}, { 238, 0x0040600012ULL, 3.5555555555555554},
+    { 238, 0x0000400003ULL, -16.0}, { 238, 0x0000600003ULL, -10.666666666666666},
+    { 238, 0x0000800003ULL, -1.7777777777777777}, { 238, 0x0080402003ULL, -2.6666666666666665},
+    { 238, 0x0040400004ULL, 10.666666666666666}, { 238, 0x0040600004ULL, 3.5555555555555554},
+    { 239, 0x0000802401ULL, -3.5555555555555554}, { 239, 0x0000802003ULL, 3.5555555555555554},
+    { 240, 0x0000002001ULL, 32.0}, { 241, 0x0000402202ULL, -10.666666666666666},
+    { 241, 0x0000402003ULL, -10.666666666666666}, { 242, 0x0000804401ULL, 0.8888888888888888},
+    { 242, 0x0000804003ULL, -0.8888888888888888}, { 243, 0x0008040041ULL, -64.0},
+    { 243, 0x0208040041ULL, 64.0}, { 243, 0x0008040002ULL, 64.0},
+    { 243, 0x0208040002ULL, -64.0}, { 244, 0x0001040041ULL, 16.0},
+    { 244, 0x0001080041ULL, -16.0}, { 244, 0x0009040011ULL, 16.0},
+    { 244, 0x0001040002ULL, 16.0}, { 244, 0x0001080002ULL, -16.0},
+    { 245, 0x0000048041ULL, -16.0}, { 245, 0x0000088041ULL, 16.0},
+    { 245, 0x0008048011ULL, -16.0}, { 245, 0x0000048002ULL, -16.0},
+    { 245, 0x0000088002ULL, 16.0}, { 246, 0x0000240241ULL, -32.0},
+    { 246, 0x0000440241ULL, -10.666666666666666}, { 246, 0x0000280241ULL, 32.0},
+    { 246, 0x0000480241ULL, 10.666666666666666}, { 246, 0x0048242241ULL, -16.0},
+    { 246, 0x0040240211ULL, -5.333333333333333}, { 246, 0x0008240211ULL, -16.0},
+    { 246, 0x0008440211ULL, 5.333333333333333}, { 246, 0x0040280211ULL, -5.333333333333333},
+    { 246, 0x0040240051ULL, -5.333333333333333}, { 246, 0x0008240051ULL, -16.0},
+    { 246, 0x0008440051ULL, 5.333333333333333}, { 246, 0x0040280051ULL, -5.333333333333333},
+    { 246, 0x0040240242ULL, 10.666666666666666}, { 246, 0x0008240242ULL, 32.0},
+    { 246, 0x0008440242ULL, 10.666666666666666}, { 246, 0x0040280242ULL, -10.666666666666666},
+    { 246, 0x0040240012ULL, 10.666666666666666}, { 246, 0x0008240012ULL, 32.0},
+    { 246, 0x0008440012ULL, -10.666666666666666}, { 246, 0x0040280012ULL, 10.666666666666666},
+    { 246, 0x0000240003ULL, 32.0}, { 246, 0x0000440003ULL, 10.666666666666666},
+    { 246, 0x0000280003ULL, -32.0}, { 246, 0x0000480003ULL, -10.666666666666666},
+    { 246, 0x0048242003ULL, 16.0}, { 246, 0x0040240004ULL, -10.666666666666666},
+    { 246, 0x0008240004ULL, -32.0}, { 246, 0x0008440004ULL, -10.666666666666666},
+    { 246, 0x0040280004ULL, 10.666666666666666}, { 247, 0x0000482241ULL, -21.333333333333332},
+    { 247, 0x0000482003ULL, 21.333333333333332}, { 248, 0x0000082042ULL, -32.0},
+    { 248, 0x0000082003ULL, -32.0}, { 249, 0x0000484241ULL, 5.333333333333333},
+    { 249, 0x0000484003ULL, -5.333333333333333}, { 250, 0x0000080081ULL, 16.0},
+    { 250, 0x00000c0081ULL, -32.0}, { 250, 0x0000100081ULL, 16.0},
+    { 250, 0x0010082081ULL, 24.0}, { 250, 0x0008080051ULL, 32.0},
+    { 250, 0x00080c0051ULL, 32.0}, { 250, 0x0008080082ULL, -32.0},
+    { 250, 0x00080c0082ULL, 32.0}, { 250, 0x0008080012ULL, -32.0},
+    { 250, 0x00080c0012ULL, -32.0}, { 250, 0x0000080003ULL, -16.0},
+    { 250, 0x00000c0003ULL, 32.0}, { 250, 0x0000100003ULL, -16.0},
+    { 250, 0x0010082003ULL, -24.0}, { 250, 0x0008080004ULL, 32.0},
+    { 250, 0x00080c0004ULL, -32.0}, { 251, 0x0000102081ULL, -32.0},
+    { 251, 0x0000102003ULL, 32.0}, { 252, 0x0000104081ULL, 8.0},
+    { 252, 0x0000104003ULL, -8.0}, { 253, 0x0000802401ULL, 3.5555555555555554},
+    { 253, 0x0000802003ULL, -3.5555555555555554}, { 254, 0x0000482241ULL, 21.333333333333332},
+    { 254, 0x0000482003ULL, -21.333333333333332}, { 255, 0x0000102081ULL, 32.0},
+    { 255, 0x0000102003ULL, -32.0}, { 256, 0x0080400401ULL, -3.5555555555555554},
+    { 256, 0x0080400003ULL, 3.5555555555555554}, { 257, 0x0000802401ULL, -1.7777777777777777},
+    { 257, 0x0000802003ULL, 1.7777777777777777}, { 258, 0x0048240241ULL, 21.333333333333332},
+    { 258, 0x0048240003ULL, -21.333333333333332}, { 259, 0x0000482241ULL, -10.666666666666666},
+    { 259, 0x0000482003ULL, 10.666666666666666}, { 260, 0x0010080081ULL, -32.0},
+    { 260, 0x0010080003ULL, 32.0}, { 261, 0x0000102081ULL, -16.0},
+    { 261, 0x0000102003ULL, 16.0}, { 262, 0x0240200201ULL, -42.666666666666664},
+    { 262, 0x0240200002ULL, 42.666666666666664}, { 263, 0x0041200011ULL, -10.666666666666666},
+    { 264, 0x0040208011ULL, 10.666666666666666}, { 265, 0x0040400211ULL, 21.333333333333332},
+    { 265, 0x0040400012ULL, -21.333333333333332}, { 265, 0x0080400212ULL, -3.5555555555555554},
+    { 265, 0x0080400013ULL, 3.5555555555555554}, { 266, 0x0000002001ULL, -96.0},
+    { 267, 0x0000402011ULL, 21.333333333333332}, { 268, 0x0000802411ULL, -0.8888888888888888},
+    { 268, 0x0000802021ULL, -0.8888888888888888}, { 268, 0x0000802212ULL, 1.7777777777777777},
+    { 268, 0x0000802013ULL, 2.6666666666666665}, { 269, 0x0208040041ULL, 128.0},
+    { 269, 0x0208040002ULL, -128.0}, { 270, 0x0009040011ULL, 32.0},
+    { 271, 0x0008048011ULL, -32.0}, { 272, 0x0040240211ULL, -10.666666666666666},
+    { 272, 0x0008240211ULL, -32.0}, { 272, 0x0040240051ULL, -10.666666666666666},
+    { 272, 0x0008240051ULL, -32.0}, { 272, 0x0040240012ULL, 21.333333333333332},
+    { 272, 0x0008240012ULL, 64.0}, { 272, 0x0048240212ULL, 10.666666666666666},
+    { 272, 0x0048240052ULL, 10.666666666666666}, { 272, 0x0048240013ULL, -21.333333333333332},
+    { 273, 0x0000082011ULL, 64.0}, { 274, 0x0000482251ULL, -5.333333333333333},
+    { 274, 0x0000482021ULL, -5.333333333333333}, { 274, 0x0000482212ULL, 5.333333333333333},
+    { 274, 0x0000482052ULL, 5.333333333333333}, { 274, 0x0000482013ULL, 16.0},
+    { 275, 0x0008080051ULL, 64.0}, { 275, 0x0008080012ULL, -64.0},
+    { 275, 0x0010080052ULL, -32.0}, { 275, 0x0010080013ULL, 32.0},
+    { 276, 0x0000102091ULL, -8.0}, { 276, 0x0000102021ULL, -8.0},
+    { 276, 0x0000102052ULL, 16.0}, { 276, 0x0000102013ULL, 24.0},
+    { 277, 0x0080400401ULL, 3.5555555555555554}, { 277, 0x0080400003ULL, -3.5555555555555554},
+    { 278, 0x0000802401ULL, 1.7777777777777777}, { 278, 0x0000802003ULL, -1.7777777777777777},
+    { 279, 0x0048240241ULL, -21.333333333333332}, { 279, 0x0048240003ULL, 21.333333333333332},
+    { 280, 0x0000482241ULL, 10.666666666666666}, { 280, 0x0000482003ULL, -10.666666666666666},
+    { 281, 0x0010080081ULL, 32.0}, { 281, 0x0010080003ULL, -32.0},
+    { 282, 0x0000102081ULL, 16.0}, { 282, 0x0000102003ULL, -16.0},
+    { 283, 0x0080400401ULL, -3.5555555555555554}, { 283, 0x0080400003ULL, 3.5555555555555554},
+    { 284, 0x0000802401ULL, -1.7777777777777777}, { 284, 0x0000802003ULL, 1.7777777777777777},
+    { 285, 0x0048240241ULL, 21.333333333333332}, { 285, 0x0048240003ULL, -21.333333333333332},
+    { 286, 0x0000482241ULL, -10.666666666666666}, { 286, 0x0000482003ULL, 10.666666666666666},
+    { 287, 0x0010080081ULL, -32.0}, { 287, 0x0010080003ULL, 32.0},
+    { 288, 0x0000102081ULL, -16.0}, { 288, 0x0000102003ULL, 16.0},
+    { 289, 0x0040402202ULL, 10.666666666666666}, { 289, 0x0040602202ULL, -7.111111111111111},
+    { 290, 0x0040242202ULL, -10.666666666666666}, { 290, 0x0008442202ULL, 10.666666666666666},
+    { 290, 0x0040282202ULL, -10.666666666666666}, { 290, 0x0008242042ULL, -32.0},
+    { 290, 0x0008442042ULL, 10.666666666666666}, { 290, 0x0040282042ULL, -10.666666666666666},
+    { 291, 0x0008082042ULL, 32.0}, { 291, 0x00080c2042ULL, 64.0},
+    { 292, 0x0041202002ULL, -10.666666666666666}, { 293, 0x004020a002ULL, 10.666666666666666},
+    { 294, 0x0040402202ULL, 32.0}, { 294, 0x0080402402ULL, -0.8888888888888888},
+    { 294, 0x0080402012ULL, -1.7777777777777777}, { 294, 0x0000400203ULL, -32.0},
+    { 294, 0x0000800203ULL, 3.5555555555555554}, { 294, 0x0080402203ULL, -5.333333333333333},
+    { 294, 0x0080402004ULL, -0.8888888888888888}, { 295, 0x0000402002ULL, -42.666666666666664},
+    { 296, 0x0000802402ULL, 1.7777777777777777}, { 296, 0x0000802012ULL, 3.5555555555555554},
+    { 296, 0x0000802203ULL, 3.5555555555555554}, { 296, 0x0000802004ULL, 1.7777777777777777},
+    { 297, 0x0000002002ULL, 32.0}, { 298, 0x0000404002ULL, 21.333333333333332},
+    { 299, 0x0000804402ULL, -0.8888888888888888}, { 299, 0x0000804012ULL, -1.7777777777777777},
+    { 299, 0x0000804203ULL, -1.7777777777777777}, { 299, 0x0000804004ULL, -0.8888888888888888},
+    { 300, 0x0009042002ULL, 32.0}, { 301, 0x000804a002ULL, -32.0},
+    { 302, 0x0040242202ULL, -16.0}, { 302, 0x0008242202ULL, -48.0},
+    { 302, 0x0040242042ULL, -16.0}, { 302, 0x0008242042ULL, -48.0},
+    { 302, 0x0048242242ULL, 5.333333333333333}, { 302, 0x0048242012ULL, 10.666666666666666},
+    { 302, 0x0000240203ULL, 32.0}, { 302, 0x0000480203ULL, 10.666666666666666},
+    { 302, 0x0048242203ULL, 16.0}, { 302, 0x0000240043ULL, 32.0},
+    { 302, 0x0000480043ULL, 10.666666666666666}, { 302, 0x0048242043ULL, 16.0},
+    { 302, 0x0048242004ULL, 5.333333333333333}, { 303, 0x0000082002ULL, -128.0},
+    { 304, 0x0000482242ULL, 10.666666666666666}, { 304, 0x0000482012ULL, 21.333333333333332},
+    { 304, 0x0000482203ULL, 10.666666666666666}, { 304, 0x0000482043ULL, 10.666666666666666},
+    { 304, 0x0000482004ULL, 10.666666666666666}, { 305, 0x0000084002ULL, 64.0},
+    { 306, 0x0000484242ULL, -5.333333333333333}, { 306, 0x0000484012ULL, -10.666666666666666},
+    { 306, 0x0000484203ULL, -5.333333333333333}, { 306, 0x0000484043ULL, -5.333333333333333},
+    { 306, 0x0000484004ULL, -5.333333333333333}, { 307, 0x0008082042ULL, 96.0},
+    { 307, 0x0010082082ULL, -8.0}, { 307, 0x0010082012ULL, -16.0},
+    { 307, 0x0000080043ULL, -32.0}, { 307, 0x0000100043ULL, 32.0},
+    { 307, 0x0010082043ULL, -48.0}, { 307, 0x0010082004ULL, -8.0},
+    { 308, 0x0000102082ULL, 16.0}, { 308, 0x0000102012ULL, 32.0},
+    { 308, 0x0000102043ULL, 32.0}, { 308, 0x0000102004ULL, 16.0},
+    { 309, 0x0000104082ULL, -8.0}, { 309, 0x0000104012ULL, -16.0},
+    { 309, 0x0000104043ULL, -16.0}, { 309, 0x0000104004ULL, -8.0},
+    { 310, 0x0041200002ULL, -10.666666666666666}, { 311, 0x0040208002ULL, 10.666666666666666},
+    { 312, 0x0040400202ULL, 21.333333333333332}, { 312, 0x0040600202ULL, 7.111111111111111},
+    { 313, 0x0009040002ULL, 32.0}, { 314, 0x0008048002ULL, -32.0},
+    { 315, 0x0040240202ULL, -10.666666666666666}, { 315, 0x0008240202ULL, -32.0},
+    { 315, 0x0008440202ULL, -10.666666666666666}, { 315, 0x0040280202ULL, 10.666666666666666},
+    { 315, 0x0040240042ULL, -10.666666666666666}, { 315, 0x0008240042ULL, -32.0},
+    { 315, 0x0008440042ULL, -10.666666666666666}, { 315, 0x0040280042ULL, 10.666666666666666},
+    { 316, 0x0008080042ULL, 64.0}, { 316, 0x00080c0042ULL, -64.0},
+    { 317, 0x0041200002ULL, 10.666666666666666}, { 318, 0x0040208002ULL, -10.666666666666666},
+    { 319, 0x0040400202ULL, -21.333333333333332}, { 319, 0x0040600202ULL, 7.111111111111111},
+    { 320, 0x0009040002ULL, -32.0}, { 321, 0x0008048002ULL, 32.0},
+    { 322, 0x0040240202ULL, 10.666666666666666}, { 322, 0x0008240202ULL, 32.0},
+    { 322, 0x0008440202ULL, -10.666666666666666}, { 322, 0x0040280202ULL, 10.666666666666666},
+    { 322, 0x0040240042ULL, 10.666666666666666}, { 322, 0x0008240042ULL, 32.0},
+    { 322, 0x0008440042ULL, -10.666666666666666}, { 322, 0x0040280042ULL, 10.666666666666666},
+    { 323, 0x0008080042ULL, -64.0}, { 323, 0x00080c0042ULL, -64.0},
+    { 324, 0x0041200002ULL, 21.333333333333332}, { 325, 0x0040208002ULL, -21.333333333333332},
+    { 326, 0x0040400202ULL, -42.666666666666664}, { 326, 0x0080400203ULL, 7.111111111111111},
+    { 327, 0x0000402002ULL, -42.666666666666664}, { 328, 0x0000802402ULL, 1.7777777777777777},
+    { 328, 0x0000802012ULL, 3.5555555555555554}, { 328, 0x0000802203ULL, 3.5555555555555554},
+    { 328, 0x0000802004ULL, 1.7777777777777777}, { 329, 0x0009040002ULL, -64.0},
+    { 330, 0x0008048002ULL, 64.0}, { 331, 0x0040240202ULL, 21.333333333333332},
+    { 331, 0x0008240202ULL, 64.0}, { 331, 0x0040240042ULL, 21.333333333333332},
+    { 331, 0x0008240042ULL, 64.0}, { 331, 0x0048240203ULL, -21.333333333333332},
+    { 331, 0x0048240043ULL, -21.333333333333332}, { 332, 0x0000082002ULL, -128.0},
+    { 333, 0x0000482242ULL, 10.666666666666666}, { 333, 0x0000482012ULL, 21.333333333333332},
+    { 333, 0x0000482203ULL, 10.666666666666666}, { 333, 0x0000482043ULL, 10.666666666666666},
+    { 333, 0x0000482004ULL, 10.666666666666666}, { 334, 0x0008080042ULL, -128.0},
+    { 334, 0x0010080043ULL, 64.0}, { 335, 0x0000102082ULL, 16.0},
+    { 335, 0x0000102012ULL, 32.0}, { 335, 0x0000102043ULL, 32.0},
+    { 335, 0x0000102004ULL, 16.0}, { 336, 0x0080402003ULL, 1.7777777777777777},
+    { 337, 0x0000802003ULL, -3.5555555555555554}, { 338, 0x0000804003ULL, 1.7777777777777777},
+    { 339, 0x0048242003ULL, -10.666666666666666}, { 340, 0x0000482003ULL, -21.333333333333332},
+    { 341, 0x0000484003ULL, 10.666666666666666}, { 342, 0x0010082003ULL, 16.0},
+    { 343, 0x0000102003ULL, -32.0}, { 344, 0x0000104003ULL, 16.0},
+    { 345, 0x0000802003ULL, -3.5555555555555554}, { 346, 0x0000482003ULL, -21.333333333333332},
+    { 347, 0x0000102003ULL, -32.0}, { 348, 0x0000000001ULL, -128.0},
+    { 348, 0x0200000001ULL, 256.0}, { 348, 0x0400000001ULL, -128.0},
+    { 349, 0x0002002001ULL, -16.0}, { 350, 0x000100a001ULL, 32.0},
+    { 351, 0x0000012001ULL, -16.0}, { 352, 0x0040202201ULL, -21.333333333333332},
+    { 352, 0x0240202201ULL, -10.666666666666666}, { 352, 0x0000200011ULL, -64.0},
+    { 352, 0x0200200011ULL, 64.0}, { 352, 0x0000400011ULL, 21.333333333333332},
+    { 352, 0x0200400011ULL, -21.333333333333332}, { 352, 0x0040202002ULL, -21.333333333333332},
+    { 352, 0x0240202002ULL, -10.666666666666666}, { 352, 0x0200200202ULL, -64.0},
+    { 352, 0x0000400202ULL, -21.333333333333332}, { 352, 0x0200400202ULL, -42.666666666666664},
+    { 352, 0x0200200003ULL, -64.0}, { 352, 0x0000400003ULL, -21.333333333333332},
+    { 352, 0x0200400003ULL, -42.666666666666664}, { 353, 0x0001202201ULL, 8.0},
+    { 353, 0x0041202011ULL, 2.6666666666666665}, { 353, 0x0001200211ULL, -16.0},
+    { 353, 0x0001202002ULL, 8.0}, { 353, 0x0001200012ULL, -16.0},
+    { 354, 0x000020a201ULL, -8.0}, { 354, 0x004020a011ULL, -2.6666666666666665},
+    { 354, 0x0000208211ULL, 16.0}, { 354, 0x000020a002ULL, -8.0},
+    { 354, 0x0000208012ULL, 16.0}, { 355, 0x0000400411ULL, 8.0},
+    { 355, 0x0000600411ULL, -5.333333333333333}, { 355, 0x0000800411ULL, 0.8888888888888888},
+    { 355, 0x0000400021ULL, -8.0}, { 355, 0x0000600021ULL, 5.333333333333333},
+    { 355, 0x0000800021ULL, -0.8888888888888888}, { 355, 0x0000400212ULL, 32.0},
+    { 355, 0x0000800212ULL, 3.5555555555555554}, { 355, 0x0000400013ULL, 24.0},
+    { 355, 0x0000600013ULL, 5.333333333333333}, { 355, 0x0000800013ULL, 2.6666666666666665},
+    { 356, 0x0000002001ULL, 128.0}, { 357, 0x0000402011ULL, -21.333333333333332},
+    { 357, 0x0000402202ULL, 10.666666666666666}, { 357, 0x0000402003ULL, 10.666666666666666},
+    { 358, 0x0000802411ULL, -0.8888888888888888}, { 358, 0x0000802021ULL, 0.8888888888888888},
+    { 358, 0x0000802212ULL, -3.5555555555555554}, { 358, 0x0000802013ULL, -2.6666666666666665},
+    { 359, 0x0008042041ULL, 64.0}, { 359, 0x0208042041ULL, 32.0},
+    { 359, 0x0000040011ULL, 64.0}, { 359, 0x0200040011ULL, -64.0},
+    { 359, 0x0000080011ULL, 64.0}, { 359, 0x0200080011ULL, -64.0},
+    { 359, 0x0008042002ULL, 64.0}, { 359, 0x0208042002ULL, 32.0},
+    { 359, 0x0200040042ULL, 64.0}, { 359, 0x0000080042ULL, -64.0},
+    { 359, 0x0200080042ULL, -128.0}, { 359, 0x0200040003ULL, 64.0},
+    { 359, 0x0000080003ULL, -64.0}, { 359, 0x0200080003ULL, -128.0},
+    { 360, 0x0001042041ULL, -8.0}, { 360, 0x0009042011ULL, -8.0},
+    { 360, 0x0001040051ULL, 16.0}, { 360, 0x0001042002ULL, -8.0},
+    { 360, 0x0001040012ULL, 16.0}, { 361, 0x000004a041ULL, 8.0},
+    { 361, 0x000804a011ULL, 8.0}, { 361, 0x0000048051ULL, -16.0},
+    { 361, 0x000004a002ULL, 8.0}, { 361, 0x0000048012ULL, -16.0},
+    { 362, 0x0040242211ULL, -2.6666666666666665}, { 362, 0x0008242211ULL, 8.0},
+    { 362, 0x0008442211ULL, 5.333333333333333}, { 362, 0x0040282211ULL, 5.333333333333333},
+    { 362, 0x0040242051ULL, 2.6666666666666665}, { 362, 0x0008242051ULL, -8.0},
+    { 362, 0x0008442051ULL, -5.333333333333333}, { 362, 0x0040282051ULL, -5.333333333333333},
+    { 362, 0x0000240251ULL, -16.0}, { 362, 0x0000440251ULL, 5.333333333333333},
+    { 362, 0x0000280251ULL, -16.0}, { 362, 0x0000480251ULL, 5.333333333333333},
+    { 362, 0x0000240021ULL, 16.0}, { 362, 0x0000440021ULL, -5.333333333333333},
+    { 362, 0x0000280021ULL, 16.0}, { 362, 0x0000480021ULL, -5.333333333333333},
+    { 362, 0x0000240212ULL, -32.0}, { 362, 0x0000440212ULL, -5.333333333333333},
+    { 362, 0x0000280212ULL, -16.0}, { 362, 0x0000480212ULL, 10.666666666666666},
+    { 362, 0x0000240052ULL, -32.0}, { 362, 0x0000440052ULL, 5.333333333333333},
+    { 362, 0x0000280052ULL, 16.0}, { 362, 0x0000480052ULL, 10.666666666666666},
+    { 362, 0x0000240013ULL, -48.0}, { 362, 0x0000440013ULL, -5.333333333333333},
+    { 362, 0x0000280013ULL, 16.0}, { 362, 0x0000480013ULL, 16.0},
+    { 363, 0x0000082011ULL, -64.0}, { 363, 0x0000082042ULL, 32.0},
+    { 363, 0x0000082003ULL, 32.0}, { 364, 0x0000482251ULL, -5.333333333333333},
+    { 364, 0x0000482021ULL, 5.333333333333333}, { 364, 0x0000482212ULL, -10.666666666666666},
+    { 364, 0x0000482052ULL, -10.666666666666666}, { 364, 0x0000482013ULL, -16.0},
+    { 365, 0x0000080091ULL, 8.0}, { 365, 0x00000c0091ULL, 16.0},
+    { 365, 0x0000100091ULL, 8.0}, { 365, 0x0000080021ULL, -8.0},
+    { 365, 0x00000c0021ULL, -16.0}, { 365, 0x0000100021ULL, -8.0},
+    { 365, 0x0000080052ULL, 32.0}, { 365, 0x0000100052ULL, 32.0},
+    { 365, 0x0000080013ULL, 24.0}, { 365, 0x00000c0013ULL, -16.0},
+    { 365, 0x0000100013ULL, 24.0}, { 366, 0x0000102091ULL, -8.0},
+    { 366, 0x0000102021ULL, 8.0}, { 366, 0x0000102052ULL, -32.0},
+    { 366, 0x0000102013ULL, -24.0}, { 367, 0x0002000001ULL, -32.0},
+    { 368, 0x0001008001ULL, 64.0}, { 369, 0x0000010001ULL, -32.0},
+    { 370, 0x0040200201ULL, -21.333333333333332}, { 370, 0x0240200201ULL, -21.333333333333332},
+    { 370, 0x0040200002ULL, -21.333333333333332}, { 370, 0x0240200002ULL, -21.333333333333332},
+    { 371, 0x0001200201ULL, 16.0}, { 371, 0x0001400201ULL, -5.333333333333333},
+    { 371, 0x0041200011ULL, 5.333333333333333}, { 371, 0x0001200002ULL, 16.0},
+    { 371, 0x0001400002ULL, -5.333333333333333}, { 372, 0x0000208201ULL, -16.0},
+    { 372, 0x0000408201ULL, 5.333333333333333}, { 372, 0x0040208011ULL, -5.333333333333333},
+    { 372, 0x0000208002ULL, -16.0}, { 372, 0x0000408002ULL, 5.333333333333333},
+    { 373, 0x0008040041ULL, 64.0}, { 373, 0x0208040041ULL, 64.0},
+    { 373, 0x0008040002ULL, 64.0}, { 373, 0x0208040002ULL, 64.0},
+    { 374, 0x0001040041ULL, -16.0}, { 374, 0x0001080041ULL, -16.0},
+    { 374, 0x0009040011ULL, -16.0}, { 374, 0x0001040002ULL, -16.0},
+    { 374, 0x0001080002ULL, -16.0}, { 375, 0x0000048041ULL, 16.0},
+    { 375, 0x0000088041ULL, 16.0}, { 375, 0x0008048011ULL, 16.0},
+    { 375, 0x0000048002ULL, 16.0}, { 375, 0x0000088002ULL, 16.0},
+    { 376, 0x0040240211ULL, -5.333333333333333}, { 376, 0x0008240211ULL, 16.0},
+    { 376, 0x0008440211ULL, 5.333333333333333}, { 376, 0x0040280211ULL, 5.333333333333333},
+    { 376, 0x0040240051ULL, 5.333333333333333}, { 376, 0x0008240051ULL, -16.0},
+    { 376, 0x0008440051ULL, -5.333333333333333}, { 376, 0x0040280051ULL, -5.333333333333333},
+    { 377, 0x0040200201ULL, 21.333333333333332}, { 377, 0x0240200201ULL, -21.333333333333332},
+    { 377, 0x0040200002ULL, 21.333333333333332}, { 377, 0x0240200002ULL, -21.333333333333332},
+    { 378, 0x0001200201ULL, 16.0}, { 378, 0x0001400201ULL, 5.333333333333333},
+    { 378, 0x0041200011ULL, 5.333333333333333}, { 378, 0x0001200002ULL, 16.0},
+    { 378, 0x0001400002ULL, 5.333333333333333}, { 379, 0x0000208201ULL, -16.0},
+    { 379, 0x0000408201ULL, -5.333333333333333}, { 379, 0x0040208011ULL, -5.333333333333333},
+    { 379, 0x0000208002ULL, -16.0}, { 379, 0x0000408002ULL, -5.333333333333333},
+    { 380, 0x0008040041ULL, -64.0}, { 380, 0x0208040041ULL, 64.0},
+    { 380, 0x0008040002ULL, -64.0}, { 380, 0x0208040002ULL, 64.0},
+    { 381, 0x0001040041ULL, -16.0}, { 381, 0x0001080041ULL, 16.0},
+    { 381, 0x0009040011ULL, -16.0}, { 381, 0x0001040002ULL, -16.0},
+    { 381, 0x0001080002ULL, 16.0}, { 382, 0x0000048041ULL, 16.0},
+    { 382, 0x0000088041ULL, -16.0}, { 382, 0x0008048011ULL, 16.0},
+    { 382, 0x0000048002ULL, 16.0}, { 382, 0x0000088002ULL, -16.0},
+    { 383, 0x0040240211ULL, -5.333333333333333}, { 383, 0x0008240211ULL, 16.0},
+    { 383, 0x0008440211ULL, -5.333333333333333}, { 383, 0x0040280211ULL, -5.333333333333333},
+    { 383, 0x0040240051ULL, 5.333333333333333}, { 383, 0x0008240051ULL, -16.0},
+    { 383, 0x0008440051ULL, 5.333333333333333}, { 383, 0x0040280051ULL, 5.333333333333333},
+    { 384, 0x0000000001ULL, -128.0}, { 384, 0x0200000001ULL, 256.0},
+    { 384, 0x0400000001ULL, -128.0}, { 385, 0x0002002001ULL, -4.0},
+    { 385, 0x0002000011ULL, 16.0}, { 386, 0x000100a001ULL, 8.0},
+    { 386, 0x0001008011ULL, -32.0}, { 387, 0x0000012001ULL, -4.0},
+    { 387, 0x0000010011ULL, 16.0}, { 388, 0x0000200011ULL, -64.0},
+    { 388, 0x0200200011ULL, 64.0}, { 388, 0x0000400011ULL, 21.333333333333332},
+    { 388, 0x0200400011ULL, -21.333333333333332}, { 388, 0x0240200012ULL, -42.666666666666664},
+    { 389, 0x0041202011ULL, 2.6666666666666665}, { 389, 0x0001200211ULL, -16.0},
+    { 389, 0x0001400211ULL, 5.333333333333333}, { 389, 0x0041200021ULL, -5.333333333333333},
+    { 389, 0x0001200012ULL, -16.0}, { 389, 0x0001400012ULL, 5.333333333333333},
+    { 390, 0x004020a011ULL, -2.6666666666666665}, { 390, 0x0000208211ULL, 16.0},
+    { 390, 0x0000408211ULL, -5.333333333333333}, { 390, 0x0040208021ULL, 5.333333333333333},
+    { 390, 0x0000208012ULL, 16.0}, { 390, 0x0000408012ULL, -5.333333333333333},
+    { 391, 0x0000400411ULL, 8.0}, { 391, 0x0000600411ULL, -5.333333333333333},
+    { 391, 0x0000800411ULL, 0.8888888888888888}, { 391, 0x0080402411ULL, 1.3333333333333333},
+    { 391, 0x0000400021ULL, -8.0}, { 391, 0x0000600021ULL, 5.333333333333333},
+    { 391, 0x0000800021ULL, -0.8888888888888888}, { 391, 0x0080402021ULL, -1.3333333333333333},
+    { 391, 0x0000400212ULL, 16.0}, { 391, 0x0000600212ULL, -10.666666666666666},
+    { 391, 0x0000800212ULL, 1.7777777777777777}, { 391, 0x0080402212ULL, 2.6666666666666665},
+    { 391, 0x0040600412ULL, 3.5555555555555554}, { 391, 0x0040400022ULL, 10.666666666666666},
+    { 391, 0x0000400013ULL, 8.0}, { 391, 0x0000600013ULL, -5.333333333333333},
+    { 391, 0x0000800013ULL, 0.8888888888888888}, { 391, 0x0080402013ULL, 1.3333333333333333},
+    { 391, 0x0040600213ULL, 7.111111111111111}, { 391, 0x0040600014ULL, 3.5555555555555554},
+    { 392, 0x0000004001ULL, -16.0}, { 392, 0x0000002011ULL, 48.0},
+    { 393, 0x0000404011ULL, 5.333333333333333}, { 393, 0x0000402021ULL, -5.333333333333333},
+    { 394, 0x0000804411ULL, 0.4444444444444444}, { 394, 0x0000804021ULL, -0.4444444444444444},
+    { 394, 0x0000804212ULL, 0.8888888888888888}, { 394, 0x0000804013ULL, 0.4444444444444444},
+    { 395, 0x0000040011ULL, 64.0}, { 395, 0x0200040011ULL, -64.0},
+    { 395, 0x0000080011ULL, 64.0}, { 395, 0x0200080011ULL, -64.0},
+    { 395, 0x0208040012ULL, 128.0}, { 396, 0x0009042011ULL, -8.0},
+    { 396, 0x0001040051ULL, 16.0}, { 396, 0x0001080051ULL, 16.0},
+    { 396, 0x0009040021ULL, 16.0}, { 396, 0x0001040012ULL, 16.0},
+    { 396, 0x0001080012ULL, 16.0}, { 397, 0x000804a011ULL, 8.0},
+    { 397, 0x0000048051ULL, -16.0}, { 397, 0x0000088051ULL, -16.0},
+    { 397, 0x0008048021ULL, -16.0}, { 397, 0x0000048012ULL, -16.0},
+    { 397, 0x0000088012ULL, -16.0}, { 398, 0x0000240251ULL, -16.0},
+    { 398, 0x0000440251ULL, 5.333333333333333}, { 398, 0x0000280251ULL, -16.0},
+    { 398, 0x0000480251ULL, 5.333333333333333}, { 398, 0x0048242251ULL, -8.0},
+    { 398, 0x0000240021ULL, 16.0}, { 398, 0x0000440021ULL, -5.333333333333333},
+    { 398, 0x0000280021ULL, 16.0}, { 398, 0x0000480021ULL, -5.333333333333333},
+    { 398, 0x0048242021ULL, 8.0}, { 398, 0x0000240212ULL, -16.0},
+    { 398, 0x0000440212ULL, 5.333333333333333}, { 398, 0x0000280212ULL, -16.0},
+    { 398, 0x0000480212ULL, 5.333333333333333}, { 398, 0x0048242212ULL, -8.0},
+    { 398, 0x0000240052ULL, -16.0}, { 398, 0x0000440052ULL, 5.333333333333333},
+    { 398, 0x0000280052ULL, -16.0}, { 398, 0x0000480052ULL, 5.333333333333333},
+    { 398, 0x0048242052ULL, -8.0}, { 398, 0x0008440252ULL, -10.666666666666666},
+    { 398, 0x0040280252ULL, 10.666666666666666}, { 398, 0x0040240022ULL, -10.666666666666666},
+    { 398, 0x0008240022ULL, -32.0}, { 398, 0x0000240013ULL, -16.0},
+    { 398, 0x0000440013ULL, 5.333333333333333}, { 398, 0x0000280013ULL, -16.0},
+    { 398, 0x0000480013ULL, 5.333333333333333}, { 398, 0x0048242013ULL, -8.0},
+    { 398, 0x0008440213ULL, -10.666666666666666}, { 398, 0x0040280213ULL, 10.666666666666666},
+    { 398, 0x0008440053ULL, -10.666666666666666}, { 398, 0x0040280053ULL, 10.666666666666666},
+    { 398, 0x0008440014ULL, -10.666666666666666}, { 398, 0x0040280014ULL, 10.666666666666666},
+    { 399, 0x0000084011ULL, 16.0}, { 399, 0x0000082021ULL, -16.0},
+    { 400, 0x0000484251ULL, 2.6666666666666665}, { 400, 0x0000484021ULL, -2.6666666666666665},
+    { 400, 0x0000484212ULL, 2.6666666666666665}, { 400, 0x0000484052ULL, 2.6666666666666665},
+    { 400, 0x0000484013ULL, 2.6666666666666665}, { 401, 0x0000080091ULL, 8.0},
+    { 401, 0x00000c0091ULL, 16.0}, { 401, 0x0000100091ULL, 8.0},
+    { 401, 0x0010082091ULL, 12.0}, { 401, 0x0000080021ULL, -8.0},
+    { 401, 0x00000c0021ULL, -16.0}, { 401, 0x0000100021ULL, -8.0},
+    { 401, 0x0010082021ULL, -12.0}, { 401, 0x0000080052ULL, 16.0},
+    { 401, 0x00000c0052ULL, 32.0}, { 401, 0x0000100052ULL, 16.0},
+    { 401, 0x0010082052ULL, 24.0}, { 401, 0x00080c0092ULL, -32.0},
+    { 401, 0x0008080022ULL, 32.0}, { 401, 0x0000080013ULL, 8.0},
+    { 401, 0x00000c0013ULL, 16.0}, { 401, 0x0000100013ULL, 8.0},
+    { 401, 0x0010082013ULL, 12.0}, { 401, 0x00080c0053ULL, -64.0},
+    { 401, 0x00080c0014ULL, -32.0}, { 402, 0x0000104091ULL, 4.0},
+    { 402, 0x0000104021ULL, -4.0}, { 402, 0x0000104052ULL, 8.0},
+    { 402, 0x0000104013ULL, 4.0}, { 403, 0x0080400411ULL, 1.7777777777777777},
+    { 403, 0x0080400021ULL, -1.7777777777777777}, { 403, 0x0080400212ULL, 7.111111111111111},
+    { 403, 0x0080400013ULL, 5.333333333333333}, { 404, 0x0000002001ULL, -32.0},
+    { 405, 0x0000402011ULL, 10.666666666666666}, { 405, 0x0000402202ULL, -10.666666666666666},
+    { 405, 0x0000402003ULL, -10.666666666666666}, { 406, 0x0000802411ULL, 0.8888888888888888},
+    { 406, 0x0000802021ULL, -0.8888888888888888}, { 406, 0x0000802212ULL, 3.5555555555555554},
+    { 406, 0x0000802013ULL, 2.6666666666666665}, { 407, 0x0048240251ULL, -10.666666666666666},
+    { 407, 0x0048240021ULL, 10.666666666666666}, { 407, 0x0048240212ULL, -21.333333333333332},
+    { 407, 0x0048240052ULL, -21.333333333333332}, { 407, 0x0048240013ULL, -32.0},
+    { 408, 0x0000082011ULL, 32.0}, { 408, 0x0000082042ULL, -32.0},
+    { 408, 0x0000082003ULL, -32.0}, { 409, 0x0000482251ULL, 5.333333333333333},
+    { 409, 0x0000482021ULL, -5.333333333333333}, { 409, 0x0000482212ULL, 10.666666666666666},
+    { 409, 0x0000482052ULL, 10.666666666666666}, { 409, 0x0000482013ULL, 16.0},
+    { 410, 0x0010080091ULL, 16.0}, { 410, 0x0010080021ULL, -16.0},
+    { 410, 0x0010080052ULL, 64.0}, { 410, 0x0010080013ULL, 48.0},
+    { 411, 0x0000102091ULL, 8.0}, { 411, 0x0000102021ULL, -8.0},
+    { 411, 0x0000102052ULL, 32.0}, { 411, 0x0000102013ULL, 24.0},
+    { 412, 0x0040200201ULL, 42.666666666666664}, { 412, 0x0040200002ULL, 42.666666666666664},
+    { 413, 0x0041200011ULL, 10.666666666666666}, { 414, 0x0040208011ULL, -10.666666666666666},
+    { 415, 0x0000002001ULL, 32.0}, { 416, 0x0000402011ULL, -10.666666666666666},
+    { 416, 0x0000402202ULL, 10.666666666666666}, { 416, 0x0000402003ULL, 10.666666666666666},
+    { 417, 0x0000802411ULL, -0.8888888888888888}, { 417, 0x0000802021ULL, 0.8888888888888888},
+    { 417, 0x0000802212ULL, -3.5555555555555554}, { 417, 0x0000802013ULL, -2.6666666666666665},
+    { 418, 0x0008040041ULL, -128.0}, { 418, 0x0008040002ULL, -128.0},
+    { 419, 0x0009040011ULL, -32.0}, { 420, 0x0008048011ULL, 32.0},
+    { 421, 0x0008440211ULL, -10.666666666666666}, { 421, 0x0040280211ULL, -10.666666666666666},
+    { 421, 0x0008440051ULL, 10.666666666666666}, { 421, 0x0040280051ULL, 10.666666666666666},
+    { 422, 0x0000082011ULL, -32.0}, { 422, 0x0000082042ULL, 32.0},
+    { 422, 0x0000082003ULL, 32.0}, { 423, 0x0000482251ULL, -5.333333333333333},
+    { 423, 0x0000482021ULL, 5.333333333333333}, { 423, 0x0000482212ULL, -10.666666666666666},
+    { 423, 0x0000482052ULL, -10.666666666666666}, { 423, 0x0000482013ULL, -16.0},
+    { 424, 0x0000102091ULL, -8.0}, { 424, 0x0000102021ULL, 8.0},
+    { 424, 0x0000102052ULL, -32.0}, { 424, 0x0000102013ULL, -24.0},
+    { 425, 0x0080400411ULL, -1.7777777777777777}, { 425, 0x0080400021ULL, 1.7777777777777777},
+    { 425, 0x0080400212ULL, -3.5555555555555554}, { 425, 0x0080400013ULL, -1.7777777777777777},
+    { 426, 0x0000002001ULL, 32.0}, { 427, 0x0000402011ULL, -10.666666666666666},
+    { 428, 0x0000802411ULL, -0.8888888888888888}, { 428, 0x0000802021ULL, 0.8888888888888888},
+    { 428, 0x0000802212ULL, -1.7777777777777777}, { 428, 0x0000802013ULL, -0.8888888888888888},
+    { 429, 0x0048240251ULL, 10.666666666666666}, { 429, 0x0048240021ULL, -10.666666666666666},
+    { 429, 0x0048240212ULL, 10.666666666666666}, { 429, 0x0048240052ULL, 10.666666666666666},
+    { 429, 0x0048240013ULL, 10.666666666666666}, { 430, 0x0000082011ULL, -32.0},
+    { 431, 0x0000482251ULL, -5.333333333333333}, { 431, 0x0000482021ULL, 5.333333333333333},
+    { 431, 0x0000482212ULL, -5.333333333333333}, { 431, 0x0000482052ULL, -5.333333333333333},
+    { 431, 0x0000482013ULL, -5.333333333333333}, { 432, 0x0010080091ULL, -16.0},
+    { 432, 0x0010080021ULL, 16.0}, { 432, 0x0010080052ULL, -32.0},
+    { 432, 0x0010080013ULL, -16.0}, { 433, 0x0000102091ULL, -8.0},
+    { 433, 0x0000102021ULL, 8.0}, { 433, 0x0000102052ULL, -16.0},
+    { 433, 0x0000102013ULL, -8.0}, { 434, 0x0000200002ULL, 128.0},
+    { 434, 0x0200200002ULL, -128.0}, { 434, 0x0000400002ULL, -42.666666666666664},
+    { 434, 0x0200400002ULL, 42.666666666666664}, { 435, 0x0041202002ULL, -5.333333333333333},
+    { 436, 0x004020a002ULL, 5.333333333333333}, { 437, 0x0000400402ULL, 16.0},
+    { 437, 0x0000600402ULL, 10.666666666666666}, { 437, 0x0000800402ULL, 1.7777777777777777},
+    { 437, 0x0000400012ULL, 32.0}, { 437, 0x0000600012ULL, -21.333333333333332},
+    { 437, 0x0000800012ULL, 3.5555555555555554}, { 437, 0x0000400004ULL, -16.0},
+    { 437, 0x0000600004ULL, -10.666666666666666}, { 437, 0x0000800004ULL, -1.7777777777777777},
+    { 438, 0x0000402002ULL, 42.666666666666664}, { 439, 0x0000802402ULL, -1.7777777777777777},
+    { 439, 0x0000802012ULL, -3.5555555555555554}, { 439, 0x0000802004ULL, 1.7777777777777777},
+    { 440, 0x0000040002ULL, -128.0}, { 440, 0x0200040002ULL, 128.0},
+    { 440, 0x0000080002ULL, -128.0}, { 440, 0x0200080002ULL, 128.0},
+    { 441, 0x0009042002ULL, 16.0}, { 442, 0x000804a002ULL, -16.0},
+    { 443, 0x0040242202ULL, 5.333333333333333}, { 443, 0x0008242202ULL, -16.0},
+    { 443, 0x0008442202ULL, -10.666666666666666}, { 443, 0x0040282202ULL, -10.666666666666666},
+    { 443, 0x0040242042ULL, -5.333333333333333}, { 443, 0x0008242042ULL, 16.0},
+    { 443, 0x0008442042ULL, 10.666666666666666}, { 443, 0x0040282042ULL, 10.666666666666666},
+    { 443, 0x0000240242ULL, -32.0}, { 443, 0x0000440242ULL, -10.666666666666666},
+    { 443, 0x0000280242ULL, 32.0}, { 443, 0x0000480242ULL, 10.666666666666666},
+    { 443, 0x0000240012ULL, -64.0}, { 443, 0x0000440012ULL, 21.333333333333332},
+    { 443, 0x0000280012ULL, -64.0}, { 443, 0x0000480012ULL, 21.333333333333332},
+    { 443, 0x0000440203ULL, 10.666666666666666}, { 443, 0x0000280203ULL, 32.0},
+    { 443, 0x0000440043ULL, -10.666666666666666}, { 443, 0x0000280043ULL, -32.0},
+    { 443, 0x0000240004ULL, 32.0}, { 443, 0x0000440004ULL, 10.666666666666666},
+    { 443, 0x0000280004ULL, -32.0}, { 443, 0x0000480004ULL, -10.666666666666666},
+    { 444, 0x0000082002ULL, 128.0}, { 445, 0x0000482242ULL, -10.666666666666666},
+    { 445, 0x0000482012ULL, -21.333333333333332}, { 445, 0x0000482004ULL, 10.666666666666666},
+    { 446, 0x0000080082ULL, 16.0}, { 446, 0x00000c0082ULL, -32.0},
+    { 446, 0x0000100082ULL, 16.0}, { 446, 0x0000080012ULL, 32.0},
+    { 446, 0x00000c0012ULL, 64.0}, { 446, 0x0000100012ULL, 32.0},
+    { 446, 0x0000080004ULL, -16.0}, { 446, 0x00000c0004ULL, 32.0},
+    { 446, 0x0000100004ULL, -16.0}, { 447, 0x0000102082ULL, -16.0},
+    { 447, 0x0000102012ULL, -32.0}, { 447, 0x0000102004ULL, 16.0},
+    { 448, 0x0041200002ULL, -10.666666666666666}, { 449, 0x0040208002ULL, 10.666666666666666},
+    { 450, 0x0009040002ULL, 32.0}, { 451, 0x0008048002ULL, -32.0},
+    { 452, 0x0040240202ULL, 10.666666666666666}, { 452, 0x0008240202ULL, -32.0},
+    { 452, 0x0008440202ULL, -10.666666666666666}, { 452, 0x0040280202ULL, -10.666666666666666},
+    { 452, 0x0040240042ULL, -10.666666666666666}, { 452, 0x0008240042ULL, 32.0},
+    { 452, 0x0008440042ULL, 10.666666666666666}, { 452, 0x0040280042ULL, 10.666666666666666},
+    { 453, 0x0041200002ULL, -10.666666666666666}, { 454, 0x0040208002ULL, 10.666666666666666},
+    { 455, 0x0009040002ULL, 32.0}, { 456, 0x0008048002ULL, -32.0},
+    { 457, 0x0040240202ULL, 10.666666666666666}, { 457, 0x0008240202ULL, -32.0},
+    { 457, 0x0008440202ULL, 10.666666666666666}, { 457, 0x0040280202ULL, 10.666666666666666},
+    { 457, 0x0040240042ULL, -10.666666666666666}, { 457, 0x0008240042ULL, 32.0},
+    { 457, 0x0008440042ULL, -10.666666666666666}, { 457, 0x0040280042ULL, -10.666666666666666},
+    { 458, 0x0000200002ULL, 128.0}, { 458, 0x0200200002ULL, -128.0},
+    { 458, 0x0000400002ULL, -42.666666666666664}, { 458, 0x0200400002ULL, 42.666666666666664},
+    { 458, 0x0040200202ULL, -21.333333333333332}, { 458, 0x0240200202ULL, -21.333333333333332},
+    { 458, 0x0040200003ULL, -21.333333333333332}, { 458, 0x0240200003ULL, 64.0},
+    { 459, 0x0041202002ULL, -5.333333333333333}, { 459, 0x0041200012ULL, 10.666666666666666},
+    { 460, 0x004020a002ULL, 5.333333333333333}, { 460, 0x0040208012ULL, -10.666666666666666},
+    { 461, 0x0000400012ULL, 32.0}, { 461, 0x0000600012ULL, -21.333333333333332},
+    { 461, 0x0000800012ULL, 3.5555555555555554}, { 461, 0x0080402012ULL, 5.333333333333333},
+    { 461, 0x0040400212ULL, 10.666666666666666}, { 461, 0x0040600212ULL, 3.5555555555555554},
+    { 461, 0x0040400013ULL, -32.0}, { 461, 0x0040600013ULL, 3.5555555555555554},
+    { 462, 0x0000002002ULL, -64.0}, { 463, 0x0000404002ULL, -10.666666666666666},
+    { 463, 0x0000402012ULL, 21.333333333333332}, { 464, 0x0000804012ULL, 1.7777777777777777},
+    { 465, 0x0000040002ULL, -128.0}, { 465, 0x0200040002ULL, 128.0},
+    { 465, 0x0000080002ULL, -128.0}, { 465, 0x0200080002ULL, 128.0},
+    { 465, 0x0008040042ULL, 64.0}, { 465, 0x0208040042ULL, 64.0},
+    { 465, 0x0008040003ULL, 64.0}, { 465, 0x0208040003ULL, -192.0},
+    { 466, 0x0009042002ULL, 16.0}, { 466, 0x0009040012ULL, -32.0},
+    { 467, 0x000804a002ULL, -16.0}, { 467, 0x0008048012ULL, 32.0},
+    { 468, 0x0000240012ULL, -64.0}, { 468, 0x0000440012ULL, 21.333333333333332},
+    { 468, 0x0000280012ULL, -64.0}, { 468, 0x0000480012ULL, 21.333333333333332},
+    { 468, 0x0048242012ULL, -32.0}, { 468, 0x0040240212ULL, -5.333333333333333},
+    { 468, 0x0008240212ULL, -16.0}, { 468, 0x0008440212ULL, -5.333333333333333},
+    { 468, 0x0040280212ULL, 5.333333333333333}, { 468, 0x0040240052ULL, -5.333333333333333},
+    { 468, 0x0008240052ULL, -16.0}, { 468, 0x0008440052ULL, -5.333333333333333},
+    { 468, 0x0040280052ULL, 5.333333333333333}, { 468, 0x0040240013ULL, 32.0},
+    { 468, 0x0008240013ULL, 96.0}, { 468, 0x0008440013ULL, -10.666666666666666},
+    { 468, 0x0040280013ULL, 10.666666666666666}, { 469, 0x0000084002ULL, -32.0},
+    { 469, 0x0000082012ULL, 64.0}, { 470, 0x0000484012ULL, 10.666666666666666},
+    { 471, 0x0000080012ULL, 32.0}, { 471, 0x00000c0012ULL, 64.0},
+    { 471, 0x0000100012ULL, 32.0}, { 471, 0x0010082012ULL, 48.0},
+    { 471, 0x0008080052ULL, 32.0}, { 471, 0x00080c0052ULL, -32.0},
+    { 471, 0x0008080013ULL, -96.0}, { 471, 0x00080c0013ULL, -32.0},
+    { 472, 0x0000104012ULL, 16.0}, { 473, 0x0080400402ULL, 3.5555555555555554},
+    { 473, 0x0080400012ULL, 7.111111111111111}, { 473, 0x0080400004ULL, -3.5555555555555554},
+    { 474, 0x0000402002ULL, -21.333333333333332}, { 475, 0x0000802402ULL, 1.7777777777777777},
+    { 475, 0x0000802012ULL, 3.5555555555555554}, { 475, 0x0000802004ULL, -1.7777777777777777},
+    { 476, 0x0048240242ULL, -21.333333333333332}, { 476, 0x0048240012ULL, -42.666666666666664},
+    { 476, 0x0048240004ULL, 21.333333333333332}, { 477, 0x0000082002ULL, -64.0},
+    { 478, 0x0000482242ULL, 10.666666666666666}, { 478, 0x0000482012ULL, 21.333333333333332},
+    { 478, 0x0000482004ULL, -10.666666666666666}, { 479, 0x0010080082ULL, 32.0},
+    { 479, 0x0010080012ULL, 64.0}, { 479, 0x0010080004ULL, -32.0},
+    { 480, 0x0000102082ULL, 16.0}, { 480, 0x0000102012ULL, 32.0},
+    { 480, 0x0000102004ULL, -16.0}, { 481, 0x0041200002ULL, -21.333333333333332},
+    { 482, 0x0040208002ULL, 21.333333333333332}, { 483, 0x0000402002ULL, 21.333333333333332},
+    { 484, 0x0000802402ULL, -1.7777777777777777}, { 484, 0x0000802012ULL, -3.5555555555555554},
+    { 484, 0x0000802004ULL, 1.7777777777777777}, { 485, 0x0009040002ULL, 64.0},
+    { 486, 0x0008048002ULL, -64.0}, { 487, 0x0008440202ULL, 21.333333333333332},
+    { 487, 0x0040280202ULL, 21.333333333333332}, { 487, 0x0008440042ULL, -21.333333333333332},
+    { 487, 0x0040280042ULL, -21.333333333333332}, { 488, 0x0000082002ULL, 64.0},
+    { 489, 0x0000482242ULL, -10.666666666666666}, { 489, 0x0000482012ULL, -21.333333333333332},
+    { 489, 0x0000482004ULL, 10.666666666666666}, { 490, 0x0000102082ULL, -16.0},
+    { 490, 0x0000102012ULL, -32.0}, { 490, 0x0000102004ULL, 16.0},
+    { 491, 0x0080400012ULL, -7.111111111111111}, { 492, 0x0000402002ULL, 21.333333333333332},
+    { 493, 0x0000802012ULL, -3.5555555555555554}, { 494, 0x0048240012ULL, 42.666666666666664},
+    { 495, 0x0000082002ULL, 64.0}, { 496, 0x0000482012ULL, -21.333333333333332},
+    { 497, 0x0010080012ULL, -64.0}, { 498, 0x0000102012ULL, -32.0},
+    { 499, 0x0000400003ULL, -32.0}, { 499, 0x0000600003ULL, 21.333333333333332},
+    { 499, 0x0000800003ULL, -3.5555555555555554}, { 500, 0x0000802003ULL, 3.5555555555555554},
+    { 501, 0x0000240003ULL, 64.0}, { 501, 0x0000440003ULL, -21.333333333333332},
+    { 501, 0x0000280003ULL, 64.0}, { 501, 0x0000480003ULL, -21.333333333333332},
+    { 502, 0x0000482003ULL, 21.333333333333332}, { 503, 0x0000080003ULL, -32.0},
+    { 503, 0x00000c0003ULL, -64.0}, { 503, 0x0000100003ULL, -32.0},
+    { 504, 0x0000102003ULL, 32.0}, { 505, 0x0000400003ULL, -32.0},
+    { 505, 0x0000600003ULL, 21.333333333333332}, { 505, 0x0000800003ULL, -3.5555555555555554},
+    { 505, 0x0080402003ULL, -5.333333333333333}, { 505, 0x0040400203ULL, -21.333333333333332},
+    { 505, 0x0040600203ULL, -7.111111111111111}, { 505, 0x0040400004ULL, 21.333333333333332},
+    { 505, 0x0040600004ULL, -7.111111111111111}, { 506, 0x0000402003ULL, -21.333333333333332},
+    { 507, 0x0000804003ULL, -1.7777777777777777}, { 508, 0x0000240003ULL, 64.0},
+    { 508, 0x0000440003ULL, -21.333333333333332}, { 508, 0x0000280003ULL, 64.0},
+    { 508, 0x0000480003ULL, -21.333333333333332}, { 508, 0x0048242003ULL, 32.0},
+    { 508, 0x0040240203ULL, 10.666666666666666}, { 508, 0x0008240203ULL, 32.0},
+    { 508, 0x0008440203ULL, 10.666666666666666}, { 508, 0x0040280203ULL, -10.666666666666666},
+    { 508, 0x0040240043ULL, 10.666666666666666}, { 508, 0x0008240043ULL, 32.0},
+    { 508, 0x0008440043ULL, 10.666666666666666}, { 508, 0x0040280043ULL, -10.666666666666666},
+    { 508, 0x0040240004ULL, -21.333333333333332}, { 508, 0x0008240004ULL, -64.0},
+    { 508, 0x0008440004ULL, 21.333333333333332}, { 508, 0x0040280004ULL, -21.333333333333332},
+    { 509, 0x0000082003ULL, -64.0}, { 510, 0x0000484003ULL, -10.666666666666666},
+    { 511, 0x0000080003ULL, -32.0}, { 511, 0x00000c0003ULL, -64.0},
+    { 511, 0x0000100003ULL, -32.0}, { 511, 0x0010082003ULL, -48.0},
+    { 511, 0x0008080043ULL, -64.0}, { 511, 0x00080c0043ULL, 64.0},
+    { 511, 0x0008080004ULL, 64.0}, { 511, 0x00080c0004ULL, 64.0},
+    { 512, 0x0000104003ULL, -16.0}, { 513, 0x0080400003ULL, -7.111111111111111},
+    { 514, 0x0000802003ULL, -3.5555555555555554}, { 515, 0x0048240003ULL, 42.666666666666664},
+    { 516, 0x0000482003ULL, -21.333333333333332}, { 517, 0x0010080003ULL, -64.0},
+    { 518, 0x0000102003ULL, -32.0}, { 519, 0x0000802003ULL, 3.5555555555555554},
+    { 520, 0x0000482003ULL, 21.333333333333332}, { 521, 0x0000102003ULL, 32.0},
+    { 522, 0x0080400003ULL, 7.111111111111111}, { 523, 0x0000802003ULL, 3.5555555555555554},
+    { 524, 0x0048240003ULL, -42.666666666666664}, { 525, 0x0000482003ULL, 21.333333333333332},
+    { 526, 0x0010080003ULL, 64.0}, { 527, 0x0000102003ULL, 32.0},
+    { 528, 0x0040200202ULL, 21.333333333333332}, { 528, 0x0240200202ULL, 21.333333333333332},
+    { 528, 0x0040200003ULL, 21.333333333333332}, { 528, 0x0240200003ULL, 21.333333333333332},
+    { 529, 0x0008040042ULL, -64.0}, { 529, 0x0208040042ULL, -64.0},
+    { 529, 0x0008040003ULL, -64.0}, { 529, 0x0208040003ULL, -64.0},
+    { 530, 0x0040240212ULL, 5.333333333333333}, { 530, 0x0008240212ULL, -16.0},
+    { 530, 0x0008440212ULL, -5.333333333333333}, { 530, 0x0040280212ULL, -5.333333333333333},
+    { 530, 0x0040240052ULL, -5.333333333333333}, { 530, 0x0008240052ULL, 16.0},
+    { 530, 0x0008440052ULL, 5.333333333333333}, { 530, 0x0040280052ULL, 5.333333333333333},
+    { 531, 0x0080400412ULL, -1.7777777777777777}, { 531, 0x0080400022ULL, 1.7777777777777777},
+    { 531, 0x0080400213ULL, -3.5555555555555554}, { 531, 0x0080400014ULL, -1.7777777777777777},
+    { 532, 0x0000002002ULL, 32.0}, { 533, 0x0000402012ULL, -10.666666666666666},
+    { 534, 0x0000802412ULL, -0.8888888888888888}, { 534, 0x0000802022ULL, 0.8888888888888888},
+    { 534, 0x0000802213ULL, -1.7777777777777777}, { 534, 0x0000802014ULL, -0.8888888888888888},
+    { 535, 0x0048240252ULL, 10.666666666666666}, { 535, 0x0048240022ULL, -10.666666666666666},
+    { 535, 0x0048240213ULL, 10.666666666666666}, { 535, 0x0048240053ULL, 10.666666666666666},
+    { 535, 0x0048240014ULL, 10.666666666666666}, { 536, 0x0000082012ULL, -32.0},
+    { 537, 0x0000482252ULL, -5.333333333333333}, { 537, 0x0000482022ULL, 5.333333333333333},
+    { 537, 0x0000482213ULL, -5.333333333333333}, { 537, 0x0000482053ULL, -5.333333333333333},
+    { 537, 0x0000482014ULL, -5.333333333333333}, { 538, 0x0010080092ULL, -16.0},
+    { 538, 0x0010080022ULL, 16.0}, { 538, 0x0010080053ULL, -32.0},
+    { 538, 0x0010080014ULL, -16.0}, { 539, 0x0000102092ULL, -8.0},
+    { 539, 0x0000102022ULL, 8.0}, { 539, 0x0000102053ULL, -16.0},
+    { 539, 0x0000102014ULL, -8.0}, { 540, 0x0040240203ULL, -10.666666666666666},
+    { 540, 0x0008240203ULL, 32.0}, { 540, 0x0008440203ULL, 10.666666666666666},
+    { 540, 0x0040280203ULL, 10.666666666666666}, { 540, 0x0040240043ULL, 10.666666666666666},
+    { 540, 0x0008240043ULL, -32.0}, { 540, 0x0008440043ULL, -10.666666666666666},
+    { 540, 0x0040280043ULL, -10.666666666666666}, { 541, 0x0080400013ULL, -7.111111111111111},
+    { 542, 0x0000402003ULL, 21.333333333333332}, { 543, 0x0000802013ULL, -3.5555555555555554},
+    { 544, 0x0048240013ULL, 42.666666666666664}, { 545, 0x0000082003ULL, 64.0},
+    { 546, 0x0000482013ULL, -21.333333333333332}, { 547, 0x0010080013ULL, -64.0},
+    { 548, 0x0000102013ULL, -32.0}, { 549, 0x0080400004ULL, 7.111111111111111},
+    { 550, 0x0000802004ULL, 3.5555555555555554}, { 551, 0x0048240004ULL, -42.666666666666664},
+    { 552, 0x0000482004ULL, 21.333333333333332}, { 553, 0x0010080004ULL, 64.0},
+    { 554, 0x0000102004ULL, 32.0}, { 555, 0x0000002001ULL, -128.0},
+    { 555, 0x0200002001ULL, -256.0}, { 555, 0x0400002001ULL, -128.0},
+    { 556, 0x0000202011ULL, 64.0}, { 556, 0x0200202011ULL, 64.0},
+    { 556, 0x0000402011ULL, 21.333333333333332}, { 556, 0x0200402011ULL, 21.333333333333332},
+    { 556, 0x0240202211ULL, -10.666666666666666}, { 556, 0x0240202012ULL, -32.0},
+    { 557, 0x0041204011ULL, -2.6666666666666665}, { 557, 0x0001202211ULL, -8.0},
+    { 557, 0x0001402211ULL, -5.333333333333333}, { 557, 0x0001202012ULL, -8.0},
+    { 557, 0x0001402012ULL, -5.333333333333333}, { 558, 0x004020c011ULL, 2.6666666666666665},
+    { 558, 0x000020a211ULL, 8.0}, { 558, 0x000040a211ULL, 5.333333333333333},
+    { 558, 0x000020a012ULL, 8.0}, { 558, 0x000040a012ULL, 5.333333333333333},
+    { 559, 0x0000402411ULL, 8.0}, { 559, 0x0000602411ULL, 5.333333333333333},
+    { 559, 0x0000802411ULL, 0.8888888888888888}, { 559, 0x0000402021ULL, -8.0},
+    { 559, 0x0000602021ULL, -5.333333333333333}, { 559, 0x0000802021ULL, -0.8888888888888888},
+    { 559, 0x0000402212ULL, 16.0}, { 559, 0x0000602212ULL, 10.666666666666666},
+    { 559, 0x0000802212ULL, 1.7777777777777777}, { 559, 0x0040602412ULL, -3.5555555555555554},
+    { 559, 0x0040402022ULL, 5.333333333333333}, { 559, 0x0000402013ULL, 8.0},
+    { 559, 0x0000602013ULL, 5.333333333333333}, { 559, 0x0000802013ULL, 0.8888888888888888},
+    { 559, 0x0040602213ULL, -7.111111111111111}, { 559, 0x0040602014ULL, -3.5555555555555554},
+    { 560, 0x0000004001ULL, 64.0}, { 560, 0x0000002011ULL, -64.0},
+    { 561, 0x0000404011ULL, -16.0}, { 561, 0x0000402021ULL, 5.333333333333333},
+    { 562, 0x0000804411ULL, -0.8888888888888888}, { 562, 0x0000804021ULL, 0.8888888888888888},
+    { 562, 0x0000804212ULL, -1.7777777777777777}, { 562, 0x0000804013ULL, -0.8888888888888888},
+    { 563, 0x0000042011ULL, -64.0}, { 563, 0x0200042011ULL, -64.0},
+    { 563, 0x0000082011ULL, 64.0}, { 563, 0x0200082011ULL, 64.0},
+    { 563, 0x0208042051ULL, 32.0}, { 563, 0x0208042012ULL, 96.0},
+    { 564, 0x0009044011ULL, 8.0}, { 564, 0x0001042051ULL, 8.0},
+    { 564, 0x0001082051ULL, -16.0}, { 564, 0x0001042012ULL, 8.0},
+    { 564, 0x0001082012ULL, -16.0}, { 565, 0x000804c011ULL, -8.0},
+    { 565, 0x000004a051ULL, -8.0}, { 565, 0x000008a051ULL, 16.0},
+    { 565, 0x000004a012ULL, -8.0}, { 565, 0x000008a012ULL, 16.0},
+    { 566, 0x0000242251ULL, -16.0}, { 566, 0x0000442251ULL, -5.333333333333333},
+    { 566, 0x0000282251ULL, 16.0}, { 566, 0x0000482251ULL, 5.333333333333333},
+    { 566, 0x0000242021ULL, 16.0}, { 566, 0x0000442021ULL, 5.333333333333333},
+    { 566, 0x0000282021ULL, -16.0}, { 566, 0x0000482021ULL, -5.333333333333333},
+    { 566, 0x0040242221ULL, -2.6666666666666665}, { 566, 0x0008242221ULL, 8.0},
+    { 566, 0x0040242061ULL, 2.6666666666666665}, { 566, 0x0008242061ULL, -8.0},
+    { 566, 0x0000242212ULL, -16.0}, { 566, 0x0000442212ULL, -5.333333333333333},
+    { 566, 0x0000282212ULL, 16.0}, { 566, 0x0000482212ULL, 5.333333333333333},
+    { 566, 0x0000242052ULL, -16.0}, { 566, 0x0000442052ULL, -5.333333333333333},
+    { 566, 0x0000282052ULL, 16.0}, { 566, 0x0000482052ULL, 5.333333333333333},
+    { 566, 0x0008442252ULL, 10.666666666666666}, { 566, 0x0040282252ULL, -10.666666666666666},
+    { 566, 0x0040242022ULL, -5.333333333333333}, { 566, 0x0008242022ULL, -16.0},
+    { 566, 0x0000242013ULL, -16.0}, { 566, 0x0000442013ULL, -5.333333333333333},
+    { 566, 0x0000282013ULL, 16.0}, { 566, 0x0000482013ULL, 5.333333333333333},
+    { 566, 0x0008442213ULL, 10.666666666666666}, { 566, 0x0040282213ULL, -10.666666666666666},
+    { 566, 0x0008442053ULL, 10.666666666666666}, { 566, 0x0040282053ULL, -10.666666666666666},
+    { 566, 0x0008442014ULL, 10.666666666666666}, { 566, 0x0040282014ULL, -10.666666666666666},
+    { 567, 0x0000084011ULL, -48.0}, { 567, 0x0000082021ULL, 16.0},
+    { 568, 0x0000484251ULL, -5.333333333333333}, { 568, 0x0000484021ULL, 5.333333333333333},
+    { 568, 0x0000484212ULL, -5.333333333333333}, { 568, 0x0000484052ULL, -5.333333333333333},
+    { 568, 0x0000484013ULL, -5.333333333333333}, { 569, 0x0000082091ULL, 8.0},
+    { 569, 0x00000c2091ULL, -16.0}, { 569, 0x0000102091ULL, 8.0},
+    { 569, 0x0000082021ULL, -8.0}, { 569, 0x00000c2021ULL, 16.0},
+    { 569, 0x0000102021ULL, -8.0}, { 569, 0x0000082052ULL, 16.0},
+    { 569, 0x00000c2052ULL, -32.0}, { 569, 0x0000102052ULL, 16.0},
+    { 569, 0x00080c2092ULL, 32.0}, { 569, 0x0008082022ULL, 16.0},
+    { 569, 0x0000082013ULL, 8.0}, { 569, 0x00000c2013ULL, -16.0},
+    { 569, 0x0000102013ULL, 8.0}, { 569, 0x00080c2053ULL, 64.0},
+    { 569, 0x00080c2014ULL, 32.0}, { 570, 0x0000104091ULL, -8.0},
+    { 570, 0x0000104021ULL, 8.0}, { 570, 0x0000104052ULL, -16.0},
+    { 570, 0x0000104013ULL, -8.0}, { 571, 0x0000000001ULL, -128.0},
+    { 571, 0x0200000001ULL, -256.0}, { 571, 0x0400000001ULL, -128.0},
+    { 572, 0x0040202201ULL, 21.333333333333332}, { 572, 0x0240202201ULL, 10.666666666666666},
+    { 572, 0x0000200011ULL, 64.0}, { 572, 0x0200200011ULL, 64.0},
+    { 572, 0x0000400011ULL, 21.333333333333332}, { 572, 0x0200400011ULL, 21.333333333333332},
+    { 572, 0x0040202002ULL, 21.333333333333332}, { 572, 0x0240202002ULL, 10.666666666666666},
+    { 572, 0x0200200202ULL, -64.0}, { 572, 0x0000400202ULL, -21.333333333333332},
+    { 572, 0x0200400202ULL, 42.666666666666664}, { 572, 0x0200200003ULL, -64.0},
+    { 572, 0x0000400003ULL, -21.333333333333332}, { 572, 0x0200400003ULL, 42.666666666666664},
+    { 573, 0x0001202201ULL, -8.0}, { 573, 0x0041202011ULL, -8.0},
+    { 573, 0x0001200211ULL, -16.0}, { 573, 0x0001202002ULL, -8.0},
+    { 573, 0x0001200012ULL, -16.0}, { 574, 0x000020a201ULL, 8.0},
+    { 574, 0x004020a011ULL, 8.0}, { 574, 0x0000208211ULL, 16.0},
+    { 574, 0x000020a002ULL, 8.0}, { 574, 0x0000208012ULL, 16.0},
+    { 575, 0x0000400411ULL, 8.0}, { 575, 0x0000600411ULL, 5.333333333333333},
+    { 575, 0x0000800411ULL, 0.8888888888888888}, { 575, 0x0000400021ULL, -8.0},
+    { 575, 0x0000600021ULL, -5.333333333333333}, { 575, 0x0000800021ULL, -0.8888888888888888},
+    { 575, 0x0000400212ULL, 32.0}, { 575, 0x0000800212ULL, 3.5555555555555554},
+    { 575, 0x0000400013ULL, 24.0}, { 575, 0x0000600013ULL, -5.333333333333333},
+    { 575, 0x0000800013ULL, 2.6666666666666665}, { 576, 0x0000402011ULL, -10.666666666666666},
+    { 576, 0x0000402202ULL, 21.333333333333332}, { 576, 0x0000402003ULL, 21.333333333333332},
+    { 577, 0x0000802411ULL, -0.8888888888888888}, { 577, 0x0000802021ULL, 0.8888888888888888},
+    { 577, 0x0000802212ULL, -3.5555555555555554}, { 577, 0x0000802013ULL, -2.6666666666666665},
+    { 578, 0x0008042041ULL, -64.0}, { 578, 0x0208042041ULL, -32.0},
+    { 578, 0x0000040011ULL, -64.0}, { 578, 0x0200040011ULL, -64.0},
+    { 578, 0x0000080011ULL, 64.0}, { 578, 0x0200080011ULL, 64.0},
+    { 578, 0x0008042002ULL, -64.0}, { 578, 0x0208042002ULL, -32.0},
+    { 578, 0x0200040042ULL, 64.0}, { 578, 0x0000080042ULL, -64.0},
+    { 578, 0x0200080042ULL, 128.0}, { 578, 0x0200040003ULL, 64.0},
+    { 578, 0x0000080003ULL, -64.0}, { 578, 0x0200080003ULL, 128.0},
+    { 579, 0x0001042041ULL, 8.0}, { 579, 0x0009042011ULL, 24.0},
+    { 579, 0x0001040051ULL, 16.0}, { 579, 0x0001042002ULL, 8.0},
+    { 579, 0x0001040012ULL, 16.0}, { 580, 0x000004a041ULL, -8.0},
+    { 580, 0x000804a011ULL, -24.0}, { 580, 0x0000048051ULL, -16.0},
+    { 580, 0x000004a002ULL, -8.0}, { 580, 0x0000048012ULL, -16.0},
+    { 581, 0x0040242211ULL, 2.6666666666666665}, { 581, 0x0008242211ULL, -8.0},
+    { 581, 0x0008442211ULL, -5.333333333333333}, { 581, 0x0040282211ULL, -5.333333333333333},
+    { 581, 0x0040242051ULL, -2.6666666666666665}, { 581, 0x0008242051ULL, 8.0},
+    { 581, 0x0008442051ULL, 5.333333333333333}, { 581, 0x0040282051ULL, 5.333333333333333},
+    { 581, 0x0000240251ULL, -16.0}, { 581, 0x0000440251ULL, -5.333333333333333},
+    { 581, 0x0000280251ULL, 16.0}, { 581, 0x0000480251ULL, 5.333333333333333},
+    { 581, 0x0000240021ULL, 16.0}, { 581, 0x0000440021ULL, 5.333333333333333},
+    { 581, 0x0000280021ULL, -16.0}, { 581, 0x0000480021ULL, -5.333333333333333},
+    { 581, 0x0000240212ULL, -32.0}, { 581, 0x0000440212ULL, 5.333333333333333},
+    { 581, 0x0000280212ULL, 16.0}, { 581, 0x0000480212ULL, 10.666666666666666},
+    { 581, 0x0000240052ULL, -32.0}, { 581, 0x0000440052ULL, -5.333333333333333},
+    { 581, 0x0000280052ULL, -16.0}, { 581, 0x0000480052ULL, 10.666666666666666},
+    { 581, 0x0000240013ULL, -48.0}, { 581, 0x0000440013ULL, 5.333333333333333},
+    { 581, 0x0000280013ULL, -16.0}, { 581, 0x0000480013ULL, 16.0},
+    { 582, 0x0000082011ULL, -32.0}, { 582, 0x0000082042ULL, 64.0},
+    { 582, 0x0000082003ULL, 64.0}, { 583, 0x0000482251ULL, -5.333333333333333},
+    { 583, 0x0000482021ULL, 5.333333333333333}, { 583, 0x0000482212ULL, -10.666666666666666},
+    { 583, 0x0000482052ULL, -10.666666666666666}, { 583, 0x0000482013ULL, -16.0},
+    { 584, 0x0000080091ULL, 8.0}, { 584, 0x00000c0091ULL, -16.0},
+    { 584, 0x0000100091ULL, 8.0}, { 584, 0x0000080021ULL, -8.0},
+    { 584, 0x00000c0021ULL, 16.0}, { 584, 0x0000100021ULL, -8.0},
+    { 584, 0x0000080052ULL, 32.0}, { 584, 0x0000100052ULL, 32.0},
+    { 584, 0x0000080013ULL, 24.0}, { 584, 0x00000c0013ULL, 16.0},
+    { 584, 0x0000100013ULL, 24.0}, { 585, 0x0000102091ULL, -8.0},
+    { 585, 0x0000102021ULL, 8.0}, { 585, 0x0000102052ULL, -32.0},
+    { 585, 0x0000102013ULL, -24.0}, { 586, 0x0040200201ULL, 21.333333333333332},
+    { 586, 0x0240200201ULL, 21.333333333333332}, { 586, 0x0040200002ULL, 21.333333333333332},
+    { 586, 0x0240200002ULL, 21.333333333333332}, { 587, 0x0001200201ULL, -16.0},
+    { 587, 0x0001400201ULL, 5.333333333333333}, { 587, 0x0041200011ULL, -5.333333333333333},
+    { 587, 0x0001200002ULL, -16.0}, { 587, 0x0001400002ULL, 5.333333333333333},
+    { 588, 0x0000208201ULL, 16.0}, { 588, 0x0000408201ULL, -5.333333333333333},
+    { 588, 0x0040208011ULL, 5.333333333333333}, { 588, 0x0000208002ULL, 16.0},
+    { 588, 0x0000408002ULL, -5.333333333333333}, { 589, 0x0008040041ULL, -64.0},
+    { 589, 0x0208040041ULL, -64.0}, { 589, 0x0008040002ULL, -64.0},
+    { 589, 0x0208040002ULL, -64.0}, { 590, 0x0001040041ULL, 16.0},
+    { 590, 0x0001080041ULL, 16.0}, { 590, 0x0009040011ULL, 16.0},
+    { 590, 0x0001040002ULL, 16.0}, { 590, 0x0001080002ULL, 16.0},
+    { 591, 0x0000048041ULL, -16.0}, { 591, 0x0000088041ULL, -16.0},
+    { 591, 0x0008048011ULL, -16.0}, { 591, 0x0000048002ULL, -16.0},
+    { 591, 0x0000088002ULL, -16.0}, { 592, 0x0040240211ULL, 5.333333333333333},
+    { 592, 0x0008240211ULL, -16.0}, { 592, 0x0008440211ULL, -5.333333333333333},
+    { 592, 0x0040280211ULL, -5.333333333333333}, { 592, 0x0040240051ULL, -5.333333333333333},
+    { 592, 0x0008240051ULL, 16.0}, { 592, 0x0008440051ULL, 5.333333333333333},
+    { 592, 0x0040280051ULL, 5.333333333333333}, { 593, 0x0002002001ULL, 16.0},
+    { 594, 0x000100a001ULL, -32.0}, { 595, 0x0000012001ULL, 16.0},
+    { 596, 0x0041202011ULL, -5.333333333333333}, { 597, 0x004020a011ULL, 5.333333333333333},
+    { 598, 0x0080402411ULL, -1.7777777777777777}, { 598, 0x0080402021ULL, 1.7777777777777777},
+    { 598, 0x0080402212ULL, -7.111111111111111}, { 598, 0x0080402013ULL, -5.333333333333333},
+    { 599, 0x0000002001ULL, -128.0}, { 600, 0x0000402011ULL, 32.0},
+    { 600, 0x0000402202ULL, -32.0}, { 600, 0x0000402003ULL, -32.0},
+    { 601, 0x0000802411ULL, 1.7777777777777777}, { 601, 0x0000802021ULL, -1.7777777777777777},
+    { 601, 0x0000802212ULL, 7.111111111111111}, { 601, 0x0000802013ULL, 5.333333333333333},
+    { 602, 0x0009042011ULL, 16.0}, { 603, 0x000804a011ULL, -16.0},
+    { 604, 0x0048242251ULL, 10.666666666666666}, { 604, 0x0048242021ULL, -10.666666666666666},
+    { 604, 0x0048242212ULL, 21.333333333333332}, { 604, 0x0048242052ULL, 21.333333333333332},
+    { 604, 0x0048242013ULL, 32.0}, { 605, 0x0000082011ULL, 96.0},
+    { 605, 0x0000082042ULL, -96.0}, { 605, 0x0000082003ULL, -96.0},
+    { 606, 0x0000482251ULL, 10.666666666666666}, { 606, 0x0000482021ULL, -10.666666666666666},
+    { 606, 0x0000482212ULL, 21.333333333333332}, { 606, 0x0000482052ULL, 21.333333333333332},
+    { 606, 0x0000482013ULL, 32.0}, { 607, 0x0010082091ULL, -16.0},
+    { 607, 0x0010082021ULL, 16.0}, { 607, 0x0010082052ULL, -64.0},
+    { 607, 0x0010082013ULL, -48.0}, { 608, 0x0000102091ULL, 16.0},
+    { 608, 0x0000102021ULL, -16.0}, { 608, 0x0000102052ULL, 64.0},
+    { 608, 0x0000102013ULL, 48.0}, { 609, 0x0002000001ULL, 32.0},
+    { 610, 0x0001008001ULL, -64.0}, { 611, 0x0000010001ULL, 32.0},
+    { 612, 0x0040200201ULL, -21.333333333333332}, { 612, 0x0240200201ULL, 21.333333333333332},
+    { 612, 0x0040200002ULL, -21.333333333333332}, { 612, 0x0240200002ULL, 21.333333333333332},
+    { 613, 0x0001200201ULL, -16.0}, { 613, 0x0001400201ULL, -5.333333333333333},
+    { 613, 0x0041200011ULL, -5.333333333333333}, { 613, 0x0001200002ULL, -16.0},
+    { 613, 0x0001400002ULL, -5.333333333333333}, { 614, 0x0000208201ULL, 16.0},
+    { 614, 0x0000408201ULL, 5.333333333333333}, { 614, 0x0040208011ULL, 5.333333333333333},
+    { 614, 0x0000208002ULL, 16.0}, { 614, 0x0000408002ULL, 5.333333333333333},
+    { 615, 0x0008040041ULL, 64.0}, { 615, 0x0208040041ULL, -64.0},
+    { 615, 0x0008040002ULL, 64.0}, { 615, 0x0208040002ULL, -64.0},
+    { 616, 0x0001040041ULL, 16.0}, { 616, 0x0001080041ULL, -16.0},
+    { 616, 0x0009040011ULL, 16.0}, { 616, 0x0001040002ULL, 16.0},
+    { 616, 0x0001080002ULL, -16.0}, { 617, 0x0000048041ULL, -16.0},
+    { 617, 0x0000088041ULL, 16.0}, { 617, 0x0008048011ULL, -16.0},
+    { 617, 0x0000048002ULL, -16.0}, { 617, 0x0000088002ULL, 16.0},
+    { 618, 0x0040240211ULL, 5.333333333333333}, { 618, 0x0008240211ULL, -16.0},
+    { 618, 0x0008440211ULL, 5.333333333333333}, { 618, 0x0040280211ULL, 5.333333333333333},
+    { 618, 0x0040240051ULL, -5.333333333333333}, { 618, 0x0008240051ULL, 16.0},
+    { 618, 0x0008440051ULL, -5.333333333333333}, { 618, 0x0040280051ULL, -5.333333333333333},
+    { 619, 0x0000000001ULL, 128.0}, { 619, 0x0200000001ULL, 256.0},
+    { 619, 0x0400000001ULL, 128.0}, { 620, 0x0002002001ULL, 4.0},
+    { 620, 0x0002000011ULL, -16.0}, { 621, 0x000100a001ULL, -8.0},
+    { 621, 0x0001008011ULL, 32.0}, { 622, 0x0000012001ULL, 4.0},
+    { 622, 0x0000010011ULL, -16.0}, { 623, 0x0000200011ULL, -64.0},
+    { 623, 0x0200200011ULL, -64.0}, { 623, 0x0000400011ULL, -21.333333333333332},
+    { 623, 0x0200400011ULL, -21.333333333333332}, { 623, 0x0240200012ULL, 42.666666666666664},
+    { 624, 0x0041202011ULL, 2.6666666666666665}, { 624, 0x0001200211ULL, 16.0},
+    { 624, 0x0001400211ULL, 5.333333333333333}, { 624, 0x0041200021ULL, 5.333333333333333},
+    { 624, 0x0001200012ULL, 16.0}, { 624, 0x0001400012ULL, 5.333333333333333},
+    { 625, 0x004020a011ULL, -2.6666666666666665}, { 625, 0x0000208211ULL, -16.0},
+    { 625, 0x0000408211ULL, -5.333333333333333}, { 625, 0x0040208021ULL, -5.333333333333333},
+    { 625, 0x0000208012ULL, -16.0}, { 625, 0x0000408012ULL, -5.333333333333333},
+    { 626, 0x0000400411ULL, -8.0}, { 626, 0x0000600411ULL, -5.333333333333333},
+    { 626, 0x0000800411ULL, -0.8888888888888888}, { 626, 0x0080402411ULL, -1.3333333333333333},
+    { 626, 0x0000400021ULL, 8.0}, { 626, 0x0000600021ULL, 5.333333333333333},
+    { 626, 0x0000800021ULL, 0.8888888888888888}, { 626, 0x0080402021ULL, 1.3333333333333333},
+    { 626, 0x0000400212ULL, -16.0}, { 626, 0x0000600212ULL, -10.666666666666666},
+    { 626, 0x0000800212ULL, -1.7777777777777777}, { 626, 0x0080402212ULL, -2.6666666666666665},
+    { 626, 0x0040600412ULL, 3.5555555555555554}, { 626, 0x0040400022ULL, -10.666666666666666},
+    { 626, 0x0000400013ULL, -8.0}, { 626, 0x0000600013ULL, -5.333333333333333},
+    { 626, 0x0000800013ULL, -0.8888888888888888}, { 626, 0x0080402013ULL, -1.3333333333333333},
+    { 626, 0x0040600213ULL, 7.111111111111111}, { 626, 0x0040600014ULL, 3.5555555555555554},
+    { 627, 0x0000002001ULL, -128.0}, { 628, 0x0000402011ULL, 32.0},
+    { 629, 0x0000802411ULL, 1.7777777777777777}, { 629, 0x0000802021ULL, -1.7777777777777777},
+    { 629, 0x0000802212ULL, 3.5555555555555554}, { 629, 0x0000802013ULL, 1.7777777777777777},
+    { 630, 0x0000004001ULL, 16.0}, { 630, 0x0000002011ULL, -48.0},
+    { 631, 0x0000404011ULL, -5.333333333333333}, { 631, 0x0000402021ULL, 5.333333333333333},
+    { 632, 0x0000804411ULL, -0.4444444444444444}, { 632, 0x0000804021ULL, 0.4444444444444444},
+    { 632, 0x0000804212ULL, -0.8888888888888888}, { 632, 0x0000804013ULL, -0.4444444444444444},
+    { 633, 0x0000040011ULL, 64.0}, { 633, 0x0200040011ULL, 64.0},
+    { 633, 0x0000080011ULL, -64.0}, { 633, 0x0200080011ULL, -64.0},
+    { 633, 0x0208040012ULL, -128.0}, { 634, 0x0009042011ULL, -8.0},
+    { 634, 0x0001040051ULL, -16.0}, { 634, 0x0001080051ULL, 16.0},
+    { 634, 0x0009040021ULL, -16.0}, { 634, 0x0001040012ULL, -16.0},
+    { 634, 0x0001080012ULL, 16.0}, { 635, 0x000804a011ULL, 8.0},
+    { 635, 0x0000048051ULL, 16.0}, { 635, 0x0000088051ULL, -16.0},
+    { 635, 0x0008048021ULL, 16.0}, { 635, 0x0000048012ULL, 16.0},
+    { 635, 0x0000088012ULL, -16.0}, { 636, 0x0000240251ULL, 16.0},
+    { 636, 0x0000440251ULL, 5.333333333333333}, { 636, 0x0000280251ULL, -16.0},
+    { 636, 0x0000480251ULL, -5.333333333333333}, { 636, 0x0048242251ULL, 8.0},
+    { 636, 0x0000240021ULL, -16.0}, { 636, 0x0000440021ULL, -5.333333333333333},
+    { 636, 0x0000280021ULL, 16.0}, { 636, 0x0000480021ULL, 5.333333333333333},
+    { 636, 0x0048242021ULL, -8.0}, { 636, 0x0000240212ULL, 16.0},
+    { 636, 0x0000440212ULL, 5.333333333333333}, { 636, 0x0000280212ULL, -16.0},
+    { 636, 0x0000480212ULL, -5.333333333333333}, { 636, 0x0048242212ULL, 8.0},
+    { 636, 0x0000240052ULL, 16.0}, { 636, 0x0000440052ULL, 5.333333333333333},
+    { 636, 0x0000280052ULL, -16.0}, { 636, 0x0000480052ULL, -5.333333333333333},
+    { 636, 0x0048242052ULL, 8.0}, { 636, 0x0008440252ULL, -10.666666666666666},
+    { 636, 0x0040280252ULL, 10.666666666666666}, { 636, 0x0040240022ULL, 10.666666666666666},
+    { 636, 0x0008240022ULL, 32.0}, { 636, 0x0000240013ULL, 16.0},
+    { 636, 0x0000440013ULL, 5.333333333333333}, { 636, 0x0000280013ULL, -16.0},
+    { 636, 0x0000480013ULL, -5.333333333333333}, { 636, 0x0048242013ULL, 8.0},
+    { 636, 0x0008440213ULL, -10.666666666666666}, { 636, 0x0040280213ULL, 10.666666666666666},
+    { 636, 0x0008440053ULL, -10.666666666666666}, { 636, 0x0040280053ULL, 10.666666666666666},
+    { 636, 0x0008440014ULL, -10.666666666666666}, { 636, 0x0040280014ULL, 10.666666666666666},
+    { 637, 0x0000082011ULL, 96.0}, { 638, 0x0000482251ULL, 10.666666666666666},
+    { 638, 0x0000482021ULL, -10.666666666666666}, { 638, 0x0000482212ULL, 10.666666666666666},
+    { 638, 0x0000482052ULL, 10.666666666666666}, { 638, 0x0000482013ULL, 10.666666666666666},
+    { 639, 0x0000084011ULL, -16.0}, { 639, 0x0000082021ULL, 16.0},
+    { 640, 0x0000484251ULL, -2.6666666666666665}, { 640, 0x0000484021ULL, 2.6666666666666665},
+    { 640, 0x0000484212ULL, -2.6666666666666665}, { 640, 0x0000484052ULL, -2.6666666666666665},
+    { 640, 0x0000484013ULL, -2.6666666666666665}, { 641, 0x0000080091ULL, -8.0},
+    { 641, 0x00000c0091ULL, 16.0}, { 641, 0x0000100091ULL, -8.0},
+    { 641, 0x0010082091ULL, -12.0}, { 641, 0x0000080021ULL, 8.0},
+    { 641, 0x00000c0021ULL, -16.0}, { 641, 0x0000100021ULL, 8.0},
+    { 641, 0x0010082021ULL, 12.0}, { 641, 0x0000080052ULL, -16.0},
+    { 641, 0x00000c0052ULL, 32.0}, { 641, 0x0000100052ULL, -16.0},
+    { 641, 0x0010082052ULL, -24.0}, { 641, 0x00080c0092ULL, -32.0},
+    { 641, 0x0008080022ULL, -32.0}, { 641, 0x0000080013ULL, -8.0},
+    { 641, 0x00000c0013ULL, 16.0}, { 641, 0x0000100013ULL, -8.0},
+    { 641, 0x0010082013ULL, -12.0}, { 641, 0x00080c0053ULL, -64.0},
+    { 641, 0x00080c0014ULL, -32.0}, { 642, 0x0000102091ULL, 16.0},
+    { 642, 0x0000102021ULL, -16.0}, { 642, 0x0000102052ULL, 32.0},
+    { 642, 0x0000102013ULL, 16.0}, { 643, 0x0000104091ULL, -4.0},
+    { 643, 0x0000104021ULL, 4.0}, { 643, 0x0000104052ULL, -8.0},
+    { 643, 0x0000104013ULL, -4.0}, { 644, 0x0040200201ULL, -42.666666666666664},
+    { 644, 0x0040200002ULL, -42.666666666666664}, { 645, 0x0041200011ULL, 10.666666666666666},
+    { 646, 0x0040208011ULL, -10.666666666666666}, { 647, 0x0000002001ULL, 32.0},
+    { 648, 0x0000402011ULL, -10.666666666666666}, { 648, 0x0000402202ULL, 10.666666666666666},
+    { 648, 0x0000402003ULL, 10.666666666666666}, { 649, 0x0000802411ULL, -0.8888888888888888},
+    { 649, 0x0000802021ULL, 0.8888888888888888}, { 649, 0x0000802212ULL, -3.5555555555555554},
+    { 649, 0x0000802013ULL, -2.6666666666666665}, { 650, 0x0008040041ULL, 128.0},
+    { 650, 0x0008040002ULL, 128.0}, { 651, 0x0009040011ULL, -32.0},
+    { 652, 0x0008048011ULL, 32.0}, { 653, 0x0008440211ULL, 10.666666666666666},
+    { 653, 0x0040280211ULL, 10.666666666666666}, { 653, 0x0008440051ULL, -10.666666666666666},
+    { 653, 0x0040280051ULL, -10.666666666666666}, { 654, 0x0000082011ULL, -32.0},
+    { 654, 0x0000082042ULL, 32.0}, { 654, 0x0000082003ULL, 32.0},
+    { 655, 0x0000482251ULL, -5.333333333333333}, { 655, 0x0000482021ULL, 5.333333333333333},
+    { 655, 0x0000482212ULL, -10.666666666666666}, { 655, 0x0000482052ULL, -10.666666666666666},
+    { 655, 0x0000482013ULL, -16.0}, { 656, 0x0000102091ULL, -8.0},
+    { 656, 0x0000102021ULL, 8.0}, { 656, 0x0000102052ULL, -32.0},
+    { 656, 0x0000102013ULL, -24.0}, { 657, 0x0080400411ULL, 1.7777777777777777},
+    { 657, 0x0080400021ULL, -1.7777777777777777}, { 657, 0x0080400212ULL, 7.111111111111111},
+    { 657, 0x0080400013ULL, 5.333333333333333}, { 658, 0x0000002001ULL, -32.0},
+    { 659, 0x0000402011ULL, 10.666666666666666}, { 659, 0x0000402202ULL, -10.666666666666666},
+    { 659, 0x0000402003ULL, -10.666666666666666}, { 660, 0x0000802411ULL, 0.8888888888888888},
+    { 660, 0x0000802021ULL, -0.8888888888888888}, { 660, 0x0000802212ULL, 3.5555555555555554},
+    { 660, 0x0000802013ULL, 2.6666666666666665}, { 661, 0x0048240251ULL, -10.666666666666666},
+    { 661, 0x0048240021ULL, 10.666666666666666}, { 661, 0x0048240212ULL, -21.333333333333332},
+    { 661, 0x0048240052ULL, -21.333333333333332}, { 661, 0x0048240013ULL, -32.0},
+    { 662, 0x0000082011ULL, 32.0}, { 662, 0x0000082042ULL, -32.0},
+    { 662, 0x0000082003ULL, -32.0}, { 663, 0x0000482251ULL, 5.333333333333333},
+    { 663, 0x0000482021ULL, -5.333333333333333}, { 663, 0x0000482212ULL, 10.666666666666666},
+    { 663, 0x0000482052ULL, 10.666666666666666}, { 663, 0x0000482013ULL, 16.0},
+    { 664, 0x0010080091ULL, 16.0}, { 664, 0x0010080021ULL, -16.0},
+    { 664, 0x0010080052ULL, 64.0}, { 664, 0x0010080013ULL, 48.0},
+    { 665, 0x0000102091ULL, 8.0}, { 665, 0x0000102021ULL, -8.0},
+    { 665, 0x0000102052ULL, 32.0}, { 665, 0x0000102013ULL, 24.0},
+    { 666, 0x0080400411ULL, 1.7777777777777777}, { 666, 0x0080400021ULL, -1.7777777777777777},
+    { 666, 0x0080400212ULL, 3.5555555555555554}, { 666, 0x0080400013ULL, 1.7777777777777777},
+    { 667, 0x0000002001ULL, -32.0}, { 668, 0x0000402011ULL, 10.666666666666666},
+    { 669, 0x0000802411ULL, 0.8888888888888888}, { 669, 0x0000802021ULL, -0.8888888888888888},
+    { 669, 0x0000802212ULL, 1.7777777777777777}, { 669, 0x0000802013ULL, 0.8888888888888888},
+    { 670, 0x0048240251ULL, -10.666666666666666}, { 670, 0x0048240021ULL, 10.666666666666666},
+    { 670, 0x0048240212ULL, -10.666666666666666}, { 670, 0x0048240052ULL, -10.666666666666666},
+    { 670, 0x0048240013ULL, -10.666666666666666}, { 671, 0x0000082011ULL, 32.0},
+    { 672, 0x0000482251ULL, 5.333333333333333}, { 672, 0x0000482021ULL, -5.333333333333333},
+    { 672, 0x0000482212ULL, 5.333333333333333}, { 672, 0x0000482052ULL, 5.333333333333333},
+    { 672, 0x0000482013ULL, 5.333333333333333}, { 673, 0x0010080091ULL, 16.0},
+    { 673, 0x0010080021ULL, -16.0}, { 673, 0x0010080052ULL, 32.0},
+    { 673, 0x0010080013ULL, 16.0}, { 674, 0x0000102091ULL, 8.0},
+    { 674, 0x0000102021ULL, -8.0}, { 674, 0x0000102052ULL, 16.0},
+    { 674, 0x0000102013ULL, 8.0}, { 675, 0x0000202002ULL, -128.0},
+    { 675, 0x0200202002ULL, -128.0}, { 675, 0x0000402002ULL, -42.666666666666664},
+    { 675, 0x0200402002ULL, -42.666666666666664}, { 675, 0x0040202202ULL, 21.333333333333332},
+    { 675, 0x0040202003ULL, 21.333333333333332}, { 675, 0x0240202003ULL, 42.666666666666664},
+    { 676, 0x0041204002ULL, 5.333333333333333}, { 677, 0x004020c002ULL, -5.333333333333333},
+    { 678, 0x0000402012ULL, 32.0}, { 678, 0x0000602012ULL, 21.333333333333332},
+    { 678, 0x0000802012ULL, 3.5555555555555554}, { 678, 0x0040402212ULL, 5.333333333333333},
+    { 678, 0x0040602212ULL, -3.5555555555555554}, { 678, 0x0040402013ULL, -16.0},
+    { 678, 0x0040602013ULL, -3.5555555555555554}, { 679, 0x0000002002ULL, 128.0},
+    { 680, 0x0000404002ULL, 32.0}, { 680, 0x0000402012ULL, -21.333333333333332},
+    { 681, 0x0000804012ULL, -3.5555555555555554}, { 682, 0x0000042002ULL, 128.0},
+    { 682, 0x0200042002ULL, 128.0}, { 682, 0x0000082002ULL, -128.0},
+    { 682, 0x0200082002ULL, -128.0}, { 682, 0x0008042042ULL, -64.0},
+    { 682, 0x0008042003ULL, -64.0}, { 682, 0x0208042003ULL, -128.0},
+    { 683, 0x0009044002ULL, -16.0}, { 684, 0x000804c002ULL, 16.0},
+    { 685, 0x0000242012ULL, -64.0}, { 685, 0x0000442012ULL, -21.333333333333332},
+    { 685, 0x0000282012ULL, 64.0}, { 685, 0x0000482012ULL, 21.333333333333332},
+    { 685, 0x0040242212ULL, 5.333333333333333}, { 685, 0x0008242212ULL, -32.0},
+    { 685, 0x0008442212ULL, 5.333333333333333}, { 685, 0x0040282212ULL, -5.333333333333333},
+    { 685, 0x0040242052ULL, -10.666666666666666}, { 685, 0x0008242052ULL, 16.0},
+    { 685, 0x0008442052ULL, 5.333333333333333}, { 685, 0x0040282052ULL, -5.333333333333333},
+    { 685, 0x0040242013ULL, 16.0}, { 685, 0x0008242013ULL, 48.0},
+    { 685, 0x0008442013ULL, 10.666666666666666}, { 685, 0x0040282013ULL, -10.666666666666666},
+    { 686, 0x0000084002ULL, 96.0}, { 686, 0x0000082012ULL, -64.0},
+    { 687, 0x0000484012ULL, -21.333333333333332}, { 688, 0x0000082012ULL, 32.0},
+    { 688, 0x00000c2012ULL, -64.0}, { 688, 0x0000102012ULL, 32.0},
+    { 688, 0x0008082052ULL, 16.0}, { 688, 0x00080c2052ULL, 32.0},
+    { 688, 0x0008082013ULL, -48.0}, { 688, 0x00080c2013ULL, 32.0},
+    { 689, 0x0000104012ULL, -32.0}, { 690, 0x0000200002ULL, -128.0},
+    { 690, 0x0200200002ULL, -128.0}, { 690, 0x0000400002ULL, -42.666666666666664},
+    { 690, 0x0200400002ULL, -42.666666666666664}, { 691, 0x0041202002ULL, 16.0},
+    { 692, 0x004020a002ULL, -16.0}, { 693, 0x0000400402ULL, 16.0},
+    { 693, 0x0000600402ULL, -10.666666666666666}, { 693, 0x0000800402ULL, 1.7777777777777777},
+    { 693, 0x0000400012ULL, 32.0}, { 693, 0x0000600012ULL, 21.333333333333332},
+    { 693, 0x0000800012ULL, 3.5555555555555554}, { 693, 0x0000400004ULL, -16.0},
+    { 693, 0x0000600004ULL, 10.666666666666666}, { 693, 0x0000800004ULL, -1.7777777777777777},
+    { 694, 0x0000402002ULL, 21.333333333333332}, { 695, 0x0000802402ULL, -1.7777777777777777},
+    { 695, 0x0000802012ULL, -3.5555555555555554}, { 695, 0x0000802004ULL, 1.7777777777777777},
+    { 696, 0x0000040002ULL, 128.0}, { 696, 0x0200040002ULL, 128.0},
+    { 696, 0x0000080002ULL, -128.0}, { 696, 0x0200080002ULL, -128.0},
+    { 697, 0x0009042002ULL, -48.0}, { 698, 0x000804a002ULL, 48.0},
+    { 699, 0x0040242202ULL, -5.333333333333333}, { 699, 0x0008242202ULL, 16.0},
+    { 699, 0x0008442202ULL, 10.666666666666666}, { 699, 0x0040282202ULL, 10.666666666666666},
+    { 699, 0x0040242042ULL, 5.333333333333333}, { 699, 0x0008242042ULL, -16.0},
+    { 699, 0x0008442042ULL, -10.666666666666666}, { 699, 0x0040282042ULL, -10.666666666666666},
+    { 699, 0x0000240242ULL, -32.0}, { 699, 0x0000440242ULL, 10.666666666666666},
+    { 699, 0x0000280242ULL, -32.0}, { 699, 0x0000480242ULL, 10.666666666666666},
+    { 699, 0x0000240012ULL, -64.0}, { 699, 0x0000440012ULL, -21.333333333333332},
+    { 699, 0x0000280012ULL, 64.0}, { 699, 0x0000480012ULL, 21.333333333333332},
+    { 699, 0x0000440203ULL, -10.666666666666666}, { 699, 0x0000280203ULL, -32.0},
+    { 699, 0x0000440043ULL, 10.666666666666666}, { 699, 0x0000280043ULL, 32.0},
+    { 699, 0x0000240004ULL, 32.0}, { 699, 0x0000440004ULL, -10.666666666666666},
+    { 699, 0x0000280004ULL, 32.0}, { 699, 0x0000480004ULL, -10.666666666666666},
+    { 700, 0x0000082002ULL, 64.0}, { 701, 0x0000482242ULL, -10.666666666666666},
+    { 701, 0x0000482012ULL, -21.333333333333332}, { 701, 0x0000482004ULL, 10.666666666666666},
+    { 702, 0x0000080082ULL, 16.0}, { 702, 0x00000c0082ULL, 32.0},
+    { 702, 0x0000100082ULL, 16.0}, { 702, 0x0000080012ULL, 32.0},
+    { 702, 0x00000c0012ULL, -64.0}, { 702, 0x0000100012ULL, 32.0},
+    { 702, 0x0000080004ULL, -16.0}, { 702, 0x00000c0004ULL, -32.0},
+    { 702, 0x0000100004ULL, -16.0}, { 703, 0x0000102082ULL, -16.0},
+    { 703, 0x0000102012ULL, -32.0}, { 703, 0x0000102004ULL, 16.0},
+    { 704, 0x0041200002ULL, 10.666666666666666}, { 705, 0x0040208002ULL, -10.666666666666666},
+    { 706, 0x0009040002ULL, -32.0}, { 707, 0x0008048002ULL, 32.0},
+    { 708, 0x0040240202ULL, -10.666666666666666}, { 708, 0x0008240202ULL, 32.0},
+    { 708, 0x0008440202ULL, 10.666666666666666}, { 708, 0x0040280202ULL, 10.666666666666666},
+    { 708, 0x0040240042ULL, 10.666666666666666}, { 708, 0x0008240042ULL, -32.0},
+    { 708, 0x0008440042ULL, -10.666666666666666}, { 708, 0x0040280042ULL, -10.666666666666666},
+    { 709, 0x0041202002ULL, 10.666666666666666}, { 710, 0x004020a002ULL, -10.666666666666666},
+    { 711, 0x0080402402ULL, -3.5555555555555554}, { 711, 0x0080402012ULL, -7.111111111111111},
+    { 711, 0x0080402004ULL, 3.5555555555555554}, { 712, 0x0000402002ULL, -64.0},
+    { 713, 0x0000802402ULL, 3.5555555555555554}, { 713, 0x0000802012ULL, 7.111111111111111},
+    { 713, 0x0000802004ULL, -3.5555555555555554}, { 714, 0x0009042002ULL, -32.0},
+    { 715, 0x000804a002ULL, 32.0}, { 716, 0x0048242242ULL, 21.333333333333332},
+    { 716, 0x0048242012ULL, 42.666666666666664}, { 716, 0x0048242004ULL, -21.333333333333332},
+    { 717, 0x0000082002ULL, -192.0}, { 718, 0x0000482242ULL, 21.333333333333332},
+    { 718, 0x0000482012ULL, 42.666666666666664}, { 718, 0x0000482004ULL, -21.333333333333332},
+    { 719, 0x0010082082ULL, -32.0}, { 719, 0x0010082012ULL, -64.0},
+    { 719, 0x0010082004ULL, 32.0}, { 720, 0x0000102082ULL, 32.0},
+    { 720, 0x0000102012ULL, 64.0}, { 720, 0x0000102004ULL, -32.0},
+    { 721, 0x0041200002ULL, 10.666666666666666}, { 722, 0x0040208002ULL, -10.666666666666666},
+    { 723, 0x0009040002ULL, -32.0}, { 724, 0x0008048002ULL, 32.0},
+    { 725, 0x0040240202ULL, -10.666666666666666}, { 725, 0x0008240202ULL, 32.0},
+    { 725, 0x0008440202ULL, -10.666666666666666}, { 725, 0x0040280202ULL, -10.666666666666666},
+    { 725, 0x0040240042ULL, 10.666666666666666}, { 725, 0x0008240042ULL, -32.0},
+    { 725, 0x0008440042ULL, 10.666666666666666}, { 725, 0x0040280042ULL, 10.666666666666666},
+    { 726, 0x0000200002ULL, 128.0}, { 726, 0x0200200002ULL, 128.0},
+    { 726, 0x0000400002ULL, 42.666666666666664}, { 726, 0x0200400002ULL, 42.666666666666664},
+    { 726, 0x0040200202ULL, -21.333333333333332}, { 726, 0x0240200202ULL, 21.333333333333332},
+    { 726, 0x0040200003ULL, -21.333333333333332}, { 726, 0x0240200003ULL, -64.0},
+    { 727, 0x0041202002ULL, -5.333333333333333}, { 727, 0x0041200012ULL, -10.666666666666666},
+    { 728, 0x004020a002ULL, 5.333333333333333}, { 728, 0x0040208012ULL, 10.666666666666666},
+    { 729, 0x0000400012ULL, -32.0}, { 729, 0x0000600012ULL, -21.333333333333332},
+    { 729, 0x0000800012ULL, -3.5555555555555554}, { 729, 0x0080402012ULL, -5.333333333333333},
+    { 729, 0x0040400212ULL, -10.666666666666666}, { 729, 0x0040600212ULL, 3.5555555555555554},
+    { 729, 0x0040400013ULL, 32.0}, { 729, 0x0040600013ULL, 3.5555555555555554},
+    { 730, 0x0000402002ULL, -64.0}, { 731, 0x0000802012ULL, 7.111111111111111},
+    { 732, 0x0000002002ULL, 64.0}, { 733, 0x0000404002ULL, 10.666666666666666},
+    { 733, 0x0000402012ULL, -21.333333333333332}, { 734, 0x0000804012ULL, -1.7777777777777777},
+    { 735, 0x0000040002ULL, -128.0}, { 735, 0x0200040002ULL, -128.0},
+    { 735, 0x0000080002ULL, 128.0}, { 735, 0x0200080002ULL, 128.0},
+    { 735, 0x0008040042ULL, 64.0}, { 735, 0x0208040042ULL, -64.0},
+    { 735, 0x0008040003ULL, 64.0}, { 735, 0x0208040003ULL, 192.0},
+    { 736, 0x0009042002ULL, 16.0}, { 736, 0x0009040012ULL, 32.0},
+    { 737, 0x000804a002ULL, -16.0}, { 737, 0x0008048012ULL, -32.0},
+    { 738, 0x0000240012ULL, 64.0}, { 738, 0x0000440012ULL, 21.333333333333332},
+    { 738, 0x0000280012ULL, -64.0}, { 738, 0x0000480012ULL, -21.333333333333332},
+    { 738, 0x0048242012ULL, 32.0}, { 738, 0x0040240212ULL, 5.333333333333333},
+    { 738, 0x0008240212ULL, 16.0}, { 738, 0x0008440212ULL, -5.333333333333333},
+    { 738, 0x0040280212ULL, 5.333333333333333}, { 738, 0x0040240052ULL, 5.333333333333333},
+    { 738, 0x0008240052ULL, 16.0}, { 738, 0x0008440052ULL, -5.333333333333333},
+    { 738, 0x0040280052ULL, 5.333333333333333}, { 738, 0x0040240013ULL, -32.0},
+    { 738, 0x0008240013ULL, -96.0}, { 738, 0x0008440013ULL, -10.666666666666666},
+    { 738, 0x0040280013ULL, 10.666666666666666}, { 739, 0x0000082002ULL, -192.0},
+    { 740, 0x0000482012ULL, 42.666666666666664}, { 741, 0x0000084002ULL, 32.0},
+    { 741, 0x0000082012ULL, -64.0}, { 742, 0x0000484012ULL, -10.666666666666666},
+    { 743, 0x0000080012ULL, -32.0}, { 743, 0x00000c0012ULL, 64.0},
+    { 743, 0x0000100012ULL, -32.0}, { 743, 0x0010082012ULL, -48.0},
+    { 743, 0x0008080052ULL, -32.0}, { 743, 0x00080c0052ULL, -32.0},
+    { 743, 0x0008080013ULL, 96.0}, { 743, 0x00080c0013ULL, -32.0},
+    { 744, 0x0000102012ULL, 64.0}, { 745, 0x0000104012ULL, -16.0},
+    { 746, 0x0041200002ULL, -21.333333333333332}, { 747, 0x0040208002ULL, 21.333333333333332},
+    { 748, 0x0000402002ULL, 21.333333333333332}, { 749, 0x0000802402ULL, -1.7777777777777777},
+    { 749, 0x0000802012ULL, -3.5555555555555554}, { 749, 0x0000802004ULL, 1.7777777777777777},
+    { 750, 0x0009040002ULL, 64.0}, { 751, 0x0008048002ULL, -64.0},
+    { 752, 0x0008440202ULL, -21.333333333333332}, { 752, 0x0040280202ULL, -21.333333333333332},
+    { 752, 0x0008440042ULL, 21.333333333333332}, { 752, 0x0040280042ULL, 21.333333333333332},
+    { 753, 0x0000082002ULL, 64.0}, { 754, 0x0000482242ULL, -10.666666666666666},
+    { 754, 0x0000482012ULL, -21.333333333333332}, { 754, 0x0000482004ULL, 10.666666666666666},
+    { 755, 0x0000102082ULL, -16.0}, { 755, 0x0000102012ULL, -32.0},
+    { 755, 0x0000102004ULL, 16.0}, { 756, 0x0080400402ULL, 3.5555555555555554},
+    { 756, 0x0080400012ULL, 7.111111111111111}, { 756, 0x0080400004ULL, -3.5555555555555554},
+    { 757, 0x0000402002ULL, -21.333333333333332}, { 758, 0x0000802402ULL, 1.7777777777777777},
+    { 758, 0x0000802012ULL, 3.5555555555555554}, { 758, 0x0000802004ULL, -1.7777777777777777},
+    { 759, 0x0048240242ULL, -21.333333333333332}, { 759, 0x0048240012ULL, -42.666666666666664},
+    { 759, 0x0048240004ULL, 21.333333333333332}, { 760, 0x0000082002ULL, -64.0},
+    { 761, 0x0000482242ULL, 10.666666666666666}, { 761, 0x0000482012ULL, 21.333333333333332},
+    { 761, 0x0000482004ULL, -10.666666666666666}, { 762, 0x0010080082ULL, 32.0},
+    { 762, 0x0010080012ULL, 64.0}, { 762, 0x0010080004ULL, -32.0},
+    { 763, 0x0000102082ULL, 16.0}, { 763, 0x0000102012ULL, 32.0},
+    { 763, 0x0000102004ULL, -16.0}, { 764, 0x0080400012ULL, 7.111111111111111},
+    { 765, 0x0000402002ULL, -21.333333333333332}, { 766, 0x0000802012ULL, 3.5555555555555554},
+    { 767, 0x0048240012ULL, -42.666666666666664}, { 768, 0x0000082002ULL, -64.0},
+    { 769, 0x0000482012ULL, 21.333333333333332}, { 770, 0x0010080012ULL, 64.0},
+    { 771, 0x0000102012ULL, 32.0}, { 772, 0x0000402003ULL, -32.0},
+    { 772, 0x0000602003ULL, -21.333333333333332}, { 772, 0x0000802003ULL, -3.5555555555555554},
+    { 772, 0x0040402203ULL, -10.666666666666666}, { 772, 0x0040602203ULL, 7.111111111111111},
+    { 772, 0x0040402004ULL, 10.666666666666666}, { 772, 0x0040602004ULL, 7.111111111111111},
+    { 773, 0x0000402003ULL, 21.333333333333332}, { 774, 0x0000804003ULL, 3.5555555555555554},
+    { 775, 0x0000242003ULL, 64.0}, { 775, 0x0000442003ULL, 21.333333333333332},
+    { 775, 0x0000282003ULL, -64.0}, { 775, 0x0000482003ULL, -21.333333333333332},
+    { 775, 0x0008242203ULL, 32.0}, { 775, 0x0008442203ULL, -10.666666666666666},
+    { 775, 0x0040282203ULL, 10.666666666666666}, { 775, 0x0040242043ULL, 10.666666666666666},
+    { 775, 0x0008442043ULL, -10.666666666666666}, { 775, 0x0040282043ULL, 10.666666666666666},
+    { 775, 0x0040242004ULL, -10.666666666666666}, { 775, 0x0008242004ULL, -32.0},
+    { 775, 0x0008442004ULL, -21.333333333333332}, { 775, 0x0040282004ULL, 21.333333333333332},
+    { 776, 0x0000082003ULL, 64.0}, { 777, 0x0000484003ULL, 21.333333333333332},
+    { 778, 0x0000082003ULL, -32.0}, { 778, 0x00000c2003ULL, 64.0},
+    { 778, 0x0000102003ULL, -32.0}, { 778, 0x0008082043ULL, -32.0},
+    { 778, 0x00080c2043ULL, -64.0}, { 778, 0x0008082004ULL, 32.0},
+    { 778, 0x00080c2004ULL, -64.0}, { 779, 0x0000104003ULL, 32.0},
+    { 780, 0x0000400003ULL, -32.0}, { 780, 0x0000600003ULL, -21.333333333333332},
+    { 780, 0x0000800003ULL, -3.5555555555555554}, { 781, 0x0000802003ULL, 3.5555555555555554},
+    { 782, 0x0000240003ULL, 64.0}, { 782, 0x0000440003ULL, 21.333333333333332},
+    { 782, 0x0000280003ULL, -64.0}, { 782, 0x0000480003ULL, -21.333333333333332},
+    { 783, 0x0000482003ULL, 21.333333333333332}, { 784, 0x0000080003ULL, -32.0},
+    { 784, 0x00000c0003ULL, 64.0}, { 784, 0x0000100003ULL, -32.0},
+    { 785, 0x0000102003ULL, 32.0}, { 786, 0x0080402003ULL, 7.111111111111111},
+    { 787, 0x0000802003ULL, -7.111111111111111}, { 788, 0x0048242003ULL, -42.666666666666664},
+    { 789, 0x0000482003ULL, -42.666666666666664}, { 790, 0x0010082003ULL, 64.0},
+    { 791, 0x0000102003ULL, -64.0}, { 792, 0x0000400003ULL, 32.0},
+    { 792, 0x0000600003ULL, 21.333333333333332}, { 792, 0x0000800003ULL, 3.5555555555555554},
+    { 792, 0x0080402003ULL, 5.333333333333333}, { 792, 0x0040400203ULL, 21.333333333333332},
+    { 792, 0x0040600203ULL, -7.111111111111111}, { 792, 0x0040400004ULL, -21.333333333333332},
+    { 792, 0x0040600004ULL, -7.111111111111111}, { 793, 0x0000802003ULL, -7.111111111111111},
+    { 794, 0x0000402003ULL, 21.333333333333332}, { 795, 0x0000804003ULL, 1.7777777777777777},
+    { 796, 0x0000240003ULL, -64.0}, { 796, 0x0000440003ULL, -21.333333333333332},
+    { 796, 0x0000280003ULL, 64.0}, { 796, 0x0000480003ULL, 21.333333333333332},
+    { 796, 0x0048242003ULL, -32.0}, { 796, 0x0040240203ULL, -10.666666666666666},
+    { 796, 0x0008240203ULL, -32.0}, { 796, 0x0008440203ULL, 10.666666666666666},
+    { 796, 0x0040280203ULL, -10.666666666666666}, { 796, 0x0040240043ULL, -10.666666666666666},
+    { 796, 0x0008240043ULL, -32.0}, { 796, 0x0008440043ULL, 10.666666666666666},
+    { 796, 0x0040280043ULL, -10.666666666666666}, { 796, 0x0040240004ULL, 21.333333333333332},
+    { 796, 0x0008240004ULL, 64.0}, { 796, 0x0008440004ULL, 21.333333333333332},
+    { 796, 0x0040280004ULL, -21.333333333333332}, { 797, 0x0000482003ULL, -42.666666666666664},
+    { 798, 0x0000082003ULL, 64.0}, { 799, 0x0000484003ULL, 10.666666666666666},
+    { 800, 0x0000080003ULL, 32.0}, { 800, 0x00000c0003ULL, -64.0},
+    { 800, 0x0000100003ULL, 32.0}, { 800, 0x0010082003ULL, 48.0},
+    { 800, 0x0008080043ULL, 64.0}, { 800, 0x00080c0043ULL, 64.0},
+    { 800, 0x0008080004ULL, -64.0}, { 800, 0x00080c0004ULL, 64.0},
+    { 801, 0x0000102003ULL, -64.0}, { 802, 0x0000104003ULL, 16.0},
+    { 803, 0x0000802003ULL, 3.5555555555555554}, { 804, 0x0000482003ULL, 21.333333333333332},
+    { 805, 0x0000102003ULL, 32.0}, { 806, 0x0080400003ULL, -7.111111111111111},
+    { 807, 0x0000802003ULL, -3.5555555555555554}, { 808, 0x0048240003ULL, 42.666666666666664},
+    { 809, 0x0000482003ULL, -21.333333333333332}, { 810, 0x0010080003ULL, -64.0},
+    { 811, 0x0000102003ULL, -32.0}, { 812, 0x0080400003ULL, -7.111111111111111},
+    { 813, 0x0000802003ULL, -3.5555555555555554}, { 814, 0x0048240003ULL, 42.666666666666664},
+    { 815, 0x0000482003ULL, -21.333333333333332}, { 816, 0x0010080003ULL, -64.0},
+    { 817, 0x0000102003ULL, -32.0}, { 818, 0x0000000002ULL, 256.0},
+    { 818, 0x0400000002ULL, 256.0}, { 819, 0x0200200012ULL, -128.0},
+    { 819, 0x0000400012ULL, -42.666666666666664}, { 820, 0x0000400412ULL, -16.0},
+    { 820, 0x0000800412ULL, -1.7777777777777777}, { 820, 0x0000400022ULL, 16.0},
+    { 820, 0x0000800022ULL, 1.7777777777777777}, { 820, 0x0000400213ULL, -32.0},
+    { 820, 0x0000800213ULL, -3.5555555555555554}, { 820, 0x0000400014ULL, -16.0},
+    { 820, 0x0000800014ULL, -1.7777777777777777}, { 821, 0x0000002002ULL, -128.0},
+    { 822, 0x0000402012ULL, 32.0}, { 823, 0x0000802412ULL, 1.7777777777777777},
+    { 823, 0x0000802022ULL, -1.7777777777777777}, { 823, 0x0000802213ULL, 3.5555555555555554},
+    { 823, 0x0000802014ULL, 1.7777777777777777}, { 824, 0x0200040012ULL, 128.0},
+    { 824, 0x0000080012ULL, -128.0}, { 825, 0x0000240252ULL, 32.0},
+    { 825, 0x0000480252ULL, -10.666666666666666}, { 825, 0x0000240022ULL, -32.0},
+    { 825, 0x0000480022ULL, 10.666666666666666}, { 825, 0x0000240213ULL, 32.0},
+    { 825, 0x0000480213ULL, -10.666666666666666}, { 825, 0x0000240053ULL, 32.0},
+    { 825, 0x0000480053ULL, -10.666666666666666}, { 825, 0x0000240014ULL, 32.0},
+    { 825, 0x0000480014ULL, -10.666666666666666}, { 826, 0x0000082012ULL, 96.0},
+    { 827, 0x0000482252ULL, 10.666666666666666}, { 827, 0x0000482022ULL, -10.666666666666666},
+    { 827, 0x0000482213ULL, 10.666666666666666}, { 827, 0x0000482053ULL, 10.666666666666666},
+    { 827, 0x0000482014ULL, 10.666666666666666}, { 828, 0x0000080092ULL, -16.0},
+    { 828, 0x0000100092ULL, -16.0}, { 828, 0x0000080022ULL, 16.0},
+    { 828, 0x0000100022ULL, 16.0}, { 828, 0x0000080053ULL, -32.0},
+    { 828, 0x0000100053ULL, -32.0}, { 828, 0x0000080014ULL, -16.0},
+    { 828, 0x0000100014ULL, -16.0}, { 829, 0x0000102092ULL, 16.0},
+    { 829, 0x0000102022ULL, -16.0}, { 829, 0x0000102053ULL, 32.0},
+    { 829, 0x0000102014ULL, 16.0}, { 830, 0x0040200202ULL, -21.333333333333332},
+    { 830, 0x0240200202ULL, -21.333333333333332}, { 830, 0x0040200003ULL, -21.333333333333332},
+    { 830, 0x0240200003ULL, -21.333333333333332}, { 831, 0x0008040042ULL, 64.0},
+    { 831, 0x0208040042ULL, 64.0}, { 831, 0x0008040003ULL, 64.0},
+    { 831, 0x0208040003ULL, 64.0}, { 832, 0x0040240212ULL, -5.333333333333333},
+    { 832, 0x0008240212ULL, 16.0}, { 832, 0x0008440212ULL, 5.333333333333333},
+    { 832, 0x0040280212ULL, 5.333333333333333}, { 832, 0x0040240052ULL, 5.333333333333333},
+    { 832, 0x0008240052ULL, -16.0}, { 832, 0x0008440052ULL, -5.333333333333333},
+    { 832, 0x0040280052ULL, -5.333333333333333}, { 833, 0x0040200202ULL, -21.333333333333332},
+    { 833, 0x0240200202ULL, 21.333333333333332}, { 833, 0x0040200003ULL, -21.333333333333332},
+    { 833, 0x0240200003ULL, 21.333333333333332}, { 834, 0x0008040042ULL, 64.0},
+    { 834, 0x0208040042ULL, -64.0}, { 834, 0x0008040003ULL, 64.0},
+    { 834, 0x0208040003ULL, -64.0}, { 835, 0x0040240212ULL, 5.333333333333333},
+    { 835, 0x0008240212ULL, -16.0}, { 835, 0x0008440212ULL, 5.333333333333333},
+    { 835, 0x0040280212ULL, 5.333333333333333}, { 835, 0x0040240052ULL, -5.333333333333333},
+    { 835, 0x0008240052ULL, 16.0}, { 835, 0x0008440052ULL, -5.333333333333333},
+    { 835, 0x0040280052ULL, -5.333333333333333}, { 836, 0x0000002002ULL, -64.0},
+    { 837, 0x0000402012ULL, 21.333333333333332}, { 838, 0x0000802412ULL, 1.7777777777777777},
+    { 838, 0x0000802022ULL, -1.7777777777777777}, { 838, 0x0000802213ULL, 3.5555555555555554},
+    { 838, 0x0000802014ULL, 1.7777777777777777}, { 839, 0x0000082012ULL, 64.0},
+    { 840, 0x0000482252ULL, 10.666666666666666}, { 840, 0x0000482022ULL, -10.666666666666666},
+    { 840, 0x0000482213ULL, 10.666666666666666}, { 840, 0x0000482053ULL, 10.666666666666666},
+    { 840, 0x0000482014ULL, 10.666666666666666}, { 841, 0x0000102092ULL, 16.0},
+    { 841, 0x0000102022ULL, -16.0}, { 841, 0x0000102053ULL, 32.0},
+    { 841, 0x0000102014ULL, 16.0}, { 842, 0x0200200003ULL, 256.0},
+    { 842, 0x0000400003ULL, 85.33333333333333}, { 843, 0x0000400013ULL, -64.0},
+    { 843, 0x0000800013ULL, -7.111111111111111}, { 844, 0x0000402003ULL, -64.0},
+    { 845, 0x0000802013ULL, 7.111111111111111}, { 846, 0x0200040003ULL, -256.0},
+    { 846, 0x0000080003ULL, 256.0}, { 847, 0x0000240013ULL, 128.0},
+    { 847, 0x0000480013ULL, -42.666666666666664}, { 848, 0x0000082003ULL, -192.0},
+    { 849, 0x0000482013ULL, 42.666666666666664}, { 850, 0x0000080013ULL, -64.0},
+    { 850, 0x0000100013ULL, -64.0}, { 851, 0x0000102013ULL, 64.0},
+    { 852, 0x0040240203ULL, 10.666666666666666}, { 852, 0x0008240203ULL, -32.0},
+    { 852, 0x0008440203ULL, -10.666666666666666}, { 852, 0x0040280203ULL, -10.666666666666666},
+    { 852, 0x0040240043ULL, -10.666666666666666}, { 852, 0x0008240043ULL, 32.0},
+    { 852, 0x0008440043ULL, 10.666666666666666}, { 852, 0x0040280043ULL, 10.666666666666666},
+    { 853, 0x0040240203ULL, -10.666666666666666}, { 853, 0x0008240203ULL, 32.0},
+    { 853, 0x0008440203ULL, -10.666666666666666}, { 853, 0x0040280203ULL, -10.666666666666666},
+    { 853, 0x0040240043ULL, 10.666666666666666}, { 853, 0x0008240043ULL, -32.0},
+    { 853, 0x0008440043ULL, 10.666666666666666}, { 853, 0x0040280043ULL, 10.666666666666666},
+    { 854, 0x0000402003ULL, -42.666666666666664}, { 855, 0x0000802013ULL, 7.111111111111111},
+    { 856, 0x0000082003ULL, -128.0}, { 857, 0x0000482013ULL, 42.666666666666664},
+    { 858, 0x0000102013ULL, 64.0}, { 859, 0x0000400004ULL, 64.0},
+    { 859, 0x0000800004ULL, 7.111111111111111}, { 860, 0x0000802004ULL, -7.111111111111111},
+    { 861, 0x0000240004ULL, -128.0}, { 861, 0x0000480004ULL, 42.666666666666664},
+    { 862, 0x0000482004ULL, -42.666666666666664}, { 863, 0x0000080004ULL, 64.0},
+    { 863, 0x0000100004ULL, 64.0}, { 864, 0x0000102004ULL, -64.0},
+    { 865, 0x0000802004ULL, -7.111111111111111}, { 866, 0x0000482004ULL, -42.666666666666664},
+    { 867, 0x0000102004ULL, -64.0}, { 868, 0x0080402412ULL, 1.7777777777777777},
+    { 868, 0x0080402022ULL, -1.7777777777777777}, { 868, 0x0080402213ULL, 3.5555555555555554},
+    { 868, 0x0080402014ULL, 1.7777777777777777}, { 869, 0x0000002002ULL, 128.0},
+    { 870, 0x0000402012ULL, -32.0}, { 871, 0x0000802412ULL, -1.7777777777777777},
+    { 871, 0x0000802022ULL, 1.7777777777777777}, { 871, 0x0000802213ULL, -3.5555555555555554},
+    { 871, 0x0000802014ULL, -1.7777777777777777}, { 872, 0x0048242252ULL, -10.666666666666666},
+    { 872, 0x0048242022ULL, 10.666666666666666}, { 872, 0x0048242213ULL, -10.666666666666666},
+    { 872, 0x0048242053ULL, -10.666666666666666}, { 872, 0x0048242014ULL, -10.666666666666666},
+    { 873, 0x0000082012ULL, -96.0}, { 874, 0x0000482252ULL, -10.666666666666666},
+    { 874, 0x0000482022ULL, 10.666666666666666}, { 874, 0x0000482213ULL, -10.666666666666666},
+    { 874, 0x0000482053ULL, -10.666666666666666}, { 874, 0x0000482014ULL, -10.666666666666666},
+    { 875, 0x0010082092ULL, 16.0}, { 875, 0x0010082022ULL, -16.0},
+    { 875, 0x0010082053ULL, 32.0}, { 875, 0x0010082014ULL, 16.0},
+    { 876, 0x0000102092ULL, -16.0}, { 876, 0x0000102022ULL, 16.0},
+    { 876, 0x0000102053ULL, -32.0}, { 876, 0x0000102014ULL, -16.0},
+    { 877, 0x0040200202ULL, 21.333333333333332}, { 877, 0x0240200202ULL, -21.333333333333332},
+    { 877, 0x0040200003ULL, 21.333333333333332}, { 877, 0x0240200003ULL, -21.333333333333332},
+    { 878, 0x0008040042ULL, -64.0}, { 878, 0x0208040042ULL, 64.0},
+    { 878, 0x0008040003ULL, -64.0}, { 878, 0x0208040003ULL, 64.0},
+    { 879, 0x0040240212ULL, -5.333333333333333}, { 879, 0x0008240212ULL, 16.0},
+    { 879, 0x0008440212ULL, -5.333333333333333}, { 879, 0x0040280212ULL, -5.333333333333333},
+    { 879, 0x0040240052ULL, 5.333333333333333}, { 879, 0x0008240052ULL, -16.0},
+    { 879, 0x0008440052ULL, 5.333333333333333}, { 879, 0x0040280052ULL, 5.333333333333333},
+    { 880, 0x0080400412ULL, -1.7777777777777777}, { 880, 0x0080400022ULL, 1.7777777777777777},
+    { 880, 0x0080400213ULL, -3.5555555555555554}, { 880, 0x0080400014ULL, -1.7777777777777777},
+    { 881, 0x0000002002ULL, 32.0}, { 882, 0x0000402012ULL, -10.666666666666666},
+    { 883, 0x0000802412ULL, -0.8888888888888888}, { 883, 0x0000802022ULL, 0.8888888888888888},
+    { 883, 0x0000802213ULL, -1.7777777777777777}, { 883, 0x0000802014ULL, -0.8888888888888888},
+    { 884, 0x0048240252ULL, 10.666666666666666}, { 884, 0x0048240022ULL, -10.666666666666666},
+    { 884, 0x0048240213ULL, 10.666666666666666}, { 884, 0x0048240053ULL, 10.666666666666666},
+    { 884, 0x0048240014ULL, 10.666666666666666}, { 885, 0x0000082012ULL, -32.0},
+    { 886, 0x0000482252ULL, -5.333333333333333}, { 886, 0x0000482022ULL, 5.333333333333333},
+    { 886, 0x0000482213ULL, -5.333333333333333}, { 886, 0x0000482053ULL, -5.333333333333333},
+    { 886, 0x0000482014ULL, -5.333333333333333}, { 887, 0x0010080092ULL, -16.0},
+    { 887, 0x0010080022ULL, 16.0}, { 887, 0x0010080053ULL, -32.0},
+    { 887, 0x0010080014ULL, -16.0}, { 888, 0x0000102092ULL, -8.0},
+    { 888, 0x0000102022ULL, 8.0}, { 888, 0x0000102053ULL, -16.0},
+    { 888, 0x0000102014ULL, -8.0}, { 889, 0x0080402013ULL, 7.111111111111111},
+    { 890, 0x0000402003ULL, 64.0}, { 891, 0x0000802013ULL, -7.111111111111111},
+    { 892, 0x0048242013ULL, -42.666666666666664}, { 893, 0x0000082003ULL, 192.0},
+    { 894, 0x0000482013ULL, -42.666666666666664}, { 895, 0x0010082013ULL, 64.0},
+    { 896, 0x0000102013ULL, -64.0}, { 897, 0x0040240203ULL, 10.666666666666666},
+    { 897, 0x0008240203ULL, -32.0}, { 897, 0x0008440203ULL, 10.666666666666666},
+    { 897, 0x0040280203ULL, 10.666666666666666}, { 897, 0x0040240043ULL, -10.666666666666666},
+    { 897, 0x0008240043ULL, 32.0}, { 897, 0x0008440043ULL, -10.666666666666666},
+    { 897, 0x0040280043ULL, -10.666666666666666}, { 898, 0x0080400013ULL, -7.111111111111111},
+    { 899, 0x0000402003ULL, 21.333333333333332}, { 900, 0x0000802013ULL, -3.5555555555555554},
+    { 901, 0x0048240013ULL, 42.666666666666664}, { 902, 0x0000082003ULL, 64.0},
+    { 903, 0x0000482013ULL, -21.333333333333332}, { 904, 0x0010080013ULL, -64.0},
+    { 905, 0x0000102013ULL, -32.0}, { 906, 0x0080402004ULL, -7.111111111111111},
+    { 907, 0x0000802004ULL, 7.111111111111111}, { 908, 0x0048242004ULL, 42.666666666666664},
+    { 909, 0x0000482004ULL, 42.666666666666664}, { 910, 0x0010082004ULL, -64.0},
+    { 911, 0x0000102004ULL, 64.0}, { 912, 0x0080400004ULL, 7.111111111111111},
+    { 913, 0x0000802004ULL, 3.5555555555555554}, { 914, 0x0048240004ULL, -42.666666666666664},
+    { 915, 0x0000482004ULL, 21.333333333333332}, { 916, 0x0010080004ULL, 64.0},
+    { 917, 0x0000102004ULL, 32.0},
+  };
+
+}
+
+//____________________________________________________________________________
+const genie::SKAmplitudeTable_t & genie::SKAmplitudeTable(int reaction)
+{
+  static const SKAmplitudeTable_t kNN = {
+    sizeof(kMonomialsNN)/sizeof(kMonomialsNN[0]), kMonomialsNN,
+    sizeof(kTermsNN)/sizeof(kTermsNN[0]), kTermsNN
+  };
+  static const SKAmplitudeTable_t kNP = {
+    sizeof(kMonomialsNP)/sizeof(kMonomialsNP[0]), kMonomialsNP,
+    sizeof(kTermsNP)/sizeof(kTermsNP[0]), kTermsNP
+  };
+  static const SKAmplitudeTable_t kPP = {
+    sizeof(kMonomialsPP)/sizeof(kMonomialsPP[0]), kMonomialsPP,
+    sizeof(kTermsPP)/sizeof(kTermsPP[0]), kTermsPP
+  };
+
+  if      (reaction == 1) return kNN;
+  else if (reaction == 2) return kNP;
+  return kPP;
+}
+//____________________________________________________________________________
@@ -23,6 +23,7 @@
 #define _ALAM_SIMO_ATHAR_VACAS_SINGLE_KAON_PXSEC_2014_H_
 
 #include "Framework/EventGen/XSecAlgorithmI.h"
+#include "Physics/Strange/XSection/AlamSimoAtharVacasSKAmplitude.h"
 
 namespace genie {
 
@@ -51,20 +52,20 @@ private:
 
   const XSecIntegratorI * fXSecIntegrator;  ///< cross section integrator
 
-  // Calculate matrix elements
-  double Amatrix_NN(double theta, double phikq) const;
-  double Amatrix_NP(double theta, double phikq) const;
-  double Amatrix_PP(double theta, double phikq) const;
+  // Calculate the matrix element of the current reaction
+  double Amatrix(double theta, double phikq) const;
 
   // Physics parameters set globally
   // The names of these parameters in the code match the convention in the original FORTRAN code
-  // They are used in the matrix element calculations which are thousands of lines long
-  // We try to change as little as possible, so keep these names
   double amLam, amEta, Vus, fpi, d, f, g, amup, amun, Fm1, Fm2;
 
+  // Matrix elements, with their coefficients evaluated at configuration,
+  // per reaction (NN, NP, PP) and final state lepton (e, mu, tau)
+  AlamSimoAtharVacasSKAmplitude fAmplitude[3][3];
+
   // Interaction parameters set locally
-  // These are set event-by-event, and used in the matrix element calculation which is thousands
-  // of lines long. The names are kept from the original FORTRAN code
+  // These are set event-by-event, and used in the matrix element calculation.
+  // The names are kept from the original FORTRAN code
   // They are mutable because the XSec routine must be const in GENIE, but they are needed in the
   // matrix element calculations which are separate functions
   mutable int leptonPDG, reactionType;
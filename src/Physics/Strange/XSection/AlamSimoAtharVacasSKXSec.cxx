@@ -121,12 +121,14 @@ double AlamSimoAtharVacasSKXSec::Integrate(
 
   double xsec = 0;
 
-  // do the integration over log(1-costheta) so it's not so sharply peaked
+  // do the integration over log(1-costheta) so it's not so sharply peaked,
+  // and over Tkaon/(tmax-Tlep) rather than Tkaon: the cross section vanishes
+  // for Tlep+Tkaon > tmax, ie. over half of the (Tlep,Tkaon) square
 
   ROOT::Math::IBaseFunctionMultiDim * func =
-        new utils::gsl::d3Xsec_dTldTkdCosThetal(model, interaction);
-  double kine_min[3] = { zero, zero, -20 }; // Tlep, Tkaon, cosine theta lep
-  double kine_max[3] = { tmax, tmax,  0.69314718056 }; // Tlep, Tkaon, cosine theta lep
+        new utils::gsl::d3Xsec_dTldTkdCosThetal(model, interaction, tmax);
+  double kine_min[3] = { zero, zero, -20 }; // Tlep, Tkaon/(tmax-Tlep), log(1-cos theta lep)
+  double kine_max[3] = { tmax,  1.0,  0.69314718056 };
 
   ROOT::Math::IntegrationMultiDim::Type ig_type =
     utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
@@ -169,10 +171,11 @@ void AlamSimoAtharVacasSKXSec::LoadConfig(void)
 //____________________________________________________________________________
 
 genie::utils::gsl::d3Xsec_dTldTkdCosThetal::d3Xsec_dTldTkdCosThetal(
-     const XSecAlgorithmI * m, const Interaction * i) :
+     const XSecAlgorithmI * m, const Interaction * i, double tmax) :
 ROOT::Math::IBaseFunctionMultiDim(),
 fModel(m),
-fInteraction(i)
+fInteraction(i),
+fTMax(tmax)
 {
 
 }
@@ -193,8 +196,8 @@ double genie::utils::gsl::d3Xsec_dTldTkdCosThetal::DoEval(const double * xin) co
 {
 // inputs:
 //    Tl [GeV]
-//    Tk [GeV]
-//    cosine theta l
+//    Tk [GeV], or Tk/(tmax-Tl) if tmax>0
+//    log(1 - cosine theta l)
 //    * calculate phi_kq based on neutrino energy -- this is for the integral only
 // outputs:
 //   differential cross section [10^-38 cm^2]
@@ -214,6 +217,10 @@ double genie::utils::gsl::d3Xsec_dTldTkdCosThetal::DoEval(const double * xin) co
   double log_oneminuscostheta = xin[2];
   double cos_theta_l = 1.0 - TMath::Exp(log_oneminuscostheta);
   double J = 1.0 - cos_theta_l; // Jacobian for transformation
+  if(fTMax > 0.) {
+    T_k *= (fTMax - T_l);
+    J   *= (fTMax - T_l);
+  }
 
   kinematics->SetKV(kKVTl, T_l);
   kinematics->SetKV(kKVTk, T_k);
@@ -237,6 +244,6 @@ ROOT::Math::IBaseFunctionMultiDim *
    genie::utils::gsl::d3Xsec_dTldTkdCosThetal::Clone() const
 {
   return
-    new genie::utils::gsl::d3Xsec_dTldTkdCosThetal(fModel,fInteraction);
+    new genie::utils::gsl::d3Xsec_dTldTkdCosThetal(fModel,fInteraction,fTMax);
 }
 //____________________________________________________________________________
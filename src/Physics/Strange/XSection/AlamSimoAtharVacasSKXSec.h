@@ -61,10 +61,14 @@ private:
  namespace utils {
   namespace gsl   {
 
+   //! d3xsec/dTl dTk dln(1-cos(theta_l)). With tmax>0, the kaon kinetic
+   //! energy is Tk = s * (tmax-Tl) and the second variable is s in [0,1], so
+   //! that only the physical region Tl+Tk <= tmax is integrated
    class d3Xsec_dTldTkdCosThetal: public ROOT::Math::IBaseFunctionMultiDim
    {
     public:
-      d3Xsec_dTldTkdCosThetal(const XSecAlgorithmI * m, const Interaction * i);
+      d3Xsec_dTldTkdCosThetal(const XSecAlgorithmI * m, const Interaction * i,
+                              double tmax = -1.);
      ~d3Xsec_dTldTkdCosThetal();
       // ROOT::Math::IBaseFunctionMultiDim interface
       unsigned int                        NDim   (void)               const;
@@ -73,6 +77,7 @@ private:
     private:
       const XSecAlgorithmI * fModel;
       const Interaction *    fInteraction;
+      double                 fTMax;
    };
 
   } // gsl   namespace
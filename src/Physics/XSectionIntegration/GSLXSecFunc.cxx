@@ -12,6 +12,7 @@
 //____________________________________________________________________________
 
 #include <cassert>
+#include <vector>
 
 #include <TMath.h>
 
@@ -28,8 +29,28 @@
 #include "Framework/Utils/KineUtils.h"
 #include "Framework/Numerical/GSLUtils.h"
 
+using std::vector;
+
 using namespace genie;
 
+//____________________________________________________________________________
+void genie::utils::gsl::EvalBatch(
+    const ROOT::Math::IBaseFunctionMultiDim & fn,
+    unsigned int n, const double * const * xin, double * out)
+{
+  const XSecFuncBatchI * batch = dynamic_cast<const XSecFuncBatchI *> (&fn);
+  if(batch) {
+    batch->DoEvalBatch(n, xin, out);
+    return;
+  }
+
+  unsigned int ndim = fn.NDim();
+  vector<double> point(ndim);
+  for(unsigned int ip = 0; ip < n; ip++) {
+    for(unsigned int id = 0; id < ndim; id++) point[id] = xin[id][ip];
+    out[ip] = fn(&point[0]);
+  }
+}
 //____________________________________________________________________________
 genie::utils::gsl::dXSec_dQ2_E::dXSec_dQ2_E(
     const XSecAlgorithmI * m, const Interaction * i, double scale) :
@@ -146,6 +167,29 @@ ROOT::Math::IBaseFunctionMultiDim *
   return
     new genie::utils::gsl::d2XSec_dxdy_E(fModel,fInteraction);
 }
+void genie::utils::gsl::d2XSec_dxdy_E::DoEvalBatch(
+    unsigned int n, const double * const * xin, double * out) const
+{
+// inputs:
+//    x [-], y [-] for n points
+// outputs:
+//   differential cross section [10^-38 cm^2] for n points
+//
+  if(n == 0) return;
+  vector<double> W(n), Q2(n);
+  for(unsigned int ip = 0; ip < n; ip++) {
+    fInteraction->KinePtr()->Setx(xin[0][ip]);
+    fInteraction->KinePtr()->Sety(xin[1][ip]);
+    kinematics::UpdateWQ2FromXY(fInteraction);
+    W [ip] = fInteraction->Kine().W();
+    Q2[ip] = fInteraction->Kine().Q2();
+  }
+  const KineVar_t vars[4] = { kKVx, kKVy, kKVW, kKVQ2 };
+  const double *  kine[4] = { xin[0], xin[1], &W[0], &Q2[0] };
+  fModel->XSecBatch(fInteraction, kPSxyfE, n, 4, vars, kine, out);
+
+  for(unsigned int ip = 0; ip < n; ip++) out[ip] /= (1E-38 * units::cm2);
+}
 //____________________________________________________________________________
 genie::utils::gsl::d2XSec_dQ2dy_E::d2XSec_dQ2dy_E(
      const XSecAlgorithmI * m, const Interaction * i) :
@@ -185,6 +229,28 @@ ROOT::Math::IBaseFunctionMultiDim *
   return
     new genie::utils::gsl::d2XSec_dQ2dy_E(fModel,fInteraction);
 }
+void genie::utils::gsl::d2XSec_dQ2dy_E::DoEvalBatch(
+    unsigned int n, const double * const * xin, double * out) const
+{
+// inputs:
+//   Q2 [-], y [-] for n points
+// outputs:
+//   differential cross section [10^-38 cm^2] for n points
+//
+  if(n == 0) return;
+  vector<double> x(n);
+  for(unsigned int ip = 0; ip < n; ip++) {
+    fInteraction->KinePtr()->SetQ2(xin[0][ip]);
+    fInteraction->KinePtr()->Sety (xin[1][ip]);
+    kinematics::UpdateXFromQ2Y(fInteraction);
+    x[ip] = fInteraction->Kine().x();
+  }
+  const KineVar_t vars[3] = { kKVQ2, kKVy, kKVx };
+  const double *  kine[3] = { xin[0], xin[1], &x[0] };
+  fModel->XSecBatch(fInteraction, kPSQ2yfE, n, 3, vars, kine, out);
+
+  for(unsigned int ip = 0; ip < n; ip++) out[ip] /= (1E-38 * units::cm2);
+}
 //____________________________________________________________________________
 genie::utils::gsl::d2XSec_dQ2dydt_E::d2XSec_dQ2dydt_E(
      const XSecAlgorithmI * m, const Interaction * i) :
@@ -318,6 +384,35 @@ ROOT::Math::IBaseFunctionMultiDim *
   return
     new genie::utils::gsl::d2XSec_dWdQ2_E(fModel,fInteraction);
 }
+void genie::utils::gsl::d2XSec_dWdQ2_E::DoEvalBatch(
+    unsigned int n, const double * const * xin, double * out) const
+{
+// inputs:
+//    W  [GeV], Q2 [GeV^2] for n points
+// outputs:
+//   differential cross section [10^-38 cm^2/GeV^3] for n points
+//
+  if(n == 0) return;
+  unsigned int nvars = 2;
+  vector<double> x, y;
+  if(fInteraction->ProcInfo().IsDeepInelastic() ||
+     fInteraction->ProcInfo().IsDarkMatterDeepInelastic()) {
+    double E = fInteraction->InitState().ProbeE(kRfHitNucRest);
+    double M = fInteraction->InitState().Tgt().HitNucP4Ptr()->M();
+    x.resize(n);
+    y.resize(n);
+    for(unsigned int ip = 0; ip < n; ip++) {
+      kinematics::WQ2toXY(E,M,xin[0][ip],xin[1][ip],x[ip],y[ip]);
+    }
+    nvars = 4;
+  }
+  const KineVar_t vars[4] = { kKVW, kKVQ2, kKVx, kKVy };
+  const double *  kine[4] = { xin[0], xin[1],
+                              (nvars==4) ? &x[0] : 0, (nvars==4) ? &y[0] : 0 };
+  fModel->XSecBatch(fInteraction, kPSWQ2fE, n, nvars, vars, kine, out);
+
+  for(unsigned int ip = 0; ip < n; ip++) out[ip] /= (1E-38 * units::cm2);
+}
 //____________________________________________________________________________
 genie::utils::gsl::d2XSec_dxdy_Ex::d2XSec_dxdy_Ex(
      const XSecAlgorithmI * m, const Interaction * i, double x) :
@@ -932,26 +1027,42 @@ unsigned int genie::utils::gsl::dXSec_Log_Wrapper::NDim   (void) const
 {
   return fFn->NDim();
 }
+double genie::utils::gsl::dXSec_Log_Wrapper::Transform (unsigned int i, double x) const
+{
+  if (fIfLog[i]) {
+    double a = fMins[i];
+    double b = fMaxes[i];
+    return a + (b-a)/(constants::kNapierConst-1.) * (exp(x/(b-a)) - 1.);
+  }
+  return x;
+}
 double genie::utils::gsl::dXSec_Log_Wrapper::DoEval (const double * xin) const
 {
   double * toEval = new double[this->NDim()];
-  double a,b,x;
   for (unsigned int i = 0 ; i < this->NDim() ; i++ )
   {
-    if (fIfLog[i]) {
-      a = fMins[i];
-      b = fMaxes[i];
-      x = xin[i];
-      toEval[i] = a + (b-a)/(constants::kNapierConst-1.) * (exp(x/(b-a)) - 1.);
-    }
-    else {
-      toEval[i] = xin[i];
-    }
+    toEval[i] = this->Transform(i, xin[i]);
   }
   double val = (*fFn)(toEval);
   delete[] toEval;
   return val;
 }
+void genie::utils::gsl::dXSec_Log_Wrapper::DoEvalBatch (
+    unsigned int n, const double * const * xin, double * out) const
+{
+  if (n == 0) return;
+  unsigned int ndim = this->NDim();
+  vector< vector<double> > toEval(ndim, vector<double>(n));
+  vector<const double *> rows(ndim);
+  for (unsigned int i = 0 ; i < ndim ; i++ )
+  {
+    for (unsigned int ip = 0 ; ip < n ; ip++ ) {
+      toEval[i][ip] = this->Transform(i, xin[i][ip]);
+    }
+    rows[i] = &toEval[i][0];
+  }
+  genie::utils::gsl::EvalBatch(*fFn, n, &rows[0], out);
+}
 ROOT::Math::IBaseFunctionMultiDim * genie::utils::gsl::dXSec_Log_Wrapper::Clone (void) const
 {
   return new dXSec_Log_Wrapper(fFn,fIfLog,fMins,fMaxes);
@@ -29,6 +29,25 @@ class Interaction;
 namespace utils {
 namespace gsl   {
 
+//.....................................................................................
+//
+// genie::utils::gsl::XSecFuncBatchI
+// Interface of the multi-dimensional cross section functions that can be evaluated
+// over a block of points at once. The points are given as a structure of arrays:
+// xin[idim][ipoint]. Use EvalBatch() to evaluate any ROOT::Math function over a block,
+// falling back to one DoEval() call per point if the function has no batch method.
+//
+class XSecFuncBatchI
+{
+public:
+  virtual ~XSecFuncBatchI() { }
+
+  virtual void DoEvalBatch (unsigned int n, const double * const * xin, double * out) const = 0;
+};
+
+void EvalBatch (const ROOT::Math::IBaseFunctionMultiDim & fn,
+                unsigned int n, const double * const * xin, double * out);
+
 //.....................................................................................
 //
 // genie::utils::gsl::dXSec_dQ2_E
@@ -77,7 +96,7 @@ private:
 // genie::utils::gsl::d2XSec_dxdy_E
 // A 2-D cross section function: d2xsec/dxdy = f(x,y)|(fixed E)
 //
-class d2XSec_dxdy_E: public ROOT::Math::IBaseFunctionMultiDim
+class d2XSec_dxdy_E: public ROOT::Math::IBaseFunctionMultiDim, public XSecFuncBatchI
 {
 public:
   d2XSec_dxdy_E(const XSecAlgorithmI * m, const Interaction * i);
@@ -88,6 +107,9 @@ public:
   double                              DoEval (const double * xin) const;
   ROOT::Math::IBaseFunctionMultiDim * Clone  (void)               const;
 
+  // XSecFuncBatchI interface
+  void DoEvalBatch (unsigned int n, const double * const * xin, double * out) const;
+
 private:
   const XSecAlgorithmI * fModel;
   const Interaction *    fInteraction;
@@ -98,7 +120,7 @@ private:
 // genie::utils::gsl::d2XSec_dQ2dy_E
 // A 2-D cross section function: d2xsec/dQ2dy = f(Q^2,y)|(fixed E)
 //
-class d2XSec_dQ2dy_E: public ROOT::Math::IBaseFunctionMultiDim
+class d2XSec_dQ2dy_E: public ROOT::Math::IBaseFunctionMultiDim, public XSecFuncBatchI
 {
 public:
   d2XSec_dQ2dy_E(const XSecAlgorithmI * m, const Interaction * i);
@@ -109,6 +131,9 @@ public:
   double                              DoEval (const double * xin) const;
   ROOT::Math::IBaseFunctionMultiDim * Clone  (void)               const;
 
+  // XSecFuncBatchI interface
+  void DoEvalBatch (unsigned int n, const double * const * xin, double * out) const;
+
 private:
   const XSecAlgorithmI * fModel;
   const Interaction *    fInteraction;
@@ -161,7 +186,7 @@ private:
 // genie::utils::gsl::d2XSec_dWdQ2_E
 // A 2-D cross section function: d2xsec/dWdQ2 = f(W,Q2)|(fixed E)
 //
-class d2XSec_dWdQ2_E: public ROOT::Math::IBaseFunctionMultiDim
+class d2XSec_dWdQ2_E: public ROOT::Math::IBaseFunctionMultiDim, public XSecFuncBatchI
 {
 public:
   d2XSec_dWdQ2_E(const XSecAlgorithmI * m, const Interaction * i);
@@ -172,6 +197,9 @@ public:
   double                              DoEval (const double * xin) const;
   ROOT::Math::IBaseFunctionMultiDim * Clone  (void)               const;
 
+  // XSecFuncBatchI interface
+  void DoEvalBatch (unsigned int n, const double * const * xin, double * out) const;
+
 private:
   const XSecAlgorithmI * fModel;
   const Interaction *    fInteraction;
@@ -402,7 +430,7 @@ private:
 /// dXSec_Log_Wrapper
 /// Redistributes variables over a range to a e^-x distribution.
 /// Allows the integrator to use a logarithmic series of points while calling uniformly.
-class dXSec_Log_Wrapper: public ROOT::Math::IBaseFunctionMultiDim
+class dXSec_Log_Wrapper: public ROOT::Math::IBaseFunctionMultiDim, public XSecFuncBatchI
 {
   public:
     dXSec_Log_Wrapper(const ROOT::Math::IBaseFunctionMultiDim * fn,
@@ -414,7 +442,12 @@ class dXSec_Log_Wrapper: public ROOT::Math::IBaseFunctionMultiDim
     double                              DoEval (const double * xin) const;
     ROOT::Math::IBaseFunctionMultiDim * Clone  (void)               const;
 
+    // XSecFuncBatchI interface
+    void DoEvalBatch (unsigned int n, const double * const * xin, double * out) const;
+
   private:
+    double Transform (unsigned int i, double x) const;
+
     const ROOT::Math::IBaseFunctionMultiDim * fFn;
     bool * fIfLog;
     double * fMins;
@@ -0,0 +1,363 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+
+#include "libxml/xmlmemory.h"
+#include "libxml/parser.h"
+
+#include <TMath.h>
+#include <TLorentzVector.h>
+
+#include "Framework/Algorithm/AlgConfigPool.h"
+#include "Framework/Conventions/Units.h"
+#include "Framework/EventGen/EventGeneratorI.h"
+#include "Framework/EventGen/EventGeneratorList.h"
+#include "Framework/EventGen/GEVGDriver.h"
+#include "Framework/EventGen/InteractionList.h"
+#include "Framework/EventGen/InteractionListGeneratorI.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Registry/Registry.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Framework/Utils/XmlParserUtils.h"
+#include "Physics/XSectionIntegration/XSecIntegratorI.h"
+#include "Physics/XSectionIntegration/XSecIntegratorTuner.h"
+
+using std::endl;
+using std::ofstream;
+
+using namespace genie;
+
+//____________________________________________________________________________
+XSecIntegratorTuner::XSecIntegratorTuner(double precision, int nenergies) :
+fPrecision(precision),
+fNEnergies(TMath::Max(1, nenergies))
+{
+
+}
+//____________________________________________________________________________
+XSecIntegratorTuner::~XSecIntegratorTuner()
+{
+
+}
+//____________________________________________________________________________
+void XSecIntegratorTuner::Calibrate(const GEVGDriver & driver,
+  const InitialState & init_state, double emax)
+{
+  const EventGeneratorList * evglist = driver.EventGenerators();
+
+  EventGeneratorList::const_iterator evgliter = evglist->begin();
+  for( ; evgliter != evglist->end(); ++evgliter) {
+     const EventGeneratorI * evgen = *evgliter;
+     const InteractionListGeneratorI * ilstgen = evgen->IntListGenerator();
+     InteractionList * ilst = ilstgen->CreateInteractionList(init_state);
+     if(!ilst) continue;
+
+     // the energy range of the splines (see GEVGDriver::CreateSplines())
+     const XSecAlgorithmI * alg = evgen->CrossSectionAlg();
+     double Emin = TMath::Max(0.001,evgen->ValidityContext().Emin());
+     double Emax = evgen->ValidityContext().Emax();
+     if(emax > 0) Emax = TMath::Min(emax, Emax);
+
+     InteractionList::const_iterator intliter = ilst->begin();
+     for( ; intliter != ilst->end(); ++intliter) {
+       this->Calibrate(alg, *intliter, Emin, Emax);
+     }
+     delete ilst;
+  }
+}
+//____________________________________________________________________________
+void XSecIntegratorTuner::Calibrate(
+  const XSecAlgorithmI * model, const Interaction * interaction,
+  double Emin, double Emax)
+{
+  if(!model->GetConfig().Exists("XSec-Integrator")) return;
+  const XSecIntegratorI * intg =
+     dynamic_cast<const XSecIntegratorI *> (model->SubAlg("XSec-Integrator"));
+  if(!intg) return;
+
+  string key = intg->Id().Key();
+  map<string, Calibration>::iterator it = fCalib.find(key);
+  if(it == fCalib.end()) {
+    vector<Candidate> candidates = this->Candidates(intg->GetConfig());
+    if(candidates.size() == 0) {
+      LOG("IntgTuner", pWARN)
+        << "No GSL integration settings to calibrate for: " << key;
+    }
+    Calibration calib;
+    calib.name       = intg->Id().Name();
+    calib.config     = intg->Id().Config();
+    calib.candidates = candidates;
+    calib.cost .assign(candidates.size(), 0.);
+    calib.error.assign(candidates.size(), 0.);
+    calib.cost0      = 0.;
+    calib.error0     = 0.;
+    calib.nchannels  = 0;
+    calib.npoints    = 0;
+    it = fCalib.insert(map<string, Calibration>::value_type(key, calib)).first;
+  }
+  Calibration & calib = it->second;
+  if(calib.candidates.size() == 0) return;
+
+  LOG("IntgTuner", pNOTICE)
+     << "Calibrating " << key << " for " << interaction->AsString();
+
+  // the high-precision reference
+  const Registry & config = intg->GetConfig();
+  int maxeval = (config.Exists("gsl-max-eval")) ?
+                 config.GetInt("gsl-max-eval") : 100000;
+  Candidate ref;
+  ref.type    = "adaptive";
+  ref.reltol  = 0.01 * fPrecision;
+  ref.maxeval = 10 * TMath::Max(maxeval, 100000);
+
+  Interaction local(*interaction);
+  calib.nchannels++;
+
+  double lE = std::log(Emax/Emin);
+  for(int ie = 1; ie <= fNEnergies; ie++) {
+    double E = Emin * std::exp(lE * ie / fNEnergies);
+    double cost = 0.;
+
+    // the configured settings
+    const_cast<XSecIntegratorI *>(intg)->Configure(calib.config);
+    double xsec0 = this->Integral(model, local, E, cost);
+    double cost0 = cost;
+
+    this->Configure(intg, ref);
+    double xsec_ref = this->Integral(model, local, E, cost);
+    if(xsec_ref == 0. || std::isnan(xsec_ref)) {
+      // below threshold, or not computable: no point to calibrate
+      continue;
+    }
+    calib.npoints++;
+    calib.cost0 += cost0;
+    calib.error0 = TMath::Max(calib.error0, std::fabs(xsec0/xsec_ref - 1.));
+
+    for(unsigned int ic = 0; ic < calib.candidates.size(); ic++) {
+      this->Configure(intg, calib.candidates[ic]);
+      double xsec = this->Integral(model, local, E, cost);
+      double err  = std::isnan(xsec) ? 1. : std::fabs(xsec/xsec_ref - 1.);
+      calib.cost [ic] += cost;
+      calib.error[ic]  = TMath::Max(calib.error[ic], err);
+    }
+    LOG("IntgTuner", pINFO)
+       << "E = " << E << " GeV: xsec(reference) = "
+       << (1E+38/units::cm2)*xsec_ref << " x 1E-38 cm^2";
+  }
+
+  // back to the configured settings
+  const_cast<XSecIntegratorI *>(intg)->Configure(calib.config);
+}
+//____________________________________________________________________________
+vector<XSecIntegratorTuner::Candidate> XSecIntegratorTuner::Candidates(
+  const Registry & config) const
+{
+  vector<Candidate> candidates;
+  if(!config.Exists("gsl-integration-type")) return candidates;
+
+  // integrator types of the family of the configured one (the type name
+  // alone does not tell a 1-D from an N-dim adaptive integrator)
+  string type = utils::str::ToLower(config.GetString("gsl-integration-type"));
+  vector<string> types;
+  bool mc = (type == "vegas" || type == "miser" || type == "plain");
+  if(mc) {
+    types.push_back("vegas");
+    types.push_back("miser");
+    types.push_back("adaptive");
+  } else if(type == "gauss" || type == "non_adaptive" ||
+            type == "adaptive_singular") {
+    types.push_back(type);
+    types.push_back("adaptive");
+    if(type != "gauss") types.push_back("gauss");
+  } else {
+    types.push_back(type);
+  }
+
+  const double reltol[] = { 1E-2, 3E-3, 1E-3, 3E-4, 1E-4 };
+  const int    nreltol  = sizeof(reltol)/sizeof(double);
+
+  int maxeval = (config.Exists("gsl-max-eval")) ?
+                 config.GetInt("gsl-max-eval") : -1;
+
+  for(unsigned int it = 0; it < types.size(); it++) {
+    bool mc_type = (types[it] == "vegas" || types[it] == "miser");
+    for(int ir = 0; ir < nreltol; ir++) {
+      Candidate c;
+      c.type    = types[it];
+      c.reltol  = reltol[ir];
+      c.maxeval = maxeval;
+      candidates.push_back(c);
+      // the precision of the Monte Carlo integrators is set by the calls
+      if(mc_type && maxeval > 0) {
+        c.maxeval = maxeval/10; candidates.push_back(c);
+        c.maxeval = maxeval/3;  candidates.push_back(c);
+      }
+    }
+  }
+  return candidates;
+}
+//____________________________________________________________________________
+void XSecIntegratorTuner::Configure(
+  const XSecIntegratorI * intg, const Candidate & c) const
+{
+  Registry r("XSecIntegratorTuner", false);
+  r.Set("gsl-integration-type",   c.type);
+  r.Set("gsl-relative-tolerance", c.reltol);
+  if(c.maxeval > 0) r.Set("gsl-max-eval", c.maxeval);
+
+  XSecIntegratorI * alg = const_cast<XSecIntegratorI *>(intg);
+  alg->Configure(intg->Id().Config()); // drop the previous candidate
+  alg->Configure(r);
+}
+//____________________________________________________________________________
+double XSecIntegratorTuner::Integral(const XSecAlgorithmI * model,
+  Interaction & interaction, double E, double & cost) const
+{
+  // set the probe energy as XSecSplineList::KnotXSec() does
+  double pr_mass = interaction.InitStatePtr()->Probe()->Mass();
+  TLorentzVector p4(0,0,E,E);
+  if (pr_mass > 0.) {
+    double pz = TMath::Max(0.,E*E - pr_mass*pr_mass);
+    p4.SetPz(TMath::Sqrt(pz));
+  }
+  interaction.InitStatePtr()->SetProbeP4(p4);
+
+  std::clock_t start = std::clock();
+  double xsec = model->Integral(&interaction);
+  cost = double(std::clock() - start) / CLOCKS_PER_SEC;
+  return xsec;
+}
+//____________________________________________________________________________
+int XSecIntegratorTuner::Select(const Calibration & calib) const
+{
+  int best = -1;
+  for(unsigned int ic = 0; ic < calib.candidates.size(); ic++) {
+    if(calib.error[ic] > fPrecision) continue;
+    if(best < 0 || calib.cost[ic] < calib.cost[best]) best = ic;
+  }
+  return best;
+}
+//____________________________________________________________________________
+bool XSecIntegratorTuner::SaveAsXml(string filename) const
+{
+  ofstream out(filename.c_str());
+  if(!out.is_open()) {
+    LOG("IntgTuner", pERROR) << "Couldn't write: " << filename;
+    return false;
+  }
+
+  out << "<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?>" << endl << endl;
+  out << "<!-- GENIE cross section integrator settings, tuned for a "
+      << "relative precision of " << fPrecision << " -->" << endl;
+  out << "<integrator_tune precision=\"" << fPrecision << "\">" << endl;
+
+  map<string, Calibration>::const_iterator it = fCalib.begin();
+  for( ; it != fCalib.end(); ++it) {
+    const Calibration & calib = it->second;
+    if(calib.npoints == 0) continue;
+
+    int best = this->Select(calib);
+    if(best < 0) {
+      LOG("IntgTuner", pWARN)
+        << "No candidate meets the precision for " << it->first
+        << " - Keeping its configured settings";
+      out << "  <!-- " << it->first << ": no candidate meets the precision"
+          << " (configured settings: max. error " << calib.error0 << ") -->"
+          << endl;
+      continue;
+    }
+    const Candidate & c = calib.candidates[best];
+
+    LOG("IntgTuner", pNOTICE)
+      << it->first << " : " << c.type << ", rel. tolerance = " << c.reltol
+      << ", max. evaluations = " << c.maxeval
+      << " - CPU time " << calib.cost[best] << " s (was " << calib.cost0
+      << " s), max. error " << calib.error[best] << " (was "
+      << calib.error0 << ")";
+
+    out << "  <!-- " << calib.nchannels << " channels, " << calib.npoints
+        << " points: CPU time " << calib.cost[best] << " s (configured: "
+        << calib.cost0 << " s), max. error " << calib.error[best]
+        << " (configured: " << calib.error0 << ") -->" << endl;
+    out << "  <integrator name=\"" << calib.name
+        << "\" config=\"" << calib.config << "\">" << endl;
+    out << "    <param type=\"string\" name=\"gsl-integration-type\"> "
+        << c.type << " </param>" << endl;
+    out << "    <param type=\"double\" name=\"gsl-relative-tolerance\"> "
+        << c.reltol << " </param>" << endl;
+    if(c.maxeval > 0) {
+      out << "    <param type=\"int\" name=\"gsl-max-eval\"> "
+          << c.maxeval << " </param>" << endl;
+    }
+    out << "  </integrator>" << endl;
+  }
+  out << "</integrator_tune>" << endl;
+  out.close();
+  return true;
+}
+//____________________________________________________________________________
+bool XSecIntegratorTuner::LoadFromXml(string filename)
+{
+  xmlDocPtr xml_doc = xmlParseFile(filename.c_str());
+  if(xml_doc==NULL) {
+    LOG("IntgTuner", pERROR) << "Couldn't parse: " << filename;
+    return false;
+  }
+  xmlNodePtr xml_root = xmlDocGetRootElement(xml_doc);
+  if(xml_root==NULL ||
+     xmlStrcmp(xml_root->name, (const xmlChar *) "integrator_tune")) {
+    LOG("IntgTuner", pERROR) << "Not an integrator tune file: " << filename;
+    xmlFreeDoc(xml_doc);
+    return false;
+  }
+
+  AlgConfigPool * pool = AlgConfigPool::Instance();
+
+  xmlNodePtr xml_intg = xml_root->xmlChildrenNode;
+  for( ; xml_intg != NULL; xml_intg = xml_intg->next) {
+    if(xmlStrcmp(xml_intg->name, (const xmlChar *) "integrator")) continue;
+
+    string name   = utils::xml::GetAttribute(xml_intg, "name");
+    string config = utils::xml::GetAttribute(xml_intg, "config");
+    Registry * r = pool->FindRegistry(name, config);
+    if(!r) {
+      LOG("IntgTuner", pWARN)
+        << "No configuration " << name << "/" << config << " - Skipping";
+      continue;
+    }
+    bool locked = r->IsLocked();
+    r->UnLock();
+
+    xmlNodePtr xml_param = xml_intg->xmlChildrenNode;
+    for( ; xml_param != NULL; xml_param = xml_param->next) {
+      if(xmlStrcmp(xml_param->name, (const xmlChar *) "param")) continue;
+      string type  = utils::xml::GetAttribute(xml_param, "type");
+      string key   = utils::xml::GetAttribute(xml_param, "name");
+      string value = utils::xml::TrimSpaces(
+               xmlNodeListGetString(xml_doc, xml_param->xmlChildrenNode, 1));
+      if(r->Exists(key)) r->UnLockItem(key);
+      if      (type == "int"   ) r->Set(key, (int) atoi(value.c_str()));
+      else if (type == "double") r->Set(key, atof(value.c_str()));
+      else                       r->Set(key, value);
+      LOG("IntgTuner", pNOTICE)
+        << name << "/" << config << ": " << key << " = " << value;
+    }
+    if(locked) r->Lock();
+  }
+  xmlFreeDoc(xml_doc);
+  return true;
+}
+//____________________________________________________________________________
@@ -0,0 +1,114 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::XSecIntegratorTuner
+
+\brief    Calibrates the numerical integration settings of the cross section
+          integrators (XSecIntegratorI) used by a job.
+
+          For each channel given to Calibrate(), the integral of its cross
+          section model is computed at a few energies with a high-precision
+          reference (adaptive integration at 1/100 of the target precision)
+          and with a grid of candidate settings of its integrator: the GSL
+          integration type (of the family of the configured one), relative
+          tolerance and, for Monte Carlo integrators, max evaluations.
+          The integrator settings are shared by all channels using the same
+          integrator (algorithm & parameter set), so SaveAsXml() writes, for
+          each integrator, the candidate with the lowest total CPU time that
+          meets the target precision at all the calibrated points.
+          LoadFromXml() sets such a file at the AlgConfigPool, so that the
+          integrators configured afterwards use the tuned settings.
+
+          Integrators without a "gsl-integration-type" parameter, and models
+          not using an "XSec-Integrator", are left out. The integrals must be
+          computed for real: calibrate without pre-computed (free nucleon)
+          cross section splines.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _XSEC_INTEGRATOR_TUNER_H_
+#define _XSEC_INTEGRATOR_TUNER_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+using std::map;
+using std::string;
+using std::vector;
+
+namespace genie {
+
+class GEVGDriver;
+class InitialState;
+class Interaction;
+class Registry;
+class XSecAlgorithmI;
+class XSecIntegratorI;
+
+class XSecIntegratorTuner {
+
+public:
+  XSecIntegratorTuner(double precision = 1E-3, int nenergies = 4);
+ ~XSecIntegratorTuner();
+
+  //! calibrate the integrators of all the channels of a driver configured
+  //! for the input initial state, up to emax (<0: the max energy of the
+  //! validity range of each generator)
+  void Calibrate (const GEVGDriver & driver, const InitialState & init_state,
+                  double emax = -1.);
+
+  //! calibrate the integrator of the input model & channel at nenergies
+  //! log-spaced energies in (Emin, Emax]
+  void Calibrate (const XSecAlgorithmI * model, const Interaction * interaction,
+                  double Emin, double Emax);
+
+  //! write out the selected settings of each calibrated integrator
+  bool SaveAsXml (string filename) const;
+
+  //! set the integrator settings of a file written by SaveAsXml() at the
+  //! AlgConfigPool (before the integrators get configured)
+  static bool LoadFromXml (string filename);
+
+private:
+
+  //! a candidate integrator setting
+  struct Candidate {
+    string type;     ///< GSL integration type
+    double reltol;   ///< relative tolerance
+    int    maxeval;  ///< max evaluations (<0: as configured)
+  };
+  //! the calibration of an integrator
+  struct Calibration {
+    string            name;       ///< integrator algorithm name
+    string            config;     ///< integrator parameter set
+    vector<Candidate> candidates;
+    vector<double>    cost;       ///< CPU time of each candidate (s)
+    vector<double>    error;      ///< max rel. error of each candidate
+    double            cost0;      ///< CPU time of the configured settings (s)
+    double            error0;     ///< max rel. error of the configured settings
+    int               nchannels;
+    int               npoints;    ///< calibrated (channel, energy) points
+  };
+
+  vector<Candidate> Candidates (const Registry & config) const;
+  void   Configure (const XSecIntegratorI * intg, const Candidate & c) const;
+  double Integral  (const XSecAlgorithmI * model, Interaction & interaction,
+                    double E, double & cost) const;
+  int    Select    (const Calibration & calib) const;
+
+  double                     fPrecision;  ///< target relative precision
+  int                        fNEnergies;  ///< calibrated energies per channel
+  map<string, Calibration>   fCalib;      ///< integrator key -> calibration
+};
+
+}       // genie namespace
+#endif  // _XSEC_INTEGRATOR_TUNER_H_
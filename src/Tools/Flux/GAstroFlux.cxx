@@ -9,6 +9,7 @@
 //____________________________________________________________________________
 
 #include <cassert>
+#include <algorithm>
 
 #include <TH1D.h>
 #include <TH2D.h>
@@ -276,6 +277,8 @@ void GAstroFlux::SetEnergyPowLawIdx(double n)
   // normalize
   double max = fEnergySpectrum->GetMaximum();
   fEnergySpectrum->Scale(1./max);
+
+  fNuGen->ClearTables();
 }
 //___________________________________________________________________________
 void GAstroFlux::SetUserCoordSystem(TRotation & rotation)
@@ -422,27 +425,90 @@ bool GAstroFlux::NuGenerator::SelectEnergy(
     return false;
   }
 
+  if(&log10Epdf != fEPdf) this->BuildEnergyTable(log10Epdf);
+  if(fECdf.empty()) {
+    return false;
+  }
+
+  RandomGen * rnd = RandomGen::Instance();
+
   // Generate weighted flux:
   //
   if(weighted) {
-     RandomGen * rnd = RandomGen::Instance();
      log10E  = log10Emin + (log10Emax-log10Emin) * rnd->RndFlux().Rndm();
-     wght    = log10Epdf.GetBinContent(log10Epdf.FindBin(log10E));
+     wght    = 0.;
+     if(log10E >= fEEdges.front() && log10E < fEEdges.back()) {
+       int ibin = upper_bound(fEEdges.begin(), fEEdges.end(), log10E)
+                - fEEdges.begin() - 1;
+       wght = fEContent[ibin];
+     }
   }
 
   // Generate un-weighted flux:
+  // invert the cumulative pdf, restricted to [log10Emin, log10Emax]
   //
   else {
-     do {
-       log10E = log10Epdf.GetRandom();
+     double cdfmin = this->EnergyCdf(log10Emin);
+     double cdfmax = this->EnergyCdf(log10Emax);
+     if(cdfmax <= cdfmin) {
+       return false;
      }
-     while(log10E < log10Emin || log10E > log10Emax);
+     double u = cdfmin + (cdfmax-cdfmin) * rnd->RndFlux().Rndm();
+     int nb   = fEContent.size();
+     int ibin = upper_bound(fECdf.begin(), fECdf.end(), u) - fECdf.begin() - 1;
+     ibin     = TMath::Max(0, TMath::Min(nb-1, ibin));
+     double dcdf = fECdf[ibin+1] - fECdf[ibin];
+     double frac = (dcdf > 0.) ? (u - fECdf[ibin]) / dcdf : 0.;
+     log10E = fEEdges[ibin] + (fEEdges[ibin+1]-fEEdges[ibin]) * frac;
      wght = 1.;
   }
 
   return true;
 }
 //___________________________________________________________________________
+void GAstroFlux::NuGenerator::BuildEnergyTable(const TH1D & log10Epdf)
+{
+// tabulate the energy pdf (edges, contents & cumulative pdf) once, so that
+// energies are generated without any ROOT histogram calls
+
+  fEPdf = &log10Epdf;
+  fEEdges  .clear();
+  fEContent.clear();
+  fECdf    .clear();
+
+  int nb = log10Epdf.GetNbinsX();
+  double sum = 0.;
+  fEEdges.push_back(log10Epdf.GetBinLowEdge(1));
+  fECdf  .push_back(0.);
+  for(int i = 1; i <= nb; i++) {
+    double content = TMath::Max(0., log10Epdf.GetBinContent(i));
+    sum += content;
+    fEEdges  .push_back(log10Epdf.GetBinLowEdge(i) + log10Epdf.GetBinWidth(i));
+    fEContent.push_back(log10Epdf.GetBinContent(i));
+    fECdf    .push_back(sum);
+  }
+  if(sum <= 0.) {
+    LOG("Flux", pERROR) << "Empty neutrino energy spectrum";
+    fEEdges.clear();
+    fEContent.clear();
+    fECdf.clear();
+    return;
+  }
+  for(unsigned int i = 0; i < fECdf.size(); i++) fECdf[i] /= sum;
+}
+//___________________________________________________________________________
+double GAstroFlux::NuGenerator::EnergyCdf(double log10E) const
+{
+// cumulative energy pdf, interpolated linearly within bins
+
+  if(log10E <= fEEdges.front()) return 0.;
+  if(log10E >= fEEdges.back())  return 1.;
+  int ibin = upper_bound(fEEdges.begin(), fEEdges.end(), log10E)
+           - fEEdges.begin() - 1;
+  double frac = (log10E - fEEdges[ibin]) / (fEEdges[ibin+1] - fEEdges[ibin]);
+  return fECdf[ibin] + (fECdf[ibin+1] - fECdf[ibin]) * frac;
+}
+//___________________________________________________________________________
 bool GAstroFlux::NuGenerator::SelectOrigin(
   bool weighted, TH2D & opdf,
   double & phi, double & costheta, double & wght)
@@ -451,25 +517,75 @@ bool GAstroFlux::NuGenerator::SelectOrigin(
   costheta = -999999;
   phi      = -999999;
 
+  if(&opdf != fOPdf) this->BuildOriginTable(opdf);
+
+  RandomGen * rnd = RandomGen::Instance();
+  unsigned int nphi = fPhiEdges.size() - 1;
+
   // Generate weighted flux:
   //
   if(weighted) {
-     RandomGen * rnd = RandomGen::Instance();
      phi      = 2.*kPi * rnd->RndFlux().Rndm();
      costheta = -1. + 2.*rnd->RndFlux().Rndm();
-     wght     = opdf.GetBinContent(opdf.FindBin(phi,costheta));
+     if(phi      >= fPhiEdges.front() && phi      < fPhiEdges.back() &&
+        costheta >= fCosEdges.front() && costheta < fCosEdges.back()) {
+       int ix = upper_bound(fPhiEdges.begin(), fPhiEdges.end(), phi)
+              - fPhiEdges.begin() - 1;
+       int iy = upper_bound(fCosEdges.begin(), fCosEdges.end(), costheta)
+              - fCosEdges.begin() - 1;
+       unsigned int ibin = iy*nphi + ix;
+       wght = fOSampler.Probability(ibin) * fOSampler.Sum();
+     }
   }
 
   // Generate un-weighted flux:
   //
   else {
-     opdf.GetRandom2(phi,costheta);
+     if(fOSampler.IsEmpty()) {
+       return false;
+     }
+     unsigned int ibin = fOSampler.Sample(rnd->RndFlux().Rndm());
+     unsigned int ix   = ibin % nphi;
+     unsigned int iy   = ibin / nphi;
+     phi      = fPhiEdges[ix] +
+                (fPhiEdges[ix+1]-fPhiEdges[ix]) * rnd->RndFlux().Rndm();
+     costheta = fCosEdges[iy] +
+                (fCosEdges[iy+1]-fCosEdges[iy]) * rnd->RndFlux().Rndm();
      wght = 1.;
   }
 
   return true;
 }
 //___________________________________________________________________________
+void GAstroFlux::NuGenerator::BuildOriginTable(const TH2D & opdf)
+{
+// tabulate the (phi,costheta) pdf once, as an alias table over its bins
+// (bin index = icostheta * nphi + iphi)
+
+  fOPdf = &opdf;
+  fPhiEdges.clear();
+  fCosEdges.clear();
+
+  const TAxis * xaxis = opdf.GetXaxis();
+  const TAxis * yaxis = opdf.GetYaxis();
+  int nx = xaxis->GetNbins();
+  int ny = yaxis->GetNbins();
+  for(int ix = 1; ix <= nx; ix++) fPhiEdges.push_back(xaxis->GetBinLowEdge(ix));
+  fPhiEdges.push_back(xaxis->GetBinUpEdge(nx));
+  for(int iy = 1; iy <= ny; iy++) fCosEdges.push_back(yaxis->GetBinLowEdge(iy));
+  fCosEdges.push_back(yaxis->GetBinUpEdge(ny));
+
+  vector<double> content(nx*ny);
+  for(int iy = 1; iy <= ny; iy++) {
+    for(int ix = 1; ix <= nx; ix++) {
+      content[(iy-1)*nx + (ix-1)] = opdf.GetBinContent(ix,iy);
+    }
+  }
+  if(!fOSampler.Build(content)) {
+    LOG("Flux", pERROR) << "Empty neutrino origin (phi,costheta) pdf";
+  }
+}
+//___________________________________________________________________________
 bool GAstroFlux::NuPropagator::Go(
   double phi, double costheta, const TVector3 & detector_centre,
   double detector_sz, int nu_pdg, double Ev)
@@ -96,6 +96,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 
 #include <TLorentzVector.h>
 #include <TVector3.h>
@@ -103,12 +104,14 @@
 
 #include "Framework/Conventions/Units.h"
 #include "Framework/EventGen/GFluxI.h"
+#include "Framework/Numerical/AliasSampler.h"
 
 class TH1D;
 class TH2D;
 
 using std::string;
 using std::map;
+using std::vector;
 
 namespace genie {
 namespace flux  {
@@ -198,11 +201,24 @@ protected:
   //
   class NuGenerator {
   public:
-    NuGenerator() {}
+    NuGenerator() : fEPdf(0), fOPdf(0) {}
    ~NuGenerator() {}
     bool SelectNuPdg (bool weighted, const map<int,double> & nupdgpdf, int & nupdg, double & wght);
     bool SelectEnergy(bool weighted, TH1D & log10epdf, double log10emin, double log10emax, double & log10e, double & wght);
     bool SelectOrigin(bool weighted, TH2D & opdf, double & phi, double & costheta, double & wght);
+    void ClearTables (void) { fEPdf = 0; fOPdf = 0; } ///< pdf histograms changed: rebuild tables on next use
+  private:
+    void   BuildEnergyTable (const TH1D & log10epdf);
+    void   BuildOriginTable (const TH2D & opdf);
+    double EnergyCdf        (double log10e) const;
+    const TH1D *   fEPdf;     ///< energy pdf the energy table was built from
+    vector<double> fEEdges;   ///< log10(E) bin edges
+    vector<double> fEContent; ///< energy pdf bin contents
+    vector<double> fECdf;     ///< cumulative energy pdf at the bin edges, normalized to 1
+    const TH2D *   fOPdf;     ///< origin pdf the origin table was built from
+    vector<double> fPhiEdges; ///< phi bin edges
+    vector<double> fCosEdges; ///< cos(theta) bin edges
+    AliasSampler   fOSampler; ///< alias table over the (phi,costheta) bins
   };
   class NuPropagator {
   public:
@@ -93,11 +93,15 @@ bool GAtmoFlux::GenerateNext_1try(void)
 
      // generate events according to a power law spectrum,
      // then weight events by flux and inverse power law
-     // (note: cannot use index alpha=1)
+     // (note: cannot use index alpha=1), within the energy range of the
+     // flux tables and of the energy cuts, so that no throws are wasted
+     // on energies rejected by the cuts
      double alpha = fSpectralIndex;
 
-     double emin = TMath::Power(fEnergyBins[0],1.0-alpha);
-     double emax = TMath::Power(fEnergyBins[fNumEnergyBins],1.0-alpha);
+     double elo  = TMath::Max(fEnergyBins[0], this->MinEnergy());
+     double ehi  = TMath::Min(fEnergyBins[fNumEnergyBins], this->MaxEnergy());
+     double emin = TMath::Power(elo,1.0-alpha);
+     double emax = TMath::Power(ehi,1.0-alpha);
      Ev          = TMath::Power(emin+(emax-emin)*rnd->RndFlux().Rndm(),1.0/(1.0-alpha));
      costheta    = -1+2*rnd->RndFlux().Rndm();
      phi         = 2.*kPi* rnd->RndFlux().Rndm();
@@ -123,12 +127,24 @@ bool GAtmoFlux::GenerateNext_1try(void)
      // generate nominal flux
      //
 
-     Axis_t ax = 0, ay = 0, az = 0;
-     fTotalFluxHisto->GetRandom3(ax, ay, az);
-     Ev       = (double)ax;
-     costheta = (double)ay;
-     phi      = (double)az;
-     nu_pdg   = this->SelectNeutrino(Ev, costheta, phi);
+     // a single draw from the alias table selects both the neutrino
+     // species and the (Ev,costheta,phi) bin, then pick a point in the bin
+     if(fFluxSampler.IsEmpty()) {
+        LOG("Flux", pFATAL) << "No atmospheric neutrino flux to sample from!";
+        exit(1);
+     }
+     unsigned int ibin = fFluxSampler.Sample(rnd->RndFlux().Rndm());
+     unsigned int ip   = ibin % fNumPhiBins;      ibin /= fNumPhiBins;
+     unsigned int ic   = ibin % fNumCosThetaBins; ibin /= fNumCosThetaBins;
+     unsigned int ie   = ibin % fNumEnergyBins;   ibin /= fNumEnergyBins;
+
+     Ev       = fEnergyBins[ie] +
+                (fEnergyBins[ie+1]-fEnergyBins[ie]) * rnd->RndFlux().Rndm();
+     costheta = fCosThetaBins[ic] +
+                (fCosThetaBins[ic+1]-fCosThetaBins[ic]) * rnd->RndFlux().Rndm();
+     phi      = fPhiBins[ip] +
+                (fPhiBins[ip+1]-fPhiBins[ip]) * rnd->RndFlux().Rndm();
+     nu_pdg   = fFluxSamplerPdg[ibin];
      weight   = 1.0;
   }
 
@@ -279,6 +295,8 @@ void GAtmoFlux::Initialize(void)
 
   fTotalFluxHisto = 0;
   fTotalFluxHistoIntg = 0;
+  fFluxSampler.Clear();
+  fFluxSamplerPdg.clear();
 
   bool allow_dup = false;
   fPdgCList = new PDGCodeList(allow_dup);
@@ -543,6 +561,44 @@ void GAtmoFlux::AddAllFluxes(void)
   }
 
   fTotalFluxHistoIntg = fTotalFluxHisto->Integral();
+
+  this->BuildFluxSampler();
+}
+//___________________________________________________________________________
+void GAtmoFlux::BuildFluxSampler(void)
+{
+// Build an alias table over all (neutrino species, Ev, costheta, phi) bins
+// of the (bin-integrated) flux histograms, so that the unweighted flux
+// generation selects the species & bin with a single O(1) draw.
+// Bin index = ((species * nE + ie) * ncostheta + ic) * nphi + ip
+
+  fFluxSamplerPdg.clear();
+
+  unsigned int nbins = fNumEnergyBins * fNumCosThetaBins * fNumPhiBins;
+  vector<double> flux;
+  flux.reserve(nbins * fFluxHistoMap.size());
+
+  map<int,TH3D*>::iterator it = fFluxHistoMap.begin();
+  for( ; it != fFluxHistoMap.end(); ++it) {
+    TH3D * flux_histogram = it->second;
+    fFluxSamplerPdg.push_back(it->first);
+    for(unsigned int ie = 0; ie < fNumEnergyBins; ie++) {
+      for(unsigned int ic = 0; ic < fNumCosThetaBins; ic++) {
+        for(unsigned int ip = 0; ip < fNumPhiBins; ip++) {
+          flux.push_back(flux_histogram->GetBinContent(ie+1,ic+1,ip+1));
+        }
+      }
+    }
+  }
+
+  if(!fFluxSampler.Build(flux)) {
+    LOG("Flux", pERROR)
+       << "The atmospheric neutrino flux is 0 in all " << flux.size() << " bins";
+    return;
+  }
+  LOG("Flux", pNOTICE)
+       << "Built flux alias table over " << fFluxSamplerPdg.size()
+       << " neutrino species x " << nbins << " (Ev,costheta,phi) bins";
 }
 //___________________________________________________________________________
 TH3D * GAtmoFlux::CreateFluxHisto(string name, string title)
@@ -47,6 +47,7 @@
 #include <TRotation.h>
 
 #include "Framework/EventGen/GFluxI.h"
+#include "Framework/Numerical/AliasSampler.h"
 
 class TH3D;
 
@@ -112,6 +113,7 @@ protected:
   TH3D *  CreateFluxHisto   (string name, string title);
   void    ZeroFluxHisto     (TH3D * hist);
   void    AddAllFluxes      (void);
+  void    BuildFluxSampler  (void);
   int     SelectNeutrino    (double Ev, double costheta, double phi);
   TH3D*   CreateNormalisedFluxHisto ( TH3D* hist);  // normalise flux files
 
@@ -144,6 +146,8 @@ protected:
   double           fTotalFluxHistoIntg; ///< fFluxSum2D integral
   map<int, TH3D*>  fFluxHistoMap;       ///< flux = f(Ev,cos8,phi) for each neutrino species
   map<int, TH3D*>  fRawFluxHistoMap;    ///< flux = f(Ev,cos8,phi) for each neutrino species
+  AliasSampler     fFluxSampler;        ///< alias table over all (nu species, Ev, cos8, phi) bins
+  vector<int>      fFluxSamplerPdg;     ///< nu species of each block of fFluxSampler bins
   vector<int>      fFluxFlavour;        ///< input flux file for each neutrino species
   vector<string>   fFluxFile;           ///< input flux file for each neutrino species
 };
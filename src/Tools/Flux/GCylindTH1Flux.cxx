@@ -47,9 +47,16 @@ bool GCylindTH1Flux::GenerateNext(void)
   //-- Reset previously generated neutrino code / 4-p / 4-x
   this->ResetSelection();
 
-  //-- Generate an energy from the 'combined' spectrum histogram
+  //-- Select a neutrino species & energy bin from the flux spectra with
+  //   a single alias table draw, generate an energy within the bin
   //   and compute the momentum vector
-  double Ev = (double) fTotSpectrum->GetRandom();
+  RandomGen * rnd = RandomGen::Instance();
+  if(fSampler.IsEmpty()) {
+     LOG("Flux", pERROR) << "No flux spectrum to sample from";
+     return false;
+  }
+  unsigned int ibin = fSampler.Sample(rnd->RndFlux().Rndm());
+  double Ev = fSamplerElow[ibin] + fSamplerEwid[ibin] * rnd->RndFlux().Rndm();
 
   TVector3 p3(*fDirVec); // momentum along the neutrino direction
   p3.SetMag(Ev);         // with |p|=Ev
@@ -61,9 +68,8 @@ bool GCylindTH1Flux::GenerateNext(void)
 
   fgP4.SetPxPyPzE(p3.Px(), p3.Py(), p3.Pz(), Ev);
 
-  //-- Select a neutrino species from the flux fractions at the
-  //   selected energy
-  fgPdgC = (*fPdgCList)[this->SelectNeutrino(Ev)];
+  //-- Set the neutrino species of the selected bin
+  fgPdgC = (*fPdgCList)[fSamplerNu[ibin]];
 
   //-- Compute neutrino 4-x
 
@@ -204,6 +210,14 @@ void GCylindTH1Flux::AddEnergySpectrum(int nu_pdgc, TH1D * spectrum)
   }
 }
 //___________________________________________________________________________
+const TH1D * GCylindTH1Flux::EnergySpectrum(int nu_pdgc) const
+{
+  for(unsigned int i = 0; i < fPdgCList->size() && i < fSpectrum.size(); i++) {
+    if((*fPdgCList)[i] == nu_pdgc) return fSpectrum[i];
+  }
+  return 0;
+}
+//___________________________________________________________________________
 void GCylindTH1Flux::SetRtDependence(string rdep)
 {
 // Set the (functional form of) Rt dependence as string, eg "x*x+sin(x)"
@@ -232,40 +246,33 @@ void GCylindTH1Flux::AddAllFluxes(void)
      else       { fTotSpectrum->Add(spectrum);        }
      inu++;
   }
+
+  this->BuildFluxSampler();
 }
 //___________________________________________________________________________
-int GCylindTH1Flux::SelectNeutrino(double Ev)
+void GCylindTH1Flux::BuildFluxSampler(void)
 {
-  const unsigned int n = fPdgCList->size();
-  double fraction[n];
-
-  vector<TH1D *>::const_iterator spectrum_iter;
-
-  unsigned int inu=0;
-  for(spectrum_iter = fSpectrum.begin();
-                       spectrum_iter != fSpectrum.end(); ++spectrum_iter) {
-     TH1D * spectrum = *spectrum_iter;
-     fraction[inu++] = spectrum->GetBinContent(spectrum->FindBin(Ev));
+// Build an alias table over the bins of all neutrino spectra so that a
+// single O(1) draw selects both the neutrino species and the energy bin
+// (no ROOT histogram calls when generating)
+
+  fSamplerNu  .clear();
+  fSamplerElow.clear();
+  fSamplerEwid.clear();
+
+  vector<double> flux;
+  for(unsigned int inu = 0; inu < fSpectrum.size(); inu++) {
+     TH1D * spectrum = fSpectrum[inu];
+     for(int ib = 1; ib <= spectrum->GetNbinsX(); ib++) {
+        flux        .push_back(spectrum->GetBinContent(ib));
+        fSamplerNu  .push_back(inu);
+        fSamplerElow.push_back(spectrum->GetBinLowEdge(ib));
+        fSamplerEwid.push_back(spectrum->GetBinWidth(ib));
+     }
   }
-
-  double sum = 0;
-  for(inu = 0; inu < n; inu++) {
-     sum += fraction[inu];
-     fraction[inu] = sum;
-     LOG("Flux", pDEBUG) << "SUM-FRACTION(0->" << inu <<") = " << sum;
+  if(!fSampler.Build(flux)) {
+     LOG("Flux", pWARN) << "The input flux spectra are empty";
   }
-
-  RandomGen * rnd = RandomGen::Instance();
-  double R = sum * rnd->RndFlux().Rndm();
-
-  LOG("Flux", pDEBUG) << "R e [0,SUM] = " << R;
-
-  for(inu = 0; inu < n; inu++) {if ( R < fraction[inu] ) return inu;}
-
-  LOG("Flux", pERROR) << "Could not select a neutrino species";
-  assert(false);
-
-  return -1;
 }
 //___________________________________________________________________________
 double GCylindTH1Flux::GeneratePhi(void) const
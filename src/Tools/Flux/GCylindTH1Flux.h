@@ -29,6 +29,7 @@
 #include <TLorentzVector.h>
 
 #include "Framework/EventGen/GFluxI.h"
+#include "Framework/Numerical/AliasSampler.h"
 
 class TH1D;
 class TF1;
@@ -53,6 +54,9 @@ public :
   void AddEnergySpectrum   (int nu_pdgc, TH1D * spectrum);
   void SetRtDependence     (string rdep);
 
+  //! the energy spectrum of a neutrino species (0 if none)
+  const TH1D * EnergySpectrum (int nu_pdgc) const;
+
   // methods implementing the GENIE GFluxI interface
   const PDGCodeList &    FluxParticles (void) { return *fPdgCList; }
   double                 MaxEnergy     (void) { return  fMaxEv;    }
@@ -73,7 +77,7 @@ private:
   void   CleanUp           (void);
   void   ResetSelection    (void);
   void   AddAllFluxes      (void);
-  int    SelectNeutrino    (double Ev);
+  void   BuildFluxSampler  (void);
   double GeneratePhi       (void) const;
   double GenerateRt        (void) const;
 
@@ -85,6 +89,10 @@ private:
   TLorentzVector fgX4;         ///< running generated nu 4-position
   vector<TH1D *> fSpectrum;    ///< flux = f(Ev), 1/neutrino species
   TH1D *         fTotSpectrum; ///< combined flux = f(Ev)
+  AliasSampler   fSampler;     ///< alias table over all (nu species, Ev) bins
+  vector<unsigned int> fSamplerNu;   ///< nu species of each fSampler bin
+  vector<double>       fSamplerElow; ///< low energy edge of each fSampler bin
+  vector<double>       fSamplerEwid; ///< energy width of each fSampler bin
   TVector3 *     fDirVec;      ///< neutrino direction
   TVector3 *     fBeamSpot;    ///< beam spot position
   double         fRt;          ///< transverse size of neutrino beam
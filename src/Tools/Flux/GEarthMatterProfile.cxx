@@ -0,0 +1,176 @@
+//____________________________________________________________________________
+/*!
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+
+#include "Framework/Conventions/Constants.h"
+#include "Framework/Conventions/Units.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/PREM.h"
+#include "Tools/Flux/GEarthMatterProfile.h"
+
+using namespace genie;
+using namespace genie::constants;
+
+namespace genie {
+namespace flux {
+
+//____________________________________________________________________________
+GEarthMatterProfile::GEarthMatterProfile(
+    int ncosz, double depth, double height, double maxsegment) :
+fNCosZ      ( (ncosz > 1) ? ncosz : 1 ),
+fDepth      ( (depth  > 0.) ? depth  : 0. ),
+fHeight     ( (height > 0.) ? height : 0. ),
+fMaxSegment ( (maxsegment > 0.) ? maxsegment : 100000. ),
+fREarth     ( kREarth / units::m )
+{
+  if ( fDepth >= fREarth ) {
+    LOG("Flux", pFATAL)
+      << "Detector depth (" << fDepth << " m) beyond the Earth radius";
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  fPaths.resize(fNCosZ);
+  double dcz = 2. / fNCosZ;
+  for ( int i = 0; i < fNCosZ; ++i ) {
+    this->BuildPath(-1. + (i+0.5)*dcz, fPaths[i]);
+  }
+
+  // column depth at the bin edges, for interpolation
+  fColumn.resize(fNCosZ+1);
+  GEarthPath edge;
+  for ( int i = 0; i <= fNCosZ; ++i ) {
+    this->BuildPath(-1. + i*dcz, edge);
+    fColumn[i] = edge.column;
+  }
+
+  LOG("Flux", pNOTICE)
+    << "Built the Earth matter profile in " << fNCosZ
+    << " cos(zenith) bins (detector depth: " << fDepth
+    << " m, production height: " << fHeight << " m)";
+}
+//____________________________________________________________________________
+GEarthMatterProfile::~GEarthMatterProfile()
+{
+
+}
+//____________________________________________________________________________
+const GEarthPath & GEarthMatterProfile::Path(double cosz) const
+{
+  return fPaths[this->Bin(cosz)];
+}
+//____________________________________________________________________________
+double GEarthMatterProfile::PathLength(double cosz) const
+{
+  return this->EarthExit(cosz, fREarth + fHeight);
+}
+//____________________________________________________________________________
+double GEarthMatterProfile::ColumnDepth(double cosz) const
+{
+  double u = 0.5 * (cosz + 1.) * fNCosZ;
+  if ( u <= 0.     ) return fColumn[0];
+  if ( u >= fNCosZ ) return fColumn[fNCosZ];
+  int    i = (int) u;
+  double f = u - i;
+  return (1.-f) * fColumn[i] + f * fColumn[i+1];
+}
+//____________________________________________________________________________
+double GEarthMatterProfile::Transmission(double cosz, double xsec) const
+{
+  return std::exp( - this->ColumnDepth(cosz) * kNA * xsec );
+}
+//____________________________________________________________________________
+int GEarthMatterProfile::Bin(double cosz) const
+{
+  int i = (int) (0.5 * (cosz + 1.) * fNCosZ);
+  if ( i < 0      ) i = 0;
+  if ( i >= fNCosZ ) i = fNCosZ - 1;
+  return i;
+}
+//____________________________________________________________________________
+double GEarthMatterProfile::EarthExit(double cosz, double radius) const
+{
+  // distance from the detector, backwards along the neutrino direction,
+  // to the sphere of the given radius (>= the detector radius)
+  double rD   = fREarth - fDepth;
+  double disc = rD*rD*(cosz*cosz - 1.) + radius*radius;
+  return -rD*cosz + std::sqrt( (disc > 0.) ? disc : 0. );
+}
+//____________________________________________________________________________
+void GEarthMatterProfile::BuildPath(double cosz, GEarthPath & path) const
+{
+  // s: distance from the detector, backwards along the neutrino direction.
+  // The point at s is at a radius r(s)^2 = rD^2 + 2*s*rD*cosz + s^2.
+  double rD  = fREarth - fDepth;
+  double sE  = this->EarthExit(cosz, fREarth);
+  double sO  = this->PathLength(cosz);
+
+  // break the part within the Earth at each crossing of a shell boundary
+  std::vector<double> sbreak;
+  sbreak.push_back(0.);
+  sbreak.push_back(sE);
+  int nshells = utils::prem::NShells();
+  for ( int k = 0; k < nshells - 1; ++k ) {
+    double R    = utils::prem::ShellRadius(k) / units::m;
+    double disc = rD*rD*(cosz*cosz - 1.) + R*R;
+    if ( disc <= 0. ) continue;
+    double sq = std::sqrt(disc);
+    double s1 = -rD*cosz - sq;
+    double s2 = -rD*cosz + sq;
+    if ( s1 > 0. && s1 < sE ) sbreak.push_back(s1);
+    if ( s2 > 0. && s2 < sE ) sbreak.push_back(s2);
+  }
+  std::sort(sbreak.begin(), sbreak.end());
+
+  double rcore = utils::prem::ShellRadius(1) / units::m;  // outer core
+
+  path.length = sO;
+  path.column = 0.;
+  path.segments.clear();
+
+  // the vacuum from the production point down to the surface
+  if ( sO > sE ) {
+    GEarthSegment air = { sO - sE, 0., 0. };
+    path.segments.push_back(air);
+  }
+
+  // ... then the Earth shells, from the entry point to the detector
+  const int nsub = 8;
+  for ( int ib = (int) sbreak.size() - 1; ib > 0; --ib ) {
+    double shi = sbreak[ib];
+    double slo = sbreak[ib-1];
+    if ( shi - slo < 1.E-3 ) continue;  // (rounding errors)
+    int    nseg = (int) std::ceil( (shi - slo) / fMaxSegment );
+    double ds   = (shi - slo) / nseg;
+    for ( int iseg = 0; iseg < nseg; ++iseg ) {
+      double s0 = shi - (iseg+1)*ds;
+      // mean density along the segment (midpoint rule)
+      double rho = 0.;
+      for ( int j = 0; j < nsub; ++j ) {
+        double s = s0 + (j+0.5) * ds / nsub;
+        double r = std::sqrt( rD*rD + 2.*s*rD*cosz + s*s );
+        rho += utils::prem::Density(r*units::m) / units::g_cm3;
+      }
+      rho /= nsub;
+      double smid = s0 + 0.5*ds;
+      double rmid = std::sqrt( rD*rD + 2.*smid*rD*cosz + smid*smid );
+      GEarthSegment seg = { ds, rho, (rmid < rcore) ? 0.466 : 0.494 };
+      path.segments.push_back(seg);
+      path.column += rho * ds * 100.;   // g/cm^3 * m -> g/cm^2
+    }
+  }
+}
+//____________________________________________________________________________
+
+} // namespace flux
+} // namespace genie
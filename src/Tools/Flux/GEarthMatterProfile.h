@@ -0,0 +1,103 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::flux::GEarthMatterProfile
+
+\brief   Zenith-binned cache of the matter crossed by neutrinos on their way
+         to a detector at (or below) the Earth surface, for atmospheric and
+         astrophysical fluxes with Earth absorption or matter oscillations.
+
+         For each bin in the cosine of the zenith angle of the neutrino
+         arrival direction (+1: from above, -1: from below, through the
+         Earth centre) the cache holds the path length, the column depth
+         and the ordered constant-density segments of the path (from the
+         neutrino origin to the detector), integrated once through the
+         PREM model (see utils::prem). Each neutrino then needs a single
+         table look-up.
+
+         Segments split the path at the PREM shell boundaries and are at
+         most MaxSegment() long, their density being the mean PREM density
+         along them. The segment electron fraction is 0.466 in the core and
+         0.494 in the mantle & crust. The path starts with a vacuum segment
+         from the production height (default: 15 km, typical for atmospheric
+         neutrinos) down to the surface.
+
+         A profile can be shared by several GFluxBlenders and is used by
+         matter-aware GFlavorMixerI schemas (ProbabilityRowsInMatter()).
+
+         Units: lengths in m, densities in g/cm^3, column depths in g/cm^2.
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         for the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef GENIE_FLUX_GEARTHMATTERPROFILE_H
+#define GENIE_FLUX_GEARTHMATTERPROFILE_H
+
+#include <vector>
+
+namespace genie {
+namespace flux {
+
+  /// a constant-density part of a neutrino path
+  struct GEarthSegment {
+    double length;   ///< length (m)
+    double density;  ///< mass density (g/cm^3)
+    double ye;       ///< electron fraction (electrons per nucleon)
+  };
+
+  /// the matter crossed by a neutrino on its way to the detector
+  struct GEarthPath {
+    double                     length;   ///< path length (m)
+    double                     column;   ///< column depth (g/cm^2)
+    std::vector<GEarthSegment> segments; ///< from the neutrino origin to the detector
+  };
+
+  class GEarthMatterProfile {
+
+  public:
+    GEarthMatterProfile(int    ncosz      = 1000,
+                        double depth      = 0.,
+                        double height     = 15000.,
+                        double maxsegment = 100000.);
+   ~GEarthMatterProfile();
+
+    /// the cached path of the cos(zenith) bin containing cosz
+    const GEarthPath & Path        (double cosz) const;
+    /// path length (m), computed exactly
+    double             PathLength  (double cosz) const;
+    /// column depth (g/cm^2), interpolated between the cached bins
+    double             ColumnDepth (double cosz) const;
+    /// Earth transmission probability for a cross section per nucleon
+    /// xsec (cm^2): exp(-column depth * N_A * xsec)
+    double             Transmission(double cosz, double xsec) const;
+
+    int    NCosZBins  (void) const { return fNCosZ;      }
+    double Depth      (void) const { return fDepth;      }
+    double Height     (void) const { return fHeight;     }
+    double MaxSegment (void) const { return fMaxSegment; }
+
+  private:
+    int    Bin       (double cosz) const;
+    double EarthExit (double cosz, double radius) const;
+    void   BuildPath (double cosz, GEarthPath & path) const;
+
+    int                     fNCosZ;      ///< # of cos(zenith) bins in [-1,1]
+    double                  fDepth;      ///< detector depth below the surface (m)
+    double                  fHeight;     ///< neutrino production height (m)
+    double                  fMaxSegment; ///< max length of a path segment (m)
+    double                  fREarth;     ///< Earth radius (m)
+    std::vector<GEarthPath> fPaths;      ///< path at each bin centre
+    std::vector<double>     fColumn;     ///< column depth at each bin edge (g/cm^2)
+  };
+
+} // namespace flux
+} // namespace genie
+
+#endif //GENIE_FLUX_GEARTHMATTERPROFILE_H
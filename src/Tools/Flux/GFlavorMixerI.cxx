@@ -8,6 +8,8 @@
 */
 //____________________________________________________________________________
 
+#include <vector>
+
 #include "Tools/Flux/GFlavorMixerI.h"
 
 namespace genie {
@@ -16,5 +18,34 @@ namespace flux {
   GFlavorMixerI::GFlavorMixerI() { ; }
   GFlavorMixerI::~GFlavorMixerI() { ; }
 
+  void GFlavorMixerI::ProbabilityRows(int n, const int* pdg_initial,
+                                      const double* energy,
+                                      const double* dist,
+                                      int nfinal, const int* pdg_final,
+                                      double* prob)
+  {
+    // default: one Probability() call per element
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < nfinal; ++j) {
+        prob[i*nfinal+j] = this->Probability(pdg_initial[i],pdg_final[j],
+                                             energy[i],dist[i]);
+      }
+    }
+  }
+
+  void GFlavorMixerI::ProbabilityRowsInMatter(int n, const int* pdg_initial,
+                                      const double* energy,
+                                      const GEarthPath* const* path,
+                                      int nfinal, const int* pdg_final,
+                                      double* prob)
+  {
+    // default: vacuum mixing over the path lengths
+    if (n <= 0) return;
+    std::vector<double> dist(n);
+    for (int i = 0; i < n; ++i) dist[i] = path[i]->length;
+    this->ProbabilityRows(n,pdg_initial,energy,&dist[0],
+                          nfinal,pdg_final,prob);
+  }
+
 } // namespace flux
 } // namespace genie
@@ -21,6 +21,18 @@
          Probability is expected to be normalized (that is, the sum
          of all possible outcomes, including 0, must be 1).
 
+         The batch ProbabilityRows() returns the full row of transition
+         probabilities for a block of (energy, distance) pairs.  By default
+         it calls Probability() for each element; models that are costly to
+         evaluate (e.g. diagonalising a matter Hamiltonian) should override
+         it to do that work once per pair rather than once per final flavor.
+
+         ProbabilityRowsInMatter() is its form for neutrinos crossing the
+         Earth (see GEarthMatterProfile): each neutrino comes with the
+         ordered constant-density segments of its path. By default the
+         matter is ignored and the path lengths are used as distances;
+         matter oscillation schemas should override it.
+
 \author  Robert Hatcher <rhatcher \at fnal.gov>
          Fermi National Accelerator Laboratory
 
@@ -36,6 +48,8 @@
 
 #include <string>
 
+#include "Tools/Flux/GEarthMatterProfile.h"
+
 namespace genie {
 namespace flux {
 
@@ -62,6 +76,24 @@ namespace flux {
     virtual double    Probability(int pdg_initial, int pdg_final,
                                   double energy, double dist) = 0;
 
+    /// batch form of Probability(): for each of the n neutrinos
+    /// (initial flavor, energy, distance) fill the transition probabilities
+    /// to each of the nfinal pdg_final codes, prob[i*nfinal+j]
+    virtual void      ProbabilityRows(int n, const int* pdg_initial,
+                                      const double* energy,
+                                      const double* dist,
+                                      int nfinal, const int* pdg_final,
+                                      double* prob);
+
+    /// form of ProbabilityRows() with the matter crossed by each neutrino
+    /// (segments from its origin to the detector); by default the matter
+    /// is ignored and distances are the path lengths
+    virtual void      ProbabilityRowsInMatter(int n, const int* pdg_initial,
+                                      const double* energy,
+                                      const GEarthPath* const* path,
+                                      int nfinal, const int* pdg_final,
+                                      double* prob);
+
     /// provide a means of printing the configuration
     virtual void     PrintConfig(bool verbose=true) = 0;
 
@@ -20,6 +20,7 @@
 
 #include "Tools/Flux/GFluxBlender.h"
 #include "Tools/Flux/GFlavorMixerI.h"
+#include "Tools/Flux/GEarthMatterProfile.h"
 #include "Framework/Messenger/Messenger.h"
 #define  LOG_BEGIN(a,b)   LOG(a,b)
 #define  LOG_END ""
@@ -42,7 +43,16 @@ GFluxBlender::GFluxBlender() :
   fEnergy(0),
   fDistance(0),
   fPdgCGenerated(0),
-  fPdgCMixed(0)
+  fPdgCMixed(0),
+  fRndm(0),
+  fBlockSize(1),
+  fBlockN(0),
+  fBlockNext(0),
+  fWeight(0),
+  fIndex(-1),
+  fMatterProfile(0),
+  fUpDir(0,0,1),
+  fPath(0)
 { ; }
 
 GFluxBlender::~GFluxBlender()
@@ -86,6 +96,24 @@ bool GFluxBlender::GenerateNext(void)
 
   bool gen1 = false;
   while ( ! gen1 ) {
+    if ( UseBlock() ) {
+      // take the next neutrino (& its transition probabilities) of the block
+      if ( fBlockNext >= fBlockN && ! FillBlock() ) return false;
+      size_t i       = fBlockNext++;
+      fPdgCGenerated = fBlkPdg[i];
+      fEnergy        = fBlkEnergy[i];
+      fDistance      = fBlkDist[i];
+      fWeight        = fBlkWeight[i];
+      fIndex         = fBlkIndex[i];
+      fP4            = fBlkP4[i];
+      fX4            = fBlkX4[i];
+      fPath          = fBlkPath[i];
+      for (size_t indx = 0; indx < fNPDGOut; ++indx )
+        fProb[indx] = fBlkProb[i*fNPDGOut+indx];
+      fPdgCMixed = ChooseFromProb();
+      gen1 = ( fPdgCMixed != 0 );
+      continue;
+    }
     if ( ! fRealGFluxI->GenerateNext() ) return false;
     // have a new entry
     fPdgCGenerated = fRealGFluxI->PdgCode();
@@ -99,7 +127,13 @@ bool GFluxBlender::GenerateNext(void)
       if ( fGNuMIFlux   ) fDistance = fGNuMIFlux->GetDecayDist();
       if ( fGSimpleFlux ) fDistance = fGSimpleFlux->GetDecayDist();
       fEnergy = fRealGFluxI->Momentum().Energy();
-      fPdgCMixed = ChooseFlavor(fPdgCGenerated,fEnergy,fDistance);
+      if ( fMatterProfile ) {
+        fPath      = FindPath(fRealGFluxI->Momentum());
+        fDistance  = fPath->length;
+        fPdgCMixed = ChooseFlavor(fPdgCGenerated,fEnergy,fPath);
+      } else {
+        fPdgCMixed = ChooseFlavor(fPdgCGenerated,fEnergy,fDistance);
+      }
       // we may have to generate a new neutrino if it oscillates away
       // don't pass non-particles to GENIE ... it won't like it
       gen1 = ( fPdgCMixed != 0 );
@@ -108,6 +142,63 @@ bool GFluxBlender::GenerateNext(void)
   return true;
 }
 //____________________________________________________________________________
+bool GFluxBlender::FillBlock(void)
+{
+  // draw up to fBlockSize neutrinos from the flux generator and evaluate
+  // all their transition probabilities in a single call to the mixer
+  size_t nblk = fBlockSize;
+  fBlkPdg.resize(nblk);
+  fBlkEnergy.resize(nblk);
+  fBlkDist.resize(nblk);
+  fBlkWeight.resize(nblk);
+  fBlkIndex.resize(nblk);
+  fBlkP4.resize(nblk);
+  fBlkX4.resize(nblk);
+  fBlkPath.resize(nblk);
+
+  fBlockN    = 0;
+  fBlockNext = 0;
+  while ( fBlockN < nblk ) {
+    if ( fBlockN > 0 && fRealGFluxI->End() ) break;
+    if ( ! fRealGFluxI->GenerateNext() ) break;
+    size_t i = fBlockN++;
+    double dist = fBaselineDist;
+    if ( fGNuMIFlux   ) dist = fGNuMIFlux->GetDecayDist();
+    if ( fGSimpleFlux ) dist = fGSimpleFlux->GetDecayDist();
+    fBlkPdg[i]    = fRealGFluxI->PdgCode();
+    fBlkEnergy[i] = fRealGFluxI->Momentum().Energy();
+    fBlkDist[i]   = dist;
+    fBlkWeight[i] = fRealGFluxI->Weight();
+    fBlkIndex[i]  = fRealGFluxI->Index();
+    fBlkP4[i]     = fRealGFluxI->Momentum();
+    fBlkX4[i]     = fRealGFluxI->Position();
+    fBlkPath[i]   = 0;
+    if ( fMatterProfile ) {
+      fBlkPath[i] = FindPath(fBlkP4[i]);
+      fBlkDist[i] = fBlkPath[i]->length;
+    }
+  }
+  if ( fBlockN == 0 ) return false;
+
+  fBlkProb.resize(fBlockN*fNPDGOut);
+  if ( fMatterProfile ) {
+    fFlavorMixer->ProbabilityRowsInMatter(fBlockN,&fBlkPdg[0],&fBlkEnergy[0],
+                                          &fBlkPath[0],fNPDGOut,
+                                          &fPDGListMixed[0],&fBlkProb[0]);
+  } else {
+    fFlavorMixer->ProbabilityRows(fBlockN,&fBlkPdg[0],&fBlkEnergy[0],
+                                  &fBlkDist[0],fNPDGOut,&fPDGListMixed[0],
+                                  &fBlkProb[0]);
+  }
+  return true;
+}
+//____________________________________________________________________________
+bool GFluxBlender::End(void)
+{
+  if ( UseBlock() && fBlockNext < fBlockN ) return false;
+  return fRealGFluxI->End();
+}
+//____________________________________________________________________________
 void GFluxBlender::Clear(Option_t * opt)
 {
 // Clear method needed to conform to GFluxI interface
@@ -119,6 +210,7 @@ long int GFluxBlender::Index(void)
 {
 // Index method needed to conform to GFluxI interface
 //
+  if ( UseBlock() ) return fIndex;
   return fRealGFluxI->Index();
 }
 //____________________________________________________________________________
@@ -131,6 +223,32 @@ void GFluxBlender::GenerateWeighted(bool gen_weighted)
       "gen_weighted: " << gen_weighted;
 }
 //____________________________________________________________________________
+void GFluxBlender::SetEnergyWindow(int pdg, double emin, double emax)
+{
+  // the hint refers to the flavor after mixing: without a mixer pass it
+  // on as is, otherwise pass on the union of the windows of all flavors
+  // to each generated flavor (any of them may oscillate into any other)
+  if ( ! fRealGFluxI ) return;
+  if ( ! fFlavorMixer ) {
+    fRealGFluxI->SetEnergyWindow(pdg,emin,emax);
+    return;
+  }
+  fEWinMin[pdg] = emin;
+  fEWinMax[pdg] = emax;
+  if ( fEWinMin.size() < fNPDGOut ) return; // wait for all flavors
+
+  double umin = fEWinMin.begin()->second;
+  double umax = fEWinMax.begin()->second;
+  std::map<int,double>::const_iterator it = fEWinMin.begin();
+  for ( ; it != fEWinMin.end(); ++it ) {
+    umin = TMath::Min(umin,it->second);
+    umax = TMath::Max(umax,fEWinMax[it->first]);
+  }
+  for (size_t indx = 0; indx < fPDGListGenerator.size(); ++indx ) {
+    fRealGFluxI->SetEnergyWindow(fPDGListGenerator[indx],umin,umax);
+  }
+}
+//____________________________________________________________________________
 GFluxI* GFluxBlender::AdoptFluxGenerator(GFluxI* generator)
 {
   GFluxI* oldgen = fRealGFluxI;
@@ -155,21 +273,45 @@ GFlavorMixerI* GFluxBlender::AdoptFlavorMixer(GFlavorMixerI* mixer)
 //____________________________________________________________________________
 int GFluxBlender::ChooseFlavor(int pdg_init, double energy, double dist)
 {
-  // choose a new flavor
+  // choose a new flavor, given the full row of transition probabilities
+  fFlavorMixer->ProbabilityRows(1,&pdg_init,&energy,&dist,
+                                fNPDGOut,&fPDGListMixed[0],&fProb[0]);
+  return ChooseFromProb();
+}
+
+//____________________________________________________________________________
+int GFluxBlender::ChooseFlavor(int pdg_init, double energy,
+                               const GEarthPath* path)
+{
+  // as above, for a neutrino crossing the given matter
+  fFlavorMixer->ProbabilityRowsInMatter(1,&pdg_init,&energy,&path,
+                                        fNPDGOut,&fPDGListMixed[0],&fProb[0]);
+  return ChooseFromProb();
+}
+
+//____________________________________________________________________________
+const GEarthPath* GFluxBlender::FindPath(const TLorentzVector & p4) const
+{
+  // the neutrino arrives from the zenith angle of -p
+  double pmag = p4.Vect().Mag();
+  double cosz = ( pmag > 0. ) ? - p4.Vect().Dot(fUpDir) / pmag : 1.;
+  return &(fMatterProfile->Path(cosz));
+}
+
+//____________________________________________________________________________
+int GFluxBlender::ChooseFromProb(void)
+{
   bool   isset = false;
   int    pdg_out = 0;
   double sumprob = 0;
 
   fRndm = RandomGen::Instance()->RndFlux().Rndm();
   for (size_t indx = 0; indx < fNPDGOut; ++indx ) {
-    int pdg_test = fPDGListMixed[indx];
-    double prob = fFlavorMixer->Probability(pdg_init,pdg_test,energy,dist);
-    fProb[indx] = prob;
     sumprob += fProb[indx];
     fSumProb[indx] = sumprob;
     if ( ! isset && fRndm < sumprob ) {
       isset   = true;
-      pdg_out = pdg_test;
+      pdg_out = fPDGListMixed[indx];
     }
   }
 
@@ -200,6 +342,13 @@ void GFluxBlender::PrintConfig(void)
   }
   LOG_BEGIN("FluxBlender", pINFO)
     << "   BaselineDist " << fBaselineDist << LOG_END;
+  if ( fMatterProfile ) {
+    LOG_BEGIN("FluxBlender", pINFO)
+      << "   Earth matter profile: " << fMatterProfile->NCosZBins()
+      << " cos(zenith) bins, detector depth " << fMatterProfile->Depth()
+      << " m, up direction (" << fUpDir.X() << "," << fUpDir.Y()
+      << "," << fUpDir.Z() << ")" << LOG_END;
+  }
   LOG_BEGIN("FluxBlender", pINFO)
     << "PDG List from Generator" << fPDGListGenerator << LOG_END;
   LOG_BEGIN("FluxBlender", pINFO)
@@ -38,6 +38,9 @@
 #define GENIE_FLUX_GFLUXBLENDER_H
 
 #include <vector>
+#include <map>
+#include <TLorentzVector.h>
+#include <TVector3.h>
 #include "Framework/EventGen/GFluxI.h"
 #include "Framework/ParticleData/PDGCodeList.h"
 
@@ -48,6 +51,8 @@ namespace flux {
   class GFlavorMixerI;
   class GNuMIFlux;
   class GSimpleNtpFlux;
+  class GEarthMatterProfile;
+  struct GEarthPath;
 
   class GFluxBlender : public GFluxI {
 
@@ -66,13 +71,14 @@ namespace flux {
     double                 MaxEnergy     (void) { return fRealGFluxI->MaxEnergy(); } ///< declare the max flux neutrino energy that can be generated (for init. purposes)
     bool                   GenerateNext  (void); ///< generate the next flux neutrino (return false in err)
     int                    PdgCode       (void) { return fPdgCMixed; } ///< returns the flux neutrino pdg code
-    double                 Weight        (void) { return fRealGFluxI->Weight(); } ///< returns the flux neutrino weight (if any)
-    const TLorentzVector & Momentum      (void) { return fRealGFluxI->Momentum(); } ///< returns the flux neutrino 4-momentum
-    const TLorentzVector & Position      (void) { return fRealGFluxI->Position(); } ///< returns the flux neutrino 4-position (note: expect SI rather than physical units)
-    bool                   End           (void) { return fRealGFluxI->End(); }  ///< true if no more flux nu's can be thrown (eg reaching end of beam sim ntuples)
+    double                 Weight        (void) { return UseBlock() ? fWeight : fRealGFluxI->Weight(); } ///< returns the flux neutrino weight (if any)
+    const TLorentzVector & Momentum      (void) { return UseBlock() ? fP4 : fRealGFluxI->Momentum(); } ///< returns the flux neutrino 4-momentum
+    const TLorentzVector & Position      (void) { return UseBlock() ? fX4 : fRealGFluxI->Position(); } ///< returns the flux neutrino 4-position (note: expect SI rather than physical units)
+    bool                   End           (void);  ///< true if no more flux nu's can be thrown (eg reaching end of beam sim ntuples)
     long int               Index            (void);
     void                   Clear            (Option_t * opt);
     void                   GenerateWeighted (bool gen_weighted);
+    void                   SetEnergyWindow  (int pdg, double emin, double emax);
 
     //
     // Additions to the GFluxI interface:
@@ -88,6 +94,29 @@ namespace flux {
     //
     void            SetBaselineDist  (double dist) { fBaselineDist = dist; }
     double          GetBaselineDist  (void) { return fBaselineDist; }
+    //
+    // Draw blocks of n flux neutrinos from the flux generator ahead of use,
+    // so the flavor mixer evaluates all their transition probabilities in
+    // one GFlavorMixerI::ProbabilityRows() call (default n=1: no block).
+    // With n>1 only the GFluxI state (pdg, weight, 4-momentum, 4-position,
+    // index, distance) is kept per neutrino: generator specific accessors
+    // (e.g. pass-through info) then refer to the last neutrino of the block,
+    // and the generator's own exposure counts neutrinos of the whole block.
+    //
+    void            SetBlockSize     (int n) { fBlockSize = (n > 1) ? n : 1; }
+    int             GetBlockSize     (void) { return fBlockSize; }
+    //
+    // For neutrinos crossing the Earth (atmospheric, astrophysical fluxes)
+    // take the travel distance and the matter crossed from a zenith-binned
+    // GEarthMatterProfile (shared, not adopted), and evaluate transition
+    // probabilities with GFlavorMixerI::ProbabilityRowsInMatter().
+    // The zenith angle is the one of the neutrino arrival direction with
+    // respect to the local vertical of the flux frame (default: +z).
+    //
+    void            SetMatterProfile (const GEarthMatterProfile* profile) { fMatterProfile = profile; }
+    const GEarthMatterProfile* GetMatterProfile (void) { return fMatterProfile; }
+    void            SetUpDirection   (const TVector3 & up) { fUpDir = up.Unit(); }
+    const GEarthPath* MatterPath     (void) { return fPath; } ///< matter crossed by the current neutrino (0 if no profile)
 
     //
     // Configuration:
@@ -102,6 +131,11 @@ namespace flux {
 
   private:
     int             ChooseFlavor(int pdg_init, double energy, double dist);
+    int             ChooseFlavor(int pdg_init, double energy, const GEarthPath* path);
+    const GEarthPath* FindPath(const TLorentzVector & p4) const;
+    int             ChooseFromProb(void);
+    bool            FillBlock(void);
+    bool            UseBlock(void) const { return fFlavorMixer && fBlockSize > 1; }
 
     GFluxI*         fRealGFluxI;        ///< actual flux generator
     GNuMIFlux*      fGNuMIFlux;         ///< ref to avoid repeat dynamic_cast
@@ -124,6 +158,30 @@ namespace flux {
     std::vector<double> fSumProb;       ///< cummulative probability
     double              fRndm;          ///< random # used to make choice
 
+    std::map<int,double> fEWinMin;      ///< energy window hint per (mixed) flavor: min
+    std::map<int,double> fEWinMax;      ///< energy window hint per (mixed) flavor: max
+
+    int                 fBlockSize;     ///< # of flux neutrinos drawn per block
+    size_t              fBlockN;        ///< # of neutrinos in the current block
+    size_t              fBlockNext;     ///< next neutrino to take from the block
+    std::vector<int>            fBlkPdg;    ///< block: generated flavor
+    std::vector<double>         fBlkEnergy; ///< block: energy
+    std::vector<double>         fBlkDist;   ///< block: travel distance
+    std::vector<double>         fBlkWeight; ///< block: weight
+    std::vector<long int>       fBlkIndex;  ///< block: generator index
+    std::vector<TLorentzVector> fBlkP4;     ///< block: 4-momentum
+    std::vector<TLorentzVector> fBlkX4;     ///< block: 4-position
+    std::vector<double>         fBlkProb;   ///< block: transition probs [i*fNPDGOut+j]
+    std::vector<const GEarthPath*> fBlkPath; ///< block: matter crossed
+    double              fWeight;        ///< current neutrino's weight (block mode)
+    long int            fIndex;         ///< current neutrino's index (block mode)
+    TLorentzVector      fP4;            ///< current neutrino's 4-momentum (block mode)
+    TLorentzVector      fX4;            ///< current neutrino's 4-position (block mode)
+
+    const GEarthMatterProfile* fMatterProfile; ///< Earth matter profile (not owned)
+    TVector3            fUpDir;         ///< local vertical in the flux frame
+    const GEarthPath*   fPath;          ///< matter crossed by the current neutrino
+
   };
 
 } // namespace flux
@@ -8,6 +8,8 @@
 */
 //____________________________________________________________________________
 
+#include <cstdlib>
+
 #include "Tools/Flux/GFluxFileConfigI.h"
 #include "Framework/Messenger/Messenger.h"
 #include "TMath.h"
@@ -22,6 +24,9 @@ namespace flux {
     , fNCycles(0)
     , fICycle(0)
     , fZ0(-3.4e38)
+    , fIShard(0)
+    , fNShards(1)
+    , fShardFiles(false)
   { ; }
 
   GFluxFileConfigI::~GFluxFileConfigI() { ; }
@@ -103,6 +108,70 @@ namespace flux {
     LOG("Flux", pINFO)
       << "Declared list of neutrino species: " << *fPdgCList;
   }
+  //___________________________________________________________________________
+  void GFluxFileConfigI::SetShard(int ishard, int nshards)
+  {
+    // Split the input flux into nshards disjoint shards, eg. for as many
+    // batch jobs, and use shard ishard only. Whole files are dealt out to
+    // the shards if there are enough of them (so that each job opens only
+    // its own files), otherwise consecutive blocks of entries.
+
+    if ( nshards < 1 || ishard < 0 || ishard >= nshards ) {
+      LOG("Flux", pFATAL)
+        << "Invalid flux shard " << ishard << " of " << nshards;
+      exit(1);
+    }
+    fIShard  = ishard;
+    fNShards = nshards;
+
+    LOG("Flux", pNOTICE)
+      << "Using shard " << fIShard << " of " << fNShards << " of the input flux";
+  }
+  //___________________________________________________________________________
+  bool GFluxFileConfigI::SelectShard(int /*ishard*/, int /*nshards*/)
+  {
+    // Flux drivers able to reposition their reading at run time override it
+
+    return false;
+  }
+  //___________________________________________________________________________
+  void GFluxFileConfigI::ShardFiles(std::set<std::string> & filenames)
+  {
+    fShardFiles = ( fNShards > 1 && filenames.size() >= (size_t) fNShards );
+    if ( ! fShardFiles ) return;
+
+    // consecutive blocks of files, the sizes of which differ by at most one
+    size_t nfiles = filenames.size();
+    size_t first  = nfiles *  fIShard    / fNShards;
+    size_t last   = nfiles * (fIShard+1) / fNShards;
+
+    std::set<std::string> shard;
+    std::set<std::string>::const_iterator fitr = filenames.begin();
+    for ( size_t i = 0; fitr != filenames.end(); ++fitr, ++i ) {
+      if ( i >= first && i < last ) shard.insert(*fitr);
+    }
+    filenames.swap(shard);
+
+    LOG("Flux", pNOTICE)
+      << "Flux shard " << fIShard << " of " << fNShards << ": files "
+      << first << " to " << last-1 << " of " << nfiles;
+  }
+  //___________________________________________________________________________
+  void GFluxFileConfigI::ShardEntries(Long64_t nentries, Long64_t & first,
+                                      Long64_t & last) const
+  {
+    first = 0;
+    last  = nentries;
+    if ( fNShards <= 1 || fShardFiles ) return;
+
+    // consecutive blocks of entries, the sizes of which differ by at most one
+    first = nentries *  fIShard    / fNShards;
+    last  = nentries * (fIShard+1) / fNShards;
+
+    LOG("Flux", pNOTICE)
+      << "Flux shard " << fIShard << " of " << fNShards << ": entries "
+      << first << " to " << last-1 << " of " << nentries;
+  }
 
 } // namespace flux
 } // namespace genie
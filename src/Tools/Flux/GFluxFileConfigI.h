@@ -22,6 +22,8 @@
 #include <vector>
 #include <set>
 
+#include <Rtypes.h>
+
 #include "Framework/ParticleData/PDGCodeList.h"
 class TTree;
 
@@ -91,8 +93,32 @@ namespace flux {
     /// limit cycling through input files
     virtual void         SetNumOfCycles(long int ncycle);
 
+    /// use only a deterministic share (shard ishard of nshards) of the
+    /// input flux: the ishard-th of nshards consecutive blocks of the
+    /// (sorted) input files if there are at least nshards files, of the
+    /// entries of the chained files otherwise; the shard is read from its
+    /// first entry on and is cycled over on its own.
+    /// must be called before LoadBeamSimData()
+    virtual void         SetShard(int ishard, int nshards);
+    /// switch, once the flux got loaded and the event generation driver
+    /// configured, to the ishard-th of nshards consecutive blocks of the
+    /// entries of the loaded files, read once from its first entry on,
+    /// and restart the flux (and POT) accounting; eg. for blocks of the
+    /// flux handed out by a job coordinator at run time.
+    /// returns false if the flux driver can not do so
+    virtual bool         SelectShard(int ishard, int nshards);
+    int                  IShard()  const { return fIShard;  }
+    int                  NShards() const { return fNShards; }
+
   protected:  // visible to derived classes
 
+    /// keep the files of the shard only (if dealing out whole files)
+    void                 ShardFiles(std::set<std::string> & filenames);
+    /// the [first,last) range of the entries of the shard, out of the
+    /// nentries of the files loaded
+    void                 ShardEntries(Long64_t nentries, Long64_t & first,
+                                      Long64_t & last) const;
+
     PDGCodeList * fPdgCList;     ///< list of neutrino pdg-codes to generate
     PDGCodeList * fPdgCListRej;  ///< list of nu pdg-codes seen but rejected
     std::string   fXMLbasename;  ///< XML file that might hold config param_sets
@@ -101,6 +127,9 @@ namespace flux {
                                  ///< default 0 = infinitely
     double        fZ0;           ///< configurable starting z position for
                                  ///< each flux neutrino (in detector coord system)
+    int           fIShard;       ///< shard of the input flux used...
+    int           fNShards;      ///< ...out of so many (1 = all of it)
+    bool          fShardFiles;   ///< were whole files dealt out to the shards?
   };
 
 } // namespace flux
@@ -0,0 +1,300 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+*/
+//____________________________________________________________________________
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+#include <TDirectory.h>
+#include <TFile.h>
+#include <TH1D.h>
+
+#include "Framework/Conventions/Units.h"
+#include "Framework/EventGen/EventGeneratorI.h"
+#include "Framework/EventGen/GEVGDriver.h"
+#include "Framework/EventGen/InteractionList.h"
+#include "Framework/EventGen/XSecAlgorithmI.h"
+#include "Framework/Interaction/InitialState.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/Spline.h"
+#include "Framework/ParticleData/PDGCodeList.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/XSecSplineList.h"
+#include "Tools/Flux/GCylindTH1Flux.h"
+#include "Tools/Flux/GFluxFoldedRates.h"
+
+using std::ofstream;
+using std::ostringstream;
+using std::setprecision;
+
+using namespace genie;
+using namespace genie::flux;
+
+//____________________________________________________________________________
+GFluxFoldedRates::GFluxFoldedRates() :
+fNThreads(1),
+fNSub(10)
+{
+
+}
+//____________________________________________________________________________
+GFluxFoldedRates::~GFluxFoldedRates()
+{
+  map<int, TH1D *>::iterator it = fFlux.begin();
+  for( ; it != fFlux.end(); ++it) delete it->second;
+  fFlux.clear();
+}
+//____________________________________________________________________________
+void GFluxFoldedRates::AddFlux(int nu_pdgc, const TH1D * spectrum)
+{
+  if(!spectrum) return;
+
+  map<int, TH1D *>::iterator it = fFlux.find(nu_pdgc);
+  if(it != fFlux.end()) {
+    LOG("FluxRates", pWARN)
+      << "Replacing the flux spectrum of neutrino: " << nu_pdgc;
+    delete it->second;
+  }
+  TH1D * flux = new TH1D(*spectrum);
+  flux->SetDirectory(0);
+  fFlux[nu_pdgc] = flux;
+}
+//____________________________________________________________________________
+void GFluxFoldedRates::AddFlux(const GCylindTH1Flux & flux)
+{
+  const PDGCodeList & nus = const_cast<GCylindTH1Flux &>(flux).FluxParticles();
+  for(unsigned int i = 0; i < nus.size(); i++) {
+    this->AddFlux(nus[i], flux.EnergySpectrum(nus[i]));
+  }
+}
+//____________________________________________________________________________
+void GFluxFoldedRates::AddTarget(int tgt_pdgc, double ntargets)
+{
+  fTargets[tgt_pdgc] = ntargets;
+}
+//____________________________________________________________________________
+bool GFluxFoldedRates::Compute(void)
+{
+  fChannels.clear();
+  fRates.clear();
+
+  // the channels of each initial state: drivers are configured one at a
+  // time (configuring is not thread-safe), and dropped once their channels
+  // and splines are known
+  map<int, TH1D *>::const_iterator fit = fFlux.begin();
+  for( ; fit != fFlux.end(); ++fit) {
+    map<int, double>::const_iterator tit = fTargets.begin();
+    for( ; tit != fTargets.end(); ++tit) {
+      this->FindChannels(fit->first, fit->second, tit->first, tit->second);
+    }
+  }
+  if(fChannels.empty()) {
+    LOG("FluxRates", pERROR) << "No channel to fold with the flux";
+    return false;
+  }
+
+  LOG("FluxRates", pNOTICE)
+    << "Folding " << fChannels.size() << " channels with the flux, using "
+    << fNThreads << " threads";
+
+  // each channel fills its own entry of fRates: no locking needed
+  std::atomic<unsigned int> next(0);
+  unsigned int nthreads =
+     std::min( (unsigned int) fNThreads, (unsigned int) fChannels.size() );
+  if(nthreads <= 1) {
+    for(unsigned int i = 0; i < fChannels.size(); i++) this->Fold(fChannels[i]);
+  } else {
+    vector<std::thread> threads;
+    for(unsigned int ithread = 0; ithread < nthreads; ithread++) {
+      threads.push_back( std::thread( [this, &next] () {
+        unsigned int i = 0;
+        while( (i = next++) < fChannels.size() ) this->Fold(fChannels[i]);
+      }));
+    }
+    for(unsigned int ithread = 0; ithread < threads.size(); ithread++) {
+      threads[ithread].join();
+    }
+  }
+  return true;
+}
+//____________________________________________________________________________
+void GFluxFoldedRates::FindChannels(
+   int nu_pdgc, const TH1D * flux, int tgt_pdgc, double ntargets)
+{
+  InitialState init_state(tgt_pdgc, nu_pdgc);
+
+  GEVGDriver driver;
+  driver.SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+  driver.Configure(init_state);
+
+  XSecSplineList * xsl = XSecSplineList::Instance();
+
+  const InteractionList * ilist = driver.Interactions();
+  if(!ilist) return;
+
+  InteractionList::const_iterator it = ilist->begin();
+  for( ; it != ilist->end(); ++it) {
+    const Interaction * interaction = *it;
+    const XSecAlgorithmI * xsec_alg =
+       driver.FindGenerator(interaction)->CrossSectionAlg();
+    const Spline * spl = xsl->GetSpline(xsec_alg, interaction);
+    if(!spl) {
+      LOG("FluxRates", pWARN)
+        << "No cross section spline for: " << interaction->AsString()
+        << " - Channel left out";
+      continue;
+    }
+
+    GFluxRate rate;
+    rate.nu       = nu_pdgc;
+    rate.target   = tgt_pdgc;
+    rate.channel  = interaction->AsString();
+    rate.ntargets = ntargets;
+    rate.total    = 0.;
+    rate.xsec     = 0.;
+
+    Channel ch;
+    ch.irate  = fRates.size();
+    ch.flux   = flux;
+    ch.spline = spl;
+
+    fRates.push_back(rate);
+    fChannels.push_back(ch);
+  }
+}
+//____________________________________________________________________________
+void GFluxFoldedRates::Fold(const Channel & ch)
+{
+  GFluxRate & rate = fRates[ch.irate];
+
+  const TH1D * flux = ch.flux;
+  int nb = flux->GetNbinsX();
+  unsigned int n = nb * fNSub;
+
+  // all the energies of the flux, evaluated at once
+  vector<double> E (n);
+  vector<double> xs(n);
+  for(int ib = 0; ib < nb; ib++) {
+    double elow = flux->GetBinLowEdge(ib+1);
+    double de   = flux->GetBinWidth(ib+1) / fNSub;
+    for(int j = 0; j < fNSub; j++) E[ib*fNSub + j] = elow + (j + 0.5) * de;
+  }
+  ch.spline->Evaluate(&E[0], &xs[0], n);
+
+  rate.rate.assign(nb, 0.);
+  double sum_flux = 0.;
+  double sum_rate = 0.;
+  for(int ib = 0; ib < nb; ib++) {
+    double sum_xs = 0.;
+    for(int j = 0; j < fNSub; j++) {
+      double x = xs[ib*fNSub + j];
+      if(x > 0) sum_xs += x;
+    }
+    double phi = flux->GetBinContent(ib+1);
+    double r   = rate.ntargets * phi * (sum_xs / fNSub) / units::cm2;
+    rate.rate[ib] = r;
+    sum_rate += r;
+    sum_flux += phi;
+  }
+  rate.total = sum_rate;
+  rate.xsec  = (sum_flux > 0 && rate.ntargets > 0) ?
+               sum_rate / (sum_flux * rate.ntargets) : 0.;
+}
+//____________________________________________________________________________
+double GFluxFoldedRates::TotalRate(int nu_pdgc, int tgt_pdgc) const
+{
+  double sum = 0.;
+  for(unsigned int i = 0; i < fRates.size(); i++) {
+    const GFluxRate & rate = fRates[i];
+    if(nu_pdgc  != 0 && rate.nu     != nu_pdgc ) continue;
+    if(tgt_pdgc != 0 && rate.target != tgt_pdgc) continue;
+    sum += rate.total;
+  }
+  return sum;
+}
+//____________________________________________________________________________
+bool GFluxFoldedRates::SaveAsText(string filename) const
+{
+  ofstream out(filename.c_str());
+  if(!out.is_open()) {
+    LOG("FluxRates", pERROR) << "Couldn't create file: " << filename;
+    return false;
+  }
+
+  out << "# nu target channel ibin Elow(GeV) Ehigh(GeV) flux rate\n";
+  for(unsigned int i = 0; i < fChannels.size(); i++) {
+    const GFluxRate & rate = fRates[fChannels[i].irate];
+    const TH1D * flux = fChannels[i].flux;
+    for(unsigned int ib = 0; ib < rate.rate.size(); ib++) {
+      double elow = flux->GetBinLowEdge(ib+1);
+      out << rate.nu << " " << rate.target << " " << rate.channel
+          << " " << ib
+          << " " << setprecision(6) << elow
+          << " " << elow + flux->GetBinWidth(ib+1)
+          << " " << setprecision(8) << flux->GetBinContent(ib+1)
+          << " " << rate.rate[ib] << "\n";
+    }
+  }
+
+  out << "# nu target channel ntargets rate xsec(cm^2)\n";
+  for(unsigned int i = 0; i < fRates.size(); i++) {
+    const GFluxRate & rate = fRates[i];
+    out << "# " << rate.nu << " " << rate.target << " " << rate.channel
+        << " " << setprecision(8) << rate.ntargets
+        << " " << rate.total << " " << rate.xsec << "\n";
+  }
+  out.close();
+
+  LOG("FluxRates", pNOTICE) << "Wrote the rate table: " << filename;
+  return true;
+}
+//____________________________________________________________________________
+bool GFluxFoldedRates::SaveAsROOT(string filename) const
+{
+  TDirectory * cwd = gDirectory;
+  TFile file(filename.c_str(), "RECREATE");
+  if(file.IsZombie()) {
+    LOG("FluxRates", pERROR) << "Couldn't create file: " << filename;
+    if(cwd) cwd->cd();
+    return false;
+  }
+
+  for(unsigned int i = 0; i < fChannels.size(); i++) {
+    const GFluxRate & rate = fRates[fChannels[i].irate];
+
+    ostringstream dirname;
+    dirname << "nu_" << rate.nu << "_tgt_" << rate.target;
+    TDirectory * dir = file.GetDirectory(dirname.str().c_str());
+    if(!dir) dir = file.mkdir(dirname.str().c_str());
+    dir->cd();
+
+    ostringstream name;
+    name << "rate_" << i;
+    TH1D * h = new TH1D(*fChannels[i].flux);
+    h->SetNameTitle(name.str().c_str(), rate.channel.c_str());
+    h->Reset();
+    for(unsigned int ib = 0; ib < rate.rate.size(); ib++) {
+      h->SetBinContent(ib+1, rate.rate[ib]);
+    }
+    h->SetDirectory(dir);
+    h->Write();
+    delete h;
+  }
+  file.Close();
+  if(cwd) cwd->cd();
+
+  LOG("FluxRates", pNOTICE) << "Wrote the rate histograms: " << filename;
+  return true;
+}
+//____________________________________________________________________________
@@ -0,0 +1,127 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::flux::GFluxFoldedRates
+
+\brief    Folds neutrino flux spectra with the cross section splines of all
+          the channels simulated for each target, giving the event rate of
+          each (neutrino, target, channel) in each energy bin of the flux,
+          and the flux-averaged cross sections, without generating events.
+
+          The flux spectra are 1-D histograms of the flux integrated over
+          each energy bin (eg. neutrinos / cm^2 / POT per bin), given one by
+          one or taken from a GCylindTH1Flux driver. Each target comes with
+          its number of target nuclei (1: rates per nucleus). The rate of a
+          channel in a bin is then
+
+                 R = N(targets) x flux(bin) x <xsec>(bin)
+
+          in units of the flux normalization x cm^2 (eg. events / POT), where
+          <xsec>(bin) is the mean of the cross section at nsub (default: 10)
+          energies evenly spaced within the bin.
+          The cross sections are read from the splines of the XSecSplineList,
+          to be loaded beforehand (see utils::app_init::XSecTable()): the
+          channels are the ones of a GEVGDriver of each initial state, and
+          channels without a spline are left out (with a warning).
+          The channels are folded with the array version of Spline::Evaluate()
+          at all the energies of a flux at once, spread over the input number
+          of threads.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _G_FLUX_FOLDED_RATES_H_
+#define _G_FLUX_FOLDED_RATES_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+using std::map;
+using std::string;
+using std::vector;
+
+class TH1D;
+
+namespace genie {
+
+class Spline;
+
+namespace flux  {
+
+class GCylindTH1Flux;
+
+//! the folded rate of a (neutrino, target, channel)
+struct GFluxRate {
+  int            nu;        ///< neutrino pdg code
+  int            target;    ///< target pdg code
+  string         channel;   ///< channel (Interaction::AsString())
+  double         ntargets;  ///< number of target nuclei
+  vector<double> rate;      ///< rate in each flux energy bin
+  double         total;     ///< rate over all flux energy bins
+  double         xsec;      ///< flux-averaged cross section (cm^2)
+};
+
+class GFluxFoldedRates {
+
+public:
+  GFluxFoldedRates();
+ ~GFluxFoldedRates();
+
+  //! add the flux spectrum of a neutrino species (the histogram is copied)
+  void AddFlux   (int nu_pdgc, const TH1D * spectrum);
+  //! add the flux spectra of all the neutrino species of a flux driver
+  void AddFlux   (const GCylindTH1Flux & flux);
+  //! add a target with its number of nuclei
+  void AddTarget (int tgt_pdgc, double ntargets = 1.);
+
+  void SetNThreads  (int nthreads) { fNThreads = (nthreads > 1) ? nthreads : 1; }
+  void SetNSubBins  (int nsub)     { fNSub     = (nsub     > 1) ? nsub     : 1; }
+
+  //! find the channels of all (neutrino, target) pairs and fold them with
+  //! the flux; returns false if no channel could be folded
+  bool Compute (void);
+
+  const vector<GFluxRate> & Rates (void) const { return fRates; }
+
+  //! rate summed over the channels of a neutrino and target (0: all)
+  double TotalRate (int nu_pdgc = 0, int tgt_pdgc = 0) const;
+
+  //! write the rate table (one line per channel and energy bin, followed
+  //! by the per-channel totals and flux-averaged cross sections)
+  bool SaveAsText (string filename) const;
+  //! write the rate of each channel vs energy (TH1D), in one directory per
+  //! (neutrino, target)
+  bool SaveAsROOT (string filename) const;
+
+private:
+
+  //! a channel to fold (once found by Compute())
+  struct Channel {
+    unsigned int   irate;     ///< its entry in fRates
+    const TH1D *   flux;      ///< flux spectrum of its neutrino
+    const Spline * spline;    ///< its cross section spline
+  };
+
+  void FindChannels (int nu_pdgc, const TH1D * flux, int tgt_pdgc, double ntargets);
+  void Fold         (const Channel & ch);
+
+  map<int, TH1D *>   fFlux;      ///< neutrino pdg code -> flux spectrum
+  map<int, double>   fTargets;   ///< target pdg code -> number of nuclei
+  int                fNThreads;  ///< threads folding the channels
+  int                fNSub;      ///< energies per flux bin
+  vector<Channel>    fChannels;
+  vector<GFluxRate>  fRates;
+};
+
+} // flux namespace
+} // genie namespace
+
+#endif // _G_FLUX_FOLDED_RATES_H_
@@ -0,0 +1,153 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::flux::GFluxPrefetchRing
+
+\brief    A background reader for the ntuple based flux drivers.
+
+          A reader thread reads consecutive flux ntuple entries (wrapping
+          around at the end of the ntuple) into a ring buffer of ready flux
+          records, which the flux driver's GenerateNext() takes in order.
+          This way basket reading & decompression (possibly from network
+          storage) overlaps with the event generation instead of stalling it.
+
+          The record type must be default constructible and assignable.
+          The reader function fills the record of the input entry on the
+          reader thread, so it must only use objects (eg. a TChain of its
+          own) that are not touched by the driver thread.
+
+          Header only, to be used within the flux driver implementation
+          files (not part of the ROOT dictionary).
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _GFLUX_PREFETCH_RING_H_
+#define _GFLUX_PREFETCH_RING_H_
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+#include <Rtypes.h>
+
+namespace genie {
+namespace flux {
+
+template <class R> class GFluxPrefetchRing {
+
+public:
+  typedef std::function<bool (Long64_t, R &)> Reader_t;
+
+  GFluxPrefetchRing(int depth, Long64_t nentries, Reader_t reader) :
+    fReader    (reader),
+    fNEntries  (nentries),
+    fSlots     (depth > 0 ? depth : 1),
+    fSlotEntry (depth > 0 ? depth : 1, -1),
+    fHead      (0),
+    fCount     (0),
+    fStop      (false),
+    fFailed    (false)
+  {
+  }
+ ~GFluxPrefetchRing() { this->Stop(); }
+
+  int Depth(void) const { return fSlots.size(); }
+
+  //! Wait for the record of the input entry and copy it out.
+  //! The reader starts (or restarts, if the request is out of sequence) at
+  //! the requested entry. Returns false if the reader fails to read it.
+  bool Next(Long64_t ientry, R & rec)
+  {
+    for (int itry = 0; itry < 2; ++itry) {
+      if ( ! fThread.joinable() ) this->Start(ientry);
+
+      std::unique_lock<std::mutex> lock(fMutex);
+      fCond.wait(lock, [this]{ return fCount > 0 || fFailed; });
+      if ( fCount > 0 && fSlotEntry[fHead] == ientry ) {
+        rec = fSlots[fHead];
+        fHead = (fHead + 1) % fSlots.size();
+        fCount--;
+        fCond.notify_all();
+        return true;
+      }
+      lock.unlock();
+      this->Stop();
+    }
+    return false;
+  }
+
+private:
+
+  void Start(Long64_t first)
+  {
+    fHead   = 0;
+    fCount  = 0;
+    fStop   = false;
+    fFailed = false;
+    fThread = std::thread(&GFluxPrefetchRing::Run, this, first);
+  }
+
+  void Stop(void)
+  {
+    {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fStop = true;
+    }
+    fCond.notify_all();
+    if ( fThread.joinable() ) fThread.join();
+  }
+
+  void Run(Long64_t first)
+  {
+    R rec;
+    Long64_t ientry = first;
+    while ( true ) {
+      // read outside the lock, so the driver can take ready records meanwhile
+      bool isok = fReader(ientry, rec);
+
+      std::unique_lock<std::mutex> lock(fMutex);
+      fCond.wait(lock, [this]{ return fStop || fCount < fSlots.size(); });
+      if ( fStop ) return;
+      if ( ! isok ) {
+        fFailed = true;
+        fCond.notify_all();
+        return;
+      }
+      unsigned int islot = (fHead + fCount) % fSlots.size();
+      fSlots[islot]     = rec;
+      fSlotEntry[islot] = ientry;
+      fCount++;
+      fCond.notify_all();
+      lock.unlock();
+
+      if ( ++ientry >= fNEntries ) ientry = 0;
+    }
+  }
+
+  Reader_t                fReader;     ///< fills the record of an entry
+  Long64_t                fNEntries;   ///< number of flux ntuple entries
+  std::vector<R>          fSlots;      ///< ring buffer of ready records
+  std::vector<Long64_t>   fSlotEntry;  ///< ntuple entry of each slot
+  unsigned int            fHead;       ///< next slot to be taken
+  unsigned int            fCount;      ///< number of ready records
+  bool                    fStop;       ///< reader asked to stop
+  bool                    fFailed;     ///< reader failed to read an entry
+  std::thread             fThread;     ///< reader thread
+  std::mutex              fMutex;
+  std::condition_variable fCond;
+};
+
+} // flux namespace
+} // genie namespace
+
+#endif // _GFLUX_PREFETCH_RING_H_
@@ -9,6 +9,8 @@
 //____________________________________________________________________________
 
 #include <cstdlib>
+#include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <cassert>
 
@@ -39,6 +41,23 @@ using std::endl;
 using namespace genie;
 using namespace genie::flux;
 
+namespace {
+  // detector location entry index side file: header followed by the entries
+  const char   kLocIndexMagic[8] = { 'G','J','P','L','O','C','I','X' };
+  const UInt_t kLocIndexVersion  = 1;
+
+  struct LocIndexHeader_t {
+    char     magic[8];
+    UInt_t   version;
+    Int_t    detlocid;   // detector location id
+    Long64_t nentries;   // flux ntuple entries
+    Long64_t nloc;       // indexed entries (0 for far detector locations)
+    Long64_t nnu1c;      // neutrinos at the detector location / cycle
+    Double_t maxwgt;     // max flux weight
+    Double_t sumwgt1c;   // sum of weights at the detector location / cycle
+  };
+}
+
 ClassImp(GJPARCNuFluxPassThroughInfo)
 
 //____________________________________________________________________________
@@ -114,8 +133,9 @@ bool GJPARCNuFlux::GenerateNext_weighted(void)
   }
 
   // Read next flux ntuple entry. Use fEntriesThisCycle to keep track of when
-  // in new cycle as fIEntry can now have an offset
-  if(fEntriesThisCycle >= fNEntries) {
+  // in new cycle as fIEntry can now have an offset. For near detector
+  // locations only the (indexed) entries at the detector location are read
+  if(fEntriesThisCycle >= fNCycleEntries) {
      // Exit if have not found neutrino at specified location for whole cycle
      if(fNDetLocIdFound == 0){
        LOG("Flux", pFATAL)
@@ -142,14 +162,15 @@ bool GJPARCNuFlux::GenerateNext_weighted(void)
   // with the generated event branch- for use further upstream in the t2k
   // analysis chain -eg for beam reweighting etc-)
   bool found_entry;
+  long int ientry = this->CycleEntry(fIEntry);
   if (fNuFluxUsingTree)
-    found_entry = fNuFluxTree->GetEntry(fIEntry) > 0;
+    found_entry = fNuFluxTree->GetEntry(ientry) > 0;
   else
-    found_entry = fNuFluxChain->GetEntry(fIEntry) > 0;
+    found_entry = fNuFluxChain->GetEntry(ientry) > 0;
   assert(found_entry);
   fLoadedNeutrino = true;
   fEntriesThisCycle++;
-  fIEntry = (fIEntry+1) % fNEntries;
+  fIEntry = (fIEntry+1) % fNCycleEntries;
 
   if (fNuFluxUsingTree) {
     if(fNuFluxSumTree) fNuFluxSumTree->GetEntry(0); // get entry 0 as only 1 entry in tree
@@ -334,7 +355,7 @@ double GJPARCNuFlux::POT_1cycle(void)
 // Use the max weight instead, since flux neutrinos get de-weighted
 // before thrown to the event generation driver
 //
-  double pot = fFilePOT / fMaxWeight;
+  double pot = fFileFraction * fCycleFraction * fFilePOT / fMaxWeight;
   return pot;
 }
 //___________________________________________________________________________
@@ -356,7 +377,7 @@ double GJPARCNuFlux::POT_curravg(void)
 //
   double cnt   = (double)fNNeutrinos;
   double cnt1c = (double)fNNeutrinosTot1c;
-  double pot  = (cnt/cnt1c) * this->POT_1cycle();
+  double pot  = (cnt/cnt1c) * fFileFraction * fFilePOT / fMaxWeight;
   return pot;
 }
 //___________________________________________________________________________
@@ -368,7 +389,8 @@ long int GJPARCNuFlux::Index(void)
   if(fLoadedNeutrino){
     // subtract 1 as fIEntry was incremented since call to TTree::GetEntry
     // and deal with special case where fIEntry-1 is last entry in cycle
-    return fIEntry == 0 ? fNEntries - 1 : fIEntry-1;
+    long int ipos = (fIEntry == 0) ? fNCycleEntries - 1 : fIEntry-1;
+    return this->CycleEntry(ipos);
   }
   // return -1 if no neutrino loaded since last call to this->ResetCurrent()
   return -1;
@@ -394,6 +416,7 @@ bool GJPARCNuFlux::LoadBeamSimData(string filename, string detector_location)
   vector<string> filenamev = utils::str::Split(filename,"@");
   string fileroot = "";
   int firstfile = -1, lastfile = -1;
+  fFileFraction = 1.;
 
   if (!fNuFluxUsingTree) {
     if (filenamev.size() != 3) {
@@ -406,6 +429,22 @@ bool GJPARCNuFlux::LoadBeamSimData(string filename, string detector_location)
     fileroot  = filenamev[0];
     firstfile = atoi(filenamev[1].c_str());
     lastfile  = atoi(filenamev[2].c_str());
+
+    // keep the files of the flux shard only, if dealing out whole files
+    // (the POT normalization of the files loaded is assumed to be the
+    // same fraction of the one of the whole series)
+    int nfiles = lastfile - firstfile + 1;
+    if (fNShards > 1 && nfiles >= fNShards) {
+      int first = firstfile + nfiles *  fIShard    / fNShards;
+      int last  = firstfile + nfiles * (fIShard+1) / fNShards - 1;
+      LOG("Flux", pNOTICE)
+        << "Flux shard " << fIShard << " of " << fNShards << ": files "
+        << first << " to " << last << " of the series " << firstfile
+        << " to " << lastfile;
+      fFileFraction = (double) (last - first + 1) / nfiles;
+      firstfile = first;
+      lastfile  = last;
+    }
     LOG("Flux", pNOTICE)
       << "Chaining beam simulation output files with stem: " << fileroot
       << " and run numbers in the range: [" << firstfile << ", " << firstfile << "]";
@@ -679,32 +718,39 @@ bool GJPARCNuFlux::LoadBeamSimData(string filename, string detector_location)
   fICycle = 1;
 
   // sum-up weights & number of neutrinos for the specified location
-  // over a complete cycle. Also record the maximum weight as previous
-  // method using TTree::GetV1() seg faulted for more than ~1.5E6 entries
+  // over a complete cycle, record the maximum weight and index the entries
+  // at the specified location - or read all that from the side file
   fSumWeightTot1c  = 0;
   fNNeutrinosTot1c = 0;
   fNDetLocIdFound = 0;
-  for(int ientry = 0; ientry < fNEntries; ientry++) {
-     if (fNuFluxUsingTree)
-       fNuFluxTree->GetEntry(ientry);
-     else
-       fNuFluxChain->GetEntry(ientry);
-     // check for negative flux weights
-     if(fPassThroughInfo->norm + controls::kASmallNum < 0.0){
-       LOG("Flux", pERROR) << "Negative flux weight! Will set weight to 0.0";
-       fPassThroughInfo->norm  = 0.0;
-     }
-     fNorm = (double) fPassThroughInfo->norm;
-     // update maximum weight
-     fMaxWeight = TMath::Max(fMaxWeight, (double) fPassThroughInfo->norm);
-     // compare detector location (see GenerateNext_weighted() for details)
-     if(fIsNDLoc && fDetLocId!=fPassThroughInfo->idfd) continue;
-     fSumWeightTot1c += fNorm;
-     fNNeutrinosTot1c++;
-     fNDetLocIdFound++;
+  fLocEntries.clear();
+  bool indexed =
+    fLocIndexFile.size() > 0 && this->ReadLocationIndex(fLocIndexFile);
+  if(!indexed) {
+    this->ScanBeamSimData();
+    if(fLocIndexFile.size() > 0) this->WriteLocationIndex(fLocIndexFile);
   }
+  fNCycleEntries = (fIsNDLoc) ? (long int) fLocEntries.size() : fNEntries;
+
+  // loop over a block of the entries only, for a flux shard not made of
+  // whole files
+  fCycleFirst    = 0;
+  fCycleFraction = 1.;
+  if (fNShards > 1 && fFileFraction == 1.) {
+    long int first = (long int) ((long long) fNCycleEntries *  fIShard    / fNShards);
+    long int last  = (long int) ((long long) fNCycleEntries * (fIShard+1) / fNShards);
+    LOG("Flux", pNOTICE)
+      << "Flux shard " << fIShard << " of " << fNShards << ": entries "
+      << first << " to " << last-1 << " of the " << fNCycleEntries
+      << " at the detector location";
+    fCycleFraction = (fNCycleEntries > 0) ?
+       (double) (last - first) / fNCycleEntries : 1.;
+    fCycleFirst    = first;
+    fNCycleEntries = last - first;
+  }
+
   // Exit if have not found neutrino at specified location for whole cycle
-  if(fNDetLocIdFound == 0){
+  if(fNNeutrinosTot1c == 0){
     LOG("Flux", pFATAL)
      << "The input jnubeam flux ntuple contains no entries for detector id "
      << fDetLocId << ". Terminating job!";
@@ -729,6 +775,136 @@ bool GJPARCNuFlux::LoadBeamSimData(string filename, string detector_location)
   return true;
 }
 //___________________________________________________________________________
+void GJPARCNuFlux::ScanBeamSimData(void)
+{
+// Loop over the flux ntuple to sum-up weights & number of neutrinos for the
+// specified location over a complete cycle, to record the maximum weight
+// (as previous method using TTree::GetV1() seg faulted for more than ~1.5E6
+// entries) and, for near detector locations, to index the entries at the
+// specified location. Only the norm & idfd branches are read.
+
+  TTree * tree = (fNuFluxUsingTree) ? fNuFluxTree : fNuFluxChain;
+  tree->SetBranchStatus("*",    0);
+  tree->SetBranchStatus("norm", 1);
+  if(fIsNDLoc) tree->SetBranchStatus("idfd", 1);
+
+  for(Long64_t ientry = 0; ientry < fNEntries; ientry++) {
+     tree->GetEntry(ientry);
+     // check for negative flux weights
+     if(fPassThroughInfo->norm + controls::kASmallNum < 0.0){
+       LOG("Flux", pERROR) << "Negative flux weight! Will set weight to 0.0";
+       fPassThroughInfo->norm  = 0.0;
+     }
+     double norm = (double) fPassThroughInfo->norm;
+     // update maximum weight
+     fMaxWeight = TMath::Max(fMaxWeight, norm);
+     // compare detector location (see GenerateNext_weighted() for details)
+     if(fIsNDLoc && fDetLocId!=fPassThroughInfo->idfd) continue;
+     if(fIsNDLoc) fLocEntries.push_back(ientry);
+     fSumWeightTot1c += norm;
+     fNNeutrinosTot1c++;
+  }
+
+  tree->SetBranchStatus("*", 1);
+  fPassThroughInfo->Reset();
+
+  if(fIsNDLoc) {
+    LOG("Flux", pNOTICE)
+      << "Indexed " << fLocEntries.size() << " of " << fNEntries
+      << " flux ntuple entries at detector location " << fDetLoc;
+  }
+}
+//___________________________________________________________________________
+void GJPARCNuFlux::SetLocationIndexFile(string filename)
+{
+// Multi-detector flux ntuples are looped over via an index of the entries at
+// the specified (near) detector location, built by the flux ntuple scan at
+// LoadBeamSimData(). With a side file, the index (and the scan results) are
+// read from it instead, if it exists and matches the flux ntuple & detector
+// location, or else written to it for later jobs.
+
+  fLocIndexFile = filename;
+}
+//___________________________________________________________________________
+bool GJPARCNuFlux::ReadLocationIndex(string filename)
+{
+  if(gSystem->AccessPathName(filename.c_str())) {
+    LOG("Flux", pNOTICE)
+      << "No detector location index file " << filename << " - will build one";
+    return false;
+  }
+  FILE * fp = fopen(filename.c_str(), "rb");
+  if(!fp) {
+    LOG("Flux", pWARN) << "Can not open " << filename;
+    return false;
+  }
+  LocIndexHeader_t header;
+  bool isok = ( fread(&header, sizeof(LocIndexHeader_t), 1, fp) == 1 &&
+                memcmp(header.magic, kLocIndexMagic, 8) == 0 &&
+                header.version  == kLocIndexVersion &&
+                header.detlocid == fDetLocId &&
+                header.nentries == fNEntries &&
+                header.nloc     <= fNEntries );
+  if(isok) {
+    fLocEntries.resize(header.nloc);
+    if(header.nloc > 0) {
+      isok = ( fread(&fLocEntries[0], sizeof(Long64_t), header.nloc, fp) ==
+               (size_t) header.nloc );
+    }
+  }
+  fclose(fp);
+  if(!isok) {
+    LOG("Flux", pWARN)
+      << "The detector location index file " << filename
+      << " does not match the input flux ntuple & location - will rebuild it";
+    fLocEntries.clear();
+    return false;
+  }
+
+  fMaxWeight       = header.maxwgt;
+  fSumWeightTot1c  = header.sumwgt1c;
+  fNNeutrinosTot1c = header.nnu1c;
+
+  LOG("Flux", pNOTICE)
+    << "Read the index of " << fLocEntries.size() << " of " << fNEntries
+    << " flux ntuple entries at detector location " << fDetLoc
+    << " from " << filename;
+  return true;
+}
+//___________________________________________________________________________
+bool GJPARCNuFlux::WriteLocationIndex(string filename) const
+{
+  LocIndexHeader_t header;
+  memset(&header, 0, sizeof(LocIndexHeader_t));
+  memcpy(header.magic, kLocIndexMagic, 8);
+  header.version  = kLocIndexVersion;
+  header.detlocid = fDetLocId;
+  header.nentries = fNEntries;
+  header.nloc     = fLocEntries.size();
+  header.nnu1c    = fNNeutrinosTot1c;
+  header.maxwgt   = fMaxWeight;
+  header.sumwgt1c = fSumWeightTot1c;
+
+  FILE * fp = fopen(filename.c_str(), "wb");
+  if(!fp) {
+    LOG("Flux", pWARN) << "Can not open " << filename << " for writing";
+    return false;
+  }
+  bool isok = ( fwrite(&header, sizeof(LocIndexHeader_t), 1, fp) == 1 );
+  if(isok && header.nloc > 0) {
+    isok = ( fwrite(&fLocEntries[0], sizeof(Long64_t), header.nloc, fp) ==
+             (size_t) header.nloc );
+  }
+  isok = ( fclose(fp) == 0 ) && isok;
+  if(!isok) {
+    LOG("Flux", pWARN) << "Failed writing " << filename;
+    return false;
+  }
+  LOG("Flux", pNOTICE)
+    << "Wrote the detector location index to " << filename;
+  return true;
+}
+//___________________________________________________________________________
 void GJPARCNuFlux::SetFluxParticles(const PDGCodeList & particles)
 {
   if(!fPdgCList) {
@@ -787,9 +963,27 @@ void GJPARCNuFlux::GenerateWeighted(bool gen_weighted)
   fGenerateWeighted = gen_weighted;
 }
 //___________________________________________________________________________
+void GJPARCNuFlux::SetShard(int ishard, int nshards)
+{
+// Split the input flux into nshards disjoint shards, eg. for as many batch
+// jobs, and use shard ishard only: consecutive blocks of the files of a
+// file series (/dir/root_filename@#@#) if there are at least nshards files
+// (so that each job opens only its own files), otherwise consecutive blocks
+// of the entries at the detector location, cycled over on their own.
+//
+  if(nshards < 1 || ishard < 0 || ishard >= nshards) {
+    LOG("Flux", pFATAL)
+      << "Invalid flux shard " << ishard << " of " << nshards;
+    exit(1);
+  }
+  fIShard  = ishard;
+  fNShards = nshards;
+}
+//___________________________________________________________________________
 void GJPARCNuFlux::RandomOffset()
 {
-// Choose a random number between 0-->fNEntries to set as start point for
+// Choose a random number between 0-->fNCycleEntries (the number of entries at
+// the detector location) to set as start point for
 // looping over flux ntuple. May be necessary when looping over very large
 // flux files as always starting fromthe same point may introduce biases
 // (inversely proportional to number of cycles). This method resets the
@@ -797,7 +991,7 @@ void GJPARCNuFlux::RandomOffset()
 // is made.
 //
   double ran_frac = RandomGen::Instance()->RndFlux().Rndm();
-  long int offset = (long int) floor(ran_frac * fNEntries);
+  long int offset = (long int) floor(ran_frac * fNCycleEntries);
   LOG("Flux", pERROR) << "Setting flux driver to start looping over entries "
                       << "with offset of "<< offset;
   fIEntry = fOffset = offset;
@@ -844,9 +1038,17 @@ void GJPARCNuFlux::Initialize(void)
   fIsNDLoc         = false;
 
   fNEntries        = 0;
+  fNCycleEntries   = 0;
+  fLocEntries.clear();
+  fLocIndexFile    = "";
   fIEntry          = 0;
   fEntriesThisCycle= 0;
   fOffset          = 0;
+  fCycleFirst      = 0;
+  fIShard          = 0;
+  fNShards         = 1;
+  fFileFraction    = 1.;
+  fCycleFraction   = 1.;
   fNorm            = 0.;
   fMaxWeight       = 0;
   fFilePOT         = 0;
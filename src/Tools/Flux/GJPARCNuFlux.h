@@ -23,6 +23,7 @@
 #define _GJPARC_NEUTRINO_FLUX_H_
 
 #include <string>
+#include <vector>
 #include <iostream>
 
 #include <TLorentzVector.h>
@@ -63,7 +64,7 @@ public :
   double                 Weight        (void) { return  fNorm / fMaxWeight;    }
   const TLorentzVector & Momentum      (void) { return  fgP4;                  }
   const TLorentzVector & Position      (void) { return  fgX4;                  }
-  bool                   End           (void) { return  fEntriesThisCycle >= fNEntries
+  bool                   End           (void) { return  fEntriesThisCycle >= fNCycleEntries
                                                      && fICycle == fNCycles && fNCycles > 0;   }
   long int               Index         (void);
   void                   Clear            (Option_t * opt);
@@ -82,6 +83,8 @@ public :
   void SetNumOfCycles   (int n);                               ///< set how many times to cycle through the ntuple (default: 1 / n=0 means 'infinite')
   void DisableOffset    (void){fUseRandomOffset = false;}      ///< switch off random offset, must be called before LoadBeamSimData to have any effect
   void RandomOffset     (void);                                ///< choose a random offset as starting entry in flux ntuple
+  void SetLocationIndexFile (string filename);                 ///< read (or else write) the detector location entry index from (to) a side file, must be called before LoadBeamSimData
+  void SetShard         (int ishard, int nshards);             ///< use only shard ishard of nshards of the flux files (of a file series, if enough) or entries, must be called before LoadBeamSimData
 
   double   POT_1cycle     (void);                              ///< flux POT per cycle
   double   POT_curravg    (void);                              ///< current average POT
@@ -101,6 +104,10 @@ private:
   void CleanUp               (void);
   void ResetCurrent          (void);
   int  DLocName2Id           (string name);
+  void ScanBeamSimData       (void);
+  bool ReadLocationIndex     (string filename);
+  bool WriteLocationIndex    (string filename) const;
+  long int CycleEntry        (long int ipos) const { ipos += fCycleFirst; return (fIsNDLoc) ? (long int) fLocEntries[ipos] : ipos; }
 
   // Private data members
   //
@@ -123,9 +130,17 @@ private:
   bool      fIsFDLoc;          ///< input location is a 'far'  detector location?
   bool      fIsNDLoc;          ///< input location is a 'near' detector location?
   long int  fNEntries;         ///< number of flux ntuple entries
+  long int  fNCycleEntries;    ///< number of flux ntuple entries looped over per cycle (the ones at the detector location)
+  std::vector<Long64_t> fLocEntries; ///< flux ntuple entries at the detector location (near detector locations only)
+  string    fLocIndexFile;     ///< side file for the detector location entry index (if any)
   long int  fIEntry;           ///< current flux ntuple entry
   long int  fEntriesThisCycle; ///< keep track of number of entries used so far for this cycle
-  long int  fOffset;           ///< start looping at entry fOffset
+  long int  fOffset;           ///< start looping at entry fOffset (of the entries at the detector location)
+  long int  fCycleFirst;       ///< first of the entries at the detector location looped over (of the flux shard)
+  int       fIShard;           ///< shard of the input flux used...
+  int       fNShards;          ///< ...out of so many (1 = all of it)
+  double    fFileFraction;     ///< fraction of the input files (file series) loaded (of the flux shard)
+  double    fCycleFraction;    ///< fraction of the entries at the detector location looped over (of the flux shard)
   double    fNorm;             ///< current flux ntuple normalisation
   double    fMaxWeight;        ///< max flux  neutrino weight in input file for the specified detector location
   double    fFilePOT;          ///< file POT normalization, typically 1E+21
@@ -17,6 +17,8 @@
 #include <sstream>
 #include <cassert>
 #include <climits>
+#include <thread>
+#include <functional>
 
 #include "libxml/xmlmemory.h"
 #include "libxml/parser.h"
@@ -29,11 +31,14 @@
 #include <TChainElement.h>
 #include <TSystem.h>
 #include <TStopwatch.h>
+#include <TROOT.h>
+#include <TRandom3.h>
 
 #include "Framework/Conventions/Units.h"
 #include "Framework/Conventions/GBuild.h"
 
 #include "Tools/Flux/GNuMIFlux.h"
+#include "Tools/Flux/GFluxPrefetchRing.h"
 #include "Tools/Flux/GNuMINtuple/g3numi.h"
 #include "Tools/Flux/GNuMINtuple/g3numi.C"
 #include "Tools/Flux/GNuMINtuple/g4numi.h"
@@ -67,6 +72,40 @@ static genie::flux::xypartials gpartials;  // global one used by CalcEnuWgt()
 using namespace genie;
 using namespace genie::flux;
 
+// readers of GNuMIFlux for use on other threads: a TChain of their own on
+// the same files (trees are not thread-safe) and, for the background reader,
+// a ring of ready entry copies
+namespace genie {
+  namespace flux  {
+    class GNuMIFluxNtpReader {
+    public:
+       GNuMIFluxNtpReader(const std::vector<std::string> & files,
+                          string treename, string gen);
+      ~GNuMIFluxNtpReader();
+       bool Read(Long64_t ientry, GNuMIFluxPassThroughInfo & rec);
+
+    private:
+       TChain*   fChain;   ///< reader's own chain
+       g3numi*   fG3NuMI;  ///< reader's g3numi ntuple
+       g4numi*   fG4NuMI;  ///< reader's g4numi ntuple
+       flugg*    fFlugg;   ///< reader's flugg ntuple
+    };
+
+    class GNuMIFluxPrefetch {
+    public:
+       GNuMIFluxPrefetch(const std::vector<std::string> & files,
+                         string treename, string gen,
+                         Long64_t nentries, int depth);
+      ~GNuMIFluxPrefetch();
+       bool GetEntry(Long64_t ientry, GNuMIFluxPassThroughInfo * entry);
+
+    private:
+       GNuMIFluxNtpReader fReader;  ///< reader used by the thread
+       GFluxPrefetchRing<GNuMIFluxPassThroughInfo> * fRing; ///< ring & thread
+    };
+  }
+}
+
 // declaration of helper class
 namespace genie {
   namespace flux  {
@@ -226,12 +265,12 @@ bool GNuMIFlux::GenerateNext_weighted(void)
     this->ResetCurrent();
     // Move on, read next flux ntuple entry
     fIEntry++;
-    if ( fIEntry >= fNEntries ) {
+    if ( fIEntry >= fLastEntry ) {
       // Ran out of entries @ the current cycle of this flux file
       // Check whether more (or infinite) number of cycles is requested
       if ( fICycle < fNCycles || fNCycles == 0 ) {
         fICycle++;
-        fIEntry=0;
+        fIEntry=fFirstEntry;
       } else {
         LOG("Flux", pWARN)
           << "No more entries in input flux neutrino ntuple, cycle "
@@ -242,7 +281,9 @@ bool GNuMIFlux::GenerateNext_weighted(void)
       }
     }
 
-    if ( fG3NuMI ) {
+    if ( fPrefetch && fPrefetch->GetEntry(fIEntry,fCurEntry) ) {
+      // copied from the background reader's ring buffer
+    } else if ( fG3NuMI ) {
       fG3NuMI->GetEntry(fIEntry);
       fCurEntry->MakeCopy(fG3NuMI);
     } else if ( fG4NuMI ) {
@@ -315,26 +356,11 @@ bool GNuMIFlux::GenerateNext_weighted(void)
   // Make sure that the appropriate maximum flux neutrino energy was set at
   // initialization via GNuMIFlux::SetMaxEnergy(double Ev)
 
-  fCurEntry->fgX4 = fFluxWindowBase;
-
-  double Ev = 0;
-  double& wgt_xy = fCurEntry->fgXYWgt;
-  switch ( fUseFluxAtDetCenter ) {
-  case -1:  // near detector
-    wgt_xy   = fCurEntry->nwtnear;
-    Ev       = fCurEntry->nenergyn;
-    break;
-  case +1:  // far detector
-    wgt_xy   = fCurEntry->nwtfar;
-    Ev       = fCurEntry->nenergyf;
-    break;
-  default:  // recalculate on x-y window
-    RandomGen * rnd = RandomGen::Instance();
-    fCurEntry->fgX4 += ( rnd->RndFlux().Rndm()*fFluxWindowDir1 +
-                         rnd->RndFlux().Rndm()*fFluxWindowDir2   );
-    fCurEntry->CalcEnuWgt(fCurEntry->fgX4,Ev,wgt_xy);
-    break;
-  }
+  // Set the current flux neutrino 4-position & 4-momentum and its weight
+  // this is in *beam* coordinates
+  RandomGen * rnd = RandomGen::Instance();
+  fWeight = this->EntryWeight(*fCurEntry,rnd->RndFlux());
+  double Ev = fCurEntry->fgP4.Energy();
 
   if (Ev > fMaxEv) {
      LOG("Flux", pWARN)
@@ -342,25 +368,9 @@ bool GNuMIFlux::GenerateNext_weighted(void)
           << "\nEv = " << Ev << "(> Ev{max} = " << fMaxEv << ")";
   }
 
-  // Set the current flux neutrino 4-momentum
-  // this is in *beam* coordinates
   fgX4dkvtx = TLorentzVector( fCurEntry->vx,
                               fCurEntry->vy,
                               fCurEntry->vz, 0.);
-  // don't use TLorentzVector here for Mag() due to - on metric
-  // normalize direction to 1.0
-  TVector3 dirNu = (fCurEntry->fgX4.Vect() - fgX4dkvtx.Vect()).Unit();
-  fCurEntry->fgP4.SetPxPyPzE( Ev*dirNu.X(),
-                              Ev*dirNu.Y(),
-                              Ev*dirNu.Z(), Ev);
-
-  // calculate the weight, potentially includes effect from tilted window
-  // must be done *after* neutrino direction is determined
-  fWeight = fCurEntry->nimpwt * fCurEntry->fgXYWgt;  // full weight
-  if ( fApplyTiltWeight ) {
-    double tiltwgt = dirNu.Dot( FluxWindowNormal() );
-    fWeight *= TMath::Abs( tiltwgt );
-  }
 
   // update sume of weights
   fSumWeight += this->Weight();
@@ -392,6 +402,52 @@ bool GNuMIFlux::GenerateNext_weighted(void)
   return true;
 }
 //___________________________________________________________________________
+double GNuMIFlux::EntryWeight(
+  GNuMIFluxPassThroughInfo & entry, TRandom & rnd) const
+{
+// Set the neutrino 4-position (on the flux window, or at the detector
+// center) & 4-momentum, in *beam* coordinates, of the input (pdg converted)
+// entry and return its full weight.
+// Only reads the driver configuration, so it may run on the scan threads.
+
+  entry.fgX4 = fFluxWindowBase;
+
+  double Ev = 0;
+  double& wgt_xy = entry.fgXYWgt;
+  switch ( fUseFluxAtDetCenter ) {
+  case -1:  // near detector
+    wgt_xy   = entry.nwtnear;
+    Ev       = entry.nenergyn;
+    break;
+  case +1:  // far detector
+    wgt_xy   = entry.nwtfar;
+    Ev       = entry.nenergyf;
+    break;
+  default:  // recalculate on x-y window
+    entry.fgX4 += ( rnd.Rndm()*fFluxWindowDir1 +
+                    rnd.Rndm()*fFluxWindowDir2   );
+    entry.CalcEnuWgt(entry.fgX4,Ev,wgt_xy);
+    break;
+  }
+
+  // don't use TLorentzVector here for Mag() due to - on metric
+  // normalize direction to 1.0
+  TVector3 dkvtx(entry.vx, entry.vy, entry.vz);
+  TVector3 dirNu = (entry.fgX4.Vect() - dkvtx).Unit();
+  entry.fgP4.SetPxPyPzE( Ev*dirNu.X(),
+                         Ev*dirNu.Y(),
+                         Ev*dirNu.Z(), Ev);
+
+  // calculate the weight, potentially includes effect from tilted window
+  // must be done *after* neutrino direction is determined
+  double wgt = entry.nimpwt * entry.fgXYWgt;  // full weight
+  if ( fApplyTiltWeight ) {
+    double tiltwgt = dirNu.Dot( fWindowNormal );
+    wgt *= TMath::Abs( tiltwgt );
+  }
+  return wgt;
+}
+//___________________________________________________________________________
 double GNuMIFlux::GetDecayDist() const
 {
   // return distance (user units) between dk point and start position
@@ -540,6 +596,9 @@ void GNuMIFlux::LoadBeamSimData(const std::vector<std::string>& patterns,
     } // legal directory
   } // loop over patterns
 
+  // keep the files of the flux shard only, if dealing out whole files
+  this->ShardFiles(fnames);
+
   size_t indx = 0;
   std::set<string>::const_iterator sitr = fnames.begin();
   for ( ; sitr != fnames.end(); ++sitr, ++indx ) {
@@ -642,13 +701,19 @@ void GNuMIFlux::LoadBeamSimData(const std::vector<std::string>& patterns,
      this->ScanForMaxWeight();
   }
 
+  // the entries cycled over: those of the flux shard, if dealing out
+  // entries, or all of them
+  this->ShardEntries(fNEntries, fFirstEntry, fLastEntry);
+
   // current ntuple cycle # (flux ntuples may be recycled)
   fICycle =  0;
   // pick a starting entry index [0:fNEntries-1]
+  // (a shard starts from its first entry)
   // pretend we just used up the the previous one
   RandomGen* rnd = RandomGen::Instance();
   fIUse   =  9999999;
   fIEntry = rnd->RndFlux().Integer(fNEntries) - 1;
+  if ( fNShards > 1 ) fIEntry = fFirstEntry - 1;
 
   // don't count things we used to estimate max weight
   fSumWeight  = 0;
@@ -658,6 +723,37 @@ void GNuMIFlux::LoadBeamSimData(const std::vector<std::string>& patterns,
   LOG("Flux",pNOTICE) << "about to CalcEffPOTsPerNu";
   this->CalcEffPOTsPerNu();
 
+  // (re)start the background reader, if requested, on the new files
+  this->StartPrefetch();
+}
+//___________________________________________________________________________
+bool GNuMIFlux::SelectShard(int ishard, int nshards)
+{
+  // Read the ishard-th of nshards consecutive blocks of the loaded entries,
+  // once, and restart the flux accounting (see GFluxFileConfigI).
+  // Whole files dealt out to load time shards can not be re-dealt.
+
+  if ( ! fNuFluxTree || fShardFiles ) return false;
+  if ( nshards < 1 || ishard < 0 || ishard >= nshards ) return false;
+
+  fIShard  = ishard;
+  fNShards = nshards;
+  this->ShardEntries(fNEntries, fFirstEntry, fLastEntry);
+
+  // read the block once: its first cycle is the last one
+  fNCycles = 1;
+  fICycle  = 1;
+  fIUse    = 9999999;
+  fIEntry  = fFirstEntry - 1;
+  fEnd     = false;
+
+  fSumWeight  = 0;
+  fNNeutrinos = 0;
+  fAccumPOTs  = 0;
+
+  // restart the background reader, if any, at the block
+  this->StartPrefetch();
+  return true;
 }
 //___________________________________________________________________________
 void GNuMIFlux::GetBranchInfo(std::vector<std::string>& branchNames,
@@ -685,6 +781,10 @@ void GNuMIFlux::ScanForMaxWeight(void)
      return;
   }
 
+  // skip the scan if an identical one is already recorded in the cache file
+  string cachekey = ( fMaxWgtCacheFile != "" ) ? this->MaxWgtCacheKey() : "";
+  if ( cachekey != "" && this->ReadMaxWgtCache(cachekey) ) return;
+
   // scan for the maximum weight
   int ipos_estimator = fUseFluxAtDetCenter;
   if ( ipos_estimator == 0 ) {
@@ -725,21 +825,45 @@ void GNuMIFlux::ScanForMaxWeight(void)
   }
   // the above works only for things close to the MINOS stored weight
   // values.  otherwise we need to work out our own estimate.
+  // split the scan of fMaxWgtEntries rays (consecutive entries, each used
+  // fNUse times) over threads with readers & random generators of their own
+  int nthreads = fMaxWgtScanThreads;
+  if ( nthreads <= 0 ) nthreads = std::thread::hardware_concurrency();
+  if ( nthreads <= 0 ) nthreads = 1;
+  Long64_t nscan = (fMaxWgtEntries + fNUse - 1) / fNUse;
+  if ( nscan < nthreads ) nthreads = TMath::Max(1LL, nscan);
+
+  std::vector<std::string> files = this->GetFileList();
+  std::vector<double> thrwgtmx(nthreads, 0.), threnumx(nthreads, 0.);
+  std::vector<std::thread> threads;
+
   double wgtgenmx = 0, enumx = 0;
   TStopwatch t;
   t.Start();
-  for (int itry=0; itry < fMaxWgtEntries; ++itry) {
-    this->GenerateNext_weighted();
-    double wgt = this->Weight();
-    if ( wgt > wgtgenmx ) wgtgenmx = wgt;
-    double enu = fCurEntry->fgP4.Energy();
-    if ( enu > enumx ) enumx = enu;
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,6,0)
+  ROOT::EnableThreadSafety();
+#endif
+  RandomGen * rnd = RandomGen::Instance();
+  for (int ith = 0; ith < nthreads; ++ith) {
+    Long64_t first = ( ith    * nscan) / nthreads;
+    Long64_t last  = ((ith+1) * nscan) / nthreads;
+    unsigned int seed = rnd->RndFlux().Integer(kMaxInt) + 1;
+    threads.push_back(std::thread(&GNuMIFlux::ScanMaxWeightRange, this,
+                                  std::cref(files), first, last, seed,
+                                  std::ref(thrwgtmx[ith]),
+                                  std::ref(threnumx[ith])));
+  }
+  for (int ith = 0; ith < nthreads; ++ith) {
+    threads[ith].join();
+    wgtgenmx = TMath::Max(wgtgenmx, thrwgtmx[ith]);
+    enumx    = TMath::Max(enumx,    threnumx[ith]);
   }
   t.Stop();
   t.Print("u");
   LOG("Flux", pNOTICE) << "Maximum flux weight for spin = "
                        << wgtgenmx << ", energy = " << enumx
-                       << " (" << fMaxWgtEntries << ")";
+                       << " (" << fMaxWgtEntries << " on "
+                       << nthreads << " threads)";
 
   if (wgtgenmx > fMaxWeight ) fMaxWeight = wgtgenmx;
   // apply a fudge factor to estimated weight
@@ -755,6 +879,116 @@ void GNuMIFlux::ScanForMaxWeight(void)
   LOG("Flux", pNOTICE) << "Maximum flux weight = " << fMaxWeight
                        << ", energy = " << fMaxEv;
 
+  if ( cachekey != "" ) this->WriteMaxWgtCache(cachekey);
+}
+//___________________________________________________________________________
+void GNuMIFlux::ScanMaxWeightRange(
+  const std::vector<std::string> & files,
+  Long64_t first, Long64_t last, unsigned int seed,
+  double & wgtmx, double & enumx) const
+{
+// Find the max weight & energy of rays thrown on the entries [first,last)
+// (modulo the # of entries) of the input files. Runs on a scan thread.
+
+  GNuMIFluxNtpReader reader(files, fNuFluxTreeName, fNuFluxGen);
+  TRandom3 rnd(seed);
+  GNuMIFluxPassThroughInfo entry;
+
+  wgtmx = 0;
+  enumx = 0;
+  for (Long64_t i = first; i < last; ++i) {
+    entry.ResetCopy();
+    entry.ResetCurrent();
+    if ( ! reader.Read(i % fNEntries, entry) ) break;
+    entry.pcodes = 0;  // fetched entry has geant codes
+    entry.units  = 0;  // fetched entry has original units
+    entry.ConvertPartCodes();
+    entry.fgPdgC = entry.ntype;
+    if ( ! fPdgCList->ExistsInPDGCodeList(entry.fgPdgC) ) continue;
+
+    for (long int iuse = 0; iuse < fNUse; ++iuse) {
+      double wgt = this->EntryWeight(entry, rnd);
+      wgtmx = TMath::Max(wgtmx, wgt);
+      enumx = TMath::Max(enumx, entry.fgP4.Energy());
+    }
+  }
+}
+//___________________________________________________________________________
+string GNuMIFlux::MaxWgtCacheKey(void)
+{
+// Key of the max weight scan in the cache file: a hash of all it depends on
+// (the file set -names & # of entries-, flux window, beam rotation, max
+// energy and scan settings), so that identical jobs share the result
+
+  std::ostringstream key;
+  key << std::setprecision(17);
+
+  std::vector<std::string> files = this->GetFileList();
+  for (size_t i = 0; i < files.size(); ++i) {
+    // not the full path: jobs may use local copies of the files
+    key << gSystem->BaseName(files[i].c_str()) << ";";
+  }
+  key << fNuFluxTreeName << ";" << fNuFluxGen << ";" << fNEntries << ";";
+  for (int i = 0; i < 4; ++i) {
+    key << fFluxWindowBase[i] << "," << fFluxWindowDir1[i] << ","
+        << fFluxWindowDir2[i] << "," << fBeamZero[i] << ";";
+    for (int j = 0; j < 4; ++j) key << fBeamRot(i,j) << ",";
+  }
+  key << ";" << fMaxEv << ";" << fMaxEFudge << ";" << fMaxWgtFudge << ";"
+      << fMaxWgtEntries << ";" << fNUse << ";" << fUseFluxAtDetCenter << ";"
+      << fApplyTiltWeight << ";";
+  for (size_t i = 0; i < fPdgCList->size(); ++i) key << (*fPdgCList)[i] << ",";
+
+  std::ostringstream hash;
+  hash << std::hex << std::setw(16) << std::setfill('0')
+       << utils::str::Hash(key.str());
+  return hash.str();
+}
+//___________________________________________________________________________
+bool GNuMIFlux::ReadMaxWgtCache(const string & key)
+{
+// Look up the max weight & energy of the input key in the cache file
+
+  std::ifstream cache(fMaxWgtCacheFile.c_str());
+  if ( ! cache.good() ) return false;
+
+  string line;
+  while ( std::getline(cache,line) ) {
+    if ( line.empty() || line[0] == '#' ) continue;
+    std::istringstream fields(line);
+    string linekey;
+    double wgtmx = 0, enumx = 0;
+    if ( ! (fields >> linekey >> wgtmx >> enumx) ) continue;
+    if ( linekey != key || wgtmx <= 0 ) continue;
+
+    fMaxWeight = wgtmx;
+    fMaxEv     = enumx;
+    LOG("Flux", pNOTICE) << "Maximum flux weight = " << fMaxWeight
+                         << ", energy = " << fMaxEv
+                         << " (from " << fMaxWgtCacheFile
+                         << ", key " << key << ")";
+    return true;
+  }
+  return false;
+}
+//___________________________________________________________________________
+void GNuMIFlux::WriteMaxWgtCache(const string & key) const
+{
+// Append the max weight & energy of the input key to the cache file
+// (as a single write, as concurrent jobs may be appending too)
+
+  std::ostringstream line;
+  line << std::setprecision(17)
+       << key << " " << fMaxWeight << " " << fMaxEv << "\n";
+
+  std::ofstream cache(fMaxWgtCacheFile.c_str(), std::ios::app);
+  if ( ! cache.good() ) {
+    LOG("Flux", pWARN)
+      << "Could not write to the max weight cache file " << fMaxWgtCacheFile;
+    return;
+  }
+  cache << line.str();
+  cache.flush();
 }
 //___________________________________________________________________________
 void GNuMIFlux::SetMaxEnergy(double Ev)
@@ -773,6 +1007,35 @@ void GNuMIFlux::SetEntryReuse(long int nuse)
   fNUse    = TMath::Max(1L, nuse);
 }
 //___________________________________________________________________________
+void GNuMIFlux::SetPrefetchDepth(int depth)
+{
+// With depth > 0 a background thread reads (and decompresses) up to "depth"
+// entries ahead of the current one, on a TChain of its own, so that slow
+// (eg. network) file access does not stall GenerateNext()
+
+  fPrefetchDepth = TMath::Max(0, depth);
+  this->StartPrefetch();
+}
+//___________________________________________________________________________
+void GNuMIFlux::StartPrefetch(void)
+{
+  if ( fPrefetch ) {
+    delete fPrefetch;
+    fPrefetch = 0;
+  }
+  if ( fPrefetchDepth <= 0 || fNEntries <= 0 ) return;
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,6,0)
+  ROOT::EnableThreadSafety();
+#endif
+  fPrefetch = new GNuMIFluxPrefetch(GetFileList(), fNuFluxTreeName,
+                                    fNuFluxGen, fNEntries, fPrefetchDepth);
+
+  LOG("Flux", pNOTICE)
+    << "Reading ahead up to " << fPrefetchDepth
+    << " flux entries in a background thread";
+}
+//___________________________________________________________________________
 void GNuMIFlux::SetTreeName(string name)
 {
   fNuFluxTreeName = name;
@@ -1036,6 +1299,9 @@ void GNuMIFlux::Initialize(void)
 
   fCurEntry        = new GNuMIFluxPassThroughInfo;
 
+  fPrefetchDepth   =  0;
+  fPrefetch        =  0;
+
   fNuFluxTree      =  0;
   fG3NuMI          =  0;
   fG4NuMI          =  0;
@@ -1046,6 +1312,8 @@ void GNuMIFlux::Initialize(void)
 
   fNEntries        =  0;
   fIEntry          = -1;
+  fFirstEntry      =  0;
+  fLastEntry       =  0;
   fICycle          =  0;
   fNUse            =  1;
   fIUse            =  999999;
@@ -1057,6 +1325,8 @@ void GNuMIFlux::Initialize(void)
   fMaxWgtFudge     =  1.05;
   fMaxWgtEntries   = 2500000;
   fMaxEFudge       =  0;
+  fMaxWgtScanThreads = 0;
+  fMaxWgtCacheFile   = "";
 
   fSumWeight       =  0;
   fNNeutrinos      =  0;
@@ -1120,6 +1390,7 @@ void GNuMIFlux::CleanUp(void)
   if (fPdgCListRej) delete fPdgCListRej;
   if (fCurEntry)    delete fCurEntry;
 
+  if ( fPrefetch )  delete fPrefetch;
   if ( fG3NuMI )    delete fG3NuMI;
   if ( fG4NuMI )    delete fG4NuMI;
   if ( fFlugg  )    delete fFlugg;
@@ -2445,6 +2716,74 @@ std::vector<std::string> GNuMIFlux::GetFileList()
   return flist;
 }
 
+//___________________________________________________________________________
+GNuMIFluxNtpReader::GNuMIFluxNtpReader(
+  const std::vector<std::string> & files, string treename, string gen) :
+fG3NuMI(0),
+fG4NuMI(0),
+fFlugg(0)
+{
+  fChain = new TChain(treename.c_str());
+  for (size_t i = 0; i < files.size(); ++i) fChain->AddFile(files[i].c_str());
+
+  if ( gen == "g3numi" ) fG3NuMI = new g3numi(fChain);
+  if ( gen == "g4numi" ) fG4NuMI = new g4numi(fChain);
+  if ( gen == "flugg"  ) fFlugg  = new flugg(fChain);
+}
+//___________________________________________________________________________
+GNuMIFluxNtpReader::~GNuMIFluxNtpReader()
+{
+  // the MakeClass destructors delete the current file of the chain,
+  // leave that to the chain itself
+  if ( fG3NuMI ) { fG3NuMI->fChain = 0; delete fG3NuMI; }
+  if ( fG4NuMI ) { fG4NuMI->fChain = 0; delete fG4NuMI; }
+  if ( fFlugg  ) { fFlugg->fChain  = 0; delete fFlugg;  }
+  delete fChain;
+}
+//___________________________________________________________________________
+bool GNuMIFluxNtpReader::Read(Long64_t ientry, GNuMIFluxPassThroughInfo & rec)
+{
+// Copy the input ntuple entry (not yet converted to pdg codes / user units)
+
+  if ( fG3NuMI ) {
+    if ( fG3NuMI->GetEntry(ientry) <= 0 ) return false;
+    rec.MakeCopy(fG3NuMI);
+  } else if ( fG4NuMI ) {
+    if ( fG4NuMI->GetEntry(ientry) <= 0 ) return false;
+    rec.MakeCopy(fG4NuMI);
+  } else if ( fFlugg ) {
+    if ( fFlugg->GetEntry(ientry) <= 0 ) return false;
+    rec.MakeCopy(fFlugg);
+  } else {
+    return false;
+  }
+  return true;
+}
+//___________________________________________________________________________
+GNuMIFluxPrefetch::GNuMIFluxPrefetch(
+  const std::vector<std::string> & files, string treename, string gen,
+  Long64_t nentries, int depth) :
+fReader(files, treename, gen)
+{
+  fRing = new GFluxPrefetchRing<GNuMIFluxPassThroughInfo>(depth, nentries,
+    [this](Long64_t ientry, GNuMIFluxPassThroughInfo & rec)
+      { return fReader.Read(ientry,rec); });
+}
+//___________________________________________________________________________
+GNuMIFluxPrefetch::~GNuMIFluxPrefetch()
+{
+  delete fRing;   // stops the reader thread before the reader goes
+}
+//___________________________________________________________________________
+bool GNuMIFluxPrefetch::GetEntry(
+  Long64_t ientry, GNuMIFluxPassThroughInfo * entry)
+{
+// Copy the prefetched input entry into the driver's current entry,
+// returns false if the reader failed to provide it
+
+  return fRing->Next(ientry,*entry);
+}
+
 //___________________________________________________________________________
 
 std::vector<double> GNuMIFluxXMLHelper::GetDoubleVector(std::string str)
@@ -2636,6 +2975,24 @@ void GNuMIFluxXMLHelper::ParseParamSet(xmlDocPtr& xml_doc, xmlNodePtr& xml_pset)
       fGNuMI->SetEntryReuse(nreuse);
       SLOG("GNuMIFlux", pINFO) << "set entry reuse = " << nreuse;
 
+    } else if ( pname == "prefetch" ) {
+      long int depth = 0;
+      std::vector<long int> v = GetIntVector(pval);
+      if ( v.size() > 0 ) depth = v[0];
+      fGNuMI->SetPrefetchDepth(depth);
+      SLOG("GNuMIFlux", pINFO) << "set prefetch depth = " << depth;
+
+    } else if ( pname == "maxwgtthreads" ) {
+      long int nthreads = 0;
+      std::vector<long int> v = GetIntVector(pval);
+      if ( v.size() > 0 ) nthreads = v[0];
+      fGNuMI->SetMaxWgtScanThreads(nthreads);
+      SLOG("GNuMIFlux", pINFO) << "set max weight scan threads = " << nthreads;
+
+    } else if ( pname == "maxwgtcache" ) {
+      fGNuMI->SetMaxWgtCacheFile(pval);
+      SLOG("GNuMIFlux", pINFO) << "set max weight cache file = " << pval;
+
     } else {
       SLOG("GNuMIFlux", pWARN)
         << "  NOT HANDLED: pname \"" << pname
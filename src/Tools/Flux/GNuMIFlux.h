@@ -39,6 +39,7 @@
 
 class TFile;
 class TChain;
+class TRandom;
 class TTree;
 class TBranch;
 
@@ -210,6 +211,8 @@ public:
 ClassDef(GNuMIFluxPassThroughInfo,5)
 };
 
+class GNuMIFluxPrefetch;
+
 /// GNuMIFlux:
 /// ==========
 /// An implementation of the GFluxI interface that provides NuMI flux
@@ -281,6 +284,7 @@ public :
                              std::vector<std::string>& branchClassNames,
                              std::vector<void**>&      branchObjPointers);
   virtual TTree* GetMetaDataTree();
+  virtual bool   SelectShard(int ishard, int nshards);
 
   //
   // configuration of GNuMIFlux
@@ -293,12 +297,19 @@ public :
 
   void      SetEntryReuse(long int nuse=1);                       ///<  # of times to use entry before moving to next
 
+  void      SetPrefetchDepth(int depth=0);                        ///< # of entries read ahead by a background reader thread (0 = off)
+  int       PrefetchDepth(void) const { return fPrefetchDepth; }
+
   void      SetTreeName(string name);                             ///< set input tree name (default: "h10")
   void      ScanForMaxWeight(void);                               ///< scan for max flux weight (before generating unweighted flux neutrinos)
   void      SetMaxWgtScan(double fudge = 1.05, long int nentries = 2500000)      ///< configuration when estimating max weight
             { fMaxWgtFudge = fudge; fMaxWgtEntries = nentries; }
   void      SetMaxEFudge(double fudge = 1.05)                     ///< extra fudge factor in estimating maximum energy
             { fMaxEFudge = fudge; }
+  void      SetMaxWgtScanThreads(int nthreads = 0)                ///< # of threads scanning for max weight (0 = # of cores)
+            { fMaxWgtScanThreads = nthreads; }
+  void      SetMaxWgtCacheFile(string fname = "")                 ///< side file caching the max weight scan results ("" = no caching)
+            { fMaxWgtCacheFile = fname; }
   void      SetApplyWindowTiltWeight(bool apply = true)           ///< apply wgt due to tilt of flux window relative to beam
             { fApplyTiltWeight = apply; }
 
@@ -378,6 +389,15 @@ private:
   void ResetCurrent          (void);
   void AddFile               (TTree* tree, string fname);
   void CalcEffPOTsPerNu      (void);
+  void StartPrefetch         (void);
+
+  double EntryWeight         (GNuMIFluxPassThroughInfo & entry, TRandom & rnd) const;
+  void   ScanMaxWeightRange  (const std::vector<std::string> & files,
+                              Long64_t first, Long64_t last, unsigned int seed,
+                              double & wgtmx, double & enumx) const;
+  string MaxWgtCacheKey      (void);
+  bool   ReadMaxWgtCache     (const string & key);
+  void   WriteMaxWgtCache    (const string & key) const;
   
   // Private data members
   //
@@ -394,6 +414,8 @@ private:
   int       fNFiles;              ///< number of files in chain
   Long64_t  fNEntries;            ///< number of flux ntuple entries
   Long64_t  fIEntry;              ///< current flux ntuple entry
+  Long64_t  fFirstEntry;          ///< first entry of the cycle (of the flux shard)...
+  Long64_t  fLastEntry;           ///< ...and one past its last entry
   Long64_t  fNuTot;               ///< cummulative # of entries (=fNEntries)
   Long64_t  fFilePOTs;            ///< # of protons-on-target represented by all files
 
@@ -402,6 +424,8 @@ private:
   double    fMaxWgtFudge;         ///< fudge factor for estimating max wgt
   long int  fMaxWgtEntries;       ///< # of entries in estimating max wgt
   double    fMaxEFudge;           ///< fudge factor for estmating max enu (0=> use fixed 120GeV)
+  int       fMaxWgtScanThreads;   ///< # of threads scanning for max wgt (0 => # of cores)
+  string    fMaxWgtCacheFile;     ///< side file caching the max wgt scan results
 
   long int  fNUse;                ///< how often to use same entry in a row
   long int  fIUse;                ///< current # of times an entry has been used
@@ -435,6 +459,9 @@ private:
 
   GNuMIFluxPassThroughInfo* fCurEntry;  ///< copy of current ntuple entry info (owned structure)
 
+  int                 fPrefetchDepth;   ///< # of entries to read ahead (0 = no reader thread)
+  GNuMIFluxPrefetch*  fPrefetch;        //! background reader (owned)
+
 };
 
 //#define GNUMI_TEST_XY_WGT
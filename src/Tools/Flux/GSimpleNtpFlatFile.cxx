@@ -0,0 +1,491 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+
+ For the class documentation see the corresponding header file.
+*/
+//____________________________________________________________________________
+
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <TTree.h>
+
+#include "Tools/Flux/GSimpleNtpFlatFile.h"
+#include "Tools/Flux/GSimpleNtpFlux.h"
+#include "Framework/Messenger/Messenger.h"
+
+using namespace genie;
+using namespace genie::flux;
+
+namespace {
+
+  const char      kMagic[8]      = { 'G','S','M','P','F','L','A','T' };
+  const UInt_t    kByteOrderMark = 0x01020304;
+  const UInt_t    kVersion       = 1;
+  const ULong64_t kAlign         = 64;     // column alignment (bytes)
+  const Long64_t  kChunk         = 65536;  // entries written at a time
+
+  struct Header_t {
+    char      magic[8];
+    UInt_t    bom;
+    UInt_t    version;
+    UInt_t    ncolumns;
+    UInt_t    nmeta;
+    ULong64_t nentries;
+  };
+
+  // the standard columns: the "entry" variables, then the "numi" ones
+  enum {
+    kCwgt, kCvtxx, kCvtxy, kCvtxz, kCdist, kCpx, kCpy, kCpz, kCE, kCpdg,
+    kCmetakey,
+    kCtpx, kCtpy, kCtpz, kCvx, kCvy, kCvz, kCpdpx, kCpdpy, kCpdpz,
+    kCpppx, kCpppy, kCpppz, kCndecay, kCptype, kCppmedium, kCtptype,
+    kCrun, kCevtno, kCentryno,
+    kNColumns
+  };
+  const int kNEntryColumns = kCmetakey + 1;
+
+  struct ColumnDef_t {
+    const char * name;
+    UInt_t       type;
+  };
+  const ColumnDef_t kColumns[kNColumns] = {
+    { "wgt",      GSimpleNtpFlatFile::kColFloat  },
+    { "vtxx",     GSimpleNtpFlatFile::kColDouble },
+    { "vtxy",     GSimpleNtpFlatFile::kColDouble },
+    { "vtxz",     GSimpleNtpFlatFile::kColDouble },
+    { "dist",     GSimpleNtpFlatFile::kColDouble },
+    { "px",       GSimpleNtpFlatFile::kColFloat  },
+    { "py",       GSimpleNtpFlatFile::kColFloat  },
+    { "pz",       GSimpleNtpFlatFile::kColFloat  },
+    { "E",        GSimpleNtpFlatFile::kColFloat  },
+    { "pdg",      GSimpleNtpFlatFile::kColInt    },
+    { "metakey",  GSimpleNtpFlatFile::kColInt    },
+    { "tpx",      GSimpleNtpFlatFile::kColFloat  },
+    { "tpy",      GSimpleNtpFlatFile::kColFloat  },
+    { "tpz",      GSimpleNtpFlatFile::kColFloat  },
+    { "vx",       GSimpleNtpFlatFile::kColFloat  },
+    { "vy",       GSimpleNtpFlatFile::kColFloat  },
+    { "vz",       GSimpleNtpFlatFile::kColFloat  },
+    { "pdpx",     GSimpleNtpFlatFile::kColFloat  },
+    { "pdpy",     GSimpleNtpFlatFile::kColFloat  },
+    { "pdpz",     GSimpleNtpFlatFile::kColFloat  },
+    { "pppx",     GSimpleNtpFlatFile::kColFloat  },
+    { "pppy",     GSimpleNtpFlatFile::kColFloat  },
+    { "pppz",     GSimpleNtpFlatFile::kColFloat  },
+    { "ndecay",   GSimpleNtpFlatFile::kColInt    },
+    { "ptype",    GSimpleNtpFlatFile::kColInt    },
+    { "ppmedium", GSimpleNtpFlatFile::kColInt    },
+    { "tptype",   GSimpleNtpFlatFile::kColInt    },
+    { "run",      GSimpleNtpFlatFile::kColInt    },
+    { "evtno",    GSimpleNtpFlatFile::kColInt    },
+    { "entryno",  GSimpleNtpFlatFile::kColInt    }
+  };
+
+  UInt_t Width(UInt_t type)
+  {
+    return ( type == GSimpleNtpFlatFile::kColDouble ) ? 8 : 4;
+  }
+
+  void Values(const GSimpleNtpEntry & e, const GSimpleNtpNuMI * n,
+              double * d, Int_t * iv)
+  {
+    d[kCwgt]  = e.wgt;
+    d[kCvtxx] = e.vtxx;
+    d[kCvtxy] = e.vtxy;
+    d[kCvtxz] = e.vtxz;
+    d[kCdist] = e.dist;
+    d[kCpx]   = e.px;
+    d[kCpy]   = e.py;
+    d[kCpz]   = e.pz;
+    d[kCE]    = e.E;
+    iv[kCpdg]     = e.pdg;
+    iv[kCmetakey] = (Int_t) e.metakey;
+    if ( ! n ) return;
+    d[kCtpx]  = n->tpx;
+    d[kCtpy]  = n->tpy;
+    d[kCtpz]  = n->tpz;
+    d[kCvx]   = n->vx;
+    d[kCvy]   = n->vy;
+    d[kCvz]   = n->vz;
+    d[kCpdpx] = n->pdpx;
+    d[kCpdpy] = n->pdpy;
+    d[kCpdpz] = n->pdpz;
+    d[kCpppx] = n->pppx;
+    d[kCpppy] = n->pppy;
+    d[kCpppz] = n->pppz;
+    iv[kCndecay]   = n->ndecay;
+    iv[kCptype]    = n->ptype;
+    iv[kCppmedium] = n->ppmedium;
+    iv[kCtptype]   = n->tptype;
+    iv[kCrun]      = n->run;
+    iv[kCevtno]    = n->evtno;
+    iv[kCentryno]  = n->entryno;
+  }
+}
+
+//____________________________________________________________________________
+GSimpleNtpFlatFile::GSimpleNtpFlatFile() :
+fFileName(""),
+fData(0),
+fSize(0),
+fNEntries(0),
+fHasNuMI(false)
+{
+
+}
+//____________________________________________________________________________
+GSimpleNtpFlatFile::~GSimpleNtpFlatFile()
+{
+  this->Close();
+}
+//____________________________________________________________________________
+bool GSimpleNtpFlatFile::Convert(
+  TTree * fluxtree, TTree * metatree, const string & fname)
+{
+  if ( ! fluxtree ) return false;
+
+  GSimpleNtpEntry * entry = new GSimpleNtpEntry;
+  GSimpleNtpNuMI  * numi  = 0;
+  fluxtree->SetBranchAddress("entry",&entry);
+  bool hasnumi = ( fluxtree->GetBranch("numi") != 0 );
+  if ( hasnumi ) {
+    numi = new GSimpleNtpNuMI;
+    fluxtree->SetBranchAddress("numi",&numi);
+  }
+
+  // meta data
+  std::vector<Meta_t> metas;
+  if ( metatree ) {
+    GSimpleNtpMeta * meta = new GSimpleNtpMeta;
+    metatree->SetBranchAddress("meta",&meta);
+    for (Long64_t imeta = 0; imeta < metatree->GetEntries(); ++imeta) {
+      metatree->GetEntry(imeta);
+      Meta_t m;
+      memset(&m, 0, sizeof(Meta_t));
+      m.metakey = meta->metakey;
+      m.npdg    = std::min((size_t)8, meta->pdglist.size());
+      if ( meta->pdglist.size() > 8 ) {
+        LOG("Flux", pWARN)
+          << "Keeping 8 of the " << meta->pdglist.size()
+          << " flavors of meta data record " << meta->metakey;
+      }
+      for (UInt_t i = 0; i < m.npdg; ++i) m.pdglist[i] = meta->pdglist[i];
+      m.maxEnergy = meta->maxEnergy;
+      m.minWgt    = meta->minWgt;
+      m.maxWgt    = meta->maxWgt;
+      m.protons   = meta->protons;
+      for (int j = 0; j < 3; ++j) {
+        m.windowBase[j] = meta->windowBase[j];
+        m.windowDir1[j] = meta->windowDir1[j];
+        m.windowDir2[j] = meta->windowDir2[j];
+      }
+      metas.push_back(m);
+    }
+    metatree->ResetBranchAddresses();
+    delete meta;
+  }
+
+  // lay out the file
+  int      ncol     = ( hasnumi ) ? kNColumns : kNEntryColumns;
+  Long64_t nentries = fluxtree->GetEntries();
+
+  Header_t header;
+  memset(&header, 0, sizeof(Header_t));
+  memcpy(header.magic, kMagic, 8);
+  header.bom      = kByteOrderMark;
+  header.version  = kVersion;
+  header.ncolumns = ncol;
+  header.nmeta    = metas.size();
+  header.nentries = nentries;
+
+  std::vector<Column_t> cols(ncol);
+  ULong64_t offset = sizeof(Header_t) + ncol * sizeof(Column_t) +
+                     metas.size() * sizeof(Meta_t);
+  for (int icol = 0; icol < ncol; ++icol) {
+    memset(&cols[icol], 0, sizeof(Column_t));
+    strncpy(cols[icol].name, kColumns[icol].name, 15);
+    cols[icol].type   = kColumns[icol].type;
+    cols[icol].width  = Width(kColumns[icol].type);
+    offset = ((offset + kAlign - 1) / kAlign) * kAlign;
+    cols[icol].offset = offset;
+    offset += cols[icol].width * nentries;
+  }
+
+  FILE * fp = fopen(fname.c_str(), "wb");
+  if ( ! fp ) {
+    LOG("Flux", pERROR) << "Can not open " << fname << " for writing";
+    fluxtree->ResetBranchAddresses();
+    delete entry;
+    if ( numi ) delete numi;
+    return false;
+  }
+  bool isok = true;
+  isok &= ( fwrite(&header, sizeof(Header_t), 1, fp) == 1 );
+  isok &= ( fwrite(&cols[0], sizeof(Column_t), ncol, fp) == (size_t)ncol );
+  if ( metas.size() > 0 ) {
+    isok &= ( fwrite(&metas[0], sizeof(Meta_t), metas.size(), fp) ==
+              metas.size() );
+  }
+
+  // fill the columns, a chunk of entries at a time
+  std::vector< std::vector<char> > buffers(ncol);
+  for (int icol = 0; icol < ncol; ++icol) {
+    buffers[icol].resize(kChunk * cols[icol].width);
+  }
+  double dval[kNColumns];
+  Int_t  ival[kNColumns];
+  for (Long64_t first = 0; isok && first < nentries; first += kChunk) {
+    Long64_t n = std::min(kChunk, nentries - first);
+    for (Long64_t i = 0; i < n; ++i) {
+      fluxtree->GetEntry(first + i);
+      Values(*entry, numi, dval, ival);
+      for (int icol = 0; icol < ncol; ++icol) {
+        char * dest = &buffers[icol][i * cols[icol].width];
+        if ( cols[icol].type == kColFloat ) {
+          float f = dval[icol];
+          memcpy(dest, &f, 4);
+        } else if ( cols[icol].type == kColDouble ) {
+          memcpy(dest, &dval[icol], 8);
+        } else {
+          memcpy(dest, &ival[icol], 4);
+        }
+      }
+    }
+    for (int icol = 0; icol < ncol; ++icol) {
+      isok &= ( fseeko(fp, cols[icol].offset + first * cols[icol].width,
+                       SEEK_SET) == 0 );
+      isok &= ( fwrite(&buffers[icol][0], cols[icol].width, n, fp) ==
+                (size_t)n );
+    }
+    LOG("Flux", pINFO)
+      << "Wrote " << first + n << " of " << nentries << " entries";
+  }
+  isok &= ( fclose(fp) == 0 );
+
+  fluxtree->ResetBranchAddresses();
+  delete entry;
+  if ( numi ) delete numi;
+
+  if ( ! isok ) {
+    LOG("Flux", pERROR) << "Failed writing " << fname;
+    return false;
+  }
+  LOG("Flux", pNOTICE)
+    << "Wrote " << nentries << " flux entries (" << ncol << " columns, "
+    << metas.size() << " meta data records) to " << fname;
+  return true;
+}
+//____________________________________________________________________________
+bool GSimpleNtpFlatFile::Open(const string & fname)
+{
+  this->Close();
+
+  int fd = open(fname.c_str(), O_RDONLY);
+  if ( fd < 0 ) {
+    LOG("Flux", pERROR) << "Can not open " << fname;
+    return false;
+  }
+  struct stat st;
+  if ( fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(Header_t) ) {
+    LOG("Flux", pERROR) << fname << " is not a flat flux file";
+    close(fd);
+    return false;
+  }
+  void * addr = mmap(0, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if ( addr == MAP_FAILED ) {
+    LOG("Flux", pERROR) << "Can not map " << fname << " into memory";
+    return false;
+  }
+#ifdef MADV_SEQUENTIAL
+  madvise(addr, st.st_size, MADV_SEQUENTIAL);
+#endif
+  fData     = static_cast<char *>(addr);
+  fSize     = st.st_size;
+  fFileName = fname;
+
+  const Header_t * header = reinterpret_cast<const Header_t *>(fData);
+  bool isok = ( memcmp(header->magic, kMagic, 8) == 0 &&
+                header->bom == kByteOrderMark &&
+                header->version == kVersion );
+  ULong64_t tables = sizeof(Header_t) +
+                     header->ncolumns * sizeof(Column_t) +
+                     header->nmeta * sizeof(Meta_t);
+  isok = isok && ( tables <= fSize );
+  if ( ! isok ) {
+    LOG("Flux", pERROR)
+      << fname << " is not a flat flux file (of this version / byte order)";
+    this->Close();
+    return false;
+  }
+
+  fNEntries = header->nentries;
+  const Column_t * cols =
+    reinterpret_cast<const Column_t *>(fData + sizeof(Header_t));
+  fColumns.assign(cols, cols + header->ncolumns);
+  const Meta_t * metas =
+    reinterpret_cast<const Meta_t *>(cols + header->ncolumns);
+  fMeta.assign(metas, metas + header->nmeta);
+
+  for (size_t icol = 0; icol < fColumns.size(); ++icol) {
+    const Column_t & col = fColumns[icol];
+    if ( fNEntries > 0 &&
+         col.offset + (ULong64_t) col.width * fNEntries > fSize ) {
+      LOG("Flux", pERROR)
+        << fname << " is truncated (column " << col.name << ")";
+      this->Close();
+      return false;
+    }
+  }
+
+  fColPtr .assign(kNColumns, (const void *) 0);
+  fColType.assign(kNColumns, 0);
+  for (int icol = 0; icol < kNColumns; ++icol) {
+    fColPtr [icol] = this->Column(kColumns[icol].name, kColumns[icol].type);
+    fColType[icol] = kColumns[icol].type;
+    if ( icol < kNEntryColumns && ! fColPtr[icol] ) {
+      LOG("Flux", pERROR)
+        << fname << " has no \"" << kColumns[icol].name << "\" column";
+      this->Close();
+      return false;
+    }
+  }
+  fHasNuMI = true;
+  for (int icol = kNEntryColumns; icol < kNColumns; ++icol) {
+    if ( ! fColPtr[icol] ) fHasNuMI = false;
+  }
+
+  LOG("Flux", pNOTICE)
+    << "Mapped " << fname << ": " << fNEntries << " flux entries, "
+    << fColumns.size() << " columns" << (fHasNuMI ? " (with numi)" : "")
+    << ", " << fMeta.size() << " meta data records";
+  return true;
+}
+//____________________________________________________________________________
+void GSimpleNtpFlatFile::Close(void)
+{
+  if ( fData ) munmap(fData, fSize);
+  fData     = 0;
+  fSize     = 0;
+  fNEntries = 0;
+  fHasNuMI  = false;
+  fFileName = "";
+  fColumns.clear();
+  fMeta.clear();
+  fColPtr.clear();
+  fColType.clear();
+}
+//____________________________________________________________________________
+void GSimpleNtpFlatFile::GetMeta(int imeta, GSimpleNtpMeta & meta) const
+{
+  const Meta_t & m = fMeta[imeta];
+
+  meta.Reset();
+  for (UInt_t i = 0; i < m.npdg; ++i) meta.AddFlavor(m.pdglist[i]);
+  meta.maxEnergy = m.maxEnergy;
+  meta.minWgt    = m.minWgt;
+  meta.maxWgt    = m.maxWgt;
+  meta.protons   = m.protons;
+  for (int j = 0; j < 3; ++j) {
+    meta.windowBase[j] = m.windowBase[j];
+    meta.windowDir1[j] = m.windowDir1[j];
+    meta.windowDir2[j] = m.windowDir2[j];
+  }
+  meta.infiles.push_back(fFileName);
+  meta.metakey   = m.metakey;
+}
+//____________________________________________________________________________
+void GSimpleNtpFlatFile::GetEntry(
+  Long64_t ientry, GSimpleNtpEntry & entry, GSimpleNtpNuMI * numi) const
+{
+  entry.wgt     = this->DValue(kCwgt,  ientry);
+  entry.vtxx    = this->DValue(kCvtxx, ientry);
+  entry.vtxy    = this->DValue(kCvtxy, ientry);
+  entry.vtxz    = this->DValue(kCvtxz, ientry);
+  entry.dist    = this->DValue(kCdist, ientry);
+  entry.px      = this->DValue(kCpx,   ientry);
+  entry.py      = this->DValue(kCpy,   ientry);
+  entry.pz      = this->DValue(kCpz,   ientry);
+  entry.E       = this->DValue(kCE,    ientry);
+  entry.pdg     = this->IValue(kCpdg,  ientry);
+  entry.metakey = (UInt_t) this->IValue(kCmetakey, ientry);
+
+  if ( ! numi || ! fHasNuMI ) return;
+
+  numi->tpx      = this->DValue(kCtpx,  ientry);
+  numi->tpy      = this->DValue(kCtpy,  ientry);
+  numi->tpz      = this->DValue(kCtpz,  ientry);
+  numi->vx       = this->DValue(kCvx,   ientry);
+  numi->vy       = this->DValue(kCvy,   ientry);
+  numi->vz       = this->DValue(kCvz,   ientry);
+  numi->pdpx     = this->DValue(kCpdpx, ientry);
+  numi->pdpy     = this->DValue(kCpdpy, ientry);
+  numi->pdpz     = this->DValue(kCpdpz, ientry);
+  numi->pppx     = this->DValue(kCpppx, ientry);
+  numi->pppy     = this->DValue(kCpppy, ientry);
+  numi->pppz     = this->DValue(kCpppz, ientry);
+  numi->ndecay   = this->IValue(kCndecay,   ientry);
+  numi->ptype    = this->IValue(kCptype,    ientry);
+  numi->ppmedium = this->IValue(kCppmedium, ientry);
+  numi->tptype   = this->IValue(kCtptype,   ientry);
+  numi->run      = this->IValue(kCrun,      ientry);
+  numi->evtno    = this->IValue(kCevtno,    ientry);
+  numi->entryno  = this->IValue(kCentryno,  ientry);
+}
+//____________________________________________________________________________
+const float * GSimpleNtpFlatFile::FloatColumn(const string & name) const
+{
+  return static_cast<const float *>(this->Column(name, kColFloat));
+}
+//____________________________________________________________________________
+const double * GSimpleNtpFlatFile::DoubleColumn(const string & name) const
+{
+  return static_cast<const double *>(this->Column(name, kColDouble));
+}
+//____________________________________________________________________________
+const Int_t * GSimpleNtpFlatFile::IntColumn(const string & name) const
+{
+  return static_cast<const Int_t *>(this->Column(name, kColInt));
+}
+//____________________________________________________________________________
+const void * GSimpleNtpFlatFile::Column(const string & name, UInt_t type) const
+{
+  for (size_t icol = 0; icol < fColumns.size(); ++icol) {
+    const Column_t & col = fColumns[icol];
+    if ( col.type == type && strncmp(col.name, name.c_str(), 16) == 0 ) {
+      return fData + col.offset;
+    }
+  }
+  return 0;
+}
+//____________________________________________________________________________
+double GSimpleNtpFlatFile::DValue(int icol, Long64_t ientry) const
+{
+  const void * col = fColPtr[icol];
+  switch ( fColType[icol] ) {
+    case kColFloat  : return static_cast<const float  *>(col)[ientry];
+    case kColDouble : return static_cast<const double *>(col)[ientry];
+    default         : return static_cast<const Int_t  *>(col)[ientry];
+  }
+}
+//____________________________________________________________________________
+Int_t GSimpleNtpFlatFile::IValue(int icol, Long64_t ientry) const
+{
+  if ( fColType[icol] == kColInt ) {
+    return static_cast<const Int_t *>(fColPtr[icol])[ientry];
+  }
+  return (Int_t) this->DValue(icol, ientry);
+}
+//____________________________________________________________________________
@@ -0,0 +1,138 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::flux::GSimpleNtpFlatFile
+
+\brief    A flat, columnar and memory-mapped alternative to the ROOT files
+          of the GSimpleNtpFlux ntuple format, for high-rate jobs where
+          streaming each entry through ROOT is a real cost.
+
+          A flat file holds the "entry" (and, optionally, the "numi")
+          variables of all flux entries as fixed width columns, one
+          contiguous array per variable, plus the meta data of the input
+          files. Once mapped into memory, an entry is a few array loads,
+          and blocks of consecutive entries can be consumed directly
+          through the column pointers.
+
+          Layout (native byte order, checked through the header):
+
+            header   : char magic[8] "GSMPFLAT", uint32 byte order mark,
+                       uint32 version, uint32 # of columns,
+                       uint32 # of meta records, uint64 # of entries
+            columns  : # of columns x { char name[16], uint32 type,
+                       uint32 width, uint64 offset (from start of file) }
+            meta     : # of meta records x Meta_t
+            data     : the columns, each aligned to 64 bytes
+
+          The "aux" branch (variable length) is not carried over.
+          Files are written by Convert() (see the gsimple2flat utility) and
+          read by GSimpleNtpFlux::LoadBeamSimData() for files named *.gsflat.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2020, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _SIMPLE_NTP_FLAT_FILE_H_
+#define _SIMPLE_NTP_FLAT_FILE_H_
+
+#include <string>
+#include <vector>
+
+#include <Rtypes.h>
+
+class TTree;
+
+using std::string;
+
+namespace genie {
+namespace flux  {
+
+class GSimpleNtpEntry;
+class GSimpleNtpNuMI;
+class GSimpleNtpMeta;
+
+class GSimpleNtpFlatFile {
+
+public :
+  GSimpleNtpFlatFile();
+ ~GSimpleNtpFlatFile();
+
+  typedef enum EColumnType {
+    kColFloat  = 0,   ///< 32-bit float
+    kColDouble = 1,   ///< 64-bit float
+    kColInt    = 2    ///< 32-bit int
+  } ColumnType_t;
+
+  //! Write a flat file from the "flux" (& "meta") trees of GSimpleNtpFlux
+  //! ROOT files. Positions & distances are kept in double precision.
+  static bool Convert (TTree * fluxtree, TTree * metatree, const string & fname);
+
+  bool     Open      (const string & fname); ///< map the file into memory
+  void     Close     (void);
+  bool     IsOpen    (void) const { return fData != 0; }
+  string   FileName  (void) const { return fFileName; }
+
+  Long64_t NEntries  (void) const { return fNEntries; }
+  bool     HasNuMI   (void) const { return fHasNuMI;  }
+  int      NMeta     (void) const { return fMeta.size(); }
+  void     GetMeta   (int imeta, GSimpleNtpMeta & meta) const;
+
+  //! Fill the branch objects with the input entry (numi may be null)
+  void     GetEntry  (Long64_t ientry, GSimpleNtpEntry & entry,
+                      GSimpleNtpNuMI * numi = 0) const;
+
+  //! Contiguous columns, for consumers of whole blocks of entries
+  //! (null if the named column does not exist or is of another type)
+  const float  *  FloatColumn  (const string & name) const;
+  const double *  DoubleColumn (const string & name) const;
+  const Int_t  *  IntColumn    (const string & name) const;
+
+  //! Meta data record of an input file
+  struct Meta_t {
+    UInt_t   metakey;
+    UInt_t   npdg;
+    Int_t    pdglist[8];
+    Double_t maxEnergy;
+    Double_t minWgt;
+    Double_t maxWgt;
+    Double_t protons;
+    Double_t windowBase[3];
+    Double_t windowDir1[3];
+    Double_t windowDir2[3];
+  };
+
+private:
+
+  //! Column descriptor, as stored in the file
+  struct Column_t {
+    char      name[16];
+    UInt_t    type;
+    UInt_t    width;
+    ULong64_t offset;
+  };
+
+  const void * Column (const string & name, UInt_t type) const;
+  double       DValue (int icol, Long64_t ientry) const;
+  Int_t        IValue (int icol, Long64_t ientry) const;
+
+  string                fFileName;  ///< mapped file name
+  char *                fData;      ///< start of the mapping
+  ULong64_t             fSize;      ///< size of the mapping
+  Long64_t              fNEntries;  ///< # of flux entries
+  bool                  fHasNuMI;   ///< are the "numi" columns present
+  std::vector<Column_t> fColumns;   ///< column descriptors
+  std::vector<Meta_t>   fMeta;      ///< meta data records
+  std::vector<const void *> fColPtr;   ///< standard columns (null if absent)
+  std::vector<UInt_t>       fColType;  ///< and their types
+};
+
+} // flux namespace
+} // genie namespace
+
+#endif // _SIMPLE_NTP_FLAT_FILE_H_
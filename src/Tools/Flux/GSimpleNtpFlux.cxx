@@ -20,11 +20,14 @@
 #include <TChainElement.h>
 #include <TSystem.h>
 #include <TStopwatch.h>
+#include <TROOT.h>
 
 #include "Framework/Conventions/Units.h"
 #include "Framework/Conventions/GBuild.h"
 
 #include "Tools/Flux/GSimpleNtpFlux.h"
+#include "Tools/Flux/GFluxPrefetchRing.h"
+#include "Tools/Flux/GSimpleNtpFlatFile.h"
 
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
@@ -62,6 +65,98 @@ ClassImp(GSimpleNtpMeta)
 // static storage
 UInt_t genie::flux::GSimpleNtpMeta::mxfileprint = UINT_MAX;
 
+namespace genie {
+namespace flux  {
+//____________________________________________________________________________
+// The background reader of GSimpleNtpFlux: a TChain of its own on the same
+// files (trees are not thread-safe) filling a ring of ready entry records
+//
+class GSimpleNtpPrefetch {
+public:
+  struct Record_t {
+    GSimpleNtpEntry entry;
+    GSimpleNtpNuMI  numi;
+    GSimpleNtpAux   aux;
+    Int_t           nbytes;
+  };
+
+  GSimpleNtpPrefetch(const std::vector<std::string> & files,
+                     bool withnumi, bool withaux, Long64_t nentries, int depth);
+ ~GSimpleNtpPrefetch();
+
+  Int_t GetEntry(Long64_t ientry, GSimpleNtpEntry * entry,
+                 GSimpleNtpNuMI * numi, GSimpleNtpAux * aux);
+
+private:
+  bool  Read    (Long64_t ientry, Record_t & rec);
+
+  TChain *                      fChain;  ///< reader's own chain
+  GSimpleNtpEntry *             fEntry;  ///< reader's "entry" branch
+  GSimpleNtpNuMI *              fNuMI;   ///< reader's "numi" branch (or 0)
+  GSimpleNtpAux *               fAux;    ///< reader's "aux" branch (or 0)
+  Record_t                      fRecord; ///< last record taken
+  GFluxPrefetchRing<Record_t> * fRing;   ///< ring buffer & reader thread
+};
+} // flux namespace
+} // genie namespace
+
+//____________________________________________________________________________
+GSimpleNtpPrefetch::GSimpleNtpPrefetch(
+  const std::vector<std::string> & files,
+  bool withnumi, bool withaux, Long64_t nentries, int depth)
+{
+  fChain = new TChain("flux");
+  for (size_t i = 0; i < files.size(); ++i) fChain->AddFile(files[i].c_str());
+
+  fEntry = new GSimpleNtpEntry;
+  fNuMI  = (withnumi) ? new GSimpleNtpNuMI : 0;
+  fAux   = (withaux)  ? new GSimpleNtpAux  : 0;
+  fChain->SetBranchAddress("entry",&fEntry);
+  if ( fNuMI ) fChain->SetBranchAddress("numi",&fNuMI);
+  if ( fAux  ) fChain->SetBranchAddress("aux",&fAux);
+
+  fRing = new GFluxPrefetchRing<Record_t>(depth, nentries,
+    [this](Long64_t ientry, Record_t & rec) { return this->Read(ientry,rec); });
+}
+//____________________________________________________________________________
+GSimpleNtpPrefetch::~GSimpleNtpPrefetch()
+{
+  delete fRing;   // stops the reader thread first
+  delete fChain;
+  delete fEntry;
+  if ( fNuMI ) delete fNuMI;
+  if ( fAux  ) delete fAux;
+}
+//____________________________________________________________________________
+Int_t GSimpleNtpPrefetch::GetEntry(
+  Long64_t ientry, GSimpleNtpEntry * entry,
+  GSimpleNtpNuMI * numi, GSimpleNtpAux * aux)
+{
+// Copy the prefetched input entry into the driver's branch objects,
+// returns -1 if the reader failed to provide it
+
+  if ( ! fRing->Next(ientry,fRecord) ) return -1;
+
+  *entry = fRecord.entry;
+  if ( numi && fNuMI ) *numi = fRecord.numi;
+  if ( aux  && fAux  ) *aux  = fRecord.aux;
+  return fRecord.nbytes;
+}
+//____________________________________________________________________________
+bool GSimpleNtpPrefetch::Read(Long64_t ientry, Record_t & rec)
+{
+// Runs on the reader thread
+
+  Int_t nbytes = fChain->GetEntry(ientry);
+  if ( nbytes <= 0 ) return false;
+
+  rec.entry = *fEntry;
+  if ( fNuMI ) rec.numi = *fNuMI;
+  if ( fAux  ) rec.aux  = *fAux;
+  rec.nbytes = nbytes;
+  return true;
+}
+
 //____________________________________________________________________________
 GSimpleNtpFlux::GSimpleNtpFlux() :
   GFluxExposureI(genie::flux::kPOTs)
@@ -101,6 +196,7 @@ bool GSimpleNtpFlux::GenerateNext(void)
 
      // Get next weighted flux ntuple entry
      bool nextok = this->GenerateNext_weighted();
+     if ( ! nextok && fCurSkipped ) continue; // outside the energy window
      if ( fGenWeighted ) return nextok;
      if ( ! nextok ) continue;
      if ( fAlreadyUnwgt ) return true;
@@ -164,6 +260,8 @@ bool GSimpleNtpFlux::GenerateNext_weighted(void)
      exit(1);
   }
 
+  fCurSkipped = false;
+
   // Reuse an entry?
   //std::cout << " ***** iuse " << fIUse << " nuse " << fNUse
   //          << " ientry " << fIEntry << " nentry " << fNEntries
@@ -177,12 +275,12 @@ bool GSimpleNtpFlux::GenerateNext_weighted(void)
     // Move on, read next flux ntuple entry
     ++fIEntry;
     ++fNEntriesUsed;  // count total # used
-    if ( fIEntry >= fNEntries ) {
+    if ( fIEntry >= fLastEntry ) {
       // Ran out of entries @ the current cycle of this flux file
       // Check whether more (or infinite) number of cycles is requested
       if (fICycle < fNCycles || fNCycles == 0 ) {
         fICycle++;
-        fIEntry=0;
+        fIEntry=fFirstEntry;
       } else {
         LOG("Flux", pWARN)
           << "No more entries in input flux neutrino ntuple, cycle "
@@ -193,7 +291,10 @@ bool GSimpleNtpFlux::GenerateNext_weighted(void)
       }
     }
 
-    int nbytes = fNuFluxTree->GetEntry(fIEntry);
+    int nbytes = -1;
+    if ( ! fFlatFiles.empty() ) nbytes = this->GetFlatEntry(fIEntry);
+    else if ( fPrefetch ) nbytes = fPrefetch->GetEntry(fIEntry,fCurEntry,fCurNuMI,fCurAux);
+    if ( nbytes < 0 ) nbytes = fNuFluxTree->GetEntry(fIEntry);
     UInt_t metakey = fCurEntry->metakey;
     if ( fAllFilesMeta && ( fCurMeta->metakey != metakey ) ) {
       UInt_t oldkey = fCurMeta->metakey;
@@ -205,10 +306,12 @@ bool GSimpleNtpFlux::GenerateNext_weighted(void)
       // so find the right one by a simple linear search.
       // not a large burden since it only happens infrequently and
       // the list is normally quite short.
-      int nmeta = fNuMetaTree->GetEntries();
+      int nmeta = ( fFlatFiles.empty() ) ? fNuMetaTree->GetEntries()
+                                         : fFlatMeta.size();
       int nbmeta = 0;
       for (int imeta = 0; imeta < nmeta; ++imeta ) {
-        nbmeta = fNuMetaTree->GetEntry(imeta);
+        if ( fFlatFiles.empty() ) nbmeta = fNuMetaTree->GetEntry(imeta);
+        else                      *fCurMeta = fFlatMeta[imeta];
         if ( fCurMeta->metakey == metakey ) break;
       }
       // next condition should never happen
@@ -271,6 +374,20 @@ bool GSimpleNtpFlux::GenerateNext_weighted(void)
       return false;
     }
 
+    // skip entries that can't interact (energy window hint of the event
+    // generation driver), all of their uses: they are counted above already
+    if ( ! fEWinMin.empty() ) {
+      std::map<int,double>::const_iterator wmin = fEWinMin.find(fCurEntry->pdg);
+      if ( wmin != fEWinMin.end() &&
+           ( fCurEntry->E < wmin->second ||
+             fCurEntry->E > fEWinMax[fCurEntry->pdg] ) ) {
+        fIUse = fNUse;
+        fNSkippedEWin++;
+        fCurSkipped = true;
+        return false;
+      }
+    }
+
   }
 
   // Update the curr neutrino p4/x4 lorentz vector
@@ -311,6 +428,18 @@ bool GSimpleNtpFlux::GenerateNext_weighted(void)
   return true;
 }
 //___________________________________________________________________________
+void GSimpleNtpFlux::SetEnergyWindow(int pdg, double emin, double emax)
+{
+// Entries of this species outside [emin,emax] can't interact: skip them
+// (they're still accounted for in the POTs / number of neutrinos used)
+
+  LOG("Flux", pNOTICE)
+    << "Skipping pdg-code " << pdg << " entries outside ["
+    << emin << ", " << emax << "] GeV";
+  fEWinMin[pdg] = emin;
+  fEWinMax[pdg] = emax;
+}
+//___________________________________________________________________________
 double GSimpleNtpFlux::GetDecayDist() const
 {
   // return distance (user units) between dk point and start position
@@ -420,6 +549,9 @@ void GSimpleNtpFlux::LoadBeamSimData(const std::vector<string>& patterns,
     } // legal directory
   } // loop over patterns
 
+  // keep the files of the flux shard only, if dealing out whole files
+  this->ShardFiles(fnames);
+
   size_t indx = 0;
   std::set<string>::const_iterator sitr = fnames.begin();
   for ( ; sitr != fnames.end(); ++sitr, ++indx) {
@@ -434,6 +566,12 @@ void GSimpleNtpFlux::LoadBeamSimData(const std::vector<string>& patterns,
     // open the file to see what it contains
     LOG("Flux", pINFO) << "Load file " <<  filename;
 
+    if ( filename.size() > 7 &&
+         filename.compare(filename.size()-7, 7, ".gsflat") == 0 ) {
+      this->AddFlatFile(filename);
+      continue;
+    }
+
     TFile* tf = TFile::Open(filename.c_str(),"READ");
     TTree* etree = (TTree*)tf->Get("flux");
     if ( etree ) {
@@ -451,6 +589,15 @@ void GSimpleNtpFlux::LoadBeamSimData(const std::vector<string>& patterns,
   // this will open all files and read headers!!
   fNEntries = fNuFluxTree->GetEntries();
 
+  if ( ! fFlatFiles.empty() ) {
+    if ( fNEntries > 0 ) {
+      LOG("Flux", pWARN)
+        << "Flat (*.gsflat) and ROOT flux files can't be mixed: "
+        << "ignoring the " << fNEntries << " entries of the ROOT files";
+    }
+    fNEntries = fFlatFirst.back() + fFlatFiles.back()->NEntries();
+  }
+
   if ( fNEntries == 0 ) {
     LOG("Flux", pERROR)
       << "!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!";
@@ -477,45 +624,51 @@ void GSimpleNtpFlux::LoadBeamSimData(const std::vector<string>& patterns,
     }
   }
 
-  int sba_status[3] = { -999, -999, -999 };
-  // "entry" branch isn't optional ... contains the neutrino info
+  if ( ! fFlatFiles.empty() ) {
+    // flat files are read directly, there are no branches to attach
+    if ( ! OptionalAttachBranch("numi") ) { delete fCurNuMI; fCurNuMI = 0; }
+    if ( ! OptionalAttachBranch("aux")  ) { delete fCurAux;  fCurAux  = 0; }
+  } else {
+    int sba_status[3] = { -999, -999, -999 };
+    // "entry" branch isn't optional ... contains the neutrino info
 #if ROOT_VERSION_CODE >= ROOT_VERSION(5,26,0)
-  sba_status[0] =
+    sba_status[0] =
 #endif
-    fNuFluxTree->SetBranchAddress("entry",&fCurEntry);
+      fNuFluxTree->SetBranchAddress("entry",&fCurEntry);
 #if ROOT_VERSION_CODE >= ROOT_VERSION(5,26,0)
-  if ( sba_status[0] < 0 ) {
-    LOG("Flux", pFATAL)
-      << "flux chain has no \"entry\" branch " << sba_status[0];
-    assert(0);
-  }
+    if ( sba_status[0] < 0 ) {
+      LOG("Flux", pFATAL)
+        << "flux chain has no \"entry\" branch " << sba_status[0];
+      assert(0);
+    }
 #endif
-  //TBranch* bentry = fNuFluxTree->GetBranch("entry");
-  //bentry->SetAutoDelete(false);
+    //TBranch* bentry = fNuFluxTree->GetBranch("entry");
+    //bentry->SetAutoDelete(false);
 
-  if ( OptionalAttachBranch("numi") ) {
+    if ( OptionalAttachBranch("numi") ) {
 #if ROOT_VERSION_CODE >= ROOT_VERSION(5,26,0)
-    sba_status[1] =
+      sba_status[1] =
 #endif
-      fNuFluxTree->SetBranchAddress("numi",&fCurNuMI);
-    //TBranch* bnumi = fNuFluxTree->GetBranch("numi");
-    //bnumi->SetAutoDelete(false);
-  } else { delete fCurNuMI; fCurNuMI = 0; }
+        fNuFluxTree->SetBranchAddress("numi",&fCurNuMI);
+      //TBranch* bnumi = fNuFluxTree->GetBranch("numi");
+      //bnumi->SetAutoDelete(false);
+    } else { delete fCurNuMI; fCurNuMI = 0; }
 
-  if ( OptionalAttachBranch("aux") ) {
+    if ( OptionalAttachBranch("aux") ) {
 #if ROOT_VERSION_CODE >= ROOT_VERSION(5,26,0)
-    sba_status[2] =
+      sba_status[2] =
 #endif
-      fNuFluxTree->SetBranchAddress("aux",&fCurAux);
-    //TBranch* baux = fNuFluxTree->GetBranch("aux");
-    //baux->SetAutoDelete(false);
-  } else { delete fCurAux; fCurAux = 0; }
-
-  LOG("Flux", pDEBUG)
-    << " SetBranchAddress status: "
-    << " \"entry\"=" << sba_status[0]
-    << " \"numi\"=" << sba_status[1]
-    << " \"aux\"=" << sba_status[2];
+        fNuFluxTree->SetBranchAddress("aux",&fCurAux);
+      //TBranch* baux = fNuFluxTree->GetBranch("aux");
+      //baux->SetAutoDelete(false);
+    } else { delete fCurAux; fCurAux = 0; }
+
+    LOG("Flux", pDEBUG)
+      << " SetBranchAddress status: "
+      << " \"entry\"=" << sba_status[0]
+      << " \"numi\"=" << sba_status[1]
+      << " \"aux\"=" << sba_status[2];
+  }
 
   // attach requested branches
 
@@ -525,16 +678,22 @@ void GSimpleNtpFlux::LoadBeamSimData(const std::vector<string>& patterns,
      this->ProcessMeta();
   }
 
+  // the entries cycled over: those of the flux shard, if dealing out
+  // entries, or all of them
+  this->ShardEntries(fNEntries, fFirstEntry, fLastEntry);
+
   // current ntuple cycle # (flux ntuples may be recycled)
   fICycle =  0;
   // pick a starting entry index [0:fNEntries-1]
+  // (a shard starts from its first entry)
   // pretend we just used up the the previous one
   RandomGen* rnd = RandomGen::Instance();
   fIUse   =  9999999;
   fIEntry = rnd->RndFlux().Integer(fNEntries) - 1;
+  if ( fNShards > 1 ) fIEntry = fFirstEntry - 1;
   if ( config.find("no-offset-index") != string::npos ) {
     LOG("Flux",pINFO) << "Config saw \"no-offset-index\"";
-    fIEntry = -1;
+    fIEntry = fFirstEntry - 1;
   }
   LOG("Flux",pINFO) << "Start with entry fIEntry=" << fIEntry;
 
@@ -543,10 +702,44 @@ void GSimpleNtpFlux::LoadBeamSimData(const std::vector<string>& patterns,
   fSumWeight  = 0;
   fNNeutrinos = 0;
   fAccumPOTs  = 0;
+  fNSkippedEWin = 0;
 
   LOG("Flux",pDEBUG) << "about to CalcEffPOTsPerNu";
   this->CalcEffPOTsPerNu();
 
+  // (re)start the background reader, if requested, on the new files
+  this->StartPrefetch();
+}
+//___________________________________________________________________________
+bool GSimpleNtpFlux::SelectShard(int ishard, int nshards)
+{
+  // Read the ishard-th of nshards consecutive blocks of the loaded entries,
+  // once, and restart the flux accounting (see GFluxFileConfigI).
+  // Whole files dealt out to load time shards can not be re-dealt.
+
+  if ( ! fNuFluxTree || fShardFiles ) return false;
+  if ( nshards < 1 || ishard < 0 || ishard >= nshards ) return false;
+
+  fIShard  = ishard;
+  fNShards = nshards;
+  this->ShardEntries(fNEntries, fFirstEntry, fLastEntry);
+
+  // read the block once: its first cycle is the last one
+  fNCycles = 1;
+  fICycle  = 1;
+  fIUse    = 9999999;
+  fIEntry  = fFirstEntry - 1;
+  fEnd     = false;
+
+  fNEntriesUsed = 0;
+  fNSkippedEWin = 0;
+  fSumWeight  = 0;
+  fNNeutrinos = 0;
+  fAccumPOTs  = 0;
+
+  // restart the background reader, if any, at the block
+  this->StartPrefetch();
+  return true;
 }
 //___________________________________________________________________________
 void GSimpleNtpFlux::GetBranchInfo(std::vector<std::string>& branchNames,
@@ -590,15 +783,21 @@ void GSimpleNtpFlux::ProcessMeta(void)
 
   // PDGLibrary* pdglib = PDGLibrary::Instance(); // get initialized now
 
-  if ( fAllFilesMeta ) {
+  if ( fAllFilesMeta && ! fFlatFiles.empty() ) {
+    // meta data of the flat files were read when mapping them
+  } else if ( fAllFilesMeta ) {
     fNuMetaTree->SetBranchAddress("meta",&fCurMeta);
 #ifdef USE_INDEX_FOR_META
     int nindices = fNuMetaTree->BuildIndex("metakey"); // key used to tie entries to meta data
     LOG("Flux", pDEBUG) << "ProcessMeta() BuildIndex nindices " << nindices;
 #endif
-    int nmeta = fNuMetaTree->GetEntries();
+  }
+  if ( fAllFilesMeta ) {
+    int nmeta = ( fFlatFiles.empty() ) ? fNuMetaTree->GetEntries()
+                                       : fFlatMeta.size();
     for (int imeta = 0; imeta < nmeta; ++imeta ) {
-      fNuMetaTree->GetEntry(imeta);
+      if ( fFlatFiles.empty() ) fNuMetaTree->GetEntry(imeta);
+      else                      *fCurMeta = fFlatMeta[imeta];
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
       LOG("Flux", pNOTICE) << "ProcessMeta() ifile " << imeta
                            << " (of " << fNFiles
@@ -648,6 +847,37 @@ void GSimpleNtpFlux::SetEntryReuse(long int nuse)
   fNUse    = TMath::Max(1L, nuse);
 }
 //___________________________________________________________________________
+void GSimpleNtpFlux::SetPrefetchDepth(int depth)
+{
+// With depth > 0 a background thread reads (and decompresses) up to "depth"
+// entries ahead of the current one, on a TChain of its own, so that slow
+// (eg. network) file access does not stall GenerateNext().
+// Extra branches the user attached to GetFluxTChain() are not filled then.
+
+  fPrefetchDepth = TMath::Max(0, depth);
+  this->StartPrefetch();
+}
+//___________________________________________________________________________
+void GSimpleNtpFlux::StartPrefetch(void)
+{
+  if ( fPrefetch ) {
+    delete fPrefetch;
+    fPrefetch = 0;
+  }
+  if ( fPrefetchDepth <= 0 || fNEntries <= 0 ) return;
+  if ( ! fFlatFiles.empty() ) return; // mapped files need no reader thread
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,6,0)
+  ROOT::EnableThreadSafety();
+#endif
+  fPrefetch = new GSimpleNtpPrefetch(GetFileList(), (fCurNuMI != 0),
+                                     (fCurAux != 0), fNEntries, fPrefetchDepth);
+
+  LOG("Flux", pNOTICE)
+    << "Reading ahead up to " << fPrefetchDepth
+    << " flux entries in a background thread";
+}
+//___________________________________________________________________________
 void GSimpleNtpFlux::GetFluxWindow(TVector3& p0, TVector3& p1, TVector3& p2) const
 {
   // return flux window points
@@ -682,6 +912,7 @@ void GSimpleNtpFlux::Clear(Option_t * opt)
   fSumWeight  = 0;
   fNNeutrinos = 0;
   fAccumPOTs  = 0;
+  fNSkippedEWin = 0;
 
 }
 //___________________________________________________________________________
@@ -708,6 +939,10 @@ void GSimpleNtpFlux::Initialize(void)
   fCurNuMICopy     = 0;
   fCurAuxCopy      = 0;
 
+  fPrefetchDepth   = 0;
+  fPrefetch        = 0;
+  fIFlatFile       = 0;
+
   fNuFluxTree      = new TChain("flux");
   fNuMetaTree      = new TChain("meta");
 
@@ -718,6 +953,8 @@ void GSimpleNtpFlux::Initialize(void)
 
   fNEntries        =  0;
   fIEntry          = -1;
+  fFirstEntry      =  0;
+  fLastEntry       =  0;
   fIFileNumber     =  0;
   fICycle          =  0;
   fNUse            =  1;
@@ -732,6 +969,8 @@ void GSimpleNtpFlux::Initialize(void)
   fNEntriesUsed    =  0;
   fEffPOTsPerNu    =  0;
   fAccumPOTs       =  0;
+  fNSkippedEWin    =  0;
+  fCurSkipped      = false;
 
   fGenWeighted     = false;
   fAllFilesMeta    = true;
@@ -776,6 +1015,9 @@ void GSimpleNtpFlux::CleanUp(void)
   if (fCurAux)      delete fCurAux;
   if (fCurMeta)     delete fCurMeta;
 
+  if (fPrefetch)    delete fPrefetch;
+  for (size_t i = 0; i < fFlatFiles.size(); ++i) delete fFlatFiles[i];
+  fFlatFiles.clear();
   if (fNuFluxTree)  delete fNuFluxTree;
   if (fNuMetaTree)  delete fNuMetaTree;
 
@@ -819,6 +1061,18 @@ bool GSimpleNtpFlux::OptionalAttachBranch(std::string name)
     return false;
   }
 
+  if ( ! fFlatFiles.empty() ) {
+    // flat files carry the "numi" variables (if all have them) but no "aux"
+    bool hasit = ( name == "numi" );
+    for (size_t i = 0; i < fFlatFiles.size(); ++i)
+      hasit = hasit && fFlatFiles[i]->HasNuMI();
+    if ( ! hasit ) {
+      LOG("Flux", pINFO)
+        << "no \"" << name << "\" columns in the flat flux files";
+    }
+    return hasit;
+  }
+
   if ( ( fNuFluxTree->GetBranch(name.c_str()) ) ) return true;
 
   LOG("Flux", pINFO)
@@ -1094,6 +1348,7 @@ void GSimpleNtpFlux::PrintConfig()
     << " times, in " << fICycle << "/" << fNCycles << " cycles"
     << "\n SumWeight " << fSumWeight << " for " << fNNeutrinos << " neutrinos"
     << " with " << fNEntriesUsed << " entries read"
+    << " (" << fNSkippedEWin << " skipped outside the energy window)"
     << "\n EffPOTsPerNu " << fEffPOTsPerNu << " AccumPOTs " << fAccumPOTs
     << "\n GenWeighted \"" << (fGenWeighted?"true":"false") << "\""
     << " AlreadyUnwgt \"" << (fAlreadyUnwgt?"true":"false") << "\""
@@ -1111,7 +1366,55 @@ std::vector<std::string> GSimpleNtpFlux::GetFileList()
   while (( chEl=(TChainElement*)next() )) {
     flist.push_back(chEl->GetTitle());
   }
+  for (size_t i = 0; i < fFlatFiles.size(); ++i) {
+    flist.push_back(fFlatFiles[i]->FileName());
+  }
   return flist;
 }
+//___________________________________________________________________________
+void GSimpleNtpFlux::AddFlatFile(string fname)
+{
+// Map a flat (columnar) flux file, see GSimpleNtpFlatFile
+
+  GSimpleNtpFlatFile * flat = new GSimpleNtpFlatFile;
+  if ( ! flat->Open(fname) ) {
+    delete flat;
+    return;
+  }
+
+  Long64_t first = 0;
+  if ( ! fFlatFiles.empty() ) {
+    first = fFlatFirst.back() + fFlatFiles.back()->NEntries();
+  }
+  fFlatFiles.push_back(flat);
+  fFlatFirst.push_back(first);
+
+  if ( flat->NMeta() == 0 ) fAllFilesMeta = false;
+  for (int imeta = 0; imeta < flat->NMeta(); ++imeta) {
+    GSimpleNtpMeta meta;
+    flat->GetMeta(imeta,meta);
+    fFlatMeta.push_back(meta);
+  }
+  fNFiles++;
+
+  LOG("Flux",pINFO)
+    << "flat file " << fname << " of " << flat->NEntries()
+    << " entries, starting at entry " << first;
+}
+//___________________________________________________________________________
+int GSimpleNtpFlux::GetFlatEntry(Long64_t ientry)
+{
+// Fill the current entry from the mapped flat files (no ROOT streaming)
+
+  if ( fIFlatFile >= fFlatFiles.size() ||
+       ientry <  fFlatFirst[fIFlatFile] ||
+       ientry >= fFlatFirst[fIFlatFile] + fFlatFiles[fIFlatFile]->NEntries() ) {
+    fIFlatFile = std::upper_bound(fFlatFirst.begin(), fFlatFirst.end(),
+                                  ientry) - fFlatFirst.begin() - 1;
+  }
+  const GSimpleNtpFlatFile * flat = fFlatFiles[fIFlatFile];
+  flat->GetEntry(ientry - fFlatFirst[fIFlatFile], *fCurEntry, fCurNuMI);
+  return sizeof(GSimpleNtpEntry);
+}
 
 //___________________________________________________________________________
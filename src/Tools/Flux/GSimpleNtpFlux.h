@@ -22,6 +22,7 @@
 #include <iostream>
 #include <vector>
 #include <set>
+#include <map>
 
 #include <TVector3.h>
 #include <TLorentzVector.h>
@@ -191,6 +192,9 @@ ostream & operator << (ostream & stream, const GSimpleNtpEntry & info);
   };
 
 
+class GSimpleNtpPrefetch;
+class GSimpleNtpFlatFile;
+
 /// GSimpleNtpFlux:
 /// ==========
 /// An implementation of the GFluxI interface that provides NuMI flux
@@ -219,6 +223,7 @@ public :
   long int               Index         (void) { return  fIEntry;              }
   void                   Clear            (Option_t * opt);
   void                   GenerateWeighted (bool gen_weighted);
+  void                   SetEnergyWindow  (int pdg, double emin, double emax);
 
   // Methods specific to the NuMI flux driver,
   // for configuration/initialization of the flux & event generation drivers
@@ -254,6 +259,7 @@ public :
   double    UsedPOTs(void) const;       ///< # of protons-on-target used
 
   long int  NEntriesUsed(void) const { return fNEntriesUsed; } ///< number of entries read from files
+  long int  NSkippedByEnergyWindow(void) const { return fNSkippedEWin; } ///< entries skipped (but counted in the exposure) as outside the energy window
   double    SumWeight(void) const { return fSumWeight;  } ///< integrated weight for flux neutrinos looped so far
 
   void      PrintCurrent(void);         ///< print current entry from leaves
@@ -261,6 +267,10 @@ public :
 
   std::vector<std::string> GetFileList();  ///< list of files currently part of chain
 
+  int       NFlatFiles(void) const { return fFlatFiles.size(); } ///< # of (*.gsflat) flat files in use
+  const genie::flux::GSimpleNtpFlatFile *
+    GetFlatFile(int i) const { return fFlatFiles[i]; } ///< flat file, for block access to its columns
+
   //
   // GFluxFileConfigI interface
   //
@@ -271,6 +281,7 @@ public :
                               std::vector<std::string>& branchClassNames,
                               std::vector<void**>&      branchObjPointers);
   virtual TTree* GetMetaDataTree();
+  virtual bool   SelectShard(int ishard, int nshards);
 
   //
   // configuration of GSimpleNtpFlux
@@ -284,6 +295,9 @@ public :
 
   void      SetEntryReuse(long int nuse=1);                       ///<  # of times to use entry before moving to next
 
+  void      SetPrefetchDepth(int depth=0);  ///< # of entries read ahead by a background reader thread (0 = off)
+  int       PrefetchDepth(void) const { return fPrefetchDepth; }
+
   void      ProcessMeta(void);  ///< scan for max flux energy, weight
 
   void      GetFluxWindow(TVector3& p1, TVector3& p2, TVector3& p3) const; ///< 3 points define a plane in beam coordinate
@@ -301,6 +315,9 @@ private:
   bool OptionalAttachBranch  (std::string bname);
   void CalcEffPOTsPerNu      (void);
   void ScanMeta              (void);
+  void StartPrefetch         (void);
+  void AddFlatFile           (string fname);
+  int  GetFlatEntry          (Long64_t ientry);
 
   // Private data members
   //
@@ -315,6 +332,8 @@ private:
   int       fNFiles;              ///< number of files in chain
   Long64_t  fNEntries;            ///< number of flux ntuple entries
   Long64_t  fIEntry;              ///< current flux ntuple entry
+  Long64_t  fFirstEntry;          ///< first entry of the cycle (of the flux shard)...
+  Long64_t  fLastEntry;           ///< ...and one past its last entry
   Int_t     fIFileNumber;         ///< which file for the current entry
 
   Double_t  fFilePOTs;            ///< # of protons-on-target represented by all files
@@ -347,6 +366,19 @@ private:
   GSimpleNtpNuMI*  fCurNuMICopy;   ///< current "numi" branch extra info
   GSimpleNtpAux*   fCurAuxCopy;    ///< current "aux" branch extra info
 
+  int                 fPrefetchDepth; ///< # of entries to read ahead (0 = no reader thread)
+  GSimpleNtpPrefetch* fPrefetch;      //! background reader (owned)
+
+  std::vector<GSimpleNtpFlatFile*> fFlatFiles; //! mapped flat files (owned), used instead of the chain
+  std::vector<Long64_t>       fFlatFirst;     ///< first entry of each flat file
+  std::vector<GSimpleNtpMeta> fFlatMeta;      ///< meta data of the flat files
+  size_t                      fIFlatFile;     ///< flat file of the current entry
+
+  std::map<int,double> fEWinMin;      ///< energy window hint, per species: min
+  std::map<int,double> fEWinMax;      ///< energy window hint, per species: max
+  long int             fNSkippedEWin; ///< # of entries skipped because of the energy window
+  bool                 fCurSkipped;   ///< was the last entry skipped because of the energy window
+
 };
 
 } // flux namespace
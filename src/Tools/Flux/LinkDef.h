@@ -23,6 +23,7 @@
 
 #pragma link C++ class genie::flux::GCylindTH1Flux;
 #pragma link C++ class genie::flux::GMonoEnergeticFlux;
+#pragma link C++ class genie::flux::GFluxFoldedRates;
 
 #pragma link C++ class genie::flux::GAtmoFlux;
 #pragma link C++ class genie::flux::GFLUKAAtmoFlux;
@@ -39,12 +40,16 @@
 #pragma link C++ class genie::flux::GSimpleNtpMeta+;
 
 #pragma link C++ class genie::flux::GSimpleNtpFlux;
+#pragma link C++ class genie::flux::GSimpleNtpFlatFile;
 
 #pragma link C++ class genie::flux::GFluxBlender;
 
 #pragma link C++ class genie::flux::GFlavorMixerI;
 #pragma link C++ class genie::flux::GFlavorMixerFactory;
 #pragma link C++ class genie::flux::GFlavorMap;
+#pragma link C++ class genie::flux::GEarthMatterProfile;
+#pragma link C++ struct genie::flux::GEarthSegment;
+#pragma link C++ struct genie::flux::GEarthPath;
 
 #pragma link C++ class genie::flux::GFluxDriverFactory;
 
@@ -55,8 +55,8 @@ void GeomVolSelectorFiducial::TrimSegment(PathSegment& ps) const
     Double_t dist = ps.fRayDist;
     StepRangeSet::iterator srs_itr = ps.fStepRangeSet.begin();
     StepRangeSet::iterator srs_end = ps.fStepRangeSet.end();
-    StepRangeSet modifiedStepRangeSet;
     Bool_t ismod = false;
+    fTrimmedSteps.clear();
 
     // loop over steps within this segement
     for ( ; srs_itr != srs_end; ++srs_itr ) {
@@ -70,13 +70,13 @@ void GeomVolSelectorFiducial::TrimSegment(PathSegment& ps) const
       // build up new step list
       bool nonzerostep = ( step1.first != step1.second );
       if ( nonzerostep || ! fRemoveEntries ) {
-        modifiedStepRangeSet.push_back(step1);
+        fTrimmedSteps.push_back(step1);
         if (split) {
-          modifiedStepRangeSet.push_back(step2);
+          fTrimmedSteps.push_back(step2);
         }
       }
     } // loop over step range set elements
-    if ( ismod ) ps.fStepRangeSet = modifiedStepRangeSet;
+    if ( ismod ) ps.fStepRangeSet.assign(fTrimmedSteps.begin(),fTrimmedSteps.end());
 
   } // fIsHit
 
@@ -165,6 +165,25 @@ void GeomVolSelectorFiducial::BeginPSList(const PathSegmentList* untrimmed) cons
 
 }
 
+//___________________________________________________________________________
+bool GeomVolSelectorFiducial::SwimRange(const TVector3& start, const TVector3& dir,
+                                        Double_t& smin, Double_t& smax) const
+{
+  // Analytic intersection of the ray with the fiducial shape, before any
+  // navigation: steps outside [fDistIn,fDistOut] would all be trimmed.
+  // A reversed selection keeps everything outside, so the whole ray.
+
+  if ( ! GeomVolSelectorBasic::SwimRange(start,dir,smin,smax) ) return false;
+  if ( fSelectReverse || ! fShape ) return true;
+
+  RayIntercept intercept = fShape->Intercept(start,dir);
+  if ( ! intercept.fIsHit || intercept.fDistOut <= 0 ) return false;
+
+  smin = TMath::Max(smin, intercept.fDistIn);
+  smax = TMath::Min(smax, intercept.fDistOut);
+  return ( smax > smin );
+}
+
 //___________________________________________________________________________
 void GeomVolSelectorFiducial::EndPSList() const
 {
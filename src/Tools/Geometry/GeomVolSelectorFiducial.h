@@ -53,6 +53,11 @@ public :
   void BeginPSList(const PathSegmentList* untrimmed) const;
   void EndPSList() const;
 
+  /// restrict the navigation to the ray's interval within the fiducial
+  /// shape (unless the selection is reversed)
+  bool SwimRange(const TVector3& start, const TVector3& dir,
+                 double& smin, double& smax) const;
+
   // allow the selection to be reversed (i.e. exclude "fid" region)
   void SetReverseFiducial(Bool_t reverse=true) { fSelectReverse = reverse; }
 
@@ -89,6 +94,7 @@ protected:
   // values calculated during BeginPSList():
   mutable const PathSegmentList* fCurrPathSegmentList;  // reference only, for ray info
   mutable RayIntercept fIntercept;  // current intercept parameters
+  mutable StepRangeSet fTrimmedSteps; // trimmed steps of the current segment (storage reused)
 
 };
 
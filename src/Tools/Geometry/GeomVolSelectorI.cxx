@@ -7,6 +7,8 @@
 */
 //____________________________________________________________________________
 
+#include <cfloat>
+
 #include "Framework/Messenger/Messenger.h"
 #include "Tools/Geometry/GeomVolSelectorI.h"
 #include "Tools/Geometry/PathSegmentList.h"
@@ -36,26 +38,35 @@ GeomVolSelectorI::~GeomVolSelectorI()
 PathSegmentList*
 GeomVolSelectorI::GenerateTrimmedList(const PathSegmentList* untrimmed) const
 {
-  this->BeginPSList(untrimmed);
-
-  PathSegmentList* trimmed = new PathSegmentList();
-  trimmed->SetStartInfo(untrimmed->GetStartPos(),untrimmed->GetDirection());
-
-  const genie::geometry::PathSegmentList::PathSegmentV_t& segments =
-    untrimmed->GetPathSegmentV();
-  genie::geometry::PathSegmentList::PathSegVCItr_t sitr = segments.begin();
-  genie::geometry::PathSegmentList::PathSegVCItr_t sitr_end = segments.end();
+  PathSegmentList* trimmed = new PathSegmentList(*untrimmed);
+  this->TrimList(trimmed);
+  return trimmed;
+}
+//___________________________________________________________________________
+bool GeomVolSelectorI::SwimRange(const TVector3& /*start*/, const TVector3& /*dir*/,
+                                 double& smin, double& smax) const
+{
+  smin = 0;
+  smax = DBL_MAX;
+  return true;
+}
+//___________________________________________________________________________
+void GeomVolSelectorI::TrimList(PathSegmentList* list) const
+{
+  this->BeginPSList(list);
 
-  for ( ; sitr != sitr_end ; ++sitr ) {
-    PathSegment ps = *sitr;  // new PathSegment is a copy of old
+  // trim the segments in place, moving the kept ones down over the removed
+  // ones (re-using the storage of the latter)
+  size_t nkeep = 0;
+  for ( size_t i = 0; i < list->size(); ++i ) {
+    PathSegment& ps = list->GetSegment(i);
     this->TrimSegment(ps);
     if ( fRemoveEntries && ps.GetSummedStepRange() == 0 ) continue; // remove null segments
-    // now put (adjusted) entry on trimmed list
-    trimmed->AddSegment(ps);
+    if ( nkeep != i ) list->GetSegment(nkeep) = ps;
+    ++nkeep;
   }
+  list->Truncate(nkeep);
 
   this->EndPSList();
-
-  return trimmed;
 }
 //___________________________________________________________________________
@@ -39,6 +39,9 @@ public :
   /// relinquishes ownership of returned object
   virtual PathSegmentList* GenerateTrimmedList(const PathSegmentList* untrimmed) const;
 
+  /// trim the segments of the input list in place
+  virtual void TrimList(PathSegmentList* list) const;
+
   /// This is the method every derived version must implement
   /// To reject a segment outright:  segment.fStepRangeSet.clear()
   virtual void TrimSegment(PathSegment& segment) const = 0;
@@ -50,6 +53,15 @@ public :
   virtual void BeginPSList(const PathSegmentList* untrimmed) const = 0;
   virtual void EndPSList() const = 0;
 
+  /// Range [smin,smax] of distances along the ray (from start, in the
+  /// given direction; "top vol" coords & units) out of which every step
+  /// would be rejected, so that the geometry need only be navigated within
+  /// it. Returns false if the whole ray would be rejected (no navigation).
+  /// By default the whole ray [0,DBL_MAX] is selected.
+  /// Called after SetCurrentRay() and before BeginPSList().
+  virtual bool SwimRange(const TVector3& start, const TVector3& dir,
+                         double& smin, double& smax) const;
+
   /// configure for individual neutrino ray
   void SetCurrentRay(const TLorentzVector& x4, const TLorentzVector& p4)
   { fX4 = x4; fP4 = p4; }
@@ -59,8 +59,8 @@ void GeomVolSelectorRockBox::TrimSegment(PathSegment& ps) const
     Double_t dist = ps.fRayDist;
     StepRangeSet::iterator srs_itr = ps.fStepRangeSet.begin();
     StepRangeSet::iterator srs_end = ps.fStepRangeSet.end();
-    StepRangeSet modifiedStepRangeSet;
     Bool_t ismod = false;
+    fTrimmedSteps.clear();
 
     // loop over steps within this segement
     for ( ; srs_itr != srs_end; ++srs_itr ) {
@@ -74,13 +74,13 @@ void GeomVolSelectorRockBox::TrimSegment(PathSegment& ps) const
       // build up new step list
       bool nonzerostep = ( step1.first != step1.second );
       if ( nonzerostep || ! fRemoveEntries ) {
-        modifiedStepRangeSet.push_back(step1);
+        fTrimmedSteps.push_back(step1);
         if (split) {
-          modifiedStepRangeSet.push_back(step2);
+          fTrimmedSteps.push_back(step2);
         }
       }
     } // loop over step range set elements
-    if ( ismod ) ps.fStepRangeSet = modifiedStepRangeSet;
+    if ( ismod ) ps.fStepRangeSet.assign(fTrimmedSteps.begin(),fTrimmedSteps.end());
 
   } // fIsHit
 
@@ -96,7 +96,7 @@ void GeomVolSelectorRockBox::BeginPSList(const PathSegmentList* untrimmed) const
 
   fCurrPathSegmentList = untrimmed;
 
-  MakeRockBox();
+  MakeRockBox(fCurrPathSegmentList->GetDirection());
 
   if ( ! fRockBoxShape ) {
     LOG("GeomVolSel", pFATAL) << "no shape defined";
@@ -113,6 +113,25 @@ void GeomVolSelectorRockBox::BeginPSList(const PathSegmentList* untrimmed) const
 
 }
 
+//___________________________________________________________________________
+bool GeomVolSelectorRockBox::SwimRange(const TVector3& start, const TVector3& dir,
+                                       Double_t& smin, Double_t& smax) const
+{
+  // Steps outside the (energy dependent) rock box would all be trimmed
+
+  if ( ! GeomVolSelectorFiducial::SwimRange(start,dir,smin,smax) ) return false;
+
+  MakeRockBox(dir);
+  if ( ! fRockBoxShape ) return true;
+
+  RayIntercept intercept = fRockBoxShape->Intercept(start,dir);
+  if ( ! intercept.fIsHit || intercept.fDistOut <= 0 ) return false;
+
+  smin = TMath::Max(smin, intercept.fDistIn);
+  smax = TMath::Min(smax, intercept.fDistOut);
+  return ( smax > smin );
+}
+
 //___________________________________________________________________________
 void GeomVolSelectorRockBox::EndPSList() const
 {
@@ -159,7 +178,7 @@ void GeomVolSelectorRockBox::SetMinimumWall(Double_t w)
   }
 }
 //___________________________________________________________________________
-void GeomVolSelectorRockBox::MakeRockBox() const
+void GeomVolSelectorRockBox::MakeRockBox(const TVector3& dir) const
 {
   // This sets parameters for a box
 
@@ -168,7 +187,7 @@ void GeomVolSelectorRockBox::MakeRockBox() const
   double boxXYZMin[3], boxXYZMax[3];
   for ( int j = 0; j < 3; ++j ) {
     double dmin = 0, dmax = 0;
-    double dircos = fCurrPathSegmentList->GetDirection()[j];
+    double dircos = dir[j];
     if ( dircos > 0 ) dmin =  dircos*energy/fDeDx;  // pad upstream
     else              dmax = -dircos*energy/fDeDx;
 
@@ -188,7 +207,10 @@ void GeomVolSelectorRockBox::MakeRockBox() const
     }
   }
 
-  FidPolyhedron* poly = new FidPolyhedron();
+  // re-use the box of the previous ray
+  FidPolyhedron* poly = dynamic_cast<FidPolyhedron*>(fRockBoxShape);
+  if ( poly ) poly->clear();
+  else        poly = new FidPolyhedron();
   // careful about sign of "d" vs. direction normal
   PlaneParam pln0(-1,0,0, boxXYZMin[0]);  poly->push_back(pln0);
   PlaneParam pln1(0,-1,0, boxXYZMin[1]);  poly->push_back(pln1);
@@ -197,8 +219,10 @@ void GeomVolSelectorRockBox::MakeRockBox() const
   PlaneParam pln4(0,+1,0,-boxXYZMax[1]);  poly->push_back(pln4);
   PlaneParam pln5(0,0,+1,-boxXYZMax[2]);  poly->push_back(pln5);
 
-  if ( fRockBoxShape ) delete fRockBoxShape;
-  fRockBoxShape = poly;
+  if ( fRockBoxShape != poly ) {
+    if ( fRockBoxShape ) delete fRockBoxShape;
+    fRockBoxShape = poly;
+  }
 
 #ifdef RWH_DEBUG
   static bool first = true;
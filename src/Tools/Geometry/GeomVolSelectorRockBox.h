@@ -47,6 +47,10 @@ public :
   void BeginPSList(const PathSegmentList* untrimmed) const;
   void EndPSList() const;
 
+  /// restrict the navigation to the ray's interval within the rock box
+  bool SwimRange(const TVector3& start, const TVector3& dir,
+                 double& smin, double& smax) const;
+
   //
   // set fiducial volume parameter (call only once)
   //   in "top vol" coordinates and units
@@ -67,7 +71,7 @@ public :
 
 protected:
 
-  void MakeRockBox() const;
+  void MakeRockBox(const TVector3& dir) const;
 
   Double_t  fMinimalXYZMin[3];   /// interior box lower corner
   Double_t  fMinimalXYZMax[3];   /// interior box upper corner
@@ -186,7 +186,7 @@ TVector3 PathSegment::GetPosition(Double_t fractrim) const
 //===========================================================================
 //___________________________________________________________________________
 PathSegmentList::PathSegmentList(void)
-  : fDoCrossCheck(false), fPrintVerbose(false)
+  : fNSegments(0), fDoCrossCheck(false), fPrintVerbose(false)
 {
 
 }
@@ -208,10 +208,19 @@ void PathSegmentList::SetAllToZero(void)
 
   this->fStartPos.SetXYZ(0,0,1e37); // clear cache of position/direction
   this->fDirection.SetXYZ(0,0,0);   //
-  this->fSegmentList.clear();       // clear the vector
+  this->fNSegments = 0;             // clear the segments (kept for reuse)
   this->fMatStepSum.clear();        // clear the re-factorized info
 }
 
+//___________________________________________________________________________
+void PathSegmentList::AddSegment(const PathSegment& ps)
+{
+  // overwrite a segment of a previous ray if any, reusing its storage
+  if ( fNSegments < fSegmentList.size() ) fSegmentList[fNSegments] = ps;
+  else                                    fSegmentList.push_back(ps);
+  ++fNSegments;
+}
+
 //___________________________________________________________________________
 void PathSegmentList::SetStartInfo(const TVector3& pos, const TVector3& dir)
 {
@@ -230,13 +239,24 @@ void PathSegmentList::FillMatStepSum(void)
 {
   fMatStepSum.clear();
 
-  PathSegmentList::PathSegVCItr_t sitr = fSegmentList.begin();
-  PathSegmentList::PathSegVCItr_t sitr_end = fSegmentList.end();
+  // consecutive segments are often in the same material and the number of
+  // materials along a ray is small: look for the last one first, then scan
+  size_t imat = 0;
+  PathSegmentList::PathSegVCItr_t sitr = this->begin();
+  PathSegmentList::PathSegVCItr_t sitr_end = this->end();
   for ( ; sitr != sitr_end ; ++sitr ) {
     const PathSegment& ps = *sitr;
     const TGeoMaterial* mat  = ps.fMaterial;
+    if ( imat >= fMatStepSum.size() || fMatStepSum[imat].first != mat ) {
+      for ( imat = 0; imat < fMatStepSum.size(); ++imat ) {
+        if ( fMatStepSum[imat].first == mat ) break;
+      }
+      if ( imat == fMatStepSum.size() ) {
+        fMatStepSum.push_back(std::make_pair(mat,0.));
+      }
+    }
     // use the post-trim limits on how much material is stepped through
-    fMatStepSum[mat] += ps.GetSummedStepRange();
+    fMatStepSum[imat].second += ps.GetSummedStepRange();
   }
 
 }
@@ -244,7 +264,6 @@ void PathSegmentList::FillMatStepSum(void)
 //___________________________________________________________________________
 void PathSegmentList::Copy(const PathSegmentList & plist)
 {
-  fSegmentList.clear();
   fMatStepSum.clear();
 
   // copy the segments
@@ -256,7 +275,8 @@ void PathSegmentList::Copy(const PathSegmentList & plist)
   // other elements
   fStartPos     = plist.fStartPos;
   fDirection    = plist.fDirection;
-  fSegmentList  = plist.fSegmentList;
+  fSegmentList.assign(plist.begin(), plist.end());
+  fNSegments    = plist.fNSegments;
   fMatStepSum   = plist.fMatStepSum;
   fDoCrossCheck = plist.fDoCrossCheck;
   fPrintVerbose = plist.fPrintVerbose;
@@ -269,8 +289,8 @@ void PathSegmentList::CrossCheck(double& mxddist, double& mxdstep) const
   double dstep, ddist;
   mxdstep = 0;
   mxddist = 0;
-  PathSegmentList::PathSegVCItr_t sitr = fSegmentList.begin();
-  PathSegmentList::PathSegVCItr_t sitr_end = fSegmentList.end();
+  PathSegmentList::PathSegVCItr_t sitr = this->begin();
+  PathSegmentList::PathSegVCItr_t sitr_end = this->end();
   for ( ; sitr != sitr_end ; ++sitr ) {
     const PathSegment& ps = *sitr;
     ps.DoCrossCheck(fStartPos,ddist,dstep);
@@ -291,8 +311,8 @@ void PathSegmentList::Print(ostream & stream) const
 
   double dstep, ddist, mxdstep = 0, mxddist = 0;
   int k = 0, nseg = 0;
-  PathSegmentList::PathSegVCItr_t sitr = fSegmentList.begin();
-  PathSegmentList::PathSegVCItr_t sitr_end = fSegmentList.end();
+  PathSegmentList::PathSegVCItr_t sitr = this->begin();
+  PathSegmentList::PathSegVCItr_t sitr_end = this->end();
   for ( ; sitr != sitr_end ; ++sitr, ++k ) {
     const PathSegment& ps = *sitr;
     ++nseg;
@@ -8,6 +8,11 @@
          geometry materials.  Good for a single starting position and
          travelling along the direction of the neutrino 4-momentum.
 
+         The list is meant to be refilled for each ray: SetAllToZero() only
+         resets the number of segments in use, so that the segments (with
+         their step ranges and path strings) and the material step sums are
+         overwritten in place rather than re-allocated.
+
 \author  Robert Hatcher <rhatcher@fnal.gov>
          FNAL
 
@@ -133,18 +138,24 @@ public :
   void    SetStartInfo    (const TVector3& pos = TVector3(0,0,1e37),
                            const TVector3& dir = TVector3(0,0,0)     );
   bool    IsSameStart     (const TVector3& pos, const TVector3& dir) const;
-  void    AddSegment      (const PathSegment& ps) { fSegmentList.push_back(ps); }
+  void    AddSegment      (const PathSegment& ps);
+  void    Truncate        (size_t n) { if ( n < fNSegments ) fNSegments = n; }
 
   const TVector3& GetDirection() const { return fDirection; }
   const TVector3& GetStartPos() const  { return fStartPos; }
 
-  typedef std::list<PathSegment> PathSegmentV_t;
+  typedef std::vector<PathSegment> PathSegmentV_t;
   typedef PathSegmentV_t::const_iterator PathSegVCItr_t;
 
-  const   PathSegmentV_t&   GetPathSegmentV (void) const { return fSegmentList; }
-  size_t                    size(void) const { return fSegmentList.size(); }
+  /// segments in use
+  PathSegVCItr_t            begin (void) const { return fSegmentList.begin(); }
+  PathSegVCItr_t            end   (void) const { return fSegmentList.begin() + fNSegments; }
+  size_t                    size  (void) const { return fNSegments; }
+  const PathSegment &       GetSegment (size_t i) const { return fSegmentList[i]; }
+  PathSegment &             GetSegment (size_t i)       { return fSegmentList[i]; }
 
-  typedef std::map<const TGeoMaterial*,Double_t> MaterialMap_t;
+  /// step sums by material, in the order the materials are first stepped in
+  typedef std::vector< std::pair<const TGeoMaterial*,Double_t> > MaterialMap_t;
   typedef MaterialMap_t::const_iterator MaterialMapCItr_t;
 
   void                      FillMatStepSum   (void);
@@ -169,8 +180,9 @@ public :
   TVector3         fStartPos;  ///< starting position (in top vol coords)
   TVector3         fDirection; ///< direction (in top vol coords)
 
-  /// Actual list of segments
+  /// Actual list of segments (the first fNSegments are in use)
   PathSegmentV_t   fSegmentList;
+  size_t           fNSegments;
 
   /// Segment list re-evaluated by material for fast lookup of path lengths
   MaterialMap_t    fMatStepSum;
@@ -14,10 +14,16 @@
 */
 //____________________________________________________________________________
 
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
+#include <cfloat>
 #include <iomanip>
 #include <set>
+#include <map>
+#include <atomic>
+#include <mutex>
+#include <thread>
 
 #include <TGeoVolume.h>
 #include <TGeoManager.h>
@@ -33,6 +39,7 @@
 #include <TMath.h>
 #include <TPolyMarker3D.h>
 #include <TGeoBBox.h>
+#include <TGeoNavigator.h>
 
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/Conventions/Units.h"
@@ -47,6 +54,9 @@
 #include "Framework/ParticleData/PDGCodeList.h"
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/EventGenCost.h"
+#include "Framework/Utils/StartupProfile.h"
+#include "Framework/Utils/TraceScope.h"
 
 using namespace genie;
 using namespace genie::geometry;
@@ -56,6 +66,85 @@ using namespace genie::controls;
 //#define RWH_DEBUG_2
 //#define RWH_COUNTVOLS
 
+//___________________________________________________________________________
+namespace {
+  // max number of rays whose path lengths are computed in one batch
+  const unsigned int kMaxRayBatch = 100000;
+
+  // max number of max path length scans in convergence mode
+  const int kMaxScanBlocks = 1000;
+
+  // navigation contexts of all geometry drivers, keyed by (driver, thread)
+  typedef std::pair<unsigned long, std::thread::id> NavKey_t;
+  std::mutex                                 gNavContextMutex;
+  std::map<NavKey_t, ROOTGeomNavContext *>   gNavContexts;
+  std::atomic<unsigned long>                 gNNavIds(0);
+
+  // context looked-up last by the calling thread
+  thread_local unsigned long        gLastNavId      = 0;
+  thread_local ROOTGeomNavContext * gLastNavContext = 0;
+
+  // swim cache: max number of cached rays per thread, and distance (top vol
+  // units) by which boundary points are pushed to check the next volume
+  const unsigned int kMaxSwimCacheRays = 200000;
+  const double       kSwimCachePush    = 1.E-6;
+}
+
+//___________________________________________________________________________
+// Volumes crossed by the last swum ray of each flux window & direction cell
+// (one cache per thread, kept in its navigation context)
+namespace genie    {
+namespace geometry {
+
+class ROOTGeomSwimCache {
+public:
+  struct Cell_t {
+    long i[6];  ///< position (3) and direction (3) cell indices
+    bool operator < (const Cell_t & c) const
+      { return std::lexicographical_compare(i, i+6, c.i, c.i+6); }
+  };
+  struct Volume_t {
+    const TGeoVolume * fVolume;  ///< crossed volume
+    TGeoHMatrix        fMatrix;  ///< its global matrix
+    int                fLevel;   ///< its depth in the geometry tree
+    string             fPath;    ///< its path (if needed)
+  };
+  struct Ray_t {
+    Ray_t() : fOutside(false) { }
+    bool               fOutside; ///< does the ray start outside the geometry?
+    vector<Volume_t>   fVolumes; ///< crossed volumes, in order
+  };
+
+  void Store(const Cell_t & cell, const Ray_t & ray) {
+    if ( fRays.size() >= kMaxSwimCacheRays ) fRays.clear();
+    fRays[cell] = ray;
+  }
+  const Ray_t * Find(const Cell_t & cell) const {
+    std::map<Cell_t, Ray_t>::const_iterator it = fRays.find(cell);
+    return ( it != fRays.end() ) ? &(it->second) : 0;
+  }
+
+private:
+  std::map<Cell_t, Ray_t> fRays;
+};
+
+}      // geometry namespace
+}      // genie    namespace
+
+namespace {
+  // flux window & direction cell of the input ray (top vol coord & units)
+  ROOTGeomSwimCache::Cell_t SwimCell(
+      const TVector3 & r0, const TVector3 & udir, double dx, double dtheta)
+  {
+    ROOTGeomSwimCache::Cell_t cell;
+    for (int k = 0; k < 3; k++) {
+      cell.i[k]   = (long) TMath::Floor(r0[k]   / dx);
+      cell.i[k+3] = (long) TMath::Floor(udir[k] / dtheta);
+    }
+    return cell;
+  }
+}
+
 #ifdef RWH_COUNTVOLS
 // keep some statistics about how many volumes traversed for each box face
 long int mxsegments = 0; //rwh
@@ -121,6 +210,8 @@ const PathLengthList & ROOTGeomAnalyzer::ComputeMaxPathLengths(void)
 /// geometry. The computed path lengths are in SI units (kgr/m^2, if
 /// density weighting is enabled)
 
+  GTRACE_SCOPE("ROOTGeomAnalyzer::ComputeMaxPathLengths");
+
   LOG("GROOTGeom", pNOTICE)
      << "Computing the maximum path lengths for all materials";
 
@@ -133,15 +224,18 @@ const PathLengthList & ROOTGeomAnalyzer::ComputeMaxPathLengths(void)
   fCurrMaxPathLengthList->SetAllToZero();
 
   //-- select maximum path length calculation method
-  if ( fFlux ) {
+  if ( fConvBlocks > 0 ) {
+    this->MaxPathLengthsConverge();
+  } else if ( fFlux ) {
     this->MaxPathLengthsFluxMethod();
-    // clear any accumulated exposure accounted generated
-    // while exploring the geometry
-    fFlux->Clear("CycleHistory");
   } else {
     this->MaxPathLengthsBoxMethod();
   }
 
+  // clear any accumulated exposure accounted generated
+  // while exploring the geometry
+  if ( fFlux ) fFlux->Clear("CycleHistory");
+
   return *fCurrMaxPathLengthList;
 }
 
@@ -155,6 +249,8 @@ const PathLengthList & ROOTGeomAnalyzer::ComputePathLengths(
 /// The computed path lengths are in SI units (kgr/m^2, if density
 /// weighting is enabled)
 
+  GTRACE_SCOPE("ROOTGeomAnalyzer::ComputePathLengths");
+
   //LOG("GROOTGeom", pDEBUG)
   //     << "Computing path-lengths for the input neutrino";
 
@@ -170,6 +266,23 @@ const PathLengthList & ROOTGeomAnalyzer::ComputePathLengths(
     fGeomVolSelector->SetSI2Local(1/this->LengthUnits());
   }
 
+  ROOTGeomNavContext & ctx = this->NavContext();
+
+  this->RayPathLengths(x, p, ctx);
+
+  return *ctx.fPathLengthList;
+}
+
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::RayPathLengths(
+    const TLorentzVector & x, const TLorentzVector & p,
+    ROOTGeomNavContext & ctx)
+{
+/// Computes the path-lengths (SI units) of the input ray as in
+/// ComputePathLengths(), filling the path-length list of the input
+/// navigation context. Apart from the volume selector, used by
+/// ComputePathLengths() only, it does not modify the geometry driver.
+
   TVector3 udir = p.Vect().Unit(); // unit vector along direction
   TVector3 pos = x.Vect();         // initial position
   this->SI2Local(pos);             // SI -> curr geom units
@@ -180,27 +293,110 @@ const PathLengthList & ROOTGeomAnalyzer::ComputePathLengths(
   }
 
   // reset current list of path-lengths
-  fCurrPathLengthList->SetAllToZero();
+  PathLengthList & pllst = *ctx.fPathLengthList;
+  pllst.SetAllToZero();
+
+  this->Swim(pos, udir, ctx);
 
-  //loop over materials & compute the path-length
-  vector<int>::iterator itr;
-  for (itr=fCurrPDGCodeList->begin();itr!=fCurrPDGCodeList->end();itr++) {
+  // path-length of all target nuclei at once: (summed step of each material)
+  // x (material x target nucleus weight table)
+  const int ntgt = fCurrPDGCodeList->size();
+  std::vector<double> & pl = ctx.fTgtPathLengths;
+  pl.assign(ntgt, 0.);
 
-    int pdgc = *itr;
+  PathSegmentList::MaterialMapCItr_t mitr     =
+    ctx.fPathSegmentList->GetMatStepSumMap().begin();
+  PathSegmentList::MaterialMapCItr_t mitr_end =
+    ctx.fPathSegmentList->GetMatStepSumMap().end();
+  for ( ; mitr != mitr_end; ++mitr ) {
+    const TGeoMaterial * mat = mitr->first;
+    if ( ! mat ) continue;  // segment outside geometry has no material
+    double step = mitr->second;
+    const double * w = this->WeightTableRow(mat);
+    if ( w ) {
+      for (int j = 0; j < ntgt; j++) pl[j] += step * w[j];
+    } else {
+      for (int j = 0; j < ntgt; j++)
+        pl[j] += step * this->GetWeight(mat, (*fCurrPDGCodeList)[j]);
+    }
+  }
 
-    Double_t pl = this->ComputePathLengthPDG(pos,udir,pdgc);
-    fCurrPathLengthList->AddPathLength(pdgc,pl);
+  for (int j = 0; j < ntgt; j++) {
+    int pdgc = (*fCurrPDGCodeList)[j];
+    pllst.AddPathLength(pdgc,pl[j]);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
     LOG("GROOTGeom", pINFO)
-      <<"Calculated path length for material: " << pdgc << " = " << pl;
+      <<"Calculated path length for material: " << pdgc << " = " << pl[j];
 #endif
 
-  } // loop over materials
+  } // loop over target nuclei
+
+  this->Local2SI(pllst); // curr geom units -> SI
+}
+
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::ComputePathLengthsBatch(
+    const vector<TLorentzVector> & x4, const vector<TLorentzVector> & p4,
+    vector<double> & pl)
+{
+/// Computes the path-lengths (SI units) of the input rays, in the order of
+/// the materials of the max path length list: pl[iray*nmat + imat].
+/// With ScannerNThreads() > 1 the rays are shared between threads, each
+/// navigating with its own context. The results do not depend on the
+/// number of threads. A volume selector keeps the rays in one thread, as
+/// it holds the current ray.
+
+  GTRACE_SCOPE("ROOTGeomAnalyzer::ComputePathLengthsBatch");
+
+  const unsigned int nrays = x4.size();
+  const unsigned int nmat  = fCurrMaxPathLengthList->size();
+  pl.assign(nrays * nmat, 0.);
+  if(nrays == 0) return;
+
+  unsigned int nthreads = (fNThreads > 1) ? (unsigned int) fNThreads : 1;
+  nthreads = TMath::Min(nthreads, nrays);
+  if ( fGeomVolSelector ) nthreads = 1;
+
+  if ( nthreads == 1 ) {
+    for (unsigned int iray = 0; iray < nrays; iray++) {
+      const PathLengthList & pllst = this->ComputePathLengths(x4[iray], p4[iray]);
+      PathLengthList::const_iterator pl_iter = pllst.begin();
+      for (unsigned int imat = 0; pl_iter != pllst.end(); ++pl_iter, ++imat) {
+        pl[iray*nmat + imat] = pl_iter->second;
+      }
+    }
+    return;
+  }
+
+  this->SetMaxThreads(nthreads);
+
+  std::atomic<unsigned int> next(0);
+  vector<std::thread> workers;
+  for (unsigned int it = 0; it < nthreads; it++) {
+    workers.push_back(std::thread([&]() {
+      ROOTGeomNavContext & ctx = this->NavContext();
+      unsigned int iray;
+      while ( (iray = next++) < nrays ) {
+        this->RayPathLengths(x4[iray], p4[iray], ctx);
+        const PathLengthList & pllst = *ctx.fPathLengthList;
+        PathLengthList::const_iterator pl_iter = pllst.begin();
+        for (unsigned int imat = 0; pl_iter != pllst.end(); ++pl_iter, ++imat) {
+          pl[iray*nmat + imat] = pl_iter->second;
+        }
+      }
+    }));
+  }
+  for (unsigned int it = 0; it < nthreads; it++) workers[it].join();
+}
 
-  this->Local2SI(*fCurrPathLengthList); // curr geom units -> SI
+//___________________________________________________________________________
+const PathSegmentList & ROOTGeomAnalyzer::CurrentPathSegmentList(void)
+{
+/// Path segments of the last ray swum (by ComputePathLengths() or
+/// GenerateVertex()) in the calling thread, eg for diagnostics
 
-  return *fCurrPathLengthList;
+  return *(this->NavContext().fPathSegmentList);
 }
 
 //___________________________________________________________________________
@@ -210,17 +406,26 @@ const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
 /// Generates a random vertex, within the detector material with the input
 /// PDG code, for a neutrino starting from point x (master coord) and
 /// travelling along the direction of p (master coord).
+/// The ray is not swum again if it is the one of the last ComputePathLengths()
+/// call of the thread. With VtxFromSegments() the vertex volume and material
+/// are also taken from the swum path segments, instead of being looked-up in
+/// the geometry.
+
+  GTRACE_SCOPE("ROOTGeomAnalyzer::GenerateVertex");
 
   LOG("GROOTGeom", pNOTICE)
        << "Generating vtx in material: " << tgtpdg
        << " along the input neutrino direction";
 
+  ROOTGeomNavContext & ctx = this->NavContext();
+  TGeoNavigator * nav = ctx.fNavigator;
+
   int nretry = 0;
   retry:  // goto label in case of abject failure
   nretry++;
 
   // reset current interaction vertex
-  fCurrVertex->SetXYZ(0.,0.,0.);
+  ctx.fVertex.SetXYZ(0.,0.,0.);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("GROOTGeom", pDEBUG)
@@ -244,11 +449,11 @@ const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
     this->Master2TopDir(udir);   // transform direction (master -> top)
   }
 
-  double maxwgt_dist = this->ComputePathLengthPDG(pos,udir,tgtpdg);
+  double maxwgt_dist = this->ComputePathLengthPDG(pos,udir,tgtpdg,ctx);
   if ( maxwgt_dist <= 0 ) {
     LOG("GROOTGeom", pERROR)
      << "The current trajectory does not cross the selected material!!";
-    return *fCurrVertex;
+    return ctx.fVertex;
   }
 
   // generate random number between 0 and max_dist
@@ -264,26 +469,26 @@ const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
        << "Generated 'distance' in selected material = " << genwgt_dist;
 #ifdef RWH_DEBUG
   if ( ( fDebugFlags & 0x01 ) ) {
-    fCurrPathSegmentList->SetDoCrossCheck(true);       //RWH
-    LOG("GROOTGeom", pINFO) << *fCurrPathSegmentList;  //RWH
+    ctx.fPathSegmentList->SetDoCrossCheck(true);       //RWH
+    LOG("GROOTGeom", pINFO) << *ctx.fPathSegmentList;  //RWH
     double mxddist = 0, mxdstep = 0;
-    fCurrPathSegmentList->CrossCheck(mxddist,mxdstep);
+    ctx.fPathSegmentList->CrossCheck(mxddist,mxdstep);
     fmxddist = TMath::Max(fmxddist,mxddist);
     fmxdstep = TMath::Max(fmxdstep,mxdstep);
   }
 #endif
 
   // compute the pdg weight for each material just once, then use a stl map
-  PathSegmentList::MaterialMap_t wgtmap;
+  std::map<const TGeoMaterial*, double> wgtmap;
   PathSegmentList::MaterialMapCItr_t mitr     =
-    fCurrPathSegmentList->GetMatStepSumMap().begin();
+    ctx.fPathSegmentList->GetMatStepSumMap().begin();
   PathSegmentList::MaterialMapCItr_t mitr_end =
-    fCurrPathSegmentList->GetMatStepSumMap().end();
+    ctx.fPathSegmentList->GetMatStepSumMap().end();
   // loop over map to get tgt weight for each material (once)
   // steps outside the geometry may have no assigned material
   for ( ; mitr != mitr_end; ++mitr ) {
     const TGeoMaterial* mat = mitr->first;
-    double wgt = ( mat ) ? this->GetWeight(mat,tgtpdg) : 0;
+    double wgt = ( mat ) ? this->TargetWeight(mat,tgtpdg) : 0;
     wgtmap[mat] = wgt;
 #ifdef RWH_DEBUG
     if ( ( fDebugFlags & 0x02 ) ) {
@@ -294,9 +499,9 @@ const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
   }
 
   // walk down the path to pick the vertex
-  const genie::geometry::PathSegmentList::PathSegmentV_t& segments =
-    fCurrPathSegmentList->GetPathSegmentV();
+  const genie::geometry::PathSegmentList & segments = *ctx.fPathSegmentList;
   genie::geometry::PathSegmentList::PathSegVCItr_t sitr;
+  const genie::geometry::PathSegment * vtxseg = 0;
   double walked = 0;
   for ( sitr = segments.begin(); sitr != segments.end(); ++sitr) {
     const genie::geometry::PathSegment& seg = *sitr;
@@ -333,8 +538,11 @@ const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
           << genwgt_dist << " " << walked << " " << wgtstep;
       }
       pos = seg.GetPosition(frac);
-      fGeometry -> SetCurrentPoint (pos[0],pos[1],pos[2]);
-      fGeometry -> FindNode();
+      vtxseg = &seg;
+      if ( ! fVtxFromSegments ) {
+        nav -> SetCurrentPoint (pos[0],pos[1],pos[2]);
+        nav -> FindNode();
+      }
       LOG("GROOTGeom", pINFO)
         << "Choose vertex position in " << seg.fVolume->GetName() << " "
          << utils::print::Vec3AsString(&pos);
@@ -343,13 +551,24 @@ const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
     walked = beyond;
   }
 
-  LOG("GROOTGeom", pNOTICE)
-     << "The vertex was placed in volume: "
-     << fGeometry->GetCurrentVolume()->GetName()
-     << ", path: " << fGeometry->GetPath();
+  bool ok = false;
+  if ( fVtxFromSegments && vtxseg ) {
+    LOG("GROOTGeom", pNOTICE)
+       << "The vertex was placed in volume: " << vtxseg->fVolume->GetName()
+#ifdef PATHSEG_KEEP_PATH
+       << ", path: " << vtxseg->fPathString
+#endif
+       ;
+    ok = this->HasTargetMaterial(vtxseg->fMaterial,tgtpdg);
+  } else {
+    LOG("GROOTGeom", pNOTICE)
+       << "The vertex was placed in volume: "
+       << nav->GetCurrentVolume()->GetName()
+       << ", path: " << nav->GetPath();
 
-  // warn for any volume overshoots
-  bool ok = this->FindMaterialInCurrentVol(tgtpdg);
+    // warn for any volume overshoots
+    ok = this->FindMaterialInCurrentVol(tgtpdg,nav);
+  }
   if (!ok) {
     LOG("GROOTGeom", pWARN)
        << "Geometry volume was probably overshot";
@@ -369,14 +588,56 @@ const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
 
   this->Local2SI(pos);   // curr geom units -> SI
 
-  fCurrVertex->SetXYZ(pos[0],pos[1],pos[2]);
+  ctx.fVertex.SetXYZ(pos[0],pos[1],pos[2]);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("GROOTGeom", pDEBUG)
       << "Vtx (m) = " << utils::print::Vec3AsString(&pos);
 #endif
 
-  return *fCurrVertex;
+  return ctx.fVertex;
+}
+
+//___________________________________________________________________________
+ROOTGeomNavContext & ROOTGeomAnalyzer::NavContext(void)
+{
+/// Returns the navigation context of the calling thread, creating it (with
+/// a new TGeoNavigator) the first time the thread uses the driver.
+/// Threads other than the one that loaded the geometry can only navigate
+/// once SetMaxThreads() has been called.
+
+  if ( gLastNavId == fNavId && gLastNavContext ) return *gLastNavContext;
+
+  NavKey_t key(fNavId, std::this_thread::get_id());
+
+  ROOTGeomNavContext * ctx = 0;
+  {
+    std::lock_guard<std::mutex> lock(gNavContextMutex);
+    std::map<NavKey_t, ROOTGeomNavContext *>::const_iterator it =
+       gNavContexts.find(key);
+    if ( it != gNavContexts.end() ) ctx = it->second;
+  }
+
+  if ( ! ctx ) {
+    if ( ! fGeometry->IsMultiThread() ) {
+      LOG("GROOTGeom", pFATAL)
+        << "The geometry is navigated from a new thread but it was not "
+        << "set up for multi-threaded navigation (see SetMaxThreads())";
+      gAbortingInErr = true;
+      exit(1);
+    }
+    TGeoNavigator * nav = fGeometry->GetCurrentNavigator();
+    if ( ! nav ) nav = fGeometry->AddNavigator();
+    ctx = new ROOTGeomNavContext(nav, *fCurrPDGCodeList);
+
+    std::lock_guard<std::mutex> lock(gNavContextMutex);
+    gNavContexts[key] = ctx;
+  }
+
+  gLastNavId      = fNavId;
+  gLastNavContext = ctx;
+
+  return *ctx;
 }
 
 //===========================================================================
@@ -428,6 +689,22 @@ void ROOTGeomAnalyzer::SetMaxPlSafetyFactor(double sf)
     << "Max path length safety factor: " << fMaxPlSafetyFactor;
 }
 
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::SetScannerConvergence(int nblocks, double tol)
+{
+/// Repeat the max path length scans (of ScannerNPoints() x ScannerNRays()
+/// rays per box surface, or ScannerNParticles() flux neutrinos) until no
+/// max path length has grown by a relative amount larger than tol for
+/// nblocks consecutive scans. nblocks <= 0 (default) runs a single scan.
+
+  fConvBlocks = nblocks;
+  fConvTol    = TMath::Max(0., tol);
+
+  LOG("GROOTGeom", pNOTICE)
+    << "Max path length scanner convergence: " << fConvBlocks
+    << " scans, tolerance: " << fConvTol;
+}
+
 //___________________________________________________________________________
 void ROOTGeomAnalyzer::SetMixtureWeightsSum(double sum)
 {
@@ -436,6 +713,20 @@ void ROOTGeomAnalyzer::SetMixtureWeightsSum(double sum)
 /// compute the correct weight normalization.
 
   fMixtWghtSum = sum;
+
+  // the weight table depends on the mixture weights normalization
+  if (fCurrPDGCodeList) this->BuildWeightTable();
+}
+
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::SetWeightWithDensity(bool wt)
+{
+/// Set whether path-lengths are weighted with the material density
+
+  fDensWeight = wt;
+
+  // the weight table depends on the density weighting
+  if (fCurrPDGCodeList) this->BuildWeightTable();
 }
 
 //___________________________________________________________________________
@@ -485,6 +776,53 @@ void ROOTGeomAnalyzer::SetTopVolName(string name)
   // set volume name
   fTopVolume = gvol;
   fGeometry->SetTopVolume(fTopVolume);
+  this->SetTopBox();
+}
+
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::SetMaxThreads(int nt)
+{
+/// Set up the geometry for navigation from up to nt threads (other than
+/// the one that loaded the geometry), see TGeoManager::SetMaxThreads().
+/// Call it from the main thread, once the driver has been configured and
+/// before it is used from any other thread.
+
+  if ( nt < 1 ) return;
+  if ( fGeometry->IsMultiThread() && fGeometry->GetMaxThreads() >= nt ) return;
+
+  LOG("GROOTGeom", pNOTICE)
+    << "Setting up the geometry for navigation from " << nt << " threads";
+
+  fGeometry->SetMaxThreads(nt);
+}
+
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::SetSwimCacheCells(double dx, double dtheta)
+{
+/// Enable the swim cache for beam fluxes: rays starting within the same
+/// flux window cell of size dx (m) with directions within the same cell of
+/// size dtheta (rad) are assumed to cross the same sequence of volumes as
+/// the last ray of the cell that was swum through the geometry. Only the
+/// boundaries of these volumes are then computed for each ray (and checked
+/// to follow on each other), the full swim being repeated if they do not.
+/// Small volumes crossed by a ray but not by the cached one are missed, so
+/// the cells should be small compared to the smallest detector features.
+/// Use dx <= 0 to disable the cache (default). As it only pays off for the
+/// narrow beam directions, enable it after the max path lengths are known.
+
+  fSwimCachePosCell = TMath::Max(0., dx);
+  fSwimCacheDirCell = TMath::Max(0., dtheta);
+  if ( fSwimCachePosCell > 0 && fSwimCacheDirCell <= 0 ) {
+    LOG("GROOTGeom", pWARN)
+      << "Invalid swim cache direction cell: " << dtheta << " - Disabling the cache";
+    fSwimCachePosCell = 0;
+    fSwimCacheDirCell = 0;
+  }
+  if ( fSwimCachePosCell > 0 ) {
+    LOG("GROOTGeom", pNOTICE)
+      << "Swim cache enabled with cells of " << fSwimCachePosCell
+      << " m x " << fSwimCacheDirCell << " rad";
+  }
 }
 
 //===========================================================================
@@ -652,18 +990,26 @@ void ROOTGeomAnalyzer::Initialize(void)
                 << "Initializing ROOT geometry driver & setting defaults";
 
   fCurrMaxPathLengthList = 0;
-  fCurrPathLengthList    = 0;
-  fCurrPathSegmentList   = 0;
+  fMainNavContext        = 0;
+  fNavId                 = 0;
   fGeomVolSelector       = 0;
   fCurrPDGCodeList       = 0;
   fTopVolume             = 0;
   fTopVolumeName         = "";
   fKeepSegPath           = false;
+  fVtxFromSegments       = false;
+  fClipToTopBox          = true;
+  fSwimCachePosCell      = 0;
+  fSwimCacheDirCell      = 0;
+  fConvBlocks            = 0;
+  fConvTol               = 0;
+  fMaxPlSafetyFactorNeeded = 0;
 
   // some defaults:
   this -> SetScannerNPoints    (200);
   this -> SetScannerNRays      (200);
   this -> SetScannerNParticles (10000);
+  this -> SetScannerNThreads   (1);
   this -> SetScannerFlux       (0);
   this -> SetMaxPlSafetyFactor (1.1);
   this -> SetLengthUnits       (genie::units::meter);
@@ -683,8 +1029,21 @@ void ROOTGeomAnalyzer::CleanUp(void)
 {
   LOG("GROOTGeom", pNOTICE) << "Cleaning up...";
 
-  if ( fCurrPathSegmentList   ) delete fCurrPathSegmentList;
-  if ( fCurrPathLengthList    ) delete fCurrPathLengthList;
+  // navigation contexts of all threads (their navigators are owned by the
+  // TGeoManager)
+  {
+    std::lock_guard<std::mutex> lock(gNavContextMutex);
+    std::map<NavKey_t, ROOTGeomNavContext *>::iterator it =
+       gNavContexts.begin();
+    while ( it != gNavContexts.end() ) {
+      if ( it->first.first == fNavId ) {
+        delete it->second;
+        gNavContexts.erase(it++);
+      } else ++it;
+    }
+  }
+  fMainNavContext = 0;
+
   if ( fCurrMaxPathLengthList ) delete fCurrMaxPathLengthList;
   if ( fCurrPDGCodeList       ) delete fCurrPDGCodeList;
   if ( fMasterToTop           ) delete fMasterToTop;
@@ -695,6 +1054,8 @@ void ROOTGeomAnalyzer::Load(string filename)
 {
 /// Load the detector geometry from the input ROOT file
 ///
+  StartupProfile::Scope phase("ROOTGeomAnalyzer::Load");
+
   LOG("GROOTGeom", pNOTICE) << "Loading geometry from: " << filename;
 
   bool is_accessible = ! (gSystem->AccessPathName( filename.c_str() ));
@@ -727,10 +1088,17 @@ void ROOTGeomAnalyzer::Load(TGeoManager * gm)
   const PDGCodeList & pdglist = this->ListOfTargetNuclei();
 
   fTopVolume             = 0;
-  fCurrPathSegmentList   = new PathSegmentList();
-  fCurrPathLengthList    = new PathLengthList(pdglist);
   fCurrMaxPathLengthList = new PathLengthList(pdglist);
-  fCurrVertex            = new TVector3(0.,0.,0.);
+
+  // navigation context of the loading thread
+  TGeoNavigator * nav = fGeometry->GetCurrentNavigator();
+  if ( ! nav ) nav = fGeometry->AddNavigator();
+  fNavId          = ++gNNavIds;
+  fMainNavContext = new ROOTGeomNavContext(nav, pdglist);
+  {
+    std::lock_guard<std::mutex> lock(gNavContextMutex);
+    gNavContexts[NavKey_t(fNavId, std::this_thread::get_id())] = fMainNavContext;
+  }
 
   // ask geometry manager for its top volume
   fTopVolume = fGeometry->GetTopVolume();
@@ -738,6 +1106,7 @@ void ROOTGeomAnalyzer::Load(TGeoManager * gm)
       LOG("GROOTGeom", pFATAL) << "Could not get top volume!!!";
   }
   assert(fTopVolume);
+  this->SetTopBox();
 
   // load matrix (identity) of top volume
   fMasterToTop = new TGeoHMatrix(*fGeometry->GetCurrentMatrix());
@@ -760,7 +1129,10 @@ void ROOTGeomAnalyzer::BuildListOfTargetNuclei(void)
 /// be seen during swimming through the volumes if those code are only
 /// found in materials outside the top volume.
 
+  StartupProfile::Scope phase("ROOTGeomAnalyzer::BuildListOfTargetNuclei");
+
   fCurrPDGCodeList = new PDGCodeList;
+  fTgtMaterials.clear();
 
   if (!fGeometry) {
     LOG("GROOTGeom", pFATAL) << "No ROOT geometry is loaded!!";
@@ -796,6 +1168,7 @@ void ROOTGeomAnalyzer::BuildListOfTargetNuclei(void)
       if ( seen_mat.find(mat_indx) != seen_mat.end() ) continue;
       seen_mat.insert(mat_indx);
       volvec.push_back(volume); //RWH
+      fTgtMaterials.push_back(mat);
 
       if (mat->IsMixture()) {
          TGeoMixture * mixt = dynamic_cast <TGeoMixture*> (mat);
@@ -814,6 +1187,81 @@ void ROOTGeomAnalyzer::BuildListOfTargetNuclei(void)
   // list is easier to read so this doesn't cost much
   std::sort(fCurrPDGCodeList->begin(),fCurrPDGCodeList->end());
 
+  this->BuildWeightTable();
+}
+
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::BuildWeightTable(void)
+{
+/// Tabulate the weight of each target nucleus in each material of the
+/// geometry volumes (a dense material x target nucleus matrix), so that
+/// the swum path segments are converted into per-nucleus path-lengths
+/// without walking the mixture elements at every step.
+/// Rebuilt whenever the density weighting or the mixture weights
+/// normalization changes.
+
+  fWeightTableRow.clear();
+  fWeightTable.clear();
+  if (!fCurrPDGCodeList) return;
+
+  const int ntgt = fCurrPDGCodeList->size();
+  const int nmat = fTgtMaterials.size();
+
+  int maxindx = -1;
+  for (int imat = 0; imat < nmat; imat++) {
+    maxindx = TMath::Max(maxindx, fTgtMaterials[imat]->GetIndex());
+  }
+  fWeightTableRow.assign(maxindx+1, -1);
+  fWeightTable.assign(nmat*ntgt, 0.);
+
+  for (int imat = 0; imat < nmat; imat++) {
+    const TGeoMaterial * mat = fTgtMaterials[imat];
+    for (int j = 0; j < ntgt; j++) {
+      fWeightTable[imat*ntgt + j] =
+        this->GetWeight(mat, (*fCurrPDGCodeList)[j]);
+    }
+    if (mat->GetIndex() >= 0) fWeightTableRow[mat->GetIndex()] = imat;
+  }
+
+  LOG("GROOTGeom", pINFO)
+    << "Built the weight table of " << ntgt << " target nuclei in "
+    << nmat << " materials";
+}
+
+//___________________________________________________________________________
+int ROOTGeomAnalyzer::TargetIndex(int pdgc) const
+{
+/// Position of the input target nucleus in the (sorted) list of target
+/// nuclei, -1 if not found
+
+  PDGCodeList::const_iterator it = std::lower_bound(
+     fCurrPDGCodeList->begin(), fCurrPDGCodeList->end(), pdgc);
+  if (it == fCurrPDGCodeList->end() || *it != pdgc) return -1;
+  return it - fCurrPDGCodeList->begin();
+}
+
+//___________________________________________________________________________
+const double * ROOTGeomAnalyzer::WeightTableRow(
+                                          const TGeoMaterial * mat) const
+{
+/// Target nuclei weights of the input material, 0 if not tabulated
+
+  int indx = mat->GetIndex();
+  if (indx < 0 || indx >= (int) fWeightTableRow.size()) return 0;
+  int row = fWeightTableRow[indx];
+  if (row < 0 || fTgtMaterials[row] != mat) return 0;
+  return &fWeightTable[row * fCurrPDGCodeList->size()];
+}
+
+//___________________________________________________________________________
+double ROOTGeomAnalyzer::TargetWeight(const TGeoMaterial * mat, int pdgc)
+{
+/// As GetWeight() but reading the weight table whenever possible
+
+  const double * w = this->WeightTableRow(mat);
+  int j = this->TargetIndex(pdgc);
+  if (w && j >= 0) return w[j];
+  return this->GetWeight(mat, pdgc);
 }
 
 //___________________________________________________________________________
@@ -970,6 +1418,71 @@ double ROOTGeomAnalyzer::GetWeight(const TGeoMixture* mixt, int ielement, int pd
   return weight;
 }
 
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::MaxPathLengthsConverge(void)
+{
+/// Repeat the max path length scan (FLUX method if a flux driver is set,
+/// else BOX method) until no material's max path length has grown (by more
+/// than the ScannerConvTol() relative tolerance) for ScannerConvBlocks()
+/// consecutive scans. Also computes the safety factor that a single scan
+/// would have needed to reach the converged max path lengths.
+
+  LOG("GROOTGeom", pNOTICE)
+    << "Repeating the max path length scans until no max path length grew"
+    << " for " << fConvBlocks << " scans (tolerance: " << fConvTol << ")";
+
+  PathLengthList plfirst;
+  PathLengthList::const_iterator pl_iter;
+
+  int iblock  = 0;
+  int nstable = 0;
+  while ( nstable < fConvBlocks && iblock < kMaxScanBlocks ) {
+
+    PathLengthList plprev(*fCurrMaxPathLengthList);
+
+    if ( fFlux ) this->MaxPathLengthsFluxMethod();
+    else         this->MaxPathLengthsBoxMethod();
+    iblock++;
+
+    bool grown = false;
+    for (pl_iter  = fCurrMaxPathLengthList->begin();
+         pl_iter != fCurrMaxPathLengthList->end(); ++pl_iter) {
+       double prev = plprev.PathLength(pl_iter->first);
+       if ( pl_iter->second > prev * (1. + fConvTol) ) grown = true;
+    }
+    if ( iblock == 1 ) plfirst = *fCurrMaxPathLengthList;
+
+    nstable = grown ? 0 : nstable + 1;
+
+    LOG("GROOTGeom", pINFO)
+      << "Max path length scan " << iblock
+      << (grown ? ": max path lengths grew" : ": max path lengths unchanged")
+      << " (" << nstable << "/" << fConvBlocks << ")";
+  }
+
+  if ( nstable < fConvBlocks ) {
+    LOG("GROOTGeom", pWARN)
+      << "Max path lengths didn't converge after " << iblock << " scans";
+  }
+
+  // factor by which the max path lengths of the first scan had to grow
+  fMaxPlSafetyFactorNeeded = 1.;
+  for (pl_iter  = fCurrMaxPathLengthList->begin();
+       pl_iter != fCurrMaxPathLengthList->end(); ++pl_iter) {
+     double first = plfirst.PathLength(pl_iter->first);
+     if ( first > 0 ) {
+       fMaxPlSafetyFactorNeeded =
+          TMath::Max(fMaxPlSafetyFactorNeeded, pl_iter->second / first);
+     }
+  }
+  fMaxPlSafetyFactorNeeded *= this->MaxPlSafetyFactor();
+
+  LOG("GROOTGeom", pNOTICE)
+    << "Max path lengths converged after " << iblock << " scans."
+    << " The safety factor needed by a single scan is "
+    << fMaxPlSafetyFactorNeeded << " (used: " << this->MaxPlSafetyFactor() << ")";
+}
+
 //___________________________________________________________________________
 void ROOTGeomAnalyzer::MaxPathLengthsFluxMethod(void)
 {
@@ -994,43 +1507,66 @@ void ROOTGeomAnalyzer::MaxPathLengthsFluxMethod(void)
       << "max path lengths with FLUX method forcing Enu=" << emax;
   }
 
+  // The flux neutrinos are generated in batches of at most the number of
+  // entering neutrinos still needed, and their path lengths computed by
+  // ComputePathLengthsBatch(), so that the same neutrinos are used for any
+  // number of threads
+  vector<TLorentzVector> x4;
+  vector<TLorentzVector> p4;
+  vector<double>         pl;
+  const unsigned int nmat = fCurrMaxPathLengthList->size();
+
   while (iparticle < nparticles ) {
 
-    bool ok = fFlux->GenerateNext();
-    if (!ok) {
-       LOG("GROOTGeom", pWARN) << "Couldn't generate a flux neutrino";
-       continue;
-    }
+    unsigned int nbatch =
+       TMath::Min((unsigned int) (nparticles - iparticle), kMaxRayBatch);
+    x4.clear();
+    p4.clear();
 
-    TLorentzVector   nup4  = fFlux->Momentum();
-    if ( rescale_e ) {
-      double ecurr = nup4.E();
-      if ( ecurr > 0 ) nup4 *= (emax/ecurr);
-    }
-    const TLorentzVector & nux4  = fFlux->Position();
+    while (x4.size() < nbatch) {
+      bool ok = fFlux->GenerateNext();
+      if (!ok) {
+         LOG("GROOTGeom", pWARN) << "Couldn't generate a flux neutrino";
+         continue;
+      }
+
+      TLorentzVector   nup4  = fFlux->Momentum();
+      if ( rescale_e ) {
+        double ecurr = nup4.E();
+        if ( ecurr > 0 ) nup4 *= (emax/ecurr);
+      }
+      const TLorentzVector & nux4  = fFlux->Position();
 
-    //LOG("GMCJDriver", pNOTICE)
-    //   << "\n [-] Generated flux neutrino: "
-    //   << "\n  |----o 4-momentum : " << utils::print::P4AsString(&nup4)
-    //   << "\n  |----o 4-position : " << utils::print::X4AsString(&nux4);
+      //LOG("GMCJDriver", pNOTICE)
+      //   << "\n [-] Generated flux neutrino: "
+      //   << "\n  |----o 4-momentum : " << utils::print::P4AsString(&nup4)
+      //   << "\n  |----o 4-position : " << utils::print::X4AsString(&nux4);
+
+      x4.push_back(nux4);
+      p4.push_back(nup4);
+    }
 
-    const PathLengthList & pl = this->ComputePathLengths(nux4, nup4);
+    this->ComputePathLengthsBatch(x4, p4, pl);
 
-    bool enters = false;
+    for (unsigned int iray = 0; iray < nbatch; iray++) {
+      bool enters = false;
 
-    for (pl_iter = pl.begin(); pl_iter != pl.end(); ++pl_iter) {
-       int    pdgc       = pl_iter->first;
-       double pathlength = pl_iter->second;
+      unsigned int imat = 0;
+      for (pl_iter  = fCurrMaxPathLengthList->begin();
+           pl_iter != fCurrMaxPathLengthList->end(); ++pl_iter, ++imat) {
+         int    pdgc       = pl_iter->first;
+         double pathlength = pl[iray*nmat + imat];
 
-       if ( pathlength > 0 ) {
-          pathlength *= (this->MaxPlSafetyFactor());
+         if ( pathlength > 0 ) {
+            pathlength *= (this->MaxPlSafetyFactor());
 
-          pathlength = TMath::Max(pathlength, fCurrMaxPathLengthList->PathLength(pdgc));
-          fCurrMaxPathLengthList->SetPathLength(pdgc,pathlength);
-          enters = true;
-       }
+            pathlength = TMath::Max(pathlength, fCurrMaxPathLengthList->PathLength(pdgc));
+            fCurrMaxPathLengthList->SetPathLength(pdgc,pathlength);
+            enters = true;
+         }
+      }
+      if (enters) iparticle++;
     }
-    if (enters) iparticle++;
   }
 }
 
@@ -1054,25 +1590,46 @@ void ROOTGeomAnalyzer::MaxPathLengthsBoxMethod(void)
 
   PathLengthList::const_iterator pl_iter;
 
-  while ( (ok = this->GenBoxRay(iparticle++,nux4,nup4)) ) {
+  // The rays are generated in sequence (as GenBoxRay() keeps the current
+  // box point) in batches, whose path lengths are computed by
+  // ComputePathLengthsBatch()
+  vector<TLorentzVector> x4;
+  vector<TLorentzVector> p4;
+  vector<double>         plbatch;
+  const unsigned int nmat = fCurrMaxPathLengthList->size();
+
+  while ( ok ) {
+
+    x4.clear();
+    p4.clear();
+    while ( x4.size() < kMaxRayBatch &&
+            (ok = this->GenBoxRay(iparticle++,nux4,nup4)) ) {
+
+      //LOG("GMCJDriver", pNOTICE)
+      //  << "\n [-] Generated flux neutrino: "
+      //  << "\n  |----o 4-momentum : " << utils::print::P4AsString(&nup4)
+      //  << "\n  |----o 4-position : " << utils::print::X4AsString(&nux4);
 
-    //LOG("GMCJDriver", pNOTICE)
-    //  << "\n [-] Generated flux neutrino: "
-    //  << "\n  |----o 4-momentum : " << utils::print::P4AsString(&nup4)
-    //  << "\n  |----o 4-position : " << utils::print::X4AsString(&nux4);
+      x4.push_back(nux4);
+      p4.push_back(nup4);
+    }
 
-    const PathLengthList & pllst = this->ComputePathLengths(nux4, nup4);
+    this->ComputePathLengthsBatch(x4, p4, plbatch);
 
-    for (pl_iter = pllst.begin(); pl_iter != pllst.end(); ++pl_iter) {
-       int    pdgc = pl_iter->first;
-       double pl   = pl_iter->second;
+    for (unsigned int iray = 0; iray < x4.size(); iray++) {
+      unsigned int imat = 0;
+      for (pl_iter  = fCurrMaxPathLengthList->begin();
+           pl_iter != fCurrMaxPathLengthList->end(); ++pl_iter, ++imat) {
+         int    pdgc = pl_iter->first;
+         double pl   = plbatch[iray*nmat + imat];
 
-       if (pl>0) {
-          pl *= (this->MaxPlSafetyFactor());
+         if (pl>0) {
+            pl *= (this->MaxPlSafetyFactor());
 
-          pl = TMath::Max(pl, fCurrMaxPathLengthList->PathLength(pdgc));
-          fCurrMaxPathLengthList->SetPathLength(pdgc,pl);
-       }
+            pl = TMath::Max(pl, fCurrMaxPathLengthList->PathLength(pdgc));
+            fCurrMaxPathLengthList->SetPathLength(pdgc,pl);
+         }
+      }
     }
   }
 
@@ -1288,15 +1845,25 @@ bool ROOTGeomAnalyzer::GenBoxRay(int indx, TLorentzVector& x4, TLorentzVector& p
 
 //________________________________________________________________________
 double ROOTGeomAnalyzer::ComputePathLengthPDG(
-                  const TVector3 & r0, const TVector3 & udir, int pdgc)
+   const TVector3 & r0, const TVector3 & udir, int pdgc, ROOTGeomNavContext & ctx)
 {
 /// Compute the path length for the material with pdg-code = pdc, staring
 /// from the input position r (top vol coord & units) and moving along the
-/// direction of the unit vector udir (top vol coord).
+/// direction of the unit vector udir (top vol coord), swimming with the
+/// input navigation context.
 
-  double pl = 0; // path-length (x density, if density-weighting is ON)
+  this->Swim(r0,udir,ctx);
+
+  return this->PathLengthPDG(*ctx.fPathSegmentList, pdgc);
+}
 
-  this->SwimOnce(r0,udir);
+//________________________________________________________________________
+double ROOTGeomAnalyzer::PathLengthPDG(const PathSegmentList & psl, int pdgc)
+{
+/// Sum the path length for the material with pdg-code = pdc over the
+/// segments of the input (swum) PathSegmentList
+
+  double pl = 0; // path-length (x density, if density-weighting is ON)
 
   double step   = 0;
   double weight = 0;
@@ -1307,14 +1874,14 @@ double ROOTGeomAnalyzer::ComputePathLengthPDG(
 
   // loop over independent materials, which is shorter or equal to # of volumes
   PathSegmentList::MaterialMapCItr_t itr     =
-    fCurrPathSegmentList->GetMatStepSumMap().begin();
+    psl.GetMatStepSumMap().begin();
   PathSegmentList::MaterialMapCItr_t itr_end =
-    fCurrPathSegmentList->GetMatStepSumMap().end();
+    psl.GetMatStepSumMap().end();
   for ( ; itr != itr_end; ++itr ) {
     mat  = itr->first;
     if ( ! mat ) continue;  // segment outside geometry has no material
     step = itr->second;
-    weight = this->GetWeight(mat,pdgc);
+    weight = this->TargetWeight(mat,pdgc);
     pl += (step*weight);
   }
 
@@ -1332,19 +1899,232 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
 /// Swim through the geometry from the from the input position
 /// r0 (top vol coord & units) and moving along the direction of the
 /// unit vector udir (topvol coord) to create a filled PathSegmentList
+/// (in the navigation context of the calling thread)
 
-  int nvolswim = 0; //rwh
+  this->Swim(r0, udir, this->NavContext());
+}
+
+//________________________________________________________________________
+void ROOTGeomAnalyzer::Swim(
+   const TVector3 & r0, const TVector3 & udir, ROOTGeomNavContext & ctx)
+{
+/// Swim as in SwimOnce(), with the navigator and filling the PathSegmentList
+/// (trimmed in place) of the input navigation context
 
-  if ( ! fCurrPathSegmentList ) fCurrPathSegmentList = new PathSegmentList();
+  PathSegmentList * psl = ctx.fPathSegmentList;
 
   // don't swim if the current PathSegmentList is up-to-date
-  if ( fCurrPathSegmentList->IsSameStart(r0,udir) ) return;
+  if ( psl->IsSameStart(r0,udir) ) return;
+
+  // rays missing the top volume bounding box cross no volume: leave the
+  // list empty (zero path lengths) without navigating the geometry
+  if ( fClipToTopBox && this->MissesTopBox(r0,udir) ) {
+    psl->SetAllToZero();
+    psl->SetStartInfo(r0,udir);
+    return;
+  }
+
+  // follow the volumes of the cached ray of the flux window & direction
+  // cell, if any, or swim through the geometry
+  bool cached = ( fSwimCachePosCell > 0 && this->SwimFromCache(r0,udir,ctx) );
+  if ( ! cached ) {
+    bool enters = this->SwimGeometry(r0,udir,ctx);
+    if ( ! enters ) return;
+  }
+
+#ifdef RWH_DEBUG_2
+  if ( ( fDebugFlags & 0x20 ) ) {
+    psl->SetDoCrossCheck(true);       //RWH
+    LOG("GROOTGeom", pNOTICE) << "Before trimming" << *psl;
+    double mxddist = 0, mxdstep = 0;
+    psl->CrossCheck(mxddist,mxdstep);
+    fmxddist = TMath::Max(fmxddist,mxddist);
+    fmxdstep = TMath::Max(fmxdstep,mxdstep);
+  }
+#endif
+
+  // PathSegmentList trimming occurs here! (in place)
+  if ( fGeomVolSelector ) {
+    fGeomVolSelector->TrimList(psl);
+  }
+
+  psl->FillMatStepSum();
+
+#ifdef RWH_DEBUG_2
+  if ( fGeomVolSelector) {
+    // after FillMatStepSum() so one can see the summed mass
+    if ( ( fDebugFlags & 0x40 ) ) {
+      psl->SetPrintVerbose(true);
+      LOG("GROOTGeom", pNOTICE) << "After  trimming" << *psl;
+      psl->SetPrintVerbose(false);
+    }
+  }
+#endif
+
+  return;
+}
+
+//________________________________________________________________________
+void ROOTGeomAnalyzer::SetTopBox(void)
+{
+/// Cache the bounding box of the top volume shape (top vol coord & units),
+/// slightly enlarged so that rays starting at / grazing its faces are swum
+
+  TGeoBBox * box = (TGeoBBox *) fTopVolume->GetShape();
+  const double * o = box->GetOrigin();
+  double dl[3] = { box->GetDX(), box->GetDY(), box->GetDZ() };
+  for (int i = 0; i < 3; i++) {
+    double tol = 1E-9 * dl[i] + TGeoShape::Tolerance();
+    fTopBoxMin[i] = o[i] - dl[i] - tol;
+    fTopBoxMax[i] = o[i] + dl[i] + tol;
+  }
+}
+
+//________________________________________________________________________
+bool ROOTGeomAnalyzer::MissesTopBox(
+   const TVector3 & r0, const TVector3 & udir) const
+{
+/// Does the ray starting at r0 and moving along udir (top vol coord & units)
+/// miss the top volume bounding box? (slab test, no geometry look-up)
+/// A ray missing the box can't enter any volume of the top volume.
+
+  double r[3] = { r0.X(),   r0.Y(),   r0.Z()   };
+  double u[3] = { udir.X(), udir.Y(), udir.Z() };
+  double tmin = 0, tmax = DBL_MAX;
+  for (int i = 0; i < 3; i++) {
+    if ( u[i] == 0 ) {
+      if ( r[i] < fTopBoxMin[i] || r[i] > fTopBoxMax[i] ) return true;
+      continue;
+    }
+    double t1 = (fTopBoxMin[i] - r[i]) / u[i];
+    double t2 = (fTopBoxMax[i] - r[i]) / u[i];
+    if ( t1 > t2 ) std::swap(t1,t2);
+    if ( t1 > tmin ) tmin = t1;
+    if ( t2 < tmax ) tmax = t2;
+    if ( tmin > tmax ) return true;
+  }
+  return false;
+}
+
+//________________________________________________________________________
+bool ROOTGeomAnalyzer::SwimFromCache(
+   const TVector3 & r0, const TVector3 & udir, ROOTGeomNavContext & ctx)
+{
+/// Fill the (untrimmed) PathSegmentList of the input navigation context
+/// following the volumes of the cached ray of the input ray cell.
+/// The boundaries are computed from the shapes of these volumes, checking
+/// that the ray is inside each of them and that each boundary leads to the
+/// next. Returns false (and the ray must be swum) if there is no cached ray
+/// or if the checks fail.
+
+  if ( ! ctx.fSwimCache ) ctx.fSwimCache = new ROOTGeomSwimCache();
+
+  const ROOTGeomSwimCache::Ray_t * ray =
+     ctx.fSwimCache->Find(SwimCell(r0, udir,
+        fSwimCachePosCell/this->LengthUnits(), fSwimCacheDirCell));
+  if ( ! ray || ray->fVolumes.empty() ) return false;
+
+  bool selneedspath = ( fGeomVolSelector && fGeomVolSelector->GetNeedPath() );
+  const bool fill_path = fKeepSegPath || selneedspath;
+
+  PathSegmentList * psl = ctx.fPathSegmentList;
+  psl->SetAllToZero();
+  psl->SetStartInfo(r0,udir);
+
+  double dir[3] = { udir[0], udir[1], udir[2] };
+  double pos[3] = { r0[0],   r0[1],   r0[2]   };
+  double local[3], ldir[3], point[3];
+  double raydist = 0;
+
+  // step to the top volume
+  if ( ray->fOutside ) {
+    double step = fTopVolume->GetShape()->DistFromOutside(pos,dir);
+    if ( this->WillNeverEnter(step) ) return false;
+    for (int k = 0; k < 3; k++) pos[k] += step*dir[k];
+    raydist += step;
+  }
+
+  PathSegment ps_curr;
+  const unsigned int nvol = ray->fVolumes.size();
+  for (unsigned int iv = 0; iv < nvol; iv++) {
+    const ROOTGeomSwimCache::Volume_t & cvol = ray->fVolumes[iv];
+    const ROOTGeomSwimCache::Volume_t * nvol_p =
+       ( iv+1 < nvol ) ? &(ray->fVolumes[iv+1]) : 0;
+    const TGeoShape * shape = cvol.fVolume->GetShape();
+
+    // distance to the volume boundary or, if the next volume is deeper in
+    // the geometry tree, to the next volume
+    cvol.fMatrix.MasterToLocal    (pos, local);
+    cvol.fMatrix.MasterToLocalVect(dir, ldir);
+    double step = shape->DistFromInside(local,ldir);
+    if ( nvol_p && nvol_p->fLevel > cvol.fLevel ) {
+      nvol_p->fMatrix.MasterToLocal    (pos, point);
+      nvol_p->fMatrix.MasterToLocalVect(dir, ldir);
+      double step_next = nvol_p->fVolume->GetShape()->DistFromOutside(point,ldir);
+      if ( step_next > step ) return false;
+      step = step_next;
+    }
+    if ( this->WillNeverEnter(step) ) return false;
+
+    // the ray must be within the volume
+    if ( step > kSwimCachePush ) {
+      for (int k = 0; k < 3; k++) point[k] = pos[k] + 0.5*step*dir[k];
+      cvol.fMatrix.MasterToLocal(point, local);
+      if ( ! shape->Contains(local) ) return false;
+    }
+
+    const TGeoMedium * med = cvol.fVolume->GetMedium();
+    ps_curr.SetEnter(pos, raydist);
+    ps_curr.SetGeo(cvol.fVolume, med, med->GetMaterial());
+#ifdef PATHSEG_KEEP_PATH
+    if (fill_path) {
+      if ( cvol.fPath.empty() ) return false;
+      ps_curr.SetPath(cvol.fPath.c_str());
+    }
+#endif
+
+    for (int k = 0; k < 3; k++) pos[k] += step*dir[k];
+    raydist += step;
+
+    ps_curr.SetExit(pos);
+    ps_curr.SetStep(step);
+    psl->AddSegment(ps_curr);
+
+    // the boundary must lead to the next volume (or out of the geometry)
+    for (int k = 0; k < 3; k++) point[k] = pos[k] + kSwimCachePush*dir[k];
+    if ( nvol_p ) {
+      nvol_p->fMatrix.MasterToLocal(point, local);
+      if ( ! nvol_p->fVolume->GetShape()->Contains(local) ) return false;
+    } else {
+      if ( fTopVolume->GetShape()->Contains(point) ) return false;
+    }
+  }
+
+  return true;
+}
+
+//________________________________________________________________________
+bool ROOTGeomAnalyzer::SwimGeometry(
+   const TVector3 & r0, const TVector3 & udir, ROOTGeomNavContext & ctx)
+{
+/// Swim through the geometry (see Swim()) with the navigator of the input
+/// navigation context, filling its (untrimmed) PathSegmentList.
+/// Returns false if the ray never enters the geometry. With the swim cache
+/// enabled, the ray volumes are stored for its flux window & direction cell.
+/// With a volume selector, only the range of the ray it may keep (eg the
+/// interval within a fiducial shape) is navigated, and rays it would
+/// reject altogether are not navigated at all.
+
+  int nvolswim = 0; //rwh
+
+  TGeoNavigator * nav = ctx.fNavigator;
+  PathSegmentList * psl = ctx.fPathSegmentList;
 
   // start fresh
-  fCurrPathSegmentList->SetAllToZero();
+  psl->SetAllToZero();
 
   // set start info so next time we don't swim for the same ray
-  fCurrPathSegmentList->SetStartInfo(r0,udir);
+  psl->SetStartInfo(r0,udir);
 
   PathSegment ps_curr;
 
@@ -1362,48 +2142,76 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
   bool selneedspath = ( fGeomVolSelector && fGeomVolSelector->GetNeedPath() );
   const bool fill_path = fKeepSegPath || selneedspath;
 
+  // range of the ray to navigate
+  double smin = 0;
+  double smax = DBL_MAX;
+  if ( fGeomVolSelector &&
+       ! fGeomVolSelector->SwimRange(r0,udir,smin,smax) ) {
+    psl->SetAllToZero();
+    return false;
+  }
+  smin = TMath::Max(0., smin);
+  const bool restricted = ( smin > 0 || smax < DBL_MAX );
+  raydist = smin;
+
+  // record the volumes for the swim cache (full rays only)
+  const bool record = ( fSwimCachePosCell > 0 && ! restricted &&
+                        ! ( fDebugFlags & 0x10 ) );
+  ROOTGeomSwimCache::Ray_t ray;
+  ROOTGeomSwimCache::Volume_t curr_vol;
+
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("GROOTGeom", pNOTICE)
     << "SwimOnce x [" << r0[0] << "," << r0[1] << "," << r0[2]
     << "] udir [" << udir[0] << "," << udir[1] << "," << udir[2];
 #endif
 
-  fGeometry -> SetCurrentDirection (udir[0],udir[1],udir[2]);
-  fGeometry -> SetCurrentPoint     (r0[0],  r0[1],  r0[2]  );
+  TVector3 rstart = r0 + smin * udir;
+  nav -> SetCurrentDirection (udir[0],  udir[1],  udir[2]  );
+  nav -> SetCurrentPoint     (rstart[0],rstart[1],rstart[2]);
 
   while (!found_vol || keep_on) {
      keep_on = true;
 
-     fGeometry->FindNode();
+     nav->FindNode();
 
-     ps_curr.SetEnter( fGeometry->GetCurrentPoint() , raydist );
-     vol = fGeometry->GetCurrentVolume();
+     ps_curr.SetEnter( nav->GetCurrentPoint() , raydist );
+     vol = nav->GetCurrentVolume();
      med = vol->GetMedium();
      mat = med->GetMaterial();
      ps_curr.SetGeo(vol,med,mat);
 #ifdef PATHSEG_KEEP_PATH
-     if (fill_path) ps_curr.SetPath(fGeometry->GetPath());
+     if (fill_path) ps_curr.SetPath(nav->GetPath());
+#endif
+     if (record && vol) {
+       curr_vol.fVolume = vol;
+       curr_vol.fMatrix = *nav->GetCurrentMatrix();
+       curr_vol.fLevel  = nav->GetLevel();
+#ifdef PATHSEG_KEEP_PATH
+       if (fill_path) curr_vol.fPath = ps_curr.fPathString;
 #endif
+     }
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
 #ifdef DUMP_SWIM
        LOG("GROOTGeom", pDEBUG) << "Current volume: " << vol->GetName()
-                             << " pos " << fGeometry->GetCurrentPoint()[0]
-                             << " "     << fGeometry->GetCurrentPoint()[1]
-                             << " "     << fGeometry->GetCurrentPoint()[2]
-                             << " dir " << fGeometry->GetCurrentDirection()[0]
-                             << " "     << fGeometry->GetCurrentDirection()[1]
-                             << " "     << fGeometry->GetCurrentDirection()[2]
-                             << "[path: " << fGeometry->GetPath() << "]";
+                             << " pos " << nav->GetCurrentPoint()[0]
+                             << " "     << nav->GetCurrentPoint()[1]
+                             << " "     << nav->GetCurrentPoint()[2]
+                             << " dir " << nav->GetCurrentDirection()[0]
+                             << " "     << nav->GetCurrentDirection()[1]
+                             << " "     << nav->GetCurrentDirection()[2]
+                             << "[path: " << nav->GetPath() << "]";
 #endif
 #endif
 
      // find the start of top
-     if (fGeometry->IsOutside() || !vol) {
+     if (nav->IsOutside() || !vol) {
         keep_on = false;
         if (found_vol) break;
+        ray.fOutside = true;
         step = 0;
-          this->StepToNextBoundary();
+          this->StepToNextBoundary(nav);
         //rwh//raydist += step;  // STNB doesn't actually "step"
 
 #ifdef RWH_DEBUG
@@ -1413,8 +2221,8 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
 #endif
 #endif
 
-        while (!fGeometry->IsEntering()) {
-          step = this->Step();
+        while (!nav->IsEntering()) {
+          step = this->Step(nav);
           raydist += step;
 #ifdef RWH_DEBUG
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
@@ -1439,12 +2247,12 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
                   << " p [" << udir[0] << "," << udir[1] << "," << udir[2] << "]";
             }
 #endif
-            fCurrPathSegmentList->SetAllToZero();
-            return;
+            psl->SetAllToZero();
+            return false;
           }
         } // finished while
 
-        ps_curr.SetExit(fGeometry->GetCurrentPoint());
+        ps_curr.SetExit(nav->GetCurrentPoint());
         ps_curr.SetStep(step);
         if ( ( fDebugFlags & 0x10 ) ) {
           // In general don't add the path segments from the start point to
@@ -1453,7 +2261,7 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
           ps_curr.fStepRangeSet.clear();
           LOG("GROOTGeom", pNOTICE)
             << "debug: step towards top volume: " << ps_curr;
-          fCurrPathSegmentList->AddSegment(ps_curr);
+          psl->AddSegment(ps_curr);
         }
 
      }  // outside or !vol
@@ -1461,15 +2269,19 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
      if (keep_on) {
        if (!found_vol) found_vol = true;
 
-       step   = this->StepUntilEntering();
+       step   = this->StepUntilEntering(nav);
        raydist += step;
 
-       ps_curr.SetExit(fGeometry->GetCurrentPoint());
+       ps_curr.SetExit(nav->GetCurrentPoint());
        ps_curr.SetStep(step);
-       fCurrPathSegmentList->AddSegment(ps_curr);
+       psl->AddSegment(ps_curr);
+       if (record) ray.fVolumes.push_back(curr_vol);
 
        nvolswim++; //rwh
 
+       // nothing beyond the selected range is kept
+       if (raydist >= smax) break;
+
 #ifdef DUMP_SWIM
        LOG("GROOTGeom", pDEBUG) << "Current volume: " << vol->GetName()
                                 << " step " << step << " in " << mat->GetName();
@@ -1489,7 +2301,7 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
     nswims[curface]++;   //rwh
     dnvols[curface]  += (double)nvolswim;
     dnvols2[curface] += (double)nvolswim * (double)nvolswim;
-    long int ns = fCurrPathSegmentList->size();
+    long int ns = psl->size();
     if ( ns > mxsegments ) mxsegments = ns;
   }
 #endif
@@ -1497,61 +2309,24 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
 //rwh:debug
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("GROOTGeom", pDEBUG)
-    << "PathSegmentList size " << fCurrPathSegmentList->size();
+    << "PathSegmentList size " << psl->size();
 #endif
 
-#ifdef RWH_DEBUG_2
-  if ( ( fDebugFlags & 0x20 ) ) {
-    fCurrPathSegmentList->SetDoCrossCheck(true);       //RWH
-    LOG("GROOTGeom", pNOTICE) << "Before trimming" << *fCurrPathSegmentList;
-    double mxddist = 0, mxdstep = 0;
-    fCurrPathSegmentList->CrossCheck(mxddist,mxdstep);
-    fmxddist = TMath::Max(fmxddist,mxddist);
-    fmxdstep = TMath::Max(fmxdstep,mxdstep);
+  if (record) {
+    if ( ! ctx.fSwimCache ) ctx.fSwimCache = new ROOTGeomSwimCache();
+    ctx.fSwimCache->Store(SwimCell(r0, udir,
+       fSwimCachePosCell/this->LengthUnits(), fSwimCacheDirCell), ray);
   }
-#endif
 
-  // PathSegmentList trimming occurs here!
-  if ( fGeomVolSelector ) {
-    PathSegmentList* altlist =
-      fGeomVolSelector->GenerateTrimmedList(fCurrPathSegmentList);
-    std::swap(altlist,fCurrPathSegmentList);
-    delete altlist;  // after swap delete original
-  }
-
-  fCurrPathSegmentList->FillMatStepSum();
-
-#ifdef RWH_DEBUG_2
-  if ( fGeomVolSelector) {
-    // after FillMatStepSum() so one can see the summed mass
-    if ( ( fDebugFlags & 0x40 ) ) {
-      fCurrPathSegmentList->SetPrintVerbose(true);
-      LOG("GROOTGeom", pNOTICE) << "After  trimming" << *fCurrPathSegmentList;
-      fCurrPathSegmentList->SetPrintVerbose(false);
-    }
-  }
-#endif
-
-
-  return;
+  return true;
 }
 
 //___________________________________________________________________________
-bool ROOTGeomAnalyzer::FindMaterialInCurrentVol(int tgtpdg)
+bool ROOTGeomAnalyzer::FindMaterialInCurrentVol(int tgtpdg, TGeoNavigator * nav)
 {
-  TGeoVolume * vol = fGeometry -> GetCurrentVolume();
+  TGeoVolume * vol = nav -> GetCurrentVolume();
   if(vol) {
-    TGeoMaterial * mat = vol->GetMedium()->GetMaterial();
-    if(mat->IsMixture()) {
-      TGeoMixture * mixt = dynamic_cast <TGeoMixture*> (mat);
-      for(int i = 0; i < mixt->GetNelements(); i++) {
-         int pdg = this->GetTargetPdgCode(mixt, i);
-         if(tgtpdg == pdg) return true;
-      }
-    } else {
-       int pdg = this->GetTargetPdgCode(mat);
-       if(tgtpdg == pdg) return true;
-    }
+    return this->HasTargetMaterial(vol->GetMedium()->GetMaterial(), tgtpdg);
   } else {
      LOG("GROOTGeom", pWARN) << "Current volume is null!";
      return false;
@@ -1559,33 +2334,52 @@ bool ROOTGeomAnalyzer::FindMaterialInCurrentVol(int tgtpdg)
   return false;
 }
 //___________________________________________________________________________
-double ROOTGeomAnalyzer::StepToNextBoundary(void)
+bool ROOTGeomAnalyzer::HasTargetMaterial(
+                               const TGeoMaterial * mat, int tgtpdg) const
 {
-  fGeometry->FindNextBoundary();
-  double step=fGeometry->GetStep();
+  if(!mat) return false;
+
+  if(mat->IsMixture()) {
+    const TGeoMixture * mixt = dynamic_cast <const TGeoMixture*> (mat);
+    for(int i = 0; i < mixt->GetNelements(); i++) {
+       int pdg = this->GetTargetPdgCode(mixt, i);
+       if(tgtpdg == pdg) return true;
+    }
+  } else {
+     int pdg = this->GetTargetPdgCode(mat);
+     if(tgtpdg == pdg) return true;
+  }
+  return false;
+}
+//___________________________________________________________________________
+double ROOTGeomAnalyzer::StepToNextBoundary(TGeoNavigator * nav)
+{
+  nav->FindNextBoundary();
+  double step=nav->GetStep();
   return step;
 }
 //___________________________________________________________________________
-double ROOTGeomAnalyzer::Step(void)
+double ROOTGeomAnalyzer::Step(TGeoNavigator * nav)
 {
-  fGeometry->Step();
-  double step=fGeometry->GetStep();
+  nav->Step();
+  EventGenCost::Current().ngeomsteps++;
+  double step=nav->GetStep();
   return step;
 }
 //___________________________________________________________________________
-double ROOTGeomAnalyzer::StepUntilEntering(void)
+double ROOTGeomAnalyzer::StepUntilEntering(TGeoNavigator * nav)
 {
-  this->StepToNextBoundary();  // doesn't actually step, so don't include in sum
+  this->StepToNextBoundary(nav);  // doesn't actually step, so don't include in sum
   double step = 0; //
 
-  while(!fGeometry->IsEntering()) {
-    step += this->Step();
+  while(!nav->IsEntering()) {
+    step += this->Step(nav);
   }
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
 
-  bool isen = fGeometry->IsEntering();
-  bool isob = fGeometry->IsOnBoundary();
+  bool isen = nav->IsEntering();
+  bool isob = nav->IsOnBoundary();
 
   LOG("GROOTGeom",pDEBUG)
       << "IsEntering = "     << utils::print::BoolAsYNString(isen)
@@ -1616,3 +2410,27 @@ bool ROOTGeomAnalyzer::WillNeverEnter(double step)
 }
 
 //___________________________________________________________________________
+
+//===========================================================================
+// Per-thread navigation context:
+
+//___________________________________________________________________________
+ROOTGeomNavContext::ROOTGeomNavContext(
+                        TGeoNavigator * nav, const PDGCodeList & pdglist) :
+fNavigator       (nav),
+fPathSegmentList (new PathSegmentList()),
+fPathLengthList  (new PathLengthList(pdglist)),
+fVertex          (0.,0.,0.),
+fSwimCache       (0),
+fTgtPathLengths  (pdglist.size(), 0.)
+{
+
+}
+//___________________________________________________________________________
+ROOTGeomNavContext::~ROOTGeomNavContext()
+{
+  delete fPathSegmentList;
+  delete fPathLengthList;
+  delete fSwimCache;
+}
+//___________________________________________________________________________
@@ -5,6 +5,14 @@
 
 \brief    A ROOT/GEANT4 geometry driver
 
+          The driver holds the geometry description and its configuration,
+          while the navigation state (TGeoNavigator, path-segment and
+          path-length lists, generated vertex) is kept in a per-thread
+          ROOTGeomNavContext. Once configured (and once SetMaxThreads() has
+          been called from the main thread) ComputePathLengths() and
+          GenerateVertex() can be called from several threads at a time,
+          unless a GeomVolSelectorI (which holds the current ray) is used.
+
 \author   Anselmo Meregaglia <anselmo.meregaglia \at cern.ch>
           ETH Zurich
 
@@ -26,6 +34,7 @@
 #define _ROOT_GEOMETRY_ANALYZER_H_
 
 #include <string>
+#include <vector>
 #include <algorithm>
 
 #include <TGeoManager.h>
@@ -39,6 +48,7 @@ class TGeoMaterial;
 class TGeoMixture;
 class TGeoElement;
 class TGeoHMatrix;
+class TGeoNavigator;
 
 using std::string;
 
@@ -50,6 +60,22 @@ namespace geometry {
 
 class PathSegmentList;
 class GeomVolSelectorI;
+class ROOTGeomSwimCache;
+
+//! Navigation state of one thread using a ROOTGeomAnalyzer
+class ROOTGeomNavContext {
+
+public :
+  ROOTGeomNavContext(TGeoNavigator * nav, const PDGCodeList & pdglist);
+ ~ROOTGeomNavContext();
+
+  TGeoNavigator *   fNavigator;       ///< navigator of the thread (owned by the TGeoManager)
+  PathSegmentList * fPathSegmentList; ///< current list of path-segments
+  PathLengthList *  fPathLengthList;  ///< current list of path-lengths
+  TVector3          fVertex;          ///< current generated vertex
+  ROOTGeomSwimCache * fSwimCache;     ///< volumes of the swum rays of each flux window & direction cell
+  std::vector<double> fTgtPathLengths; ///< per target nucleus path-lengths of the current ray (scratch)
+};
 
 class ROOTGeomAnalyzer : public GeomAnalyzerI {
 
@@ -69,26 +95,46 @@ public :
   virtual const  TVector3 &       GenerateVertex(const TLorentzVector & x,
                                                  const TLorentzVector & p, int tgtpdg);
 
+  /// compute the path-lengths of a batch of rays (see ComputePathLengths()),
+  /// in the order of the materials of ListOfTargetNuclei():
+  /// pl[iray*nmat + imat]
+  virtual void ComputePathLengthsBatch (const std::vector<TLorentzVector> & x4,
+                                        const std::vector<TLorentzVector> & p4,
+                                        std::vector<double> & pl);
+
+  /// (trimmed) path segments of the last ray swum by the calling thread
+  virtual const PathSegmentList & CurrentPathSegmentList (void);
+
   /// set geometry driver's configuration options
 
   virtual void SetScannerNPoints    (int    np) { fNPoints    = np; } /* box  scanner */
   virtual void SetScannerNRays      (int    nr) { fNRays      = nr; } /* box  scanner */
   virtual void SetScannerNParticles (int    np) { fNParticles = np; } /* flux scanner */
   virtual void SetScannerFlux       (GFluxI* f) { fFlux       = f;  } /* flux scanner */
-  virtual void SetWeightWithDensity (bool   wt) { fDensWeight = wt; }
+  virtual void SetScannerNThreads   (int    nt) { fNThreads   = nt; } /* box & flux scanners */
+  virtual void SetScannerConvergence(int nblocks, double tol = 1E-3); /* box & flux scanners */
+  virtual void SetWeightWithDensity (bool   wt);
   virtual void SetMixtureWeightsSum (double sum);
   virtual void SetLengthUnits       (double lu);
   virtual void SetDensityUnits      (double du);
   virtual void SetMaxPlSafetyFactor (double sf);
   virtual void SetTopVolName        (string nm);
   virtual void SetKeepSegPath       (bool keep) { fKeepSegPath = keep; }
+  virtual void SetVtxFromSegments   (bool  seg) { fVtxFromSegments = seg; }
+  virtual void SetClipToTopBox      (bool clip) { fClipToTopBox = clip; } /* skip rays missing the top vol bounding box */
   virtual void SetDebugFlags        (int  flgs) { fDebugFlags  = flgs; }
+  virtual void SetMaxThreads        (int    nt);  /* threads navigating the geometry */
+  virtual void SetSwimCacheCells    (double dx, double dtheta); /* beam flux swim cache */
 
   /// retrieve geometry driver's configuration options
 
   virtual int           ScannerNPoints    (void) const { return fNPoints;           }
   virtual int           ScannerNRays      (void) const { return fNRays;             }
   virtual int           ScannerNParticles (void) const { return fNParticles;        }
+  virtual int           ScannerNThreads   (void) const { return fNThreads;          }
+  virtual int           ScannerConvBlocks (void) const { return fConvBlocks;        }
+  virtual double        ScannerConvTol    (void) const { return fConvTol;           }
+  virtual double        MaxPlSafetyFactorNeeded (void) const { return fMaxPlSafetyFactorNeeded; }
   virtual bool          WeightWithDensity (void) const { return fDensWeight;        }
   virtual double        LengthUnits       (void) const { return fLengthScale;       }
   virtual double        DensityUnits      (void) const { return fDensityScale;      }
@@ -97,8 +143,16 @@ public :
   virtual string        TopVolName        (void) const { return fTopVolumeName;     }
   virtual TGeoManager * GetGeometry       (void) const { return fGeometry;          }
   virtual bool          GetKeepSegPath    (void) const { return fKeepSegPath;       }
+  virtual bool          VtxFromSegments   (void) const { return fVtxFromSegments;   }
+  virtual bool          ClipToTopBox      (void) const { return fClipToTopBox;      }
+  virtual double        SwimCachePosCell  (void) const { return fSwimCachePosCell;  }
+  virtual double        SwimCacheDirCell  (void) const { return fSwimCacheDirCell;  }
   virtual const PathLengthList& GetMaxPathLengths(void) const { return *fCurrMaxPathLengthList; } // call only after ComputeMaxPathLengths() has been called
 
+  /// navigation state of the calling thread (created on first use)
+
+  virtual ROOTGeomNavContext & NavContext (void);
+
   /// access to geometry coordinate/unit transforms for validation/test purposes
 
   virtual void   Local2SI      (PathLengthList & pl) const;
@@ -128,19 +182,37 @@ protected:
   virtual double GetWeight               (const TGeoMaterial * mat, int pdgc);
   virtual double GetWeight               (const TGeoMixture * mixt, int pdgc);
   virtual double GetWeight               (const TGeoMixture * mixt, int ielement, int pdgc);
+  virtual void   BuildWeightTable        (void);
+  int            TargetIndex             (int pdgc) const;
+  const double * WeightTableRow          (const TGeoMaterial * mat) const;
+  double         TargetWeight            (const TGeoMaterial * mat, int pdgc);
 
+  virtual void   MaxPathLengthsConverge  (void);
   virtual void   MaxPathLengthsFluxMethod(void);
   virtual void   MaxPathLengthsBoxMethod (void);
   virtual bool   GenBoxRay               (int indx, TLorentzVector& x4, TLorentzVector& p4);
+  virtual void   RayPathLengths          (const TLorentzVector & x, const TLorentzVector & p,
+                                          ROOTGeomNavContext & ctx);
 
-  virtual double ComputePathLengthPDG    (const TVector3 & r, const TVector3 & udir, int pdgc);
+  virtual double ComputePathLengthPDG    (const TVector3 & r, const TVector3 & udir, int pdgc,
+                                          ROOTGeomNavContext & ctx);
+  virtual double PathLengthPDG           (const PathSegmentList & psl, int pdgc);
   virtual void   SwimOnce                (const TVector3 & r, const TVector3 & udir);
-
-  virtual bool   FindMaterialInCurrentVol(int pdgc);
+  virtual void   Swim                    (const TVector3 & r, const TVector3 & udir,
+                                          ROOTGeomNavContext & ctx);
+  virtual bool   SwimGeometry            (const TVector3 & r, const TVector3 & udir,
+                                          ROOTGeomNavContext & ctx);
+  virtual bool   SwimFromCache           (const TVector3 & r, const TVector3 & udir,
+                                          ROOTGeomNavContext & ctx);
+  virtual void   SetTopBox               (void);
+  virtual bool   MissesTopBox            (const TVector3 & r, const TVector3 & udir) const;
+
+  virtual bool   FindMaterialInCurrentVol(int pdgc, TGeoNavigator * nav);
+  virtual bool   HasTargetMaterial       (const TGeoMaterial * mat, int pdgc) const;
   virtual bool   WillNeverEnter          (double step);
-  virtual double StepToNextBoundary      (void);
-  virtual double Step                    (void);
-  virtual double StepUntilEntering       (void);
+  virtual double StepToNextBoundary      (TGeoNavigator * nav);
+  virtual double Step                    (TGeoNavigator * nav);
+  virtual double StepUntilEntering       (TGeoNavigator * nav);
 
 
 
@@ -150,22 +222,34 @@ protected:
   int              fNPoints;               ///< max path length scanner (box method): points/surface [def:200]
   int              fNRays;                 ///< max path length scanner (box method): rays/point [def:200]
   int              fNParticles;            ///< max path length scanner (flux method): particles in [def:10000]
+  int              fNThreads;              ///< max path length scanner: threads tracing the rays [def:1]
+  int              fConvBlocks;            ///< max path length scanner: stop once no max grew for that many scans [def:0, single scan]
+  double           fConvTol;               ///< max path length scanner: relative growth of a max not counted as growth
+  double           fMaxPlSafetyFactorNeeded; ///< max path length scanner: factor between the converged and the first scan max path lengths
   GFluxI *         fFlux;                  ///< a flux objects that can be used to scan the max path lengths
   bool             fDensWeight;            ///< if true pathlengths are weighted with density [def:true]
   double           fLengthScale;           ///< conversion factor: input geometry length units -> meters
   double           fDensityScale;          ///< conversion factor: input geometry density units -> kgr/meters^3
   double           fMaxPlSafetyFactor;     ///< factor that can multiply the computed max path lengths
   double           fMixtWghtSum;           ///< norm of relative weights (<0 if explicit summing required)
-  TVector3 *       fCurrVertex;            ///< current generated vertex
-  PathLengthList * fCurrPathLengthList;    ///< current list of path-lengths
   PathLengthList * fCurrMaxPathLengthList; ///< current list of max path-lengths
   PDGCodeList *    fCurrPDGCodeList;       ///< current list of target nuclei
+  std::vector<const TGeoMaterial*> fTgtMaterials; ///< distinct materials of the geometry volumes
+  std::vector<int> fWeightTableRow;        ///< row of each material (by TGeoMaterial index) in the weight table, -1 if none
+  std::vector<double> fWeightTable;        ///< (material x target nucleus) weights, curr geom density units
   TGeoVolume *     fTopVolume;             ///< top volume
   TGeoHMatrix *    fMasterToTop;           ///< matrix connecting master coordinates to top volume coordinates
   bool             fMasterToTopIsIdentity; ///< is fMasterToTop matrix the identity matrix?
 
   bool             fKeepSegPath;           ///< need to fill path segment "path"
-  PathSegmentList* fCurrPathSegmentList;   ///< current list of path-segments
+  double           fSwimCachePosCell;      ///< swim cache: flux window cell size (m) [def:0, no cache]
+  double           fSwimCacheDirCell;      ///< swim cache: direction cell size (rad)
+  bool             fVtxFromSegments;       ///< place the vertex using the swum path segments only (no geometry look-up) [def:false]
+  bool             fClipToTopBox;          ///< don't swim rays missing the top volume bounding box [def:true]
+  double           fTopBoxMin[3];          ///< top volume bounding box, low corner (top vol coord & units)
+  double           fTopBoxMax[3];          ///< top volume bounding box, high corner (top vol coord & units)
+  ROOTGeomNavContext * fMainNavContext;    ///< navigation state of the thread that loaded the geometry
+  unsigned long    fNavId;                 ///< unique id of this driver's navigation contexts
   GeomVolSelectorI* fGeomVolSelector;      ///< optional path seg trimmer (owned)
 
   // used by GenBoxRay to retain history between calls
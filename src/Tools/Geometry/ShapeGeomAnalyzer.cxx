@@ -0,0 +1,283 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2020, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+
+ For the class documentation see the corresponding header file.
+*/
+//____________________________________________________________________________
+
+#include <algorithm>
+
+#include <TLorentzVector.h>
+#include <TMath.h>
+
+#include "Tools/Geometry/ShapeGeomAnalyzer.h"
+#include "Tools/Geometry/FidShape.h"
+#include "Framework/EventGen/PathLengthList.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/ParticleData/PDGCodeList.h"
+
+using namespace genie;
+using namespace genie::geometry;
+
+//___________________________________________________________________________
+ShapeGeomAnalyzer::ShapeGeomAnalyzer() :
+GeomAnalyzerI(),
+fCurrVertex(0,0,0)
+{
+  fCurrPDGCodeList       = new PDGCodeList;
+  fCurrPathLengthList    = new PathLengthList;
+  fCurrMaxPathLengthList = new PathLengthList;
+}
+//___________________________________________________________________________
+ShapeGeomAnalyzer::~ShapeGeomAnalyzer()
+{
+  this->CleanUp();
+}
+//___________________________________________________________________________
+void ShapeGeomAnalyzer::AddBox(
+   const TVector3 & xyzmin, const TVector3 & xyzmax,
+   const map<int,double> & tgtmap)
+{
+  double bmin[3], bmax[3];
+  for ( int j = 0; j < 3; ++j ) {
+    bmin[j] = TMath::Min(xyzmin[j],xyzmax[j]);
+    bmax[j] = TMath::Max(xyzmin[j],xyzmax[j]);
+  }
+
+  FidPolyhedron * poly = new FidPolyhedron();
+  // careful about sign of "d" vs. direction normal
+  poly->push_back(PlaneParam(-1,0,0, bmin[0]));
+  poly->push_back(PlaneParam(0,-1,0, bmin[1]));
+  poly->push_back(PlaneParam(0,0,-1, bmin[2]));
+  poly->push_back(PlaneParam(+1,0,0,-bmax[0]));
+  poly->push_back(PlaneParam(0,+1,0,-bmax[1]));
+  poly->push_back(PlaneParam(0,0,+1,-bmax[2]));
+
+  double maxchord = (xyzmax - xyzmin).Mag();
+
+  this->AddLayer(poly, maxchord, tgtmap);
+}
+//___________________________________________________________________________
+void ShapeGeomAnalyzer::AddSphere(
+   const TVector3 & center, double radius, const map<int,double> & tgtmap)
+{
+  this->AddLayer(new FidSphere(center,radius), 2*radius, tgtmap);
+}
+//___________________________________________________________________________
+void ShapeGeomAnalyzer::AddCylinder(
+   const TVector3 & base, const TVector3 & axis, double radius, double length,
+   const map<int,double> & tgtmap)
+{
+// Cylinder of the input radius, whose axis starts at the base point and
+// extends over the input length along the axis direction
+
+  TVector3 u = axis.Unit();
+  TVector3 top = base + length * u;
+
+  PlaneParam cap1(-u.X(),-u.Y(),-u.Z(), u.Dot(base)); // note sign change
+  PlaneParam cap2(+u.X(),+u.Y(),+u.Z(),-u.Dot(top));
+
+  double maxchord = TMath::Sqrt(4*radius*radius + length*length);
+
+  this->AddLayer(new FidCylinder(base,u,radius,cap1,cap2), maxchord, tgtmap);
+}
+//___________________________________________________________________________
+void ShapeGeomAnalyzer::AddLayer(
+   FidShape * shape, double maxchord, const map<int,double> & tgtmap)
+{
+  Layer_t layer;
+  layer.fShape    = shape;
+  layer.fMaxChord = maxchord;
+  layer.fTgtMap   = tgtmap;
+  fLayers.push_back(layer);
+
+  map<int,double>::const_iterator iter;
+  for(iter = tgtmap.begin(); iter != tgtmap.end(); ++iter) {
+    if(! fCurrPDGCodeList->ExistsInPDGCodeList(iter->first)) {
+      fCurrPDGCodeList->push_back(iter->first);
+    }
+  }
+
+  delete fCurrPathLengthList;
+  delete fCurrMaxPathLengthList;
+  fCurrPathLengthList    = new PathLengthList(*fCurrPDGCodeList);
+  fCurrMaxPathLengthList = new PathLengthList(*fCurrPDGCodeList);
+
+  LOG("ShapeGeom", pNOTICE)
+    << "Added layer " << fLayers.size()-1 << ": " << *shape
+    << " (max chord: " << maxchord << " m)";
+}
+//___________________________________________________________________________
+const PDGCodeList & ShapeGeomAnalyzer::ListOfTargetNuclei(void)
+{
+  return *fCurrPDGCodeList;
+}
+//___________________________________________________________________________
+const PathLengthList & ShapeGeomAnalyzer::ComputeMaxPathLengths(void)
+{
+// Upper bound of the max path lengths: for each nucleus, the sum of the
+// max chords x density weights of the layers it is found in
+
+  fCurrMaxPathLengthList->SetAllToZero();
+
+  for(unsigned int il = 0; il < fLayers.size(); il++) {
+    const Layer_t & layer = fLayers[il];
+    map<int,double>::const_iterator iter;
+    for(iter = layer.fTgtMap.begin(); iter != layer.fTgtMap.end(); ++iter) {
+      fCurrMaxPathLengthList->AddPathLength(
+          iter->first, layer.fMaxChord * iter->second);
+    }
+  }
+
+  LOG("ShapeGeom", pNOTICE)
+    << "Max path lengths: " << *fCurrMaxPathLengthList;
+
+  return *fCurrMaxPathLengthList;
+}
+//___________________________________________________________________________
+const PathLengthList & ShapeGeomAnalyzer::ComputePathLengths(
+                          const TLorentzVector & x, const TLorentzVector & p)
+{
+  fCurrPathLengthList->SetAllToZero();
+
+  this->Intervals(x,p);
+
+  for(unsigned int i = 0; i < fIntervals.size(); i++) {
+    const Interval_t & intv = fIntervals[i];
+    double step = intv.fDistOut - intv.fDistIn;
+    const map<int,double> & tgtmap = fLayers[intv.fLayer].fTgtMap;
+    map<int,double>::const_iterator iter;
+    for(iter = tgtmap.begin(); iter != tgtmap.end(); ++iter) {
+      fCurrPathLengthList->AddPathLength(iter->first, step * iter->second);
+    }
+  }
+
+  return *fCurrPathLengthList;
+}
+//___________________________________________________________________________
+const TVector3 & ShapeGeomAnalyzer::GenerateVertex(
+   const TLorentzVector & x, const TLorentzVector & p, int tgtpdg)
+{
+// Generate a vertex along the input ray, uniformly in the density weighted
+// path length of the input target nucleus
+
+  fCurrVertex.SetXYZ(0.,0.,0.);
+
+  this->Intervals(x,p);
+
+  double maxwgt_dist = 0;
+  for(unsigned int i = 0; i < fIntervals.size(); i++) {
+    const Interval_t & intv = fIntervals[i];
+    maxwgt_dist +=
+      (intv.fDistOut - intv.fDistIn) * this->Weight(intv.fLayer, tgtpdg);
+  }
+  if ( maxwgt_dist <= 0 ) {
+    LOG("ShapeGeom", pERROR)
+     << "The current trajectory does not cross the selected material!!";
+    return fCurrVertex;
+  }
+
+  RandomGen * rnd = RandomGen::Instance();
+  double genwgt_dist = maxwgt_dist * rnd->RndGeom().Rndm();
+
+  TVector3 udir = p.Vect().Unit();
+  double walked = 0;
+  for(unsigned int i = 0; i < fIntervals.size(); i++) {
+    const Interval_t & intv = fIntervals[i];
+    double wgt = this->Weight(intv.fLayer, tgtpdg);
+    double wgtstep = (intv.fDistOut - intv.fDistIn) * wgt;
+    if ( wgtstep > 0 && walked + wgtstep >= genwgt_dist ) {
+      double dist = intv.fDistIn + (genwgt_dist - walked) / wgt;
+      fCurrVertex = x.Vect() + dist * udir;
+      break;
+    }
+    walked += wgtstep;
+  }
+
+  LOG("ShapeGeom", pINFO)
+    << "Vertex = (" << fCurrVertex.X() << ", " << fCurrVertex.Y()
+    << ", " << fCurrVertex.Z() << ") m";
+
+  return fCurrVertex;
+}
+//___________________________________________________________________________
+void ShapeGeomAnalyzer::Intervals(
+                          const TLorentzVector & x, const TLorentzVector & p)
+{
+// Split the input ray (from its start point on) into the intervals of the
+// layers it crosses, the layer added last taking precedence where layers
+// overlap
+
+  fIntervals.clear();
+
+  TVector3 start = x.Vect();
+  TVector3 udir  = p.Vect().Unit();
+
+  const int nl = fLayers.size();
+  std::vector<RayIntercept> icpt(nl);
+  std::vector<double> edges;
+  for(int il = 0; il < nl; il++) {
+    icpt[il] = fLayers[il].fShape->Intercept(start,udir);
+    if ( ! icpt[il].fIsHit || icpt[il].fDistOut <= 0 ) {
+      icpt[il].fIsHit = false;
+      continue;
+    }
+    icpt[il].fDistIn = TMath::Max(0., icpt[il].fDistIn);
+    edges.push_back(icpt[il].fDistIn);
+    edges.push_back(icpt[il].fDistOut);
+  }
+  std::sort(edges.begin(), edges.end());
+
+  for(unsigned int ie = 1; ie < edges.size(); ie++) {
+    double s0 = edges[ie-1];
+    double s1 = edges[ie];
+    if ( s1 <= s0 ) continue;
+    double smid = 0.5*(s0+s1);
+    int ilayer = -1;
+    for(int il = nl-1; il >= 0; il--) {
+      if ( icpt[il].fIsHit &&
+           icpt[il].fDistIn <= smid && smid <= icpt[il].fDistOut ) {
+        ilayer = il;
+        break;
+      }
+    }
+    if ( ilayer < 0 ) continue;
+    // merge with the previous interval of the same layer
+    if ( ! fIntervals.empty() && fIntervals.back().fLayer == ilayer &&
+         fIntervals.back().fDistOut == s0 ) {
+      fIntervals.back().fDistOut = s1;
+      continue;
+    }
+    Interval_t intv;
+    intv.fDistIn  = s0;
+    intv.fDistOut = s1;
+    intv.fLayer   = ilayer;
+    fIntervals.push_back(intv);
+  }
+}
+//___________________________________________________________________________
+double ShapeGeomAnalyzer::Weight(int ilayer, int tgtpdg) const
+{
+  const map<int,double> & tgtmap = fLayers[ilayer].fTgtMap;
+  map<int,double>::const_iterator iter = tgtmap.find(tgtpdg);
+  return ( iter != tgtmap.end() ) ? iter->second : 0.;
+}
+//___________________________________________________________________________
+void ShapeGeomAnalyzer::CleanUp(void)
+{
+  for(unsigned int il = 0; il < fLayers.size(); il++) {
+    delete fLayers[il].fShape;
+  }
+  fLayers.clear();
+
+  if( fCurrPathLengthList    ) delete fCurrPathLengthList;
+  if( fCurrMaxPathLengthList ) delete fCurrMaxPathLengthList;
+  if( fCurrPDGCodeList       ) delete fCurrPDGCodeList;
+}
+//___________________________________________________________________________
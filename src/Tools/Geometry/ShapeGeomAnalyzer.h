@@ -0,0 +1,118 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::geometry::ShapeGeomAnalyzer
+
+\brief   A lightweight implementation of the GeomAnalyzerI interface for
+         detectors made of a few simple analytic shapes (boxes, spheres and
+         cylinders), each filled with its own mix of target nuclei.
+
+         Path lengths and vertices are computed from the closed-form ray
+         intersections of the shapes (see FidShape) rather than by navigating
+         a ROOT geometry, which is much faster for the single-material box
+         or cylinder (or layered shapes) used in sensitivity studies.
+
+         Shapes (layers) may overlap: where they do, the layer added last
+         takes precedence, so that the outer volumes are to be added first
+         (eg. a rock sphere, then the detector cylinder inside it).
+         Positions and shape dimensions are in meters, in the coordinate
+         system of the flux driver. The composition of each layer is given
+         as a map of target nucleus pdg code -> density weight (kg/m^3, ie.
+         the layer density times the nucleus mass fraction), so that the
+         computed path lengths are (as for ROOTGeomAnalyzer) density
+         weighted, in kg/m^2.
+
+         The max path length of each nucleus is the sum, over the layers
+         containing it, of the layer's max chord times its density weight:
+         an upper bound rather than the exact maximum.
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _SHAPE_GEOMETRY_ANALYZER_H_
+#define _SHAPE_GEOMETRY_ANALYZER_H_
+
+#include <map>
+#include <vector>
+
+#include <TVector3.h>
+
+#include "Framework/EventGen/GeomAnalyzerI.h"
+
+using std::map;
+
+namespace genie    {
+namespace geometry {
+
+class FidShape;
+
+class ShapeGeomAnalyzer : public GeomAnalyzerI {
+
+public :
+  ShapeGeomAnalyzer();
+ ~ShapeGeomAnalyzer();
+
+  // add the detector layers (outer ones first), in meters,
+  // with their pdg code -> density weight (kg/m^3) map
+
+  void AddBox      (const TVector3 & xyzmin, const TVector3 & xyzmax,
+                    const map<int,double> & tgtmap);
+  void AddSphere   (const TVector3 & center, double radius,
+                    const map<int,double> & tgtmap);
+  void AddCylinder (const TVector3 & base, const TVector3 & axis,
+                    double radius, double length,
+                    const map<int,double> & tgtmap);
+
+  int  NLayers     (void) const { return fLayers.size(); }
+
+  // implement the GeomAnalyzerI interface
+
+  const PDGCodeList &    ListOfTargetNuclei    (void);
+  const PathLengthList & ComputeMaxPathLengths (void);
+
+  const PathLengthList &
+           ComputePathLengths
+             (const TLorentzVector & x, const TLorentzVector & p);
+  const TVector3 &
+           GenerateVertex
+             (const TLorentzVector & x, const TLorentzVector & p, int tgtpdg);
+private:
+
+  //! A shape and its composition
+  struct Layer_t {
+    FidShape *      fShape;    ///< shape (owned)
+    double          fMaxChord; ///< longest chord through the shape (m)
+    map<int,double> fTgtMap;   ///< target pdg code -> density weight (kg/m^3)
+  };
+
+  //! A ray interval within the (visible part of a) single layer
+  struct Interval_t {
+    double fDistIn;            ///< distance along the ray where it starts (m)
+    double fDistOut;           ///< distance along the ray where it ends (m)
+    int    fLayer;             ///< layer
+  };
+
+  void   AddLayer   (FidShape * shape, double maxchord, const map<int,double> & tgtmap);
+  void   Intervals  (const TLorentzVector & x, const TLorentzVector & p);
+  double Weight     (int ilayer, int tgtpdg) const;
+  void   CleanUp    (void);
+
+  std::vector<Layer_t>    fLayers;             ///< detector layers
+  std::vector<Interval_t> fIntervals;          ///< layer intervals of the current ray
+  TVector3                fCurrVertex;         ///< current generated vertex
+  PathLengthList *        fCurrPathLengthList; ///< current list of path-lengths
+  PathLengthList *        fCurrMaxPathLengthList; ///< list of max path-lengths
+  PDGCodeList *           fCurrPDGCodeList;    ///< current list of target nuclei
+};
+
+}      // geometry namespace
+}      // genie    namespace
+
+#endif // _SHAPE_GEOMETRY_ANALYZER_H_
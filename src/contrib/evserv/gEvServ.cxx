@@ -5,12 +5,37 @@
 
 \brief   GENIE v+A event generation server 
 
+         A long-lived server: the generator is initialised (tune, splines and
+         event generation drivers) once and then serves events to any number
+         of successive client connections, until it is shut down.
+         Besides single events (EVTVTX, sent as text STDHEP lines), clients
+         can pull event batches (EVTBATCH) streamed as compact GHEP records
+         (NtpMCCompactEventRecord) in ROOT messages, so that downstream
+         detector simulation jobs can take events on demand, without a GENIE
+         start-up per job and without intermediate event files.
+         See client_test.C for the message syntax.
+
          Syntax :
-           gevserv [-p port]
+           gevserv [-p port] [--seed random_number_seed]
+                   [--cross-sections xml_file]
+                   [--tune genie_tune]
+                   [--output-compression alg[:level]]
+                   [--message-thresholds xml_file]
 
          Options :
            [] denotes an optional argument
            -p port number (default: 9090)
+           --seed
+              Random number seed.
+           --cross-sections
+              Cross section splines loaded at start-up (default: $GSPLOAD).
+           --tune
+              Specifies a GENIE comprehensive neutrino interaction model tune.
+              [default: "Default"].
+           --output-compression
+              ROOT compression settings of the streamed event batches.
+           --message-thresholds
+              Allows users to customize the message stream thresholds.
 
 \author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
  University of Liverpool & STFC Rutherford Appleton Laboratory
@@ -36,21 +61,24 @@
 #include <TBits.h>
 #include <TMath.h>
 
-#include "Conventions/Units.h"
-#include "EVGCore/EventRecord.h"
-#include "EVGDrivers/GEVGDriver.h"
-#include "EVGDrivers/GEVGPool.h"
-#include "EVGDrivers/GMCJMonitor.h"
-#include "GHEP/GHepFlags.h"
-#include "GHEP/GHepParticle.h"
-#include "GHEP/GHepRecord.h"
-#include "Interaction/Interaction.h"
-#include "Messenger/Messenger.h"
-#include "Numerical/Spline.h"
-#include "PDG/PDGCodeList.h"
-#include "Utils/XSecSplineList.h"
-#include "Utils/StringUtils.h"
-#include "Utils/CmdLnArgParser.h"
+#include "Framework/Conventions/Units.h"
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/GEVGDriver.h"
+#include "Framework/EventGen/GEVGPool.h"
+#include "Framework/EventGen/GMCJMonitor.h"
+#include "Framework/GHEP/GHepFlags.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/GHEP/GHepRecord.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpMCCompactEventRecord.h"
+#include "Framework/Numerical/Spline.h"
+#include "Framework/ParticleData/PDGCodeList.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/XSecSplineList.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Framework/Utils/CmdLnArgParser.h"
 
 using std::string;
 using std::vector;
@@ -64,11 +92,14 @@ using namespace genie::utils;
 void GetCommandLineArgs (int argc, char ** argv);
 void PrintSyntax        (void);
 void RunInitChecks      (void);
+void Initialize         (void);
+void Serve              (void);
 void HandleMesg         (string mesg);
 void Handshake          (void);
 void Configure          (string mesg);
 void CalcTotalXSec      (string mesg);
 void GenerateEvent      (string mesg);
+void GenerateBatch      (string mesg);
 void Shutdown           (void);
 
 // ** Consts & Defaults
@@ -88,6 +119,10 @@ const string kEvgenCmdRecv         = "EVTVTX";
 const string kEvgenHdrCmdSent      = "EVTREC";
 const string kEvgenStdhepCmdSent   = "STDHEP";
 const string kEvgenOkMesgSent      = "EVENT GENERATED";
+const string kBatchCmdRecv         = "EVTBATCH";
+const string kBatchHdrCmdSent      = "EVTBATCH";
+const string kBatchOkMesgSent      = "BATCH GENERATED";
+const int    kBatchMaxTries        = 100;   // attempts per batch event
 const string kShutdownCmdRecv      = "SHUTDOWN";
 const string kShutdownOkMesgSent   = "SHUTTING DOWN";
 const string kErrNoConf            = "*** NOT CONFIGURED! ***";
@@ -97,7 +132,9 @@ const string kErr                  = "FAILED";
 
 // ** User-specified options:
 //
-int gOptPortNum;   // port number
+int      gOptPortNum;      // port number
+long int gOptRanSeed;      // random number seed
+string   gOptInpXSecFile;  // cross section splines file
 
 // ** Globals
 //
@@ -115,42 +152,67 @@ int main(int argc, char ** argv)
   // Run some checks
   RunInitChecks();
 
+  // Initialise the tune, random number generators & splines (once)
+  Initialize();
+
   // Open a server socket
   TServerSocket * serv_sock = new TServerSocket(gOptPortNum, kTRUE);
+  if(!serv_sock->IsValid()) exit(1);
+  LOG("gevserv", pNOTICE) << "Listening on port: " << gOptPortNum;
 
-  // Accept a connection
-  gSock = serv_sock->Accept();
+  // Accept connections, one client at a time, until shut down.
+  // The configured event generation drivers are kept across connections.
 
-  if(!gSock) exit(1);
-  LOG("gevserv", pNOTICE) << "Listening on port: " << gOptPortNum;
-  
-  // Set no TCP/IP NODELAY
-  int delay_ok = gSock->SetOption(kNoDelay,1);
-  LOG("gevserv", pNOTICE) << "TCP_NODELAY > " << delay_ok;
+  while(!gShutDown) {
+
+    gSock = serv_sock->Accept();
+    if(!gSock || !gSock->IsValid()) break;
 
-  // Start listening for messages & take the corresponding actions
+    // Set no TCP/IP NODELAY
+    int delay_ok = gSock->SetOption(kNoDelay,1);
+    LOG("gevserv", pNOTICE) << "TCP_NODELAY > " << delay_ok;
 
-  while(1) {
+    Serve();
 
-    if(gShutDown) break;
+    gSock->Close();
+    delete gSock;
+    gSock = 0;
+  }
+
+  serv_sock->Close();
+  delete serv_sock;
+
+  return 0;
+}
+//____________________________________________________________________________
+void Serve(void)
+{
+// Listen for messages from the connected client & take the corresponding 
+// actions, until the client disconnects or asks for a shutdown
+
+  while(!gShutDown) {
 
     TMessage * mesg = 0;
 
-    gSock->Recv(mesg);
+    // a non-positive return value means the client went away
+    if(gSock->Recv(mesg) <= 0) {
+      LOG("gevserv", pNOTICE) << "Client disconnected";
+      delete mesg;
+      return;
+    }
 
     if(!mesg) continue;
-    if(mesg->What() != kMESS_STRING) continue;
+    if(mesg->What() != kMESS_STRING) { delete mesg; continue; }
 
     char mesg_content[2048];
     mesg->ReadString(mesg_content, 2048);
+    delete mesg;
 
     LOG("gevserv", pNOTICE) << "Processing mesg > " << mesg_content;
 
     HandleMesg(mesg_content);
 
-  } // while(1)
-
-  return 0;
+  } // while(!gShutDown)
 }
 //____________________________________________________________________________
 void HandleMesg(string mesg)
@@ -175,6 +237,11 @@ void HandleMesg(string mesg)
     GenerateEvent(mesg);
   } 
   else
+  if (mesg.find(kBatchCmdRecv.c_str()) != string::npos) 
+  {
+    GenerateBatch(mesg);
+  } 
+  else
   if (mesg.find(kShutdownCmdRecv.c_str()) != string::npos) 
   {
     Shutdown();
@@ -199,7 +266,7 @@ void Configure(string mesg)
 // ** Load splines 
 //    - if the "load-splines" command is contained in the mesg 
 //    - the splines are loaded from the the XML file specified in $GSPLOAD (server-side) 
-//    the "load-splines" mesg is sent
+//      unless they were already loaded at start-up (--cross-sections)
 // ** Specify the neutrino list
 //    - adding a "neutrino-list=<comma separated list of pdg codes>" in the mesg
 // ** Specify the target list
@@ -221,12 +288,14 @@ void Configure(string mesg)
 
   LOG("gevserv", pNOTICE) << "Configure options: " << mesg;
 
-  // Autoload splines from the XML file pointed at the $GSPLOAD env. var.
-  // (if set at the server side)
+  // Load splines from the XML file pointed at the $GSPLOAD env. var.
+  // (if set at the server side and not already loaded at start-up)
   //
   if(mesg.find(kConfigCmdLdSpl) != string::npos) {
-     XSecSplineList * xspl = XSecSplineList::Instance();
-     xspl->AutoLoad();
+     if(gOptInpXSecFile.empty() && gSystem->Getenv("GSPLOAD")) {
+       XSecSplineList * xspl = XSecSplineList::Instance();
+       xspl->LoadFromXml(gSystem->Getenv("GSPLOAD"));
+     }
 
      mesg.erase(mesg.find(kConfigCmdLdSpl),12);
      mesg = str::TrimSpaces(mesg);             
@@ -289,11 +358,16 @@ void Configure(string mesg)
 
      InitialState init_state(target_code, neutrino_code);
 
+     // already configured by an earlier client?
+     if(gGPool.FindDriver(init_state)) continue;
+
      LOG("gevserv", pNOTICE)
        << "\n\n ---- Creating a GEVGDriver object configured for init-state: "
        << init_state.AsString() << " ----\n\n";
 
      GEVGDriver * evgdriver = new GEVGDriver;
+     evgdriver->SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+     evgdriver->SetUnphysEventMask(*RunOpt::Instance()->UnphysEventMask());
      evgdriver->Configure(init_state);
      evgdriver->UseSplines(); // will also check if all splines needed are loaded
 
@@ -460,7 +534,7 @@ void GenerateEvent(string mesg)
   if      (proc_info.IsQuasiElastic())      int_type = 1;
   else if (proc_info.IsResonant())          int_type = 2;
   else if (proc_info.IsDeepInelastic())     int_type = 3;
-  else if (proc_info.IsCoherent())          int_type = 4;
+  else if (proc_info.IsCoherentProduction()) int_type = 4;
   else if (proc_info.IsInverseMuDecay())    int_type = 5;
   else if (proc_info.IsNuElectronElastic()) int_type = 6;
 
@@ -558,6 +632,102 @@ void GenerateEvent(string mesg)
   LOG("gevserv", pINFO) << "...done!";
 }
 //____________________________________________________________________________
+void GenerateBatch(string mesg)
+{
+// Generate a batch of events for the given initial state and stream them
+// back as compact GHEP records (NtpMCCompactEventRecord), one ROOT message
+// per event.
+// Syntax:
+//   mesg recv:
+//      EVTBATCH: ievt0 nevents ipdgnu ipdgtgt px_nu py_nu pz_nu
+//   mesg sent:
+//      EVTBATCH: nevents
+//      <nevents kMESS_OBJECT messages, events numbered ievt0, ievt0+1, ...>
+//      BATCH GENERATED
+//
+  LOG("gevserv", pNOTICE) << "Generating event batch - Input info : " << mesg;
+
+  if(!gConfigured) {
+      LOG("gevserv", pERROR) 
+             << "Event server is not configured - Can not generate events";
+      gSock->Send(kErrNoConf.c_str());
+      gSock->Send(kErr.c_str());
+      return;
+  }
+
+  // Extract info from the input mesg
+
+  mesg = str::FilterString(kBatchCmdRecv, mesg); 
+  mesg = str::FilterString(":", mesg); 
+  mesg = str::TrimSpaces(mesg);             
+
+  vector<string> sv = str::Split(mesg," "); 
+
+  assert(sv.size()==7);
+  int    ievt0   = atoi(sv[0].c_str());  // first event number
+  int    nev     = atoi(sv[1].c_str());  // number of events
+  int    ipdgnu  = atoi(sv[2].c_str());  // neutrino code
+  int    ipdgtgt = atoi(sv[3].c_str());  // target code
+  double px      = atof(sv[4].c_str());  // neutrino px
+  double py      = atof(sv[5].c_str());  // neutrino py
+  double pz      = atof(sv[6].c_str());  // neutrino pz
+  double E       = TMath::Sqrt(px*px + py*py + pz*pz);
+
+  TLorentzVector p4(px,py,pz,E); 
+
+  // Find the appropriate event generation driver for the given initial state
+
+  InitialState init_state(ipdgtgt, ipdgnu);
+  GEVGDriver * evg_driver = gGPool.FindDriver(init_state);
+  if(!evg_driver) {
+     LOG("gevserv", pERROR)
+       << "No GEVGDriver object for init state: " << init_state.AsString();
+     gSock->Send(kErrNoDriver.c_str());
+     gSock->Send(kErr.c_str());
+     return;
+  }
+
+  ostringstream batch_hdr;
+  batch_hdr << kBatchHdrCmdSent << ": " << nev;
+  gSock->Send(batch_hdr.str().c_str());
+
+  // The record (and its particle array) is re-used across the batch
+  NtpMCCompactEventRecord rec;
+  int compression = RunOpt::Instance()->OutputCompression();
+
+  for(int iev = 0; iev < nev; iev++) {
+
+    // Generate the requested event, trying again if it is unphysical
+    EventRecord * event = 0;
+    for(int itry = 0; itry < kBatchMaxTries; itry++) {
+      event = evg_driver->GenerateEvent(p4);
+      if(event && !event->IsUnphysical()) break;
+      delete event;
+      event = 0;
+    }
+    if(!event) {
+      LOG("gevserv", pWARN) 
+          << "Failed to generate event " << ievt0 + iev << " of the batch";
+      gSock->Send(kErrNoEvent.c_str());
+      gSock->Send(kErr.c_str());
+      return;
+    }
+    LOG("gevserv", pINFO) << "Generated event: " << *event;
+
+    rec.Fill(ievt0 + iev, event);
+    delete event;
+
+    TMessage mobj(kMESS_OBJECT);
+    if(compression >= 0) mobj.SetCompressionSettings(compression);
+    mobj.WriteObject(&rec);
+    gSock->Send(mobj);
+  }
+
+  gSock->Send(kBatchOkMesgSent.c_str());
+
+  LOG("gevserv", pINFO) << "...done!";
+}
+//____________________________________________________________________________
 void Shutdown(void)
 {
   LOG("gevserv", pNOTICE) << "Shutting GENIE event server down ...";
@@ -571,6 +741,16 @@ void Shutdown(void)
 //____________________________________________________________________________
 void RunInitChecks(void)
 {
+  if(!gOptInpXSecFile.empty()) {
+    bool is_accessible = ! (gSystem->AccessPathName( gOptInpXSecFile.c_str() ));
+    if (!is_accessible) {
+       LOG("gevserv", pWARN) 
+          << "*** The file (" << gOptInpXSecFile 
+          << ") specified with --cross-sections doesn't seem to be available!";
+       LOG("gevserv", pWARN) 
+          << "*** Expect a significant start-up overhead!";
+    }     
+  } else
   if(gSystem->Getenv("GSPLOAD")) {
     string splines_filename = gSystem->Getenv("GSPLOAD");
     bool is_accessible = ! (gSystem->AccessPathName( splines_filename.c_str() ));
@@ -587,10 +767,32 @@ void RunInitChecks(void)
   }
 }
 //____________________________________________________________________________
+void Initialize(void)
+{
+// Everything that only needs to be done once for the lifetime of the server
+
+  if ( ! RunOpt::Instance()->Tune() ) {
+    LOG("gevserv", pFATAL) << " No TuneId in RunOption";
+    exit(-1);
+  }
+  RunOpt::Instance()->BuildTune();
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+  utils::app_init::RandGen(gOptRanSeed);
+  if(!gOptInpXSecFile.empty()) {
+    utils::app_init::XSecTable(gOptInpXSecFile, false);
+  }
+
+  GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
+}
+//____________________________________________________________________________
 void GetCommandLineArgs(int argc, char ** argv)
 {
   LOG("gevserv", pNOTICE) << "Parsing command line arguments";
 
+  // Common run options
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
   CmdLnArgParser parser(argc,argv);
 
   // port number:
@@ -602,13 +804,36 @@ void GetCommandLineArgs(int argc, char ** argv)
 	<< "Unspecified port number - Using default (" << kDefPortNum << ")";
     gOptPortNum = kDefPortNum;
   }
+
+  // random number seed
+  if( parser.OptionExists("seed") ) {
+    LOG("gevserv", pINFO) << "Reading random number seed";
+    gOptRanSeed = parser.ArgAsLong("seed");
+  } else {
+    LOG("gevserv", pINFO) << "Unspecified random number seed - Using default";
+    gOptRanSeed = -1;
+  }
+
+  // cross section splines, loaded at start-up
+  if( parser.OptionExists("cross-sections") ) {
+    LOG("gevserv", pINFO) << "Reading cross-section file";
+    gOptInpXSecFile = parser.ArgAsString("cross-sections");
+  } else 
+  if( gSystem->Getenv("GSPLOAD") ) {
+    gOptInpXSecFile = gSystem->Getenv("GSPLOAD");
+  } else {
+    gOptInpXSecFile = "";
+  }
 }
 //____________________________________________________________________________
 void PrintSyntax(void)
 {
   LOG("gevserv", pNOTICE)
     << "\n\n" << "Syntax:" << "\n"
-    << "   gevserv [-p port] \n";
+    << "   gevserv [-p port] [--seed random_number_seed] \n"
+    << "           [--cross-sections xml_file] [--tune genie_tune] \n"
+    << "           [--output-compression alg[:level]] \n"
+    << "           [--message-thresholds xml_file] \n";
 }
 //____________________________________________________________________________
 
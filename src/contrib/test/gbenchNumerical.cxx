@@ -0,0 +1,534 @@
+//____________________________________________________________________________
+/*!
+
+\program gbenchNumerical
+
+\brief   Micro-benchmarks of the numerical kernels of GENIE (Framework/Numerical
+         and the hot functions of KineUtils & MathUtils), in ns per operation,
+         on fixed inputs. They give a common baseline against which proposed
+         optimisations of the kernels can be judged, on the hardware of each
+         user.
+
+         Each benchmark runs its kernel over a fixed set of pre-computed
+         inputs (so that the input generation is not timed). The number of
+         operations is calibrated so that each repetition lasts at least the
+         requested time, and the median (and min) time per operation over the
+         repetitions is reported, with a checksum of the results (which must
+         not change when a kernel is optimised, unless its results are meant
+         to change).
+
+         Build it with `make bench` in $GENIE/src/contrib/test.
+
+\syntax  gbenchNumerical [-f filter] [-t min_time] [-r nrep] [-o output_file]
+
+         []  denotes an optional argument
+         -f  runs only the benchmarks whose name contains the input string
+         -t  minimum time of each repetition, in seconds (default: 0.2)
+         -r  number of repetitions (default: 5)
+         -o  also writes the results (name, ns/op, checksum) to a text file,
+             eg. to be compared with the results of an other build
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+
+*/
+//____________________________________________________________________________
+
+#include <string>
+#include <vector>
+#include <complex>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <functional>
+#include <chrono>
+
+#include <TMath.h>
+#include <TRandom3.h>
+#include <Math/IFunction.h>
+#include <Math/Integrator.h>
+#include <Math/IntegratorMultiDim.h>
+
+#include "Framework/Conventions/Constants.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/Spline.h"
+#include "Framework/Numerical/BLI2D.h"
+#include "Framework/Numerical/Interpolator2D.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/IntegrationTools.h"
+#include "Framework/Numerical/GSLUtils.h"
+#include "Framework/Numerical/MathUtils.h"
+#include "Framework/Utils/KineUtils.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+
+using std::string;
+using std::vector;
+using std::complex;
+using std::ofstream;
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+using namespace genie;
+using namespace genie::constants;
+
+// a benchmark kernel: runs n operations and returns a checksum of the results
+typedef std::function<double (Long64_t)> Kernel_t;
+
+struct BenchResult {
+  string   name;
+  Long64_t nops;     // operations per repetition
+  double   median;   // ns/op
+  double   min;      // ns/op
+  double   checksum; // of the results of one repetition
+};
+
+void        GetCommandLineArgs (int argc, char ** argv);
+void        PrintSyntax        (void);
+void        AddBenchmarks      (void);
+void        Add                (string name, Kernel_t kernel);
+BenchResult Run                (string name, Kernel_t kernel);
+double      Now                (void);
+
+// command-line options
+string gOptFilter  = "";
+double gOptMinTime = 0.2;
+int    gOptNRep    = 5;
+string gOptOutFile = "";
+
+// the benchmarks
+vector<string>   gNames;
+vector<Kernel_t> gKernels;
+
+// fixed inputs
+const int kNInputs = 4096; // power of 2
+vector<double> gX;  // uniform in [0,1)
+vector<double> gY;  // uniform in [0,1)
+
+// the objects benchmarked
+Spline *           gSpline   = 0;
+Spline *           gSplineF  = 0; // single precision (Spline::Compact())
+BLI2DUnifGrid *    gBLIUnif  = 0;
+BLI2DNonUnifGrid * gBLINonUn = 0;
+Interpolator2D *   gInterp2D = 0;
+
+// integrands for the GSL integrators
+class BenchFunc1D : public ROOT::Math::IBaseFunctionOneDim {
+public:
+  ROOT::Math::IBaseFunctionOneDim * Clone (void) const { return new BenchFunc1D; }
+private:
+  double DoEval (double x) const { return x * TMath::Exp(-x) / (1. + x*x); }
+};
+class BenchFunc2D : public ROOT::Math::IBaseFunctionMultiDim {
+public:
+  unsigned int NDim (void) const { return 2; }
+  ROOT::Math::IBaseFunctionMultiDim * Clone (void) const { return new BenchFunc2D; }
+private:
+  double DoEval (const double * x) const {
+    return TMath::Exp(-x[0]*x[1]) * (1. + x[0]) / (1. + x[1]*x[1]);
+  }
+};
+
+// the functions tabulated for the interpolators
+double Func1D (double x)           { return 1.e-38 * x * TMath::Exp(-0.3*x) + 1.e-40; }
+double Func2D (double x, double y) { return TMath::Sin(x) * TMath::Cos(0.5*y) + x*y; }
+
+//__________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc, argv);
+
+  // the benchmark printout must not be drowned by the library messages
+  Messenger * msg = Messenger::Instance();
+  msg->SetPriorityLevel("Spline",           pERROR);
+  msg->SetPriorityLevel("BLI2DUnifGrid",    pERROR);
+  msg->SetPriorityLevel("BLI2DNonUnifGrid", pERROR);
+  msg->SetPriorityLevel("Rndm",             pERROR);
+
+  // fixed inputs
+  TRandom3 rnd(12345);
+  gX.resize(kNInputs);
+  gY.resize(kNInputs);
+  for(int i = 0; i < kNInputs; i++) {
+    gX[i] = rnd.Rndm();
+    gY[i] = rnd.Rndm();
+  }
+
+  AddBenchmarks();
+
+  cout << endl << " " << std::left << setw(44) << "benchmark" << std::right
+       << setw(14) << "ops/rep"
+       << setw(14) << "ns/op"
+       << setw(14) << "min ns/op"
+       << setw(20) << "checksum" << endl;
+
+  vector<BenchResult> results;
+  for(unsigned int i = 0; i < gNames.size(); i++) {
+    if(gOptFilter.size() > 0 &&
+       gNames[i].find(gOptFilter) == string::npos) continue;
+    BenchResult r = Run(gNames[i], gKernels[i]);
+    results.push_back(r);
+    cout << " " << std::left << setw(44) << r.name << std::right
+         << setw(14) << r.nops
+         << std::fixed << setprecision(2)
+         << setw(14) << r.median
+         << setw(14) << r.min
+         << std::scientific << setprecision(10)
+         << setw(20) << r.checksum << endl;
+    cout.unsetf(std::ios::floatfield);
+  }
+
+  if(gOptOutFile.size() > 0) {
+    ofstream out(gOptOutFile.c_str());
+    out << "# benchmark\tns/op\tmin ns/op\tchecksum (tab-separated)" << endl;
+    for(unsigned int i = 0; i < results.size(); i++) {
+      out << results[i].name << "\t" << setprecision(6) << results[i].median
+          << "\t" << results[i].min
+          << "\t" << setprecision(12) << results[i].checksum << endl;
+    }
+    out.close();
+    LOG("gbench", pNOTICE) << "Saved the results to: " << gOptOutFile;
+  }
+
+  delete gSpline;
+  delete gSplineF;
+  delete gBLIUnif;
+  delete gBLINonUn;
+  delete gInterp2D;
+
+  return 0;
+}
+//__________________________________________________________________________
+void AddBenchmarks(void)
+{
+  const unsigned int mask = kNInputs - 1;
+
+  //
+  // Spline::Evaluate (a cross section like spline of 500 knots in E)
+  //
+  const int    nknots = 500;
+  const double Emin   = 0.01;
+  const double Emax   = 100.;
+  vector<double> E(nknots), xsec(nknots);
+  for(int i = 0; i < nknots; i++) {
+    E[i]    = Emin * TMath::Power(Emax/Emin, (double) i/(nknots-1));
+    xsec[i] = Func1D(E[i]);
+  }
+  gSpline  = new Spline(nknots, &E[0], &xsec[0]);
+  gSplineF = new Spline(nknots, &E[0], &xsec[0]);
+  gSplineF->Compact(true);
+
+  static vector<double> Ex(kNInputs), Ey(kNInputs);
+  for(int i = 0; i < kNInputs; i++) Ex[i] = Emin + (Emax-Emin) * gX[i];
+
+  Add("Spline::Evaluate", [mask](Long64_t n) {
+    double s = 0;
+    for(Long64_t i = 0; i < n; i++) s += gSpline->Evaluate(Ex[i & mask]);
+    return s;
+  });
+  Add("Spline::Evaluate (single precision)", [mask](Long64_t n) {
+    double s = 0;
+    for(Long64_t i = 0; i < n; i++) s += gSplineF->Evaluate(Ex[i & mask]);
+    return s;
+  });
+  Add("Spline::Evaluate (sorted x)", [mask](Long64_t n) {
+    static vector<double> xs;
+    if(xs.empty()) { xs = Ex; std::sort(xs.begin(), xs.end()); }
+    double s = 0;
+    for(Long64_t i = 0; i < n; i++) s += gSpline->Evaluate(xs[i & mask]);
+    return s;
+  });
+  Add("Spline::Evaluate (array)", [](Long64_t n) {
+    double s = 0;
+    Long64_t done = 0;
+    while(done < n) {
+      unsigned int m = (unsigned int) TMath::Min((Long64_t) kNInputs, n - done);
+      gSpline->Evaluate(&Ex[0], &Ey[0], m);
+      s += Ey[m-1];
+      done += m;
+    }
+    return s;
+  });
+
+  //
+  // BLI2DUnifGrid / BLI2DNonUnifGrid::Evaluate and Interpolator2D::Eval
+  // (a 100 x 100 grid in [0,10] x [0,10])
+  //
+  const int    ng   = 100;
+  const double gmax = 10.;
+  vector<double> gx(ng), gy(ng), gz(ng*ng), gzt(ng*ng);
+  for(int i = 0; i < ng; i++) {
+    gx[i] = gmax * i / (ng-1);
+    gy[i] = gmax * TMath::Power((double) i/(ng-1), 2); // non-uniform in y
+  }
+  gBLIUnif  = new BLI2DUnifGrid    (ng, 0., gmax, ng, 0., gmax);
+  gBLINonUn = new BLI2DNonUnifGrid (ng, 0., gmax, ng, 0., gmax);
+  for(int ix = 0; ix < ng; ix++) {
+    for(int iy = 0; iy < ng; iy++) {
+      double yu = gmax * iy / (ng-1);
+      gBLIUnif ->AddPoint(gx[ix], yu,     Func2D(gx[ix], yu));
+      gBLINonUn->AddPoint(gx[ix], gy[iy], Func2D(gx[ix], gy[iy]));
+      gzt[ix + iy*ng] = Func2D(gx[ix], gy[iy]); // gsl layout: z[ix + iy*nx]
+    }
+  }
+  gInterp2D = new Interpolator2D(ng, &gx[0], ng, &gy[0], &gzt[0]);
+
+  static vector<double> bx(kNInputs), by(kNInputs), bz(kNInputs);
+  for(int i = 0; i < kNInputs; i++) {
+    bx[i] = gmax * gX[i];
+    by[i] = gmax * gY[i];
+  }
+
+  Add("BLI2DUnifGrid::Evaluate", [mask](Long64_t n) {
+    double s = 0;
+    for(Long64_t i = 0; i < n; i++)
+      s += gBLIUnif->Evaluate(bx[i & mask], by[i & mask]);
+    return s;
+  });
+  Add("BLI2DNonUnifGrid::Evaluate", [mask](Long64_t n) {
+    double s = 0;
+    for(Long64_t i = 0; i < n; i++)
+      s += gBLINonUn->Evaluate(bx[i & mask], by[i & mask]);
+    return s;
+  });
+  Add("BLI2DNonUnifGrid::Evaluate (array)", [](Long64_t n) {
+    double s = 0;
+    Long64_t done = 0;
+    while(done < n) {
+      int m = (int) TMath::Min((Long64_t) kNInputs, n - done);
+      gBLINonUn->Evaluate(&bx[0], &by[0], &bz[0], m);
+      s += bz[m-1];
+      done += m;
+    }
+    return s;
+  });
+  Add("Interpolator2D::Eval", [mask](Long64_t n) {
+    double s = 0;
+    for(Long64_t i = 0; i < n; i++)
+      s += gInterp2D->Eval(bx[i & mask], by[i & mask]);
+    return s;
+  });
+
+  //
+  // RandomGen throughput (the engine is re-seeded for the checksum)
+  //
+  Add("RandomGen::RndKine().Rndm", [](Long64_t n) {
+    TRandom & r = RandomGen::Instance()->RndKine();
+    r.SetSeed(4357);
+    double s = 0;
+    for(Long64_t i = 0; i < n; i++) s += r.Rndm();
+    return s;
+  });
+  Add("RandomGen::RndKine().Gaus", [](Long64_t n) {
+    TRandom & r = RandomGen::Instance()->RndKine();
+    r.SetSeed(4357);
+    double s = 0;
+    for(Long64_t i = 0; i < n; i++) s += r.Gaus();
+    return s;
+  });
+  Add("RandomGen::RndKine().RndmArray (x4096)", [](Long64_t n) {
+    TRandom & r = RandomGen::Instance()->RndKine();
+    r.SetSeed(4357);
+    static vector<double> buf(kNInputs);
+    double s = 0;
+    Long64_t done = 0;
+    while(done < n) {
+      int m = (int) TMath::Min((Long64_t) kNInputs, n - done);
+      r.RndmArray(m, &buf[0]);
+      s += buf[m-1];
+      done += m;
+    }
+    return s;
+  });
+
+  //
+  // IntegrationTools: Gauss-Legendre points (SG20R) & 2D integration (RG202D)
+  //
+  Add("integrationtools::SG20R (n=10)", [](Long64_t n) {
+    static double x[20*10], w[20*10];
+    unsigned int np = 0;
+    double s = 0;
+    for(Long64_t i = 0; i < n; i++) {
+      alvarezruso::integrationtools::SG20R(0., 1. + 1.e-6*(i & 15), 10, 20, x, np, w);
+      s += x[np-1];
+    }
+    return s;
+  });
+  Add("integrationtools::RG202D", [](Long64_t n) {
+    static vector< vector< complex<double> > > cf(4, vector< complex<double> >(40));
+    static vector< complex<double> > cres(4);
+    static bool init = false;
+    if(!init) {
+      for(int l = 0; l < 4; l++)
+        for(int j = 0; j < 40; j++)
+          cf[l][j] = complex<double>(gX[l*40+j], gY[l*40+j]);
+      init = true;
+    }
+    double s = 0;
+    for(Long64_t i = 0; i < n; i++) {
+      alvarezruso::integrationtools::RG202D(0., 1., 2, 0, 3, cf, 20, cres);
+      s += cres[0].real() + cres[3].imag();
+    }
+    return s;
+  });
+
+  //
+  // The GSL integrator types (as set by GSLOneDimIntgType/GSLIntgType)
+  //
+  const char * types1d[] = { "gauss", "adaptive", "adaptive_singular", "non_adaptive" };
+  for(int it = 0; it < 4; it++) {
+    string type = types1d[it];
+    Add("GSL 1D integration: " + type, [type](Long64_t n) {
+      BenchFunc1D func;
+      ROOT::Math::Integrator ig(func,
+         utils::gsl::Integration1DimTypeFromString(type), 1.e-12, 1.e-6, 1000);
+      double s = 0;
+      for(Long64_t i = 0; i < n; i++) s += ig.Integral(0., 5. + 1.e-3*(i & 15));
+      return s;
+    });
+  }
+  const char * types2d[] = { "adaptive", "plain", "miser", "vegas" };
+  for(int it = 0; it < 4; it++) {
+    string type = types2d[it];
+    Add("GSL 2D integration: " + type, [type](Long64_t n) {
+      BenchFunc2D func;
+      ROOT::Math::IntegratorMultiDim ig(func,
+         utils::gsl::IntegrationNDimTypeFromString(type), 1.e-12, 1.e-3, 10000);
+      double a[2] = { 0., 0. };
+      double b[2] = { 2., 3. };
+      double s = 0;
+      for(Long64_t i = 0; i < n; i++) s += ig.Integral(a, b);
+      return s;
+    });
+  }
+
+  //
+  // KineUtils & MathUtils hot functions
+  //
+  const double M  = kNucleonMass;
+  const double ml = kMuonMass;
+  Add("kinematics::InelWLim", [mask,M,ml](Long64_t n) {
+    double s = 0;
+    for(Long64_t i = 0; i < n; i++) {
+      Range1D_t r = utils::kinematics::InelWLim(0.5 + 10.*gX[i & mask], M, ml);
+      s += r.max;
+    }
+    return s;
+  });
+  Add("kinematics::InelQ2Lim_W", [mask,M,ml](Long64_t n) {
+    double s = 0;
+    for(Long64_t i = 0; i < n; i++) {
+      double Ev = 0.5 + 10.*gX[i & mask];
+      double W  = 1.08 + (Ev - 0.1) * gY[i & mask];
+      Range1D_t r = utils::kinematics::InelQ2Lim_W(Ev, M, ml, W);
+      s += r.max;
+    }
+    return s;
+  });
+  Add("kinematics::XYtoWQ2", [mask,M](Long64_t n) {
+    double s = 0, W = 0, Q2 = 0;
+    for(Long64_t i = 0; i < n; i++) {
+      utils::kinematics::XYtoWQ2(5., M, W, Q2, gX[i & mask], gY[i & mask]);
+      s += W + Q2;
+    }
+    return s;
+  });
+  Add("kinematics::WQ2toXY", [mask,M](Long64_t n) {
+    double s = 0, x = 0, y = 0;
+    for(Long64_t i = 0; i < n; i++) {
+      utils::kinematics::WQ2toXY(5., M, 1. + 2.*gX[i & mask], 3.*gY[i & mask], x, y);
+      s += x + y;
+    }
+    return s;
+  });
+  Add("math::KahanSummation (x4096)", [](Long64_t n) {
+    double s = 0;
+    for(Long64_t done = 0; done < n; done += kNInputs) {
+      s += utils::math::KahanSummation(gX);
+    }
+    return s;
+  });
+  Add("math::HashCombine", [](Long64_t n) {
+    ULong64_t h = 0;
+    for(Long64_t i = 0; i < n; i++) h = utils::math::HashCombine(h, i);
+    return (double) (h >> 11);
+  });
+}
+//__________________________________________________________________________
+void Add(string name, Kernel_t kernel)
+{
+  gNames.push_back(name);
+  gKernels.push_back(kernel);
+}
+//__________________________________________________________________________
+BenchResult Run(string name, Kernel_t kernel)
+{
+  BenchResult r;
+  r.name = name;
+
+  // calibrate the number of operations per repetition
+  Long64_t n = 1;
+  while(true) {
+    double t0 = Now();
+    kernel(n);
+    double t = Now() - t0;
+    if(t >= 0.1 * gOptMinTime || n >= (1LL << 40)) {
+      double nt = (t > 0.) ? n * gOptMinTime / t : 10. * n;
+      n = TMath::Max((Long64_t) 1, (Long64_t) nt);
+      break;
+    }
+    n *= 10;
+  }
+  r.nops = n;
+
+  // time the repetitions
+  vector<double> nsop;
+  for(int irep = 0; irep < gOptNRep; irep++) {
+    double t0 = Now();
+    r.checksum = kernel(n);
+    double t = Now() - t0;
+    nsop.push_back(1.e+9 * t / n);
+  }
+  std::sort(nsop.begin(), nsop.end());
+  r.median = nsop[nsop.size()/2];
+  r.min    = nsop[0];
+  return r;
+}
+//__________________________________________________________________________
+double Now(void)
+{
+  return std::chrono::duration<double>(
+           std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+//__________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  CmdLnArgParser parser(argc,argv);
+
+  if( parser.OptionExists('h') ) {
+    PrintSyntax();
+    exit(0);
+  }
+  if( parser.OptionExists('f') ) gOptFilter  = parser.ArgAsString('f');
+  if( parser.OptionExists('t') ) gOptMinTime = parser.ArgAsDouble('t');
+  if( parser.OptionExists('r') ) gOptNRep    = parser.ArgAsInt('r');
+  if( parser.OptionExists('o') ) gOptOutFile = parser.ArgAsString('o');
+
+  gOptMinTime = TMath::Max(1.e-3, gOptMinTime);
+  gOptNRep    = TMath::Max(1, gOptNRep);
+}
+//__________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gbench", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gbenchNumerical [-f filter] [-t min_time] [-r nrep] [-o output_file]\n";
+}
+//__________________________________________________________________________
@@ -0,0 +1,91 @@
+//____________________________________________________________________________
+/*!
+
+\program gperfChecksum
+
+\brief   Computes a checksum of the physics content of GENIE event files, for
+         the performance regression harness (gperf_regression.pl): the PDG
+         code, status and 4-momentum (rounded to 10 keV, so that last-bit
+         differences of the math libraries do not show) of all particles of
+         all events, in order. Two samples generated with the same build
+         inputs, seeds and physics have the same checksum.
+
+\syntax  gperfChecksum -f event_files
+
+         -f  input GHEP event file(s) (wildcards accepted)
+
+         Prints: `checksum: <hex> events: <n> particles: <n>'
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2020, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+
+*/
+//____________________________________________________________________________
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpReader.h"
+#include "Framework/Numerical/MathUtils.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+
+using std::string;
+
+using namespace genie;
+
+// momenta are rounded to this precision (GeV)
+const double kPrecision = 1.e-5;
+
+Long64_t Round(double x) { return (Long64_t) std::llround(x / kPrecision); }
+
+//__________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  CmdLnArgParser parser(argc,argv);
+  if( ! parser.OptionExists('f') ) {
+    LOG("gperf", pFATAL) << "Syntax: gperfChecksum -f event_files";
+    exit(1);
+  }
+  string files = parser.ArgAsString('f');
+
+  NtpReader reader;
+  if(reader.AddFiles(files) == 0 || !reader.Initialize()) {
+    LOG("gperf", pFATAL) << "Couldn't read events from: " << files;
+    exit(1);
+  }
+
+  ULong64_t checksum   = 0;
+  Long64_t  nparticles = 0;
+  for(Long64_t iev = 0; iev < reader.NEvents(); iev++) {
+    const EventRecord * event = reader.Event(iev);
+    if(!event) continue;
+    int np = event->GetEntries();
+    checksum = utils::math::HashCombine(checksum, np);
+    for(int ip = 0; ip < np; ip++) {
+      const GHepParticle * p = event->Particle(ip);
+      checksum = utils::math::HashCombine(checksum, p->Pdg());
+      checksum = utils::math::HashCombine(checksum, (Long64_t) p->Status());
+      checksum = utils::math::HashCombine(checksum, Round(p->Px()));
+      checksum = utils::math::HashCombine(checksum, Round(p->Py()));
+      checksum = utils::math::HashCombine(checksum, Round(p->Pz()));
+      checksum = utils::math::HashCombine(checksum, Round(p->E()));
+    }
+    nparticles += np;
+  }
+
+  printf("checksum: %016llx events: %lld particles: %lld\n",
+     (unsigned long long) checksum, (long long) reader.NEvents(),
+     (long long) nparticles);
+
+  return 0;
+}
+//__________________________________________________________________________
@@ -0,0 +1,244 @@
+#!/usr/bin/perl
+
+#---------------------------------------------------------------------------------------------------------------------
+# End-to-end performance regression harness.
+#
+# Runs a fixed set of reference event generation jobs with pinned seeds and records, for each job:
+#  - the event generation throughput (events/s, excl. the job start-up),
+#  - the peak resident memory (MB),
+#  - the start-up time (s, until the first event: configuration, splines, ... see StartupProfile),
+#  - a checksum of the physics content of the output events (see gperfChecksum).
+# Then compares them with those of a baseline (saved by an earlier run of this script, with the same
+# machine, inputs and options) within tolerances. Exits with a non-zero status if any job regressed.
+# A changed checksum means that the generated events changed: expected for physics changes (then save
+# a new baseline), a bug for pure performance changes.
+#
+# Syntax:
+#   shell% perl gperf_regression.pl <options>
+#
+# Options:
+#    --cross-sections      : Cross section spline file (for the neutrino jobs)
+#   [--tune]               : GENIE tune, default: $GENIE_TUNE if set, or the default tune of the apps
+#   [--jobs]               : Comma separated list of jobs to run (see below), default: all
+#   [--nev-scale]          : Scale factor for the number of events of each job, default: 1
+#   [--baseline]           : Baseline file to compare with
+#   [--save-baseline]      : File to save the results in, as a baseline for later runs
+#   [--tol-rate]           : Tolerated fractional drop of events/s, default: 0.15
+#   [--tol-rss]            : Tolerated fractional increase of the peak RSS, default: 0.15
+#   [--tol-startup]        : Tolerated fractional increase of the start-up time, default: 0.25
+#   [--work-dir]           : Directory for the job outputs and logs, default: ./gperf
+#   [--bin-dir]            : Directory of the GENIE executables, default: $GENIE/bin
+#
+# JOBS:
+#.......................................................................................................
+#  job          | app           | nev  | init state / flux                                        | seed
+#.......................................................................................................
+#  numuAr40_1   | gevgen        | 5k   | numu CC on Ar40, 1 GeV                                   | 1081
+#  numuAr40_3   | gevgen        | 5k   | numu CC on Ar40, 3 GeV                                   | 1082
+#  numuAr40_10  | gevgen        | 5k   | numu CC on Ar40, 10 GeV                                  | 1083
+#  atmoH2O      | gevgen        | 5k   | numu, E^-2.7 (atmospheric-like) flux, 0.5-20 GeV, water | 1084
+#  numiCH       | gevgen        | 5k   | numu, NuMI-like LE flux, 0.5-20 GeV, CH target mix       | 1085
+#  hAFe56       | gevgen_hadron | 20k  | pi+ on Fe56, 165 MeV kinetic energy (INTRANUKE hA)       | 1086
+#.......................................................................................................
+# The fluxes are functional forms, and the 'geometries' target mixes, so that the jobs need no flux or
+# geometry input files (the geometry navigation has its own benchmark: ggeombench).
+#
+# Examples:
+#   shell% perl gperf_regression.pl --cross-sections gxspl-vA.xml --save-baseline baseline.txt
+#   shell% perl gperf_regression.pl --cross-sections gxspl-vA.xml --baseline baseline.txt
+#   shell% perl gperf_regression.pl --cross-sections gxspl-vA.xml --baseline baseline.txt --jobs numiCH
+#
+# Needs the gperfChecksum program (make bench in $GENIE/src/contrib/test) and GNU time (/usr/bin/time)
+# for the peak RSS.
+#
+# Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+# University of Liverpool & STFC Rutherford Appleton Laboratory
+#---------------------------------------------------------------------------------------------------------------------
+#
+
+use File::Path;
+use Cwd 'abs_path';
+use Time::HiRes qw(time);
+
+# inputs
+#
+$iarg=0;
+foreach (@ARGV) {
+  if($_ eq '--cross-sections') { $xsec_file     = $ARGV[$iarg+1]; }
+  if($_ eq '--tune')           { $tune          = $ARGV[$iarg+1]; }
+  if($_ eq '--jobs')           { $jobs          = $ARGV[$iarg+1]; }
+  if($_ eq '--nev-scale')      { $nev_scale     = $ARGV[$iarg+1]; }
+  if($_ eq '--baseline')       { $baseline      = $ARGV[$iarg+1]; }
+  if($_ eq '--save-baseline')  { $save_baseline = $ARGV[$iarg+1]; }
+  if($_ eq '--tol-rate')       { $tol_rate      = $ARGV[$iarg+1]; }
+  if($_ eq '--tol-rss')        { $tol_rss       = $ARGV[$iarg+1]; }
+  if($_ eq '--tol-startup')    { $tol_startup   = $ARGV[$iarg+1]; }
+  if($_ eq '--work-dir')       { $work_dir      = $ARGV[$iarg+1]; }
+  if($_ eq '--bin-dir')        { $bin_dir       = $ARGV[$iarg+1]; }
+  $iarg++;
+}
+
+$tune          = $ENV{'GENIE_TUNE'}    unless defined $tune;
+$jobs          = "all"                 unless defined $jobs;
+$nev_scale     = 1                     unless defined $nev_scale;
+$tol_rate      = 0.15                  unless defined $tol_rate;
+$tol_rss       = 0.15                  unless defined $tol_rss;
+$tol_startup   = 0.25                  unless defined $tol_startup;
+$work_dir      = "./gperf"             unless defined $work_dir;
+$bin_dir       = "$ENV{'GENIE'}/bin"   unless defined $bin_dir;
+
+# the reference jobs: app, number of events, seed, arguments
+#
+@job_names = ('numuAr40_1', 'numuAr40_3', 'numuAr40_10', 'atmoH2O', 'numiCH', 'hAFe56');
+
+%app_hash = (
+  'numuAr40_1'  => 'gevgen',
+  'numuAr40_3'  => 'gevgen',
+  'numuAr40_10' => 'gevgen',
+  'atmoH2O'     => 'gevgen',
+  'numiCH'      => 'gevgen',
+  'hAFe56'      => 'gevgen_hadron'
+);
+%nev_hash = (
+  'numuAr40_1'  =>  5000,
+  'numuAr40_3'  =>  5000,
+  'numuAr40_10' =>  5000,
+  'atmoH2O'     =>  5000,
+  'numiCH'      =>  5000,
+  'hAFe56'      => 20000
+);
+%seed_hash = (
+  'numuAr40_1'  => 1081,
+  'numuAr40_3'  => 1082,
+  'numuAr40_10' => 1083,
+  'atmoH2O'     => 1084,
+  'numiCH'      => 1085,
+  'hAFe56'      => 1086
+);
+%args_hash = (
+  'numuAr40_1'  => "-p 14 -t 1000180400 -e 1  --event-generator-list CC",
+  'numuAr40_3'  => "-p 14 -t 1000180400 -e 3  --event-generator-list CC",
+  'numuAr40_10' => "-p 14 -t 1000180400 -e 10 --event-generator-list CC",
+  'atmoH2O'     => "-p 14 -t '1000080160[0.8881],1000010010[0.1119]' -e 0.5,20 -f 'x^(-2.7)'",
+  'numiCH'      => "-p 14 -t '1000060120[0.9226],1000010010[0.0774]' -e 0.5,20 -f 'x*x*exp(-x/1.5)+0.02*exp(-x/8)'",
+  'hAFe56'      => "-p 211 -t 1000260560 -k 0.165 -m hA"
+);
+
+@run_jobs = ($jobs eq "all") ? @job_names : split(',', $jobs);
+foreach $job (@run_jobs) {
+  die("** Aborting [Unknown job: $job]") unless defined $app_hash{$job};
+  die("** Aborting [Undefined cross section file. Use the --cross-sections option]")
+    if ($app_hash{$job} eq 'gevgen' && !defined $xsec_file);
+}
+
+die("** Aborting [Can not find gperfChecksum in $bin_dir: build it with make bench in \$GENIE/src/contrib/test]")
+unless -x "$bin_dir/gperfChecksum";
+
+$have_gnu_time = (-x "/usr/bin/time");
+
+mkpath($work_dir, {verbose => 0, mode=>0777});
+$work_dir  = abs_path($work_dir);
+$xsec_file = abs_path($xsec_file) if defined $xsec_file; # the jobs run in the work dir
+
+# run the jobs
+#
+%results = ();
+foreach $job (@run_jobs) {
+
+  $nev  = int($nev_hash{$job} * $nev_scale);
+  $nev  = 1 unless $nev > 0;
+  $app  = $app_hash{$job};
+  $out  = "$work_dir/$job";
+  $log  = "$work_dir/$job.log";
+  unlink glob("$out*.ghep.root");
+
+  $cmd  = "$bin_dir/$app -n $nev -r 0 --seed $seed_hash{$job} $args_hash{$job}";
+  $cmd .= " --tune $tune" if (defined $tune && $tune ne "");
+  $cmd .= " --cross-sections $xsec_file" if ($app eq 'gevgen');
+  $cmd .= ($app eq 'gevgen') ? " -o $out.ghep.root" : " -o $out";
+  $cmd  = "/usr/bin/time -f 'GPERF_TIME %e %M' $cmd" if $have_gnu_time;
+
+  print "Running $job: $cmd\n";
+  $start = time();
+  system("cd $work_dir; GMCJMONTELEMETRY=0 $cmd > $log 2>&1");
+  $wall  = time() - $start;
+  die("** Aborting [Job $job failed, see $log]") if ($? != 0);
+
+  # peak RSS & start-up time, from the job log
+  $rss     = -1;
+  $startup = 0;
+  open(LOG, "<$log");
+  while(<LOG>) {
+    if(/GPERF_TIME\s+(\S+)\s+(\d+)/)                   { $rss     = $2 / 1024.; }
+    if(/total:\s+(\S+)\s+s since the first phase/)     { $startup = $1;         }
+  }
+  close(LOG);
+
+  # physics checksum
+  $checksum = `$bin_dir/gperfChecksum -f '$out*.ghep.root' 2>/dev/null`;
+  $checksum =~ /checksum:\s+(\S+)\s+events:\s+(\d+)/;
+  $checksum = $1;
+  $nevout   = $2;
+
+  $rate = ($wall > $startup) ? $nevout / ($wall - $startup) : 0;
+
+  $results{$job} = [ $rate, $rss, $startup, $checksum ];
+  printf("  %-12s : %10.2f events/s, %8.1f MB peak RSS, %7.2f s start-up, checksum %s\n",
+         $job, $rate, $rss, $startup, $checksum);
+}
+
+# save the baseline
+#
+if(defined $save_baseline) {
+  open(BASE, ">$save_baseline") or die("** Aborting [Can not write $save_baseline]");
+  print BASE "# job events/s peak_rss_MB startup_s checksum (nev-scale: $nev_scale)\n";
+  foreach $job (@run_jobs) {
+    printf BASE ("%s %.4f %.1f %.3f %s\n", $job, @{$results{$job}});
+  }
+  close(BASE);
+  print "Saved the baseline in $save_baseline\n";
+}
+
+# compare with the baseline
+#
+$nfail = 0;
+if(defined $baseline) {
+  %base = ();
+  open(BASE, "<$baseline") or die("** Aborting [Can not read $baseline]");
+  while(<BASE>) {
+    next if /^#/;
+    @cols = split(' ', $_);
+    next unless @cols == 5;
+    $base{$cols[0]} = [ @cols[1..4] ];
+  }
+  close(BASE);
+
+  print "\nComparison with the baseline $baseline:\n";
+  foreach $job (@run_jobs) {
+    if(!defined $base{$job}) {
+      print "  $job : not in the baseline\n";
+      next;
+    }
+    ($rate,  $rss,  $startup,  $checksum)  = @{$results{$job}};
+    ($rate0, $rss0, $startup0, $checksum0) = @{$base{$job}};
+    @problems = ();
+    push(@problems, sprintf("events/s %.2f -> %.2f", $rate0, $rate))
+       if ($rate < (1 - $tol_rate) * $rate0);
+    push(@problems, sprintf("peak RSS %.1f -> %.1f MB", $rss0, $rss))
+       if ($rss0 > 0 && $rss > (1 + $tol_rss) * $rss0);
+    push(@problems, sprintf("start-up %.2f -> %.2f s", $startup0, $startup))
+       if ($startup > (1 + $tol_startup) * $startup0 && $startup - $startup0 > 0.5);
+    push(@problems, "checksum $checksum0 -> $checksum (the events changed)")
+       if ($checksum ne $checksum0);
+    if(@problems) {
+      $nfail++;
+      print "  $job : FAILED: ", join(", ", @problems), "\n";
+    } else {
+      printf("  %-12s : ok (events/s %+.1f%%, peak RSS %+.1f%%)\n", $job,
+        ($rate0 > 0) ? 100 * ($rate/$rate0 - 1) : 0,
+        ($rss0  > 0) ? 100 * ($rss/$rss0 - 1)   : 0);
+    }
+  }
+}
+
+exit($nfail > 0 ? 1 : 0);
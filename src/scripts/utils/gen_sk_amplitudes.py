@@ -0,0 +1,277 @@
+#!/usr/bin/env python
+"""
+Generate the tables of the single-kaon production matrix elements used by
+AlamSimoAtharVacasSKPXSec2014 (AlamSimoAtharVacasSKAmplitudeTables.cxx).
+
+The matrix elements (Amatrix_NN, Amatrix_NP and Amatrix_PP) of the reference
+implementation, $GENIE/src/contrib/nirkko/singlekaon_xsec.cxx, are expanded
+into polynomials of the kinematic variables, whose coefficients are in turn
+polynomials of the kinematics-independent parameters (masses, couplings).
+Usage:
+
+    ./gen_sk_amplitudes.py                        # default input / output
+    ./gen_sk_amplitudes.py input.cxx output.cxx
+"""
+
+from __future__ import print_function
+import os
+import re
+import sys
+
+
+# kinematic variables (in the order of AlamSimoAtharVacasSKAmplitude::Evaluate)
+kine_vars = ['Enu', 'Elep', 'Ekaon', 'akk1', 'akpk', 'apkk1',
+             'C1', 'C3', 'C6', 'C7', 'C8']
+# kinematics-independent parameters (in the order of SetParameters())
+par_vars  = ['am', 'amk', 'amSig', 'amLam', 'aml',
+             'C2', 'C4', 'C5', 'C9', 'Fm1', 'Fm2', 'f']
+# overall factors, applied by AlamSimoAtharVacasSKPXSec2014
+factors   = ['con', 'gform']
+# switches of the individual terms, all set to 1 in the reference code
+switches  = ['t1', 't2', 't3', 't4', 't5', 't6']
+
+kine_bits = 2   # bits per kinematic exponent
+par_bits  = 3   # bits per parameter exponent
+
+reactions = [('NN', 'nu + n -> l- + n + K+'),
+             ('NP', 'nu + n -> l- + p + K0'),
+             ('PP', 'nu + p -> l- + p + K+')]
+
+
+def matrix_element(source, reaction):
+    """
+    Return the expression of the matrix element of the input reaction.
+    """
+    i = source.index('Amatrix_' + reaction + '(double theta')
+    i = source.index('t1=1.0', i)
+    i = source.index('sol', i)
+    i = source.index('=', i) + 1
+    j = source.index(';', i)
+    return re.sub(r'\s+', '', source[i:j])
+
+
+def tokenize(expr):
+    return re.findall(r'\d+\.\d*(?:[eE][-+]?\d+)?|\d*\.\d+(?:[eE][-+]?\d+)?'
+                      r'|\d+|[A-Za-z_]\w*|[-+*/()]', expr)
+
+
+class Polynomial(object):
+    """
+    Polynomial as a map of (kinematic exponents, parameter exponents) to a
+    numerical coefficient. Overall factors are only checked, not kept.
+    """
+    nk = len(kine_vars)
+    np = len(par_vars)
+    one = ((0,) * nk, (0,) * np)
+
+    def __init__(self, terms=None):
+        self.terms = terms if terms is not None else {}
+
+    @staticmethod
+    def constant(value):
+        return Polynomial({Polynomial.one: value})
+
+    @staticmethod
+    def variable(name):
+        if name in switches:
+            return Polynomial.constant(1.0)
+        if name in factors:
+            factor_count[name] = factor_count.get(name, 0) + 1
+            return Polynomial.constant(1.0)
+        kine = [0] * Polynomial.nk
+        par = [0] * Polynomial.np
+        if name in kine_vars:
+            kine[kine_vars.index(name)] = 1
+        elif name in par_vars:
+            par[par_vars.index(name)] = 1
+        else:
+            raise ValueError('Unknown variable: ' + name)
+        return Polynomial({(tuple(kine), tuple(par)): 1.0})
+
+    def add(self, other, sign):
+        terms = dict(self.terms)
+        for key, value in other.terms.items():
+            terms[key] = terms.get(key, 0.) + sign * value
+        return Polynomial(terms)
+
+    def mul(self, other):
+        terms = {}
+        for (k1, p1), v1 in self.terms.items():
+            for (k2, p2), v2 in other.terms.items():
+                key = (tuple(a + b for a, b in zip(k1, k2)),
+                       tuple(a + b for a, b in zip(p1, p2)))
+                terms[key] = terms.get(key, 0.) + v1 * v2
+        return Polynomial(terms)
+
+    def scale(self, value):
+        return Polynomial(dict((k, v * value) for k, v in self.terms.items()))
+
+
+factor_count = {}
+
+
+class Parser(object):
+    """
+    Recursive descent parser of the (+,-,*,/) expressions of the reference
+    code. Divisions are only by numbers.
+    """
+    def __init__(self, tokens):
+        self.tokens = tokens
+        self.pos = 0
+
+    def peek(self):
+        return self.tokens[self.pos] if self.pos < len(self.tokens) else None
+
+    def next(self):
+        self.pos += 1
+        return self.tokens[self.pos - 1]
+
+    def expression(self):
+        result = self.term()
+        while self.peek() in ('+', '-'):
+            sign = 1.0 if self.next() == '+' else -1.0
+            result = result.add(self.term(), sign)
+        return result
+
+    def term(self):
+        result = self.unary()
+        while self.peek() in ('*', '/'):
+            op = self.next()
+            operand = self.unary()
+            if op == '*':
+                result = result.mul(operand)
+            else:
+                if list(operand.terms.keys()) != [Polynomial.one]:
+                    raise ValueError('Division by a non-constant')
+                result = result.scale(1.0 / operand.terms[Polynomial.one])
+        return result
+
+    def unary(self):
+        if self.peek() == '-':
+            self.next()
+            return self.unary().scale(-1.0)
+        if self.peek() == '+':
+            self.next()
+            return self.unary()
+        return self.atom()
+
+    def atom(self):
+        token = self.next()
+        if token == '(':
+            result = self.expression()
+            if self.next() != ')':
+                raise ValueError('Unbalanced parentheses')
+            return result
+        if re.match(r'[A-Za-z_]', token):
+            return Polynomial.variable(token)
+        return Polynomial.constant(float(token))
+
+
+def pack(exponents, bits):
+    code = 0
+    for i, e in enumerate(exponents):
+        if e >= (1 << bits):
+            raise ValueError('Exponent out of range: %d' % e)
+        code |= e << (bits * i)
+    return code
+
+
+def table(reaction, description, expr):
+    """
+    Expand the input matrix element and return the C++ code of its tables.
+    """
+    factor_count.clear()
+    parser = Parser(tokenize(expr))
+    poly = parser.expression()
+    if parser.pos != len(parser.tokens):
+        raise ValueError('Unparsed tokens in ' + reaction)
+    if factor_count != {'con': 1, 'gform': 1}:
+        raise ValueError('Unexpected overall factors in ' + reaction)
+
+    terms = sorted((k, v) for k, v in poly.terms.items() if v != 0.)
+    monomials = sorted(set(k for (k, p), v in terms))
+    index = dict((m, i) for i, m in enumerate(monomials))
+
+    lines = []
+    lines.append('  // %s: %d kinematic monomials, %d terms'
+                 % (description, len(monomials), len(terms)))
+    lines.append('  const unsigned int kMonomials%s[%d] = {'
+                 % (reaction, len(monomials)))
+    codes = ['0x%06x' % pack(m, kine_bits) for m in monomials]
+    for i in range(0, len(codes), 8):
+        lines.append('    ' + ', '.join(codes[i:i+8]) + ',')
+    lines.append('  };')
+    lines.append('  const genie::SKAmplitudeTerm_t kTerms%s[%d] = {'
+                 % (reaction, len(terms)))
+    entries = ['{%4d, 0x%010xULL, %s}'
+               % (index[k], pack(p, par_bits), repr(v)) for (k, p), v in terms]
+    for i in range(0, len(entries), 2):
+        lines.append('    ' + ', '.join(entries[i:i+2]) + ',')
+    lines.append('  };')
+    lines.append('')
+    return lines
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    src = os.path.normpath(os.path.join(here, '..', '..'))
+    inp = os.path.join(src, 'contrib', 'nirkko', 'singlekaon_xsec.cxx')
+    out = os.path.join(src, 'Physics', 'Strange', 'XSection',
+                       'AlamSimoAtharVacasSKAmplitudeTables.cxx')
+    if len(sys.argv) > 2:
+        inp, out = sys.argv[1], sys.argv[2]
+
+    source = open(inp).read()
+
+    lines = []
+    lines.append('//' + '_' * 76)
+    lines.append('/*')
+    lines.append(' Copyright (c) 2003-2020, The GENIE Collaboration')
+    lines.append(' For the full text of the license visit http://copyright.genie-mc.org')
+    lines.append('')
+    lines.append(' Costas Andreopoulos <constantinos.andreopoulos \\at cern.ch>')
+    lines.append(' University of Liverpool & STFC Rutherford Appleton Laboratory')
+    lines.append('*/')
+    lines.append('//' + '_' * 76)
+    lines.append('//')
+    lines.append('// Tables of the single-kaon production matrix elements.')
+    lines.append('// Generated by $GENIE/src/scripts/utils/gen_sk_amplitudes.py from the')
+    lines.append('// matrix elements of $GENIE/src/contrib/nirkko/singlekaon_xsec.cxx.')
+    lines.append('// DO NOT EDIT.')
+    lines.append('//')
+    lines.append('// Kinematic monomials: exponents (%d bits each) of %s.'
+                 % (kine_bits, ', '.join(kine_vars)))
+    lines.append('// Terms: monomial, exponents (%d bits each) of %s, coefficient.'
+                 % (par_bits, ', '.join(par_vars)))
+    lines.append('//' + '_' * 76)
+    lines.append('')
+    lines.append('#include "Physics/Strange/XSection/AlamSimoAtharVacasSKAmplitude.h"')
+    lines.append('')
+    lines.append('namespace {')
+    lines.append('')
+    for reaction, description in reactions:
+        lines += table(reaction, description, matrix_element(source, reaction))
+    lines.append('}')
+    lines.append('')
+    lines.append('//' + '_' * 76)
+    lines.append('const genie::SKAmplitudeTable_t & genie::SKAmplitudeTable(int reaction)')
+    lines.append('{')
+    for i, (reaction, description) in enumerate(reactions):
+        lines.append('  static const SKAmplitudeTable_t k%s = {' % reaction)
+        lines.append('    sizeof(kMonomials%s)/sizeof(kMonomials%s[0]), kMonomials%s,'
+                     % (reaction, reaction, reaction))
+        lines.append('    sizeof(kTerms%s)/sizeof(kTerms%s[0]), kTerms%s'
+                     % (reaction, reaction, reaction))
+        lines.append('  };')
+    lines.append('')
+    lines.append('  if      (reaction == 1) return kNN;')
+    lines.append('  else if (reaction == 2) return kNP;')
+    lines.append('  return kPP;')
+    lines.append('}')
+    lines.append('//' + '_' * 76)
+
+    open(out, 'w').write('\n'.join(lines) + '\n')
+
+
+if __name__ == '__main__':
+    main()